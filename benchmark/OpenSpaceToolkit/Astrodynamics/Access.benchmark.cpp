@@ -1,9 +1,14 @@
 /// Apache License 2.0
 
+#include <atomic>
+
 #include "benchmark/benchmark.h"
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Map.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Object/Interval.hpp>
 
@@ -17,11 +22,19 @@
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler/COE.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/SGP4.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/SGP4/TLE.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
 
 using ostk::core::container::Array;
+using ostk::core::container::Map;
+using ostk::core::type::Real;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using RealInterval = ostk::mathematics::object::Interval<Real>;
 
 using ostk::physics::coordinate::Frame;
 using ostk::physics::coordinate::Position;
@@ -29,6 +42,7 @@ using ostk::physics::coordinate::spherical::LLA;
 using ostk::physics::Environment;
 using ostk::physics::environment::gravitational::Earth;
 using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 using ostk::physics::time::Interval;
 using ostk::physics::time::Scale;
@@ -39,8 +53,11 @@ using ostk::astrodynamics::Access;
 using ostk::astrodynamics::access::Generator;
 using ostk::astrodynamics::Trajectory;
 using ostk::astrodynamics::trajectory::Orbit;
+using ostk::astrodynamics::trajectory::orbit::model::Kepler;
+using ostk::astrodynamics::trajectory::orbit::model::kepler::COE;
 using ostk::astrodynamics::trajectory::orbit::model::SGP4;
 using ostk::astrodynamics::trajectory::orbit::model::sgp4::TLE;
+using ostk::astrodynamics::trajectory::State;
 
 static const int DEFAULT_ITERATIONS = 10;
 
@@ -84,5 +101,234 @@ static void benchmark001(benchmark::State& state)
     }
 }
 
+// Parameterized suite
+//
+// Arguments: {station count, satellite count, interval duration [h], step [s], generator type, state filter, mode}
+//  - generator type: 0 = AerRanges, 1 = AerMask
+//  - state filter: 0 = none (pass-through, only used for counting), 1 = horizon half-space rejection
+//  - mode: 0 = serial pair loop, 1 = parallel batch computeAccesses, 2 = serial pair loop with coarse screening
+//
+// Reported counters: pairs per second, and condition evaluations per access.
+
+enum class GeneratorType
+{
+    AerRanges,
+    AerMask
+};
+
+enum class Mode
+{
+    Serial,
+    Parallel,
+    Screening
+};
+
+static Array<Trajectory> generateGroundStationTrajectories(const Size aStationCount)
+{
+    Array<Trajectory> groundStationTrajectories = Array<Trajectory>::Empty();
+
+    for (Size stationIndex = 0; stationIndex < aStationCount; ++stationIndex)
+    {
+        // Stations spread in latitude and longitude
+
+        const Real latitude_deg = -60.0 + 120.0 * ((stationIndex * 7) % 13) / 12.0;
+        const Real longitude_deg = -180.0 + 360.0 * stationIndex / static_cast<Real>(aStationCount);
+
+        const LLA groundStationLla = {Angle::Degrees(latitude_deg), Angle::Degrees(longitude_deg), Length::Meters(5.0)};
+        const Position groundStationPosition = Position::Meters(
+            groundStationLla.toCartesian(Earth::EGM2008.equatorialRadius_, Earth::EGM2008.flattening_), Frame::ITRF()
+        );
+
+        groundStationTrajectories.add(Trajectory::Position(groundStationPosition));
+    }
+
+    return groundStationTrajectories;
+}
+
+static Array<Trajectory> generateSatelliteTrajectories(const Size aSatelliteCount)
+{
+    Array<Trajectory> satelliteTrajectories = Array<Trajectory>::Empty();
+
+    // Walker-like constellation, 8 planes
+
+    const Size planeCount = 8;
+
+    for (Size satelliteIndex = 0; satelliteIndex < aSatelliteCount; ++satelliteIndex)
+    {
+        const Size planeIndex = satelliteIndex % planeCount;
+        const Size slotIndex = satelliteIndex / planeCount;
+
+        const COE coe = {
+            Length::Kilometers(6928.0),
+            0.0,
+            Angle::Degrees(53.0),
+            Angle::Degrees(360.0 * planeIndex / planeCount),
+            Angle::Degrees(0.0),
+            Angle::Degrees(30.0 * slotIndex + 7.5 * planeIndex),
+        };
+
+        const Kepler keplerianModel = {
+            coe,
+            REFERENCE_START_INSTANT,
+            Earth::EGM2008.gravitationalParameter_,
+            Earth::EGM2008.equatorialRadius_,
+            Earth::EGM2008.J2_,
+            Earth::EGM2008.J4_,
+            Kepler::PerturbationType::J2
+        };
+
+        satelliteTrajectories.add(Orbit(keplerianModel, REFERENCE_ENVIRONMENT.accessCelestialObjectWithName("Earth")));
+    }
+
+    return satelliteTrajectories;
+}
+
+static Generator generateGenerator(const GeneratorType& aGeneratorType, const Duration& aStep)
+{
+    const RealInterval rangeRange = RealInterval::Closed(0.0, 1.0e10);
+
+    Generator generator =
+        (aGeneratorType == GeneratorType::AerRanges)
+            ? Generator::AerRanges(
+                  RealInterval::Closed(0.0, 360.0), RealInterval::Closed(10.0, 90.0), rangeRange, REFERENCE_ENVIRONMENT
+              )
+            : Generator::AerMask(
+                  Map<Real, Real>({{0.0, 10.0}, {90.0, 5.0}, {180.0, 15.0}, {270.0, 5.0}, {359.0, 10.0}}),
+                  rangeRange,
+                  REFERENCE_ENVIRONMENT
+              );
+
+    generator.setStep(aStep);
+
+    return generator;
+}
+
+static void benchmarkSuite(benchmark::State& state)
+{
+    const Size stationCount = static_cast<Size>(state.range(0));
+    const Size satelliteCount = static_cast<Size>(state.range(1));
+    const Duration intervalDuration = Duration::Hours(static_cast<Real>(state.range(2)));
+    const Duration step = Duration::Seconds(static_cast<Real>(state.range(3)));
+    const GeneratorType generatorType = static_cast<GeneratorType>(state.range(4));
+    const bool stateFilterIsEnabled = state.range(5) != 0;
+    const Mode mode = static_cast<Mode>(state.range(6));
+
+    const Array<Trajectory> groundStationTrajectories = generateGroundStationTrajectories(stationCount);
+    const Array<Trajectory> satelliteTrajectories = generateSatelliteTrajectories(satelliteCount);
+
+    const Interval interval = Interval::Closed(REFERENCE_START_INSTANT, REFERENCE_START_INSTANT + intervalDuration);
+
+    std::atomic<Size> conditionEvaluationCount = {0};
+
+    Generator generator = generateGenerator(generatorType, step);
+
+    // Condition evaluations are counted through the state filter, which is the first evaluation stage
+
+    generator.setStateFilter(
+        [&conditionEvaluationCount, stateFilterIsEnabled](const State& aFromState, const State& aToState) -> bool
+        {
+            ++conditionEvaluationCount;
+
+            if (!stateFilterIsEnabled)
+            {
+                return true;
+            }
+
+            // Reject "to" positions below the "from" geocentric horizontal plane
+
+            const Position fromPosition = aFromState.getPosition().inFrame(Frame::GCRF(), aFromState.accessInstant());
+            const Position toPosition = aToState.getPosition().inFrame(Frame::GCRF(), aToState.accessInstant());
+
+            return (toPosition.accessCoordinates() - fromPosition.accessCoordinates())
+                       .dot(fromPosition.accessCoordinates()) > 0.0;
+        }
+    );
+
+    if (mode == Mode::Screening)
+    {
+        generator.enableScreening(Angle::Degrees(5.0));
+    }
+
+    Size accessCount = 0;
+
+    for (auto _ : state)
+    {
+        if (mode == Mode::Parallel)
+        {
+            const Array<Array<Array<Access>>> accessesMatrix =
+                generator.computeAccesses(interval, groundStationTrajectories, satelliteTrajectories);
+
+            for (const auto& accessesRow : accessesMatrix)
+            {
+                for (const auto& accesses : accessesRow)
+                {
+                    accessCount += accesses.getSize();
+                }
+            }
+
+            benchmark::DoNotOptimize(accessesMatrix);
+        }
+        else
+        {
+            for (const auto& groundStationTrajectory : groundStationTrajectories)
+            {
+                for (const auto& satelliteTrajectory : satelliteTrajectories)
+                {
+                    const Array<Access> accesses =
+                        generator.computeAccesses(interval, groundStationTrajectory, satelliteTrajectory);
+
+                    accessCount += accesses.getSize();
+
+                    benchmark::DoNotOptimize(accesses);
+                }
+            }
+        }
+    }
+
+    const Real pairCount = static_cast<Real>(stationCount * satelliteCount * state.iterations());
+
+    state.counters["PairsPerSecond"] = benchmark::Counter(pairCount, benchmark::Counter::kIsRate);
+    state.counters["EvaluationsPerAccess"] =
+        (accessCount > 0) ? static_cast<Real>(conditionEvaluationCount.load()) / static_cast<Real>(accessCount) : 0.0;
+}
+
+static void registerSuiteArguments(benchmark::internal::Benchmark* aBenchmark)
+{
+    // Baseline: stations x satellites scaling
+
+    for (const auto& [stationCount, satelliteCount] :
+         Array<std::pair<int, int>> {{1, 1}, {1, 16}, {4, 16}, {8, 64}, {50, 64}})
+    {
+        aBenchmark->Args({stationCount, satelliteCount, 24, 60, 0, 0, 0});
+    }
+
+    // Interval length and step
+
+    for (const auto& [intervalDuration_h, step_s] : Array<std::pair<int, int>> {{168, 60}, {24, 10}, {24, 300}})
+    {
+        aBenchmark->Args({4, 16, intervalDuration_h, step_s, 0, 0, 0});
+    }
+
+    // Generator type, state filter and mode
+
+    for (const int generatorType : {0, 1})
+    {
+        for (const int stateFilter : {0, 1})
+        {
+            for (const int mode : {0, 1, 2})
+            {
+                aBenchmark->Args({8, 64, 24, 60, generatorType, stateFilter, mode});
+            }
+        }
+    }
+}
+
 // Register the functions as a benchmark
 BENCHMARK(benchmark001)->Name("Access | Ground Station <> TLE")->Iterations(DEFAULT_ITERATIONS);
+BENCHMARK(benchmarkSuite)
+    ->Name("Access | Suite")
+    ->ArgNames({"Stations", "Satellites", "Hours", "Step", "Mask", "StateFilter", "Mode"})
+    ->Apply(registerSuiteArguments)
+    ->Iterations(1)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
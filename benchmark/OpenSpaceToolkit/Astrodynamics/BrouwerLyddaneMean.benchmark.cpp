@@ -0,0 +1,164 @@
+/// Apache License 2.0
+
+#include "benchmark/benchmark.h"
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/BrouwerLyddaneMean/BrouwerLyddaneMeanLong.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler/COE.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Size;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::unit::Angle;
+using ostk::physics::unit::Length;
+using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
+
+using ostk::astrodynamics::trajectory::orbit::model::blm::BrouwerLyddaneMeanLong;
+using ostk::astrodynamics::trajectory::orbit::model::kepler::COE;
+
+static const int DEFAULT_ITERATIONS = 10;
+
+// Cartesian states along one sun-synchronous orbit
+
+static Array<COE::CartesianState> generateCartesianStates(const Size &aCount)
+{
+    Array<COE::CartesianState> cartesianStates = Array<COE::CartesianState>::Empty();
+    cartesianStates.reserve(aCount);
+
+    for (Size index = 0; index < aCount; ++index)
+    {
+        const COE coe = {
+            Length::Kilometers(6928.0),
+            1.0e-3,
+            Angle::Degrees(97.5),
+            Angle::Degrees(30.0),
+            Angle::Degrees(60.0),
+            Angle::Degrees(360.0 * index / aCount),
+        };
+
+        cartesianStates.add(
+            coe.getCartesianState(EarthGravitationalModel::EGM2008.gravitationalParameter_, Frame::GCRF())
+        );
+    }
+
+    return cartesianStates;
+}
+
+static Array<BrouwerLyddaneMeanLong> generateElementSets(const Size &aCount)
+{
+    return BrouwerLyddaneMeanLong::FromCartesianStates(
+        generateCartesianStates(aCount), EarthGravitationalModel::EGM2008.gravitationalParameter_, 1
+    );
+}
+
+// Arguments: {element set count}
+
+static void benchmarkCartesian(benchmark::State &state)
+{
+    const Array<COE::CartesianState> cartesianStates = generateCartesianStates(static_cast<Size>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        for (const COE::CartesianState &cartesianState : cartesianStates)
+        {
+            benchmark::DoNotOptimize(BrouwerLyddaneMeanLong::Cartesian(
+                cartesianState, EarthGravitationalModel::EGM2008.gravitationalParameter_
+            ));
+        }
+    }
+
+    state.counters["ConversionsPerSecond"] = benchmark::Counter(
+        static_cast<double>(cartesianStates.getSize()) * static_cast<double>(state.iterations()),
+        benchmark::Counter::kIsRate
+    );
+}
+
+static void benchmarkToCOE(benchmark::State &state)
+{
+    const Array<BrouwerLyddaneMeanLong> elementSets = generateElementSets(static_cast<Size>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        for (const BrouwerLyddaneMeanLong &elementSet : elementSets)
+        {
+            benchmark::DoNotOptimize(elementSet.toCOE());
+        }
+    }
+
+    state.counters["ConversionsPerSecond"] = benchmark::Counter(
+        static_cast<double>(elementSets.getSize()) * static_cast<double>(state.iterations()),
+        benchmark::Counter::kIsRate
+    );
+}
+
+static void benchmarkGetCartesianState(benchmark::State &state)
+{
+    const Array<BrouwerLyddaneMeanLong> elementSets = generateElementSets(static_cast<Size>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        for (const BrouwerLyddaneMeanLong &elementSet : elementSets)
+        {
+            benchmark::DoNotOptimize(
+                elementSet.getCartesianState(EarthGravitationalModel::EGM2008.gravitationalParameter_, Frame::GCRF())
+            );
+        }
+    }
+
+    state.counters["ConversionsPerSecond"] = benchmark::Counter(
+        static_cast<double>(elementSets.getSize()) * static_cast<double>(state.iterations()),
+        benchmark::Counter::kIsRate
+    );
+}
+
+// Arguments: {element set count, thread count}
+
+static void benchmarkFromCartesianStates(benchmark::State &state)
+{
+    const Array<COE::CartesianState> cartesianStates = generateCartesianStates(static_cast<Size>(state.range(0)));
+    const Size threadCount = static_cast<Size>(state.range(1));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(BrouwerLyddaneMeanLong::FromCartesianStates(
+            cartesianStates, EarthGravitationalModel::EGM2008.gravitationalParameter_, threadCount
+        ));
+    }
+
+    state.counters["ConversionsPerSecond"] = benchmark::Counter(
+        static_cast<double>(cartesianStates.getSize()) * static_cast<double>(state.iterations()),
+        benchmark::Counter::kIsRate
+    );
+}
+
+// Register the functions as a benchmark
+BENCHMARK(benchmarkCartesian)
+    ->Name("Brouwer-Lyddane Mean Long | Cartesian")
+    ->ArgNames({"ElementSets"})
+    ->Args({1000})
+    ->Iterations(DEFAULT_ITERATIONS);
+BENCHMARK(benchmarkToCOE)
+    ->Name("Brouwer-Lyddane Mean Long | To COE")
+    ->ArgNames({"ElementSets"})
+    ->Args({1000})
+    ->Iterations(DEFAULT_ITERATIONS);
+BENCHMARK(benchmarkGetCartesianState)
+    ->Name("Brouwer-Lyddane Mean Long | Get Cartesian State")
+    ->ArgNames({"ElementSets"})
+    ->Args({1000})
+    ->Iterations(DEFAULT_ITERATIONS);
+BENCHMARK(benchmarkFromCartesianStates)
+    ->Name("Brouwer-Lyddane Mean Long | From Cartesian States")
+    ->ArgNames({"ElementSets", "Threads"})
+    ->Args({10000, 1})
+    ->Args({10000, 0})
+    ->Iterations(DEFAULT_ITERATIONS)
+    ->UseRealTime();
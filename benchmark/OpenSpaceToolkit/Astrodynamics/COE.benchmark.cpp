@@ -0,0 +1,114 @@
+/// Apache License 2.0
+
+#include "benchmark/benchmark.h"
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler/COE.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Size;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::unit::Angle;
+using ostk::physics::unit::Length;
+using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
+
+using ostk::astrodynamics::trajectory::orbit::model::kepler::COE;
+
+static const int DEFAULT_ITERATIONS = 10;
+
+// Element sets along one orbit, with eccentricity [1e-3]
+
+static Array<COE> generateCOEs(const Size &aCount, const double &anEccentricity)
+{
+    Array<COE> coes = Array<COE>::Empty();
+    coes.reserve(aCount);
+
+    for (Size index = 0; index < aCount; ++index)
+    {
+        coes.add({
+            Length::Kilometers(7000.0),
+            anEccentricity,
+            Angle::Degrees(97.5),
+            Angle::Degrees(30.0),
+            Angle::Degrees(60.0),
+            Angle::Degrees(360.0 * index / aCount),
+        });
+    }
+
+    return coes;
+}
+
+// Arguments: {element set count, eccentricity [1e-3]}
+
+static void benchmarkGetCartesianState(benchmark::State &state)
+{
+    const Array<COE> coes =
+        generateCOEs(static_cast<Size>(state.range(0)), static_cast<double>(state.range(1)) * 1e-3);
+
+    for (auto _ : state)
+    {
+        for (const COE &coe : coes)
+        {
+            benchmark::DoNotOptimize(
+                coe.getCartesianState(EarthGravitationalModel::EGM2008.gravitationalParameter_, Frame::GCRF())
+            );
+        }
+    }
+
+    state.counters["ConversionsPerSecond"] = benchmark::Counter(
+        static_cast<double>(coes.getSize()) * static_cast<double>(state.iterations()), benchmark::Counter::kIsRate
+    );
+}
+
+static void benchmarkCartesian(benchmark::State &state)
+{
+    const Array<COE> coes =
+        generateCOEs(static_cast<Size>(state.range(0)), static_cast<double>(state.range(1)) * 1e-3);
+
+    Array<COE::CartesianState> cartesianStates = Array<COE::CartesianState>::Empty();
+    cartesianStates.reserve(coes.getSize());
+
+    for (const COE &coe : coes)
+    {
+        cartesianStates.add(
+            coe.getCartesianState(EarthGravitationalModel::EGM2008.gravitationalParameter_, Frame::GCRF())
+        );
+    }
+
+    for (auto _ : state)
+    {
+        for (const COE::CartesianState &cartesianState : cartesianStates)
+        {
+            benchmark::DoNotOptimize(
+                COE::Cartesian(cartesianState, EarthGravitationalModel::EGM2008.gravitationalParameter_)
+            );
+        }
+    }
+
+    state.counters["ConversionsPerSecond"] = benchmark::Counter(
+        static_cast<double>(cartesianStates.getSize()) * static_cast<double>(state.iterations()),
+        benchmark::Counter::kIsRate
+    );
+}
+
+// Register the functions as a benchmark
+BENCHMARK(benchmarkGetCartesianState)
+    ->Name("COE | Get Cartesian State")
+    ->ArgNames({"ElementSets", "Eccentricity"})
+    ->Args({1000, 1})
+    ->Args({1000, 500})
+    ->Iterations(DEFAULT_ITERATIONS);
+BENCHMARK(benchmarkCartesian)
+    ->Name("COE | Cartesian")
+    ->ArgNames({"ElementSets", "Eccentricity"})
+    ->Args({1000, 1})
+    ->Args({1000, 500})
+    ->Iterations(DEFAULT_ITERATIONS);
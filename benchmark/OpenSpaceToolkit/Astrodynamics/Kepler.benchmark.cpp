@@ -0,0 +1,157 @@
+/// Apache License 2.0
+
+#include "benchmark/benchmark.h"
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler/COE.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::VectorXd;
+
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+using ostk::physics::unit::Angle;
+using ostk::physics::unit::Length;
+using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
+
+using ostk::astrodynamics::trajectory::orbit::model::Kepler;
+using ostk::astrodynamics::trajectory::orbit::model::kepler::COE;
+
+static const int DEFAULT_ITERATIONS = 10;
+
+static const Real REFERENCE_TOLERANCE = 1e-12;
+
+// Arguments: {mean anomaly count, eccentricity [1e-3]}
+
+static void benchmarkScalar(benchmark::State &state)
+{
+    const Size count = static_cast<Size>(state.range(0));
+    const Real eccentricity = static_cast<double>(state.range(1)) * 1e-3;
+
+    const VectorXd meanAnomalies = VectorXd::LinSpaced(count, 0.0, 2.0 * M_PI);
+
+    for (auto _ : state)
+    {
+        for (Eigen::Index index = 0; index < meanAnomalies.size(); ++index)
+        {
+            benchmark::DoNotOptimize(COE::EccentricAnomalyFromMeanAnomaly(
+                Angle::Radians(meanAnomalies[index]), eccentricity, REFERENCE_TOLERANCE
+            ));
+        }
+    }
+
+    state.counters["AnomaliesPerSecond"] = benchmark::Counter(
+        static_cast<double>(count) * static_cast<double>(state.iterations()), benchmark::Counter::kIsRate
+    );
+}
+
+static void benchmarkArray(benchmark::State &state)
+{
+    const Size count = static_cast<Size>(state.range(0));
+    const VectorXd eccentricities = VectorXd::Constant(1, static_cast<double>(state.range(1)) * 1e-3);
+
+    const VectorXd meanAnomalies = VectorXd::LinSpaced(count, 0.0, 2.0 * M_PI);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(COE::EccentricAnomaliesFromMeanAnomalies(meanAnomalies, eccentricities));
+    }
+
+    state.counters["AnomaliesPerSecond"] = benchmark::Counter(
+        static_cast<double>(count) * static_cast<double>(state.iterations()), benchmark::Counter::kIsRate
+    );
+}
+
+static const Instant REFERENCE_EPOCH = Instant::DateTime(DateTime(2023, 1, 1, 0, 0, 0), Scale::UTC);
+
+static const Array<Kepler::PerturbationType> PERTURBATION_TYPES = {
+    Kepler::PerturbationType::None,
+    Kepler::PerturbationType::J2,
+    Kepler::PerturbationType::J4,
+};
+
+// Arguments: {instant count, perturbation type (0: none, 1: J2, 2: J4)}
+
+static void benchmarkCalculateStateAt(benchmark::State &state)
+{
+    const Size count = static_cast<Size>(state.range(0));
+
+    const COE coe = {
+        Length::Kilometers(6928.0),
+        1.0e-3,
+        Angle::Degrees(97.5),
+        Angle::Degrees(30.0),
+        Angle::Degrees(60.0),
+        Angle::Degrees(0.0),
+    };
+
+    const Kepler kepler = {
+        coe,
+        REFERENCE_EPOCH,
+        EarthGravitationalModel::EGM2008.gravitationalParameter_,
+        EarthGravitationalModel::EGM2008.equatorialRadius_,
+        EarthGravitationalModel::EGM2008.J2_,
+        EarthGravitationalModel::EGM2008.J4_,
+        PERTURBATION_TYPES[static_cast<Size>(state.range(1))],
+    };
+
+    Array<Instant> instants = Array<Instant>::Empty();
+    instants.reserve(count);
+
+    for (Size index = 0; index < count; ++index)
+    {
+        instants.add(REFERENCE_EPOCH + Duration::Seconds(86400.0 * index / count));
+    }
+
+    for (auto _ : state)
+    {
+        for (const Instant &instant : instants)
+        {
+            benchmark::DoNotOptimize(kepler.calculateStateAt(instant));
+        }
+    }
+
+    state.counters["StatesPerSecond"] = benchmark::Counter(
+        static_cast<double>(count) * static_cast<double>(state.iterations()), benchmark::Counter::kIsRate
+    );
+}
+
+// Register the functions as a benchmark
+BENCHMARK(benchmarkScalar)
+    ->Name("Kepler | Eccentric Anomaly | Scalar")
+    ->Args({10000, 1})
+    ->Args({10000, 100})
+    ->Args({10000, 900})
+    ->Iterations(DEFAULT_ITERATIONS);
+BENCHMARK(benchmarkArray)
+    ->Name("Kepler | Eccentric Anomaly | Array")
+    ->Args({10000, 1})
+    ->Args({10000, 100})
+    ->Args({10000, 900})
+    ->Iterations(DEFAULT_ITERATIONS);
+BENCHMARK(benchmarkCalculateStateAt)
+    ->Name("Kepler | Calculate State At")
+    ->ArgNames({"Instants", "Perturbation"})
+    ->Args({1000, 0})
+    ->Args({1000, 1})
+    ->Args({1000, 2})
+    ->Iterations(DEFAULT_ITERATIONS);
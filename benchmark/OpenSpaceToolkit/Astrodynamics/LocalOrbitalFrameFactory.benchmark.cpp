@@ -0,0 +1,121 @@
+/// Apache License 2.0
+
+#include "benchmark/benchmark.h"
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/LocalOrbitalFrameFactory.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+
+using ostk::astrodynamics::trajectory::LocalOrbitalFrameFactory;
+
+static const int DEFAULT_ITERATIONS = 10;
+
+static const Instant REFERENCE_START_INSTANT = Instant::DateTime(DateTime(2023, 1, 1, 0, 0, 0), Scale::UTC);
+
+static const Vector3d REFERENCE_POSITION = {6928030.022926601, -35311.5927995581, -15342.216614716504};
+
+static const Vector3d REFERENCE_VELOCITY = {11.25440758409726, -1055.4321962342744, 7511.291781873726};
+
+static const Array<Shared<const LocalOrbitalFrameFactory>> FACTORIES = {
+    LocalOrbitalFrameFactory::VNC(Frame::GCRF()),
+    LocalOrbitalFrameFactory::LVLH(Frame::GCRF()),
+    LocalOrbitalFrameFactory::QSW(Frame::GCRF()),
+    LocalOrbitalFrameFactory::NED(Frame::GCRF()),
+};
+
+// Distinct instants over one day, so that each request generates a new frame
+
+static Array<Instant> generateInstants(const Size &aCount)
+{
+    Array<Instant> instants = Array<Instant>::Empty();
+    instants.reserve(aCount);
+
+    for (Size index = 0; index < aCount; ++index)
+    {
+        instants.add(REFERENCE_START_INSTANT + Duration::Seconds(86400.0 * index / aCount));
+    }
+
+    return instants;
+}
+
+// Arguments: {instant count, factory (0: VNC, 1: LVLH, 2: QSW, 3: NED)}
+
+static void benchmarkGenerateFrame(benchmark::State &state)
+{
+    const Shared<const LocalOrbitalFrameFactory> factorySPtr = FACTORIES[static_cast<Size>(state.range(1))];
+
+    const Array<Instant> instants = generateInstants(static_cast<Size>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        for (const Instant &instant : instants)
+        {
+            benchmark::DoNotOptimize(factorySPtr->generateFrame(instant, REFERENCE_POSITION, REFERENCE_VELOCITY));
+        }
+    }
+
+    state.counters["FramesPerSecond"] = benchmark::Counter(
+        static_cast<double>(instants.getSize()) * static_cast<double>(state.iterations()), benchmark::Counter::kIsRate
+    );
+}
+
+static void benchmarkGenerateTransform(benchmark::State &state)
+{
+    const Shared<const LocalOrbitalFrameFactory> factorySPtr = FACTORIES[static_cast<Size>(state.range(1))];
+
+    const Array<Instant> instants = generateInstants(static_cast<Size>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        for (const Instant &instant : instants)
+        {
+            benchmark::DoNotOptimize(factorySPtr->generateTransform(instant, REFERENCE_POSITION, REFERENCE_VELOCITY));
+        }
+    }
+
+    state.counters["TransformsPerSecond"] = benchmark::Counter(
+        static_cast<double>(instants.getSize()) * static_cast<double>(state.iterations()), benchmark::Counter::kIsRate
+    );
+}
+
+static void registerArguments(benchmark::internal::Benchmark *aBenchmark)
+{
+    for (const int factory : {0, 1, 2, 3})
+    {
+        aBenchmark->Args({1000, factory});
+    }
+}
+
+// Register the functions as a benchmark
+BENCHMARK(benchmarkGenerateFrame)
+    ->Name("Local Orbital Frame Factory | Generate Frame")
+    ->ArgNames({"Instants", "Factory"})
+    ->Apply(registerArguments)
+    ->Iterations(DEFAULT_ITERATIONS);
+BENCHMARK(benchmarkGenerateTransform)
+    ->Name("Local Orbital Frame Factory | Generate Transform")
+    ->ArgNames({"Instants", "Factory"})
+    ->Apply(registerArguments)
+    ->Iterations(DEFAULT_ITERATIONS);
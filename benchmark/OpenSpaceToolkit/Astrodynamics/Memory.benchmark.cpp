@@ -0,0 +1,421 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+#include "benchmark/benchmark.h"
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Velocity.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/CentralBodyGravity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/PositionDerivative.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/EventCondition/RealCondition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Propagated.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Segment.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Sequence.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/NumericalSolver.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Velocity;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::environment::object::celestial::Earth;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+
+using ostk::astrodynamics::Dynamics;
+using ostk::astrodynamics::dynamics::CentralBodyGravity;
+using ostk::astrodynamics::dynamics::PositionDerivative;
+using ostk::astrodynamics::eventcondition::RealCondition;
+using ostk::astrodynamics::trajectory::orbit::model::Propagated;
+using ostk::astrodynamics::trajectory::Propagator;
+using ostk::astrodynamics::trajectory::Segment;
+using ostk::astrodynamics::trajectory::Sequence;
+using ostk::astrodynamics::trajectory::State;
+using ostk::astrodynamics::trajectory::state::NumericalSolver;
+
+static const int DEFAULT_ITERATIONS = 5;
+
+static const Instant REFERENCE_START_INSTANT = Instant::DateTime(DateTime(2023, 1, 1, 0, 0, 0), Scale::UTC);
+
+// Allocation counters, fed by the allocator hook below while counting is enabled. Sizes are the usable sizes of the
+// blocks, so that allocations and deallocations balance, and the current byte count is relative to the start of the
+// measurement (blocks allocated beforehand and freed during the measurement make it decrease).
+
+namespace
+{
+
+std::atomic<bool> allocationCountingIsEnabled = {false};
+std::atomic<std::uint64_t> allocationCount = {0};
+std::atomic<std::uint64_t> allocatedByteCount = {0};
+std::atomic<std::int64_t> currentByteCount = {0};
+std::atomic<std::int64_t> peakByteCount = {0};
+
+struct AllocationStatistics
+{
+    std::uint64_t allocationCount = 0;     ///< Allocations (including reallocations).
+    std::uint64_t allocatedByteCount = 0;  ///< Bytes allocated.
+    std::int64_t peakByteCount = 0;        ///< Peak of the bytes in use above the start of the measurement.
+};
+
+#if defined(__GLIBC__)
+
+void recordAllocation(void* aPointer)
+{
+    if ((aPointer == nullptr) || !allocationCountingIsEnabled.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    const std::size_t size = malloc_usable_size(aPointer);
+
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocatedByteCount.fetch_add(size, std::memory_order_relaxed);
+
+    const std::int64_t current =
+        currentByteCount.fetch_add(static_cast<std::int64_t>(size), std::memory_order_relaxed) +
+        static_cast<std::int64_t>(size);
+
+    std::int64_t peak = peakByteCount.load(std::memory_order_relaxed);
+
+    while ((current > peak) && !peakByteCount.compare_exchange_weak(peak, current, std::memory_order_relaxed))
+    {
+    }
+}
+
+void recordDeallocation(void* aPointer)
+{
+    if ((aPointer == nullptr) || !allocationCountingIsEnabled.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    currentByteCount.fetch_sub(static_cast<std::int64_t>(malloc_usable_size(aPointer)), std::memory_order_relaxed);
+}
+
+#endif
+
+bool allocationCountingIsAvailable()
+{
+#if defined(__GLIBC__)
+    return true;
+#else
+    return false;
+#endif
+}
+
+void startAllocationCounting()
+{
+    allocationCount = 0;
+    allocatedByteCount = 0;
+    currentByteCount = 0;
+    peakByteCount = 0;
+
+    allocationCountingIsEnabled = true;
+}
+
+AllocationStatistics stopAllocationCounting()
+{
+    allocationCountingIsEnabled = false;
+
+    return {allocationCount.load(), allocatedByteCount.load(), peakByteCount.load()};
+}
+
+}  // namespace
+
+// Counting allocator hook: the C allocation functions are interposed for the whole benchmark executable, so that both
+// operator new (State, Array<State>, ...) and the Eigen dynamic size storage (VectorXd contributions, ...), which goes
+// through malloc directly, are counted, in this executable and in the libraries it loads. Only available with glibc,
+// which exposes its allocator under the __libc_ prefix.
+
+#if defined(__GLIBC__)
+
+extern "C"
+{
+    void* __libc_malloc(std::size_t aSize);
+    void* __libc_calloc(std::size_t aCount, std::size_t aSize);
+    void* __libc_realloc(void* aPointer, std::size_t aSize);
+    void* __libc_memalign(std::size_t anAlignment, std::size_t aSize);
+    void __libc_free(void* aPointer);
+
+    void* malloc(std::size_t aSize) noexcept
+    {
+        void* pointer = __libc_malloc(aSize);
+        recordAllocation(pointer);
+        return pointer;
+    }
+
+    void* calloc(std::size_t aCount, std::size_t aSize) noexcept
+    {
+        void* pointer = __libc_calloc(aCount, aSize);
+        recordAllocation(pointer);
+        return pointer;
+    }
+
+    void* realloc(void* aPointer, std::size_t aSize) noexcept
+    {
+        recordDeallocation(aPointer);
+        void* pointer = __libc_realloc(aPointer, aSize);
+        recordAllocation(pointer);
+        return pointer;
+    }
+
+    void* memalign(std::size_t anAlignment, std::size_t aSize) noexcept
+    {
+        void* pointer = __libc_memalign(anAlignment, aSize);
+        recordAllocation(pointer);
+        return pointer;
+    }
+
+    void* aligned_alloc(std::size_t anAlignment, std::size_t aSize) noexcept
+    {
+        return memalign(anAlignment, aSize);
+    }
+
+    int posix_memalign(void** aPointer, std::size_t anAlignment, std::size_t aSize) noexcept
+    {
+        void* pointer = memalign(anAlignment, aSize);
+
+        if (pointer == nullptr)
+        {
+            return ENOMEM;
+        }
+
+        *aPointer = pointer;
+
+        return 0;
+    }
+
+    void free(void* aPointer) noexcept
+    {
+        recordDeallocation(aPointer);
+        __libc_free(aPointer);
+    }
+}
+
+#endif
+
+static void reportAllocations(
+    benchmark::State &state, const AllocationStatistics &anAllocationStatistics, const Size &aUnitCount
+)
+{
+    const double iterationCount = static_cast<double>(state.iterations());
+    const double unitCount = std::max<double>(1.0, static_cast<double>(aUnitCount));
+
+    state.counters["Allocations"] = static_cast<double>(anAllocationStatistics.allocationCount) / iterationCount;
+    state.counters["AllocatedBytes"] = benchmark::Counter(
+        static_cast<double>(anAllocationStatistics.allocatedByteCount) / iterationCount,
+        benchmark::Counter::kDefaults,
+        benchmark::Counter::kIs1024
+    );
+    state.counters["PeakBytes"] = benchmark::Counter(
+        static_cast<double>(anAllocationStatistics.peakByteCount),
+        benchmark::Counter::kDefaults,
+        benchmark::Counter::kIs1024
+    );
+    state.counters["AllocationsPerStep"] = static_cast<double>(anAllocationStatistics.allocationCount) / unitCount;
+    state.counters["BytesPerStep"] = static_cast<double>(anAllocationStatistics.allocatedByteCount) / unitCount;
+}
+
+static Shared<Celestial> accessEarth()
+{
+    static const Shared<Celestial> earthSPtr = std::make_shared<Celestial>(Earth::Spherical());
+
+    return earthSPtr;
+}
+
+static NumericalSolver generateNumericalSolver()
+{
+    NumericalSolver numericalSolver = {
+        NumericalSolver::LogType::NoLog,
+        NumericalSolver::StepperType::RungeKuttaDopri5,
+        30.0,
+        1.0e-12,
+        1.0e-12,
+    };
+
+    numericalSolver.enableStatistics();
+
+    return numericalSolver;
+}
+
+static Array<Shared<Dynamics>> generateDynamics()
+{
+    return {
+        std::make_shared<PositionDerivative>(),
+        std::make_shared<CentralBodyGravity>(accessEarth()),
+    };
+}
+
+static State generateInitialState()
+{
+    return {
+        REFERENCE_START_INSTANT,
+        Position::Meters({7000000.0, 0.0, 0.0}, Frame::GCRF()),
+        Velocity::MetersPerSecond({0.0, 5335.865450622126, 5335.865450622126}, Frame::GCRF()),
+    };
+}
+
+// Arguments: {propagation duration [hour]}
+
+static void benchmarkPropagation(benchmark::State &state)
+{
+    if (!allocationCountingIsAvailable())
+    {
+        state.SkipWithError("Allocation counting is only available with glibc.");
+        return;
+    }
+
+    const Propagator propagator = {generateNumericalSolver(), generateDynamics()};
+
+    const State initialState = generateInitialState();
+    const Instant endInstant = initialState.accessInstant() + Duration::Hours(static_cast<double>(state.range(0)));
+
+    Size stepCount = 0;
+
+    startAllocationCounting();
+
+    for (auto _ : state)
+    {
+        const Size previousStepCount = propagator.getStatistics().stepCount;
+
+        benchmark::DoNotOptimize(propagator.calculateStateAt(initialState, endInstant));
+
+        stepCount += propagator.getStatistics().stepCount - previousStepCount;
+    }
+
+    reportAllocations(state, stopAllocationCounting(), stepCount);
+}
+
+// Arguments: {repetition count (one hour coast segment per repetition)}
+
+static void benchmarkSequenceSolve(benchmark::State &state)
+{
+    if (!allocationCountingIsAvailable())
+    {
+        state.SkipWithError("Allocation counting is only available with glibc.");
+        return;
+    }
+
+    Sequence sequence = {Array<Segment>::Empty(), generateNumericalSolver(), generateDynamics()};
+
+    sequence.addCoastSegment(std::make_shared<RealCondition>(
+        RealCondition::DurationCondition(RealCondition::Criterion::StrictlyPositive, Duration::Hours(1.0))
+    ));
+
+    const State initialState = generateInitialState();
+    const Size repetitionCount = static_cast<Size>(state.range(0));
+
+    Size stepCount = 0;
+
+    startAllocationCounting();
+
+    for (auto _ : state)
+    {
+        const Sequence::Solution solution = sequence.solve(initialState, repetitionCount);
+
+        for (const Segment::Solution &segmentSolution : solution.segmentSolutions)
+        {
+            stepCount += segmentSolution.integrationStatistics.stepCount;
+        }
+    }
+
+    reportAllocations(state, stopAllocationCounting(), stepCount);
+}
+
+// Arguments: {propagation duration [day]}, with one requested state per minute, all of which end up in the cache
+
+static void benchmarkPropagatedCaching(benchmark::State &state)
+{
+    if (!allocationCountingIsAvailable())
+    {
+        state.SkipWithError("Allocation counting is only available with glibc.");
+        return;
+    }
+
+    const Propagator propagator = {generateNumericalSolver(), generateDynamics()};
+
+    const State initialState = generateInitialState();
+    const Size instantCount = static_cast<Size>(state.range(0)) * 1440;
+
+    Array<Instant> instants = Array<Instant>::Empty();
+    instants.reserve(instantCount);
+
+    for (Size index = 0; index < instantCount; ++index)
+    {
+        instants.add(initialState.accessInstant() + Duration::Minutes(static_cast<double>(index + 1)));
+    }
+
+    Size stepCount = 0;
+    Size cachedStateCount = 0;
+
+    startAllocationCounting();
+
+    for (auto _ : state)
+    {
+        const Size previousStepCount = propagator.getStatistics().stepCount;
+
+        const Propagated propagated = {propagator, initialState};
+
+        benchmark::DoNotOptimize(propagated.calculateStatesAt(instants));
+
+        stepCount += propagator.getStatistics().stepCount - previousStepCount;
+        cachedStateCount = propagated.accessCachedStateArray().getSize();
+    }
+
+    reportAllocations(state, stopAllocationCounting(), stepCount);
+
+    state.counters["CachedStates"] = static_cast<double>(cachedStateCount);
+}
+
+// Register the functions as a benchmark
+BENCHMARK(benchmarkPropagation)
+    ->Name("Memory | Propagation | Calculate State At")
+    ->ArgNames({"Hours"})
+    ->Args({1})
+    ->Args({24})
+    ->Iterations(DEFAULT_ITERATIONS)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(benchmarkSequenceSolve)
+    ->Name("Memory | Sequence | Solve")
+    ->ArgNames({"Repetitions"})
+    ->Args({24})
+    ->Args({168})
+    ->Iterations(DEFAULT_ITERATIONS)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(benchmarkPropagatedCaching)
+    ->Name("Memory | Propagated | Calculate States At")
+    ->ArgNames({"Days"})
+    ->Args({1})
+    ->Args({7})
+    ->Iterations(DEFAULT_ITERATIONS)
+    ->Unit(benchmark::kMillisecond);
@@ -1,38 +1,79 @@
 /// Apache License 2.0
 
+#include <cmath>
+
 #include "benchmark/benchmark.h"
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
 
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/Earth.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Moon.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Sun.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Angle.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/AtmosphericDrag.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/CentralBodyGravity.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/PositionDerivative.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/ThirdBodyGravity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/Thruster.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/SatelliteSystem.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/GuidanceLaw/QLaw.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler/COE.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianPosition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianVelocity.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/NumericalSolver.hpp>
 
 using ostk::core::container::Array;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::Vector3d;
+using ostk::mathematics::object::VectorXd;
 
 using ostk::physics::coordinate::Frame;
 using ostk::physics::coordinate::Position;
 using ostk::physics::coordinate::Velocity;
 using ostk::physics::environment::object::Celestial;
 using ostk::physics::environment::object::celestial::Earth;
+using ostk::physics::environment::object::celestial::Moon;
+using ostk::physics::environment::object::celestial::Sun;
 using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 using ostk::physics::time::Scale;
+using ostk::physics::unit::Angle;
+using ostk::physics::unit::Length;
+using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
+using EarthAtmosphericModel = ostk::physics::environment::atmospheric::Earth;
 
 using ostk::astrodynamics::Dynamics;
+using ostk::astrodynamics::dynamics::AtmosphericDrag;
 using ostk::astrodynamics::dynamics::CentralBodyGravity;
 using ostk::astrodynamics::dynamics::PositionDerivative;
+using ostk::astrodynamics::dynamics::ThirdBodyGravity;
+using ostk::astrodynamics::dynamics::Thruster;
+using ostk::astrodynamics::flight::system::SatelliteSystem;
+using ostk::astrodynamics::guidancelaw::QLaw;
+using ostk::astrodynamics::trajectory::orbit::model::kepler::COE;
 using ostk::astrodynamics::trajectory::Propagator;
 using ostk::astrodynamics::trajectory::State;
+using ostk::astrodynamics::trajectory::state::CoordinateSubset;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianPosition;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianVelocity;
 using ostk::astrodynamics::trajectory::state::NumericalSolver;
 
 static const int DEFAULT_ITERATIONS = 10;
@@ -123,8 +164,337 @@ static void benchmark004(benchmark::State &state)
     }
 }
 
+static Array<State> generateDispersedStates(const Size &aSampleCount)
+{
+    Array<State> states = Array<State>::Empty();
+    states.reserve(aSampleCount);
+
+    for (Size i = 0; i < aSampleCount; ++i)
+    {
+        const double dispersion = static_cast<double>(i) / static_cast<double>(aSampleCount) - 0.5;
+
+        states.add({
+            REFERENCE_START_INSTANT,
+            Position::Meters(
+                REFERENCE_INITIAL_STATE.getPosition().getCoordinates() + 100.0 * dispersion * Vector3d::UnitX(),
+                Frame::GCRF()
+            ),
+            Velocity::MetersPerSecond(
+                REFERENCE_INITIAL_STATE.getVelocity().getCoordinates() + 0.1 * dispersion * Vector3d::UnitY(),
+                Frame::GCRF()
+            ),
+        });
+    }
+
+    return states;
+}
+
+static void benchmarkDispersions(benchmark::State &state, const bool useEnsemble)
+{
+    const Size sampleCount = static_cast<Size>(state.range(0));
+
+    const Shared<Celestial> earth = std::make_shared<Celestial>(Earth::Spherical());
+    const Array<Shared<Dynamics>> dynamics = {
+        std::make_shared<PositionDerivative>(), std::make_shared<CentralBodyGravity>(earth)
+    };
+
+    const Propagator propagator = {
+        REFERENCE_SOLVER,
+        dynamics,
+    };
+
+    const Array<State> initialStates = generateDispersedStates(sampleCount);
+    const Instant endInstant = REFERENCE_START_INSTANT + Duration::Hours(1.0);
+
+    for (auto _ : state)
+    {
+        if (useEnsemble)
+        {
+            benchmark::DoNotOptimize(propagator.calculateEnsembleStatesAt(initialStates, endInstant));
+        }
+        else
+        {
+            for (const State &initialState : initialStates)
+            {
+                benchmark::DoNotOptimize(propagator.calculateStateAt(initialState, endInstant));
+            }
+        }
+    }
+
+    state.counters["SamplesPerSecond"] = benchmark::Counter(
+        static_cast<double>(sampleCount) * static_cast<double>(state.iterations()), benchmark::Counter::kIsRate
+    );
+}
+
+static void benchmark005(benchmark::State &state)
+{
+    benchmarkDispersions(state, false);
+}
+
+static void benchmark006(benchmark::State &state)
+{
+    benchmarkDispersions(state, true);
+}
+
+static void benchmark007(benchmark::State &state)
+{
+    // Orbit raising from the reference orbit, with the mass appended to the reference state
+
+    VectorXd coordinates(7);
+    coordinates << REFERENCE_INITIAL_STATE.getPosition().getCoordinates(),
+        REFERENCE_INITIAL_STATE.getVelocity().getCoordinates(), 200.0;
+
+    const State initialState = {
+        REFERENCE_START_INSTANT,
+        coordinates,
+        Frame::GCRF(),
+        {CartesianPosition::Default(), CartesianVelocity::Default(), CoordinateSubset::Mass()},
+    };
+
+    const COE targetCOE = {
+        Length::Kilometers(7000.0),
+        0.001,
+        Angle::Degrees(98.0),
+        Angle::Degrees(0.0),
+        Angle::Degrees(0.0),
+        Angle::Degrees(0.0),
+    };
+
+    const QLaw::Parameters parameters = {
+        {
+            {COE::Element::SemiMajorAxis, {1.0, 100.0}},
+            {COE::Element::Eccentricity, {1.0, 1e-3}},
+        },
+    };
+
+    const Shared<Celestial> earth = std::make_shared<Celestial>(Earth::Spherical());
+    const Array<Shared<Dynamics>> dynamics = {
+        std::make_shared<PositionDerivative>(),
+        std::make_shared<CentralBodyGravity>(earth),
+        std::make_shared<Thruster>(
+            SatelliteSystem::Default(),
+            std::make_shared<QLaw>(targetCOE, EarthGravitationalModel::EGM2008.gravitationalParameter_, parameters)
+        ),
+    };
+
+    const Propagator propagator = {
+        REFERENCE_SOLVER,
+        dynamics,
+    };
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(propagator.calculateStateAt(initialState, REFERENCE_END_INSTANT));
+    }
+}
+
+// Position derivative counting its evaluations: it is evaluated exactly once per evaluation of the system of equations
+
+class CountingPositionDerivative : public PositionDerivative
+{
+   public:
+    mutable Size evaluationCount = 0;
+
+    virtual void writeContribution(
+        const Instant &anInstant, const VectorXd &x, const Shared<const Frame> &aFrameSPtr, VectorXd &aContribution
+    ) const override
+    {
+        ++evaluationCount;
+
+        PositionDerivative::writeContribution(anInstant, x, aFrameSPtr, aContribution);
+    }
+};
+
+enum class ForceModel
+{
+    Spherical,
+    EGM2008,
+    EGM2008Drag,
+    EGM2008ThirdBody,
+    SphericalQLaw
+};
+
+static const Array<NumericalSolver::StepperType> MATRIX_STEPPER_TYPES = {
+    NumericalSolver::StepperType::RungeKutta4,
+    NumericalSolver::StepperType::RungeKuttaCashKarp54,
+    NumericalSolver::StepperType::RungeKuttaFehlberg78,
+    NumericalSolver::StepperType::RungeKuttaDopri5,
+};
+
+static State matrixInitialState(const ForceModel &aForceModel)
+{
+    const VectorXd positionVelocity = REFERENCE_INITIAL_STATE.getCoordinates();
+
+    // Drag reads the mass, surface area and drag coefficient, and the thruster reads and writes the mass
+
+    if (aForceModel == ForceModel::EGM2008Drag)
+    {
+        VectorXd coordinates(9);
+        coordinates << positionVelocity, 200.0, 1.0, 2.2;
+
+        return {
+            REFERENCE_START_INSTANT,
+            coordinates,
+            Frame::GCRF(),
+            {CartesianPosition::Default(),
+             CartesianVelocity::Default(),
+             CoordinateSubset::Mass(),
+             CoordinateSubset::SurfaceArea(),
+             CoordinateSubset::DragCoefficient()},
+        };
+    }
+
+    if (aForceModel == ForceModel::SphericalQLaw)
+    {
+        VectorXd coordinates(7);
+        coordinates << positionVelocity, 200.0;
+
+        return {
+            REFERENCE_START_INSTANT,
+            coordinates,
+            Frame::GCRF(),
+            {CartesianPosition::Default(), CartesianVelocity::Default(), CoordinateSubset::Mass()},
+        };
+    }
+
+    return REFERENCE_INITIAL_STATE;
+}
+
+static Array<Shared<Dynamics>> matrixDynamics(const ForceModel &aForceModel)
+{
+    if (aForceModel == ForceModel::Spherical)
+    {
+        return {std::make_shared<CentralBodyGravity>(std::make_shared<Celestial>(Earth::Spherical()))};
+    }
+
+    if (aForceModel == ForceModel::SphericalQLaw)
+    {
+        const COE targetCOE = {
+            Length::Kilometers(7000.0),
+            0.001,
+            Angle::Degrees(98.0),
+            Angle::Degrees(0.0),
+            Angle::Degrees(0.0),
+            Angle::Degrees(0.0),
+        };
+
+        const QLaw::Parameters parameters = {
+            {
+                {COE::Element::SemiMajorAxis, {1.0, 100.0}},
+                {COE::Element::Eccentricity, {1.0, 1e-3}},
+            },
+        };
+
+        return {
+            std::make_shared<CentralBodyGravity>(std::make_shared<Celestial>(Earth::Spherical())),
+            std::make_shared<Thruster>(
+                SatelliteSystem::Default(),
+                std::make_shared<QLaw>(targetCOE, EarthGravitationalModel::EGM2008.gravitationalParameter_, parameters)
+            ),
+        };
+    }
+
+    Array<Shared<Dynamics>> dynamics = {
+        std::make_shared<CentralBodyGravity>(std::make_shared<Celestial>(Earth::EGM2008(20, 20))),
+    };
+
+    if (aForceModel == ForceModel::EGM2008Drag)
+    {
+        dynamics.add(std::make_shared<AtmosphericDrag>(std::make_shared<Celestial>(
+            Earth::AtmosphericOnly(std::make_shared<EarthAtmosphericModel>(EarthAtmosphericModel::Type::Exponential))
+        )));
+    }
+
+    if (aForceModel == ForceModel::EGM2008ThirdBody)
+    {
+        dynamics.add(std::make_shared<ThirdBodyGravity>(std::make_shared<Sun>(Sun::Default())));
+        dynamics.add(std::make_shared<ThirdBodyGravity>(std::make_shared<Moon>(Moon::Default())));
+    }
+
+    return dynamics;
+}
+
+static void benchmarkMatrix(benchmark::State &state)
+{
+    const NumericalSolver::StepperType stepperType = MATRIX_STEPPER_TYPES[static_cast<Size>(state.range(0))];
+    const double tolerance = std::pow(10.0, -static_cast<double>(state.range(1)));
+    const ForceModel forceModel = static_cast<ForceModel>(state.range(2));
+
+    const NumericalSolver numericalSolver = {
+        NumericalSolver::LogType::NoLog,
+        stepperType,
+        5.0,
+        tolerance,
+        tolerance,
+    };
+
+    const Shared<CountingPositionDerivative> positionDerivativeSPtr = std::make_shared<CountingPositionDerivative>();
+
+    Array<Shared<Dynamics>> dynamics = matrixDynamics(forceModel);
+    dynamics.add(positionDerivativeSPtr);
+
+    const Propagator propagator = {
+        numericalSolver,
+        dynamics,
+    };
+
+    const State initialState = matrixInitialState(forceModel);
+    const double simulatedDays = (REFERENCE_END_INSTANT - REFERENCE_START_INSTANT).inDays();
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(propagator.calculateStateAt(initialState, REFERENCE_END_INSTANT));
+    }
+
+    const double totalSimulatedDays = simulatedDays * static_cast<double>(state.iterations());
+
+    state.counters["SecondsPerDay"] =
+        benchmark::Counter(totalSimulatedDays, benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+    state.counters["EvaluationsPerDay"] =
+        static_cast<double>(positionDerivativeSPtr->evaluationCount) / totalSimulatedDays;
+}
+
+static void registerMatrixArguments(benchmark::internal::Benchmark *aBenchmark)
+{
+    // Fixed step steppers do not depend on the tolerance, hence only the adaptive steppers sweep tolerances
+
+    for (int forceModel = 0; forceModel <= static_cast<int>(ForceModel::SphericalQLaw); ++forceModel)
+    {
+        for (int stepperType = 0; stepperType < static_cast<int>(MATRIX_STEPPER_TYPES.getSize()); ++stepperType)
+        {
+            for (const int toleranceExponent : {6, 9, 12})
+            {
+                if ((stepperType == 0) && (toleranceExponent != 9))
+                {
+                    continue;
+                }
+
+                aBenchmark->Args({stepperType, toleranceExponent, forceModel});
+            }
+        }
+    }
+}
+
 // Register the functions as a benchmark
 BENCHMARK(benchmark001)->Name("Propagation | Numerical | Spherical")->Iterations(DEFAULT_ITERATIONS);
 BENCHMARK(benchmark002)->Name("Propagation | Numerical | EGM1984 {100, 100}")->Iterations(DEFAULT_ITERATIONS);
 BENCHMARK(benchmark003)->Name("Propagation | Numerical | EGM1996 {100, 100}")->Iterations(DEFAULT_ITERATIONS);
 BENCHMARK(benchmark004)->Name("Propagation | Numerical | EGM2008 {100, 100}")->Iterations(DEFAULT_ITERATIONS);
+BENCHMARK(benchmark005)
+    ->Name("Propagation | Dispersions | Per Sample")
+    ->Arg(100)
+    ->Arg(1000)
+    ->Iterations(DEFAULT_ITERATIONS);
+BENCHMARK(benchmark006)
+    ->Name("Propagation | Dispersions | Ensemble")
+    ->Arg(100)
+    ->Arg(1000)
+    ->Iterations(DEFAULT_ITERATIONS);
+BENCHMARK(benchmark007)->Name("Propagation | Numerical | Thruster QLaw")->Iterations(DEFAULT_ITERATIONS);
+BENCHMARK(benchmarkMatrix)
+    ->Name("Propagation | Matrix")
+    ->ArgNames({"Stepper", "Tolerance", "ForceModel"})
+    ->Apply(registerMatrixArguments)
+    ->Iterations(1)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -0,0 +1,102 @@
+/// Apache License 2.0
+
+#include "benchmark/benchmark.h"
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/SGP4.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/SGP4/TLE.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Size;
+
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+
+using ostk::astrodynamics::trajectory::orbit::model::SGP4;
+using ostk::astrodynamics::trajectory::orbit::model::sgp4::TLE;
+
+static const int DEFAULT_ITERATIONS = 10;
+
+static const TLE REFERENCE_TLE = {
+    "1 25544U 98067A   18207.57531344  .00001549  00000-0  30766-4 0  9995",
+    "2 25544  51.6395 182.3890 0004258   3.1656 107.7911 15.54015933124641",
+};
+
+// Instants spread over one day from the TLE epoch
+
+static Array<Instant> generateInstants(const Size &aCount)
+{
+    Array<Instant> instants = Array<Instant>::Empty();
+    instants.reserve(aCount);
+
+    for (Size index = 0; index < aCount; ++index)
+    {
+        instants.add(REFERENCE_TLE.getEpoch() + Duration::Seconds(86400.0 * index / aCount));
+    }
+
+    return instants;
+}
+
+static const Array<SGP4::OutputFrame> OUTPUT_FRAMES = {
+    SGP4::OutputFrame::GCRF,
+    SGP4::OutputFrame::TEME,
+    SGP4::OutputFrame::TEMEOfEpoch,
+};
+
+// Arguments: {instant count, output frame (0: GCRF, 1: TEME, 2: TEME of epoch)}
+
+static void benchmarkCalculateStateAt(benchmark::State &state)
+{
+    const SGP4 sgp4 = {REFERENCE_TLE, OUTPUT_FRAMES[static_cast<Size>(state.range(1))]};
+
+    const Array<Instant> instants = generateInstants(static_cast<Size>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        for (const Instant &instant : instants)
+        {
+            benchmark::DoNotOptimize(sgp4.calculateStateAt(instant));
+        }
+    }
+
+    state.counters["StatesPerSecond"] = benchmark::Counter(
+        static_cast<double>(instants.getSize()) * static_cast<double>(state.iterations()), benchmark::Counter::kIsRate
+    );
+}
+
+static void benchmarkCalculateStatesAt(benchmark::State &state)
+{
+    const SGP4 sgp4 = {REFERENCE_TLE, OUTPUT_FRAMES[static_cast<Size>(state.range(1))]};
+
+    const Array<Instant> instants = generateInstants(static_cast<Size>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(sgp4.calculateStatesAt(instants));
+    }
+
+    state.counters["StatesPerSecond"] = benchmark::Counter(
+        static_cast<double>(instants.getSize()) * static_cast<double>(state.iterations()), benchmark::Counter::kIsRate
+    );
+}
+
+// Register the functions as a benchmark
+BENCHMARK(benchmarkCalculateStateAt)
+    ->Name("SGP4 | Calculate State At")
+    ->ArgNames({"Instants", "OutputFrame"})
+    ->Args({1000, 0})
+    ->Args({1000, 1})
+    ->Args({1000, 2})
+    ->Iterations(DEFAULT_ITERATIONS);
+BENCHMARK(benchmarkCalculateStatesAt)
+    ->Name("SGP4 | Calculate States At")
+    ->ArgNames({"Instants", "OutputFrame"})
+    ->Args({1000, 0})
+    ->Args({1000, 1})
+    ->Args({1000, 2})
+    ->Iterations(DEFAULT_ITERATIONS);
@@ -0,0 +1,281 @@
+/// Apache License 2.0
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/CentralBodyGravity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/PositionDerivative.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/ThirdBodyGravity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/SGP4.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/SGP4/TLE.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/NumericalSolver.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::physics::Environment;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+
+using ostk::astrodynamics::dynamics::CentralBodyGravity;
+using ostk::astrodynamics::dynamics::PositionDerivative;
+using ostk::astrodynamics::dynamics::ThirdBodyGravity;
+using ostk::astrodynamics::trajectory::Orbit;
+using ostk::astrodynamics::trajectory::orbit::model::SGP4;
+using ostk::astrodynamics::trajectory::orbit::model::sgp4::TLE;
+using ostk::astrodynamics::trajectory::Propagator;
+using ostk::astrodynamics::trajectory::State;
+using ostk::astrodynamics::trajectory::state::NumericalSolver;
+
+static const int DEFAULT_ITERATIONS = 5;
+
+static const TLE REFERENCE_TLE = {
+    "1 25544U 98067A   18207.57531344  .00001549  00000-0  30766-4 0  9995",
+    "2 25544  51.6395 182.3890 0004258   3.1656 107.7911 15.54015933124641",
+};
+
+static const Environment &accessEnvironment()
+{
+    static const Environment environment = Environment::Default();
+
+    return environment;
+}
+
+static Shared<const Celestial> accessEarth()
+{
+    return accessEnvironment().accessCelestialObjectWithName("Earth");
+}
+
+static Array<Instant> generateInstants(const Size &aCount)
+{
+    Array<Instant> instants = Array<Instant>::Empty();
+    instants.reserve(aCount);
+
+    for (Size index = 0; index < aCount; ++index)
+    {
+        instants.add(REFERENCE_TLE.getEpoch() + Duration::Seconds(86400.0 * index / aCount));
+    }
+
+    return instants;
+}
+
+// Run the work items across threads, which claim items from a shared counter (the calling thread takes part)
+
+static void runWork(const Size &aThreadCount, const Size &aWorkCount, const std::function<void(const Size &)> &aWork)
+{
+    std::atomic<Size> workIndexCounter = {0};
+
+    const auto work = [&workIndexCounter, &aWorkCount, &aWork]() -> void
+    {
+        for (Size workIndex = workIndexCounter++; workIndex < aWorkCount; workIndex = workIndexCounter++)
+        {
+            aWork(workIndex);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(aThreadCount - 1);
+
+    for (Size threadIndex = 1; threadIndex < aThreadCount; ++threadIndex)
+    {
+        threads.emplace_back(work);
+    }
+
+    work();
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+}
+
+// Run the same workload with the thread count given as first argument, and report the speedup and the parallel
+// efficiency relative to the single thread run of the same workload (thread counts are registered in increasing
+// order). Caches are warmed up beforehand, so that every thread count measures the same steady state.
+
+static void benchmarkScaling(
+    benchmark::State &state,
+    const std::string &aWorkloadName,
+    const Size &aWorkCount,
+    const std::function<void(const Size &)> &aWork
+)
+{
+    static std::map<std::string, double> singleThreadDurations;
+
+    const Size threadCount = static_cast<Size>(state.range(0));
+
+    runWork(1, aWorkCount, aWork);
+
+    const auto startTime = std::chrono::steady_clock::now();
+
+    for (auto _ : state)
+    {
+        runWork(threadCount, aWorkCount, aWork);
+    }
+
+    const double duration_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count() /
+                              static_cast<double>(state.iterations());
+
+    if (threadCount == 1)
+    {
+        singleThreadDurations[aWorkloadName] = duration_s;
+    }
+
+    state.counters["WorkPerSecond"] = benchmark::Counter(
+        static_cast<double>(aWorkCount) * static_cast<double>(state.iterations()), benchmark::Counter::kIsRate
+    );
+
+    const auto singleThreadDurationIt = singleThreadDurations.find(aWorkloadName);
+
+    if (singleThreadDurationIt != singleThreadDurations.end())
+    {
+        const double speedup = singleThreadDurationIt->second / duration_s;
+
+        state.counters["Speedup"] = speedup;
+        state.counters["Efficiency"] = speedup / static_cast<double>(threadCount);
+    }
+}
+
+// Work item: pass lookup at one instant, on an orbit shared by all threads (pass cache guarded by a shared mutex)
+
+static void benchmarkOrbitGetPassAt(benchmark::State &state)
+{
+    const Orbit orbit = {SGP4(REFERENCE_TLE), accessEarth()};
+
+    const Array<Instant> instants = generateInstants(10000);
+
+    benchmarkScaling(
+        state,
+        "Orbit::getPassAt",
+        instants.getSize(),
+        [&orbit, &instants](const Size &aWorkIndex) -> void
+        {
+            benchmark::DoNotOptimize(orbit.getPassAt(instants[aWorkIndex]));
+        }
+    );
+}
+
+// Work item: 30 minute propagation with dynamics backed by the default environment (Earth gravity field, Sun and Moon
+// third body gravity), shared by all threads. The propagator is copied per work item, as its numerical solver is not
+// meant to be shared.
+
+static void benchmarkEnvironmentDynamics(benchmark::State &state)
+{
+    const NumericalSolver numericalSolver = {
+        NumericalSolver::LogType::NoLog,
+        NumericalSolver::StepperType::RungeKuttaDopri5,
+        30.0,
+        1.0e-10,
+        1.0e-10,
+    };
+
+    const Propagator propagator = {
+        numericalSolver,
+        {
+            std::make_shared<PositionDerivative>(),
+            std::make_shared<CentralBodyGravity>(accessEnvironment().accessCelestialObjectWithName("Earth")),
+            std::make_shared<ThirdBodyGravity>(accessEnvironment().accessCelestialObjectWithName("Sun")),
+            std::make_shared<ThirdBodyGravity>(accessEnvironment().accessCelestialObjectWithName("Moon")),
+        },
+    };
+
+    const State initialState = SGP4(REFERENCE_TLE).calculateStateAt(REFERENCE_TLE.getEpoch());
+
+    benchmarkScaling(
+        state,
+        "Environment dynamics",
+        32,
+        [&propagator, &initialState](const Size &aWorkIndex) -> void
+        {
+            const Propagator workPropagator = propagator;
+
+            benchmark::DoNotOptimize(workPropagator.calculateStateAt(
+                initialState, initialState.accessInstant() + Duration::Minutes(30.0 + static_cast<double>(aWorkIndex))
+            ));
+        }
+    );
+}
+
+// Work item: 100 states from a trajectory shared by all threads
+
+static void benchmarkTrajectoryGetStatesAt(benchmark::State &state)
+{
+    const Orbit orbit = {SGP4(REFERENCE_TLE), accessEarth()};
+
+    const Size chunkSize = 100;
+    const Array<Instant> instants = generateInstants(100 * chunkSize);
+
+    Array<Array<Instant>> instantChunks = Array<Array<Instant>>::Empty();
+
+    for (Size index = 0; index < instants.getSize(); ++index)
+    {
+        if ((index % chunkSize) == 0)
+        {
+            instantChunks.add(Array<Instant>::Empty());
+        }
+
+        instantChunks.accessLast().add(instants[index]);
+    }
+
+    benchmarkScaling(
+        state,
+        "Trajectory::getStatesAt",
+        instantChunks.getSize(),
+        [&orbit, &instantChunks](const Size &aWorkIndex) -> void
+        {
+            benchmark::DoNotOptimize(orbit.getStatesAt(instantChunks[aWorkIndex]));
+        }
+    );
+}
+
+static void registerThreadCounts(benchmark::internal::Benchmark *aBenchmark)
+{
+    const Size hardwareConcurrency = std::max<Size>(1, std::thread::hardware_concurrency());
+
+    for (Size threadCount = 1; threadCount <= hardwareConcurrency; threadCount *= 2)
+    {
+        aBenchmark->Args({static_cast<int64_t>(threadCount)});
+    }
+}
+
+// Register the functions as a benchmark
+BENCHMARK(benchmarkOrbitGetPassAt)
+    ->Name("Scaling | Orbit | Get Pass At")
+    ->ArgNames({"Threads"})
+    ->Apply(registerThreadCounts)
+    ->Iterations(DEFAULT_ITERATIONS)
+    ->UseRealTime();
+BENCHMARK(benchmarkEnvironmentDynamics)
+    ->Name("Scaling | Propagation | Environment Dynamics")
+    ->ArgNames({"Threads"})
+    ->Apply(registerThreadCounts)
+    ->Iterations(DEFAULT_ITERATIONS)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(benchmarkTrajectoryGetStatesAt)
+    ->Name("Scaling | Trajectory | Get States At")
+    ->ArgNames({"Threads"})
+    ->Apply(registerThreadCounts)
+    ->Iterations(DEFAULT_ITERATIONS)
+    ->UseRealTime();
@@ -0,0 +1,86 @@
+/// Apache License 2.0
+
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+extern char **environ;
+
+// Startup is measured on child processes, as static initialization only runs once per process: frames, coordinate
+// subsets and brokers are constructed on first use, so that loading the library (or importing the Python module)
+// does not pay for them.
+
+// Spawn a process with the given arguments, its output discarded, and wait for it. Returns true if it exited with a
+// zero status.
+
+static bool spawnAndWait(const std::vector<std::string> &anArgumentArray)
+{
+    std::vector<char *> arguments;
+
+    for (const std::string &argument : anArgumentArray)
+    {
+        arguments.push_back(const_cast<char *>(argument.c_str()));
+    }
+
+    arguments.push_back(nullptr);
+
+    posix_spawn_file_actions_t fileActions;
+    posix_spawn_file_actions_init(&fileActions);
+    posix_spawn_file_actions_addopen(&fileActions, STDOUT_FILENO, "/dev/null", O_WRONLY, 0);
+    posix_spawn_file_actions_addopen(&fileActions, STDERR_FILENO, "/dev/null", O_WRONLY, 0);
+
+    pid_t pid;
+
+    const int spawnStatus = posix_spawnp(&pid, arguments[0], &fileActions, nullptr, arguments.data(), environ);
+
+    posix_spawn_file_actions_destroy(&fileActions);
+
+    if (spawnStatus != 0)
+    {
+        return false;
+    }
+
+    int status = 0;
+
+    if (waitpid(pid, &status, 0) != pid)
+    {
+        return false;
+    }
+
+    return WIFEXITED(status) && (WEXITSTATUS(status) == 0);
+}
+
+static void benchmarkStartup(benchmark::State &state, const std::vector<std::string> &anArgumentArray)
+{
+    for (auto _ : state)
+    {
+        if (!spawnAndWait(anArgumentArray))
+        {
+            state.SkipWithError("Process failed.");
+
+            break;
+        }
+    }
+}
+
+// This executable (linked to the shared library), listing benchmarks that match none
+
+static void benchmarkLibraryStartup(benchmark::State &state)
+{
+    benchmarkStartup(state, {"/proc/self/exe", "--benchmark_list_tests=true", "--benchmark_filter=^$"});
+}
+
+static void benchmarkPythonImport(benchmark::State &state)
+{
+    benchmarkStartup(state, {"python3", "-c", "import ostk.astrodynamics"});
+}
+
+// Register the functions as a benchmark
+BENCHMARK(benchmarkLibraryStartup)->Name("Startup | Library")->Unit(benchmark::kMillisecond)->Iterations(20);
+BENCHMARK(benchmarkPythonImport)->Name("Startup | Python Import")->Unit(benchmark::kMillisecond)->Iterations(10);
@@ -0,0 +1,107 @@
+/// Apache License 2.0
+
+#include "benchmark/benchmark.h"
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Velocity.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Velocity;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+
+using ostk::astrodynamics::trajectory::State;
+
+static const int DEFAULT_ITERATIONS = 10;
+
+static const Instant REFERENCE_START_INSTANT = Instant::DateTime(DateTime(2023, 1, 1, 0, 0, 0), Scale::UTC);
+
+// States at distinct instants over one day, so that frame transforms are not served from a cache
+
+static Array<State> generateStates(const Size &aCount, const Shared<const Frame> &aFrameSPtr)
+{
+    Array<State> states = Array<State>::Empty();
+    states.reserve(aCount);
+
+    for (Size index = 0; index < aCount; ++index)
+    {
+        states.add({
+            REFERENCE_START_INSTANT + Duration::Seconds(86400.0 * index / aCount),
+            Position::Meters({6928030.022926601, -35311.5927995581, -15342.216614716504}, aFrameSPtr),
+            Velocity::MetersPerSecond({11.25440758409726, -1055.4321962342744, 7511.291781873726}, aFrameSPtr),
+        });
+    }
+
+    return states;
+}
+
+static void benchmarkInFrame(
+    benchmark::State &state, const Shared<const Frame> &aFromFrameSPtr, const Shared<const Frame> &aToFrameSPtr
+)
+{
+    const Array<State> states = generateStates(static_cast<Size>(state.range(0)), aFromFrameSPtr);
+
+    for (auto _ : state)
+    {
+        for (const State &aState : states)
+        {
+            benchmark::DoNotOptimize(aState.inFrame(aToFrameSPtr));
+        }
+    }
+
+    state.counters["StatesPerSecond"] = benchmark::Counter(
+        static_cast<double>(states.getSize()) * static_cast<double>(state.iterations()), benchmark::Counter::kIsRate
+    );
+}
+
+// Arguments: {state count}
+
+static void benchmarkGcrfToGcrf(benchmark::State &state)
+{
+    benchmarkInFrame(state, Frame::GCRF(), Frame::GCRF());
+}
+
+static void benchmarkGcrfToItrf(benchmark::State &state)
+{
+    benchmarkInFrame(state, Frame::GCRF(), Frame::ITRF());
+}
+
+static void benchmarkItrfToGcrf(benchmark::State &state)
+{
+    benchmarkInFrame(state, Frame::ITRF(), Frame::GCRF());
+}
+
+// Register the functions as a benchmark
+BENCHMARK(benchmarkGcrfToGcrf)
+    ->Name("State | In Frame | GCRF -> GCRF")
+    ->ArgNames({"States"})
+    ->Args({1000})
+    ->Iterations(DEFAULT_ITERATIONS);
+BENCHMARK(benchmarkGcrfToItrf)
+    ->Name("State | In Frame | GCRF -> ITRF")
+    ->ArgNames({"States"})
+    ->Args({1000})
+    ->Iterations(DEFAULT_ITERATIONS);
+BENCHMARK(benchmarkItrfToGcrf)
+    ->Name("State | In Frame | ITRF -> GCRF")
+    ->ArgNames({"States"})
+    ->Args({1000})
+    ->Iterations(DEFAULT_ITERATIONS);
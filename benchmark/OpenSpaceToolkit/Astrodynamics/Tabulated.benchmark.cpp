@@ -0,0 +1,137 @@
+/// Apache License 2.0
+
+#include "benchmark/benchmark.h"
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Model/Tabulated.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler/COE.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Size;
+
+using ostk::mathematics::curvefitting::Interpolator;
+
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+using ostk::physics::unit::Angle;
+using ostk::physics::unit::Length;
+using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
+
+using ostk::astrodynamics::trajectory::model::Tabulated;
+using ostk::astrodynamics::trajectory::orbit::model::Kepler;
+using ostk::astrodynamics::trajectory::orbit::model::kepler::COE;
+using ostk::astrodynamics::trajectory::State;
+
+static const int DEFAULT_ITERATIONS = 10;
+
+static const Instant REFERENCE_START_INSTANT = Instant::DateTime(DateTime(2023, 1, 1, 0, 0, 0), Scale::UTC);
+
+static const Duration REFERENCE_DURATION = Duration::Days(1.0);
+
+static const Size QUERY_COUNT = 1000;
+
+static const Array<Interpolator::Type> INTERPOLATION_TYPES = {
+    Interpolator::Type::Linear,
+    Interpolator::Type::CubicSpline,
+    Interpolator::Type::BarycentricRational,
+};
+
+// Instants over one day, at fractions (index + anOffset) / aDivisor of the day
+
+static Array<Instant> generateInstants(const Size &aCount, const double &anOffset, const double &aDivisor)
+{
+    Array<Instant> instants = Array<Instant>::Empty();
+    instants.reserve(aCount);
+
+    for (Size index = 0; index < aCount; ++index)
+    {
+        instants.add(
+            REFERENCE_START_INSTANT + REFERENCE_DURATION * ((static_cast<double>(index) + anOffset) / aDivisor)
+        );
+    }
+
+    return instants;
+}
+
+// Table of two-body states over one day, bounds included
+
+static Array<State> generateTableStates(const Size &aCount)
+{
+    const COE coe = {
+        Length::Kilometers(6928.0),
+        1.0e-3,
+        Angle::Degrees(97.5),
+        Angle::Degrees(30.0),
+        Angle::Degrees(60.0),
+        Angle::Degrees(0.0),
+    };
+
+    const Kepler kepler = {
+        coe,
+        REFERENCE_START_INSTANT,
+        EarthGravitationalModel::EGM2008.gravitationalParameter_,
+        EarthGravitationalModel::EGM2008.equatorialRadius_,
+        0.0,
+        0.0,
+        Kepler::PerturbationType::None,
+    };
+
+    return kepler.calculateStatesAt(generateInstants(aCount, 0.0, static_cast<double>(aCount - 1)));
+}
+
+// Arguments: {table size, interpolation type (0: linear, 1: cubic spline, 2: barycentric rational)}
+
+static void benchmarkCalculateStatesAt(benchmark::State &state)
+{
+    const Tabulated tabulated = {
+        generateTableStates(static_cast<Size>(state.range(0))),
+        INTERPOLATION_TYPES[static_cast<Size>(state.range(1))],
+    };
+
+    // Query instants are spread over the table span, mostly between table rows
+
+    const Array<Instant> instants = generateInstants(QUERY_COUNT, 0.5, static_cast<double>(QUERY_COUNT));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(tabulated.calculateStatesAt(instants));
+    }
+
+    state.counters["StatesPerSecond"] = benchmark::Counter(
+        static_cast<double>(instants.getSize()) * static_cast<double>(state.iterations()), benchmark::Counter::kIsRate
+    );
+}
+
+static void registerArguments(benchmark::internal::Benchmark *aBenchmark)
+{
+    for (const int tableSize : {100, 1000, 10000, 100000})
+    {
+        for (const int interpolationType : {0, 1, 2})
+        {
+            aBenchmark->Args({tableSize, interpolationType});
+        }
+    }
+}
+
+// Register the functions as a benchmark
+BENCHMARK(benchmarkCalculateStatesAt)
+    ->Name("Tabulated | Calculate States At")
+    ->ArgNames({"TableSize", "Interpolation"})
+    ->Apply(registerArguments)
+    ->Iterations(DEFAULT_ITERATIONS);
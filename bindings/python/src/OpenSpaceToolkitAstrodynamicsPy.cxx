@@ -1,6 +1,7 @@
 /// Apache License 2.0
 
 #include <OpenSpaceToolkitAstrodynamicsPy/Utility/ArrayCasting.hpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Utility/CachedObject.hpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Utility/ShiftToString.hpp>
 #include <pybind11/eigen.h>
 #include <pybind11/numpy.h>
@@ -8,16 +9,86 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
+
 #include <OpenSpaceToolkitAstrodynamicsPy/Access.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Conjunction.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Dynamics.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/EventCondition.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/ExecutionContext.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Flight.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/GuidanceLaw.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/ModelCache.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/OrbitDetermination.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/RootSolver.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Solver.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Tracer.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Trajectory.cpp>
 
+// Submodules registered on first access, rather than at import: scripts that only need the trajectory submodule
+// (e.g. TLE and SGP4) do not pay for their class registrations. Submodules are listed in registration order, and
+// registering one first registers the ones listed before it, so that the types they rely on are known.
+
+struct OpenSpaceToolkitAstrodynamicsPy_LazySubmodule
+{
+    std::vector<std::string> attributeNames;  // Attributes added to the module by the registration
+    void (*registerSubmodule)(pybind11::module&);
+    bool isRegistered;
+};
+
+inline std::vector<OpenSpaceToolkitAstrodynamicsPy_LazySubmodule>& OpenSpaceToolkitAstrodynamicsPy_LazySubmodules()
+{
+    static std::vector<OpenSpaceToolkitAstrodynamicsPy_LazySubmodule> lazySubmodules = {
+        {{"Access", "access"}, &OpenSpaceToolkitAstrodynamicsPy_Access, false},
+        {{"conjunction"}, &OpenSpaceToolkitAstrodynamicsPy_Conjunction, false},
+        {{"EventCondition", "event_condition"}, &OpenSpaceToolkitAstrodynamicsPy_EventCondition, false},
+        {{"GuidanceLaw", "guidance_law"}, &OpenSpaceToolkitAstrodynamicsPy_GuidanceLaw, false},
+        {{"orbit_determination"}, &OpenSpaceToolkitAstrodynamicsPy_OrbitDetermination, false},
+    };
+
+    return lazySubmodules;
+}
+
+// Registration happens with the GIL held, hence is not concurrent
+
+inline pybind11::object OpenSpaceToolkitAstrodynamicsPy_GetLazyAttribute(
+    pybind11::module& aModule, const std::string& anAttributeName
+)
+{
+    std::vector<OpenSpaceToolkitAstrodynamicsPy_LazySubmodule>& lazySubmodules =
+        OpenSpaceToolkitAstrodynamicsPy_LazySubmodules();
+
+    const auto lazySubmoduleIt = std::find_if(
+        lazySubmodules.begin(),
+        lazySubmodules.end(),
+        [&anAttributeName](const OpenSpaceToolkitAstrodynamicsPy_LazySubmodule& aLazySubmodule) -> bool
+        {
+            return std::find(
+                       aLazySubmodule.attributeNames.begin(), aLazySubmodule.attributeNames.end(), anAttributeName
+                   ) != aLazySubmodule.attributeNames.end();
+        }
+    );
+
+    if (lazySubmoduleIt == lazySubmodules.end())
+    {
+        throw pybind11::attribute_error("module 'ostk.astrodynamics' has no attribute '" + anAttributeName + "'");
+    }
+
+    for (auto it = lazySubmodules.begin(); it != std::next(lazySubmoduleIt); ++it)
+    {
+        if (!it->isRegistered)
+        {
+            it->isRegistered = true;
+            it->registerSubmodule(aModule);
+        }
+    }
+
+    return aModule.attr(anAttributeName.c_str());
+}
+
 PYBIND11_MODULE(OpenSpaceToolkitAstrodynamicsPy, m)
 {
     // Add optional docstring for package OpenSpaceToolkitAstrodynamicsPy
@@ -37,12 +108,44 @@ PYBIND11_MODULE(OpenSpaceToolkitAstrodynamicsPy, m)
     OpenSpaceToolkitAstrodynamicsPy_Solver(m);
     OpenSpaceToolkitAstrodynamicsPy_RootSolver(m);
 
+    OpenSpaceToolkitAstrodynamicsPy_Tracer(m);
+    OpenSpaceToolkitAstrodynamicsPy_ExecutionContext(m);
+    OpenSpaceToolkitAstrodynamicsPy_ModelCache(m);
+
     // Add python submodules to OpenSpaceToolkitAstrodynamicsPy
     OpenSpaceToolkitAstrodynamicsPy_Flight(m);
     OpenSpaceToolkitAstrodynamicsPy_Dynamics(m);
     OpenSpaceToolkitAstrodynamicsPy_Trajectory(m);
-    OpenSpaceToolkitAstrodynamicsPy_Access(m);
-    OpenSpaceToolkitAstrodynamicsPy_Conjunction(m);
-    OpenSpaceToolkitAstrodynamicsPy_EventCondition(m);
-    OpenSpaceToolkitAstrodynamicsPy_GuidanceLaw(m);
+
+    // Register the other submodules on first access (module level __getattr__ and __dir__, see PEP 562)
+    m.def(
+        "__getattr__",
+        [m](const std::string& anAttributeName) mutable -> pybind11::object
+        {
+            return OpenSpaceToolkitAstrodynamicsPy_GetLazyAttribute(m, anAttributeName);
+        },
+        pybind11::arg("name")
+    );
+
+    m.def(
+        "__dir__",
+        [m]() -> pybind11::list
+        {
+            pybind11::list attributeNames = pybind11::list(m.attr("__dict__").attr("keys")());
+
+            for (const OpenSpaceToolkitAstrodynamicsPy_LazySubmodule& lazySubmodule :
+                 OpenSpaceToolkitAstrodynamicsPy_LazySubmodules())
+            {
+                if (!lazySubmodule.isRegistered)
+                {
+                    for (const std::string& attributeName : lazySubmodule.attributeNames)
+                    {
+                        attributeNames.append(attributeName);
+                    }
+                }
+            }
+
+            return attributeNames;
+        }
+    );
 }
@@ -2,7 +2,14 @@
 
 #include <OpenSpaceToolkit/Astrodynamics/Access.hpp>
 
+#include <OpenSpaceToolkitAstrodynamicsPy/Access/AerFilter.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Access/CoverageGenerator.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Access/CrosslinkGenerator.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Access/Generator.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Access/IncrementalGenerator.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Access/IntervalSet.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Access/IntervalTree.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Access/SensorFilter.cpp>
 
 inline void OpenSpaceToolkitAstrodynamicsPy_Access(pybind11::module& aModule)
 {
@@ -198,5 +205,12 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Access(pybind11::module& aModule)
     auto access = aModule.def_submodule("access");
 
     // Add elements to "access" module
+    OpenSpaceToolkitAstrodynamicsPy_Access_AerFilter(access);
+    OpenSpaceToolkitAstrodynamicsPy_Access_SensorFilter(access);
     OpenSpaceToolkitAstrodynamicsPy_Access_Generator(access);
+    OpenSpaceToolkitAstrodynamicsPy_Access_IncrementalGenerator(access);
+    OpenSpaceToolkitAstrodynamicsPy_Access_CoverageGenerator(access);
+    OpenSpaceToolkitAstrodynamicsPy_Access_CrosslinkGenerator(access);
+    OpenSpaceToolkitAstrodynamicsPy_Access_IntervalSet(access);
+    OpenSpaceToolkitAstrodynamicsPy_Access_IntervalTree(access);
 }
@@ -0,0 +1,221 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Access/AerFilter.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Access_AerFilter(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::astrodynamics::access::AerFilter;
+
+    class_<AerFilter>(
+        aModule,
+        "AerFilter",
+        R"doc(
+            Declarative AER filter.
+
+            AER filters are built from azimuth, elevation and range intervals or from azimuth-elevation masks, and
+            composed with `&`, `|` and `~`. They are evaluated natively, hence an access generator using an AER filter
+            never calls back into Python during the access search.
+
+        )doc"
+    )
+
+        .def(
+            "__call__",
+            &AerFilter::operator(),
+            R"doc(
+                Evaluate the filter.
+
+                Args:
+                    aer (AER): The AER.
+
+                Returns:
+                    bool: True if the AER passes the filter.
+
+            )doc",
+            arg("aer")
+        )
+        .def(
+            "evaluate",
+            &AerFilter::evaluate,
+            R"doc(
+                Evaluate the filter on raw AER coordinates, without constructing an AER.
+
+                Args:
+                    azimuth (float): The azimuth [rad], in [0, 2pi).
+                    elevation (float): The elevation [rad], in [-pi/2, pi/2].
+                    range (float): The range [m].
+
+                Returns:
+                    bool: True if the AER coordinates pass the filter.
+
+            )doc",
+            arg("azimuth"),
+            arg("elevation"),
+            arg("range")
+        )
+
+        .def(
+            "__and__",
+            [](const AerFilter& aFilter, const AerFilter& anotherFilter) -> AerFilter
+            {
+                return AerFilter::And({aFilter, anotherFilter});
+            },
+            is_operator()
+        )
+        .def(
+            "__or__",
+            [](const AerFilter& aFilter, const AerFilter& anotherFilter) -> AerFilter
+            {
+                return AerFilter::Or({aFilter, anotherFilter});
+            },
+            is_operator()
+        )
+        .def(
+            "__invert__",
+            [](const AerFilter& aFilter) -> AerFilter
+            {
+                return AerFilter::Not(aFilter);
+            }
+        )
+
+        .def(
+            "is_defined",
+            &AerFilter::isDefined,
+            R"doc(
+                Check if the filter is defined.
+
+                Returns:
+                    bool: True if the filter is defined.
+
+            )doc"
+        )
+
+        .def_static(
+            "undefined",
+            &AerFilter::Undefined,
+            R"doc(
+                Create an undefined filter.
+
+                Returns:
+                    AerFilter: An undefined filter.
+
+            )doc"
+        )
+        .def_static(
+            "azimuth",
+            &AerFilter::Azimuth,
+            R"doc(
+                Create a filter on azimuth.
+
+                Args:
+                    azimuth_interval (RealInterval): The azimuth interval [deg], in [0, 360].
+
+                Returns:
+                    AerFilter: The filter.
+
+            )doc",
+            arg("azimuth_interval")
+        )
+        .def_static(
+            "elevation",
+            &AerFilter::Elevation,
+            R"doc(
+                Create a filter on elevation.
+
+                Args:
+                    elevation_interval (RealInterval): The elevation interval [deg], in [-90, 90].
+
+                Returns:
+                    AerFilter: The filter.
+
+            )doc",
+            arg("elevation_interval")
+        )
+        .def_static(
+            "range",
+            &AerFilter::Range,
+            R"doc(
+                Create a filter on range.
+
+                Args:
+                    range_interval (RealInterval): The range interval [m].
+
+                Returns:
+                    AerFilter: The filter.
+
+            )doc",
+            arg("range_interval")
+        )
+        .def_static(
+            "ranges",
+            &AerFilter::Ranges,
+            R"doc(
+                Create a filter on azimuth, elevation and range intervals. Undefined intervals are not filtered on.
+
+                Args:
+                    azimuth_interval (RealInterval): The azimuth interval [deg].
+                    elevation_interval (RealInterval): The elevation interval [deg].
+                    range_interval (RealInterval): The range interval [m].
+
+                Returns:
+                    AerFilter: The filter.
+
+            )doc",
+            arg("azimuth_interval"),
+            arg("elevation_interval"),
+            arg("range_interval")
+        )
+        .def_static(
+            "mask",
+            &AerFilter::Mask,
+            R"doc(
+                Create a filter on an azimuth-elevation mask, and a range interval.
+
+                The minimum elevation is linearly interpolated in azimuth between the mask points.
+
+                Args:
+                    azimuth_elevation_mask (dict[float, float]): The mask [deg], mapping azimuths to minimum elevations.
+                    range_interval (RealInterval): The range interval [m]. Not filtered on if undefined.
+
+                Returns:
+                    AerFilter: The filter.
+
+            )doc",
+            arg("azimuth_elevation_mask"),
+            arg("range_interval")
+        )
+        .def_static(
+            "all_of",
+            &AerFilter::And,
+            R"doc(
+                Create the conjunction of filters.
+
+                Args:
+                    filters (list[AerFilter]): The filters.
+
+                Returns:
+                    AerFilter: A filter passing if all filters pass.
+
+            )doc",
+            arg("filters")
+        )
+        .def_static(
+            "any_of",
+            &AerFilter::Or,
+            R"doc(
+                Create the disjunction of filters.
+
+                Args:
+                    filters (list[AerFilter]): The filters.
+
+                Returns:
+                    AerFilter: A filter passing if any filter passes.
+
+            )doc",
+            arg("filters")
+        )
+
+        ;
+}
@@ -0,0 +1,205 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Access/CoverageGenerator.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Access_CoverageGenerator(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::container::Array;
+    using ostk::core::type::Shared;
+
+    using ostk::physics::coordinate::spherical::LLA;
+    using ostk::physics::environment::object::Celestial;
+    using ostk::physics::time::Duration;
+    using ostk::physics::unit::Angle;
+
+    using ostk::astrodynamics::access::CoverageGenerator;
+
+    class_<CoverageGenerator, Shared<CoverageGenerator>> coverageGenerator(
+        aModule,
+        "CoverageGenerator",
+        R"doc(
+            A coverage generator.
+
+            Computes the accesses between a grid of ground points and a constellation of satellites, over a regular
+            time grid. The states of each satellite are evaluated once per instant, and only the grid points lying in
+            the latitude bands below the satellite visibility cone are tested against its elevation mask. Access
+            intervals are resolved to the step of the time grid.
+
+            The visibility tests can be offloaded to a CUDA device (see CoverageGenerator.Backend). States, frame
+            transforms and the assembly of the access intervals remain on the host in all cases.
+
+        )doc"
+    );
+
+    enum_<CoverageGenerator::Backend>(
+        coverageGenerator,
+        "Backend",
+        R"doc(
+            Visibility backend.
+
+            The CUDA backend is only available in builds configured with BUILD_WITH_CUDA, on hosts with a CUDA device.
+        )doc"
+    )
+
+        .value("CPU", CoverageGenerator::Backend::CPU, "Latitude band screening on the host")
+        .value("CUDA", CoverageGenerator::Backend::CUDA, "Visibility tests on a CUDA device")
+
+        ;
+
+    coverageGenerator
+
+        .def(
+            init<
+                const Array<LLA>&,
+                const Angle&,
+                const Shared<const Celestial>&,
+                const Duration&,
+                const CoverageGenerator::Backend&>(),
+            R"doc(
+                Constructor.
+
+                Args:
+                    grid_points (list[LLA]): The grid points.
+                    minimum_elevation (Angle): The minimum elevation.
+                    celestial (Celestial): The central body, whose frame the grid points are fixed in.
+                    step (Duration): The time grid step. Defaults to 1 minute.
+                    backend (CoverageGenerator.Backend): The visibility backend. Defaults to CPU.
+
+            )doc",
+            arg("grid_points"),
+            arg("minimum_elevation"),
+            arg("celestial"),
+            arg("step") = DEFAULT_STEP,
+            arg("backend") = CoverageGenerator::Backend::CPU
+        )
+
+        .def(
+            "is_defined",
+            &CoverageGenerator::isDefined,
+            R"doc(
+                Check if the coverage generator is defined.
+
+                Returns:
+                    bool: True if the coverage generator is defined, False otherwise.
+
+            )doc"
+        )
+
+        .def(
+            "get_grid_points",
+            &CoverageGenerator::getGridPoints,
+            R"doc(
+                Get the grid points.
+
+                Returns:
+                    list[LLA]: The grid points.
+
+            )doc"
+        )
+
+        .def(
+            "get_minimum_elevation",
+            &CoverageGenerator::getMinimumElevation,
+            R"doc(
+                Get the minimum elevation.
+
+                Returns:
+                    Angle: The minimum elevation.
+
+            )doc"
+        )
+
+        .def(
+            "get_step",
+            &CoverageGenerator::getStep,
+            R"doc(
+                Get the time grid step.
+
+                Returns:
+                    Duration: The step.
+
+            )doc"
+        )
+
+        .def(
+            "get_backend",
+            &CoverageGenerator::getBackend,
+            R"doc(
+                Get the visibility backend.
+
+                Returns:
+                    CoverageGenerator.Backend: The backend.
+
+            )doc"
+        )
+
+        .def(
+            "compute_coverage",
+            &CoverageGenerator::computeCoverage,
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Compute the coverage of the grid points by an array of satellites.
+
+                Args:
+                    interval (Interval): The analysis interval.
+                    trajectories (list[Trajectory]): The satellite trajectories.
+
+                Returns:
+                    list[CoverageGenerator.PointCoverage]: The coverage of each grid point, in the order of the grid points.
+
+            )doc",
+            arg("interval"),
+            arg("trajectories")
+        )
+
+        .def_static(
+            "undefined",
+            &CoverageGenerator::Undefined,
+            R"doc(
+                Get an undefined coverage generator.
+
+                Returns:
+                    CoverageGenerator: An undefined coverage generator.
+
+            )doc"
+        )
+
+        .def_static(
+            "is_backend_available",
+            &CoverageGenerator::IsBackendAvailable,
+            R"doc(
+                Check if a visibility backend is available in this build and on this host.
+
+                Args:
+                    backend (CoverageGenerator.Backend): The visibility backend.
+
+                Returns:
+                    bool: True if the backend is available.
+
+            )doc",
+            arg("backend")
+        )
+
+        ;
+
+    class_<CoverageGenerator::PointCoverage>(
+        aModule.attr("CoverageGenerator"),
+        "PointCoverage",
+        R"doc(
+            Coverage of a grid point.
+
+            Revisit durations are those of the gaps between accesses, including the gaps at the start and end of the
+            analysis interval.
+
+        )doc"
+    )
+
+        .def_readonly("access_intervals", &CoverageGenerator::PointCoverage::accessIntervals)
+        .def_readonly("access_duration", &CoverageGenerator::PointCoverage::accessDuration)
+        .def_readonly("maximum_revisit_duration", &CoverageGenerator::PointCoverage::maximumRevisitDuration)
+        .def_readonly("mean_revisit_duration", &CoverageGenerator::PointCoverage::meanRevisitDuration)
+
+        ;
+}
@@ -0,0 +1,246 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Access/CrosslinkGenerator.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Access_CrosslinkGenerator(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Real;
+    using ostk::core::type::Shared;
+
+    using ostk::mathematics::object::Vector3d;
+
+    using ostk::physics::environment::object::Celestial;
+    using ostk::physics::time::Duration;
+    using ostk::physics::time::Instant;
+    using ostk::physics::time::Interval;
+    using ostk::physics::unit::Angle;
+    using ostk::physics::unit::Length;
+
+    using ostk::astrodynamics::access::CrosslinkGenerator;
+    using ostk::astrodynamics::flight::Profile;
+    using ostk::astrodynamics::Trajectory;
+
+    class_<CrosslinkGenerator, Shared<CrosslinkGenerator>> crosslinkGeneratorClass(
+        aModule,
+        "CrosslinkGenerator",
+        R"doc(
+            An inter-satellite link (crosslink) access generator.
+
+            Computes the accesses between two satellites from their GCRF positions only: a link is active when the
+            range lies within the range interval, the line of sight clears the Earth ellipsoid raised by the grazing
+            altitude, and, for a "from" satellite given by its flight profile, the "to" satellite lies within the
+            body-frame field of view. No Earth-fixed frame is constructed.
+
+            The maximum elevation of the generated accesses is the geocentric elevation of the "to" satellite above
+            the local horizontal plane of the "from" satellite, at the time of closest approach.
+
+        )doc"
+    );
+
+    class_<CrosslinkGenerator::FieldOfView>(
+        crosslinkGeneratorClass,
+        "FieldOfView",
+        R"doc(
+            Conical field of view, defined in the body frame of a satellite.
+
+        )doc"
+    )
+
+        .def(
+            init(
+                [](const Vector3d& aBoresight, const Angle& aHalfAngle) -> CrosslinkGenerator::FieldOfView
+                {
+                    return {aBoresight, aHalfAngle};
+                }
+            ),
+            R"doc(
+                Constructor.
+
+                Args:
+                    boresight (np.ndarray): The boresight direction, in the body frame.
+                    half_angle (Angle): The cone half angle.
+
+            )doc",
+            arg("boresight"),
+            arg("half_angle")
+        )
+
+        .def_readonly("boresight", &CrosslinkGenerator::FieldOfView::boresight)
+        .def_readonly("half_angle", &CrosslinkGenerator::FieldOfView::halfAngle)
+
+        ;
+
+    crosslinkGeneratorClass
+
+        .def(
+            init<
+                const Shared<const Celestial>&,
+                const ostk::mathematics::object::Interval<Real>&,
+                const Length&,
+                const Duration&,
+                const Duration&>(),
+            R"doc(
+                Constructor.
+
+                Args:
+                    earth (Celestial): The Earth.
+                    range_interval (RealInterval): The range interval [m] (not filtered on if undefined).
+                    grazing_altitude (Length): The minimum altitude of the line of sight above the Earth ellipsoid.
+                    step (Duration): The time grid step. Defaults to 1 minute.
+                    tolerance (Duration): The temporal tolerance. Defaults to 1 microsecond.
+
+            )doc",
+            arg("earth"),
+            arg("range_interval"),
+            arg("grazing_altitude"),
+            arg("step") = DEFAULT_STEP,
+            arg("tolerance") = DEFAULT_TOLERANCE
+        )
+
+        .def(
+            "is_defined",
+            &CrosslinkGenerator::isDefined,
+            R"doc(
+                Check if the crosslink generator is defined.
+
+                Returns:
+                    bool: True if the crosslink generator is defined, False otherwise.
+
+            )doc"
+        )
+
+        .def(
+            "get_range_interval",
+            &CrosslinkGenerator::getRangeInterval,
+            R"doc(
+                Get the range interval.
+
+                Returns:
+                    RealInterval: The range interval [m].
+
+            )doc"
+        )
+
+        .def(
+            "get_grazing_altitude",
+            &CrosslinkGenerator::getGrazingAltitude,
+            R"doc(
+                Get the grazing altitude.
+
+                Returns:
+                    Length: The grazing altitude.
+
+            )doc"
+        )
+
+        .def(
+            "get_step",
+            &CrosslinkGenerator::getStep,
+            R"doc(
+                Get the time grid step.
+
+                Returns:
+                    Duration: The step.
+
+            )doc"
+        )
+
+        .def(
+            "get_tolerance",
+            &CrosslinkGenerator::getTolerance,
+            R"doc(
+                Get the temporal tolerance.
+
+                Returns:
+                    Duration: The tolerance.
+
+            )doc"
+        )
+
+        .def(
+            "is_active_at",
+            &CrosslinkGenerator::isActiveAt,
+            R"doc(
+                Check if the link between two satellites is active at a given instant.
+
+                Args:
+                    instant (Instant): The instant.
+                    from_trajectory (Trajectory): The "from" trajectory.
+                    to_trajectory (Trajectory): The "to" trajectory.
+
+                Returns:
+                    bool: True if the link is active.
+
+            )doc",
+            arg("instant"),
+            arg("from_trajectory"),
+            arg("to_trajectory")
+        )
+
+        .def(
+            "compute_accesses",
+            overload_cast<const Interval&, const Trajectory&, const Trajectory&>(
+                &CrosslinkGenerator::computeAccesses, const_
+            ),
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Compute the accesses between two satellites.
+
+                Args:
+                    interval (Interval): The analysis interval.
+                    from_trajectory (Trajectory): The "from" trajectory.
+                    to_trajectory (Trajectory): The "to" trajectory.
+
+                Returns:
+                    list[Access]: The accesses.
+
+            )doc",
+            arg("interval"),
+            arg("from_trajectory"),
+            arg("to_trajectory")
+        )
+
+        .def(
+            "compute_accesses",
+            overload_cast<const Interval&, const Profile&, const CrosslinkGenerator::FieldOfView&, const Trajectory&>(
+                &CrosslinkGenerator::computeAccesses, const_
+            ),
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Compute the accesses between two satellites, within the field of view of the "from" satellite.
+
+                The "from" flight profile must be expressed in GCRF.
+
+                Args:
+                    interval (Interval): The analysis interval.
+                    from_profile (Profile): The "from" flight profile.
+                    field_of_view (CrosslinkGenerator.FieldOfView): The field of view, in the body frame of the "from"
+                        profile.
+                    to_trajectory (Trajectory): The "to" trajectory.
+
+                Returns:
+                    list[Access]: The accesses.
+
+            )doc",
+            arg("interval"),
+            arg("from_profile"),
+            arg("field_of_view"),
+            arg("to_trajectory")
+        )
+
+        .def_static(
+            "undefined",
+            &CrosslinkGenerator::Undefined,
+            R"doc(
+                Get an undefined crosslink generator.
+
+                Returns:
+                    CrosslinkGenerator: An undefined crosslink generator.
+
+            )doc"
+        )
+
+        ;
+}
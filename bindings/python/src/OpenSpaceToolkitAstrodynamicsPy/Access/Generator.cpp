@@ -8,16 +8,24 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Access_Generator(pybind11::module& a
 {
     using namespace pybind11;
 
+    using ostk::core::container::Array;
     using ostk::core::container::Map;
     using ostk::core::type::Real;
     using ostk::core::type::Shared;
+    using ostk::core::type::Size;
 
     using ostk::physics::coordinate::spherical::AER;
     using ostk::physics::Environment;
     using ostk::physics::time::Duration;
+    using ostk::physics::time::Interval;
+    using ostk::physics::unit::Angle;
+    using ostk::physics::unit::Length;
 
     using ostk::astrodynamics::Access;
+    using ostk::astrodynamics::access::AerFilter;
     using ostk::astrodynamics::access::Generator;
+    using ostk::astrodynamics::access::SensorFilter;
+    using ostk::astrodynamics::Trajectory;
     using ostk::astrodynamics::trajectory::State;
 
     class_<Generator, Shared<Generator>>(
@@ -29,6 +37,37 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Access_Generator(pybind11::module& a
         )doc"
     )
 
+        .def(
+            init(
+                [](const Environment& anEnvironment,
+                   const AerFilter& anAerFilter,
+                   const std::function<bool(const Access&)>& anAccessFilter,
+                   const std::function<bool(const State&, const State&)>& aStateFilter,
+                   const Duration& aStep,
+                   const Duration& aTolerance) -> Generator
+                {
+                    return {anEnvironment, anAerFilter, anAccessFilter, aStateFilter, aStep, aTolerance};
+                }
+            ),
+            R"doc(
+                Constructor, with a native AER filter, evaluated without calling back into Python.
+
+                Args:
+                    environment (Environment): The environment.
+                    aer_filter (AerFilter): The AER filter.
+                    access_filter (function): The access filter.
+                    state_filter (function): The state filter.
+                    step (Duration): The step.
+                    tolerance (Duration): The tolerance.
+
+            )doc",
+            arg("environment"),
+            arg("aer_filter"),
+            arg("access_filter") = none(),
+            arg("state_filter") = none(),
+            arg_v("step", DEFAULT_STEP, "Duration.minutes(1.0)"),
+            arg_v("tolerance", DEFAULT_TOLERANCE, "Duration.microseconds(1.0)")
+        )
         .def(
             init<
                 const Environment&,
@@ -125,6 +164,40 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Access_Generator(pybind11::module& a
             )doc"
         )
 
+        .def(
+            "is_screening_enabled",
+            &Generator::isScreeningEnabled,
+            R"doc(
+                Check if coarse geometric screening is enabled.
+
+                Returns:
+                    bool: True if coarse geometric screening is enabled.
+
+            )doc"
+        )
+        .def(
+            "get_screening_minimum_elevation",
+            &Generator::getScreeningMinimumElevation,
+            R"doc(
+                Get the coarse screening minimum elevation.
+
+                Returns:
+                    Angle: The minimum elevation (undefined if not screened on).
+
+            )doc"
+        )
+        .def(
+            "get_screening_maximum_range",
+            &Generator::getScreeningMaximumRange,
+            R"doc(
+                Get the coarse screening maximum range.
+
+                Returns:
+                    Length: The maximum range (undefined if not screened on).
+
+            )doc"
+        )
+
         .def(
             "get_condition_function",
             &Generator::getConditionFunction,
@@ -144,7 +217,8 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Access_Generator(pybind11::module& a
         )
         .def(
             "compute_accesses",
-            &Generator::computeAccesses,
+            overload_cast<const Interval&, const Trajectory&, const Trajectory&>(&Generator::computeAccesses, const_),
+            call_guard<gil_scoped_release>(),
             R"doc(
                 Compute the accesses.
 
@@ -161,6 +235,56 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Access_Generator(pybind11::module& a
             arg("from_trajectory"),
             arg("to_trajectory")
         )
+        .def(
+            "compute_accesses",
+            overload_cast<const Interval&, const Array<Trajectory>&, const Array<Trajectory>&, const Size&>(
+                &Generator::computeAccesses, const_
+            ),
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Compute the accesses between every pair of trajectories, using a pool of worker threads.
+
+                Args:
+                    interval (Interval): The interval.
+                    from_trajectories (list[Trajectory]): The "from" trajectories.
+                    to_trajectories (list[Trajectory]): The "to" trajectories.
+                    thread_count (int): The worker thread count. Defaults to 0 (the default thread count of ExecutionContext).
+
+                Returns:
+                    list[list[list[Access]]]: The accesses, indexed by [from trajectory index][to trajectory index].
+
+            )doc",
+            arg("interval"),
+            arg("from_trajectories"),
+            arg("to_trajectories"),
+            arg("thread_count") = 0
+        )
+        .def(
+            "compute_piecewise_accesses",
+            &Generator::computePiecewiseAccesses,
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Compute the accesses between trajectories made of pieces (e.g., historical TLE sequences).
+
+                The interval is split at the switch instants of piecewise trajectories, and each segment is processed
+                with the pieces it uses, using a pool of worker threads. Access intervals meeting at a switch instant
+                are merged.
+
+                Args:
+                    interval (Interval): The interval.
+                    from_trajectory (Trajectory): The "from" trajectory.
+                    to_trajectory (Trajectory): The "to" trajectory.
+                    thread_count (int): The worker thread count. Defaults to 0 (the default thread count of ExecutionContext).
+
+                Returns:
+                    list[Access]: The accesses.
+
+            )doc",
+            arg("interval"),
+            arg("from_trajectory"),
+            arg("to_trajectory"),
+            arg("thread_count") = 0
+        )
         .def(
             "set_step",
             &Generator::setStep,
@@ -185,6 +309,21 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Access_Generator(pybind11::module& a
         )doc",
             arg("tolerance")
         )
+        .def(
+            "set_aer_filter",
+            [](Generator& aGenerator, const AerFilter& anAerFilter)
+            {
+                aGenerator.setAerFilter(anAerFilter);
+            },
+            R"doc(
+            Set a native AER filter, evaluated without calling back into Python.
+
+            Args:
+                aer_filter (AerFilter): The AER filter.
+
+        )doc",
+            arg("aer_filter")
+        )
         .def(
             "set_aer_filter",
             &Generator::setAerFilter,
@@ -209,6 +348,21 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Access_Generator(pybind11::module& a
         )doc",
             arg("access_filter")
         )
+        .def(
+            "set_state_filter",
+            [](Generator& aGenerator, const SensorFilter& aSensorFilter)
+            {
+                aGenerator.setStateFilter(aSensorFilter);
+            },
+            R"doc(
+            Set a native sensor filter, evaluated without calling back into Python.
+
+            Args:
+                state_filter (SensorFilter): The sensor filter.
+
+        )doc",
+            arg("state_filter")
+        )
         .def(
             "set_state_filter",
             &Generator::setStateFilter,
@@ -221,6 +375,95 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Access_Generator(pybind11::module& a
         )doc",
             arg("state_filter")
         )
+        .def(
+            "enable_screening",
+            &Generator::enableScreening,
+            R"doc(
+            Enable coarse geometric screening.
+
+            A cheap test computed from GCRF position vectors (Earth occlusion, minimum geocentric elevation, maximum
+            range) is performed before the line of sight and AER evaluation.
+            The minimum elevation and maximum range must not be tighter than the AER filter.
+
+            Args:
+                minimum_elevation (Angle): The minimum elevation. Defaults to Angle.undefined().
+                maximum_range (Length): The maximum range. Defaults to Length.undefined().
+
+        )doc",
+            arg_v("minimum_elevation", Angle::Undefined(), "Angle.undefined()"),
+            arg_v("maximum_range", Length::Undefined(), "Length.undefined()")
+        )
+        .def(
+            "disable_screening",
+            &Generator::disableScreening,
+            R"doc(
+                Disable coarse geometric screening.
+
+            )doc"
+        )
+
+        .def(
+            "is_statistics_enabled",
+            &Generator::isStatisticsEnabled,
+            R"doc(
+                Check if statistics are enabled.
+
+                Returns:
+                    bool: True if statistics are enabled, False otherwise.
+
+            )doc"
+        )
+        .def(
+            "get_statistics",
+            [](Generator& aGenerator, const bool reset) -> Generator::Statistics
+            {
+                const Generator::Statistics statistics = aGenerator.getStatistics();
+
+                if (reset)
+                {
+                    aGenerator.resetStatistics();
+                }
+
+                return statistics;
+            },
+            R"doc(
+                Get the statistics accumulated since statistics were enabled (or last reset).
+
+                Args:
+                    reset (bool, optional): If True, reset statistics once read, so that the next read covers the next calls only. Defaults to False.
+
+                Returns:
+                    Generator.Statistics: The statistics.
+
+            )doc",
+            arg("reset") = false
+        )
+        .def(
+            "enable_statistics",
+            &Generator::enableStatistics,
+            R"doc(
+                Enable statistics.
+
+                Copies of this generator (e.g., the workers of a multi-trajectory computation) share its statistics.
+
+            )doc"
+        )
+        .def(
+            "disable_statistics",
+            &Generator::disableStatistics,
+            R"doc(
+                Disable statistics.
+
+            )doc"
+        )
+        .def(
+            "reset_statistics",
+            &Generator::resetStatistics,
+            R"doc(
+                Reset statistics.
+
+            )doc"
+        )
 
         .def_static(
             "undefined",
@@ -271,5 +514,65 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Access_Generator(pybind11::module& a
             arg("environment")
         )
 
+        ;
+
+    class_<Generator::Statistics>(
+        aModule.attr("Generator"),
+        "Statistics",
+        R"doc(
+            Access generation statistics, accumulated over computations while enabled.
+
+        )doc"
+    )
+
+        .def_readonly("condition_evaluation_count", &Generator::Statistics::conditionEvaluationCount)
+        .def_readonly("condition_evaluation_duration", &Generator::Statistics::conditionEvaluationDuration)
+        .def_readonly("root_solver_call_count", &Generator::Statistics::rootSolverCallCount)
+        .def_readonly("root_solver_iteration_count", &Generator::Statistics::rootSolverIterationCount)
+        .def_readonly("root_solver_duration", &Generator::Statistics::rootSolverDuration)
+        .def_readonly("state_query_count", &Generator::Statistics::stateQueryCount)
+        .def_readonly("state_query_duration", &Generator::Statistics::stateQueryDuration)
+        .def_readonly("line_of_sight_count", &Generator::Statistics::lineOfSightCount)
+        .def_readonly("line_of_sight_duration", &Generator::Statistics::lineOfSightDuration)
+        .def_readonly("aer_calculation_count", &Generator::Statistics::aerCalculationCount)
+        .def_readonly("aer_calculation_duration", &Generator::Statistics::aerCalculationDuration)
+        .def_readonly(
+            "time_of_closest_approach_evaluation_count", &Generator::Statistics::timeOfClosestApproachEvaluationCount
+        )
+        .def_readonly("time_of_closest_approach_duration", &Generator::Statistics::timeOfClosestApproachDuration)
+
+        .def(
+            "to_dict",
+            [](const Generator::Statistics& aStatistics) -> dict
+            {
+                dict statistics;
+
+                statistics["condition_evaluation_count"] = aStatistics.conditionEvaluationCount;
+                statistics["condition_evaluation_duration"] =
+                    double(aStatistics.conditionEvaluationDuration.inSeconds());
+                statistics["root_solver_call_count"] = aStatistics.rootSolverCallCount;
+                statistics["root_solver_iteration_count"] = aStatistics.rootSolverIterationCount;
+                statistics["root_solver_duration"] = double(aStatistics.rootSolverDuration.inSeconds());
+                statistics["state_query_count"] = aStatistics.stateQueryCount;
+                statistics["state_query_duration"] = double(aStatistics.stateQueryDuration.inSeconds());
+                statistics["line_of_sight_count"] = aStatistics.lineOfSightCount;
+                statistics["line_of_sight_duration"] = double(aStatistics.lineOfSightDuration.inSeconds());
+                statistics["aer_calculation_count"] = aStatistics.aerCalculationCount;
+                statistics["aer_calculation_duration"] = double(aStatistics.aerCalculationDuration.inSeconds());
+                statistics["time_of_closest_approach_evaluation_count"] =
+                    aStatistics.timeOfClosestApproachEvaluationCount;
+                statistics["time_of_closest_approach_duration"] =
+                    double(aStatistics.timeOfClosestApproachDuration.inSeconds());
+
+                return statistics;
+            },
+            R"doc(
+                Convert the statistics to a dictionary, e.g. for a metrics exporter.
+
+                Returns:
+                    dict[str, int | float]: The counts, and the durations [s].
+            )doc"
+        )
+
         ;
 }
@@ -0,0 +1,109 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Access/IncrementalGenerator.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Access_IncrementalGenerator(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Shared;
+
+    using ostk::astrodynamics::access::Generator;
+    using ostk::astrodynamics::access::IncrementalGenerator;
+    using ostk::astrodynamics::Trajectory;
+
+    class_<IncrementalGenerator, Shared<IncrementalGenerator>>(
+        aModule,
+        "IncrementalGenerator",
+        R"doc(
+            An incremental access generator.
+
+            Retains the accesses computed over a previous analysis interval. When the analysis interval is shifted
+            or extended, only the new tail is evaluated and accesses touching the previous interval end are
+            re-validated.
+
+        )doc"
+    )
+
+        .def(
+            init<const Generator&, const Trajectory&, const Trajectory&>(),
+            R"doc(
+                Constructor.
+
+                Args:
+                    generator (Generator): The access generator.
+                    from_trajectory (Trajectory): The "from" trajectory.
+                    to_trajectory (Trajectory): The "to" trajectory.
+
+            )doc",
+            arg("generator"),
+            arg("from_trajectory"),
+            arg("to_trajectory")
+        )
+
+        .def(
+            "is_defined",
+            &IncrementalGenerator::isDefined,
+            R"doc(
+                Check if the incremental generator is defined.
+
+                Returns:
+                    bool: True if the incremental generator is defined, False otherwise.
+
+            )doc"
+        )
+
+        .def(
+            "get_interval",
+            &IncrementalGenerator::getInterval,
+            R"doc(
+                Get the interval of the last computation.
+
+                Returns:
+                    Interval: The interval (undefined if nothing has been computed yet).
+
+            )doc"
+        )
+
+        .def(
+            "compute_accesses",
+            &IncrementalGenerator::computeAccesses,
+            R"doc(
+                Compute the accesses, reusing results from the previous computation.
+
+                Results are reused if the interval starts within the previous interval. Otherwise, accesses are fully
+                recomputed.
+
+                Args:
+                    interval (Interval): The analysis interval.
+
+                Returns:
+                    list[Access]: The accesses.
+
+            )doc",
+            arg("interval")
+        )
+
+        .def(
+            "reset",
+            &IncrementalGenerator::reset,
+            R"doc(
+                Discard retained results.
+
+            )doc"
+        )
+
+        .def_static(
+            "undefined",
+            &IncrementalGenerator::Undefined,
+            R"doc(
+                Get an undefined incremental generator.
+
+                Returns:
+                    IncrementalGenerator: An undefined incremental generator.
+
+            )doc"
+        )
+
+        ;
+}
@@ -0,0 +1,200 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Access/IntervalSet.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Access_IntervalSet(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::container::Array;
+
+    using ostk::physics::time::Interval;
+
+    using ostk::astrodynamics::access::IntervalSet;
+
+    class_<IntervalSet>(
+        aModule,
+        "IntervalSet",
+        R"doc(
+            Set of disjoint time intervals, in chronological order.
+
+            Input intervals are sorted and merged on construction, and set operations merge the sorted interval
+            arrays in linear time. Intervals are treated as closed, and only intervals of non-zero duration are
+            retained.
+
+        )doc"
+    )
+
+        .def(
+            init<const Array<Interval>&>(),
+            R"doc(
+                Constructor.
+
+                Args:
+                    intervals (list[Interval]): The intervals, in any order, possibly overlapping.
+
+            )doc",
+            arg("intervals")
+        )
+
+        .def(self == self)
+        .def(self != self)
+
+        .def(
+            "is_empty",
+            &IntervalSet::isEmpty,
+            R"doc(
+                Check if the interval set is empty.
+
+                Returns:
+                    bool: True if the interval set is empty.
+
+            )doc"
+        )
+
+        .def(
+            "contains",
+            &IntervalSet::contains,
+            R"doc(
+                Check if the interval set contains an instant.
+
+                Args:
+                    instant (Instant): The instant.
+
+                Returns:
+                    bool: True if the interval set contains the instant.
+
+            )doc",
+            arg("instant")
+        )
+
+        .def(
+            "get_size",
+            &IntervalSet::getSize,
+            R"doc(
+                Get the number of (disjoint) intervals.
+
+                Returns:
+                    int: The number of intervals.
+
+            )doc"
+        )
+
+        .def(
+            "get_intervals",
+            &IntervalSet::accessIntervals,
+            R"doc(
+                Get the intervals.
+
+                Returns:
+                    list[Interval]: The disjoint intervals, in chronological order.
+
+            )doc"
+        )
+
+        .def(
+            "get_duration",
+            &IntervalSet::getDuration,
+            R"doc(
+                Get the total duration.
+
+                Returns:
+                    Duration: The sum of the interval durations.
+
+            )doc"
+        )
+
+        .def(
+            "union_with",
+            &IntervalSet::unionWith,
+            R"doc(
+                Get the union with another interval set.
+
+                Args:
+                    interval_set (IntervalSet): The interval set.
+
+                Returns:
+                    IntervalSet: The union.
+
+            )doc",
+            arg("interval_set")
+        )
+
+        .def(
+            "intersection_with",
+            &IntervalSet::intersectionWith,
+            R"doc(
+                Get the intersection with another interval set.
+
+                Args:
+                    interval_set (IntervalSet): The interval set.
+
+                Returns:
+                    IntervalSet: The intersection.
+
+            )doc",
+            arg("interval_set")
+        )
+
+        .def(
+            "difference_with",
+            &IntervalSet::differenceWith,
+            R"doc(
+                Get the difference with another interval set.
+
+                Args:
+                    interval_set (IntervalSet): The interval set.
+
+                Returns:
+                    IntervalSet: The intervals of this set not covered by the other set.
+
+            )doc",
+            arg("interval_set")
+        )
+
+        .def(
+            "complement_in",
+            &IntervalSet::complementIn,
+            R"doc(
+                Get the complement within an interval.
+
+                Args:
+                    interval (Interval): The interval.
+
+                Returns:
+                    IntervalSet: The gaps of this set within the interval.
+
+            )doc",
+            arg("interval")
+        )
+
+        .def_static(
+            "empty",
+            &IntervalSet::Empty,
+            R"doc(
+                Get an empty interval set.
+
+                Returns:
+                    IntervalSet: An empty interval set.
+
+            )doc"
+        )
+
+        .def_static(
+            "from_accesses",
+            &IntervalSet::FromAccesses,
+            R"doc(
+                Get an interval set from accesses.
+
+                Args:
+                    accesses (list[Access]): The accesses.
+
+                Returns:
+                    IntervalSet: The interval set.
+
+            )doc",
+            arg("accesses")
+        )
+
+        ;
+}
@@ -0,0 +1,100 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Access/IntervalTree.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Access_IntervalTree(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::container::Array;
+
+    using ostk::physics::time::Interval;
+
+    using ostk::astrodynamics::access::IntervalTree;
+
+    class_<IntervalTree>(
+        aModule,
+        "IntervalTree",
+        R"doc(
+            Static interval tree, for point and overlap queries over (possibly overlapping) intervals.
+
+            Queries run in O(log n + k), k being the number of matches, and return indices into the input array.
+            Intervals are treated as closed.
+
+        )doc"
+    )
+
+        .def(
+            init<const Array<Interval>&>(),
+            R"doc(
+                Constructor.
+
+                Args:
+                    intervals (list[Interval]): The intervals, in any order.
+
+            )doc",
+            arg("intervals")
+        )
+
+        .def(
+            "get_size",
+            &IntervalTree::getSize,
+            R"doc(
+                Get the number of intervals.
+
+                Returns:
+                    int: The number of intervals.
+
+            )doc"
+        )
+
+        .def(
+            "query_containing",
+            &IntervalTree::queryContaining,
+            R"doc(
+                Query the intervals containing an instant.
+
+                Args:
+                    instant (Instant): The instant.
+
+                Returns:
+                    list[int]: The indices of the matching intervals, in increasing order.
+
+            )doc",
+            arg("instant")
+        )
+
+        .def(
+            "query_overlapping",
+            &IntervalTree::queryOverlapping,
+            R"doc(
+                Query the intervals overlapping an interval.
+
+                Args:
+                    interval (Interval): The interval.
+
+                Returns:
+                    list[int]: The indices of the matching intervals, in increasing order.
+
+            )doc",
+            arg("interval")
+        )
+
+        .def_static(
+            "from_accesses",
+            &IntervalTree::FromAccesses,
+            R"doc(
+                Get an interval tree from accesses.
+
+                Args:
+                    accesses (list[Access]): The accesses.
+
+                Returns:
+                    IntervalTree: The interval tree, indexed as the accesses.
+
+            )doc",
+            arg("accesses")
+        )
+
+        ;
+}
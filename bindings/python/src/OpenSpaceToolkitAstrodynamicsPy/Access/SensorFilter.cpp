@@ -0,0 +1,205 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Access/SensorFilter.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Access_SensorFilter(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::physics::time::Duration;
+
+    using ostk::astrodynamics::access::SensorFilter;
+
+    class_<SensorFilter> sensorFilter(
+        aModule,
+        "SensorFilter",
+        R"doc(
+            Body-mounted sensor field of view filter.
+
+            The sensor frame is defined from the body frame of a flight profile (expressed in GCRF) by a constant
+            rotation, its Z axis being the boresight. The sensor attitude is tabulated over an interval and
+            interpolated in between.
+
+            Used as a state filter of an access generator, the sensor is mounted on the "to" trajectory and observes
+            the "from" trajectory. It is evaluated natively, hence the generator never calls back into Python during
+            the access search.
+
+        )doc"
+    );
+
+    enum_<SensorFilter::Shape>(
+        sensorFilter,
+        "Shape",
+        R"doc(
+            Field of view shape.
+        )doc"
+    )
+
+        .value("Undefined", SensorFilter::Shape::Undefined, "Undefined shape")
+        .value("Cone", SensorFilter::Shape::Cone, "Circular cone around the boresight")
+        .value("Rectangle", SensorFilter::Shape::Rectangle, "Rectangular pyramid around the boresight")
+
+        ;
+
+    sensorFilter
+
+        .def(
+            "__call__",
+            &SensorFilter::operator(),
+            R"doc(
+                Evaluate the filter on states.
+
+                Args:
+                    from_state (State): The "from" (target) state.
+                    to_state (State): The "to" (observer) state.
+
+                Returns:
+                    bool: True if the target is in the field of view.
+
+            )doc",
+            arg("from_state"),
+            arg("to_state")
+        )
+        .def(
+            "evaluate",
+            &SensorFilter::evaluate,
+            R"doc(
+                Evaluate the filter on GCRF position coordinates.
+
+                Args:
+                    instant (Instant): The instant.
+                    observer_position_coordinates (np.ndarray): The observer position [m], in GCRF.
+                    target_position_coordinates (np.ndarray): The target position [m], in GCRF.
+
+                Returns:
+                    bool: True if the target is in the field of view.
+
+            )doc",
+            arg("instant"),
+            arg("observer_position_coordinates"),
+            arg("target_position_coordinates")
+        )
+        .def(
+            "is_defined",
+            &SensorFilter::isDefined,
+            R"doc(
+                Check if the filter is defined.
+
+                Returns:
+                    bool: True if the filter is defined.
+
+            )doc"
+        )
+        .def(
+            "get_shape",
+            &SensorFilter::getShape,
+            R"doc(
+                Get the field of view shape.
+
+                Returns:
+                    SensorFilter.Shape: The shape.
+
+            )doc"
+        )
+        .def(
+            "get_interval",
+            &SensorFilter::getInterval,
+            R"doc(
+                Get the interval over which the attitude is tabulated.
+
+                Returns:
+                    Interval: The interval.
+
+            )doc"
+        )
+        .def(
+            "get_step",
+            &SensorFilter::getStep,
+            R"doc(
+                Get the step between tabulated attitudes.
+
+                Returns:
+                    Duration: The step.
+
+            )doc"
+        )
+        .def(
+            "get_attitude_at",
+            &SensorFilter::getAttitudeAt,
+            R"doc(
+                Get the attitude of the sensor at a given instant.
+
+                Args:
+                    instant (Instant): The instant.
+
+                Returns:
+                    Quaternion: The quaternion mapping GCRF to the sensor frame.
+
+            )doc",
+            arg("instant")
+        )
+
+        .def_static(
+            "undefined",
+            &SensorFilter::Undefined,
+            R"doc(
+                Construct an undefined filter.
+
+                Returns:
+                    SensorFilter: An undefined filter.
+
+            )doc"
+        )
+        .def_static(
+            "cone",
+            &SensorFilter::Cone,
+            R"doc(
+                Construct a conical field of view filter.
+
+                Args:
+                    profile (Profile): The flight profile, expressed in GCRF.
+                    sensor_attitude (Quaternion): The quaternion mapping the body frame to the sensor frame.
+                    half_angle (Angle): The cone half angle, in (0, 180] deg.
+                    interval (Interval): The interval over which the attitude is tabulated.
+                    step (Duration): The step between tabulated attitudes. Defaults to 10 seconds.
+
+                Returns:
+                    SensorFilter: The filter.
+
+            )doc",
+            arg("profile"),
+            arg("sensor_attitude"),
+            arg("half_angle"),
+            arg("interval"),
+            arg_v("step", Duration::Seconds(10.0), "Duration.seconds(10.0)"),
+            call_guard<gil_scoped_release>()
+        )
+        .def_static(
+            "rectangle",
+            &SensorFilter::Rectangle,
+            R"doc(
+                Construct a rectangular field of view filter.
+
+                Args:
+                    profile (Profile): The flight profile, expressed in GCRF.
+                    sensor_attitude (Quaternion): The quaternion mapping the body frame to the sensor frame.
+                    horizontal_half_angle (Angle): The half angle in the XZ plane of the sensor frame, in (0, 90) deg.
+                    vertical_half_angle (Angle): The half angle in the YZ plane of the sensor frame, in (0, 90) deg.
+                    interval (Interval): The interval over which the attitude is tabulated.
+                    step (Duration): The step between tabulated attitudes. Defaults to 10 seconds.
+
+                Returns:
+                    SensorFilter: The filter.
+
+            )doc",
+            arg("profile"),
+            arg("sensor_attitude"),
+            arg("horizontal_half_angle"),
+            arg("vertical_half_angle"),
+            arg("interval"),
+            arg_v("step", Duration::Seconds(10.0), "Duration.seconds(10.0)"),
+            call_guard<gil_scoped_release>()
+        )
+
+        ;
+}
@@ -1,6 +1,8 @@
 /// Apache License 2.0
 
+#include <OpenSpaceToolkitAstrodynamicsPy/Conjunction/AvoidanceManeuverSolver.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Conjunction/Message.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Conjunction/Screener.cpp>
 
 inline void OpenSpaceToolkitAstrodynamicsPy_Conjunction(pybind11::module& aModule)
 {
@@ -9,4 +11,6 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Conjunction(pybind11::module& aModul
 
     // Add objects to "conjunction" submodule
     OpenSpaceToolkitAstrodynamicsPy_Conjunction_Message(conjunction);
+    OpenSpaceToolkitAstrodynamicsPy_Conjunction_Screener(conjunction);
+    OpenSpaceToolkitAstrodynamicsPy_Conjunction_AvoidanceManeuverSolver(conjunction);
 }
@@ -0,0 +1,215 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Conjunction/AvoidanceManeuverSolver.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Conjunction_AvoidanceManeuverSolver(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Real;
+    using ostk::core::type::Size;
+
+    using ostk::physics::unit::Length;
+
+    using ostk::astrodynamics::conjunction::AvoidanceManeuverSolver;
+    using ostk::astrodynamics::trajectory::Propagator;
+
+    class_<AvoidanceManeuverSolver> avoidanceManeuverSolver(
+        aModule,
+        "AvoidanceManeuverSolver",
+        R"doc(
+            Collision avoidance maneuver trade-space solver.
+
+            The first object of the CDM is the maneuvering object. Candidate impulsive burns (lead time before TCA x
+            RTN direction x velocity increment magnitude) are screened with the state transition matrix of the nominal
+            trajectory, and the best candidates are refined by full propagation, in parallel.
+
+            Candidates meeting the probability of collision threshold come first, by increasing velocity increment
+            magnitude, followed by the others, by increasing probability of collision. Refined candidates come first.
+
+        )doc"
+    );
+
+    class_<AvoidanceManeuverSolver::Candidate>(
+        avoidanceManeuverSolver,
+        "Candidate",
+        R"doc(
+            Candidate avoidance maneuver.
+
+        )doc"
+    )
+
+        .def_readonly(
+            "lead_time",
+            &AvoidanceManeuverSolver::Candidate::leadTime,
+            R"doc(
+                The burn time before TCA.
+            )doc"
+        )
+        .def_readonly(
+            "instant",
+            &AvoidanceManeuverSolver::Candidate::instant,
+            R"doc(
+                The burn instant.
+            )doc"
+        )
+        .def_readonly(
+            "direction_rtn",
+            &AvoidanceManeuverSolver::Candidate::direction_RTN,
+            R"doc(
+                The unit burn direction, in the RTN frame of the maneuvering object at the burn.
+            )doc"
+        )
+        .def_readonly(
+            "delta_v_magnitude",
+            &AvoidanceManeuverSolver::Candidate::deltaVMagnitude,
+            R"doc(
+                The velocity increment magnitude [m/s].
+            )doc"
+        )
+        .def_readonly(
+            "miss_distance",
+            &AvoidanceManeuverSolver::Candidate::missDistance,
+            R"doc(
+                The miss distance in the encounter plane.
+            )doc"
+        )
+        .def_readonly(
+            "collision_probability",
+            &AvoidanceManeuverSolver::Candidate::collisionProbability,
+            R"doc(
+                The probability of collision.
+            )doc"
+        )
+        .def_readonly(
+            "is_refined",
+            &AvoidanceManeuverSolver::Candidate::isRefined,
+            R"doc(
+                True if evaluated by full propagation, False if linearized.
+            )doc"
+        )
+
+        ;
+
+    avoidanceManeuverSolver
+
+        .def(
+            init<const Propagator&, const Length&, const Real&, const Size&, const Size&>(),
+            R"doc(
+                Constructor.
+
+                Args:
+                    propagator (Propagator): The propagator of the maneuvering object (its dynamics must only read its position and velocity).
+                    hard_body_radius (Length): The combined hard body radius.
+                    collision_probability_threshold (float): The probability of collision threshold.
+                    refinement_count (int): The count of best candidates refined by full propagation.
+                    thread_count (int): The worker thread count (0 defaults to the default thread count).
+
+            )doc",
+            arg("propagator"),
+            arg("hard_body_radius"),
+            arg("collision_probability_threshold") = 1e-4,
+            arg("refinement_count") = 5,
+            arg("thread_count") = 0
+        )
+
+        .def("__str__", &(shiftToString<AvoidanceManeuverSolver>))
+        .def("__repr__", &(shiftToString<AvoidanceManeuverSolver>))
+
+        .def(
+            "is_defined",
+            &AvoidanceManeuverSolver::isDefined,
+            R"doc(
+                Check if the avoidance maneuver solver is defined.
+
+                Returns:
+                    bool: True if the avoidance maneuver solver is defined.
+            )doc"
+        )
+
+        .def(
+            "get_propagator",
+            &AvoidanceManeuverSolver::getPropagator,
+            R"doc(
+                Get the propagator of the maneuvering object.
+
+                Returns:
+                    Propagator: The propagator.
+            )doc"
+        )
+        .def(
+            "get_hard_body_radius",
+            &AvoidanceManeuverSolver::getHardBodyRadius,
+            R"doc(
+                Get the combined hard body radius.
+
+                Returns:
+                    Length: The combined hard body radius.
+            )doc"
+        )
+        .def(
+            "get_collision_probability_threshold",
+            &AvoidanceManeuverSolver::getCollisionProbabilityThreshold,
+            R"doc(
+                Get the probability of collision threshold.
+
+                Returns:
+                    float: The probability of collision threshold.
+            )doc"
+        )
+        .def(
+            "get_refinement_count",
+            &AvoidanceManeuverSolver::getRefinementCount,
+            R"doc(
+                Get the count of best candidates refined by full propagation.
+
+                Returns:
+                    int: The refinement count.
+            )doc"
+        )
+        .def(
+            "get_thread_count",
+            &AvoidanceManeuverSolver::getThreadCount,
+            R"doc(
+                Get the worker thread count.
+
+                Returns:
+                    int: The worker thread count (0 defaults to the default thread count).
+            )doc"
+        )
+
+        .def(
+            "solve",
+            &AvoidanceManeuverSolver::solve,
+            call_guard<gil_scoped_release>(),
+            arg("cdm"),
+            arg("lead_times"),
+            arg("directions_rtn"),
+            arg("delta_v_magnitudes"),
+            R"doc(
+                Solve the trade space of avoidance maneuvers of a conjunction.
+
+                Args:
+                    cdm (CDM): The CDM, whose first object is the maneuvering object.
+                    lead_times (list[Duration]): The burn lead times (before TCA).
+                    directions_rtn (list[numpy.ndarray]): The burn directions, in the RTN frame of the maneuvering object at the burn.
+                    delta_v_magnitudes (list[float]): The velocity increment magnitudes [m/s].
+
+                Returns:
+                    list[AvoidanceManeuverSolver.Candidate]: The candidates, ranked.
+            )doc"
+        )
+
+        .def_static(
+            "undefined",
+            &AvoidanceManeuverSolver::Undefined,
+            R"doc(
+                Get an undefined avoidance maneuver solver.
+
+                Returns:
+                    AvoidanceManeuverSolver: An undefined avoidance maneuver solver.
+            )doc"
+        )
+
+        ;
+}
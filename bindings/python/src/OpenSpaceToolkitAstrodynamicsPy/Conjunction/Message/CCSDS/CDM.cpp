@@ -7,8 +7,10 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Conjunction_Message_CCSDS_CDM(pybind
     using namespace pybind11;
 
     using ostk::core::container::Array;
+    using ostk::core::filesystem::File;
     using ostk::core::type::Integer;
     using ostk::core::type::Real;
+    using ostk::core::type::Size;
     using ostk::core::type::String;
 
     using ostk::mathematics::object::MatrixXd;
@@ -24,6 +26,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Conjunction_Message_CCSDS_CDM(pybind
     using ostk::physics::unit::Mass;
 
     using ostk::astrodynamics::conjunction::message::ccsds::CDM;
+    using ostk::astrodynamics::ExecutionContext;
     using ostk::astrodynamics::trajectory::State;
 
     class_<CDM> cdm(
@@ -280,6 +283,24 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Conjunction_Message_CCSDS_CDM(pybind
 
             )doc"
         )
+        .def(
+            "compute_collision_probability",
+            &CDM::computeCollisionProbability,
+            arg("hard_body_radius"),
+            R"doc(
+                Compute the collision probability, from the object states and RTN covariances at TCA.
+
+                The combined position covariance is projected onto the encounter plane, and integrated over the hard
+                body disk (Foster's method).
+
+                Args:
+                    hard_body_radius (Length): The combined hard body radius.
+
+                Returns:
+                    float: The collision probability.
+
+            )doc"
+        )
 
         .def_static(
             "undefined",
@@ -330,6 +351,140 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Conjunction_Message_CCSDS_CDM(pybind
         )doc",
             arg("file")
         )
+        .def_static(
+            "parse_kvn",
+            &CDM::ParseKVN,
+            R"doc(
+                Parse a CDM from a string, in the CCSDS Keyword = Value Notation (KVN).
+
+                Args:
+                    string (str): The string to parse.
+
+                Returns:
+                    CDM: The parsed CDM.
+            )doc",
+            arg("string")
+        )
+        .def_static(
+            "load_kvn",
+            &CDM::LoadKVN,
+            R"doc(
+                Load a CDM from a file, in the CCSDS Keyword = Value Notation (KVN).
+
+                Args:
+                    file (File): The file to load.
+
+                Returns:
+                    CDM: The loaded CDM.
+            )doc",
+            arg("file")
+        )
+        .def_static(
+            "parse_array",
+            overload_cast<const String&, const Size&>(&CDM::ParseArray),
+            R"doc(
+                Parse an array of CDMs (e.g. a SpaceTrack JSON query result) from a string.
+
+                The fields of each message are read directly, without building an intermediate dictionary, in parallel chunks.
+
+                Args:
+                    string (str): The string to parse, holding a JSON array of CDMs.
+                    thread_count (int): The worker thread count. Defaults to 0 (default thread count of ExecutionContext).
+
+                Returns:
+                    list[CDM]: The parsed CDMs, in the order of the string.
+            )doc",
+            arg("string"),
+            arg("thread_count") = 0
+        )
+        .def_static(
+            "parse_array",
+            overload_cast<const String&, const ExecutionContext&>(&CDM::ParseArray),
+            R"doc(
+                Parse an array of CDMs from a string, within an execution context.
+
+                Args:
+                    string (str): The string to parse, holding a JSON array of CDMs.
+                    execution_context (ExecutionContext): The execution context.
+
+                Returns:
+                    list[CDM]: The parsed CDMs, in the order of the string.
+            )doc",
+            arg("string"),
+            arg("execution_context")
+        )
+        .def_static(
+            "load_array",
+            overload_cast<const File&, const Size&>(&CDM::LoadArray),
+            R"doc(
+                Load an array of CDMs from a file.
+
+                Args:
+                    file (File): The file to load, holding a JSON array of CDMs.
+                    thread_count (int): The worker thread count. Defaults to 0 (default thread count of ExecutionContext).
+
+                Returns:
+                    list[CDM]: The loaded CDMs, in the order of the file.
+            )doc",
+            arg("file"),
+            arg("thread_count") = 0
+        )
+        .def_static(
+            "load_array",
+            overload_cast<const File&, const ExecutionContext&>(&CDM::LoadArray),
+            R"doc(
+                Load an array of CDMs from a file, within an execution context.
+
+                Args:
+                    file (File): The file to load, holding a JSON array of CDMs.
+                    execution_context (ExecutionContext): The execution context.
+
+                Returns:
+                    list[CDM]: The loaded CDMs, in the order of the file.
+            )doc",
+            arg("file"),
+            arg("execution_context")
+        )
+        .def_static(
+            "compute_collision_probabilities",
+            overload_cast<const Array<CDM>&, const Length&, const Size&>(&CDM::ComputeCollisionProbabilities),
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Compute the collision probabilities of an array of CDMs, in parallel.
+
+                Args:
+                    cdms (list[CDM]): The CDMs.
+                    hard_body_radius (Length): The combined hard body radius.
+                    thread_count (int): The worker thread count. Defaults to 0 (default thread count of ExecutionContext).
+
+                Returns:
+                    list[float]: The collision probabilities, in the order of the CDMs.
+            )doc",
+            arg("cdms"),
+            arg("hard_body_radius"),
+            arg("thread_count") = 0
+        )
+        .def_static(
+            "compute_collision_probabilities",
+            overload_cast<const Array<CDM>&, const Length&, const ExecutionContext&>(
+                &CDM::ComputeCollisionProbabilities
+            ),
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Compute the collision probabilities of an array of CDMs, within an execution context.
+
+                Args:
+                    cdms (list[CDM]): The CDMs.
+                    hard_body_radius (Length): The combined hard body radius.
+                    execution_context (ExecutionContext): The execution context.
+
+                Returns:
+                    list[float]: The collision probabilities, in the order of the CDMs.
+            )doc",
+            arg("cdms"),
+            arg("hard_body_radius"),
+            arg("execution_context")
+        )
         .def_static(
             "object_type_from_string",
             &CDM::ObjectTypeFromString,
@@ -0,0 +1,250 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Conjunction/Screener.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Conjunction_Screener(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::container::Array;
+    using ostk::core::type::Size;
+
+    using ostk::physics::time::Duration;
+    using ostk::physics::time::Interval;
+    using ostk::physics::unit::Length;
+
+    using ostk::astrodynamics::conjunction::Screener;
+    using ostk::astrodynamics::ExecutionContext;
+    using ostk::astrodynamics::Trajectory;
+    using ostk::astrodynamics::trajectory::orbit::model::sgp4::TLE;
+
+    class_<Screener> screener(
+        aModule,
+        "Screener",
+        R"doc(
+            All-vs-all conjunction screener.
+
+            Trajectories are sampled on a regular time grid. Candidate pairs are found per time bucket with a spatial
+            hash of bounding spheres and a perigee / apogee filter, then the time of closest approach is refined as
+            the root of the range rate.
+
+        )doc"
+    );
+
+    class_<Screener::Conjunction>(
+        screener,
+        "Conjunction",
+        R"doc(
+            Close approach between two screened objects, in a CDM compatible layout.
+
+        )doc"
+    )
+
+        .def_readonly(
+            "first_object_index",
+            &Screener::Conjunction::firstObjectIndex,
+            R"doc(
+                The index of the first object.
+            )doc"
+        )
+        .def_readonly(
+            "second_object_index",
+            &Screener::Conjunction::secondObjectIndex,
+            R"doc(
+                The index of the second object.
+            )doc"
+        )
+        .def_readonly(
+            "relative_metadata",
+            &Screener::Conjunction::relativeMetadata,
+            R"doc(
+                The relative metadata (time of closest approach, miss distance, screening period and volume).
+            )doc"
+        )
+        .def_readonly(
+            "relative_position_rtn",
+            &Screener::Conjunction::relativePosition_RTN,
+            R"doc(
+                The relative position of the second object, in the first object RTN frame [m].
+            )doc"
+        )
+        .def_readonly(
+            "relative_velocity_rtn",
+            &Screener::Conjunction::relativeVelocity_RTN,
+            R"doc(
+                The relative velocity of the second object, in the first object RTN frame [m/s].
+            )doc"
+        )
+        .def_readonly(
+            "data_array",
+            &Screener::Conjunction::dataArray,
+            R"doc(
+                The object states at the time of closest approach, in the GCRF frame.
+            )doc"
+        )
+
+        ;
+
+    screener
+
+        .def(
+            init<const Length&, const Duration&, const Duration&, const Size&>(),
+            R"doc(
+                Constructor.
+
+                Args:
+                    screening_distance (Length): The screening distance (spherical screening volume).
+                    step (Duration): The sampling step.
+                    tolerance (Duration): The time of closest approach tolerance.
+                    thread_count (int): The worker thread count (0 defaults to the default thread count of ExecutionContext).
+
+            )doc",
+            arg("screening_distance"),
+            arg("step") = Duration::Seconds(30.0),
+            arg("tolerance") = Duration::Milliseconds(1.0),
+            arg("thread_count") = 0
+        )
+
+        .def("__str__", &(shiftToString<Screener>))
+        .def("__repr__", &(shiftToString<Screener>))
+
+        .def(
+            "is_defined",
+            &Screener::isDefined,
+            R"doc(
+                Check if the screener is defined.
+
+                Returns:
+                    bool: True if the screener is defined.
+            )doc"
+        )
+
+        .def(
+            "get_screening_distance",
+            &Screener::getScreeningDistance,
+            R"doc(
+                Get the screening distance.
+
+                Returns:
+                    Length: The screening distance.
+            )doc"
+        )
+        .def(
+            "get_step",
+            &Screener::getStep,
+            R"doc(
+                Get the sampling step.
+
+                Returns:
+                    Duration: The sampling step.
+            )doc"
+        )
+        .def(
+            "get_tolerance",
+            &Screener::getTolerance,
+            R"doc(
+                Get the time of closest approach tolerance.
+
+                Returns:
+                    Duration: The time of closest approach tolerance.
+            )doc"
+        )
+        .def(
+            "get_thread_count",
+            &Screener::getThreadCount,
+            R"doc(
+                Get the worker thread count.
+
+                Returns:
+                    int: The worker thread count (0 defaults to the default thread count of ExecutionContext).
+            )doc"
+        )
+
+        .def(
+            "screen",
+            overload_cast<const Array<Trajectory>&, const Interval&>(&Screener::screen, const_),
+            call_guard<gil_scoped_release>(),
+            arg("trajectories"),
+            arg("interval"),
+            R"doc(
+                Screen trajectories against each other.
+
+                Args:
+                    trajectories (list[Trajectory]): The trajectories.
+                    interval (Interval): The screening interval.
+
+                Returns:
+                    list[Screener.Conjunction]: The conjunctions, sorted by object indices and time of closest approach.
+            )doc"
+        )
+        .def(
+            "screen",
+            overload_cast<const Array<Trajectory>&, const Interval&, const ExecutionContext&>(
+                &Screener::screen, const_
+            ),
+            call_guard<gil_scoped_release>(),
+            arg("trajectories"),
+            arg("interval"),
+            arg("execution_context"),
+            R"doc(
+                Screen trajectories against each other, within an execution context, which overrides the thread count of the screener.
+
+                Args:
+                    trajectories (list[Trajectory]): The trajectories.
+                    interval (Interval): The screening interval.
+                    execution_context (ExecutionContext): The execution context.
+
+                Returns:
+                    list[Screener.Conjunction]: The conjunctions, sorted by object indices and time of closest approach.
+            )doc"
+        )
+        .def(
+            "screen",
+            overload_cast<const Array<TLE>&, const Interval&>(&Screener::screen, const_),
+            call_guard<gil_scoped_release>(),
+            arg("tles"),
+            arg("interval"),
+            R"doc(
+                Screen a catalog of TLEs against each other, propagated with SGP4.
+
+                Args:
+                    tles (list[TLE]): The TLEs.
+                    interval (Interval): The screening interval.
+
+                Returns:
+                    list[Screener.Conjunction]: The conjunctions, sorted by object indices and time of closest approach.
+            )doc"
+        )
+        .def(
+            "screen",
+            overload_cast<const Array<TLE>&, const Interval&, const ExecutionContext&>(&Screener::screen, const_),
+            call_guard<gil_scoped_release>(),
+            arg("tles"),
+            arg("interval"),
+            arg("execution_context"),
+            R"doc(
+                Screen a catalog of TLEs against each other, propagated with SGP4, within an execution context, which overrides the thread count of the screener.
+
+                Args:
+                    tles (list[TLE]): The TLEs.
+                    interval (Interval): The screening interval.
+                    execution_context (ExecutionContext): The execution context.
+
+                Returns:
+                    list[Screener.Conjunction]: The conjunctions, sorted by object indices and time of closest approach.
+            )doc"
+        )
+
+        .def_static(
+            "undefined",
+            &Screener::Undefined,
+            R"doc(
+                Get an undefined screener.
+
+                Returns:
+                    Screener: An undefined screener.
+            )doc"
+        )
+
+        ;
+}
@@ -5,6 +5,7 @@
 #include <OpenSpaceToolkitAstrodynamicsPy/Dynamics/AtmosphericDrag.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Dynamics/CentralBodyGravity.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Dynamics/PositionDerivative.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Dynamics/SolarRadiationPressure.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Dynamics/Tabulated.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Dynamics/ThirdBodyGravity.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Dynamics/Thruster.cpp>
@@ -180,6 +181,39 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics(pybind11::module& aModule)
 
         ;
 
+    class_<Dynamics::Timing>(
+        aModule.attr("Dynamics"),
+        "Timing",
+        R"doc(
+            Cumulative evaluation count and time of a dynamics within systems of equations.
+
+        )doc"
+    )
+
+        .def_readonly("call_count", &Dynamics::Timing::callCount)
+        .def_readonly("duration", &Dynamics::Timing::duration)
+
+        .def(
+            "to_dict",
+            [](const Dynamics::Timing& aTiming) -> dict
+            {
+                dict timing;
+
+                timing["call_count"] = aTiming.callCount;
+                timing["duration"] = double(aTiming.duration.inSeconds());
+
+                return timing;
+            },
+            R"doc(
+                Convert the timing to a dictionary, e.g. for a metrics exporter.
+
+                Returns:
+                    dict[str, int | float]: The call count, and the cumulative evaluation time [s].
+            )doc"
+        )
+
+        ;
+
     // Create "dynamics" python submodule
     auto dynamics = aModule.def_submodule("dynamics");
 
@@ -188,6 +222,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics(pybind11::module& aModule)
     OpenSpaceToolkitAstrodynamicsPy_Dynamics_CentralBodyGravity(dynamics);
     OpenSpaceToolkitAstrodynamicsPy_Dynamics_ThirdBodyGravity(dynamics);
     OpenSpaceToolkitAstrodynamicsPy_Dynamics_AtmosphericDrag(dynamics);
+    OpenSpaceToolkitAstrodynamicsPy_Dynamics_SolarRadiationPressure(dynamics);
     OpenSpaceToolkitAstrodynamicsPy_Dynamics_Thruster(dynamics);
     OpenSpaceToolkitAstrodynamicsPy_Dynamics_Tabulated(dynamics);
 }
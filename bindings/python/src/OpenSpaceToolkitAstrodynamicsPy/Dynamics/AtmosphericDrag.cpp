@@ -7,11 +7,16 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics_AtmosphericDrag(pybind11::m
     using namespace pybind11;
 
     using ostk::core::type::Shared;
+    using ostk::core::type::Size;
+    using ostk::core::type::String;
 
     using ostk::physics::environment::object::Celestial;
+    using ostk::physics::time::Instant;
+    using ostk::physics::unit::Length;
 
     using ostk::astrodynamics::Dynamics;
     using ostk::astrodynamics::dynamics::AtmosphericDrag;
+    using ostk::astrodynamics::flight::system::SatelliteSystem;
 
     {
         class_<AtmosphericDrag, Dynamics, Shared<AtmosphericDrag>>(
@@ -33,6 +38,46 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics_AtmosphericDrag(pybind11::m
 
                 )doc"
             )
+            .def(
+                init<const Shared<Celestial>&, const Shared<const AtmosphericDrag::DensityTable>&, const String&>(),
+                arg("celestial"),
+                arg("density_table"),
+                arg("name") = String::Empty(),
+                R"doc(
+                    Constructor with density table.
+
+                    Within the tabulated altitude range, the atmospheric density is interpolated from the table instead of being evaluated with the atmospheric model.
+
+                    Args:
+                        celestial (Celestial): The celestial body.
+                        density_table (AtmosphericDrag.DensityTable): The density table of the celestial body.
+                        name (str): The name. Defaults to an empty string (automatic name).
+
+                )doc"
+            )
+            .def(
+                init<
+                    const Shared<Celestial>&,
+                    const Shared<const AtmosphericDrag::DensityTable>&,
+                    const Shared<const SatelliteSystem::ProjectedAreaTable>&,
+                    const String&>(),
+                arg("celestial"),
+                arg("density_table"),
+                arg("projected_area_table"),
+                arg("name") = String::Empty(),
+                R"doc(
+                    Constructor with projected area table.
+
+                    The drag area is interpolated from the projected area table along the relative velocity, expressed in the body frame through the attitude quaternion of the state, instead of being read from the surface area subset.
+
+                    Args:
+                        celestial (Celestial): The celestial body.
+                        density_table (AtmosphericDrag.DensityTable): The density table of the celestial body (can be None).
+                        projected_area_table (SatelliteSystem.ProjectedAreaTable): The projected area table of the satellite (can be None).
+                        name (str): The name. Defaults to an empty string (automatic name).
+
+                )doc"
+            )
 
             .def("__str__", &(shiftToString<AtmosphericDrag>))
             .def("__repr__", &(shiftToString<AtmosphericDrag>))
@@ -61,6 +106,30 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics_AtmosphericDrag(pybind11::m
                 )doc"
             )
 
+            .def(
+                "get_density_table",
+                &AtmosphericDrag::getDensityTable,
+                R"doc(
+                    Get the density table.
+
+                    Returns:
+                        AtmosphericDrag.DensityTable: The density table (None if there is none).
+
+                )doc"
+            )
+
+            .def(
+                "get_projected_area_table",
+                &AtmosphericDrag::getProjectedAreaTable,
+                R"doc(
+                    Get the projected area table.
+
+                    Returns:
+                        SatelliteSystem.ProjectedAreaTable: The projected area table (None if there is none).
+
+                )doc"
+            )
+
             .def(
                 "compute_contribution",
                 &AtmosphericDrag::computeContribution,
@@ -80,5 +149,123 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics_AtmosphericDrag(pybind11::m
 
                 )doc"
             );
+
+        class_<AtmosphericDrag::DensityTable, Shared<AtmosphericDrag::DensityTable>>(
+            aModule.attr("AtmosphericDrag"),
+            "DensityTable",
+            R"doc(
+                An atmospheric density grid (altitude x local solar time x latitude), evaluated once at a reference instant and interpolated afterwards.
+
+                Space weather and solar declination are frozen at the reference instant, hence the table is meant for screening-quality propagations spanning a few days.
+
+            )doc"
+        )
+            .def(
+                init<
+                    const Shared<Celestial>&,
+                    const Instant&,
+                    const Length&,
+                    const Length&,
+                    const Length&,
+                    const Size&,
+                    const Size&>(),
+                arg("celestial"),
+                arg("reference_instant"),
+                arg("minimum_altitude"),
+                arg("maximum_altitude"),
+                arg_v("altitude_step", Length::Kilometers(2.0), "Length.kilometers(2.0)"),
+                arg("local_solar_time_count") = 24,
+                arg("latitude_count") = 19,
+                R"doc(
+                    Constructor.
+
+                    Args:
+                        celestial (Celestial): The celestial body, with an atmospheric model.
+                        reference_instant (Instant): The reference instant.
+                        minimum_altitude (Length): The minimum altitude.
+                        maximum_altitude (Length): The maximum altitude.
+                        altitude_step (Length): The altitude grid step. Defaults to 2 km.
+                        local_solar_time_count (int): The number of local solar time grid points. Defaults to 24.
+                        latitude_count (int): The number of latitude grid points. Defaults to 19.
+
+                )doc"
+            )
+
+            .def(
+                "get_celestial",
+                &AtmosphericDrag::DensityTable::getCelestial,
+                R"doc(
+                    Get the celestial body.
+
+                    Returns:
+                        Celestial: The celestial body.
+
+                )doc"
+            )
+            .def(
+                "get_reference_instant",
+                &AtmosphericDrag::DensityTable::getReferenceInstant,
+                R"doc(
+                    Get the reference instant.
+
+                    Returns:
+                        Instant: The reference instant.
+
+                )doc"
+            )
+            .def(
+                "get_minimum_altitude",
+                &AtmosphericDrag::DensityTable::getMinimumAltitude,
+                R"doc(
+                    Get the minimum altitude.
+
+                    Returns:
+                        Length: The minimum altitude.
+
+                )doc"
+            )
+            .def(
+                "get_maximum_altitude",
+                &AtmosphericDrag::DensityTable::getMaximumAltitude,
+                R"doc(
+                    Get the maximum altitude.
+
+                    Returns:
+                        Length: The maximum altitude.
+
+                )doc"
+            )
+            .def(
+                "is_applicable_at",
+                &AtmosphericDrag::DensityTable::isApplicableAt,
+                arg("position_coordinates"),
+                R"doc(
+                    Check if a position is within the tabulated altitude range.
+
+                    Args:
+                        position_coordinates (numpy.ndarray): The position coordinates [m], expressed in ITRF.
+
+                    Returns:
+                        bool: True if the position is within the tabulated altitude range.
+
+                )doc"
+            )
+            .def(
+                "get_density_at",
+                &AtmosphericDrag::DensityTable::getDensityAt,
+                arg("position_coordinates"),
+                arg("instant"),
+                R"doc(
+                    Get the interpolated atmospheric density.
+
+                    Args:
+                        position_coordinates (numpy.ndarray): The position coordinates [m], expressed in ITRF.
+                        instant (Instant): The instant.
+
+                    Returns:
+                        float: The atmospheric density [kg/m^3].
+
+                )doc"
+            );
     }
 }
@@ -6,9 +6,12 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics_CentralBodyGravity(pybind11
 {
     using namespace pybind11;
 
+    using ostk::core::container::Array;
     using ostk::core::type::Shared;
+    using ostk::core::type::String;
 
     using ostk::physics::environment::object::Celestial;
+    using ostk::physics::unit::Length;
 
     using ostk::astrodynamics::Dynamics;
     using ostk::astrodynamics::dynamics::CentralBodyGravity;
@@ -33,6 +36,23 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics_CentralBodyGravity(pybind11
 
                 )doc"
             )
+            .def(
+                init<const Shared<Celestial>&, const Array<CentralBodyGravity::AltitudeBand>&, const String&>(),
+                arg("celestial"),
+                arg("altitude_bands"),
+                arg("name") = String::Empty(),
+                R"doc(
+                    Constructor with altitude bands.
+
+                    The gravitational field is evaluated with the celestial of the highest band whose minimum altitude is below the current (spherical) altitude, and with the central body below all bands.
+
+                    Args:
+                        celestial (Celestial): The central body.
+                        altitude_bands (list[CentralBodyGravity.AltitudeBand]): The altitude bands.
+                        name (str): The name. Defaults to an empty string (automatic name).
+
+                )doc"
+            )
 
             .def("__str__", &(shiftToString<CentralBodyGravity>))
             .def("__repr__", &(shiftToString<CentralBodyGravity>))
@@ -61,6 +81,18 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics_CentralBodyGravity(pybind11
                 )doc"
             )
 
+            .def(
+                "get_altitude_bands",
+                &CentralBodyGravity::getAltitudeBands,
+                R"doc(
+                    Get the altitude bands.
+
+                    Returns:
+                        list[CentralBodyGravity.AltitudeBand]: The altitude bands, sorted by increasing minimum altitude.
+
+                )doc"
+            )
+
             .def(
                 "compute_contribution",
                 &CentralBodyGravity::computeContribution,
@@ -80,5 +112,34 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics_CentralBodyGravity(pybind11
 
                 )doc"
             );
+
+        class_<CentralBodyGravity::AltitudeBand>(
+            aModule.attr("CentralBodyGravity"),
+            "AltitudeBand",
+            R"doc(
+                An altitude band, above which the gravitational field is evaluated with another gravitational model of the central body.
+
+            )doc"
+        )
+            .def(
+                init(
+                    [](const Length& aMinimumAltitude, const Shared<Celestial>& aCelestialSPtr)
+                    {
+                        return CentralBodyGravity::AltitudeBand {aMinimumAltitude, aCelestialSPtr};
+                    }
+                ),
+                arg("minimum_altitude"),
+                arg("celestial"),
+                R"doc(
+                    Constructor.
+
+                    Args:
+                        minimum_altitude (Length): The minimum altitude of the band.
+                        celestial (Celestial): The central body, with the gravitational model used in the band.
+
+                )doc"
+            )
+            .def_readonly("minimum_altitude", &CentralBodyGravity::AltitudeBand::minimumAltitude)
+            .def_readonly("celestial", &CentralBodyGravity::AltitudeBand::celestialObjectSPtr);
     }
 }
@@ -0,0 +1,141 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/SolarRadiationPressure.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics_SolarRadiationPressure(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Real;
+    using ostk::core::type::Shared;
+    using ostk::core::type::String;
+
+    using ostk::physics::environment::object::Celestial;
+
+    using ostk::astrodynamics::Dynamics;
+    using ostk::astrodynamics::dynamics::SolarRadiationPressure;
+    using ostk::astrodynamics::dynamics::ThirdBodyGravity;
+
+    {
+        class_<SolarRadiationPressure, Dynamics, Shared<SolarRadiationPressure>>(
+            aModule,
+            "SolarRadiationPressure",
+            R"doc(
+                The solar radiation pressure model, for a cannonball spacecraft.
+
+                The illumination fraction follows the conic umbra and penumbra of the occulting body, assumed at the origin of the propagation frame.
+                Reads the position, mass and surface area of the state.
+
+            )doc"
+        )
+            .def(
+                init<
+                    const Shared<Celestial>&,
+                    const Shared<Celestial>&,
+                    const Real&,
+                    const Shared<const ThirdBodyGravity::EphemerisTable>&,
+                    const String&>(),
+                arg("sun"),
+                arg("occulting_celestial"),
+                arg("reflectivity_coefficient"),
+                arg("sun_ephemeris_table") = none(),
+                arg("name") = String::Empty(),
+                R"doc(
+                    Constructor.
+
+                    The Sun ephemeris table (e.g., the one of the Sun third body gravity) can be shared by all the dynamics propagated over the same interval.
+
+                    Args:
+                        sun (Celestial): The Sun.
+                        occulting_celestial (Celestial): The occulting celestial body, at the origin of the propagation frame.
+                        reflectivity_coefficient (float): The reflectivity coefficient (1.0 for a black body, 2.0 for a perfect mirror).
+                        sun_ephemeris_table (ThirdBodyGravity.EphemerisTable): The ephemeris table of the Sun. Defaults to None.
+                        name (str): The name. Defaults to an empty string (automatic name).
+
+                )doc"
+            )
+
+            .def("__str__", &(shiftToString<SolarRadiationPressure>))
+            .def("__repr__", &(shiftToString<SolarRadiationPressure>))
+
+            .def(
+                "is_defined",
+                &SolarRadiationPressure::isDefined,
+                R"doc(
+                    Check if the solar radiation pressure is defined.
+
+                    Returns:
+                        bool: True if the solar radiation pressure is defined, False otherwise.
+
+                )doc"
+            )
+
+            .def(
+                "get_sun",
+                &SolarRadiationPressure::getSun,
+                R"doc(
+                    Get the Sun.
+
+                    Returns:
+                        Celestial: The Sun.
+
+                )doc"
+            )
+
+            .def(
+                "get_occulting_celestial",
+                &SolarRadiationPressure::getOccultingCelestial,
+                R"doc(
+                    Get the occulting celestial body.
+
+                    Returns:
+                        Celestial: The occulting celestial body.
+
+                )doc"
+            )
+
+            .def(
+                "get_reflectivity_coefficient",
+                &SolarRadiationPressure::getReflectivityCoefficient,
+                R"doc(
+                    Get the reflectivity coefficient.
+
+                    Returns:
+                        float: The reflectivity coefficient.
+
+                )doc"
+            )
+
+            .def(
+                "get_sun_ephemeris_table",
+                &SolarRadiationPressure::getSunEphemerisTable,
+                R"doc(
+                    Get the Sun ephemeris table.
+
+                    Returns:
+                        ThirdBodyGravity.EphemerisTable: The Sun ephemeris table (None if there is none).
+
+                )doc"
+            )
+
+            .def(
+                "compute_contribution",
+                &SolarRadiationPressure::computeContribution,
+                arg("instant"),
+                arg("x"),
+                arg("frame"),
+                R"doc(
+                    Compute the contribution of the solar radiation pressure to the state vector.
+
+                    Args:
+                        instant (Instant): The instant of the state vector.
+                        x (numpy.ndarray): The state vector.
+                        frame (Frame): The reference frame.
+
+                    Returns:
+                        numpy.ndarray: The contribution of the solar radiation pressure to the state vector.
+
+                )doc"
+            );
+    }
+}
@@ -7,8 +7,13 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics_ThirdBodyGravity(pybind11::
     using namespace pybind11;
 
     using ostk::core::type::Shared;
+    using ostk::core::type::Size;
+    using ostk::core::type::String;
 
+    using ostk::physics::coordinate::Frame;
     using ostk::physics::environment::object::Celestial;
+    using ostk::physics::time::Duration;
+    using ostk::physics::time::Interval;
 
     using ostk::astrodynamics::Dynamics;
     using ostk::astrodynamics::dynamics::ThirdBodyGravity;
@@ -33,6 +38,24 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics_ThirdBodyGravity(pybind11::
 
                 )doc"
             )
+            .def(
+                init<const Shared<Celestial>&, const Shared<const ThirdBodyGravity::EphemerisTable>&, const String&>(),
+                arg("celestial"),
+                arg("ephemeris_table"),
+                arg("name") = String::Empty(),
+                R"doc(
+                    Constructor with ephemeris table.
+
+                    Within the tabulated interval and frame, the celestial body position is obtained from the table and its gravity is evaluated as that of a point mass.
+                    The table can be shared by all the dynamics propagated over the same interval.
+
+                    Args:
+                        celestial (Celestial): The celestial body.
+                        ephemeris_table (ThirdBodyGravity.EphemerisTable): The ephemeris table of the celestial body.
+                        name (str): The name. Defaults to an empty string (automatic name).
+
+                )doc"
+            )
 
             .def("__str__", &(shiftToString<ThirdBodyGravity>))
             .def("__repr__", &(shiftToString<ThirdBodyGravity>))
@@ -61,6 +84,18 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics_ThirdBodyGravity(pybind11::
                 )doc"
             )
 
+            .def(
+                "get_ephemeris_table",
+                &ThirdBodyGravity::getEphemerisTable,
+                R"doc(
+                    Get the ephemeris table.
+
+                    Returns:
+                        ThirdBodyGravity.EphemerisTable: The ephemeris table (None if there is none).
+
+                )doc"
+            )
+
             .def(
                 "compute_contribution",
                 &ThirdBodyGravity::computeContribution,
@@ -80,5 +115,104 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Dynamics_ThirdBodyGravity(pybind11::
 
                 )doc"
             );
+
+        class_<ThirdBodyGravity::EphemerisTable, Shared<ThirdBodyGravity::EphemerisTable>>(
+            aModule.attr("ThirdBodyGravity"),
+            "EphemerisTable",
+            R"doc(
+                A position table of a celestial body over an interval, stored as piecewise Chebyshev polynomials.
+
+            )doc"
+        )
+            .def(
+                init<
+                    const Shared<Celestial>&,
+                    const Interval&,
+                    const Shared<const Frame>&,
+                    const Duration&,
+                    const Size&>(),
+                arg("celestial"),
+                arg("interval"),
+                arg("frame"),
+                arg_v("segment_duration", Duration::Days(1.0), "Duration.days(1.0)"),
+                arg("degree") = 12,
+                R"doc(
+                    Constructor.
+
+                    Args:
+                        celestial (Celestial): The celestial body.
+                        interval (Interval): The tabulated interval.
+                        frame (Frame): The frame in which positions are tabulated.
+                        segment_duration (Duration): The polynomial segment duration. Defaults to one day.
+                        degree (int): The polynomial degree. Defaults to 12.
+
+                )doc"
+            )
+
+            .def(
+                "get_celestial",
+                &ThirdBodyGravity::EphemerisTable::getCelestial,
+                R"doc(
+                    Get the celestial body.
+
+                    Returns:
+                        Celestial: The celestial body.
+
+                )doc"
+            )
+            .def(
+                "get_interval",
+                &ThirdBodyGravity::EphemerisTable::getInterval,
+                R"doc(
+                    Get the tabulated interval.
+
+                    Returns:
+                        Interval: The tabulated interval.
+
+                )doc"
+            )
+            .def(
+                "get_frame",
+                &ThirdBodyGravity::EphemerisTable::getFrame,
+                R"doc(
+                    Get the frame in which positions are tabulated.
+
+                    Returns:
+                        Frame: The frame.
+
+                )doc"
+            )
+            .def(
+                "is_applicable_at",
+                &ThirdBodyGravity::EphemerisTable::isApplicableAt,
+                arg("instant"),
+                arg("frame"),
+                R"doc(
+                    Check if the table can be evaluated at a given instant, in a given frame.
+
+                    Args:
+                        instant (Instant): The instant.
+                        frame (Frame): The frame.
+
+                    Returns:
+                        bool: True if the instant is in the tabulated interval and the frame is the tabulated frame.
+
+                )doc"
+            )
+            .def(
+                "get_position_at",
+                &ThirdBodyGravity::EphemerisTable::getPositionAt,
+                arg("instant"),
+                R"doc(
+                    Get the position of the celestial body at a given instant.
+
+                    Args:
+                        instant (Instant): The instant, in the tabulated interval.
+
+                    Returns:
+                        numpy.ndarray: The position coordinates [m], expressed in the tabulated frame.
+
+                )doc"
+            );
     }
 }
@@ -233,6 +233,17 @@ inline void OpenSpaceToolkitAstrodynamicsPy_EventCondition(pybind11::module& aMo
                 )doc"
             )
 
+            .def(
+                "get_target_instant",
+                &EventCondition::getTargetInstant,
+                R"doc(
+                    Get the target instant, for an event condition that only depends on time.
+
+                    Returns:
+                       Instant: The target instant, undefined if the event condition does not only depend on time.
+                )doc"
+            )
+
             .def(
                 "is_satisfied",
                 &EventCondition::isSatisfied,
@@ -82,6 +82,29 @@ inline void OpenSpaceToolkitAstrodynamicsPy_EventCondition_LogicalCondition(pybi
                 )doc"
             )
 
+            .def(
+                "is_compiled",
+                &LogicalCondition::isCompiled,
+                R"doc(
+                    Check if the logical condition is compiled.
+
+                    Returns:
+                        bool: True if the logical condition is compiled.
+
+                )doc"
+            )
+
+            .def(
+                "compile",
+                &LogicalCondition::compile,
+                R"doc(
+                    Compile the logical condition into a single fused evaluator.
+
+                    Nested logical conditions of the same type are flattened, repeated event conditions are evaluated once, and the event conditions are evaluated in order of increasing measured cost per decision, short-circuiting the remaining ones. The outcome of the evaluations is unchanged.
+
+                )doc"
+            )
+
             ;
     }
 }
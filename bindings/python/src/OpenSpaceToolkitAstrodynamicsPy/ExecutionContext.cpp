@@ -0,0 +1,78 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/ExecutionContext.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_ExecutionContext(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Size;
+
+    using ostk::astrodynamics::ExecutionContext;
+
+    class_<ExecutionContext>(
+        aModule,
+        "ExecutionContext",
+        R"doc(
+            Execution context of the parallel operations of the library.
+
+            Runs independent tasks on a bounded number of worker threads, which claim tasks dynamically. Results are
+            collected in task order, and the exception of the failed task of lowest index is raised, hence results do
+            not depend on the thread count. Parallel operations started from a worker run serially on that worker.
+
+            A thread count of 0 resolves to the process-wide default thread count, which is the hardware concurrency
+            unless set otherwise. Library operations taking a thread count of 0 resolve it the same way.
+
+        )doc"
+    )
+
+        .def(
+            init<const Size&>(),
+            R"doc(
+                Constructor.
+
+                Args:
+                    thread_count (int): The maximum worker thread count. Defaults to 0, i.e. the default thread count.
+
+            )doc",
+            arg("thread_count") = 0
+        )
+
+        .def(
+            "get_thread_count",
+            &ExecutionContext::getThreadCount,
+            R"doc(
+                Get the maximum worker thread count, with 0 resolved to the process-wide default.
+
+                Returns:
+                    int: The thread count.
+
+            )doc"
+        )
+
+        .def_static(
+            "get_default_thread_count",
+            &ExecutionContext::GetDefaultThreadCount,
+            R"doc(
+                Get the process-wide default thread count.
+
+                Returns:
+                    int: The default thread count.
+
+            )doc"
+        )
+        .def_static(
+            "set_default_thread_count",
+            &ExecutionContext::SetDefaultThreadCount,
+            R"doc(
+                Set the process-wide default thread count.
+
+                Args:
+                    thread_count (int): The thread count. 0 resets the default to the hardware concurrency.
+
+            )doc",
+            arg("thread_count")
+        )
+
+        ;
+}
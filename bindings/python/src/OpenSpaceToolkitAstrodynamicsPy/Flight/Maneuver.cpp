@@ -65,7 +65,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Flight_Maneuver(pybind11::module& aM
         .def(
             "get_acceleration_profile",
             &Maneuver::getAccelerationProfile,
-            arg_v("frame", Maneuver::DefaultAccelFrameSPtr, "GCRF"),
+            arg_v("frame", Maneuver::DefaultAccelFrame(), "GCRF"),
             R"doc(
                 Get the acceleration profile.
 
@@ -76,6 +76,22 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Flight_Maneuver(pybind11::module& aM
                     list[numpy.ndarray]: The acceleration profile (m/s^2).
             )doc"
         )
+        .def(
+            "get_acceleration_profile_in_local_orbital_frame",
+            &Maneuver::getAccelerationProfileInLocalOrbitalFrame,
+            arg("local_orbital_frame_factory"),
+            arg("states"),
+            R"doc(
+                Get the acceleration profile expressed in a local orbital frame.
+
+                Args:
+                    local_orbital_frame_factory (LocalOrbitalFrameFactory): The local orbital frame factory.
+                    states (list[State]): The states, one per maneuver instant.
+
+                Returns:
+                    list[numpy.ndarray]: The acceleration profile (m/s^2).
+            )doc"
+        )
         .def(
             "get_mass_flow_rate_profile",
             &Maneuver::getMassFlowRateProfile,
@@ -147,7 +163,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Flight_Maneuver(pybind11::module& aM
         .def(
             "to_tabulated_dynamics",
             &Maneuver::toTabulatedDynamics,
-            arg_v("frame", Maneuver::DefaultAccelFrameSPtr, "GCRF"),
+            arg_v("frame", Maneuver::DefaultAccelFrame(), "GCRF"),
             arg("interpolation_type") = DEFAULT_MANEUVER_INTERPOLATION_TYPE,
             R"doc(
                 Convert the maneuver to tabulated dynamics.
@@ -174,6 +190,26 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Flight_Maneuver(pybind11::module& aM
                 Maneuver: The created maneuver.
         )doc"
         )
+        .def_static(
+            "local_orbital_frame_acceleration_profile",
+            &Maneuver::LocalOrbitalFrameAccelerationProfile,
+            arg("states"),
+            arg("acceleration_profile"),
+            arg("local_orbital_frame_factory"),
+            arg("mass_flow_rate_profile"),
+            R"doc(
+                Create a maneuver from an acceleration profile expressed in a local orbital frame.
+
+                Args:
+                    states (list[State]): An array of states, must be sorted.
+                    acceleration_profile (list[numpy.ndarray]): An acceleration profile of the maneuver, one numpy.ndarray per state.
+                    local_orbital_frame_factory (LocalOrbitalFrameFactory): The local orbital frame factory, in which the acceleration profile is defined.
+                    mass_flow_rate_profile (list[float]): A mass flow rate profile of the maneuver (negative numbers expected).
+
+                Returns:
+                    Maneuver: The created maneuver.
+            )doc"
+        )
         .def_static(
             "constant_mass_flow_rate_profile",
             &Maneuver::ConstantMassFlowRateProfile,
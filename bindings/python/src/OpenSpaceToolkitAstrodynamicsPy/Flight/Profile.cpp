@@ -111,6 +111,23 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Flight_Profile(pybind11::module& aMo
             arg("frame_name")
         )
 
+        .def(
+            "tabulate",
+            &Profile::tabulate,
+            R"doc(
+                Get a profile whose transforms are tabulated on a grid of instants.
+
+                The transforms are evaluated once at each instant of the grid, and served from that table to subsequent queries at these instants, including through body frames.
+
+                Args:
+                    instants (list[Instant]): The instants of the grid.
+
+                Returns:
+                    Profile: The tabulated profile.
+            )doc",
+            arg("instants")
+        )
+
         .def_static(
             "undefined",
             &Profile::Undefined,
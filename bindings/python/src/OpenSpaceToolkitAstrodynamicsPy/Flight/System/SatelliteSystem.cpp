@@ -7,9 +7,12 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Flight_System_SatelliteSystem(pybind
     using namespace pybind11;
 
     using ostk::core::type::Real;
+    using ostk::core::type::Shared;
+    using ostk::core::type::Size;
 
     using ostk::mathematics::geometry::d3::object::Composite;
     using ostk::mathematics::object::Matrix3d;
+    using ostk::mathematics::object::Vector3d;
 
     using ostk::physics::unit::Mass;
 
@@ -116,6 +119,18 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Flight_System_SatelliteSystem(pybind
                 )doc"
             )
 
+            .def(
+                "get_projected_area_table",
+                &SatelliteSystem::getProjectedAreaTable,
+                R"doc(
+                    Get the projected area table of the satellite system, built once along with the satellite system.
+
+                    Returns:
+                        SatelliteSystem.ProjectedAreaTable: The projected area table (None if the geometry is not supported).
+
+                )doc"
+            )
+
             .def_static(
                 "undefined",
                 &SatelliteSystem::Undefined,
@@ -138,6 +153,109 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Flight_System_SatelliteSystem(pybind
                 )doc"
             )
 
+            ;
+
+        class_<SatelliteSystem::ProjectedAreaTable, Shared<SatelliteSystem::ProjectedAreaTable>>(
+            aModule.attr("SatelliteSystem"),
+            "ProjectedAreaTable",
+            R"doc(
+                Projected surface area of a satellite geometry, tabulated over the view directions expressed in the satellite body frame.
+
+                The projected areas of the cuboids of the geometry are summed: overlaps and self-shadowing are not accounted for.
+
+            )doc"
+        )
+
+            .def(
+                init<const Composite&, const Size&, const Size&>(),
+                arg("geometry"),
+                arg("azimuth_count") = 72,
+                arg("elevation_count") = 37,
+                R"doc(
+                    Constructor.
+
+                    Args:
+                        geometry (Composite): The geometry, made of cuboids and points.
+                        azimuth_count (int): The number of azimuth grid points. Defaults to 72.
+                        elevation_count (int): The number of elevation grid points. Defaults to 37.
+
+                )doc"
+            )
+
+            .def(
+                "get_azimuth_count",
+                &SatelliteSystem::ProjectedAreaTable::getAzimuthCount,
+                R"doc(
+                    Get the number of azimuth grid points.
+
+                    Returns:
+                        int: The number of azimuth grid points.
+
+                )doc"
+            )
+
+            .def(
+                "get_elevation_count",
+                &SatelliteSystem::ProjectedAreaTable::getElevationCount,
+                R"doc(
+                    Get the number of elevation grid points.
+
+                    Returns:
+                        int: The number of elevation grid points.
+
+                )doc"
+            )
+
+            .def(
+                "get_projected_area_at",
+                &SatelliteSystem::ProjectedAreaTable::getProjectedAreaAt,
+                arg("direction"),
+                R"doc(
+                    Get the interpolated projected area along a view direction.
+
+                    Args:
+                        direction (np.ndarray): The view direction, expressed in the satellite body frame.
+
+                    Returns:
+                        float: The projected area [m^2].
+
+                )doc"
+            )
+
+            .def_static(
+                "is_supported",
+                &SatelliteSystem::ProjectedAreaTable::IsSupported,
+                arg("geometry"),
+                R"doc(
+                    Check if a geometry is supported by projected area tables.
+
+                    Args:
+                        geometry (Composite): The geometry.
+
+                    Returns:
+                        bool: True if the geometry is defined, and made of cuboids and points only.
+
+                )doc"
+            )
+
+            .def_static(
+                "compute_projected_area",
+                &SatelliteSystem::ProjectedAreaTable::ComputeProjectedArea,
+                arg("geometry"),
+                arg("direction"),
+                R"doc(
+                    Compute the projected area of a geometry along a view direction.
+
+                    Args:
+                        geometry (Composite): The geometry, made of cuboids and points.
+                        direction (np.ndarray): The unit view direction, expressed in the satellite body frame.
+
+                    Returns:
+                        float: The projected area [m^2].
+
+                )doc"
+            )
+
             ;
     }
 }
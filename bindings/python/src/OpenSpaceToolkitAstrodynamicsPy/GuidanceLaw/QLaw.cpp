@@ -4,8 +4,10 @@
 
 using namespace pybind11;
 
+using ostk::core::container::Array;
 using ostk::core::container::Map;
 using ostk::core::container::Tuple;
+using ostk::core::type::Real;
 using ostk::core::type::Shared;
 using ostk::core::type::Size;
 using ostk::core::type::String;
@@ -13,12 +15,19 @@ using ostk::core::type::String;
 using ostk::mathematics::object::Vector3d;
 
 using ostk::physics::coordinate::Frame;
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 using ostk::physics::unit::Derived;
 
+using ostk::astrodynamics::Dynamics;
+using ostk::astrodynamics::EventCondition;
+using ostk::astrodynamics::ExecutionContext;
+using ostk::astrodynamics::flight::system::SatelliteSystem;
 using ostk::astrodynamics::GuidanceLaw;
 using ostk::astrodynamics::guidancelaw::QLaw;
 using ostk::astrodynamics::trajectory::orbit::model::kepler::COE;
+using ostk::astrodynamics::trajectory::State;
+using ostk::astrodynamics::trajectory::state::NumericalSolver;
 
 void OpenSpaceToolkitAstrodynamicsPy_GuidanceLaw_QLaw(pybind11::module& aModule)
 {
@@ -204,6 +213,52 @@ void OpenSpaceToolkitAstrodynamicsPy_GuidanceLaw_QLaw(pybind11::module& aModule)
 
         .value("Analytical", QLaw::GradientStrategy::Analytical, "Analytical")
         .value("FiniteDifference", QLaw::GradientStrategy::FiniteDifference, "Finite Differenced")
+        .value(
+            "AutomaticDifferentiation",
+            QLaw::GradientStrategy::AutomaticDifferentiation,
+            "Forward-mode Automatic Differentiation"
+        )
+
+        ;
+
+    class_<QLaw::SweepResult>(
+        qLaw,
+        "SweepResult",
+        R"doc(
+            The outcome of the propagation of one parameterization of a sweep.
+
+        )doc"
+    )
+        .def_readonly(
+            "condition_is_satisfied",
+            &QLaw::SweepResult::conditionIsSatisfied,
+            R"doc(
+                Whether the event condition is satisfied.
+
+                Type:
+                    bool
+            )doc"
+        )
+        .def_readonly(
+            "time_of_flight",
+            &QLaw::SweepResult::timeOfFlight,
+            R"doc(
+                The propagation duration.
+
+                Type:
+                    Duration
+            )doc"
+        )
+        .def_readonly(
+            "delta_v",
+            &QLaw::SweepResult::deltaV,
+            R"doc(
+                The delta V [m/s].
+
+                Type:
+                    float
+            )doc"
+        )
 
         ;
 
@@ -213,7 +268,13 @@ void OpenSpaceToolkitAstrodynamicsPy_GuidanceLaw_QLaw(pybind11::module& aModule)
         .def("__repr__", &(shiftToString<QLaw>))
 
         .def(
-            init<const COE&, const Derived&, const QLaw::Parameters&, const QLaw::GradientStrategy&>(),
+            init<
+                const COE&,
+                const Derived&,
+                const QLaw::Parameters&,
+                const QLaw::GradientStrategy&,
+                const Duration&,
+                const Real&>(),
             R"doc(
                 Constructor.
 
@@ -222,12 +283,16 @@ void OpenSpaceToolkitAstrodynamicsPy_GuidanceLaw_QLaw(pybind11::module& aModule)
                     gravitational_parameter (float): The gravitational parameter of the central body.
                     parameters (QLaw.Parameters): A set of parameters for the QLaw.
                     gradient_strategy (QLaw.GradientStrategy): The strategy used to compute the gradient dQ_dOE. Defaults to FiniteDifference.
+                    direction_update_interval (Duration): The duration the thrust direction is held for, in the theta-R-H frame, before being recomputed. Defaults to zero (recomputed at every call).
+                    direction_update_threshold (Real): The change in orbital elements beyond which the held thrust direction is recomputed, as the largest of the relative semi-major axis change, the eccentricity change and the angle changes [rad]. Defaults to undefined, in which case a held direction is recomputed beyond a change of 1e-3. Held directions are kept per thread, and only reused for the elements they were computed at, so that a guidance law can be shared across propagations.
 
             )doc",
             arg("target_coe"),
             arg("gravitational_parameter"),
             arg("parameters"),
-            arg("gradient_strategy") = QLaw::GradientStrategy::FiniteDifference
+            arg("gradient_strategy") = QLaw::GradientStrategy::FiniteDifference,
+            arg("direction_update_interval") = Duration::Zero(),
+            arg("direction_update_threshold") = Real::Undefined()
         )
 
         .def(
@@ -260,6 +325,26 @@ void OpenSpaceToolkitAstrodynamicsPy_GuidanceLaw_QLaw(pybind11::module& aModule)
                     QLaw.GradientStrategy: The gradient strategy.
             )doc"
         )
+        .def(
+            "get_direction_update_interval",
+            &QLaw::getDirectionUpdateInterval,
+            R"doc(
+                Get the thrust direction update interval.
+
+                Returns:
+                    Duration: The thrust direction update interval.
+            )doc"
+        )
+        .def(
+            "get_direction_update_threshold",
+            &QLaw::getDirectionUpdateThreshold,
+            R"doc(
+                Get the thrust direction update threshold.
+
+                Returns:
+                    Real: The thrust direction update threshold.
+            )doc"
+        )
 
         .def(
             "calculate_thrust_acceleration_at",
@@ -284,5 +369,101 @@ void OpenSpaceToolkitAstrodynamicsPy_GuidanceLaw_QLaw(pybind11::module& aModule)
             arg("output_frame")
         )
 
+        .def_static(
+            "sweep",
+            overload_cast<
+                const COE&,
+                const Derived&,
+                const Array<QLaw::Parameters>&,
+                const State&,
+                const SatelliteSystem&,
+                const Shared<EventCondition>&,
+                const Array<Shared<Dynamics>>&,
+                const NumericalSolver&,
+                const Duration&,
+                const QLaw::GradientStrategy&,
+                const Size&>(&QLaw::Sweep),
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Propagate a set of parameterizations of the QLaw from the same initial state, in parallel.
+
+                Each parameterization drives a maneuvering segment, solved until the event condition is satisfied or
+                the maximum propagation duration is reached. The dynamics are shared read-only between the workers.
+
+                Args:
+                    target_coe (COE): The target orbit described by Classical Orbital Elements.
+                    gravitational_parameter (Derived): The gravitational parameter of the central body.
+                    parameters_array (list[QLaw.Parameters]): The parameters, one per run.
+                    state (State): The initial state, holding the mass of the spacecraft.
+                    satellite_system (SatelliteSystem): The satellite system, providing the propulsion system.
+                    event_condition (EventCondition): The event condition ending each run.
+                    dynamics (list[Dynamics]): The dynamics, excluding the thruster.
+                    numerical_solver (NumericalSolver): The numerical solver.
+                    maximum_propagation_duration (Duration): The maximum propagation duration per run. Defaults to 30 days.
+                    gradient_strategy (QLaw.GradientStrategy): The strategy used to compute the gradient dQ_dOE. Defaults to FiniteDifference.
+                    thread_count (int): The worker thread count, 0 defaulting to the default thread count of ExecutionContext. Defaults to 0.
+
+                Returns:
+                    list[QLaw.SweepResult]: The sweep results, in the order of the parameters.
+            )doc",
+            arg("target_coe"),
+            arg("gravitational_parameter"),
+            arg("parameters_array"),
+            arg("state"),
+            arg("satellite_system"),
+            arg("event_condition"),
+            arg("dynamics"),
+            arg("numerical_solver"),
+            arg("maximum_propagation_duration") = Duration::Days(30.0),
+            arg("gradient_strategy") = QLaw::GradientStrategy::FiniteDifference,
+            arg("thread_count") = 0
+        )
+        .def_static(
+            "sweep",
+            overload_cast<
+                const COE&,
+                const Derived&,
+                const Array<QLaw::Parameters>&,
+                const State&,
+                const SatelliteSystem&,
+                const Shared<EventCondition>&,
+                const Array<Shared<Dynamics>>&,
+                const NumericalSolver&,
+                const Duration&,
+                const QLaw::GradientStrategy&,
+                const ExecutionContext&>(&QLaw::Sweep),
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Propagate a set of parameterizations of the QLaw from the same initial state, within an execution context.
+
+                Args:
+                    target_coe (COE): The target orbit described by Classical Orbital Elements.
+                    gravitational_parameter (Derived): The gravitational parameter of the central body.
+                    parameters_array (list[QLaw.Parameters]): The parameters, one per run.
+                    state (State): The initial state, holding the mass of the spacecraft.
+                    satellite_system (SatelliteSystem): The satellite system, providing the propulsion system.
+                    event_condition (EventCondition): The event condition ending each run.
+                    dynamics (list[Dynamics]): The dynamics, excluding the thruster.
+                    numerical_solver (NumericalSolver): The numerical solver.
+                    maximum_propagation_duration (Duration): The maximum propagation duration per run.
+                    gradient_strategy (QLaw.GradientStrategy): The strategy used to compute the gradient dQ_dOE.
+                    execution_context (ExecutionContext): The execution context.
+
+                Returns:
+                    list[QLaw.SweepResult]: The sweep results, in the order of the parameters.
+            )doc",
+            arg("target_coe"),
+            arg("gravitational_parameter"),
+            arg("parameters_array"),
+            arg("state"),
+            arg("satellite_system"),
+            arg("event_condition"),
+            arg("dynamics"),
+            arg("numerical_solver"),
+            arg("maximum_propagation_duration"),
+            arg("gradient_strategy"),
+            arg("execution_context")
+        )
+
         ;
 }
@@ -0,0 +1,124 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/ModelCache.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_ModelCache(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Integer;
+
+    using ostk::astrodynamics::ModelCache;
+    using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
+    using EarthMagneticModel = ostk::physics::environment::magnetic::Earth;
+    using EarthAtmosphericModel = ostk::physics::environment::atmospheric::Earth;
+
+    class_<ModelCache>(
+        aModule,
+        "ModelCache",
+        R"doc(
+            Process-wide cache of environment models.
+
+            Constructing an Earth gravitational model (e.g. EGM2008) or atmospheric model (e.g. NRLMSISE00) loads and
+            parses coefficient and space weather files. Models are constructed once per type (and degree and order for
+            gravitational models), then shared, and remain valid after the cache is cleared. Accesses are thread-safe.
+
+        )doc"
+    )
+
+        .def_static(
+            "access_earth_gravitational_model",
+            &ModelCache::AccessEarthGravitationalModel,
+            R"doc(
+                Access an Earth gravitational model.
+
+                Args:
+                    type (EarthGravitationalModel.Type): The gravitational model type.
+                    degree (int, optional): The maximum degree. Defaults to the model maximum.
+                    order (int, optional): The maximum order. Defaults to the model maximum.
+
+                Returns:
+                    EarthGravitationalModel: The shared gravitational model.
+
+            )doc",
+            arg("type"),
+            arg("degree") = Integer::Undefined(),
+            arg("order") = Integer::Undefined()
+        )
+        .def_static(
+            "access_earth_magnetic_model",
+            &ModelCache::AccessEarthMagneticModel,
+            R"doc(
+                Access an Earth magnetic model.
+
+                Args:
+                    type (EarthMagneticModel.Type): The magnetic model type.
+
+                Returns:
+                    EarthMagneticModel: The shared magnetic model.
+
+            )doc",
+            arg("type")
+        )
+        .def_static(
+            "access_earth_atmospheric_model",
+            &ModelCache::AccessEarthAtmosphericModel,
+            R"doc(
+                Access an Earth atmospheric model.
+
+                Args:
+                    type (EarthAtmosphericModel.Type): The atmospheric model type.
+
+                Returns:
+                    EarthAtmosphericModel: The shared atmospheric model.
+
+            )doc",
+            arg("type")
+        )
+        .def_static(
+            "access_earth",
+            &ModelCache::AccessEarth,
+            R"doc(
+                Access an Earth celestial object, built from cached models.
+
+                The returned object is shared, and is not to be modified.
+
+                Args:
+                    gravitational_model_type (EarthGravitationalModel.Type): The gravitational model type.
+                    gravitational_model_degree (int, optional): The maximum degree. Defaults to the model maximum.
+                    gravitational_model_order (int, optional): The maximum order. Defaults to the model maximum.
+                    magnetic_model_type (EarthMagneticModel.Type, optional): The magnetic model type.
+                    atmospheric_model_type (EarthAtmosphericModel.Type, optional): The atmospheric model type.
+
+                Returns:
+                    Celestial: The shared Earth celestial object.
+
+            )doc",
+            arg("gravitational_model_type"),
+            arg("gravitational_model_degree") = Integer::Undefined(),
+            arg("gravitational_model_order") = Integer::Undefined(),
+            arg("magnetic_model_type") = EarthMagneticModel::Type::Undefined,
+            arg("atmospheric_model_type") = EarthAtmosphericModel::Type::Undefined
+        )
+        .def_static(
+            "get_size",
+            &ModelCache::GetSize,
+            R"doc(
+                Get the number of cached models and celestial objects.
+
+                Returns:
+                    int: The cached entry count.
+
+            )doc"
+        )
+        .def_static(
+            "clear",
+            &ModelCache::Clear,
+            R"doc(
+                Clear the cache. Models handed out beforehand remain valid.
+
+            )doc"
+        )
+
+        ;
+}
@@ -0,0 +1,14 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkitAstrodynamicsPy/OrbitDetermination/BatchLeastSquaresSolver.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/OrbitDetermination/Measurement.cpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_OrbitDetermination(pybind11::module& aModule)
+{
+    // Create "orbit_determination" python submodule
+    auto orbitDetermination = aModule.def_submodule("orbit_determination");
+
+    // Add objects to "orbit_determination" submodule
+    OpenSpaceToolkitAstrodynamicsPy_OrbitDetermination_Measurement(orbitDetermination);
+    OpenSpaceToolkitAstrodynamicsPy_OrbitDetermination_BatchLeastSquaresSolver(orbitDetermination);
+}
@@ -0,0 +1,208 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/OrbitDetermination/BatchLeastSquaresSolver.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_OrbitDetermination_BatchLeastSquaresSolver(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::container::Array;
+    using ostk::core::type::Real;
+    using ostk::core::type::Size;
+
+    using ostk::astrodynamics::orbitdetermination::BatchLeastSquaresSolver;
+    using ostk::astrodynamics::orbitdetermination::Measurement;
+    using ostk::astrodynamics::trajectory::Propagator;
+    using ostk::astrodynamics::trajectory::State;
+
+    class_<BatchLeastSquaresSolver> batchLeastSquaresSolver(
+        aModule,
+        "BatchLeastSquaresSolver",
+        R"doc(
+            Batch least squares orbit determination.
+
+            Estimates the position and velocity of an object at an epoch from tracking measurements, with Gauss-Newton
+            iterations on the normal equations. Each iteration takes a single propagation, integrating the variational
+            equations alongside the state over all the measurement instants. Measurement residuals and partials are
+            then evaluated concurrently.
+
+            Iterations stop once the weighted root mean square of the residuals changes by less than the relative
+            tolerance between two iterations.
+
+        )doc"
+    );
+
+    class_<BatchLeastSquaresSolver::Analysis>(
+        batchLeastSquaresSolver,
+        "Analysis",
+        R"doc(
+            The outcome of an orbit determination.
+
+        )doc"
+    )
+        .def_readonly(
+            "estimated_state",
+            &BatchLeastSquaresSolver::Analysis::estimatedState,
+            R"doc(
+                The estimated state at the epoch of the initial guess, in GCRF.
+
+                Type:
+                    State
+            )doc"
+        )
+        .def_readonly(
+            "covariance",
+            &BatchLeastSquaresSolver::Analysis::covariance,
+            R"doc(
+                The formal covariance of the estimated position and velocity (6 x 6), in GCRF.
+
+                Type:
+                    np.ndarray
+            )doc"
+        )
+        .def_readonly(
+            "iteration_count",
+            &BatchLeastSquaresSolver::Analysis::iterationCount,
+            R"doc(
+                The number of iterations (propagations).
+
+                Type:
+                    int
+            )doc"
+        )
+        .def_readonly(
+            "has_converged",
+            &BatchLeastSquaresSolver::Analysis::hasConverged,
+            R"doc(
+                True if the tolerance was met within the maximum iteration count.
+
+                Type:
+                    bool
+            )doc"
+        )
+        .def_readonly(
+            "rms_weighted_residual",
+            &BatchLeastSquaresSolver::Analysis::rmsWeightedResidual,
+            R"doc(
+                The root mean square of the residuals, weighted by the standard deviations.
+
+                Type:
+                    Real
+            )doc"
+        )
+        .def_readonly(
+            "residuals",
+            &BatchLeastSquaresSolver::Analysis::residuals,
+            R"doc(
+                The residuals of the measurements at the estimated state, in measurement order.
+
+                Type:
+                    list[np.ndarray]
+            )doc"
+        )
+
+        ;
+
+    batchLeastSquaresSolver
+
+        .def(
+            init<const Propagator&, const Size&, const Real&>(),
+            arg("propagator"),
+            arg("maximum_iteration_count") = 20,
+            arg("relative_tolerance") = 1e-6,
+            R"doc(
+                Construct a new `BatchLeastSquaresSolver` object.
+
+                Args:
+                    propagator (Propagator): The propagator, modeling the dynamics of the object.
+                    maximum_iteration_count (int, optional): The maximum iteration count. Defaults to 20.
+                    relative_tolerance (float, optional): The relative tolerance on the weighted root mean square of
+                        the residuals. Defaults to 1e-6.
+
+                Returns:
+                    BatchLeastSquaresSolver: The new `BatchLeastSquaresSolver` object.
+            )doc"
+        )
+
+        .def("__str__", &(shiftToString<BatchLeastSquaresSolver>))
+        .def("__repr__", &(shiftToString<BatchLeastSquaresSolver>))
+
+        .def(
+            "access_propagator",
+            &BatchLeastSquaresSolver::accessPropagator,
+            return_value_policy::reference_internal,
+            R"doc(
+                Access the propagator.
+
+                Returns:
+                    Propagator: The propagator.
+            )doc"
+        )
+        .def(
+            "get_maximum_iteration_count",
+            &BatchLeastSquaresSolver::getMaximumIterationCount,
+            R"doc(
+                Get the maximum iteration count.
+
+                Returns:
+                    int: The maximum iteration count.
+            )doc"
+        )
+        .def(
+            "get_relative_tolerance",
+            &BatchLeastSquaresSolver::getRelativeTolerance,
+            R"doc(
+                Get the relative tolerance.
+
+                Returns:
+                    Real: The relative tolerance.
+            )doc"
+        )
+        .def(
+            "solve",
+            +[](const BatchLeastSquaresSolver& aSolver,
+                const State& anInitialGuessState,
+                const Array<Measurement>& aMeasurementArray) -> BatchLeastSquaresSolver::Analysis
+            {
+                return aSolver.solve(anInitialGuessState, aMeasurementArray);
+            },
+            call_guard<gil_scoped_release>(),
+            arg("initial_guess_state"),
+            arg("measurements"),
+            R"doc(
+                Estimate the state of an object from measurements.
+
+                Only the position and velocity are estimated. Measurements may be given in any order, and on both
+                sides of the epoch. Measurements are evaluated concurrently, with the default thread count.
+
+                Args:
+                    initial_guess_state (State): The initial guess of the state, at the estimation epoch.
+                    measurements (list[Measurement]): The measurements.
+
+                Returns:
+                    BatchLeastSquaresSolver.Analysis: The analysis.
+            )doc"
+        )
+        .def(
+            "solve",
+            &BatchLeastSquaresSolver::solve,
+            call_guard<gil_scoped_release>(),
+            arg("initial_guess_state"),
+            arg("measurements"),
+            arg("execution_context"),
+            R"doc(
+                Estimate the state of an object from measurements.
+
+                Args:
+                    initial_guess_state (State): The initial guess of the state, at the estimation epoch.
+                    measurements (list[Measurement]): The measurements.
+                    execution_context (ExecutionContext): The execution context, for the evaluation of the
+                        measurements.
+
+                Returns:
+                    BatchLeastSquaresSolver.Analysis: The analysis.
+            )doc"
+        )
+
+        ;
+}
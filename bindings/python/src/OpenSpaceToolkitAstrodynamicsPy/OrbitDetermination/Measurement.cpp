@@ -0,0 +1,304 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/OrbitDetermination/Measurement.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_OrbitDetermination_Measurement(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Shared;
+
+    using ostk::mathematics::object::VectorXd;
+
+    using ostk::physics::time::Instant;
+
+    using ostk::astrodynamics::orbitdetermination::Measurement;
+    using ostk::astrodynamics::Trajectory;
+
+    class_<Measurement> measurement(
+        aModule,
+        "Measurement",
+        R"doc(
+            Tracking measurement of an object from a station.
+
+            Measurements are modeled geometrically in GCRF, from the state of the object and the state of the station
+            at the measurement instant (light time and atmospheric delays are not modeled):
+
+            - Range [m]: distance from the station to the object
+            - RangeRate [m/s]: rate of change of the range
+            - Angles [rad]: topocentric right ascension and declination of the object, as seen from the station
+
+            Stations are trajectories, typically fixed ground positions (see `Trajectory.position`).
+
+        )doc"
+    );
+
+    enum_<Measurement::Type>(
+        measurement,
+        "Type",
+        R"doc(
+            Measurement type.
+        )doc"
+    )
+
+        .value("Undefined", Measurement::Type::Undefined, "Undefined")
+        .value("Range", Measurement::Type::Range, "Range [m]")
+        .value("RangeRate", Measurement::Type::RangeRate, "Range rate [m/s]")
+        .value("Angles", Measurement::Type::Angles, "Topocentric right ascension and declination [rad]")
+
+        ;
+
+    measurement
+
+        .def(
+            init<
+                const Instant&,
+                const Measurement::Type&,
+                const VectorXd&,
+                const VectorXd&,
+                const Shared<const Trajectory>&>(),
+            arg("instant"),
+            arg("type"),
+            arg("value"),
+            arg("standard_deviation"),
+            arg("station_trajectory"),
+            R"doc(
+                Construct a new `Measurement` object.
+
+                Args:
+                    instant (Instant): The instant.
+                    type (Measurement.Type): The measurement type.
+                    value (np.ndarray): The measured value (of size 1, or 2 for angles).
+                    standard_deviation (np.ndarray): The standard deviation of the measurement noise, per component.
+                    station_trajectory (Trajectory): The trajectory of the station.
+
+                Returns:
+                    Measurement: The new `Measurement` object.
+            )doc"
+        )
+
+        .def(self == self)
+        .def(self != self)
+
+        .def("__str__", &(shiftToString<Measurement>))
+        .def("__repr__", &(shiftToString<Measurement>))
+
+        .def(
+            "is_defined",
+            &Measurement::isDefined,
+            R"doc(
+                Check if the measurement is defined.
+
+                Returns:
+                    bool: True if the measurement is defined.
+            )doc"
+        )
+        .def(
+            "get_instant",
+            &Measurement::accessInstant,
+            R"doc(
+                Get the instant.
+
+                Returns:
+                    Instant: The instant.
+            )doc"
+        )
+        .def(
+            "get_type",
+            &Measurement::getType,
+            R"doc(
+                Get the measurement type.
+
+                Returns:
+                    Measurement.Type: The measurement type.
+            )doc"
+        )
+        .def(
+            "get_value",
+            &Measurement::getValue,
+            R"doc(
+                Get the measured value.
+
+                Returns:
+                    np.ndarray: The measured value.
+            )doc"
+        )
+        .def(
+            "get_standard_deviation",
+            &Measurement::getStandardDeviation,
+            R"doc(
+                Get the standard deviation, per component.
+
+                Returns:
+                    np.ndarray: The standard deviation.
+            )doc"
+        )
+        .def(
+            "get_station_trajectory",
+            &Measurement::getStationTrajectory,
+            R"doc(
+                Get the trajectory of the station.
+
+                Returns:
+                    Trajectory: The trajectory of the station.
+            )doc"
+        )
+        .def(
+            "get_size",
+            &Measurement::getSize,
+            R"doc(
+                Get the number of components.
+
+                Returns:
+                    int: The number of components.
+            )doc"
+        )
+        .def(
+            "calculate_value",
+            &Measurement::calculateValue,
+            arg("state"),
+            R"doc(
+                Calculate the modeled value of the measurement, for a state of the object.
+
+                Args:
+                    state (State): The state of the object, at the measurement instant.
+
+                Returns:
+                    np.ndarray: The modeled value.
+            )doc"
+        )
+        .def(
+            "calculate_residual",
+            &Measurement::calculateResidual,
+            arg("state"),
+            R"doc(
+                Calculate the residual (measured minus modeled value), for a state of the object.
+
+                Right ascension residuals are wrapped to [-pi, pi].
+
+                Args:
+                    state (State): The state of the object, at the measurement instant.
+
+                Returns:
+                    np.ndarray: The residual.
+            )doc"
+        )
+        .def(
+            "calculate_partials",
+            &Measurement::calculatePartials,
+            arg("state"),
+            R"doc(
+                Calculate the partial derivatives of the modeled value, with respect to the position and velocity of
+                the object in GCRF.
+
+                Args:
+                    state (State): The state of the object, at the measurement instant.
+
+                Returns:
+                    np.ndarray: The partial derivatives (size x 6).
+            )doc"
+        )
+
+        .def_static(
+            "undefined",
+            &Measurement::Undefined,
+            R"doc(
+                Construct an undefined measurement.
+
+                Returns:
+                    Measurement: An undefined measurement.
+            )doc"
+        )
+        .def_static(
+            "range",
+            &Measurement::Range,
+            arg("instant"),
+            arg("range"),
+            arg("standard_deviation"),
+            arg("station_trajectory"),
+            R"doc(
+                Construct a range measurement.
+
+                Args:
+                    instant (Instant): The instant.
+                    range (Length): The range.
+                    standard_deviation (Length): The standard deviation.
+                    station_trajectory (Trajectory): The trajectory of the station.
+
+                Returns:
+                    Measurement: The range measurement.
+            )doc"
+        )
+        .def_static(
+            "range_rate",
+            &Measurement::RangeRate,
+            arg("instant"),
+            arg("range_rate"),
+            arg("standard_deviation"),
+            arg("station_trajectory"),
+            R"doc(
+                Construct a range rate measurement.
+
+                Args:
+                    instant (Instant): The instant.
+                    range_rate (float): The range rate [m/s].
+                    standard_deviation (float): The standard deviation [m/s].
+                    station_trajectory (Trajectory): The trajectory of the station.
+
+                Returns:
+                    Measurement: The range rate measurement.
+            )doc"
+        )
+        .def_static(
+            "angles",
+            &Measurement::Angles,
+            arg("instant"),
+            arg("right_ascension"),
+            arg("declination"),
+            arg("standard_deviation"),
+            arg("station_trajectory"),
+            R"doc(
+                Construct an angles measurement.
+
+                Args:
+                    instant (Instant): The instant.
+                    right_ascension (Angle): The topocentric right ascension.
+                    declination (Angle): The topocentric declination.
+                    standard_deviation (Angle): The standard deviation, for both angles.
+                    station_trajectory (Trajectory): The trajectory of the station.
+
+                Returns:
+                    Measurement: The angles measurement.
+            )doc"
+        )
+        .def_static(
+            "string_from_type",
+            &Measurement::StringFromType,
+            arg("type"),
+            R"doc(
+                Convert a measurement type to a string.
+
+                Args:
+                    type (Measurement.Type): The measurement type.
+
+                Returns:
+                    str: The string.
+            )doc"
+        )
+        .def_static(
+            "size_from_type",
+            &Measurement::SizeFromType,
+            arg("type"),
+            R"doc(
+                Get the number of components of a measurement type.
+
+                Args:
+                    type (Measurement.Type): The measurement type.
+
+                Returns:
+                    int: The number of components.
+            )doc"
+        )
+
+        ;
+}
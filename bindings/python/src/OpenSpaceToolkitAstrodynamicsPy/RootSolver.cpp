@@ -182,6 +182,64 @@ inline void OpenSpaceToolkitAstrodynamicsPy_RootSolver(pybind11::module& aModule
                 arg("upper_bound")
             )
 
+            .def(
+                "itp",
+                +[](const RootSolver& aRootSolver,
+                    const pythonFunctionSignature& aFunction,
+                    const Real& aLowerBound,
+                    const Real& anUpperBound) -> RootSolver::Solution
+                {
+                    return aRootSolver.itp(aFunction, aLowerBound, anUpperBound);
+                },
+                R"doc(
+                    Solve the root of a function using the ITP (Interpolate, Truncate and Project) method.
+
+                    Bracketing method converging superlinearly on smooth functions, and never taking more iterations
+                    than bisection (plus one).
+
+                    Args:
+                        function (callable): The function to solve.
+                        lower_bound (float): The lower bound of the root.
+                        upper_bound (float): The upper bound of the root.
+
+                    Returns:
+                        RootSolverSolution: The solution to the root.
+
+                )doc",
+                arg("function"),
+                arg("lower_bound"),
+                arg("upper_bound")
+            )
+
+            .def(
+                "newton",
+                +[](const RootSolver& aRootSolver,
+                    const pythonFunctionSignature& aFunction,
+                    const pythonFunctionSignature& aDerivative,
+                    const Real& aLowerBound,
+                    const Real& anUpperBound) -> RootSolver::Solution
+                {
+                    return aRootSolver.newton(aFunction, aDerivative, aLowerBound, anUpperBound);
+                },
+                R"doc(
+                    Solve the root of a function using the Newton method, safeguarded by bisection within the bounds.
+
+                    Args:
+                        function (callable): The function to solve.
+                        derivative (callable): The derivative of the function.
+                        lower_bound (float): The lower bound of the root.
+                        upper_bound (float): The upper bound of the root.
+
+                    Returns:
+                        RootSolverSolution: The solution to the root.
+
+                )doc",
+                arg("function"),
+                arg("derivative"),
+                arg("lower_bound"),
+                arg("upper_bound")
+            )
+
             .def_static(
                 "default",
                 &RootSolver::Default,
@@ -1,6 +1,8 @@
 /// Apache License 2.0
 
+#include <OpenSpaceToolkitAstrodynamicsPy/Solver/EclipseSolver.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Solver/FiniteDifferenceSolver.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Solver/LambertSolver.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Solver/TemporalConditionSolver.cpp>
 
 inline void OpenSpaceToolkitAstrodynamicsPy_Solver(pybind11::module& aModule)
@@ -11,4 +13,6 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Solver(pybind11::module& aModule)
     // Add objects to "solver" submodule
     OpenSpaceToolkitAstrodynamicsPy_Solver_TemporalConditionSolver(solver);
     OpenSpaceToolkitAstrodynamicsPy_Solver_FiniteDifferenceSolver(solver);
+    OpenSpaceToolkitAstrodynamicsPy_Solver_EclipseSolver(solver);
+    OpenSpaceToolkitAstrodynamicsPy_Solver_LambertSolver(solver);
 }
@@ -0,0 +1,260 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Solver/EclipseSolver.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Solver_EclipseSolver(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Shared;
+
+    using ostk::mathematics::object::Vector3d;
+
+    using ostk::physics::environment::object::Celestial;
+    using ostk::physics::time::Duration;
+
+    using ostk::astrodynamics::solver::EclipseSolver;
+
+    class_<EclipseSolver> eclipseSolver(
+        aModule,
+        "EclipseSolver",
+        R"doc(
+            Computes the intervals a trajectory spends in the shadow of an occulting body.
+
+            The shadow is modeled by conic umbra and penumbra cones. The angular margins to the cone boundaries drive
+            the adaptive time steps of the search, and the Sun and occulting body positions are tabulated over the
+            analysis interval.
+
+        )doc"
+    );
+
+    enum_<EclipseSolver::Region>(
+        eclipseSolver,
+        "Region",
+        R"doc(
+            Illumination region.
+        )doc"
+    )
+
+        .value("Sunlight", EclipseSolver::Region::Sunlight, "Fully illuminated")
+        .value("Penumbra", EclipseSolver::Region::Penumbra, "Partially illuminated (including annular eclipses)")
+        .value("Umbra", EclipseSolver::Region::Umbra, "Not illuminated")
+        .value("Shadow", EclipseSolver::Region::Shadow, "Penumbra or umbra")
+
+        ;
+
+    eclipseSolver
+
+        .def(
+            init<
+                const Shared<const Celestial>&,
+                const Shared<const Celestial>&,
+                const Duration&,
+                const Duration&,
+                const Duration&>(),
+            R"doc(
+                Constructor.
+
+                Args:
+                    sun (Celestial): The Sun.
+                    occulting_celestial (Celestial): The occulting celestial body.
+                    time_step (Duration): The minimum time step, used near region boundaries. Defaults to 30 seconds.
+                    tolerance (Duration): The tolerance on region entry and exit instants. Defaults to 1 millisecond.
+                    maximum_time_step (Duration): The maximum time step. Defaults to 10 minutes.
+
+            )doc",
+            arg("sun"),
+            arg("occulting_celestial"),
+            arg("time_step") = Duration::Seconds(30.0),
+            arg("tolerance") = Duration::Milliseconds(1.0),
+            arg("maximum_time_step") = Duration::Minutes(10.0)
+        )
+
+        .def(
+            "is_defined",
+            &EclipseSolver::isDefined,
+            R"doc(
+                Check if the eclipse solver is defined.
+
+                Returns:
+                    bool: True if the eclipse solver is defined, False otherwise.
+
+            )doc"
+        )
+
+        .def(
+            "get_time_step",
+            &EclipseSolver::getTimeStep,
+            R"doc(
+                Get the time step.
+
+                Returns:
+                    Duration: The time step.
+
+            )doc"
+        )
+
+        .def(
+            "get_tolerance",
+            &EclipseSolver::getTolerance,
+            R"doc(
+                Get the tolerance.
+
+                Returns:
+                    Duration: The tolerance.
+
+            )doc"
+        )
+
+        .def(
+            "get_maximum_time_step",
+            &EclipseSolver::getMaximumTimeStep,
+            R"doc(
+                Get the maximum time step.
+
+                Returns:
+                    Duration: The maximum time step.
+
+            )doc"
+        )
+
+        .def(
+            "compute_illumination_fraction",
+            &EclipseSolver::computeIlluminationFraction,
+            R"doc(
+                Compute the illumination fraction of a satellite.
+
+                Args:
+                    instant (Instant): The instant.
+                    position_coordinates (np.ndarray): The satellite position coordinates, in GCRF [m].
+
+                Returns:
+                    float: The illumination fraction (1.0 in sunlight, 0.0 in umbra).
+
+            )doc",
+            arg("instant"),
+            arg("position_coordinates")
+        )
+
+        .def(
+            "compute_intervals",
+            &EclipseSolver::computeIntervals,
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Compute the intervals a trajectory spends in a given region.
+
+                Args:
+                    trajectory (Trajectory): The trajectory.
+                    interval (Interval): The analysis interval.
+                    region (EclipseSolver.Region): The region.
+
+                Returns:
+                    list[Interval]: The intervals, in chronological order.
+
+            )doc",
+            arg("trajectory"),
+            arg("interval"),
+            arg("region")
+        )
+
+        .def(
+            "generate_event_condition",
+            &EclipseSolver::generateEventCondition,
+            R"doc(
+                Generate an event condition on a region, for the propagation of a segment.
+
+                The condition evaluates the shadow function of the region, positive inside the region: a positive
+                crossing criterion triggers on region entry, and a negative crossing criterion on region exit.
+
+                Args:
+                    region (EclipseSolver.Region): The region.
+                    criterion (RealCondition.Criterion): The criterion.
+
+                Returns:
+                    RealCondition: The event condition.
+
+            )doc",
+            arg("region"),
+            arg("criterion")
+        )
+
+        .def_static(
+            "undefined",
+            &EclipseSolver::Undefined,
+            R"doc(
+                Get an undefined eclipse solver.
+
+                Returns:
+                    EclipseSolver: An undefined eclipse solver.
+
+            )doc"
+        )
+
+        .def_static(
+            "string_from_region",
+            &EclipseSolver::StringFromRegion,
+            R"doc(
+                Convert a region to a string.
+
+                Args:
+                    region (EclipseSolver.Region): The region.
+
+                Returns:
+                    str: The string.
+
+            )doc",
+            arg("region")
+        )
+
+        .def_static(
+            "compute_shadow_function",
+            &EclipseSolver::ComputeShadowFunction,
+            R"doc(
+                Compute the shadow function of a region, positive inside the region.
+
+                Args:
+                    region (EclipseSolver.Region): The region.
+                    position_coordinates (np.ndarray): The satellite position coordinates [m].
+                    sun_position_coordinates (np.ndarray): The Sun position coordinates [m].
+                    occulting_position_coordinates (np.ndarray): The occulting body position coordinates [m].
+                    sun_radius (float): The Sun radius [m].
+                    occulting_radius (float): The occulting body radius [m].
+
+                Returns:
+                    float: The angular margin to the region boundary [rad].
+
+            )doc",
+            arg("region"),
+            arg("position_coordinates"),
+            arg("sun_position_coordinates"),
+            arg("occulting_position_coordinates"),
+            arg("sun_radius"),
+            arg("occulting_radius")
+        )
+
+        .def_static(
+            "compute_illumination_fraction_from_geometry",
+            &EclipseSolver::ComputeIlluminationFraction,
+            R"doc(
+                Compute the illumination fraction from the conic shadow geometry.
+
+                Args:
+                    position_coordinates (np.ndarray): The satellite position coordinates [m].
+                    sun_position_coordinates (np.ndarray): The Sun position coordinates [m].
+                    occulting_position_coordinates (np.ndarray): The occulting body position coordinates [m].
+                    sun_radius (float): The Sun radius [m].
+                    occulting_radius (float): The occulting body radius [m].
+
+                Returns:
+                    float: The illumination fraction.
+
+            )doc",
+            arg("position_coordinates"),
+            arg("sun_position_coordinates"),
+            arg("occulting_position_coordinates"),
+            arg("sun_radius"),
+            arg("occulting_radius")
+        )
+
+        ;
+}
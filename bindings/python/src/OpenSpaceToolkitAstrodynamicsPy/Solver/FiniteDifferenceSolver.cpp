@@ -103,7 +103,10 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Solver_FiniteDifferenceSolver(pybind
                 const std::function<MatrixXd(const State&, const Array<Instant>&)>& generateStateCoordinates,
                 const Size& aCoordinatesDimension) -> MatrixXd
             {
-                return solver.computeJacobian(aState, anInstantArray, generateStateCoordinates, aCoordinatesDimension);
+                // Python callables hold the GIL, hence are evaluated serially
+                return solver.computeJacobian(
+                    aState, anInstantArray, generateStateCoordinates, aCoordinatesDimension, 1
+                );
             },
             R"doc(
                 Compute the jacobian.
@@ -130,7 +133,8 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Solver_FiniteDifferenceSolver(pybind
                 const std::function<VectorXd(const State&, const Instant&)>& generateStateCoordinates,
                 const Size& aCoordinatesDimension) -> MatrixXd
             {
-                return solver.computeJacobian(aState, anInstant, generateStateCoordinates, aCoordinatesDimension);
+                // Python callables hold the GIL, hence are evaluated serially
+                return solver.computeJacobian(aState, anInstant, generateStateCoordinates, aCoordinatesDimension, 1);
             },
             R"doc(
                 Compute the jacobian.
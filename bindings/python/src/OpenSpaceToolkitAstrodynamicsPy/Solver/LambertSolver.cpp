@@ -0,0 +1,442 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Solver/LambertSolver.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Solver_LambertSolver(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::container::Array;
+    using ostk::core::type::Real;
+    using ostk::core::type::Size;
+
+    using ostk::physics::time::Duration;
+    using ostk::physics::time::Instant;
+    using ostk::physics::unit::Derived;
+
+    using ostk::astrodynamics::ExecutionContext;
+    using ostk::astrodynamics::Trajectory;
+    using ostk::astrodynamics::solver::LambertSolver;
+
+    class_<LambertSolver> lambertSolver(
+        aModule,
+        "LambertSolver",
+        R"doc(
+            Lambert solver, finding the Keplerian arcs joining two positions in a given time of flight.
+
+            Implements the algorithm of Izzo (2015), for the direct transfer and for both branches of each feasible
+            multi-revolution transfer. Transfer grids (e.g. porkchop plots) are solved concurrently, and only hold
+            velocities, delta-V and orbital elements: orbits are built on request.
+
+        )doc"
+    );
+
+    class_<LambertSolver::Solution>(
+        lambertSolver,
+        "Solution",
+        R"doc(
+            A solution of Lambert's problem.
+
+        )doc"
+    )
+        .def_readonly(
+            "revolution_count",
+            &LambertSolver::Solution::revolutionCount,
+            R"doc(
+                The number of complete revolutions.
+
+                Type:
+                    int
+            )doc"
+        )
+        .def_readonly(
+            "departure_velocity",
+            &LambertSolver::Solution::departureVelocity,
+            R"doc(
+                The velocity at departure [m/s].
+
+                Type:
+                    np.ndarray
+            )doc"
+        )
+        .def_readonly(
+            "arrival_velocity",
+            &LambertSolver::Solution::arrivalVelocity,
+            R"doc(
+                The velocity at arrival [m/s].
+
+                Type:
+                    np.ndarray
+            )doc"
+        )
+
+        ;
+
+    class_<LambertSolver::Transfer>(
+        lambertSolver,
+        "Transfer",
+        R"doc(
+            A transfer between two states, along the Lambert arc of lowest total delta-V.
+
+        )doc"
+    )
+        .def_readonly(
+            "revolution_count",
+            &LambertSolver::Transfer::revolutionCount,
+            R"doc(
+                The number of complete revolutions.
+
+                Type:
+                    int
+            )doc"
+        )
+        .def_readonly(
+            "departure_state",
+            &LambertSolver::Transfer::departureState,
+            R"doc(
+                The state on the transfer arc at departure, in GCRF.
+
+                Type:
+                    State
+            )doc"
+        )
+        .def_readonly(
+            "arrival_state",
+            &LambertSolver::Transfer::arrivalState,
+            R"doc(
+                The state on the transfer arc at arrival, in GCRF.
+
+                Type:
+                    State
+            )doc"
+        )
+        .def_readonly(
+            "departure_delta_v",
+            &LambertSolver::Transfer::departureDeltaV,
+            R"doc(
+                The delta-V at departure [m/s].
+
+                Type:
+                    Real
+            )doc"
+        )
+        .def_readonly(
+            "arrival_delta_v",
+            &LambertSolver::Transfer::arrivalDeltaV,
+            R"doc(
+                The delta-V at arrival [m/s].
+
+                Type:
+                    Real
+            )doc"
+        )
+        .def_readonly(
+            "classical_orbital_elements",
+            &LambertSolver::Transfer::classicalOrbitalElements,
+            R"doc(
+                The classical orbital elements of the transfer arc at departure.
+
+                Type:
+                    COE
+            )doc"
+        )
+        .def(
+            "is_defined",
+            &LambertSolver::Transfer::isDefined,
+            R"doc(
+                Check if the transfer is defined.
+
+                Returns:
+                    bool: True if the transfer is defined.
+            )doc"
+        )
+        .def(
+            "get_total_delta_v",
+            &LambertSolver::Transfer::getTotalDeltaV,
+            R"doc(
+                Get the total delta-V.
+
+                Returns:
+                    Real: The total delta-V [m/s].
+            )doc"
+        )
+
+        ;
+
+    class_<LambertSolver::TransferGrid>(
+        lambertSolver,
+        "TransferGrid",
+        R"doc(
+            Transfers over a grid of departure instants (rows) and times of flight (columns).
+
+        )doc"
+    )
+        .def_readonly(
+            "departure_instants",
+            &LambertSolver::TransferGrid::departureInstants,
+            R"doc(
+                The departure instants, one per row.
+
+                Type:
+                    list[Instant]
+            )doc"
+        )
+        .def_readonly(
+            "times_of_flight",
+            &LambertSolver::TransferGrid::timesOfFlight,
+            R"doc(
+                The times of flight, one per column.
+
+                Type:
+                    list[Duration]
+            )doc"
+        )
+        .def_readonly(
+            "transfers",
+            &LambertSolver::TransferGrid::transfers,
+            R"doc(
+                The transfers, in row-major order.
+
+                Type:
+                    list[LambertSolver.Transfer]
+            )doc"
+        )
+        .def(
+            "access_transfer_at",
+            &LambertSolver::TransferGrid::accessTransferAt,
+            return_value_policy::reference_internal,
+            arg("departure_index"),
+            arg("time_of_flight_index"),
+            R"doc(
+                Access the transfer of a cell.
+
+                Args:
+                    departure_index (int): The departure instant index.
+                    time_of_flight_index (int): The time of flight index.
+
+                Returns:
+                    LambertSolver.Transfer: The transfer.
+            )doc"
+        )
+        .def(
+            "get_departure_delta_vs",
+            &LambertSolver::TransferGrid::getDepartureDeltaVs,
+            R"doc(
+                Get the departure delta-V of each cell (NaN for cells without solution).
+
+                Returns:
+                    np.ndarray: The departure delta-V matrix [m/s].
+            )doc"
+        )
+        .def(
+            "get_arrival_delta_vs",
+            &LambertSolver::TransferGrid::getArrivalDeltaVs,
+            R"doc(
+                Get the arrival delta-V of each cell (NaN for cells without solution).
+
+                Returns:
+                    np.ndarray: The arrival delta-V matrix [m/s].
+            )doc"
+        )
+        .def(
+            "get_total_delta_vs",
+            &LambertSolver::TransferGrid::getTotalDeltaVs,
+            R"doc(
+                Get the total delta-V of each cell (NaN for cells without solution).
+
+                Returns:
+                    np.ndarray: The total delta-V matrix [m/s].
+            )doc"
+        )
+
+        ;
+
+    lambertSolver
+
+        .def(
+            init<const Derived&, const Size&, const bool&, const Size&, const Real&>(),
+            arg("gravitational_parameter"),
+            arg("maximum_revolution_count") = 0,
+            arg("is_prograde") = true,
+            arg("maximum_iteration_count") = 35,
+            arg("tolerance") = 1e-11,
+            R"doc(
+                Construct a new `LambertSolver` object.
+
+                Args:
+                    gravitational_parameter (Derived): The gravitational parameter.
+                    maximum_revolution_count (int, optional): The maximum number of complete revolutions. Defaults to 0.
+                    is_prograde (bool, optional): True for prograde transfers. Defaults to True.
+                    maximum_iteration_count (int, optional): The maximum number of iterations. Defaults to 35.
+                    tolerance (float, optional): The tolerance on the universal variable. Defaults to 1e-11.
+
+                Returns:
+                    LambertSolver: The new `LambertSolver` object.
+            )doc"
+        )
+
+        .def("__str__", &(shiftToString<LambertSolver>))
+        .def("__repr__", &(shiftToString<LambertSolver>))
+
+        .def(
+            "get_gravitational_parameter",
+            &LambertSolver::getGravitationalParameter,
+            R"doc(
+                Get the gravitational parameter.
+
+                Returns:
+                    Derived: The gravitational parameter.
+            )doc"
+        )
+        .def(
+            "get_maximum_revolution_count",
+            &LambertSolver::getMaximumRevolutionCount,
+            R"doc(
+                Get the maximum revolution count.
+
+                Returns:
+                    int: The maximum revolution count.
+            )doc"
+        )
+        .def(
+            "is_prograde",
+            &LambertSolver::isPrograde,
+            R"doc(
+                Check if transfers are prograde.
+
+                Returns:
+                    bool: True if transfers are prograde.
+            )doc"
+        )
+        .def(
+            "get_maximum_iteration_count",
+            &LambertSolver::getMaximumIterationCount,
+            R"doc(
+                Get the maximum iteration count.
+
+                Returns:
+                    int: The maximum iteration count.
+            )doc"
+        )
+        .def(
+            "get_tolerance",
+            &LambertSolver::getTolerance,
+            R"doc(
+                Get the tolerance.
+
+                Returns:
+                    Real: The tolerance.
+            )doc"
+        )
+        .def(
+            "solve",
+            &LambertSolver::solve,
+            arg("departure_position"),
+            arg("arrival_position"),
+            arg("time_of_flight"),
+            R"doc(
+                Solve Lambert's problem.
+
+                Solutions are sorted by revolution count: the direct transfer first, then both branches of each
+                feasible multi-revolution transfer. Collinear positions have no solution.
+
+                Args:
+                    departure_position (np.ndarray): The departure position [m].
+                    arrival_position (np.ndarray): The arrival position [m], in the same inertial frame.
+                    time_of_flight (Duration): The time of flight.
+
+                Returns:
+                    list[LambertSolver.Solution]: The solutions.
+            )doc"
+        )
+        .def(
+            "compute_transfer",
+            &LambertSolver::computeTransfer,
+            arg("departure_state"),
+            arg("arrival_state"),
+            R"doc(
+                Compute the transfer of lowest total delta-V between two states.
+
+                Args:
+                    departure_state (State): The departure state.
+                    arrival_state (State): The arrival state, after the departure state.
+
+                Returns:
+                    LambertSolver.Transfer: The transfer (undefined if Lambert's problem has no solution).
+            )doc"
+        )
+        .def(
+            "compute_transfer_grid",
+            +[](const LambertSolver& aLambertSolver,
+                const Trajectory& aDepartureTrajectory,
+                const Trajectory& anArrivalTrajectory,
+                const Array<Instant>& aDepartureInstantArray,
+                const Array<Duration>& aTimeOfFlightArray) -> LambertSolver::TransferGrid
+            {
+                return aLambertSolver.computeTransferGrid(
+                    aDepartureTrajectory, anArrivalTrajectory, aDepartureInstantArray, aTimeOfFlightArray
+                );
+            },
+            call_guard<gil_scoped_release>(),
+            arg("departure_trajectory"),
+            arg("arrival_trajectory"),
+            arg("departure_instants"),
+            arg("times_of_flight"),
+            R"doc(
+                Compute the transfers between two trajectories over a grid of departure instants and times of flight.
+
+                The states of the trajectories are calculated up front, and cells are then solved concurrently, with
+                the default thread count.
+
+                Args:
+                    departure_trajectory (Trajectory): The departure trajectory.
+                    arrival_trajectory (Trajectory): The arrival trajectory.
+                    departure_instants (list[Instant]): The departure instants.
+                    times_of_flight (list[Duration]): The (positive) times of flight.
+
+                Returns:
+                    LambertSolver.TransferGrid: The transfer grid.
+            )doc"
+        )
+        .def(
+            "compute_transfer_grid",
+            &LambertSolver::computeTransferGrid,
+            call_guard<gil_scoped_release>(),
+            arg("departure_trajectory"),
+            arg("arrival_trajectory"),
+            arg("departure_instants"),
+            arg("times_of_flight"),
+            arg("execution_context"),
+            R"doc(
+                Compute the transfers between two trajectories over a grid of departure instants and times of flight.
+
+                Args:
+                    departure_trajectory (Trajectory): The departure trajectory.
+                    arrival_trajectory (Trajectory): The arrival trajectory.
+                    departure_instants (list[Instant]): The departure instants.
+                    times_of_flight (list[Duration]): The (positive) times of flight.
+                    execution_context (ExecutionContext): The execution context.
+
+                Returns:
+                    LambertSolver.TransferGrid: The transfer grid.
+            )doc"
+        )
+        .def(
+            "compute_orbit",
+            &LambertSolver::computeOrbit,
+            arg("transfer"),
+            arg("celestial_object"),
+            R"doc(
+                Build the orbit of a transfer, with an unperturbed Kepler model.
+
+                Args:
+                    transfer (LambertSolver.Transfer): The transfer.
+                    celestial_object (Celestial): The central celestial object.
+
+                Returns:
+                    Orbit: The orbit.
+            )doc"
+        )
+
+        ;
+}
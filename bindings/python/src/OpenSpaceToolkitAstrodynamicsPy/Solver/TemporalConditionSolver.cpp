@@ -9,12 +9,15 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Solver_TemporalConditionSolver(pybin
     using namespace pybind11;
 
     using ostk::core::container::Array;
+    using ostk::core::type::Shared;
     using ostk::core::type::Size;
 
+    using ostk::physics::environment::object::Celestial;
     using ostk::physics::time::Duration;
     using ostk::physics::time::Interval;
 
     using ostk::astrodynamics::solver::TemporalConditionSolver;
+    using ostk::astrodynamics::Trajectory;
 
     class_<TemporalConditionSolver>(
         aModule,
@@ -74,6 +77,67 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Solver_TemporalConditionSolver(pybin
             )doc"
         )
 
+        .def(
+            "is_statistics_enabled",
+            &TemporalConditionSolver::isStatisticsEnabled,
+            R"doc(
+                Check if statistics are enabled.
+
+                Returns:
+                    bool: True if statistics are enabled, False otherwise.
+            )doc"
+        )
+
+        .def(
+            "get_statistics",
+            [](TemporalConditionSolver& aTemporalConditionSolver,
+               const bool reset) -> TemporalConditionSolver::Statistics
+            {
+                const TemporalConditionSolver::Statistics statistics = aTemporalConditionSolver.getStatistics();
+
+                if (reset)
+                {
+                    aTemporalConditionSolver.resetStatistics();
+                }
+
+                return statistics;
+            },
+            R"doc(
+                Get the statistics accumulated since statistics were enabled (or last reset).
+
+                Args:
+                    reset (bool, optional): If True, reset statistics once read, so that the next read covers the next calls only. Defaults to False.
+
+                Returns:
+                    TemporalConditionSolver.Statistics: The statistics.
+            )doc",
+            arg("reset") = false
+        )
+
+        .def(
+            "enable_statistics",
+            &TemporalConditionSolver::enableStatistics,
+            R"doc(
+                Enable statistics. Copies of this solver share its statistics.
+            )doc"
+        )
+
+        .def(
+            "disable_statistics",
+            &TemporalConditionSolver::disableStatistics,
+            R"doc(
+                Disable statistics.
+            )doc"
+        )
+
+        .def(
+            "reset_statistics",
+            &TemporalConditionSolver::resetStatistics,
+            R"doc(
+                Reset statistics.
+            )doc"
+        )
+
         .def(
             "solve",
             overload_cast<const TemporalConditionSolver::Condition&, const Interval&>(
@@ -112,5 +176,195 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Solver_TemporalConditionSolver(pybin
             arg("interval")
         )
 
+        .def(
+            "solve",
+            overload_cast<
+                const TemporalConditionSolver::Condition&,
+                const Interval&,
+                const TemporalConditionSolver::IntervalCallback&>(&TemporalConditionSolver::solve, const_),
+            R"doc(
+                Solve a temporal condition, streaming intervals to a callback as they are closed.
+
+                Instants are generated on the fly, hence the search runs in constant memory.
+
+                Args:
+                    condition (function): The condition to solve.
+                    interval (Interval): The interval to solve the condition over.
+                    interval_callback (function): The callback, invoked for each interval in chronological order.
+            )doc",
+            arg("condition"),
+            arg("interval"),
+            arg("interval_callback")
+        )
+
+        .def(
+            "solve",
+            overload_cast<
+                const Array<TemporalConditionSolver::Condition>&,
+                const Interval&,
+                const TemporalConditionSolver::IntervalCallback&>(&TemporalConditionSolver::solve, const_),
+            R"doc(
+                Solve an array of temporal conditions, streaming intervals to a callback as they are closed.
+
+                Instants are generated on the fly, hence the search runs in constant memory.
+
+                Args:
+                    conditions (list): The conditions to solve.
+                    interval (Interval): The interval to solve the conditions over.
+                    interval_callback (function): The callback, invoked for each interval in chronological order.
+            )doc",
+            arg("conditions"),
+            arg("interval"),
+            arg("interval_callback")
+        )
+
+        .def(
+            "solve",
+            overload_cast<
+                const Array<TemporalConditionSolver::StateCondition>&,
+                const Array<Trajectory>&,
+                const Array<Shared<const Celestial>>&,
+                const Interval&>(&TemporalConditionSolver::solve, const_),
+            R"doc(
+                Solve an array of state conditions, sharing a snapshot of trajectory states and celestial positions per
+                instant.
+
+                Each trajectory and celestial object is queried at most once per instant, and not at all past the first
+                unmet condition.
+
+                Args:
+                    state_conditions (list): The state conditions to solve, each taking a snapshot.
+                    trajectories (list[Trajectory]): The trajectories, indexed by the snapshot.
+                    celestials (list[Celestial]): The celestial objects, indexed by the snapshot.
+                    interval (Interval): The interval to solve the conditions over.
+
+                Returns:
+                    list: The intervals over which all conditions are met.
+            )doc",
+            arg("state_conditions"),
+            arg("trajectories"),
+            arg("celestials"),
+            arg("interval")
+        )
+
+        .def(
+            "solve_adaptive",
+            &TemporalConditionSolver::solveAdaptive,
+            R"doc(
+                Solve a temporal condition expressed as a continuous margin, using adaptive time steps.
+
+                Steps are sized from the margin and its rate of change: large steps are taken when the margin is far
+                from zero, and steps shrink down to the solver time step near crossings.
+
+                Args:
+                    margin_function (function): The margin function, positive when the condition is met.
+                    interval (Interval): The interval to solve the condition over.
+                    maximum_time_step (Duration): The largest time step allowed.
+
+                Returns:
+                    list: The intervals over which the margin is positive.
+            )doc",
+            arg("margin_function"),
+            arg("interval"),
+            arg("maximum_time_step")
+        )
+
+        ;
+
+    class_<TemporalConditionSolver::Snapshot>(
+        aModule.attr("TemporalConditionSolver"),
+        "Snapshot",
+        R"doc(
+            Trajectory states and celestial positions at a given instant, shared by the state conditions evaluated at
+            that instant.
+
+        )doc"
+    )
+
+        .def(
+            "access_instant",
+            &TemporalConditionSolver::Snapshot::accessInstant,
+            return_value_policy::reference_internal,
+            R"doc(
+                Access the instant.
+
+                Returns:
+                    Instant: The instant.
+            )doc"
+        )
+
+        .def(
+            "access_state",
+            &TemporalConditionSolver::Snapshot::accessState,
+            return_value_policy::reference_internal,
+            R"doc(
+                Access the state of a trajectory.
+
+                Args:
+                    trajectory_index (int): The trajectory index.
+
+                Returns:
+                    State: The state, in the trajectory frame.
+            )doc",
+            arg("trajectory_index")
+        )
+
+        .def(
+            "access_celestial_position_coordinates",
+            &TemporalConditionSolver::Snapshot::accessCelestialPositionCoordinates,
+            R"doc(
+                Access the position coordinates of a celestial object.
+
+                Args:
+                    celestial_index (int): The celestial object index.
+
+                Returns:
+                    np.ndarray: The position coordinates, in GCRF [m].
+            )doc",
+            arg("celestial_index")
+        )
+
+        ;
+
+    class_<TemporalConditionSolver::Statistics>(
+        aModule.attr("TemporalConditionSolver"),
+        "Statistics",
+        R"doc(
+            Solver statistics, accumulated over solver calls while enabled.
+
+        )doc"
+    )
+
+        .def_readonly("condition_evaluation_count", &TemporalConditionSolver::Statistics::conditionEvaluationCount)
+        .def_readonly(
+            "condition_evaluation_duration", &TemporalConditionSolver::Statistics::conditionEvaluationDuration
+        )
+        .def_readonly("root_solver_call_count", &TemporalConditionSolver::Statistics::rootSolverCallCount)
+        .def_readonly("root_solver_iteration_count", &TemporalConditionSolver::Statistics::rootSolverIterationCount)
+        .def_readonly("root_solver_duration", &TemporalConditionSolver::Statistics::rootSolverDuration)
+
+        .def(
+            "to_dict",
+            [](const TemporalConditionSolver::Statistics& aStatistics) -> dict
+            {
+                dict statistics;
+
+                statistics["condition_evaluation_count"] = aStatistics.conditionEvaluationCount;
+                statistics["condition_evaluation_duration"] =
+                    double(aStatistics.conditionEvaluationDuration.inSeconds());
+                statistics["root_solver_call_count"] = aStatistics.rootSolverCallCount;
+                statistics["root_solver_iteration_count"] = aStatistics.rootSolverIterationCount;
+                statistics["root_solver_duration"] = double(aStatistics.rootSolverDuration.inSeconds());
+
+                return statistics;
+            },
+            R"doc(
+                Convert the statistics to a dictionary, e.g. for a metrics exporter.
+
+                Returns:
+                    dict[str, int | float]: The counts, and the durations [s].
+            )doc"
+        )
+
         ;
 }
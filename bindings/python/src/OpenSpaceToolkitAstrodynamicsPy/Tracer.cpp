@@ -0,0 +1,134 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Tracer.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Tracer(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Size;
+
+    using ostk::astrodynamics::Tracer;
+
+    class_<Tracer> tracer(
+        aModule,
+        "Tracer",
+        R"doc(
+            Process-wide tracer, recording scoped spans for timeline views of long runs.
+
+            Tracing is disabled by default. While enabled, spans around sequence and segment solving, numerical
+            integration, root solving, temporal condition solving and access computation are buffered in memory, and
+            can be exported in the Chrome trace event format, read by chrome://tracing and https://ui.perfetto.dev.
+
+        )doc"
+    );
+
+    class_<Tracer::Event>(
+        tracer,
+        "Event",
+        R"doc(
+            A completed span.
+
+        )doc"
+    )
+
+        .def_readonly("name", &Tracer::Event::name)
+        .def_readonly("category", &Tracer::Event::category)
+        .def_readonly("detail", &Tracer::Event::detail)
+        .def_readonly("start_time", &Tracer::Event::startTime)
+        .def_readonly("duration", &Tracer::Event::duration)
+        .def_readonly("thread_index", &Tracer::Event::threadIndex)
+
+        ;
+
+    tracer
+
+        .def_static(
+            "is_enabled",
+            &Tracer::IsEnabled,
+            R"doc(
+                Check if tracing is enabled.
+
+                Returns:
+                    bool: True if tracing is enabled.
+
+            )doc"
+        )
+        .def_static(
+            "enable",
+            &Tracer::Enable,
+            R"doc(
+                Enable tracing.
+
+                Event start times are relative to the first enabling since the last clear.
+
+                Args:
+                    maximum_event_count (int, optional): The maximum number of buffered events. Defaults to 1000000.
+
+            )doc",
+            arg("maximum_event_count") = 1000000
+        )
+        .def_static(
+            "disable",
+            &Tracer::Disable,
+            R"doc(
+                Disable tracing, keeping the buffered events.
+
+            )doc"
+        )
+        .def_static(
+            "clear",
+            &Tracer::Clear,
+            R"doc(
+                Clear the buffered events and the dropped event count.
+
+            )doc"
+        )
+        .def_static(
+            "get_events",
+            &Tracer::GetEvents,
+            R"doc(
+                Get the buffered events, in order of completion.
+
+                Returns:
+                    list[Tracer.Event]: The events.
+
+            )doc"
+        )
+        .def_static(
+            "get_dropped_event_count",
+            &Tracer::GetDroppedEventCount,
+            R"doc(
+                Get the number of spans dropped since the last clear, because the buffer was full.
+
+                Returns:
+                    int: The dropped event count.
+
+            )doc"
+        )
+        .def_static(
+            "to_chrome_trace",
+            &Tracer::ToChromeTrace,
+            R"doc(
+                Export the buffered events in the Chrome trace event format.
+
+                Returns:
+                    str: The Chrome trace (JSON).
+
+            )doc"
+        )
+        .def_static(
+            "dump",
+            &Tracer::Dump,
+            R"doc(
+                Write the buffered events to a file in the Chrome trace event format (JSON).
+
+                Args:
+                    file (File): The output file.
+
+            )doc",
+            arg("file")
+        )
+
+        ;
+}
@@ -1,13 +1,22 @@
 /// Apache License 2.0
 
+#include <cmath>
+#include <cstdint>
+
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory.hpp>
 
+#include <OpenSpaceToolkitAstrodynamicsPy/Utility/DateTime64.hpp>
+
+#include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/CompactEphemeris.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/Ephemeris.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/FleetPropagator.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/LocalOrbitalFrameDirection.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/LocalOrbitalFrameFactory.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/LocalOrbitalFrameTransformProvider.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/Model.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/Orbit.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/Propagator.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/RelativeMotion.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/Segment.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/Sequence.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/State.cpp>
@@ -18,10 +27,14 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory(pybind11::module& aModule
     using namespace pybind11;
 
     using ostk::core::container::Array;
+    using ostk::core::type::Index;
     using ostk::core::type::Shared;
 
+    using ostk::physics::time::Instant;
+
     using ostk::astrodynamics::Trajectory;
     using ostk::astrodynamics::trajectory::State;
+    using ostk::astrodynamics::trajectory::state::StateTable;
 
     class_<Trajectory, Shared<Trajectory>>(
         aModule,
@@ -95,6 +108,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory(pybind11::module& aModule
         .def(
             "get_states_at",
             &Trajectory::getStatesAt,
+            call_guard<gil_scoped_release>(),
             R"doc(
                 Get the states of the trajectory at a given set of instants. It can be more performant than looping `calculate_state_at` for multiple instants.
 
@@ -106,6 +120,104 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory(pybind11::module& aModule
             )doc",
             arg("instants")
         )
+        .def(
+            "get_ephemeris_at",
+            &Trajectory::getEphemerisAt,
+            R"doc(
+                Get the ephemeris of the trajectory at a given set of instants, as arrays of positions and velocities.
+
+                Args:
+                    instants (list[Instant]): The instants.
+
+                Returns:
+                    Ephemeris: The ephemeris of the trajectory at the given instants.
+            )doc",
+            arg("instants")
+        )
+        .def(
+            "get_state_table_at",
+            [](const Trajectory& aTrajectory, const array& anInstantArray) -> StateTable
+            {
+                if (anInstantArray.dtype().kind() != 'M')
+                {
+                    throw type_error("Instants must be a numpy.datetime64 array.");
+                }
+
+                const array_t<std::int64_t> dateTime64Array = anInstantArray.attr("astype")("datetime64[ns]")
+                                                                   .attr("ravel")()
+                                                                   .attr("view")("int64")
+                                                                   .cast<array_t<std::int64_t>>();
+
+                if (dateTime64Array.size() == 0)
+                {
+                    return StateTable::Undefined();
+                }
+
+                const auto dateTime64s = dateTime64Array.unchecked<1>();
+
+                StateTable::OffsetVector offsets(dateTime64Array.size());
+
+                for (Index index = 0; index < Index(offsets.size()); ++index)
+                {
+                    offsets(index) = dateTime64s(index) - dateTime64s(0);
+                }
+
+                const Instant epoch = InstantFromDateTime64(dateTime64s(0));
+
+                gil_scoped_release release;
+
+                return aTrajectory.getStateTableAt(epoch, offsets);
+            },
+            R"doc(
+                Get the states of the trajectory at a NumPy array of instants, as a state table.
+
+                Instants are neither converted to nor returned as Python objects, and the table coordinates are exposed
+                as a single N x M array. The epoch of the table is the first instant, and offsets are taken from the
+                datetime64 values, hence leap seconds within the array are not accounted for.
+
+                Args:
+                    instants (np.ndarray): The instants, as a numpy.datetime64 array (UTC).
+
+                Returns:
+                    StateTable: The states of the trajectory at the given instants.
+            )doc",
+            arg("instants")
+        )
+        .def(
+            "get_state_table_at",
+            [](const Trajectory& aTrajectory,
+               const Instant& anEpoch,
+               const array_t<double, array::c_style | array::forcecast>& anOffsetArray) -> StateTable
+            {
+                const auto offsetSeconds = anOffsetArray.unchecked<1>();
+
+                StateTable::OffsetVector offsets(offsetSeconds.shape(0));
+
+                for (Index index = 0; index < Index(offsets.size()); ++index)
+                {
+                    offsets(index) = std::llround(offsetSeconds(index) * 1e9);
+                }
+
+                gil_scoped_release release;
+
+                return aTrajectory.getStateTableAt(anEpoch, offsets);
+            },
+            R"doc(
+                Get the states of the trajectory at instants given as offsets from an epoch, as a state table.
+
+                Instants are neither converted to nor returned as Python objects, and the table coordinates are exposed
+                as a single N x M array.
+
+                Args:
+                    epoch (Instant): The epoch.
+                    offsets (np.ndarray): The offsets from the epoch [s], rounded to the nanosecond.
+
+                Returns:
+                    StateTable: The states of the trajectory at the given instants.
+            )doc",
+            arg("epoch"),
+            arg("offsets")
+        )
 
         .def_static(
             "undefined",
@@ -144,10 +256,14 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory(pybind11::module& aModule
     OpenSpaceToolkitAstrodynamicsPy_Trajectory_LocalOrbitalFrameDirection(trajectory);
 
     OpenSpaceToolkitAstrodynamicsPy_Trajectory_State(trajectory);
+    OpenSpaceToolkitAstrodynamicsPy_Trajectory_Ephemeris(trajectory);
+    OpenSpaceToolkitAstrodynamicsPy_Trajectory_CompactEphemeris(trajectory);
+    OpenSpaceToolkitAstrodynamicsPy_Trajectory_RelativeMotion(trajectory);
     OpenSpaceToolkitAstrodynamicsPy_Trajectory_StateBuilder(trajectory);
     OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit(trajectory);
     OpenSpaceToolkitAstrodynamicsPy_Trajectory_Model(trajectory);
     OpenSpaceToolkitAstrodynamicsPy_Trajectory_Propagator(trajectory);
+    OpenSpaceToolkitAstrodynamicsPy_Trajectory_FleetPropagator(trajectory);
     OpenSpaceToolkitAstrodynamicsPy_Trajectory_Segment(trajectory);
     OpenSpaceToolkitAstrodynamicsPy_Trajectory_Sequence(trajectory);
 }
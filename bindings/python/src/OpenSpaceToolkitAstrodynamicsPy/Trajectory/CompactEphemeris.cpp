@@ -0,0 +1,247 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/CompactEphemeris.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_CompactEphemeris(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Size;
+
+    using ostk::astrodynamics::trajectory::CompactEphemeris;
+    using ostk::astrodynamics::trajectory::Ephemeris;
+
+    class_<CompactEphemeris>(
+        aModule,
+        "CompactEphemeris",
+        R"doc(
+            Reduced-precision ephemeris, for visualization and coarse screening archives.
+
+            Positions (and optionally velocities) are stored as single precision offsets from double precision anchors,
+            one anchor per block of consecutive rows.
+
+        )doc"
+    )
+
+        .def(
+            init<const Ephemeris&, const Size&, const bool&>(),
+            arg("ephemeris"),
+            arg("block_size") = 32,
+            arg("store_velocities") = true,
+            R"doc(
+                Construct a new `CompactEphemeris` object.
+
+                Args:
+                    ephemeris (Ephemeris): The ephemeris, of sorted instants.
+                    block_size (int, optional): The number of rows per block. Defaults to 32.
+                    store_velocities (bool, optional): True to store velocities. Defaults to True.
+
+                Returns:
+                    CompactEphemeris: The new `CompactEphemeris` object.
+            )doc"
+        )
+
+        .def(self == self)
+        .def(self != self)
+
+        .def(
+            "is_defined",
+            &CompactEphemeris::isDefined,
+            R"doc(
+                Check if the compact ephemeris is defined.
+
+                Returns:
+                    bool: True if the compact ephemeris is defined.
+            )doc"
+        )
+        .def(
+            "has_velocities",
+            &CompactEphemeris::hasVelocities,
+            R"doc(
+                Check if velocities are stored.
+
+                Returns:
+                    bool: True if velocities are stored.
+            )doc"
+        )
+        .def(
+            "get_size",
+            &CompactEphemeris::getSize,
+            R"doc(
+                Get the number of rows.
+
+                Returns:
+                    int: The number of rows.
+            )doc"
+        )
+        .def(
+            "get_block_size",
+            &CompactEphemeris::getBlockSize,
+            R"doc(
+                Get the number of rows per block.
+
+                Returns:
+                    int: The block size.
+            )doc"
+        )
+        .def(
+            "get_storage_size",
+            &CompactEphemeris::getStorageSize,
+            R"doc(
+                Get the size of the stored data.
+
+                Returns:
+                    int: The size of the stored data [bytes].
+            )doc"
+        )
+        .def(
+            "get_frame",
+            &CompactEphemeris::accessFrame,
+            R"doc(
+                Get the reference frame.
+
+                Returns:
+                    Frame: The reference frame.
+            )doc"
+        )
+        .def(
+            "get_interval",
+            &CompactEphemeris::getInterval,
+            R"doc(
+                Get the interval covered by the rows.
+
+                Returns:
+                    Interval: The interval.
+            )doc"
+        )
+        .def(
+            "get_instants",
+            &CompactEphemeris::getInstants,
+            R"doc(
+                Get the instants.
+
+                Returns:
+                    list[Instant]: The instants.
+            )doc"
+        )
+        .def(
+            "get_positions",
+            &CompactEphemeris::getPositions,
+            R"doc(
+                Get the positions.
+
+                Returns:
+                    np.ndarray: The positions [m], one row per instant.
+            )doc"
+        )
+        .def(
+            "get_velocities",
+            &CompactEphemeris::getVelocities,
+            R"doc(
+                Get the velocities.
+
+                Returns:
+                    np.ndarray: The velocities [m/s], one row per instant.
+            )doc"
+        )
+        .def(
+            "get_state_at",
+            &CompactEphemeris::getStateAt,
+            R"doc(
+                Get the state at an index.
+
+                Args:
+                    index (int): The row index.
+
+                Returns:
+                    State: The state, holding a position and, if stored, a velocity.
+            )doc",
+            arg("index")
+        )
+        .def(
+            "get_states",
+            &CompactEphemeris::getStates,
+            R"doc(
+                Get all the states.
+
+                Returns:
+                    list[State]: The states.
+            )doc"
+        )
+        .def(
+            "to_ephemeris",
+            &CompactEphemeris::toEphemeris,
+            R"doc(
+                Expand to a full precision ephemeris.
+
+                Returns:
+                    Ephemeris: The ephemeris.
+            )doc"
+        )
+        .def(
+            "calculate_positions_at",
+            &CompactEphemeris::calculatePositionsAt,
+            R"doc(
+                Calculate positions at given instants, by linear interpolation.
+
+                Args:
+                    instants (list[Instant]): The instants.
+
+                Returns:
+                    np.ndarray: The positions [m], one row per instant.
+            )doc",
+            arg("instants")
+        )
+        .def(
+            "calculate_states_at",
+            &CompactEphemeris::calculateStatesAt,
+            R"doc(
+                Calculate states at given instants, by linear interpolation.
+
+                Args:
+                    instants (list[Instant]): The instants.
+
+                Returns:
+                    list[State]: The states.
+            )doc",
+            arg("instants")
+        )
+        .def(
+            "save",
+            &CompactEphemeris::save,
+            R"doc(
+                Save to a file.
+
+                Args:
+                    file (File): The file.
+            )doc",
+            arg("file")
+        )
+
+        .def_static(
+            "undefined",
+            &CompactEphemeris::Undefined,
+            R"doc(
+                Create an undefined `CompactEphemeris` object.
+
+                Returns:
+                    CompactEphemeris: The undefined `CompactEphemeris` object.
+            )doc"
+        )
+        .def_static(
+            "load",
+            &CompactEphemeris::Load,
+            R"doc(
+                Load from a file, as written by `save`.
+
+                Args:
+                    file (File): The file.
+
+                Returns:
+                    CompactEphemeris: The `CompactEphemeris` object.
+            )doc",
+            arg("file")
+        )
+
+        ;
+}
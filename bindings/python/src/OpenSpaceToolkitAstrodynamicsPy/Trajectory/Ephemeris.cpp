@@ -0,0 +1,164 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Ephemeris.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Ephemeris(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::container::Array;
+    using ostk::core::type::Shared;
+
+    using ostk::mathematics::object::MatrixXd;
+
+    using ostk::physics::coordinate::Frame;
+    using ostk::physics::time::Instant;
+
+    using ostk::astrodynamics::trajectory::Ephemeris;
+
+    class_<Ephemeris>(
+        aModule,
+        "Ephemeris",
+        R"doc(
+            Positions and velocities of a trajectory at a sequence of instants, expressed in a single frame.
+
+            Positions and velocities are stored as N x 3 arrays, one row per instant.
+
+        )doc"
+    )
+
+        .def(
+            init<const Array<Instant>&, const MatrixXd&, const MatrixXd&, const Shared<const Frame>&>(),
+            arg("instants"),
+            arg("positions"),
+            arg("velocities"),
+            arg("frame"),
+            R"doc(
+                Construct a new `Ephemeris` object.
+
+                Args:
+                    instants (list[Instant]): The instants.
+                    positions (np.ndarray): The positions [m], one row per instant.
+                    velocities (np.ndarray): The velocities [m/s], one row per instant.
+                    frame (Frame): The reference frame.
+
+                Returns:
+                    Ephemeris: The new `Ephemeris` object.
+            )doc"
+        )
+
+        .def(self == self)
+        .def(self != self)
+
+        .def(
+            "is_defined",
+            &Ephemeris::isDefined,
+            R"doc(
+                Check if the ephemeris is defined.
+
+                Returns:
+                    bool: True if the ephemeris is defined.
+            )doc"
+        )
+        .def(
+            "get_size",
+            &Ephemeris::getSize,
+            R"doc(
+                Get the number of instants.
+
+                Returns:
+                    int: The number of instants.
+            )doc"
+        )
+        .def(
+            "get_instants",
+            &Ephemeris::accessInstants,
+            R"doc(
+                Get the instants.
+
+                Returns:
+                    list[Instant]: The instants.
+            )doc"
+        )
+        .def(
+            "get_frame",
+            &Ephemeris::accessFrame,
+            R"doc(
+                Get the reference frame.
+
+                Returns:
+                    Frame: The reference frame.
+            )doc"
+        )
+        .def(
+            "get_positions",
+            &Ephemeris::accessPositions,
+            R"doc(
+                Get the positions.
+
+                Returns:
+                    np.ndarray: The positions [m], one row per instant.
+            )doc"
+        )
+        .def(
+            "get_velocities",
+            &Ephemeris::accessVelocities,
+            R"doc(
+                Get the velocities.
+
+                Returns:
+                    np.ndarray: The velocities [m/s], one row per instant.
+            )doc"
+        )
+        .def(
+            "get_state_at",
+            &Ephemeris::getStateAt,
+            R"doc(
+                Get the state at an index.
+
+                Args:
+                    index (int): The instant index.
+
+                Returns:
+                    State: The state.
+            )doc",
+            arg("index")
+        )
+        .def(
+            "get_states",
+            &Ephemeris::getStates,
+            R"doc(
+                Get all the states.
+
+                Returns:
+                    list[State]: The states.
+            )doc"
+        )
+
+        .def_static(
+            "undefined",
+            &Ephemeris::Undefined,
+            R"doc(
+                Create an undefined `Ephemeris` object.
+
+                Returns:
+                    Ephemeris: The undefined `Ephemeris` object.
+            )doc"
+        )
+        .def_static(
+            "from_states",
+            &Ephemeris::FromStates,
+            R"doc(
+                Create an `Ephemeris` object from states, expressed in the frame of the first state.
+
+                Args:
+                    states (list[State]): The states.
+
+                Returns:
+                    Ephemeris: The `Ephemeris` object.
+            )doc",
+            arg("states")
+        )
+
+        ;
+}
@@ -0,0 +1,150 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/FleetPropagator.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_FleetPropagator(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Shared;
+    using ostk::core::type::Size;
+
+    using ostk::physics::time::Duration;
+
+    using ostk::astrodynamics::dynamics::AtmosphericDrag;
+    using ostk::astrodynamics::trajectory::FleetPropagator;
+    using ostk::astrodynamics::trajectory::Propagator;
+
+    class_<FleetPropagator>(
+        aModule,
+        "FleetPropagator",
+        R"doc(
+            Propagate a fleet of satellites to common output instants, sharing the environment terms between them.
+
+            Third body gravity and solar radiation pressure dynamics without an ephemeris table get one Chebyshev table per celestial object, sampled once over the propagation interval for the whole fleet. Atmospheric drag dynamics without a density table get the (optional) fleet density table.
+
+            Satellites are then propagated in parallel, with their own adaptive steps.
+
+        )doc"
+    )
+
+        .def(
+            init<const Propagator&, const Shared<const AtmosphericDrag::DensityTable>&, const Duration&, const Size&>(),
+            R"doc(
+                Constructor.
+
+                Args:
+                    propagator (Propagator): The propagator, shared by all the satellites.
+                    density_table (AtmosphericDrag.DensityTable, optional): The atmospheric density table, shared by all the satellites. Defaults to None.
+                    ephemeris_segment_duration (Duration, optional): The polynomial segment duration of the ephemeris tables. Defaults to 1 day.
+                    thread_count (int, optional): The worker thread count (0 defaults to the default thread count). Defaults to 0.
+
+            )doc",
+            arg("propagator"),
+            arg("density_table") = none(),
+            arg_v("ephemeris_segment_duration", Duration::Days(1.0), "Duration.days(1.0)"),
+            arg("thread_count") = 0
+        )
+
+        .def("__str__", &(shiftToString<FleetPropagator>))
+        .def("__repr__", &(shiftToString<FleetPropagator>))
+
+        .def(
+            "is_defined",
+            &FleetPropagator::isDefined,
+            R"doc(
+                Check if the fleet propagator is defined.
+
+                Returns:
+                    bool: True if the fleet propagator is defined.
+            )doc"
+        )
+
+        .def(
+            "get_propagator",
+            &FleetPropagator::accessPropagator,
+            return_value_policy::reference_internal,
+            R"doc(
+                Get the propagator, shared by all the satellites.
+
+                Returns:
+                    Propagator: The propagator.
+            )doc"
+        )
+        .def(
+            "get_density_table",
+            &FleetPropagator::getDensityTable,
+            R"doc(
+                Get the atmospheric density table.
+
+                Returns:
+                    AtmosphericDrag.DensityTable: The density table (None if there is none).
+            )doc"
+        )
+        .def(
+            "get_ephemeris_segment_duration",
+            &FleetPropagator::getEphemerisSegmentDuration,
+            R"doc(
+                Get the polynomial segment duration of the ephemeris tables.
+
+                Returns:
+                    Duration: The ephemeris segment duration.
+            )doc"
+        )
+        .def(
+            "get_thread_count",
+            &FleetPropagator::getThreadCount,
+            R"doc(
+                Get the worker thread count.
+
+                Returns:
+                    int: The worker thread count (0 defaults to the default thread count).
+            )doc"
+        )
+
+        .def(
+            "get_shared_environment_propagator",
+            &FleetPropagator::getSharedEnvironmentPropagator,
+            arg("interval"),
+            R"doc(
+                Get the propagator with the environment terms shared over an interval.
+
+                Args:
+                    interval (Interval): The propagation interval.
+
+                Returns:
+                    Propagator: A copy of the propagator, whose dynamics share the ephemeris and density tables.
+            )doc"
+        )
+
+        .def(
+            "calculate_states_at",
+            &FleetPropagator::calculateStatesAt,
+            call_guard<gil_scoped_release>(),
+            arg("states"),
+            arg("instants"),
+            R"doc(
+                Calculate the states of a fleet at common instants.
+
+                Args:
+                    states (list[State]): The initial states, one per satellite.
+                    instants (list[Instant]): The output instants, sorted.
+
+                Returns:
+                    list[list[State]]: The states at the instants, one list per satellite, in the order of the initial states.
+            )doc"
+        )
+
+        .def_static(
+            "undefined",
+            &FleetPropagator::Undefined,
+            R"doc(
+                Get an undefined fleet propagator.
+
+                Returns:
+                    FleetPropagator: An undefined fleet propagator.
+            )doc"
+        )
+
+        ;
+}
@@ -65,6 +65,42 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_LocalOrbitalFrameFactory(
             )doc"
         )
 
+        .def(
+            "generate_transform",
+            &LocalOrbitalFrameFactory::generateTransform,
+            arg("instant"),
+            arg("position_vector"),
+            arg("velocity_vector"),
+            R"doc(
+                Generate the transform from the parent frame to the local orbital frame, without registering a frame.
+
+                Args:
+                    instant (Instant): The instant.
+                    position_vector (numpy.ndarray): The position vector, expressed in the parent frame.
+                    velocity_vector (numpy.ndarray): The velocity vector, expressed in the parent frame.
+
+                Returns:
+                    Transform: The transform from the parent frame to the local orbital frame.
+
+            )doc"
+        )
+
+        .def(
+            "generate_rotation_matrices",
+            &LocalOrbitalFrameFactory::generateRotationMatrices,
+            arg("states"),
+            R"doc(
+                Generate the rotation matrices from the parent frame to the local orbital frame, for a set of states.
+
+                Args:
+                    states (list[State]): The states.
+
+                Returns:
+                    list[numpy.ndarray]: The rotation matrices, one per state.
+
+            )doc"
+        )
+
         .def_static(
             "undefined",
             &LocalOrbitalFrameFactory::Undefined,
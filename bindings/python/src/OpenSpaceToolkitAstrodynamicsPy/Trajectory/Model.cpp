@@ -2,6 +2,10 @@
 
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Model.hpp>
 
+#include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/Model/Cached.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/Model/Chebyshev.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/Model/Piecewise.cpp>
+
 inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Model(pybind11::module &aModule)
 {
     using namespace pybind11;
@@ -77,4 +81,11 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Model(pybind11::module &a
         )
 
         ;
+
+    // Create "model" python submodule
+    auto model = aModule.def_submodule("model");
+
+    OpenSpaceToolkitAstrodynamicsPy_Trajectory_Model_Piecewise(model);
+    OpenSpaceToolkitAstrodynamicsPy_Trajectory_Model_Chebyshev(model);
+    OpenSpaceToolkitAstrodynamicsPy_Trajectory_Model_Cached(model);
 }
@@ -0,0 +1,116 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Model/Cached.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Model_Cached(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Size;
+
+    using ostk::astrodynamics::Trajectory;
+    using ostk::astrodynamics::trajectory::Model;
+    using ostk::astrodynamics::trajectory::model::Cached;
+
+    class_<Cached, Model>(
+        aModule,
+        "Cached",
+        R"doc(
+            Cached trajectory model.
+
+            Wraps a trajectory (e.g., SGP4, Kepler, propagated or tabulated), and remembers the states it calculates,
+            keyed on their instant, so that consumers asking for the same instants only pay for each state once. The
+            cache is bounded: once full, the least recently used states are evicted.
+
+            The cache is thread-safe, and shared by the copies of the model, e.g. those held by copies of a trajectory.
+
+        )doc"
+    )
+
+        .def(
+            init<const Trajectory&, const Size&>(),
+            R"doc(
+                Constructor.
+
+                Args:
+                    trajectory (Trajectory): The trajectory to cache the states of.
+                    capacity (int, optional): The capacity, in states. Defaults to 4096.
+
+            )doc",
+            arg("trajectory"),
+            arg("capacity") = Cached::DefaultCapacity
+        )
+
+        .def(self == self)
+        .def(self != self)
+
+        .def("__str__", &(shiftToString<Cached>))
+        .def("__repr__", &(shiftToString<Cached>))
+
+        .def(
+            "get_trajectory",
+            &Cached::accessTrajectory,
+            R"doc(
+                Get the wrapped trajectory.
+
+                Returns:
+                    Trajectory: The trajectory.
+
+            )doc"
+        )
+        .def(
+            "get_capacity",
+            &Cached::getCapacity,
+            R"doc(
+                Get the capacity of the cache.
+
+                Returns:
+                    int: The capacity, in states.
+
+            )doc"
+        )
+        .def(
+            "get_size",
+            &Cached::getSize,
+            R"doc(
+                Get the number of cached states.
+
+                Returns:
+                    int: The number of cached states.
+
+            )doc"
+        )
+        .def(
+            "get_hit_count",
+            &Cached::getHitCount,
+            R"doc(
+                Get the number of states found in the cache since it was created (or last cleared).
+
+                Returns:
+                    int: The hit count.
+
+            )doc"
+        )
+        .def(
+            "get_miss_count",
+            &Cached::getMissCount,
+            R"doc(
+                Get the number of states calculated by the wrapped trajectory since the cache was created (or last
+                cleared).
+
+                Returns:
+                    int: The miss count.
+
+            )doc"
+        )
+        .def(
+            "clear",
+            &Cached::clear,
+            R"doc(
+                Clear the cache, and reset its hit and miss counts.
+
+            )doc"
+        )
+
+        ;
+}
@@ -0,0 +1,238 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Model/Chebyshev.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Model_Chebyshev(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::container::Array;
+    using ostk::core::type::Shared;
+
+    using ostk::mathematics::object::MatrixXd;
+
+    using ostk::physics::coordinate::Frame;
+    using ostk::physics::time::Duration;
+    using ostk::physics::time::Instant;
+
+    using ostk::astrodynamics::trajectory::Model;
+    using ostk::astrodynamics::trajectory::model::Chebyshev;
+
+    class_<Chebyshev, Model> chebyshevClass(
+        aModule,
+        "Chebyshev",
+        R"doc(
+            Chebyshev trajectory model.
+
+            Positions and velocities stored as Chebyshev series over contiguous segments of variable duration, a
+            compact representation of an ephemeris.
+
+        )doc"
+    );
+
+    class_<Chebyshev::Segment>(
+        chebyshevClass,
+        "Segment",
+        R"doc(
+            Segment, over which positions and velocities are Chebyshev series of the time normalized to [-1, 1].
+
+        )doc"
+    )
+
+        .def(
+            init(
+                [](const Instant& aStartInstant,
+                   const Duration& aDuration,
+                   const MatrixXd& aPositionCoefficientMatrix,
+                   const MatrixXd& aVelocityCoefficientMatrix)
+                {
+                    return Chebyshev::Segment {
+                        aStartInstant, aDuration, aPositionCoefficientMatrix, aVelocityCoefficientMatrix
+                    };
+                }
+            ),
+            R"doc(
+                Constructor.
+
+                Args:
+                    start_instant (Instant): The start instant.
+                    duration (Duration): The strictly positive duration.
+                    position_coefficients (np.ndarray): The position coefficients [m], of 3 rows and one column per
+                        degree.
+                    velocity_coefficients (np.ndarray): The velocity coefficients [m/s], of 3 rows and one column per
+                        degree.
+
+            )doc",
+            arg("start_instant"),
+            arg("duration"),
+            arg("position_coefficients"),
+            arg("velocity_coefficients")
+        )
+
+        .def_readonly(
+            "start_instant",
+            &Chebyshev::Segment::startInstant,
+            R"doc(
+                The start instant.
+            )doc"
+        )
+        .def_readonly(
+            "duration",
+            &Chebyshev::Segment::duration,
+            R"doc(
+                The duration.
+            )doc"
+        )
+        .def_readonly(
+            "position_coefficients",
+            &Chebyshev::Segment::positionCoefficients,
+            R"doc(
+                The position coefficients [m].
+            )doc"
+        )
+        .def_readonly(
+            "velocity_coefficients",
+            &Chebyshev::Segment::velocityCoefficients,
+            R"doc(
+                The velocity coefficients [m/s].
+            )doc"
+        )
+
+        ;
+
+    chebyshevClass
+
+        .def(
+            init<const Array<Chebyshev::Segment>&, const Shared<const Frame>&>(),
+            R"doc(
+                Constructor.
+
+                Args:
+                    segments (list[Chebyshev.Segment]): The contiguous segments, of coefficients of the same degree.
+                    frame (Frame): The frame.
+
+            )doc",
+            arg("segments"),
+            arg("frame")
+        )
+
+        .def(self == self)
+        .def(self != self)
+
+        .def("__str__", &(shiftToString<Chebyshev>))
+        .def("__repr__", &(shiftToString<Chebyshev>))
+
+        .def(
+            "get_interval",
+            &Chebyshev::getInterval,
+            R"doc(
+                Get the interval covered by the segments.
+
+                Returns:
+                    Interval: The interval.
+
+            )doc"
+        )
+        .def(
+            "get_frame",
+            &Chebyshev::getFrame,
+            R"doc(
+                Get the frame.
+
+                Returns:
+                    Frame: The frame.
+
+            )doc"
+        )
+        .def(
+            "get_degree",
+            &Chebyshev::getDegree,
+            R"doc(
+                Get the degree of the series.
+
+                Returns:
+                    int: The degree.
+
+            )doc"
+        )
+        .def(
+            "get_segment_count",
+            &Chebyshev::getSegmentCount,
+            R"doc(
+                Get the number of segments.
+
+                Returns:
+                    int: The number of segments.
+
+            )doc"
+        )
+        .def(
+            "get_segments",
+            &Chebyshev::accessSegments,
+            R"doc(
+                Get the segments.
+
+                Returns:
+                    list[Chebyshev.Segment]: The segments.
+
+            )doc"
+        )
+        .def(
+            "calculate_ephemeris_at",
+            &Chebyshev::calculateEphemerisAt,
+            R"doc(
+                Calculate the ephemeris at given instants.
+
+                Args:
+                    instants (list[Instant]): The instants.
+
+                Returns:
+                    Ephemeris: The ephemeris, in the frame of the model.
+
+            )doc",
+            arg("instants")
+        )
+
+        .def_static(
+            "undefined",
+            &Chebyshev::Undefined,
+            R"doc(
+                Get an undefined Chebyshev model.
+
+                Returns:
+                    Chebyshev: The undefined Chebyshev model.
+
+            )doc"
+        )
+        .def_static(
+            "fit",
+            &Chebyshev::Fit,
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Fit a Chebyshev model to the output of a propagator.
+
+                Segments exceeding the position tolerance are halved, and the next segment grows when the fit is well
+                within the tolerance, up to the maximum segment duration.
+
+                Args:
+                    propagator (Propagator): The propagator.
+                    state (State): The initial state, the model is in its frame.
+                    interval (Interval): The interval, of strictly positive duration.
+                    position_tolerance (Length): The strictly positive position tolerance.
+                    degree (int, optional): The degree of the series, in [2, 30]. Defaults to 12.
+                    maximum_segment_duration (Duration, optional): The maximum segment duration. Defaults to 1 hour.
+
+                Returns:
+                    Chebyshev: The Chebyshev model.
+
+            )doc",
+            arg("propagator"),
+            arg("state"),
+            arg("interval"),
+            arg("position_tolerance"),
+            arg("degree") = 12,
+            arg("maximum_segment_duration") = Duration::Hours(1.0)
+        )
+
+        ;
+}
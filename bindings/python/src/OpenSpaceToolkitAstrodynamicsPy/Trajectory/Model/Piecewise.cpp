@@ -0,0 +1,118 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Model/Piecewise.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Model_Piecewise(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::container::Array;
+
+    using ostk::physics::time::Instant;
+
+    using ostk::astrodynamics::Trajectory;
+    using ostk::astrodynamics::trajectory::Model;
+    using ostk::astrodynamics::trajectory::model::Piecewise;
+
+    class_<Piecewise, Model>(
+        aModule,
+        "Piecewise",
+        R"doc(
+            Piecewise trajectory model.
+
+            Trajectory composed of pieces (e.g., SGP4 or tabulated trajectories), switched at given instants: piece i
+            is used from switch instant i - 1 (included) to switch instant i (excluded), the first and last pieces
+            extending indefinitely.
+
+        )doc"
+    )
+
+        .def(
+            init<const Array<Trajectory>&, const Array<Instant>&>(),
+            R"doc(
+                Constructor.
+
+                Args:
+                    trajectories (list[Trajectory]): The pieces.
+                    switch_instants (list[Instant]): The strictly increasing switch instants, one less than pieces.
+
+            )doc",
+            arg("trajectories"),
+            arg("switch_instants")
+        )
+
+        .def(self == self)
+        .def(self != self)
+
+        .def("__str__", &(shiftToString<Piecewise>))
+        .def("__repr__", &(shiftToString<Piecewise>))
+
+        .def(
+            "get_piece_count",
+            &Piecewise::getPieceCount,
+            R"doc(
+                Get the number of pieces.
+
+                Returns:
+                    int: The number of pieces.
+
+            )doc"
+        )
+        .def(
+            "get_trajectories",
+            &Piecewise::accessTrajectories,
+            R"doc(
+                Get the pieces.
+
+                Returns:
+                    list[Trajectory]: The trajectories.
+
+            )doc"
+        )
+        .def(
+            "get_switch_instants",
+            &Piecewise::accessSwitchInstants,
+            R"doc(
+                Get the switch instants.
+
+                Returns:
+                    list[Instant]: The switch instants.
+
+            )doc"
+        )
+        .def(
+            "get_piece_index_at",
+            &Piecewise::getPieceIndexAt,
+            R"doc(
+                Get the index of the piece used at a given instant.
+
+                Args:
+                    instant (Instant): The instant.
+
+                Returns:
+                    int: The piece index.
+
+            )doc",
+            arg("instant")
+        )
+
+        .def_static(
+            "tles",
+            &Piecewise::TLEs,
+            R"doc(
+                Construct a piecewise SGP4 model from a sequence of TLEs.
+
+                TLEs are sorted by epoch, and each TLE is used up to halfway to the epochs of its neighbors.
+
+                Args:
+                    tles (list[TLE]): The TLEs, with distinct epochs.
+
+                Returns:
+                    Piecewise: The piecewise model.
+
+            )doc",
+            arg("tles")
+        )
+
+        ;
+}
@@ -20,8 +20,12 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit(pybind11::module& a
 
     using ostk::physics::environment::object::Celestial;
     using ostk::physics::time::Duration;
+    using ostk::physics::time::Instant;
+    using ostk::physics::time::Time;
     using ostk::physics::unit::Angle;
+    using ostk::physics::unit::Length;
 
+    using ostk::astrodynamics::ExecutionContext;
     using ostk::astrodynamics::trajectory::Orbit;
     using ostk::astrodynamics::trajectory::orbit::model::Kepler;
     using ostk::astrodynamics::trajectory::orbit::model::Propagated;
@@ -200,6 +204,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit(pybind11::module& a
             .def(
                 "get_pass_at",
                 &Orbit::getPassAt,
+                call_guard<gil_scoped_release>(),
                 R"doc(
                     Get the pass at a given instant.
 
@@ -215,6 +220,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit(pybind11::module& a
             .def(
                 "get_pass_with_revolution_number",
                 &Orbit::getPassWithRevolutionNumber,
+                call_guard<gil_scoped_release>(),
                 R"doc(
                     Get the pass with a given revolution number.
 
@@ -229,12 +235,99 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit(pybind11::module& a
                 arg("revolution_number"),
                 arg_v("step_duration", Duration::Minutes(10.0), "Duration.minutes(10.0)")
             )
+            .def(
+                "get_sampled_pass_with_revolution_number",
+                &Orbit::getSampledPassWithRevolutionNumber,
+                call_guard<gil_scoped_release>(),
+                R"doc(
+                    Get the pass with a given revolution number, sampling the orbit model in bulk.
+
+                    The model is sampled on a regular grid, one window of steps at a time, and the crossings are located by interpolating the sampled states.
+
+                    Args:
+                        revolution_number (int): The revolution number.
+                        step_duration (Duration): The sampling step duration.
+                        window_step_count (int): The number of steps per sampling window, which must span more than one revolution.
+
+                    Returns:
+                        Pass: The pass.
+
+                )doc",
+                arg("revolution_number"),
+                arg_v("step_duration", Duration::Minutes(1.0), "Duration.minutes(1.0)"),
+                arg("window_step_count") = 1000
+            )
+            .def(
+                "save_pass_snapshot",
+                &Orbit::savePassSnapshot,
+                R"doc(
+                    Save the cached passes to a binary snapshot file, made of a versioned header followed by fixed size records.
+
+                    Args:
+                        file (File): The file.
+
+                )doc",
+                arg("file")
+            )
+            .def(
+                "load_pass_snapshot",
+                &Orbit::loadPassSnapshot,
+                R"doc(
+                    Load passes from a binary snapshot file into the pass cache.
+
+                    The snapshot must have been saved from an orbit with the same model epoch. Passes already cached are kept.
+
+                    Args:
+                        file (File): The file.
+
+                )doc",
+                arg("file")
+            )
+            .def(
+                "get_ground_track",
+                &Orbit::getGroundTrack,
+                call_guard<gil_scoped_release>(),
+                R"doc(
+                    Get the ground track of the orbit at a given array of instants.
+
+                    The states are generated in bulk, transformed to the frame of the central body with one transform per instant, and converted to geodetic coordinates all at once.
+
+                    Args:
+                        instants (list[Instant]): The instants.
+
+                    Returns:
+                        numpy.ndarray: A N x 3 array, whose columns hold the geodetic latitudes [rad], longitudes [rad] and altitudes [m].
+
+                )doc",
+                arg("instants")
+            )
+            .def(
+                "get_coes_at",
+                &Orbit::getCOEsAt,
+                call_guard<gil_scoped_release>(),
+                R"doc(
+                    Get the osculating classical orbital elements of the orbit at a given array of instants.
+
+                    Keplerian models propagate their elements directly. Other models generate the states in bulk, which are converted to elements all at once, with the gravitational parameter of the central body.
+
+                    Args:
+                        instants (list[Instant]): The instants.
+
+                    Returns:
+                        list[COE]: The COEs, in GCRF.
+
+                )doc",
+                arg("instants")
+            )
             .def(
                 "get_orbital_frame",
                 &Orbit::getOrbitalFrame,
                 R"doc(
                     Get the orbital frame.
 
+                    Orbital frames are generated once per orbit (and shared by its copies), and are not registered in
+                    the global frame manager, hence cannot be accessed by name.
+
                     Args:
                         frame_type (Orbit::FrameType): The frame type.
 
@@ -340,7 +433,9 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit(pybind11::module& a
 
             .def_static(
                 "sun_synchronous",
-                &Orbit::SunSynchronous,
+                overload_cast<const Instant&, const Length&, const Time&, const Shared<const Celestial>&, const Angle&>(
+                    &Orbit::SunSynchronous
+                ),
                 arg("epoch"),
                 arg("altitude"),
                 arg("local_time_at_descending_node"),
@@ -361,9 +456,70 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit(pybind11::module& a
                 )doc"
             )
 
+            .def_static(
+                "sun_synchronous",
+                overload_cast<
+                    const Instant&,
+                    const Array<Length>&,
+                    const Array<Time>&,
+                    const Shared<const Celestial>&,
+                    const Angle&>(&Orbit::SunSynchronous),
+                arg("epoch"),
+                arg("altitudes"),
+                arg("local_times_at_descending_node"),
+                arg("celestial_object"),
+                arg_v("argument_of_latitude", Angle::Zero(), "Angle.zero()"),
+                R"doc(
+                    Create sun-synchronous `Orbit` objects, for design sweeps.
+
+                    The Sun position is computed once for the epoch.
+
+                    Args:
+                        epoch (Instant): The epoch.
+                        altitudes (list[Length]): The altitudes.
+                        local_times_at_descending_node (list[Time]): The local times at descending node.
+                        celestial_object (Celestial): The celestial object.
+                        argument_of_latitude (Angle): The argument of latitude.
+
+                    Returns:
+                        list[Orbit]: The sun-synchronous `Orbit` objects.
+                )doc"
+            )
+
+            .def_static(
+                "repeat_ground_track",
+                &Orbit::RepeatGroundTrack,
+                arg("epoch"),
+                arg("revolution_count"),
+                arg("day_count"),
+                arg("inclination"),
+                arg("celestial_object"),
+                arg_v("raan", Angle::Zero(), "Angle.zero()"),
+                arg_v("argument_of_latitude", Angle::Zero(), "Angle.zero()"),
+                R"doc(
+                    Create a circular repeat ground track `Orbit` object.
+
+                    The semi-major axis is solved for, so that the ground track repeats after a number of revolutions
+                    in a number of days, under the J2 secular rates.
+
+                    Args:
+                        epoch (Instant): The epoch.
+                        revolution_count (int): The number of revolutions per cycle.
+                        day_count (int): The number of days per cycle.
+                        inclination (Angle): The inclination.
+                        celestial_object (Celestial): The celestial object (Earth only).
+                        raan (Angle): The right ascension of the ascending node.
+                        argument_of_latitude (Angle): The argument of latitude.
+
+                    Returns:
+                        Orbit: The repeat ground track `Orbit` object.
+                )doc"
+            )
+
             .def_static(
                 "compute_passes",
-                &Orbit::ComputePasses,
+                overload_cast<const Array<State>&, const Integer&>(&Orbit::ComputePasses),
+                call_guard<gil_scoped_release>(),
                 arg("states"),
                 arg("initial_revolution_number"),
                 R"doc(
@@ -378,6 +534,29 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit(pybind11::module& a
                 )doc"
             )
 
+            .def_static(
+                "compute_passes",
+                overload_cast<const Array<State>&, const Integer&, const ExecutionContext&>(&Orbit::ComputePasses),
+                call_guard<gil_scoped_release>(),
+                arg("states"),
+                arg("initial_revolution_number"),
+                arg("execution_context"),
+                R"doc(
+                    Compute passes from a set of states, in parallel.
+
+                    Crossings are located concurrently over chunks of states, and refined by interpolating the states
+                    around each crossing.
+
+                    Args:
+                        states (Array<State>): The states.
+                        initial_revolution_number (Integer): The initial revolution number.
+                        execution_context (ExecutionContext): The execution context.
+
+                    Returns:
+                        list[tuple[int, Pass]]: List of index-pass pairs
+                )doc"
+            )
+
             ;
     }
 
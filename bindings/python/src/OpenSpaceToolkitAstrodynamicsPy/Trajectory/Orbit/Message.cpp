@@ -1,5 +1,6 @@
 /// Apache License 2.0
 
+#include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/Orbit/Message/CCSDS.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/Orbit/Message/SpaceX.cpp>
 
 inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Message(pybind11::module& aModule)
@@ -9,4 +10,5 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Message(pybind11::m
 
     // add objects to "message" submodule
     OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Message_SpaceX(message);
+    OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Message_CCSDS(message);
 }
@@ -0,0 +1,12 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/Orbit/Message/CCSDS/OEM.cpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Message_CCSDS(pybind11::module& aModule)
+{
+    // Create "ccsds" python submodule
+    auto ccsds = aModule.def_submodule("ccsds");
+
+    // add objects to "ccsds" submodule
+    OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Message_CCSDS_OEM(ccsds);
+}
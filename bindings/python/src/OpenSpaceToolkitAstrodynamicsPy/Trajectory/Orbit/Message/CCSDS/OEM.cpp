@@ -0,0 +1,459 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Message/CCSDS/OEM.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Message_CCSDS_OEM(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::container::Array;
+    using ostk::core::filesystem::File;
+    using ostk::core::type::Size;
+    using ostk::core::type::String;
+
+    using ostk::physics::time::Instant;
+
+    using ostk::astrodynamics::trajectory::orbit::message::ccsds::OEM;
+    using ostk::astrodynamics::trajectory::Propagator;
+    using ostk::astrodynamics::trajectory::State;
+
+    class_<OEM> oem(
+        aModule,
+        "OEM",
+        R"doc(
+            The CCSDS Orbit Ephemeris Message (OEM), KVN format.
+
+            Positions and velocities are read and written in km and km/s. Large ephemerides are handled with
+            `OEM.Writer` and `OEM.Reader`, which stream states to and from disk one chunk at a time.
+
+            See Also:
+                `CCSDS OEM <https://public.ccsds.org/Pubs/502x0b3e1.pdf>`_.
+
+        )doc"
+    );
+
+    class_<OEM::Header>(
+        oem,
+        "Header",
+        R"doc(
+            The header of the OEM message.
+
+        )doc"
+    )
+
+        .def(
+            init<const String&, const Instant&, const String&>(),
+            R"doc(
+                Constructor.
+
+                Args:
+                    version (str): The CCSDS OEM version.
+                    creation_date (Instant): The message creation date.
+                    originator (str): The message originator.
+
+            )doc",
+            arg("version"),
+            arg("creation_date"),
+            arg("originator")
+        )
+
+        .def_readonly("version", &OEM::Header::version)
+        .def_readonly("creation_date", &OEM::Header::creationDate)
+        .def_readonly("originator", &OEM::Header::originator)
+
+        ;
+
+    class_<OEM::Metadata>(
+        oem,
+        "Metadata",
+        R"doc(
+            The metadata of an OEM segment.
+
+        )doc"
+    )
+
+        .def(
+            init<
+                const String&,
+                const String&,
+                const String&,
+                const String&,
+                const String&,
+                const Instant&,
+                const Instant&>(),
+            R"doc(
+                Constructor.
+
+                Args:
+                    object_name (str): The object name.
+                    object_id (str): The object identifier.
+                    center_name (str): The center name.
+                    reference_frame (str): The reference frame (GCRF, ICRF, EME2000, ITRF or TEME).
+                    time_system (str): The time system (UTC, TAI, TT, GPS, TDB, TCB, TCG or UT1).
+                    start_time (Instant): The segment start time.
+                    stop_time (Instant): The segment stop time.
+
+            )doc",
+            arg("object_name"),
+            arg("object_id"),
+            arg("center_name"),
+            arg("reference_frame"),
+            arg("time_system"),
+            arg("start_time"),
+            arg("stop_time")
+        )
+
+        .def_readonly("object_name", &OEM::Metadata::objectName)
+        .def_readonly("object_id", &OEM::Metadata::objectId)
+        .def_readonly("center_name", &OEM::Metadata::centerName)
+        .def_readonly("reference_frame", &OEM::Metadata::referenceFrame)
+        .def_readonly("time_system", &OEM::Metadata::timeSystem)
+        .def_readonly("start_time", &OEM::Metadata::startTime)
+        .def_readonly("stop_time", &OEM::Metadata::stopTime)
+
+        ;
+
+    class_<OEM::Segment>(
+        oem,
+        "Segment",
+        R"doc(
+            An OEM segment: metadata and states.
+
+        )doc"
+    )
+
+        .def(
+            init<const OEM::Metadata&, const Array<State>&>(),
+            R"doc(
+                Constructor.
+
+                Args:
+                    metadata (Metadata): The segment metadata.
+                    states (list[State]): The segment states.
+
+            )doc",
+            arg("metadata"),
+            arg("states")
+        )
+
+        .def_readonly("metadata", &OEM::Segment::metadata)
+        .def_readonly("states", &OEM::Segment::states)
+
+        ;
+
+    class_<OEM::Writer>(
+        oem,
+        "Writer",
+        R"doc(
+            Streaming OEM writer.
+
+            States are flushed to disk every chunk of states, so that the ephemeris never has to be held in memory.
+
+        )doc"
+    )
+
+        .def(
+            init<const File&, const OEM::Header&, const Size&>(),
+            R"doc(
+                Constructor, writes the header.
+
+                Args:
+                    file (File): The output file.
+                    header (Header): The header.
+                    chunk_size (int): The number of states written to disk at once.
+
+            )doc",
+            arg("file"),
+            arg("header"),
+            arg("chunk_size") = DEFAULT_OEM_CHUNK_SIZE
+        )
+
+        .def(
+            "__enter__",
+            [](OEM::Writer& aWriter) -> OEM::Writer&
+            {
+                return aWriter;
+            },
+            return_value_policy::reference
+        )
+        .def(
+            "__exit__",
+            [](OEM::Writer& aWriter, const object&, const object&, const object&)
+            {
+                aWriter.close();
+            }
+        )
+
+        .def(
+            "is_open",
+            &OEM::Writer::isOpen,
+            R"doc(
+                Check if the writer is open.
+
+                Returns:
+                    bool: True if the writer is open.
+
+            )doc"
+        )
+        .def(
+            "write_metadata",
+            &OEM::Writer::writeMetadata,
+            R"doc(
+                Start a new segment.
+
+                Args:
+                    metadata (Metadata): The segment metadata.
+
+            )doc",
+            arg("metadata")
+        )
+        .def(
+            "write",
+            overload_cast<const State&>(&OEM::Writer::write),
+            R"doc(
+                Write a state to the current segment.
+
+                Args:
+                    state (State): The state, converted to the segment reference frame.
+
+            )doc",
+            arg("state")
+        )
+        .def(
+            "write",
+            overload_cast<const Array<State>&>(&OEM::Writer::write),
+            R"doc(
+                Write states to the current segment.
+
+                Args:
+                    states (list[State]): The states, converted to the segment reference frame.
+
+            )doc",
+            arg("states")
+        )
+        .def(
+            "write",
+            overload_cast<const Propagator&, const State&, const Array<Instant>&>(&OEM::Writer::write),
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Propagate a state and write the propagated states to the current segment, one chunk at a time.
+
+                Args:
+                    propagator (Propagator): The propagator.
+                    state (State): The initial state.
+                    instants (list[Instant]): The instants, in chronological order.
+
+            )doc",
+            arg("propagator"),
+            arg("state"),
+            arg("instants")
+        )
+        .def(
+            "close",
+            &OEM::Writer::close,
+            R"doc(
+                Flush buffered states and close the file.
+
+            )doc"
+        )
+
+        ;
+
+    class_<OEM::Reader>(
+        oem,
+        "Reader",
+        R"doc(
+            Streaming OEM reader.
+
+            Segments are read one after the other, and their states one chunk at a time.
+
+        )doc"
+    )
+
+        .def(
+            init<const File&>(),
+            R"doc(
+                Constructor, reads the header.
+
+                Args:
+                    file (File): The input file.
+
+            )doc",
+            arg("file")
+        )
+
+        .def(
+            "get_header",
+            &OEM::Reader::getHeader,
+            R"doc(
+                Get the header.
+
+                Returns:
+                    Header: The header.
+
+            )doc"
+        )
+        .def(
+            "get_metadata",
+            &OEM::Reader::getMetadata,
+            R"doc(
+                Get the current segment metadata.
+
+                Returns:
+                    Metadata: The current segment metadata.
+
+            )doc"
+        )
+        .def(
+            "read_metadata",
+            &OEM::Reader::readMetadata,
+            R"doc(
+                Advance to the next segment, skipping any unread state of the current segment.
+
+                Returns:
+                    bool: True if a segment was read, False at the end of the file.
+
+            )doc"
+        )
+        .def(
+            "read_states",
+            &OEM::Reader::readStates,
+            R"doc(
+                Read the next states of the current segment.
+
+                Args:
+                    maximum_count (int): The maximum number of states.
+
+                Returns:
+                    list[State]: The states, empty once the segment is exhausted.
+
+            )doc",
+            arg("maximum_count") = DEFAULT_OEM_CHUNK_SIZE
+        )
+        .def(
+            "read_tabulated",
+            &OEM::Reader::readTabulated,
+            R"doc(
+                Read the remaining states of the current segment into a tabulated model.
+
+                Args:
+                    interpolation_type (Interpolator.Type): The interpolation type.
+
+                Returns:
+                    Tabulated: The tabulated model.
+
+            )doc",
+            arg("interpolation_type") = DEFAULT_TABULATED_TRAJECTORY_INTERPOLATION_TYPE
+        )
+
+        ;
+
+    oem
+
+        .def(
+            init<const OEM::Header&, const Array<OEM::Segment>&>(),
+            R"doc(
+                Constructor.
+
+                Args:
+                    header (Header): The header.
+                    segments (list[Segment]): The segments.
+
+            )doc",
+            arg("header"),
+            arg("segments")
+        )
+
+        .def("__str__", &(shiftToString<OEM>))
+        .def("__repr__", &(shiftToString<OEM>))
+
+        .def(
+            "is_defined",
+            &OEM::isDefined,
+            R"doc(
+                Check if the OEM message is defined.
+
+                Returns:
+                    bool: True if the OEM message is defined.
+
+            )doc"
+        )
+        .def(
+            "get_header",
+            &OEM::getHeader,
+            R"doc(
+                Get the header.
+
+                Returns:
+                    Header: The header.
+
+            )doc"
+        )
+        .def(
+            "get_segments",
+            &OEM::getSegments,
+            R"doc(
+                Get the segments.
+
+                Returns:
+                    list[Segment]: The segments.
+
+            )doc"
+        )
+        .def(
+            "get_segment_at",
+            &OEM::getSegmentAt,
+            R"doc(
+                Get the segment at a given index.
+
+                Args:
+                    index (int): The segment index.
+
+                Returns:
+                    Segment: The segment.
+
+            )doc",
+            arg("index")
+        )
+        .def(
+            "save",
+            &OEM::save,
+            R"doc(
+                Write the message to a file.
+
+                Args:
+                    file (File): The output file.
+
+            )doc",
+            arg("file")
+        )
+
+        .def_static(
+            "undefined",
+            &OEM::Undefined,
+            R"doc(
+                Get an undefined OEM message.
+
+                Returns:
+                    OEM: An undefined OEM message.
+
+            )doc"
+        )
+        .def_static(
+            "load",
+            &OEM::Load,
+            R"doc(
+                Load an OEM message from a file.
+
+                Args:
+                    file (File): The file.
+
+                Returns:
+                    OEM: The OEM message.
+
+            )doc",
+            arg("file")
+        )
+
+        ;
+}
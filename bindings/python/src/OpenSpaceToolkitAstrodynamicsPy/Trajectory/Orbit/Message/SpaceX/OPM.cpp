@@ -112,6 +112,59 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Message_SpaceX_OPM(
             )doc",
             arg("name")
         )
+        .def(
+            "to_states",
+            &OPM::toStates,
+            R"doc(
+                Get the deployment states.
+
+                Returns:
+                    states (list[State]): The deployment states, in the order of the deployments.
+
+            )doc"
+        )
+        .def(
+            "calculate_states_at",
+            &OPM::calculateStatesAt,
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Propagate all deployments to an instant, as a batch, in parallel.
+
+                Args:
+                    propagator (Propagator): The propagator.
+                    instant (Instant): The instant.
+                    thread_count (int): The worker thread count (0 defaults to the default thread count of ExecutionContext).
+
+                Returns:
+                    states (list[State]): The propagated states, in the order of the deployments.
+
+            )doc",
+            arg("propagator"),
+            arg("instant"),
+            arg("thread_count") = 0
+        )
+        .def(
+            "generate_orbits",
+            &OPM::generateOrbits,
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Generate the orbits of all deployments, propagated to an analysis horizon as a batch.
+
+                Args:
+                    propagator (Propagator): The propagator.
+                    celestial_object (Celestial): The celestial object.
+                    instant (Instant): The analysis horizon.
+                    thread_count (int): The worker thread count (0 defaults to the default thread count of ExecutionContext).
+
+                Returns:
+                    orbits (list[Orbit]): The orbits, in the order of the deployments.
+
+            )doc",
+            arg("propagator"),
+            arg("celestial_object"),
+            arg("instant"),
+            arg("thread_count") = 0
+        )
 
         .def_static(
             "undefined",
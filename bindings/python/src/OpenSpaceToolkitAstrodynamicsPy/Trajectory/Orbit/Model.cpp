@@ -4,6 +4,7 @@
 #include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/Orbit/Model/Kepler/BrouwerLyddaneMean.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/Orbit/Model/Propagated.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/Orbit/Model/SGP4.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/Orbit/Model/SemiAnalytical.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/Orbit/Model/Tabulated.cpp>
 
 inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model(pybind11::module& aModule)
@@ -194,6 +195,23 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model(pybind11::mod
             )doc",
             arg("instant")
         )
+        .def(
+            "estimate_ascending_node_instant",
+            &Model::estimateAscendingNodeInstant,
+            R"doc(
+                Estimate the instant of the ascending node starting a given revolution.
+
+                Analytic initial guess, refined locally by the orbit pass computation.
+
+                Args:
+                    revolution_number (int): The revolution number.
+
+                Returns:
+                    Instant: The estimated instant, undefined if the model provides no estimate.
+
+            )doc",
+            arg("revolution_number")
+        )
 
         ;
 
@@ -205,5 +223,6 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model(pybind11::mod
     OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_SGP4(model);
     OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_Tabulated(model);
     OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_Propagated(model);
+    OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_SemiAnalytical(model);
     OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_BrouwerLyddaneMean(model);
 }
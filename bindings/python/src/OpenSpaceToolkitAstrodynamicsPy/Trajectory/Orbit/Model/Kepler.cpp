@@ -220,6 +220,36 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_Kepler(pybind
                 )doc"
             )
 
+            .def(
+                "calculate_states_at",
+                &Kepler::calculateStatesAt,
+                arg("instants"),
+                R"doc(
+                    Calculate the states of the `Kepler` model at given instants. The secular rates are computed once for the whole instant array.
+
+                    Args:
+                        instants (list[Instant]): The instants.
+
+                    Returns:
+                        list[State]: The states.
+                )doc"
+            )
+
+            .def(
+                "calculate_coes_at",
+                &Kepler::calculateCOEsAt,
+                arg("instants"),
+                R"doc(
+                    Calculate the classical orbital elements of the `Kepler` model at given instants, without going through cartesian states.
+
+                    Args:
+                        instants (list[Instant]): The instants.
+
+                    Returns:
+                        list[COE]: The COEs, in GCRF.
+                )doc"
+            )
+
             .def(
                 "calculate_revolution_number_at",
                 &Kepler::calculateRevolutionNumberAt,
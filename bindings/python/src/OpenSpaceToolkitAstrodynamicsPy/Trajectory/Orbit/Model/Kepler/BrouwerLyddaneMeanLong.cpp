@@ -8,13 +8,18 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_BrouwerLyddan
 {
     using namespace pybind11;
 
+    using ostk::core::container::Array;
     using ostk::core::type::Real;
+    using ostk::core::type::Size;
 
     using ostk::physics::unit::Angle;
+    using ostk::physics::unit::Derived;
     using ostk::physics::unit::Length;
 
+    using ostk::astrodynamics::ExecutionContext;
     using ostk::astrodynamics::trajectory::orbit::model::blm::BrouwerLyddaneMean;
     using ostk::astrodynamics::trajectory::orbit::model::blm::BrouwerLyddaneMeanLong;
+    using ostk::astrodynamics::trajectory::orbit::model::kepler::COE;
 
     class_<BrouwerLyddaneMeanLong, BrouwerLyddaneMean> brouwerLyddaneMeanLong(
         aModule,
@@ -93,6 +98,86 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_BrouwerLyddan
             arg("gravitational_parameter")
         )
 
+        .def_static(
+            "from_cartesian_states",
+            overload_cast<const Array<COE::CartesianState>&, const Derived&, const Size&>(
+                &BrouwerLyddaneMeanLong::FromCartesianStates
+            ),
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Create a list of `BrouwerLyddaneMeanLong` models from Cartesian states, converted in parallel.
+
+                Args:
+                    cartesian_states (list[CartesianState]): The Cartesian states.
+                    gravitational_parameter (float): The gravitational parameter of the central body.
+                    thread_count (int): The number of worker threads, 0 to use the default thread count of ExecutionContext. Defaults to 0.
+
+                Returns:
+                    list[BrouwerLyddaneMeanLong]: The `BrouwerLyddaneMeanLong` models.
+            )doc",
+            arg("cartesian_states"),
+            arg("gravitational_parameter"),
+            arg("thread_count") = 0
+        )
+        .def_static(
+            "from_cartesian_states",
+            overload_cast<const Array<COE::CartesianState>&, const Derived&, const ExecutionContext&>(
+                &BrouwerLyddaneMeanLong::FromCartesianStates
+            ),
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Create a list of `BrouwerLyddaneMeanLong` models from Cartesian states, converted within an execution context.
+
+                Args:
+                    cartesian_states (list[CartesianState]): The Cartesian states.
+                    gravitational_parameter (float): The gravitational parameter of the central body.
+                    execution_context (ExecutionContext): The execution context.
+
+                Returns:
+                    list[BrouwerLyddaneMeanLong]: The `BrouwerLyddaneMeanLong` models.
+            )doc",
+            arg("cartesian_states"),
+            arg("gravitational_parameter"),
+            arg("execution_context")
+        )
+
+        .def_static(
+            "to_coes",
+            overload_cast<const Array<BrouwerLyddaneMeanLong>&, const Size&>(&BrouwerLyddaneMeanLong::ToCOEs),
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Convert a list of `BrouwerLyddaneMeanLong` models to classical orbital elements, in parallel.
+
+                Args:
+                    element_sets (list[BrouwerLyddaneMeanLong]): The `BrouwerLyddaneMeanLong` models.
+                    thread_count (int): The number of worker threads, 0 to use the default thread count of ExecutionContext. Defaults to 0.
+
+                Returns:
+                    list[COE]: The classical orbital elements.
+            )doc",
+            arg("element_sets"),
+            arg("thread_count") = 0
+        )
+        .def_static(
+            "to_coes",
+            overload_cast<const Array<BrouwerLyddaneMeanLong>&, const ExecutionContext&>(
+                &BrouwerLyddaneMeanLong::ToCOEs
+            ),
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Convert a list of `BrouwerLyddaneMeanLong` models to classical orbital elements, within an execution context.
+
+                Args:
+                    element_sets (list[BrouwerLyddaneMeanLong]): The `BrouwerLyddaneMeanLong` models.
+                    execution_context (ExecutionContext): The execution context.
+
+                Returns:
+                    list[COE]: The classical orbital elements.
+            )doc",
+            arg("element_sets"),
+            arg("execution_context")
+        )
+
         .def_static(
             "undefined",
             &BrouwerLyddaneMeanLong::Undefined,
@@ -8,13 +8,18 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_BrouwerLyddan
 {
     using namespace pybind11;
 
+    using ostk::core::container::Array;
     using ostk::core::type::Real;
+    using ostk::core::type::Size;
 
     using ostk::physics::unit::Angle;
+    using ostk::physics::unit::Derived;
     using ostk::physics::unit::Length;
 
+    using ostk::astrodynamics::ExecutionContext;
     using ostk::astrodynamics::trajectory::orbit::model::blm::BrouwerLyddaneMean;
     using ostk::astrodynamics::trajectory::orbit::model::blm::BrouwerLyddaneMeanShort;
+    using ostk::astrodynamics::trajectory::orbit::model::kepler::COE;
 
     class_<BrouwerLyddaneMeanShort, BrouwerLyddaneMean> brouwerLyddaneMeanShort(
         aModule,
@@ -92,6 +97,86 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_BrouwerLyddan
             arg("gravitational_parameter")
         )
 
+        .def_static(
+            "from_cartesian_states",
+            overload_cast<const Array<COE::CartesianState>&, const Derived&, const Size&>(
+                &BrouwerLyddaneMeanShort::FromCartesianStates
+            ),
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Create a list of `BrouwerLyddaneMeanShort` models from Cartesian states, converted in parallel.
+
+                Args:
+                    cartesian_states (list[CartesianState]): The Cartesian states.
+                    gravitational_parameter (float): The gravitational parameter of the central body.
+                    thread_count (int): The number of worker threads, 0 to use the default thread count of ExecutionContext. Defaults to 0.
+
+                Returns:
+                    list[BrouwerLyddaneMeanShort]: The `BrouwerLyddaneMeanShort` models.
+            )doc",
+            arg("cartesian_states"),
+            arg("gravitational_parameter"),
+            arg("thread_count") = 0
+        )
+        .def_static(
+            "from_cartesian_states",
+            overload_cast<const Array<COE::CartesianState>&, const Derived&, const ExecutionContext&>(
+                &BrouwerLyddaneMeanShort::FromCartesianStates
+            ),
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Create a list of `BrouwerLyddaneMeanShort` models from Cartesian states, converted within an execution context.
+
+                Args:
+                    cartesian_states (list[CartesianState]): The Cartesian states.
+                    gravitational_parameter (float): The gravitational parameter of the central body.
+                    execution_context (ExecutionContext): The execution context.
+
+                Returns:
+                    list[BrouwerLyddaneMeanShort]: The `BrouwerLyddaneMeanShort` models.
+            )doc",
+            arg("cartesian_states"),
+            arg("gravitational_parameter"),
+            arg("execution_context")
+        )
+
+        .def_static(
+            "to_coes",
+            overload_cast<const Array<BrouwerLyddaneMeanShort>&, const Size&>(&BrouwerLyddaneMeanShort::ToCOEs),
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Convert a list of `BrouwerLyddaneMeanShort` models to classical orbital elements, in parallel.
+
+                Args:
+                    element_sets (list[BrouwerLyddaneMeanShort]): The `BrouwerLyddaneMeanShort` models.
+                    thread_count (int): The number of worker threads, 0 to use the default thread count of ExecutionContext. Defaults to 0.
+
+                Returns:
+                    list[COE]: The classical orbital elements.
+            )doc",
+            arg("element_sets"),
+            arg("thread_count") = 0
+        )
+        .def_static(
+            "to_coes",
+            overload_cast<const Array<BrouwerLyddaneMeanShort>&, const ExecutionContext&>(
+                &BrouwerLyddaneMeanShort::ToCOEs
+            ),
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Convert a list of `BrouwerLyddaneMeanShort` models to classical orbital elements, within an execution context.
+
+                Args:
+                    element_sets (list[BrouwerLyddaneMeanShort]): The `BrouwerLyddaneMeanShort` models.
+                    execution_context (ExecutionContext): The execution context.
+
+                Returns:
+                    list[COE]: The classical orbital elements.
+            )doc",
+            arg("element_sets"),
+            arg("execution_context")
+        )
+
         .def_static(
             "undefined",
             &BrouwerLyddaneMeanShort::Undefined,
@@ -370,6 +370,84 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_Kepler_COE(py
             arg("gravitational_parameter")
         )
 
+        .def_static(
+            "cartesian_to_SI_vector",
+            &COE::CartesianToSIVector,
+            R"doc(
+                Convert a Cartesian state vector to a `COE` vector, in SI units, without building intermediate objects.
+
+                Args:
+                    cartesian_vector (Vector6d): The Cartesian state vector [x, y, z, vx, vy, vz] in meters and meters per second.
+                    gravitational_parameter (float): The gravitational parameter of the central body, in m^3/s^2.
+
+                Returns:
+                    Vector6d: The `COE` vector [a, e, i, raan, aop, true anomaly] in meters and radians.
+            )doc",
+            arg("cartesian_vector"),
+            arg("gravitational_parameter")
+        )
+
+        .def_static(
+            "SI_vector_to_cartesian",
+            &COE::SIVectorToCartesian,
+            R"doc(
+                Convert a `COE` vector, in SI units, to a Cartesian state vector without building intermediate objects.
+
+                Args:
+                    coe_vector (Vector6d): The `COE` vector [a, e, i, raan, aop, true anomaly] in meters and radians.
+                    gravitational_parameter (float): The gravitational parameter of the central body, in m^3/s^2.
+
+                Returns:
+                    Vector6d: The Cartesian state vector [x, y, z, vx, vy, vz] in meters and meters per second.
+            )doc",
+            arg("coe_vector"),
+            arg("gravitational_parameter")
+        )
+
+        .def_static(
+            "cartesians_to_SI_vectors",
+            &COE::CartesiansToSIVectors,
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Convert Cartesian state vectors to `COE` vectors, in SI units, row-wise and natively.
+
+                Anomalies other than the true anomaly are only defined for elliptic orbits.
+
+                Args:
+                    cartesian_vectors (numpy.ndarray): The Cartesian state vectors [x, y, z, vx, vy, vz] in meters and meters per second, as a N x 6 array.
+                    gravitational_parameter (float): The gravitational parameter of the central body, in m^3/s^2.
+                    anomaly_type (COE.AnomalyType, optional): The anomaly type of the last `COE` column. Defaults to TrueAnomaly.
+
+                Returns:
+                    numpy.ndarray: The `COE` vectors [a, e, i, raan, aop, anomaly] in meters and radians, as a N x 6 array.
+            )doc",
+            arg("cartesian_vectors"),
+            arg("gravitational_parameter"),
+            arg("anomaly_type") = COE::AnomalyType::True
+        )
+
+        .def_static(
+            "SI_vectors_to_cartesians",
+            &COE::SIVectorsToCartesians,
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Convert `COE` vectors, in SI units, to Cartesian state vectors, row-wise and natively.
+
+                Mean anomalies are converted with the vectorized Kepler solver. Mean and eccentric anomalies are only supported for elliptic orbits.
+
+                Args:
+                    coe_vectors (numpy.ndarray): The `COE` vectors [a, e, i, raan, aop, anomaly] in meters and radians, as a N x 6 array.
+                    gravitational_parameter (float): The gravitational parameter of the central body, in m^3/s^2.
+                    anomaly_type (COE.AnomalyType, optional): The anomaly type of the last `COE` column. Defaults to TrueAnomaly.
+
+                Returns:
+                    numpy.ndarray: The Cartesian state vectors [x, y, z, vx, vy, vz] in meters and meters per second, as a N x 6 array.
+            )doc",
+            arg("coe_vectors"),
+            arg("gravitational_parameter"),
+            arg("anomaly_type") = COE::AnomalyType::True
+        )
+
         .def_static(
             "from_SI_vector",
             &COE::FromSIVector,
@@ -387,6 +465,35 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_Kepler_COE(py
             arg("anomaly_type")
         )
 
+        .def_static(
+            "save_snapshot",
+            &COE::SaveSnapshot,
+            R"doc(
+                Save a set of `COE` to a binary snapshot file, made of a versioned header followed by fixed size records.
+
+                Args:
+                    coes (list[COE]): The `COE` set.
+                    file (File): The file.
+            )doc",
+            arg("coes"),
+            arg("file")
+        )
+
+        .def_static(
+            "load_snapshot",
+            &COE::LoadSnapshot,
+            R"doc(
+                Load a set of `COE` from a binary snapshot file.
+
+                Args:
+                    file (File): The file.
+
+                Returns:
+                    list[COE]: The `COE` set, in the order it was saved.
+            )doc",
+            arg("file")
+        )
+
         .def_static(
             "eccentric_anomaly_from_true_anomaly",
             &COE::EccentricAnomalyFromTrueAnomaly,
@@ -476,6 +583,44 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_Kepler_COE(py
             arg("tolerance")
         )
 
+        .def_static(
+            "eccentric_anomalies_from_mean_anomalies",
+            &COE::EccentricAnomaliesFromMeanAnomalies,
+            R"doc(
+                Compute eccentric anomalies from mean anomalies, element-wise, for elliptic orbits. Kepler's equation is solved for a fixed iteration count over the whole array.
+
+                Args:
+                    mean_anomalies (numpy.ndarray): The mean anomalies [rad].
+                    eccentricities (numpy.ndarray): The eccentricities, either one per mean anomaly or a single one for all.
+                    iteration_count (int): The iteration count. Defaults to 5.
+
+                Returns:
+                    numpy.ndarray: The eccentric anomalies [rad], in [0, 2pi).
+            )doc",
+            arg("mean_anomalies"),
+            arg("eccentricities"),
+            arg("iteration_count") = 5
+        )
+
+        .def_static(
+            "true_anomalies_from_mean_anomalies",
+            &COE::TrueAnomaliesFromMeanAnomalies,
+            R"doc(
+                Compute true anomalies from mean anomalies, element-wise, for elliptic orbits.
+
+                Args:
+                    mean_anomalies (numpy.ndarray): The mean anomalies [rad].
+                    eccentricities (numpy.ndarray): The eccentricities, either one per mean anomaly or a single one for all.
+                    iteration_count (int): The iteration count. Defaults to 5.
+
+                Returns:
+                    numpy.ndarray: The true anomalies [rad], in [0, 2pi).
+            )doc",
+            arg("mean_anomalies"),
+            arg("eccentricities"),
+            arg("iteration_count") = 5
+        )
+
         .def_static(
             "compute_semi_latus_rectum",
             &COE::ComputeSemiLatusRectum,
@@ -9,6 +9,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_Propagated(py
     using ostk::core::container::Array;
     using ostk::core::type::Integer;
     using ostk::core::type::Shared;
+    using ostk::core::type::Size;
 
     using ostk::physics::time::Instant;
 
@@ -124,13 +125,16 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_Propagated(py
 
             .def(
                 "calculate_states_at",
-                &Propagated::calculateStatesAt,
+                overload_cast<const Array<Instant>&, const Size&>(&Propagated::calculateStatesAt, const_),
+                call_guard<gil_scoped_release>(),
                 arg("instants"),
+                arg("thread_count") = 1,
                 R"doc(
-                    Calculate the states of the `Propagated` model at given instants.
+                    Calculate the states of the `Propagated` model at given instants. Windows between cached states can be processed in parallel, using a pool of worker threads.
 
                     Args:
                         instants (list[Instant]): The instants.
+                        thread_count (int): The worker thread count (0 defaults to the default thread count). Defaults to 1 (serial).
 
                     Returns:
                         list[State]: The states.
@@ -156,10 +160,23 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_Propagated(py
 
             .def(
                 "access_cached_state_array",
-                &Propagated::accessCachedStateArray,
+                &Propagated::getCachedStateArray,
                 R"doc(
                     Access the cached state array of the `Propagated` model.
 
+                    The array is copied under the cache lock, hence is consistent even while other threads query the model.
+
+                    Returns:
+                        list[State]: The cached state array.
+
+                )doc"
+            )
+            .def(
+                "get_cached_state_array",
+                &Propagated::getCachedStateArray,
+                R"doc(
+                    Get a copy of the cached state array of the `Propagated` model, taken under the cache lock.
+
                     Returns:
                         list[State]: The cached state array.
 
@@ -178,6 +195,56 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_Propagated(py
                 )doc"
             )
 
+            .def(
+                "get_hermite_interpolation_span",
+                &Propagated::getHermiteInterpolationSpan,
+                R"doc(
+                    Get the Hermite interpolation span of the `Propagated` model.
+
+                    Returns:
+                        Duration: The span (undefined if Hermite interpolation is disabled).
+
+                )doc"
+            )
+
+            .def(
+                "set_hermite_interpolation_span",
+                &Propagated::setHermiteInterpolationSpan,
+                arg("duration"),
+                R"doc(
+                    Set the Hermite interpolation span of the `Propagated` model. Between cached states at most this far apart, states are interpolated with a cubic Hermite polynomial instead of being propagated.
+
+                    Args:
+                        duration (Duration): The span (undefined disables Hermite interpolation).
+
+                )doc"
+            )
+
+            .def(
+                "get_checkpoint_spacing",
+                &Propagated::getCheckpointSpacing,
+                R"doc(
+                    Get the checkpoint spacing of the `Propagated` model.
+
+                    Returns:
+                        Duration: The spacing (undefined if checkpointing is disabled).
+
+                )doc"
+            )
+
+            .def(
+                "set_checkpoint_spacing",
+                &Propagated::setCheckpointSpacing,
+                arg("duration"),
+                R"doc(
+                    Set the checkpoint spacing of the `Propagated` model. When propagating forward of the last cached state, intermediate states are added to the cached state array at multiples of this spacing.
+
+                    Args:
+                        duration (Duration): The spacing (undefined disables checkpointing).
+
+                )doc"
+            )
+
             .def(
                 "set_cached_state_array",
                 &Propagated::setCachedStateArray,
@@ -191,6 +258,100 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_Propagated(py
                 )doc"
             )
 
+            .def(
+                "get_cache_policy",
+                &Propagated::getCachePolicy,
+                R"doc(
+                    Get the cache policy of the `Propagated` model.
+
+                    Returns:
+                        Propagated.CachePolicy: The cache policy.
+
+                )doc"
+            )
+
+            .def(
+                "set_cache_policy",
+                &Propagated::setCachePolicy,
+                arg("cache_policy"),
+                R"doc(
+                    Set the cache policy of the `Propagated` model, evicting cached states if needed.
+
+                    Args:
+                        cache_policy (Propagated.CachePolicy): The cache policy.
+
+                )doc"
+            )
+
+            .def(
+                "add_cached_state",
+                &Propagated::addCachedState,
+                arg("state"),
+                R"doc(
+                    Add a state to the cached state array of the `Propagated` model, keeping it sorted.
+
+                    Args:
+                        state (State): The state.
+
+                )doc"
+            )
+
+            ;
+
+        class_<Propagated::CachePolicy>(
+            propagated_class,
+            "CachePolicy",
+            R"doc(
+                Policy bounding the cached state array. Anchor states (provided at construction or through `set_cached_state_array`) are always kept, added states are evicted least recently queried first.
+
+            )doc"
+        )
+
+            .def(
+                init<const Size&, const Size&>(),
+                R"doc(
+                    Constructor.
+
+                    Args:
+                        maximum_state_count (int, optional): The maximum cached state count (0 for unbounded). Defaults to 0.
+                        maximum_memory_size (int, optional): The maximum estimated cache memory size in bytes (0 for unbounded). Defaults to 0.
+
+                )doc",
+                arg("maximum_state_count") = 0,
+                arg("maximum_memory_size") = 0
+            )
+
+            .def_readwrite(
+                "maximum_state_count",
+                &Propagated::CachePolicy::maximumStateCount,
+                R"doc(
+                    The maximum cached state count (0 for unbounded).
+
+                    :type: int
+                )doc"
+            )
+            .def_readwrite(
+                "maximum_memory_size",
+                &Propagated::CachePolicy::maximumMemorySize,
+                R"doc(
+                    The maximum estimated cache memory size in bytes (0 for unbounded).
+
+                    :type: int
+                )doc"
+            )
+
+            .def_static(
+                "unbounded",
+                &Propagated::CachePolicy::Unbounded,
+                R"doc(
+                    Get an unbounded cache policy.
+
+                    Returns:
+                        Propagated.CachePolicy: The cache policy.
+
+                )doc"
+            )
+
             ;
     }
 }
@@ -4,15 +4,59 @@
 
 #include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/Orbit/Model/SGP4/TLE.cpp>
 
+/// @brief Wrap a 6 x (instant count x TLE count) catalog states matrix into NumPy positions and velocities
+///
+/// The matrix is moved into a capsule, and both arrays are views of shape (instant count, TLE count, 3) on it.
+inline pybind11::tuple OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_SGP4_CatalogArrays(
+    ostk::mathematics::object::MatrixXd&& aStateMatrix,
+    const ostk::core::type::Size& anInstantCount,
+    const ostk::core::type::Size& aTleCount
+)
+{
+    using namespace pybind11;
+
+    using ostk::mathematics::object::MatrixXd;
+
+    MatrixXd* stateMatrixPtr = new MatrixXd(std::move(aStateMatrix));
+
+    const capsule owner(
+        stateMatrixPtr,
+        [](void* aPointer)
+        {
+            delete static_cast<MatrixXd*>(aPointer);
+        }
+    );
+
+    const ssize_t doubleSize = sizeof(double);
+
+    const std::vector<ssize_t> shape = {ssize_t(anInstantCount), ssize_t(aTleCount), 3};
+    const std::vector<ssize_t> strides = {ssize_t(aTleCount) * 6 * doubleSize, 6 * doubleSize, doubleSize};
+
+    const array_t<double> positions(shape, strides, stateMatrixPtr->data(), owner);
+    const array_t<double> velocities(shape, strides, stateMatrixPtr->data() + 3, owner);
+
+    return make_tuple(positions, velocities);
+}
+
 inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_SGP4(pybind11::module& aModule)
 {
     using namespace pybind11;
 
+    using ostk::core::container::Array;
+    using ostk::core::filesystem::File;
+    using ostk::core::type::Size;
+    using ostk::core::type::String;
+
+    using ostk::mathematics::object::MatrixXd;
+
+    using ostk::physics::time::Instant;
+
+    using ostk::astrodynamics::ExecutionContext;
     using ostk::astrodynamics::trajectory::orbit::model::SGP4;
     using ostk::astrodynamics::trajectory::orbit::model::sgp4::TLE;
 
     {
-        class_<SGP4, ostk::astrodynamics::trajectory::orbit::Model>(
+        class_<SGP4, ostk::astrodynamics::trajectory::orbit::Model> sgp4_class(
             aModule,
             "SGP4",
             R"doc(
@@ -20,19 +64,44 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_SGP4(pybind11
 
                 Provides the interface for orbit models.
 
+            )doc"
+        );
+
+        enum_<SGP4::OutputFrame>(
+            sgp4_class,
+            "OutputFrame",
+            R"doc(
+                The frame in which states are output.
+
             )doc"
         )
 
+            .value("GCRF", SGP4::OutputFrame::GCRF, "Geocentric Celestial Reference Frame")
+
+            .value("TEME", SGP4::OutputFrame::TEME, "True Equator Mean Equinox of date")
+
+            .value(
+                "TEMEOfEpoch",
+                SGP4::OutputFrame::TEMEOfEpoch,
+                "True Equator Mean Equinox of the TLE epoch (no frame conversion)"
+            )
+
+            ;
+
+        sgp4_class
+
             .def(
-                init<TLE>(),
+                init<const TLE&, const SGP4::OutputFrame&>(),
                 R"doc(
                     Constructor.
 
                     Args:
                         tle (TLE): The TLE.
+                        output_frame (SGP4.OutputFrame): The output frame. Defaults to GCRF; TEMEOfEpoch skips the frame conversion.
 
                 )doc",
-                arg("tle")
+                arg("tle"),
+                arg("output_frame") = SGP4::OutputFrame::GCRF
             )
 
             .def(
@@ -59,6 +128,18 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_SGP4(pybind11
                 )doc"
             )
 
+            .def(
+                "get_output_frame",
+                &SGP4::getOutputFrame,
+                R"doc(
+                    Get the output frame of the `SGP4` model.
+
+                    Returns:
+                        SGP4.OutputFrame: The output frame.
+
+                )doc"
+            )
+
             .def(
                 "get_epoch",
                 &SGP4::getEpoch,
@@ -115,6 +196,163 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_SGP4(pybind11
                 )doc"
             )
 
+            .def_static(
+                "calculate_catalog_states_at",
+                overload_cast<const Array<TLE>&, const Array<Instant>&, const Size&>(&SGP4::CalculateCatalogStatesAt),
+                call_guard<gil_scoped_release>(),
+                arg("tles"),
+                arg("instants"),
+                arg("thread_count") = 0,
+                R"doc(
+                    Calculate the states of a catalog of TLEs over an instant grid. Each TLE is parsed once and evaluated in a tight loop, satellites being distributed over a pool of worker threads. Evaluations that fail (e.g. decayed satellites) are filled with NaN.
+
+                    Args:
+                        tles (list[TLE]): The TLEs.
+                        instants (list[Instant]): The instants.
+                        thread_count (int): The worker thread count (0 defaults to the default thread count of ExecutionContext).
+
+                    Returns:
+                        numpy.ndarray: A 6 x (instant count x TLE count) array of GCRF positions [m] and velocities [m/s], grouped by instant.
+
+                )doc"
+            )
+            .def_static(
+                "calculate_catalog_states_at",
+                overload_cast<const Array<TLE>&, const Array<Instant>&, const ExecutionContext&>(
+                    &SGP4::CalculateCatalogStatesAt
+                ),
+                call_guard<gil_scoped_release>(),
+                arg("tles"),
+                arg("instants"),
+                arg("execution_context"),
+                R"doc(
+                    Calculate the states of a catalog of TLEs over an instant grid, within an execution context. Evaluations that fail (e.g. decayed satellites) are filled with NaN.
+
+                    Args:
+                        tles (list[TLE]): The TLEs.
+                        instants (list[Instant]): The instants.
+                        execution_context (ExecutionContext): The execution context.
+
+                    Returns:
+                        numpy.ndarray: A 6 x (instant count x TLE count) array of GCRF positions [m] and velocities [m/s], grouped by instant.
+
+                )doc"
+            )
+
+            .def_static(
+                "propagate_catalog",
+                [](const Array<TLE>& aTleArray, const Array<Instant>& anInstantArray, const Size& aThreadCount) -> tuple
+                {
+                    MatrixXd states;
+
+                    {
+                        gil_scoped_release release;
+
+                        states = SGP4::CalculateCatalogStatesAt(aTleArray, anInstantArray, aThreadCount);
+                    }
+
+                    return OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_SGP4_CatalogArrays(
+                        std::move(states), anInstantArray.getSize(), aTleArray.getSize()
+                    );
+                },
+                arg("tles"),
+                arg("instants"),
+                arg("thread_count") = 0,
+                R"doc(
+                    Propagate a catalog of TLEs over an instant grid, natively and over a pool of worker threads. Evaluations that fail (e.g. decayed satellites) are filled with NaN.
+
+                    Args:
+                        tles (list[TLE]): The TLEs.
+                        instants (list[Instant]): The instants.
+                        thread_count (int): The worker thread count (0 defaults to the default thread count of ExecutionContext).
+
+                    Returns:
+                        tuple[numpy.ndarray, numpy.ndarray]: The GCRF positions [m] and velocities [m/s], as (instant count, TLE count, 3) arrays.
+
+                )doc"
+            )
+            .def_static(
+                "propagate_catalog",
+                [](const std::vector<std::string>& aLineArray,
+                   const Array<Instant>& anInstantArray,
+                   const Size& aThreadCount) -> tuple
+                {
+                    MatrixXd states;
+                    Size tleCount = 0;
+
+                    {
+                        gil_scoped_release release;
+
+                        std::string catalog;
+
+                        for (const std::string& line : aLineArray)
+                        {
+                            catalog.append(line).append(1, '\n');
+                        }
+
+                        const Array<TLE> tles = TLE::ParseCatalog(String(catalog), aThreadCount);
+
+                        states = SGP4::CalculateCatalogStatesAt(tles, anInstantArray, aThreadCount);
+                        tleCount = tles.getSize();
+                    }
+
+                    return OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_SGP4_CatalogArrays(
+                        std::move(states), anInstantArray.getSize(), tleCount
+                    );
+                },
+                arg("lines"),
+                arg("instants"),
+                arg("thread_count") = 0,
+                R"doc(
+                    Parse a catalog of TLEs from its lines, and propagate it over an instant grid, natively and over a pool of worker threads. No TLE object is created in Python.
+
+                    Args:
+                        lines (list[str]): The catalog lines, each TLE being made of two element lines, optionally preceded by a satellite name line.
+                        instants (list[Instant]): The instants.
+                        thread_count (int): The worker thread count (0 defaults to the default thread count of ExecutionContext).
+
+                    Returns:
+                        tuple[numpy.ndarray, numpy.ndarray]: The GCRF positions [m] and velocities [m/s], as (instant count, TLE count, 3) arrays, in the order of the lines.
+
+                )doc"
+            )
+            .def_static(
+                "propagate_catalog",
+                [](const File& aFile, const Array<Instant>& anInstantArray, const Size& aThreadCount) -> tuple
+                {
+                    MatrixXd states;
+                    Size tleCount = 0;
+
+                    {
+                        gil_scoped_release release;
+
+                        const Array<TLE> tles = TLE::LoadCatalog(aFile, aThreadCount);
+
+                        states = SGP4::CalculateCatalogStatesAt(tles, anInstantArray, aThreadCount);
+                        tleCount = tles.getSize();
+                    }
+
+                    return OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_SGP4_CatalogArrays(
+                        std::move(states), anInstantArray.getSize(), tleCount
+                    );
+                },
+                arg("file"),
+                arg("instants"),
+                arg("thread_count") = 0,
+                R"doc(
+                    Load a catalog of TLEs from a file, and propagate it over an instant grid, natively and over a pool of worker threads. No TLE object is created in Python.
+
+                    Args:
+                        file (File): The catalog file.
+                        instants (list[Instant]): The instants.
+                        thread_count (int): The worker thread count (0 defaults to the default thread count of ExecutionContext).
+
+                    Returns:
+                        tuple[numpy.ndarray, numpy.ndarray]: The GCRF positions [m] and velocities [m/s], as (instant count, TLE count, 3) arrays, in the order of the file.
+
+                )doc"
+            )
+
             ;
     }
 
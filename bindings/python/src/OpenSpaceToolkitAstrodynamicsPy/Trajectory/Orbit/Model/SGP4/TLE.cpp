@@ -6,14 +6,17 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_SGP4_TLE(pybi
 {
     using namespace pybind11;
 
+    using ostk::core::filesystem::File;
     using ostk::core::type::Integer;
     using ostk::core::type::Real;
+    using ostk::core::type::Size;
     using ostk::core::type::String;
 
     using ostk::physics::time::Instant;
     using ostk::physics::unit::Angle;
     using ostk::physics::unit::Derived;
 
+    using ostk::astrodynamics::ExecutionContext;
     using ostk::astrodynamics::trajectory::orbit::model::sgp4::TLE;
 
     class_<TLE>(
@@ -66,6 +69,22 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_SGP4_TLE(pybi
         .def("__str__", &(shiftToString<TLE>))
         .def("__repr__", &(shiftToString<TLE>))
 
+        .def(pickle(
+            [](const TLE& aTLE) -> tuple
+            {
+                return make_tuple(aTLE.getSatelliteName(), aTLE.getFirstLine(), aTLE.getSecondLine());
+            },
+            [](const tuple& aState) -> TLE
+            {
+                if (aState.size() != 3)
+                {
+                    throw value_error("Invalid TLE pickle state.");
+                }
+
+                return {aState[0].cast<String>(), aState[1].cast<String>(), aState[2].cast<String>()};
+            }
+        ))
+
         .def(
             "is_defined",
             &TLE::isDefined,
@@ -410,6 +429,106 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_SGP4_TLE(pybi
             )doc"
         )
 
+        .def_static(
+            "parse_catalog",
+            overload_cast<const String&, const Size&>(&TLE::ParseCatalog),
+            call_guard<gil_scoped_release>(),
+            arg("string"),
+            arg("thread_count") = 0,
+            R"doc(
+                Parse a catalog of TLEs from a string. Each TLE is made of two element lines, optionally preceded by a satellite name line.
+
+                Args:
+                    string (str): The string to parse.
+                    thread_count (int): The worker thread count (0 defaults to the default thread count of ExecutionContext).
+
+                Returns:
+                    list[TLE]: The parsed TLEs, in the order of the string.
+            )doc"
+        )
+        .def_static(
+            "parse_catalog",
+            overload_cast<const String&, const ExecutionContext&>(&TLE::ParseCatalog),
+            call_guard<gil_scoped_release>(),
+            arg("string"),
+            arg("execution_context"),
+            R"doc(
+                Parse a catalog of TLEs from a string, within an execution context.
+
+                Args:
+                    string (str): The string to parse.
+                    execution_context (ExecutionContext): The execution context.
+
+                Returns:
+                    list[TLE]: The parsed TLEs, in the order of the string.
+            )doc"
+        )
+
+        .def_static(
+            "load_catalog",
+            overload_cast<const File&, const Size&>(&TLE::LoadCatalog),
+            call_guard<gil_scoped_release>(),
+            arg("file"),
+            arg("thread_count") = 0,
+            R"doc(
+                Load a catalog of TLEs from a file. Each TLE is made of two element lines, optionally preceded by a satellite name line.
+
+                Args:
+                    file (File): The file.
+                    thread_count (int): The worker thread count (0 defaults to the default thread count of ExecutionContext).
+
+                Returns:
+                    list[TLE]: The loaded TLEs, in the order of the file.
+            )doc"
+        )
+        .def_static(
+            "load_catalog",
+            overload_cast<const File&, const ExecutionContext&>(&TLE::LoadCatalog),
+            call_guard<gil_scoped_release>(),
+            arg("file"),
+            arg("execution_context"),
+            R"doc(
+                Load a catalog of TLEs from a file, within an execution context.
+
+                Args:
+                    file (File): The file.
+                    execution_context (ExecutionContext): The execution context.
+
+                Returns:
+                    list[TLE]: The loaded TLEs, in the order of the file.
+            )doc"
+        )
+
+        .def_static(
+            "save_catalog_snapshot",
+            &TLE::SaveCatalogSnapshot,
+            arg("tles"),
+            arg("file"),
+            R"doc(
+                Save a catalog of TLEs to a binary snapshot file, made of a versioned header followed by fixed size records.
+
+                Args:
+                    tles (list[TLE]): The TLEs.
+                    file (File): The file.
+            )doc"
+        )
+
+        .def_static(
+            "load_catalog_snapshot",
+            &TLE::LoadCatalogSnapshot,
+            call_guard<gil_scoped_release>(),
+            arg("file"),
+            R"doc(
+                Load a catalog of TLEs from a binary snapshot file. Records are not parsed nor validated again.
+
+                Args:
+                    file (File): The file.
+
+                Returns:
+                    list[TLE]: The TLEs, in the order they were saved.
+            )doc"
+        )
+
         .def_static(
             "construct",
             overload_cast<
@@ -0,0 +1,147 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/SemiAnalytical.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_SemiAnalytical(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::container::Array;
+    using ostk::core::type::Integer;
+    using ostk::core::type::Shared;
+
+    using ostk::physics::time::Duration;
+    using ostk::physics::unit::Derived;
+
+    using ostk::astrodynamics::Dynamics;
+    using ostk::astrodynamics::trajectory::orbit::model::SemiAnalytical;
+    using ostk::astrodynamics::trajectory::State;
+
+    class_<SemiAnalytical, ostk::astrodynamics::trajectory::orbit::Model>(
+        aModule,
+        "SemiAnalytical",
+        R"doc(
+            An orbit model propagating averaged (mean) equinoctial elements, for long-term studies.
+
+            Mean element rates are the Gauss variational equations of the perturbing accelerations, averaged over one
+            revolution, and integrated over steps of hours. Computed states are mean states: the short periodic terms
+            are not recovered.
+
+        )doc"
+    )
+
+        .def(
+            init<const State&, const Array<Shared<Dynamics>>&, const Derived&, const Duration&, const Integer&>(),
+            R"doc(
+                Constructor.
+
+                Args:
+                    state (State): The initial (osculating) state, of an elliptical orbit.
+                    dynamics (list[Dynamics]): The dynamics, including the central body gravity.
+                    gravitational_parameter (Derived): The gravitational parameter of the central body.
+                    step_duration (Duration, optional): The integration step duration. Defaults to 6 hours.
+                    initial_revolution_number (int, optional): The initial revolution number. Defaults to 1.
+
+            )doc",
+            arg("state"),
+            arg("dynamics"),
+            arg("gravitational_parameter"),
+            arg("step_duration") = Duration::Hours(6.0),
+            arg("initial_revolution_number") = 1
+        )
+
+        .def(self == self)
+        .def(self != self)
+
+        .def("__str__", &(shiftToString<SemiAnalytical>))
+        .def("__repr__", &(shiftToString<SemiAnalytical>))
+
+        .def(
+            "is_defined",
+            &SemiAnalytical::isDefined,
+            R"doc(
+                Check if the `SemiAnalytical` model is defined.
+
+                Returns:
+                    bool: True if the `SemiAnalytical` model is defined, False otherwise.
+
+            )doc"
+        )
+        .def(
+            "get_initial_state",
+            &SemiAnalytical::accessInitialState,
+            R"doc(
+                Get the initial state.
+
+                Returns:
+                    State: The initial state.
+
+            )doc"
+        )
+        .def(
+            "get_dynamics",
+            &SemiAnalytical::getDynamics,
+            R"doc(
+                Get the dynamics.
+
+                Returns:
+                    list[Dynamics]: The dynamics.
+
+            )doc"
+        )
+        .def(
+            "get_gravitational_parameter",
+            &SemiAnalytical::getGravitationalParameter,
+            R"doc(
+                Get the gravitational parameter.
+
+                Returns:
+                    Derived: The gravitational parameter.
+
+            )doc"
+        )
+        .def(
+            "get_step_duration",
+            &SemiAnalytical::getStepDuration,
+            R"doc(
+                Get the integration step duration.
+
+                Returns:
+                    Duration: The step duration.
+
+            )doc"
+        )
+        .def(
+            "calculate_mean_elements_at",
+            &SemiAnalytical::calculateMeanElementsAt,
+            R"doc(
+                Calculate the mean equinoctial elements at an instant.
+
+                Args:
+                    instant (Instant): The instant.
+
+                Returns:
+                    np.ndarray: The mean elements (a [m], h, k, p, q, lambda [rad]), with a continuous mean longitude.
+
+            )doc",
+            arg("instant")
+        )
+        .def(
+            "calculate_states_at",
+            &SemiAnalytical::calculateStatesAt,
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Calculate the (mean) states at given instants.
+
+                Args:
+                    instants (list[Instant]): The instants.
+
+                Returns:
+                    list[State]: The states, in the frame of the initial state.
+
+            )doc",
+            arg("instants")
+        )
+
+        ;
+}
@@ -1,16 +1,111 @@
 /// Apache License 2.0
 
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Tabulated.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/AngularVelocity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/AttitudeQuaternion.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianPosition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianVelocity.hpp>
+
+#include <OpenSpaceToolkitAstrodynamicsPy/Utility/DateTime64.hpp>
 
 using namespace pybind11;
 
 using ostk::core::container::Array;
 using ostk::core::type::Integer;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+using ostk::core::type::String;
 
 using ostk::mathematics::curvefitting::Interpolator;
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::VectorXd;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::unit::Length;
+
+using ostk::astrodynamics::trajectory::Propagator;
 
 using ostk::astrodynamics::trajectory::orbit::model::Tabulated;
 using ostk::astrodynamics::trajectory::State;
+using ostk::astrodynamics::trajectory::state::CoordinateBroker;
+using ostk::astrodynamics::trajectory::state::CoordinateSubset;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::AngularVelocity;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::AttitudeQuaternion;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianPosition;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianVelocity;
+
+inline Tabulated OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_Tabulated_FromArrays(
+    const Instant& anEpoch,
+    const array_t<double, array::c_style | array::forcecast>& aTimestampArray,
+    const array_t<double, array::c_style | array::forcecast>& aCoordinateArray,
+    const Shared<const Frame>& aFrameSPtr,
+    const Shared<const CoordinateBroker>& aCoordinateBrokerSPtr,
+    const Integer& anInitialRevolutionNumber,
+    const Interpolator::Type& anInterpolationType
+)
+{
+    if ((aTimestampArray.ndim() != 1) || (aCoordinateArray.ndim() != 2))
+    {
+        throw value_error("Timestamps must be a 1D array, and coordinates a 2D array.");
+    }
+
+    const Shared<const CoordinateBroker> coordinateBrokerSPtr =
+        (aCoordinateBrokerSPtr != nullptr)
+            ? aCoordinateBrokerSPtr
+            : std::make_shared<CoordinateBroker>(
+                  CoordinateBroker({CartesianPosition::Default(), CartesianVelocity::Default()})
+              );
+
+    // The arrays (or their contiguous float64 conversions) are referenced by the model, and released with the GIL held
+
+    const Shared<const void> storageSPtr(
+        new tuple(make_tuple(aTimestampArray, aCoordinateArray)),
+        [](const tuple* aTuplePtr)
+        {
+            gil_scoped_acquire acquire;
+
+            delete aTuplePtr;
+        }
+    );
+
+    return {
+        anEpoch,
+        Eigen::Map<const VectorXd>(aTimestampArray.data(), aTimestampArray.shape(0)),
+        Eigen::Map<const Tabulated::RowMajorMatrixXd>(
+            aCoordinateArray.data(), aCoordinateArray.shape(0), aCoordinateArray.shape(1)
+        ),
+        aFrameSPtr,
+        coordinateBrokerSPtr,
+        anInitialRevolutionNumber,
+        anInterpolationType,
+        storageSPtr,
+    };
+}
+
+inline Shared<const Frame> OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_Tabulated_FrameWithName(
+    const String& aFrameName
+)
+{
+    // Static frames are registered when first accessed, which may not have happened yet in an unpickling process
+
+    for (const auto& frameSPtr : {Frame::GCRF(), Frame::ITRF(), Frame::TEME(), Frame::CIRF(), Frame::TIRF()})
+    {
+        if (frameSPtr->getName() == aFrameName)
+        {
+            return frameSPtr;
+        }
+    }
+
+    if (Frame::Exists(aFrameName))
+    {
+        return Frame::WithName(aFrameName);
+    }
+
+    throw value_error(String::Format("Cannot restore frame [{}].", aFrameName));
+}
 
 inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_Tabulated(pybind11::module& aModule)
 {
@@ -39,6 +134,33 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_Tabulated(pyb
             arg("interpolation_type") = DEFAULT_TABULATED_TRAJECTORY_INTERPOLATION_TYPE
         )
 
+        .def(
+            init(&OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_Tabulated_FromArrays),
+            R"doc(
+                Constructor from NumPy arrays of timestamps and coordinates.
+
+                C-contiguous float64 arrays are referenced by the model, without copy, and must not be modified
+                afterwards. Other arrays are converted once.
+
+                Args:
+                    epoch (Instant): The epoch of the timestamps.
+                    timestamps (numpy.ndarray): The timestamps [s since epoch], sorted, as a N array.
+                    coordinates (numpy.ndarray): The coordinates, as a N x M array.
+                    frame (Frame): The frame of the coordinates.
+                    coordinate_broker (CoordinateBroker, optional): The coordinate broker describing the M columns. Defaults to Cartesian position and velocity.
+                    initial_revolution_number (int, optional): The initial revolution number. Defaults to 1.
+                    interpolation_type (Interpolator.Type, optional): The interpolation type.
+
+            )doc",
+            arg("epoch"),
+            arg("timestamps"),
+            arg("coordinates"),
+            arg("frame"),
+            arg("coordinate_broker") = none(),
+            arg("initial_revolution_number") = Integer(1),
+            arg("interpolation_type") = DEFAULT_TABULATED_TRAJECTORY_INTERPOLATION_TYPE
+        )
+
         .def(self == self)
 
         .def(self != self)
@@ -47,6 +169,83 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_Tabulated(pyb
 
         .def("__repr__", &(shiftToString<Tabulated>))
 
+        .def(pickle(
+            [](const object& aTabulatedObject) -> tuple
+            {
+                const Tabulated& tabulated = aTabulatedObject.cast<const Tabulated&>();
+
+                const State firstState = tabulated.getFirstState();
+
+                list subsets;
+
+                for (const auto& subsetSPtr : firstState.accessCoordinateBroker()->getSubsets())
+                {
+                    subsets.append(make_tuple(std::string(subsetSPtr->getName()), subsetSPtr->getSize()));
+                }
+
+                // Timestamps and coordinates are pickled as NumPy arrays: with pickle protocol 5, they can be
+                // transferred out-of-band, e.g. through shared memory
+
+                return make_tuple(
+                    DateTime64FromInstant(tabulated.getTableEpoch()),
+                    aTabulatedObject.attr("get_timestamps")(),
+                    aTabulatedObject.attr("get_coordinates")(),
+                    std::string(firstState.accessFrame()->getName()),
+                    subsets,
+                    int(tabulated.getRevolutionNumberAtEpoch()),
+                    int(tabulated.getInterpolationType())
+                );
+            },
+            [](const tuple& aState) -> Tabulated
+            {
+                if (aState.size() != 7)
+                {
+                    throw value_error("Invalid Tabulated pickle state.");
+                }
+
+                Array<Shared<const CoordinateSubset>> subsets = Array<Shared<const CoordinateSubset>>::Empty();
+
+                for (const handle& subsetHandle : aState[4].cast<list>())
+                {
+                    const String name = subsetHandle.cast<tuple>()[0].cast<std::string>();
+                    const Size size = subsetHandle.cast<tuple>()[1].cast<Size>();
+
+                    // Subsets are identified by name and size, and the subsets with dedicated behavior (e.g. frame
+                    // transformations) are restored as such
+
+                    Shared<const CoordinateSubset> subsetSPtr = std::make_shared<CoordinateSubset>(name, size);
+
+                    for (const Shared<const CoordinateSubset>& defaultSubsetSPtr :
+                         Array<Shared<const CoordinateSubset>>({
+                             CartesianPosition::Default(),
+                             CartesianVelocity::Default(),
+                             AngularVelocity::Default(),
+                             AttitudeQuaternion::Default(),
+                         }))
+                    {
+                        if (*defaultSubsetSPtr == *subsetSPtr)
+                        {
+                            subsetSPtr = defaultSubsetSPtr;
+                        }
+                    }
+
+                    subsets.add(subsetSPtr);
+                }
+
+                return OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_Tabulated_FromArrays(
+                    InstantFromDateTime64(aState[0].cast<std::int64_t>()),
+                    aState[1].cast<array_t<double, array::c_style | array::forcecast>>(),
+                    aState[2].cast<array_t<double, array::c_style | array::forcecast>>(),
+                    OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_Tabulated_FrameWithName(
+                        aState[3].cast<std::string>()
+                    ),
+                    std::make_shared<CoordinateBroker>(subsets),
+                    Integer(aState[5].cast<int>()),
+                    Interpolator::Type(aState[6].cast<int>())
+                );
+            }
+        ))
+
         .def(
             "is_defined",
             &Tabulated::isDefined,
@@ -95,6 +294,71 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_Tabulated(pyb
             )doc"
         )
 
+        .def(
+            "get_table_epoch",
+            &Tabulated::getTableEpoch,
+            R"doc(
+                Get the epoch of the timestamps of the `Tabulated` model.
+
+                Returns:
+                    Instant: The epoch of the timestamps.
+
+            )doc"
+        )
+
+        .def(
+            "get_timestamps",
+            [](const object& aTabulatedObject) -> array_t<double>
+            {
+                const Eigen::Map<const VectorXd> timestamps =
+                    aTabulatedObject.cast<const Tabulated&>().accessTimestamps();
+
+                array_t<double> timestampArray(
+                    {timestamps.size()}, {Eigen::Index(sizeof(double))}, timestamps.data(), aTabulatedObject
+                );
+                timestampArray.attr("setflags")(arg("write") = false);
+
+                return timestampArray;
+            },
+            R"doc(
+                Get the timestamps of the `Tabulated` model.
+
+                The array is a read-only view on the storage of the model, which it keeps alive.
+
+                Returns:
+                    numpy.ndarray: The timestamps [s since the timestamps epoch].
+
+            )doc"
+        )
+
+        .def(
+            "get_coordinates",
+            [](const object& aTabulatedObject) -> array_t<double>
+            {
+                const Eigen::Map<const Tabulated::RowMajorMatrixXd> coordinates =
+                    aTabulatedObject.cast<const Tabulated&>().accessCoordinates();
+
+                array_t<double> coordinateArray(
+                    {coordinates.rows(), coordinates.cols()},
+                    {coordinates.cols() * Eigen::Index(sizeof(double)), Eigen::Index(sizeof(double))},
+                    coordinates.data(),
+                    aTabulatedObject
+                );
+                coordinateArray.attr("setflags")(arg("write") = false);
+
+                return coordinateArray;
+            },
+            R"doc(
+                Get the coordinates of the `Tabulated` model.
+
+                The array is a read-only view on the storage of the model, which it keeps alive.
+
+                Returns:
+                    numpy.ndarray: The coordinates, as a N x M array.
+
+            )doc"
+        )
+
         .def(
             "get_interpolation_type",
             &Tabulated::getInterpolationType,
@@ -139,6 +403,23 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_Tabulated(pyb
             arg("instants")
         )
 
+        .def(
+            "calculate_state_table_at",
+            &Tabulated::calculateStateTableAt,
+            R"doc(
+                Calculate a state table of the `Tabulated` model at given instants, without building intermediate
+                states.
+
+                Args:
+                    instants (list[Instant]): The instants.
+
+                Returns:
+                    StateTable: The state table.
+
+            )doc",
+            arg("instants")
+        )
+
         .def(
             "calculate_revolution_number_at",
             &Tabulated::calculateRevolutionNumberAt,
@@ -155,5 +436,60 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Orbit_Model_Tabulated(pyb
             arg("instant")
         )
 
+        .def_static(
+            "sample",
+            [](const Propagator& aPropagator,
+               const State& aState,
+               const Interval& anInterval,
+               const Length& aPositionTolerance,
+               const Integer& anInitialRevolutionNumber,
+               const Interpolator::Type& anInterpolationType,
+               const Duration& aMaximumStepDuration) -> Tabulated
+            {
+                gil_scoped_release release;
+
+                const ostk::astrodynamics::trajectory::model::Tabulated tabulated = Tabulated::Sample(
+                    aPropagator, aState, anInterval, aPositionTolerance, anInterpolationType, aMaximumStepDuration
+                );
+
+                return {
+                    tabulated.getTableEpoch(),
+                    VectorXd(tabulated.accessTimestamps()),
+                    MatrixXd(tabulated.accessCoordinates()),
+                    aState.accessFrame(),
+                    aState.accessCoordinateBroker(),
+                    anInitialRevolutionNumber,
+                    anInterpolationType,
+                };
+            },
+            R"doc(
+                Sample the output of a propagator, at instants chosen for the interpolation to meet a tolerance.
+
+                Sampling starts from a uniform grid of the maximum step duration, and steps whose interpolated position
+                in the middle exceeds the position tolerance are halved, until all the steps meet it. Samples are hence
+                dense where the trajectory is hard to interpolate (maneuvers, perigee passes) and sparse elsewhere.
+
+                Args:
+                    propagator (Propagator): The propagator.
+                    state (State): The initial state, the model is in its frame.
+                    interval (Interval): The interval, of strictly positive duration.
+                    position_tolerance (Length): The strictly positive position tolerance.
+                    initial_revolution_number (int, optional): The initial revolution number. Defaults to 1.
+                    interpolation_type (Interpolator.Type, optional): The interpolation type.
+                    maximum_step_duration (Duration, optional): The maximum duration between samples. Defaults to 10 minutes.
+
+                Returns:
+                    Tabulated: The tabulated model.
+
+            )doc",
+            arg("propagator"),
+            arg("state"),
+            arg("interval"),
+            arg("position_tolerance"),
+            arg("initial_revolution_number") = Integer(1),
+            arg("interpolation_type") = DEFAULT_TABULATED_TRAJECTORY_INTERPOLATION_TYPE,
+            arg_v("maximum_step_duration", Duration::Minutes(10.0), "Duration.minutes(10.0)")
+        )
+
         ;
 }
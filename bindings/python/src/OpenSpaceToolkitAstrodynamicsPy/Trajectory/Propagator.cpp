@@ -1,25 +1,40 @@
 /// Apache License 2.0
 
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianPosition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianVelocity.hpp>
 
 inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Propagator(pybind11::module& aModule)
 {
     using namespace pybind11;
 
     using ostk::core::container::Array;
+    using ostk::core::container::Pair;
+    using ostk::core::type::Index;
+    using ostk::core::type::Real;
     using ostk::core::type::Shared;
+    using ostk::core::type::Size;
 
     using ostk::mathematics::curvefitting::Interpolator;
+    using ostk::mathematics::object::MatrixXd;
+    using ostk::mathematics::object::VectorXd;
 
+    using ostk::physics::coordinate::Frame;
     using ostk::physics::Environment;
+    using ostk::physics::time::Duration;
     using ostk::physics::time::Instant;
 
     using ostk::astrodynamics::Dynamics;
     using ostk::astrodynamics::EventCondition;
+    using ostk::astrodynamics::ExecutionContext;
     using ostk::astrodynamics::flight::Maneuver;
     using ostk::astrodynamics::flight::system::SatelliteSystem;
     using ostk::astrodynamics::trajectory::Propagator;
     using ostk::astrodynamics::trajectory::State;
+    using ostk::astrodynamics::trajectory::state::CoordinateBroker;
+    using ostk::astrodynamics::trajectory::state::CoordinateSubset;
+    using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianPosition;
+    using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianVelocity;
     using ostk::astrodynamics::trajectory::state::NumericalSolver;
 
     class_<Propagator>(
@@ -101,6 +116,88 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Propagator(pybind11::modu
 
             )doc"
         )
+        .def(
+            "get_statistics",
+            &Propagator::getStatistics,
+            R"doc(
+                Get the integration statistics of the numerical solver.
+
+                Statistics are enabled on the numerical solver before constructing the propagator, and are shared by the
+                numerical solver, the propagator and its copies.
+
+                Returns:
+                    NumericalSolver.Statistics: The integration statistics.
+
+            )doc"
+        )
+
+        .def(
+            "is_dynamics_timing_enabled",
+            &Propagator::isDynamicsTimingEnabled,
+            R"doc(
+                Check if dynamics timing is enabled.
+
+                Returns:
+                    bool: True if dynamics timing is enabled.
+
+            )doc"
+        )
+        .def(
+            "get_dynamics_timings",
+            [](Propagator& aPropagator, const bool reset) -> dict
+            {
+                dict timings;
+
+                for (const auto& nameAndTiming : aPropagator.getDynamicsTimings())
+                {
+                    timings[cast(nameAndTiming.first)] = nameAndTiming.second;
+                }
+
+                if (reset)
+                {
+                    aPropagator.resetDynamicsTiming();
+                }
+
+                return timings;
+            },
+            R"doc(
+                Get the evaluation timings of the dynamics, keyed by dynamics name.
+
+                Timings of dynamics sharing a name are summed. Timers are shared by the propagator and its copies.
+
+                Args:
+                    reset (bool, optional): Whether to reset the timings after reading them. Defaults to False.
+
+                Returns:
+                    dict[str, Dynamics.Timing]: The dynamics timings.
+
+            )doc",
+            arg("reset") = false
+        )
+        .def(
+            "enable_dynamics_timing",
+            &Propagator::enableDynamicsTiming,
+            R"doc(
+                Enable dynamics timing, recording the call count and evaluation time of each dynamics.
+
+            )doc"
+        )
+        .def(
+            "disable_dynamics_timing",
+            &Propagator::disableDynamicsTiming,
+            R"doc(
+                Disable dynamics timing.
+
+            )doc"
+        )
+        .def(
+            "reset_dynamics_timing",
+            &Propagator::resetDynamicsTiming,
+            R"doc(
+                Reset dynamics timings.
+
+            )doc"
+        )
 
         .def(
             "get_number_of_coordinates",
@@ -174,7 +271,12 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Propagator(pybind11::modu
 
         .def(
             "calculate_state_at",
-            &Propagator::calculateStateAt,
+            [](const Propagator& aPropagator, const State& aState, const Instant& anInstant) -> State
+            {
+                gil_scoped_release release;
+
+                return aPropagator.calculateStateAt(aState, anInstant);
+            },
             arg("state"),
             arg("instant"),
             R"doc(
@@ -189,15 +291,112 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Propagator(pybind11::modu
 
             )doc"
         )
+        .def(
+            "calculate_state_and_state_transition_matrix_at",
+            [](const Propagator& aPropagator, const State& aState, const Instant& anInstant) -> Pair<State, MatrixXd>
+            {
+                gil_scoped_release release;
+
+                return aPropagator.calculateStateAndStateTransitionMatrixAt(aState, anInstant);
+            },
+            arg("state"),
+            arg("instant"),
+            R"doc(
+                Calculate the state and the state transition matrix at a given instant.
+
+                The state transition matrix follows the structure of the propagator coordinate subsets, and is
+                expressed in the integration frame (GCRF).
+
+                Args:
+                    state (State) The state.
+                    instant (Instant) The instant.
+
+                Returns:
+                    tuple[State, numpy.ndarray]: The state and the state transition matrix at the given instant.
+
+            )doc"
+        )
+        .def(
+            "calculate_states_and_state_transition_matrices_at",
+            [](const Propagator& aPropagator,
+               const State& aState,
+               const Array<Instant>& anInstantArray) -> Array<Pair<State, MatrixXd>>
+            {
+                gil_scoped_release release;
+
+                return aPropagator.calculateStatesAndStateTransitionMatricesAt(aState, anInstantArray);
+            },
+            arg("state"),
+            arg("instants"),
+            R"doc(
+                Calculate the states and the state transition matrices at given instants, from a single integration
+                pass.
+
+                State transition matrices follow the structure of the propagator coordinate subsets, and are expressed
+                in the integration frame (GCRF).
+
+                Args:
+                    state (State) The initial state.
+                    instants (list[Instant]) The instants, sorted.
+
+                Returns:
+                    list[tuple[State, numpy.ndarray]]: The states and the state transition matrices at the given
+                    instants.
+
+            )doc"
+        )
+        .def(
+            "calculate_states_and_covariances_at",
+            [](const Propagator& aPropagator,
+               const State& aState,
+               const MatrixXd& aCovariance,
+               const Array<Instant>& anInstantArray) -> Array<Pair<State, MatrixXd>>
+            {
+                gil_scoped_release release;
+
+                return aPropagator.calculateStatesAndCovariancesAt(aState, aCovariance, anInstantArray);
+            },
+            arg("state"),
+            arg("covariance"),
+            arg("instants"),
+            R"doc(
+                Calculate the states and the covariances at given instants, from a single integration pass.
+
+                The initial covariance is mapped through the state transition matrix at each instant. Covariances
+                follow the structure of the propagator coordinate subsets, and are expressed in the integration frame
+                (GCRF).
+
+                Args:
+                    state (State) The initial state.
+                    covariance (numpy.ndarray) The initial covariance.
+                    instants (list[Instant]) The instants, sorted.
+
+                Returns:
+                    list[tuple[State, numpy.ndarray]]: The states and the covariances at the given instants.
+
+            )doc"
+        )
         .def(
             "calculate_state_to_condition",
-            &Propagator::calculateStateToCondition,
+            [](const Propagator& aPropagator,
+               const State& aState,
+               const Instant& anInstant,
+               const EventCondition& anEventCondition) -> NumericalSolver::ConditionSolution
+            {
+                // Called on the propagator itself, whose numerical solver keeps the observed states of the call
+
+                gil_scoped_release release;
+
+                return aPropagator.calculateStateToCondition(aState, anInstant, anEventCondition);
+            },
             arg("state"),
             arg("instant"),
             arg("event_condition"),
             R"doc(
                 Calculate the state up to a given event condition.
 
+                The GIL is released during the propagation. The event condition is evaluated in place, hence must not be shared with concurrent calls.
+
                 Args:
                     state (State) The state.
                     instant (Instant) The instant.
@@ -209,9 +408,48 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Propagator(pybind11::modu
             )doc"
         )
 
+        .def(
+            "calculate_state_and_events_at",
+            [](const Propagator& aPropagator,
+               const State& aState,
+               const Instant& anInstant,
+               const Array<Shared<EventCondition>>& anEventConditionArray) -> NumericalSolver::EventsSolution
+            {
+                // Called on the propagator itself, whose numerical solver keeps the observed states of the call
+
+                gil_scoped_release release;
+
+                return aPropagator.calculateStateAndEventsAt(aState, anInstant, anEventConditionArray);
+            },
+            arg("state"),
+            arg("instant"),
+            arg("event_conditions"),
+            R"doc(
+                Calculate the state at a given instant, recording every occurrence of a set of event conditions.
+
+                Conditions do not stop the propagation, and are all detected in a single pass. The GIL is released
+                during the propagation. Event conditions are evaluated in place, hence must not be shared with
+                concurrent calls.
+
+                Args:
+                    state (State): The state.
+                    instant (Instant): The instant.
+                    event_conditions (list[EventCondition]): The event conditions.
+
+                Returns:
+                    NumericalSolver.EventsSolution: The final state and the event occurrences, in integration order.
+
+            )doc"
+        )
+
         .def(
             "calculate_states_at",
-            &Propagator::calculateStatesAt,
+            [](const Propagator& aPropagator, const State& aState, const Array<Instant>& anInstantArray) -> Array<State>
+            {
+                gil_scoped_release release;
+
+                return aPropagator.calculateStatesAt(aState, anInstantArray);
+            },
             arg("state"),
             arg("instants"),
             R"doc(
@@ -226,6 +464,270 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Propagator(pybind11::modu
 
             )doc"
         )
+        .def(
+            "calculate_states_at",
+            overload_cast<const Array<State>&, const Instant&, const Size&>(&Propagator::calculateStatesAt, const_),
+            call_guard<gil_scoped_release>(),
+            arg("states"),
+            arg("instant"),
+            arg("thread_count") = 0,
+            R"doc(
+                Calculate the states at a given instant, given initial states. Initial states are propagated in parallel, using a pool of worker threads.
+
+                Args:
+                    states (list[State]) The initial states.
+                    instant (Instant) The instant.
+                Returns:
+                    list[State]: The states at the given instant, in the order of the initial states.
+
+            )doc"
+        )
+        .def(
+            "calculate_states_at",
+            overload_cast<const Array<State>&, const Array<Instant>&, const Size&>(
+                &Propagator::calculateStatesAt, const_
+            ),
+            call_guard<gil_scoped_release>(),
+            arg("states"),
+            arg("instants"),
+            arg("thread_count") = 0,
+            R"doc(
+                Calculate the states at given instants, given initial states. Initial states are propagated in parallel, using a pool of worker threads.
+
+                Args:
+                    states (list[State]) The initial states.
+                    instants (list[Instant]) The instants, sorted.
+                    thread_count (int): The worker thread count. Defaults to 0 (the default thread count of ExecutionContext).
+
+                Returns:
+                    list[list[State]]: The states at the given instants, one list per initial state.
+
+            )doc"
+        )
+        .def(
+            "calculate_states_at",
+            overload_cast<const Array<State>&, const Instant&, const ExecutionContext&>(
+                &Propagator::calculateStatesAt, const_
+            ),
+            call_guard<gil_scoped_release>(),
+            arg("states"),
+            arg("instant"),
+            arg("execution_context"),
+            R"doc(
+                Calculate the states at a given instant, given initial states, propagated within an execution context.
+
+                Args:
+                    states (list[State]) The initial states.
+                    instant (Instant) The instant.
+                    execution_context (ExecutionContext): The execution context.
+
+                Returns:
+                    list[State]: The states at the given instant, in the order of the initial states.
+
+            )doc"
+        )
+        .def(
+            "calculate_states_at",
+            overload_cast<const Array<State>&, const Array<Instant>&, const ExecutionContext&>(
+                &Propagator::calculateStatesAt, const_
+            ),
+            call_guard<gil_scoped_release>(),
+            arg("states"),
+            arg("instants"),
+            arg("execution_context"),
+            R"doc(
+                Calculate the states at given instants, given initial states, propagated within an execution context.
+
+                Args:
+                    states (list[State]) The initial states.
+                    instants (list[Instant]) The instants, sorted.
+                    execution_context (ExecutionContext): The execution context.
+
+                Returns:
+                    list[list[State]]: The states at the given instants, one list per initial state.
+
+            )doc"
+        )
+        .def(
+            "calculate_coordinates_at",
+            [](const Propagator& aPropagator,
+               const MatrixXd& aCoordinateMatrix,
+               const Instant& anEpoch,
+               const Shared<const Frame>& aFrameSPtr,
+               const Array<Instant>& anInstantArray,
+               const Shared<const CoordinateBroker>& aCoordinateBrokerSPtr,
+               const Size& aThreadCount) -> array_t<double>
+            {
+                const Shared<const CoordinateBroker> coordinateBrokerSPtr =
+                    (aCoordinateBrokerSPtr != nullptr)
+                        ? aCoordinateBrokerSPtr
+                        : std::make_shared<CoordinateBroker>(
+                              CoordinateBroker({CartesianPosition::Default(), CartesianVelocity::Default()})
+                          );
+
+                if (aCoordinateMatrix.cols() != Index(coordinateBrokerSPtr->getNumberOfCoordinates()))
+                {
+                    throw value_error("Coordinates must have one column per coordinate of the coordinate broker.");
+                }
+
+                const Size stateCount = aCoordinateMatrix.rows();
+                const Size instantCount = anInstantArray.getSize();
+                const Size coordinateCount = aCoordinateMatrix.cols();
+
+                array_t<double> coordinates({stateCount, instantCount, coordinateCount});
+
+                {
+                    gil_scoped_release release;
+
+                    Array<State> states = Array<State>::Empty();
+                    states.reserve(stateCount);
+
+                    for (Index stateIndex = 0; stateIndex < stateCount; ++stateIndex)
+                    {
+                        states.add({
+                            anEpoch,
+                            VectorXd(aCoordinateMatrix.row(stateIndex).transpose()),
+                            aFrameSPtr,
+                            coordinateBrokerSPtr,
+                        });
+                    }
+
+                    const Array<Array<State>> outputStateArrays =
+                        aPropagator.calculateStatesAt(states, anInstantArray, aThreadCount);
+
+                    const Array<Shared<const CoordinateSubset>> coordinateSubsets =
+                        coordinateBrokerSPtr->getSubsets();
+
+                    auto outputCoordinates = coordinates.mutable_unchecked<3>();
+
+                    for (Index stateIndex = 0; stateIndex < stateCount; ++stateIndex)
+                    {
+                        for (Index instantIndex = 0; instantIndex < instantCount; ++instantIndex)
+                        {
+                            const VectorXd stateCoordinates =
+                                outputStateArrays[stateIndex][instantIndex].extractCoordinates(coordinateSubsets);
+
+                            for (Index coordinateIndex = 0; coordinateIndex < coordinateCount; ++coordinateIndex)
+                            {
+                                outputCoordinates(stateIndex, instantIndex, coordinateIndex) =
+                                    stateCoordinates(coordinateIndex);
+                            }
+                        }
+                    }
+                }
+
+                return coordinates;
+            },
+            arg("coordinates"),
+            arg("epoch"),
+            arg("frame"),
+            arg("instants"),
+            arg("coordinate_broker") = none(),
+            arg("thread_count") = 0,
+            R"doc(
+                Calculate the coordinates at given instants, given an array of initial coordinates sharing an epoch and a frame.
+
+                Initial coordinates are propagated in parallel, using a pool of worker threads, with the GIL released. No `State` object is exchanged with Python.
+
+                Args:
+                    coordinates (numpy.ndarray) The initial coordinates, as a N x M array.
+                    epoch (Instant) The epoch of the initial coordinates.
+                    frame (Frame) The frame of the initial and output coordinates.
+                    instants (list[Instant]) The K output instants, sorted.
+                    coordinate_broker (CoordinateBroker, optional) The coordinate broker describing the M columns. Defaults to Cartesian position and velocity.
+                    thread_count (int): The worker thread count. Defaults to 0 (the default thread count of ExecutionContext).
+
+                Returns:
+                    numpy.ndarray: The coordinates at the given instants, as a N x K x M array.
+
+            )doc"
+        )
+        .def(
+            "calculate_states_at",
+            overload_cast<
+                const State&,
+                const Array<Instant>&,
+                const Propagator&,
+                const Real&,
+                const Size&,
+                const Size&>(&Propagator::calculateStatesAt, const_),
+            call_guard<gil_scoped_release>(),
+            arg("state"),
+            arg("instants"),
+            arg("coarse_propagator"),
+            arg("tolerance") = 1e-3,
+            arg("maximum_iteration_count") = 10,
+            arg("thread_count") = 0,
+            R"doc(
+                Calculate the states at given instants, in parallel in time. Window boundaries are predicted with the coarse propagator, then each window is refined in parallel and corrected (Parareal) until the boundary states converge.
+
+                Args:
+                    state (State) The initial state.
+                    instants (list[Instant]) The instants, sorted and strictly after the initial state instant.
+                    coarse_propagator (Propagator) The coarse propagator.
+                    tolerance (float): The tolerance on the boundary state corrections, in SI units. Defaults to 1e-3.
+                    maximum_iteration_count (int): The maximum correction iteration count. Defaults to 10.
+                    thread_count (int): The worker thread count. Defaults to 0 (the default thread count of ExecutionContext).
+
+                Returns:
+                    list[State]: The states at the given instants.
+
+            )doc"
+        )
+        .def(
+            "calculate_states_at",
+            overload_cast<
+                const State&,
+                const Array<Instant>&,
+                const Propagator&,
+                const Real&,
+                const Size&,
+                const ExecutionContext&>(&Propagator::calculateStatesAt, const_),
+            call_guard<gil_scoped_release>(),
+            arg("state"),
+            arg("instants"),
+            arg("coarse_propagator"),
+            arg("tolerance"),
+            arg("maximum_iteration_count"),
+            arg("execution_context"),
+            R"doc(
+                Calculate the states at given instants, in parallel in time within an execution context.
+
+                Args:
+                    state (State) The initial state.
+                    instants (list[Instant]) The instants, sorted and strictly after the initial state instant.
+                    coarse_propagator (Propagator) The coarse propagator.
+                    tolerance (float): The tolerance on the boundary state corrections, in SI units.
+                    maximum_iteration_count (int): The maximum correction iteration count.
+                    execution_context (ExecutionContext): The execution context.
+
+                Returns:
+                    list[State]: The states at the given instants.
+
+            )doc"
+        )
+        .def(
+            "calculate_ensemble_states_at",
+            [](const Propagator& aPropagator, const Array<State>& aStateArray, const Instant& anInstant) -> Array<State>
+            {
+                gil_scoped_release release;
+
+                return aPropagator.calculateEnsembleStatesAt(aStateArray, anInstant);
+            },
+            arg("states"),
+            arg("instant"),
+            R"doc(
+                Calculate the states at a given instant, given an ensemble of initial states. The ensemble is integrated as a single matrix with shared steps.
+
+                Args:
+                    states (list[State]) The initial states, sharing instant, frame and coordinate subsets.
+                    instant (Instant) The instant.
+
+                Returns:
+                    list[State]: The states at the given instant, in the order of the initial states.
+
+            )doc"
+        )
 
         .def_static(
             "default",
@@ -267,4 +769,72 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Propagator(pybind11::modu
                     Propagator: The propagator.
             )doc"
         );
+
+    class_<Propagator::Session>(
+        aModule.attr("Propagator"),
+        "Session",
+        R"doc(
+            A resumable propagation session, which keeps the stepper state and the last step size across calls.
+
+        )doc"
+    )
+
+        .def(
+            init<const Propagator&, const State&>(),
+            arg("propagator"),
+            arg("state"),
+            R"doc(
+                Construct a new `Session` object.
+
+                Args:
+                    propagator (Propagator) The propagator.
+                    state (State) The initial state.
+
+                Returns:
+                    Session: The new `Session` object.
+
+            )doc"
+        )
+
+        .def(
+            "get_state",
+            &Propagator::Session::accessState,
+            R"doc(
+                Get the current state.
+
+                Returns:
+                    State: The current state.
+
+            )doc"
+        )
+        .def(
+            "advance_to",
+            &Propagator::Session::advanceTo,
+            arg("instant"),
+            R"doc(
+                Advance the session to an instant, not earlier than the current state instant.
+
+                Args:
+                    instant (Instant) The instant.
+
+                Returns:
+                    State: The state at the instant.
+
+            )doc"
+        )
+        .def(
+            "advance_by",
+            &Propagator::Session::advanceBy,
+            arg("duration"),
+            R"doc(
+                Advance the session by a positive duration.
+
+                Args:
+                    duration (Duration) The duration.
+
+                Returns:
+                    State: The state after the duration.
+
+            )doc"
+        );
 }
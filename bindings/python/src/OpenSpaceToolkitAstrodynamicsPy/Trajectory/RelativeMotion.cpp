@@ -0,0 +1,250 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/RelativeMotion.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_RelativeMotion(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::container::Array;
+
+    using ostk::physics::time::Instant;
+    using ostk::physics::unit::Derived;
+
+    using ostk::astrodynamics::trajectory::RelativeMotion;
+    using ostk::astrodynamics::trajectory::State;
+
+    class_<RelativeMotion> relativeMotion(
+        aModule,
+        "RelativeMotion",
+        R"doc(
+            Analytic propagation of the motion of a chaser relative to a target, for proximity operations.
+
+            Relative states are 6-vectors (position [m], velocity [m/s]) of the chaser with respect to the target,
+            expressed in the QSW frame of the target (X axis along the position, Z axis along the orbital momentum),
+            velocities being derivatives in this rotating frame. They are propagated in closed form with the linearized
+            equations of relative motion about the Keplerian orbit of the target.
+
+        )doc"
+    );
+
+    enum_<RelativeMotion::Type>(
+        relativeMotion,
+        "Type",
+        R"doc(
+            Relative motion model type.
+        )doc"
+    )
+
+        .value("Undefined", RelativeMotion::Type::Undefined, "Undefined")
+        .value(
+            "ClohessyWiltshire",
+            RelativeMotion::Type::ClohessyWiltshire,
+            "Clohessy-Wiltshire equations, for circular target orbits"
+        )
+        .value(
+            "YamanakaAnkersen",
+            RelativeMotion::Type::YamanakaAnkersen,
+            "Yamanaka-Ankersen state transition matrix, for elliptical target orbits"
+        )
+
+        ;
+
+    relativeMotion
+
+        .def(
+            init<const State&, const Derived&, const RelativeMotion::Type&>(),
+            arg("target_state"),
+            arg("gravitational_parameter"),
+            arg("type") = RelativeMotion::Type::YamanakaAnkersen,
+            R"doc(
+                Construct a new `RelativeMotion` object.
+
+                Args:
+                    target_state (State): The target state, defining the Keplerian orbit of the target.
+                    gravitational_parameter (Derived): The gravitational parameter.
+                    type (RelativeMotion.Type, optional): The model type. Defaults to YamanakaAnkersen.
+
+                Returns:
+                    RelativeMotion: The new `RelativeMotion` object.
+            )doc"
+        )
+
+        .def(self == self)
+        .def(self != self)
+
+        .def("__str__", &(shiftToString<RelativeMotion>))
+        .def("__repr__", &(shiftToString<RelativeMotion>))
+
+        .def(
+            "is_defined",
+            &RelativeMotion::isDefined,
+            R"doc(
+                Check if the relative motion is defined.
+
+                Returns:
+                    bool: True if the relative motion is defined.
+            )doc"
+        )
+        .def(
+            "get_target_state",
+            &RelativeMotion::accessTargetState,
+            R"doc(
+                Get the target state.
+
+                Returns:
+                    State: The target state, in GCRF.
+            )doc"
+        )
+        .def(
+            "get_gravitational_parameter",
+            &RelativeMotion::getGravitationalParameter,
+            R"doc(
+                Get the gravitational parameter.
+
+                Returns:
+                    Derived: The gravitational parameter.
+            )doc"
+        )
+        .def(
+            "get_type",
+            &RelativeMotion::getType,
+            R"doc(
+                Get the model type.
+
+                Returns:
+                    RelativeMotion.Type: The model type.
+            )doc"
+        )
+        .def(
+            "get_eccentricity",
+            &RelativeMotion::getEccentricity,
+            R"doc(
+                Get the eccentricity of the target orbit.
+
+                Returns:
+                    float: The eccentricity.
+            )doc"
+        )
+        .def(
+            "get_mean_motion",
+            &RelativeMotion::getMeanMotion,
+            R"doc(
+                Get the mean motion of the target orbit.
+
+                Returns:
+                    float: The mean motion [rad/s].
+            )doc"
+        )
+        .def(
+            "calculate_state_transition_matrix",
+            &RelativeMotion::calculateStateTransitionMatrix,
+            R"doc(
+                Calculate the state transition matrix of relative states between two instants.
+
+                Args:
+                    start_instant (Instant): The start instant.
+                    end_instant (Instant): The end instant.
+
+                Returns:
+                    np.ndarray: The state transition matrix (6 x 6).
+            )doc",
+            arg("start_instant"),
+            arg("end_instant")
+        )
+        .def(
+            "calculate_relative_state_at",
+            &RelativeMotion::calculateRelativeStateAt,
+            R"doc(
+                Calculate the relative state at an instant, from a relative state at another instant.
+
+                Args:
+                    relative_state (np.ndarray): The relative state, in the QSW frame of the target.
+                    start_instant (Instant): The instant of the relative state.
+                    instant (Instant): The instant.
+
+                Returns:
+                    np.ndarray: The relative state, in the QSW frame of the target.
+            )doc",
+            arg("relative_state"),
+            arg("start_instant"),
+            arg("instant")
+        )
+        .def(
+            "calculate_relative_states_at",
+            &RelativeMotion::calculateRelativeStatesAt,
+            R"doc(
+                Calculate the relative states at given instants, from a relative state at another instant.
+
+                Args:
+                    relative_state (np.ndarray): The relative state, in the QSW frame of the target.
+                    start_instant (Instant): The instant of the relative state.
+                    instants (list[Instant]): The instants.
+
+                Returns:
+                    np.ndarray: The relative states, one row per instant.
+            )doc",
+            arg("relative_state"),
+            arg("start_instant"),
+            arg("instants")
+        )
+
+        .def_static(
+            "undefined",
+            &RelativeMotion::Undefined,
+            R"doc(
+                Get an undefined relative motion.
+
+                Returns:
+                    RelativeMotion: An undefined relative motion.
+            )doc"
+        )
+        .def_static(
+            "compute_relative_state",
+            &RelativeMotion::ComputeRelativeState,
+            R"doc(
+                Compute the state of a chaser relative to a target, in the QSW frame of the target.
+
+                Args:
+                    target_state (State): The target state.
+                    chaser_state (State): The chaser state, at the same instant.
+
+                Returns:
+                    np.ndarray: The relative state (position [m], velocity [m/s]).
+            )doc",
+            arg("target_state"),
+            arg("chaser_state")
+        )
+        .def_static(
+            "compute_chaser_state",
+            &RelativeMotion::ComputeChaserState,
+            R"doc(
+                Compute the state of a chaser from its state relative to a target.
+
+                Args:
+                    target_state (State): The target state.
+                    relative_state (np.ndarray): The relative state, in the QSW frame of the target.
+
+                Returns:
+                    State: The chaser state, in the frame of the target state.
+            )doc",
+            arg("target_state"),
+            arg("relative_state")
+        )
+        .def_static(
+            "string_from_type",
+            &RelativeMotion::StringFromType,
+            R"doc(
+                Get the string representation of a model type.
+
+                Args:
+                    type (RelativeMotion.Type): The model type.
+
+                Returns:
+                    str: The string representation.
+            )doc",
+            arg("type")
+        )
+
+        ;
+}
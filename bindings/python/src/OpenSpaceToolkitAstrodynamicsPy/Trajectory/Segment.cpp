@@ -7,14 +7,18 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Segment(pybind11::module&
     using namespace pybind11;
 
     using ostk::core::container::Array;
+    using ostk::core::filesystem::File;
+    using ostk::core::type::Real;
     using ostk::core::type::Shared;
     using ostk::core::type::String;
 
+    using ostk::physics::coordinate::Frame;
     using ostk::physics::time::Duration;
 
     using ostk::astrodynamics::Dynamics;
     using ostk::astrodynamics::flight::Maneuver;
     using ostk::astrodynamics::trajectory::Segment;
+    using ostk::astrodynamics::trajectory::State;
     using ostk::astrodynamics::trajectory::state::CoordinateSubset;
     using ostk::astrodynamics::trajectory::state::NumericalSolver;
 
@@ -105,6 +109,25 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Segment(pybind11::module&
                 :type: Type
             )doc"
         )
+        .def_readonly(
+            "integration_statistics",
+            &Segment::Solution::integrationStatistics,
+            R"doc(
+                The integration statistics of the segment, if statistics are enabled on the segment numerical solver.
+
+                :type: NumericalSolver.Statistics
+            )doc"
+        )
+        .def_readonly(
+            "final_time_step",
+            &Segment::Solution::finalTimeStep,
+            R"doc(
+                The step size [s] proposed by the stepper at the end of the segment, to warm-start the next one.
+                Undefined for impulsive maneuver segments.
+
+                :type: Real
+            )doc"
+        )
 
         .def(
             "access_start_instant",
@@ -192,7 +215,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Segment(pybind11::module&
 
         .def(
             "extract_maneuvers",
-            &Segment::Solution::extractManeuvers,
+            overload_cast<const Shared<const Frame>&>(&Segment::Solution::extractManeuvers, const_),
             arg("frame"),
             R"doc(
             Extract maneuvers from the (maneuvering) segment.
@@ -271,6 +294,38 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Segment(pybind11::module&
             )doc"
         )
 
+        .def(
+            "save_snapshot",
+            &Segment::Solution::saveSnapshot,
+            R"doc(
+                Write the solution to a binary snapshot file.
+
+                Dynamics are stored by name, states with their frame and coordinate subsets.
+
+                Args:
+                    file (File): The output file.
+
+            )doc",
+            arg("file")
+        )
+        .def_static(
+            "load_snapshot",
+            &Segment::Solution::LoadSnapshot,
+            R"doc(
+                Load a solution from a binary snapshot file.
+
+                Args:
+                    file (File): The snapshot file.
+                    dynamics (list[Dynamics], optional): Dynamics, matched by name with the stored dynamics. If empty, the solution is loaded without dynamics.
+
+                Returns:
+                    Solution: The solution.
+
+            )doc",
+            arg("file"),
+            arg("dynamics") = Array<Shared<Dynamics>>::Empty()
+        )
+
         ;
 
     enum_<Segment::Type>(
@@ -283,6 +338,174 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Segment(pybind11::module&
 
         .value("Coast", Segment::Type::Coast, "Coast")
         .value("Maneuver", Segment::Type::Maneuver, "Maneuver")
+        .value("ImpulsiveManeuver", Segment::Type::ImpulsiveManeuver, "Impulsive maneuver")
+
+        ;
+
+    class_<Segment::StateRetention> stateRetention(
+        segment,
+        "StateRetention",
+        R"doc(
+            Policy for the states retained in a segment solution. The first and last states of the segment are always retained.
+
+        )doc"
+    );
+
+    enum_<Segment::StateRetention::Type>(
+        stateRetention,
+        "Type",
+        R"doc(
+            State retention type.
+        )doc"
+    )
+
+        .value("All", Segment::StateRetention::Type::All, "Retain all observed states")
+        .value("Endpoints", Segment::StateRetention::Type::Endpoints, "Retain the first and last states only")
+        .value("EveryNthStep", Segment::StateRetention::Type::EveryNthStep, "Retain every N-th observed state")
+        .value(
+            "FixedSpacing",
+            Segment::StateRetention::Type::FixedSpacing,
+            "Retain states spaced by at least a fixed duration"
+        )
+
+        ;
+
+    stateRetention
+
+        .def(
+            "get_type",
+            &Segment::StateRetention::getType,
+            R"doc(
+                Get the type of the state retention.
+
+                Returns:
+                    Type: The type of the state retention.
+
+            )doc"
+        )
+        .def(
+            "get_step_count",
+            &Segment::StateRetention::getStepCount,
+            R"doc(
+                Get the step count, for the every N-th step policy.
+
+                Returns:
+                    int: The step count.
+
+            )doc"
+        )
+        .def(
+            "get_spacing",
+            &Segment::StateRetention::getSpacing,
+            R"doc(
+                Get the spacing, for the fixed spacing policy.
+
+                Returns:
+                    Duration: The spacing.
+
+            )doc"
+        )
+        .def(
+            "apply",
+            &Segment::StateRetention::apply,
+            arg("states"),
+            R"doc(
+                Select the states to retain from chronologically ordered states.
+
+                Args:
+                    states (list[State]): The states.
+
+                Returns:
+                    list[State]: The retained states.
+
+            )doc"
+        )
+
+        .def_static(
+            "all",
+            &Segment::StateRetention::All,
+            R"doc(
+                Retain all observed states.
+
+                Returns:
+                    StateRetention: The state retention.
+
+            )doc"
+        )
+        .def(
+            "get_delta_v",
+            &Segment::getDeltaV,
+            R"doc(
+                Get the delta V of an impulsive maneuver segment, expressed in the local orbital frame.
+
+                Returns:
+                    np.ndarray: The delta V [m/s].
+
+            )doc"
+        )
+        .def(
+            "get_local_orbital_frame_factory",
+            &Segment::getLocalOrbitalFrameFactory,
+            R"doc(
+                Get the local orbital frame factory of an impulsive maneuver segment.
+
+                Returns:
+                    LocalOrbitalFrameFactory: The local orbital frame factory.
+
+            )doc"
+        )
+        .def(
+            "get_specific_impulse",
+            &Segment::getSpecificImpulse,
+            R"doc(
+                Get the specific impulse of an impulsive maneuver segment.
+
+                Returns:
+                    float: The specific impulse [s].
+
+            )doc"
+        )
+        .def_static(
+            "endpoints",
+            &Segment::StateRetention::Endpoints,
+            R"doc(
+                Retain the first and last states only.
+
+                Returns:
+                    StateRetention: The state retention.
+
+            )doc"
+        )
+        .def_static(
+            "every_nth_step",
+            &Segment::StateRetention::EveryNthStep,
+            arg("step_count"),
+            R"doc(
+                Retain every N-th observed state.
+
+                Args:
+                    step_count (int): The step count N, strictly positive.
+
+                Returns:
+                    StateRetention: The state retention.
+
+            )doc"
+        )
+        .def_static(
+            "fixed_spacing",
+            &Segment::StateRetention::FixedSpacing,
+            arg("spacing"),
+            R"doc(
+                Retain states spaced by at least a fixed duration.
+
+                Args:
+                    spacing (Duration): The spacing, strictly positive.
+
+                Returns:
+                    StateRetention: The state retention.
+
+            )doc"
+        )
 
         ;
 
@@ -346,18 +569,39 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Segment(pybind11::module&
 
             )doc"
         )
+        .def(
+            "get_state_retention",
+            &Segment::getStateRetention,
+            R"doc(
+                Get the state retention policy of the segment solutions.
+
+                Returns:
+                    StateRetention: The state retention.
+
+            )doc"
+        )
 
         .def(
             "solve",
-            &Segment::solve,
+            [](const Segment& aSegment,
+               const State& aState,
+               const Duration& aMaximumPropagationDuration,
+               const Real& anInitialTimeStep)
+            {
+                return aSegment.solve(aState, aMaximumPropagationDuration, nullptr, anInitialTimeStep);
+            },
+            call_guard<gil_scoped_release>(),
             arg("state"),
             arg_v("maximum_propagation_duration", Duration::Days(30.0), "Duration.days(30.0)"),
+            arg("initial_time_step") = Real::Undefined(),
             R"doc(
                 Solve the segment.
 
                 Args:
                     state (State): The state.
                     maximum_propagation_duration (Duration, optional): The maximum propagation duration.
+                    initial_time_step (Real, optional): A step size [s] to start the integration with, typically the
+                        final time step of the previous segment solution. Defaults to the configured time step.
 
                 Returns:
                     SegmentSolution: The segment solution.
@@ -372,6 +616,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Segment(pybind11::module&
             arg("event_condition"),
             arg("dynamics"),
             arg("numerical_solver"),
+            arg_v("state_retention", Segment::StateRetention::All(), "Segment.StateRetention.all()"),
             R"doc(
                 Create a coast segment.
 
@@ -380,6 +625,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Segment(pybind11::module&
                     event_condition (EventCondition): The event condition.
                     dynamics (Dynamics): The dynamics.
                     numerical_solver (NumericalSolver): The numerical solver.
+                    state_retention (StateRetention, optional): The state retention policy of the solutions. Defaults to all states.
 
                 Returns:
                     Segment: The coast segment.
@@ -394,6 +640,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Segment(pybind11::module&
             arg("thruster_dynamics"),
             arg("dynamics"),
             arg("numerical_solver"),
+            arg_v("state_retention", Segment::StateRetention::All(), "Segment.StateRetention.all()"),
             R"doc(
                 Create a maneuver segment.
 
@@ -403,11 +650,40 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Segment(pybind11::module&
                     thruster_dynamics (ThrusterDynamics): The thruster dynamics.
                     dynamics (Dynamics): The dynamics.
                     numerical_solver (NumericalSolver): The numerical solver.
+                    state_retention (StateRetention, optional): The state retention policy of the solutions. Defaults to all states.
 
                 Returns:
                     Segment: The maneuver segment.
             )doc"
         )
 
+        .def_static(
+            "impulsive_maneuver",
+            &Segment::ImpulsiveManeuver,
+            arg("name"),
+            arg("delta_v"),
+            arg("local_orbital_frame_factory"),
+            arg("specific_impulse"),
+            arg("dynamics"),
+            arg("numerical_solver"),
+            R"doc(
+                Create an impulsive maneuver segment.
+
+                The delta V is applied instantaneously to the initial state, and the mass is updated with the rocket
+                equation. The solution holds the pre-burn and post-burn states, both at the initial instant.
+
+                Args:
+                    name (str): The name of the segment.
+                    delta_v (np.ndarray): The delta V, expressed in the local orbital frame [m/s].
+                    local_orbital_frame_factory (LocalOrbitalFrameFactory): The local orbital frame factory.
+                    specific_impulse (float): The specific impulse [s].
+                    dynamics (Dynamics): The dynamics.
+                    numerical_solver (NumericalSolver): The numerical solver.
+
+                Returns:
+                    Segment: The impulsive maneuver segment.
+            )doc"
+        )
+
         ;
 }
@@ -1,5 +1,7 @@
 /// Apache License 2.0
 
+#include <pybind11/functional.h>  // To pass anonymous functions directly
+
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Sequence.hpp>
 
 inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Sequence(pybind11::module& aModule)
@@ -7,16 +9,22 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Sequence(pybind11::module
     using namespace pybind11;
 
     using ostk::core::container::Array;
+    using ostk::core::filesystem::File;
     using ostk::core::type::Shared;
     using ostk::core::type::Size;
     using ostk::core::type::String;
 
+    using ostk::mathematics::object::MatrixXd;
+
     using ostk::physics::time::Duration;
+    using ostk::physics::time::Instant;
 
     using ostk::astrodynamics::Dynamics;
+    using ostk::astrodynamics::ExecutionContext;
     using ostk::astrodynamics::flight::system::SatelliteSystem;
     using ostk::astrodynamics::trajectory::Segment;
     using ostk::astrodynamics::trajectory::Sequence;
+    using ostk::astrodynamics::trajectory::State;
     using ostk::astrodynamics::trajectory::state::NumericalSolver;
 
     class_<Sequence> sequence(
@@ -172,7 +180,9 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Sequence(pybind11::module
 
         .def(
             "calculate_states_at",
-            &Sequence::Solution::calculateStatesAt,
+            overload_cast<const Array<Instant>&, const NumericalSolver&>(
+                &Sequence::Solution::calculateStatesAt, const_
+            ),
             R"doc(
                 Calculate states in this sequence's solution at provided instants.
 
@@ -187,6 +197,211 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Sequence(pybind11::module
             arg("numerical_solver")
         )
 
+        .def(
+            "calculate_states_at",
+            overload_cast<const Array<Instant>&, const NumericalSolver&, const ExecutionContext&>(
+                &Sequence::Solution::calculateStatesAt, const_
+            ),
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Calculate states in this sequence's solution at provided instants, resolving segments concurrently.
+
+                The sorted instants are partitioned between segments, and the states of each segment are calculated on their own task.
+
+                Args:
+                    instants (list[Instant]): The sorted instants at which the states will be calculated.
+                    numerical_solver (NumericalSolver): The numerical solver used to calculate the states.
+                    execution_context (ExecutionContext): The execution context.
+
+                Returns:
+                    list[State]: The states at the provided instants.
+                )doc",
+            arg("instants"),
+            arg("numerical_solver"),
+            arg("execution_context")
+        )
+
+        .def(
+            "save_snapshot",
+            &Sequence::Solution::saveSnapshot,
+            R"doc(
+                Write the solution to a binary snapshot file.
+
+                Dynamics are stored by name, states with their frame and coordinate subsets.
+
+                Args:
+                    file (File): The output file.
+
+            )doc",
+            arg("file")
+        )
+        .def_static(
+            "load_snapshot",
+            &Sequence::Solution::LoadSnapshot,
+            R"doc(
+                Load a solution from a binary snapshot file.
+
+                Args:
+                    file (File): The snapshot file.
+                    dynamics (list[Dynamics], optional): Dynamics, matched by name with the stored dynamics. If empty, the solution is loaded without dynamics.
+
+                Returns:
+                    Solution: The solution.
+
+            )doc",
+            arg("file"),
+            arg("dynamics") = Array<Shared<Dynamics>>::Empty()
+        )
+
+        ;
+
+    class_<Sequence::AsyncSolution>(
+        sequence,
+        "AsyncSolution",
+        R"doc(
+            A handle on a `Sequence` solve running in the background.
+
+        )doc"
+    )
+
+        .def(
+            "is_ready",
+            &Sequence::AsyncSolution::isReady,
+            R"doc(
+                Check if the solve is over, i.e. if the solution is available without waiting.
+
+                Returns:
+                    bool: True if the solve is over.
+
+            )doc"
+        )
+        .def(
+            "is_cancelled",
+            &Sequence::AsyncSolution::isCancelled,
+            R"doc(
+                Check if cancellation of the solve has been requested.
+
+                Returns:
+                    bool: True if cancellation has been requested.
+
+            )doc"
+        )
+        .def(
+            "wait",
+            &Sequence::AsyncSolution::wait,
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Wait for the solve to be over.
+
+            )doc"
+        )
+        .def(
+            "get",
+            &Sequence::AsyncSolution::get,
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Get the solution, waiting for the solve to be over.
+
+                A cancelled solve returns the solutions of the segments that completed before cancellation, and is marked as not complete. Errors raised by the solve are re-raised.
+
+                Returns:
+                    SequenceSolution: The sequence solution.
+
+            )doc"
+        )
+        .def(
+            "cancel",
+            &Sequence::AsyncSolution::cancel,
+            R"doc(
+                Request cancellation of the solve. Cancellation is checked between segments and within the integration of each segment, whose partial solution is discarded.
+
+            )doc"
+        )
+
+        ;
+
+    class_<Sequence::TargetingSolution>(
+        sequence,
+        "TargetingSolution",
+        R"doc(
+            The Targeting Solution object that is returned when a targeting problem is solved on a `Sequence`.
+
+        )doc"
+    )
+
+        .def_readonly(
+            "controls",
+            &Sequence::TargetingSolution::controls,
+            R"doc(
+                The control variables of the last iterate.
+
+                :type: np.ndarray
+            )doc"
+        )
+        .def_readonly(
+            "constraints",
+            &Sequence::TargetingSolution::constraints,
+            R"doc(
+                The constraint values at the last iterate.
+
+                :type: np.ndarray
+            )doc"
+        )
+        .def_readonly(
+            "jacobian",
+            &Sequence::TargetingSolution::jacobian,
+            R"doc(
+                The constraint Jacobian with respect to the controls, at the last iterate.
+
+                :type: np.ndarray
+            )doc"
+        )
+        .def_readonly(
+            "solution",
+            &Sequence::TargetingSolution::solution,
+            R"doc(
+                The sequence solution at the last iterate.
+
+                :type: SequenceSolution
+            )doc"
+        )
+        .def_readonly(
+            "iteration_count",
+            &Sequence::TargetingSolution::iterationCount,
+            R"doc(
+                The number of targeting iterations.
+
+                :type: int
+            )doc"
+        )
+        .def_readonly(
+            "propagation_count",
+            &Sequence::TargetingSolution::propagationCount,
+            R"doc(
+                The number of sequence solves, including the Jacobian evaluations.
+
+                :type: int
+            )doc"
+        )
+        .def_readonly(
+            "jacobian_evaluation_count",
+            &Sequence::TargetingSolution::jacobianEvaluationCount,
+            R"doc(
+                The number of finite difference Jacobian evaluations.
+
+                :type: int
+            )doc"
+        )
+        .def_readonly(
+            "has_converged",
+            &Sequence::TargetingSolution::hasConverged,
+            R"doc(
+                Whether the constraints are met within tolerance.
+
+                :type: bool
+            )doc"
+        )
+
         ;
 
     {
@@ -294,6 +509,20 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Sequence(pybind11::module
 
                 )doc"
             )
+            .def(
+                "set_segment",
+                &Sequence::setSegment,
+                arg("index"),
+                arg("segment"),
+                R"doc(
+                    Replace a segment.
+
+                    Args:
+                        index (int): The index of the segment to replace.
+                        segment (Segment): The segment.
+
+                )doc"
+            )
             .def(
                 "add_coast_segment",
                 &Sequence::addCoastSegment,
@@ -320,13 +549,73 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Sequence(pybind11::module
                 arg("event_condition"),
                 arg("thruster_dynamics")
             )
+            .def(
+                "add_impulsive_maneuver_segment",
+                &Sequence::addImpulsiveManeuverSegment,
+                R"doc(
+                    Add an impulsive maneuver segment.
+
+                    Args:
+                        delta_v (np.ndarray): The delta V, expressed in the local orbital frame [m/s].
+                        local_orbital_frame_factory (LocalOrbitalFrameFactory): The local orbital frame factory.
+                        specific_impulse (float): The specific impulse [s].
+
+                )doc",
+                arg("delta_v"),
+                arg("local_orbital_frame_factory"),
+                arg("specific_impulse")
+            )
 
             .def(
                 "solve",
-                &Sequence::solve,
+                overload_cast<const State&, const Size&>(&Sequence::solve, const_),
+                call_guard<gil_scoped_release>(),
                 R"doc(
                     Solve the sequence.
 
+                    The GIL is released during the solve. Event condition targets are updated by the solve, hence a sequence must not be solved concurrently from several threads: use one sequence per thread, or solve an array of states.
+
+                    Args:
+                        state (State): The state.
+                        repetition_count (int, optional): The repetition count. Defaults to 1.
+
+                    Returns:
+                        SequenceSolution: The sequence solution.
+
+                )doc",
+                arg("state"),
+                arg("repetition_count") = 1
+            )
+
+            .def(
+                "solve",
+                overload_cast<const Array<State>&, const Size&, const Size&>(&Sequence::solve, const_),
+                call_guard<gil_scoped_release>(),
+                R"doc(
+                    Solve the sequence for each of the initial states. Initial states are solved in parallel, using a pool of worker threads, each holding clones of the segment event conditions.
+
+                    Args:
+                        states (list[State]): The initial states.
+                        repetition_count (int, optional): The repetition count. Defaults to 1.
+                        thread_count (int, optional): The number of worker threads. Defaults to 0, i.e. the default thread count of ExecutionContext.
+
+                    Returns:
+                        list[SequenceSolution]: The sequence solutions, in the order of the initial states.
+
+                )doc",
+                arg("states"),
+                arg("repetition_count") = 1,
+                arg("thread_count") = 0
+            )
+
+            .def(
+                "solve_warm_started",
+                &Sequence::solveWarmStarted,
+                R"doc(
+                    Solve the sequence, reusing the segment solutions of the previous warm-started solve.
+
+                    Segment solutions are reused as long as the segments and their initial states are unchanged, so that only the segments following the first changed one are propagated. Changes made in place to a shared event condition or dynamics are not detected, and require clearing the solution cache.
+
                     Args:
                         state (State): The state.
                         repetition_count (int, optional): The repetition count. Defaults to 1.
@@ -339,12 +628,101 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_Sequence(pybind11::module
                 arg("repetition_count") = 1
             )
 
+            .def(
+                "clear_solution_cache",
+                &Sequence::clearSolutionCache,
+                R"doc(
+                    Clear the segment solutions cached by warm-started solves.
+
+                )doc"
+            )
+
+            .def(
+                "solve_targeting",
+                &Sequence::solveTargeting,
+                call_guard<gil_scoped_release>(),
+                R"doc(
+                    Solve a targeting problem on the sequence: adjust control variables, mapped to the initial state of the sequence, until the constraints evaluated on the sequence solution vanish.
+
+                    The constraint Jacobian is evaluated once by forward finite differences, or seeded by the caller, and then maintained with Broyden rank-one updates, so that an iteration costs a single sequence solve. It is only re-evaluated when an updated Jacobian fails to decrease the constraints norm.
+
+                    Args:
+                        initial_controls (np.ndarray): The initial control variables.
+                        initial_state_generator (callable): Callable generating the initial state of the sequence from control variables.
+                        constraint_generator (callable): Callable computing the constraint values from a sequence solution.
+                        tolerance (float, optional): The tolerance on the constraints norm. Defaults to 1e-6.
+                        maximum_iteration_count (int, optional): The maximum number of iterations. Defaults to 20.
+                        initial_jacobian (np.ndarray, optional): The initial constraint Jacobian. Defaults to empty, i.e. evaluated by finite differences.
+                        relative_step (float, optional): The relative step used to perturb the controls for finite differences. Defaults to 1e-6.
+
+                    Returns:
+                        SequenceTargetingSolution: The targeting solution.
+
+                )doc",
+                arg("initial_controls"),
+                arg("initial_state_generator"),
+                arg("constraint_generator"),
+                arg("tolerance") = 1e-6,
+                arg("maximum_iteration_count") = 20,
+                arg_v("initial_jacobian", MatrixXd(), "numpy.empty((0, 0))"),
+                arg("relative_step") = 1e-6
+            )
+
+            .def(
+                "solve_async",
+                &Sequence::solveAsync,
+                R"doc(
+                    Solve the sequence in the background.
+
+                    The solve runs on a dedicated thread, on a copy of the sequence whose segments, event conditions and dynamics are shared with this sequence, which must not be solved concurrently. Segment solutions are streamed to the callback, from the background thread, as they complete.
+
+                    Args:
+                        state (State): The state.
+                        repetition_count (int, optional): The repetition count. Defaults to 1.
+                        segment_solution_callback (callable, optional): Callable invoked with each completed segment solution. Defaults to None.
+
+                    Returns:
+                        SequenceAsyncSolution: A handle on the solve.
+
+                )doc",
+                arg("state"),
+                arg("repetition_count") = 1,
+                arg("segment_solution_callback") = none()
+            )
+
+            .def(
+                "solve_to_condition_async",
+                &Sequence::solveToConditionAsync,
+                R"doc(
+                    Solve the sequence in the background, until the event condition is met.
+
+                    Background counterpart of `solve_to_condition`, with the same threading and cancellation behavior as `solve_async`.
+
+                    Args:
+                        state (State): The state.
+                        event_condition (EventCondition): The event condition.
+                        maximum_propagation_duration_limit (Duration, optional): The maximum propagation duration limit for the sequence. Defaults to 30 days.
+                        segment_solution_callback (callable, optional): Callable invoked with each completed segment solution. Defaults to None.
+
+                    Returns:
+                        SequenceAsyncSolution: A handle on the solve.
+
+                )doc",
+                arg("state"),
+                arg("event_condition"),
+                arg_v("maximum_propagation_duration_limit", Duration::Days(30.0), "Duration.days(30.0)"),
+                arg("segment_solution_callback") = none()
+            )
+
             .def(
                 "solve_to_condition",
                 &Sequence::solveToCondition,
+                call_guard<gil_scoped_release>(),
                 R"doc(
                     Solve the sequence until the event condition is met.
 
+                    The GIL is released during the solve. Event condition targets are updated by the solve, hence a sequence must not be solved concurrently from several threads: use one sequence per thread, or solve an array of states.
+
                     In the case that the event condition is not met due to maximum propagation duration limit,
                     it will return the `SequenceSolution` with `executionIsComplete` set to `False`.
 
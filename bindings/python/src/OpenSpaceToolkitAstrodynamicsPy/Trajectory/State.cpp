@@ -4,12 +4,17 @@
 
 #include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/State/CoordinateBroker.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/State/CoordinateSubset.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/State/EarthOrientation.cpp>
 #include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/State/NumericalSolver.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/State/StateTable.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/State/TransformCache.cpp>
+#include <OpenSpaceToolkitAstrodynamicsPy/Trajectory/State/TransformInterpolator.cpp>
 
 inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State(pybind11::module& aModule)
 {
     using namespace pybind11;
 
+    using ostk::core::container::Array;
     using ostk::core::type::Shared;
 
     using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
@@ -18,6 +23,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State(pybind11::module& a
     using ostk::physics::coordinate::Frame;
     using ostk::physics::coordinate::Position;
     using ostk::physics::coordinate::Velocity;
+    using ostk::physics::time::Duration;
     using ostk::physics::time::Instant;
 
     using ostk::astrodynamics::trajectory::State;
@@ -277,6 +283,42 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State(pybind11::module& a
             arg("frame")
         )
 
+        .def_static(
+            "states_in_frame",
+            overload_cast<const Array<State>&, const Shared<const Frame>&>(&State::InFrame),
+            R"doc(
+                Transform states to a given reference frame, computing the transform once per frame and instant.
+
+                Args:
+                    states (list[State]): The states.
+                    frame (Frame): The reference frame to transform to.
+
+                Returns:
+                    list[State]: The transformed states.
+            )doc",
+            arg("states"),
+            arg("frame")
+        )
+
+        .def_static(
+            "states_in_frame",
+            overload_cast<const Array<State>&, const Shared<const Frame>&, const Duration&>(&State::InFrame),
+            R"doc(
+                Transform states to a given reference frame sharing their origin, computing transforms exactly every interpolation step and interpolating them in between.
+
+                Args:
+                    states (list[State]): The states.
+                    frame (Frame): The reference frame to transform to.
+                    interpolation_step (Duration): The step between exactly computed transforms.
+
+                Returns:
+                    list[State]: The transformed states.
+            )doc",
+            arg("states"),
+            arg("frame"),
+            arg("interpolation_step")
+        )
+
         .def_static(
             "undefined",
             &State::Undefined,
@@ -295,5 +337,9 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State(pybind11::module& a
 
     OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_CoordinateBroker(state);
     OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_CoordinateSubset(state);
+    OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_EarthOrientation(state);
     OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_NumericalSolver(state);
+    OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_StateTable(state);
+    OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_TransformCache(state);
+    OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_TransformInterpolator(state);
 }
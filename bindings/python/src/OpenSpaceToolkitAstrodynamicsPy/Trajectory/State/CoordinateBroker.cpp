@@ -42,6 +42,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_CoordinateBroker(py
 
         .def(self == self)
         .def(self != self)
+        .def("__hash__", &CoordinateBroker::hash)
 
         .def(
             "access_subsets",
@@ -114,6 +115,20 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_CoordinateBroker(py
 
             )doc"
         )
+        .def(
+            "get_subset_index",
+            overload_cast<const Shared<const CoordinateSubset>&>(&CoordinateBroker::getSubsetIndex, const_),
+            arg("coordinate_subset"),
+            R"doc(
+                Get the starting index of a coordinate subset in the state coordinates.
+
+                Args:
+                    coordinate_subset (CoordinateSubset): The coordinate subset of interest.
+
+                Returns:
+                    int: The starting index of the coordinate subset.
+            )doc"
+        )
 
         .def(
             "extract_coordinate",
@@ -125,6 +125,18 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_CoordinateSubset(py
                     str: The identifier of the coordinate subset.
             )doc"
         )
+        .def(
+            "get_handle",
+            &CoordinateSubset::getHandle,
+            R"doc(
+                Get the handle of the coordinate subset.
+
+                Coordinate subsets share a handle if and only if they share an identifier.
+
+                Returns:
+                    int: The handle of the coordinate subset.
+            )doc"
+        )
         .def(
             "get_name",
             &CoordinateSubset::getName,
@@ -218,30 +230,36 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_CoordinateSubset(py
 
         .def_static(
             "mass",
-            &CoordinateSubset::Mass,
+            cachedObject(&CoordinateSubset::Mass),
             R"doc(
                 Get the mass coordinate subset.
 
+                The same object is returned at each call.
+
                 Returns:
                     CoordinateSubset: The mass coordinate subset.
             )doc"
         )
         .def_static(
             "surface_area",
-            &CoordinateSubset::SurfaceArea,
+            cachedObject(&CoordinateSubset::SurfaceArea),
             R"doc(
                 Get the surface area coordinate subset.
 
+                The same object is returned at each call.
+
                 Returns:
                     CoordinateSubset: The surface area coordinate subset.
             )doc"
         )
         .def_static(
             "drag_coefficient",
-            &CoordinateSubset::DragCoefficient,
+            cachedObject(&CoordinateSubset::DragCoefficient),
             R"doc(
                 Get the drag coefficient coordinate subset.
 
+                The same object is returned at each call.
+
                 Returns:
                     CoordinateSubset: The drag coefficient coordinate subset.
             )doc"
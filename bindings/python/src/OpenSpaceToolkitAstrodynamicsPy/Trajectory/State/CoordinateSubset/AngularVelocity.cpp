@@ -64,10 +64,12 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_CoordinateSubset_An
 
         .def_static(
             "default",
-            &AngularVelocity::Default,
+            cachedObject(&AngularVelocity::Default),
             R"doc(
                 Get the default Angular velocity subset.
 
+                The same object is returned at each call.
+
                 Returns:
                     AngularVelocity: The default Angular velocity subset.
             )doc"
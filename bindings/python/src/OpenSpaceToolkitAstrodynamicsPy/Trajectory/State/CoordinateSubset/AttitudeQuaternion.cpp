@@ -63,10 +63,12 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_CoordinateSubset_At
 
         .def_static(
             "default",
-            &AttitudeQuaternion::Default,
+            cachedObject(&AttitudeQuaternion::Default),
             R"doc(
                 Get the default Attitude quaternion subset.
 
+                The same object is returned at each call.
+
                 Returns:
                     AttitudeQuaternion: The default Attitude quaternion subset.
             )doc"
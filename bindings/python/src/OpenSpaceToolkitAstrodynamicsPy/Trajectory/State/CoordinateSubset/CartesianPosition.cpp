@@ -63,10 +63,12 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_CoordinateSubset_Ca
 
         .def_static(
             "default",
-            &CartesianPosition::Default,
+            cachedObject(&CartesianPosition::Default),
             R"doc(
                 Get the default Cartesian position subset.
 
+                The same object is returned at each call.
+
                 Returns:
                     CartesianPosition: The default Cartesian position subset.
             )doc"
@@ -65,10 +65,12 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_CoordinateSubset_Ca
 
         .def_static(
             "default",
-            &CartesianVelocity::Default,
+            cachedObject(&CartesianVelocity::Default),
             R"doc(
                 Get the default Cartesian velocity subset.
 
+                The same object is returned at each call.
+
                 Returns:
                     CartesianVelocity: The default Cartesian velocity subset.
             )doc"
@@ -0,0 +1,110 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/EarthOrientation.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_EarthOrientation(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::astrodynamics::trajectory::state::EarthOrientation;
+
+    class_<EarthOrientation> earthOrientation(
+        aModule,
+        "EarthOrientation",
+        R"doc(
+            Process-wide selection of the Earth orientation model used for GCRF to ITRF transforms.
+
+            The interpolated model evaluates the full model on a regular grid, and spherically interpolates in between.
+            It applies to the transform cache (state frame conversions, access AER) and to atmospheric drag. Changing
+            the model or the step clears the transform cache.
+
+        )doc"
+    );
+
+    enum_<EarthOrientation::Model>(
+        earthOrientation,
+        "Model",
+        R"doc(
+            Earth orientation model.
+        )doc"
+    )
+
+        .value("Full", EarthOrientation::Model::Full, "Full model, evaluated at each instant")
+        .value("Interpolated", EarthOrientation::Model::Interpolated, "Full model, evaluated on a grid and interpolated")
+
+        ;
+
+    earthOrientation
+
+        .def_static(
+            "get_model",
+            &EarthOrientation::GetModel,
+            R"doc(
+                Get the model.
+
+                Returns:
+                    EarthOrientation.Model: The model.
+
+            )doc"
+        )
+
+        .def_static(
+            "set_model",
+            &EarthOrientation::SetModel,
+            arg("model"),
+            R"doc(
+                Set the model.
+
+                Args:
+                    model (EarthOrientation.Model): The model.
+
+            )doc"
+        )
+
+        .def_static(
+            "get_interpolation_step",
+            &EarthOrientation::GetInterpolationStep,
+            R"doc(
+                Get the grid step of the interpolated model.
+
+                Returns:
+                    Duration: The step.
+
+            )doc"
+        )
+
+        .def_static(
+            "set_interpolation_step",
+            &EarthOrientation::SetInterpolationStep,
+            arg("step"),
+            R"doc(
+                Set the grid step of the interpolated model.
+
+                Args:
+                    step (Duration): The strictly positive step. Defaults to 1 hour.
+
+            )doc"
+        )
+
+        .def_static(
+            "get_transform",
+            &EarthOrientation::GetTransform,
+            arg("from_frame"),
+            arg("to_frame"),
+            arg("instant"),
+            R"doc(
+                Get the transform between two frames at a given instant, using the model for GCRF to ITRF transforms.
+
+                Args:
+                    from_frame (Frame): The frame to transform from.
+                    to_frame (Frame): The frame to transform to.
+                    instant (Instant): The instant.
+
+                Returns:
+                    Transform: The transform.
+
+            )doc"
+        )
+
+        ;
+}
@@ -7,7 +7,11 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_NumericalSolver(pyb
     using namespace pybind11;
 
     using ostk::core::container::Array;
+    using ostk::core::type::Real;
+    using ostk::core::type::Shared;
+    using ostk::core::type::Size;
 
+    using ostk::physics::time::Duration;
     using ostk::physics::time::Instant;
 
     using MathNumericalSolver = ostk::mathematics::solver::NumericalSolver;
@@ -33,6 +37,33 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_NumericalSolver(pyb
             )doc"
     );
 
+    enum_<NumericalSolver::LongHorizonScheme>(
+        numericalSolver,
+        "LongHorizonScheme",
+        R"doc(
+            Long horizon integration scheme, taking constant steps with a stepper other than the generic Runge-Kutta ones.
+        )doc"
+    )
+
+        .value("Undefined", NumericalSolver::LongHorizonScheme::Undefined, "Undefined (integrate with the stepper)")
+        .value(
+            "AdamsBashforthMoulton",
+            NumericalSolver::LongHorizonScheme::AdamsBashforthMoulton,
+            "Eighth order Adams-Bashforth-Moulton predictor-corrector"
+        )
+        .value(
+            "GaussLegendre",
+            NumericalSolver::LongHorizonScheme::GaussLegendre,
+            "Fourth order symplectic Gauss-Legendre collocation"
+        )
+        .value(
+            "RungeKuttaMuntheKaas",
+            NumericalSolver::LongHorizonScheme::RungeKuttaMuntheKaas,
+            "Fourth order Runge-Kutta-Munthe-Kaas, attitude quaternion kept on the unit sphere"
+        )
+
+        ;
+
     class_<NumericalSolver::ConditionSolution>(
         numericalSolver,
         "ConditionSolution",
@@ -84,6 +115,149 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_NumericalSolver(pyb
 
         ;
 
+    class_<NumericalSolver::EventOccurrence>(
+        numericalSolver,
+        "EventOccurrence",
+        R"doc(
+            An occurrence of an event condition, found during an integration.
+
+        )doc"
+    )
+        .def_readonly(
+            "condition_index",
+            &NumericalSolver::EventOccurrence::conditionIndex,
+            R"doc(
+                The index of the event condition.
+
+                Type:
+                    int
+            )doc"
+        )
+        .def_readonly(
+            "state",
+            &NumericalSolver::EventOccurrence::state,
+            R"doc(
+                The state at the occurrence.
+
+                Type:
+                    State
+            )doc"
+        )
+        .def_readonly(
+            "iteration_count",
+            &NumericalSolver::EventOccurrence::iterationCount,
+            R"doc(
+                The number of root solver iterations performed.
+
+                Type:
+                    int
+            )doc"
+        )
+        .def_readonly(
+            "root_solver_has_converged",
+            &NumericalSolver::EventOccurrence::rootSolverHasConverged,
+            R"doc(
+                Whether the root solver has converged.
+
+                Type:
+                    bool
+            )doc"
+        )
+
+        ;
+
+    class_<NumericalSolver::EventsSolution>(
+        numericalSolver,
+        "EventsSolution",
+        R"doc(
+            The solution of an integration recording event occurrences.
+
+        )doc"
+    )
+        .def_readonly(
+            "state",
+            &NumericalSolver::EventsSolution::state,
+            R"doc(
+                The final state.
+
+                Type:
+                    State
+            )doc"
+        )
+        .def_readonly(
+            "event_occurrences",
+            &NumericalSolver::EventsSolution::eventOccurrences,
+            R"doc(
+                The event occurrences, in integration order.
+
+                Type:
+                    list[EventOccurrence]
+            )doc"
+        )
+
+        ;
+
+    class_<NumericalSolver::Statistics>(
+        numericalSolver,
+        "Statistics",
+        R"doc(
+            Integration statistics, accumulated over integrations while enabled.
+
+            Steps are the accepted steps of the stepper. Rejected steps are counted for adaptive steppers. Integrations
+            to a list of instants with a non dense stepper only count evaluations.
+
+        )doc"
+    )
+
+        .def_readonly("evaluation_count", &NumericalSolver::Statistics::evaluationCount)
+        .def_readonly("step_count", &NumericalSolver::Statistics::stepCount)
+        .def_readonly("rejected_step_count", &NumericalSolver::Statistics::rejectedStepCount)
+        .def_readonly("minimum_step_duration", &NumericalSolver::Statistics::minimumStepDuration)
+        .def_readonly("maximum_step_duration", &NumericalSolver::Statistics::maximumStepDuration)
+        .def_readonly("cumulative_step_duration", &NumericalSolver::Statistics::cumulativeStepDuration)
+
+        .def(
+            "get_mean_step_duration",
+            &NumericalSolver::Statistics::getMeanStepDuration,
+            R"doc(
+                Get the mean accepted step duration.
+
+                Returns:
+                    Duration: The mean step duration (undefined without steps).
+            )doc"
+        )
+
+        .def(
+            "to_dict",
+            [](const NumericalSolver::Statistics& aStatistics) -> dict
+            {
+                const auto inSeconds = [](const Duration& aDuration) -> object
+                {
+                    return aDuration.isDefined() ? cast(double(aDuration.inSeconds())) : none();
+                };
+
+                dict statistics;
+
+                statistics["evaluation_count"] = aStatistics.evaluationCount;
+                statistics["step_count"] = aStatistics.stepCount;
+                statistics["rejected_step_count"] = aStatistics.rejectedStepCount;
+                statistics["minimum_step_duration"] = inSeconds(aStatistics.minimumStepDuration);
+                statistics["maximum_step_duration"] = inSeconds(aStatistics.maximumStepDuration);
+                statistics["mean_step_duration"] = inSeconds(aStatistics.getMeanStepDuration());
+                statistics["cumulative_step_duration"] = inSeconds(aStatistics.cumulativeStepDuration);
+
+                return statistics;
+            },
+            R"doc(
+                Convert the statistics to a dictionary, e.g. for a metrics exporter.
+
+                Returns:
+                    dict[str, int | float | None]: The counts, and the step durations [s] (None without steps).
+            )doc"
+        )
+
+        ;
+
     {
         numericalSolver
 
@@ -152,6 +326,148 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_NumericalSolver(pyb
                         RootSolver: The root solver.
                 )doc"
             )
+            .def(
+                "get_long_horizon_scheme",
+                &NumericalSolver::getLongHorizonScheme,
+                R"doc(
+                    Get the long horizon scheme.
+
+                    Returns:
+                        NumericalSolver.LongHorizonScheme: The long horizon scheme.
+                )doc"
+            )
+            .def(
+                "supports_fixed_size_integration",
+                &NumericalSolver::supportsFixedSizeIntegration,
+                R"doc(
+                    Check if the solver supports fixed size integration, used by propagators for orbit-only states.
+
+                    Returns:
+                        bool: True if the solver supports fixed size integration.
+                )doc"
+            )
+
+            .def(
+                "is_statistics_enabled",
+                &NumericalSolver::isStatisticsEnabled,
+                R"doc(
+                    Check if statistics are enabled.
+
+                    Returns:
+                        bool: True if statistics are enabled, False otherwise.
+                )doc"
+            )
+            .def(
+                "get_statistics",
+                [](NumericalSolver& aNumericalSolver, const bool reset) -> NumericalSolver::Statistics
+                {
+                    const NumericalSolver::Statistics statistics = aNumericalSolver.getStatistics();
+
+                    if (reset)
+                    {
+                        aNumericalSolver.resetStatistics();
+                    }
+
+                    return statistics;
+                },
+                R"doc(
+                    Get the statistics accumulated since statistics were enabled (or last reset).
+
+                    Args:
+                        reset (bool, optional): If True, reset statistics once read. Defaults to False.
+
+                    Returns:
+                        NumericalSolver.Statistics: The statistics.
+                )doc",
+                arg("reset") = false
+            )
+            .def(
+                "enable_statistics",
+                &NumericalSolver::enableStatistics,
+                R"doc(
+                    Enable statistics.
+
+                    Copies of this solver (e.g., those held by propagators and segments) share its statistics.
+                )doc"
+            )
+            .def(
+                "disable_statistics",
+                &NumericalSolver::disableStatistics,
+                R"doc(
+                    Disable statistics.
+                )doc"
+            )
+            .def(
+                "reset_statistics",
+                &NumericalSolver::resetStatistics,
+                R"doc(
+                    Reset statistics.
+                )doc"
+            )
+            .def(
+                "set_initial_time_step",
+                &NumericalSolver::setInitialTimeStep,
+                arg("initial_time_step"),
+                R"doc(
+                    Set the step size the next integrations start with, in place of the configured time step.
+
+                    Meant to warm-start an integration with the step size the error controller settled on at the end
+                    of a previous one (see `get_final_time_step`). Only applies to adaptive steppers (without long
+                    horizon scheme), integrating to an instant or to a condition.
+
+                    Args:
+                        initial_time_step (Real): An initial time step [s], or undefined to start with the configured
+                            time step.
+                )doc"
+            )
+            .def(
+                "get_initial_time_step",
+                &NumericalSolver::getInitialTimeStep,
+                R"doc(
+                    Get the step size the next integrations start with.
+
+                    Returns:
+                        Real: The initial time step [s], undefined if the configured time step is used.
+                )doc"
+            )
+            .def(
+                "get_final_time_step",
+                &NumericalSolver::getFinalTimeStep,
+                R"doc(
+                    Get the step size proposed by the stepper at the end of the last integration to an instant or
+                    condition.
+
+                    Returns:
+                        Real: The final time step [s], undefined if no integration has been performed.
+                )doc"
+            )
+            .def(
+                "set_state_batch_logger",
+                +[](NumericalSolver& aNumericalSolver,
+                    const NumericalSolver::StateBatchLogger& aStateBatchLogger,
+                    const Size& aBatchSize) -> void
+                {
+                    aNumericalSolver.setStateBatchLogger(aStateBatchLogger, aBatchSize, false);
+                },
+                arg("state_batch_logger"),
+                arg("batch_size"),
+                R"doc(
+                    Set a logger of batches of observed states.
+
+                    The states observed during an integration (those passed to the state logger) are buffered, and
+                    delivered by batches of the given size, the remaining states being delivered when the integration
+                    ends. The GIL is thus only acquired once per batch, instead of once per step.
+
+                    Batches are delivered in order, on the integrating thread: a Python logger requires the GIL in
+                    any case, hence asynchronous delivery is only available from C++. The logger is shared by the
+                    copies of the solver, e.g. those held by propagators.
+
+                    Args:
+                        state_batch_logger (callable): A function taking a list of states, or None to disable batch
+                            logging.
+                        batch_size (int): The batch size, in states.
+                )doc"
+            )
 
             .def(
                 "integrate_time",
@@ -264,6 +580,49 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_NumericalSolver(pyb
                 arg("event_condition")
             )
 
+            .def(
+                "integrate_time",
+                +[](NumericalSolver& aNumericalSolver,
+                    const State& aState,
+                    const Instant& anInstant,
+                    const object& aSystemOfEquationsObject,
+                    const Array<Shared<EventCondition>>& anEventConditionArray) -> NumericalSolver::EventsSolution
+                {
+                    const auto pythonDynamicsEquation =
+                        pybind11::cast<pythonSystemOfEquationsSignature>(aSystemOfEquationsObject);
+
+                    const NumericalSolver::SystemOfEquationsWrapper& systemOfEquations =
+                        [&](const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double t
+                        ) -> void
+                    {
+                        dxdt = pythonDynamicsEquation(x, dxdt, t);
+                    };
+
+                    return aNumericalSolver.integrateTime(aState, anInstant, systemOfEquations, anEventConditionArray);
+                },
+                R"doc(
+                    Integrate the trajectory to a given instant, recording every occurrence of a set of event
+                    conditions.
+
+                    Conditions do not terminate the integration: they are all checked on each step, in a single pass,
+                    and the instant of each occurrence is refined on the dense output of the step.
+
+                    Args:
+                        state (State): The initial state of the trajectory.
+                        instant (Instant): The instant to integrate to.
+                        system_of_equations (callable): The system of equations.
+                        event_conditions (list[EventCondition]): The event conditions.
+
+                    Returns:
+                        EventsSolution: The final state and the event occurrences.
+
+                )doc",
+                arg("state"),
+                arg("instant"),
+                arg("system_of_equations"),
+                arg("event_conditions")
+            )
+
             .def_static(
                 "default",
                 &NumericalSolver::Default,
@@ -296,6 +655,38 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_NumericalSolver(pyb
                 arg("stepper_type"),
                 arg("time_step")
             )
+            .def_static(
+                "long_horizon",
+                &NumericalSolver::LongHorizon,
+                R"doc(
+                    Return a Numerical Solver using a long horizon scheme, taking large constant steps.
+
+                    Sessions and ensemble integration are not supported.
+
+                    Args:
+                        long_horizon_scheme (NumericalSolver.LongHorizonScheme): The long horizon scheme.
+                        time_step (float): The (constant) time step, in seconds.
+
+                    Returns:
+                        NumericalSolver: The numerical solver.
+                )doc",
+                arg("long_horizon_scheme"),
+                arg("time_step")
+            )
+            .def_static(
+                "string_from_long_horizon_scheme",
+                &NumericalSolver::StringFromLongHorizonScheme,
+                R"doc(
+                    Get the string representation of a long horizon scheme.
+
+                    Args:
+                        long_horizon_scheme (NumericalSolver.LongHorizonScheme): The long horizon scheme.
+
+                    Returns:
+                        str: The string representation.
+                )doc",
+                arg("long_horizon_scheme")
+            )
             .def_static(
                 "default_conditional",
                 &NumericalSolver::DefaultConditional,
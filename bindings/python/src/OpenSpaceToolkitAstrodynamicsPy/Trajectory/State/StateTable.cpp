@@ -0,0 +1,315 @@
+/// Apache License 2.0
+
+#include <cstdint>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/StateTable.hpp>
+
+#include <OpenSpaceToolkitAstrodynamicsPy/Utility/DateTime64.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_StateTable(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::container::Array;
+    using ostk::core::type::Index;
+    using ostk::core::type::Shared;
+    using ostk::core::type::String;
+
+    using ostk::mathematics::object::MatrixXd;
+
+    using ostk::physics::coordinate::Frame;
+    using ostk::physics::time::Instant;
+
+    using ostk::astrodynamics::trajectory::state::CoordinateBroker;
+    using ostk::astrodynamics::trajectory::state::CoordinateSubset;
+    using ostk::astrodynamics::trajectory::state::StateTable;
+
+    class_<StateTable>(
+        aModule,
+        "StateTable",
+        R"doc(
+            Columnar table of states sharing a frame and a coordinate broker.
+
+            Instants are stored as nanosecond offsets from an epoch, and coordinates as an N x M array, one row per
+            state, in which each coordinate is a contiguous column. Arrays are returned as read-only views on the
+            table, without copying.
+
+        )doc"
+    )
+
+        .def(
+            init<
+                const Instant&,
+                const StateTable::OffsetVector&,
+                const MatrixXd&,
+                const Shared<const Frame>&,
+                const Shared<const CoordinateBroker>&>(),
+            arg("epoch"),
+            arg("offsets"),
+            arg("coordinates"),
+            arg("frame"),
+            arg("coordinate_broker"),
+            R"doc(
+                Constructor.
+
+                Args:
+                    epoch (Instant): The epoch.
+                    offsets (np.ndarray): The offsets from the epoch [ns], one per state.
+                    coordinates (np.ndarray): The coordinates, one row per state.
+                    frame (Frame): The frame.
+                    coordinate_broker (CoordinateBroker): The coordinate broker, describing the coordinate columns.
+
+            )doc"
+        )
+
+        .def(self == self)
+        .def(self != self)
+
+        .def("__len__", &StateTable::getSize)
+
+        .def(
+            "is_defined",
+            &StateTable::isDefined,
+            R"doc(
+                Check if the state table is defined.
+
+                Returns:
+                    bool: True if the state table is defined.
+
+            )doc"
+        )
+        .def(
+            "get_size",
+            &StateTable::getSize,
+            R"doc(
+                Get the number of states.
+
+                Returns:
+                    int: The number of states.
+
+            )doc"
+        )
+        .def(
+            "get_epoch",
+            &StateTable::accessEpoch,
+            R"doc(
+                Get the epoch.
+
+                Returns:
+                    Instant: The epoch.
+
+            )doc"
+        )
+        .def(
+            "get_offsets",
+            &StateTable::accessOffsets,
+            return_value_policy::reference_internal,
+            R"doc(
+                Get the offsets from the epoch, as a read-only view.
+
+                Returns:
+                    np.ndarray: The offsets [ns], one per state.
+
+            )doc"
+        )
+        .def(
+            "get_datetimes",
+            [](const StateTable& aStateTable) -> object
+            {
+                const std::int64_t epochDateTime64 = DateTime64FromInstant(aStateTable.accessEpoch());
+
+                array_t<std::int64_t> dateTime64Array(aStateTable.getSize());
+                auto dateTime64s = dateTime64Array.mutable_unchecked<1>();
+
+                for (Index index = 0; index < aStateTable.getSize(); ++index)
+                {
+                    dateTime64s(index) = epochDateTime64 + aStateTable.accessOffsets()(index);
+                }
+
+                return dateTime64Array.attr("view")("datetime64[ns]");
+            },
+            R"doc(
+                Get the instants, as a numpy.datetime64 array (UTC), computed from the epoch and the offsets.
+
+                Returns:
+                    np.ndarray: The instants, one per state.
+
+            )doc"
+        )
+        .def(
+            "get_coordinates",
+            &StateTable::accessCoordinates,
+            return_value_policy::reference_internal,
+            R"doc(
+                Get the coordinates, as a read-only view.
+
+                Returns:
+                    np.ndarray: The coordinates, one row per state.
+
+            )doc"
+        )
+        .def(
+            "get_coordinates_of",
+            &StateTable::accessCoordinatesOf,
+            return_value_policy::reference_internal,
+            arg("coordinate_subset"),
+            R"doc(
+                Get the coordinates of a subset, as a read-only view.
+
+                Args:
+                    coordinate_subset (CoordinateSubset): The coordinate subset.
+
+                Returns:
+                    np.ndarray: The coordinates of the subset, one row per state.
+
+            )doc"
+        )
+        .def(
+            "get_columns",
+            [](const object& aStateTable) -> dict
+            {
+                const StateTable& stateTable = aStateTable.cast<const StateTable&>();
+
+                const object coordinates =
+                    cast(stateTable.accessCoordinates(), return_value_policy::reference_internal, aStateTable);
+
+                dict columns;
+
+                columns["offset"] =
+                    cast(stateTable.accessOffsets(), return_value_policy::reference_internal, aStateTable);
+
+                Index columnIndex = 0;
+
+                const Array<Shared<const CoordinateSubset>> subsets =
+                    stateTable.accessCoordinateBroker()->getSubsets();
+
+                for (const Shared<const CoordinateSubset>& subsetSPtr : subsets)
+                {
+                    for (Index i = 0; i < subsetSPtr->getSize(); ++i)
+                    {
+                        const String name = (subsetSPtr->getSize() == 1)
+                                              ? subsetSPtr->getName()
+                                              : String::Format("{}_{}", subsetSPtr->getName(), i);
+
+                        columns[str(name)] = coordinates[make_tuple(slice(none(), none(), none()), columnIndex++)];
+                    }
+                }
+
+                return columns;
+            },
+            R"doc(
+                Get the columns of the table, as read-only views: the offsets from the epoch [ns] under "offset", and
+                one column per coordinate, named after its subset (suffixed with the coordinate index for subsets of
+                several coordinates).
+
+                The result can be passed as is to `pandas.DataFrame` or `pyarrow.table`.
+
+                Returns:
+                    dict[str, np.ndarray]: The columns.
+
+            )doc"
+        )
+        .def(
+            "get_frame",
+            &StateTable::accessFrame,
+            R"doc(
+                Get the frame.
+
+                Returns:
+                    Frame: The frame.
+
+            )doc"
+        )
+        .def(
+            "get_coordinate_broker",
+            &StateTable::accessCoordinateBroker,
+            R"doc(
+                Get the coordinate broker.
+
+                Returns:
+                    CoordinateBroker: The coordinate broker.
+
+            )doc"
+        )
+        .def(
+            "get_instant_at",
+            &StateTable::getInstantAt,
+            arg("index"),
+            R"doc(
+                Get the instant of a state.
+
+                Args:
+                    index (int): The state index.
+
+                Returns:
+                    Instant: The instant.
+
+            )doc"
+        )
+        .def(
+            "get_instants",
+            &StateTable::getInstants,
+            R"doc(
+                Get all the instants.
+
+                Returns:
+                    list[Instant]: The instants.
+
+            )doc"
+        )
+        .def(
+            "get_state_at",
+            &StateTable::getStateAt,
+            arg("index"),
+            R"doc(
+                Get a state.
+
+                Args:
+                    index (int): The state index.
+
+                Returns:
+                    State: The state.
+
+            )doc"
+        )
+        .def(
+            "get_states",
+            &StateTable::getStates,
+            R"doc(
+                Get all the states.
+
+                Returns:
+                    list[State]: The states.
+
+            )doc"
+        )
+
+        .def_static(
+            "undefined",
+            &StateTable::Undefined,
+            R"doc(
+                Create an undefined state table.
+
+                Returns:
+                    StateTable: The undefined state table.
+
+            )doc"
+        )
+        .def_static(
+            "from_states",
+            &StateTable::FromStates,
+            arg("states"),
+            R"doc(
+                Create a state table from states, expressed in the frame of the first state.
+
+                Args:
+                    states (list[State]): The states, sharing the coordinate subsets of the first state.
+
+                Returns:
+                    StateTable: The state table.
+
+            )doc"
+        )
+
+        ;
+}
@@ -0,0 +1,95 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/TransformCache.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_TransformCache(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::astrodynamics::trajectory::state::TransformCache;
+
+    class_<TransformCache>(
+        aModule,
+        "TransformCache",
+        R"doc(
+            Process-wide, thread-safe and bounded cache of frame transforms, keyed by (from frame, to frame, instant).
+
+        )doc"
+    )
+
+        .def_readonly_static(
+            "default_capacity",
+            &TransformCache::DefaultCapacity,
+            R"doc(
+                The default capacity.
+            )doc"
+        )
+
+        .def_static(
+            "get",
+            &TransformCache::Get,
+            arg("from_frame"),
+            arg("to_frame"),
+            arg("instant"),
+            R"doc(
+                Get the transform between two frames at a given instant, computing it only if not cached.
+
+                Args:
+                    from_frame (Frame): The frame to transform from.
+                    to_frame (Frame): The frame to transform to.
+                    instant (Instant): The instant.
+
+                Returns:
+                    Transform: The transform.
+
+            )doc"
+        )
+
+        .def_static(
+            "get_size",
+            &TransformCache::GetSize,
+            R"doc(
+                Get the number of cached transforms.
+
+                Returns:
+                    int: The number of cached transforms.
+
+            )doc"
+        )
+
+        .def_static(
+            "get_capacity",
+            &TransformCache::GetCapacity,
+            R"doc(
+                Get the capacity.
+
+                Returns:
+                    int: The maximum number of cached transforms.
+
+            )doc"
+        )
+
+        .def_static(
+            "set_capacity",
+            &TransformCache::SetCapacity,
+            arg("capacity"),
+            R"doc(
+                Set the capacity, evicting transforms if needed.
+
+                Args:
+                    capacity (int): The maximum number of cached transforms (0 disables caching).
+
+            )doc"
+        )
+
+        .def_static(
+            "clear",
+            &TransformCache::Clear,
+            R"doc(
+                Clear the cache.
+
+            )doc"
+        )
+
+        ;
+}
@@ -0,0 +1,99 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/TransformInterpolator.hpp>
+
+inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_State_TransformInterpolator(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Shared;
+
+    using ostk::physics::coordinate::Frame;
+    using ostk::physics::time::Duration;
+    using ostk::physics::time::Interval;
+
+    using ostk::astrodynamics::trajectory::state::TransformInterpolator;
+
+    class_<TransformInterpolator>(
+        aModule,
+        "TransformInterpolator",
+        R"doc(
+            Interpolator of the transform between two frames sharing their origin over an interval.
+
+            Exact transforms are computed on a uniform grid of nodes, and interpolated in between: spherically for the orientation, linearly otherwise. Earth rotation is reproduced exactly between nodes, so that for GCRF to ITRF the position error is below 0.1 mm in LEO and 1 mm in GEO with the default step.
+
+        )doc"
+    )
+
+        .def(
+            init<const Shared<const Frame>&, const Shared<const Frame>&, const Interval&, const Duration&>(),
+            arg("from_frame"),
+            arg("to_frame"),
+            arg("interval"),
+            arg_v("step", Duration::Minutes(5.0), "Duration.minutes(5.0)"),
+            R"doc(
+                Constructor.
+
+                Args:
+                    from_frame (Frame): The frame to transform from.
+                    to_frame (Frame): The frame to transform to.
+                    interval (Interval): The interval over which transforms are interpolated.
+                    step (Duration, optional): The step between exactly computed transforms. Defaults to 5 minutes.
+
+            )doc"
+        )
+
+        .def(
+            "get_interval",
+            &TransformInterpolator::getInterval,
+            R"doc(
+                Get the interval.
+
+                Returns:
+                    Interval: The interval.
+
+            )doc"
+        )
+
+        .def(
+            "get_step",
+            &TransformInterpolator::getStep,
+            R"doc(
+                Get the step between exactly computed transforms.
+
+                Returns:
+                    Duration: The step.
+
+            )doc"
+        )
+
+        .def(
+            "get_node_count",
+            &TransformInterpolator::getNodeCount,
+            R"doc(
+                Get the number of exactly computed transforms.
+
+                Returns:
+                    int: The number of transforms.
+
+            )doc"
+        )
+
+        .def(
+            "get_transform_at",
+            &TransformInterpolator::getTransformAt,
+            arg("instant"),
+            R"doc(
+                Get the transform at a given instant.
+
+                Args:
+                    instant (Instant): An instant within the interval.
+
+                Returns:
+                    Transform: The transform.
+
+            )doc"
+        )
+
+        ;
+}
@@ -163,7 +163,7 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_StateBuilder(pybind11::mo
         )
         .def(
             "reduce",
-            &StateBuilder::reduce,
+            overload_cast<const State&>(&StateBuilder::reduce, const_),
             arg("state"),
             R"doc(
                 Reduce a `State` object to the `StateBuilder`.
@@ -176,9 +176,26 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_StateBuilder(pybind11::mo
 
             )doc"
         )
+        .def(
+            "reduce",
+            overload_cast<const Array<State>&>(&StateBuilder::reduce, const_),
+            arg("states"),
+            R"doc(
+                Reduce `State` objects to the `StateBuilder`.
+
+                The mapping between coordinate subsets is computed once per coordinate broker of the input states.
+
+                Arguments:
+                    states (list[State]): The `State` objects to reduce.
+
+                Returns:
+                    list[State]: The `State` objects reduced to the `StateBuilder`.
+
+            )doc"
+        )
         .def(
             "expand",
-            &StateBuilder::expand,
+            overload_cast<const State&, const State&>(&StateBuilder::expand, const_),
             arg("state"),
             arg("default_state"),
             R"doc(
@@ -193,6 +210,25 @@ inline void OpenSpaceToolkitAstrodynamicsPy_Trajectory_StateBuilder(pybind11::mo
 
             )doc"
         )
+        .def(
+            "expand",
+            overload_cast<const Array<State>&, const State&>(&StateBuilder::expand, const_),
+            arg("states"),
+            arg("default_state"),
+            R"doc(
+                Expand `State` objects to the `StateBuilder`.
+
+                The mapping between coordinate subsets is computed once per coordinate broker of the input states.
+
+                Arguments:
+                    states (list[State]): The `State` objects to expand.
+                    default_state (State): The default `State` object.
+
+                Returns:
+                    list[State]: The `State` objects expanded to the `StateBuilder`.
+
+            )doc"
+        )
 
         .def(
             "get_coordinate_subsets",
@@ -0,0 +1,34 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkitAstrodynamicsPy_Utility_CachedObject__
+#define __OpenSpaceToolkitAstrodynamicsPy_Utility_CachedObject__
+
+#include <memory>
+
+#include <pybind11/pybind11.h>
+
+/// @brief Wrap a singleton getter into a function returning a cached Python object
+///
+/// The Python wrapper is created on first call and kept alive by the returned function, hence repeated calls return
+/// the same Python object (comparable by identity) without creating a new wrapper. Since the wrapper stays registered,
+/// other bindings returning the same C++ instance (e.g. a coordinate broker's subsets) also return this object.
+///
+/// @param aGetter A getter returning the same C++ instance at each call
+/// @return Function returning the cached Python object
+template <typename Getter>
+auto cachedObject(Getter aGetter)
+{
+    const std::shared_ptr<pybind11::object> cachedObjectSPtr = std::make_shared<pybind11::object>();
+
+    return [aGetter, cachedObjectSPtr]() -> pybind11::object
+    {
+        if (!(*cachedObjectSPtr))
+        {
+            *cachedObjectSPtr = pybind11::cast(aGetter());
+        }
+
+        return *cachedObjectSPtr;
+    };
+}
+
+#endif
@@ -0,0 +1,93 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkitAstrodynamicsPy_Utility_DateTime64__
+#define __OpenSpaceToolkitAstrodynamicsPy_Utility_DateTime64__
+
+#include <cstdint>
+
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+// NumPy datetime64[ns] values count nanoseconds since 1970-01-01T00:00:00 UTC, without leap seconds. Conversions go
+// through the UTC calendar date, using the civil calendar algorithms from
+// https://howardhinnant.github.io/date_algorithms.html
+
+static constexpr std::int64_t DATETIME64_NANOSECONDS_PER_DAY = 86400000000000;
+
+/// @brief Convert a NumPy datetime64[ns] value to an instant
+inline ostk::physics::time::Instant InstantFromDateTime64(const std::int64_t& aDateTime64)
+{
+    using ostk::physics::time::DateTime;
+    using ostk::physics::time::Instant;
+    using ostk::physics::time::Scale;
+
+    std::int64_t dayCount = aDateTime64 / DATETIME64_NANOSECONDS_PER_DAY;
+    std::int64_t nanosecondOfDay = aDateTime64 % DATETIME64_NANOSECONDS_PER_DAY;
+
+    if (nanosecondOfDay < 0)
+    {
+        dayCount -= 1;
+        nanosecondOfDay += DATETIME64_NANOSECONDS_PER_DAY;
+    }
+
+    dayCount += 719468;
+
+    const std::int64_t era = ((dayCount >= 0) ? dayCount : (dayCount - 146096)) / 146097;
+    const std::int64_t dayOfEra = dayCount - era * 146097;
+    const std::int64_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    const std::int64_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    const std::int64_t monthIndex = (5 * dayOfYear + 2) / 153;
+
+    const std::int64_t day = dayOfYear - (153 * monthIndex + 2) / 5 + 1;
+    const std::int64_t month = (monthIndex < 10) ? (monthIndex + 3) : (monthIndex - 9);
+    const std::int64_t year = yearOfEra + era * 400 + ((month <= 2) ? 1 : 0);
+
+    const std::int64_t secondOfDay = nanosecondOfDay / 1000000000;
+    const std::int64_t nanosecond = nanosecondOfDay % 1000000000;
+
+    return Instant::DateTime(
+        DateTime(
+            year,
+            month,
+            day,
+            secondOfDay / 3600,
+            (secondOfDay / 60) % 60,
+            secondOfDay % 60,
+            nanosecond / 1000000,
+            (nanosecond / 1000) % 1000,
+            nanosecond % 1000
+        ),
+        Scale::UTC
+    );
+}
+
+/// @brief Convert an instant to a NumPy datetime64[ns] value
+inline std::int64_t DateTime64FromInstant(const ostk::physics::time::Instant& anInstant)
+{
+    using ostk::physics::time::DateTime;
+    using ostk::physics::time::Scale;
+
+    const DateTime dateTime = anInstant.getDateTime(Scale::UTC);
+
+    const std::int64_t month = dateTime.accessDate().getMonth();
+    const std::int64_t day = dateTime.accessDate().getDay();
+    const std::int64_t year = std::int64_t(dateTime.accessDate().getYear()) - ((month <= 2) ? 1 : 0);
+
+    const std::int64_t era = ((year >= 0) ? year : (year - 399)) / 400;
+    const std::int64_t yearOfEra = year - era * 400;
+    const std::int64_t dayOfYear = (153 * ((month > 2) ? (month - 3) : (month + 9)) + 2) / 5 + day - 1;
+    const std::int64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    const std::int64_t dayCount = era * 146097 + dayOfEra - 719468;
+
+    const std::int64_t secondOfDay = std::int64_t(dateTime.accessTime().getHour()) * 3600 +
+                                     std::int64_t(dateTime.accessTime().getMinute()) * 60 +
+                                     std::int64_t(dateTime.accessTime().getSecond());
+
+    return dayCount * DATETIME64_NANOSECONDS_PER_DAY + secondOfDay * 1000000000 +
+           std::int64_t(dateTime.accessTime().getMillisecond()) * 1000000 +
+           std::int64_t(dateTime.accessTime().getMicrosecond()) * 1000 +
+           std::int64_t(dateTime.accessTime().getNanosecond());
+}
+
+#endif
@@ -0,0 +1,106 @@
+# Apache License 2.0
+
+import math
+
+import pytest
+
+from ostk.mathematics.object import RealInterval
+
+from ostk.physics import Environment
+from ostk.physics.coordinate.spherical import AER
+from ostk.physics.unit import Angle
+from ostk.physics.unit import Length
+
+from ostk.astrodynamics.access import AerFilter
+from ostk.astrodynamics.access import Generator
+
+
+def make_aer(azimuth: float, elevation: float, range: float) -> AER:
+    return AER(Angle.degrees(azimuth), Angle.degrees(elevation), Length.meters(range))
+
+
+@pytest.fixture
+def elevation_filter() -> AerFilter:
+    return AerFilter.elevation(RealInterval.closed(10.0, 90.0))
+
+
+@pytest.fixture
+def range_filter() -> AerFilter:
+    return AerFilter.range(RealInterval.closed(0.0, 2.0e6))
+
+
+class TestAerFilter:
+    def test_intervals(self, elevation_filter: AerFilter, range_filter: AerFilter):
+        assert elevation_filter.is_defined()
+        assert elevation_filter(make_aer(0.0, 45.0, 1.0e7))
+        assert not elevation_filter(make_aer(0.0, 5.0, 1.0e6))
+
+        assert range_filter(make_aer(0.0, 0.0, 1.0e6))
+        assert not range_filter(make_aer(0.0, 45.0, 3.0e6))
+
+        ranges_filter = AerFilter.ranges(
+            RealInterval.undefined(),
+            RealInterval.closed(10.0, 90.0),
+            RealInterval.closed(0.0, 2.0e6),
+        )
+
+        assert ranges_filter(make_aer(300.0, 45.0, 1.0e6))
+        assert not ranges_filter(make_aer(300.0, 5.0, 1.0e6))
+
+    def test_mask(self):
+        mask_filter = AerFilter.mask(
+            {0.0: 10.0, 180.0: 30.0}, RealInterval.closed(0.0, 2.0e6)
+        )
+
+        assert mask_filter(make_aer(90.0, 25.0, 1.0e6))
+        assert not mask_filter(make_aer(90.0, 15.0, 1.0e6))
+
+    def test_evaluate(self):
+        mask_filter = AerFilter.mask(
+            {0.0: 10.0, 180.0: 30.0}, RealInterval.closed(0.0, 2.0e6)
+        )
+
+        assert mask_filter.evaluate(math.pi / 2.0, math.radians(25.0), 1.0e6)
+        assert not mask_filter.evaluate(math.pi / 2.0, math.radians(15.0), 1.0e6)
+        assert not mask_filter.evaluate(math.pi / 2.0, math.radians(25.0), 3.0e6)
+
+    def test_composition(self, elevation_filter: AerFilter, range_filter: AerFilter):
+        conjunction = elevation_filter & range_filter
+
+        assert conjunction(make_aer(0.0, 45.0, 1.0e6))
+        assert not conjunction(make_aer(0.0, 45.0, 3.0e6))
+
+        disjunction = elevation_filter | range_filter
+
+        assert disjunction(make_aer(0.0, 5.0, 1.0e6))
+        assert not disjunction(make_aer(0.0, 5.0, 3.0e6))
+
+        negation = ~elevation_filter
+
+        assert negation(make_aer(0.0, 5.0, 1.0e6))
+
+        assert AerFilter.all_of([elevation_filter, range_filter])(
+            make_aer(0.0, 45.0, 1.0e6)
+        )
+        assert AerFilter.any_of([elevation_filter, range_filter])(
+            make_aer(0.0, 5.0, 1.0e6)
+        )
+
+    def test_undefined(self):
+        assert not AerFilter.undefined().is_defined()
+
+        with pytest.raises(RuntimeError):
+            AerFilter.undefined()(make_aer(0.0, 45.0, 1.0e6))
+
+    def test_generator(self, elevation_filter: AerFilter, range_filter: AerFilter):
+        generator = Generator(
+            environment=Environment.default(),
+            aer_filter=elevation_filter & range_filter,
+        )
+
+        assert generator.is_defined()
+        assert generator.get_aer_filter()(make_aer(0.0, 45.0, 1.0e6))
+
+        generator.set_aer_filter(~elevation_filter)
+
+        assert generator.get_aer_filter()(make_aer(0.0, 5.0, 1.0e6))
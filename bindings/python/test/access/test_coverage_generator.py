@@ -0,0 +1,116 @@
+# Apache License 2.0
+
+import pytest
+
+from ostk.physics.unit import Length
+from ostk.physics.unit import Angle
+from ostk.physics.time import DateTime
+from ostk.physics.time import Scale
+from ostk.physics.time import Duration
+from ostk.physics.time import Instant
+from ostk.physics.time import Interval
+from ostk.physics.coordinate.spherical import LLA
+from ostk.physics import Environment
+from ostk.physics.environment.object import Celestial
+
+from ostk.astrodynamics.trajectory import Orbit
+from ostk.astrodynamics.trajectory.orbit.model import Kepler
+from ostk.astrodynamics.trajectory.orbit.model.kepler import COE
+from ostk.astrodynamics.access import CoverageGenerator
+
+
+@pytest.fixture
+def earth() -> Celestial:
+    return Environment.default().access_celestial_object_with_name("Earth")
+
+
+@pytest.fixture
+def start_instant() -> Instant:
+    return Instant.date_time(DateTime(2018, 1, 1, 0, 0, 0), Scale.UTC)
+
+
+@pytest.fixture
+def grid_points() -> list[LLA]:
+    return [
+        LLA(Angle.degrees(latitude), Angle.degrees(0.0), Length.meters(0.0))
+        for latitude in (-30.0, 0.0, 30.0, 89.0)
+    ]
+
+
+@pytest.fixture
+def satellites(earth: Celestial, start_instant: Instant) -> list[Orbit]:
+    return [
+        Orbit(
+            model=Kepler(
+                coe=COE(
+                    semi_major_axis=Length.kilometers(7000.0),
+                    eccentricity=0.0,
+                    inclination=Angle.degrees(60.0),
+                    raan=Angle.degrees(raan),
+                    aop=Angle.degrees(0.0),
+                    true_anomaly=Angle.degrees(0.0),
+                ),
+                epoch=start_instant,
+                celestial_object=earth,
+                perturbation_type=Kepler.PerturbationType.No,
+            ),
+            celestial_object=earth,
+        )
+        for raan in (0.0, 120.0)
+    ]
+
+
+@pytest.fixture
+def coverage_generator(grid_points: list[LLA], earth: Celestial) -> CoverageGenerator:
+    return CoverageGenerator(
+        grid_points=grid_points,
+        minimum_elevation=Angle.degrees(10.0),
+        celestial=earth,
+        step=Duration.minutes(1.0),
+    )
+
+
+class TestCoverageGenerator:
+    def test_constructor_success(self, coverage_generator: CoverageGenerator):
+        assert isinstance(coverage_generator, CoverageGenerator)
+        assert coverage_generator.is_defined()
+        assert len(coverage_generator.get_grid_points()) == 4
+        assert coverage_generator.get_minimum_elevation() == Angle.degrees(10.0)
+        assert coverage_generator.get_step() == Duration.minutes(1.0)
+        assert coverage_generator.get_backend() == CoverageGenerator.Backend.CPU
+
+    def test_is_backend_available_success(self):
+        assert CoverageGenerator.is_backend_available(CoverageGenerator.Backend.CPU)
+
+    def test_undefined_success(self):
+        assert CoverageGenerator.undefined().is_defined() is False
+
+    def test_compute_coverage_success(
+        self,
+        coverage_generator: CoverageGenerator,
+        satellites: list[Orbit],
+        start_instant: Instant,
+    ):
+        interval = Interval.closed(start_instant, start_instant + Duration.hours(12.0))
+
+        point_coverages = coverage_generator.compute_coverage(
+            interval=interval,
+            trajectories=satellites,
+        )
+
+        assert len(point_coverages) == 4
+
+        for point_coverage in point_coverages:
+            assert isinstance(point_coverage, CoverageGenerator.PointCoverage)
+            assert (
+                point_coverage.maximum_revisit_duration
+                >= point_coverage.mean_revisit_duration
+            )
+
+            for access_interval in point_coverage.access_intervals:
+                assert access_interval.get_start() >= interval.get_start()
+                assert access_interval.get_end() <= interval.get_end()
+
+        assert len(point_coverages[1].access_intervals) > 0
+        assert len(point_coverages[3].access_intervals) == 0
+        assert point_coverages[3].maximum_revisit_duration == interval.get_duration()
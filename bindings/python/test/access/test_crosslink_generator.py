@@ -0,0 +1,158 @@
+# Apache License 2.0
+
+import math
+
+import numpy as np
+
+import pytest
+
+from ostk.mathematics.geometry.d3.transformation.rotation import Quaternion
+from ostk.mathematics.object import RealInterval
+
+from ostk.physics.unit import Length
+from ostk.physics.unit import Angle
+from ostk.physics.time import DateTime
+from ostk.physics.time import Scale
+from ostk.physics.time import Duration
+from ostk.physics.time import Instant
+from ostk.physics.time import Interval
+from ostk.physics import Environment
+from ostk.physics.environment.object import Celestial
+
+from ostk.astrodynamics.flight import Profile
+from ostk.astrodynamics.trajectory import Orbit
+from ostk.astrodynamics.trajectory.orbit.model import Kepler
+from ostk.astrodynamics.trajectory.orbit.model.kepler import COE
+from ostk.astrodynamics.access import CrosslinkGenerator
+
+
+@pytest.fixture
+def earth() -> Celestial:
+    return Environment.default().access_celestial_object_with_name("Earth")
+
+
+@pytest.fixture
+def start_instant() -> Instant:
+    return Instant.date_time(DateTime(2018, 1, 1, 0, 0, 0), Scale.UTC)
+
+
+@pytest.fixture
+def interval(start_instant: Instant) -> Interval:
+    return Interval.closed(start_instant, start_instant + Duration.hours(12.0))
+
+
+def make_orbit(
+    earth: Celestial,
+    epoch: Instant,
+    semi_major_axis: Length,
+    true_anomaly: Angle,
+) -> Orbit:
+    return Orbit(
+        model=Kepler(
+            coe=COE(
+                semi_major_axis=semi_major_axis,
+                eccentricity=0.0,
+                inclination=Angle.degrees(0.0),
+                raan=Angle.degrees(0.0),
+                aop=Angle.degrees(0.0),
+                true_anomaly=true_anomaly,
+            ),
+            epoch=epoch,
+            celestial_object=earth,
+            perturbation_type=Kepler.PerturbationType.No,
+        ),
+        celestial_object=earth,
+    )
+
+
+@pytest.fixture
+def crosslink_generator(earth: Celestial) -> CrosslinkGenerator:
+    return CrosslinkGenerator(
+        earth=earth,
+        range_interval=RealInterval.closed(0.0, 1.0e7),
+        grazing_altitude=Length.kilometers(100.0),
+        step=Duration.minutes(1.0),
+    )
+
+
+class TestCrosslinkGenerator:
+    def test_constructor_success(self, crosslink_generator: CrosslinkGenerator):
+        assert isinstance(crosslink_generator, CrosslinkGenerator)
+        assert crosslink_generator.is_defined()
+        assert crosslink_generator.get_grazing_altitude() == Length.kilometers(100.0)
+        assert crosslink_generator.get_step() == Duration.minutes(1.0)
+
+    def test_undefined_success(self):
+        assert CrosslinkGenerator.undefined().is_defined() is False
+
+    def test_is_active_at_success(
+        self,
+        crosslink_generator: CrosslinkGenerator,
+        earth: Celestial,
+        start_instant: Instant,
+    ):
+        from_orbit = make_orbit(
+            earth, start_instant, Length.kilometers(7000.0), Angle.degrees(0.0)
+        )
+        to_orbit = make_orbit(
+            earth, start_instant, Length.kilometers(7000.0), Angle.degrees(30.0)
+        )
+
+        assert crosslink_generator.is_active_at(start_instant, from_orbit, to_orbit)
+
+    def test_compute_accesses_success(
+        self,
+        crosslink_generator: CrosslinkGenerator,
+        earth: Celestial,
+        start_instant: Instant,
+        interval: Interval,
+    ):
+        from_orbit = make_orbit(
+            earth, start_instant, Length.kilometers(7000.0), Angle.degrees(0.0)
+        )
+        to_orbit = make_orbit(
+            earth, start_instant, Length.kilometers(7500.0), Angle.degrees(0.0)
+        )
+
+        accesses = crosslink_generator.compute_accesses(
+            interval=interval,
+            from_trajectory=from_orbit,
+            to_trajectory=to_orbit,
+        )
+
+        assert len(accesses) > 0
+
+        for access in accesses:
+            assert access.get_acquisition_of_signal() >= interval.get_start()
+            assert access.get_loss_of_signal() <= interval.get_end()
+
+    def test_compute_accesses_with_field_of_view_success(
+        self,
+        crosslink_generator: CrosslinkGenerator,
+        earth: Celestial,
+        start_instant: Instant,
+        interval: Interval,
+    ):
+        from_orbit = make_orbit(
+            earth, start_instant, Length.kilometers(7000.0), Angle.degrees(0.0)
+        )
+        to_orbit = make_orbit(
+            earth, start_instant, Length.kilometers(7000.0), Angle.degrees(30.0)
+        )
+
+        field_of_view = CrosslinkGenerator.FieldOfView(
+            boresight=np.array(
+                [math.cos(math.radians(105.0)), math.sin(math.radians(105.0)), 0.0]
+            ),
+            half_angle=Angle.degrees(10.0),
+        )
+
+        accesses = crosslink_generator.compute_accesses(
+            interval=interval,
+            from_profile=Profile.inertial_pointing(from_orbit, Quaternion.unit()),
+            field_of_view=field_of_view,
+            to_trajectory=to_orbit,
+        )
+
+        assert len(accesses) > 0
+        assert accesses[0].get_acquisition_of_signal() == start_instant
@@ -185,6 +185,29 @@ class TestGenerator:
         assert accesses[0] is not None
         assert isinstance(accesses[0], Access)
 
+    def test_compute_accesses_multiple_trajectories_success(
+        self,
+        generator: Generator,
+        from_trajectory: Trajectory,
+        to_trajectory: Trajectory,
+    ):
+        accesses = generator.compute_accesses(
+            interval=Interval.closed(
+                Instant.date_time(DateTime(2018, 1, 1, 0, 0, 0), Scale.UTC),
+                Instant.date_time(DateTime(2018, 1, 1, 2, 0, 0), Scale.UTC),
+            ),
+            from_trajectories=[from_trajectory],
+            to_trajectories=[to_trajectory, to_trajectory],
+            thread_count=2,
+        )
+
+        assert accesses is not None
+        assert isinstance(accesses, list)
+        assert len(accesses) == 1
+        assert len(accesses[0]) == 2
+        assert isinstance(accesses[0][0][0], Access)
+        assert accesses[0][0] == accesses[0][1]
+
     def test_set_step_success(self, generator: Generator):
         generator.set_step(Duration.seconds(1.0))
 
@@ -200,6 +223,65 @@ class TestGenerator:
     def test_set_state_filter_success(self, generator: Generator):
         generator.set_state_filter(state_filter=lambda state_1, state_2: True)
 
+    def test_screening_success(self, generator: Generator):
+        assert generator.is_screening_enabled() is False
+
+        generator.enable_screening(
+            minimum_elevation=Angle.degrees(10.0),
+            maximum_range=Length.kilometers(3000.0),
+        )
+
+        assert generator.is_screening_enabled() is True
+        assert generator.get_screening_minimum_elevation() == Angle.degrees(10.0)
+        assert generator.get_screening_maximum_range() == Length.kilometers(3000.0)
+
+        generator.disable_screening()
+
+        assert generator.is_screening_enabled() is False
+
+    def test_statistics_success(
+        self,
+        generator: Generator,
+        from_trajectory: Trajectory,
+        to_trajectory: Trajectory,
+    ):
+        assert generator.is_statistics_enabled() is False
+
+        generator.enable_statistics()
+
+        assert generator.is_statistics_enabled() is True
+
+        generator.compute_accesses(
+            interval=Interval.closed(
+                Instant.date_time(DateTime(2018, 1, 1, 0, 0, 0), Scale.UTC),
+                Instant.date_time(DateTime(2018, 1, 1, 2, 0, 0), Scale.UTC),
+            ),
+            from_trajectory=from_trajectory,
+            to_trajectory=to_trajectory,
+        )
+
+        statistics: Generator.Statistics = generator.get_statistics()
+
+        assert statistics.condition_evaluation_count > 0
+        assert statistics.state_query_count == statistics.condition_evaluation_count
+        assert isinstance(statistics.condition_evaluation_duration, Duration)
+
+        statistics_dict: dict = statistics.to_dict()
+
+        assert statistics_dict["state_query_count"] == statistics.state_query_count
+        assert isinstance(statistics_dict["condition_evaluation_duration"], float)
+
+        assert generator.get_statistics(reset=True).condition_evaluation_count > 0
+        assert generator.get_statistics().condition_evaluation_count == 0
+
+        generator.reset_statistics()
+
+        assert generator.get_statistics().condition_evaluation_count == 0
+
+        generator.disable_statistics()
+
+        assert generator.is_statistics_enabled() is False
+
     def test_undefined_success(self):
         generator = Generator.undefined()
 
@@ -0,0 +1,133 @@
+# Apache License 2.0
+
+import pytest
+
+from ostk.physics.unit import Length
+from ostk.physics.unit import Angle
+from ostk.physics.time import DateTime
+from ostk.physics.time import Scale
+from ostk.physics.time import Duration
+from ostk.physics.time import Instant
+from ostk.physics.time import Interval
+from ostk.physics import Environment
+from ostk.physics.environment.object import Celestial
+
+from ostk.astrodynamics import Trajectory
+from ostk.astrodynamics.trajectory import Orbit
+from ostk.astrodynamics.trajectory.orbit.model import Kepler
+from ostk.astrodynamics.trajectory.orbit.model.kepler import COE
+from ostk.astrodynamics.access import Generator
+from ostk.astrodynamics.access import IncrementalGenerator
+
+
+@pytest.fixture
+def environment() -> Environment:
+    return Environment.default()
+
+
+@pytest.fixture
+def earth(environment: Environment) -> Celestial:
+    return environment.access_celestial_object_with_name("Earth")
+
+
+@pytest.fixture
+def generator(environment: Environment) -> Generator:
+    return Generator(environment=environment)
+
+
+@pytest.fixture
+def start_instant() -> Instant:
+    return Instant.date_time(DateTime(2018, 1, 1, 0, 0, 0), Scale.UTC)
+
+
+def generate_orbit(earth: Celestial, epoch: Instant, raan: Angle) -> Orbit:
+    return Orbit(
+        model=Kepler(
+            coe=COE(
+                semi_major_axis=Length.kilometers(7000.0),
+                eccentricity=0.0,
+                inclination=Angle.degrees(45.0),
+                raan=raan,
+                aop=Angle.degrees(0.0),
+                true_anomaly=Angle.degrees(0.0),
+            ),
+            epoch=epoch,
+            celestial_object=earth,
+            perturbation_type=Kepler.PerturbationType.No,
+        ),
+        celestial_object=earth,
+    )
+
+
+@pytest.fixture
+def from_trajectory(earth: Celestial, start_instant: Instant) -> Trajectory:
+    return generate_orbit(earth, start_instant, Angle.degrees(0.0))
+
+
+@pytest.fixture
+def to_trajectory(earth: Celestial, start_instant: Instant) -> Trajectory:
+    return generate_orbit(earth, start_instant, Angle.degrees(90.0))
+
+
+@pytest.fixture
+def incremental_generator(
+    generator: Generator,
+    from_trajectory: Trajectory,
+    to_trajectory: Trajectory,
+) -> IncrementalGenerator:
+    return IncrementalGenerator(
+        generator=generator,
+        from_trajectory=from_trajectory,
+        to_trajectory=to_trajectory,
+    )
+
+
+class TestIncrementalGenerator:
+    def test_constructor_success(self, incremental_generator: IncrementalGenerator):
+        assert incremental_generator is not None
+        assert isinstance(incremental_generator, IncrementalGenerator)
+        assert incremental_generator.is_defined()
+
+    def test_undefined_success(self):
+        assert IncrementalGenerator.undefined().is_defined() is False
+
+    def test_compute_accesses_success(
+        self,
+        incremental_generator: IncrementalGenerator,
+        generator: Generator,
+        from_trajectory: Trajectory,
+        to_trajectory: Trajectory,
+        start_instant: Instant,
+    ):
+        assert incremental_generator.get_interval().is_defined() is False
+
+        for tick_index in range(4):
+            window_start_instant = start_instant + Duration.minutes(47.0 * tick_index)
+            interval = Interval.closed(
+                window_start_instant, window_start_instant + Duration.hours(12.0)
+            )
+
+            accesses = incremental_generator.compute_accesses(interval=interval)
+            reference_accesses = generator.compute_accesses(
+                interval=interval,
+                from_trajectory=from_trajectory,
+                to_trajectory=to_trajectory,
+            )
+
+            assert len(accesses) == len(reference_accesses)
+            assert incremental_generator.get_interval() == interval
+
+            for access, reference_access in zip(accesses, reference_accesses):
+                assert access.get_type() == reference_access.get_type()
+                assert access.get_acquisition_of_signal().is_near(
+                    reference_access.get_acquisition_of_signal(),
+                    Duration.milliseconds(1.0),
+                )
+                assert access.get_loss_of_signal().is_near(
+                    reference_access.get_loss_of_signal(),
+                    Duration.milliseconds(1.0),
+                )
+
+        incremental_generator.reset()
+
+        assert incremental_generator.get_interval().is_defined() is False
@@ -0,0 +1,89 @@
+# Apache License 2.0
+
+import pytest
+
+from ostk.physics.time import DateTime
+from ostk.physics.time import Scale
+from ostk.physics.time import Duration
+from ostk.physics.time import Instant
+from ostk.physics.time import Interval
+
+from ostk.astrodynamics.access import IntervalSet
+from ostk.astrodynamics.access import IntervalTree
+
+
+@pytest.fixture
+def reference_instant() -> Instant:
+    return Instant.date_time(DateTime(2018, 1, 1, 0, 0, 0), Scale.UTC)
+
+
+@pytest.fixture
+def make_interval(reference_instant: Instant):
+    def _make_interval(start_minute: float, end_minute: float) -> Interval:
+        return Interval.closed(
+            reference_instant + Duration.minutes(start_minute),
+            reference_instant + Duration.minutes(end_minute),
+        )
+
+    return _make_interval
+
+
+class TestIntervalSet:
+    def test_constructor_success(self, make_interval):
+        interval_set = IntervalSet(
+            [
+                make_interval(20.0, 30.0),
+                make_interval(0.0, 10.0),
+                make_interval(5.0, 20.0),
+            ]
+        )
+
+        assert interval_set.get_size() == 1
+        assert interval_set.get_intervals() == [make_interval(0.0, 30.0)]
+        assert interval_set.get_duration() == Duration.minutes(30.0)
+        assert IntervalSet.empty().is_empty()
+
+    def test_set_operations_success(self, make_interval, reference_instant: Instant):
+        first_interval_set = IntervalSet(
+            [make_interval(0.0, 10.0), make_interval(20.0, 30.0)]
+        )
+        second_interval_set = IntervalSet(
+            [make_interval(5.0, 25.0), make_interval(30.0, 40.0)]
+        )
+
+        union = first_interval_set.union_with(second_interval_set)
+        intersection = first_interval_set.intersection_with(second_interval_set)
+        difference = first_interval_set.difference_with(second_interval_set)
+        complement = first_interval_set.complement_in(make_interval(0.0, 30.0))
+
+        assert union == IntervalSet([make_interval(0.0, 40.0)])
+        assert intersection == IntervalSet(
+            [make_interval(5.0, 10.0), make_interval(20.0, 25.0)]
+        )
+        assert difference == IntervalSet(
+            [make_interval(0.0, 5.0), make_interval(25.0, 30.0)]
+        )
+        assert complement == IntervalSet([make_interval(10.0, 20.0)])
+
+        assert first_interval_set.contains(reference_instant + Duration.minutes(5.0))
+        assert not first_interval_set.contains(
+            reference_instant + Duration.minutes(15.0)
+        )
+
+
+class TestIntervalTree:
+    def test_query_success(self, make_interval, reference_instant: Instant):
+        interval_tree = IntervalTree(
+            [
+                make_interval(20.0, 30.0),
+                make_interval(0.0, 100.0),
+                make_interval(25.0, 26.0),
+                make_interval(40.0, 50.0),
+            ]
+        )
+
+        assert interval_tree.get_size() == 4
+        assert interval_tree.query_containing(
+            reference_instant + Duration.minutes(25.0)
+        ) == [0, 1, 2]
+        assert interval_tree.query_overlapping(make_interval(28.0, 45.0)) == [0, 1, 3]
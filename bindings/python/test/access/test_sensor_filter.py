@@ -0,0 +1,164 @@
+# Apache License 2.0
+
+import math
+
+import numpy as np
+
+import pytest
+
+from ostk.mathematics.geometry.d3.transformation.rotation import Quaternion
+
+from ostk.physics import Environment
+from ostk.physics.coordinate import Frame
+from ostk.physics.coordinate import Position
+from ostk.physics.environment.object import Celestial
+from ostk.physics.time import DateTime
+from ostk.physics.time import Duration
+from ostk.physics.time import Instant
+from ostk.physics.time import Interval
+from ostk.physics.time import Scale
+from ostk.physics.unit import Angle
+from ostk.physics.unit import Length
+
+from ostk.astrodynamics import Trajectory
+from ostk.astrodynamics.access import Generator
+from ostk.astrodynamics.access import SensorFilter
+from ostk.astrodynamics.flight import Profile
+from ostk.astrodynamics.trajectory import Orbit
+from ostk.astrodynamics.trajectory.orbit.model import Kepler
+from ostk.astrodynamics.trajectory.orbit.model.kepler import COE
+
+
+@pytest.fixture
+def earth() -> Celestial:
+    return Environment.default().access_celestial_object_with_name("Earth")
+
+
+@pytest.fixture
+def start_instant() -> Instant:
+    return Instant.date_time(DateTime(2018, 1, 1, 0, 0, 0), Scale.UTC)
+
+
+@pytest.fixture
+def interval(start_instant: Instant) -> Interval:
+    return Interval.closed(start_instant, start_instant + Duration.hours(6.0))
+
+
+@pytest.fixture
+def orbit(earth: Celestial, start_instant: Instant) -> Orbit:
+    return Orbit(
+        model=Kepler(
+            coe=COE(
+                semi_major_axis=Length.kilometers(7000.0),
+                eccentricity=0.0,
+                inclination=Angle.degrees(45.0),
+                raan=Angle.degrees(0.0),
+                aop=Angle.degrees(0.0),
+                true_anomaly=Angle.degrees(0.0),
+            ),
+            epoch=start_instant,
+            celestial_object=earth,
+            perturbation_type=Kepler.PerturbationType.No,
+        ),
+        celestial_object=earth,
+    )
+
+
+@pytest.fixture
+def cone_filter(orbit: Orbit, interval: Interval) -> SensorFilter:
+    return SensorFilter.cone(
+        profile=Profile.inertial_pointing(orbit, Quaternion.unit()),
+        sensor_attitude=Quaternion.unit(),
+        half_angle=Angle.degrees(10.0),
+        interval=interval,
+    )
+
+
+class TestSensorFilter:
+    def test_constructor_success(self, cone_filter: SensorFilter, interval: Interval):
+        assert cone_filter.is_defined()
+        assert cone_filter.get_shape() == SensorFilter.Shape.Cone
+        assert cone_filter.get_interval() == interval
+        assert cone_filter.get_step() == Duration.seconds(10.0)
+
+        assert not SensorFilter.undefined().is_defined()
+
+    def test_evaluate_success(
+        self,
+        cone_filter: SensorFilter,
+        orbit: Orbit,
+        interval: Interval,
+        start_instant: Instant,
+    ):
+        observer = np.array([7.0e6, 0.0, 0.0])
+
+        def direction(x_angle: float, y_angle: float) -> np.ndarray:
+            return np.array(
+                [math.tan(math.radians(x_angle)), math.tan(math.radians(y_angle)), 1.0]
+            )
+
+        assert cone_filter.evaluate(
+            start_instant, observer, observer + 1.0e6 * direction(9.0, 0.0)
+        )
+        assert not cone_filter.evaluate(
+            start_instant, observer, observer + 1.0e6 * direction(11.0, 0.0)
+        )
+
+        rectangle_filter = SensorFilter.rectangle(
+            profile=Profile.inertial_pointing(orbit, Quaternion.unit()),
+            sensor_attitude=Quaternion.unit(),
+            horizontal_half_angle=Angle.degrees(10.0),
+            vertical_half_angle=Angle.degrees(5.0),
+            interval=interval,
+        )
+
+        assert rectangle_filter.evaluate(
+            start_instant, observer, observer + 1.0e6 * direction(9.0, 4.0)
+        )
+        assert not rectangle_filter.evaluate(
+            start_instant, observer, observer + 1.0e6 * direction(0.0, 6.0)
+        )
+
+    def test_generator_success(self, orbit: Orbit, interval: Interval):
+        # Ground target below the satellite, one hour into the interval
+        sub_satellite_direction = (
+            orbit.get_state_at(interval.get_start() + Duration.hours(1.0))
+            .in_frame(Frame.ITRF())
+            .get_position()
+            .get_coordinates()
+        )
+        sub_satellite_direction /= np.linalg.norm(sub_satellite_direction)
+
+        target_trajectory = Trajectory.position(
+            Position.meters(6378137.0 * sub_satellite_direction, Frame.ITRF())
+        )
+
+        sensor_filter = SensorFilter.cone(
+            profile=Profile.nadir_pointing(orbit, Orbit.FrameType.VVLH),
+            sensor_attitude=Quaternion.unit(),
+            half_angle=Angle.degrees(30.0),
+            interval=interval,
+        )
+
+        native_generator = Generator(Environment.default())
+        native_generator.set_state_filter(sensor_filter)
+
+        closure_generator = Generator(Environment.default())
+        closure_generator.set_state_filter(
+            lambda from_state, to_state: sensor_filter(from_state, to_state)
+        )
+
+        native_accesses = native_generator.compute_accesses(
+            interval, target_trajectory, orbit
+        )
+        closure_accesses = closure_generator.compute_accesses(
+            interval, target_trajectory, orbit
+        )
+
+        assert len(native_accesses) > 0
+        assert len(native_accesses) == len(closure_accesses)
+
+        for native_access, closure_access in zip(native_accesses, closure_accesses):
+            assert native_access.get_acquisition_of_signal().is_near(
+                closure_access.get_acquisition_of_signal(), Duration.milliseconds(1.0)
+            )
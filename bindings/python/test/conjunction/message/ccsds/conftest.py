@@ -18,6 +18,11 @@ def cdm_file(data_directory_path: str) -> File:
     return File.path(Path.parse(f"{data_directory_path}/cdm.json"))
 
 
+@pytest.fixture
+def cdm_kvn_file(data_directory_path: str) -> File:
+    return File.path(Path.parse(f"{data_directory_path}/cdm.kvn"))
+
+
 @pytest.fixture
 def cdm_spacetrack_dictionary() -> dict:
     return {
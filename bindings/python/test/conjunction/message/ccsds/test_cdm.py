@@ -405,6 +405,59 @@ class TestCDM:
     def test_load(self, cdm_file: File):
         assert CDM.load(file=cdm_file) is not None
 
+    def test_load_kvn(self, cdm_kvn_file: File):
+        cdm = CDM.load_kvn(file=cdm_kvn_file)
+
+        assert cdm.get_originator() == "CSpOC"
+        assert cdm.get_object_metadata_at(0).object_designator == 48911
+        assert cdm.get_object_metadata_at(1).object_name == "COSMOS 1602"
+
+        with open(str(cdm_kvn_file.get_path().to_string()), "r") as stream:
+            assert (
+                CDM.parse_kvn(string=stream.read()).get_message_id()
+                == cdm.get_message_id()
+            )
+
+    def test_parse_array(self, cdm_file: File):
+        cdm = CDM.load(file=cdm_file)
+
+        with open(cdm_file.get_path().to_string(), "r") as stream:
+            contents = stream.read()
+
+        cdms = CDM.parse_array(string=f"[{contents}, {contents}]")
+
+        assert len(cdms) == 2
+
+        for parsed_cdm in cdms:
+            assert parsed_cdm.get_message_id() == cdm.get_message_id()
+            assert (
+                parsed_cdm.get_time_of_closest_approach()
+                == cdm.get_time_of_closest_approach()
+            )
+            assert parsed_cdm.get_miss_distance() == cdm.get_miss_distance()
+
+        assert CDM.parse_array(string="[]") == []
+
+    def test_compute_collision_probability(self, cdm_kvn_file: File):
+        cdm = CDM.load_kvn(file=cdm_kvn_file)
+
+        probability = cdm.compute_collision_probability(
+            hard_body_radius=Length.meters(20.0)
+        )
+
+        assert 0.0 <= probability <= 1.0
+        assert probability <= cdm.compute_collision_probability(
+            hard_body_radius=Length.meters(40.0)
+        )
+
+        probabilities = CDM.compute_collision_probabilities(
+            cdms=[cdm, cdm],
+            hard_body_radius=Length.meters(20.0),
+            thread_count=2,
+        )
+
+        assert probabilities == [probability, probability]
+
     def test_object_type_from_string(self):
         assert CDM.object_type_from_string("PAYLOAD") == CDM.ObjectType.Payload
         assert CDM.object_type_from_string("ROCKET BODY") == CDM.ObjectType.RocketBody
@@ -0,0 +1,109 @@
+# Apache License 2.0
+
+import pytest
+
+import pathlib
+
+import numpy as np
+
+from ostk.core.filesystem import Path
+from ostk.core.filesystem import File
+
+from ostk.physics.unit import Length
+from ostk.physics.time import Duration
+from ostk.physics.environment.object.celestial import Earth
+
+from ostk.astrodynamics.trajectory import Propagator
+from ostk.astrodynamics.trajectory.state import NumericalSolver
+from ostk.astrodynamics.dynamics import CentralBodyGravity
+from ostk.astrodynamics.dynamics import PositionDerivative
+from ostk.astrodynamics.conjunction import AvoidanceManeuverSolver
+from ostk.astrodynamics.conjunction.message.ccsds import CDM
+
+
+@pytest.fixture
+def cdm() -> CDM:
+    return CDM.load_kvn(
+        file=File.path(
+            Path.parse(
+                f"{pathlib.Path(__file__).parent.absolute()}/message/ccsds/data/cdm.kvn"
+            )
+        )
+    )
+
+
+@pytest.fixture
+def propagator() -> Propagator:
+    return Propagator(
+        NumericalSolver(
+            NumericalSolver.LogType.NoLog,
+            NumericalSolver.StepperType.RungeKuttaFehlberg78,
+            5.0,
+            1.0e-12,
+            1.0e-12,
+        ),
+        [PositionDerivative(), CentralBodyGravity(Earth.spherical())],
+    )
+
+
+@pytest.fixture
+def solver(propagator: Propagator) -> AvoidanceManeuverSolver:
+    return AvoidanceManeuverSolver(
+        propagator=propagator,
+        hard_body_radius=Length.meters(20.0),
+        collision_probability_threshold=1e-4,
+        refinement_count=3,
+        thread_count=2,
+    )
+
+
+class TestAvoidanceManeuverSolver:
+    def test_constructor(self, solver: AvoidanceManeuverSolver):
+        assert solver is not None
+        assert isinstance(solver, AvoidanceManeuverSolver)
+        assert solver.is_defined()
+        assert not AvoidanceManeuverSolver.undefined().is_defined()
+
+    def test_getters(self, solver: AvoidanceManeuverSolver):
+        assert solver.get_propagator() is not None
+        assert solver.get_hard_body_radius() == Length.meters(20.0)
+        assert solver.get_collision_probability_threshold() == 1e-4
+        assert solver.get_refinement_count() == 3
+        assert solver.get_thread_count() == 2
+
+    def test_solve(self, solver: AvoidanceManeuverSolver, cdm: CDM):
+        candidates = solver.solve(
+            cdm=cdm,
+            lead_times=[Duration.minutes(10.0), Duration.minutes(30.0)],
+            directions_rtn=[
+                np.array([0.0, 1.0, 0.0]),
+                np.array([0.0, -1.0, 0.0]),
+                np.array([1.0, 0.0, 0.0]),
+            ],
+            delta_v_magnitudes=[0.0, 0.1, 1.0],
+        )
+
+        assert len(candidates) == 18
+        assert [candidate.is_refined for candidate in candidates] == [
+            True
+        ] * 3 + [False] * 15
+
+        for candidate in candidates:
+            assert isinstance(candidate, AvoidanceManeuverSolver.Candidate)
+            assert np.linalg.norm(candidate.direction_rtn) == pytest.approx(1.0)
+            assert 0.0 <= candidate.collision_probability <= 1.0
+            assert candidate.miss_distance.in_meters() >= 0.0
+            assert (
+                candidate.instant
+                == cdm.get_time_of_closest_approach() - candidate.lead_time
+            )
+
+        nominal_collision_probability = cdm.compute_collision_probability(
+            hard_body_radius=Length.meters(20.0)
+        )
+
+        for candidate in candidates:
+            if candidate.delta_v_magnitude == 0.0:
+                assert candidate.collision_probability == pytest.approx(
+                    nominal_collision_probability, abs=1e-9
+                )
@@ -0,0 +1,118 @@
+# Apache License 2.0
+
+import pytest
+
+from ostk.physics.unit import Length
+from ostk.physics.unit import Angle
+from ostk.physics.time import DateTime
+from ostk.physics.time import Scale
+from ostk.physics.time import Duration
+from ostk.physics.time import Instant
+from ostk.physics.time import Interval
+from ostk.physics import Environment
+from ostk.physics.environment.object import Celestial
+
+from ostk.astrodynamics.trajectory import Orbit
+from ostk.astrodynamics.trajectory.orbit.model import Kepler
+from ostk.astrodynamics.trajectory.orbit.model.kepler import COE
+from ostk.astrodynamics.trajectory.orbit.model.sgp4 import TLE
+from ostk.astrodynamics.conjunction import Screener
+
+
+@pytest.fixture
+def earth() -> Celestial:
+    return Environment.default().access_celestial_object_with_name("Earth")
+
+
+@pytest.fixture
+def epoch() -> Instant:
+    return Instant.date_time(DateTime(2018, 1, 1, 0, 0, 0), Scale.UTC)
+
+
+@pytest.fixture
+def screener() -> Screener:
+    return Screener(
+        screening_distance=Length.kilometers(5.0),
+        step=Duration.seconds(30.0),
+        tolerance=Duration.milliseconds(1.0),
+        thread_count=2,
+    )
+
+
+def circular_orbit(
+    earth: Celestial, epoch: Instant, semi_major_axis: Length, inclination: Angle
+) -> Orbit:
+    return Orbit(
+        model=Kepler(
+            coe=COE(
+                semi_major_axis=semi_major_axis,
+                eccentricity=0.0,
+                inclination=inclination,
+                raan=Angle.degrees(0.0),
+                aop=Angle.degrees(0.0),
+                true_anomaly=Angle.degrees(0.0),
+            ),
+            epoch=epoch,
+            celestial_object=earth,
+            perturbation_type=Kepler.PerturbationType.No,
+        ),
+        celestial_object=earth,
+    )
+
+
+class TestScreener:
+    def test_constructor(self, screener: Screener):
+        assert screener is not None
+        assert isinstance(screener, Screener)
+        assert screener.is_defined()
+
+        assert Screener(screening_distance=Length.kilometers(5.0)).is_defined()
+
+    def test_undefined(self):
+        assert Screener.undefined().is_defined() is False
+
+    def test_getters(self, screener: Screener):
+        assert screener.get_screening_distance() == Length.kilometers(5.0)
+        assert screener.get_step() == Duration.seconds(30.0)
+        assert screener.get_tolerance() == Duration.milliseconds(1.0)
+        assert screener.get_thread_count() == 2
+
+    def test_screen(self, screener: Screener, earth: Celestial, epoch: Instant):
+        trajectories = [
+            circular_orbit(earth, epoch, Length.kilometers(7000.0), Angle.degrees(0.0)),
+            circular_orbit(earth, epoch, Length.kilometers(7000.0), Angle.degrees(90.0)),
+            circular_orbit(earth, epoch, Length.kilometers(7100.0), Angle.degrees(0.0)),
+        ]
+
+        interval = Interval.closed(
+            epoch - Duration.minutes(20.25), epoch + Duration.minutes(20.0)
+        )
+
+        conjunctions = screener.screen(trajectories=trajectories, interval=interval)
+
+        assert len(conjunctions) == 1
+
+        conjunction = conjunctions[0]
+
+        assert conjunction.first_object_index == 0
+        assert conjunction.second_object_index == 1
+        assert (
+            conjunction.relative_metadata.time_of_closest_approach - epoch
+        ).get_absolute() < Duration.milliseconds(10.0)
+        assert conjunction.relative_metadata.miss_distance.in_meters() < 100.0
+        assert conjunction.relative_metadata.screen_volume_shape == "SPHERE"
+        assert len(conjunction.relative_position_rtn) == 3
+        assert len(conjunction.data_array) == 2
+
+    def test_screen_tles(self, screener: Screener):
+        tle = TLE(
+            "1 25544U 98067A   18231.17878740  .00000187  00000-0  10196-4 0  9994",
+            "2 25544  51.6447  64.7824 0005971  73.1467  36.4366 15.53848234128316",
+        )
+
+        interval = Interval.closed(tle.get_epoch(), tle.get_epoch() + Duration.hours(1.0))
+
+        conjunctions = screener.screen(tles=[tle, tle], interval=interval)
+
+        assert len(conjunctions) == 1
+        assert conjunctions[0].relative_metadata.time_of_closest_approach == interval.get_start()
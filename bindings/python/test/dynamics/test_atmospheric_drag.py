@@ -9,6 +9,7 @@ from ostk.mathematics.geometry.d3.object import Composite
 from ostk.mathematics.geometry.d3.object import Point
 
 from ostk.physics.unit import Mass
+from ostk.physics.unit import Length
 from ostk.physics.time import Instant
 from ostk.physics.time import DateTime
 from ostk.physics.time import Scale
@@ -33,6 +34,7 @@ from ostk.astrodynamics.trajectory.state.coordinate_subset import (
 )
 from ostk.astrodynamics import Dynamics
 from ostk.astrodynamics.dynamics import AtmosphericDrag
+from ostk.astrodynamics.flight.system import SatelliteSystem
 
 
 @pytest.fixture
@@ -126,3 +128,66 @@ class TestAtmosphericDrag:
         )
 
         assert len(contribution) == 3
+
+    def test_density_table(
+        self, dynamics: AtmosphericDrag, earth: Earth, state: State
+    ):
+        density_table: AtmosphericDrag.DensityTable = AtmosphericDrag.DensityTable(
+            earth,
+            state.get_instant(),
+            Length.kilometers(200.0),
+            Length.kilometers(1000.0),
+        )
+
+        assert density_table.get_minimum_altitude() == Length.kilometers(200.0)
+        assert density_table.is_applicable_at(np.array([7000000.0, 0.0, 0.0]))
+        assert density_table.get_density_at(
+            np.array([7000000.0, 0.0, 0.0]), state.get_instant()
+        ) > 0.0
+
+        assert dynamics.get_density_table() is None
+
+        tabulated_dynamics: AtmosphericDrag = AtmosphericDrag(earth, density_table)
+
+        assert tabulated_dynamics.get_density_table() is not None
+
+        contribution = dynamics.compute_contribution(
+            state.get_instant(), state.get_coordinates(), state.get_frame()
+        )
+        tabulated_contribution = tabulated_dynamics.compute_contribution(
+            state.get_instant(), state.get_coordinates(), state.get_frame()
+        )
+
+        assert tabulated_contribution == pytest.approx(contribution, rel=1e-2)
+
+    def test_projected_area_table(
+        self, dynamics: AtmosphericDrag, earth: Earth, state: State
+    ):
+        projected_area_table = SatelliteSystem.ProjectedAreaTable(
+            Composite(
+                Cuboid(
+                    Point(0.0, 0.0, 0.0),
+                    [[1.0, 0.0, 0.0], [0.0, 1.0, 0.0], [0.0, 0.0, 1.0]],
+                    [1.0, 2.0, 3.0],
+                )
+            )
+        )
+
+        assert dynamics.get_projected_area_table() is None
+
+        attitude_dynamics: AtmosphericDrag = AtmosphericDrag(
+            earth, None, projected_area_table
+        )
+
+        assert attitude_dynamics.get_projected_area_table() is not None
+        assert len(attitude_dynamics.get_read_coordinate_subsets()) == 5
+
+        coordinates = state.get_coordinates()
+
+        contribution = attitude_dynamics.compute_contribution(
+            state.get_instant(),
+            np.concatenate((coordinates[:7], coordinates[8:9], [0.0, 0.0, 0.0, 1.0])),
+            state.get_frame(),
+        )
+
+        assert len(contribution) == 3
@@ -10,6 +10,7 @@ from ostk.physics.time import Scale
 from ostk.physics.coordinate import Position
 from ostk.physics.coordinate import Velocity
 from ostk.physics.coordinate import Frame
+from ostk.physics.unit import Length
 from ostk.physics.environment.object.celestial import Earth
 
 from ostk.astrodynamics.trajectory import State
@@ -56,3 +57,27 @@ class TestCentralBodyGravity:
 
         assert len(contribution) == 3
         assert contribution == pytest.approx([-8.134702887755102, 0.0, 0.0])
+
+    def test_altitude_bands(self, earth: Earth, state: State):
+        spherical_earth: Earth = Earth.spherical()
+
+        dynamics: CentralBodyGravity = CentralBodyGravity(
+            earth,
+            [
+                CentralBodyGravity.AltitudeBand(
+                    Length.kilometers(100.0), spherical_earth
+                ),
+            ],
+        )
+
+        assert dynamics.is_defined()
+        assert len(dynamics.get_altitude_bands()) == 1
+        assert dynamics.get_altitude_bands()[0].minimum_altitude == Length.kilometers(
+            100.0
+        )
+
+        contribution = dynamics.compute_contribution(
+            state.get_instant(), state.get_coordinates(), state.get_frame()
+        )
+
+        assert contribution == pytest.approx([-8.134702887755102, 0.0, 0.0])
@@ -0,0 +1,115 @@
+# Apache License 2.0
+
+import pytest
+
+import numpy as np
+
+from ostk.physics.time import Instant
+from ostk.physics.time import DateTime
+from ostk.physics.time import Scale
+from ostk.physics.time import Duration
+from ostk.physics.time import Interval
+from ostk.physics.coordinate import Frame
+from ostk.physics.environment.object.celestial import Earth
+from ostk.physics.environment.object.celestial import Sun
+
+from ostk.astrodynamics import Dynamics
+from ostk.astrodynamics.dynamics import SolarRadiationPressure
+from ostk.astrodynamics.dynamics import ThirdBodyGravity
+
+
+@pytest.fixture
+def sun() -> Sun:
+    return Sun.spherical()
+
+
+@pytest.fixture
+def earth() -> Earth:
+    return Earth.spherical()
+
+
+@pytest.fixture
+def dynamics(sun: Sun, earth: Earth) -> SolarRadiationPressure:
+    return SolarRadiationPressure(sun, earth, 1.5)
+
+
+@pytest.fixture
+def instant() -> Instant:
+    return Instant.date_time(DateTime(2021, 3, 20, 12, 0, 0), Scale.UTC)
+
+
+@pytest.fixture
+def coordinates() -> np.ndarray:
+    # Position [m], mass [kg] and surface area [m^2]
+    return np.array([7000000.0, 0.0, 0.0, 100.0, 2.0])
+
+
+class TestSolarRadiationPressure:
+    def test_constructors(
+        self,
+        dynamics: SolarRadiationPressure,
+    ):
+        assert dynamics is not None
+        assert isinstance(dynamics, SolarRadiationPressure)
+        assert isinstance(dynamics, Dynamics)
+        assert dynamics.is_defined()
+
+    def test_getters(
+        self,
+        dynamics: SolarRadiationPressure,
+        sun: Sun,
+        earth: Earth,
+    ):
+        assert dynamics.get_sun() == sun
+        assert dynamics.get_occulting_celestial() == earth
+        assert dynamics.get_reflectivity_coefficient() == 1.5
+        assert dynamics.get_sun_ephemeris_table() is None
+
+    def test_compute_contribution(
+        self,
+        dynamics: SolarRadiationPressure,
+        instant: Instant,
+        coordinates: np.ndarray,
+    ):
+        contribution = dynamics.compute_contribution(instant, coordinates, Frame.GCRF())
+
+        assert len(contribution) == 3
+        assert np.linalg.norm(contribution) == pytest.approx(
+            4.56e-6 * 1.5 * 2.0 / 100.0, rel=3.5e-2
+        )
+        assert contribution[0] < 0.0
+
+        shadowed_contribution = dynamics.compute_contribution(
+            instant, np.array([-7000000.0, 0.0, 0.0, 100.0, 2.0]), Frame.GCRF()
+        )
+
+        assert np.linalg.norm(shadowed_contribution) == pytest.approx(0.0)
+
+    def test_sun_ephemeris_table(
+        self,
+        dynamics: SolarRadiationPressure,
+        sun: Sun,
+        earth: Earth,
+        instant: Instant,
+        coordinates: np.ndarray,
+    ):
+        sun_ephemeris_table: ThirdBodyGravity.EphemerisTable = (
+            ThirdBodyGravity.EphemerisTable(
+                sun,
+                Interval.closed(instant, instant + Duration.days(1.0)),
+                Frame.GCRF(),
+            )
+        )
+
+        tabulated_dynamics: SolarRadiationPressure = SolarRadiationPressure(
+            sun, earth, 1.5, sun_ephemeris_table
+        )
+
+        assert tabulated_dynamics.get_sun_ephemeris_table() is not None
+
+        assert tabulated_dynamics.compute_contribution(
+            instant, coordinates, Frame.GCRF()
+        ) == pytest.approx(
+            dynamics.compute_contribution(instant, coordinates, Frame.GCRF()),
+            rel=1e-8,
+        )
@@ -7,6 +7,8 @@ import numpy as np
 from ostk.physics.time import Instant
 from ostk.physics.time import DateTime
 from ostk.physics.time import Scale
+from ostk.physics.time import Duration
+from ostk.physics.time import Interval
 from ostk.physics.coordinate import Position
 from ostk.physics.coordinate import Velocity
 from ostk.physics.coordinate import Frame
@@ -65,3 +67,42 @@ class TestThirdBodyGravity:
         assert contribution == pytest.approx(
             [-4.620543790697659e-07, 2.948717888154649e-07, 1.301648617451192e-07]
         )
+
+    def test_ephemeris_table(
+        self,
+        dynamics: ThirdBodyGravity,
+        moon: Moon,
+        state: State,
+    ):
+        ephemeris_table: ThirdBodyGravity.EphemerisTable = (
+            ThirdBodyGravity.EphemerisTable(
+                moon,
+                Interval.closed(
+                    state.get_instant(), state.get_instant() + Duration.days(1.0)
+                ),
+                Frame.GCRF(),
+            )
+        )
+
+        assert ephemeris_table.is_applicable_at(state.get_instant(), Frame.GCRF())
+        assert np.linalg.norm(
+            ephemeris_table.get_position_at(state.get_instant())
+            - moon.get_position_in(Frame.GCRF(), state.get_instant())
+            .in_meters()
+            .get_coordinates()
+        ) == pytest.approx(0.0, abs=1.0)
+
+        assert dynamics.get_ephemeris_table() is None
+
+        tabulated_dynamics: ThirdBodyGravity = ThirdBodyGravity(moon, ephemeris_table)
+
+        assert tabulated_dynamics.get_ephemeris_table() is not None
+
+        contribution = tabulated_dynamics.compute_contribution(
+            state.get_instant(), state.get_coordinates(), state.get_frame()
+        )
+
+        assert contribution == pytest.approx(
+            [-4.620543790697659e-07, 2.948717888154649e-07, 1.301648617451192e-07],
+            rel=1e-8,
+        )
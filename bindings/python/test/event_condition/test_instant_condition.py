@@ -41,6 +41,11 @@ def state() -> State:
 
 
 class TestInstantCondition:
+    def test_get_target_instant(
+        self, instant_condition: InstantCondition, instant: Instant
+    ):
+        assert instant_condition.get_target_instant() == instant
+
     def test_get_instant(self, instant_condition: InstantCondition, instant: Instant):
         assert instant_condition.get_instant() == instant
 
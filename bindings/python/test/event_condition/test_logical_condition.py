@@ -118,3 +118,39 @@ class TestLogicalCondition:
             logical_condition.is_satisfied(previous_state=state, current_state=state)
             == expected_result
         )
+
+    @pytest.mark.parametrize(
+        "logical_condition_type,expected_result",
+        (
+            (LogicalCondition.Type.And, False),
+            (LogicalCondition.Type.Or, True),
+        ),
+    )
+    def test_compile(
+        self,
+        logical_condition_type: LogicalCondition.Type,
+        expected_result: bool,
+        event_conditions: list[RealCondition],
+        state: State,
+    ):
+        logical_condition: LogicalCondition = LogicalCondition(
+            "Logical Condition",
+            logical_condition_type,
+            [
+                LogicalCondition("Nested", logical_condition_type, event_conditions),
+                *event_conditions,
+            ],
+        )
+
+        assert not logical_condition.is_compiled()
+
+        logical_condition.compile()
+
+        assert logical_condition.is_compiled()
+        assert len(logical_condition.get_event_conditions()) == 3
+
+        for _ in range(20):
+            assert (
+                logical_condition.is_satisfied(previous_state=state, current_state=state)
+                == expected_result
+            )
@@ -89,3 +89,43 @@ class TestSatelliteSystem:
         assert satellite_system.get_cross_sectional_surface_area() == surface_area
         assert satellite_system.get_drag_coefficient() == drag_coefficient
         assert satellite_system.get_propulsion_system() == propulsion_system
+
+    def test_projected_area_table(
+        self,
+        satellite_system: SatelliteSystem,
+    ):
+        assert satellite_system.get_projected_area_table() is not None
+        assert SatelliteSystem.undefined().get_projected_area_table() is None
+
+        geometry = Composite(
+            Cuboid(
+                Point(0.0, 0.0, 0.0),
+                [[1.0, 0.0, 0.0], [0.0, 1.0, 0.0], [0.0, 0.0, 1.0]],
+                [1.0, 2.0, 3.0],
+            )
+        )
+
+        assert SatelliteSystem.ProjectedAreaTable.is_supported(geometry)
+
+        projected_area_table = SatelliteSystem.ProjectedAreaTable(geometry)
+
+        assert projected_area_table.get_azimuth_count() == 72
+        assert projected_area_table.get_elevation_count() == 37
+
+        assert projected_area_table.get_projected_area_at(
+            np.array([1.0, 0.0, 0.0])
+        ) == pytest.approx(24.0)
+        assert projected_area_table.get_projected_area_at(
+            np.array([0.0, 1.0, 0.0])
+        ) == pytest.approx(12.0)
+        assert projected_area_table.get_projected_area_at(
+            np.array([0.0, 0.0, 1.0])
+        ) == pytest.approx(8.0)
+
+        direction = np.array([-0.3, 0.7, 0.5])
+        direction /= np.linalg.norm(direction)
+
+        assert projected_area_table.get_projected_area_at(direction) == pytest.approx(
+            SatelliteSystem.ProjectedAreaTable.compute_projected_area(geometry, direction),
+            abs=0.1,
+        )
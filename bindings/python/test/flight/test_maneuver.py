@@ -9,10 +9,14 @@ from ostk.physics.time import Instant
 from ostk.physics.time import Interval
 from ostk.physics.time import Duration
 from ostk.physics.coordinate import Frame
+from ostk.physics.coordinate import Position
+from ostk.physics.coordinate import Velocity
 from ostk.physics.unit import Mass
 
 from ostk.astrodynamics.flight import Maneuver
 from ostk.astrodynamics.dynamics import Tabulated as TabulatedDynamics
+from ostk.astrodynamics.trajectory import LocalOrbitalFrameFactory
+from ostk.astrodynamics.trajectory import State
 from ostk.astrodynamics.trajectory.state import CoordinateSubset
 
 
@@ -210,3 +214,43 @@ class TestManeuver:
         assert maneuver.get_mass_flow_rate_profile() == [
             mass_flow_rate for _ in range(len(instants))
         ]
+
+    def test_local_orbital_frame_acceleration_profile(
+        self,
+        instants: list[Instant],
+        acceleration_profile: list[np.ndarray],
+        frame: Frame,
+        mass_flow_rate_profile: list[float],
+    ):
+        states: list[State] = [
+            State(
+                instant,
+                Position.meters([7.0e6, 0.0, 0.0], frame),
+                Velocity.meters_per_second([0.0, 7.0e3, 0.0], frame),
+            )
+            for instant in instants
+        ]
+
+        local_orbital_frame_factory = LocalOrbitalFrameFactory.VNC(frame)
+
+        maneuver = Maneuver.local_orbital_frame_acceleration_profile(
+            states=states,
+            acceleration_profile=acceleration_profile,
+            local_orbital_frame_factory=local_orbital_frame_factory,
+            mass_flow_rate_profile=mass_flow_rate_profile,
+        )
+
+        assert maneuver.is_defined()
+        assert np.allclose(
+            maneuver.get_acceleration_profile(frame)[0],
+            np.array([0.0, 1.0e-3, 0.0]),
+            atol=1e-15,
+        )
+
+        for acceleration, expected_acceleration in zip(
+            maneuver.get_acceleration_profile_in_local_orbital_frame(
+                local_orbital_frame_factory, states
+            ),
+            acceleration_profile,
+        ):
+            assert np.allclose(acceleration, expected_acceleration, atol=1e-15)
@@ -74,6 +74,14 @@ class TestProfile:
         assert frame is not None
         assert isinstance(frame, Frame)
 
+    def test_tabulate(self, profile: Profile, instant: Instant):
+        tabulated_profile: Profile = profile.tabulate([instant])
+
+        assert tabulated_profile is not None
+        assert isinstance(tabulated_profile, Profile)
+        assert tabulated_profile.is_defined()
+        assert tabulated_profile.get_state_at(instant) == profile.get_state_at(instant)
+
     def test_undefined(self):
         profile: Profile = Profile.undefined()
 
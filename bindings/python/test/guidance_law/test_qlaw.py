@@ -5,6 +5,7 @@ import pytest
 import numpy as np
 
 from ostk.physics.time import Instant
+from ostk.physics.time import Duration
 from ostk.physics.coordinate import Frame
 from ostk.physics.unit import Derived
 from ostk.physics.environment.gravitational import Earth as EarthGravitationalModel
@@ -12,11 +13,22 @@ from ostk.physics.time import Instant
 from ostk.physics.coordinate import Frame
 from ostk.physics.unit import Length
 from ostk.physics.unit import Angle
+from ostk.physics.environment.object.celestial import Earth
 
 
 from ostk.astrodynamics.trajectory.orbit.model.kepler import COE
 from ostk.astrodynamics import GuidanceLaw
 from ostk.astrodynamics.guidance_law import QLaw
+from ostk.astrodynamics.dynamics import CentralBodyGravity
+from ostk.astrodynamics.dynamics import PositionDerivative
+from ostk.astrodynamics.event_condition import InstantCondition
+from ostk.astrodynamics.flight.system import SatelliteSystem
+from ostk.astrodynamics.trajectory import State
+from ostk.astrodynamics.trajectory.state import CoordinateSubset
+from ostk.astrodynamics.trajectory.state import CoordinateBroker
+from ostk.astrodynamics.trajectory.state import NumericalSolver
+from ostk.astrodynamics.trajectory.state.coordinate_subset import CartesianPosition
+from ostk.astrodynamics.trajectory.state.coordinate_subset import CartesianVelocity
 
 
 @pytest.fixture
@@ -94,6 +106,27 @@ def instant() -> Instant:
     return Instant.J2000()
 
 
+@pytest.fixture
+def state(
+    instant: Instant,
+    position_coordinates: list[float],
+    velocity_coordinates: list[float],
+    frame: Frame,
+) -> State:
+    return State(
+        instant,
+        [*position_coordinates, *velocity_coordinates, 200.0],
+        frame,
+        CoordinateBroker(
+            [
+                CartesianPosition.default(),
+                CartesianVelocity.default(),
+                CoordinateSubset.mass(),
+            ]
+        ),
+    )
+
+
 class TestQLawParameters:
     def test_constructors(self, parameters: QLaw.Parameters):
         assert parameters is not None
@@ -117,6 +150,46 @@ class TestQLaw:
         assert q_law.get_parameters() is not None
         assert q_law.get_target_coe() is not None
         assert q_law.get_gradient_strategy() is not None
+        assert q_law.get_direction_update_interval() == Duration.zero()
+        assert q_law.get_direction_update_threshold().is_defined() is False
+
+    def test_held_direction(
+        self,
+        target_COE: COE,
+        gravitational_parameter: Derived,
+        parameters: QLaw.Parameters,
+        position_coordinates: list[float],
+        velocity_coordinates: list[float],
+        thrust_acceleration: float,
+        instant: Instant,
+        frame: Frame,
+    ):
+        q_law = QLaw(
+            target_coe=target_COE,
+            gravitational_parameter=gravitational_parameter,
+            parameters=parameters,
+            direction_update_interval=Duration.minutes(1.0),
+        )
+
+        assert q_law.get_direction_update_interval() == Duration.minutes(1.0)
+
+        acceleration = q_law.calculate_thrust_acceleration_at(
+            instant=instant,
+            position_coordinates=position_coordinates,
+            velocity_coordinates=velocity_coordinates,
+            thrust_acceleration=thrust_acceleration,
+            output_frame=frame,
+        )
+
+        assert pytest.approx(
+            q_law.calculate_thrust_acceleration_at(
+                instant=instant + Duration.seconds(10.0),
+                position_coordinates=position_coordinates,
+                velocity_coordinates=velocity_coordinates,
+                thrust_acceleration=thrust_acceleration,
+                output_frame=frame,
+            )
+        ) == acceleration
 
     def test_calculate_thrust_acceleration_at(
         self,
@@ -136,3 +209,34 @@ class TestQLaw:
                 output_frame=frame,
             )
         ) == np.array([0.0, 0.0033333320640941645, 2.9088817174504986e-06])
+
+    def test_sweep(
+        self,
+        target_COE: COE,
+        gravitational_parameter: Derived,
+        parameters: QLaw.Parameters,
+        state: State,
+    ):
+        results = QLaw.sweep(
+            target_coe=target_COE,
+            gravitational_parameter=gravitational_parameter,
+            parameters_array=[parameters, parameters],
+            state=state,
+            satellite_system=SatelliteSystem.default(),
+            event_condition=InstantCondition(
+                InstantCondition.Criterion.AnyCrossing,
+                state.get_instant() + Duration.minutes(10.0),
+            ),
+            dynamics=[PositionDerivative(), CentralBodyGravity(Earth.spherical())],
+            numerical_solver=NumericalSolver.default_conditional(),
+            thread_count=2,
+        )
+
+        assert len(results) == 2
+
+        for result in results:
+            assert result.condition_is_satisfied is True
+            assert result.time_of_flight.in_seconds() == pytest.approx(600.0, abs=1e-3)
+            assert result.delta_v > 0.0
+
+        assert results[0].delta_v == results[1].delta_v
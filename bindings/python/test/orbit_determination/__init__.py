@@ -0,0 +1 @@
+# Apache License 2.0
@@ -0,0 +1,135 @@
+# Apache License 2.0
+
+import pytest
+
+import numpy as np
+
+from ostk.physics.time import Instant
+from ostk.physics.time import DateTime
+from ostk.physics.time import Scale
+from ostk.physics.time import Duration
+from ostk.physics.unit import Length
+from ostk.physics.coordinate import Position
+from ostk.physics.coordinate import Velocity
+from ostk.physics.coordinate import Frame
+from ostk.physics.environment.object.celestial import Earth
+
+from ostk.astrodynamics import ExecutionContext
+from ostk.astrodynamics import Trajectory
+from ostk.astrodynamics.dynamics import CentralBodyGravity
+from ostk.astrodynamics.dynamics import PositionDerivative
+from ostk.astrodynamics.trajectory import Propagator
+from ostk.astrodynamics.trajectory import State
+from ostk.astrodynamics.trajectory.state import NumericalSolver
+from ostk.astrodynamics.orbit_determination import Measurement
+from ostk.astrodynamics.orbit_determination import BatchLeastSquaresSolver
+
+
+@pytest.fixture
+def epoch() -> Instant:
+    return Instant.date_time(DateTime(2024, 1, 1, 0, 0, 0), Scale.UTC)
+
+
+@pytest.fixture
+def propagator() -> Propagator:
+    return Propagator(
+        NumericalSolver(
+            NumericalSolver.LogType.NoLog,
+            NumericalSolver.StepperType.RungeKuttaFehlberg78,
+            5.0,
+            1.0e-12,
+            1.0e-12,
+        ),
+        [PositionDerivative(), CentralBodyGravity(Earth.spherical())],
+    )
+
+
+@pytest.fixture
+def truth_state(epoch: Instant) -> State:
+    return State(
+        epoch,
+        Position.meters([7000000.0, 0.0, 0.0], Frame.GCRF()),
+        Velocity.meters_per_second(
+            [0.0, 5335.865450622126, 5335.865450622126], Frame.GCRF()
+        ),
+    )
+
+
+@pytest.fixture
+def measurements(
+    epoch: Instant, propagator: Propagator, truth_state: State
+) -> list[Measurement]:
+    stations: list[Trajectory] = [
+        Trajectory.position(Position.meters([6378137.0, 0.0, 0.0], Frame.ITRF())),
+        Trajectory.position(Position.meters([0.0, 6378137.0, 0.0], Frame.ITRF())),
+    ]
+
+    instants: list[Instant] = [epoch + Duration.minutes(10.0 * k) for k in range(19)]
+    truth_states: list[State] = propagator.calculate_states_at(truth_state, instants)
+
+    measurements: list[Measurement] = []
+
+    for instant, state in zip(instants, truth_states):
+        for station in stations:
+            modeled_measurement = Measurement.range(
+                instant, Length.meters(0.0), Length.meters(1.0), station
+            )
+            value: float = modeled_measurement.calculate_value(state)[0]
+
+            measurements.append(
+                Measurement.range(
+                    instant, Length.meters(value), Length.meters(1.0), station
+                )
+            )
+
+    return measurements
+
+
+class TestBatchLeastSquaresSolver:
+    def test_constructor(self, propagator: Propagator):
+        solver = BatchLeastSquaresSolver(propagator)
+
+        assert solver.get_maximum_iteration_count() == 20
+        assert solver.get_relative_tolerance() == pytest.approx(1e-6)
+        assert isinstance(str(solver), str)
+
+    def test_solve(
+        self,
+        propagator: Propagator,
+        truth_state: State,
+        measurements: list[Measurement],
+        epoch: Instant,
+    ):
+        solver = BatchLeastSquaresSolver(propagator, maximum_iteration_count=5)
+
+        initial_guess_state = State(
+            epoch,
+            Position.meters([7001000.0, 0.0, 0.0], Frame.GCRF()),
+            Velocity.meters_per_second(
+                [0.0, 5336.865450622126, 5335.865450622126], Frame.GCRF()
+            ),
+        )
+
+        analysis: BatchLeastSquaresSolver.Analysis = solver.solve(
+            initial_guess_state, measurements
+        )
+
+        assert analysis.iteration_count <= 5
+        assert analysis.covariance.shape == (6, 6)
+        assert len(analysis.residuals) == len(measurements)
+
+        position_error: float = np.linalg.norm(
+            analysis.estimated_state.get_position().get_coordinates()
+            - truth_state.get_position().get_coordinates()
+        )
+
+        assert position_error < 1.0
+
+        serial_analysis: BatchLeastSquaresSolver.Analysis = solver.solve(
+            initial_guess_state, measurements, ExecutionContext(1)
+        )
+
+        assert np.array_equal(
+            serial_analysis.estimated_state.get_coordinates(),
+            analysis.estimated_state.get_coordinates(),
+        )
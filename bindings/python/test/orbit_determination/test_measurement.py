@@ -0,0 +1,112 @@
+# Apache License 2.0
+
+import pytest
+
+import numpy as np
+
+from ostk.physics.time import Instant
+from ostk.physics.time import DateTime
+from ostk.physics.time import Scale
+from ostk.physics.unit import Angle
+from ostk.physics.unit import Length
+from ostk.physics.coordinate import Position
+from ostk.physics.coordinate import Velocity
+from ostk.physics.coordinate import Frame
+
+from ostk.astrodynamics import Trajectory
+from ostk.astrodynamics.trajectory import State
+from ostk.astrodynamics.orbit_determination import Measurement
+
+
+@pytest.fixture
+def instant() -> Instant:
+    return Instant.date_time(DateTime(2024, 1, 1, 0, 0, 0), Scale.UTC)
+
+
+@pytest.fixture
+def station() -> Trajectory:
+    return Trajectory.position(Position.meters([6378137.0, 0.0, 0.0], Frame.ITRF()))
+
+
+@pytest.fixture
+def state(instant: Instant) -> State:
+    return State(
+        instant,
+        Position.meters([5000000.0, 4000000.0, 3000000.0], Frame.GCRF()),
+        Velocity.meters_per_second([-4500.0, 5000.0, 2500.0], Frame.GCRF()),
+    )
+
+
+class TestMeasurement:
+    def test_constructor(self, instant: Instant, station: Trajectory):
+        measurement = Measurement(
+            instant,
+            Measurement.Type.Range,
+            np.array([1.0e6]),
+            np.array([10.0]),
+            station,
+        )
+
+        assert measurement.is_defined()
+        assert measurement.get_type() == Measurement.Type.Range
+        assert measurement.get_size() == 1
+        assert measurement.get_instant() == instant
+        assert isinstance(str(measurement), str)
+
+        with pytest.raises(RuntimeError):
+            Measurement(
+                instant,
+                Measurement.Type.Angles,
+                np.array([0.1]),
+                np.array([1.0e-5, 1.0e-5]),
+                station,
+            )
+
+    def test_factories(self, instant: Instant, station: Trajectory):
+        range_measurement = Measurement.range(
+            instant, Length.kilometers(1000.0), Length.meters(10.0), station
+        )
+
+        assert range_measurement.get_value()[0] == pytest.approx(1.0e6)
+        assert range_measurement.get_standard_deviation()[0] == pytest.approx(10.0)
+
+        range_rate_measurement = Measurement.range_rate(instant, -250.0, 0.01, station)
+
+        assert range_rate_measurement.get_type() == Measurement.Type.RangeRate
+
+        angles_measurement = Measurement.angles(
+            instant,
+            Angle.degrees(10.0),
+            Angle.degrees(20.0),
+            Angle.radians(1.0e-5),
+            station,
+        )
+
+        assert angles_measurement.get_size() == 2
+        assert np.allclose(angles_measurement.get_value(), np.radians([10.0, 20.0]))
+
+        assert not Measurement.undefined().is_defined()
+        assert Measurement.string_from_type(Measurement.Type.Angles) == "Angles"
+        assert Measurement.size_from_type(Measurement.Type.Angles) == 2
+
+    def test_calculate(self, instant: Instant, station: Trajectory, state: State):
+        measurement = Measurement.range(
+            instant, Length.meters(0.0), Length.meters(10.0), station
+        )
+
+        value: np.ndarray = measurement.calculate_value(state)
+
+        offset_measurement = Measurement.range(
+            instant, Length.meters(value[0] + 25.0), Length.meters(10.0), station
+        )
+
+        assert offset_measurement.calculate_residual(state)[0] == pytest.approx(25.0)
+
+        angles_measurement = Measurement.angles(
+            instant, Angle.zero(), Angle.zero(), Angle.radians(1.0e-5), station
+        )
+
+        partials: np.ndarray = angles_measurement.calculate_partials(state)
+
+        assert partials.shape == (2, 6)
+        assert np.all(partials[:, 3:] == 0.0)
@@ -0,0 +1,156 @@
+# Apache License 2.0
+
+import numpy as np
+
+import pytest
+
+from ostk.physics.unit import Length
+from ostk.physics.unit import Angle
+from ostk.physics.time import DateTime
+from ostk.physics.time import Scale
+from ostk.physics.time import Duration
+from ostk.physics.time import Instant
+from ostk.physics.time import Interval
+from ostk.physics import Environment
+from ostk.physics.environment.object import Celestial
+
+from ostk.astrodynamics.trajectory import Orbit
+from ostk.astrodynamics.trajectory.orbit.model import Kepler
+from ostk.astrodynamics.trajectory.orbit.model.kepler import COE
+from ostk.astrodynamics.event_condition import RealCondition
+from ostk.astrodynamics.solver import EclipseSolver
+
+
+@pytest.fixture
+def environment() -> Environment:
+    return Environment.default()
+
+
+@pytest.fixture
+def sun(environment: Environment) -> Celestial:
+    return environment.access_celestial_object_with_name("Sun")
+
+
+@pytest.fixture
+def earth(environment: Environment) -> Celestial:
+    return environment.access_celestial_object_with_name("Earth")
+
+
+@pytest.fixture
+def start_instant() -> Instant:
+    return Instant.date_time(DateTime(2018, 1, 1, 0, 0, 0), Scale.UTC)
+
+
+@pytest.fixture
+def interval(start_instant: Instant) -> Interval:
+    return Interval.closed(start_instant, start_instant + Duration.hours(6.0))
+
+
+@pytest.fixture
+def orbit(earth: Celestial, start_instant: Instant) -> Orbit:
+    return Orbit(
+        model=Kepler(
+            coe=COE(
+                semi_major_axis=Length.kilometers(7000.0),
+                eccentricity=0.0,
+                inclination=Angle.degrees(0.0),
+                raan=Angle.degrees(0.0),
+                aop=Angle.degrees(0.0),
+                true_anomaly=Angle.degrees(0.0),
+            ),
+            epoch=start_instant,
+            celestial_object=earth,
+            perturbation_type=Kepler.PerturbationType.No,
+        ),
+        celestial_object=earth,
+    )
+
+
+@pytest.fixture
+def eclipse_solver(sun: Celestial, earth: Celestial) -> EclipseSolver:
+    return EclipseSolver(sun=sun, occulting_celestial=earth)
+
+
+class TestEclipseSolver:
+    def test_constructor_success(self, sun: Celestial, earth: Celestial):
+        eclipse_solver = EclipseSolver(
+            sun=sun,
+            occulting_celestial=earth,
+            time_step=Duration.seconds(10.0),
+            tolerance=Duration.milliseconds(10.0),
+            maximum_time_step=Duration.minutes(5.0),
+        )
+
+        assert isinstance(eclipse_solver, EclipseSolver)
+        assert eclipse_solver.is_defined()
+        assert eclipse_solver.get_time_step() == Duration.seconds(10.0)
+        assert eclipse_solver.get_tolerance() == Duration.milliseconds(10.0)
+        assert eclipse_solver.get_maximum_time_step() == Duration.minutes(5.0)
+
+    def test_undefined_success(self):
+        assert EclipseSolver.undefined().is_defined() is False
+
+    def test_string_from_region_success(self):
+        assert EclipseSolver.string_from_region(EclipseSolver.Region.Umbra) == "Umbra"
+
+    def test_compute_shadow_function_success(self):
+        sun_position_coordinates = np.array([1.496e11, 0.0, 0.0])
+
+        assert (
+            EclipseSolver.compute_shadow_function(
+                region=EclipseSolver.Region.Umbra,
+                position_coordinates=np.array([-7.0e6, 0.0, 0.0]),
+                sun_position_coordinates=sun_position_coordinates,
+                occulting_position_coordinates=np.zeros(3),
+                sun_radius=6.957e8,
+                occulting_radius=6.378e6,
+            )
+            > 0.0
+        )
+
+        assert (
+            EclipseSolver.compute_illumination_fraction_from_geometry(
+                position_coordinates=np.array([7.0e6, 0.0, 0.0]),
+                sun_position_coordinates=sun_position_coordinates,
+                occulting_position_coordinates=np.zeros(3),
+                sun_radius=6.957e8,
+                occulting_radius=6.378e6,
+            )
+            == 1.0
+        )
+
+    def test_compute_intervals_success(
+        self,
+        eclipse_solver: EclipseSolver,
+        orbit: Orbit,
+        interval: Interval,
+    ):
+        umbra_intervals = eclipse_solver.compute_intervals(
+            trajectory=orbit,
+            interval=interval,
+            region=EclipseSolver.Region.Umbra,
+        )
+
+        assert len(umbra_intervals) > 0
+
+        for umbra_interval in umbra_intervals:
+            center = umbra_interval.get_center()
+
+            assert (
+                eclipse_solver.compute_illumination_fraction(
+                    instant=center,
+                    position_coordinates=orbit.get_state_at(center)
+                    .get_position()
+                    .get_coordinates(),
+                )
+                == 0.0
+            )
+
+    def test_generate_event_condition_success(self, eclipse_solver: EclipseSolver):
+        condition = eclipse_solver.generate_event_condition(
+            region=EclipseSolver.Region.Umbra,
+            criterion=RealCondition.Criterion.PositiveCrossing,
+        )
+
+        assert isinstance(condition, RealCondition)
+        assert condition.get_name() == "Earth Umbra"
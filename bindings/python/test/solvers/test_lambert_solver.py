@@ -0,0 +1,144 @@
+# Apache License 2.0
+
+import pytest
+
+import numpy as np
+
+from ostk.physics.time import Instant
+from ostk.physics.time import DateTime
+from ostk.physics.time import Scale
+from ostk.physics.time import Duration
+from ostk.physics.unit import Angle
+from ostk.physics.unit import Length
+from ostk.physics.environment.object.celestial import Earth
+
+from ostk.astrodynamics import ExecutionContext
+from ostk.astrodynamics.solver import LambertSolver
+from ostk.astrodynamics.trajectory import Orbit
+
+
+@pytest.fixture
+def earth() -> Earth:
+    return Earth.spherical()
+
+
+@pytest.fixture
+def epoch() -> Instant:
+    return Instant.date_time(DateTime(2024, 1, 1, 0, 0, 0), Scale.UTC)
+
+
+@pytest.fixture
+def lambert_solver(earth: Earth) -> LambertSolver:
+    return LambertSolver(
+        gravitational_parameter=earth.get_gravitational_parameter(),
+        maximum_revolution_count=1,
+    )
+
+
+@pytest.fixture
+def departure_orbit(epoch: Instant, earth: Earth) -> Orbit:
+    return Orbit.circular(epoch, Length.kilometers(600.0), Angle.degrees(50.0), earth)
+
+
+@pytest.fixture
+def arrival_orbit(epoch: Instant, earth: Earth) -> Orbit:
+    return Orbit.circular(epoch, Length.kilometers(1200.0), Angle.degrees(55.0), earth)
+
+
+class TestLambertSolver:
+    def test_constructor(self, lambert_solver: LambertSolver):
+        assert lambert_solver.get_maximum_revolution_count() == 1
+        assert lambert_solver.is_prograde()
+        assert lambert_solver.get_maximum_iteration_count() == 35
+        assert lambert_solver.get_tolerance() == pytest.approx(1e-11)
+        assert isinstance(str(lambert_solver), str)
+
+    def test_solve(self, earth: Earth):
+        lambert_solver = LambertSolver(earth.get_gravitational_parameter())
+
+        solutions: list[LambertSolver.Solution] = lambert_solver.solve(
+            np.array([15945340.0, 0.0, 0.0]),
+            np.array([12214838.99, 10249467.31, 0.0]),
+            Duration.minutes(76.0),
+        )
+
+        assert len(solutions) == 1
+        assert solutions[0].revolution_count == 0
+        assert np.allclose(
+            solutions[0].departure_velocity, [2058.913, 2915.965, 0.0], atol=0.1
+        )
+        assert np.allclose(
+            solutions[0].arrival_velocity, [-3451.565, 910.315, 0.0], atol=0.1
+        )
+
+    def test_compute_transfer(
+        self,
+        lambert_solver: LambertSolver,
+        departure_orbit: Orbit,
+        arrival_orbit: Orbit,
+        epoch: Instant,
+        earth: Earth,
+    ):
+        arrival_instant: Instant = epoch + Duration.minutes(70.0)
+
+        transfer: LambertSolver.Transfer = lambert_solver.compute_transfer(
+            departure_orbit.get_state_at(epoch),
+            arrival_orbit.get_state_at(arrival_instant),
+        )
+
+        assert transfer.is_defined()
+        assert transfer.get_total_delta_v() == pytest.approx(
+            float(transfer.departure_delta_v) + float(transfer.arrival_delta_v)
+        )
+
+        orbit: Orbit = lambert_solver.compute_orbit(transfer, earth)
+
+        position = orbit.get_state_at(arrival_instant).get_position()
+        arrival_position = arrival_orbit.get_state_at(arrival_instant).get_position()
+
+        assert np.allclose(
+            position.get_coordinates(), arrival_position.get_coordinates(), atol=1e-2
+        )
+
+    def test_compute_transfer_grid(
+        self,
+        lambert_solver: LambertSolver,
+        departure_orbit: Orbit,
+        arrival_orbit: Orbit,
+        epoch: Instant,
+    ):
+        departure_instants: list[Instant] = [
+            epoch + Duration.minutes(10.0 * i) for i in range(4)
+        ]
+        times_of_flight: list[Duration] = [
+            Duration.minutes(30.0 + 25.0 * j) for j in range(3)
+        ]
+
+        transfer_grid = lambert_solver.compute_transfer_grid(
+            departure_orbit, arrival_orbit, departure_instants, times_of_flight
+        )
+
+        total_delta_vs: np.ndarray = transfer_grid.get_total_delta_vs()
+
+        assert total_delta_vs.shape == (4, 3)
+        assert len(transfer_grid.transfers) == 12
+        assert np.allclose(
+            total_delta_vs,
+            transfer_grid.get_departure_delta_vs()
+            + transfer_grid.get_arrival_delta_vs(),
+        )
+
+        transfer: LambertSolver.Transfer = transfer_grid.access_transfer_at(1, 2)
+
+        assert transfer.get_total_delta_v() == pytest.approx(total_delta_vs[1, 2])
+
+        assert np.array_equal(
+            lambert_solver.compute_transfer_grid(
+                departure_orbit,
+                arrival_orbit,
+                departure_instants,
+                times_of_flight,
+                ExecutionContext(1),
+            ).get_total_delta_vs(),
+            total_delta_vs,
+        )
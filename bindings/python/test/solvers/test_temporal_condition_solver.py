@@ -1,5 +1,7 @@
 # Apache License 2.0
 
+import numpy as np
+
 import pytest
 
 from ostk.physics.unit import Length
@@ -10,7 +12,10 @@ from ostk.physics.time import Interval
 from ostk.physics.time import DateTime
 from ostk.physics.time import Scale
 from ostk.physics import Environment
+from ostk.physics.coordinate import Position
+from ostk.physics.coordinate import Frame
 
+from ostk.astrodynamics import Trajectory
 from ostk.astrodynamics.trajectory import Orbit
 from ostk.astrodynamics.trajectory.orbit.model import Kepler
 from ostk.astrodynamics.trajectory.orbit.model.kepler import COE
@@ -111,6 +116,128 @@ class TestTemporalConditionSolver:
         assert isinstance(solution, list)
         assert solution == []
 
+    def test_solve_success_interval_callback(
+        self,
+        temporal_condition_solver: TemporalConditionSolver,
+        interval: Interval,
+    ):
+        intervals: list[Interval] = []
+
+        temporal_condition_solver.solve(
+            condition=lambda _: True,
+            interval=interval,
+            interval_callback=lambda solution_interval: intervals.append(solution_interval),
+        )
+
+        assert intervals == [interval]
+
+    def test_solve_adaptive_success(
+        self,
+        temporal_condition_solver: TemporalConditionSolver,
+        interval: Interval,
+    ):
+        solution: list[Interval] = temporal_condition_solver.solve_adaptive(
+            margin_function=lambda _: 1.0,
+            interval=interval,
+            maximum_time_step=Duration.minutes(10.0),
+        )
+
+        assert isinstance(solution, list)
+        assert solution == [interval]
+
+        solution: list[Interval] = temporal_condition_solver.solve_adaptive(
+            margin_function=lambda _: -1.0,
+            interval=interval,
+            maximum_time_step=Duration.minutes(10.0),
+        )
+
+        assert solution == []
+
+    def test_solve_success_state_conditions(
+        self,
+        temporal_condition_solver: TemporalConditionSolver,
+        interval: Interval,
+    ):
+        station_trajectory = Trajectory.position(
+            Position.meters([6378137.0, 0.0, 0.0], Frame.ITRF())
+        )
+        sun = Environment.default().access_celestial_object_with_name("Sun")
+
+        def state_condition(snapshot: TemporalConditionSolver.Snapshot) -> bool:
+            state = snapshot.access_state(0)
+            sun_position_coordinates = snapshot.access_celestial_position_coordinates(0)
+
+            return (
+                state.get_instant() == snapshot.access_instant()
+                and np.linalg.norm(sun_position_coordinates) > 1.4e11
+            )
+
+        solution: list[Interval] = temporal_condition_solver.solve(
+            state_conditions=[state_condition],
+            trajectories=[station_trajectory],
+            celestials=[sun],
+            interval=interval,
+        )
+
+        assert solution == [interval]
+
+        solution = temporal_condition_solver.solve(
+            state_conditions=[state_condition, lambda snapshot: False],
+            trajectories=[station_trajectory],
+            celestials=[sun],
+            interval=interval,
+        )
+
+        assert solution == []
+
+    def test_statistics_success(
+        self,
+        temporal_condition_solver: TemporalConditionSolver,
+        interval: Interval,
+    ):
+        assert temporal_condition_solver.is_statistics_enabled() is False
+
+        temporal_condition_solver.enable_statistics()
+
+        assert temporal_condition_solver.is_statistics_enabled() is True
+
+        temporal_condition_solver.solve(
+            condition=lambda instant: instant
+            < Instant.date_time(DateTime(2018, 1, 1, 1, 0, 0), Scale.UTC),
+            interval=interval,
+        )
+
+        statistics: TemporalConditionSolver.Statistics = (
+            temporal_condition_solver.get_statistics()
+        )
+
+        assert statistics.condition_evaluation_count > 0
+        assert statistics.root_solver_call_count == 1
+        assert statistics.root_solver_iteration_count > 0
+
+        statistics_dict: dict = statistics.to_dict()
+
+        assert statistics_dict["condition_evaluation_count"] == (
+            statistics.condition_evaluation_count
+        )
+        assert statistics_dict["root_solver_duration"] == pytest.approx(
+            statistics.root_solver_duration.in_seconds()
+        )
+
+        assert (
+            temporal_condition_solver.get_statistics(reset=True).root_solver_call_count
+            == 1
+        )
+        assert temporal_condition_solver.get_statistics().root_solver_call_count == 0
+
+        temporal_condition_solver.reset_statistics()
+
+        assert temporal_condition_solver.get_statistics().condition_evaluation_count == 0
+
+        temporal_condition_solver.disable_statistics()
+
+        assert temporal_condition_solver.is_statistics_enabled() is False
+
     def test_solve_success_using_access_generator(
         self,
         temporal_condition_solver: TemporalConditionSolver,
@@ -0,0 +1,33 @@
+# Apache License 2.0
+
+import os
+
+import pytest
+
+from ostk.astrodynamics import ExecutionContext
+
+
+@pytest.fixture(autouse=True)
+def reset_default_thread_count():
+    ExecutionContext.set_default_thread_count(0)
+
+    yield
+
+    ExecutionContext.set_default_thread_count(0)
+
+
+class TestExecutionContext:
+    def test_constructor(self):
+        assert ExecutionContext(4).get_thread_count() == 4
+        assert ExecutionContext().get_thread_count() == max(1, os.cpu_count())
+
+    def test_default_thread_count(self):
+        ExecutionContext.set_default_thread_count(3)
+
+        assert ExecutionContext.get_default_thread_count() == 3
+        assert ExecutionContext().get_thread_count() == 3
+        assert ExecutionContext(4).get_thread_count() == 4
+
+        ExecutionContext.set_default_thread_count(0)
+
+        assert ExecutionContext.get_default_thread_count() == max(1, os.cpu_count())
@@ -24,3 +24,20 @@ class TestImport:
         from ostk.astrodynamics import Access
         from ostk.astrodynamics.access import Generator
         from ostk.astrodynamics.trajectory.state import NumericalSolver
+
+    def test_import_lazy_submodules(self):
+        import ostk.astrodynamics as astrodynamics
+
+        assert "orbit_determination" in dir(astrodynamics)
+
+        import ostk.astrodynamics.orbit_determination as orbit_determination
+
+        assert orbit_determination is astrodynamics.orbit_determination
+
+        from ostk.astrodynamics import GuidanceLaw
+        from ostk.astrodynamics.guidance_law import QLaw
+        from ostk.astrodynamics.event_condition import RealCondition
+        from ostk.astrodynamics.conjunction import Screener
+
+        with pytest.raises(AttributeError):
+            astrodynamics.undefined_attribute
@@ -0,0 +1,68 @@
+# Apache License 2.0
+
+import pytest
+
+from ostk.physics.environment.atmospheric import Earth as EarthAtmosphericModel
+from ostk.physics.environment.gravitational import Earth as EarthGravitationalModel
+from ostk.physics.environment.magnetic import Earth as EarthMagneticModel
+
+from ostk.astrodynamics import ModelCache
+
+
+@pytest.fixture(autouse=True)
+def clear_model_cache():
+    ModelCache.clear()
+
+    yield
+
+    ModelCache.clear()
+
+
+class TestModelCache:
+    def test_access_earth_gravitational_model(self):
+        assert ModelCache.get_size() == 0
+
+        model: EarthGravitationalModel = ModelCache.access_earth_gravitational_model(
+            EarthGravitationalModel.Type.Spherical
+        )
+
+        assert model is not None
+        assert ModelCache.get_size() == 1
+
+        ModelCache.access_earth_gravitational_model(
+            type=EarthGravitationalModel.Type.EGM96,
+            degree=10,
+            order=10,
+        )
+
+        assert ModelCache.get_size() == 2
+
+    def test_access_earth_models(self):
+        assert (
+            ModelCache.access_earth_magnetic_model(EarthMagneticModel.Type.Undefined)
+            is not None
+        )
+        assert (
+            ModelCache.access_earth_atmospheric_model(
+                EarthAtmosphericModel.Type.Exponential
+            )
+            is not None
+        )
+
+        assert ModelCache.get_size() == 2
+
+    def test_access_earth(self):
+        earth = ModelCache.access_earth(
+            gravitational_model_type=EarthGravitationalModel.Type.Spherical,
+            atmospheric_model_type=EarthAtmosphericModel.Type.Exponential,
+        )
+
+        assert earth.get_name() == "Earth"
+        assert earth.gravitational_model_is_defined()
+        assert earth.atmospheric_model_is_defined()
+
+        assert ModelCache.get_size() == 4
+
+        ModelCache.clear()
+
+        assert ModelCache.get_size() == 0
@@ -66,5 +66,23 @@ class TestRootSolver:
         )
         assert pytest.approx(solution.root, abs=1e-15) == 2.0
 
+    def test_itp(self, root_solver):
+        solution = root_solver.itp(
+            function=quadratic_function,
+            lower_bound=1.0,
+            upper_bound=3.0,
+        )
+        assert pytest.approx(solution.root, abs=1e-15) == 2.0
+
+    def test_newton(self, root_solver):
+        solution = root_solver.newton(
+            function=quadratic_function,
+            derivative=lambda x: 2.0 * x,
+            lower_bound=1.0,
+            upper_bound=3.0,
+        )
+        assert pytest.approx(solution.root, abs=1e-15) == 2.0
+        assert solution.has_converged
+
     def test_default(self):
         assert RootSolver.default() is not None
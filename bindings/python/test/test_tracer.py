@@ -0,0 +1,75 @@
+# Apache License 2.0
+
+import json
+
+import pytest
+
+from ostk.core.filesystem import File
+from ostk.core.filesystem import Path
+
+from ostk.astrodynamics import RootSolver
+from ostk.astrodynamics import Tracer
+
+
+@pytest.fixture(autouse=True)
+def reset_tracer():
+    Tracer.disable()
+    Tracer.clear()
+
+    yield
+
+    Tracer.disable()
+    Tracer.clear()
+
+
+class TestTracer:
+    def test_disabled(self):
+        assert not Tracer.is_enabled()
+
+        RootSolver(100, 1e-12).solve(lambda x: x**2 - 4.0, 0.0, 5.0)
+
+        assert Tracer.get_events() == []
+
+    def test_events(self):
+        Tracer.enable()
+
+        assert Tracer.is_enabled()
+
+        RootSolver(100, 1e-12).solve(lambda x: x**2 - 4.0, 0.0, 5.0)
+
+        events: list[Tracer.Event] = Tracer.get_events()
+
+        assert len(events) == 1
+        assert events[0].name == "RootSolver::solve"
+        assert events[0].category == "root solving"
+        assert events[0].duration.is_positive()
+
+        Tracer.clear()
+
+        assert Tracer.get_events() == []
+
+    def test_maximum_event_count(self):
+        Tracer.enable(maximum_event_count=1)
+
+        for _ in range(3):
+            RootSolver(100, 1e-12).solve(lambda x: x**2 - 4.0, 0.0, 5.0)
+
+        assert len(Tracer.get_events()) == 1
+        assert Tracer.get_dropped_event_count() == 2
+
+    def test_to_chrome_trace(self, tmp_path):
+        Tracer.enable()
+
+        RootSolver(100, 1e-12).solve(lambda x: x**2 - 4.0, 0.0, 5.0)
+
+        chrome_trace: dict = json.loads(Tracer.to_chrome_trace())
+
+        assert len(chrome_trace["traceEvents"]) == 1
+        assert chrome_trace["traceEvents"][0]["name"] == "RootSolver::solve"
+        assert chrome_trace["traceEvents"][0]["ph"] == "X"
+
+        file_path = tmp_path / "trace.json"
+
+        Tracer.dump(File.path(Path.parse(str(file_path))))
+
+        assert json.loads(file_path.read_text()) == chrome_trace
@@ -0,0 +1,58 @@
+# Apache License 2.0
+
+import pytest
+
+from ostk.physics.coordinate import Frame
+from ostk.physics.coordinate import Position
+from ostk.physics.time import Duration
+from ostk.physics.time import Instant
+
+from ostk.astrodynamics import Trajectory
+from ostk.astrodynamics.trajectory.model import Cached
+
+
+@pytest.fixture
+def trajectory() -> Trajectory:
+    return Trajectory.position(Position.meters([7.0e6, 0.0, 0.0], Frame.GCRF()))
+
+
+@pytest.fixture
+def instants() -> list[Instant]:
+    return [Instant.J2000() + Duration.minutes(float(minute)) for minute in range(10)]
+
+
+@pytest.fixture
+def cached(trajectory: Trajectory) -> Cached:
+    return Cached(trajectory=trajectory, capacity=16)
+
+
+class TestCached:
+    def test_constructor_success(self, cached: Cached, trajectory: Trajectory):
+        assert cached.is_defined()
+        assert cached.get_capacity() == 16
+        assert cached.get_size() == 0
+        assert cached.get_trajectory() == trajectory
+
+    def test_calculate_states_at_success(
+        self, cached: Cached, trajectory: Trajectory, instants: list[Instant]
+    ):
+        states = cached.calculate_states_at(instants)
+
+        assert states == trajectory.get_states_at(instants)
+        assert cached.get_miss_count() == len(instants)
+
+        assert cached.calculate_state_at(instants[0]) == states[0]
+        assert cached.get_hit_count() == 1
+
+        cached.clear()
+
+        assert cached.get_size() == 0
+
+    def test_trajectory_success(self, cached: Cached, instants: list[Instant]):
+        trajectory = Trajectory(cached)
+
+        trajectory.get_states_at(instants)
+        trajectory.get_states_at(instants)
+
+        assert cached.get_hit_count() == len(instants)
+        assert cached.get_miss_count() == len(instants)
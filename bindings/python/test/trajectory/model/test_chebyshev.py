@@ -0,0 +1,118 @@
+# Apache License 2.0
+
+import pytest
+
+import numpy as np
+
+from ostk.physics.coordinate import Frame
+from ostk.physics.coordinate import Position
+from ostk.physics.coordinate import Velocity
+from ostk.physics.environment.object.celestial import Earth
+from ostk.physics.time import DateTime
+from ostk.physics.time import Duration
+from ostk.physics.time import Instant
+from ostk.physics.time import Interval
+from ostk.physics.time import Scale
+from ostk.physics.unit import Length
+
+from ostk.astrodynamics import Trajectory
+from ostk.astrodynamics.dynamics import CentralBodyGravity
+from ostk.astrodynamics.dynamics import PositionDerivative
+from ostk.astrodynamics.trajectory import Propagator
+from ostk.astrodynamics.trajectory import State
+from ostk.astrodynamics.trajectory.model import Chebyshev
+from ostk.astrodynamics.trajectory.state import NumericalSolver
+
+
+@pytest.fixture
+def start_instant() -> Instant:
+    return Instant.date_time(DateTime(2018, 1, 1, 0, 0, 0), Scale.UTC)
+
+
+@pytest.fixture
+def interval(start_instant: Instant) -> Interval:
+    return Interval.closed(start_instant, start_instant + Duration.hours(2.0))
+
+
+@pytest.fixture
+def state(start_instant: Instant) -> State:
+    return State(
+        start_instant,
+        Position.meters([7000000.0, 0.0, 0.0], Frame.GCRF()),
+        Velocity.meters_per_second(
+            [0.0, 5335.865450622126, 5335.865450622126], Frame.GCRF()
+        ),
+    )
+
+
+@pytest.fixture
+def propagator() -> Propagator:
+    return Propagator(
+        NumericalSolver.default(),
+        [PositionDerivative(), CentralBodyGravity(Earth.spherical())],
+    )
+
+
+@pytest.fixture
+def chebyshev(propagator: Propagator, state: State, interval: Interval) -> Chebyshev:
+    return Chebyshev.fit(
+        propagator=propagator,
+        state=state,
+        interval=interval,
+        position_tolerance=Length.meters(1.0),
+    )
+
+
+class TestChebyshev:
+    def test_fit_success(self, chebyshev: Chebyshev, interval: Interval):
+        assert chebyshev.is_defined()
+        assert chebyshev.get_interval() == interval
+        assert chebyshev.get_frame() == Frame.GCRF()
+        assert chebyshev.get_degree() == 12
+        assert chebyshev.get_segment_count() == len(chebyshev.get_segments())
+
+        segment: Chebyshev.Segment = chebyshev.get_segments()[0]
+
+        assert segment.start_instant == interval.get_start()
+        assert segment.position_coefficients.shape == (3, 13)
+
+    def test_constructor_success(self, chebyshev: Chebyshev):
+        assert (
+            Chebyshev(segments=chebyshev.get_segments(), frame=chebyshev.get_frame())
+            == chebyshev
+        )
+        assert not Chebyshev.undefined().is_defined()
+
+    def test_calculate_states_at_success(
+        self,
+        chebyshev: Chebyshev,
+        propagator: Propagator,
+        state: State,
+        interval: Interval,
+    ):
+        instants: list[Instant] = interval.generate_grid(Duration.minutes(1.0))
+
+        states: list[State] = chebyshev.calculate_states_at(instants)
+        reference_states: list[State] = propagator.calculate_states_at(state, instants)
+
+        for state_, reference_state in zip(states, reference_states):
+            assert (
+                np.linalg.norm(
+                    state_.get_position().get_coordinates()
+                    - reference_state.get_position().get_coordinates()
+                )
+                < 2.0
+            )
+
+        assert chebyshev.calculate_ephemeris_at(instants).get_size() == len(instants)
+
+    def test_trajectory_success(self, chebyshev: Chebyshev, start_instant: Instant):
+        trajectory = Trajectory(chebyshev)
+
+        assert trajectory.get_state_at(
+            start_instant + Duration.minutes(1.0)
+        ).is_defined()
+
+    def test_calculate_state_at_failure(self, chebyshev: Chebyshev, interval: Interval):
+        with pytest.raises(RuntimeError):
+            chebyshev.calculate_state_at(interval.get_end() + Duration.seconds(1.0))
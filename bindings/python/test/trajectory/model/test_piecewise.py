@@ -0,0 +1,68 @@
+# Apache License 2.0
+
+import pytest
+
+from ostk.physics.coordinate import Frame
+from ostk.physics.coordinate import Position
+from ostk.physics.time import Duration
+from ostk.physics.time import Instant
+
+from ostk.astrodynamics import Trajectory
+from ostk.astrodynamics.trajectory.model import Piecewise
+from ostk.astrodynamics.trajectory.orbit.model.sgp4 import TLE
+
+
+@pytest.fixture
+def tle() -> TLE:
+    return TLE(
+        "1 39419U 13066D   18248.44969859 -.00000394  00000-0 -31796-4 0  9997",
+        "2 39419  97.6313 314.6863 0012643 218.7350 141.2966 14.93878994260975",
+    )
+
+
+@pytest.fixture
+def switch_instant(tle: TLE) -> Instant:
+    return tle.get_epoch()
+
+
+@pytest.fixture
+def piecewise(switch_instant: Instant) -> Piecewise:
+    return Piecewise(
+        trajectories=[
+            Trajectory.position(Position.meters([7.0e6, 0.0, 0.0], Frame.GCRF())),
+            Trajectory.position(Position.meters([0.0, 7.0e6, 0.0], Frame.GCRF())),
+        ],
+        switch_instants=[switch_instant],
+    )
+
+
+class TestPiecewise:
+    def test_constructor_success(self, piecewise: Piecewise, switch_instant: Instant):
+        assert piecewise.is_defined()
+        assert piecewise.get_piece_count() == 2
+        assert len(piecewise.get_trajectories()) == 2
+        assert piecewise.get_switch_instants() == [switch_instant]
+
+    def test_get_piece_index_at_success(
+        self, piecewise: Piecewise, switch_instant: Instant
+    ):
+        assert piecewise.get_piece_index_at(switch_instant - Duration.minutes(1.0)) == 0
+        assert piecewise.get_piece_index_at(switch_instant) == 1
+
+    def test_trajectory_success(self, piecewise: Piecewise, switch_instant: Instant):
+        trajectory = Trajectory(piecewise)
+
+        state = trajectory.get_state_at(switch_instant + Duration.minutes(1.0))
+
+        assert list(state.get_position().get_coordinates()) == [0.0, 7.0e6, 0.0]
+
+    def test_tles_success(self, tle: TLE):
+        later_tle = TLE(tle.get_first_line(), tle.get_second_line())
+        later_tle.set_epoch(tle.get_epoch() + Duration.days(1.0))
+
+        piecewise = Piecewise.tles([later_tle, tle])
+
+        assert piecewise.get_piece_count() == 2
+        assert piecewise.get_switch_instants() == [
+            tle.get_epoch() + Duration.hours(12.0)
+        ]
@@ -0,0 +1,116 @@
+# Apache License 2.0
+
+import pytest
+
+from ostk.core.filesystem import Path
+from ostk.core.filesystem import File
+
+from ostk.physics.time import DateTime
+from ostk.physics.time import Duration
+from ostk.physics.time import Instant
+from ostk.physics.time import Interval
+from ostk.physics.time import Scale
+from ostk.physics.coordinate import Position
+from ostk.physics.coordinate import Velocity
+from ostk.physics.coordinate import Frame
+
+from ostk.astrodynamics.trajectory import State
+from ostk.astrodynamics.trajectory import Propagator
+from ostk.astrodynamics.trajectory.orbit.message.ccsds import OEM
+
+
+@pytest.fixture
+def epoch() -> Instant:
+    return Instant.date_time(DateTime(2018, 1, 1, 0, 0, 0), Scale.UTC)
+
+
+@pytest.fixture
+def header(epoch: Instant) -> OEM.Header:
+    return OEM.Header(version="2.0", creation_date=epoch, originator="OSTK")
+
+
+@pytest.fixture
+def metadata(epoch: Instant) -> OEM.Metadata:
+    return OEM.Metadata(
+        object_name="SATELLITE",
+        object_id="2018-001A",
+        center_name="EARTH",
+        reference_frame="GCRF",
+        time_system="UTC",
+        start_time=epoch,
+        stop_time=epoch + Duration.minutes(10.0),
+    )
+
+
+@pytest.fixture
+def state(epoch: Instant) -> State:
+    return State(
+        epoch,
+        Position.meters([7000.0e3, 0.0, 0.0], Frame.GCRF()),
+        Velocity.meters_per_second([0.0, 5335.865450622126, 5335.865450622126], Frame.GCRF()),
+    )
+
+
+@pytest.fixture
+def output_file() -> File:
+    return File.path(Path.parse("/tmp/OpenSpaceToolkitAstrodynamicsPy_OEM.oem"))
+
+
+class TestOEM:
+    def test_load(self, oem_file: File):
+        oem: OEM = OEM.load(oem_file)
+
+        assert oem.is_defined()
+        assert oem.get_header().originator == "NASA/JPL"
+        assert len(oem.get_segments()) == 2
+
+        segment: OEM.Segment = oem.get_segment_at(0)
+
+        assert segment.metadata.object_name == "MARS GLOBAL SURVEYOR"
+        assert segment.metadata.reference_frame == "GCRF"
+        assert len(segment.states) == 3
+        assert segment.states[0].get_instant() == segment.metadata.start_time
+
+    def test_undefined(self):
+        assert OEM.undefined().is_defined() is False
+
+    def test_reader(self, oem_file: File):
+        reader = OEM.Reader(oem_file)
+
+        assert reader.get_header().version == "2.0"
+
+        assert reader.read_metadata()
+        assert len(reader.read_states(maximum_count=2)) == 2
+        assert len(reader.read_states(maximum_count=2)) == 1
+        assert len(reader.read_states(maximum_count=2)) == 0
+
+        assert reader.read_metadata()
+        assert reader.read_tabulated().is_defined()
+
+        assert reader.read_metadata() is False
+
+    def test_writer(
+        self,
+        header: OEM.Header,
+        metadata: OEM.Metadata,
+        state: State,
+        epoch: Instant,
+        output_file: File,
+    ):
+        propagator: Propagator = Propagator.default()
+
+        instants: list[Instant] = Interval.closed(
+            epoch, epoch + Duration.minutes(10.0)
+        ).generate_grid(Duration.seconds(10.0))
+
+        with OEM.Writer(file=output_file, header=header, chunk_size=16) as writer:
+            writer.write_metadata(metadata)
+            writer.write(propagator=propagator, state=state, instants=instants)
+
+        oem: OEM = OEM.load(output_file)
+
+        assert len(oem.get_segments()) == 1
+        assert len(oem.get_segment_at(0).states) == len(instants)
+        assert oem.get_segment_at(0).metadata.stop_time == instants[-1]
+
+        output_file.remove()
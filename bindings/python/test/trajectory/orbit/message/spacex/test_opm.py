@@ -16,6 +16,9 @@ from ostk.physics.time import Duration
 from ostk.physics.coordinate import Position
 from ostk.physics.coordinate import Velocity
 from ostk.physics.coordinate import Frame
+from ostk.physics import Environment
+
+from ostk.astrodynamics.trajectory import Propagator
 
 from ostk.astrodynamics.trajectory.orbit.message.spacex import OPM
 
@@ -106,3 +109,32 @@ class TestOPM:
 class TestOPMDeployment:
     def test_to_state(self, opm: OPM):
         assert opm.get_deployment_with_name(name="A").to_state() is not None
+
+    def test_to_states(self, opm: OPM):
+        states = opm.to_states()
+
+        assert len(states) == len(opm.get_deployments())
+        assert states[0] == opm.get_deployment_at(0).to_state()
+
+    def test_calculate_states_at(self, opm_file: File):
+        opm: OPM = OPM.load(opm_file)
+
+        environment: Environment = Environment.default()
+        propagator: Propagator = Propagator.default(environment)
+        horizon: Instant = opm.get_header().launch_date + Duration.hours(6.0)
+
+        states = opm.calculate_states_at(
+            propagator=propagator, instant=horizon, thread_count=2
+        )
+
+        assert len(states) == len(opm.get_deployments())
+        assert all(state.get_instant() == horizon for state in states)
+
+        orbits = opm.generate_orbits(
+            propagator=propagator,
+            celestial_object=environment.access_celestial_object_with_name("Earth"),
+            instant=horizon,
+        )
+
+        assert len(orbits) == len(opm.get_deployments())
+        assert all(orbit.is_defined() for orbit in orbits)
@@ -98,5 +98,22 @@ class TestBrouwerLyddaneMeanLong:
             cartesian_state, gravitational_parameter
         ).is_defined()
 
+    def test_from_cartesian_states(
+        self, cartesian_state: tuple[Position, Velocity], gravitational_parameter
+    ):
+        element_sets = BrouwerLyddaneMeanLong.from_cartesian_states(
+            [cartesian_state, cartesian_state], gravitational_parameter
+        )
+
+        assert len(element_sets) == 2
+        assert element_sets[0] == BrouwerLyddaneMeanLong.cartesian(
+            cartesian_state, gravitational_parameter
+        )
+
+        coes = BrouwerLyddaneMeanLong.to_coes(element_sets, thread_count=2)
+
+        assert len(coes) == 2
+        assert coes[1] == element_sets[1].to_coe()
+
     def test_undefined(self):
         assert BrouwerLyddaneMeanLong.undefined().is_defined() is False
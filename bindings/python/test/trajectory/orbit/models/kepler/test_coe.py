@@ -2,6 +2,13 @@
 
 import pytest
 
+import tempfile
+
+import numpy as np
+
+from ostk.core.filesystem import Path
+from ostk.core.filesystem import File
+
 from ostk.physics.unit import Length
 from ostk.physics.unit import Angle
 from ostk.physics.environment.gravitational import Earth
@@ -162,6 +169,109 @@ class TestCOE:
             COE.AnomalyType.TrueAnomaly,
         )
 
+    def test_SI_vector_cartesian_conversions(
+        self,
+        coe: COE,
+    ):
+        gravitational_parameter: float = 3.986004418e14
+
+        coe_vector = coe.get_SI_vector(COE.AnomalyType.TrueAnomaly)
+
+        cartesian_vector = COE.SI_vector_to_cartesian(coe_vector, gravitational_parameter)
+
+        assert len(cartesian_vector) == 6
+
+        for value, expected_value in zip(
+            COE.cartesian_to_SI_vector(cartesian_vector, gravitational_parameter),
+            coe_vector,
+        ):
+            assert value == pytest.approx(expected_value, rel=1e-9)
+
+    @pytest.mark.parametrize(
+        "anomaly_type",
+        (
+            COE.AnomalyType.TrueAnomaly,
+            COE.AnomalyType.MeanAnomaly,
+            COE.AnomalyType.EccentricAnomaly,
+        ),
+    )
+    def test_SI_vectors_cartesians_conversions(
+        self,
+        coe: COE,
+        anomaly_type: COE.AnomalyType,
+    ):
+        gravitational_parameter: float = 3.986004418e14
+
+        coe_vectors = np.array([coe.get_SI_vector(anomaly_type)] * 3)
+
+        cartesian_vectors = COE.SI_vectors_to_cartesians(
+            coe_vectors, gravitational_parameter, anomaly_type
+        )
+
+        assert cartesian_vectors.shape == (3, 6)
+        assert cartesian_vectors[1] == pytest.approx(
+            COE.SI_vector_to_cartesian(
+                coe.get_SI_vector(COE.AnomalyType.TrueAnomaly), gravitational_parameter
+            ),
+            rel=1e-9,
+        )
+
+        np.testing.assert_allclose(
+            COE.cartesians_to_SI_vectors(
+                cartesian_vectors, gravitational_parameter, anomaly_type
+            ),
+            coe_vectors,
+            rtol=1e-9,
+        )
+
+        with pytest.raises(RuntimeError):
+            COE.cartesians_to_SI_vectors(np.zeros((2, 3)), gravitational_parameter)
+
+    def test_snapshot(
+        self,
+        coe: COE,
+    ):
+        snapshot_file = tempfile.NamedTemporaryFile(suffix=".coes", delete=False)
+        snapshot_file.close()
+
+        try:
+            COE.save_snapshot([coe, coe], File.path(Path.parse(snapshot_file.name)))
+
+            assert COE.load_snapshot(File.path(Path.parse(snapshot_file.name))) == [
+                coe,
+                coe,
+            ]
+
+        finally:
+            File.path(Path.parse(snapshot_file.name)).remove()
+
+    def test_anomalies_from_mean_anomalies(self):
+        mean_anomalies = [0.0, 1.0, 2.0, 3.0]
+
+        eccentric_anomalies = COE.eccentric_anomalies_from_mean_anomalies(
+            mean_anomalies, [0.1]
+        )
+        true_anomalies = COE.true_anomalies_from_mean_anomalies(mean_anomalies, [0.1])
+
+        assert len(eccentric_anomalies) == 4
+        assert len(true_anomalies) == 4
+
+        for mean_anomaly, eccentric_anomaly, true_anomaly in zip(
+            mean_anomalies, eccentric_anomalies, true_anomalies
+        ):
+            assert eccentric_anomaly == pytest.approx(
+                COE.eccentric_anomaly_from_mean_anomaly(
+                    Angle.radians(mean_anomaly), 0.1, 1e-12
+                ).in_radians(),
+                abs=1e-10,
+            )
+            assert true_anomaly == pytest.approx(
+                COE.true_anomaly_from_mean_anomaly(
+                    Angle.radians(mean_anomaly), 0.1, 1e-12
+                ).in_radians(),
+                abs=1e-10,
+            )
+
     def test_string_from_element(self):
         element_str = COE.string_from_element(COE.Element.SemiMajorAxis)
         assert element_str == "SemiMajorAxis"
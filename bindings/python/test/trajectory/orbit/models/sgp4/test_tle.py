@@ -2,6 +2,7 @@
 
 import pytest
 
+import pickle
 import tempfile
 
 from ostk.core.filesystem import Path
@@ -257,6 +258,58 @@ class TestTLE:
         finally:
             File.path(Path.parse(tle_file.name)).remove()
 
+    def test_parse_catalog(self, tle: TLE):
+        catalog: str = "\n".join(
+            [
+                str(tle.get_satellite_name()),
+                str(tle.get_first_line()),
+                str(tle.get_second_line()),
+                str(tle.get_first_line()),
+                str(tle.get_second_line()),
+            ]
+        )
+
+        tles: list[TLE] = TLE.parse_catalog(catalog)
+
+        assert len(tles) == 2
+        assert tles[0] == tle
+        assert tles[1].get_satellite_name() == ""
+        assert tles[1].get_first_line() == tle.get_first_line()
+
+        assert TLE.parse_catalog(catalog, thread_count=1) == tles
+
+    def test_load_catalog(self, tle: TLE):
+        catalog: str = "\n".join(
+            [
+                str(tle.get_satellite_name()),
+                str(tle.get_first_line()),
+                str(tle.get_second_line()),
+            ]
+            * 3
+        )
+
+        catalog_file = tempfile.NamedTemporaryFile(suffix=".txt", delete=False)
+        catalog_file.write(catalog.encode())
+        catalog_file.close()
+
+        try:
+            assert TLE.load_catalog(File.path(Path.parse(catalog_file.name))) == [tle] * 3
+
+        finally:
+            File.path(Path.parse(catalog_file.name)).remove()
+
+    def test_catalog_snapshot(self, tle: TLE):
+        snapshot_file = tempfile.NamedTemporaryFile(suffix=".tles", delete=False)
+        snapshot_file.close()
+
+        try:
+            TLE.save_catalog_snapshot([tle] * 3, File.path(Path.parse(snapshot_file.name)))
+
+            assert TLE.load_catalog_snapshot(File.path(Path.parse(snapshot_file.name))) == [tle] * 3
+
+        finally:
+            File.path(Path.parse(snapshot_file.name)).remove()
+
     def test_construct_with_satellite_name(self, tle: TLE):
         constructed_tle = TLE.construct(
             satellite_name="Satellite",
@@ -329,3 +382,9 @@ class TestTLE:
             TLE.generate_checksum(f"{str(tle.get_second_line())[:-1]}9")
             == tle.get_second_line_checksum()
         )
+
+    def test_pickle(self, tle: TLE):
+        unpickled_tle: TLE = pickle.loads(pickle.dumps(tle))
+
+        assert unpickled_tle == tle
+        assert unpickled_tle.get_satellite_name() == tle.get_satellite_name()
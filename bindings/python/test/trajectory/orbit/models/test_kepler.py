@@ -122,9 +122,31 @@ def test_trajectory_orbit_models_kepler_calculate_state_at_epoch():
     assert kepler.calculate_state_at(epoch) is not None
 
 
+def test_trajectory_orbit_models_kepler_calculate_states_at():
+    kepler: Kepler = construct_kepler()
+
+    epoch: Instant = Instant.date_time(DateTime(2018, 1, 1, 0, 0, 0), Scale.UTC)
+
+    states = kepler.calculate_states_at([epoch, epoch])
+
+    assert len(states) == 2
+    assert states[0] == kepler.calculate_state_at(epoch)
+
+
 def test_trajectory_orbit_models_kepler_calculate_rev_number_at_epoch():
     kepler: Kepler = construct_kepler()
 
     epoch: Instant = Instant.date_time(DateTime(2018, 1, 1, 0, 0, 0), Scale.UTC)
 
     assert kepler.calculate_revolution_number_at(epoch) is not None
+
+
+def test_trajectory_orbit_models_kepler_estimate_ascending_node_instant():
+    kepler: Kepler = construct_kepler()
+
+    first_instant: Instant = kepler.estimate_ascending_node_instant(2)
+    second_instant: Instant = kepler.estimate_ascending_node_instant(3)
+
+    assert first_instant.is_defined()
+    assert second_instant.is_defined()
+    assert first_instant < second_instant
@@ -7,6 +7,7 @@ import numpy as np
 from ostk.physics.time import Instant
 from ostk.physics.time import DateTime
 from ostk.physics.time import Scale
+from ostk.physics.time import Duration
 from ostk.physics.coordinate import Position
 from ostk.physics.coordinate import Velocity
 from ostk.physics.coordinate import Frame
@@ -192,6 +193,68 @@ class TestPropagated:
         assert propagated_state_array_orbit[0].get_instant() == instant_array[0]
         assert propagated_state_array_orbit[1].get_instant() == instant_array[1]
 
+        assert (
+            propagated.calculate_states_at(instant_array, thread_count=1)
+            == propagated_state_array
+        )
+
+    def test_cache_policy(
+        self,
+        propagated: Propagated,
+        state: State,
+    ):
+        assert propagated.get_cache_policy().maximum_state_count == 0
+        assert propagated.get_cache_policy().maximum_memory_size == 0
+
+        cache_policy = Propagated.CachePolicy(maximum_state_count=2)
+        propagated.set_cache_policy(cache_policy)
+
+        assert propagated.get_cache_policy().maximum_state_count == 2
+
+        propagated.add_cached_state(
+            propagated.calculate_state_at(state.get_instant() + Duration.minutes(5.0))
+        )
+        propagated.add_cached_state(
+            propagated.calculate_state_at(state.get_instant() + Duration.minutes(10.0))
+        )
+
+        assert len(propagated.access_cached_state_array()) == 2
+
+        propagated.set_cache_policy(Propagated.CachePolicy.unbounded())
+
+    def test_hermite_interpolation_span(
+        self,
+        propagated: Propagated,
+    ):
+        assert propagated.get_hermite_interpolation_span().is_defined() is False
+
+        propagated.set_hermite_interpolation_span(Duration.minutes(10.0))
+
+        assert propagated.get_hermite_interpolation_span() == Duration.minutes(10.0)
+
+        propagated.set_hermite_interpolation_span(Duration.undefined())
+
+        assert propagated.get_hermite_interpolation_span().is_defined() is False
+
+    def test_checkpoint_spacing(
+        self,
+        propagated: Propagated,
+        state: State,
+    ):
+        assert propagated.get_checkpoint_spacing().is_defined() is False
+
+        propagated.set_checkpoint_spacing(Duration.minutes(10.0))
+
+        assert propagated.get_checkpoint_spacing() == Duration.minutes(10.0)
+
+        propagated.calculate_state_at(state.get_instant() + Duration.minutes(30.0))
+
+        assert len(propagated.access_cached_state_array()) > 1
+
+        propagated.set_checkpoint_spacing(Duration.undefined())
+
+        assert propagated.get_checkpoint_spacing().is_defined() is False
+
     def test_calculate_revolution_number_at(
         self,
         propagated: Propagated,
@@ -211,6 +274,13 @@ class TestPropagated:
         assert len(propagated.access_cached_state_array()) == 1
         assert propagated.access_cached_state_array()[0] == state
 
+    def test_get_cached_state_array(
+        self,
+        propagated: Propagated,
+        state: State,
+    ):
+        assert propagated.get_cached_state_array() == [state]
+
     def test_access_propagator(
         self,
         propagated: Propagated,
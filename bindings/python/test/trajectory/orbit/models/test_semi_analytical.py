@@ -0,0 +1,91 @@
+# Apache License 2.0
+
+import pytest
+
+import numpy as np
+
+from ostk.physics.time import Instant
+from ostk.physics.time import DateTime
+from ostk.physics.time import Scale
+from ostk.physics.time import Duration
+from ostk.physics.coordinate import Position
+from ostk.physics.coordinate import Velocity
+from ostk.physics.coordinate import Frame
+from ostk.physics.environment.object.celestial import Earth
+from ostk.physics.environment.gravitational import Earth as EarthGravitationalModel
+
+from ostk.astrodynamics.trajectory import State
+from ostk.astrodynamics.dynamics import CentralBodyGravity
+from ostk.astrodynamics.dynamics import PositionDerivative
+from ostk.astrodynamics.trajectory.orbit.model import SemiAnalytical
+
+
+@pytest.fixture
+def instant() -> Instant:
+    return Instant.date_time(DateTime(2018, 1, 2, 0, 0, 0), Scale.UTC)
+
+
+@pytest.fixture
+def state(instant: Instant) -> State:
+    frame: Frame = Frame.GCRF()
+    position: Position = Position.meters([7000000.0, 0.0, 0.0], frame)
+    velocity: Velocity = Velocity.meters_per_second(
+        [0.0, 5335.865450622126, 5335.865450622126], frame
+    )
+
+    return State(instant, position, velocity)
+
+
+@pytest.fixture
+def dynamics() -> list:
+    return [PositionDerivative(), CentralBodyGravity(Earth.spherical())]
+
+
+@pytest.fixture
+def semi_analytical(state: State, dynamics: list) -> SemiAnalytical:
+    return SemiAnalytical(
+        state=state,
+        dynamics=dynamics,
+        gravitational_parameter=EarthGravitationalModel.EGM96.gravitational_parameter,
+        step_duration=Duration.hours(12.0),
+        initial_revolution_number=5,
+    )
+
+
+class TestSemiAnalytical:
+    def test_constructor(self, semi_analytical: SemiAnalytical, state: State):
+        assert semi_analytical is not None
+        assert isinstance(semi_analytical, SemiAnalytical)
+        assert semi_analytical.is_defined()
+        assert semi_analytical.get_initial_state() == state
+        assert semi_analytical.get_step_duration() == Duration.hours(12.0)
+        assert len(semi_analytical.get_dynamics()) == 2
+        assert semi_analytical.get_revolution_number_at_epoch() == 5
+
+    def test_calculate_mean_elements_at(
+        self, semi_analytical: SemiAnalytical, instant: Instant
+    ):
+        elements: np.ndarray = semi_analytical.calculate_mean_elements_at(
+            instant + Duration.days(2.0)
+        )
+
+        assert elements.shape == (6,)
+        assert elements[0] == pytest.approx(7000000.0, abs=10.0)
+
+    def test_calculate_states_at(
+        self, semi_analytical: SemiAnalytical, instant: Instant
+    ):
+        instants: list[Instant] = [
+            instant + Duration.hours(6.0 * i) for i in range(-4, 5)
+        ]
+
+        states: list[State] = semi_analytical.calculate_states_at(instants)
+
+        assert len(states) == len(instants)
+
+        for state in states:
+            radius: float = np.linalg.norm(state.get_position().get_coordinates())
+
+            assert radius == pytest.approx(7000000.0, abs=100.0)
+
+        assert semi_analytical.calculate_state_at(instants[3]) == states[3]
@@ -1 +1,99 @@
 # Apache License 2.0
+
+import tempfile
+
+import pytest
+
+import numpy as np
+
+from ostk.core.filesystem import File
+from ostk.core.filesystem import Path
+
+from ostk.physics.coordinate import Frame
+from ostk.physics.time import Duration
+
+from ostk.astrodynamics.trajectory.orbit.model import SGP4
+from ostk.astrodynamics.trajectory.orbit.model.sgp4 import TLE
+
+
+@pytest.fixture
+def tle() -> TLE:
+    return TLE(
+        satellite_name="Satellite",
+        first_line="1 25544U 98067A   18231.17878740  .00000187  00000-0  10196-4 0  9994",
+        second_line="2 25544  51.6447  64.7824 0005971  73.1467  36.4366 15.53848234128316",
+    )
+
+
+class TestSGP4:
+    def test_calculate_catalog_states_at(self, tle: TLE):
+        instants = [tle.get_epoch() + Duration.minutes(10.0 * i) for i in range(3)]
+
+        states = SGP4.calculate_catalog_states_at([tle, tle], instants)
+
+        assert states.shape == (6, 6)
+
+        state = SGP4(tle).calculate_state_at(instants[1])
+
+        assert states[:3, 2] == pytest.approx(
+            state.get_position().get_coordinates(), abs=1e-2
+        )
+        assert states[3:, 3] == pytest.approx(
+            state.get_velocity().get_coordinates(), abs=1e-5
+        )
+
+    def test_propagate_catalog(self, tle: TLE):
+        instants = [tle.get_epoch() + Duration.minutes(10.0 * i) for i in range(3)]
+
+        positions, velocities = SGP4.propagate_catalog([tle, tle], instants)
+
+        assert positions.shape == (3, 2, 3)
+        assert velocities.shape == (3, 2, 3)
+
+        state = SGP4(tle).calculate_state_at(instants[1])
+
+        assert positions[1, 0] == pytest.approx(
+            state.get_position().get_coordinates(), abs=1e-2
+        )
+        assert velocities[1, 1] == pytest.approx(
+            state.get_velocity().get_coordinates(), abs=1e-5
+        )
+
+        lines: list[str] = [
+            str(tle.get_satellite_name()),
+            str(tle.get_first_line()),
+            str(tle.get_second_line()),
+            str(tle.get_first_line()),
+            str(tle.get_second_line()),
+        ]
+
+        lines_positions, lines_velocities = SGP4.propagate_catalog(
+            lines, instants, thread_count=1
+        )
+
+        np.testing.assert_array_equal(lines_positions, positions)
+        np.testing.assert_array_equal(lines_velocities, velocities)
+
+        catalog_file = tempfile.NamedTemporaryFile(suffix=".txt", delete=False)
+        catalog_file.write("\n".join(lines).encode())
+        catalog_file.close()
+
+        try:
+            file_positions, _ = SGP4.propagate_catalog(
+                File.path(Path.parse(catalog_file.name)), instants
+            )
+
+            np.testing.assert_array_equal(file_positions, positions)
+
+        finally:
+            File.path(Path.parse(catalog_file.name)).remove()
+
+    def test_output_frame(self, tle: TLE):
+        sgp4 = SGP4(tle, SGP4.OutputFrame.TEMEOfEpoch)
+
+        assert sgp4.get_output_frame() == SGP4.OutputFrame.TEMEOfEpoch
+        assert SGP4(tle).get_output_frame() == SGP4.OutputFrame.GCRF
+
+        state = sgp4.calculate_state_at(tle.get_epoch() + Duration.hours(1.0))
+
+        assert state.get_frame() != Frame.GCRF()
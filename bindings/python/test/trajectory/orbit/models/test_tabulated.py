@@ -1,5 +1,7 @@
 # Apache License 2.0
 
+import pickle
+
 import pytest
 
 import numpy as np
@@ -10,14 +12,21 @@ from ostk.physics.time import Instant
 from ostk.physics.time import DateTime
 from ostk.physics.time import Scale
 from ostk.physics.time import Duration
+from ostk.physics.time import Interval
+from ostk.physics.unit import Length
 from ostk.physics.coordinate import Position
 from ostk.physics.coordinate import Velocity
 from ostk.physics.coordinate import Frame
 from ostk.physics import Environment
+from ostk.physics.environment.object.celestial import Earth
 
 from ostk.astrodynamics.trajectory import State
 from ostk.astrodynamics.trajectory import Orbit
+from ostk.astrodynamics.trajectory import Propagator
+from ostk.astrodynamics.trajectory.state import NumericalSolver
 from ostk.astrodynamics.trajectory.orbit.model import Tabulated
+from ostk.astrodynamics.dynamics import CentralBodyGravity
+from ostk.astrodynamics.dynamics import PositionDerivative
 
 
 @pytest.fixture
@@ -378,3 +387,169 @@ class TestTabulated:
             tabulated.calculate_state_at(
                 test_states[-1].get_instant() + Duration.seconds(1)
             )
+
+    @pytest.mark.parametrize(
+        "interpolation_type",
+        (
+            (Interpolator.Type.Linear),
+            (Interpolator.Type.CubicSpline),
+            (Interpolator.Type.BarycentricRational),
+        ),
+    )
+    def test_constructor_numpy(
+        self, test_states: list[State], interpolation_type: Interpolator.Type
+    ):
+        epoch: Instant = test_states[0].get_instant()
+
+        timestamps = np.array(
+            [(state.get_instant() - epoch).in_seconds() for state in test_states]
+        )
+        coordinates = np.array([state.get_coordinates() for state in test_states])
+
+        tabulated = Tabulated(
+            epoch=epoch,
+            timestamps=timestamps,
+            coordinates=coordinates,
+            frame=Frame.GCRF(),
+            interpolation_type=interpolation_type,
+        )
+
+        assert tabulated.is_defined()
+        assert tabulated.get_table_epoch() == epoch
+        assert tabulated.get_interval() == Tabulated(
+            states=test_states,
+            initial_revolution_number=1,
+            interpolation_type=interpolation_type,
+        ).get_interval()
+
+        # Views share the storage of the input arrays
+
+        assert np.shares_memory(tabulated.get_timestamps(), timestamps)
+        assert np.shares_memory(tabulated.get_coordinates(), coordinates)
+        assert not tabulated.get_coordinates().flags.writeable
+
+        np.testing.assert_array_equal(tabulated.get_coordinates(), coordinates)
+
+        state: State = tabulated.calculate_state_at(test_states[1].get_instant())
+
+        assert state.get_coordinates() == pytest.approx(
+            test_states[1].get_coordinates(), rel=1e-12
+        )
+
+    def test_constructor_numpy_failure(self, test_states: list[State]):
+        epoch: Instant = test_states[0].get_instant()
+
+        timestamps = np.array([0.0, 2.0, 1.0])
+        coordinates = np.array([state.get_coordinates() for state in test_states[:3]])
+
+        with pytest.raises(RuntimeError):
+            Tabulated(
+                epoch=epoch,
+                timestamps=timestamps,
+                coordinates=coordinates,
+                frame=Frame.GCRF(),
+            )
+
+        with pytest.raises(ValueError):
+            Tabulated(
+                epoch=epoch,
+                timestamps=coordinates,
+                coordinates=coordinates,
+                frame=Frame.GCRF(),
+            )
+
+    def test_pickle(self, test_states: list[State]):
+        epoch: Instant = test_states[0].get_instant()
+
+        tabulated = Tabulated(
+            epoch=epoch,
+            timestamps=np.array(
+                [(state.get_instant() - epoch).in_seconds() for state in test_states]
+            ),
+            coordinates=np.array([state.get_coordinates() for state in test_states]),
+            frame=Frame.GCRF(),
+            interpolation_type=Interpolator.Type.CubicSpline,
+        )
+
+        unpickled_tabulated: Tabulated = pickle.loads(pickle.dumps(tabulated))
+
+        assert unpickled_tabulated.get_table_epoch() == epoch
+        assert unpickled_tabulated.get_interval() == tabulated.get_interval()
+        assert (
+            unpickled_tabulated.get_interpolation_type()
+            == Interpolator.Type.CubicSpline
+        )
+        assert unpickled_tabulated.get_revolution_number_at_epoch() == 1
+
+        instant: Instant = test_states[1].get_instant() + Duration.seconds(0.5)
+
+        assert unpickled_tabulated.calculate_state_at(
+            instant
+        ) == tabulated.calculate_state_at(instant)
+
+        # With protocol 5, the table is transferred out-of-band,
+        # and the unpickled model references the buffers
+
+        buffers: list[pickle.PickleBuffer] = []
+
+        data: bytes = pickle.dumps(
+            tabulated, protocol=5, buffer_callback=buffers.append
+        )
+
+        assert len(buffers) == 2
+
+        unpickled_tabulated = pickle.loads(data, buffers=buffers)
+
+        assert np.shares_memory(
+            unpickled_tabulated.get_coordinates(), np.asarray(buffers[1].raw())
+        )
+        np.testing.assert_array_equal(
+            unpickled_tabulated.get_coordinates(), tabulated.get_coordinates()
+        )
+
+    def test_sample(self):
+        propagator = Propagator(
+            NumericalSolver.default(),
+            [PositionDerivative(), CentralBodyGravity(Earth.spherical())],
+        )
+
+        start_instant = Instant.date_time(DateTime(2018, 1, 1, 0, 0, 0), Scale.UTC)
+        interval = Interval.closed(start_instant, start_instant + Duration.hours(3.0))
+
+        state = State(
+            start_instant,
+            Position.meters([7000000.0, 0.0, 0.0], Frame.GCRF()),
+            Velocity.meters_per_second([0.0, 6500.0, 6500.0], Frame.GCRF()),
+        )
+
+        tabulated: Tabulated = Tabulated.sample(
+            propagator=propagator,
+            state=state,
+            interval=interval,
+            position_tolerance=Length.kilometers(1.0),
+            interpolation_type=Interpolator.Type.Linear,
+            maximum_step_duration=Duration.minutes(10.0),
+        )
+
+        assert isinstance(tabulated, Tabulated)
+        assert tabulated.is_defined()
+        assert tabulated.get_interval() == interval
+        assert tabulated.get_interpolation_type() == Interpolator.Type.Linear
+
+        timestamps: np.ndarray = tabulated.get_timestamps()
+        steps: np.ndarray = np.diff(timestamps)
+
+        # Fewer samples than a fixed 10 s grid, denser around perigee
+
+        assert len(timestamps) < 1081
+        assert steps.max() <= 600.0 + 1e-6
+        assert steps.max() > 2.0 * steps.min()
+
+        instant = start_instant + Duration.minutes(42.0)
+
+        assert np.linalg.norm(
+            tabulated.calculate_state_at(instant).get_position().get_coordinates()
+            - propagator.calculate_state_at(state, instant)
+            .get_position()
+            .get_coordinates()
+        ) < 2.0e3
@@ -105,3 +105,10 @@ class TestCartesianPosition:
             [1238864.12746338, 6889500.39136482, -176.262107699686],
         ):
             assert value == pytest.approx(expected, rel=1e-14)
+
+    def test_default(self, cartesian_position: CartesianPosition):
+        assert CartesianPosition.default() is cartesian_position
+        assert (
+            CoordinateBroker([CartesianPosition.default()]).get_subsets()[0]
+            is cartesian_position
+        )
@@ -57,6 +57,19 @@ class TestCoordinateBroker:
     ):
         assert coordinate_broker.has_subset(coordinate_subsets[0])
 
+    def test_get_subset_index(
+        self, coordinate_broker: CoordinateBroker, coordinate_subsets: list
+    ):
+        assert coordinate_broker.get_subset_index(coordinate_subsets[0]) == 0
+
+        with pytest.raises(RuntimeError):
+            coordinate_broker.get_subset_index(CoordinateSubset("NEVER_ADDED", 7))
+
+    def test_hash(
+        self, coordinate_broker: CoordinateBroker, coordinate_subsets: list
+    ):
+        assert hash(coordinate_broker) == hash(CoordinateBroker(coordinate_subsets))
+
     def test_extract_coordinate(
         self,
         coordinate_broker: CoordinateBroker,
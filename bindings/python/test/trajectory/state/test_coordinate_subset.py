@@ -36,6 +36,10 @@ class TestCoordinateSubset:
     def test_get_id(self, coordinate_subset: CoordinateSubset):
         assert coordinate_subset.get_id() is not None
 
+    def test_get_handle(self, coordinate_subset: CoordinateSubset, name: str, size: int):
+        assert coordinate_subset.get_handle() == CoordinateSubset(name, size).get_handle()
+        assert coordinate_subset.get_handle() != CoordinateSubset(name, size + 1).get_handle()
+
     def test_get_name(self, coordinate_subset: CoordinateSubset, name: str):
         assert coordinate_subset.get_name() == name
 
@@ -44,3 +48,4 @@ class TestCoordinateSubset:
 
     def test_mass(self):
         assert CoordinateSubset.mass() is not None
+        assert CoordinateSubset.mass() is CoordinateSubset.mass()
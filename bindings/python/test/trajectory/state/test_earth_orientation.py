@@ -0,0 +1,43 @@
+# Apache License 2.0
+
+import pytest
+
+from ostk.physics.coordinate import Frame
+from ostk.physics.time import Instant
+from ostk.physics.time import DateTime
+from ostk.physics.time import Duration
+from ostk.physics.time import Scale
+
+from ostk.astrodynamics.trajectory.state import EarthOrientation
+
+
+@pytest.fixture
+def instant() -> Instant:
+    return Instant.date_time(DateTime(2018, 1, 1, 0, 0, 0), Scale.UTC)
+
+
+class TestEarthOrientation:
+    def test_model(self):
+        assert EarthOrientation.get_model() == EarthOrientation.Model.Full
+        assert EarthOrientation.get_interpolation_step() == Duration.hours(1.0)
+
+        EarthOrientation.set_model(EarthOrientation.Model.Interpolated)
+        EarthOrientation.set_interpolation_step(Duration.minutes(10.0))
+
+        assert EarthOrientation.get_model() == EarthOrientation.Model.Interpolated
+        assert EarthOrientation.get_interpolation_step() == Duration.minutes(10.0)
+
+        EarthOrientation.set_model(EarthOrientation.Model.Full)
+        EarthOrientation.set_interpolation_step(Duration.hours(1.0))
+
+    def test_get_transform(self, instant: Instant):
+        EarthOrientation.set_model(EarthOrientation.Model.Interpolated)
+
+        transform = EarthOrientation.get_transform(
+            Frame.GCRF(), Frame.ITRF(), instant + Duration.seconds(137.0)
+        )
+
+        assert transform is not None
+        assert transform.get_instant() == instant + Duration.seconds(137.0)
+
+        EarthOrientation.set_model(EarthOrientation.Model.Full)
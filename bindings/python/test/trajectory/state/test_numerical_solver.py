@@ -223,6 +223,110 @@ class TestNumericalSolver:
                 - math.cos((end_instant - initial_state.get_instant()).in_seconds())
             )
 
+    def test_statistics(
+        self,
+        initial_state: State,
+        numerical_solver: NumericalSolver,
+    ):
+        assert not numerical_solver.is_statistics_enabled()
+
+        with pytest.raises(RuntimeError):
+            numerical_solver.get_statistics()
+
+        numerical_solver.enable_statistics()
+
+        evaluation_count: int = 0
+
+        def counting_oscillator(x, dxdt, t):
+            nonlocal evaluation_count
+            evaluation_count += 1
+            return oscillator(x, dxdt, t)
+
+        numerical_solver.integrate_time(
+            initial_state,
+            initial_state.get_instant() + Duration.seconds(100.0),
+            counting_oscillator,
+        )
+
+        statistics: NumericalSolver.Statistics = numerical_solver.get_statistics(
+            reset=True
+        )
+
+        assert statistics.evaluation_count == evaluation_count
+        assert statistics.step_count > 0
+        assert statistics.minimum_step_duration <= statistics.maximum_step_duration
+        assert statistics.get_mean_step_duration().is_defined()
+
+        statistics_dict: dict = statistics.to_dict()
+
+        assert statistics_dict["evaluation_count"] == evaluation_count
+        assert statistics_dict["cumulative_step_duration"] == pytest.approx(100.0)
+
+        assert numerical_solver.get_statistics().evaluation_count == 0
+        assert numerical_solver.get_statistics().to_dict()["mean_step_duration"] is None
+
+        numerical_solver.disable_statistics()
+
+        assert not numerical_solver.is_statistics_enabled()
+
+    def test_set_state_batch_logger(
+        self,
+        initial_state: State,
+        numerical_solver: NumericalSolver,
+        custom_condition: RealCondition,
+    ):
+        state_batches: list[list[State]] = []
+
+        numerical_solver.set_state_batch_logger(state_batches.append, 8)
+
+        numerical_solver.integrate_time(
+            initial_state,
+            initial_state.get_instant() + Duration.seconds(100.0),
+            oscillator,
+            custom_condition,
+        )
+
+        assert len(state_batches) > 0
+        assert all(len(state_batch) == 8 for state_batch in state_batches[:-1])
+        assert 0 < len(state_batches[-1]) <= 8
+
+        logged_states: list[State] = [
+            state for state_batch in state_batches for state in state_batch
+        ]
+
+        assert logged_states == numerical_solver.get_observed_states()[1:]
+
+        numerical_solver.set_state_batch_logger(None, 0)
+
+        with pytest.raises(RuntimeError):
+            numerical_solver.set_state_batch_logger(state_batches.append, 0)
+
+    def test_set_initial_time_step(
+        self,
+        initial_state: State,
+        numerical_solver_conditional: NumericalSolver,
+        custom_condition: RealCondition,
+    ):
+        end_time: float = initial_state.get_instant() + Duration.seconds(100.0)
+
+        numerical_solver_conditional.integrate_time(
+            initial_state, end_time, oscillator, custom_condition
+        )
+
+        final_time_step: float = numerical_solver_conditional.get_final_time_step()
+
+        assert final_time_step > 0.0
+
+        numerical_solver_conditional.set_initial_time_step(final_time_step)
+
+        assert numerical_solver_conditional.get_initial_time_step() == final_time_step
+
+        condition_solution = numerical_solver_conditional.integrate_time(
+            initial_state, end_time, oscillator, custom_condition
+        )
+
+        assert condition_solution.condition_is_satisfied
+
     def test_integrate_time_with_condition(
         self,
         initial_state: State,
@@ -252,6 +356,46 @@ class TestNumericalSolver:
         assert 5e-9 >= abs(state_vector[0] - math.sin(time))
         assert 5e-9 >= abs(state_vector[1] - math.cos(time))
 
+    def test_integrate_time_with_events(
+        self,
+        initial_state: State,
+        numerical_solver: NumericalSolver,
+    ):
+        end_time: float = initial_state.get_instant() + Duration.seconds(10.0)
+
+        crossing_condition = RealCondition(
+            "Crossing",
+            RealCondition.Criterion.AnyCrossing,
+            lambda state: state.get_coordinates()[0],
+            0.5,
+        )
+
+        events_solution = numerical_solver.integrate_time(
+            initial_state, end_time, oscillator, [crossing_condition]
+        )
+
+        assert events_solution.state.get_instant() == end_time
+
+        expected_times = [
+            math.asin(0.5),
+            math.pi - math.asin(0.5),
+            2.0 * math.pi + math.asin(0.5),
+            3.0 * math.pi - math.asin(0.5),
+        ]
+
+        assert len(events_solution.event_occurrences) == len(expected_times)
+
+        for event_occurrence, expected_time in zip(
+            events_solution.event_occurrences, expected_times
+        ):
+            time = (
+                event_occurrence.state.get_instant() - initial_state.get_instant()
+            ).in_seconds()
+
+            assert event_occurrence.condition_index == 0
+            assert event_occurrence.root_solver_has_converged
+            assert abs(float(time) - expected_time) < 1e-6
+
     def test_integrate_conditional_with_logger(
         self,
         initial_state: State,
@@ -312,3 +456,39 @@ class TestNumericalSolver:
             )
             is not None
         )
+
+    @pytest.mark.parametrize(
+        "long_horizon_scheme",
+        [
+            NumericalSolver.LongHorizonScheme.AdamsBashforthMoulton,
+            NumericalSolver.LongHorizonScheme.GaussLegendre,
+            NumericalSolver.LongHorizonScheme.RungeKuttaMuntheKaas,
+        ],
+    )
+    def test_long_horizon(
+        self,
+        initial_state: State,
+        long_horizon_scheme: NumericalSolver.LongHorizonScheme,
+    ):
+        numerical_solver: NumericalSolver = NumericalSolver.long_horizon(
+            long_horizon_scheme, 1e-2
+        )
+
+        assert numerical_solver.get_long_horizon_scheme() == long_horizon_scheme
+        assert numerical_solver.supports_fixed_size_integration() is False
+        assert NumericalSolver.string_from_long_horizon_scheme(long_horizon_scheme)
+
+        duration_seconds: float = 10.0
+        state_vector: np.ndarray = numerical_solver.integrate_time(
+            initial_state,
+            initial_state.get_instant() + Duration.seconds(duration_seconds),
+            oscillator,
+        ).get_coordinates()
+
+        assert 1e-8 >= abs(state_vector[0] - math.sin(duration_seconds))
+        assert 1e-8 >= abs(state_vector[1] - math.cos(duration_seconds))
+
+        with pytest.raises(Exception):
+            NumericalSolver.long_horizon(
+                NumericalSolver.LongHorizonScheme.Undefined, 1e-2
+            )
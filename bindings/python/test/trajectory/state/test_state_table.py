@@ -0,0 +1,133 @@
+# Apache License 2.0
+
+import pytest
+
+import numpy as np
+
+from ostk.physics.coordinate import Frame
+from ostk.physics.time import Duration
+from ostk.physics.time import Instant
+
+from ostk.astrodynamics import Trajectory
+from ostk.astrodynamics.trajectory import State
+from ostk.astrodynamics.trajectory.state import CoordinateBroker
+from ostk.astrodynamics.trajectory.state import CoordinateSubset
+from ostk.astrodynamics.trajectory.state import StateTable
+from ostk.astrodynamics.trajectory.state.coordinate_subset import CartesianPosition
+from ostk.astrodynamics.trajectory.state.coordinate_subset import CartesianVelocity
+
+
+@pytest.fixture
+def coordinate_broker() -> CoordinateBroker:
+    return CoordinateBroker(
+        [
+            CartesianPosition.default(),
+            CartesianVelocity.default(),
+            CoordinateSubset.mass(),
+        ]
+    )
+
+
+@pytest.fixture
+def states(coordinate_broker: CoordinateBroker) -> list[State]:
+    return [
+        State(
+            Instant.J2000() + Duration.seconds(10.0 * i),
+            [7000000.0 + i, 1.0 * i, 2.0 * i, 0.0, 7546.0 + i, 3.0 * i, 100.0 - i],
+            Frame.GCRF(),
+            coordinate_broker,
+        )
+        for i in range(5)
+    ]
+
+
+@pytest.fixture
+def state_table(states: list[State]) -> StateTable:
+    return StateTable.from_states(states)
+
+
+class TestStateTable:
+    def test_from_states(self, state_table: StateTable, states: list[State]):
+        assert state_table.is_defined()
+        assert len(state_table) == len(states)
+        assert state_table.get_epoch() == states[0].get_instant()
+        assert state_table.get_frame() == Frame.GCRF()
+        assert state_table.get_instants() == [state.get_instant() for state in states]
+        assert state_table.get_states() == states
+        assert state_table.get_state_at(2) == states[2]
+
+    def test_arrays(self, state_table: StateTable):
+        offsets: np.ndarray = state_table.get_offsets()
+
+        assert offsets.dtype == np.int64
+        assert offsets[1] == 10_000_000_000
+
+        coordinates: np.ndarray = state_table.get_coordinates()
+
+        assert coordinates.shape == (5, 7)
+        assert coordinates.flags["F_CONTIGUOUS"]
+        assert not coordinates.flags["OWNDATA"]
+        assert not coordinates.flags["WRITEABLE"]
+
+        velocities: np.ndarray = state_table.get_coordinates_of(
+            CartesianVelocity.default()
+        )
+
+        assert velocities.shape == (5, 3)
+        assert np.array_equal(velocities, coordinates[:, 3:6])
+
+    def test_get_columns(self, state_table: StateTable):
+        columns: dict = state_table.get_columns()
+
+        assert len(columns) == 8
+        assert np.array_equal(columns["offset"], state_table.get_offsets())
+        assert np.array_equal(
+            columns["CARTESIAN_POSITION_0"], state_table.get_coordinates()[:, 0]
+        )
+        assert np.array_equal(columns["MASS"], state_table.get_coordinates()[:, 6])
+
+    def test_get_datetimes(self, state_table: StateTable):
+        datetimes: np.ndarray = state_table.get_datetimes()
+
+        assert datetimes.dtype == np.dtype("datetime64[ns]")
+        assert np.array_equal(
+            datetimes - datetimes[0], state_table.get_offsets().astype("timedelta64[ns]")
+        )
+
+    def test_trajectory_get_state_table_at(
+        self, state_table: StateTable, states: list[State]
+    ):
+        trajectory = Trajectory(states)
+
+        from_datetimes: StateTable = trajectory.get_state_table_at(
+            state_table.get_datetimes()
+        )
+
+        assert len(from_datetimes) == len(states)
+        assert np.array_equal(from_datetimes.get_offsets(), state_table.get_offsets())
+        assert np.allclose(
+            from_datetimes.get_coordinates(), state_table.get_coordinates()
+        )
+
+        from_offsets: StateTable = trajectory.get_state_table_at(
+            states[0].get_instant(), np.array([5.0, 15.0])
+        )
+
+        assert np.array_equal(
+            from_offsets.get_offsets(), [5_000_000_000, 15_000_000_000]
+        )
+        assert from_offsets.get_coordinates().shape == (2, 7)
+        assert from_offsets.get_state_at(1) == trajectory.get_state_at(
+            states[0].get_instant() + Duration.seconds(15.0)
+        )
+
+        assert not trajectory.get_state_table_at(
+            np.array([], dtype="datetime64[ns]")
+        ).is_defined()
+
+        with pytest.raises(TypeError):
+            trajectory.get_state_table_at(np.array([1.0, 2.0]))
+
+    def test_undefined(self):
+        assert not StateTable.undefined().is_defined()
+        assert not StateTable.from_states([]).is_defined()
@@ -0,0 +1,42 @@
+# Apache License 2.0
+
+import pytest
+
+from ostk.physics.coordinate import Frame
+from ostk.physics.time import Instant
+from ostk.physics.time import DateTime
+from ostk.physics.time import Scale
+
+from ostk.astrodynamics.trajectory.state import TransformCache
+
+
+@pytest.fixture
+def instant() -> Instant:
+    return Instant.date_time(DateTime(2018, 1, 1, 0, 0, 0), Scale.UTC)
+
+
+class TestTransformCache:
+    def test_get(self, instant: Instant):
+        TransformCache.clear()
+
+        transform = TransformCache.get(Frame.GCRF(), Frame.ITRF(), instant)
+
+        assert transform is not None
+        assert TransformCache.get_size() == 1
+
+        TransformCache.get(Frame.GCRF(), Frame.ITRF(), instant)
+
+        assert TransformCache.get_size() == 1
+
+    def test_capacity(self, instant: Instant):
+        assert TransformCache.get_capacity() == TransformCache.default_capacity
+
+        TransformCache.set_capacity(0)
+
+        assert TransformCache.get_size() == 0
+
+        TransformCache.get(Frame.GCRF(), Frame.ITRF(), instant)
+
+        assert TransformCache.get_size() == 0
+
+        TransformCache.set_capacity(TransformCache.default_capacity)
@@ -0,0 +1,64 @@
+# Apache License 2.0
+
+import pytest
+
+from ostk.physics.coordinate import Frame
+from ostk.physics.time import Instant
+from ostk.physics.time import Interval
+from ostk.physics.time import DateTime
+from ostk.physics.time import Duration
+from ostk.physics.time import Scale
+
+from ostk.astrodynamics.trajectory.state import TransformInterpolator
+
+
+@pytest.fixture
+def interval() -> Interval:
+    start_instant: Instant = Instant.date_time(DateTime(2018, 1, 1, 0, 0, 0), Scale.UTC)
+
+    return Interval.closed(start_instant, start_instant + Duration.hours(1.0))
+
+
+@pytest.fixture
+def transform_interpolator(interval: Interval) -> TransformInterpolator:
+    return TransformInterpolator(Frame.GCRF(), Frame.ITRF(), interval)
+
+
+class TestTransformInterpolator:
+    def test_constructor(self, interval: Interval):
+        assert TransformInterpolator(Frame.GCRF(), Frame.ITRF(), interval) is not None
+        assert (
+            TransformInterpolator(
+                from_frame=Frame.GCRF(),
+                to_frame=Frame.ITRF(),
+                interval=interval,
+                step=Duration.minutes(10.0),
+            ).get_node_count()
+            == 7
+        )
+
+    def test_getters(
+        self,
+        transform_interpolator: TransformInterpolator,
+        interval: Interval,
+    ):
+        assert transform_interpolator.get_interval() == interval
+        assert transform_interpolator.get_step() == Duration.minutes(5.0)
+        assert transform_interpolator.get_node_count() == 13
+
+    def test_get_transform_at(
+        self,
+        transform_interpolator: TransformInterpolator,
+        interval: Interval,
+    ):
+        instant: Instant = interval.get_start() + Duration.seconds(137.0)
+
+        transform = transform_interpolator.get_transform_at(instant)
+
+        assert transform is not None
+        assert transform.get_instant() == instant
+
+        with pytest.raises(RuntimeError):
+            transform_interpolator.get_transform_at(
+                interval.get_end() + Duration.seconds(1.0)
+            )
@@ -0,0 +1,105 @@
+# Apache License 2.0
+
+import pytest
+
+import numpy as np
+
+from ostk.core.filesystem import Path
+from ostk.core.filesystem import File
+
+from ostk.physics.time import Instant
+from ostk.physics.time import Duration
+from ostk.physics.coordinate import Frame
+
+from ostk.astrodynamics.trajectory import CompactEphemeris
+from ostk.astrodynamics.trajectory import Ephemeris
+from ostk.astrodynamics.trajectory import State
+
+
+@pytest.fixture
+def instants() -> list[Instant]:
+    return [Instant.J2000() + Duration.minutes(1.0 * i) for i in range(100)]
+
+
+@pytest.fixture
+def positions() -> np.ndarray:
+    angles = np.arange(100) * 60.0 * 2.0 * np.pi / 5828.5
+    return 7000000.0 * np.column_stack(
+        (np.cos(angles), np.sin(angles), np.zeros(100))
+    )
+
+
+@pytest.fixture
+def velocities() -> np.ndarray:
+    angles = np.arange(100) * 60.0 * 2.0 * np.pi / 5828.5
+    return 7546.0 * np.column_stack((-np.sin(angles), np.cos(angles), np.zeros(100)))
+
+
+@pytest.fixture
+def ephemeris(
+    instants: list[Instant], positions: np.ndarray, velocities: np.ndarray
+) -> Ephemeris:
+    return Ephemeris(instants, positions, velocities, Frame.GCRF())
+
+
+@pytest.fixture
+def compact_ephemeris(ephemeris: Ephemeris) -> CompactEphemeris:
+    return CompactEphemeris(ephemeris)
+
+
+class TestCompactEphemeris:
+    def test_constructor(
+        self,
+        compact_ephemeris: CompactEphemeris,
+        ephemeris: Ephemeris,
+        instants: list[Instant],
+        positions: np.ndarray,
+    ):
+        assert compact_ephemeris.is_defined()
+        assert compact_ephemeris.has_velocities()
+        assert compact_ephemeris.get_size() == len(instants)
+        assert compact_ephemeris.get_block_size() == 32
+        assert compact_ephemeris.get_frame() == Frame.GCRF()
+        assert compact_ephemeris.get_instants() == instants
+        assert np.allclose(compact_ephemeris.get_positions(), positions, atol=2.0)
+
+        position_only = CompactEphemeris(
+            ephemeris=ephemeris, block_size=16, store_velocities=False
+        )
+
+        assert not position_only.has_velocities()
+        assert position_only.get_storage_size() < compact_ephemeris.get_storage_size()
+
+    def test_get_states(self, compact_ephemeris: CompactEphemeris):
+        states: list[State] = compact_ephemeris.get_states()
+
+        assert len(states) == compact_ephemeris.get_size()
+        assert states[1] == compact_ephemeris.get_state_at(1)
+        assert compact_ephemeris.to_ephemeris().get_size() == len(states)
+
+    def test_calculate_states_at(
+        self, compact_ephemeris: CompactEphemeris, instants: list[Instant]
+    ):
+        interpolation_instants: list[Instant] = [
+            instants[0] + Duration.seconds(79.3 * i) for i in range(50)
+        ]
+
+        states: list[State] = compact_ephemeris.calculate_states_at(
+            interpolation_instants
+        )
+        positions: np.ndarray = compact_ephemeris.calculate_positions_at(
+            interpolation_instants
+        )
+
+        assert len(states) == len(interpolation_instants)
+        assert positions.shape == (len(interpolation_instants), 3)
+
+    def test_save_load(self, compact_ephemeris: CompactEphemeris, tmp_path):
+        file: File = File.path(Path.parse(str(tmp_path / "ephemeris.bin")))
+
+        compact_ephemeris.save(file)
+
+        assert CompactEphemeris.load(file) == compact_ephemeris
+
+    def test_undefined(self):
+        assert not CompactEphemeris.undefined().is_defined()
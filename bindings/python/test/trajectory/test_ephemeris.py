@@ -0,0 +1,63 @@
+# Apache License 2.0
+
+import pytest
+
+import numpy as np
+
+from ostk.physics.time import Instant
+from ostk.physics.time import Duration
+from ostk.physics.coordinate import Frame
+
+from ostk.astrodynamics.trajectory import Ephemeris
+from ostk.astrodynamics.trajectory import State
+
+
+@pytest.fixture
+def instants() -> list[Instant]:
+    return [Instant.J2000() + Duration.seconds(10.0 * i) for i in range(3)]
+
+
+@pytest.fixture
+def positions() -> np.ndarray:
+    return np.array([[7000000.0 + i, 1.0 * i, 2.0 * i] for i in range(3)])
+
+
+@pytest.fixture
+def velocities() -> np.ndarray:
+    return np.array([[0.0, 7546.0 + i, 3.0 * i] for i in range(3)])
+
+
+@pytest.fixture
+def ephemeris(
+    instants: list[Instant], positions: np.ndarray, velocities: np.ndarray
+) -> Ephemeris:
+    return Ephemeris(instants, positions, velocities, Frame.GCRF())
+
+
+class TestEphemeris:
+    def test_constructor(
+        self,
+        ephemeris: Ephemeris,
+        instants: list[Instant],
+        positions: np.ndarray,
+        velocities: np.ndarray,
+    ):
+        assert ephemeris.is_defined()
+        assert ephemeris.get_size() == len(instants)
+        assert ephemeris.get_instants() == instants
+        assert ephemeris.get_frame() == Frame.GCRF()
+        assert np.array_equal(ephemeris.get_positions(), positions)
+        assert np.array_equal(ephemeris.get_velocities(), velocities)
+
+    def test_get_states(self, ephemeris: Ephemeris, positions: np.ndarray):
+        states: list[State] = ephemeris.get_states()
+
+        assert len(states) == ephemeris.get_size()
+        assert states[1] == ephemeris.get_state_at(1)
+        assert np.array_equal(states[1].get_coordinates()[0:3], positions[1])
+
+    def test_from_states(self, ephemeris: Ephemeris):
+        assert Ephemeris.from_states(ephemeris.get_states()) == ephemeris
+
+    def test_undefined(self):
+        assert not Ephemeris.undefined().is_defined()
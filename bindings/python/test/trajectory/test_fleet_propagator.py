@@ -0,0 +1,134 @@
+# Apache License 2.0
+
+import pytest
+
+import numpy as np
+
+from ostk.physics.time import Instant
+from ostk.physics.time import DateTime
+from ostk.physics.time import Scale
+from ostk.physics.time import Duration
+from ostk.physics.time import Interval
+from ostk.physics.coordinate import Position
+from ostk.physics.coordinate import Velocity
+from ostk.physics.coordinate import Frame
+from ostk.physics.environment.object.celestial import Earth
+from ostk.physics.environment.object.celestial import Moon
+from ostk.physics.environment.object.celestial import Sun
+
+from ostk.astrodynamics.trajectory import State
+from ostk.astrodynamics.trajectory import Propagator
+from ostk.astrodynamics.trajectory import FleetPropagator
+from ostk.astrodynamics.trajectory.state import NumericalSolver
+from ostk.astrodynamics.dynamics import CentralBodyGravity
+from ostk.astrodynamics.dynamics import PositionDerivative
+from ostk.astrodynamics.dynamics import ThirdBodyGravity
+
+
+@pytest.fixture
+def start_instant() -> Instant:
+    return Instant.date_time(DateTime(2021, 3, 20, 12, 0, 0), Scale.UTC)
+
+
+@pytest.fixture
+def propagator() -> Propagator:
+    return Propagator(
+        NumericalSolver(
+            NumericalSolver.LogType.NoLog,
+            NumericalSolver.StepperType.RungeKuttaFehlberg78,
+            5.0,
+            1.0e-12,
+            1.0e-12,
+        ),
+        [
+            PositionDerivative(),
+            CentralBodyGravity(Earth.spherical()),
+            ThirdBodyGravity(Sun.spherical()),
+            ThirdBodyGravity(Moon.spherical()),
+        ],
+    )
+
+
+@pytest.fixture
+def fleet_propagator(propagator: Propagator) -> FleetPropagator:
+    return FleetPropagator(
+        propagator=propagator,
+        ephemeris_segment_duration=Duration.days(1.0),
+        thread_count=2,
+    )
+
+
+@pytest.fixture
+def states(start_instant: Instant) -> list[State]:
+    return [
+        State(
+            start_instant,
+            Position.meters(position, Frame.GCRF()),
+            Velocity.meters_per_second(velocity, Frame.GCRF()),
+        )
+        for position, velocity in [
+            ([7000.0e3, 0.0, 0.0], [0.0, 5335.865450622126, 5335.865450622126]),
+            ([0.0, 7200.0e3, 0.0], [-7440.0, 0.0, 0.0]),
+        ]
+    ]
+
+
+@pytest.fixture
+def instants(start_instant: Instant) -> list[Instant]:
+    return [start_instant + Duration.hours(float(i)) for i in range(1, 4)]
+
+
+class TestFleetPropagator:
+    def test_constructor(self, fleet_propagator: FleetPropagator):
+        assert fleet_propagator is not None
+        assert isinstance(fleet_propagator, FleetPropagator)
+        assert fleet_propagator.is_defined()
+        assert not FleetPropagator.undefined().is_defined()
+
+    def test_getters(self, fleet_propagator: FleetPropagator):
+        assert fleet_propagator.get_propagator() is not None
+        assert fleet_propagator.get_density_table() is None
+        assert fleet_propagator.get_ephemeris_segment_duration() == Duration.days(1.0)
+        assert fleet_propagator.get_thread_count() == 2
+
+    def test_get_shared_environment_propagator(
+        self,
+        fleet_propagator: FleetPropagator,
+        start_instant: Instant,
+    ):
+        propagator: Propagator = fleet_propagator.get_shared_environment_propagator(
+            interval=Interval.closed(start_instant, start_instant + Duration.hours(3.0))
+        )
+
+        dynamics = propagator.get_dynamics()
+
+        assert len(dynamics) == 4
+        assert dynamics[2].get_ephemeris_table() is not None
+        assert dynamics[3].get_ephemeris_table() is not None
+
+    def test_calculate_states_at(
+        self,
+        fleet_propagator: FleetPropagator,
+        propagator: Propagator,
+        states: list[State],
+        instants: list[Instant],
+    ):
+        fleet_states: list[list[State]] = fleet_propagator.calculate_states_at(
+            states=states,
+            instants=instants,
+        )
+
+        assert len(fleet_states) == len(states)
+
+        for state, satellite_states in zip(states, fleet_states):
+            reference_states = propagator.calculate_states_at(state, instants)
+
+            assert len(satellite_states) == len(instants)
+
+            for satellite_state, reference_state in zip(
+                satellite_states, reference_states
+            ):
+                assert np.linalg.norm(
+                    satellite_state.get_position().get_coordinates()
+                    - reference_state.get_position().get_coordinates()
+                ) == pytest.approx(0.0, abs=1e-2)
@@ -10,6 +10,7 @@ from ostk.physics.coordinate import Velocity
 from ostk.physics.coordinate import Frame
 
 from ostk.astrodynamics.trajectory import LocalOrbitalFrameFactory
+from ostk.astrodynamics.trajectory import State
 
 
 @pytest.fixture
@@ -69,6 +70,43 @@ class TestLocalOrbitalFrameFactory:
         assert frame is not None
         assert frame.is_defined()
 
+    def test_generate_transform(
+        self,
+        local_orbital_frame_factory: LocalOrbitalFrameFactory,
+        instant: Instant,
+        position_vector: list,
+        velocity_vector: list,
+    ):
+        transform = local_orbital_frame_factory.generate_transform(
+            instant,
+            position_vector,
+            velocity_vector,
+        )
+
+        assert transform is not None
+        assert transform.is_defined()
+
+    def test_generate_rotation_matrices(
+        self,
+        local_orbital_frame_factory: LocalOrbitalFrameFactory,
+        parent_frame: Frame,
+        instant: Instant,
+        position_vector: list,
+        velocity_vector: list,
+    ):
+        state = State(
+            instant,
+            Position.meters(position_vector, parent_frame),
+            Velocity.meters_per_second(velocity_vector, parent_frame),
+        )
+
+        rotation_matrices = local_orbital_frame_factory.generate_rotation_matrices(
+            [state, state]
+        )
+
+        assert len(rotation_matrices) == 2
+        assert rotation_matrices[0].shape == (3, 3)
+
     def test_is_defined(
         self,
         local_orbital_frame_factory: LocalOrbitalFrameFactory,
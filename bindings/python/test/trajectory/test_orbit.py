@@ -2,10 +2,17 @@
 
 import pytest
 
+import math
+import tempfile
+
+from ostk.core.filesystem import Path
+from ostk.core.filesystem import File
+
 from ostk.physics.environment.object.celestial import Earth
 from ostk.physics.unit import Length, Angle
 from ostk.physics.time import Scale, Instant, DateTime, Time, Duration, Interval
 
+from ostk.astrodynamics import ExecutionContext
 from ostk.astrodynamics.trajectory import Orbit, State
 from ostk.astrodynamics.trajectory.orbit import Pass
 from ostk.astrodynamics.trajectory.orbit import Pass
@@ -100,6 +107,79 @@ class TestOrbit:
 
         assert orbit.get_pass_with_revolution_number(2, Duration.minutes(10.0)) is not None
 
+    def test_get_sampled_pass_with_revolution_number(self, orbit: Orbit):
+        pass_ = orbit.get_sampled_pass_with_revolution_number(3)
+
+        assert pass_ is not None
+        assert isinstance(pass_, Pass)
+        assert pass_.is_defined()
+        assert pass_.get_revolution_number() == 3
+
+        assert (
+            orbit.get_sampled_pass_with_revolution_number(
+                revolution_number=5,
+                step_duration=Duration.seconds(30.0),
+                window_step_count=500,
+            )
+            is not None
+        )
+
+    def test_pass_snapshot(self, earth: Earth, epoch: Instant):
+        orbit: Orbit = Orbit.sun_synchronous(
+            epoch, Length.kilometers(500.0), Time.midnight(), earth
+        )
+
+        pass_: Pass = orbit.get_pass_with_revolution_number(3)
+
+        snapshot_file = tempfile.NamedTemporaryFile(suffix=".passes", delete=False)
+        snapshot_file.close()
+
+        try:
+            orbit.save_pass_snapshot(File.path(Path.parse(snapshot_file.name)))
+
+            restored_orbit: Orbit = Orbit.sun_synchronous(
+                epoch, Length.kilometers(500.0), Time.midnight(), earth
+            )
+            restored_orbit.load_pass_snapshot(File.path(Path.parse(snapshot_file.name)))
+
+            assert restored_orbit.get_pass_with_revolution_number(3) == pass_
+
+        finally:
+            File.path(Path.parse(snapshot_file.name)).remove()
+
+    def test_get_ground_track(self, earth: Earth, epoch: Instant):
+        orbit: Orbit = Orbit.sun_synchronous(
+            epoch, Length.kilometers(500.0), Time.midnight(), earth
+        )
+
+        instants: list[Instant] = Interval.closed(
+            epoch, epoch + Duration.hours(1.0)
+        ).generate_grid(Duration.minutes(1.0))
+
+        ground_track = orbit.get_ground_track(instants)
+
+        assert ground_track.shape == (len(instants), 3)
+        assert (abs(ground_track[:, 0]) <= math.pi / 2.0).all()
+        assert (abs(ground_track[:, 1]) <= math.pi).all()
+        assert (abs(ground_track[:, 2] - 500.0e3) < 50.0e3).all()
+
+    def test_get_coes_at(self, earth: Earth, epoch: Instant):
+        orbit: Orbit = Orbit.sun_synchronous(
+            epoch, Length.kilometers(500.0), Time.midnight(), earth
+        )
+
+        instants: list[Instant] = Interval.closed(
+            epoch, epoch + Duration.hours(1.0)
+        ).generate_grid(Duration.minutes(1.0))
+
+        coes = orbit.get_coes_at(instants)
+
+        assert len(coes) == len(instants)
+
+        for coe in coes:
+            assert coe.get_eccentricity() < 1e-3
+            assert abs(coe.get_inclination().in_degrees() - 97.4) < 0.1
+
     def test_undefined(self):
         assert Orbit.undefined().is_defined() is False
 
@@ -169,6 +249,42 @@ class TestOrbit:
             argument_of_latitude=Angle.degrees(50.0),
         ).is_defined()
 
+    def test_sun_synchronous_array(self, earth: Earth, epoch: Instant):
+        orbits: list[Orbit] = Orbit.sun_synchronous(
+            epoch=epoch,
+            altitudes=[Length.kilometers(500.0), Length.kilometers(600.0)],
+            local_times_at_descending_node=[Time.midnight(), Time(10, 30, 0)],
+            celestial_object=earth,
+        )
+
+        assert len(orbits) == 2
+        assert all(orbit.is_defined() for orbit in orbits)
+
+    def test_repeat_ground_track(self, earth: Earth, epoch: Instant):
+        orbit: Orbit = Orbit.repeat_ground_track(
+            epoch=epoch,
+            revolution_count=15,
+            day_count=1,
+            inclination=Angle.degrees(98.0),
+            celestial_object=earth,
+        )
+
+        assert orbit is not None
+        assert isinstance(orbit, Orbit)
+        assert orbit.is_defined()
+
     def test_compute_passes(self, orbit: Orbit, states: list[State]):
         passes: list[tuple[int, Pass]] = orbit.compute_passes(states, 1)
         assert passes is not None
+
+    def test_compute_passes_in_parallel(self, orbit: Orbit, states: list[State]):
+        passes: list[tuple[int, Pass]] = Orbit.compute_passes(
+            states, 1, ExecutionContext(2)
+        )
+
+        reference_passes: list[tuple[int, Pass]] = Orbit.compute_passes(states, 1)
+
+        assert len(passes) == len(reference_passes)
+        assert [index for index, _ in passes] == [
+            index for index, _ in reference_passes
+        ]
@@ -1,5 +1,7 @@
 # Apache License 2.0
 
+from concurrent.futures import ThreadPoolExecutor
+
 import pytest
 
 import numpy as np
@@ -301,6 +303,62 @@ class TestPropagator:
     ):
         assert propagator.access_numerical_solver() == numerical_solver
 
+    def test_get_statistics(
+        self, numerical_solver: NumericalSolver, dynamics: list, state: State
+    ):
+        with pytest.raises(RuntimeError):
+            Propagator(numerical_solver, dynamics).get_statistics()
+
+        numerical_solver.enable_statistics()
+
+        propagator = Propagator(numerical_solver, dynamics)
+        propagator.calculate_state_at(state, state.get_instant() + Duration.minutes(10.0))
+
+        statistics: NumericalSolver.Statistics = propagator.get_statistics()
+
+        assert statistics.evaluation_count > 0
+        assert statistics.step_count > 0
+        assert (
+            numerical_solver.get_statistics().evaluation_count
+            == statistics.evaluation_count
+        )
+
+    def test_dynamics_timing(
+        self, propagator: Propagator, dynamics: list, state: State
+    ):
+        assert not propagator.is_dynamics_timing_enabled()
+
+        with pytest.raises(RuntimeError):
+            propagator.get_dynamics_timings()
+
+        propagator.enable_dynamics_timing()
+
+        assert propagator.is_dynamics_timing_enabled()
+
+        propagator.calculate_state_at(
+            state, state.get_instant() + Duration.minutes(10.0)
+        )
+
+        timings: dict[str, Dynamics.Timing] = propagator.get_dynamics_timings(
+            reset=True
+        )
+
+        assert set(timings.keys()) == {dynamic.get_name() for dynamic in dynamics}
+
+        for timing in timings.values():
+            assert timing.call_count > 0
+            assert timing.duration.is_positive()
+            assert timing.to_dict()["duration"] > 0.0
+
+        assert all(
+            timing.call_count == 0
+            for timing in propagator.get_dynamics_timings().values()
+        )
+
+        propagator.disable_dynamics_timing()
+
+        assert not propagator.is_dynamics_timing_enabled()
+
     def test_get_dynamics(self, propagator: Propagator, dynamics: list):
         assert propagator.get_dynamics() == dynamics
 
@@ -370,6 +428,89 @@ class TestPropagator:
         )
         assert propagator_state.get_instant() == instant
 
+    def test_calculate_state_and_state_transition_matrix_at(
+        self, propagator: Propagator, state: State
+    ):
+        instant: Instant = Instant.date_time(DateTime(2018, 1, 1, 0, 10, 0), Scale.UTC)
+
+        (
+            propagator_state,
+            state_transition_matrix,
+        ) = propagator.calculate_state_and_state_transition_matrix_at(state, instant)
+
+        assert propagator_state.get_instant() == instant
+        assert np.allclose(
+            propagator_state.get_coordinates(),
+            propagator.calculate_state_at(state, instant).get_coordinates(),
+        )
+
+        state_size: int = len(propagator_state.get_coordinates())
+
+        assert state_transition_matrix.shape == (state_size, state_size)
+        assert np.isfinite(state_transition_matrix).all()
+
+        assert not np.allclose(state_transition_matrix, np.eye(state_size))
+
+    def test_calculate_states_and_state_transition_matrices_at(
+        self, propagator: Propagator, state: State
+    ):
+        instants: list[Instant] = [
+            Instant.date_time(DateTime(2018, 1, 1, 0, 5, 0), Scale.UTC),
+            Instant.date_time(DateTime(2018, 1, 1, 0, 10, 0), Scale.UTC),
+        ]
+
+        states_and_stms = propagator.calculate_states_and_state_transition_matrices_at(
+            state, instants
+        )
+
+        assert len(states_and_stms) == len(instants)
+
+        for instant, (propagator_state, state_transition_matrix) in zip(
+            instants, states_and_stms
+        ):
+            (
+                _,
+                reference_state_transition_matrix,
+            ) = propagator.calculate_state_and_state_transition_matrix_at(state, instant)
+
+            assert propagator_state.get_instant() == instant
+            assert np.allclose(
+                state_transition_matrix, reference_state_transition_matrix, rtol=1e-4
+            )
+
+    def test_calculate_states_and_covariances_at(
+        self, propagator: Propagator, state: State
+    ):
+        instants: list[Instant] = [
+            Instant.date_time(DateTime(2018, 1, 1, 0, 5, 0), Scale.UTC),
+            Instant.date_time(DateTime(2018, 1, 1, 0, 10, 0), Scale.UTC),
+        ]
+
+        state_size: int = len(state.get_coordinates())
+        covariance: np.ndarray = np.eye(state_size)
+
+        states_and_covariances = propagator.calculate_states_and_covariances_at(
+            state, covariance, instants
+        )
+
+        assert len(states_and_covariances) == len(instants)
+
+        for instant, (propagator_state, propagator_covariance) in zip(
+            instants, states_and_covariances
+        ):
+            (
+                _,
+                state_transition_matrix,
+            ) = propagator.calculate_state_and_state_transition_matrix_at(state, instant)
+
+            assert propagator_state.get_instant() == instant
+            assert propagator_covariance.shape == (state_size, state_size)
+            assert np.allclose(
+                propagator_covariance,
+                state_transition_matrix @ state_transition_matrix.T,
+                rtol=1e-4,
+            )
+
     def test_calculate_state_to_condition(
         self,
         conditional_numerical_solver: NumericalSolver,
@@ -392,6 +533,54 @@ class TestPropagator:
             (solution.state.get_instant() - state.get_instant()).in_seconds()
         )
 
+        observed_states: list[State] = (
+            propagator.access_numerical_solver().get_observed_states()
+        )
+
+        assert len(observed_states) > 0
+
+    def test_calculate_state_and_events_at(
+        self,
+        conditional_numerical_solver: NumericalSolver,
+        dynamics: list[Dynamics],
+        state: State,
+        event_condition: InstantCondition,
+    ):
+        propagator: Propagator = Propagator(conditional_numerical_solver, dynamics)
+
+        instant: Instant = Instant.date_time(DateTime(2018, 1, 1, 0, 10, 0), Scale.UTC)
+
+        event_conditions: list[InstantCondition] = [
+            InstantCondition(
+                InstantCondition.Criterion.StrictlyPositive,
+                state.get_instant() + Duration.seconds(300.0),
+            ),
+            event_condition,
+        ]
+
+        solution = propagator.calculate_state_and_events_at(
+            state=state,
+            instant=instant,
+            event_conditions=event_conditions,
+        )
+
+        assert solution.state.get_instant() == instant
+        assert len(solution.event_occurrences) == 2
+
+        assert [
+            occurrence.condition_index for occurrence in solution.event_occurrences
+        ] == [1, 0]
+        assert pytest.approx(42.0, abs=1e-3) == float(
+            (
+                solution.event_occurrences[0].state.get_instant() - state.get_instant()
+            ).in_seconds()
+        )
+        assert pytest.approx(300.0, abs=1e-3) == float(
+            (
+                solution.event_occurrences[1].state.get_instant() - state.get_instant()
+            ).in_seconds()
+        )
+
     def test_calculate_states_at(self, propagator: Propagator, state: State):
         instant_array = [
             Instant.date_time(DateTime(2018, 1, 1, 0, 10, 0), Scale.UTC),
@@ -446,6 +635,160 @@ class TestPropagator:
 
         _ = propagator.calculate_states_at(state, instant_array)
 
+    def test_calculate_states_at_with_state_array(self, propagator: Propagator, state: State):
+        instant = Instant.date_time(DateTime(2018, 1, 1, 0, 10, 0), Scale.UTC)
+
+        states: list[State] = propagator.calculate_states_at([state, state], instant)
+
+        assert len(states) == 2
+        assert states[0] == propagator.calculate_state_at(state, instant)
+        assert states[1] == states[0]
+
+        assert propagator.calculate_states_at([state], instant, thread_count=1)[0] == states[0]
+
+    def test_calculate_states_at_from_concurrent_threads(
+        self,
+        propagator: Propagator,
+        state: State,
+    ):
+        instant_array = [
+            Instant.date_time(DateTime(2018, 1, 1, 0, 10, 0), Scale.UTC),
+            Instant.date_time(DateTime(2018, 1, 1, 0, 20, 0), Scale.UTC),
+        ]
+
+        expected_states: list[State] = propagator.calculate_states_at(state, instant_array)
+
+        with ThreadPoolExecutor(max_workers=4) as executor:
+            futures = [
+                executor.submit(propagator.calculate_states_at, state, instant_array)
+                for _ in range(8)
+            ]
+
+            for future in futures:
+                assert future.result() == expected_states
+
+    def test_calculate_states_at_from_state_array(
+        self,
+        propagator: Propagator,
+        state: State,
+    ):
+        instant_array = [
+            Instant.date_time(DateTime(2018, 1, 1, 0, 10, 0), Scale.UTC),
+            Instant.date_time(DateTime(2018, 1, 1, 0, 20, 0), Scale.UTC),
+        ]
+
+        state_arrays: list[list[State]] = propagator.calculate_states_at(
+            [state, state], instant_array, thread_count=2
+        )
+
+        assert len(state_arrays) == 2
+        assert state_arrays[0] == propagator.calculate_states_at(state, instant_array)
+        assert state_arrays[1] == state_arrays[0]
+
+    def test_calculate_coordinates_at(
+        self,
+        propagator: Propagator,
+        state: State,
+        coordinate_broker_7d: CoordinateBroker,
+    ):
+        instant_array = [
+            Instant.date_time(DateTime(2018, 1, 1, 0, 10, 0), Scale.UTC),
+            Instant.date_time(DateTime(2018, 1, 1, 0, 20, 0), Scale.UTC),
+        ]
+
+        coordinates = np.array([state.get_coordinates(), state.get_coordinates()])
+
+        output_coordinates: np.ndarray = propagator.calculate_coordinates_at(
+            coordinates=coordinates,
+            epoch=state.get_instant(),
+            frame=Frame.GCRF(),
+            instants=instant_array,
+            coordinate_broker=coordinate_broker_7d,
+        )
+
+        assert output_coordinates.shape == (2, 2, 7)
+
+        expected_states: list[State] = propagator.calculate_states_at(state, instant_array)
+
+        for index, expected_state in enumerate(expected_states):
+            assert output_coordinates[0, index] == pytest.approx(
+                expected_state.get_coordinates(), rel=1e-12
+            )
+            assert output_coordinates[1, index] == pytest.approx(
+                expected_state.get_coordinates(), rel=1e-12
+            )
+
+        with pytest.raises(ValueError):
+            propagator.calculate_coordinates_at(
+                coordinates=coordinates,
+                epoch=state.get_instant(),
+                frame=Frame.GCRF(),
+                instants=instant_array,
+            )
+
+    def test_calculate_states_at_with_coarse_propagator(
+        self,
+        propagator: Propagator,
+        dynamics: list[Dynamics],
+        state: State,
+    ):
+        coarse_propagator: Propagator = Propagator(
+            NumericalSolver.fixed_step_size(NumericalSolver.StepperType.RungeKutta4, 60.0),
+            dynamics,
+        )
+
+        instant_array = [
+            Instant.date_time(DateTime(2018, 1, 1, 0, 10, 0), Scale.UTC),
+            Instant.date_time(DateTime(2018, 1, 1, 0, 20, 0), Scale.UTC),
+            Instant.date_time(DateTime(2018, 1, 1, 0, 30, 0), Scale.UTC),
+        ]
+
+        states: list[State] = propagator.calculate_states_at(
+            state,
+            instant_array,
+            coarse_propagator,
+            tolerance=1e-6,
+            thread_count=2,
+        )
+
+        reference_states: list[State] = propagator.calculate_states_at(state, instant_array)
+
+        assert len(states) == len(instant_array)
+
+        for output_state, reference_state in zip(states, reference_states):
+            assert output_state.get_instant() == reference_state.get_instant()
+            assert (
+                output_state.get_position().get_coordinates()
+                - reference_state.get_position().get_coordinates()
+            ) == pytest.approx([0.0, 0.0, 0.0], abs=1e-3)
+
+    def test_calculate_ensemble_states_at(self, propagator: Propagator, state: State):
+        instant = Instant.date_time(DateTime(2018, 1, 1, 0, 10, 0), Scale.UTC)
+
+        states: list[State] = propagator.calculate_ensemble_states_at([state, state], instant)
+
+        assert len(states) == 2
+        assert states[0].get_instant() == instant
+        assert states[1] == states[0]
+
+    def test_session(self, propagator: Propagator, state: State):
+        session: Propagator.Session = Propagator.Session(propagator, state)
+
+        assert session.get_state() == state
+
+        first_state: State = session.advance_by(Duration.seconds(60.0))
+
+        assert first_state.get_instant() == state.get_instant() + Duration.seconds(60.0)
+
+        second_state: State = session.advance_to(
+            state.get_instant() + Duration.seconds(120.0)
+        )
+
+        assert second_state == session.get_state()
+
+        with pytest.raises(RuntimeError):
+            session.advance_to(state.get_instant())
+
     def test_from_environment(
         self,
         numerical_solver: NumericalSolver,
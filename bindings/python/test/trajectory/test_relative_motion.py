@@ -0,0 +1,138 @@
+# Apache License 2.0
+
+import pytest
+
+import numpy as np
+
+from ostk.physics.time import Instant
+from ostk.physics.time import Duration
+from ostk.physics.coordinate import Position
+from ostk.physics.coordinate import Velocity
+from ostk.physics.coordinate import Frame
+from ostk.physics.environment.gravitational import Earth as EarthGravitationalModel
+from ostk.physics.unit import Derived
+
+from ostk.astrodynamics.trajectory import RelativeMotion
+from ostk.astrodynamics.trajectory import State
+
+
+@pytest.fixture
+def gravitational_parameter() -> Derived:
+    return EarthGravitationalModel.EGM2008.gravitational_parameter
+
+
+@pytest.fixture
+def target_state() -> State:
+    return State(
+        Instant.J2000(),
+        Position.meters([6750000.0, 0.0, 0.0], Frame.GCRF()),
+        Velocity.meters_per_second([0.0, 6200.0, 5200.0], Frame.GCRF()),
+    )
+
+
+@pytest.fixture
+def relative_state() -> np.ndarray:
+    return np.array([100.0, -200.0, 50.0, 0.1, -0.05, 0.02])
+
+
+@pytest.fixture
+def relative_motion(
+    target_state: State, gravitational_parameter: Derived
+) -> RelativeMotion:
+    return RelativeMotion(target_state, gravitational_parameter)
+
+
+class TestRelativeMotion:
+    def test_constructor(
+        self,
+        relative_motion: RelativeMotion,
+        target_state: State,
+        gravitational_parameter: Derived,
+    ):
+        assert relative_motion.is_defined()
+        assert relative_motion.get_type() == RelativeMotion.Type.YamanakaAnkersen
+        assert relative_motion.get_target_state() == target_state
+        assert 0.0 < relative_motion.get_eccentricity() < 1.0
+        assert relative_motion.get_mean_motion() > 0.0
+
+        clohessy_wiltshire = RelativeMotion(
+            target_state=target_state,
+            gravitational_parameter=gravitational_parameter,
+            type=RelativeMotion.Type.ClohessyWiltshire,
+        )
+
+        assert clohessy_wiltshire.get_type() == RelativeMotion.Type.ClohessyWiltshire
+        assert clohessy_wiltshire != relative_motion
+
+        assert not RelativeMotion.undefined().is_defined()
+        assert isinstance(str(relative_motion), str)
+        assert isinstance(
+            RelativeMotion.string_from_type(RelativeMotion.Type.YamanakaAnkersen), str
+        )
+
+    def test_calculate_state_transition_matrix(
+        self,
+        relative_motion: RelativeMotion,
+        target_state: State,
+    ):
+        start_instant: Instant = target_state.get_instant()
+        end_instant: Instant = start_instant + Duration.minutes(60.0)
+
+        assert np.allclose(
+            relative_motion.calculate_state_transition_matrix(
+                start_instant, start_instant
+            ),
+            np.eye(6),
+        )
+
+        stm: np.ndarray = relative_motion.calculate_state_transition_matrix(
+            start_instant, end_instant
+        )
+
+        assert stm.shape == (6, 6)
+        assert np.allclose(
+            relative_motion.calculate_state_transition_matrix(
+                end_instant, start_instant
+            )
+            @ stm,
+            np.eye(6),
+            atol=1e-9,
+        )
+
+    def test_calculate_relative_states_at(
+        self,
+        relative_motion: RelativeMotion,
+        target_state: State,
+        relative_state: np.ndarray,
+    ):
+        start_instant: Instant = target_state.get_instant()
+        instants: list[Instant] = [
+            start_instant + Duration.minutes(10.0 * i) for i in range(1, 6)
+        ]
+
+        relative_states: np.ndarray = relative_motion.calculate_relative_states_at(
+            relative_state, start_instant, instants
+        )
+
+        assert relative_states.shape == (5, 6)
+        assert np.allclose(
+            relative_states[2],
+            relative_motion.calculate_relative_state_at(
+                relative_state, start_instant, instants[2]
+            ),
+        )
+
+    def test_compute_relative_state(
+        self,
+        target_state: State,
+        relative_state: np.ndarray,
+    ):
+        chaser_state: State = RelativeMotion.compute_chaser_state(
+            target_state, relative_state
+        )
+
+        assert chaser_state.get_instant() == target_state.get_instant()
+        assert np.allclose(
+            RelativeMotion.compute_relative_state(target_state, chaser_state),
+            relative_state,
+        )
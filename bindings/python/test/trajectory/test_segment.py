@@ -3,6 +3,11 @@
 import pytest
 import numpy as np
 
+import tempfile
+
+from ostk.core.filesystem import File
+from ostk.core.filesystem import Path
+
 from ostk.physics import Environment
 from ostk.physics.time import Instant
 from ostk.physics.time import DateTime
@@ -19,6 +24,7 @@ from ostk.astrodynamics.dynamics import Thruster
 from ostk.astrodynamics.guidance_law import ConstantThrust
 from ostk.astrodynamics.trajectory import State
 from ostk.astrodynamics.trajectory import Segment
+from ostk.astrodynamics.trajectory import LocalOrbitalFrameFactory
 from ostk.astrodynamics.event_condition import InstantCondition
 from ostk.astrodynamics.trajectory.state import CoordinateSubset
 from ostk.astrodynamics.trajectory.state import CoordinateBroker
@@ -196,6 +202,33 @@ class TestSegment:
             is not None
         )
 
+    def test_impulsive_maneuver(
+        self,
+        name: str,
+        state: State,
+        dynamics: list,
+        numerical_solver: NumericalSolver,
+    ):
+        segment: Segment = Segment.impulsive_maneuver(
+            name=name,
+            delta_v=np.array([10.0, 0.0, 0.0]),
+            local_orbital_frame_factory=LocalOrbitalFrameFactory.VNC(Frame.GCRF()),
+            specific_impulse=300.0,
+            dynamics=dynamics,
+            numerical_solver=numerical_solver,
+        )
+
+        assert segment.get_type() == Segment.Type.ImpulsiveManeuver
+        assert segment.get_specific_impulse() == 300.0
+
+        solution: Segment.Solution = segment.solve(state)
+
+        assert len(solution.states) == 2
+        assert solution.condition_is_satisfied is True
+        assert solution.get_propagation_duration() == Duration.zero()
+        assert solution.compute_delta_v(300.0) == pytest.approx(10.0, abs=1e-9)
+        assert solution.compute_delta_mass().in_kilograms() > 0.0
+
     def test_create_solution(
         self,
         dynamics: list,
@@ -213,6 +246,132 @@ class TestSegment:
 
         assert segment_solution is not None
 
+    def test_solution_snapshot(
+        self,
+        dynamics: list,
+        state: State,
+    ):
+        segment_solution: Segment.Solution = Segment.Solution(
+            name="A Segment",
+            dynamics=dynamics,
+            states=[
+                state,
+            ],
+            condition_is_satisfied=True,
+            segment_type=Segment.Type.Coast,
+        )
+
+        snapshot_file = tempfile.NamedTemporaryFile(suffix=".sols", delete=False)
+        snapshot_file.close()
+
+        file: File = File.path(Path.parse(snapshot_file.name))
+
+        try:
+            segment_solution.save_snapshot(file)
+
+            loaded_segment_solution: Segment.Solution = Segment.Solution.load_snapshot(
+                file, dynamics
+            )
+
+            assert loaded_segment_solution.name == segment_solution.name
+            assert loaded_segment_solution.states == segment_solution.states
+            assert len(loaded_segment_solution.dynamics) == len(dynamics)
+            assert loaded_segment_solution.segment_type == Segment.Type.Coast
+
+            assert len(Segment.Solution.load_snapshot(file).dynamics) == 0
+
+        finally:
+            file.remove()
+
+    def test_state_retention(self):
+        assert (
+            Segment.StateRetention.all().get_type() == Segment.StateRetention.Type.All
+        )
+        assert (
+            Segment.StateRetention.endpoints().get_type()
+            == Segment.StateRetention.Type.Endpoints
+        )
+        assert Segment.StateRetention.every_nth_step(10).get_step_count() == 10
+        assert Segment.StateRetention.fixed_spacing(
+            Duration.minutes(1.0)
+        ).get_spacing() == Duration.minutes(1.0)
+
+        with pytest.raises(RuntimeError):
+            Segment.StateRetention.every_nth_step(0)
+
+    def test_solve_state_retention(
+        self,
+        state: State,
+        instant_condition: InstantCondition,
+        dynamics: list,
+        numerical_solver: NumericalSolver,
+        name: str,
+    ):
+        segment = Segment.coast(
+            name=name,
+            event_condition=instant_condition,
+            dynamics=dynamics,
+            numerical_solver=numerical_solver,
+            state_retention=Segment.StateRetention.endpoints(),
+        )
+
+        assert (
+            segment.get_state_retention().get_type()
+            == Segment.StateRetention.Type.Endpoints
+        )
+
+        solution = segment.solve(state)
+
+        assert len(solution.states) == 2
+        assert solution.states[0].get_instant() == state.get_instant()
+        assert solution.condition_is_satisfied is True
+
+    def test_solve_statistics(
+        self,
+        state: State,
+        name: str,
+        instant_condition: InstantCondition,
+        dynamics: list,
+        numerical_solver: NumericalSolver,
+    ):
+        segment = Segment.coast(name, instant_condition, dynamics, numerical_solver)
+
+        assert segment.solve(state).integration_statistics.step_count == 0
+
+        numerical_solver.enable_statistics()
+
+        segment = Segment.coast(name, instant_condition, dynamics, numerical_solver)
+
+        solution = segment.solve(state)
+
+        assert solution.integration_statistics.evaluation_count > 0
+        assert solution.integration_statistics.step_count > 0
+        assert (
+            numerical_solver.get_statistics().evaluation_count
+            == solution.integration_statistics.evaluation_count
+        )
+
+    def test_solve_initial_time_step(
+        self,
+        state: State,
+        name: str,
+        instant_condition: InstantCondition,
+        dynamics: list,
+        numerical_solver: NumericalSolver,
+    ):
+        segment = Segment.coast(name, instant_condition, dynamics, numerical_solver)
+
+        solution = segment.solve(state)
+
+        assert solution.final_time_step > 0.0
+
+        warm_solution = segment.solve(state, initial_time_step=solution.final_time_step)
+
+        assert warm_solution.condition_is_satisfied is True
+        assert (
+            warm_solution.states[-1].get_instant() == solution.states[-1].get_instant()
+        )
+
     def test_solve(
         self,
         state: State,
@@ -2,8 +2,13 @@
 
 import pytest
 
+import tempfile
+
 import numpy as np
 
+from ostk.core.filesystem import File
+from ostk.core.filesystem import Path
+
 from ostk.mathematics.geometry.d3.object import Composite
 from ostk.mathematics.geometry.d3.object import Cuboid
 from ostk.mathematics.geometry.d3.object import Point
@@ -27,6 +32,7 @@ from ostk.astrodynamics.event_condition import InstantCondition
 from ostk.astrodynamics.event_condition import RealCondition
 from ostk.astrodynamics import Dynamics
 from ostk.astrodynamics import EventCondition
+from ostk.astrodynamics import ExecutionContext
 from ostk.astrodynamics.dynamics import Thruster
 from ostk.astrodynamics.guidance_law import ConstantThrust
 from ostk.astrodynamics.flight.system import PropulsionSystem
@@ -408,6 +414,19 @@ class TestSequence:
 
         assert len(sequence.get_segments()) == segments_count + 1
 
+    def test_add_impulsive_maneuver_segment(
+        self,
+        sequence: Sequence,
+    ):
+        segments_count: int = len(sequence.get_segments())
+
+        sequence.add_impulsive_maneuver_segment(
+            np.array([1.0, 0.0, 0.0]), LocalOrbitalFrameFactory.VNC(Frame.GCRF()), 300.0
+        )
+
+        assert len(sequence.get_segments()) == segments_count + 1
+        assert sequence.get_segments()[-1].get_type() == Segment.Type.ImpulsiveManeuver
+
     def test_create_sequence_solution(
         self,
         segment_solution: Segment.Solution,
@@ -423,6 +442,39 @@ class TestSequence:
         assert len(solution.segment_solutions) == 1
         assert solution.execution_is_complete
 
+    def test_sequence_solution_snapshot(
+        self,
+        state: State,
+        repetition_count: int,
+        sequence: Sequence,
+        dynamics: list,
+    ):
+        solution: Sequence.Solution = sequence.solve(
+            state=state,
+            repetition_count=repetition_count,
+        )
+
+        snapshot_file = tempfile.NamedTemporaryFile(suffix=".sols", delete=False)
+        snapshot_file.close()
+
+        file: File = File.path(Path.parse(snapshot_file.name))
+
+        try:
+            solution.save_snapshot(file)
+
+            loaded_solution: Sequence.Solution = Sequence.Solution.load_snapshot(
+                file, dynamics
+            )
+
+            assert loaded_solution.execution_is_complete == solution.execution_is_complete
+            assert len(loaded_solution.segment_solutions) == len(
+                solution.segment_solutions
+            )
+            assert loaded_solution.get_states() == solution.get_states()
+
+        finally:
+            file.remove()
+
     def test_solve(
         self,
         state: State,
@@ -460,6 +512,172 @@ class TestSequence:
         assert propagated_states is not None
         assert len(propagated_states) == len(instants)
 
+        assert (
+            solution.calculate_states_at(
+                instants,
+                numerical_solver,
+                ExecutionContext(2),
+            )
+            == propagated_states
+        )
+
+    def test_solve_states(
+        self,
+        state: State,
+        repetition_count: int,
+        sequence: Sequence,
+        segments: list[Segment],
+    ):
+        states = [state, state, state]
+
+        reference_solution = sequence.solve(
+            state=state,
+            repetition_count=repetition_count,
+        )
+
+        solutions = sequence.solve(
+            states=states,
+            repetition_count=repetition_count,
+            thread_count=2,
+        )
+
+        assert len(solutions) == len(states)
+
+        for solution in solutions:
+            assert solution.execution_is_complete
+            assert len(solution.segment_solutions) == len(segments)
+            assert (
+                solution.access_end_instant()
+                == reference_solution.access_end_instant()
+            )
+
+    def test_solve_warm_started(
+        self,
+        state: State,
+        repetition_count: int,
+        sequence: Sequence,
+        segments: list[Segment],
+    ):
+        first_solution = sequence.solve_warm_started(
+            state=state,
+            repetition_count=repetition_count,
+        )
+
+        second_solution = sequence.solve_warm_started(
+            state=state,
+            repetition_count=repetition_count,
+        )
+
+        assert len(second_solution.segment_solutions) == len(segments)
+        assert (
+            second_solution.access_end_instant() == first_solution.access_end_instant()
+        )
+
+        sequence.set_segment(0, segments[0])
+        sequence.clear_solution_cache()
+
+        assert sequence.solve_warm_started(state).execution_is_complete
+
+    def test_solve_targeting(
+        self,
+        state: State,
+        coast_duration_segment: Segment,
+        numerical_solver: NumericalSolver,
+        dynamics: list,
+        maximum_propagation_duration: Duration,
+        coordinate_broker: CoordinateBroker,
+    ):
+        sequence = Sequence(
+            segments=[coast_duration_segment],
+            dynamics=dynamics,
+            numerical_solver=numerical_solver,
+            maximum_propagation_duration=maximum_propagation_duration,
+        )
+
+        coordinates = np.array(state.get_coordinates())
+
+        def generate_initial_state(controls: np.ndarray) -> State:
+            return State(
+                state.get_instant(),
+                [*coordinates[:3], *controls, *coordinates[6:]],
+                state.get_frame(),
+                coordinate_broker,
+            )
+
+        def get_final_position(solution: Sequence.Solution) -> np.ndarray:
+            return np.array(solution.get_states()[-1].get_coordinates()[:3])
+
+        initial_controls = coordinates[3:6]
+        target_position = get_final_position(
+            sequence.solve(generate_initial_state(initial_controls + [1.0, 2.0, 0.0]))
+        )
+
+        targeting_solution = sequence.solve_targeting(
+            initial_controls=initial_controls,
+            initial_state_generator=generate_initial_state,
+            constraint_generator=lambda solution: get_final_position(solution)
+            - target_position,
+            tolerance=1e-3,
+        )
+
+        assert isinstance(targeting_solution, Sequence.TargetingSolution)
+        assert targeting_solution.has_converged
+        assert np.linalg.norm(targeting_solution.constraints) < 1e-3
+        assert targeting_solution.controls == pytest.approx(
+            initial_controls + [1.0, 2.0, 0.0], abs=1e-6
+        )
+        assert targeting_solution.propagation_count == (
+            1
+            + 3 * targeting_solution.jacobian_evaluation_count
+            + targeting_solution.iteration_count
+        )
+
+    def test_solve_async(
+        self,
+        state: State,
+        repetition_count: int,
+        sequence: Sequence,
+        segments: list[Segment],
+        instant_condition: InstantCondition,
+    ):
+        reference_solution = sequence.solve(
+            state=state,
+            repetition_count=repetition_count,
+        )
+
+        segment_solutions: list[Segment.Solution] = []
+
+        async_solution = sequence.solve_async(
+            state=state,
+            repetition_count=repetition_count,
+            segment_solution_callback=segment_solutions.append,
+        )
+
+        solution = async_solution.get()
+
+        assert async_solution.is_ready()
+        assert not async_solution.is_cancelled()
+
+        assert solution.execution_is_complete
+        assert len(segment_solutions) == len(segments)
+        assert solution.access_end_instant() == reference_solution.access_end_instant()
+
+        async_solution = sequence.solve_async(state)
+        async_solution.cancel()
+
+        assert async_solution.is_cancelled()
+        assert async_solution.get() is not None
+
+        async_solution = sequence.solve_to_condition_async(
+            state=state,
+            event_condition=instant_condition,
+            maximum_propagation_duration_limit=Duration.hours(1.0),
+        )
+        async_solution.wait()
+
+        assert async_solution.is_ready()
+        assert async_solution.get() is not None
+
     def test_solve_to_condition(
         self,
         state: State,
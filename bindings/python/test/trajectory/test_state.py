@@ -7,6 +7,7 @@ import numpy as np
 from ostk.mathematics.geometry.d3.transformation.rotation import Quaternion
 
 from ostk.physics.time import Instant
+from ostk.physics.time import Duration
 from ostk.physics.time import DateTime
 from ostk.physics.time import Scale
 from ostk.physics.coordinate import Position
@@ -214,6 +215,26 @@ class TestState:
         assert state.in_frame(frame) == state
         assert state.in_frame(Frame.ITRF()) != state
 
+    def test_states_in_frame(
+        self,
+        state: State,
+    ):
+        states = [state, state]
+
+        states_itrf = State.states_in_frame(states, Frame.ITRF())
+
+        assert len(states_itrf) == len(states)
+        assert states_itrf[0] == state.in_frame(Frame.ITRF())
+
+        interpolated_states_itrf = State.states_in_frame(
+            states=states,
+            frame=Frame.ITRF(),
+            interpolation_step=Duration.minutes(5.0),
+        )
+
+        assert len(interpolated_states_itrf) == len(states)
+        assert interpolated_states_itrf[0].get_frame() == Frame.ITRF()
+
     def test_extract_coordinate(
         self,
         state: State,
@@ -161,6 +161,28 @@ class TestStateBuilder:
         assert state != expanded_state
         assert default_state != expanded_state
 
+    def test_reduce_expand_states(
+        self,
+        state: State,
+    ):
+        reduction_builder = StateBuilder(state.get_frame(), [CartesianPosition.default()])
+        reduced_states: list[State] = reduction_builder.reduce([state, state])
+
+        assert len(reduced_states) == 2
+        assert reduced_states[0] == reduction_builder.reduce(state)
+
+        expansion_builder = StateBuilder(
+            state.get_frame(),
+            [
+                CartesianPosition.default(),
+                CartesianVelocity.default(),
+            ],
+        )
+        expanded_states: list[State] = expansion_builder.expand(reduced_states, state)
+
+        assert len(expanded_states) == 2
+        assert expanded_states[0] == expansion_builder.expand(reduced_states[0], state)
+
     def test_getters(
         self,
         state_builder: StateBuilder,
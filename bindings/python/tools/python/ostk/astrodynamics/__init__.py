@@ -1,7 +1,13 @@
 # Apache License 2.0
 
+import importlib.abc
+import importlib.util
+import sys
+import types
+
 from ostk.physics import *
 
+from . import OpenSpaceToolkitAstrodynamicsPy
 from .OpenSpaceToolkitAstrodynamicsPy import *
 
 from .pytrajectory.pystate import State as PyState
@@ -9,3 +15,51 @@ from .pytrajectory.pystate import State as PyState
 trajectory.State = (
     PyState  # Override the pure c++ State class with the modified Python one
 )
+
+
+# Some submodules (access, conjunction, event_condition, guidance_law,
+# orbit_determination) are registered by the extension on first access, rather than at
+# import.
+
+
+def __getattr__(name: str):
+    return getattr(OpenSpaceToolkitAstrodynamicsPy, name)
+
+
+def __dir__() -> list[str]:
+    return sorted(set(globals()) | set(dir(OpenSpaceToolkitAstrodynamicsPy)))
+
+
+class _LazySubmoduleFinder(importlib.abc.MetaPathFinder, importlib.abc.Loader):
+    """
+    Resolve imports of submodules registered on first access (e.g.
+    `import ostk.astrodynamics.access`), by attribute lookup on the extension.
+    """
+
+    def find_spec(self, fullname: str, path, target=None):
+        if not fullname.startswith(f"{__name__}."):
+            return None
+
+        module = sys.modules[__name__]
+
+        for name in fullname[len(__name__) + 1 :].split("."):
+            module = getattr(module, name, None)
+
+            if not isinstance(module, types.ModuleType):
+                return None
+
+        return importlib.util.spec_from_loader(fullname, self)
+
+    def create_module(self, spec):
+        module = sys.modules[__name__]
+
+        for name in spec.name[len(__name__) + 1 :].split("."):
+            module = getattr(module, name)
+
+        return module
+
+    def exec_module(self, module):
+        pass
+
+
+sys.meta_path.append(_LazySubmoduleFinder())
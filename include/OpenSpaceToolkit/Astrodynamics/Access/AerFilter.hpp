@@ -0,0 +1,143 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Access_AerFilter__
+#define __OpenSpaceToolkit_Astrodynamics_Access_AerFilter__
+
+#include <functional>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Map.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Interval.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Spherical/AER.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace access
+{
+
+using ostk::core::container::Array;
+using ostk::core::container::Map;
+using ostk::core::type::Real;
+
+using ostk::mathematics::object::Interval;
+
+using ostk::physics::coordinate::spherical::AER;
+
+/// @brief Declarative AER filter
+///
+/// AER filters are built from azimuth, elevation and range intervals or from azimuth-elevation masks, and composed
+/// with logical operators. They are evaluated natively: an access generator using an AER filter built from bindings
+/// (e.g. Python) does not call back into the binding language at each condition evaluation.
+///
+/// @code{.cpp}
+///              AerFilter aerFilter = AerFilter::And({ AerFilter::Elevation(Interval<Real>::Closed(10.0, 90.0)),
+///                                                     AerFilter::Range(Interval<Real>::Closed(0.0, 2.0e6)) }) ;
+///              Generator generator = { environment, aerFilter } ;
+/// @endcode
+class AerFilter
+{
+   public:
+    /// @brief Evaluate filter
+    ///
+    /// @param anAer An AER
+    /// @return True if the AER passes the filter
+    bool operator()(const AER& anAer) const;
+
+    /// @brief Evaluate filter on raw AER coordinates, without constructing an AER
+    ///
+    /// @param anAzimuth An azimuth [rad], in [0, 2pi)
+    /// @param anElevation An elevation [rad], in [-pi/2, pi/2]
+    /// @param aRange A range [m]
+    /// @return True if the AER coordinates pass the filter
+    bool evaluate(const double& anAzimuth, const double& anElevation, const double& aRange) const;
+
+    /// @brief Check if filter is defined
+    ///
+    /// @return True if filter is defined
+    bool isDefined() const;
+
+    /// @brief Constructs an undefined filter
+    ///
+    /// @return Undefined filter
+    static AerFilter Undefined();
+
+    /// @brief Constructs a filter on azimuth
+    ///
+    /// @param anAzimuthInterval An azimuth interval [deg], in [0, 360]
+    /// @return Filter
+    static AerFilter Azimuth(const Interval<Real>& anAzimuthInterval);
+
+    /// @brief Constructs a filter on elevation
+    ///
+    /// @param anElevationInterval An elevation interval [deg], in [-90, 90]
+    /// @return Filter
+    static AerFilter Elevation(const Interval<Real>& anElevationInterval);
+
+    /// @brief Constructs a filter on range
+    ///
+    /// @param aRangeInterval A range interval [m]
+    /// @return Filter
+    static AerFilter Range(const Interval<Real>& aRangeInterval);
+
+    /// @brief Constructs a filter on azimuth, elevation and range intervals
+    ///
+    /// Undefined intervals are not filtered on.
+    ///
+    /// @param anAzimuthInterval An azimuth interval [deg]
+    /// @param anElevationInterval An elevation interval [deg]
+    /// @param aRangeInterval A range interval [m]
+    /// @return Filter
+    static AerFilter Ranges(
+        const Interval<Real>& anAzimuthInterval,
+        const Interval<Real>& anElevationInterval,
+        const Interval<Real>& aRangeInterval
+    );
+
+    /// @brief Constructs a filter on an azimuth-elevation mask, and a range interval
+    ///
+    /// The minimum elevation is linearly interpolated in azimuth between the mask points. The range interval is not
+    /// filtered on if undefined.
+    ///
+    /// The mask is precomputed into uniform azimuth bins, each referencing the mask segment at its start, so that an
+    /// evaluation is an index computation followed by a linear interpolation, regardless of the mask point count.
+    ///
+    /// @param anAzimuthElevationMask An azimuth-elevation mask [deg], mapping azimuths to minimum elevations
+    /// @param aRangeInterval A range interval [m]
+    /// @return Filter
+    static AerFilter Mask(const Map<Real, Real>& anAzimuthElevationMask, const Interval<Real>& aRangeInterval);
+
+    /// @brief Constructs the conjunction of filters
+    ///
+    /// @param aFilterArray An array of filters
+    /// @return Filter passing if all filters pass
+    static AerFilter And(const Array<AerFilter>& aFilterArray);
+
+    /// @brief Constructs the disjunction of filters
+    ///
+    /// @param aFilterArray An array of filters
+    /// @return Filter passing if any filter passes
+    static AerFilter Or(const Array<AerFilter>& aFilterArray);
+
+    /// @brief Constructs the negation of a filter
+    ///
+    /// @param aFilter A filter
+    /// @return Filter passing if the filter does not pass
+    static AerFilter Not(const AerFilter& aFilter);
+
+   private:
+    // Predicate on azimuth [rad] in [0, 2pi), elevation [rad] and range [m]
+    std::function<bool(const double&, const double&, const double&)> predicate_;
+
+    AerFilter(const std::function<bool(const double&, const double&, const double&)>& aPredicate);
+};
+
+}  // namespace access
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
@@ -0,0 +1,167 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Access_CoverageGenerator__
+#define __OpenSpaceToolkit_Astrodynamics_Access_CoverageGenerator__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Spherical/LLA.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Access/Generator.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace access
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::spherical::LLA;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::time::Duration;
+using ostk::physics::unit::Angle;
+
+using ostk::astrodynamics::Trajectory;
+
+/// @brief Coverage generator
+///
+/// Computes the accesses between a grid of ground points and a constellation of satellites, over a regular time grid.
+/// The states of each satellite are evaluated once per instant, and only the grid points lying in the latitude
+/// bands below the satellite visibility cone are tested against its elevation mask. Access intervals are resolved to
+/// the step of the time grid.
+///
+/// The visibility tests can be offloaded to a CUDA device (see Backend). States, frame transforms and the assembly of
+/// the access intervals remain on the host in all cases.
+///
+/// @code{.cpp}
+///              CoverageGenerator coverageGenerator = { gridPoints, Angle::Degrees(10.0), earthSPtr } ;
+///              Array<CoverageGenerator::PointCoverage> coverage =
+///                  coverageGenerator.computeCoverage(interval, { satellite_1, satellite_2 }) ;
+/// @endcode
+class CoverageGenerator
+{
+   public:
+    /// @brief Visibility backend
+    ///
+    /// The CUDA backend tests every grid point against every satellite, an instant chunk at a time, and is only
+    /// available in builds configured with BUILD_WITH_CUDA, on hosts with a CUDA device.
+    enum class Backend
+    {
+        CPU,
+        CUDA
+    };
+
+    /// @brief Coverage of a grid point
+    ///
+    /// Revisit durations are those of the gaps between accesses, including the gaps at the start and end of the
+    /// analysis interval.
+    struct PointCoverage
+    {
+        Array<physics::time::Interval> accessIntervals;
+        Duration accessDuration;
+        Duration maximumRevisitDuration;
+        Duration meanRevisitDuration;
+    };
+
+    /// @brief Constructor
+    ///
+    /// @param aGridPointArray An array of grid points
+    /// @param aMinimumElevation A minimum elevation
+    /// @param aCelestialSPtr A central body, whose frame the grid points are fixed in
+    /// @param aStep A time grid step
+    /// @param aBackend A visibility backend
+    CoverageGenerator(
+        const Array<LLA>& aGridPointArray,
+        const Angle& aMinimumElevation,
+        const Shared<const Celestial>& aCelestialSPtr,
+        const Duration& aStep = DEFAULT_STEP,
+        const Backend& aBackend = Backend::CPU
+    );
+
+    /// @brief Check if coverage generator is defined
+    ///
+    /// @return True if coverage generator is defined
+    bool isDefined() const;
+
+    /// @brief Get grid points
+    ///
+    /// @return Grid points
+    Array<LLA> getGridPoints() const;
+
+    /// @brief Get minimum elevation
+    ///
+    /// @return Minimum elevation
+    Angle getMinimumElevation() const;
+
+    /// @brief Get time grid step
+    ///
+    /// @return Step
+    Duration getStep() const;
+
+    /// @brief Get visibility backend
+    ///
+    /// @return Backend
+    Backend getBackend() const;
+
+    /// @brief Compute the coverage of the grid points by an array of satellites
+    ///
+    /// @param anInterval An analysis interval
+    /// @param aTrajectoryArray An array of satellite trajectories
+    /// @return Coverage of each grid point, in the order of the grid points
+    Array<PointCoverage> computeCoverage(
+        const physics::time::Interval& anInterval, const Array<Trajectory>& aTrajectoryArray
+    ) const;
+
+    /// @brief Constructs an undefined coverage generator
+    ///
+    /// @return Undefined coverage generator
+    static CoverageGenerator Undefined();
+
+    /// @brief Check if a visibility backend is available in this build and on this host
+    ///
+    /// @param aBackend A visibility backend
+    /// @return True if the backend is available
+    static bool IsBackendAvailable(const Backend& aBackend);
+
+   private:
+    Array<LLA> gridPoints_;
+    Angle minimumElevation_;
+    Shared<const Celestial> celestialSPtr_;
+    Duration step_;
+    Backend backend_;
+
+    // Grid points in the frame of the central body, and their geodetic verticals
+    Array<Vector3d> gridPositions_;
+    Array<Vector3d> gridVerticals_;
+
+    // Indices of the grid points, binned by geocentric latitude
+    double bandWidth_rad_;
+    Array<Array<Index>> bandIndices_;
+
+    static PointCoverage GeneratePointCoverage(
+        const Array<physics::time::Interval>& anAccessIntervalArray, const physics::time::Interval& anInterval
+    );
+};
+
+}  // namespace access
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
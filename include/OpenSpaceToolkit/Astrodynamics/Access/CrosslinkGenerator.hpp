@@ -0,0 +1,185 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Access_CrosslinkGenerator__
+#define __OpenSpaceToolkit_Astrodynamics_Access_CrosslinkGenerator__
+
+#include <functional>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Interval.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Access.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Access/Generator.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/Profile.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace access
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Real;
+using ostk::core::type::Shared;
+
+using ostk::mathematics::object::Interval;
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::unit::Angle;
+using ostk::physics::unit::Length;
+
+using ostk::astrodynamics::Access;
+using ostk::astrodynamics::flight::Profile;
+using ostk::astrodynamics::Trajectory;
+using ostk::astrodynamics::trajectory::State;
+
+/// @brief Inter-satellite link (crosslink) access generator
+///
+/// Computes the accesses between two satellites from their GCRF positions only: a link is active when the range lies
+/// within the range interval, the line of sight clears the Earth ellipsoid raised by the grazing altitude (atmosphere
+/// margin), and, for a "from" satellite given by its flight profile, the "to" satellite lies within the body-frame
+/// field of view. No Earth-fixed frame (ITRF, NED) is constructed.
+///
+/// The Earth ellipsoid is taken with its polar axis along the GCRF Z axis, which is accurate to the precession and
+/// nutation of the pole (a few tenths of a degree), i.e. to about a hundred meters of grazing altitude.
+///
+/// The maximum elevation of the generated accesses is the geocentric elevation of the "to" satellite above the local
+/// horizontal plane of the "from" satellite, at the time of closest approach.
+///
+/// @code{.cpp}
+///              CrosslinkGenerator crosslinkGenerator = {
+///                  earthSPtr, Interval<Real>::Closed(0.0, 5.0e6), Length::Kilometers(100.0)
+///              } ;
+///              Array<Access> accesses = crosslinkGenerator.computeAccesses(interval, satellite_1, satellite_2) ;
+/// @endcode
+class CrosslinkGenerator
+{
+   public:
+    /// @brief Conical field of view, defined in the body frame of a satellite
+    struct FieldOfView
+    {
+        Vector3d boresight;  ///< Boresight direction, in the body frame.
+        Angle halfAngle;     ///< Cone half angle.
+    };
+
+    /// @brief Constructor
+    ///
+    /// @param anEarthSPtr An Earth
+    /// @param aRangeInterval A range interval [m] (not filtered on if undefined)
+    /// @param aGrazingAltitude A minimum altitude of the line of sight above the Earth ellipsoid
+    /// @param aStep A time grid step
+    /// @param aTolerance A temporal tolerance
+    CrosslinkGenerator(
+        const Shared<const Celestial>& anEarthSPtr,
+        const Interval<Real>& aRangeInterval,
+        const Length& aGrazingAltitude,
+        const Duration& aStep = DEFAULT_STEP,
+        const Duration& aTolerance = DEFAULT_TOLERANCE
+    );
+
+    /// @brief Check if crosslink generator is defined
+    ///
+    /// @return True if crosslink generator is defined
+    bool isDefined() const;
+
+    /// @brief Get range interval
+    ///
+    /// @return Range interval [m]
+    Interval<Real> getRangeInterval() const;
+
+    /// @brief Get grazing altitude
+    ///
+    /// @return Grazing altitude
+    Length getGrazingAltitude() const;
+
+    /// @brief Get time grid step
+    ///
+    /// @return Step
+    Duration getStep() const;
+
+    /// @brief Get temporal tolerance
+    ///
+    /// @return Tolerance
+    Duration getTolerance() const;
+
+    /// @brief Check if the link between two satellites is active at a given instant
+    ///
+    /// @param anInstant An instant
+    /// @param aFromTrajectory A "from" trajectory
+    /// @param aToTrajectory A "to" trajectory
+    /// @return True if the link is active
+    bool isActiveAt(const Instant& anInstant, const Trajectory& aFromTrajectory, const Trajectory& aToTrajectory)
+        const;
+
+    /// @brief Compute the accesses between two satellites
+    ///
+    /// @param anInterval An analysis interval
+    /// @param aFromTrajectory A "from" trajectory
+    /// @param aToTrajectory A "to" trajectory
+    /// @return Accesses
+    Array<Access> computeAccesses(
+        const physics::time::Interval& anInterval, const Trajectory& aFromTrajectory, const Trajectory& aToTrajectory
+    ) const;
+
+    /// @brief Compute the accesses between two satellites, within the field of view of the "from" satellite
+    ///
+    /// The "from" flight profile must be expressed in GCRF, so that its attitude maps GCRF to the body frame.
+    ///
+    /// @param anInterval An analysis interval
+    /// @param aFromProfile A "from" flight profile
+    /// @param aFieldOfView A field of view, in the body frame of the "from" profile
+    /// @param aToTrajectory A "to" trajectory
+    /// @return Accesses
+    Array<Access> computeAccesses(
+        const physics::time::Interval& anInterval,
+        const Profile& aFromProfile,
+        const FieldOfView& aFieldOfView,
+        const Trajectory& aToTrajectory
+    ) const;
+
+    /// @brief Constructs an undefined crosslink generator
+    ///
+    /// @return Undefined crosslink generator
+    static CrosslinkGenerator Undefined();
+
+   private:
+    Shared<const Celestial> earthSPtr_;
+    Interval<Real> rangeInterval_;
+    Length grazingAltitude_;
+    Duration step_;
+    Duration tolerance_;
+
+    Array<Access> generateAccesses(
+        const physics::time::Interval& anInterval,
+        const std::function<State(const Instant&)>& aFromStateGetter,
+        const std::function<State(const Instant&)>& aToStateGetter,
+        const FieldOfView* aFieldOfViewPtr
+    ) const;
+
+    bool isActive(const State& aFromState, const State& aToState, const FieldOfView* aFieldOfViewPtr) const;
+
+    static Vector3d GetPositionCoordinates(const State& aState);
+};
+
+}  // namespace access
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
@@ -3,12 +3,18 @@
 #ifndef __OpenSpaceToolkit_Astrodynamics_Access_Generator__
 #define __OpenSpaceToolkit_Astrodynamics_Access_Generator__
 
+#include <mutex>
+
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Map.hpp>
 #include <OpenSpaceToolkit/Core/Container/Pair.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Object/Interval.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Spherical/AER.hpp>
 #include <OpenSpaceToolkit/Physics/Environment.hpp>
@@ -18,6 +24,10 @@
 #include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Access.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Access/AerFilter.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Access/SensorFilter.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/EnvironmentView.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/ExecutionContext.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory.hpp>
 
 namespace ostk
@@ -30,10 +40,14 @@ namespace access
 using ostk::core::container::Array;
 using ostk::core::container::Map;
 using ostk::core::container::Pair;
+using ostk::core::type::Index;
 using ostk::core::type::Real;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 
 using ostk::mathematics::object::Interval;
+using ostk::mathematics::object::Matrix3d;
+using ostk::mathematics::object::Vector3d;
 
 using ostk::physics::coordinate::Position;
 using ostk::physics::coordinate::spherical::AER;
@@ -45,6 +59,8 @@ using ostk::physics::unit::Angle;
 using ostk::physics::unit::Length;
 
 using ostk::astrodynamics::Access;
+using ostk::astrodynamics::EnvironmentView;
+using ostk::astrodynamics::ExecutionContext;
 using ostk::astrodynamics::Trajectory;
 using ostk::astrodynamics::trajectory::State;
 
@@ -54,6 +70,28 @@ using ostk::astrodynamics::trajectory::State;
 class Generator
 {
    public:
+    /// @brief Access generation statistics, accumulated over computations while enabled
+    ///
+    /// Condition evaluation and root solver statistics are reported by the temporal condition solver. State queries,
+    /// line of sight (Environment::intersects) and AER calculations are measured within condition evaluations.
+    /// TCA evaluations count the optimizer objective evaluations.
+    struct Statistics
+    {
+        Size conditionEvaluationCount = 0;
+        Duration conditionEvaluationDuration = Duration::Zero();
+        Size rootSolverCallCount = 0;
+        Size rootSolverIterationCount = 0;
+        Duration rootSolverDuration = Duration::Zero();
+        Size stateQueryCount = 0;
+        Duration stateQueryDuration = Duration::Zero();
+        Size lineOfSightCount = 0;
+        Duration lineOfSightDuration = Duration::Zero();
+        Size aerCalculationCount = 0;
+        Duration aerCalculationDuration = Duration::Zero();
+        Size timeOfClosestApproachEvaluationCount = 0;
+        Duration timeOfClosestApproachDuration = Duration::Zero();
+    };
+
     Generator(
         const Environment& anEnvironment,
         const Duration& aStep = DEFAULT_STEP,
@@ -81,6 +119,31 @@ class Generator
 
     std::function<bool(const State&, const State&)> getStateFilter() const;
 
+    /// @brief Check if coarse geometric screening is enabled
+    ///
+    /// @return True if coarse geometric screening is enabled
+    bool isScreeningEnabled() const;
+
+    /// @brief Get the coarse screening minimum elevation
+    ///
+    /// @return Minimum elevation (undefined if not screened on)
+    Angle getScreeningMinimumElevation() const;
+
+    /// @brief Get the coarse screening maximum range
+    ///
+    /// @return Maximum range (undefined if not screened on)
+    Length getScreeningMaximumRange() const;
+
+    /// @brief Check if statistics are enabled
+    ///
+    /// @return True if statistics are enabled
+    bool isStatisticsEnabled() const;
+
+    /// @brief Get the statistics accumulated since statistics were enabled (or last reset)
+    ///
+    /// @return Statistics
+    Statistics getStatistics() const;
+
     std::function<bool(const Instant&)> getConditionFunction(
         const Trajectory& aFromTrajectory, const Trajectory& aToTrajectory
     ) const;
@@ -89,6 +152,68 @@ class Generator
         const physics::time::Interval& anInterval, const Trajectory& aFromTrajectory, const Trajectory& aToTrajectory
     ) const;
 
+    /// @brief Compute accesses between every pair of "from" and "to" trajectories
+    ///
+    /// @code{.cpp}
+    ///              Array<Array<Array<Access>>> accessesMatrix =
+    ///                  generator.computeAccesses(interval, { groundStation }, { satellite_1, satellite_2 }) ;
+    ///              Array<Access> accesses = accessesMatrix[0][1] ; // Ground station to satellite_2
+    /// @endcode
+    ///
+    /// Pairs are distributed over a pool of worker threads. Condition evaluation updates the environment instant,
+    /// hence each worker operates on its own view of the generator environment (sharing its objects). Trajectories are
+    /// shared between workers, their models being immutable and safe to query concurrently.
+    ///
+    /// @param anInterval An analysis interval
+    /// @param aFromTrajectoryArray An array of "from" trajectories
+    /// @param aToTrajectoryArray An array of "to" trajectories
+    /// @param aThreadCount A worker thread count (0 defaults to the default thread count of ExecutionContext)
+    /// @return A matrix of accesses, indexed by [from trajectory index][to trajectory index]
+    Array<Array<Array<Access>>> computeAccesses(
+        const physics::time::Interval& anInterval,
+        const Array<Trajectory>& aFromTrajectoryArray,
+        const Array<Trajectory>& aToTrajectoryArray,
+        const Size& aThreadCount = 0
+    ) const;
+
+    /// @brief Compute accesses between every pair of "from" and "to" trajectories, within an execution context
+    ///
+    /// @param anInterval An analysis interval
+    /// @param aFromTrajectoryArray An array of "from" trajectories
+    /// @param aToTrajectoryArray An array of "to" trajectories
+    /// @param anExecutionContext An execution context
+    /// @return A matrix of accesses, indexed by [from trajectory index][to trajectory index]
+    Array<Array<Array<Access>>> computeAccesses(
+        const physics::time::Interval& anInterval,
+        const Array<Trajectory>& aFromTrajectoryArray,
+        const Array<Trajectory>& aToTrajectoryArray,
+        const ExecutionContext& anExecutionContext
+    ) const;
+
+    /// @brief Compute accesses between trajectories made of pieces (e.g., historical TLE sequences)
+    ///
+    /// @code{.cpp}
+    ///              Trajectory satellite = { Piecewise::TLEs(tles) } ;
+    ///              Array<Access> accesses = generator.computePiecewiseAccesses(interval, groundStation, satellite) ;
+    /// @endcode
+    ///
+    /// The interval is split at the switch instants of piecewise trajectories, and each segment is processed with
+    /// the pieces it uses, on a pool of worker threads. Segments are solved on the time grid of the whole interval,
+    /// and access intervals meeting at a switch instant are merged. Trajectories that are not piecewise are used as
+    /// is, hence the accesses match those of computeAccesses, up to the solver tolerance.
+    ///
+    /// @param anInterval An analysis interval
+    /// @param aFromTrajectory A "from" trajectory
+    /// @param aToTrajectory A "to" trajectory
+    /// @param aThreadCount A worker thread count (0 defaults to the default thread count of ExecutionContext)
+    /// @return Accesses
+    Array<Access> computePiecewiseAccesses(
+        const physics::time::Interval& anInterval,
+        const Trajectory& aFromTrajectory,
+        const Trajectory& aToTrajectory,
+        const Size& aThreadCount = 0
+    ) const;
+
     void setStep(const Duration& aStep);
 
     void setTolerance(const Duration& aTolerance);
@@ -97,8 +222,41 @@ class Generator
 
     void setAccessFilter(const std::function<bool(const Access&)>& anAccessFilter);
 
+    /// @brief Set state filter
+    ///
+    /// Native sensor filters (SensorFilter) are evaluated on the GCRF positions computed by the generator.
+    ///
+    /// @param aStateFilter A state filter
     void setStateFilter(const std::function<bool(const State&, const State&)>& aStateFilter);
 
+    /// @brief Enable coarse geometric screening
+    ///
+    /// A cheap test computed from raw GCRF position vectors is performed before the line of sight and AER
+    /// evaluation: instants at which the Earth polar sphere blocks the line of sight, the geocentric elevation is
+    /// below the minimum elevation (minus a margin covering the geodetic / geocentric vertical deflection), or the
+    /// range is beyond the maximum range, are deemed inactive without further evaluation.
+    /// The minimum elevation and maximum range must be consistent with (i.e., not tighter than) the AER filter.
+    ///
+    /// @param aMinimumElevation A minimum elevation (optional)
+    /// @param aMaximumRange A maximum range (optional)
+    void enableScreening(
+        const Angle& aMinimumElevation = Angle::Undefined(), const Length& aMaximumRange = Length::Undefined()
+    );
+
+    /// @brief Disable coarse geometric screening
+    void disableScreening();
+
+    /// @brief Enable statistics
+    ///
+    /// Copies of this generator (e.g., the workers of a multi-trajectory computation) share its statistics.
+    void enableStatistics();
+
+    /// @brief Disable statistics
+    void disableStatistics();
+
+    /// @brief Reset statistics
+    void resetStatistics();
+
     static Generator Undefined();
 
     /// @brief Construct an access generator with defined AER ranges
@@ -128,7 +286,8 @@ class Generator
     );
 
    private:
-    Environment environment_;
+    // Shares the objects of the environment, hence is cheap to copy per worker
+    EnvironmentView environment_;
 
     Duration step_;
     Duration tolerance_;
@@ -137,26 +296,44 @@ class Generator
     std::function<bool(const Access&)> accessFilter_;
     std::function<bool(const State&, const State&)> stateFilter_;
 
+    bool screeningIsEnabled_;
+    Angle screeningMinimumElevation_;
+    Length screeningMaximumRange_;
+
+    Shared<Statistics> statisticsSPtr_;
+    Shared<std::mutex> statisticsMutexSPtr_;
+
+    friend class IncrementalGenerator;
+    friend class CrosslinkGenerator;
+
+    Array<physics::time::Interval> computeAccessIntervals(
+        const physics::time::Interval& anInterval,
+        const Trajectory& aFromTrajectory,
+        const Trajectory& aToTrajectory,
+        Statistics* aStatisticsPtr = nullptr
+    ) const;
+
+    void recordStatistics(const Statistics& aStatistics) const;
+
     static Access GenerateAccess(
         const physics::time::Interval& anAccessInterval,
         const physics::time::Interval& aGlobalInterval,
         const Trajectory& aFromTrajectory,
         const Trajectory& aToTrajectory,
         const Shared<const Celestial> anEarthSPtr,
-        const Duration& aTolerance
+        const Duration& aTolerance,
+        Statistics* aStatisticsPtr = nullptr
     );
 
     static Instant FindTimeOfClosestApproach(
         const physics::time::Interval& anAccessInterval,
-        const Trajectory& aFromTrajectory,
-        const Trajectory& aToTrajectory,
+        const std::function<Pair<State, State>(const Instant&)>& aStatesGetter,
         const Duration& aTolerance
     );
 
     static Angle CalculateElevationAt(
         const Instant& anInstant,
-        const Trajectory& aFromTrajectory,
-        const Trajectory& aToTrajectory,
+        const std::function<Pair<State, State>(const Instant&)>& aStatesGetter,
         const Shared<const Celestial> anEarthSPtr
     );
 };
@@ -167,12 +344,35 @@ class GeneratorContext
     GeneratorContext(
         const Trajectory& aFromTrajectory,
         const Trajectory& aToTrajectory,
-        const Environment& anEnvironment,
+        const EnvironmentView& anEnvironmentView,
         const Generator& aGenerator
     );
 
     bool isAccessActive(const Instant& anInstant);
 
+    /// @brief Enable chunked state prefetching along a regular time grid
+    ///
+    /// States at grid instants (first queried instant + k * step, up to the end instant) are requested in chunks
+    /// through Trajectory::getStatesAt, so that trajectory models with efficient batch paths are amortized.
+    /// Queries at off-grid instants (e.g., root refinement) fall back to single instant state lookups.
+    /// Static trajectories are not prefetched, as their fixed positions are transformed directly.
+    ///
+    /// @param anEndInstant A grid end instant
+    /// @param aStep A grid step
+    /// @param aChunkSize A number of grid instants per chunk
+    void enableStatePrefetching(const Instant& anEndInstant, const Duration& aStep, const Size& aChunkSize);
+
+    /// @brief Get "from" and "to" states at a given instant, using prefetched states when available
+    ///
+    /// @param anInstant An instant
+    /// @return "From" and "to" states
+    Pair<State, State> getStatesAt(const Instant& anInstant);
+
+    /// @brief Set the statistics updated by condition evaluations
+    ///
+    /// @param aStatisticsPtr A pointer to statistics (not owned, nullptr disables statistics)
+    void setStatistics(Generator::Statistics* aStatisticsPtr);
+
     static Pair<State, State> GetStatesAt(
         const Instant& anInstant, const Trajectory& aFromTrajectory, const Trajectory& aToTrajectory
     );
@@ -186,13 +386,128 @@ class GeneratorContext
         const Shared<const Celestial> anEarthSPtr
     );
 
+    /// @brief Calculate AER from a stationary (Earth-fixed) position
+    ///
+    /// @param anInstant An instant
+    /// @param aFromPositionCoordinates_ITRF "From" position coordinates, in ITRF [m]
+    /// @param anItrfToNedRotation Rotation from ITRF to the "from" position NED frame
+    /// @param aToPosition A "to" position
+    /// @return AER
+    static AER CalculateAer(
+        const Instant& anInstant,
+        const Vector3d& aFromPositionCoordinates_ITRF,
+        const Matrix3d& anItrfToNedRotation,
+        const Position& aToPosition
+    );
+
+    /// @brief Calculate raw AER coordinates from a stationary (Earth-fixed) position
+    ///
+    /// @param anInstant An instant
+    /// @param aFromPositionCoordinates_ITRF "From" position coordinates, in ITRF [m]
+    /// @param anItrfToNedRotation Rotation from ITRF to the "from" position NED frame
+    /// @param aToPosition A "to" position
+    /// @return Azimuth [rad] in [0, 2pi), elevation [rad] and range [m]
+    static Vector3d CalculateAerCoordinates(
+        const Instant& anInstant,
+        const Vector3d& aFromPositionCoordinates_ITRF,
+        const Matrix3d& anItrfToNedRotation,
+        const Position& aToPosition
+    );
+
+    /// @brief Compute the rotation from ITRF to the NED frame of a given ITRF position
+    ///
+    /// @param aPositionCoordinates_ITRF Position coordinates, in ITRF [m]
+    /// @param anEarthSPtr An Earth
+    /// @return Rotation matrix
+    static Matrix3d ComputeItrfToNedRotation(
+        const Vector3d& aPositionCoordinates_ITRF, const Shared<const Celestial> anEarthSPtr
+    );
+
+    /// @brief Check if a segment intersects a spheroid (ellipsoid of revolution)
+    ///
+    /// Coordinates are scaled along the polar axis, mapping the spheroid to a sphere, in which the closest approach of
+    /// the segment to the center is computed in closed form. Segments grazing the spheroid (within a millimeter) do
+    /// not intersect it, so that points on the surface keep their line of sight above the horizon.
+    ///
+    /// @param aStartCoordinates Segment start coordinates [m]
+    /// @param anEndCoordinates Segment end coordinates [m]
+    /// @param aCenterCoordinates Spheroid center coordinates [m]
+    /// @param aPolarAxis Spheroid polar axis (unit vector)
+    /// @param anEquatorialRadius Spheroid equatorial radius [m]
+    /// @param aPolarRadius Spheroid polar radius [m]
+    /// @return True if the segment intersects the spheroid
+    static bool SegmentIntersectsSpheroid(
+        const Vector3d& aStartCoordinates,
+        const Vector3d& anEndCoordinates,
+        const Vector3d& aCenterCoordinates,
+        const Vector3d& aPolarAxis,
+        const double& anEquatorialRadius,
+        const double& aPolarRadius
+    );
+
+    /// @brief Coarse geometric screening test
+    ///
+    /// @param aFromPosition A "from" position, in GCRF
+    /// @param aToPosition A "to" position, in GCRF
+    /// @param anEarthSPtr An Earth
+    /// @param aMinimumElevation A minimum elevation (ignored if undefined)
+    /// @param aMaximumRange A maximum range (ignored if undefined)
+    /// @return False if access is provably inactive, true otherwise
+    static bool PassesScreening(
+        const Position& aFromPosition,
+        const Position& aToPosition,
+        const Shared<const Celestial> anEarthSPtr,
+        const Angle& aMinimumElevation,
+        const Length& aMaximumRange
+    );
+
    private:
     Trajectory fromTrajectory_;
     Trajectory toTrajectory_;
-    Environment environment_;
+    EnvironmentView environment_;
     const Shared<const Celestial> earthSPtr_;
 
     Generator generator_;
+
+    // AER filter of the generator. Native AER filters (AerFilter) are evaluated on raw AER coordinates.
+    std::function<bool(const AER&)> aerFilter_;
+
+    // Set if the "from" trajectory is stationary in ITRF (e.g., a ground station)
+    bool fromTrajectoryIsStationary_;
+    Vector3d fromPositionCoordinates_ITRF_;
+    Matrix3d fromItrfToNedRotation_;
+
+    // Fixed positions of static trajectories (undefined otherwise), transformed to GCRF with the cached transform of
+    // each instant instead of constructing states
+    Position fromStaticPosition_;
+    Position toStaticPosition_;
+
+    // Celestial objects of the environment, whose occultation of the line of sight is tested analytically. Unset if
+    // the environment holds other objects, in which case the line of sight is intersected with the environment.
+    bool lineOfSightIsAnalytic_;
+    Array<Shared<const Celestial>> occultingCelestialSPtrs_;
+
+    // Chunked state prefetching (disabled if the chunk size is zero)
+    Size prefetchChunkSize_;
+    Duration prefetchStep_;
+    Instant prefetchEndInstant_;
+    Instant nextPrefetchInstant_;
+    Array<Instant> prefetchedInstants_;
+    Array<State> prefetchedFromStates_;
+    Array<State> prefetchedToStates_;
+    Index prefetchIndex_;
+
+    Generator::Statistics* statisticsPtr_;
+
+    void prefetchStates();
+
+    Index getPrefetchIndexAt(const Instant& anInstant);
+
+    Pair<Position, Position> getPositionsAt(const Instant& anInstant);
+
+    bool isLineOfSightClear(
+        const Instant& anInstant, const Vector3d& aFromPositionCoordinates, const Vector3d& aToPositionCoordinates
+    ) const;
 };
 
 }  // namespace access
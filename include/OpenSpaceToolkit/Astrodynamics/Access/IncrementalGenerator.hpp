@@ -0,0 +1,91 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Access_IncrementalGenerator__
+#define __OpenSpaceToolkit_Astrodynamics_Access_IncrementalGenerator__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Access.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Access/Generator.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace access
+{
+
+using ostk::core::container::Array;
+
+using ostk::astrodynamics::Access;
+using ostk::astrodynamics::access::Generator;
+using ostk::astrodynamics::Trajectory;
+
+/// @brief Incremental access generator
+///
+/// Retains the accesses computed between two trajectories over a previous analysis interval. When the analysis
+/// interval is shifted or extended, previously computed accesses are reused: only the new tail is evaluated, and
+/// accesses touching the previous interval end are re-validated.
+///
+/// @code{.cpp}
+///              IncrementalGenerator incrementalGenerator = { generator, groundStation, satellite } ;
+///              Array<Access> accesses = incrementalGenerator.computeAccesses(interval) ;
+///              accesses = incrementalGenerator.computeAccesses(nextInterval) ; // Only evaluates the new tail
+/// @endcode
+class IncrementalGenerator
+{
+   public:
+    /// @brief Constructor
+    ///
+    /// @param aGenerator An access generator
+    /// @param aFromTrajectory A "from" trajectory
+    /// @param aToTrajectory A "to" trajectory
+    IncrementalGenerator(
+        const Generator& aGenerator, const Trajectory& aFromTrajectory, const Trajectory& aToTrajectory
+    );
+
+    /// @brief Check if incremental generator is defined
+    ///
+    /// @return True if incremental generator is defined
+    bool isDefined() const;
+
+    /// @brief Get the interval of the last computation
+    ///
+    /// @return Interval (undefined if nothing has been computed yet)
+    physics::time::Interval getInterval() const;
+
+    /// @brief Compute accesses over a given interval, reusing results from the previous computation
+    ///
+    /// Results are reused if the interval starts within the previous interval. Otherwise, accesses are fully
+    /// recomputed.
+    ///
+    /// @param anInterval An analysis interval
+    /// @return Array of accesses
+    Array<Access> computeAccesses(const physics::time::Interval& anInterval);
+
+    /// @brief Discard retained results
+    void reset();
+
+    /// @brief Constructs an undefined incremental generator
+    ///
+    /// @return Undefined incremental generator
+    static IncrementalGenerator Undefined();
+
+   private:
+    Generator generator_;
+    Trajectory fromTrajectory_;
+    Trajectory toTrajectory_;
+
+    physics::time::Interval interval_;
+    Array<physics::time::Interval> accessIntervals_;
+    Array<Access> accesses_;  // Unfiltered, one per access interval
+};
+
+}  // namespace access
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
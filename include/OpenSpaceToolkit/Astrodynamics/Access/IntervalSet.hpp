@@ -0,0 +1,134 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Access_IntervalSet__
+#define __OpenSpaceToolkit_Astrodynamics_Access_IntervalSet__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Access.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace access
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Size;
+
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+
+using ostk::astrodynamics::Access;
+
+/// @brief Set of disjoint time intervals, in chronological order
+///
+/// Input intervals are sorted and merged on construction (O(n log n)): overlapping or touching intervals are merged.
+/// Set operations then merge the sorted interval arrays in linear time.
+///
+/// Intervals are treated as closed, and only intervals of non-zero duration are retained.
+///
+/// @code{.cpp}
+///              IntervalSet visibility = IntervalSet::FromAccesses(generator.computeAccesses(...)) ;
+///              IntervalSet sunlight = { eclipseSolver.computeIntervals(..., EclipseSolver::Region::Sunlight) } ;
+///              IntervalSet windows = visibility.intersectionWith(sunlight).differenceWith(blackouts) ;
+/// @endcode
+class IntervalSet
+{
+   public:
+    /// @brief Constructor
+    ///
+    /// @param anIntervalArray An array of intervals, in any order, possibly overlapping
+    IntervalSet(const Array<Interval>& anIntervalArray);
+
+    /// @brief Equal to operator
+    ///
+    /// @param anIntervalSet An interval set
+    /// @return True if interval sets are equal
+    bool operator==(const IntervalSet& anIntervalSet) const;
+
+    /// @brief Not equal to operator
+    ///
+    /// @param anIntervalSet An interval set
+    /// @return True if interval sets are not equal
+    bool operator!=(const IntervalSet& anIntervalSet) const;
+
+    /// @brief Check if interval set is empty
+    ///
+    /// @return True if interval set is empty
+    bool isEmpty() const;
+
+    /// @brief Check if interval set contains an instant
+    ///
+    /// @param anInstant An instant
+    /// @return True if interval set contains instant
+    bool contains(const Instant& anInstant) const;
+
+    /// @brief Get number of (disjoint) intervals
+    ///
+    /// @return Number of intervals
+    Size getSize() const;
+
+    /// @brief Access intervals
+    ///
+    /// @return Disjoint intervals, in chronological order
+    const Array<Interval>& accessIntervals() const;
+
+    /// @brief Get total duration
+    ///
+    /// @return Sum of the interval durations
+    Duration getDuration() const;
+
+    /// @brief Get union with another interval set
+    ///
+    /// @param anIntervalSet An interval set
+    /// @return Union
+    IntervalSet unionWith(const IntervalSet& anIntervalSet) const;
+
+    /// @brief Get intersection with another interval set
+    ///
+    /// @param anIntervalSet An interval set
+    /// @return Intersection
+    IntervalSet intersectionWith(const IntervalSet& anIntervalSet) const;
+
+    /// @brief Get difference with another interval set
+    ///
+    /// @param anIntervalSet An interval set
+    /// @return Intervals of this set not covered by the other set
+    IntervalSet differenceWith(const IntervalSet& anIntervalSet) const;
+
+    /// @brief Get complement within an interval
+    ///
+    /// @param anInterval An interval
+    /// @return Gaps of this set within the interval
+    IntervalSet complementIn(const Interval& anInterval) const;
+
+    /// @brief Constructs an empty interval set
+    ///
+    /// @return Empty interval set
+    static IntervalSet Empty();
+
+    /// @brief Constructs an interval set from accesses
+    ///
+    /// @param anAccessArray An array of accesses
+    /// @return Interval set
+    static IntervalSet FromAccesses(const Array<Access>& anAccessArray);
+
+   private:
+    Array<Interval> intervals_;
+
+    IntervalSet();
+};
+
+}  // namespace access
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
@@ -0,0 +1,101 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Access_IntervalTree__
+#define __OpenSpaceToolkit_Astrodynamics_Access_IntervalTree__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Access.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace access
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+
+using ostk::astrodynamics::Access;
+
+/// @brief Static interval tree, for point and overlap queries over (possibly overlapping) intervals
+///
+/// Intervals are sorted by start instant, and the sorted array is viewed as an implicit balanced binary search tree,
+/// each node storing the latest end instant of its subtree. Construction is O(n log n), and queries are
+/// O(log n + k), k being the number of matching intervals.
+///
+/// Queries return indices into the input array, so that matches can be mapped back to their accesses (e.g., to the
+/// ground station or satellite of each access). Intervals are treated as closed.
+///
+/// @code{.cpp}
+///              IntervalTree intervalTree = IntervalTree::FromAccesses(accesses) ;
+///              Array<Index> overlappingAccessIndices = intervalTree.queryOverlapping(shift) ;
+/// @endcode
+class IntervalTree
+{
+   public:
+    /// @brief Constructor
+    ///
+    /// @param anIntervalArray An array of intervals, in any order
+    IntervalTree(const Array<Interval>& anIntervalArray);
+
+    /// @brief Get number of intervals
+    ///
+    /// @return Number of intervals
+    Size getSize() const;
+
+    /// @brief Query the intervals containing an instant
+    ///
+    /// @param anInstant An instant
+    /// @return Indices of the matching intervals in the input array, in increasing order
+    Array<Index> queryContaining(const Instant& anInstant) const;
+
+    /// @brief Query the intervals overlapping an interval
+    ///
+    /// @param anInterval An interval
+    /// @return Indices of the matching intervals in the input array, in increasing order
+    Array<Index> queryOverlapping(const Interval& anInterval) const;
+
+    /// @brief Constructs an interval tree from accesses
+    ///
+    /// @param anAccessArray An array of accesses
+    /// @return Interval tree, indexed as the access array
+    static IntervalTree FromAccesses(const Array<Access>& anAccessArray);
+
+   private:
+    struct Node
+    {
+        Instant startInstant;
+        Instant endInstant;
+        Instant subtreeEndInstant;
+        Index index;
+    };
+
+    Array<Node> nodes_;
+
+    Instant buildSubtree(const Index& aBeginIndex, const Index& anEndIndex);
+
+    void querySubtree(
+        const Index& aBeginIndex,
+        const Index& anEndIndex,
+        const Instant& aStartInstant,
+        const Instant& anEndInstant,
+        Array<Index>& anIndexArray
+    ) const;
+};
+
+}  // namespace access
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
@@ -0,0 +1,186 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Access_SensorFilter__
+#define __OpenSpaceToolkit_Astrodynamics_Access_SensorFilter__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/Quaternion.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/Profile.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace access
+{
+
+using ostk::core::container::Array;
+
+using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::unit::Angle;
+
+using ostk::astrodynamics::flight::Profile;
+using ostk::astrodynamics::trajectory::State;
+
+/// @brief Body-mounted sensor field of view filter
+///
+/// The sensor frame is defined from the body frame of a flight profile (expressed in GCRF) by a constant rotation, its
+/// Z axis being the boresight. A target is in the field of view if its direction, as seen from the observer, lies
+/// within a cone around the boresight, or within a rectangular pyramid whose half angles are measured in the XZ
+/// (horizontal) and YZ (vertical) planes.
+///
+/// The GCRF to sensor frame attitude is tabulated on a uniform grid over an interval, and spherically interpolated in
+/// between, so that an evaluation costs a quaternion interpolation and a few dot products. Instants out of the interval
+/// are evaluated on the profile directly.
+///
+/// Used as a state filter of an access generator, the sensor is mounted on the "to" trajectory (e.g., a satellite) and
+/// observes the "from" trajectory (e.g., a ground target). The generator then evaluates the filter natively, on the
+/// GCRF positions it already computed.
+///
+/// @code{.cpp}
+///              SensorFilter sensorFilter = SensorFilter::Cone(profile, q_S_B, Angle::Degrees(5.0), interval) ;
+///              generator.setStateFilter(sensorFilter) ;
+/// @endcode
+class SensorFilter
+{
+   public:
+    /// @brief Field of view shape
+    enum class Shape
+    {
+        Undefined,  ///< Undefined shape
+        Cone,       ///< Circular cone around the boresight
+        Rectangle   ///< Rectangular pyramid around the boresight
+    };
+
+    /// @brief Evaluate filter on states
+    ///
+    /// @param aFromState A "from" (target) state
+    /// @param aToState A "to" (observer) state
+    /// @return True if the target is in the field of view
+    bool operator()(const State& aFromState, const State& aToState) const;
+
+    /// @brief Evaluate filter on GCRF position coordinates
+    ///
+    /// @param anInstant An instant
+    /// @param anObserverPositionCoordinates An observer position [m], in GCRF
+    /// @param aTargetPositionCoordinates A target position [m], in GCRF
+    /// @return True if the target is in the field of view
+    bool evaluate(
+        const Instant& anInstant,
+        const Vector3d& anObserverPositionCoordinates,
+        const Vector3d& aTargetPositionCoordinates
+    ) const;
+
+    /// @brief Check if filter is defined
+    ///
+    /// @return True if filter is defined
+    bool isDefined() const;
+
+    /// @brief Get field of view shape
+    ///
+    /// @return Shape
+    Shape getShape() const;
+
+    /// @brief Get the interval over which the attitude is tabulated
+    ///
+    /// @return Interval
+    physics::time::Interval getInterval() const;
+
+    /// @brief Get the step between tabulated attitudes
+    ///
+    /// @return Step
+    Duration getStep() const;
+
+    /// @brief Get the attitude of the sensor at a given instant
+    ///
+    /// @param anInstant An instant
+    /// @return Quaternion mapping GCRF to the sensor frame
+    Quaternion getAttitudeAt(const Instant& anInstant) const;
+
+    /// @brief Constructs an undefined filter
+    ///
+    /// @return Undefined filter
+    static SensorFilter Undefined();
+
+    /// @brief Constructs a conical field of view filter
+    ///
+    /// @param aProfile A flight profile, expressed in GCRF
+    /// @param aSensorAttitude A quaternion mapping the body frame to the sensor frame
+    /// @param aHalfAngle A cone half angle, in (0, 180] deg
+    /// @param anInterval An interval over which the attitude is tabulated
+    /// @param aStep A step between tabulated attitudes
+    /// @return Filter
+    static SensorFilter Cone(
+        const Profile& aProfile,
+        const Quaternion& aSensorAttitude,
+        const Angle& aHalfAngle,
+        const physics::time::Interval& anInterval,
+        const Duration& aStep = Duration::Seconds(10.0)
+    );
+
+    /// @brief Constructs a rectangular field of view filter
+    ///
+    /// @param aProfile A flight profile, expressed in GCRF
+    /// @param aSensorAttitude A quaternion mapping the body frame to the sensor frame
+    /// @param aHorizontalHalfAngle A half angle in the XZ plane of the sensor frame, in (0, 90) deg
+    /// @param aVerticalHalfAngle A half angle in the YZ plane of the sensor frame, in (0, 90) deg
+    /// @param anInterval An interval over which the attitude is tabulated
+    /// @param aStep A step between tabulated attitudes
+    /// @return Filter
+    static SensorFilter Rectangle(
+        const Profile& aProfile,
+        const Quaternion& aSensorAttitude,
+        const Angle& aHorizontalHalfAngle,
+        const Angle& aVerticalHalfAngle,
+        const physics::time::Interval& anInterval,
+        const Duration& aStep = Duration::Seconds(10.0)
+    );
+
+   private:
+    Shape shape_;
+    Profile profile_;
+    Quaternion q_S_B_;
+
+    // Cosine of the cone half angle, or tangents of the rectangle half angles
+    double cosineHalfAngle_;
+    double tangentHorizontalHalfAngle_;
+    double tangentVerticalHalfAngle_;
+
+    physics::time::Interval interval_;
+    Duration step_;
+    Array<Quaternion> nodeAttitudes_;
+
+    SensorFilter(
+        const Shape& aShape,
+        const Profile& aProfile,
+        const Quaternion& aSensorAttitude,
+        const double& aCosineHalfAngle,
+        const double& aTangentHorizontalHalfAngle,
+        const double& aTangentVerticalHalfAngle,
+        const physics::time::Interval& anInterval,
+        const Duration& aStep
+    );
+
+    Quaternion computeAttitudeAt(const Instant& anInstant) const;
+
+    static Quaternion ComputeSensorAttitude(const Quaternion& aSensorAttitude, const State& aProfileState);
+};
+
+}  // namespace access
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
@@ -0,0 +1,170 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Conjunction_AvoidanceManeuverSolver__
+#define __OpenSpaceToolkit_Astrodynamics_Conjunction_AvoidanceManeuverSolver__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Conjunction/Message/CCSDS/CDM.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace conjunction
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::unit::Length;
+
+using ostk::astrodynamics::conjunction::message::ccsds::CDM;
+using ostk::astrodynamics::trajectory::Propagator;
+
+/// @brief Collision avoidance maneuver trade-space solver
+///
+/// The first object of the CDM is the maneuvering object. Candidate impulsive burns span a grid of lead times (before
+/// TCA), directions (in the RTN frame of the maneuvering object at the burn) and velocity increment magnitudes.
+///
+/// The nominal trajectory of the maneuvering object is propagated backward from TCA once, together with its state
+/// transition matrix, through all the burn instants. Each candidate is screened by mapping its velocity increment onto
+/// the TCA state through the state transition matrix, and recomputing the miss distance and the probability of
+/// collision (Foster's method) in the encounter plane, with the CDM covariances. The best candidates are then refined
+/// by full propagation of the maneuvered states to TCA, in parallel.
+///
+/// Candidates are ranked with those meeting the probability of collision threshold first, by increasing velocity
+/// increment magnitude, followed by the others, by increasing probability of collision. Refined candidates come first,
+/// ranked on their refined values.
+class AvoidanceManeuverSolver
+{
+   public:
+    /// @brief Candidate avoidance maneuver
+    struct Candidate
+    {
+        Duration leadTime;          // Burn time before TCA
+        Instant instant;            // Burn instant
+        Vector3d direction_RTN;     // Unit burn direction, in the RTN frame of the maneuvering object at the burn
+        Real deltaVMagnitude;       // Velocity increment magnitude [m/s]
+        Length missDistance;        // Miss distance in the encounter plane
+        Real collisionProbability;  // Probability of collision
+        bool isRefined;             // True if evaluated by full propagation, false if linearized
+    };
+
+    /// @brief Constructor
+    ///
+    /// @code{.cpp}
+    ///              AvoidanceManeuverSolver solver = { propagator, Length::Meters(20.0) } ;
+    /// @endcode
+    ///
+    /// @param aPropagator A propagator of the maneuvering object (its dynamics must only read its position and
+    /// velocity)
+    /// @param aHardBodyRadius A combined hard body radius
+    /// @param aCollisionProbabilityThreshold (optional) A probability of collision threshold
+    /// @param aRefinementCount (optional) A count of best candidates refined by full propagation
+    /// @param aThreadCount (optional) A worker thread count (0 defaults to the default thread count of
+    /// ExecutionContext)
+    AvoidanceManeuverSolver(
+        const Propagator& aPropagator,
+        const Length& aHardBodyRadius,
+        const Real& aCollisionProbabilityThreshold = 1e-4,
+        const Size& aRefinementCount = 5,
+        const Size& aThreadCount = 0
+    );
+
+    /// @brief Output stream operator
+    ///
+    /// @param anOutputStream An output stream
+    /// @param anAvoidanceManeuverSolver An avoidance maneuver solver
+    /// @return A reference to output stream
+    friend std::ostream& operator<<(
+        std::ostream& anOutputStream, const AvoidanceManeuverSolver& anAvoidanceManeuverSolver
+    );
+
+    /// @brief Check if avoidance maneuver solver is defined
+    ///
+    /// @return True if avoidance maneuver solver is defined
+    bool isDefined() const;
+
+    /// @brief Get propagator
+    ///
+    /// @return The propagator of the maneuvering object
+    Propagator getPropagator() const;
+
+    /// @brief Get hard body radius
+    ///
+    /// @return The combined hard body radius
+    Length getHardBodyRadius() const;
+
+    /// @brief Get probability of collision threshold
+    ///
+    /// @return The probability of collision threshold
+    Real getCollisionProbabilityThreshold() const;
+
+    /// @brief Get refinement count
+    ///
+    /// @return The count of best candidates refined by full propagation
+    Size getRefinementCount() const;
+
+    /// @brief Get worker thread count
+    ///
+    /// @return The worker thread count (0 defaults to the default thread count of ExecutionContext)
+    Size getThreadCount() const;
+
+    /// @brief Solve the trade space of avoidance maneuvers of a conjunction
+    ///
+    /// @code{.cpp}
+    ///              Array<AvoidanceManeuverSolver::Candidate> candidates =
+    ///                  solver.solve(cdm, leadTimes, directions_RTN, deltaVMagnitudes) ;
+    /// @endcode
+    ///
+    /// @param aCDM A CDM, whose first object is the maneuvering object
+    /// @param aLeadTimeArray An array of burn lead times (before TCA)
+    /// @param aDirectionArray_RTN An array of burn directions, in the RTN frame of the maneuvering object at the burn
+    /// @param aDeltaVMagnitudeArray An array of velocity increment magnitudes [m/s]
+    /// @return Array of candidates, ranked
+    Array<AvoidanceManeuverSolver::Candidate> solve(
+        const CDM& aCDM,
+        const Array<Duration>& aLeadTimeArray,
+        const Array<Vector3d>& aDirectionArray_RTN,
+        const Array<Real>& aDeltaVMagnitudeArray
+    ) const;
+
+    /// @brief Print avoidance maneuver solver
+    ///
+    /// @param anOutputStream An output stream
+    /// @param (optional) displayDecorators If true, display decorators
+    void print(std::ostream& anOutputStream, bool displayDecorator = true) const;
+
+    /// @brief Undefined avoidance maneuver solver
+    ///
+    /// @return An undefined avoidance maneuver solver
+    static AvoidanceManeuverSolver Undefined();
+
+   private:
+    Propagator propagator_;
+    Length hardBodyRadius_;
+    Real collisionProbabilityThreshold_;
+    Size refinementCount_;
+    Size threadCount_;
+};
+
+}  // namespace conjunction
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
@@ -11,6 +11,7 @@
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
@@ -23,6 +24,7 @@
 #include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
 #include <OpenSpaceToolkit/Physics/Unit/Mass.hpp>
 
+#include <OpenSpaceToolkit/Astrodynamics/ExecutionContext.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
 
 namespace ostk
@@ -45,6 +47,7 @@ using ostk::core::type::Index;
 using ostk::core::type::Integer;
 using ostk::core::type::Real;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 
 using ostk::mathematics::object::MatrixXd;
@@ -58,6 +61,7 @@ using ostk::physics::time::Instant;
 using ostk::physics::unit::Length;
 using ostk::physics::unit::Mass;
 
+using ostk::astrodynamics::ExecutionContext;
 using ostk::astrodynamics::trajectory::State;
 
 /// @brief CCSDS Conjunction Data Message (CDM)
@@ -263,6 +267,19 @@ class CDM
 
     MatrixXd getObjectCovarianceMatrix(const Index& anIndex) const;
 
+    /// @brief Compute the probability of collision, from the object states and RTN covariances at TCA
+    ///
+    /// The combined position covariance is projected onto the encounter plane (normal to the relative velocity),
+    /// and the resulting 2D Gaussian is integrated over the hard body disk (Foster's method).
+    ///
+    /// @code{.cpp}
+    ///              Real probability = cdm.computeCollisionProbability(Length::Meters(20.0)) ;
+    /// @endcode
+    ///
+    /// @param aHardBodyRadius A combined hard body radius
+    /// @return Probability of collision
+    Real computeCollisionProbability(const Length& aHardBodyRadius) const;
+
     void print(std::ostream& anOutputStream, bool displayDecorator = true) const;
 
     static CDM Undefined();
@@ -273,6 +290,108 @@ class CDM
 
     static CDM Load(const File& aFile);
 
+    /// @brief Parse a CDM from a given string, in the CCSDS Keyword = Value Notation (KVN)
+    ///
+    /// Lines are tokenized in a single pass, and their values read directly into the CDM sections. Comments and
+    /// units are skipped.
+    ///
+    /// @code{.cpp}
+    ///              CDM cdm = CDM::ParseKVN(aString) ;
+    /// @endcode
+    ///
+    /// @param aString A string in KVN format
+    /// @return CDM
+    static CDM ParseKVN(const String& aString);
+
+    /// @brief Load a CDM from a given file, in the CCSDS Keyword = Value Notation (KVN)
+    ///
+    /// @code{.cpp}
+    ///              CDM cdm = CDM::LoadKVN(File::Path(Path::Parse("/path/to/cdm.kvn"))) ;
+    /// @endcode
+    ///
+    /// @param aFile A file in KVN format
+    /// @return CDM
+    static CDM LoadKVN(const File& aFile);
+
+    /// @brief Parse an array of CDMs (e.g. a SpaceTrack JSON query result) from a given string
+    ///
+    /// The array is scanned in place, without building an intermediate dictionary. The fields of each message are
+    /// then read directly into the CDM sections, in parallel chunks.
+    ///
+    /// @code{.cpp}
+    ///              Array<CDM> cdms = CDM::ParseArray(aString) ;
+    /// @endcode
+    ///
+    /// @param aString A string holding a JSON array of CDMs
+    /// @param aThreadCount A worker thread count (0 defaults to the default thread count of ExecutionContext)
+    /// @return Array of CDMs, in the order of the string
+    static Array<CDM> ParseArray(const String& aString, const Size& aThreadCount = 0);
+
+    /// @brief Parse an array of CDMs from a given string, within an execution context
+    ///
+    /// @param aString A string holding a JSON array of CDMs
+    /// @param anExecutionContext An execution context
+    /// @return Array of CDMs, in the order of the string
+    static Array<CDM> ParseArray(const String& aString, const ExecutionContext& anExecutionContext);
+
+    /// @brief Load an array of CDMs from a given file
+    ///
+    /// @code{.cpp}
+    ///              Array<CDM> cdms = CDM::LoadArray(File::Path(Path::Parse("/path/to/cdms.json"))) ;
+    /// @endcode
+    ///
+    /// @param aFile A file holding a JSON array of CDMs
+    /// @param aThreadCount A worker thread count (0 defaults to the default thread count of ExecutionContext)
+    /// @return Array of CDMs, in the order of the file
+    static Array<CDM> LoadArray(const File& aFile, const Size& aThreadCount = 0);
+
+    /// @brief Load an array of CDMs from a given file, within an execution context
+    ///
+    /// @param aFile A file holding a JSON array of CDMs
+    /// @param anExecutionContext An execution context
+    /// @return Array of CDMs, in the order of the file
+    static Array<CDM> LoadArray(const File& aFile, const ExecutionContext& anExecutionContext);
+
+    /// @brief Compute the probabilities of collision of an array of CDMs, in parallel chunks
+    ///
+    /// @code{.cpp}
+    ///              Array<Real> probabilities = CDM::ComputeCollisionProbabilities(cdms, Length::Meters(20.0)) ;
+    /// @endcode
+    ///
+    /// @param aCDMArray An array of CDMs
+    /// @param aHardBodyRadius A combined hard body radius
+    /// @param aThreadCount A worker thread count (0 defaults to the default thread count of ExecutionContext)
+    /// @return Array of probabilities of collision, in the order of the CDMs
+    static Array<Real> ComputeCollisionProbabilities(
+        const Array<CDM>& aCDMArray, const Length& aHardBodyRadius, const Size& aThreadCount = 0
+    );
+
+    /// @brief Compute the probabilities of collision of an array of CDMs, within an execution context
+    ///
+    /// @param aCDMArray An array of CDMs
+    /// @param aHardBodyRadius A combined hard body radius
+    /// @param anExecutionContext An execution context
+    /// @return Array of probabilities of collision, in the order of the CDMs
+    static Array<Real> ComputeCollisionProbabilities(
+        const Array<CDM>& aCDMArray, const Length& aHardBodyRadius, const ExecutionContext& anExecutionContext
+    );
+
+    /// @brief Compute the probability of collision of two objects, from their states and RTN covariances at TCA
+    ///
+    /// Lets callers evaluate modified object data (e.g. after a candidate avoidance maneuver) without building a CDM.
+    ///
+    /// @code{.cpp}
+    ///              Real probability = CDM::ComputeCollisionProbability(firstData, secondData, Length::Meters(20.0)) ;
+    /// @endcode
+    ///
+    /// @param aFirstObjectData A first object data
+    /// @param aSecondObjectData A second object data
+    /// @param aHardBodyRadius A combined hard body radius
+    /// @return Probability of collision
+    static Real ComputeCollisionProbability(
+        const CDM::Data& aFirstObjectData, const CDM::Data& aSecondObjectData, const Length& aHardBodyRadius
+    );
+
     static CDM::ObjectType ObjectTypeFromString(const String& aString);
 
    private:
@@ -0,0 +1,184 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Conjunction_Screener__
+#define __OpenSpaceToolkit_Astrodynamics_Conjunction_Screener__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Conjunction/Message/CCSDS/CDM.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/ExecutionContext.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/SGP4/TLE.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace conjunction
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::unit::Length;
+
+using ostk::astrodynamics::conjunction::message::ccsds::CDM;
+using ostk::astrodynamics::ExecutionContext;
+using ostk::astrodynamics::Trajectory;
+using ostk::astrodynamics::trajectory::orbit::model::sgp4::TLE;
+
+/// @brief All-vs-all conjunction screener
+///
+/// Trajectories are sampled on a regular time grid, in the GCRF frame. Between two samples, each object is bounded
+/// by a sphere enclosing its chord, padded by the deviation allowed by its largest sampled acceleration. Candidate
+/// pairs are found, for every time bucket, by hashing these spheres on a uniform grid, and are pruned with a radial
+/// (perigee / apogee) shell filter. For each surviving pair and bucket, the time of closest approach is refined as
+/// the root of the range rate, and reported when the miss distance is within the screening distance.
+class Screener
+{
+   public:
+    /// @brief Close approach between two screened objects, in a CDM compatible layout
+    struct Conjunction
+    {
+        Index firstObjectIndex;
+        Index secondObjectIndex;
+        CDM::RelativeMetadata relativeMetadata;  // TCA, miss distance, screening period and volume
+        Vector3d relativePosition_RTN;           // Second w.r.t. first object, in first object RTN frame [m]
+        Vector3d relativeVelocity_RTN;           // Second w.r.t. first object, in first object RTN frame [m/s]
+        Array<CDM::Data> dataArray;              // Object states at TCA, in the GCRF frame (no covariance)
+    };
+
+    /// @brief Constructor
+    ///
+    /// @code{.cpp}
+    ///              Screener screener = { Length::Kilometers(5.0) } ;
+    /// @endcode
+    ///
+    /// @param aScreeningDistance A screening distance (spherical screening volume)
+    /// @param aStep (optional) A sampling step
+    /// @param aTolerance (optional) A time of closest approach tolerance
+    /// @param aThreadCount (optional) A worker thread count (0 defaults to the default thread count of
+    /// ExecutionContext)
+    Screener(
+        const Length& aScreeningDistance,
+        const Duration& aStep = Duration::Seconds(30.0),
+        const Duration& aTolerance = Duration::Milliseconds(1.0),
+        const Size& aThreadCount = 0
+    );
+
+    /// @brief Output stream operator
+    ///
+    /// @param anOutputStream An output stream
+    /// @param aScreener A screener
+    /// @return A reference to output stream
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const Screener& aScreener);
+
+    /// @brief Check if screener is defined
+    ///
+    /// @return True if screener is defined
+    bool isDefined() const;
+
+    /// @brief Get screening distance
+    ///
+    /// @return The screening distance
+    Length getScreeningDistance() const;
+
+    /// @brief Get sampling step
+    ///
+    /// @return The sampling step
+    Duration getStep() const;
+
+    /// @brief Get time of closest approach tolerance
+    ///
+    /// @return The time of closest approach tolerance
+    Duration getTolerance() const;
+
+    /// @brief Get worker thread count
+    ///
+    /// @return The worker thread count (0 defaults to the default thread count of ExecutionContext)
+    Size getThreadCount() const;
+
+    /// @brief Screen an array of trajectories against each other
+    ///
+    /// @code{.cpp}
+    ///              Array<Screener::Conjunction> conjunctions = screener.screen(trajectories, interval) ;
+    /// @endcode
+    ///
+    /// @param aTrajectoryArray An array of trajectories
+    /// @param anInterval A screening interval
+    /// @return Array of conjunctions, sorted by object indices and TCA
+    Array<Screener::Conjunction> screen(const Array<Trajectory>& aTrajectoryArray, const Interval& anInterval) const;
+
+    /// @brief Screen an array of trajectories against each other, within an execution context
+    ///
+    /// The execution context overrides the thread count of the screener.
+    ///
+    /// @param aTrajectoryArray An array of trajectories
+    /// @param anInterval A screening interval
+    /// @param anExecutionContext An execution context
+    /// @return Array of conjunctions, sorted by object indices and TCA
+    Array<Screener::Conjunction> screen(
+        const Array<Trajectory>& aTrajectoryArray, const Interval& anInterval, const ExecutionContext& anExecutionContext
+    ) const;
+
+    /// @brief Screen a catalog of TLEs against each other, propagated with SGP4
+    ///
+    /// @code{.cpp}
+    ///              Array<Screener::Conjunction> conjunctions = screener.screen(TLE::LoadCatalog(aFile), interval) ;
+    /// @endcode
+    ///
+    /// @param aTLEArray An array of TLEs
+    /// @param anInterval A screening interval
+    /// @return Array of conjunctions, sorted by object indices and TCA
+    Array<Screener::Conjunction> screen(const Array<TLE>& aTLEArray, const Interval& anInterval) const;
+
+    /// @brief Screen a catalog of TLEs against each other, propagated with SGP4, within an execution context
+    ///
+    /// The execution context overrides the thread count of the screener.
+    ///
+    /// @param aTLEArray An array of TLEs
+    /// @param anInterval A screening interval
+    /// @param anExecutionContext An execution context
+    /// @return Array of conjunctions, sorted by object indices and TCA
+    Array<Screener::Conjunction> screen(
+        const Array<TLE>& aTLEArray, const Interval& anInterval, const ExecutionContext& anExecutionContext
+    ) const;
+
+    /// @brief Print screener
+    ///
+    /// @param anOutputStream An output stream
+    /// @param (optional) displayDecorators If true, display decorators
+    void print(std::ostream& anOutputStream, bool displayDecorator = true) const;
+
+    /// @brief Undefined screener
+    ///
+    /// @return An undefined screener
+    static Screener Undefined();
+
+   private:
+    Length screeningDistance_;
+    Duration step_;
+    Duration tolerance_;
+    Size threadCount_;
+};
+
+}  // namespace conjunction
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
@@ -3,6 +3,10 @@
 #ifndef __OpenSpaceToolkit_Astrodynamics_Dynamics__
 #define __OpenSpaceToolkit_Astrodynamics_Dynamics__
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Pair.hpp>
 #include <OpenSpaceToolkit/Core/Error.hpp>
@@ -11,10 +15,13 @@
 #include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
 #include <OpenSpaceToolkit/Physics/Environment.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateBroker.hpp>
@@ -33,11 +40,14 @@ using ostk::core::type::Shared;
 using ostk::core::type::Size;
 using ostk::core::type::String;
 
+using ostk::mathematics::object::MatrixXd;
 using ostk::mathematics::object::Vector3d;
 using ostk::mathematics::object::VectorXd;
 
 using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Transform;
 using ostk::physics::Environment;
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 
 using ostk::astrodynamics::trajectory::state::CoordinateBroker;
@@ -48,6 +58,37 @@ using ostk::astrodynamics::trajectory::state::NumericalSolver;
 class Dynamics
 {
    public:
+    /// @brief Cumulative evaluation count and time of a dynamics within systems of equations
+    struct Timing
+    {
+        Size callCount = 0;                    ///< Number of evaluations.
+        Duration duration = Duration::Zero();  ///< Cumulative evaluation time.
+    };
+
+    /// @brief Accumulator of the evaluation time of a dynamics, shared by the copies of its context (thread-safe)
+    class Timer
+    {
+       public:
+        Timer();
+
+        /// @brief Record an evaluation
+        ///
+        /// @param aDuration Evaluation time
+        void record(const std::chrono::steady_clock::duration& aDuration);
+
+        /// @brief Get the timing recorded since construction (or last reset)
+        ///
+        /// @return Timing
+        Timing getTiming() const;
+
+        /// @brief Reset
+        void reset();
+
+       private:
+        std::atomic<Size> callCount_;
+        std::atomic<std::int64_t> durationNanoseconds_;
+    };
+
     struct Context
     {
         Context(
@@ -60,6 +101,16 @@ class Dynamics
         Array<Pair<Index, Size>> readIndexes;
         Array<Pair<Index, Size>> writeIndexes;
         Size readStateSize;
+        Size writeStateSize;
+
+        // Scratch buffers, preallocated so that evaluating the system of equations does not allocate
+        mutable VectorXd readState;
+        mutable VectorXd contribution;
+        mutable MatrixXd readStates;
+        mutable MatrixXd contributions;
+
+        // Evaluation timer, only set while timing is enabled, and shared by copies of the context
+        Shared<Timer> timerSPtr;
     };
 
     /// @brief Constructor
@@ -120,6 +171,55 @@ class Dynamics
         const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
     ) const = 0;
 
+    /// @brief Write the contribution to the state derivative into a preallocated vector.
+    ///
+    /// Allocation-free counterpart of computeContribution, used to evaluate the system of equations. The default
+    /// implementation delegates to computeContribution.
+    ///
+    /// @param anInstant An instant
+    /// @param x The reduced state vector (this vector will follow the structure determined by the
+    /// 'read' coordinate subsets)
+    /// @param aFrameSPtr The frame in which the state vector is expressed
+    /// @param aContribution The reduced derivative state vector, preallocated to the size determined by the 'write'
+    /// coordinate subsets
+    virtual void writeContribution(
+        const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr, VectorXd& aContribution
+    ) const;
+
+    /// @brief Write the contributions of an ensemble of states into a preallocated matrix.
+    ///
+    /// Reduced states and contributions are stored column-wise, one column per sample. The default implementation
+    /// evaluates samples one at a time through writeContribution; dynamics may override it to process the whole
+    /// column block at once.
+    ///
+    /// @param anInstant An instant
+    /// @param aStateMatrix The reduced state matrix (its rows follow the structure determined by the 'read'
+    /// coordinate subsets)
+    /// @param aFrameSPtr The frame in which the states are expressed
+    /// @param aContributionMatrix The reduced derivative state matrix, preallocated to the number of rows determined
+    /// by the 'write' coordinate subsets and to the number of samples
+    virtual void writeContributions(
+        const Instant& anInstant,
+        const MatrixXd& aStateMatrix,
+        const Shared<const Frame>& aFrameSPtr,
+        MatrixXd& aContributionMatrix
+    ) const;
+
+    /// @brief Compute the Jacobian of the contribution with respect to the reduced state.
+    ///
+    /// Used to integrate the variational equations. The default implementation uses central finite differences of
+    /// computeContribution; dynamics may override it with analytical partials.
+    ///
+    /// @param anInstant An instant
+    /// @param x The reduced state vector (this vector will follow the structure determined by the
+    /// 'read' coordinate subsets)
+    /// @param aFrameSPtr The frame in which the state vector is expressed
+    ///
+    /// @return The Jacobian matrix, of size (write state size) x (read state size)
+    virtual MatrixXd computeJacobian(
+        const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+    ) const;
+
     /// @brief Get system of equations wrapper
     ///
     /// @param aContextArray An array of Dynamics Information
@@ -131,6 +231,65 @@ class Dynamics
         const Array<Context>& aContextArray, const Instant& anInstant, const Shared<const Frame>& aFrameSPtr
     );
 
+    /// @brief Get variational system of equations wrapper
+    ///
+    /// The integrated vector is the state vector followed by the (column-major) state transition matrix, which is
+    /// propagated alongside with the Jacobians of the dynamics.
+    ///
+    /// @param aContextArray An array of Dynamics Information
+    /// @param anInstant An instant
+    /// @param aFrameSPtr The frame in which the state is expressed
+    /// @param aStateSize The state size (excluding the state transition matrix)
+    ///
+    /// @return NumericalSolver::SystemOfEquationsWrapper
+    static NumericalSolver::SystemOfEquationsWrapper GetVariationalSystemOfEquations(
+        const Array<Context>& aContextArray,
+        const Instant& anInstant,
+        const Shared<const Frame>& aFrameSPtr,
+        const Size& aStateSize
+    );
+
+    /// @brief Get fixed size system of equations wrapper
+    ///
+    /// The read and write layout of each context is resolved once, into flat index maps, so that evaluating the
+    /// system of equations involves no broker lookup nor dynamic sizing of the state. Explicitly instantiated for
+    /// state sizes 6 and 7.
+    ///
+    /// @param aContextArray An array of Dynamics Information
+    /// @param anInstant An instant
+    /// @param aFrameSPtr The reference frame in which dynamic equations are resolved
+    ///
+    /// @return NumericalSolver::FixedSizeSystemOfEquationsWrapper<StateSize>
+    template <int StateSize>
+    static NumericalSolver::FixedSizeSystemOfEquationsWrapper<StateSize> GetFixedSizeSystemOfEquations(
+        const Array<Context>& aContextArray, const Instant& anInstant, const Shared<const Frame>& aFrameSPtr
+    );
+
+    /// @brief Get ensemble system of equations wrapper
+    ///
+    /// @param aContextArray An array of Dynamics Information
+    /// @param anInstant An instant
+    /// @param aFrameSPtr The frame in which the states are expressed
+    ///
+    /// @return NumericalSolver::EnsembleSystemOfEquationsWrapper
+    static NumericalSolver::EnsembleSystemOfEquationsWrapper GetEnsembleSystemOfEquations(
+        const Array<Context>& aContextArray, const Instant& anInstant, const Shared<const Frame>& aFrameSPtr
+    );
+
+    /// @brief Get the transform between two frames at a given instant, through a per-thread cache
+    ///
+    /// All the dynamics evaluated at the same instant (e.g. within one stage of a propagation step) share the cached
+    /// transforms, instead of each computing its own. GCRF to ITRF transforms follow the EarthOrientation model.
+    ///
+    /// @param aFromFrameSPtr A frame to transform from
+    /// @param aToFrameSPtr A frame to transform to
+    /// @param anInstant An instant
+    ///
+    /// @return The transform
+    static Transform GetTransform(
+        const Shared<const Frame>& aFromFrameSPtr, const Shared<const Frame>& aToFrameSPtr, const Instant& anInstant
+    );
+
     /// @brief Get a list of dynamics from the envrionment
     ///
     /// @param anEnvironment An environment
@@ -150,8 +309,27 @@ class Dynamics
         const Shared<const Frame>& aFrameSPtr
     );
 
-    static VectorXd extractReadState(
-        const NumericalSolver::StateVector& x, const Array<Pair<Index, Size>>& readInfo, const Size readSize
+    static void VariationalEquations(
+        const NumericalSolver::StateVector& x,
+        NumericalSolver::StateVector& dxdt,
+        const double& t,
+        const Array<Context>& aContextArray,
+        const Instant& anInstant,
+        const Shared<const Frame>& aFrameSPtr,
+        const Size& aStateSize
+    );
+
+    static void EnsembleDynamicalEquations(
+        const MatrixXd& x,
+        MatrixXd& dxdt,
+        const double t,
+        const Array<Context>& aContextArray,
+        const Instant& anInstant,
+        const Shared<const Frame>& aFrameSPtr
+    );
+
+    static void extractReadState(
+        const NumericalSolver::StateVector& x, const Array<Pair<Index, Size>>& readInfo, VectorXd& aReadState
     );
 
     static void applyContribution(
@@ -3,10 +3,14 @@
 #ifndef __OpenSpaceToolkit_Astrodynamics_Dynamics_AtmosphericDrag__
 #define __OpenSpaceToolkit_Astrodynamics_Dynamics_AtmosphericDrag__
 
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 
 #include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
 #include <OpenSpaceToolkit/Physics/Unit/Mass.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
@@ -19,11 +23,15 @@ namespace astrodynamics
 namespace dynamics
 {
 
+using ostk::core::container::Array;
 using ostk::core::type::Integer;
+using ostk::core::type::Real;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 
 using ostk::physics::environment::object::Celestial;
 using ostk::physics::time::Instant;
+using ostk::physics::unit::Length;
 using ostk::physics::unit::Mass;
 
 using ostk::astrodynamics::Dynamics;
@@ -33,6 +41,95 @@ using ostk::astrodynamics::flight::system::SatelliteSystem;
 class AtmosphericDrag : public Dynamics
 {
    public:
+    /// @brief Atmospheric density grid, in altitude x local solar time x latitude, evaluated once at a reference
+    /// instant and interpolated afterwards
+    ///
+    /// The logarithm of the density is interpolated trilinearly. The interpolation error is bounded by
+    /// (h^2 / 8) max|d^2 log(rho) / dh^2| per axis of grid step h. It vanishes in altitude for exponential layers, and
+    /// is dominated by the diurnal and latitudinal gradients for NRLMSISE00. The (coarse) default grid keeps the
+    /// density within a few percent of the model in the thermosphere. Space weather and solar declination are frozen
+    /// at the reference instant: the local solar time follows the mean Earth rotation with respect to the Sun. The
+    /// table is therefore meant for screening-quality propagations spanning a few days.
+    class DensityTable
+    {
+       public:
+        /// @brief Constructor
+        ///
+        /// @code{.cpp}
+        ///                  const Shared<const Celestial> earthSPtr = { ... };
+        ///                  const Shared<const AtmosphericDrag::DensityTable> densityTableSPtr =
+        ///                      std::make_shared<AtmosphericDrag::DensityTable>(
+        ///                          earthSPtr, Instant::J2000(), Length::Kilometers(200.0), Length::Kilometers(1000.0)
+        ///                      );
+        /// @endcode
+        ///
+        /// @param aCelestial A celestial object, with an atmospheric model
+        /// @param aReferenceInstant A reference instant
+        /// @param aMinimumAltitude A minimum altitude
+        /// @param aMaximumAltitude A maximum altitude
+        /// @param anAltitudeStep (optional) An altitude grid step
+        /// @param aLocalSolarTimeCount (optional) A number of local solar time grid points, over a solar day
+        /// @param aLatitudeCount (optional) A number of latitude grid points, from the South pole to the North pole
+        DensityTable(
+            const Shared<const Celestial>& aCelestial,
+            const Instant& aReferenceInstant,
+            const Length& aMinimumAltitude,
+            const Length& aMaximumAltitude,
+            const Length& anAltitudeStep = Length::Kilometers(2.0),
+            const Size& aLocalSolarTimeCount = 24,
+            const Size& aLatitudeCount = 19
+        );
+
+        /// @brief Get celestial
+        ///
+        /// @return A celestial object
+        Shared<const Celestial> getCelestial() const;
+
+        /// @brief Get reference instant
+        ///
+        /// @return The reference instant
+        Instant getReferenceInstant() const;
+
+        /// @brief Get minimum altitude
+        ///
+        /// @return The minimum altitude
+        Length getMinimumAltitude() const;
+
+        /// @brief Get maximum altitude
+        ///
+        /// @return The maximum altitude
+        Length getMaximumAltitude() const;
+
+        /// @brief Check if a position is within the tabulated altitude range
+        ///
+        /// @param aPositionCoordinates_ITRF Position coordinates [m], expressed in ITRF
+        /// @return True if the position is within the tabulated altitude range
+        bool isApplicableAt(const Vector3d& aPositionCoordinates_ITRF) const;
+
+        /// @brief Get the interpolated atmospheric density at a given position and instant
+        ///
+        /// @param aPositionCoordinates_ITRF Position coordinates [m], expressed in ITRF
+        /// @param anInstant An instant
+        /// @return The atmospheric density [kg/m^3]
+        Real getDensityAt(const Vector3d& aPositionCoordinates_ITRF, const Instant& anInstant) const;
+
+       private:
+        Shared<const Celestial> celestialObjectSPtr_;
+        Instant referenceInstant_;
+        Real minimumAltitude_m_;
+        Real altitudeStep_m_;
+        Size altitudeCount_;
+        Size localSolarTimeCount_;
+        Size latitudeCount_;
+        Real equatorialRadius_m_;
+        Real flattening_;
+        Real subsolarLongitude_rad_;
+        Array<double> logDensities_;
+
+        Index getGridIndex(const Index& anAltitudeIndex, const Index& aLocalSolarTimeIndex, const Index& aLatitudeIndex)
+            const;
+    };
+
     /// @brief Constructor
     ///
     /// @code{.cpp}
@@ -55,6 +152,51 @@ class AtmosphericDrag : public Dynamics
     /// @param aName A name
     AtmosphericDrag(const Shared<const Celestial>& aCelestial, const String& aName);
 
+    /// @brief Constructor with density table
+    ///
+    /// Within the tabulated altitude range, the atmospheric density is interpolated from the table instead of being
+    /// evaluated with the atmospheric model.
+    ///
+    /// @code{.cpp}
+    ///                  const Celestial = { ... };
+    ///                  const aDensityTableSPtr = { ... };
+    ///                  AtmosphericDrag atmosphericDrag = { aCelestial, aDensityTableSPtr };
+    /// @endcode
+    ///
+    /// @param aCelestial A celestial object
+    /// @param aDensityTableSPtr A density table of the celestial object
+    /// @param aName A name
+    AtmosphericDrag(
+        const Shared<const Celestial>& aCelestial,
+        const Shared<const DensityTable>& aDensityTableSPtr,
+        const String& aName = String::Empty()
+    );
+
+    /// @brief Constructor with a projected area table
+    ///
+    /// The drag area is interpolated from the projected area table along the relative velocity, expressed in the body
+    /// frame through the attitude quaternion of the state (instead of being read from the surface area subset). The
+    /// attitude quaternion rotates vectors from the state frame to the body frame.
+    ///
+    /// @code{.cpp}
+    ///                  const Celestial = { ... };
+    ///                  const SatelliteSystem satelliteSystem = { ... };
+    ///                  AtmosphericDrag atmosphericDrag = {
+    ///                      aCelestial, nullptr, satelliteSystem.getProjectedAreaTable()
+    ///                  };
+    /// @endcode
+    ///
+    /// @param aCelestial A celestial object
+    /// @param aDensityTableSPtr A density table of the celestial object (can be nullptr)
+    /// @param aProjectedAreaTableSPtr A projected area table of the satellite (can be nullptr)
+    /// @param aName A name
+    AtmosphericDrag(
+        const Shared<const Celestial>& aCelestial,
+        const Shared<const DensityTable>& aDensityTableSPtr,
+        const Shared<const SatelliteSystem::ProjectedAreaTable>& aProjectedAreaTableSPtr,
+        const String& aName = String::Empty()
+    );
+
     /// @brief Destructor
     virtual ~AtmosphericDrag() override;
 
@@ -75,6 +217,16 @@ class AtmosphericDrag : public Dynamics
     /// @return A celestial object
     Shared<const Celestial> getCelestial() const;
 
+    /// @brief Get density table
+    ///
+    /// @return The density table (nullptr if there is none)
+    Shared<const DensityTable> getDensityTable() const;
+
+    /// @brief Get projected area table
+    ///
+    /// @return The projected area table (nullptr if there is none)
+    Shared<const SatelliteSystem::ProjectedAreaTable> getProjectedAreaTable() const;
+
     /// @brief Return the coordinate subsets that the instance reads from
     ///
     /// @return The coordinate subsets that the instance reads from
@@ -98,6 +250,49 @@ class AtmosphericDrag : public Dynamics
         const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
     ) const override;
 
+    /// @brief Write the contribution to the state derivative into a preallocated vector.
+    ///
+    /// @param anInstant An instant
+    /// @param x The reduced state vector (this vector will follow the structure determined by the
+    /// 'read' coordinate subsets)
+    /// @param aFrameSPtr The frame in which the state vector is expressed
+    /// @param aContribution The reduced derivative state vector, preallocated to the size determined by the 'write'
+    /// coordinate subsets
+    virtual void writeContribution(
+        const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr, VectorXd& aContribution
+    ) const override;
+
+    /// @brief Compute the Jacobian of the contribution with respect to the reduced state.
+    ///
+    /// Analytical partials with respect to position, velocity, mass, surface area and drag coefficient. The density
+    /// gradient is approximated as radial, and obtained by central differences over the altitude.
+    ///
+    /// @param anInstant An instant
+    /// @param x The reduced state vector (this vector will follow the structure determined by the
+    /// 'read' coordinate subsets)
+    /// @param aFrameSPtr The frame in which the state vector is expressed
+    ///
+    /// @return The Jacobian matrix, of size (write state size) x (read state size)
+    virtual MatrixXd computeJacobian(
+        const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+    ) const override;
+
+    /// @brief Write the contributions of an ensemble of states into a preallocated matrix.
+    ///
+    /// The frame transform is evaluated once for the whole ensemble and the drag arithmetic is vectorized across
+    /// samples.
+    ///
+    /// @param anInstant An instant
+    /// @param aStateMatrix The reduced state matrix, one column per sample
+    /// @param aFrameSPtr The frame in which the states are expressed
+    /// @param aContributionMatrix The reduced derivative state matrix, one column per sample
+    virtual void writeContributions(
+        const Instant& anInstant,
+        const MatrixXd& aStateMatrix,
+        const Shared<const Frame>& aFrameSPtr,
+        MatrixXd& aContributionMatrix
+    ) const override;
+
     /// @brief Print atmospheric drag dynamics
     ///
     /// @param anOutputStream An output stream
@@ -106,6 +301,10 @@ class AtmosphericDrag : public Dynamics
 
    private:
     Shared<const Celestial> celestialObjectSPtr_;
+    Shared<const DensityTable> densityTableSPtr_;
+    Shared<const SatelliteSystem::ProjectedAreaTable> projectedAreaTableSPtr_;
+
+    Real getAtmosphericDensityAt(const Vector3d& aPositionCoordinates_ITRF, const Instant& anInstant) const;
 };
 
 }  // namespace dynamics
@@ -3,10 +3,13 @@
 #ifndef __OpenSpaceToolkit_Astrodynamics_Dynamics_CentralBodyGravity__
 #define __OpenSpaceToolkit_Astrodynamics_Dynamics_CentralBodyGravity__
 
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
 
 #include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
 
@@ -17,11 +20,14 @@ namespace astrodynamics
 namespace dynamics
 {
 
+using ostk::core::container::Array;
 using ostk::core::type::Integer;
+using ostk::core::type::Real;
 using ostk::core::type::String;
 
 using ostk::physics::environment::object::Celestial;
 using ostk::physics::time::Instant;
+using ostk::physics::unit::Length;
 
 using ostk::astrodynamics::Dynamics;
 
@@ -29,6 +35,14 @@ using ostk::astrodynamics::Dynamics;
 class CentralBodyGravity : public Dynamics
 {
    public:
+    /// @brief Altitude band, above which the gravitational field is evaluated with a (lower degree and order)
+    /// gravitational model of the central body
+    struct AltitudeBand
+    {
+        Length minimumAltitude;
+        Shared<const Celestial> celestialObjectSPtr;
+    };
+
     /// @brief Constructor
     ///
     /// @code{.cpp}
@@ -51,6 +65,31 @@ class CentralBodyGravity : public Dynamics
     /// @param aName A name
     CentralBodyGravity(const Shared<const Celestial>& aCelestial, const String& aName);
 
+    /// @brief Constructor with altitude bands
+    ///
+    /// The gravitational field is evaluated with the celestial object of the highest band whose minimum altitude is
+    /// below the current altitude, and with the provided celestial object below all bands. Altitudes are spherical,
+    /// measured from the equatorial radius of the central body, which is cheap enough to be evaluated at every step.
+    ///
+    /// @code{.cpp}
+    ///                  const Shared<const Celestial> earthSPtr =
+    ///                      std::make_shared<Celestial>(Earth::EGM2008(100, 100));
+    ///                  const Array<CentralBodyGravity::AltitudeBand> altitudeBands = {
+    ///                      {Length::Kilometers(1000.0), std::make_shared<Celestial>(Earth::EGM2008(30, 30))},
+    ///                      {Length::Kilometers(5000.0), std::make_shared<Celestial>(Earth::EGM2008(10, 10))},
+    ///                  };
+    ///                  CentralBodyGravity centralBodyGravity = { earthSPtr, altitudeBands };
+    /// @endcode
+    ///
+    /// @param aCelestial A celestial object
+    /// @param anAltitudeBandArray An array of altitude bands
+    /// @param aName A name
+    CentralBodyGravity(
+        const Shared<const Celestial>& aCelestial,
+        const Array<AltitudeBand>& anAltitudeBandArray,
+        const String& aName = String::Empty()
+    );
+
     /// @brief Destructor
     virtual ~CentralBodyGravity() override;
 
@@ -71,6 +110,11 @@ class CentralBodyGravity : public Dynamics
     /// @return A celestial object
     Shared<const Celestial> getCelestial() const;
 
+    /// @brief Get altitude bands
+    ///
+    /// @return The altitude bands, sorted by increasing minimum altitude
+    Array<AltitudeBand> getAltitudeBands() const;
+
     /// @brief Return the coordinate subsets that the instance reads from
     ///
     /// @return The coordinate subsets that the instance reads from
@@ -94,6 +138,33 @@ class CentralBodyGravity : public Dynamics
         const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
     ) const override;
 
+    /// @brief Write the contribution to the state derivative into a preallocated vector.
+    ///
+    /// @param anInstant An instant
+    /// @param x The reduced state vector (this vector will follow the structure determined by the
+    /// 'read' coordinate subsets)
+    /// @param aFrameSPtr The frame in which the state vector is expressed
+    /// @param aContribution The reduced derivative state vector, preallocated to the size determined by the 'write'
+    /// coordinate subsets
+    virtual void writeContribution(
+        const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr, VectorXd& aContribution
+    ) const override;
+
+    /// @brief Compute the Jacobian of the contribution with respect to the reduced state.
+    ///
+    /// Analytical partials of the point mass term: the higher order terms of the gravitational model, which are small
+    /// in comparison, are only accounted for in the contribution and not in its Jacobian.
+    ///
+    /// @param anInstant An instant
+    /// @param x The reduced state vector (this vector will follow the structure determined by the
+    /// 'read' coordinate subsets)
+    /// @param aFrameSPtr The frame in which the state vector is expressed
+    ///
+    /// @return The Jacobian matrix, of size (write state size) x (read state size)
+    virtual MatrixXd computeJacobian(
+        const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+    ) const override;
+
     /// @brief Print central body gravity dynamics
     ///
     /// @param anOutputStream An output stream
@@ -102,6 +173,11 @@ class CentralBodyGravity : public Dynamics
 
    private:
     Shared<const Celestial> celestialObjectSPtr_;
+    Array<AltitudeBand> altitudeBands_;
+    Array<Real> altitudeBandMinimumRadii_;
+    Real gravitationalParameter_SI_;
+
+    const Celestial& accessCelestialAt(const Vector3d& aPositionCoordinates) const;
 };
 
 }  // namespace dynamics
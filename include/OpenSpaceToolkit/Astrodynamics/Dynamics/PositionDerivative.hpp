@@ -72,6 +72,45 @@ class PositionDerivative : public Dynamics
         const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
     ) const override;
 
+    /// @brief Write the contribution to the state derivative into a preallocated vector.
+    ///
+    /// @param anInstant An instant
+    /// @param x The reduced state vector (this vector will follow the structure determined by the
+    /// 'read' coordinate subsets)
+    /// @param aFrameSPtr The frame in which the state vector is expressed
+    /// @param aContribution The reduced derivative state vector, preallocated to the size determined by the 'write'
+    /// coordinate subsets
+    virtual void writeContribution(
+        const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr, VectorXd& aContribution
+    ) const override;
+
+    /// @brief Compute the Jacobian of the contribution with respect to the reduced state.
+    ///
+    /// The position derivative is the velocity, hence the Jacobian is the identity.
+    ///
+    /// @param anInstant An instant
+    /// @param x The reduced state vector (this vector will follow the structure determined by the
+    /// 'read' coordinate subsets)
+    /// @param aFrameSPtr The frame in which the state vector is expressed
+    ///
+    /// @return The Jacobian matrix, of size (write state size) x (read state size)
+    virtual MatrixXd computeJacobian(
+        const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+    ) const override;
+
+    /// @brief Write the contributions of an ensemble of states into a preallocated matrix.
+    ///
+    /// @param anInstant An instant
+    /// @param aStateMatrix The reduced state matrix, one column per sample
+    /// @param aFrameSPtr The frame in which the states are expressed
+    /// @param aContributionMatrix The reduced derivative state matrix, one column per sample
+    virtual void writeContributions(
+        const Instant& anInstant,
+        const MatrixXd& aStateMatrix,
+        const Shared<const Frame>& aFrameSPtr,
+        MatrixXd& aContributionMatrix
+    ) const override;
+
     /// @brief Print
     ///
     /// @param anOutputStream An output stream
@@ -0,0 +1,171 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Dynamics_SolarRadiationPressure__
+#define __OpenSpaceToolkit_Astrodynamics_Dynamics_SolarRadiationPressure__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/ThirdBodyGravity.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace dynamics
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Real;
+using ostk::core::type::Shared;
+using ostk::core::type::String;
+
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::time::Instant;
+
+using ostk::astrodynamics::Dynamics;
+using ostk::astrodynamics::dynamics::ThirdBodyGravity;
+
+/// @brief Define the acceleration experienced by a spacecraft due to solar radiation pressure
+///
+/// The spacecraft is modeled as a cannonball: the acceleration is directed away from the Sun, and scaled by the
+/// reflectivity coefficient, the surface area over mass ratio, the inverse square of the distance to the Sun and the
+/// illumination fraction. The illumination fraction follows the conic umbra and penumbra of the occulting body,
+/// assumed at the origin of the propagation frame (e.g., the Earth in GCRF).
+///
+/// The Sun position can be obtained from an ephemeris table (e.g., the one shared with the Sun third body gravity),
+/// and the shadow geometry is only evaluated when the spacecraft is close enough to the shadow cones.
+class SolarRadiationPressure : public Dynamics
+{
+   public:
+    /// @brief Solar radiation pressure at one astronomical unit [N/m^2]
+    static constexpr double SolarRadiationPressureAtAstronomicalUnit_SI = 4.56e-6;
+
+    /// @brief Constructor
+    ///
+    /// @code{.cpp}
+    ///                  const Shared<const Celestial> sunSPtr = { ... };
+    ///                  const Shared<const Celestial> earthSPtr = { ... };
+    ///                  SolarRadiationPressure solarRadiationPressure = { sunSPtr, earthSPtr, 1.5 };
+    /// @endcode
+    ///
+    /// @param aSunSPtr A Sun
+    /// @param anOccultingCelestialSPtr An occulting celestial body, at the origin of the propagation frame
+    /// @param aReflectivityCoefficient A reflectivity coefficient (1.0 for a black body, 2.0 for a perfect mirror)
+    /// @param aSunEphemerisTableSPtr (optional) An ephemeris table of the Sun
+    /// @param aName (optional) A name
+    SolarRadiationPressure(
+        const Shared<const Celestial>& aSunSPtr,
+        const Shared<const Celestial>& anOccultingCelestialSPtr,
+        const Real& aReflectivityCoefficient,
+        const Shared<const ThirdBodyGravity::EphemerisTable>& aSunEphemerisTableSPtr = nullptr,
+        const String& aName = String::Empty()
+    );
+
+    /// @brief Destructor
+    virtual ~SolarRadiationPressure() override;
+
+    /// @brief Output stream operator
+    ///
+    /// @param anOutputStream An output stream
+    /// @param aSolarRadiationPressure A solar radiation pressure dynamics
+    /// @return A reference to output stream
+    friend std::ostream& operator<<(
+        std::ostream& anOutputStream, const SolarRadiationPressure& aSolarRadiationPressure
+    );
+
+    /// @brief Check if solar radiation pressure dynamics is defined
+    ///
+    /// @return True if solar radiation pressure dynamics is defined
+    virtual bool isDefined() const override;
+
+    /// @brief Get Sun
+    ///
+    /// @return The Sun
+    Shared<const Celestial> getSun() const;
+
+    /// @brief Get occulting celestial
+    ///
+    /// @return The occulting celestial body
+    Shared<const Celestial> getOccultingCelestial() const;
+
+    /// @brief Get reflectivity coefficient
+    ///
+    /// @return The reflectivity coefficient
+    Real getReflectivityCoefficient() const;
+
+    /// @brief Get Sun ephemeris table
+    ///
+    /// @return The Sun ephemeris table (nullptr if there is none)
+    Shared<const ThirdBodyGravity::EphemerisTable> getSunEphemerisTable() const;
+
+    /// @brief Return the coordinate subsets that the instance reads from
+    ///
+    /// @return The coordinate subsets that the instance reads from
+    virtual Array<Shared<const CoordinateSubset>> getReadCoordinateSubsets() const override;
+
+    /// @brief Return the coordinate subsets that the instance writes to
+    ///
+    /// @return The coordinate subsets that the instance writes to
+    virtual Array<Shared<const CoordinateSubset>> getWriteCoordinateSubsets() const override;
+
+    /// @brief Compute the contribution to the state derivative.
+    ///
+    /// @param anInstant        An instant
+    /// @param x                The reduced state vector (this vector will follow the structure determined by the 'read'
+    /// coordinate subsets)
+    /// @param aFrameSPtr       The frame in which the state vector is expressed
+    ///
+    /// @return The reduced derivative state vector (this vector must follow the structure determined by
+    /// the 'write' coordinate subsets) expressed in the given frame
+    virtual VectorXd computeContribution(
+        const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+    ) const override;
+
+    /// @brief Write the contribution to the state derivative into a preallocated vector.
+    ///
+    /// @param anInstant An instant
+    /// @param x The reduced state vector (this vector will follow the structure determined by the
+    /// 'read' coordinate subsets)
+    /// @param aFrameSPtr The frame in which the state vector is expressed
+    /// @param aContribution The reduced derivative state vector, preallocated to the size determined by the 'write'
+    /// coordinate subsets
+    virtual void writeContribution(
+        const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr, VectorXd& aContribution
+    ) const override;
+
+    /// @brief Print solar radiation pressure dynamics
+    ///
+    /// @param anOutputStream An output stream
+    /// @param (optional) displayDecorators If true, display decorators
+    virtual void print(std::ostream& anOutputStream, bool displayDecorator = true) const override;
+
+   private:
+    Shared<const Celestial> sunSPtr_;
+    Shared<const Celestial> occultingCelestialSPtr_;
+    Real reflectivityCoefficient_;
+    Shared<const ThirdBodyGravity::EphemerisTable> sunEphemerisTableSPtr_;
+    double sunRadius_m_;
+    double occultingRadius_m_;
+
+    Vector3d getSunPositionAt(const Instant& anInstant, const Shared<const Frame>& aFrameSPtr) const;
+
+    double computeIlluminationFraction(const Vector3d& aPositionCoordinates, const Vector3d& aSunPositionCoordinates)
+        const;
+};
+
+}  // namespace dynamics
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
@@ -4,6 +4,7 @@
 #define __OpenSpaceToolkit_Astrodynamics_Dynamics_Tabulated__
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
 
@@ -25,12 +26,14 @@ namespace dynamics
 {
 
 using ostk::core::container::Array;
+using ostk::core::type::Index;
 using ostk::core::type::Real;
 using ostk::core::type::Shared;
 
 using ostk::mathematics::curvefitting::Interpolator;
 using ostk::mathematics::object::MatrixXd;
 using ostk::mathematics::object::Vector3d;
+using ostk::mathematics::object::VectorXd;
 
 using ostk::physics::coordinate::Frame;
 using ostk::physics::time::Duration;
@@ -44,7 +47,13 @@ using ostk::astrodynamics::trajectory::state::CoordinateSubset;
 class Tabulated : public Dynamics
 {
    public:
-    static const Shared<const Frame> DefaultContributionFrameSPtr;
+    /// @brief Default contribution frame (GCRF)
+    ///
+    /// Constructed on first use.
+    ///
+    /// @return Default contribution frame
+    static const Shared<const Frame>& DefaultContributionFrame();
+
     /// @brief Constructor
     ///
     /// @param anInstantArray An array of instants, must be sorted
@@ -127,6 +136,22 @@ class Tabulated : public Dynamics
         const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
     ) const override;
 
+    /// @brief Write the contribution to the state derivative into a preallocated vector.
+    ///
+    /// With linear interpolation, all columns are evaluated at once from the bracketing rows of the contribution
+    /// profile. The bracketing interval is looked up from the one of the previous call on the same thread, which makes
+    /// the nearly monotonic queries of an integration constant time.
+    ///
+    /// @param anInstant An instant
+    /// @param x The reduced state vector (this vector will follow the structure determined by the
+    /// 'read' coordinate subsets)
+    /// @param aFrameSPtr The frame in which the state vector is expressed
+    /// @param aContribution The reduced derivative state vector, preallocated to the size determined by the 'write'
+    /// coordinate subsets
+    virtual void writeContribution(
+        const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr, VectorXd& aContribution
+    ) const override;
+
     /// @brief Print Tabulated dynamics
     ///
     /// @param anOutputStream An output stream
@@ -138,7 +163,11 @@ class Tabulated : public Dynamics
     const MatrixXd contributionProfile_;
     const Array<Shared<const CoordinateSubset>> writeCoordinateSubsets_;
     const Shared<const Frame> frameSPtr_;
+    const Interpolator::Type interpolationType_;
+    VectorXd timestamps_;
     Array<Shared<const Interpolator>> interpolators_;
+
+    Index findInterval(const double& anEpoch) const;
 };
 
 }  // namespace dynamics
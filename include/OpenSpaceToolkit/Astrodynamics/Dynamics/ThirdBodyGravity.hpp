@@ -3,10 +3,17 @@
 #ifndef __OpenSpaceToolkit_Astrodynamics_Dynamics_ThirdBodyGravity__
 #define __OpenSpaceToolkit_Astrodynamics_Dynamics_ThirdBodyGravity__
 
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
 
 #include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
 
@@ -17,11 +24,18 @@ namespace astrodynamics
 namespace dynamics
 {
 
+using ostk::core::container::Array;
 using ostk::core::type::Integer;
+using ostk::core::type::Real;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 
+using ostk::mathematics::object::MatrixXd;
+
 using ostk::physics::environment::object::Celestial;
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
 
 using ostk::astrodynamics::Dynamics;
 
@@ -29,6 +43,71 @@ using ostk::astrodynamics::Dynamics;
 class ThirdBodyGravity : public Dynamics
 {
    public:
+    /// @brief Position table of a celestial object over an interval, stored as piecewise Chebyshev polynomials
+    ///
+    /// The table is built once, and is meant to be shared (read-only) by all the dynamics propagated over the same
+    /// interval.
+    class EphemerisTable
+    {
+       public:
+        /// @brief Constructor
+        ///
+        /// @code{.cpp}
+        ///                  const Shared<const Celestial> moonSPtr = { ... };
+        ///                  const Interval interval = { ... };
+        ///                  const Shared<const ThirdBodyGravity::EphemerisTable> ephemerisTableSPtr =
+        ///                      std::make_shared<ThirdBodyGravity::EphemerisTable>(moonSPtr, interval, Frame::GCRF());
+        /// @endcode
+        ///
+        /// @param aCelestial A celestial object
+        /// @param anInterval An interval
+        /// @param aFrameSPtr A frame in which positions are tabulated
+        /// @param aSegmentDuration (optional) A polynomial segment duration
+        /// @param aDegree (optional) A polynomial degree
+        EphemerisTable(
+            const Shared<const Celestial>& aCelestial,
+            const Interval& anInterval,
+            const Shared<const Frame>& aFrameSPtr,
+            const Duration& aSegmentDuration = Duration::Days(1.0),
+            const Size& aDegree = 12
+        );
+
+        /// @brief Get celestial
+        ///
+        /// @return A celestial object
+        Shared<const Celestial> getCelestial() const;
+
+        /// @brief Get interval
+        ///
+        /// @return The tabulated interval
+        Interval getInterval() const;
+
+        /// @brief Get frame
+        ///
+        /// @return The frame in which positions are tabulated
+        Shared<const Frame> getFrame() const;
+
+        /// @brief Check if the table can be evaluated at a given instant, in a given frame
+        ///
+        /// @param anInstant An instant
+        /// @param aFrameSPtr A frame
+        /// @return True if the instant is in the tabulated interval and the frame is the tabulated frame
+        bool isApplicableAt(const Instant& anInstant, const Shared<const Frame>& aFrameSPtr) const;
+
+        /// @brief Get the position of the celestial object at a given instant
+        ///
+        /// @param anInstant An instant in the tabulated interval
+        /// @return The position coordinates [m], expressed in the tabulated frame
+        Vector3d getPositionAt(const Instant& anInstant) const;
+
+       private:
+        Shared<const Celestial> celestialObjectSPtr_;
+        Interval interval_;
+        Shared<const Frame> frameSPtr_;
+        Real segmentDuration_s_;
+        Array<MatrixXd> coefficients_;
+    };
+
     /// @brief Constructor
     ///
     /// @code{.cpp}
@@ -51,6 +130,26 @@ class ThirdBodyGravity : public Dynamics
     /// @param aName A name
     ThirdBodyGravity(const Shared<const Celestial>& aCelestial, const String& aName);
 
+    /// @brief Constructor with ephemeris table
+    ///
+    /// Within the tabulated interval and frame, the celestial object position is obtained from the table and its
+    /// gravity is evaluated as that of a point mass. Elsewhere, the celestial object is used directly.
+    ///
+    /// @code{.cpp}
+    ///                  const aCelestial = { ... };
+    ///                  const anEphemerisTableSPtr = { ... };
+    ///                  ThirdBodyGravity thirdBodyGravity = { aCelestial, anEphemerisTableSPtr };
+    /// @endcode
+    ///
+    /// @param aCelestial A celestial object
+    /// @param anEphemerisTableSPtr An ephemeris table of the celestial object
+    /// @param aName A name
+    ThirdBodyGravity(
+        const Shared<const Celestial>& aCelestial,
+        const Shared<const EphemerisTable>& anEphemerisTableSPtr,
+        const String& aName = String::Empty()
+    );
+
     /// @brief Destructor
     virtual ~ThirdBodyGravity() override;
 
@@ -71,6 +170,11 @@ class ThirdBodyGravity : public Dynamics
     /// @return A celestial object
     Shared<const Celestial> getCelestial() const;
 
+    /// @brief Get ephemeris table
+    ///
+    /// @return The ephemeris table (nullptr if there is none)
+    Shared<const EphemerisTable> getEphemerisTable() const;
+
     /// @brief Return the coordinate subsets that the instance reads from
     ///
     /// @return The coordinate subsets that the instance reads from
@@ -94,6 +198,18 @@ class ThirdBodyGravity : public Dynamics
         const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
     ) const override;
 
+    /// @brief Write the contribution to the state derivative into a preallocated vector.
+    ///
+    /// @param anInstant An instant
+    /// @param x The reduced state vector (this vector will follow the structure determined by the
+    /// 'read' coordinate subsets)
+    /// @param aFrameSPtr The frame in which the state vector is expressed
+    /// @param aContribution The reduced derivative state vector, preallocated to the size determined by the 'write'
+    /// coordinate subsets
+    virtual void writeContribution(
+        const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr, VectorXd& aContribution
+    ) const override;
+
     /// @brief Print third body gravity dynamics
     ///
     /// @param anOutputStream An output stream
@@ -102,6 +218,8 @@ class ThirdBodyGravity : public Dynamics
 
    private:
     Shared<const Celestial> celestialObjectSPtr_;
+    Shared<const EphemerisTable> ephemerisTableSPtr_;
+    Real gravitationalParameter_SI_;
 };
 
 }  // namespace dynamics
@@ -95,6 +95,8 @@ class Thruster : public Dynamics
     const String name_;
 
     const Real massFlowRateCache_;
+    const double dryMassCache_;  // [kg]
+    const double thrustCache_;   // [N]
 };
 
 }  // namespace dynamics
@@ -0,0 +1,135 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_EnvironmentView__
+#define __OpenSpaceToolkit_Astrodynamics_EnvironmentView__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Shared;
+using ostk::core::type::String;
+
+using ostk::physics::Environment;
+using ostk::physics::environment::Object;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::time::Instant;
+
+/// @brief Lightweight view of an environment, with its own instant
+///
+/// Copying an environment clones each of its objects, and setting its instant mutates it, so that a shared
+/// environment cannot be queried concurrently at different instants. A view holds the objects of an environment
+/// (and, through them, their ephemerides and gravitational, magnetic and atmospheric models) by shared pointer, and
+/// only owns its instant: views are cheap to copy, and each thread can move its own copy in time without affecting
+/// the others.
+///
+/// Objects are accessed read-only, hence are shared by all views of an environment.
+///
+/// @code{.cpp}
+///              const EnvironmentView environmentView = {Environment::Default()};
+///              executionContext.parallelFor(
+///                  instantCount, [&] () -> std::function<void(const Index&)>
+///                  {
+///                      return [view = environmentView, &instants] (const Index& anIndex) mutable
+///                      {
+///                          view.setInstant(instants[anIndex]) ; ...
+///                      } ;
+///                  }
+///              ) ;
+/// @endcode
+class EnvironmentView
+{
+   public:
+    /// @brief Constructor
+    ///
+    /// @param anEnvironment An environment, whose objects are shared and whose instant is copied
+    EnvironmentView(const Environment& anEnvironment);
+
+    /// @brief Constructor
+    ///
+    /// @param anEnvironment An environment, whose objects are shared
+    /// @param anInstant An instant
+    EnvironmentView(const Environment& anEnvironment, const Instant& anInstant);
+
+    /// @brief Check if view is defined
+    ///
+    /// @return True if view is defined
+    bool isDefined() const;
+
+    /// @brief Get instant
+    ///
+    /// @return Instant
+    Instant getInstant() const;
+
+    /// @brief Set instant, without affecting other views of the environment
+    ///
+    /// @param anInstant An instant
+    void setInstant(const Instant& anInstant);
+
+    /// @brief Access objects
+    ///
+    /// @return Reference to objects
+    const Array<Shared<const Object>>& accessObjects() const;
+
+    /// @brief Get object names
+    ///
+    /// @return Object names
+    Array<String> getObjectNames() const;
+
+    /// @brief Check if view has object with a given name
+    ///
+    /// @param aName An object name
+    /// @return True if view has object with given name
+    bool hasObjectWithName(const String& aName) const;
+
+    /// @brief Access object with a given name
+    ///
+    /// @param aName An object name
+    /// @return Shared pointer to object
+    Shared<const Object> accessObjectWithName(const String& aName) const;
+
+    /// @brief Access celestial object with a given name
+    ///
+    /// @param aName A celestial object name
+    /// @return Shared pointer to celestial object
+    Shared<const Celestial> accessCelestialObjectWithName(const String& aName) const;
+
+    /// @brief Check if a geometry intersects any object of the view, at the view instant
+    ///
+    /// @param aGeometry A geometry
+    /// @param anObjectToIgnoreArray An array of objects to ignore
+    /// @return True if geometry intersects an object
+    bool intersects(
+        const Object::Geometry& aGeometry,
+        const Array<Shared<const Object>>& anObjectToIgnoreArray = Array<Shared<const Object>>::Empty()
+    ) const;
+
+    /// @brief Constructs an undefined view
+    ///
+    /// @return Undefined view
+    static EnvironmentView Undefined();
+
+   private:
+    // Immutable, hence shared by all views of an environment
+    Shared<const Array<Shared<const Object>>> objectsSPtr_;
+
+    Instant instant_;
+
+    EnvironmentView(const Shared<const Array<Shared<const Object>>>& anObjectArraySPtr, const Instant& anInstant);
+};
+
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
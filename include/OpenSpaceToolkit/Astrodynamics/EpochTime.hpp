@@ -0,0 +1,66 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_EpochTime__
+#define __OpenSpaceToolkit_Astrodynamics_EpochTime__
+
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+
+/// @brief Time expressed as double precision seconds relative to an epoch
+///
+/// Integration and root finding loops (numerical solvers, temporal condition solvers) work on plain doubles, and only
+/// need instants at their boundaries, when states are built or conditions evaluated. Loops hold a single epoch time,
+/// keep their times as seconds from its epoch, and convert between seconds and instants through it, rather than
+/// carrying durations around.
+///
+/// @code{.cpp}
+///              const EpochTime epochTime = {aState.accessInstant()};
+///              const Instant instant = epochTime.getInstantAt(60.0);  // 1 minute after the epoch
+///              const double time = epochTime.getTimeAt(instant);  // 60.0
+/// @endcode
+class EpochTime
+{
+   public:
+    /// @brief Constructor
+    ///
+    /// @param anEpoch An epoch
+    EpochTime(const Instant& anEpoch);
+
+    /// @brief Check if the epoch time is defined
+    ///
+    /// @return True if the epoch time is defined
+    bool isDefined() const;
+
+    /// @brief Access the epoch
+    ///
+    /// @return Epoch
+    const Instant& accessEpoch() const;
+
+    /// @brief Get the instant at a time relative to the epoch
+    ///
+    /// @param aTime A time [s since epoch]
+    /// @return Instant
+    Instant getInstantAt(const double& aTime) const;
+
+    /// @brief Get the time of an instant relative to the epoch
+    ///
+    /// @param anInstant An instant
+    /// @return Time [s since epoch]
+    double getTimeAt(const Instant& anInstant) const;
+
+   private:
+    Instant epoch_;
+};
+
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
@@ -3,9 +3,14 @@
 #ifndef __OpenSpaceToolkit_Astrodynamics_EventCondition__
 #define __OpenSpaceToolkit_Astrodynamics_EventCondition__
 
+#include <mutex>
+
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 #include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
 #include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
 
@@ -16,9 +21,12 @@ namespace ostk
 namespace astrodynamics
 {
 
+using ostk::core::type::Index;
 using ostk::core::type::Real;
+using ostk::core::type::Shared;
 using ostk::core::type::String;
 
+using ostk::physics::time::Instant;
 using ostk::physics::unit::Angle;
 using ostk::physics::unit::Length;
 
@@ -77,6 +85,13 @@ class EventCondition
     /// @param aTargetValue A target value associated with the Real Event Condition
     EventCondition(const String& aName, const std::function<Real(const State&)>& anEvaluator, const Real& aTargetValue);
 
+    /// @brief Copy constructor
+    ///
+    /// The copy holds its own evaluation cache.
+    ///
+    /// @param anEventCondition An Event Condition
+    EventCondition(const EventCondition& anEventCondition);
+
     /// @brief Virtual destructor
     virtual ~EventCondition();
 
@@ -111,6 +126,22 @@ class EventCondition
     /// @param aState A state to calculate the relative target from
     virtual void updateTarget(const State& aState);
 
+    /// @brief Clone the Event Condition
+    ///
+    /// Clones hold their own targets, hence can be updated independently (e.g. by concurrent sequence solves). The
+    /// default implementation throws, Event Conditions defined in C++ override it.
+    ///
+    /// @return A shared clone of the Event Condition
+    virtual Shared<EventCondition> clone() const;
+
+    /// @brief Get the target instant, for an Event Condition that only depends on time
+    ///
+    /// Time based Event Conditions are met when crossing their target instant, which lets numerical solvers
+    /// integrate to it directly rather than checking the Event Condition at every step.
+    ///
+    /// @return Target instant, undefined if the Event Condition does not only depend on time
+    virtual Instant getTargetInstant() const;
+
     /// @brief Print the Event Condition
     ///
     /// @param [in, out] anOutputStream The output stream where the Event Condition will be printed
@@ -131,6 +162,21 @@ class EventCondition
     String name_;
     std::function<Real(const State&)> evaluator_;
     Target target_;
+
+    /// @brief Evaluate a state, reusing the value of either of the last two evaluated states
+    ///
+    /// The previous state of a step is the current state of the step before, hence evaluating the previous state
+    /// first lets it hit the cache. The evaluator is assumed to only depend on the state.
+    ///
+    /// @param aState A state
+    /// @return Evaluator value
+    Real evaluateWithCache(const State& aState) const;
+
+   private:
+    mutable State cachedStates_[2] = {State::Undefined(), State::Undefined()};
+    mutable Real cachedValues_[2] = {Real::Undefined(), Real::Undefined()};
+    mutable Index mostRecentCacheIndex_ = 0;
+    Shared<std::mutex> cacheMutexSPtr_ = std::make_shared<std::mutex>();
 };
 
 }  // namespace astrodynamics
@@ -77,6 +77,11 @@ class AngularCondition : public EventCondition
     /// @brief Virtual destructor
     virtual ~AngularCondition();
 
+    /// @brief Clone the Angular Condition
+    ///
+    /// @return A shared clone
+    virtual Shared<EventCondition> clone() const override;
+
     /// @brief Get the criterion of the Event Condition
     ///
     /// @return Enum representing the criterion of the Event Condition
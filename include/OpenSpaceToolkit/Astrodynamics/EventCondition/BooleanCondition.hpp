@@ -46,6 +46,11 @@ class BooleanCondition : public RealCondition
     /// @brief Virtual destructor
     virtual ~BooleanCondition();
 
+    /// @brief Clone the Boolean Condition
+    ///
+    /// @return A shared clone
+    virtual Shared<EventCondition> clone() const override;
+
     /// @brief Check if the condition is inversed
     ///
     /// @return Boolean value indicating whether the condition is inversed
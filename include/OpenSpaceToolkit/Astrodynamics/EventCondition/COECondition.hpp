@@ -27,6 +27,8 @@ using ostk::core::type::Shared;
 using ostk::core::type::String;
 
 using ostk::mathematics::object::Vector3d;
+using ostk::mathematics::object::Vector6d;
+using ostk::mathematics::object::VectorXd;
 
 using ostk::physics::coordinate::Frame;
 using ostk::physics::unit::Angle;
@@ -165,6 +167,19 @@ class COECondition
     static std::function<Real(const State&)> GenerateEvaluator(
         const COE::Element& anElement, const Shared<const Frame>& aFrameSPtr, const Derived& aGravitationalParameter
     );
+
+    /// @brief Calculate the SI COE vector of a state, through a per-thread cache
+    ///
+    /// The conditions of a same (logical) condition tree evaluate the same current and previous states, hence share
+    /// the frame conversion and the COE computation.
+    ///
+    /// @param aState A state
+    /// @param aFrameSPtr A frame in which the elements are computed
+    /// @param aGravitationalParameter_SI A gravitational parameter [m^3/s^2]
+    /// @return COE vector (see COE::CartesianToSIVector)
+    static Vector6d CalculateCOEVector(
+        const State& aState, const Shared<const Frame>& aFrameSPtr, const Real& aGravitationalParameter_SI
+    );
 };
 
 }  // namespace eventcondition
@@ -35,6 +35,11 @@ class InstantCondition : public RealCondition
     /// @brief Virtual destructor
     virtual ~InstantCondition();
 
+    /// @brief Clone the Instant Condition
+    ///
+    /// @return A shared clone
+    virtual Shared<EventCondition> clone() const override;
+
     /// @brief Get instant
     ///
     /// @return Instant
@@ -3,8 +3,12 @@
 #ifndef __OpenSpaceToolkit_Astrodynamics_EventCondition_LogicalCondition__
 #define __OpenSpaceToolkit_Astrodynamics_EventCondition_LogicalCondition__
 
+#include <mutex>
+#include <vector>
+
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/EventCondition.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
@@ -18,6 +22,7 @@ namespace eventcondition
 
 using ostk::core::container::Array;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 
 using ostk::astrodynamics::EventCondition;
 using ostk::astrodynamics::trajectory::State;
@@ -53,6 +58,11 @@ class LogicalCondition : public EventCondition
     /// @brief Destructor.
     ~LogicalCondition();
 
+    /// @brief Clone the Logical Condition, along with its Event Conditions.
+    ///
+    /// @return A shared clone.
+    virtual Shared<EventCondition> clone() const override;
+
     /// @brief Get the type of the logical connective.
     ///
     /// @return The type.
@@ -70,6 +80,22 @@ class LogicalCondition : public EventCondition
     ///                  representing the individual event conditions.
     Array<Shared<EventCondition>> getEventConditions() const;
 
+    /// @brief Check if the Logical Connective Event Condition is compiled.
+    ///
+    /// @return True if the Logical Connective Event Condition is compiled.
+    bool isCompiled() const;
+
+    /// @brief Compile the Logical Connective Event Condition into a single fused evaluator.
+    ///
+    /// Nested Logical Conditions of the same type are flattened, Event Conditions appearing several times are
+    /// evaluated once, and nested Logical Conditions of the other type are compiled in turn. The first evaluations
+    /// measure the cost of each Event Condition and how often it decides the outcome, after which the Event Conditions
+    /// are evaluated in order of increasing cost per decision, short-circuiting the remaining ones.
+    ///
+    /// Compilation does not change the outcome of the evaluations, nor the Event Conditions returned by
+    /// getEventConditions.
+    void compile();
+
     /// @brief Check if the Logical Connective Event Condition is satisfied.
     ///
     /// @param currentState A state.
@@ -94,6 +120,19 @@ class LogicalCondition : public EventCondition
     Array<Shared<EventCondition>> eventConditions_;
     evaluationSignature evaluator_;
 
+    bool isCompiled_;
+    mutable Array<Shared<EventCondition>> compiledEventConditions_;
+    mutable std::vector<double> evaluationDurations_;
+    mutable std::vector<Size> decisionCounts_;
+    mutable Size profiledEvaluationCount_;
+    Shared<std::mutex> compilationMutexSPtr_;
+
+    void collectCompiledEventConditions(const Array<Shared<EventCondition>>& anEventConditionArray);
+
+    bool isCompiledSatisfied(const State& currentState, const State& previousState) const;
+
+    bool profileCompiledSatisfied(const State& currentState, const State& previousState) const;
+
     static evaluationSignature GenerateEvaluator(const Type& aType);
 };
 
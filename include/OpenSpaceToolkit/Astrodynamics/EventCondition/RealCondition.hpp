@@ -77,11 +77,21 @@ class RealCondition : public EventCondition
     /// @brief Virtual destructor
     virtual ~RealCondition();
 
+    /// @brief Clone the Real Condition
+    ///
+    /// @return A shared clone
+    virtual Shared<EventCondition> clone() const override;
+
     /// @brief Get the criterion of the Event Condition
     ///
     /// @return Enum representing the criterion of the Event Condition
     Criterion getCriterion() const;
 
+    /// @brief Get the target instant, for a time based condition (e.g. a Duration or Instant based condition)
+    ///
+    /// @return Target instant, undefined if the condition is not time based
+    virtual Instant getTargetInstant() const override;
+
     /// @brief Print the Event Condition
     ///
     /// @param [in, out] anOutputStream The output stream where the Event Condition will be printed
@@ -120,6 +130,10 @@ class RealCondition : public EventCondition
     /// @return A Duration based condition
     static RealCondition DurationCondition(const Criterion& aCriterion, const Duration& aDuration);
 
+   protected:
+    // True if the evaluator returns the number of seconds elapsed since J2000
+    bool isTimeBased_;
+
    private:
     Criterion criterion_;
     std::function<bool(const Real&, const Real&)> comparator_;
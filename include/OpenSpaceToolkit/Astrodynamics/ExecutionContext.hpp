@@ -0,0 +1,127 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_ExecutionContext__
+#define __OpenSpaceToolkit_Astrodynamics_ExecutionContext__
+
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+/// @brief Execution context of the parallel operations of the library
+///
+/// Runs independent tasks, identified by their index, on a bounded number of worker threads. Workers claim tasks
+/// dynamically (in increasing index order) as they complete their previous ones, so that uneven tasks are balanced
+/// without any static partition. Results are collected by index, hence do not depend on the thread count nor on the
+/// scheduling.
+///
+/// Failures are deterministic as well: once a task throws, tasks of greater index are skipped, tasks of lower index
+/// still complete, and the exception of the failed task of lowest index is rethrown.
+///
+/// Parallel operations started from a worker (e.g. a batch propagation within an access computation) run serially on
+/// that worker, so that nested operations never exceed the thread count of the outermost one.
+///
+/// A thread count of 0 resolves to the process-wide default thread count, which is the hardware concurrency unless set
+/// otherwise (e.g. to cap the threads of the library within a process pool). Library operations taking a thread count
+/// of 0 resolve it the same way.
+///
+/// @code{.cpp}
+///              const ExecutionContext executionContext = { 4 } ;
+///              const Array<State> states = executionContext.map<State>(
+///                  stateCount, [&] (const Index& anIndex) { return propagator.calculateStateAt(...) ; }
+///              ) ;
+/// @endcode
+class ExecutionContext
+{
+   public:
+    /// @brief Constructor
+    ///
+    /// @param aThreadCount A maximum worker thread count (0 defaults to the process-wide default thread count)
+    ExecutionContext(const Size& aThreadCount = 0);
+
+    /// @brief Get the maximum worker thread count, with 0 resolved to the process-wide default
+    ///
+    /// @return Thread count
+    Size getThreadCount() const;
+
+    /// @brief Run a task for each index in [0, aTaskCount)
+    ///
+    /// @param aTaskCount A task count
+    /// @param aTask A task, called with the task index
+    void parallelFor(const Size& aTaskCount, const std::function<void(const Index&)>& aTask) const;
+
+    /// @brief Run a task for each index in [0, aTaskCount), with per-worker state
+    ///
+    /// The factory is called once on each worker, before its first task, and returns the task run by that worker.
+    /// This lets workers own scratch objects (e.g. a copy of a propagator) for the duration of the operation.
+    ///
+    /// @param aTaskCount A task count
+    /// @param aTaskFactory A task factory
+    void parallelFor(
+        const Size& aTaskCount, const std::function<std::function<void(const Index&)>()>& aTaskFactory
+    ) const;
+
+    /// @brief Map the indices in [0, aTaskCount) to results, collected in index order
+    ///
+    /// @param aTaskCount A task count
+    /// @param aTask A task, called with the task index
+    /// @return Results, in index order
+    template <typename T>
+    Array<T> map(const Size& aTaskCount, const std::function<T(const Index&)>& aTask) const
+    {
+        std::vector<std::optional<T>> results(aTaskCount);
+
+        this->parallelFor(
+            aTaskCount,
+            [&results, &aTask](const Index& anIndex) -> void
+            {
+                results[anIndex].emplace(aTask(anIndex));
+            }
+        );
+
+        Array<T> values = Array<T>::Empty();
+        values.reserve(aTaskCount);
+
+        for (std::optional<T>& result : results)
+        {
+            values.add(std::move(*result));
+        }
+
+        return values;
+    }
+
+    /// @brief Check if the calling thread is a worker of a running parallel operation
+    ///
+    /// @return True if the calling thread is a worker
+    static bool IsWorkerThread();
+
+    /// @brief Get the process-wide default thread count
+    ///
+    /// @return Default thread count
+    static Size GetDefaultThreadCount();
+
+    /// @brief Set the process-wide default thread count
+    ///
+    /// @param aThreadCount A thread count (0 resets the default to the hardware concurrency)
+    static void SetDefaultThreadCount(const Size& aThreadCount);
+
+   private:
+    Size threadCount_;
+};
+
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
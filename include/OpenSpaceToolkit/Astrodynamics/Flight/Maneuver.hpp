@@ -20,6 +20,8 @@
 #include <OpenSpaceToolkit/Physics/Unit/Mass.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/Tabulated.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/LocalOrbitalFrameFactory.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianVelocity.hpp>
 
@@ -49,6 +51,8 @@ using ostk::physics::time::Interval;
 using ostk::physics::unit::Mass;
 
 using ostk::astrodynamics::dynamics::Tabulated;
+using ostk::astrodynamics::trajectory::LocalOrbitalFrameFactory;
+using ostk::astrodynamics::trajectory::State;
 using ostk::astrodynamics::trajectory::state::CoordinateSubset;
 using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianVelocity;
 
@@ -58,10 +62,16 @@ using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianVelocit
 class Maneuver
 {
    public:
-    static const Shared<const Frame> DefaultAccelFrameSPtr;
     static const Duration MinimumRecommendedDuration;
     static const Duration MaximumRecommendedInterpolationInterval;
 
+    /// @brief Default acceleration frame (GCRF)
+    ///
+    /// Constructed on first use.
+    ///
+    /// @return Default acceleration frame
+    static const Shared<const Frame>& DefaultAccelFrame();
+
     /// @brief Constructor
     ///
     /// @code{.cpp}
@@ -127,7 +137,7 @@ class Maneuver
     /// @param (optional) aFrameSPtr A frame in which the acceleration profile is to be defined
     ///
     /// @return The acceleration profile (m/s^2)
-    Array<Vector3d> getAccelerationProfile(const Shared<const Frame>& aFrameSPtr = DefaultAccelFrameSPtr) const;
+    Array<Vector3d> getAccelerationProfile(const Shared<const Frame>& aFrameSPtr = DefaultAccelFrame()) const;
 
     /// @brief Get the mass flow rate profile of the maneuver
     ///
@@ -147,6 +157,24 @@ class Maneuver
     /// @return The interval
     Interval getInterval() const;
 
+    /// @brief Get the acceleration profile expressed in a local orbital frame
+    ///
+    /// The rotation matrices of the local orbital frame are generated for all the states at once.
+    ///
+    /// @code{.cpp}
+    ///                  Array<Vector3d> accelerationProfile = maneuver.getAccelerationProfileInLocalOrbitalFrame(
+    ///                      LocalOrbitalFrameFactory::VNC(Frame::GCRF()), states
+    ///                  );
+    /// @endcode
+    ///
+    /// @param aLocalOrbitalFrameFactorySPtr A local orbital frame factory
+    /// @param aStateArray An array of states, one per maneuver instant
+    ///
+    /// @return The acceleration profile, one Vector3d per instant in m/s^2
+    Array<Vector3d> getAccelerationProfileInLocalOrbitalFrame(
+        const Shared<const LocalOrbitalFrameFactory>& aLocalOrbitalFrameFactorySPtr, const Array<State>& aStateArray
+    ) const;
+
     /// @brief Calculate the deltaV magnitude imparted during the maneuver
     ///
     /// @code{.cpp}
@@ -200,7 +228,7 @@ class Maneuver
     ///
     /// @return A shared pointer to the Tabulated Dynamics object
     Shared<Tabulated> toTabulatedDynamics(
-        const Shared<const Frame>& aFrameSPtr = DefaultAccelFrameSPtr,
+        const Shared<const Frame>& aFrameSPtr = DefaultAccelFrame(),
         const Interpolator::Type& anInterpolationType = DEFAULT_MANEUVER_INTERPOLATION_TYPE
     ) const;
 
@@ -241,6 +269,29 @@ class Maneuver
         const Real& aMassFlowRate
     );
 
+    /// @brief Create a maneuver from an acceleration profile expressed in a local orbital frame
+    ///
+    /// The local orbital frame is defined by the states, one per maneuver instant, and all its rotation matrices are
+    /// generated at once.
+    ///
+    /// @code{.cpp}
+    ///                  Maneuver maneuver = Maneuver::LocalOrbitalFrameAccelerationProfile(...);
+    /// @endcode
+    ///
+    /// @param aStateArray An array of states, must be sorted
+    /// @param anAccelerationProfile An acceleration profile of the maneuver, one Vector3d per state in m/s^2
+    /// @param aLocalOrbitalFrameFactorySPtr A local orbital frame factory, in which the acceleration profile is defined
+    /// @param aMassFlowRateProfile A mass flow rate profile of the maneuver (negative numbers expected), one Real per
+    /// state in kg/s
+    ///
+    /// @return A maneuver
+    static Maneuver LocalOrbitalFrameAccelerationProfile(
+        const Array<State>& aStateArray,
+        const Array<Vector3d>& anAccelerationProfile,
+        const Shared<const LocalOrbitalFrameFactory>& aLocalOrbitalFrameFactorySPtr,
+        const Array<Real>& aMassFlowRateProfile
+    );
+
    private:
     Array<Instant> instants_;
     Array<Vector3d> accelerationProfileDefaultFrame_;
@@ -137,6 +137,22 @@ class Profile
     /// @return Shared pointer to body frame
     Shared<const Frame> getBodyFrame(const String& aFrameName) const;
 
+    /// @brief Get a flight profile whose transforms are tabulated on a grid of instants
+    ///
+    /// The transforms of transform provided profiles are evaluated once at each instant of the grid, and served
+    /// from that table to subsequent queries at these instants, including through body frames. Other instants are
+    /// evaluated as before. Profiles that are already tabulated are returned as is.
+    ///
+    /// @code{.cpp}
+    ///              Profile profile = { ... } ;
+    ///              Array<Instant> instants = { ... } ;
+    ///              Profile tabulatedProfile = profile.tabulate(instants) ;
+    /// @endcode
+    ///
+    /// @param anInstantArray An array of instants
+    /// @return Flight profile
+    Profile tabulate(const Array<Instant>& anInstantArray) const;
+
     /// @brief Print flight profile to output stream
     ///
     /// @code{.cpp}
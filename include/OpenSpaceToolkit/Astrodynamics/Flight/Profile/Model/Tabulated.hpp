@@ -8,6 +8,8 @@
 #include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
 #include <OpenSpaceToolkit/Core/Type/Index.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
 
@@ -31,6 +33,8 @@ using ostk::core::filesystem::File;
 using ostk::core::type::Index;
 using ostk::core::type::String;
 
+using ostk::mathematics::object::MatrixXd;
+
 using ostk::physics::coordinate::Axes;
 using ostk::physics::coordinate::Frame;
 using ostk::physics::time::Instant;
@@ -59,6 +63,15 @@ class Tabulated : public virtual Model
 
     virtual State calculateStateAt(const Instant& anInstant) const override;
 
+    /// @brief Calculate the states at multiple instants
+    ///
+    /// The tabulated interval containing each instant is searched starting from the interval of the previous
+    /// instant, so that sorted instants are served in constant time per instant.
+    ///
+    /// @param anInstantArray An array of instants
+    /// @return An array of states
+    virtual Array<State> calculateStatesAt(const Array<Instant>& anInstantArray) const override;
+
     virtual Axes getAxesAt(const Instant& anInstant) const override;
 
     virtual Shared<const Frame> getBodyFrame(const String& aFrameName) const override;
@@ -74,11 +87,13 @@ class Tabulated : public virtual Model
 
    private:
     Array<State> states_;
+    Array<Instant> instants_;
+    MatrixXd coordinates_;  // Position, velocity, attitude quaternion (XYZS) and angular velocity, one column per state
     mutable Index stateIndex_;
 
-    Pair<const State*, const State*> accessStateRangeAt(const Instant& anInstant) const;
+    Index locateStateIndex(const Instant& anInstant, const Index& aStateIndexHint) const;
 
-    Pair<const State*, const State*> accessStateRangeAtIndex(const Index& anIndex) const;
+    State interpolateStateAt(const Instant& anInstant, Index& aStateIndex) const;
 };
 
 }  // namespace model
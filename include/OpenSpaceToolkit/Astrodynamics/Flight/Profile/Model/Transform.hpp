@@ -62,6 +62,15 @@ class Transform : public virtual Model
 
     virtual void print(std::ostream& anOutputStream, bool displayDecorator = true) const override;
 
+    /// @brief Tabulate the transforms on a grid of instants
+    ///
+    /// The transforms are evaluated once at each instant of the grid. Subsequent queries at these instants, including
+    /// through body frames, are served from the table, while other instants are forwarded to the transform provider.
+    ///
+    /// @param anInstantArray An array of instants
+    /// @return Transform model backed by the table
+    Transform tabulate(const Array<Instant>& anInstantArray) const;
+
     static Transform Undefined();
 
     /// @brief Constructs a flight profile with inertial pointing
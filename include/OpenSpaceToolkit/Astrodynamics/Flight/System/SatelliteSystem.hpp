@@ -3,7 +3,11 @@
 #ifndef __OpenSpaceToolkit_Astrodynamics_Flight_System_SatelliteSystem__
 #define __OpenSpaceToolkit_Astrodynamics_Flight_System_SatelliteSystem__
 
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Composite.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Cuboid.hpp>
@@ -24,7 +28,11 @@ namespace flight
 namespace system
 {
 
+using ostk::core::container::Array;
+using ostk::core::type::Index;
 using ostk::core::type::Real;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
 
 using ostk::mathematics::geometry::d3::object::Composite;
 using ostk::mathematics::geometry::d3::object::Cuboid;
@@ -42,6 +50,64 @@ using ostk::astrodynamics::flight::system::PropulsionSystem;
 class SatelliteSystem : public System
 {
    public:
+    /// @brief Projected surface area of a satellite geometry, tabulated over the sphere of view directions
+    /// expressed in the satellite body frame, and interpolated bilinearly in azimuth and elevation afterwards
+    ///
+    /// The geometry is made of cuboids. The projected area of each cuboid is exact, and the areas of the cuboids
+    /// are summed: overlaps and self-shadowing between cuboids are not accounted for. The interpolation error grows
+    /// with the angular grid step, and is largest where a face becomes edge-on.
+    class ProjectedAreaTable
+    {
+       public:
+        /// @brief Constructor
+        ///
+        /// @code{.cpp}
+        ///                  Composite geometry ( ... ) ;
+        ///                  SatelliteSystem::ProjectedAreaTable projectedAreaTable = { geometry } ;
+        /// @endcode
+        ///
+        /// @param aGeometry A geometry, made of cuboids (points are allowed, and have no area)
+        /// @param anAzimuthCount (optional) A number of azimuth grid points, over a full turn
+        /// @param anElevationCount (optional) A number of elevation grid points, from the -Z axis to the +Z axis
+        ProjectedAreaTable(
+            const Composite& aGeometry, const Size& anAzimuthCount = 72, const Size& anElevationCount = 37
+        );
+
+        /// @brief Get azimuth count
+        ///
+        /// @return The number of azimuth grid points
+        Size getAzimuthCount() const;
+
+        /// @brief Get elevation count
+        ///
+        /// @return The number of elevation grid points
+        Size getElevationCount() const;
+
+        /// @brief Get the interpolated projected area along a view direction
+        ///
+        /// @param aDirection_B A view direction, expressed in the satellite body frame (not necessarily normalized)
+        /// @return The projected area [m^2]
+        Real getProjectedAreaAt(const Vector3d& aDirection_B) const;
+
+        /// @brief Check if a geometry is supported by projected area tables
+        ///
+        /// @param aGeometry A geometry
+        /// @return True if the geometry is defined, and made of cuboids and points only
+        static bool IsSupported(const Composite& aGeometry);
+
+        /// @brief Compute the projected area of a geometry along a view direction
+        ///
+        /// @param aGeometry A geometry, made of cuboids and points only
+        /// @param aDirection_B A unit view direction, expressed in the satellite body frame
+        /// @return The projected area [m^2]
+        static Real ComputeProjectedArea(const Composite& aGeometry, const Vector3d& aDirection_B);
+
+       private:
+        Size azimuthCount_;
+        Size elevationCount_;
+        Array<double> projectedAreas_;
+    };
+
     /// @brief Constructor
     ///
     /// @code{.cpp}
@@ -147,6 +213,18 @@ class SatelliteSystem : public System
     /// @return PropulsionSystem
     PropulsionSystem getPropulsionSystem() const;
 
+    /// @brief Get satellite system's projected area table
+    ///
+    /// The table is built once, along with the satellite system, and shared by its copies.
+    ///
+    /// @code{.cpp}
+    ///                  Shared<const SatelliteSystem::ProjectedAreaTable> projectedAreaTableSPtr =
+    ///                      satelliteSystem.getProjectedAreaTable() ;
+    /// @endcode
+    ///
+    /// @return The projected area table (nullptr if the geometry is not supported)
+    Shared<const ProjectedAreaTable> getProjectedAreaTable() const;
+
     /// @brief Print satellite system
     ///
     /// @param anOutputStream An output stream
@@ -176,6 +254,7 @@ class SatelliteSystem : public System
     Real crossSectionalSurfaceArea_;
     Real dragCoefficient_;
     PropulsionSystem propulsionSystem_;
+    Shared<const ProjectedAreaTable> projectedAreaTableSPtr_;
 };
 
 }  // namespace system
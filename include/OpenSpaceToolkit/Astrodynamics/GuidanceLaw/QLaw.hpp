@@ -10,10 +10,15 @@
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 #include <OpenSpaceToolkit/Physics/Unit/Derived.hpp>
 
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/EventCondition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/ExecutionContext.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/System/SatelliteSystem.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/GuidanceLaw.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Solver/FiniteDifferenceSolver.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler/COE.hpp>
-#include <OpenSpaceToolkit/Astrodynamics/Trajectory/StateBuilder.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/NumericalSolver.hpp>
 
 namespace ostk
 {
@@ -44,10 +49,15 @@ using ostk::physics::time::Instant;
 using ostk::physics::unit::Derived;
 using ostk::physics::unit::Length;
 
+using ostk::astrodynamics::Dynamics;
+using ostk::astrodynamics::EventCondition;
+using ostk::astrodynamics::ExecutionContext;
+using ostk::astrodynamics::flight::system::SatelliteSystem;
 using ostk::astrodynamics::GuidanceLaw;
 using ostk::astrodynamics::solver::FiniteDifferenceSolver;
 using ostk::astrodynamics::trajectory::orbit::model::kepler::COE;
-using ostk::astrodynamics::trajectory::StateBuilder;
+using ostk::astrodynamics::trajectory::State;
+using ostk::astrodynamics::trajectory::state::NumericalSolver;
 
 /// @brief    The Q-law is a Lyapunov feedback control law developed by Petropoulos,
 ///    based on analytic expressions for maximum rates of change of the orbit elements and
@@ -106,7 +116,16 @@ class QLaw : public GuidanceLaw
     enum class GradientStrategy
     {
         Analytical,
-        FiniteDifference
+        FiniteDifference,
+        AutomaticDifferentiation
+    };
+
+    /// @brief Outcome of the propagation of one parameterization of a sweep
+    struct SweepResult
+    {
+        bool conditionIsSatisfied;  // True if the event condition is satisfied.
+        Duration timeOfFlight;      // Propagation duration.
+        Real deltaV;                // Delta V [m/s].
     };
 
     /// @brief Constructor
@@ -116,11 +135,20 @@ class QLaw : public GuidanceLaw
     /// @param aParameterSet A set of parameters for the QLaw.
     /// @param aGradientStrategy The strategy to compute the gradient of the QLaw. Defaults to
     /// FiniteDifference
+    /// @param aDirectionUpdateInterval (optional) The duration the thrust direction is held for, in the theta-R-H
+    /// frame, before being recomputed. Defaults to zero (recomputed at every call).
+    /// @param aDirectionUpdateThreshold (optional) The change in orbital elements beyond which the held thrust
+    /// direction is recomputed, as the largest of the relative semi-major axis change, the eccentricity change and the
+    /// angle changes [rad]. Defaults to undefined, in which case a held direction is recomputed beyond a change of
+    /// 1e-3. Held directions are kept per thread, and only reused for the elements they were computed at, so that a
+    /// guidance law can be shared across propagations.
     QLaw(
         const COE& aCOE,
         const Derived& aGravitationalParameter,
         const Parameters& aParameterSet,
-        const GradientStrategy& aGradientStrategy = GradientStrategy::FiniteDifference
+        const GradientStrategy& aGradientStrategy = GradientStrategy::FiniteDifference,
+        const Duration& aDirectionUpdateInterval = Duration::Zero(),
+        const Real& aDirectionUpdateThreshold = Real::Undefined()
     );
 
     /// @brief Destructor
@@ -152,6 +180,16 @@ class QLaw : public GuidanceLaw
     /// @return Gradient Strategy
     GradientStrategy getGradientStrategy() const;
 
+    /// @brief Get thrust direction update interval
+    ///
+    /// @return Thrust direction update interval
+    Duration getDirectionUpdateInterval() const;
+
+    /// @brief Get thrust direction update threshold
+    ///
+    /// @return Thrust direction update threshold
+    Real getDirectionUpdateThreshold() const;
+
     /// @brief Print guidance law
     ///
     /// @param anOutputStream An output stream
@@ -224,22 +262,135 @@ class QLaw : public GuidanceLaw
     /// @return The coordinates in the GCRF frame
     static Matrix3d ThetaRHToGCRF(const Vector3d& aPositionCoordinates, const Vector3d& aVelocityCoordinates);
 
+    /// @brief Propagate a set of parameterizations of the QLaw from the same initial state, in parallel
+    ///
+    /// Each parameterization drives a maneuvering segment, solved until the event condition is satisfied or the
+    /// maximum propagation duration is reached. The dynamics, and the environment and gravity data they hold, are
+    /// shared read-only between the workers, while each run uses its own clone of the event condition.
+    ///
+    /// @code{.cpp}
+    ///              Array<QLaw::SweepResult> results = QLaw::Sweep(
+    ///                  targetCOE, gravitationalParameter, parametersArray, state, satelliteSystem,
+    ///                  eventConditionSPtr, dynamicsArray, numericalSolver
+    ///              );
+    /// @endcode
+    ///
+    /// @param aCOE A target orbit described by Classical Orbital Elements
+    /// @param aGravitationalParameter The gravitational parameter of the central body
+    /// @param aParametersArray An array of parameters, one per run
+    /// @param aState An initial state, holding the mass of the spacecraft
+    /// @param aSatelliteSystem A satellite system, providing the propulsion system
+    /// @param anEventConditionSPtr An event condition ending each run
+    /// @param aDynamicsArray An array of dynamics, excluding the thruster
+    /// @param aNumericalSolver A numerical solver
+    /// @param aMaximumPropagationDuration (optional) A maximum propagation duration per run. Defaults to 30 days
+    /// @param aGradientStrategy (optional) The strategy to compute the gradient of the QLaw. Defaults to
+    /// FiniteDifference
+    /// @param aThreadCount (optional) A worker thread count (0 defaults to the default thread count of
+    /// ExecutionContext)
+    /// @return Array of sweep results, in the order of the parameters
+    static Array<SweepResult> Sweep(
+        const COE& aCOE,
+        const Derived& aGravitationalParameter,
+        const Array<Parameters>& aParametersArray,
+        const State& aState,
+        const SatelliteSystem& aSatelliteSystem,
+        const Shared<EventCondition>& anEventConditionSPtr,
+        const Array<Shared<Dynamics>>& aDynamicsArray,
+        const NumericalSolver& aNumericalSolver,
+        const Duration& aMaximumPropagationDuration = Duration::Days(30.0),
+        const GradientStrategy& aGradientStrategy = GradientStrategy::FiniteDifference,
+        const Size& aThreadCount = 0
+    );
+
+    /// @brief Propagate a set of parameterizations of the QLaw from the same initial state, within an execution
+    /// context
+    ///
+    /// @param aCOE A target orbit described by Classical Orbital Elements
+    /// @param aGravitationalParameter The gravitational parameter of the central body
+    /// @param aParametersArray An array of parameters, one per run
+    /// @param aState An initial state, holding the mass of the spacecraft
+    /// @param aSatelliteSystem A satellite system, providing the propulsion system
+    /// @param anEventConditionSPtr An event condition ending each run
+    /// @param aDynamicsArray An array of dynamics, excluding the thruster
+    /// @param aNumericalSolver A numerical solver
+    /// @param aMaximumPropagationDuration A maximum propagation duration per run
+    /// @param aGradientStrategy The strategy to compute the gradient of the QLaw
+    /// @param anExecutionContext An execution context
+    /// @return Array of sweep results, in the order of the parameters
+    static Array<SweepResult> Sweep(
+        const COE& aCOE,
+        const Derived& aGravitationalParameter,
+        const Array<Parameters>& aParametersArray,
+        const State& aState,
+        const SatelliteSystem& aSatelliteSystem,
+        const Shared<EventCondition>& anEventConditionSPtr,
+        const Array<Shared<Dynamics>>& aDynamicsArray,
+        const NumericalSolver& aNumericalSolver,
+        const Duration& aMaximumPropagationDuration,
+        const GradientStrategy& aGradientStrategy,
+        const ExecutionContext& anExecutionContext
+    );
+
    private:
     const Parameters parameters_;
     const double mu_;
     const Vector6d targetCOEVector_;
     const Derived gravitationalParameter_;
+    const double gravitationalParameter_SI_;
     const GradientStrategy gradientStrategy_;
     const FiniteDifferenceSolver finiteDifferenceSolver_;
-    const StateBuilder stateBuilder_;
+    const Duration directionUpdateInterval_;
+    const Real directionUpdateThreshold_;
+
+    const Size heldDirectionKey_;
 
     const VectorXd trueAnomalyAngles_ = VectorXd::LinSpaced(50, 0.0, 2.0 * M_PI);
 
     Vector5d computeDeltaCOE(const Vector5d& aCOEVector) const;
 
+    /// @brief Scalar-generic versions of the Q computation, instantiated on double and on dual numbers
+    template <typename Scalar>
+    Eigen::Matrix<Scalar, 5, 1> evaluateDeltaCOE(const Eigen::Matrix<Scalar, 5, 1>& aCOEVector) const;
+
+    template <typename Scalar>
+    Eigen::Matrix<Scalar, 5, 1> evaluateOrbitalElementsMaximalChange(
+        const Eigen::Matrix<Scalar, 5, 1>& aCOEVector, const double& aThrustAcceleration
+    ) const;
+
+    template <typename Scalar>
+    Scalar evaluateQ(const Eigen::Matrix<Scalar, 5, 1>& aCOEVector, const double& aThrustAcceleration) const;
+
+    struct HeldDirection
+    {
+        Size key;
+        Instant instant;
+        Vector5d coeVector;
+        Vector3d direction;
+    };
+
+    HeldDirection& accessHeldDirection() const;
+
+    bool isHeldDirectionValidAt(
+        const HeldDirection& aHeldDirection, const Instant& anInstant, const Vector5d& aCOEVector
+    ) const;
+
     Vector5d computeAnalytical_dQ_dOE(const Vector5d& aCOEVector, const double& aThrustAcceleration) const;
+
+    /// @brief Compute the derivative of Q with respect to the orbital elements, by finite differences
+    ///
+    /// The scheme and relative step of the finite difference solver are applied on fixed-size vectors, calling
+    /// `computeQ` directly, so that the gradient costs only the Q evaluations, without building states.
     Vector5d computeNumerical_dQ_dOE(const Vector5d& aCOEVector, const double& aThrustAcceleration) const;
 
+    /// @brief Compute the derivative of Q with respect to the orbital elements, by forward-mode automatic
+    /// differentiation
+    ///
+    /// Q is evaluated once on dual numbers seeded along each element, yielding the gradient to machine precision.
+    Vector5d computeAutomaticDifferentiation_dQ_dOE(
+        const Vector5d& aCOEVector, const double& aThrustAcceleration
+    ) const;
+
     /// @brief Compute the effectivity of the guidance law
     ///
     /// @ref
@@ -0,0 +1,105 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_ModelCache__
+#define __OpenSpaceToolkit_Astrodynamics_ModelCache__
+
+#include <OpenSpaceToolkit/Core/Type/Integer.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Magnetic/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+
+using ostk::core::type::Integer;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::physics::environment::object::Celestial;
+using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
+using EarthMagneticModel = ostk::physics::environment::magnetic::Earth;
+using EarthAtmosphericModel = ostk::physics::environment::atmospheric::Earth;
+
+/// @brief Process-wide cache of environment models
+///
+/// Constructing an Earth gravitational model (e.g. EGM2008) or atmospheric model (e.g. NRLMSISE00) loads and parses
+/// coefficient and space weather files, which dominates the set up of a propagation. Models are constructed once per
+/// type (and degree and order for gravitational models), then shared: cached models are handed out as shared pointers,
+/// and remain valid after the cache is cleared.
+///
+/// Accesses are thread-safe. Concurrent accesses to a model being constructed wait for its construction, so that each
+/// model is loaded once. Models are read-only once constructed, hence can be evaluated concurrently.
+///
+/// @code{.cpp}
+///              const Array<Shared<Object>> objects = {
+///                  ModelCache::AccessEarth(EarthGravitationalModel::Type::EGM2008, 70, 70)
+///              };
+///              const Environment environment = {Instant::J2000(), objects};
+///              const Propagator propagator = Propagator::FromEnvironment(aNumericalSolver, environment);
+/// @endcode
+class ModelCache
+{
+   public:
+    ModelCache() = delete;
+
+    /// @brief Access an Earth gravitational model
+    ///
+    /// @param aType A gravitational model type
+    /// @param aDegree A maximum degree (undefined for the model maximum)
+    /// @param anOrder A maximum order (undefined for the model maximum)
+    /// @return Shared gravitational model
+    static Shared<EarthGravitationalModel> AccessEarthGravitationalModel(
+        const EarthGravitationalModel::Type& aType,
+        const Integer& aDegree = Integer::Undefined(),
+        const Integer& anOrder = Integer::Undefined()
+    );
+
+    /// @brief Access an Earth magnetic model
+    ///
+    /// @param aType A magnetic model type
+    /// @return Shared magnetic model
+    static Shared<EarthMagneticModel> AccessEarthMagneticModel(const EarthMagneticModel::Type& aType);
+
+    /// @brief Access an Earth atmospheric model
+    ///
+    /// @param aType An atmospheric model type
+    /// @return Shared atmospheric model
+    static Shared<EarthAtmosphericModel> AccessEarthAtmosphericModel(const EarthAtmosphericModel::Type& aType);
+
+    /// @brief Access an Earth celestial object, built from cached models
+    ///
+    /// @param aGravitationalModelType A gravitational model type
+    /// @param aGravitationalModelDegree A maximum degree (undefined for the model maximum)
+    /// @param aGravitationalModelOrder A maximum order (undefined for the model maximum)
+    /// @param aMagneticModelType A magnetic model type
+    /// @param anAtmosphericModelType An atmospheric model type
+    /// @return Shared Earth celestial object, not to be modified
+    static Shared<Celestial> AccessEarth(
+        const EarthGravitationalModel::Type& aGravitationalModelType,
+        const Integer& aGravitationalModelDegree = Integer::Undefined(),
+        const Integer& aGravitationalModelOrder = Integer::Undefined(),
+        const EarthMagneticModel::Type& aMagneticModelType = EarthMagneticModel::Type::Undefined,
+        const EarthAtmosphericModel::Type& anAtmosphericModelType = EarthAtmosphericModel::Type::Undefined
+    );
+
+    /// @brief Get the number of cached models and celestial objects
+    ///
+    /// @return Cached entry count
+    static Size GetSize();
+
+    /// @brief Clear the cache
+    ///
+    /// Models handed out beforehand remain valid, and are released with their last user.
+    static void Clear();
+};
+
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
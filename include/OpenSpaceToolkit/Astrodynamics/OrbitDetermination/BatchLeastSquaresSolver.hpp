@@ -0,0 +1,131 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_OrbitDetermination_BatchLeastSquaresSolver__
+#define __OpenSpaceToolkit_Astrodynamics_OrbitDetermination_BatchLeastSquaresSolver__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/ExecutionContext.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/OrbitDetermination/Measurement.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace orbitdetermination
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::VectorXd;
+
+using ostk::astrodynamics::ExecutionContext;
+using ostk::astrodynamics::orbitdetermination::Measurement;
+using ostk::astrodynamics::trajectory::Propagator;
+using ostk::astrodynamics::trajectory::State;
+
+/// @brief Batch least squares orbit determination
+///
+/// Estimates the position and velocity of an object at an epoch from tracking measurements, with Gauss-Newton
+/// iterations on the normal equations. Each iteration takes a single propagation, integrating the variational
+/// equations alongside the state over all the measurement instants (see
+/// Propagator::calculateStatesAndStateTransitionMatricesAt). Measurement residuals and partials are then evaluated
+/// concurrently, and accumulated in measurement order.
+///
+/// Iterations stop once the weighted root mean square of the residuals changes by less than the relative tolerance
+/// between two iterations.
+class BatchLeastSquaresSolver
+{
+   public:
+    /// @brief Outcome of an orbit determination
+    struct Analysis
+    {
+        State estimatedState;       ///< Estimated state at the epoch of the initial guess, in GCRF
+        MatrixXd covariance;        ///< Formal covariance of the estimated position and velocity (6 x 6), in GCRF
+        Size iterationCount;        ///< Number of iterations (propagations)
+        bool hasConverged;          ///< True if the tolerance was met within the maximum iteration count
+        Real rmsWeightedResidual;   ///< Root mean square of the residuals, weighted by the standard deviations
+        Array<VectorXd> residuals;  ///< Residuals of the measurements at the estimated state, in measurement order
+    };
+
+    /// @brief Constructor
+    ///
+    /// @code{.cpp}
+    ///              BatchLeastSquaresSolver solver = { propagator } ;
+    /// @endcode
+    ///
+    /// @param aPropagator A propagator, modeling the dynamics of the object
+    /// @param (optional) aMaximumIterationCount A maximum iteration count
+    /// @param (optional) aRelativeTolerance A relative tolerance on the weighted root mean square of the residuals
+    BatchLeastSquaresSolver(
+        const Propagator& aPropagator, const Size& aMaximumIterationCount = 20, const Real& aRelativeTolerance = 1e-6
+    );
+
+    /// @brief Output stream operator
+    ///
+    /// @param anOutputStream An output stream
+    /// @param aSolver A batch least squares solver
+    /// @return A reference to output stream
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const BatchLeastSquaresSolver& aSolver);
+
+    /// @brief Access propagator
+    ///
+    /// @return Propagator
+    const Propagator& accessPropagator() const;
+
+    /// @brief Get maximum iteration count
+    ///
+    /// @return Maximum iteration count
+    Size getMaximumIterationCount() const;
+
+    /// @brief Get relative tolerance
+    ///
+    /// @return Relative tolerance
+    Real getRelativeTolerance() const;
+
+    /// @brief Estimate the state of an object from measurements
+    ///
+    /// Only the position and velocity are estimated: other coordinates of the initial guess (e.g. mass) are kept.
+    /// Measurements may be given in any order, and on both sides of the epoch.
+    ///
+    /// @code{.cpp}
+    ///              BatchLeastSquaresSolver::Analysis analysis = solver.solve(initialGuessState, measurements) ;
+    /// @endcode
+    ///
+    /// @param anInitialGuessState An initial guess of the state, at the estimation epoch
+    /// @param aMeasurementArray An array of measurements
+    /// @param (optional) anExecutionContext An execution context, for the evaluation of the measurements
+    /// @return Analysis
+    Analysis solve(
+        const State& anInitialGuessState,
+        const Array<Measurement>& aMeasurementArray,
+        const ExecutionContext& anExecutionContext = ExecutionContext()
+    ) const;
+
+    /// @brief Print solver
+    ///
+    /// @param anOutputStream An output stream
+    /// @param (optional) displayDecorators If true, display decorators
+    void print(std::ostream& anOutputStream, bool displayDecorator = true) const;
+
+   private:
+    Propagator propagator_;
+    Size maximumIterationCount_;
+    Real relativeTolerance_;
+};
+
+}  // namespace orbitdetermination
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
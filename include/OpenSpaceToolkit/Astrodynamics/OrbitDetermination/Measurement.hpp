@@ -0,0 +1,241 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_OrbitDetermination_Measurement__
+#define __OpenSpaceToolkit_Astrodynamics_OrbitDetermination_Measurement__
+
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Angle.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace orbitdetermination
+{
+
+using ostk::core::type::Real;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+using ostk::core::type::String;
+
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::VectorXd;
+
+using ostk::physics::time::Instant;
+using ostk::physics::unit::Angle;
+using ostk::physics::unit::Length;
+
+using ostk::astrodynamics::Trajectory;
+using ostk::astrodynamics::trajectory::State;
+
+/// @brief Tracking measurement of an object from a station
+///
+/// Measurements are modeled geometrically in GCRF, from the state of the object and the state of the station at the
+/// measurement instant (light time and atmospheric delays are not modeled):
+/// - Range [m]: distance from the station to the object
+/// - RangeRate [m/s]: rate of change of the range
+/// - Angles [rad]: topocentric right ascension and declination of the object, as seen from the station
+///
+/// Stations are trajectories, typically fixed ground positions (see Trajectory::Position), queried at the
+/// measurement instant. Station trajectories must be safe to query concurrently when measurements are processed in
+/// parallel.
+class Measurement
+{
+   public:
+    enum class Type
+    {
+        Undefined,  ///< Undefined
+        Range,      ///< Range [m]
+        RangeRate,  ///< Range rate [m/s]
+        Angles      ///< Topocentric right ascension and declination [rad]
+    };
+
+    /// @brief Constructor
+    ///
+    /// @code{.cpp}
+    ///              Measurement measurement = { instant, Measurement::Type::Range, value, standardDeviation,
+    ///              stationTrajectorySPtr } ;
+    /// @endcode
+    ///
+    /// @param anInstant An instant
+    /// @param aType A measurement type
+    /// @param aValue A measured value (of size 1, or 2 for angles)
+    /// @param aStandardDeviation A standard deviation of the measurement noise, per component
+    /// @param aStationTrajectorySPtr A shared pointer to the trajectory of the station
+    Measurement(
+        const Instant& anInstant,
+        const Type& aType,
+        const VectorXd& aValue,
+        const VectorXd& aStandardDeviation,
+        const Shared<const Trajectory>& aStationTrajectorySPtr
+    );
+
+    /// @brief Equal to operator
+    ///
+    /// @param aMeasurement A measurement
+    /// @return True if measurements are equal
+    bool operator==(const Measurement& aMeasurement) const;
+
+    /// @brief Not equal to operator
+    ///
+    /// @param aMeasurement A measurement
+    /// @return True if measurements are not equal
+    bool operator!=(const Measurement& aMeasurement) const;
+
+    /// @brief Output stream operator
+    ///
+    /// @param anOutputStream An output stream
+    /// @param aMeasurement A measurement
+    /// @return A reference to output stream
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const Measurement& aMeasurement);
+
+    /// @brief Check if measurement is defined
+    ///
+    /// @return True if measurement is defined
+    bool isDefined() const;
+
+    /// @brief Access instant
+    ///
+    /// @return Instant
+    const Instant& accessInstant() const;
+
+    /// @brief Get type
+    ///
+    /// @return Type
+    Type getType() const;
+
+    /// @brief Get measured value
+    ///
+    /// @return Value
+    VectorXd getValue() const;
+
+    /// @brief Get standard deviation
+    ///
+    /// @return Standard deviation, per component
+    VectorXd getStandardDeviation() const;
+
+    /// @brief Get station trajectory
+    ///
+    /// @return Shared pointer to the trajectory of the station
+    Shared<const Trajectory> getStationTrajectory() const;
+
+    /// @brief Get size (number of components)
+    ///
+    /// @return Size
+    Size getSize() const;
+
+    /// @brief Calculate the modeled value of the measurement, for a state of the object
+    ///
+    /// @param aState A state of the object, at the measurement instant
+    /// @return Modeled value
+    VectorXd calculateValue(const State& aState) const;
+
+    /// @brief Calculate the residual (measured minus modeled value), for a state of the object
+    ///
+    /// Right ascension residuals are wrapped to [-pi, pi].
+    ///
+    /// @param aState A state of the object, at the measurement instant
+    /// @return Residual
+    VectorXd calculateResidual(const State& aState) const;
+
+    /// @brief Calculate the partial derivatives of the modeled value, with respect to the position and velocity of
+    /// the object in GCRF
+    ///
+    /// @param aState A state of the object, at the measurement instant
+    /// @return Partial derivatives (size x 6)
+    MatrixXd calculatePartials(const State& aState) const;
+
+    /// @brief Print measurement
+    ///
+    /// @param anOutputStream An output stream
+    /// @param (optional) displayDecorators If true, display decorators
+    void print(std::ostream& anOutputStream, bool displayDecorator = true) const;
+
+    /// @brief Constructs an undefined measurement
+    ///
+    /// @return Undefined measurement
+    static Measurement Undefined();
+
+    /// @brief Constructs a range measurement
+    ///
+    /// @param anInstant An instant
+    /// @param aRange A range
+    /// @param aStandardDeviation A standard deviation
+    /// @param aStationTrajectorySPtr A shared pointer to the trajectory of the station
+    /// @return Range measurement
+    static Measurement Range(
+        const Instant& anInstant,
+        const Length& aRange,
+        const Length& aStandardDeviation,
+        const Shared<const Trajectory>& aStationTrajectorySPtr
+    );
+
+    /// @brief Constructs a range rate measurement
+    ///
+    /// @param anInstant An instant
+    /// @param aRangeRate A range rate [m/s]
+    /// @param aStandardDeviation A standard deviation [m/s]
+    /// @param aStationTrajectorySPtr A shared pointer to the trajectory of the station
+    /// @return Range rate measurement
+    static Measurement RangeRate(
+        const Instant& anInstant,
+        const Real& aRangeRate,
+        const Real& aStandardDeviation,
+        const Shared<const Trajectory>& aStationTrajectorySPtr
+    );
+
+    /// @brief Constructs an angles measurement
+    ///
+    /// @param anInstant An instant
+    /// @param aRightAscension A topocentric right ascension
+    /// @param aDeclination A topocentric declination
+    /// @param aStandardDeviation A standard deviation, for both angles
+    /// @param aStationTrajectorySPtr A shared pointer to the trajectory of the station
+    /// @return Angles measurement
+    static Measurement Angles(
+        const Instant& anInstant,
+        const Angle& aRightAscension,
+        const Angle& aDeclination,
+        const Angle& aStandardDeviation,
+        const Shared<const Trajectory>& aStationTrajectorySPtr
+    );
+
+    /// @brief Convert type to string
+    ///
+    /// @param aType A type
+    /// @return String
+    static String StringFromType(const Type& aType);
+
+    /// @brief Get the size of a measurement type
+    ///
+    /// @param aType A type
+    /// @return Size
+    static Size SizeFromType(const Type& aType);
+
+   private:
+    Instant instant_;
+    Type type_;
+    VectorXd value_;
+    VectorXd standardDeviation_;
+    Shared<const Trajectory> stationTrajectorySPtr_;
+
+    VectorXd calculateRelativeState(const State& aState) const;
+};
+
+}  // namespace orbitdetermination
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
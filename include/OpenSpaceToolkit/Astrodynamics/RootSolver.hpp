@@ -92,6 +92,42 @@ class RootSolver
         const std::function<double(const double&)>& aFunction, const double& aLowerBound, const double& anUpperBound
     ) const;
 
+    /// @brief ITP (Interpolate, Truncate and Project) solve for root given a function, and bounds
+    ///
+    /// Bracketing method which takes regula falsi steps, truncated and projected so as to never take more iterations
+    /// than bisection (plus one), while converging superlinearly on smooth functions. It is a drop-in replacement for
+    /// bisection on continuous functions.
+    ///
+    /// @ref https://doi.org/10.1145/3423597
+    ///
+    /// @param aFunction A function
+    /// @param aLowerBound A lower bound
+    /// @param anUpperBound An upper bound
+    ///
+    /// @return The solution
+    Solution itp(
+        const std::function<double(const double&)>& aFunction, const double& aLowerBound, const double& anUpperBound
+    ) const;
+
+    /// @brief Newton solve for root given a function, its derivative, and bounds
+    ///
+    /// Newton steps are safeguarded by the bracket: a bisection step is taken instead whenever the Newton step would
+    /// leave the bracket or would not halve it fast enough, so that the solve converges quadratically near the root
+    /// and never diverges.
+    ///
+    /// @param aFunction A function
+    /// @param aDerivative The derivative of the function
+    /// @param aLowerBound A lower bound
+    /// @param anUpperBound An upper bound
+    ///
+    /// @return The solution
+    Solution newton(
+        const std::function<double(const double&)>& aFunction,
+        const std::function<double(const double&)>& aDerivative,
+        const double& aLowerBound,
+        const double& anUpperBound
+    ) const;
+
     /// @brief Print root solver
     ///
     /// @param anOutputStream An output stream
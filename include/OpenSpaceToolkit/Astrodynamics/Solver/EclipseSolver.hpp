@@ -0,0 +1,190 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Solvers_EclipseSolver__
+#define __OpenSpaceToolkit_Astrodynamics_Solvers_EclipseSolver__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/EventCondition/RealCondition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace solver
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Real;
+using ostk::core::type::Shared;
+using ostk::core::type::String;
+
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+
+using ostk::astrodynamics::eventcondition::RealCondition;
+using ostk::astrodynamics::Trajectory;
+using ostk::astrodynamics::trajectory::State;
+
+/// @brief Eclipse solver, computing the intervals a trajectory spends in the shadow of an occulting body
+///
+/// The shadow is modeled by conic umbra and penumbra cones, from the apparent radii of the Sun and of the (spherical)
+/// occulting body seen from the satellite, and the apparent angle between their centers. These define continuous
+/// shadow functions (angular margins to the umbra and penumbra boundaries), which drive the adaptive time steps of the
+/// temporal condition solver and the refinement of entry and exit instants.
+///
+/// The Sun and occulting body positions are tabulated once per computation over the analysis interval, and linearly
+/// interpolated.
+///
+/// @code{.cpp}
+///              EclipseSolver eclipseSolver = { sunSPtr, earthSPtr } ;
+///              Array<Interval> umbraIntervals =
+///                  eclipseSolver.computeIntervals(trajectory, interval, EclipseSolver::Region::Umbra) ;
+/// @endcode
+class EclipseSolver
+{
+   public:
+    enum class Region
+    {
+        Sunlight,  ///< Fully illuminated
+        Penumbra,  ///< Partially illuminated (including annular eclipses)
+        Umbra,     ///< Not illuminated
+        Shadow     ///< Penumbra or umbra
+    };
+
+    /// @brief Constructor
+    ///
+    /// @param aSunSPtr A Sun
+    /// @param anOccultingCelestialSPtr An occulting celestial body (e.g., the Earth)
+    /// @param aTimeStep A minimum time step, used near region boundaries
+    /// @param aTolerance A temporal tolerance on region entry and exit instants
+    /// @param aMaximumTimeStep A maximum time step
+    EclipseSolver(
+        const Shared<const Celestial>& aSunSPtr,
+        const Shared<const Celestial>& anOccultingCelestialSPtr,
+        const Duration& aTimeStep = Duration::Seconds(30.0),
+        const Duration& aTolerance = Duration::Milliseconds(1.0),
+        const Duration& aMaximumTimeStep = Duration::Minutes(10.0)
+    );
+
+    /// @brief Check if eclipse solver is defined
+    ///
+    /// @return True if eclipse solver is defined
+    bool isDefined() const;
+
+    /// @brief Get time step
+    ///
+    /// @return Time step
+    Duration getTimeStep() const;
+
+    /// @brief Get tolerance
+    ///
+    /// @return Tolerance
+    Duration getTolerance() const;
+
+    /// @brief Get maximum time step
+    ///
+    /// @return Maximum time step
+    Duration getMaximumTimeStep() const;
+
+    /// @brief Compute the illumination fraction of a satellite (1.0 in sunlight, 0.0 in umbra)
+    ///
+    /// @param anInstant An instant
+    /// @param aPositionCoordinates Satellite position coordinates, in GCRF [m]
+    /// @return Illumination fraction
+    Real computeIlluminationFraction(const Instant& anInstant, const Vector3d& aPositionCoordinates) const;
+
+    /// @brief Compute the intervals a trajectory spends in a given region
+    ///
+    /// @param aTrajectory A trajectory
+    /// @param anInterval An analysis interval
+    /// @param aRegion A region
+    /// @return Intervals, in chronological order
+    Array<Interval> computeIntervals(
+        const Trajectory& aTrajectory, const Interval& anInterval, const Region& aRegion
+    ) const;
+
+    /// @brief Generate an event condition on a region, for the propagation of a segment
+    ///
+    /// The condition evaluates the shadow function of the region, positive inside the region: a positive crossing
+    /// criterion triggers on region entry, and a negative crossing criterion on region exit.
+    ///
+    /// @param aRegion A region
+    /// @param aCriterion A criterion
+    /// @return Event condition
+    RealCondition generateEventCondition(const Region& aRegion, const RealCondition::Criterion& aCriterion) const;
+
+    /// @brief Constructs an undefined eclipse solver
+    ///
+    /// @return Undefined eclipse solver
+    static EclipseSolver Undefined();
+
+    /// @brief Convert region to string
+    ///
+    /// @param aRegion A region
+    /// @return String
+    static String StringFromRegion(const Region& aRegion);
+
+    /// @brief Compute the shadow function of a region, positive inside the region
+    ///
+    /// @param aRegion A region
+    /// @param aPositionCoordinates Satellite position coordinates [m]
+    /// @param aSunPositionCoordinates Sun position coordinates [m]
+    /// @param anOccultingPositionCoordinates Occulting body position coordinates [m]
+    /// @param aSunRadius Sun radius [m]
+    /// @param anOccultingRadius Occulting body radius [m]
+    /// @return Angular margin to the region boundary [rad]
+    static double ComputeShadowFunction(
+        const Region& aRegion,
+        const Vector3d& aPositionCoordinates,
+        const Vector3d& aSunPositionCoordinates,
+        const Vector3d& anOccultingPositionCoordinates,
+        const double& aSunRadius,
+        const double& anOccultingRadius
+    );
+
+    /// @brief Compute the illumination fraction from the conic shadow geometry
+    ///
+    /// @param aPositionCoordinates Satellite position coordinates [m]
+    /// @param aSunPositionCoordinates Sun position coordinates [m]
+    /// @param anOccultingPositionCoordinates Occulting body position coordinates [m]
+    /// @param aSunRadius Sun radius [m]
+    /// @param anOccultingRadius Occulting body radius [m]
+    /// @return Illumination fraction
+    static double ComputeIlluminationFraction(
+        const Vector3d& aPositionCoordinates,
+        const Vector3d& aSunPositionCoordinates,
+        const Vector3d& anOccultingPositionCoordinates,
+        const double& aSunRadius,
+        const double& anOccultingRadius
+    );
+
+   private:
+    Shared<const Celestial> sunSPtr_;
+    Shared<const Celestial> occultingCelestialSPtr_;
+    Duration timeStep_;
+    Duration tolerance_;
+    Duration maximumTimeStep_;
+};
+
+}  // namespace solver
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
@@ -85,35 +85,46 @@ class FiniteDifferenceSolver
 
     /// @brief Compute the Jacobian by perturbing the coordinates
     ///
+    /// The unperturbed coordinates are generated once, and the perturbed ones are generated concurrently,
+    /// hence `generateStateCoordinates` must be safe to call from several threads at once.
+    ///
     /// @param aState A state.
     /// @param anInstantArray An array of instants.
     /// @param generateStateCoordinates Callable to generate coordinates of States at the
     /// requested Instants.
     /// @param aCoordinatesDimension The dimension of the coordinates produced by
     /// `generateStateCoordinates`.
+    /// @param aThreadCount (optional) A worker thread count (0 defaults to the default thread count of
+    /// ExecutionContext).
     ///
     /// @return The Jacobian
     MatrixXd computeJacobian(
         const State& aState,
         const Array<Instant>& anInstantArray,
         const std::function<MatrixXd(const State&, const Array<Instant>&)>& generateStateCoordinates,
-        const Size& aCoordinatesDimension
+        const Size& aCoordinatesDimension,
+        const Size& aThreadCount = 0
     ) const;
 
     /// @brief Compute the Jacobian by perturbing the coordinates
     ///
+    /// See the overload over an array of instants for the threading requirements on `generateStateCoordinates`.
+    ///
     /// @param aState A state.
     /// @param anInstant An instant.
     /// @param generateStateCoordinates Callable to generate coordinates of a State at the
     /// requested Instant.
     /// @param aCoordinatesDimension The dimension of the coordinates produced by
     /// `generateStateCoordinates`.
+    /// @param aThreadCount (optional) A worker thread count (0 defaults to the default thread count of
+    /// ExecutionContext).
     /// @return The Jacobian
     MatrixXd computeJacobian(
         const State& aState,
         const Instant& anInstant,
         const std::function<VectorXd(const State&, const Instant&)>& generateStateCoordinates,
-        const Size& aCoordinatesDimension
+        const Size& aCoordinatesDimension,
+        const Size& aThreadCount = 0
     ) const;
 
     /// @brief Compute the gradient.
@@ -0,0 +1,253 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Solvers_LambertSolver__
+#define __OpenSpaceToolkit_Astrodynamics_Solvers_LambertSolver__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Derived.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/ExecutionContext.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler/COE.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace solver
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Real;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::unit::Derived;
+
+using ostk::astrodynamics::ExecutionContext;
+using ostk::astrodynamics::Trajectory;
+using ostk::astrodynamics::trajectory::Orbit;
+using ostk::astrodynamics::trajectory::orbit::model::kepler::COE;
+using ostk::astrodynamics::trajectory::State;
+
+/// @brief Lambert solver, finding the Keplerian arcs joining two positions in a given time of flight
+///
+/// Implements the algorithm of Izzo (Revisiting Lambert's problem, 2015): the time of flight equation is solved with
+/// Householder iterations on a single universal variable, for the direct transfer and for both branches of each
+/// feasible multi-revolution transfer. Transfers are prograde (or retrograde) with respect to the Z axis of the frame.
+///
+/// Transfer grids (e.g. departure instant by time of flight porkchop plots) are solved cell by cell on an execution
+/// context, and only hold velocities, delta-V and orbital elements: Orbit objects are built on request.
+class LambertSolver
+{
+   public:
+    /// @brief Solution of Lambert's problem
+    struct Solution
+    {
+        Size revolutionCount;        ///< Number of complete revolutions
+        Vector3d departureVelocity;  ///< Velocity at departure [m/s]
+        Vector3d arrivalVelocity;    ///< Velocity at arrival [m/s]
+    };
+
+    /// @brief Transfer between two states, along the Lambert arc of lowest total delta-V
+    struct Transfer
+    {
+        Size revolutionCount;          ///< Number of complete revolutions
+        State departureState;          ///< State on the transfer arc at departure, in GCRF
+        State arrivalState;            ///< State on the transfer arc at arrival, in GCRF
+        Real departureDeltaV;          ///< Delta-V at departure [m/s]
+        Real arrivalDeltaV;            ///< Delta-V at arrival [m/s]
+        COE classicalOrbitalElements;  ///< Classical orbital elements of the transfer arc at departure
+
+        /// @brief Check if transfer is defined
+        ///
+        /// @return True if transfer is defined
+        bool isDefined() const;
+
+        /// @brief Get total delta-V
+        ///
+        /// @return Total delta-V [m/s]
+        Real getTotalDeltaV() const;
+
+        /// @brief Constructs an undefined transfer, for cells without solution
+        ///
+        /// @return Undefined transfer
+        static Transfer Undefined();
+    };
+
+    /// @brief Transfers over a grid of departure instants and times of flight
+    struct TransferGrid
+    {
+        Array<Instant> departureInstants;  ///< Departure instants, one per row
+        Array<Duration> timesOfFlight;     ///< Times of flight, one per column
+        Array<Transfer> transfers;         ///< Transfers, in row-major order
+
+        /// @brief Access the transfer of a cell
+        ///
+        /// @param aDepartureIndex A departure instant index
+        /// @param aTimeOfFlightIndex A time of flight index
+        /// @return Transfer
+        const Transfer& accessTransferAt(const Index& aDepartureIndex, const Index& aTimeOfFlightIndex) const;
+
+        /// @brief Get the departure delta-V of each cell (NaN for cells without solution)
+        ///
+        /// @return Departure delta-V matrix [m/s]
+        MatrixXd getDepartureDeltaVs() const;
+
+        /// @brief Get the arrival delta-V of each cell (NaN for cells without solution)
+        ///
+        /// @return Arrival delta-V matrix [m/s]
+        MatrixXd getArrivalDeltaVs() const;
+
+        /// @brief Get the total delta-V of each cell (NaN for cells without solution)
+        ///
+        /// @return Total delta-V matrix [m/s]
+        MatrixXd getTotalDeltaVs() const;
+    };
+
+    /// @brief Constructor
+    ///
+    /// @code{.cpp}
+    ///              LambertSolver lambertSolver = { gravitationalParameter, 2 } ;
+    /// @endcode
+    ///
+    /// @param aGravitationalParameter A gravitational parameter
+    /// @param (optional) aMaximumRevolutionCount A maximum number of complete revolutions
+    /// @param (optional) isPrograde True for prograde transfers, false for retrograde ones
+    /// @param (optional) aMaximumIterationCount A maximum number of iterations
+    /// @param (optional) aTolerance A tolerance on the universal variable
+    LambertSolver(
+        const Derived& aGravitationalParameter,
+        const Size& aMaximumRevolutionCount = 0,
+        const bool& isPrograde = true,
+        const Size& aMaximumIterationCount = 35,
+        const Real& aTolerance = 1e-11
+    );
+
+    /// @brief Output stream operator
+    ///
+    /// @param anOutputStream An output stream
+    /// @param aLambertSolver A Lambert solver
+    /// @return A reference to output stream
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const LambertSolver& aLambertSolver);
+
+    /// @brief Get gravitational parameter
+    ///
+    /// @return Gravitational parameter
+    Derived getGravitationalParameter() const;
+
+    /// @brief Get maximum revolution count
+    ///
+    /// @return Maximum revolution count
+    Size getMaximumRevolutionCount() const;
+
+    /// @brief Check if transfers are prograde
+    ///
+    /// @return True if transfers are prograde
+    bool isPrograde() const;
+
+    /// @brief Get maximum iteration count
+    ///
+    /// @return Maximum iteration count
+    Size getMaximumIterationCount() const;
+
+    /// @brief Get tolerance
+    ///
+    /// @return Tolerance
+    Real getTolerance() const;
+
+    /// @brief Solve Lambert's problem
+    ///
+    /// Solutions are sorted by revolution count: the direct transfer first, then both branches of each feasible
+    /// multi-revolution transfer. Degenerate geometries (collinear positions) have no solution.
+    ///
+    /// @code{.cpp}
+    ///              Array<LambertSolver::Solution> solutions = lambertSolver.solve(r1, r2, Duration::Hours(2.0)) ;
+    /// @endcode
+    ///
+    /// @param aDeparturePosition A departure position [m]
+    /// @param anArrivalPosition An arrival position [m], in the same inertial frame
+    /// @param aTimeOfFlight A time of flight
+    /// @return Array of solutions
+    Array<Solution> solve(
+        const Vector3d& aDeparturePosition, const Vector3d& anArrivalPosition, const Duration& aTimeOfFlight
+    ) const;
+
+    /// @brief Compute the transfer of lowest total delta-V between two states
+    ///
+    /// @param aDepartureState A departure state
+    /// @param anArrivalState An arrival state, after the departure state
+    /// @return Transfer (undefined if Lambert's problem has no solution)
+    Transfer computeTransfer(const State& aDepartureState, const State& anArrivalState) const;
+
+    /// @brief Compute the transfers between two trajectories over a grid of departure instants and times of flight
+    ///
+    /// The states of the trajectories are calculated up front, and cells are then solved concurrently.
+    ///
+    /// @code{.cpp}
+    ///              LambertSolver::TransferGrid grid = lambertSolver.computeTransferGrid(
+    ///                  departureTrajectory, arrivalTrajectory, departureInstants, timesOfFlight
+    ///              ) ;
+    ///              MatrixXd totalDeltaVs = grid.getTotalDeltaVs() ;
+    /// @endcode
+    ///
+    /// @param aDepartureTrajectory A departure trajectory
+    /// @param anArrivalTrajectory An arrival trajectory
+    /// @param aDepartureInstantArray An array of departure instants
+    /// @param aTimeOfFlightArray An array of (positive) times of flight
+    /// @param (optional) anExecutionContext An execution context
+    /// @return Transfer grid
+    TransferGrid computeTransferGrid(
+        const Trajectory& aDepartureTrajectory,
+        const Trajectory& anArrivalTrajectory,
+        const Array<Instant>& aDepartureInstantArray,
+        const Array<Duration>& aTimeOfFlightArray,
+        const ExecutionContext& anExecutionContext = ExecutionContext()
+    ) const;
+
+    /// @brief Build the orbit of a transfer, with an unperturbed Kepler model
+    ///
+    /// @param aTransfer A transfer
+    /// @param aCelestialObjectSPtr A shared pointer to the central celestial object
+    /// @return Orbit
+    Orbit computeOrbit(const Transfer& aTransfer, const Shared<const Celestial>& aCelestialObjectSPtr) const;
+
+    /// @brief Print Lambert solver
+    ///
+    /// @param anOutputStream An output stream
+    /// @param (optional) displayDecorators If true, display decorators
+    void print(std::ostream& anOutputStream, bool displayDecorator = true) const;
+
+   private:
+    Derived gravitationalParameter_;
+    Size maximumRevolutionCount_;
+    bool isPrograde_;
+    Size maximumIterationCount_;
+    Real tolerance_;
+};
+
+}  // namespace solver
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
@@ -3,13 +3,25 @@
 #ifndef __OpenSpaceToolkit_Astrodynamics_Solvers_TemporalConditionSolver__
 #define __OpenSpaceToolkit_Astrodynamics_Solvers_TemporalConditionSolver__
 
+#include <atomic>
+#include <cstdint>
+#include <optional>
+
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
 #include <OpenSpaceToolkit/Core/Type/Size.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
 
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
 namespace ostk
 {
 namespace astrodynamics
@@ -18,12 +30,20 @@ namespace solver
 {
 
 using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Shared;
 using ostk::core::type::Size;
 
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::environment::object::Celestial;
 using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 using ostk::physics::time::Interval;
 
+using ostk::astrodynamics::Trajectory;
+using ostk::astrodynamics::trajectory::State;
+
 #define DEFAULT_MAXIMUM_ITERATION_COUNT 500
 
 /// @brief Given a set of conditions and a time interval,
@@ -32,6 +52,68 @@ class TemporalConditionSolver
 {
    public:
     typedef std::function<bool(const Instant&)> Condition;
+    typedef std::function<double(const Instant&)> MarginFunction;
+    typedef std::function<void(const Interval&)> IntervalCallback;
+
+    /// @brief Trajectory states and celestial positions at a given instant, shared by the state conditions evaluated
+    /// at that instant.
+    ///
+    /// Each trajectory state and celestial position is queried on first access only, hence at most once per instant
+    /// regardless of the number of conditions using it.
+    class Snapshot
+    {
+       public:
+        /// @brief Constructor
+        ///
+        /// @param anInstant An instant.
+        /// @param aTrajectoryArray An array of trajectories.
+        /// @param aCelestialArray An array of celestial objects.
+        Snapshot(
+            const Instant& anInstant,
+            const Array<Trajectory>& aTrajectoryArray,
+            const Array<Shared<const Celestial>>& aCelestialArray
+        );
+
+        /// @brief Access the instant.
+        ///
+        /// @return Instant.
+        const Instant& accessInstant() const;
+
+        /// @brief Access the state of a trajectory.
+        ///
+        /// @param aTrajectoryIndex A trajectory index.
+        /// @return State, in the trajectory frame.
+        const State& accessState(const Index& aTrajectoryIndex) const;
+
+        /// @brief Access the position coordinates of a celestial object.
+        ///
+        /// @param aCelestialIndex A celestial object index.
+        /// @return Position coordinates, in GCRF [m].
+        const Vector3d& accessCelestialPositionCoordinates(const Index& aCelestialIndex) const;
+
+       private:
+        Instant instant_;
+        const Array<Trajectory>& trajectories_;
+        const Array<Shared<const Celestial>>& celestialSPtrs_;
+
+        mutable std::vector<std::optional<State>> states_;
+        mutable std::vector<std::optional<Vector3d>> celestialPositionCoordinates_;
+    };
+
+    typedef std::function<bool(const Snapshot&)> StateCondition;
+
+    /// @brief Solver statistics, accumulated over solver calls while enabled.
+    ///
+    /// Condition evaluations include margin evaluations (adaptive solve), and the root solver duration includes the
+    /// condition evaluations performed while refining switching instants.
+    struct Statistics
+    {
+        Size conditionEvaluationCount = 0;
+        Duration conditionEvaluationDuration = Duration::Zero();
+        Size rootSolverCallCount = 0;
+        Size rootSolverIterationCount = 0;
+        Duration rootSolverDuration = Duration::Zero();
+    };
 
     /// @brief Constructor
     ///
@@ -64,6 +146,25 @@ class TemporalConditionSolver
     /// @return Maximum iteration count.
     Size getMaximumIterationCount() const;
 
+    /// @brief Check if statistics are enabled.
+    ///
+    /// @return True if statistics are enabled.
+    bool isStatisticsEnabled() const;
+
+    /// @brief Get the statistics accumulated since statistics were enabled (or last reset).
+    ///
+    /// @return Statistics.
+    Statistics getStatistics() const;
+
+    /// @brief Enable statistics. Copies of this solver share its statistics, and may record them concurrently.
+    void enableStatistics();
+
+    /// @brief Disable statistics.
+    void disableStatistics();
+
+    /// @brief Reset statistics.
+    void resetStatistics();
+
     /// @brief Find the intervals over which the provided condition is true.
     ///
     /// @param aCondition A temporal condition.
@@ -81,11 +182,108 @@ class TemporalConditionSolver
     Array<Interval> solve(const Array<TemporalConditionSolver::Condition>& aConditionArray, const Interval& anInterval)
         const;
 
+    /// @brief Find the intervals over which the provided condition is true, streaming them as they are closed.
+    ///
+    /// @code{.cpp}
+    ///                  temporalConditionSolver.solve(condition, interval, [] (const Interval& anInterval) -> void {
+    ///                  ... }) ;
+    /// @endcode
+    ///
+    /// Instants are generated on the fly, hence the search runs in constant memory.
+    ///
+    /// @param aCondition A temporal condition.
+    /// @param anInterval A time interval within which to perform the search.
+    /// @param anIntervalCallback A callback, invoked for each interval in chronological order.
+    void solve(
+        const TemporalConditionSolver::Condition& aCondition,
+        const Interval& anInterval,
+        const TemporalConditionSolver::IntervalCallback& anIntervalCallback
+    ) const;
+
+    /// @brief Find the intervals over which all provided conditions are true, streaming them as they are closed.
+    ///
+    /// Instants are generated on the fly, hence the search runs in constant memory.
+    ///
+    /// @param aConditionArray An array of temporal conditions.
+    /// @param anInterval A time interval within which to perform the search.
+    /// @param anIntervalCallback A callback, invoked for each interval in chronological order.
+    void solve(
+        const Array<TemporalConditionSolver::Condition>& aConditionArray,
+        const Interval& anInterval,
+        const TemporalConditionSolver::IntervalCallback& anIntervalCallback
+    ) const;
+
+    /// @brief Find the intervals over which all provided state conditions are true.
+    ///
+    /// @code{.cpp}
+    ///                  Array<Interval> intervals = temporalConditionSolver.solve(
+    ///                      { isVisible, isSunlit }, { satelliteTrajectory, stationTrajectory }, { sunSPtr }, interval
+    ///                  ) ;
+    /// @endcode
+    ///
+    /// The conditions evaluated at a given instant share a single snapshot, hence each trajectory and celestial
+    /// object is queried at most once per instant, and not at all past the first unmet condition.
+    ///
+    /// @param aStateConditionArray An array of state conditions.
+    /// @param aTrajectoryArray An array of trajectories, indexed by the snapshot.
+    /// @param aCelestialArray An array of celestial objects, indexed by the snapshot.
+    /// @param anInterval A time interval within which to perform the search.
+    ///
+    /// @return An array of time intervals.
+    Array<Interval> solve(
+        const Array<TemporalConditionSolver::StateCondition>& aStateConditionArray,
+        const Array<Trajectory>& aTrajectoryArray,
+        const Array<Shared<const Celestial>>& aCelestialArray,
+        const Interval& anInterval
+    ) const;
+
+    /// @brief Find the intervals over which the provided margin is positive, using adaptive time steps.
+    ///
+    /// @code{.cpp}
+    ///                  Array<Interval> intervals = temporalConditionSolver.solveAdaptive(
+    ///                      [] (const Instant& anInstant) -> double { return elevation(anInstant) - mask ; },
+    ///                      interval,
+    ///                      Duration::Minutes(10.0)
+    ///                  ) ;
+    /// @endcode
+    ///
+    /// The margin is a continuous function, positive when the condition is met (e.g., elevation minus mask).
+    /// Each step is sized from the current margin and its rate of change estimated over the previous step: large
+    /// steps are taken when the margin is far from zero, and steps shrink down to the solver time step near
+    /// crossings. Switching instants are refined using the margin values.
+    ///
+    /// @param aMarginFunction A margin function.
+    /// @param anInterval A time interval within which to perform the search.
+    /// @param aMaximumTimeStep The largest time step allowed.
+    ///
+    /// @return An array of time intervals.
+    Array<Interval> solveAdaptive(
+        const TemporalConditionSolver::MarginFunction& aMarginFunction,
+        const Interval& anInterval,
+        const Duration& aMaximumTimeStep
+    ) const;
+
    private:
     Duration timeStep_;
     Duration tolerance_;
     Size maximumIterationCount_;
 
+    /// @brief Statistics counters, shared by copies of this solver (e.g. by the workers of a parallel computation)
+    struct StatisticsCounters
+    {
+        std::atomic<Size> conditionEvaluationCount {0};
+        std::atomic<std::int64_t> conditionEvaluationDuration_ns {0};
+        std::atomic<Size> rootSolverCallCount {0};
+        std::atomic<Size> rootSolverIterationCount {0};
+        std::atomic<std::int64_t> rootSolverDuration_ns {0};
+    };
+
+    Shared<StatisticsCounters> statisticsSPtr_;
+
+    bool evaluateConditionAt(
+        const Instant& anInstant, const Array<TemporalConditionSolver::Condition>& aConditionArray
+    ) const;
+
     Instant findSwitchingInstant(
         const Instant& aPreviousInstant,
         const Instant& aNextInstant,
@@ -0,0 +1,136 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Tracer__
+#define __OpenSpaceToolkit_Astrodynamics_Tracer__
+
+#include <chrono>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+
+using ostk::core::container::Array;
+using ostk::core::filesystem::File;
+using ostk::core::type::Size;
+using ostk::core::type::String;
+
+using ostk::physics::time::Duration;
+
+/// @brief Process-wide tracer, recording scoped spans for timeline views of long runs
+///
+/// Tracing is disabled by default, in which case a span costs a single atomic load. While enabled, completed spans
+/// are buffered in memory, up to a maximum event count (further spans are dropped and counted), and can be exported
+/// in the Chrome trace event format, read by chrome://tracing and https://ui.perfetto.dev.
+///
+/// Spans are recorded around sequence and segment solving, numerical integration, root solving, temporal condition
+/// solving and access computation.
+class Tracer
+{
+   public:
+    /// @brief Completed span
+    struct Event
+    {
+        String name;         ///< Span name.
+        String category;     ///< Span category.
+        String detail;       ///< Optional detail (e.g. segment name), empty if none.
+        Duration startTime;  ///< Start time, relative to when tracing was enabled.
+        Duration duration;   ///< Duration.
+        Size threadIndex;    ///< Index of the recording thread, in order of first recorded span.
+    };
+
+    /// @brief Scoped span, recorded on destruction if tracing was enabled on construction
+    ///
+    /// @code{.cpp}
+    ///              {
+    ///                  const Tracer::Span span("Segment::solve", "trajectory", name_);
+    ///                  ...
+    ///              }
+    /// @endcode
+    class Span
+    {
+       public:
+        /// @brief Constructor
+        ///
+        /// @param aName A span name, with static storage duration (e.g. a string literal)
+        /// @param aCategory A span category, with static storage duration (e.g. a string literal)
+        Span(const char* aName, const char* aCategory);
+
+        /// @brief Constructor
+        ///
+        /// @param aName A span name, with static storage duration (e.g. a string literal)
+        /// @param aCategory A span category, with static storage duration (e.g. a string literal)
+        /// @param aDetail A detail, copied only if tracing is enabled
+        Span(const char* aName, const char* aCategory, const String& aDetail);
+
+        Span(const Span&) = delete;
+
+        Span& operator=(const Span&) = delete;
+
+        /// @brief Destructor, recording the span
+        ~Span();
+
+       private:
+        const char* name_;
+        const char* category_;
+        String detail_;
+        bool isActive_;
+        std::chrono::steady_clock::time_point startTime_;
+    };
+
+    Tracer() = delete;
+
+    /// @brief Check if tracing is enabled
+    ///
+    /// @return True if tracing is enabled
+    static bool IsEnabled();
+
+    /// @brief Enable tracing
+    ///
+    /// Event start times are relative to the first enabling since the last clear.
+    ///
+    /// @param aMaximumEventCount A maximum number of buffered events
+    static void Enable(const Size& aMaximumEventCount = 1000000);
+
+    /// @brief Disable tracing, keeping the buffered events
+    static void Disable();
+
+    /// @brief Clear the buffered events and the dropped event count
+    static void Clear();
+
+    /// @brief Get the buffered events, in order of completion
+    ///
+    /// @return Events
+    static Array<Event> GetEvents();
+
+    /// @brief Get the number of spans dropped since the last clear, because the buffer was full
+    ///
+    /// @return Dropped event count
+    static Size GetDroppedEventCount();
+
+    /// @brief Export the buffered events in the Chrome trace event format (JSON)
+    ///
+    /// @return Chrome trace
+    static String ToChromeTrace();
+
+    /// @brief Write the buffered events to a file in the Chrome trace event format (JSON)
+    ///
+    /// @code{.cpp}
+    ///              Tracer::Dump(File::Path(Path::Parse("/path/to/trace.json")));
+    /// @endcode
+    ///
+    /// @param aFile A file
+    static void Dump(const File& aFile);
+};
+
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
@@ -5,6 +5,7 @@
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 #include <OpenSpaceToolkit/Core/Type/Unique.hpp>
 
@@ -12,8 +13,10 @@
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
 
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Ephemeris.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Model.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/StateTable.hpp>
 
 namespace ostk
 {
@@ -22,14 +25,17 @@ namespace astrodynamics
 
 using ostk::core::container::Array;
 using ostk::core::type::Index;
+using ostk::core::type::Shared;
 using ostk::core::type::String;
 using ostk::core::type::Unique;
 
 using ostk::physics::time::Instant;
 using ostk::physics::time::Interval;
 
+using ostk::astrodynamics::trajectory::Ephemeris;
 using ostk::astrodynamics::trajectory::Model;
 using ostk::astrodynamics::trajectory::State;
+using ostk::astrodynamics::trajectory::state::StateTable;
 
 /// @brief Path followed by an object through space as a function of time
 ///
@@ -59,6 +65,8 @@ class Trajectory
 
     /// @brief Copy constructor
     ///
+    /// The model is immutable, hence shared by the copy rather than cloned.
+    ///
     /// @param aTrajectory A trajectory
     Trajectory(const Trajectory& aTrajectory);
 
@@ -134,6 +142,31 @@ class Trajectory
     /// @return Array of states
     Array<State> getStatesAt(const Array<Instant>& anInstantArray) const;
 
+    /// @brief Get ephemeris at given instants
+    ///
+    /// @code{.cpp}
+    ///              Trajectory trajectory = { ... } ;
+    ///              Array<Instant> instants = { ... } ;
+    ///              Ephemeris ephemeris = trajectory.getEphemerisAt(instants) ;
+    /// @endcode
+    ///
+    /// @param anInstantArray An array of instants
+    /// @return Ephemeris
+    Ephemeris getEphemerisAt(const Array<Instant>& anInstantArray) const;
+
+    /// @brief Get state table at instants given as offsets from an epoch
+    ///
+    /// @code{.cpp}
+    ///              Trajectory trajectory = { ... } ;
+    ///              StateTable::OffsetVector offsets = { ... } ;
+    ///              StateTable stateTable = trajectory.getStateTableAt(epoch, offsets) ;
+    /// @endcode
+    ///
+    /// @param anEpoch An epoch
+    /// @param anOffsetVector A vector of offsets from the epoch [ns]
+    /// @return State table, holding the given epoch and offsets, expressed in the frame of the first state
+    StateTable getStateTableAt(const Instant& anEpoch, const StateTable::OffsetVector& anOffsetVector) const;
+
     /// @brief Print trajectory to output stream
     ///
     /// @code{.cpp}
@@ -166,7 +199,7 @@ class Trajectory
     static Trajectory Position(const physics::coordinate::Position& aPosition);
 
    private:
-    Unique<Model> modelUPtr_;
+    Shared<const Model> modelSPtr_;  // Immutable, hence shared by copies
 
     Trajectory();
 };
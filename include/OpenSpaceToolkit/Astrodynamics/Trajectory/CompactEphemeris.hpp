@@ -0,0 +1,217 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_CompactEphemeris__
+#define __OpenSpaceToolkit_Astrodynamics_Trajectory_CompactEphemeris__
+
+#include <cstdint>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Ephemeris.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace trajectory
+{
+
+using ostk::core::container::Array;
+using ostk::core::filesystem::File;
+using ostk::core::type::Index;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+
+using ostk::astrodynamics::trajectory::Ephemeris;
+using ostk::astrodynamics::trajectory::State;
+
+/// @brief Reduced-precision ephemeris, for visualization and coarse screening archives
+///
+/// Rows are grouped in blocks of consecutive instants. Each block holds a double precision anchor (the position and
+/// velocity of its middle row), and each row a single precision offset from the anchor of its block: 12 bytes per
+/// position (and per velocity, optional) instead of 24, plus 8 bytes of time offset. The position error is of the
+/// order of 1e-7 times the largest offset in a block, so blocks should span a fraction of a revolution.
+///
+/// Positions and velocities are linearly interpolated from the compact rows, without expanding them.
+class CompactEphemeris
+{
+   public:
+    using OffsetVector = Eigen::Matrix<std::int64_t, Eigen::Dynamic, 1>;
+    using FloatMatrix = Eigen::Matrix<float, Eigen::Dynamic, 3>;
+
+    /// @brief Constructor
+    ///
+    /// @code{.cpp}
+    ///              CompactEphemeris compactEphemeris = {anEphemeris, 32, false} ;
+    /// @endcode
+    ///
+    /// @param anEphemeris An ephemeris, of sorted instants
+    /// @param (optional) aBlockSize A number of rows per block
+    /// @param (optional) storeVelocities True to store velocities
+    CompactEphemeris(const Ephemeris& anEphemeris, const Size& aBlockSize = 32, const bool& storeVelocities = true);
+
+    /// @brief Equal to operator
+    ///
+    /// @param aCompactEphemeris A compact ephemeris
+    /// @return True if compact ephemerides are equal
+    bool operator==(const CompactEphemeris& aCompactEphemeris) const;
+
+    /// @brief Not equal to operator
+    ///
+    /// @param aCompactEphemeris A compact ephemeris
+    /// @return True if compact ephemerides are not equal
+    bool operator!=(const CompactEphemeris& aCompactEphemeris) const;
+
+    /// @brief Check if compact ephemeris is defined
+    ///
+    /// @return True if compact ephemeris is defined
+    bool isDefined() const;
+
+    /// @brief Check if velocities are stored
+    ///
+    /// @return True if velocities are stored
+    bool hasVelocities() const;
+
+    /// @brief Get number of rows
+    ///
+    /// @return Number of rows
+    Size getSize() const;
+
+    /// @brief Get number of rows per block
+    ///
+    /// @return Block size
+    Size getBlockSize() const;
+
+    /// @brief Get the size of the stored data
+    ///
+    /// @return Size of the stored data [bytes]
+    Size getStorageSize() const;
+
+    /// @brief Access frame
+    ///
+    /// @return Frame
+    const Shared<const Frame>& accessFrame() const;
+
+    /// @brief Get the interval covered by the rows
+    ///
+    /// @return Interval
+    Interval getInterval() const;
+
+    /// @brief Get instants
+    ///
+    /// @return Array of instants
+    Array<Instant> getInstants() const;
+
+    /// @brief Get positions
+    ///
+    /// @return Matrix of positions [m], one row per instant
+    MatrixXd getPositions() const;
+
+    /// @brief Get velocities
+    ///
+    /// @return Matrix of velocities [m/s], one row per instant
+    MatrixXd getVelocities() const;
+
+    /// @brief Get state at an index
+    ///
+    /// @param anIndex A row index
+    /// @return State, holding a position and, if stored, a velocity
+    State getStateAt(const Index& anIndex) const;
+
+    /// @brief Get all states
+    ///
+    /// @return Array of states
+    Array<State> getStates() const;
+
+    /// @brief Expand to a full precision ephemeris
+    ///
+    /// @return Ephemeris
+    Ephemeris toEphemeris() const;
+
+    /// @brief Calculate positions at an array of instants, by linear interpolation
+    ///
+    /// @param anInstantArray An array of instants, within the interval of the compact ephemeris
+    /// @return Matrix of positions [m], one row per instant
+    MatrixXd calculatePositionsAt(const Array<Instant>& anInstantArray) const;
+
+    /// @brief Calculate states at an array of instants, by linear interpolation
+    ///
+    /// Sorted instants are located in amortized constant time.
+    ///
+    /// @param anInstantArray An array of instants, within the interval of the compact ephemeris
+    /// @return Array of states, holding a position and, if stored, a velocity
+    Array<State> calculateStatesAt(const Array<Instant>& anInstantArray) const;
+
+    /// @brief Save to a file
+    ///
+    /// The file holds a fixed size header (epoch in UTC, frame name, row count, block size, velocity flag), followed
+    /// by the time offsets [ns], the block anchors and the single precision offsets, as stored in memory.
+    ///
+    /// @param aFile A file
+    void save(const File& aFile) const;
+
+    /// @brief Constructs an undefined compact ephemeris
+    ///
+    /// @return Undefined compact ephemeris
+    static CompactEphemeris Undefined();
+
+    /// @brief Load from a file, as written by CompactEphemeris::save
+    ///
+    /// @param aFile A file
+    /// @return Compact ephemeris
+    static CompactEphemeris Load(const File& aFile);
+
+   private:
+    Instant epoch_;
+    OffsetVector offsets_;
+    Size blockSize_;
+    MatrixXd anchors_;
+    FloatMatrix positionOffsets_;
+    FloatMatrix velocityOffsets_;
+    Shared<const Frame> frameSPtr_;
+
+    CompactEphemeris(
+        const Instant& anEpoch,
+        const OffsetVector& anOffsetVector,
+        const Size& aBlockSize,
+        const MatrixXd& anAnchorMatrix,
+        const FloatMatrix& aPositionOffsetMatrix,
+        const FloatMatrix& aVelocityOffsetMatrix,
+        const Shared<const Frame>& aFrameSPtr
+    );
+
+    Vector3d positionAt(const Index& anIndex) const;
+
+    Vector3d velocityAt(const Index& anIndex) const;
+
+    Index locateInterval(const std::int64_t& anOffset, const Index& anIntervalIndexHint) const;
+
+    void interpolateAt(
+        const Instant& anInstant, Index& anIntervalIndexHint, Vector3d& aPosition, Vector3d* aVelocityPtr
+    ) const;
+};
+
+}  // namespace trajectory
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
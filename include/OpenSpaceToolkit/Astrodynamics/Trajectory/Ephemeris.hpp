@@ -0,0 +1,135 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_Ephemeris__
+#define __OpenSpaceToolkit_Astrodynamics_Trajectory_Ephemeris__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace trajectory
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::MatrixXd;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::time::Instant;
+
+using ostk::astrodynamics::trajectory::State;
+
+/// @brief Positions and velocities of a trajectory at a sequence of instants, expressed in a single frame
+///
+/// Positions and velocities are held in two N x 3 column-major matrices, so that each Cartesian component is a
+/// contiguous, aligned array over the instants, which vectorized (SIMD) operations process in bulk. States are only
+/// built on access.
+class Ephemeris
+{
+   public:
+    /// @brief Constructor
+    ///
+    /// @param anInstantArray An array of instants
+    /// @param aPositionMatrix A matrix of positions [m], one row per instant
+    /// @param aVelocityMatrix A matrix of velocities [m/s], one row per instant
+    /// @param aFrameSPtr A frame
+    Ephemeris(
+        const Array<Instant>& anInstantArray,
+        const MatrixXd& aPositionMatrix,
+        const MatrixXd& aVelocityMatrix,
+        const Shared<const Frame>& aFrameSPtr
+    );
+
+    /// @brief Equal to operator
+    ///
+    /// @param anEphemeris An ephemeris
+    /// @return True if ephemerides are equal
+    bool operator==(const Ephemeris& anEphemeris) const;
+
+    /// @brief Not equal to operator
+    ///
+    /// @param anEphemeris An ephemeris
+    /// @return True if ephemerides are not equal
+    bool operator!=(const Ephemeris& anEphemeris) const;
+
+    /// @brief Check if ephemeris is defined
+    ///
+    /// @return True if ephemeris is defined
+    bool isDefined() const;
+
+    /// @brief Get number of instants
+    ///
+    /// @return Number of instants
+    Size getSize() const;
+
+    /// @brief Access instants
+    ///
+    /// @return Array of instants
+    const Array<Instant>& accessInstants() const;
+
+    /// @brief Access frame
+    ///
+    /// @return Frame
+    const Shared<const Frame>& accessFrame() const;
+
+    /// @brief Access positions
+    ///
+    /// @return Matrix of positions [m], one row per instant
+    const MatrixXd& accessPositions() const;
+
+    /// @brief Access velocities
+    ///
+    /// @return Matrix of velocities [m/s], one row per instant
+    const MatrixXd& accessVelocities() const;
+
+    /// @brief Get state at an index
+    ///
+    /// @param anIndex An instant index
+    /// @return State
+    State getStateAt(const Index& anIndex) const;
+
+    /// @brief Get all states
+    ///
+    /// @return Array of states
+    Array<State> getStates() const;
+
+    /// @brief Constructs an undefined ephemeris
+    ///
+    /// @return Undefined ephemeris
+    static Ephemeris Undefined();
+
+    /// @brief Constructs an ephemeris from states
+    ///
+    /// States expressed in another frame than the first one are converted to the frame of the first one.
+    ///
+    /// @param aStateArray An array of states, holding positions and velocities
+    /// @return Ephemeris
+    static Ephemeris FromStates(const Array<State>& aStateArray);
+
+   private:
+    Array<Instant> instants_;
+    MatrixXd positions_;
+    MatrixXd velocities_;
+    Shared<const Frame> frameSPtr_;
+};
+
+}  // namespace trajectory
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
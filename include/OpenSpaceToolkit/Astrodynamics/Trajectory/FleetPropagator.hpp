@@ -0,0 +1,146 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_FleetPropagator__
+#define __OpenSpaceToolkit_Astrodynamics_Trajectory_FleetPropagator__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/AtmosphericDrag.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace trajectory
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+
+using ostk::astrodynamics::dynamics::AtmosphericDrag;
+using ostk::astrodynamics::trajectory::Propagator;
+using ostk::astrodynamics::trajectory::State;
+
+/// @brief Propagate a fleet of satellites to common output instants, sharing the environment terms between them
+///
+/// Before each fleet propagation, the environment quantities that every satellite would otherwise recompute at each
+/// of its own (adaptive) steps are evaluated once for the fleet, over the propagation interval:
+///
+/// - third body gravity and solar radiation pressure dynamics without an ephemeris table get one Chebyshev table per
+///   celestial object (the Sun table being shared by both), sampled once and interpolated at every satellite step;
+/// - atmospheric drag dynamics without a density table get the (optional) fleet density table, which freezes the
+///   space weather at its reference instant.
+///
+/// Satellites are then propagated in parallel through all the output instants, with their own adaptive steps. Frame
+/// transforms are shared through the per-thread and process-wide transform caches, and through the interpolated Earth
+/// orientation model when it is selected.
+class FleetPropagator
+{
+   public:
+    /// @brief Constructor
+    ///
+    /// @code{.cpp}
+    ///              FleetPropagator fleetPropagator = { propagator } ;
+    /// @endcode
+    ///
+    /// @param aPropagator A propagator, shared by all the satellites
+    /// @param aDensityTableSPtr (optional) An atmospheric density table, shared by all the satellites
+    /// @param anEphemerisSegmentDuration (optional) A polynomial segment duration of the ephemeris tables
+    /// @param aThreadCount (optional) A worker thread count (0 defaults to the default thread count of
+    /// ExecutionContext)
+    FleetPropagator(
+        const Propagator& aPropagator,
+        const Shared<const AtmosphericDrag::DensityTable>& aDensityTableSPtr = nullptr,
+        const Duration& anEphemerisSegmentDuration = Duration::Days(1.0),
+        const Size& aThreadCount = 0
+    );
+
+    /// @brief Output stream operator
+    ///
+    /// @param anOutputStream An output stream
+    /// @param aFleetPropagator A fleet propagator
+    /// @return A reference to output stream
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const FleetPropagator& aFleetPropagator);
+
+    /// @brief Check if fleet propagator is defined
+    ///
+    /// @return True if fleet propagator is defined
+    bool isDefined() const;
+
+    /// @brief Access propagator
+    ///
+    /// @return The propagator, shared by all the satellites
+    const Propagator& accessPropagator() const;
+
+    /// @brief Get density table
+    ///
+    /// @return The atmospheric density table (nullptr if there is none)
+    Shared<const AtmosphericDrag::DensityTable> getDensityTable() const;
+
+    /// @brief Get ephemeris segment duration
+    ///
+    /// @return The polynomial segment duration of the ephemeris tables
+    Duration getEphemerisSegmentDuration() const;
+
+    /// @brief Get worker thread count
+    ///
+    /// @return The worker thread count (0 defaults to the default thread count of ExecutionContext)
+    Size getThreadCount() const;
+
+    /// @brief Get the propagator with the environment terms shared over an interval
+    ///
+    /// @code{.cpp}
+    ///              Propagator propagator = fleetPropagator.getSharedEnvironmentPropagator(interval) ;
+    /// @endcode
+    ///
+    /// @param anInterval A propagation interval
+    /// @return A copy of the propagator, whose dynamics share the ephemeris and density tables
+    Propagator getSharedEnvironmentPropagator(const Interval& anInterval) const;
+
+    /// @brief Calculate the states of a fleet at common instants
+    ///
+    /// @code{.cpp}
+    ///              Array<Array<State>> states = fleetPropagator.calculateStatesAt(aStateArray, anInstantArray) ;
+    /// @endcode
+    ///
+    /// @param aStateArray An array of initial states, one per satellite
+    /// @param anInstantArray An array of output instants, sorted
+    /// @return Array of states at the instants, one per satellite, in the order of the initial states
+    Array<Array<State>> calculateStatesAt(const Array<State>& aStateArray, const Array<Instant>& anInstantArray) const;
+
+    /// @brief Print fleet propagator
+    ///
+    /// @param anOutputStream An output stream
+    /// @param (optional) displayDecorators If true, display decorators
+    void print(std::ostream& anOutputStream, bool displayDecorator = true) const;
+
+    /// @brief Undefined fleet propagator
+    ///
+    /// @return An undefined fleet propagator
+    static FleetPropagator Undefined();
+
+   private:
+    Propagator propagator_;
+    Shared<const AtmosphericDrag::DensityTable> densityTableSPtr_;
+    Duration ephemerisSegmentDuration_;
+    Size threadCount_;
+};
+
+}  // namespace trajectory
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
@@ -20,11 +20,15 @@ namespace astrodynamics
 namespace trajectory
 {
 
+using ostk::core::container::Array;
 using ostk::core::type::Shared;
 using ostk::core::type::String;
 
+using ostk::mathematics::object::Matrix3d;
+
 using ostk::physics::coordinate::Frame;
 using ostk::physics::coordinate::frame::Provider;
+using ostk::physics::coordinate::Transform;
 using ostk::physics::coordinate::Vector3d;
 using ostk::physics::time::Instant;
 
@@ -46,6 +50,27 @@ class LocalOrbitalFrameFactory
     Shared<const Frame> generateFrame(const Instant& anInstant, const Vector3d& aPosition, const Vector3d& aVelocity)
         const;
 
+    /// @brief Generate the transform from the parent frame to the local orbital frame based on current state input
+    ///
+    /// Light-weight alternative to generateFrame, which neither constructs nor registers a frame. Repeated requests
+    /// for the same state (e.g. within one integration step) are served from a per-thread cache.
+    ///
+    /// @param anInstant An instant
+    /// @param aPosition A position vector, expressed in the parent frame
+    /// @param aVelocity A velocity vector, expressed in the parent frame
+    ///
+    /// @return The transform from the parent frame to the local orbital frame
+    Transform generateTransform(const Instant& anInstant, const Vector3d& aPosition, const Vector3d& aVelocity) const;
+
+    /// @brief Generate the rotation matrices from the parent frame to the local orbital frame, for a set of states
+    ///
+    /// States expressed in another frame are first converted to the parent frame.
+    ///
+    /// @param aStateArray An array of states
+    ///
+    /// @return The rotation matrices, one per state
+    Array<Matrix3d> generateRotationMatrices(const Array<State>& aStateArray) const;
+
     /// @brief Check if local orbital frame factory is defined
     ///
     /// @return True if local orbital frame factory is defined
@@ -3,15 +3,20 @@
 #ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_LocalOrbitalFrameTransformProvider__
 #define __OpenSpaceToolkit_Astrodynamics_Trajectory_LocalOrbitalFrameTransformProvider__
 
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Velocity.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
 namespace ostk
 {
 namespace astrodynamics
@@ -19,9 +24,12 @@ namespace astrodynamics
 namespace trajectory
 {
 
+using ostk::core::container::Array;
 using ostk::core::type::Shared;
 using ostk::core::type::String;
 
+using ostk::mathematics::object::Matrix3d;
+
 using ostk::physics::coordinate::frame::Provider;
 using ostk::physics::coordinate::frame::Transform;
 using ostk::physics::coordinate::Position;
@@ -30,6 +38,8 @@ using ostk::physics::coordinate::Vector3d;
 using ostk::physics::coordinate::Velocity;
 using ostk::physics::time::Instant;
 
+using ostk::astrodynamics::trajectory::State;
+
 /// @brief Local orbital frame transform provider, frame provider
 ///
 /// @note                       Generates a specific transform based on instant, position, velocity and a LOF type.
@@ -86,6 +96,35 @@ class LocalOrbitalFrameTransformProvider : public Provider
         const Vector3d& aVelocity
     );
 
+    /// @brief Generate the transform from the parent frame to the local orbital frame, based on a state and a LOF type
+    ///
+    /// @param aType A local orbital frame provider type
+    /// @param anInstant An instant
+    /// @param aPosition A position vector
+    /// @param aVelocity A velocity vector
+    ///
+    /// @return The transform generated
+    static Transform GenerateTransform(
+        const LocalOrbitalFrameTransformProvider::Type& aType,
+        const Instant& anInstant,
+        const Vector3d& aPosition,
+        const Vector3d& aVelocity
+    );
+
+    /// @brief Generate the rotation matrices from the parent frame to the local orbital frame, for a set of states
+    ///
+    /// Batched counterpart of GenerateTransform, which only computes the orientations: each matrix maps coordinates
+    /// expressed in the parent frame to the local orbital frame. The state coordinates are used as is, and must
+    /// therefore be expressed in the parent frame.
+    ///
+    /// @param aType A local orbital frame provider type
+    /// @param aStateArray An array of states
+    ///
+    /// @return The rotation matrices, one per state
+    static Array<Matrix3d> GenerateRotationMatrices(
+        const LocalOrbitalFrameTransformProvider::Type& aType, const Array<State>& aStateArray
+    );
+
     /// @brief Convert local orbital frame transform provider type to string
     ///
     /// @param aType A local orbital frame provider type
@@ -102,21 +141,6 @@ class LocalOrbitalFrameTransformProvider : public Provider
     ///
     /// @return A local orbital frame transform provider
     LocalOrbitalFrameTransformProvider(const Transform& aTransform);
-
-    /// @brief Generate a transform based on current state and LOF type
-    ///
-    /// @param aType A local orbital frame provider type
-    /// @param anInstant An instant
-    /// @param aPosition A position vector
-    /// @param aVelocity A velocity vector
-    ///
-    /// @return The transform generated
-    static Transform generateTransform(
-        const LocalOrbitalFrameTransformProvider::Type& aType,
-        const Instant& anInstant,
-        const Vector3d& aPosition,
-        const Vector3d& aVelocity
-    );
 };
 
 }  // namespace trajectory
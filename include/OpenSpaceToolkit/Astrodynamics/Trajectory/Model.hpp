@@ -7,6 +7,7 @@
 
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Ephemeris.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
 
 namespace ostk
@@ -20,6 +21,7 @@ using ostk::core::container::Array;
 
 using ostk::physics::time::Instant;
 
+using ostk::astrodynamics::trajectory::Ephemeris;
 using ostk::astrodynamics::trajectory::State;
 
 /// @brief Trajectory model (abstract)
@@ -69,6 +71,15 @@ class Model
 
     virtual Array<State> calculateStatesAt(const Array<Instant>& anInstantArray) const;
 
+    /// @brief Calculate the ephemeris at an array of instants
+    ///
+    /// Defaults to the ephemeris of the calculated states. Models that compute positions and velocities in bulk
+    /// override it to fill the ephemeris directly, without building intermediate states.
+    ///
+    /// @param anInstantArray An array of instants
+    /// @return Ephemeris, undefined if the instant array is empty
+    virtual Ephemeris calculateEphemerisAt(const Array<Instant>& anInstantArray) const;
+
     virtual void print(std::ostream& anOutputStream, bool displayDecorator = true) const = 0;
 };
 
@@ -0,0 +1,146 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Cached__
+#define __OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Cached__
+
+#include <list>
+#include <mutex>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Map.hpp>
+#include <OpenSpaceToolkit/Core/Container/Pair.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Model.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace trajectory
+{
+namespace model
+{
+
+using ostk::core::container::Array;
+using ostk::core::container::Map;
+using ostk::core::container::Pair;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::physics::time::Instant;
+
+using ostk::astrodynamics::Trajectory;
+using ostk::astrodynamics::trajectory::Model;
+using ostk::astrodynamics::trajectory::State;
+
+/// @brief Cached trajectory model
+///
+/// Wraps a trajectory (e.g., SGP4, Kepler, propagated or tabulated), and remembers the states it calculates, keyed on
+/// their instant, so that consumers asking for the same instants (access, profiles, event conditions) only pay for
+/// each state once. The cache is bounded: once full, the least recently used states are evicted.
+///
+/// The cache is thread-safe, and shared by the copies of the model, e.g. those held by copies of a trajectory.
+///
+/// @code{.cpp}
+///              Trajectory trajectory = { Cached(Trajectory(orbit), 4096) } ;
+/// @endcode
+class Cached : public virtual Model
+{
+   public:
+    /// @brief Default capacity
+    static constexpr Size DefaultCapacity = 4096;
+
+    /// @brief Constructor
+    ///
+    /// @param aTrajectory A trajectory
+    /// @param aCapacity A capacity, in states. Defaults to Cached::DefaultCapacity.
+    Cached(const Trajectory& aTrajectory, const Size& aCapacity = Cached::DefaultCapacity);
+
+    virtual Cached* clone() const override;
+
+    bool operator==(const Cached& aCachedModel) const;
+
+    bool operator!=(const Cached& aCachedModel) const;
+
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const Cached& aCachedModel);
+
+    virtual bool isDefined() const override;
+
+    /// @brief Access the wrapped trajectory
+    ///
+    /// @return Trajectory
+    const Trajectory& accessTrajectory() const;
+
+    /// @brief Get the capacity of the cache
+    ///
+    /// @return Capacity, in states
+    Size getCapacity() const;
+
+    /// @brief Get the number of cached states
+    ///
+    /// @return Number of cached states
+    Size getSize() const;
+
+    /// @brief Get the number of states found in the cache since it was created (or last cleared)
+    ///
+    /// @return Hit count
+    Size getHitCount() const;
+
+    /// @brief Get the number of states calculated by the wrapped trajectory since the cache was created (or last
+    /// cleared)
+    ///
+    /// @return Miss count
+    Size getMissCount() const;
+
+    /// @brief Clear the cache, and reset its hit and miss counts
+    void clear() const;
+
+    virtual State calculateStateAt(const Instant& anInstant) const override;
+
+    /// @brief Calculate states at an array of instants
+    ///
+    /// States missing from the cache are calculated at once, through the batch path of the wrapped trajectory.
+    ///
+    /// @param anInstantArray An array of instants
+    /// @return States
+    virtual Array<State> calculateStatesAt(const Array<Instant>& anInstantArray) const override;
+
+    virtual void print(std::ostream& anOutputStream, bool displayDecorator = true) const override;
+
+   protected:
+    virtual bool operator==(const Model& aModel) const override;
+
+    virtual bool operator!=(const Model& aModel) const override;
+
+   private:
+    /// @brief Cached states, shared by the copies of a model
+    ///
+    /// States are listed from the most to the least recently used, and indexed by instant.
+    struct Cache
+    {
+        std::mutex mutex;  // Guards the whole cache
+        std::list<Pair<Instant, State>> stateList;
+        Map<Instant, std::list<Pair<Instant, State>>::iterator> stateMap;
+        Size hitCount = 0;
+        Size missCount = 0;
+    };
+
+    Trajectory trajectory_;
+    Size capacity_;
+    Shared<Cache> cacheSPtr_;
+
+    void cacheStates(const Array<Instant>& anInstantArray, const Array<State>& aStateArray) const;
+};
+
+}  // namespace model
+}  // namespace trajectory
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
@@ -0,0 +1,194 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Chebyshev__
+#define __OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Chebyshev__
+
+#include <vector>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Ephemeris.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Model.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace trajectory
+{
+namespace model
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::unit::Length;
+
+using ostk::astrodynamics::trajectory::Ephemeris;
+using ostk::astrodynamics::trajectory::Model;
+using ostk::astrodynamics::trajectory::Propagator;
+using ostk::astrodynamics::trajectory::State;
+
+/// @brief Chebyshev trajectory model
+///
+/// Positions and velocities are stored as Chebyshev series over contiguous segments of variable duration, which makes
+/// for a compact representation of an ephemeris (a few coefficients per segment instead of one state per sample).
+/// Segments are located by a binary search (resumed from the previous segment for sorted instants), and series are
+/// evaluated with the Clenshaw recurrence, at a cost independent of the segment duration.
+///
+/// @code{.cpp}
+///              Chebyshev chebyshev = Chebyshev::Fit(aPropagator, aState, anInterval, Length::Meters(1.0)) ;
+///              State state = chebyshev.calculateStateAt(anInstant) ;
+/// @endcode
+class Chebyshev : public virtual Model
+{
+   public:
+    /// @brief Segment, over which positions and velocities are Chebyshev series of the time normalized to [-1, 1]
+    struct Segment
+    {
+        Instant startInstant;           ///< Start instant.
+        Duration duration;              ///< Strictly positive duration.
+        MatrixXd positionCoefficients;  ///< Position coefficients [m], one column per degree.
+        MatrixXd velocityCoefficients;  ///< Velocity coefficients [m/s], one column per degree.
+    };
+
+    /// @brief Constructor
+    ///
+    /// The model is undefined without segments.
+    ///
+    /// @param aSegmentArray An array of contiguous segments, of coefficient matrices of 3 rows and of the same number
+    /// of columns
+    /// @param aFrameSPtr A frame
+    Chebyshev(const Array<Segment>& aSegmentArray, const Shared<const Frame>& aFrameSPtr);
+
+    virtual Chebyshev* clone() const override;
+
+    bool operator==(const Chebyshev& aChebyshevModel) const;
+
+    bool operator!=(const Chebyshev& aChebyshevModel) const;
+
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const Chebyshev& aChebyshevModel);
+
+    virtual bool isDefined() const override;
+
+    /// @brief Get the interval covered by the segments
+    ///
+    /// @return Interval
+    Interval getInterval() const;
+
+    /// @brief Get the frame
+    ///
+    /// @return Frame
+    Shared<const Frame> getFrame() const;
+
+    /// @brief Get the degree of the series
+    ///
+    /// @return Degree
+    Size getDegree() const;
+
+    /// @brief Get the number of segments
+    ///
+    /// @return Segment count
+    Size getSegmentCount() const;
+
+    /// @brief Access the segments
+    ///
+    /// @return Reference to segments
+    const Array<Segment>& accessSegments() const;
+
+    virtual State calculateStateAt(const Instant& anInstant) const override;
+
+    virtual Array<State> calculateStatesAt(const Array<Instant>& anInstantArray) const override;
+
+    /// @brief Calculate the ephemeris at an array of instants
+    ///
+    /// Positions and velocities are written directly into the ephemeris, without building intermediate states.
+    ///
+    /// @param anInstantArray An array of instants
+    /// @return Ephemeris, in the frame of the model
+    virtual Ephemeris calculateEphemerisAt(const Array<Instant>& anInstantArray) const override;
+
+    virtual void print(std::ostream& anOutputStream, bool displayDecorator = true) const override;
+
+    /// @brief Undefined
+    ///
+    /// @return An undefined Chebyshev model
+    static Chebyshev Undefined();
+
+    /// @brief Fit a Chebyshev model to the output of a propagator
+    ///
+    /// Segments are fitted one after the other, from the propagated states at the Chebyshev nodes of each segment.
+    /// Each fit is checked against propagated states in between the nodes: segments exceeding the position tolerance
+    /// are halved, and the next segment grows when the fit is well within the tolerance, up to the maximum segment
+    /// duration.
+    ///
+    /// @code{.cpp}
+    ///              Chebyshev chebyshev = Chebyshev::Fit(
+    ///                  aPropagator, aState, Interval::Closed(aStartInstant, anEndInstant), Length::Meters(1.0)
+    ///              ) ;
+    /// @endcode
+    ///
+    /// @param aPropagator A propagator
+    /// @param aState An initial state, the model is in its frame
+    /// @param anInterval An interval, of strictly positive duration
+    /// @param aPositionTolerance A strictly positive position tolerance
+    /// @param (optional) aDegree A degree of the series, in [2, 30]
+    /// @param (optional) aMaximumSegmentDuration A strictly positive maximum segment duration
+    /// @return Chebyshev model
+    static Chebyshev Fit(
+        const Propagator& aPropagator,
+        const State& aState,
+        const Interval& anInterval,
+        const Length& aPositionTolerance,
+        const Size& aDegree = 12,
+        const Duration& aMaximumSegmentDuration = Duration::Hours(1.0)
+    );
+
+   protected:
+    virtual bool operator==(const Model& aModel) const override;
+
+    virtual bool operator!=(const Model& aModel) const override;
+
+   private:
+    Array<Segment> segments_;
+    Shared<const Frame> frameSPtr_;
+
+    // Segment start times and durations [s], relative to the start of the first segment
+    std::vector<double> segmentStartTimes_;
+    std::vector<double> segmentDurations_;
+
+    Index locateSegment(const double& aTime, const Index& aSegmentIndexHint) const;
+
+    void evaluateAt(const Instant& anInstant, Index& aSegmentIndexHint, Vector3d& aPosition, Vector3d& aVelocity)
+        const;
+};
+
+}  // namespace model
+}  // namespace trajectory
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
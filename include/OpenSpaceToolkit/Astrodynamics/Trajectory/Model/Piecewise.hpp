@@ -0,0 +1,136 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Piecewise__
+#define __OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Piecewise__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Model.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/SGP4/TLE.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace trajectory
+{
+namespace model
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+
+using ostk::astrodynamics::Trajectory;
+using ostk::astrodynamics::trajectory::Model;
+using ostk::astrodynamics::trajectory::orbit::model::sgp4::TLE;
+using ostk::astrodynamics::trajectory::State;
+
+/// @brief Piecewise trajectory model
+///
+/// Trajectory composed of pieces (e.g., SGP4 or tabulated trajectories), switched at given instants: piece i is used
+/// from switch instant i - 1 (included) to switch instant i (excluded), the first and last pieces extending
+/// indefinitely. States are returned in the frame of the piece they are calculated with.
+///
+/// @code{.cpp}
+///              Trajectory trajectory = { Piecewise::TLEs(tles) } ;
+/// @endcode
+class Piecewise : public virtual Model
+{
+   public:
+    /// @brief Constructor
+    ///
+    /// @param aTrajectoryArray An array of trajectories (pieces)
+    /// @param aSwitchInstantArray An array of strictly increasing switch instants, one less than pieces
+    Piecewise(const Array<Trajectory>& aTrajectoryArray, const Array<Instant>& aSwitchInstantArray);
+
+    virtual Piecewise* clone() const override;
+
+    bool operator==(const Piecewise& aPiecewiseModel) const;
+
+    bool operator!=(const Piecewise& aPiecewiseModel) const;
+
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const Piecewise& aPiecewiseModel);
+
+    virtual bool isDefined() const override;
+
+    /// @brief Get the number of pieces
+    ///
+    /// @return Number of pieces
+    Size getPieceCount() const;
+
+    /// @brief Access the pieces
+    ///
+    /// @return Trajectories
+    const Array<Trajectory>& accessTrajectories() const;
+
+    /// @brief Access the switch instants
+    ///
+    /// @return Switch instants
+    const Array<Instant>& accessSwitchInstants() const;
+
+    /// @brief Get the index of the piece used at a given instant
+    ///
+    /// @param anInstant An instant
+    /// @return Piece index
+    Index getPieceIndexAt(const Instant& anInstant) const;
+
+    /// @brief Access the piece used at a given instant
+    ///
+    /// @param anInstant An instant
+    /// @return Trajectory
+    const Trajectory& accessTrajectoryAt(const Instant& anInstant) const;
+
+    /// @brief Get the switch instants strictly within an interval
+    ///
+    /// @param anInterval An interval
+    /// @return Switch instants, in increasing order
+    Array<Instant> getSwitchInstantsWithin(const Interval& anInterval) const;
+
+    virtual State calculateStateAt(const Instant& anInstant) const override;
+
+    /// @brief Calculate states at an array of instants
+    ///
+    /// Consecutive instants using the same piece are calculated at once, through the batch path of that piece.
+    ///
+    /// @param anInstantArray An array of instants
+    /// @return States
+    virtual Array<State> calculateStatesAt(const Array<Instant>& anInstantArray) const override;
+
+    virtual void print(std::ostream& anOutputStream, bool displayDecorator = true) const override;
+
+    /// @brief Constructs a piecewise SGP4 model from a sequence of TLEs
+    ///
+    /// TLEs are sorted by epoch, and each TLE is used up to halfway to the epochs of its neighbors, which bounds the
+    /// propagation span of every piece.
+    ///
+    /// @param aTleArray An array of TLEs, with distinct epochs
+    /// @return Piecewise model
+    static Piecewise TLEs(const Array<TLE>& aTleArray);
+
+   protected:
+    virtual bool operator==(const Model& aModel) const override;
+
+    virtual bool operator!=(const Model& aModel) const override;
+
+   private:
+    Array<Trajectory> trajectories_;
+    Array<Instant> switchInstants_;
+};
+
+}  // namespace model
+}  // namespace trajectory
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
@@ -3,6 +3,9 @@
 #ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Static__
 #define __OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Static__
 
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
 
@@ -18,6 +21,8 @@ namespace trajectory
 namespace model
 {
 
+using ostk::core::container::Array;
+
 using ostk::physics::coordinate::Position;
 using ostk::physics::time::Instant;
 using ostk::physics::time::Interval;
@@ -26,6 +31,9 @@ using ostk::astrodynamics::trajectory::Model;
 using ostk::astrodynamics::trajectory::State;
 
 /// @brief Static trajectory model
+///
+/// The position is fixed in its frame (e.g., a ground station in ITRF). Consumers evaluating many instants (access,
+/// coverage) access it directly, and transform it with the transform of each instant, instead of constructing states.
 class Static : public virtual Model
 {
    public:
@@ -41,8 +49,21 @@ class Static : public virtual Model
 
     virtual bool isDefined() const override;
 
+    /// @brief Access the fixed position
+    ///
+    /// @return Reference to position
+    const Position& accessPosition() const;
+
     virtual State calculateStateAt(const Instant& anInstant) const override;
 
+    /// @brief Calculate the states at an array of instants
+    ///
+    /// All states share the fixed position and a zero velocity, constructed once.
+    ///
+    /// @param anInstantArray An array of instants
+    /// @return Array of states
+    virtual Array<State> calculateStatesAt(const Array<Instant>& anInstantArray) const override;
+
     virtual void print(std::ostream& anOutputStream, bool displayDecorator = true) const override;
 
    protected:
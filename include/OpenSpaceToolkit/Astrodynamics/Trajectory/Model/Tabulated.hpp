@@ -12,12 +12,18 @@
 #include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator.hpp>
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
 
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Model.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateBroker.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/StateTable.hpp>
 
 namespace ostk
 {
@@ -39,12 +45,18 @@ using ostk::mathematics::curvefitting::Interpolator;
 using ostk::mathematics::object::MatrixXd;
 using ostk::mathematics::object::VectorXd;
 
+using ostk::physics::coordinate::Frame;
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 using ostk::physics::time::Interval;
 using ostk::physics::time::Scale;
+using ostk::physics::unit::Length;
 
 using ostk::astrodynamics::trajectory::Model;
+using ostk::astrodynamics::trajectory::Propagator;
 using ostk::astrodynamics::trajectory::State;
+using ostk::astrodynamics::trajectory::state::CoordinateBroker;
+using ostk::astrodynamics::trajectory::state::StateTable;
 
 #define DEFAULT_TABULATED_TRAJECTORY_INTERPOLATION_TYPE Interpolator::Type::Linear
 
@@ -56,11 +68,54 @@ using ostk::astrodynamics::trajectory::State;
 class Tabulated : public virtual Model
 {
    public:
+    using RowMajorMatrixXd = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
     Tabulated(
         const Array<State>& aStateArray,
         const Interpolator::Type& anInterpolationType = DEFAULT_TABULATED_TRAJECTORY_INTERPOLATION_TYPE
     );
 
+    /// @brief Constructor from a timestamps vector and a coordinates matrix
+    ///
+    /// Timestamps and coordinates are copied into the model.
+    ///
+    /// @param anEpoch An epoch
+    /// @param aTimestampVector A vector of timestamps [s since epoch], sorted
+    /// @param aCoordinateMatrix A matrix of coordinates, one row per timestamp
+    /// @param aFrameSPtr A frame
+    /// @param aCoordinateBrokerSPtr A coordinate broker, describing the coordinates columns
+    /// @param (optional) anInterpolationType An interpolation type
+    Tabulated(
+        const Instant& anEpoch,
+        const VectorXd& aTimestampVector,
+        const MatrixXd& aCoordinateMatrix,
+        const Shared<const Frame>& aFrameSPtr,
+        const Shared<const CoordinateBroker>& aCoordinateBrokerSPtr,
+        const Interpolator::Type& anInterpolationType = DEFAULT_TABULATED_TRAJECTORY_INTERPOLATION_TYPE
+    );
+
+    /// @brief Constructor from views on externally owned timestamps and coordinates buffers
+    ///
+    /// Buffers are referenced, not copied: the storage owner is kept alive by the model (and its copies), and the
+    /// buffers must not be modified while it is.
+    ///
+    /// @param anEpoch An epoch
+    /// @param aTimestampVector A view on timestamps [s since epoch], sorted
+    /// @param aCoordinateMatrix A view on row-major coordinates, one row per timestamp
+    /// @param aFrameSPtr A frame
+    /// @param aCoordinateBrokerSPtr A coordinate broker, describing the coordinates columns
+    /// @param anInterpolationType An interpolation type
+    /// @param aStorageSPtr An owner of the buffers
+    Tabulated(
+        const Instant& anEpoch,
+        const Eigen::Map<const VectorXd>& aTimestampVector,
+        const Eigen::Map<const RowMajorMatrixXd>& aCoordinateMatrix,
+        const Shared<const Frame>& aFrameSPtr,
+        const Shared<const CoordinateBroker>& aCoordinateBrokerSPtr,
+        const Interpolator::Type& anInterpolationType,
+        const Shared<const void>& aStorageSPtr
+    );
+
     virtual Tabulated* clone() const override;
 
     bool operator==(const Tabulated& aTabulatedModel) const;
@@ -79,23 +134,159 @@ class Tabulated : public virtual Model
 
     State getLastState() const;
 
+    /// @brief Get the epoch of the timestamps
+    ///
+    /// @return Timestamps epoch
+    Instant getTableEpoch() const;
+
+    /// @brief Access the timestamps, without copy
+    ///
+    /// @return View on the timestamps [s since the timestamps epoch]
+    Eigen::Map<const VectorXd> accessTimestamps() const;
+
+    /// @brief Access the coordinates, without copy
+    ///
+    /// @return View on the row-major coordinates, one row per timestamp
+    Eigen::Map<const RowMajorMatrixXd> accessCoordinates() const;
+
     virtual State calculateStateAt(const Instant& anInstant) const override;
 
     virtual Array<State> calculateStatesAt(const Array<Instant>& anInstantArray) const override;
 
+    /// @brief Calculate the ephemeris at a set of instants
+    ///
+    /// Interpolated positions and velocities are written directly into the ephemeris, without building intermediate
+    /// states.
+    ///
+    /// @param anInstantArray An array of instants
+    /// @return Ephemeris, in the frame of the tabulated states
+    virtual Ephemeris calculateEphemerisAt(const Array<Instant>& anInstantArray) const override;
+
+    /// @brief Calculate a state table at a set of instants
+    ///
+    /// Interpolated coordinates are written directly into the columns of the table, without building intermediate
+    /// states.
+    ///
+    /// @param anInstantArray An array of instants
+    /// @return State table, in the frame and with the coordinate subsets of the tabulated states
+    StateTable calculateStateTableAt(const Array<Instant>& anInstantArray) const;
+
     virtual void print(std::ostream& anOutputStream, bool displayDecorator = true) const override;
 
     static Tabulated Load(const File& aFile);
 
+    /// @brief Load a tabulated model from an ephemeris file, memory-mapped
+    ///
+    /// The file is mapped read-only, and linear interpolation reads the mapped timestamps and coordinates directly:
+    /// opening an ephemeris does not depend on its size, and pages are read on demand. Other interpolation types
+    /// build their interpolators from the mapped columns when loading.
+    ///
+    /// @code{.cpp}
+    ///              Tabulated tabulated = Tabulated::LoadEphemeris(File::Path(Path::Parse("/path/to/ephemeris.bin")));
+    /// @endcode
+    ///
+    /// @param aFile An ephemeris file, as written by Tabulated::SaveEphemeris
+    /// @param (optional) anInterpolationType An interpolation type
+    /// @return Tabulated model
+    static Tabulated LoadEphemeris(
+        const File& aFile,
+        const Interpolator::Type& anInterpolationType = DEFAULT_TABULATED_TRAJECTORY_INTERPOLATION_TYPE
+    );
+
+    /// @brief Save an array of states to an ephemeris file
+    ///
+    /// The file holds a fixed size header (epoch in UTC, frame name, row count), followed by the timestamps column
+    /// [s since epoch] and by the position and velocity coordinates, row by row [m, m/s].
+    ///
+    /// @code{.cpp}
+    ///              Tabulated::SaveEphemeris(aStateArray, File::Path(Path::Parse("/path/to/ephemeris.bin")));
+    /// @endcode
+    ///
+    /// @param aStateArray An array of states, converted to the frame of the earliest state
+    /// @param aFile An ephemeris file
+    static void SaveEphemeris(const Array<State>& aStateArray, const File& aFile);
+
+    /// @brief Sample the output of a propagator, at instants chosen for the interpolation to meet a tolerance
+    ///
+    /// Sampling starts from a uniform grid of the maximum step duration. Propagated states are then compared to the
+    /// interpolated ones at the middle of each step, and steps exceeding the position tolerance are halved, until all
+    /// the steps meet it. Samples are hence dense where the trajectory is hard to interpolate (maneuvers, perigee
+    /// passes) and sparse elsewhere, for the given interpolation type.
+    ///
+    /// @code{.cpp}
+    ///              Tabulated tabulated = Tabulated::Sample(
+    ///                  aPropagator, aState, Interval::Closed(aStartInstant, anEndInstant), Length::Meters(1.0)
+    ///              ) ;
+    /// @endcode
+    ///
+    /// @param aPropagator A propagator
+    /// @param aState An initial state, the model is in its frame
+    /// @param anInterval An interval, of strictly positive duration
+    /// @param aPositionTolerance A strictly positive position tolerance
+    /// @param (optional) anInterpolationType An interpolation type
+    /// @param (optional) aMaximumStepDuration A strictly positive maximum duration between samples
+    /// @return Tabulated model
+    static Tabulated Sample(
+        const Propagator& aPropagator,
+        const State& aState,
+        const Interval& anInterval,
+        const Length& aPositionTolerance,
+        const Interpolator::Type& anInterpolationType = DEFAULT_TABULATED_TRAJECTORY_INTERPOLATION_TYPE,
+        const Duration& aMaximumStepDuration = Duration::Minutes(10.0)
+    );
+
    protected:
     virtual bool operator==(const Model& aModel) const override;
 
     virtual bool operator!=(const Model& aModel) const override;
 
    private:
+    // Timestamps [s since epoch] and row-major coordinates, either owned, memory-mapped or externally owned
+    struct Table
+    {
+        Instant epoch = Instant::Undefined();
+        Size rowCount = 0;
+        Size columnCount = 0;
+        const double* timestamps = nullptr;
+        const double* coordinates = nullptr;
+        Shared<const void> timestampsStorageSPtr = nullptr;
+        Shared<const void> coordinatesStorageSPtr = nullptr;
+    };
+
     State firstState_ = State::Undefined();
     State lastState_ = State::Undefined();
+    Interpolator::Type interpolationType_;
+
+    // Linear interpolation is evaluated in a single pass over all coordinates, from a row-major table of the states
+    Table table_;
+
+    // Other interpolation types use one interpolator per coordinate
     Array<Shared<const Interpolator>> interpolators_;
+
+    Tabulated(
+        const State& aFirstState,
+        const State& aLastState,
+        const Table& aTable,
+        const Interpolator::Type& anInterpolationType
+    );
+
+    void setTable(
+        const Instant& anEpoch,
+        const Eigen::Map<const VectorXd>& aTimestampVector,
+        const Eigen::Map<const RowMajorMatrixXd>& aCoordinateMatrix,
+        const Shared<const Frame>& aFrameSPtr,
+        const Shared<const CoordinateBroker>& aCoordinateBrokerSPtr,
+        const Shared<const void>& aTimestampsStorageSPtr,
+        const Shared<const void>& aCoordinatesStorageSPtr
+    );
+
+    void generateInterpolators();
+
+    Index locateInterval(const double& aTimestamp, const Index& anIntervalIndexHint) const;
+
+    VectorXd interpolateCoordinatesAt(const Instant& anInstant, Index& anIntervalIndexHint) const;
+
+    State interpolateStateAt(const Instant& anInstant, Index& anIntervalIndexHint) const;
 };
 
 }  // namespace model
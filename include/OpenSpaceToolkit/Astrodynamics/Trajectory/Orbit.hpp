@@ -4,15 +4,20 @@
 #define __OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit__
 
 #include <mutex>
+#include <shared_mutex>
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Map.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
 #include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/Unique.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
@@ -20,8 +25,10 @@
 #include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
 #include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
 
+#include <OpenSpaceToolkit/Astrodynamics/ExecutionContext.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler/COE.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Pass.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
 
@@ -35,12 +42,16 @@ namespace trajectory
 using ostk::core::container::Array;
 using ostk::core::container::Map;
 using ostk::core::container::Pair;
+using ostk::core::filesystem::File;
 using ostk::core::type::Index;
 using ostk::core::type::Integer;
 using ostk::core::type::Real;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using ostk::core::type::Unique;
 
+using ostk::mathematics::object::MatrixXd;
+
 using ostk::physics::coordinate::Frame;
 using ostk::physics::environment::object::Celestial;
 using ostk::physics::time::Duration;
@@ -49,7 +60,9 @@ using ostk::physics::time::Time;
 using ostk::physics::unit::Angle;
 using ostk::physics::unit::Length;
 
+using ostk::astrodynamics::ExecutionContext;
 using ostk::astrodynamics::Trajectory;
+using ostk::astrodynamics::trajectory::orbit::model::kepler::COE;
 using ostk::astrodynamics::trajectory::orbit::Pass;
 using ostk::astrodynamics::trajectory::State;
 
@@ -86,6 +99,12 @@ class Orbit : public Trajectory
         const Shared<const Celestial>& aCelestialObjectSPtr
     );
 
+    /// @brief Copy constructor
+    ///
+    /// Copies share the model, the pass cache and the orbital frames of the orbit, so that copying is cheap and keeps
+    /// the passes already computed.
+    ///
+    /// @param anOrbit An orbit
     Orbit(const Orbit& anOrbit);
 
     ~Orbit();
@@ -106,6 +125,80 @@ class Orbit : public Trajectory
         const Integer& aRevolutionNumber, const Duration& aStepDuration = Duration::Minutes(10.0)
     ) const;
 
+    /// @brief Get the pass with a given revolution number, sampling the orbit model in bulk
+    ///
+    /// The model is sampled with `calculateStatesAt` on a regular grid, one window of steps at a time, and the
+    /// crossings are located by interpolating the sampled states (see `ComputePasses`), so that refining them does
+    /// not evaluate the model again. Complete passes are cached alongside those of `getPassWithRevolutionNumber`.
+    ///
+    /// @param aRevolutionNumber A revolution number
+    /// @param aStepDuration The sampling step duration
+    /// @param aWindowStepCount The number of steps per sampling window, which must span more than one revolution
+    /// @return The pass
+    Pass getSampledPassWithRevolutionNumber(
+        const Integer& aRevolutionNumber,
+        const Duration& aStepDuration = Duration::Minutes(1.0),
+        const Size& aWindowStepCount = 1000
+    ) const;
+
+    /// @brief Save the cached passes to a binary snapshot file
+    ///
+    /// The snapshot is made of a versioned header followed by fixed size records, one per pass, holding the
+    /// revolution number and the crossing instants as nanosecond offsets from the epoch of the orbit model.
+    ///
+    /// @code{.cpp}
+    ///                  orbit.savePassSnapshot(File::Path(Path::Parse("/path/to/orbit.passes")));
+    /// @endcode
+    ///
+    /// @param aFile A file
+    void savePassSnapshot(const File& aFile) const;
+
+    /// @brief Load passes from a binary snapshot file into the pass cache
+    ///
+    /// The snapshot must have been saved from an orbit with the same model epoch. Passes already cached are kept.
+    ///
+    /// @code{.cpp}
+    ///                  orbit.loadPassSnapshot(File::Path(Path::Parse("/path/to/orbit.passes")));
+    /// @endcode
+    ///
+    /// @param aFile A file
+    void loadPassSnapshot(const File& aFile) const;
+
+    /// @brief Get the ground track of the orbit at a given array of instants
+    ///
+    /// The states are generated in bulk, transformed to the frame of the central body with one transform per instant,
+    /// and converted to geodetic coordinates all at once.
+    ///
+    /// @code{.cpp}
+    ///                  const MatrixXd groundTrack = orbit.getGroundTrack(instants);
+    /// @endcode
+    ///
+    /// @param anInstantArray An array of instants
+    /// @return A N x 3 matrix, whose (contiguous) columns hold the geodetic latitudes [rad], longitudes [rad] and
+    /// altitudes [m]
+    MatrixXd getGroundTrack(const Array<Instant>& anInstantArray) const;
+
+    /// @brief Get the osculating classical orbital elements of the orbit at a given array of instants
+    ///
+    /// Keplerian models propagate their elements directly. Other models generate the states in bulk, which are
+    /// converted to elements all at once (see COE::CartesiansToSIVectors), with the gravitational parameter of the
+    /// central body.
+    ///
+    /// @code{.cpp}
+    ///                  const Array<COE> coes = orbit.getCOEsAt(instants);
+    /// @endcode
+    ///
+    /// @param anInstantArray An array of instants
+    /// @return An array of COEs, in GCRF
+    Array<COE> getCOEsAt(const Array<Instant>& anInstantArray) const;
+
+    /// @brief Get an orbital frame
+    ///
+    /// Orbital frames are generated once per orbit (and shared by its copies), and are not registered in the global
+    /// frame manager, hence cannot be accessed by name. They remain valid after the orbit is destructed.
+    ///
+    /// @param aFrameType A frame type
+    /// @return Shared pointer to the orbital frame
     Shared<const Frame> getOrbitalFrame(const Orbit::FrameType& aFrameType) const;
 
     virtual void print(std::ostream& anOutputStream, bool displayDecorator = true) const override;
@@ -193,22 +286,111 @@ class Orbit : public Trajectory
         const Angle& anArgumentOfLatitude = Angle::Zero()
     );
 
+    /// @brief Constructs Sun-synchronous orbits, for design sweeps
+    ///
+    ///              Model: Kepler (J2 Perturbation).
+    ///
+    /// The inclination is computed in closed form for each altitude, and the Sun position and equation of time are
+    /// computed once for the epoch. Orbits match those of the single orbit constructor.
+    ///
+    /// @code{.cpp}
+    ///              Array<Orbit> orbits = Orbit::SunSynchronous(epoch, {Length::Kilometers(500.0),
+    ///              Length::Kilometers(600.0)}, {Time(10, 30, 0), Time(22, 30, 0)}, earthSPtr) ;
+    /// @endcode
+    ///
+    /// @param anEpoch An orbit epoch
+    /// @param anAltitudeArray An array of orbit altitudes (wrt. equatorial radius)
+    /// @param aLocalTimeAtDescendingNodeArray An array of local times at descending node, of the same size
+    /// @param aCelestialObjectSPtr A shared pointer to a central celestial body
+    /// @param anArgumentOfLatitude An argument of latitude
+    /// @return Array of Sun-synchronous orbits
+    static Array<Orbit> SunSynchronous(
+        const Instant& anEpoch,
+        const Array<Length>& anAltitudeArray,
+        const Array<Time>& aLocalTimeAtDescendingNodeArray,
+        const Shared<const Celestial>& aCelestialObjectSPtr,
+        const Angle& anArgumentOfLatitude = Angle::Zero()
+    );
+
+    /// @brief Constructs a circular repeat ground track orbit
+    ///
+    ///              Model: Kepler (J2 Perturbation).
+    ///
+    /// The semi-major axis is solved for, so that the ground track repeats after a number of revolutions (nodal
+    /// periods) in a number of days (relative to the orbit plane), under the J2 secular rates. The solve starts from
+    /// the unperturbed closed-form semi-major axis.
+    ///
+    /// @param anEpoch An orbit epoch
+    /// @param aRevolutionCount A strictly positive number of revolutions per cycle
+    /// @param aDayCount A strictly positive number of days per cycle
+    /// @param anInclination An orbit inclination
+    /// @param aCelestialObjectSPtr A shared pointer to a central celestial body (Earth only)
+    /// @param aRaan A right ascension of the ascending node
+    /// @param anArgumentOfLatitude An argument of latitude
+    /// @return Repeat ground track orbit
+    static Orbit RepeatGroundTrack(
+        const Instant& anEpoch,
+        const Integer& aRevolutionCount,
+        const Integer& aDayCount,
+        const Angle& anInclination,
+        const Shared<const Celestial>& aCelestialObjectSPtr,
+        const Angle& aRaan = Angle::Zero(),
+        const Angle& anArgumentOfLatitude = Angle::Zero()
+    );
+
     static String StringFromFrameType(const Orbit::FrameType& aFrameType);
 
     static Array<Pair<Index, Pass>> ComputePasses(
         const Array<State>& aStateArray, const Integer& anInitialRevolutionNumber
     );
 
+    /// @brief Compute passes from a set of states, in parallel
+    ///
+    /// Crossings are located concurrently over chunks of consecutive states, and refined on the cubic Hermite
+    /// interpolant of the two states around each crossing (from their positions and velocities), without building an
+    /// interpolator over the whole array. Passes are then numbered sequentially. Passes match those of the sequential
+    /// computation, within the interpolation error (well below a millisecond for LEO states a minute apart).
+    ///
+    /// @code{.cpp}
+    ///              Array<Pair<Index, Pass>> passes = Orbit::ComputePasses(states, 1, ExecutionContext(4)) ;
+    /// @endcode
+    ///
+    /// @param aStateArray An array of states, in chronological order
+    /// @param anInitialRevolutionNumber An initial revolution number
+    /// @param anExecutionContext An execution context
+    /// @return Array of (state index, pass) pairs, the index being that of the state following the pass end
+    static Array<Pair<Index, Pass>> ComputePasses(
+        const Array<State>& aStateArray,
+        const Integer& anInitialRevolutionNumber,
+        const ExecutionContext& anExecutionContext
+    );
+
    private:
     const orbit::Model* modelPtr_;
 
     Shared<const Celestial> celestialObjectSPtr_;
 
-    mutable std::mutex mutex_;
-    mutable Map<Integer, Pass> passMap_;
+    /// @brief Pass cache and orbital frames, shared by the copies of an orbit
+    ///
+    /// The orbital frames are not registered in the global frame manager: they are held here, and live for as long as
+    /// a copy of the orbit or a user holds them.
+    struct Cache
+    {
+        std::shared_mutex passMutex;  // Guards the passes: shared for lookups, exclusive for insertions
+        Map<Integer, Pass> passMap;
+
+        std::mutex frameMutex;  // Guards the frames
+        Map<Orbit::FrameType, Shared<const Frame>> frameMap;
+    };
+
+    Shared<Cache> cacheSPtr_;
 
     String generateFrameName(const Orbit::FrameType& aFrameType) const;
 
+    void cachePasses(const Map<Integer, Pass>& aPassMap) const;
+
+    Pass getClosestPass(const Integer& aRevolutionNumber) const;
+
     /// @brief Find the Instant at which the return value of `getValue` crosses zero.
     /// Use a bisection search to find the Instant between `previousInstant` and `nextInstant` at which the return value
     /// of `getValue` crosses zero.
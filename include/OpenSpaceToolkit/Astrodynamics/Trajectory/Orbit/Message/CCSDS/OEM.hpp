@@ -0,0 +1,287 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Message_CCSDS_OEM__
+#define __OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Message_CCSDS_OEM__
+
+#include <fstream>
+#include <string>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Integer.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Model/Tabulated.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+#define DEFAULT_OEM_CHUNK_SIZE 4096
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace trajectory
+{
+namespace orbit
+{
+namespace message
+{
+namespace ccsds
+{
+
+using ostk::core::container::Array;
+using ostk::core::filesystem::File;
+using ostk::core::type::Index;
+using ostk::core::type::Integer;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+using ostk::core::type::String;
+
+using ostk::mathematics::curvefitting::Interpolator;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+
+using ostk::astrodynamics::trajectory::model::Tabulated;
+using ostk::astrodynamics::trajectory::Propagator;
+using ostk::astrodynamics::trajectory::State;
+
+/// @brief CCSDS Orbit Ephemeris Message (OEM), KVN format
+///
+///                      CCSDS_OEM_VERS = 2.0
+///                      CREATION_DATE = 2018-01-01T00:00:00.000
+///                      ORIGINATOR = XXX
+///
+///                      META_START
+///                      OBJECT_NAME = XXX
+///                      OBJECT_ID = 2018-001A
+///                      CENTER_NAME = EARTH
+///                      REF_FRAME = GCRF
+///                      TIME_SYSTEM = UTC
+///                      START_TIME = 2018-01-01T00:00:00.000
+///                      STOP_TIME = 2018-01-02T00:00:00.000
+///                      META_STOP
+///
+///                      2018-01-01T00:00:00.000 X Y Z X_DOT Y_DOT Z_DOT
+///
+/// Positions and velocities are read and written in [km] and [km/s]. Optional accelerations are ignored, and
+/// covariance blocks are skipped.
+///
+/// Large ephemerides are handled with OEM::Writer and OEM::Reader, which stream states to and from disk one chunk at
+/// a time instead of holding the whole message.
+///
+/// @ref                        https://public.ccsds.org/Pubs/502x0b3e1.pdf
+class OEM
+{
+   public:
+    struct Header
+    {
+        String version;
+        Instant creationDate;
+        String originator;
+    };
+
+    struct Metadata
+    {
+        String objectName;
+        String objectId;
+        String centerName;
+        String referenceFrame;  // GCRF, ICRF, EME2000, ITRF or TEME
+        String timeSystem;      // UTC, TAI, TT, GPS, TDB, TCB, TCG or UT1
+        Instant startTime;
+        Instant stopTime;
+    };
+
+    struct Segment
+    {
+        OEM::Metadata metadata;
+        Array<State> states;
+    };
+
+    /// @brief Streaming OEM writer
+    ///
+    ///                      States are formatted into a buffer, flushed to disk every chunk of states, so that the
+    ///                      ephemeris never has to be held in memory.
+    ///
+    /// @code{.cpp}
+    ///              OEM::Writer writer = { aFile, header } ;
+    ///              writer.writeMetadata(metadata) ;
+    ///              writer.write(propagator, initialState, instants) ;
+    ///              writer.close() ;
+    /// @endcode
+    class Writer
+    {
+       public:
+        /// @brief Constructor, writes the header
+        ///
+        /// @param aFile An output file
+        /// @param aHeader A header
+        /// @param aChunkSize (optional) A number of states written to disk at once
+        Writer(const File& aFile, const OEM::Header& aHeader, const Size& aChunkSize = DEFAULT_OEM_CHUNK_SIZE);
+
+        Writer(const Writer&) = delete;
+
+        Writer& operator=(const Writer&) = delete;
+
+        /// @brief Destructor, closes the writer
+        ~Writer();
+
+        /// @brief Check if writer is open
+        ///
+        /// @return True if writer is open
+        bool isOpen() const;
+
+        /// @brief Start a new segment
+        ///
+        /// @param aMetadata A segment metadata
+        void writeMetadata(const OEM::Metadata& aMetadata);
+
+        /// @brief Write a state to the current segment
+        ///
+        /// @param aState A state, converted to the segment reference frame
+        void write(const State& aState);
+
+        /// @brief Write an array of states to the current segment
+        ///
+        /// @param aStateArray An array of states, converted to the segment reference frame
+        void write(const Array<State>& aStateArray);
+
+        /// @brief Propagate a state and write the propagated states to the current segment, one chunk at a time
+        ///
+        /// @code{.cpp}
+        ///              writer.write(propagator, initialState, interval.generateGrid(Duration::Seconds(1.0))) ;
+        /// @endcode
+        ///
+        /// @param aPropagator A propagator
+        /// @param aState An initial state
+        /// @param anInstantArray An array of instants, in chronological order
+        void write(const Propagator& aPropagator, const State& aState, const Array<Instant>& anInstantArray);
+
+        /// @brief Flush buffered states and close the file
+        void close();
+
+       private:
+        std::ofstream stream_;
+        std::string buffer_;
+        Size chunkSize_;
+        Size bufferedStateCount_;
+        Shared<const Frame> frameSPtr_;
+        Scale scale_;
+
+        void flush();
+    };
+
+    /// @brief Streaming OEM reader
+    ///
+    ///                      Segments are read one after the other, and their states one chunk at a time.
+    ///
+    /// @code{.cpp}
+    ///              OEM::Reader reader = { aFile } ;
+    ///              while (reader.readMetadata())
+    ///              {
+    ///                  Tabulated tabulated = reader.readTabulated() ;
+    ///              }
+    /// @endcode
+    class Reader
+    {
+       public:
+        /// @brief Constructor, reads the header
+        ///
+        /// @param aFile An input file
+        Reader(const File& aFile);
+
+        Reader(const Reader&) = delete;
+
+        Reader& operator=(const Reader&) = delete;
+
+        /// @brief Get header
+        ///
+        /// @return Header
+        OEM::Header getHeader() const;
+
+        /// @brief Get current segment metadata
+        ///
+        /// @return Current segment metadata
+        OEM::Metadata getMetadata() const;
+
+        /// @brief Advance to the next segment, skipping any unread state of the current segment
+        ///
+        /// @return True if a segment was read, false at the end of the file
+        bool readMetadata();
+
+        /// @brief Read the next states of the current segment
+        ///
+        /// @param aMaximumCount A maximum number of states
+        /// @return Array of states, empty once the segment is exhausted
+        Array<State> readStates(const Size& aMaximumCount = DEFAULT_OEM_CHUNK_SIZE);
+
+        /// @brief Read the remaining states of the current segment into a tabulated model
+        ///
+        /// @param (optional) anInterpolationType An interpolation type
+        /// @return Tabulated model
+        Tabulated readTabulated(
+            const Interpolator::Type& anInterpolationType = DEFAULT_TABULATED_TRAJECTORY_INTERPOLATION_TYPE
+        );
+
+       private:
+        std::ifstream stream_;
+        String path_;
+        Index lineIndex_;
+        OEM::Header header_;
+        OEM::Metadata metadata_;
+        Shared<const Frame> frameSPtr_;
+        Scale scale_;
+        bool hasMetadata_;
+        bool isSegmentExhausted_;
+        bool isMetadataPending_;
+
+        bool readLine(std::string& aLine);
+    };
+
+    OEM(const OEM::Header& aHeader, const Array<OEM::Segment>& aSegmentArray);
+
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const OEM& anOEM);
+
+    bool isDefined() const;
+
+    OEM::Header getHeader() const;
+
+    Array<OEM::Segment> getSegments() const;
+
+    OEM::Segment getSegmentAt(const Index& anIndex) const;
+
+    void print(std::ostream& anOutputStream, bool displayDecorator = true) const;
+
+    /// @brief Write message to file
+    ///
+    /// @param aFile An output file
+    void save(const File& aFile) const;
+
+    static OEM Undefined();
+
+    static OEM Load(const File& aFile);
+
+   private:
+    OEM::Header header_;
+    Array<OEM::Segment> segments_;
+};
+
+}  // namespace ccsds
+}  // namespace message
+}  // namespace orbit
+}  // namespace trajectory
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
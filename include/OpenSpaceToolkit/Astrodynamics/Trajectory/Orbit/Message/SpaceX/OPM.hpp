@@ -9,14 +9,19 @@
 #include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Velocity.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 #include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
 #include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
 
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
 
 namespace ostk
@@ -39,15 +44,20 @@ using ostk::core::filesystem::File;
 using ostk::core::type::Index;
 using ostk::core::type::Integer;
 using ostk::core::type::Real;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 
 using ostk::physics::coordinate::Position;
 using ostk::physics::coordinate::Velocity;
+using ostk::physics::environment::object::Celestial;
 using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 using ostk::physics::unit::Angle;
 using ostk::physics::unit::Length;
 
+using ostk::astrodynamics::trajectory::Orbit;
+using ostk::astrodynamics::trajectory::Propagator;
 using ostk::astrodynamics::trajectory::State;
 
 /// @brief SpaceX Orbital Parameter Message (OPM)
@@ -122,6 +132,50 @@ class OPM
 
     OPM::Deployment getDeploymentWithName(const String& aName) const;
 
+    /// @brief Get the deployment states
+    ///
+    /// @return Array of states, in the order of the deployments
+    Array<State> toStates() const;
+
+    /// @brief Propagate all deployments to an instant, as a batch
+    ///
+    /// Deployment states are propagated in parallel, with Propagator::calculateStatesAt.
+    ///
+    /// @code{.cpp}
+    ///              Array<State> states = opm.calculateStatesAt(propagator, anInstant) ;
+    /// @endcode
+    ///
+    /// @param aPropagator A propagator
+    /// @param anInstant An instant
+    /// @param aThreadCount (optional) A worker thread count (0 defaults to the default thread count of
+    /// ExecutionContext)
+    /// @return Array of states, in the order of the deployments
+    Array<State> calculateStatesAt(
+        const Propagator& aPropagator, const Instant& anInstant, const Size& aThreadCount = 0
+    ) const;
+
+    /// @brief Generate the orbits of all deployments, propagated to an analysis horizon as a batch
+    ///
+    /// Each orbit uses a propagated model, whose cache is seeded with the deployment state and the state at the
+    /// horizon.
+    ///
+    /// @code{.cpp}
+    ///              Array<Orbit> orbits = opm.generateOrbits(propagator, earthSPtr, anInstant) ;
+    /// @endcode
+    ///
+    /// @param aPropagator A propagator
+    /// @param aCelestialObjectSPtr A celestial object
+    /// @param anInstant An analysis horizon
+    /// @param aThreadCount (optional) A worker thread count (0 defaults to the default thread count of
+    /// ExecutionContext)
+    /// @return Array of orbits, in the order of the deployments
+    Array<Orbit> generateOrbits(
+        const Propagator& aPropagator,
+        const Shared<const Celestial>& aCelestialObjectSPtr,
+        const Instant& anInstant,
+        const Size& aThreadCount = 0
+    ) const;
+
     void print(std::ostream& anOutputStream, bool displayDecorator = true) const;
 
     static OPM Undefined();
@@ -20,6 +20,7 @@ namespace orbit
 {
 
 using ostk::core::type::Integer;
+using ostk::core::type::Real;
 
 using ostk::physics::time::Instant;
 
@@ -44,7 +45,40 @@ class Model : public virtual ostk::astrodynamics::trajectory::Model
 
     virtual Integer calculateRevolutionNumberAt(const Instant& anInstant) const = 0;  // [TBR]
 
+    /// @brief Estimate the instant of the ascending node starting a given revolution
+    ///
+    /// Analytic initial guess, which the orbit pass computation refines locally. The default implementation provides
+    /// no estimate.
+    ///
+    /// @param aRevolutionNumber A revolution number
+    /// @return Estimated instant, undefined if the model provides no estimate
+    virtual Instant estimateAscendingNodeInstant(const Integer& aRevolutionNumber) const;
+
     virtual void print(std::ostream& anOutputStream, bool displayDecorator = true) const = 0;
+
+   protected:
+    /// @brief Estimate the duration from epoch to the ascending node starting a given revolution
+    ///
+    /// Solves (n + aop_dot) * t + n_dot * t^2 / 2 = phase for the mean argument of latitude, where the phase accounts
+    /// for the equation of center at the ascending node, as the argument of perigee drifts.
+    ///
+    /// @param aRevolutionCount A number of revolutions since the revolution at epoch
+    /// @param anEccentricity An eccentricity at epoch
+    /// @param anAop An argument of perigee at epoch [rad]
+    /// @param aMeanAnomaly A mean anomaly at epoch [rad]
+    /// @param aMeanMotion A mean motion [rad/s]
+    /// @param anAopRate A secular rate of the argument of perigee [rad/s]
+    /// @param aMeanMotionRate A first time derivative of the mean motion [rad/s^2]
+    /// @return Duration from epoch [s], undefined if the ascending node is never reached
+    static Real EstimateAscendingNodeDurationFromEpoch(
+        const Integer& aRevolutionCount,
+        const Real& anEccentricity,
+        const Real& anAop,
+        const Real& aMeanAnomaly,
+        const Real& aMeanMotion,
+        const Real& anAopRate,
+        const Real& aMeanMotionRate
+    );
 };
 
 }  // namespace orbit
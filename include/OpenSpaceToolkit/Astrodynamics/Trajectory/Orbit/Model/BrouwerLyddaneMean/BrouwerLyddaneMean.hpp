@@ -3,9 +3,13 @@
 #ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_BrouwerLyddaneMean_BrouwerLyddaneMean__
 #define __OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_BrouwerLyddaneMean_BrouwerLyddaneMean__
 
+#include <functional>
+
 #include <OpenSpaceToolkit/Core/Container/Pair.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
@@ -18,6 +22,7 @@
 #include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
 #include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
 
+#include <OpenSpaceToolkit/Astrodynamics/ExecutionContext.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler/COE.hpp>
 
 namespace ostk
@@ -34,8 +39,10 @@ namespace blm
 {
 
 using ostk::core::container::Pair;
+using ostk::core::type::Index;
 using ostk::core::type::Real;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 
 using ostk::mathematics::object::Vector6d;
@@ -48,6 +55,7 @@ using ostk::physics::unit::Angle;
 using ostk::physics::unit::Derived;
 using ostk::physics::unit::Length;
 
+using ostk::astrodynamics::ExecutionContext;
 using ostk::astrodynamics::trajectory::orbit::model::kepler::COE;
 
 /// @brief Brouwer-Lyddane Mean Orbital Elements. Short and/or secular periodic variations are
@@ -114,6 +122,17 @@ class BrouwerLyddaneMean : public COE
         const Derived &aGravitationalParameter,
         std::function<Vector6d(const Vector6d &)> toCOEVector
     );
+
+    /// @brief Apply a function to each index of a batch, split in chunks across the workers of an execution context
+    ///
+    /// @param aBatchSize A batch size
+    /// @param anExecutionContext An execution context
+    /// @param aFunction A function, called with the index of each element of the batch
+    static void ForEachInBatch(
+        const Size &aBatchSize,
+        const ExecutionContext &anExecutionContext,
+        const std::function<void(const Index &)> &aFunction
+    );
 };
 
 }  // namespace blm
@@ -3,9 +3,11 @@
 #ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Kepler_BrouwerLyddaneMeanShort__
 #define __OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Kepler_BrouwerLyddaneMeanShort__
 
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Pair.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
@@ -34,9 +36,11 @@ namespace model
 namespace blm
 {
 
+using ostk::core::container::Array;
 using ostk::core::container::Pair;
 using ostk::core::type::Real;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 
 using ostk::mathematics::object::Vector6d;
@@ -95,6 +99,52 @@ class BrouwerLyddaneMeanShort : public BrouwerLyddaneMean
         const COE::CartesianState &aCartesianState, const Derived &aGravitationalParameter
     );
 
+    /// @brief Construct a set of BrouwerLyddaneMeanShort from cartesian states
+    ///
+    /// Element sets are converted independently, in chunks spread across worker threads.
+    ///
+    /// @param aCartesianStateArray An array of cartesian states
+    /// @param aGravitationalParameter A gravitational parameter
+    /// @param aThreadCount A number of worker threads, 0 to use the default thread count of ExecutionContext
+    /// @return An array of BrouwerLyddaneMeanShort
+    static Array<BrouwerLyddaneMeanShort> FromCartesianStates(
+        const Array<COE::CartesianState> &aCartesianStateArray,
+        const Derived &aGravitationalParameter,
+        const Size &aThreadCount = 0
+    );
+
+    /// @brief Construct a set of BrouwerLyddaneMeanShort from cartesian states, within an execution context
+    ///
+    /// @param aCartesianStateArray An array of cartesian states
+    /// @param aGravitationalParameter A gravitational parameter
+    /// @param anExecutionContext An execution context
+    /// @return An array of BrouwerLyddaneMeanShort
+    static Array<BrouwerLyddaneMeanShort> FromCartesianStates(
+        const Array<COE::CartesianState> &aCartesianStateArray,
+        const Derived &aGravitationalParameter,
+        const ExecutionContext &anExecutionContext
+    );
+
+    /// @brief Convert a set of BrouwerLyddaneMeanShort to COE
+    ///
+    /// Element sets are converted independently, in chunks spread across worker threads.
+    ///
+    /// @param anElementSetArray An array of BrouwerLyddaneMeanShort
+    /// @param aThreadCount A number of worker threads, 0 to use the default thread count of ExecutionContext
+    /// @return An array of COE
+    static Array<classicalOE> ToCOEs(
+        const Array<BrouwerLyddaneMeanShort> &anElementSetArray, const Size &aThreadCount = 0
+    );
+
+    /// @brief Convert a set of BrouwerLyddaneMeanShort to COE, within an execution context
+    ///
+    /// @param anElementSetArray An array of BrouwerLyddaneMeanShort
+    /// @param anExecutionContext An execution context
+    /// @return An array of COE
+    static Array<classicalOE> ToCOEs(
+        const Array<BrouwerLyddaneMeanShort> &anElementSetArray, const ExecutionContext &anExecutionContext
+    );
+
     /// @brief Construct an undefined BrouwerLyddaneMeanShort
     ///
     /// @return Undefined BrouwerLyddaneMeanLong
@@ -105,6 +155,12 @@ class BrouwerLyddaneMeanShort : public BrouwerLyddaneMean
     ///
     /// @param aVector A vector
     static BrouwerLyddaneMeanShort FromSIVector(const Vector6d &aVector);
+
+    /// @brief Convert a mean elements vector to an osculating COE vector, both in SI units with mean anomaly
+    ///
+    /// @param aVector A mean elements vector
+    /// @return An osculating COE vector
+    static Vector6d ToCOEVector(const Vector6d &aVector);
 };
 
 }  // namespace blm
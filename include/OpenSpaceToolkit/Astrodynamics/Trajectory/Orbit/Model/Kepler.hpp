@@ -3,10 +3,13 @@
 #ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Kepler__
 #define __OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Kepler__
 
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
 #include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 #include <OpenSpaceToolkit/Physics/Unit/Derived.hpp>
@@ -27,6 +30,7 @@ namespace orbit
 namespace model
 {
 
+using ostk::core::container::Array;
 using ostk::core::type::Integer;
 using ostk::core::type::Real;
 using ostk::core::type::String;
@@ -99,8 +103,43 @@ class Kepler : public ostk::astrodynamics::trajectory::orbit::Model
 
     virtual State calculateStateAt(const Instant& anInstant) const override;
 
+    /// @brief Calculate the states at a set of instants
+    ///
+    /// The secular rates are computed once, and Kepler's equation is solved over the whole instant array at once
+    /// (see COE::TrueAnomaliesFromMeanAnomalies), without building intermediate COE objects.
+    ///
+    /// @param anInstantArray An array of instants
+    /// @return Array of states, in GCRF
+    virtual Array<State> calculateStatesAt(const Array<Instant>& anInstantArray) const override;
+
+    /// @brief Calculate the ephemeris at a set of instants
+    ///
+    /// Positions and velocities are written directly into the ephemeris, as computed by `calculateStatesAt`.
+    ///
+    /// @param anInstantArray An array of instants
+    /// @return Ephemeris, in GCRF
+    virtual Ephemeris calculateEphemerisAt(const Array<Instant>& anInstantArray) const override;
+
+    /// @brief Calculate the classical orbital elements at a set of instants
+    ///
+    /// Elements are propagated as by `calculateStatesAt` (secular rates, and Kepler's equation solved over the whole
+    /// instant array at once), without going through cartesian states.
+    ///
+    /// @param anInstantArray An array of instants
+    /// @return Array of COEs, in GCRF
+    Array<COE> calculateCOEsAt(const Array<Instant>& anInstantArray) const;
+
     virtual Integer calculateRevolutionNumberAt(const Instant& anInstant) const override;  // [TBR] ?
 
+    /// @brief Estimate the instant of the ascending node starting a given revolution
+    ///
+    /// The mean argument of latitude is advanced at its secular rate, from its value at epoch to the one at the
+    /// ascending node. Undefined for non-elliptic orbits.
+    ///
+    /// @param aRevolutionNumber A revolution number
+    /// @return Estimated instant
+    virtual Instant estimateAscendingNodeInstant(const Integer& aRevolutionNumber) const override;
+
     virtual void print(std::ostream& anOutputStream, bool displayDecorator = true) const override;
 
     static String StringFromPerturbationType(const Kepler::PerturbationType& aPerturbationType);
@@ -119,6 +158,25 @@ class Kepler : public ostk::astrodynamics::trajectory::orbit::Model
     Real j4_;
     Kepler::PerturbationType perturbationType_;
 
+    struct SecularRates
+    {
+        Real meanMotion;
+        Real raanRate;
+        Real aopRate;
+    };
+
+    struct PropagatedAnomalies
+    {
+        ostk::mathematics::object::VectorXd durationsFromEpoch_s;
+        ostk::mathematics::object::VectorXd trueAnomalies_rad;
+    };
+
+    Kepler::SecularRates calculateSecularRates() const;
+
+    Kepler::PropagatedAnomalies propagateAnomalies(
+        const Array<Instant>& anInstantArray, const Kepler::SecularRates& aSecularRates
+    ) const;
+
     static COE InertialCoeFromFixedCoe(
         const COE& aClassicalOrbitalElementSet, const Instant& anEpoch, const Celestial& aCelestialObject
     );
@@ -137,6 +195,21 @@ class Kepler : public ostk::astrodynamics::trajectory::orbit::Model
         const Instant& anInstant
     );
 
+    static Kepler::SecularRates CalculateJ2SecularRates(
+        const COE& aClassicalOrbitalElementSet,
+        const Derived& aGravitationalParameter,
+        const Length& anEquatorialRadius,
+        const Real& aJ2
+    );
+
+    static Kepler::SecularRates CalculateJ4SecularRates(
+        const COE& aClassicalOrbitalElementSet,
+        const Derived& aGravitationalParameter,
+        const Length& anEquatorialRadius,
+        const Real& aJ2,
+        const Real& aJ4
+    );
+
     static State CalculateJ2StateAt(
         const COE& aClassicalOrbitalElementSet,
         const Instant& anEpoch,
@@ -3,11 +3,15 @@
 #ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Kepler_COE__
 #define __OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Kepler_COE__
 
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Pair.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
@@ -31,12 +35,17 @@ namespace model
 namespace kepler
 {
 
+using ostk::core::container::Array;
 using ostk::core::container::Pair;
+using ostk::core::filesystem::File;
 using ostk::core::type::Real;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 
+using ostk::mathematics::object::MatrixXd;
 using ostk::mathematics::object::Vector6d;
+using ostk::mathematics::object::VectorXd;
 
 using ostk::physics::coordinate::Frame;
 using ostk::physics::coordinate::Position;
@@ -241,6 +250,55 @@ class COE
     /// @return COE
     static COE Cartesian(const COE::CartesianState& aCartesianState, const Derived& aGravitationalParameter);
 
+    /// @brief Convert a cartesian state vector to a COE vector, in SI units
+    ///
+    /// Unit-free counterpart of COE::Cartesian, intended for hot paths that already hold raw coordinates.
+    ///
+    /// @param aCartesianVector A cartesian state vector [x, y, z, vx, vy, vz] in meters and meters per second
+    /// @param aGravitationalParameter_SI A gravitational parameter in m^3/s^2
+    /// @return COE vector [a, e, i, raan, aop, true anomaly] in meters and radians
+    static Vector6d CartesianToSIVector(const Vector6d& aCartesianVector, const Real& aGravitationalParameter_SI);
+
+    /// @brief Convert a COE vector, in SI units, to a cartesian state vector
+    ///
+    /// Unit-free counterpart of COE::getCartesianState.
+    ///
+    /// @param aCOEVector A COE vector [a, e, i, raan, aop, true anomaly] in meters and radians
+    /// @param aGravitationalParameter_SI A gravitational parameter in m^3/s^2
+    /// @return Cartesian state vector [x, y, z, vx, vy, vz] in meters and meters per second
+    static Vector6d SIVectorToCartesian(const Vector6d& aCOEVector, const Real& aGravitationalParameter_SI);
+
+    /// @brief Convert cartesian state vectors to COE vectors, in SI units, row-wise
+    ///
+    /// Array counterpart of COE::CartesianToSIVector. Anomalies other than the true anomaly are derived for the
+    /// whole array at once, and are only defined for elliptic orbits.
+    ///
+    /// @param aCartesianMatrix Cartesian state vectors [x, y, z, vx, vy, vz] in meters and meters per second, as a
+    /// N x 6 matrix
+    /// @param aGravitationalParameter_SI A gravitational parameter in m^3/s^2
+    /// @param (optional) anAnomalyType The anomaly type of the last COE column
+    /// @return COE vectors [a, e, i, raan, aop, anomaly] in meters and radians, as a N x 6 matrix
+    static MatrixXd CartesiansToSIVectors(
+        const MatrixXd& aCartesianMatrix,
+        const Real& aGravitationalParameter_SI,
+        const AnomalyType& anAnomalyType = AnomalyType::True
+    );
+
+    /// @brief Convert COE vectors, in SI units, to cartesian state vectors, row-wise
+    ///
+    /// Array counterpart of COE::SIVectorToCartesian. Mean anomalies are converted with the vectorized Kepler solver
+    /// (COE::TrueAnomaliesFromMeanAnomalies), and are only supported for elliptic orbits, as are eccentric anomalies.
+    ///
+    /// @param aCOEMatrix COE vectors [a, e, i, raan, aop, anomaly] in meters and radians, as a N x 6 matrix
+    /// @param aGravitationalParameter_SI A gravitational parameter in m^3/s^2
+    /// @param (optional) anAnomalyType The anomaly type of the last COE column
+    /// @return Cartesian state vectors [x, y, z, vx, vy, vz] in meters and meters per second, as a N x 6 matrix
+    static MatrixXd SIVectorsToCartesians(
+        const MatrixXd& aCOEMatrix,
+        const Real& aGravitationalParameter_SI,
+        const AnomalyType& anAnomalyType = AnomalyType::True
+    );
+
     /// @brief Construct a COE from a vector
     ///
     /// @param aCOEVector A vector
@@ -248,6 +306,29 @@ class COE
     /// @return COE
     static COE FromSIVector(const Vector6d& aCOEVector, const AnomalyType& anAnomalyType);
 
+    /// @brief Save a set of COEs to a binary snapshot file
+    ///
+    /// The snapshot is made of a versioned header followed by fixed size records. Elements are stored in their own
+    /// units, so that a reloaded set compares equal to the saved one.
+    ///
+    /// @code{.cpp}
+    ///                  COE::SaveSnapshot(coes, File::Path(Path::Parse("/path/to/catalog.coes")));
+    /// @endcode
+    ///
+    /// @param aCOEArray An array of COEs
+    /// @param aFile A file
+    static void SaveSnapshot(const Array<COE>& aCOEArray, const File& aFile);
+
+    /// @brief Load a set of COEs from a binary snapshot file
+    ///
+    /// @code{.cpp}
+    ///                  Array<COE> coes = COE::LoadSnapshot(File::Path(Path::Parse("/path/to/catalog.coes")));
+    /// @endcode
+    ///
+    /// @param aFile A file
+    /// @return Array of COEs, in the order they were saved
+    static Array<COE> LoadSnapshot(const File& aFile);
+
     /// @brief Convert True anomaly to Eccentric anomaly
     ///
     /// @param aTrueAnomaly A true anomaly
@@ -289,6 +370,31 @@ class COE
         const Angle& aMeanAnomly, const Real& anEccentricity, const Real& aTolerance
     );
 
+    /// @brief Convert Mean anomalies to Eccentric anomalies, element-wise
+    ///
+    /// Array counterpart of EccentricAnomalyFromMeanAnomaly, for elliptic orbits. Kepler's equation is solved with
+    /// the same starter and third order corrections, but for a fixed iteration count and without branching, so that
+    /// the whole array is processed with vectorized arithmetic. The default iteration count converges to machine
+    /// precision for eccentricities up to 0.999.
+    ///
+    /// @param aMeanAnomalyVector Mean anomalies [rad]
+    /// @param anEccentricityVector Eccentricities, either one per mean anomaly or a single one for all
+    /// @param anIterationCount (optional) An iteration count
+    /// @return Eccentric anomalies [rad], in [0, 2pi)
+    static VectorXd EccentricAnomaliesFromMeanAnomalies(
+        const VectorXd& aMeanAnomalyVector, const VectorXd& anEccentricityVector, const Size& anIterationCount = 5
+    );
+
+    /// @brief Convert Mean anomalies to True anomalies, element-wise
+    ///
+    /// @param aMeanAnomalyVector Mean anomalies [rad]
+    /// @param anEccentricityVector Eccentricities, either one per mean anomaly or a single one for all
+    /// @param anIterationCount (optional) An iteration count
+    /// @return True anomalies [rad], in [0, 2pi)
+    static VectorXd TrueAnomaliesFromMeanAnomalies(
+        const VectorXd& aMeanAnomalyVector, const VectorXd& anEccentricityVector, const Size& anIterationCount = 5
+    );
+
     /// @brief Compute the semi-latus rectum of the orbit.
     ///
     /// @param aSemiMajorAxis Semi-major axis of the orbit in meters.
@@ -3,10 +3,14 @@
 #ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagated__
 #define __OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagated__
 
+#include <mutex>
+
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model.hpp>
@@ -28,7 +32,9 @@ namespace model
 using ostk::core::container::Array;
 using ostk::core::type::Integer;
 using ostk::core::type::Real;
+using ostk::core::type::Size;
 
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 
 using ostk::astrodynamics::trajectory::orbit::Model;
@@ -40,6 +46,27 @@ using ostk::astrodynamics::trajectory::state::NumericalSolver;
 class Propagated : public ostk::astrodynamics::trajectory::orbit::Model
 {
    public:
+    /// @brief Policy bounding the cached state array
+    ///
+    /// Anchor states (those provided at construction or through setCachedStateArray) are always kept. States added
+    /// through addCachedState are evicted, least recently queried first, when the cache exceeds a bound.
+    struct CachePolicy
+    {
+        /// @brief Constructor
+        ///
+        /// @param aMaximumStateCount A maximum cached state count (0 for unbounded)
+        /// @param aMaximumMemorySize A maximum (estimated) cache memory size in bytes (0 for unbounded)
+        CachePolicy(const Size& aMaximumStateCount = 0, const Size& aMaximumMemorySize = 0);
+
+        /// @brief Unbounded cache policy
+        ///
+        /// @return CachePolicy
+        static CachePolicy Unbounded();
+
+        Size maximumStateCount;  ///< Maximum cached state count (0 for unbounded)
+        Size maximumMemorySize;  ///< Maximum (estimated) cache memory size in bytes (0 for unbounded)
+    };
+
     /// @brief Constructor
     ///
     /// @code{.cpp}
@@ -68,6 +95,17 @@ class Propagated : public ostk::astrodynamics::trajectory::orbit::Model
         const Propagator& aPropagator, const Array<State>& aCachedStateArray, const Integer& aRevolutionNumber = 1
     );
 
+    /// @brief Copy constructor
+    ///
+    /// @param aPropagatedModel A propagated model
+    Propagated(const Propagated& aPropagatedModel);
+
+    /// @brief Copy assignment operator
+    ///
+    /// @param aPropagatedModel A propagated model
+    /// @return Reference to propagated model
+    Propagated& operator=(const Propagated& aPropagatedModel);
+
     /// @brief Clone propagated
     ///
     /// @return Pointer to cloned propagated
@@ -126,7 +164,7 @@ class Propagated : public ostk::astrodynamics::trajectory::orbit::Model
 
     /// @brief Calculate the state at an instant, utilizing internal cached state array to propagated
     /// shortest amount of time. Does not have macro-level sorting optimization, should not be used with disorded
-    /// instant array
+    /// instant array. Windows between cached states are processed serially.
 
     /// @code{.cpp}
     ///              Array<State> states = propagated.calculateStatesAt(anInstantArray) ;
@@ -136,6 +174,19 @@ class Propagated : public ostk::astrodynamics::trajectory::orbit::Model
     /// @return Array<State>
     virtual Array<State> calculateStatesAt(const Array<Instant>& anInstantArray) const override;
 
+    /// @brief Calculate the states at an instant array, utilizing internal cached state array to propagated
+    /// shortest amount of time. The windows between consecutive cached states are independent, and are processed in
+    /// parallel using a pool of worker threads. Dynamics are shared between workers, hence must be safe to evaluate
+    /// concurrently. Called from a worker of a parallel operation, windows are processed serially on that worker.
+    ///
+    /// @code{.cpp}
+    ///              Array<State> states = propagated.calculateStatesAt(anInstantArray, aThreadCount) ;
+    /// @endcode
+    /// @param anInstantArray A sorted instant array
+    /// @param aThreadCount A worker thread count (0 defaults to the default thread count of ExecutionContext)
+    /// @return Array<State>, in the order of the instants
+    Array<State> calculateStatesAt(const Array<Instant>& anInstantArray, const Size& aThreadCount) const;
+
     /// @brief Calculate the revolution number at an instant
     ///
     /// @code{.cpp}
@@ -147,12 +198,23 @@ class Propagated : public ostk::astrodynamics::trajectory::orbit::Model
 
     /// @brief Fetch internal cached state array
     ///
+    /// The returned reference is not synchronized: it must not be used while other threads query a model with a
+    /// defined checkpoint spacing (see getCachedStateArray).
+    ///
     /// @code{.cpp}
     ///              Array<State> stateArray = propagated.accessCachedStateArray() ;
     /// @endcode
     /// @return Array<State>&
     const Array<State>& accessCachedStateArray() const;
 
+    /// @brief Get a copy of the internal cached state array, taken under the cache lock
+    ///
+    /// @code{.cpp}
+    ///              Array<State> stateArray = propagated.getCachedStateArray() ;
+    /// @endcode
+    /// @return Array<State>
+    Array<State> getCachedStateArray() const;
+
     /// @brief Access propagator
     ///
     /// @code{.cpp}
@@ -162,6 +224,77 @@ class Propagated : public ostk::astrodynamics::trajectory::orbit::Model
     /// @return Propagator
     const Propagator& accessPropagator() const;
 
+    /// @brief Get Hermite interpolation span
+    ///
+    /// @code{.cpp}
+    ///              Duration span = propagated.getHermiteInterpolationSpan() ;
+    /// @endcode
+    ///
+    /// @return Duration (undefined if Hermite interpolation is disabled)
+    Duration getHermiteInterpolationSpan() const;
+
+    /// @brief Set Hermite interpolation span
+    ///
+    /// Between two cached states at most this far apart, states are interpolated with a cubic Hermite polynomial
+    /// from the cached positions and velocities (other coordinates are linearly interpolated), instead of being
+    /// propagated forward and backward. Much cheaper, at the expense of fidelity.
+    ///
+    /// @code{.cpp}
+    ///              propagated.setHermiteInterpolationSpan(Duration::Minutes(10.0)) ;
+    /// @endcode
+    /// @param aDuration A duration (undefined disables Hermite interpolation)
+    void setHermiteInterpolationSpan(const Duration& aDuration);
+
+    /// @brief Get checkpoint spacing
+    ///
+    /// @code{.cpp}
+    ///              Duration spacing = propagated.getCheckpointSpacing() ;
+    /// @endcode
+    ///
+    /// @return Duration (undefined if checkpointing is disabled)
+    Duration getCheckpointSpacing() const;
+
+    /// @brief Set checkpoint spacing
+    ///
+    /// When propagating forward of the last cached state, intermediate states are computed at multiples of this
+    /// spacing and added to the cached state array, so that later queries propagate from the nearest checkpoint.
+    /// Checkpoints are subject to the cache policy. Concurrent queries are safe: the cache is guarded by a mutex,
+    /// which is not held while propagating.
+    ///
+    /// @code{.cpp}
+    ///              propagated.setCheckpointSpacing(Duration::Hours(1.0)) ;
+    /// @endcode
+    /// @param aDuration A duration (undefined disables checkpointing)
+    void setCheckpointSpacing(const Duration& aDuration);
+
+    /// @brief Get cache policy
+    ///
+    /// @code{.cpp}
+    ///              Propagated::CachePolicy cachePolicy = propagated.getCachePolicy() ;
+    /// @endcode
+    ///
+    /// @return CachePolicy
+    CachePolicy getCachePolicy() const;
+
+    /// @brief Set cache policy, evicting cached states if needed
+    ///
+    /// @code{.cpp}
+    ///              propagated.setCachePolicy({1000, 0}) ;
+    /// @endcode
+    /// @param aCachePolicy A cache policy
+    void setCachePolicy(const CachePolicy& aCachePolicy);
+
+    /// @brief Add a state to the cached state array (e.g. a checkpoint), keeping it sorted
+    ///
+    /// The insertion position is found by binary search, without re-sorting the array. The added state may later be
+    /// evicted according to the cache policy.
+    ///
+    /// @code{.cpp}
+    ///              propagated.addCachedState(aState) ;
+    /// @endcode
+    /// @param aState A state
+    void addCachedState(const State& aState);
+
     /// @brief Set internal cached state array manually
     ///
     /// @code{.cpp}
@@ -194,8 +327,44 @@ class Propagated : public ostk::astrodynamics::trajectory::orbit::Model
     Propagator propagator_;
     mutable Array<State> cachedStateArray_;
     Integer initialRevolutionNumber_;
+    Duration hermiteInterpolationSpan_;
+    Duration checkpointSpacing_;
+
+    struct CacheEntry
+    {
+        bool isAnchor;
+        Size lastQueryIndex;
+    };
+
+    CachePolicy cachePolicy_;
+    mutable Array<CacheEntry> cacheEntries_;  // Parallel to the cached state array
+    mutable Size queryIndex_;
+
+    mutable std::mutex cacheMutex_;  // Guards the cache, and the interpolation and checkpoint settings
+
+    void touchCachedState(const Size& aCachedStateIndex) const;
+
+    bool insertCachedState(const State& aState, const bool& isAnchor) const;
+
+    void evictCachedStates() const;
 
     void sanitizeCachedArray() const;
+
+    static Array<State> PropagateWithCheckpoints(
+        const Propagator& aPropagator,
+        const State& aState,
+        const Array<Instant>& anInstantArray,
+        const Duration& aCheckpointSpacing,
+        Array<State>& aCheckpointStateArray
+    );
+
+    static bool CanInterpolateHermite(
+        const State& aState, const State& anotherState, const Duration& aHermiteInterpolationSpan
+    );
+
+    static Array<State> InterpolateHermite(
+        const State& aState, const State& anotherState, const Array<Instant>& anInstantArray
+    );
 };
 
 }  // namespace model
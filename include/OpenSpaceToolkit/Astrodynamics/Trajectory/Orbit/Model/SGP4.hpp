@@ -3,16 +3,21 @@
 #ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_SGP4__
 #define __OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_SGP4__
 
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 #include <OpenSpaceToolkit/Core/Type/Unique.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+
 #include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 #include <OpenSpaceToolkit/Physics/Unit/Derived.hpp>
 #include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
 
+#include <OpenSpaceToolkit/Astrodynamics/ExecutionContext.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/SGP4/TLE.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
@@ -28,23 +33,44 @@ namespace orbit
 namespace model
 {
 
+using ostk::core::container::Array;
 using ostk::core::type::Integer;
 using ostk::core::type::Real;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 using ostk::core::type::Unique;
 
+using ostk::mathematics::object::MatrixXd;
+
 using ostk::physics::environment::object::Celestial;
 using ostk::physics::time::Instant;
 using ostk::physics::unit::Derived;
 using ostk::physics::unit::Length;
 
+using ostk::astrodynamics::ExecutionContext;
 using ostk::astrodynamics::trajectory::orbit::model::sgp4::TLE;
 using ostk::astrodynamics::trajectory::State;
 
 class SGP4 : public ostk::astrodynamics::trajectory::orbit::Model
 {
    public:
-    SGP4(const TLE& aTle);
+    /// @brief Frame in which states are output
+    enum class OutputFrame
+    {
+        GCRF,        ///< Geocentric Celestial Reference Frame
+        TEME,        ///< True Equator Mean Equinox of date
+        TEMEOfEpoch  ///< True Equator Mean Equinox of the TLE epoch, in which SGP4 outputs (no frame conversion)
+    };
+
+    /// @brief Constructor
+    ///
+    /// @code{.cpp}
+    ///              SGP4 sgp4 = { aTle, SGP4::OutputFrame::TEMEOfEpoch } ;
+    /// @endcode
+    ///
+    /// @param aTle A TLE
+    /// @param anOutputFrame An output frame (TEMEOfEpoch skips the frame conversion)
+    SGP4(const TLE& aTle, const SGP4::OutputFrame& anOutputFrame = SGP4::OutputFrame::GCRF);
 
     SGP4(const SGP4& aSGP4Model);
 
@@ -64,16 +90,84 @@ class SGP4 : public ostk::astrodynamics::trajectory::orbit::Model
 
     TLE getTle() const;
 
+    /// @brief Get output frame
+    ///
+    /// @return Output frame
+    SGP4::OutputFrame getOutputFrame() const;
+
     virtual Instant getEpoch() const override;
 
     virtual Integer getRevolutionNumberAtEpoch() const override;
 
     virtual State calculateStateAt(const Instant& anInstant) const override;
 
-    virtual Integer calculateRevolutionNumberAt(const Instant& anInstant) const override;  // [TBR] ?
+    /// @brief Calculate the ephemeris at a set of instants
+    ///
+    /// Positions and velocities are written directly into the ephemeris, in the output frame, without building
+    /// intermediate states.
+    ///
+    /// @param anInstantArray An array of instants
+    /// @return Ephemeris
+    virtual Ephemeris calculateEphemerisAt(const Array<Instant>& anInstantArray) const override;
+
+    /// @brief Calculate the revolution number at a given instant
+    ///
+    /// Computed in constant time from the TLE mean elements: the mean argument of latitude is unwrapped from the TLE
+    /// epoch (see `estimateAscendingNodeInstant`), and the revolution is checked against the estimated ascending nodes
+    /// bounding it.
+    ///
+    /// @param anInstant An instant
+    /// @return Revolution number, undefined if the mean motion decays before reaching the instant
+    virtual Integer calculateRevolutionNumberAt(const Instant& anInstant) const override;
+
+    /// @brief Estimate the instant of the ascending node starting a given revolution
+    ///
+    /// The mean argument of latitude is advanced from its value at the TLE epoch, at the TLE mean motion plus the J2
+    /// secular rate of the argument of perigee, accounting for the TLE mean motion first time derivative.
+    ///
+    /// @param aRevolutionNumber A revolution number
+    /// @return Estimated instant, undefined if the mean motion decays before reaching the revolution
+    virtual Instant estimateAscendingNodeInstant(const Integer& aRevolutionNumber) const override;
 
     virtual void print(std::ostream& anOutputStream, bool displayDecorator = true) const override;
 
+    /// @brief Get string from output frame
+    ///
+    /// @param anOutputFrame An output frame
+    /// @return String
+    static String StringFromOutputFrame(const SGP4::OutputFrame& anOutputFrame);
+
+    /// @brief Calculate the states of a catalog of TLEs over an instant grid
+    ///
+    /// Each TLE is parsed once, and its TEME of epoch to GCRF rotation (constant, as the frame is frozen at epoch) is
+    /// computed once, so that evaluating the grid is a tight loop over raw SGP4 outputs, with no intermediate State.
+    /// Satellites are distributed over a pool of worker threads. Evaluations that fail (e.g. decayed satellites) are
+    /// filled with NaN.
+    ///
+    /// @code{.cpp}
+    ///              MatrixXd states = SGP4::CalculateCatalogStatesAt(aTleArray, anInstantArray) ;
+    ///              // states.col(instantIndex * aTleArray.getSize() + tleIndex) = [x, y, z, vx, vy, vz]
+    /// @endcode
+    /// @param aTleArray An array of TLEs
+    /// @param anInstantArray An array of instants
+    /// @param aThreadCount A worker thread count (0 defaults to the default thread count of ExecutionContext)
+    /// @return Matrix of size 6 x (instant count x TLE count), holding GCRF positions [m] and velocities [m/s],
+    /// grouped by instant
+    static MatrixXd CalculateCatalogStatesAt(
+        const Array<TLE>& aTleArray, const Array<Instant>& anInstantArray, const Size& aThreadCount = 0
+    );
+
+    /// @brief Calculate the states of a catalog of TLEs over an instant grid, within an execution context
+    ///
+    /// @param aTleArray An array of TLEs
+    /// @param anInstantArray An array of instants
+    /// @param anExecutionContext An execution context
+    /// @return Matrix of size 6 x (instant count x TLE count), holding GCRF positions [m] and velocities [m/s],
+    /// grouped by instant
+    static MatrixXd CalculateCatalogStatesAt(
+        const Array<TLE>& aTleArray, const Array<Instant>& anInstantArray, const ExecutionContext& anExecutionContext
+    );
+
    protected:
     virtual bool operator==(const trajectory::Model& aModel) const override;
 
@@ -83,6 +177,7 @@ class SGP4 : public ostk::astrodynamics::trajectory::orbit::Model
     class Impl;
 
     TLE tle_;
+    SGP4::OutputFrame outputFrame_;
 
     Unique<SGP4::Impl> implUPtr_;
 };
@@ -3,15 +3,19 @@
 #ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_SGP4_TLE__
 #define __OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_SGP4_TLE__
 
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 #include <OpenSpaceToolkit/Physics/Unit/Derived.hpp>
 #include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
 
+#include <OpenSpaceToolkit/Astrodynamics/ExecutionContext.hpp>
+
 namespace ostk
 {
 namespace astrodynamics
@@ -25,15 +29,19 @@ namespace model
 namespace sgp4
 {
 
+using ostk::core::container::Array;
 using ostk::core::filesystem::File;
 using ostk::core::type::Integer;
 using ostk::core::type::Real;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 
 using ostk::physics::time::Instant;
 using ostk::physics::unit::Angle;
 using ostk::physics::unit::Derived;
 
+using ostk::astrodynamics::ExecutionContext;
+
 /// @brief A Two-Line Element set (TLE) is data format encoding a list of orbital elements
 ///                      of an Earth-orbiting object for a given point in time
 ///
@@ -311,6 +319,70 @@ class TLE
     /// @return TLE
     static TLE Load(const File& aFile);
 
+    /// @brief Parse a catalog of TLEs (e.g. a CelesTrak or Space-Track bulk file) from a given string
+    ///
+    /// Each TLE is made of two element lines, optionally preceded by a satellite name line. Lines are scanned in
+    /// place, and element lines are validated in parallel chunks. Fields are only parsed when accessed.
+    ///
+    /// @code{.cpp}
+    ///              Array<TLE> tles = TLE::ParseCatalog(aString) ;
+    /// @endcode
+    ///
+    /// @param aString A string
+    /// @param aThreadCount A worker thread count (0 defaults to the default thread count of ExecutionContext)
+    /// @return Array of TLEs, in the order of the string
+    static Array<TLE> ParseCatalog(const String& aString, const Size& aThreadCount = 0);
+
+    /// @brief Parse a catalog of TLEs from a given string, within an execution context
+    ///
+    /// @param aString A string
+    /// @param anExecutionContext An execution context
+    /// @return Array of TLEs, in the order of the string
+    static Array<TLE> ParseCatalog(const String& aString, const ExecutionContext& anExecutionContext);
+
+    /// @brief Load a catalog of TLEs from a given file
+    ///
+    /// @code{.cpp}
+    ///              Array<TLE> tles = TLE::LoadCatalog(File::Path(Path::Parse("/path/to/active.txt"))) ;
+    /// @endcode
+    ///
+    /// @param aFile A file
+    /// @param aThreadCount A worker thread count (0 defaults to the default thread count of ExecutionContext)
+    /// @return Array of TLEs, in the order of the file
+    static Array<TLE> LoadCatalog(const File& aFile, const Size& aThreadCount = 0);
+
+    /// @brief Load a catalog of TLEs from a given file, within an execution context
+    ///
+    /// @param aFile A file
+    /// @param anExecutionContext An execution context
+    /// @return Array of TLEs, in the order of the file
+    static Array<TLE> LoadCatalog(const File& aFile, const ExecutionContext& anExecutionContext);
+
+    /// @brief Save a catalog of TLEs to a binary snapshot file
+    ///
+    /// The snapshot is made of a versioned header, followed by fixed size records holding the element lines and by
+    /// the satellite names. It is meant to be written once and reloaded with TLE::LoadCatalogSnapshot.
+    ///
+    /// @code{.cpp}
+    ///              TLE::SaveCatalogSnapshot(tles, File::Path(Path::Parse("/path/to/active.tles"))) ;
+    /// @endcode
+    ///
+    /// @param aTLEArray An array of TLEs
+    /// @param aFile A file
+    static void SaveCatalogSnapshot(const Array<TLE>& aTLEArray, const File& aFile);
+
+    /// @brief Load a catalog of TLEs from a binary snapshot file
+    ///
+    /// The snapshot is read in one go, and its records are not parsed nor validated again.
+    ///
+    /// @code{.cpp}
+    ///              Array<TLE> tles = TLE::LoadCatalogSnapshot(File::Path(Path::Parse("/path/to/active.tles"))) ;
+    /// @endcode
+    ///
+    /// @param aFile A file
+    /// @return Array of TLEs, in the order they were saved
+    static Array<TLE> LoadCatalogSnapshot(const File& aFile);
+
     /// @brief Construct a TLE from its components
     ///
     /// @return TLE
@@ -369,6 +441,8 @@ class TLE
     String firstLine_;
     String secondLine_;
 
+    TLE(String&& aSatelliteName, String&& aFirstLine, String&& aSecondLine, const bool& isValidated);
+
     static Real ParseReal(const String& aString, bool isDecimalPointAssumed);
 };
 
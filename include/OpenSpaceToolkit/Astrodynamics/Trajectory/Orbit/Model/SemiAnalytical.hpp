@@ -0,0 +1,278 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_SemiAnalytical__
+#define __OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_SemiAnalytical__
+
+#include <mutex>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Integer.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Derived.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateBroker.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/NumericalSolver.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace trajectory
+{
+namespace orbit
+{
+namespace model
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Integer;
+using ostk::core::type::Real;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::Vector3d;
+using ostk::mathematics::object::Vector6d;
+using ostk::mathematics::object::VectorXd;
+
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::unit::Derived;
+
+using ostk::astrodynamics::Dynamics;
+using ostk::astrodynamics::trajectory::orbit::Model;
+using ostk::astrodynamics::trajectory::State;
+using ostk::astrodynamics::trajectory::state::CoordinateBroker;
+using ostk::astrodynamics::trajectory::state::NumericalSolver;
+
+/// @brief Define an orbit model propagating averaged (mean) equinoctial elements, for long-term studies
+///
+/// Mean elements (a, h, k, p, q, lambda) are integrated with a fixed step RK4 scheme, over steps of hours. Their
+/// rates are the Gauss variational equations averaged over one revolution, by quadrature over the eccentric
+/// longitude, of the accelerations of the dynamics minus the central body attraction. Every dynamics is averaged,
+/// at the instant of the mean state, hence resonances and eclipse-dependent forces are only captured to first order.
+///
+/// Initial mean elements are the average of the osculating elements over one revolution centered on the initial
+/// state, propagated with the dynamics. Computed states hold mean positions and velocities: they differ from the
+/// osculating ones by the short periodic terms (about 10 km for J2 in low Earth orbit), which are not recovered.
+///
+/// Coordinates other than position and velocity (e.g. mass) are held constant.
+class SemiAnalytical : public ostk::astrodynamics::trajectory::orbit::Model
+{
+   public:
+    /// @brief Constructor
+    ///
+    /// @code{.cpp}
+    ///              SemiAnalytical semiAnalytical = { aState, aDynamicsArray, aGravitationalParameter } ;
+    ///              or
+    ///              SemiAnalytical semiAnalytical = { aState, aDynamicsArray, aGravitationalParameter,
+    ///              Duration::Hours(12.0) } ;
+    /// @endcode
+    ///
+    /// @param aState An initial (osculating) state, of an elliptical orbit
+    /// @param aDynamicsArray An array of dynamics, including the central body gravity
+    /// @param aGravitationalParameter The gravitational parameter of the central body
+    /// @param (optional) aStepDuration An integration step duration
+    /// @param (optional) aRevolutionNumber A revolution number at epoch
+    SemiAnalytical(
+        const State& aState,
+        const Array<Shared<Dynamics>>& aDynamicsArray,
+        const Derived& aGravitationalParameter,
+        const Duration& aStepDuration = Duration::Hours(6.0),
+        const Integer& aRevolutionNumber = 1
+    );
+
+    /// @brief Copy constructor
+    ///
+    /// @param aSemiAnalyticalModel A semi-analytical model
+    SemiAnalytical(const SemiAnalytical& aSemiAnalyticalModel);
+
+    /// @brief Copy assignment operator
+    ///
+    /// @param aSemiAnalyticalModel A semi-analytical model
+    /// @return Reference to semi-analytical model
+    SemiAnalytical& operator=(const SemiAnalytical& aSemiAnalyticalModel);
+
+    /// @brief Clone semi-analytical model
+    ///
+    /// @return Pointer to cloned semi-analytical model
+    virtual SemiAnalytical* clone() const override;
+
+    /// @brief Equal to operator
+    ///
+    /// @param aSemiAnalyticalModel A semi-analytical model
+    /// @return True if semi-analytical models are equal
+    bool operator==(const SemiAnalytical& aSemiAnalyticalModel) const;
+
+    /// @brief Not equal to operator
+    ///
+    /// @param aSemiAnalyticalModel A semi-analytical model
+    /// @return True if semi-analytical models are not equal
+    bool operator!=(const SemiAnalytical& aSemiAnalyticalModel) const;
+
+    /// @brief Output stream operator
+    ///
+    /// @param anOutputStream An output stream
+    /// @param aSemiAnalyticalModel A semi-analytical model
+    /// @return A reference to output stream
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const SemiAnalytical& aSemiAnalyticalModel);
+
+    /// @brief Check if semi-analytical model is defined
+    ///
+    /// @return True if semi-analytical model is defined
+    virtual bool isDefined() const override;
+
+    /// @brief Access initial state
+    ///
+    /// @return Initial state
+    const State& accessInitialState() const;
+
+    /// @brief Get dynamics
+    ///
+    /// @return Array of dynamics
+    Array<Shared<Dynamics>> getDynamics() const;
+
+    /// @brief Get gravitational parameter
+    ///
+    /// @return Gravitational parameter
+    Derived getGravitationalParameter() const;
+
+    /// @brief Get integration step duration
+    ///
+    /// @return Step duration
+    Duration getStepDuration() const;
+
+    /// @brief Get epoch (the instant of the initial state)
+    ///
+    /// @return Instant
+    virtual Instant getEpoch() const override;
+
+    /// @brief Get revolution number at epoch
+    ///
+    /// @return Integer
+    virtual Integer getRevolutionNumberAtEpoch() const override;
+
+    /// @brief Calculate mean equinoctial elements at an instant
+    ///
+    /// @code{.cpp}
+    ///              Vector6d elements = semiAnalytical.calculateMeanElementsAt(anInstant) ;
+    /// @endcode
+    ///
+    /// @param anInstant An instant
+    /// @return Mean elements (a [m], h, k, p, q, lambda [rad]), with a continuous mean longitude
+    Vector6d calculateMeanElementsAt(const Instant& anInstant) const;
+
+    /// @brief Calculate the (mean) state at an instant
+    ///
+    /// @code{.cpp}
+    ///              State state = semiAnalytical.calculateStateAt(anInstant) ;
+    /// @endcode
+    ///
+    /// @param anInstant An instant
+    /// @return State, in the frame of the initial state
+    virtual State calculateStateAt(const Instant& anInstant) const override;
+
+    /// @brief Calculate the (mean) states at an array of instants
+    ///
+    /// Integration nodes are cached, hence later queries within the integrated span only interpolate.
+    ///
+    /// @code{.cpp}
+    ///              Array<State> states = semiAnalytical.calculateStatesAt(anInstantArray) ;
+    /// @endcode
+    ///
+    /// @param anInstantArray An array of instants
+    /// @return Array of states, in the frame of the initial state
+    virtual Array<State> calculateStatesAt(const Array<Instant>& anInstantArray) const override;
+
+    /// @brief Calculate the revolution number at an instant, from the mean argument of latitude
+    ///
+    /// @code{.cpp}
+    ///              Integer integer = semiAnalytical.calculateRevolutionNumberAt(anInstant) ;
+    /// @endcode
+    ///
+    /// @param anInstant An instant
+    /// @return Integer
+    virtual Integer calculateRevolutionNumberAt(const Instant& anInstant) const override;
+
+    /// @brief Print semi-analytical model
+    ///
+    /// @param anOutputStream An output stream
+    /// @param (optional) displayDecorators If true, display decorators
+    virtual void print(std::ostream& anOutputStream, bool displayDecorator = true) const override;
+
+   protected:
+    /// @brief Equal to operator
+    ///
+    /// @param aModel A model
+    /// @return True if models are equal
+    virtual bool operator==(const trajectory::Model& aModel) const override;
+
+    /// @brief Not equal to operator
+    ///
+    /// @param aModel A model
+    /// @return True if models are not equal
+    virtual bool operator!=(const trajectory::Model& aModel) const override;
+
+   private:
+    struct Node
+    {
+        double time;            // Seconds from epoch
+        Vector6d elements;      // Mean elements, with a continuous mean longitude
+        Vector6d rates;         // Mean element rates
+        double rightAscension;  // Continuous right ascension of the ascending node [rad]
+    };
+
+    State initialState_;
+    Array<Shared<Dynamics>> dynamics_;
+    Derived gravitationalParameter_;
+    Duration stepDuration_;
+    Integer initialRevolutionNumber_;
+
+    Shared<CoordinateBroker> coordinateBrokerSPtr_;
+    Array<Dynamics::Context> dynamicsContexts_;
+    VectorXd stateVector_;
+    Index positionIndex_;
+    Index velocityIndex_;
+    double initialArgumentOfLatitude_;
+
+    mutable Array<Node> nodes_;  // Sorted by time, spanning the queried instants
+    mutable std::mutex nodesMutex_;
+
+    Node integrateNode(const Node& aNode, const double& aStep) const;
+
+    Vector6d calculateMeanElementRates(const double& aTime, const Vector6d& anElementVector) const;
+
+    Vector6d calculateInitialMeanElements() const;
+
+    Vector3d calculateAcceleration(
+        const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+        const Vector3d& aPosition,
+        const Vector3d& aVelocity,
+        const double& aTime,
+        VectorXd& aStateVector,
+        VectorXd& aStateDerivativeVector
+    ) const;
+
+    Vector6d interpolateElementsAt(const double& aTime, double* aRightAscensionPtr) const;
+
+    State buildState(const Instant& anInstant, const Vector6d& anElementVector) const;
+};
+
+}  // namespace model
+}  // namespace orbit
+}  // namespace trajectory
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
@@ -28,12 +28,17 @@ namespace model
 
 using ostk::core::container::Array;
 using ostk::core::type::Integer;
+using ostk::core::type::Shared;
 
 using ostk::mathematics::curvefitting::Interpolator;
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::VectorXd;
 
+using ostk::physics::coordinate::Frame;
 using ostk::physics::time::Instant;
 
 using ostk::astrodynamics::trajectory::State;
+using ostk::astrodynamics::trajectory::state::CoordinateBroker;
 
 class Tabulated : public virtual trajectory::orbit::Model, public trajectory::model::Tabulated
 {
@@ -44,6 +49,49 @@ class Tabulated : public virtual trajectory::orbit::Model, public trajectory::mo
         const Interpolator::Type& aType = DEFAULT_TABULATED_TRAJECTORY_INTERPOLATION_TYPE
     );
 
+    /// @brief Constructor from a timestamps vector and a coordinates matrix, copied into the model
+    ///
+    /// @param anEpoch An epoch
+    /// @param aTimestampVector A vector of timestamps [s since epoch], sorted
+    /// @param aCoordinateMatrix A matrix of coordinates, one row per timestamp
+    /// @param aFrameSPtr A frame
+    /// @param aCoordinateBrokerSPtr A coordinate broker, describing the coordinates columns
+    /// @param anInitialRevolutionNumber An initial revolution number
+    /// @param (optional) aType An interpolation type
+    Tabulated(
+        const Instant& anEpoch,
+        const VectorXd& aTimestampVector,
+        const MatrixXd& aCoordinateMatrix,
+        const Shared<const Frame>& aFrameSPtr,
+        const Shared<const CoordinateBroker>& aCoordinateBrokerSPtr,
+        const Integer& anInitialRevolutionNumber,
+        const Interpolator::Type& aType = DEFAULT_TABULATED_TRAJECTORY_INTERPOLATION_TYPE
+    );
+
+    /// @brief Constructor from views on externally owned timestamps and coordinates buffers
+    ///
+    /// Buffers are referenced, not copied: the storage owner is kept alive by the model (and its copies), and the
+    /// buffers must not be modified while it is.
+    ///
+    /// @param anEpoch An epoch
+    /// @param aTimestampVector A view on timestamps [s since epoch], sorted
+    /// @param aCoordinateMatrix A view on row-major coordinates, one row per timestamp
+    /// @param aFrameSPtr A frame
+    /// @param aCoordinateBrokerSPtr A coordinate broker, describing the coordinates columns
+    /// @param anInitialRevolutionNumber An initial revolution number
+    /// @param aType An interpolation type
+    /// @param aStorageSPtr An owner of the buffers
+    Tabulated(
+        const Instant& anEpoch,
+        const Eigen::Map<const VectorXd>& aTimestampVector,
+        const Eigen::Map<const RowMajorMatrixXd>& aCoordinateMatrix,
+        const Shared<const Frame>& aFrameSPtr,
+        const Shared<const CoordinateBroker>& aCoordinateBrokerSPtr,
+        const Integer& anInitialRevolutionNumber,
+        const Interpolator::Type& aType,
+        const Shared<const void>& aStorageSPtr
+    );
+
     virtual Tabulated* clone() const override;
 
     bool operator==(const Tabulated& aTabulatedModel) const;
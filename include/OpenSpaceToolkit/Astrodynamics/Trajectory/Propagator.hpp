@@ -4,21 +4,29 @@
 #define __OpenSpaceToolkit_Astrodynamics_Trajectory_Propagator__
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Map.hpp>
+#include <OpenSpaceToolkit/Core/Container/Pair.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
 #include <OpenSpaceToolkit/Core/Type/Size.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/CurveFitting/Interpolator.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
 
 #include <OpenSpaceToolkit/Physics/Environment.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/EventCondition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/ExecutionContext.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Flight/Maneuver.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateBroker.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/NumericalSolver.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/StateHistory.hpp>
 
 namespace ostk
 {
@@ -28,29 +36,88 @@ namespace trajectory
 {
 
 using ostk::core::container::Array;
+using ostk::core::container::Map;
+using ostk::core::container::Pair;
+using ostk::core::type::Real;
 using ostk::core::type::Shared;
 using ostk::core::type::Size;
+using ostk::core::type::String;
 
 using ostk::mathematics::curvefitting::Interpolator;
+using ostk::mathematics::object::MatrixXd;
 
 using ostk::physics::Environment;
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 
 using ostk::astrodynamics::Dynamics;
 using ostk::astrodynamics::EventCondition;
+using ostk::astrodynamics::ExecutionContext;
 using ostk::astrodynamics::flight::Maneuver;
 using ostk::astrodynamics::trajectory::State;
 using ostk::astrodynamics::trajectory::state::CoordinateBroker;
 using ostk::astrodynamics::trajectory::state::NumericalSolver;
+using ostk::astrodynamics::trajectory::state::StateHistory;
 
 #define DEFAULT_MANEUVER_PROPAGATION_INTERPOLATION_TYPE Interpolator::Type::BarycentricRational
 
 /// @brief Define a propagator to be used for numerical propagation
+///
+/// Propagation calls keep their mutable integration state (observed states, stepper state, dynamics scratch buffers) in
+/// a per-call copy of the numerical solver and of the dynamics contexts, so that a single propagator can be shared
+/// between threads, provided its dynamics are safe to evaluate concurrently. Condition propagation is the exception:
+/// it keeps the observed states in the numerical solver of the propagator, to be accessed after the call.
 class Propagator
 {
    public:
-    /// @brief Default integrator frame
-    static const Shared<const Frame> IntegrationFrameSPtr;
+    /// @brief Integration frame (GCRF)
+    ///
+    /// Constructed on first use.
+    ///
+    /// @return Integration frame
+    static const Shared<const Frame>& IntegrationFrame();
+
+    /// @brief Resumable propagation session
+    ///
+    /// Keeps the stepper state, the last step size and the dynamics scratch buffers across calls, so that streaming
+    /// requests only cost the integration steps.
+    ///
+    /// @code{.cpp}
+    ///              Propagator::Session session = { propagator, aState } ;
+    ///              State state = session.advanceBy(Duration::Seconds(60.0)) ;
+    ///              state = session.advanceBy(Duration::Seconds(60.0)) ;
+    /// @endcode
+    class Session
+    {
+       public:
+        /// @brief Constructor
+        ///
+        /// @param aPropagator A propagator
+        /// @param aState An initial state
+        Session(const Propagator& aPropagator, const State& aState);
+
+        /// @brief Access current state
+        ///
+        /// @return Current state
+        const State& accessState() const;
+
+        /// @brief Advance the session to an instant
+        ///
+        /// @param anInstant An instant, not earlier than the current state instant
+        /// @return State at instant
+        State advanceTo(const Instant& anInstant);
+
+        /// @brief Advance the session by a duration
+        ///
+        /// @param aDuration A positive duration
+        /// @return State after duration
+        State advanceBy(const Duration& aDuration);
+
+       private:
+        State initialState_;
+        State state_;
+        NumericalSolver::Session numericalSolverSession_;
+    };
 
     /// @brief Constructor
     ///
@@ -127,6 +194,48 @@ class Propagator
     /// @return The numerical solver
     const NumericalSolver& accessNumericalSolver() const;
 
+    /// @brief Get the integration statistics of the numerical solver
+    ///
+    /// Statistics are enabled on the numerical solver before constructing the propagator, and are shared by the
+    /// numerical solver, the propagator and its copies.
+    ///
+    /// @code{.cpp}
+    ///              aNumericalSolver.enableStatistics();
+    ///              Propagator propagator = { aNumericalSolver, aDynamicsArray } ;
+    ///              propagator.calculateStateAt(aState, anInstant);
+    ///              NumericalSolver::Statistics statistics = propagator.getStatistics();
+    /// @endcode
+    ///
+    /// @return Integration statistics
+    NumericalSolver::Statistics getStatistics() const;
+
+    /// @brief Check if dynamics timing is enabled
+    ///
+    /// @return True if dynamics timing is enabled
+    bool isDynamicsTimingEnabled() const;
+
+    /// @brief Get the evaluation timings of the dynamics, keyed by dynamics name
+    ///
+    /// Timings of dynamics sharing a name are summed. Timers are shared by the propagator and its copies.
+    ///
+    /// @code{.cpp}
+    ///              propagator.enableDynamicsTiming();
+    ///              propagator.calculateStateAt(aState, anInstant);
+    ///              Map<String, Dynamics::Timing> timings = propagator.getDynamicsTimings();
+    /// @endcode
+    ///
+    /// @return Dynamics timings
+    Map<String, Dynamics::Timing> getDynamicsTimings() const;
+
+    /// @brief Enable dynamics timing, recording the call count and evaluation time of each dynamics
+    void enableDynamicsTiming();
+
+    /// @brief Disable dynamics timing
+    void disableDynamicsTiming();
+
+    /// @brief Reset dynamics timings
+    void resetDynamicsTiming();
+
     /// @brief Get the number of propagated coordinates
     ///
     /// @return The number of propagated coordinates
@@ -179,7 +288,62 @@ class Propagator
     /// @return State
     State calculateStateAt(const State& aState, const Instant& anInstant) const;
 
+    /// @brief Calculate the state and the state transition matrix at an instant, given initial state
+    ///
+    /// The variational equations are integrated alongside the state. The state transition matrix maps deviations of
+    /// the (full) initial state onto deviations of the state at the given instant, following the structure of the
+    /// propagator coordinate subsets, expressed in the integration frame (GCRF).
+    ///
+    /// @code{.cpp}
+    ///              Pair<State, MatrixXd> stateAndSTM = propagator.calculateStateAndStateTransitionMatrixAt(aState,
+    ///              anInstant);
+    /// @endcode
+    /// @param aState An initial state
+    /// @param anInstant An instant
+    /// @return Pair of the state and of the state transition matrix
+    Pair<State, MatrixXd> calculateStateAndStateTransitionMatrixAt(const State& aState, const Instant& anInstant) const;
+
+    /// @brief Calculate the states and the state transition matrices at an array of instants, given initial state
+    /// @brief Can only be used with sorted instants array
+    ///
+    /// The variational equations are integrated alongside the state, in a single pass over all the requested
+    /// instants. State transition matrices follow the structure of the propagator coordinate subsets, expressed in the
+    /// integration frame (GCRF).
+    ///
+    /// @code{.cpp}
+    ///              Array<Pair<State, MatrixXd>> statesAndSTMs =
+    ///              propagator.calculateStatesAndStateTransitionMatricesAt(aState, anInstantArray);
+    /// @endcode
+    /// @param aState An initial state
+    /// @param anInstantArray An instant array
+    /// @return Array of pairs of the state and of the state transition matrix, in the order of the instants
+    Array<Pair<State, MatrixXd>> calculateStatesAndStateTransitionMatricesAt(
+        const State& aState, const Array<Instant>& anInstantArray
+    ) const;
+
+    /// @brief Calculate the states and the covariances at an array of instants, given an initial state and covariance
+    /// @brief Can only be used with sorted instants array
+    ///
+    /// The variational equations are integrated alongside the state, in a single pass over all the requested
+    /// instants, and the initial covariance is mapped through the state transition matrix at each of them (P = Phi
+    /// P0 Phi^T). Covariances follow the structure of the propagator coordinate subsets, expressed in the integration
+    /// frame (GCRF).
+    ///
+    /// @code{.cpp}
+    ///              Array<Pair<State, MatrixXd>> statesAndCovariances =
+    ///              propagator.calculateStatesAndCovariancesAt(aState, aCovariance, anInstantArray);
+    /// @endcode
+    /// @param aState An initial state
+    /// @param aCovariance An initial covariance
+    /// @param anInstantArray An instant array
+    /// @return Array of pairs of the state and of the covariance, in the order of the instants
+    Array<Pair<State, MatrixXd>> calculateStatesAndCovariancesAt(
+        const State& aState, const MatrixXd& aCovariance, const Array<Instant>& anInstantArray
+    ) const;
+
     /// @brief Calculate the state subject to an Event Condition, given initial state and maximum end time
+    /// @brief The observed states are kept by the numerical solver of the propagator, hence concurrent calls on a
+    /// shared propagator are not supported.
     /// @code{.cpp}
     ///              NumericalSolver::ConditionSolution state = propagator.calculateStateToCondition(aState, anInstant,
     ///              anEventCondition);
@@ -192,6 +356,23 @@ class Propagator
         const State& aState, const Instant& anInstant, const EventCondition& anEventCondition
     ) const;
 
+    /// @brief Calculate the state at an instant, given initial state, recording every occurrence of a set of Event
+    /// Conditions along the way
+    /// @brief Conditions do not stop the propagation, and are all detected in a single pass (see
+    /// NumericalSolver::integrateTime). The observed states are kept by the numerical solver of the propagator, hence
+    /// concurrent calls on a shared propagator are not supported.
+    /// @code{.cpp}
+    ///              NumericalSolver::EventsSolution eventsSolution = propagator.calculateStateAndEventsAt(aState,
+    ///              anInstant, anEventConditionArray);
+    /// @endcode
+    /// @param aState An initial state
+    /// @param anInstant An instant
+    /// @param anEventConditionArray An array of event conditions
+    /// @return NumericalSolver::EventsSolution
+    NumericalSolver::EventsSolution calculateStateAndEventsAt(
+        const State& aState, const Instant& anInstant, const Array<Shared<EventCondition>>& anEventConditionArray
+    ) const;
+
     /// @brief Calculate the states at an array of instants, given an initial state
     /// @brief Can only be used with sorted instants array
     ///
@@ -202,6 +383,130 @@ class Propagator
     /// @return Array<State>
     Array<State> calculateStatesAt(const State& aState, const Array<Instant>& anInstantArray) const;
 
+    /// @brief Calculate the states at an array of instants, given an initial state, as a state history
+    /// @brief Can only be used with sorted instants array
+    ///
+    /// The coordinates of all the output states are held in a single contiguous buffer, allocated once and released
+    /// at once, which suits large outputs, and states too large to be stored inline.
+    ///
+    /// @code{.cpp}
+    ///              StateHistory stateHistory = propagator.calculateStateHistoryAt(aState, anInstantArray);
+    /// @endcode
+    /// @param aState An initial state
+    /// @param anInstantArray An instant array
+    /// @return StateHistory
+    StateHistory calculateStateHistoryAt(const State& aState, const Array<Instant>& anInstantArray) const;
+
+    /// @brief Calculate the states at an instant, given an array of initial states
+    /// @brief Initial states are propagated in parallel, using a pool of worker threads. Dynamics are shared between
+    /// workers, hence must be safe to evaluate concurrently.
+    ///
+    /// @code{.cpp}
+    ///              Array<State> states = propagator.calculateStatesAt(aStateArray, anInstant);
+    /// @endcode
+    /// @param aStateArray An initial state array
+    /// @param anInstant An instant
+    /// @param aThreadCount A worker thread count (0 defaults to the default thread count of ExecutionContext)
+    /// @return Array<State>, in the order of the initial states
+    Array<State> calculateStatesAt(
+        const Array<State>& aStateArray, const Instant& anInstant, const Size& aThreadCount = 0
+    ) const;
+
+    /// @brief Calculate the states at an instant, given an array of initial states, within an execution context
+    ///
+    /// @param aStateArray An initial state array
+    /// @param anInstant An instant
+    /// @param anExecutionContext An execution context
+    /// @return Array<State>, in the order of the initial states
+    Array<State> calculateStatesAt(
+        const Array<State>& aStateArray, const Instant& anInstant, const ExecutionContext& anExecutionContext
+    ) const;
+
+    /// @brief Calculate the states at an array of instants, given an array of initial states
+    /// @brief Initial states are propagated in parallel, using a pool of worker threads. Dynamics are shared between
+    /// workers, hence must be safe to evaluate concurrently. Can only be used with sorted instants array.
+    ///
+    /// @code{.cpp}
+    ///              Array<Array<State>> states = propagator.calculateStatesAt(aStateArray, anInstantArray);
+    /// @endcode
+    /// @param aStateArray An initial state array
+    /// @param anInstantArray An instant array
+    /// @param aThreadCount A worker thread count (0 defaults to the default thread count of ExecutionContext)
+    /// @return Array of states at the instants, one per initial state, in the order of the initial states
+    Array<Array<State>> calculateStatesAt(
+        const Array<State>& aStateArray, const Array<Instant>& anInstantArray, const Size& aThreadCount = 0
+    ) const;
+
+    /// @brief Calculate the states at an array of instants, given an array of initial states, within an execution
+    /// context
+    ///
+    /// @param aStateArray An initial state array
+    /// @param anInstantArray An instant array
+    /// @param anExecutionContext An execution context
+    /// @return Array of states at the instants, one per initial state, in the order of the initial states
+    Array<Array<State>> calculateStatesAt(
+        const Array<State>& aStateArray,
+        const Array<Instant>& anInstantArray,
+        const ExecutionContext& anExecutionContext
+    ) const;
+
+    /// @brief Calculate the states at an array of instants, given an initial state, in parallel in time
+    /// @brief The requested instants split the propagation into windows. Window boundaries are first predicted with
+    /// a cheap coarse propagator, then each window is refined independently (and in parallel) with this propagator,
+    /// and a Parareal correction is iterated until the boundary states stop changing by more than the tolerance. After
+    /// as many iterations as windows, the result matches the sequential propagation exactly.
+    /// @brief Can only be used with sorted instants array, strictly after the initial state instant
+    ///
+    /// @code{.cpp}
+    ///              Array<State> states = propagator.calculateStatesAt(aState, anInstantArray, aCoarsePropagator);
+    /// @endcode
+    /// @param aState An initial state
+    /// @param anInstantArray An instant array
+    /// @param aCoarsePropagator A coarse propagator (e.g. point mass gravity, with a large fixed step)
+    /// @param aTolerance A tolerance on the boundary state corrections, in SI units
+    /// @param aMaximumIterationCount A maximum correction iteration count
+    /// @param aThreadCount A worker thread count (0 defaults to the default thread count of ExecutionContext)
+    /// @return Array<State>
+    Array<State> calculateStatesAt(
+        const State& aState,
+        const Array<Instant>& anInstantArray,
+        const Propagator& aCoarsePropagator,
+        const Real& aTolerance = 1e-3,
+        const Size& aMaximumIterationCount = 10,
+        const Size& aThreadCount = 0
+    ) const;
+
+    /// @brief Calculate the states at an array of instants, given an initial state, in parallel in time within an
+    /// execution context
+    ///
+    /// @param aState An initial state
+    /// @param anInstantArray An instant array
+    /// @param aCoarsePropagator A coarse propagator
+    /// @param aTolerance A tolerance on the boundary state corrections, in SI units
+    /// @param aMaximumIterationCount A maximum correction iteration count
+    /// @param anExecutionContext An execution context
+    /// @return Array<State>
+    Array<State> calculateStatesAt(
+        const State& aState,
+        const Array<Instant>& anInstantArray,
+        const Propagator& aCoarsePropagator,
+        const Real& aTolerance,
+        const Size& aMaximumIterationCount,
+        const ExecutionContext& anExecutionContext
+    ) const;
+
+    /// @brief Calculate the states at an instant, given an ensemble of initial states
+    /// @brief The ensemble is integrated as a single column-wise matrix with shared steps, so that dynamics can
+    /// evaluate all samples at once. Initial states must share instant, frame and coordinate subsets.
+    ///
+    /// @code{.cpp}
+    ///              Array<State> states = propagator.calculateEnsembleStatesAt(aStateArray, anInstant);
+    /// @endcode
+    /// @param aStateArray An initial state array
+    /// @param anInstant An instant
+    /// @return Array<State>, in the order of the initial states
+    Array<State> calculateEnsembleStatesAt(const Array<State>& aStateArray, const Instant& anInstant) const;
+
     /// @brief Print propagator
     ///
     /// @param anOutputStream An output stream
@@ -236,9 +541,14 @@ class Propagator
    private:
     Shared<CoordinateBroker> coordinatesBrokerSPtr_ = std::make_shared<CoordinateBroker>();
     Array<Dynamics::Context> dynamicsContexts_ = Array<Dynamics::Context>::Empty();
-    mutable NumericalSolver numericalSolver_;
+    mutable NumericalSolver numericalSolver_;  // Only integrated with by condition propagation
+    bool dynamicsTimingIsEnabled_ = false;
 
     void validateDynamicsSet() const;
+
+    State integrateSolverState(const State& aSolverState, const Instant& anInstant) const;
+
+    Array<State> calculateSolverStatesAt(const State& aState, const Array<Instant>& anInstantArray) const;
 };
 
 }  // namespace trajectory
@@ -0,0 +1,206 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_RelativeMotion__
+#define __OpenSpaceToolkit_Astrodynamics_Trajectory_RelativeMotion__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Derived.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace trajectory
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Real;
+using ostk::core::type::String;
+
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::VectorXd;
+
+using ostk::physics::time::Instant;
+using ostk::physics::unit::Derived;
+
+using ostk::astrodynamics::trajectory::State;
+
+/// @brief Analytic propagation of the motion of a chaser relative to a target, for proximity operations
+///
+/// Relative states are 6-vectors (position [m], velocity [m/s]) of the chaser with respect to the target, expressed in
+/// the QSW frame of the target (X axis along the position, Z axis along the orbital momentum, which is also the LVLH
+/// frame of LocalOrbitalFrameFactory), velocities being derivatives in this rotating frame. Relative states are
+/// propagated in closed form with the linearized equations of relative motion about the Keplerian orbit of the
+/// target, hence are valid for separations small with respect to the orbit radius.
+class RelativeMotion
+{
+   public:
+    enum class Type
+    {
+        Undefined,          ///< Undefined
+        ClohessyWiltshire,  ///< Clohessy-Wiltshire equations, for circular target orbits
+        YamanakaAnkersen    ///< Yamanaka-Ankersen state transition matrix, for elliptical target orbits
+    };
+
+    /// @brief Constructor
+    ///
+    /// @code{.cpp}
+    ///              RelativeMotion relativeMotion = { aTargetState, aGravitationalParameter,
+    ///              RelativeMotion::Type::YamanakaAnkersen } ;
+    /// @endcode
+    ///
+    /// @param aTargetState A target state, defining the Keplerian orbit of the target
+    /// @param aGravitationalParameter A gravitational parameter
+    /// @param (optional) aType A type of relative motion model
+    RelativeMotion(
+        const State& aTargetState,
+        const Derived& aGravitationalParameter,
+        const Type& aType = RelativeMotion::Type::YamanakaAnkersen
+    );
+
+    /// @brief Equal to operator
+    ///
+    /// @param aRelativeMotion A relative motion
+    /// @return True if relative motions are equal
+    bool operator==(const RelativeMotion& aRelativeMotion) const;
+
+    /// @brief Not equal to operator
+    ///
+    /// @param aRelativeMotion A relative motion
+    /// @return True if relative motions are not equal
+    bool operator!=(const RelativeMotion& aRelativeMotion) const;
+
+    /// @brief Output stream operator
+    ///
+    /// @param anOutputStream An output stream
+    /// @param aRelativeMotion A relative motion
+    /// @return A reference to output stream
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const RelativeMotion& aRelativeMotion);
+
+    /// @brief Check if relative motion is defined
+    ///
+    /// @return True if relative motion is defined
+    bool isDefined() const;
+
+    /// @brief Access target state
+    ///
+    /// @return Target state, in GCRF
+    const State& accessTargetState() const;
+
+    /// @brief Get gravitational parameter
+    ///
+    /// @return Gravitational parameter
+    Derived getGravitationalParameter() const;
+
+    /// @brief Get type
+    ///
+    /// @return Type
+    Type getType() const;
+
+    /// @brief Get the eccentricity of the target orbit
+    ///
+    /// @return Eccentricity
+    Real getEccentricity() const;
+
+    /// @brief Get the mean motion of the target orbit
+    ///
+    /// @return Mean motion [rad/s]
+    Real getMeanMotion() const;
+
+    /// @brief Calculate the state transition matrix of relative states between two instants
+    ///
+    /// @code{.cpp}
+    ///              MatrixXd stateTransitionMatrix = relativeMotion.calculateStateTransitionMatrix(aStartInstant,
+    ///              anEndInstant) ;
+    /// @endcode
+    ///
+    /// @param aStartInstant A start instant
+    /// @param anEndInstant An end instant
+    /// @return State transition matrix (6 x 6)
+    MatrixXd calculateStateTransitionMatrix(const Instant& aStartInstant, const Instant& anEndInstant) const;
+
+    /// @brief Calculate the relative state at an instant, from a relative state at another instant
+    ///
+    /// @param aRelativeState A relative state, in the QSW frame of the target
+    /// @param aStartInstant The instant of the relative state
+    /// @param anInstant An instant
+    /// @return Relative state, in the QSW frame of the target
+    VectorXd calculateRelativeStateAt(
+        const VectorXd& aRelativeState, const Instant& aStartInstant, const Instant& anInstant
+    ) const;
+
+    /// @brief Calculate the relative states at an array of instants, from a relative state at another instant
+    ///
+    /// @param aRelativeState A relative state, in the QSW frame of the target
+    /// @param aStartInstant The instant of the relative state
+    /// @param anInstantArray An array of instants
+    /// @return Matrix of relative states, one row per instant
+    MatrixXd calculateRelativeStatesAt(
+        const VectorXd& aRelativeState, const Instant& aStartInstant, const Array<Instant>& anInstantArray
+    ) const;
+
+    /// @brief Print relative motion
+    ///
+    /// @param anOutputStream An output stream
+    /// @param (optional) displayDecorators If true, display decorators
+    void print(std::ostream& anOutputStream, bool displayDecorator = true) const;
+
+    /// @brief Constructs an undefined relative motion
+    ///
+    /// @return Undefined relative motion
+    static RelativeMotion Undefined();
+
+    /// @brief Compute the state of a chaser relative to a target, in the QSW frame of the target
+    ///
+    /// @param aTargetState A target state
+    /// @param aChaserState A chaser state, at the same instant
+    /// @return Relative state (position [m], velocity [m/s])
+    static VectorXd ComputeRelativeState(const State& aTargetState, const State& aChaserState);
+
+    /// @brief Compute the state of a chaser from its state relative to a target
+    ///
+    /// @param aTargetState A target state
+    /// @param aRelativeState A relative state, in the QSW frame of the target
+    /// @return Chaser state, in the frame of the target state
+    static State ComputeChaserState(const State& aTargetState, const VectorXd& aRelativeState);
+
+    /// @brief Convert type to string
+    ///
+    /// @param aType A type
+    /// @return String
+    static String StringFromType(const Type& aType);
+
+   private:
+    State targetState_;
+    Derived gravitationalParameter_;
+    Type type_;
+
+    double eccentricity_;
+    double meanMotion_;
+    double meanAnomalyAtEpoch_;
+
+    RelativeMotion();
+
+    double calculateTrueAnomalyAt(const Instant& anInstant) const;
+
+    MatrixXd calculateClohessyWiltshireStateTransitionMatrix(const double& aDuration) const;
+
+    MatrixXd calculateYamanakaAnkersenStateTransitionMatrix(
+        const Instant& aStartInstant, const Instant& anEndInstant
+    ) const;
+};
+
+}  // namespace trajectory
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
@@ -3,10 +3,17 @@
 #ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_Segment__
 #define __OpenSpaceToolkit_Astrodynamics_Trajectory_Segment__
 
+#include <atomic>
+#include <functional>
+
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Map.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
@@ -19,8 +26,11 @@
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/Thruster.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/EventCondition.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Flight/Maneuver.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/LocalOrbitalFrameFactory.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Propagated.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/NumericalSolver.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/StateHistory.hpp>
 
 namespace ostk
 {
@@ -31,11 +41,16 @@ namespace trajectory
 
 using ostk::core::container::Array;
 using ostk::core::container::Map;
+using ostk::core::filesystem::File;
+using ostk::core::type::Index;
 using ostk::core::type::Integer;
+using ostk::core::type::Real;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 
 using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::Vector3d;
 
 using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
@@ -45,8 +60,11 @@ using ostk::astrodynamics::Dynamics;
 using ostk::astrodynamics::dynamics::Thruster;
 using ostk::astrodynamics::EventCondition;
 using ostk::astrodynamics::flight::Maneuver;
+using ostk::astrodynamics::trajectory::LocalOrbitalFrameFactory;
+using ostk::astrodynamics::trajectory::orbit::model::Propagated;
 using ostk::astrodynamics::trajectory::State;
 using ostk::astrodynamics::trajectory::state::NumericalSolver;
+using ostk::astrodynamics::trajectory::state::StateHistory;
 
 /// @brief Represent a propagation segment for astrodynamics purposes
 class Segment
@@ -54,8 +72,94 @@ class Segment
    public:
     enum class Type
     {
-        Coast,    ///< Coast
-        Maneuver  ///< Maneuver
+        Coast,             ///< Coast
+        Maneuver,          ///< Maneuver
+        ImpulsiveManeuver  ///< Impulsive maneuver
+    };
+
+    /// @brief Policy for the states retained in a segment solution
+    ///
+    /// Retaining fewer states reduces the memory and copy cost of long segments whose intermediate states are not
+    /// read. The first and last states of the segment are always retained.
+    class StateRetention
+    {
+       public:
+        enum class Type
+        {
+            All,           ///< Retain all observed states
+            Endpoints,     ///< Retain the first and last states only
+            EveryNthStep,  ///< Retain every N-th observed state
+            FixedSpacing   ///< Retain states spaced by at least a fixed duration
+        };
+
+        /// @brief Equal to operator
+        ///
+        /// @param aStateRetention A state retention
+        /// @return True if state retentions are equal
+        bool operator==(const StateRetention& aStateRetention) const;
+
+        /// @brief Not equal to operator
+        ///
+        /// @param aStateRetention A state retention
+        /// @return True if state retentions are not equal
+        bool operator!=(const StateRetention& aStateRetention) const;
+
+        /// @brief Get type
+        /// @return Type of state retention
+        Type getType() const;
+
+        /// @brief Get step count, for the every N-th step policy
+        /// @return Step count
+        Size getStepCount() const;
+
+        /// @brief Get spacing, for the fixed spacing policy
+        /// @return Spacing
+        Duration getSpacing() const;
+
+        /// @brief Select the states to retain from an array of chronologically ordered states
+        ///
+        /// @param aStateArray An array of states
+        /// @return Retained states
+        Array<State> apply(const Array<State>& aStateArray) const;
+
+        /// @brief Select the states to retain from a chronologically ordered state history
+        ///
+        /// Only the retained states are built.
+        ///
+        /// @param aStateHistory A state history
+        /// @return Retained states
+        Array<State> apply(const StateHistory& aStateHistory) const;
+
+        /// @brief Retain all observed states
+        /// @return State retention
+        static StateRetention All();
+
+        /// @brief Retain the first and last states only
+        /// @return State retention
+        static StateRetention Endpoints();
+
+        /// @brief Retain every N-th observed state
+        ///
+        /// @param aStepCount A step count N, strictly positive
+        /// @return State retention
+        static StateRetention EveryNthStep(const Size& aStepCount);
+
+        /// @brief Retain states spaced by at least a fixed duration
+        ///
+        /// @param aSpacing A spacing, strictly positive
+        /// @return State retention
+        static StateRetention FixedSpacing(const Duration& aSpacing);
+
+       private:
+        Type type_;
+        Size stepCount_;
+        Duration spacing_;
+
+        StateRetention(const Type& aType, const Size& aStepCount, const Duration& aSpacing);
+
+        Array<Index> getRetainedIndices(
+            const Size& aStateCount, const std::function<const Instant&(const Index&)>& anInstantAccessor
+        ) const;
     };
 
     /// @brief Once a segment is set up with an event condition, it can be solved, resulting in this segment's Solution.
@@ -114,8 +218,23 @@ class Segment
         /// @return Array of maneuvers
         Array<Maneuver> extractManeuvers(const Shared<const Frame>& aFrameSPtr) const;
 
+        /// @brief Extract maneuvers from the (maneuvering) segment, one at a time
+        ///
+        /// Thruster contributions are computed state by state, and each maneuver is passed to the callback as soon as
+        /// its block of thrusting states ends. Only the current block is held in memory, which suits long segments.
+        ///
+        /// @param aFrameSPtr Frame
+        /// @param aManeuverCallback A callback, called with each extracted maneuver in chronological order
+        void extractManeuvers(
+            const Shared<const Frame>& aFrameSPtr,
+            const std::function<void(const ostk::astrodynamics::flight::Maneuver&)>& aManeuverCallback
+        ) const;
+
         /// @brief Calculate intermediate states at specified Instants using the provided Numerical Solver
         ///
+        /// The propagated model between states is built on the first call, and reused by subsequent calls with the
+        /// same numerical solver, as long as the solution states and dynamics are unchanged.
+        ///
         /// @param aNumericalSolver a numerical solver to use for the propagation between states
         /// @param anInstantArray an array of instants
         /// @return States at specified instants
@@ -156,6 +275,30 @@ class Segment
         /// @param (optional) displayDecorators If true, display decorators
         void print(std::ostream& anOutputStream, bool displayDecorator = true) const;
 
+        /// @brief Save the segment solution to a binary snapshot
+        ///
+        /// See Sequence::Solution::saveSnapshot for the stored content.
+        ///
+        /// @code{.cpp}
+        ///              segmentSolution.saveSnapshot(File::Path(Path::Parse("/path/to/solution.sols")));
+        /// @endcode
+        ///
+        /// @param aFile A file
+        void saveSnapshot(const File& aFile) const;
+
+        /// @brief Load a segment solution from a binary snapshot
+        ///
+        /// @code{.cpp}
+        ///              Segment::Solution segmentSolution = Segment::Solution::LoadSnapshot(aFile, aDynamicsArray);
+        /// @endcode
+        ///
+        /// @param aFile A file, holding a single segment solution
+        /// @param aDynamicsArray (optional) Dynamics, matched by name with the stored dynamics identifiers
+        /// @return Segment solution
+        static Solution LoadSnapshot(
+            const File& aFile, const Array<Shared<Dynamics>>& aDynamicsArray = Array<Shared<Dynamics>>::Empty()
+        );
+
         /// @brief Output stream operator
         ///
         /// @param anOutputStream An output stream
@@ -168,6 +311,20 @@ class Segment
         Array<State> states;               // Array of states for the segment.
         bool conditionIsSatisfied;         // True if the event condition is satisfied.
         Segment::Type segmentType;         // Type of segment.
+
+        // Integration statistics of the segment, if statistics are enabled on the segment numerical solver.
+        NumericalSolver::Statistics integrationStatistics;
+
+        // Step size [s] proposed by the stepper at the end of the segment, to warm-start the next one. Undefined for
+        // impulsive maneuver segments.
+        Real finalTimeStep;
+
+       private:
+        mutable Shared<const Propagated> propagatedSPtr_;
+        mutable Array<State> propagatedStates_;
+        mutable Array<Shared<Dynamics>> propagatedDynamics_;
+
+        const Propagated& accessPropagated(const NumericalSolver& aNumericalSolver) const;
     };
 
     /// @brief Output stream operator
@@ -209,12 +366,47 @@ class Segment
     /// @return Numerical solver
     const NumericalSolver& accessNumericalSolver() const;
 
+    /// @brief Get state retention
+    /// @return State retention policy of the segment solutions
+    StateRetention getStateRetention() const;
+
+    /// @brief Get delta V, for impulsive maneuver segments
+    /// @return Delta V, expressed in the local orbital frame [m/s]
+    Vector3d getDeltaV() const;
+
+    /// @brief Get local orbital frame factory, for impulsive maneuver segments
+    /// @return Local orbital frame factory in which the delta V is expressed
+    Shared<const LocalOrbitalFrameFactory> getLocalOrbitalFrameFactory() const;
+
+    /// @brief Get specific impulse, for impulsive maneuver segments
+    /// @return Specific impulse [s]
+    Real getSpecificImpulse() const;
+
     /// @brief Solve the segment
     ///
+    /// Impulsive maneuver segments are not propagated: their solution holds the pre-burn and post-burn states, both at
+    /// the initial instant.
+    ///
     /// @param aState Initial state for the segment
     /// @param maximumPropagationDuration Maximum duration for propagation. Defaults to 30 days
+    /// @param aCancellationFlagSPtr A shared cancellation flag, checked during the integration. Once raised, the solve
+    /// throws a runtime error. Defaults to nullptr, i.e. the solve cannot be cancelled
+    /// @param anInitialTimeStep A step size [s] to start the integration with, typically the final time step of the
+    /// previous segment solution, in place of the configured time step of adaptive steppers. Defaults to undefined
     /// @return A Solution representing the result of the solve
-    Solution solve(const State& aState, const Duration& maximumPropagationDuration = Duration::Days(30.0)) const;
+    Solution solve(
+        const State& aState,
+        const Duration& maximumPropagationDuration = Duration::Days(30.0),
+        const Shared<const std::atomic<bool>>& aCancellationFlagSPtr = nullptr,
+        const Real& anInitialTimeStep = Real::Undefined()
+    ) const;
+
+    /// @brief Get a copy of the segment, holding a clone of its event condition
+    ///
+    /// Dynamics are shared with the original segment.
+    ///
+    /// @return A Segment
+    Segment clone() const;
 
     /// @brief Print the segment
     ///
@@ -228,12 +420,14 @@ class Segment
     /// @param anEventConditionSPtr An event condition
     /// @param aDynamicsArray Array of dynamics
     /// @param aNumericalSolver Numerical solver
+    /// @param aStateRetention State retention policy of the solutions. Defaults to all states
     /// @return A Segment for coasting
     static Segment Coast(
         const String& aName,
         const Shared<EventCondition>& anEventConditionSPtr,
         const Array<Shared<Dynamics>>& aDynamicsArray,
-        const NumericalSolver& aNumericalSolver
+        const NumericalSolver& aNumericalSolver,
+        const StateRetention& aStateRetention = StateRetention::All()
     );
 
     /// @brief Create a maneuvering segment
@@ -243,12 +437,35 @@ class Segment
     /// @param aThrusterDynamics Dynamics for the thruster
     /// @param aDynamicsArray Array of dynamics
     /// @param aNumericalSolver Numerical solver
+    /// @param aStateRetention State retention policy of the solutions. Defaults to all states
     /// @return A Segment for maneuvering
     static Segment Maneuver(
         const String& aName,
         const Shared<EventCondition>& anEventConditionSPtr,
         const Shared<Thruster>& aThrusterDynamics,
         const Array<Shared<Dynamics>>& aDynamicsArray,
+        const NumericalSolver& aNumericalSolver,
+        const StateRetention& aStateRetention = StateRetention::All()
+    );
+
+    /// @brief Create an impulsive maneuvering segment
+    ///
+    /// The delta V is applied instantaneously to the initial state, and the mass is updated with the rocket equation.
+    /// The dynamics and numerical solver are not used to solve the segment, they are carried over to its solution.
+    ///
+    /// @param aName A name
+    /// @param aDeltaV A delta V, expressed in the local orbital frame [m/s]
+    /// @param aLocalOrbitalFrameFactorySPtr A local orbital frame factory
+    /// @param aSpecificImpulse A specific impulse [s]
+    /// @param aDynamicsArray Array of dynamics
+    /// @param aNumericalSolver Numerical solver
+    /// @return A Segment for impulsive maneuvering
+    static Segment ImpulsiveManeuver(
+        const String& aName,
+        const Vector3d& aDeltaV,
+        const Shared<const LocalOrbitalFrameFactory>& aLocalOrbitalFrameFactorySPtr,
+        const Real& aSpecificImpulse,
+        const Array<Shared<Dynamics>>& aDynamicsArray,
         const NumericalSolver& aNumericalSolver
     );
 
@@ -258,14 +475,24 @@ class Segment
     Shared<EventCondition> eventCondition_;
     Array<Shared<Dynamics>> dynamics_;
     NumericalSolver numericalSolver_;
+    StateRetention stateRetention_;
+    Vector3d deltaV_;
+    Shared<const LocalOrbitalFrameFactory> localOrbitalFrameFactorySPtr_;
+    Real specificImpulse_;
 
     Segment(
         const String& aName,
         const Type& aType,
         const Shared<EventCondition>& anEventConditionSPtr,
         const Array<Shared<Dynamics>>& aDynamicsArray,
-        const NumericalSolver& aNumericalSolver
+        const NumericalSolver& aNumericalSolver,
+        const StateRetention& aStateRetention,
+        const Vector3d& aDeltaV = Vector3d::Zero(),
+        const Shared<const LocalOrbitalFrameFactory>& aLocalOrbitalFrameFactorySPtr = nullptr,
+        const Real& aSpecificImpulse = Real::Undefined()
     );
+
+    Solution solveImpulse(const State& aState) const;
 };
 
 }  // namespace trajectory
@@ -3,14 +3,24 @@
 #ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_Sequence__
 #define __OpenSpaceToolkit_Astrodynamics_Trajectory_Sequence__
 
+#include <atomic>
+#include <functional>
+#include <future>
+#include <mutex>
+
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
 #include <OpenSpaceToolkit/Core/Type/Size.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
 
 #include <OpenSpaceToolkit/Physics/Environment.hpp>
 #include <OpenSpaceToolkit/Physics/Unit/Mass.hpp>
 
+#include <OpenSpaceToolkit/Astrodynamics/ExecutionContext.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Flight/System/SatelliteSystem.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Propagated.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Segment.hpp>
@@ -24,14 +34,23 @@ namespace trajectory
 {
 
 using ostk::core::container::Array;
+using ostk::core::filesystem::File;
+using ostk::core::type::Index;
 using ostk::core::type::Real;
+using ostk::core::type::Shared;
 using ostk::core::type::Size;
 
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::Vector3d;
+using ostk::mathematics::object::VectorXd;
+
 using ostk::physics::Environment;
 using ostk::physics::unit::Mass;
 
 using ostk::astrodynamics::dynamics::Thruster;
+using ostk::astrodynamics::ExecutionContext;
 using ostk::astrodynamics::flight::system::SatelliteSystem;
+using ostk::astrodynamics::trajectory::LocalOrbitalFrameFactory;
 using ostk::astrodynamics::trajectory::orbit::model::Propagated;
 using ostk::astrodynamics::trajectory::Segment;
 using ostk::astrodynamics::trajectory::State;
@@ -94,12 +113,57 @@ class Sequence
         Array<State> calculateStatesAt(const Array<Instant>& anInstantArray, const NumericalSolver& aNumericalSolver)
             const;
 
+        /// @brief Calculate states in this sequence's solution at the provided instants, resolving segments
+        /// concurrently.
+        ///
+        /// The sorted instants are partitioned between segments by binary search on the segment bounds, and the
+        /// states of each segment are calculated on their own task. States are returned in instant order.
+        ///
+        /// @param anInstantArray A sorted array of instants.
+        /// @param aNumericalSolver A numerical solver to be used for the propagation.
+        /// @param anExecutionContext An execution context.
+        /// @return Array of states at provided instants.
+        Array<State> calculateStatesAt(
+            const Array<Instant>& anInstantArray,
+            const NumericalSolver& aNumericalSolver,
+            const ExecutionContext& anExecutionContext
+        ) const;
+
         /// @brief Print the sequence solution
         ///
         /// @param anOutputStream An output stream
         /// @param (optional) displayDecorators If true, display decorators
         void print(std::ostream& anOutputStream, bool displayDecorator = true) const;
 
+        /// @brief Save the sequence solution to a binary snapshot
+        ///
+        /// The snapshot holds, for each segment solution, its name, type, condition flag, dynamics names and states
+        /// (instant, frame, coordinate subsets and coordinates). Dynamics cannot be serialized, and are matched by
+        /// name when loading. Snapshots are meant to be reloaded on the same platform.
+        ///
+        /// @code{.cpp}
+        ///              sequenceSolution.saveSnapshot(File::Path(Path::Parse("/path/to/solution.sols")));
+        /// @endcode
+        ///
+        /// @param aFile A file
+        void saveSnapshot(const File& aFile) const;
+
+        /// @brief Load a sequence solution from a binary snapshot
+        ///
+        /// Stored dynamics names are resolved against the provided dynamics. If none is provided, segment solutions
+        /// are loaded without dynamics, which is enough to access their states.
+        ///
+        /// @code{.cpp}
+        ///              Sequence::Solution sequenceSolution = Sequence::Solution::LoadSnapshot(aFile, aDynamicsArray);
+        /// @endcode
+        ///
+        /// @param aFile A file
+        /// @param aDynamicsArray (optional) Dynamics, matched by name with the stored dynamics identifiers
+        /// @return Sequence solution
+        static Solution LoadSnapshot(
+            const File& aFile, const Array<Shared<Dynamics>>& aDynamicsArray = Array<Shared<Dynamics>>::Empty()
+        );
+
         /// @brief Output stream operator
         ///
         /// @param anOutputStream An output stream
@@ -111,6 +175,66 @@ class Sequence
         bool executionIsComplete;                   // True if the sequence was executed completely, false otherwise
     };
 
+    /// @brief Handle on a sequence solve running in the background.
+    ///
+    /// Handles are cheap to copy, and all copies refer to the same solve.
+    class AsyncSolution
+    {
+       public:
+        /// @brief Constructor
+        ///
+        /// @param aFuture A shared future of the solution.
+        /// @param aCancellationFlagSPtr A shared cancellation flag, checked by the solve.
+        AsyncSolution(
+            const std::shared_future<Solution>& aFuture, const Shared<std::atomic<bool>>& aCancellationFlagSPtr
+        );
+
+        /// @brief Check if the solve is over, i.e. if the solution is available without waiting.
+        ///
+        /// @return True if the solve is over
+        bool isReady() const;
+
+        /// @brief Check if cancellation of the solve has been requested.
+        ///
+        /// @return True if cancellation has been requested
+        bool isCancelled() const;
+
+        /// @brief Wait for the solve to be over.
+        void wait() const;
+
+        /// @brief Get the solution, waiting for the solve to be over.
+        ///
+        /// A cancelled solve returns the solutions of the segments that completed before cancellation, and is marked as
+        /// not complete. Errors raised by the solve are rethrown.
+        ///
+        /// @return Solution
+        Solution get() const;
+
+        /// @brief Request cancellation of the solve.
+        ///
+        /// Cancellation is checked between segments and within the integration of each segment, whose partial solution
+        /// is discarded.
+        void cancel();
+
+       private:
+        std::shared_future<Solution> future_;
+        Shared<std::atomic<bool>> cancellationFlagSPtr_;
+    };
+
+    /// @brief Solution of a targeting problem, solved on the sequence by adjusting control variables until the
+    /// constraints are met.
+    struct TargetingSolution
+    {
+        VectorXd controls;             // Control variables of the last iterate
+        VectorXd constraints;          // Constraint values at the last iterate
+        MatrixXd jacobian;             // Constraint Jacobian with respect to the controls, at the last iterate
+        Solution solution;             // Sequence solution at the last iterate
+        Size iterationCount;           // Number of targeting iterations
+        Size propagationCount;         // Number of sequence solves, including the Jacobian evaluations
+        Size jacobianEvaluationCount;  // Number of finite difference Jacobian evaluations
+        bool hasConverged;             // True if the constraints are met within tolerance
+    };
+
     /// @brief Constructor
     ///
     /// @code{.cpp}
@@ -177,6 +301,12 @@ class Sequence
     /// @param aTrajectorySegmentArray An array of trajectory segments.
     void addSegments(const Array<Segment>& aTrajectorySegmentArray);
 
+    /// @brief Replace a segment.
+    ///
+    /// @param anIndex Index of the segment to replace.
+    /// @param aTrajectorySegment A trajectory segment.
+    void setSegment(const Index& anIndex, const Segment& aTrajectorySegment);
+
     /// @brief Add a coast segment.
     ///
     /// @param anEventConditionSPtr An event condition.
@@ -188,6 +318,17 @@ class Sequence
     /// @param aThruster A thruster dynamics.
     void addManeuverSegment(const Shared<EventCondition>& anEventConditionSPtr, const Shared<Thruster>& aThruster);
 
+    /// @brief Add an impulsive maneuver segment.
+    ///
+    /// @param aDeltaV A delta V, expressed in the local orbital frame [m/s].
+    /// @param aLocalOrbitalFrameFactorySPtr A local orbital frame factory.
+    /// @param aSpecificImpulse A specific impulse [s].
+    void addImpulsiveManeuverSegment(
+        const Vector3d& aDeltaV,
+        const Shared<const LocalOrbitalFrameFactory>& aLocalOrbitalFrameFactorySPtr,
+        const Real& aSpecificImpulse
+    );
+
     /// @brief Solve the sequence given an initial state, for a number of reptitions.
     ///
     /// @param aState Initial state for the sequence.
@@ -195,6 +336,118 @@ class Sequence
     /// @return A Solution that contains solutions for each segment.
     Solution solve(const State& aState, const Size& aRepetitionCount = 1) const;
 
+    /// @brief Solve the sequence for each state of an array of initial states, for a number of repetitions.
+    ///
+    /// Initial states are distributed over a pool of worker threads. Each worker solves its own copy of the sequence,
+    /// whose segments hold clones of the event conditions, so that target updates do not leak between runs. Dynamics
+    /// are shared between workers.
+    ///
+    /// @param aStateArray Array of initial states.
+    /// @param aRepetitionCount Number of repetitions. Defaults to 1, i.e. execute sequence once.
+    /// @param aThreadCount Number of worker threads. Defaults to 0, i.e. use the default thread count of
+    /// ExecutionContext.
+    /// @return An array of Solutions, in the order of the initial states.
+    Array<Solution> solve(
+        const Array<State>& aStateArray, const Size& aRepetitionCount = 1, const Size& aThreadCount = 0
+    ) const;
+
+    /// @brief Solve the sequence for each state of an array of initial states, within an execution context.
+    ///
+    /// @param aStateArray Array of initial states.
+    /// @param aRepetitionCount Number of repetitions.
+    /// @param anExecutionContext An execution context.
+    /// @return An array of Solutions, in the order of the initial states.
+    Array<Solution> solve(
+        const Array<State>& aStateArray, const Size& aRepetitionCount, const ExecutionContext& anExecutionContext
+    ) const;
+
+    /// @brief Solve the sequence given an initial state, for a number of repetitions, reusing the segment solutions of
+    /// the previous warm-started solve.
+    ///
+    /// Segment solutions are reused as long as the segments and their initial states are unchanged since the previous
+    /// warm-started solve, so that only the segments following the first changed one are propagated. Segments are
+    /// compared by name, type, event condition and dynamics instances, numerical solver and state retention: changes
+    /// made in place to a shared event condition or dynamics are not detected, and require clearing the solution cache.
+    ///
+    /// @param aState Initial state for the sequence.
+    /// @param aRepetitionCount Number of repetitions. Defaults to 1, i.e. execute sequence once.
+    /// @return A Solution that contains solutions for each segment.
+    Solution solveWarmStarted(const State& aState, const Size& aRepetitionCount = 1) const;
+
+    /// @brief Clear the segment solutions cached by warm-started solves.
+    void clearSolutionCache();
+
+    /// @brief Solve a targeting problem on the sequence: adjust control variables, mapped to the initial state of the
+    /// sequence, until the constraints evaluated on the sequence solution vanish.
+    ///
+    /// Newton steps (least squares, minimum norm) are taken with a constraint Jacobian that is evaluated once by
+    /// forward finite differences, or seeded by the caller (e.g. from state transition matrices), and then maintained
+    /// with Broyden rank-one updates, so that an iteration costs a single sequence solve. The Jacobian is only
+    /// re-evaluated by finite differences when an updated Jacobian fails to decrease the constraints norm.
+    ///
+    /// @code{.cpp}
+    ///              Sequence::TargetingSolution targetingSolution = sequence.solveTargeting(
+    ///                  initialControls, generateInitialState, computeConstraints
+    ///              );
+    /// @endcode
+    ///
+    /// @param anInitialControlVector Initial control variables.
+    /// @param anInitialStateGenerator Callable generating the initial state of the sequence from control variables.
+    /// @param aConstraintGenerator Callable computing the constraint values from a sequence solution.
+    /// @param aTolerance Tolerance on the constraints norm. Defaults to 1e-6.
+    /// @param aMaximumIterationCount Maximum number of iterations. Defaults to 20.
+    /// @param anInitialJacobian Initial constraint Jacobian. Defaults to empty, i.e. evaluated by finite differences.
+    /// @param aRelativeStep Relative step used to perturb the controls for finite differences. Defaults to 1e-6.
+    /// @return A Targeting Solution
+    TargetingSolution solveTargeting(
+        const VectorXd& anInitialControlVector,
+        const std::function<State(const VectorXd&)>& anInitialStateGenerator,
+        const std::function<VectorXd(const Solution&)>& aConstraintGenerator,
+        const Real& aTolerance = 1e-6,
+        const Size& aMaximumIterationCount = 20,
+        const MatrixXd& anInitialJacobian = MatrixXd(),
+        const Real& aRelativeStep = 1e-6
+    ) const;
+
+    /// @brief Solve the sequence given an initial state, for a number of repetitions, in the background.
+    ///
+    /// The solve runs on a dedicated thread, on a copy of the sequence: segments, event conditions and dynamics are
+    /// shared with this sequence, which must not be solved concurrently. Segment solutions are streamed to the
+    /// callback, from the background thread, as they complete.
+    ///
+    /// @code{.cpp}
+    ///              Sequence::AsyncSolution asyncSolution = sequence.solveAsync(
+    ///                  aState, 1, [](const Segment::Solution& aSegmentSolution) -> void { ... }
+    ///              );
+    ///              asyncSolution.cancel();
+    /// @endcode
+    ///
+    /// @param aState Initial state for the sequence.
+    /// @param aRepetitionCount Number of repetitions. Defaults to 1, i.e. execute sequence once.
+    /// @param aSegmentSolutionCallback Callable invoked with each completed segment solution. Defaults to none.
+    /// @return A handle on the solve.
+    AsyncSolution solveAsync(
+        const State& aState,
+        const Size& aRepetitionCount = 1,
+        const std::function<void(const Segment::Solution&)>& aSegmentSolutionCallback = {}
+    ) const;
+
+    /// @brief Solve the sequence given an initial state until an event condition is met, in the background.
+    ///
+    /// Background counterpart of solveToCondition, with the same threading and cancellation behavior as solveAsync.
+    ///
+    /// @param aState Initial state for the sequence.
+    /// @param anEventConditionSPtr A shared event condition.
+    /// @param aMaximumPropagationDuration Maximum duration for sequence propagation.
+    /// @param aSegmentSolutionCallback Callable invoked with each completed segment solution. Defaults to none.
+    /// @return A handle on the solve.
+    AsyncSolution solveToConditionAsync(
+        const State& aState,
+        const Shared<EventCondition>& anEventConditionSPtr,
+        const Duration& aMaximumPropagationDuration = Duration::Days(30.0),
+        const std::function<void(const Segment::Solution&)>& aSegmentSolutionCallback = {}
+    ) const;
+
     /// @brief Solve the sequence given an initial state.
     ///
     /// @param aState Initial state for the sequence.
@@ -214,10 +467,47 @@ class Sequence
     void print(std::ostream& anOutputStream, bool displayDecorator = true) const;
 
    private:
+    struct CachedSegmentSolution
+    {
+        State initialState;
+        Segment segment;
+        Duration segmentPropagationDurationLimit;
+        Segment::Solution solution;
+    };
+
     Array<Segment> segments_;
     NumericalSolver numericalSolver_;
     Array<Shared<Dynamics>> dynamics_;
     Duration segmentPropagationDurationLimit_;
+
+    mutable Array<CachedSegmentSolution> cachedSegmentSolutions_;
+    Shared<std::mutex> cacheMutexSPtr_ = std::make_shared<std::mutex>();
+
+    Sequence getIsolatedCopy() const;
+
+    Solution solveSegments(
+        const State& aState,
+        const Size& aRepetitionCount,
+        const bool& useCache,
+        const std::function<void(const Segment::Solution&)>& aSegmentSolutionCallback = {},
+        const Shared<const std::atomic<bool>>& aCancellationFlagSPtr = nullptr
+    ) const;
+
+    Solution solveSegmentsToCondition(
+        const State& aState,
+        const EventCondition& anEventCondition,
+        const Duration& aMaximumPropagationDuration,
+        const std::function<void(const Segment::Solution&)>& aSegmentSolutionCallback = {},
+        const Shared<const std::atomic<bool>>& aCancellationFlagSPtr = nullptr
+    ) const;
+
+    static AsyncSolution SolveAsync(const std::function<Solution(const Shared<const std::atomic<bool>>&)>& aSolver);
+
+    static bool SegmentsAreIdentical(const Segment& aSegment, const Segment& anotherSegment);
+
+    static Real GetInitialTimeStep(
+        const Segment& aSegment, const NumericalSolver* aPreviousNumericalSolverPtr, const Real& aPreviousFinalTimeStep
+    );
 };
 
 }  // namespace trajectory
@@ -12,7 +12,9 @@
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Velocity.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateBroker.hpp>
@@ -35,7 +37,9 @@ using ostk::mathematics::object::VectorXd;
 
 using ostk::physics::coordinate::Frame;
 using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Transform;
 using ostk::physics::coordinate::Velocity;
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 
 using ostk::astrodynamics::trajectory::state::CoordinateBroker;
@@ -160,14 +164,38 @@ class State
 
     /// @brief Accessor for the coordinates.
     ///
-    /// @return The coordinates
-    const VectorXd& accessCoordinates() const;
+    /// The returned view refers to the coordinates of the State, which must outlive it.
+    ///
+    /// @return A view of the coordinates
+    Eigen::Ref<const VectorXd> accessCoordinates() const;
 
     /// @brief Access the coordinate broker associated with the State.
     ///
     /// @return The coordinate broker associated to the State
     const Shared<const CoordinateBroker>& accessCoordinateBroker() const;
 
+    /// @brief Access the coordinates of a single subset, without copy.
+    ///
+    /// The returned view refers to the coordinates of the State, which must outlive it.
+    ///
+    /// @param aSubsetSPtr The subset to access the coordinates of
+    /// @return A view of the coordinates of the subset
+    Eigen::Ref<const VectorXd> accessCoordinate(const Shared<const CoordinateSubset>& aSubsetSPtr) const;
+
+    /// @brief Access the cartesian position coordinates of the State (if present), in meters, without copy.
+    ///
+    /// The returned view refers to the coordinates of the State, which must outlive it.
+    ///
+    /// @return A view of the cartesian position coordinates
+    Eigen::Ref<const Vector3d> accessPositionCoordinates() const;
+
+    /// @brief Access the cartesian velocity coordinates of the State (if present), in meters per second, without copy.
+    ///
+    /// The returned view refers to the coordinates of the State, which must outlive it.
+    ///
+    /// @return A view of the cartesian velocity coordinates
+    Eigen::Ref<const Vector3d> accessVelocityCoordinates() const;
+
     /// @brief Get the size of the State.
     ///
     /// @return The size of the State
@@ -250,11 +278,47 @@ class State
     /// @return An undefined State
     static State Undefined();
 
+    /// @brief Transform States to a different reference frame.
+    ///
+    /// The transform between two frames is computed once per instant, and shared by all the coordinate subsets of the
+    /// states at that instant.
+    ///
+    /// @param aStateArray An array of States
+    /// @param aFrameSPtr The reference frame to transform to
+    /// @return The transformed States
+    static Array<State> InFrame(const Array<State>& aStateArray, const Shared<const Frame>& aFrameSPtr);
+
+    /// @brief Transform States to a different reference frame, interpolating transforms.
+    ///
+    /// Meant for bulk conversions of ephemerides between frames sharing their origin (e.g. GCRF and ITRF): transforms
+    /// are computed exactly every interpolation step over the span of the states and interpolated in between, see
+    /// TransformInterpolator for the resulting accuracy.
+    ///
+    /// @param aStateArray An array of States
+    /// @param aFrameSPtr The reference frame to transform to
+    /// @param anInterpolationStep A step between exactly computed transforms
+    /// @return The transformed States
+    static Array<State> InFrame(
+        const Array<State>& aStateArray, const Shared<const Frame>& aFrameSPtr, const Duration& anInterpolationStep
+    );
+
    private:
+    /// Coordinates are stored inline up to this capacity, which covers the common states (position, velocity,
+    /// attitude, angular velocity, mass...), so that creating and copying those does not allocate
+    static constexpr Size InlineCoordinatesCapacity = 16;
+
+    using InlineCoordinates = Eigen::Matrix<double, Eigen::Dynamic, 1, Eigen::ColMajor, InlineCoordinatesCapacity, 1>;
+
     Instant instant_;
-    VectorXd coordinates_;
+    InlineCoordinates inlineCoordinates_;
+    VectorXd heapCoordinates_;
     Shared<const Frame> frameSPtr_;
     Shared<const CoordinateBroker> coordinatesBrokerSPtr_;
+
+    bool hasInlineCoordinates() const;
+    void setCoordinates(const VectorXd& aCoordinates);
+
+    State applyTransform(const Transform& aTransform, const Shared<const Frame>& aFrameSPtr) const;
 };
 
 }  // namespace trajectory
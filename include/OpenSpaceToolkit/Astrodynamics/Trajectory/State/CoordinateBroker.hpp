@@ -3,8 +3,9 @@
 #ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_State_CoordinateBroker__
 #define __OpenSpaceToolkit_Astrodynamics_Trajectory_State_CoordinateBroker__
 
+#include <vector>
+
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
-#include <OpenSpaceToolkit/Core/Container/Map.hpp>
 #include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
 #include <OpenSpaceToolkit/Core/Type/Size.hpp>
@@ -22,7 +23,6 @@ namespace state
 {
 
 using ostk::core::container::Array;
-using ostk::core::container::Map;
 using ostk::core::type::Index;
 using ostk::core::type::Shared;
 using ostk::core::type::Size;
@@ -31,6 +31,10 @@ using ostk::core::type::String;
 using ostk::astrodynamics::trajectory::state::CoordinateSubset;
 
 /// @brief State coordinate broker.
+///
+/// Subsets are looked up by handle (see CoordinateSubset::getHandle), in an array of starting indices. A hash of the
+/// subsets and their indices is maintained as subsets are added, so that unequal brokers are told apart without
+/// iterating over their subsets.
 class CoordinateBroker
 {
    public:
@@ -79,6 +83,14 @@ class CoordinateBroker
     /// @return The total number of coordinate subsets
     Size getNumberOfSubsets() const;
 
+    /// @brief Return the hash value of the instance, from its coordinate subsets and their starting indices
+    ///
+    /// Equal brokers have equal hashes. As subset handles are process-wide, hashes are only comparable within a
+    /// process.
+    ///
+    /// @return The hash value of the instance
+    Size hash() const;
+
     /// @brief Return the considered coordinate subsets
     ///
     /// @return The considered coordinate subsets
@@ -99,6 +111,37 @@ class CoordinateBroker
     /// @return True if the coordinate subset is already considered
     bool hasSubset(const Shared<const CoordinateSubset>& aCoordinateSubsetSPtr) const;
 
+    /// @brief Return the starting index of a coordinate subset in the state coordinates
+    ///
+    /// @param aCoordinateSubsetSPtr the coordinate subset of interest
+    ///
+    /// @return The starting index of the subset in the state coordinates
+    Index getSubsetIndex(const Shared<const CoordinateSubset>& aCoordinateSubsetSPtr) const;
+
+    /// @brief Access the coordinates of a given subset in the full coordinates vector, without copy
+    ///
+    /// The returned view refers to the full coordinates vector, which must outlive it.
+    ///
+    /// @param aFullCoordinatesVector the full coordinates vector
+    /// @param aCoordinateSubset the coordinate subset of interest
+    ///
+    /// @return A view of the coordinates of the subset
+    Eigen::Ref<const VectorXd> accessCoordinate(
+        const VectorXd& aFullCoordinatesVector, const CoordinateSubset& aCoordinateSubset
+    ) const;
+
+    /// @brief Access the coordinates of a given subset in the full coordinates vector, without copy
+    ///
+    /// The returned view refers to the full coordinates vector, which must outlive it.
+    ///
+    /// @param aFullCoordinatesVector the full coordinates vector
+    /// @param aCoordinateSubsetSPtr the coordinate subset of interest
+    ///
+    /// @return A view of the coordinates of the subset
+    Eigen::Ref<const VectorXd> accessCoordinate(
+        const VectorXd& aFullCoordinatesVector, const Shared<const CoordinateSubset>& aCoordinateSubsetSPtr
+    ) const;
+
     /// @brief Extract the coordinates of a given subset from the full coordinates vector
     ///
     /// @param aFullCoordinatesVector the full coordinates vecctor
@@ -130,10 +173,11 @@ class CoordinateBroker
    private:
     Index nextCoordinateSubsetIndex_;
     Array<Shared<const CoordinateSubset>> coordinateSubsets_;
-    Map<String, Index> coordinateSubsetsIndexMap_;
+    std::vector<Index> coordinateSubsetIndices_;
+    Size hash_;
 
-    bool hasSubset(const String& anId) const;
-    Index getSubsetIndex(const String& anId) const;
+    bool hasSubset(const CoordinateSubset& aCoordinateSubset) const;
+    Index getSubsetIndex(const CoordinateSubset& aCoordinateSubset) const;
 };
 
 }  // namespace state
@@ -3,6 +3,7 @@
 #ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_State_CoordinateSubset__
 #define __OpenSpaceToolkit_Astrodynamics_Trajectory_State_CoordinateSubset__
 
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
 #include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
@@ -10,6 +11,7 @@
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 
 namespace ostk
@@ -21,6 +23,7 @@ namespace trajectory
 namespace state
 {
 
+using ostk::core::type::Index;
 using ostk::core::type::Shared;
 using ostk::core::type::Size;
 using ostk::core::type::String;
@@ -28,6 +31,7 @@ using ostk::core::type::String;
 using ostk::mathematics::object::VectorXd;
 
 using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Transform;
 using ostk::physics::time::Instant;
 
 class CoordinateBroker;
@@ -73,6 +77,14 @@ class CoordinateSubset
     /// @return The unique identifier of the instance
     String getId() const;
 
+    /// @brief Return the handle of the instance
+    ///
+    /// Identifiers are interned process-wide at construction: coordinate subsets share a handle if and only if they
+    /// share an identifier. Handles are small consecutive integers, starting at 0.
+    ///
+    /// @return The handle of the instance
+    Index getHandle() const;
+
     /// @brief Return the name of the instance
     ///
     /// @return The name of the instance
@@ -134,6 +146,29 @@ class CoordinateSubset
         const Shared<const CoordinateBroker>& aCoordinateBrokerSPtr
     ) const;
 
+    /// @brief Transform the coordinate subset from one frame to another, using a precomputed transform
+    ///
+    /// Lets the subsets of a state share a single transform. The default implementation ignores the transform and
+    /// calls inFrame, frame-dependent subsets override it.
+    ///
+    /// @param aTransform the transform from the reference frame associated to the coordinates to the desired one, at
+    /// the instant
+    /// @param anInstant the instant associated to the coordinates
+    /// @param aFullCoordinatesVector all coordinates
+    /// @param fromFrameSPtr the reference frame associated to the coordinates
+    /// @param toFrameSPtr the reference frame in which the coordinates are to be transformed
+    /// @param aCoordinateBrokerSPtr a coordinate broker
+    ///
+    /// @return The resulting coordinate subset value expressed in the desired reference frame
+    virtual VectorXd applyTransform(
+        const Transform& aTransform,
+        const Instant& anInstant,
+        const VectorXd& aFullCoordinatesVector,
+        const Shared<const Frame>& fromFrameSPtr,
+        const Shared<const Frame>& toFrameSPtr,
+        const Shared<const CoordinateBroker>& aCoordinateBrokerSPtr
+    ) const;
+
     /// @brief Return a default Mass instance
     ///
     /// @return The default Mass shared pointer instance
@@ -153,6 +188,7 @@ class CoordinateSubset
     String name_;
     Size size_;
     String id_;
+    Index handle_;
 };
 
 }  // namespace state
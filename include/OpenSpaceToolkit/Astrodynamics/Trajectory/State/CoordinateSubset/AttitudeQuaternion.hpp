@@ -68,6 +68,27 @@ class AttitudeQuaternion : public CoordinateSubset
         const Shared<const CoordinateBroker>& aCoordinateBrokerSPtr
     ) const override;
 
+    /// @brief              Transform the coordinate subset from one frame to another, using a precomputed transform
+    ///
+    /// @param              [in] aTransform the transform from the reference frame associated to the coordinates to
+    ///                     the desired one
+    /// @param              [in] anInstant the instant associated to the coordinates
+    /// @param              [in] aFullCoordinatesVector all coordinates
+    /// @param              [in] fromFrame the reference frame associated to the coordinates
+    /// @param              [in] toFrame the reference frame in which the coordinates are to be transformed
+    /// @param              [in] aCoordinateBrokerSPtr a coordinate broker
+    ///
+    /// @return             The resulting coordinate subset value expressed in the desired reference frame
+
+    VectorXd applyTransform(
+        const Transform& aTransform,
+        const Instant& anInstant,
+        const VectorXd& aFullCoordinatesVector,
+        const Shared<const Frame>& fromFrame,
+        const Shared<const Frame>& toFrame,
+        const Shared<const CoordinateBroker>& aCoordinateBrokerSPtr
+    ) const override;
+
     /// @brief              Return a Quaternion from coordinates.
     ///
     /// @param              [in] coordinates coordinates vector
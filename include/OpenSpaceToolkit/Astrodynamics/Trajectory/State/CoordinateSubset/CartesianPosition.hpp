@@ -91,6 +91,25 @@ class CartesianPosition : public CoordinateSubset
         const Shared<const CoordinateBroker>& aCoordinateBrokerSPtr
     ) const override;
 
+    /// @brief Transforms the coordinate subset from one frame to another, using a precomputed transform
+    ///
+    /// @param aTransform the transform from the reference frame associated to the coordinates to the desired one
+    /// @param anInstant the instant associated to the coordinates
+    /// @param aFullCoordinatesVector all coordinates
+    /// @param fromFrame the reference frame associated to the coordinates
+    /// @param toFrame the reference frame in which the coordinates are to be transformed
+    /// @param aCoordinateBrokerSPtr a coordinate broker
+    ///
+    /// @return The resulting coordinate subset value expressed in the desired reference frame
+    VectorXd applyTransform(
+        const Transform& aTransform,
+        const Instant& anInstant,
+        const VectorXd& aFullCoordinatesVector,
+        const Shared<const Frame>& fromFrame,
+        const Shared<const Frame>& toFrame,
+        const Shared<const CoordinateBroker>& aCoordinateBrokerSPtr
+    ) const override;
+
     /// @brief Return the default instance
     ///
     /// @return The default instance
@@ -0,0 +1,97 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_State_EarthOrientation__
+#define __OpenSpaceToolkit_Astrodynamics_Trajectory_State_EarthOrientation__
+
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace trajectory
+{
+namespace state
+{
+
+using ostk::core::type::Shared;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Transform;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+
+/// @brief Process-wide selection of the Earth orientation model used by the library
+///
+/// The full model computes the GCRF to ITRF transform (IAU 2006/2000A precession-nutation, Earth rotation angle and
+/// polar motion, with interpolated Earth orientation parameters) at each instant. The interpolated model computes it
+/// at the nodes of a regular grid (anchored at J2000), and spherically interpolates in between, as
+/// TransformInterpolator does: the Earth rotation is reproduced exactly, and only the slowly varying precession,
+/// nutation, polar motion and UT1 - UTC are approximated. The error grows with the square of the step: with the
+/// default step, it stays at the centimeter level on LEO positions and below 0.2 m on GEO positions, for the cost of a
+/// spherical interpolation per transform.
+///
+/// The model applies to the transforms computed by the library hot paths (TransformCache, hence state frame
+/// conversions and access AER, and Dynamics::GetTransform, hence atmospheric drag). Each thread keeps the last grid
+/// nodes it used, so that consecutive queries (e.g. successive steps of a propagation) share them.
+///
+/// Changing the model or the step clears the transform cache.
+///
+/// @code{.cpp}
+///              EarthOrientation::SetModel(EarthOrientation::Model::Interpolated) ;
+/// @endcode
+class EarthOrientation
+{
+   public:
+    enum class Model
+    {
+        Full,         ///< Full model, evaluated at each instant
+        Interpolated  ///< Full model, evaluated on a grid and interpolated
+    };
+
+    EarthOrientation() = delete;
+
+    /// @brief Get the model
+    ///
+    /// @return Model
+    static Model GetModel();
+
+    /// @brief Set the model
+    ///
+    /// @param aModel A model
+    static void SetModel(const Model& aModel);
+
+    /// @brief Get the grid step of the interpolated model
+    ///
+    /// @return Step
+    static Duration GetInterpolationStep();
+
+    /// @brief Set the grid step of the interpolated model
+    ///
+    /// @param aStep A strictly positive step. Defaults to 1 hour.
+    static void SetInterpolationStep(const Duration& aStep);
+
+    /// @brief Get the transform between two frames at a given instant, using the model for GCRF to ITRF transforms
+    ///
+    /// Other transforms are computed exactly.
+    ///
+    /// @param aFromFrameSPtr A frame to transform from
+    /// @param aToFrameSPtr A frame to transform to
+    /// @param anInstant An instant
+    /// @return Transform
+    static Transform GetTransform(
+        const Shared<const Frame>& aFromFrameSPtr, const Shared<const Frame>& aToFrameSPtr, const Instant& anInstant
+    );
+};
+
+}  // namespace state
+}  // namespace trajectory
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
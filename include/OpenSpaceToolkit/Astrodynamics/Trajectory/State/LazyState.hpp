@@ -0,0 +1,104 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_State_LazyState__
+#define __OpenSpaceToolkit_Astrodynamics_Trajectory_State_LazyState__
+
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace trajectory
+{
+namespace state
+{
+
+using ostk::core::type::Shared;
+
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Transform;
+using ostk::physics::time::Instant;
+
+using ostk::astrodynamics::trajectory::State;
+
+/// @brief State with a pending conversion to a target frame
+///
+/// The transform to the target frame is only computed (through the transform cache) when a coordinate is first
+/// accessed, and only the accessed coordinates are converted. Converted coordinates are memoized, hence a lazy state is
+/// meant to be short-lived and local to a thread.
+class LazyState
+{
+   public:
+    /// @brief Constructor
+    ///
+    /// @param aState A state
+    /// @param aFrameSPtr A target frame
+    LazyState(const State& aState, const Shared<const Frame>& aFrameSPtr);
+
+    /// @brief Access the state, in its original frame
+    ///
+    /// @return State
+    const State& accessSourceState() const;
+
+    /// @brief Access instant
+    ///
+    /// @return Instant
+    const Instant& accessInstant() const;
+
+    /// @brief Access target frame
+    ///
+    /// @return Target frame
+    const Shared<const Frame>& accessFrame() const;
+
+    /// @brief Check if the transform to the target frame has been computed
+    ///
+    /// @return True if the transform has been computed
+    bool isTransformComputed() const;
+
+    /// @brief Access position coordinates, in the target frame
+    ///
+    /// @return Position coordinates [m]
+    const Vector3d& accessPositionCoordinates() const;
+
+    /// @brief Access velocity coordinates, in the target frame
+    ///
+    /// @return Velocity coordinates [m/s]
+    const Vector3d& accessVelocityCoordinates() const;
+
+    /// @brief Access the full state, in the target frame
+    ///
+    /// @return State
+    const State& accessState() const;
+
+   private:
+    State state_;
+    Shared<const Frame> frameSPtr_;
+    bool isIdentity_;
+
+    mutable Transform transform_;
+    mutable bool positionIsComputed_;
+    mutable bool velocityIsComputed_;
+    mutable Vector3d positionCoordinates_;
+    mutable Vector3d velocityCoordinates_;
+    mutable State stateInFrame_;
+
+    const Transform& accessTransform() const;
+};
+
+}  // namespace state
+}  // namespace trajectory
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
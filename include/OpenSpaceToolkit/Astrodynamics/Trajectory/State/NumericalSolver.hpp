@@ -3,16 +3,27 @@
 #ifndef __OpenSpaceToolkit_Astrodynamics_StateNumericalSolver__
 #define __OpenSpaceToolkit_Astrodynamics_StateNumericalSolver__
 
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
 #include <OpenSpaceToolkit/Mathematics/Solver/NumericalSolver.hpp>
 
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/EventCondition.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/RootSolver.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/StateHistory.hpp>
 
 namespace ostk
 {
@@ -24,7 +35,13 @@ namespace state
 {
 
 using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Shared;
+using ostk::core::type::String;
+
+using ostk::mathematics::object::MatrixXd;
 
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 
 using ostk::astrodynamics::RootSolver;
@@ -45,6 +62,120 @@ class NumericalSolver : public MathNumericalSolver
         bool rootSolverHasConverged;  ///< Whether the root solver has converged.
     };
 
+    /// @brief Structure to hold an occurrence of an event condition, found during an integration.
+    struct EventOccurrence
+    {
+        Index conditionIndex;         ///< Index of the event condition.
+        State state;                  ///< State at the occurrence.
+        Size iterationCount;          ///< Number of root solver iterations performed.
+        bool rootSolverHasConverged;  ///< Whether the root solver has converged.
+    };
+
+    /// @brief Structure to hold the solution of an integration recording event occurrences.
+    struct EventsSolution
+    {
+        State state;                              ///< Final state after integration.
+        Array<EventOccurrence> eventOccurrences;  ///< Event occurrences, in integration order.
+    };
+
+    /// @brief Logger of batches of observed states
+    typedef std::function<void(const Array<State>&)> StateBatchLogger;
+
+    /// @brief Integration statistics, accumulated over integrations while enabled
+    ///
+    /// Steps are the accepted steps of the stepper. Rejected steps of adaptive steppers are counted directly when
+    /// the stepper is driven by the solver, and inferred from the number of evaluations per step attempt otherwise.
+    /// Integrations to an array of instants with a non dense stepper only count evaluations. Ensemble integrations
+    /// and sessions are not accounted for.
+    struct Statistics
+    {
+        Size evaluationCount = 0;                              ///< Evaluations of the system of equations.
+        Size stepCount = 0;                                    ///< Accepted steps.
+        Size rejectedStepCount = 0;                            ///< Rejected steps.
+        Duration minimumStepDuration = Duration::Undefined();  ///< Smallest accepted step.
+        Duration maximumStepDuration = Duration::Undefined();  ///< Largest accepted step.
+        Duration cumulativeStepDuration = Duration::Zero();    ///< Sum of the accepted steps.
+
+        /// @brief Get mean step duration
+        ///
+        /// @return Mean accepted step (undefined without steps)
+        Duration getMeanStepDuration() const;
+    };
+
+    /// @brief Long horizon integration scheme
+    ///
+    /// Schemes take constant steps (the solver time step) with a stepper other than the generic Runge-Kutta ones, and
+    /// take precedence over the stepper type.
+    enum class LongHorizonScheme
+    {
+        Undefined,              ///< Undefined (integrate with the stepper type)
+        AdamsBashforthMoulton,  ///< Eighth order Adams-Bashforth-Moulton predictor-corrector, two evaluations per step
+        GaussLegendre,          ///< Fourth order Gauss-Legendre collocation, symplectic (bounded energy error)
+        RungeKuttaMuntheKaas    ///< Fourth order Runge-Kutta-Munthe-Kaas, attitude quaternion kept on the unit sphere
+    };
+
+    /// @brief System of equations of an ensemble, with states stored column-wise
+    typedef std::function<void(const MatrixXd&, MatrixXd&, const double)> EnsembleSystemOfEquationsWrapper;
+
+    /// @brief State vector of a size known at compile time
+    template <int StateSize>
+    using FixedSizeStateVector = Eigen::Matrix<double, StateSize, 1>;
+
+    /// @brief System of equations of a state of a size known at compile time
+    template <int StateSize>
+    using FixedSizeSystemOfEquationsWrapper =
+        std::function<void(const FixedSizeStateVector<StateSize>&, FixedSizeStateVector<StateSize>&, const double)>;
+
+    /// @brief Resumable integration session
+    ///
+    /// Keeps the stepper state and the last step size across calls, so that successive integrations to increasing
+    /// instants only cost the integration steps. Dense steppers take their natural steps and interpolate requested
+    /// instants; other steppers shorten their last step to land on requested instants without losing their natural
+    /// step size.
+    ///
+    /// @code{.cpp}
+    ///              NumericalSolver::Session session = { numericalSolver, aState, aSystemOfEquations } ;
+    ///              State state = session.integrateTime(anInstant) ;
+    ///              state = session.integrateTime(anInstant + Duration::Seconds(60.0)) ;
+    /// @endcode
+    class Session
+    {
+       public:
+        /// @brief Constructor
+        ///
+        /// @param aNumericalSolver A numerical solver, providing the stepper type, time step and tolerances
+        /// @param aState An initial state
+        /// @param aSystemOfEquations A system of equations
+        Session(
+            const NumericalSolver& aNumericalSolver,
+            const State& aState,
+            const SystemOfEquationsWrapper& aSystemOfEquations
+        );
+
+        Session(Session&& aSession);
+
+        Session& operator=(Session&& aSession);
+
+        ~Session();
+
+        /// @brief Access current state
+        ///
+        /// @return Current state
+        const State& accessState() const;
+
+        /// @brief Integrate up to an instant, resuming from the current state
+        ///
+        /// @param anInstant An instant, not earlier than the current state instant
+        /// @return State at instant
+        State integrateTime(const Instant& anInstant);
+
+       private:
+        class Stepper;
+
+        State state_;
+        std::unique_ptr<Stepper> stepperUPtr_;
+    };
+
     /// @brief Constructor
     ///
     /// @code{.cpp}
@@ -79,6 +210,18 @@ class NumericalSolver : public MathNumericalSolver
     /// @return Observed states
     const Array<State>& accessObservedStates() const;
 
+    /// @brief Access observed state history
+    ///
+    /// Observed states are accumulated in a columnar history, from which the array of observed states is only built
+    /// on access.
+    ///
+    /// @code{.cpp}
+    ///                  numericalSolver.accessObservedStateHistory();
+    /// @endcode
+    ///
+    /// @return Observed state history
+    const StateHistory& accessObservedStateHistory() const;
+
     /// @brief Get root solver
     ///
     /// @code{.cpp}
@@ -88,6 +231,15 @@ class NumericalSolver : public MathNumericalSolver
     /// @return RootSolver
     RootSolver getRootSolver() const;
 
+    /// @brief Get long horizon scheme
+    ///
+    /// @code{.cpp}
+    ///                  numericalSolver.getLongHorizonScheme();
+    /// @endcode
+    ///
+    /// @return Long horizon scheme
+    LongHorizonScheme getLongHorizonScheme() const;
+
     /// @brief Get observed states
     ///
     /// @code{.cpp}
@@ -97,6 +249,115 @@ class NumericalSolver : public MathNumericalSolver
     /// @return Observed states
     Array<State> getObservedStates() const;
 
+    /// @brief Set a cancellation flag, checked by integrateTime at every evaluation of the system of equations
+    ///
+    /// Once the flag is raised, integrations abort by throwing a runtime error. The flag is shared by the copies of
+    /// the solver, e.g. those held by propagators, and the solver can be cancelled from another thread.
+    ///
+    /// @code{.cpp}
+    ///                  numericalSolver.setCancellationFlag(std::make_shared<std::atomic<bool>>(false));
+    /// @endcode
+    ///
+    /// @param aCancellationFlagSPtr A shared cancellation flag, or nullptr to disable cancellation
+    void setCancellationFlag(const Shared<const std::atomic<bool>>& aCancellationFlagSPtr);
+
+    /// @brief Set the step size the next integrations start with, in place of the configured time step
+    ///
+    /// Meant to warm-start an integration with the step size the error controller settled on at the end of a previous
+    /// one (see getFinalTimeStep), which saves the ramp-up and rejected first steps of a cold start. Only applies to
+    /// adaptive steppers (without long horizon scheme), integrating to an instant or to a condition.
+    ///
+    /// @code{.cpp}
+    ///                  numericalSolver.setInitialTimeStep(previousNumericalSolver.getFinalTimeStep());
+    /// @endcode
+    ///
+    /// @param anInitialTimeStep An initial time step [s], or undefined to start with the configured time step
+    void setInitialTimeStep(const Real& anInitialTimeStep);
+
+    /// @brief Get the step size the next integrations start with
+    ///
+    /// @return Initial time step [s], undefined if the configured time step is used
+    Real getInitialTimeStep() const;
+
+    /// @brief Get the step size proposed by the stepper at the end of the last integration to an instant or condition
+    ///
+    /// @return Final time step [s] (positive), undefined if no integration has been performed
+    Real getFinalTimeStep() const;
+
+    /// @brief Set a logger of batches of observed states
+    ///
+    /// The states observed during an integration (those passed to the state logger) are buffered, and delivered by
+    /// batches of the given size, the remaining states being delivered when the integration ends. The cost of each
+    /// call to the logger (e.g. acquiring the GIL for a Python callback) is thus shared by many steps.
+    ///
+    /// Batches are delivered in order, either on the integrating thread, or asynchronously, on a background thread,
+    /// so that the logger does not slow the integration down. The logger is shared by the copies of the solver, e.g.
+    /// those held by propagators, and its calls are serialized.
+    ///
+    /// @code{.cpp}
+    ///                  numericalSolver.setStateBatchLogger(
+    ///                      [] (const Array<State>& aStateArray) -> void { ... }, 100, true
+    ///                  );
+    /// @endcode
+    ///
+    /// @param aStateBatchLogger A logger of batches of states, or nullptr to disable batch logging
+    /// @param aBatchSize A batch size, in states
+    /// @param isAsynchronous True to deliver batches on a background thread
+    void setStateBatchLogger(
+        const StateBatchLogger& aStateBatchLogger, const Size& aBatchSize, const bool isAsynchronous = false
+    );
+
+    /// @brief Wait until the batches of states logged asynchronously have been delivered
+    ///
+    /// Rethrows the first exception thrown by the logger on the background thread, if any.
+    void flushStateBatchLogger() const;
+
+    /// @brief Check if statistics are enabled
+    ///
+    /// @return True if statistics are enabled
+    bool isStatisticsEnabled() const;
+
+    /// @brief Get the statistics accumulated since statistics were enabled (or last reset)
+    ///
+    /// @code{.cpp}
+    ///                  numericalSolver.enableStatistics();
+    ///                  numericalSolver.integrateTime(aState, anInstant, aSystemOfEquations);
+    ///                  NumericalSolver::Statistics statistics = numericalSolver.getStatistics();
+    /// @endcode
+    ///
+    /// @return Statistics
+    Statistics getStatistics() const;
+
+    /// @brief Enable statistics
+    ///
+    /// Copies of this solver (e.g., those held by propagators and segments) share its statistics.
+    void enableStatistics();
+
+    /// @brief Disable statistics
+    void disableStatistics();
+
+    /// @brief Reset statistics
+    void resetStatistics();
+
+    /// @brief Record the statistics of an integration performed outside of this solver, e.g. by a copy of it
+    ///
+    /// @param aStatistics Statistics to be accumulated
+    void recordStatistics(const Statistics& aStatistics) const;
+
+    /// @brief Get a copy of this solver, without its observed states
+    ///
+    /// The copy shares the settings, the statistics and the cancellation flag of this solver, and is meant to hold the
+    /// mutable state (observed states, stepper state) of a single integration call. Integrating with such copies lets
+    /// a solver be shared between concurrent calls.
+    ///
+    /// @code{.cpp}
+    ///                  NumericalSolver callNumericalSolver = numericalSolver.getCallCopy();
+    ///                  callNumericalSolver.integrateTime(aState, anInstant, aSystemOfEquations);
+    /// @endcode
+    ///
+    /// @return Numerical solver
+    NumericalSolver getCallCopy() const;
+
     /// @brief Perform numerical integration for a given array of time instants.
     ///
     /// @param aState Initial state for integration.
@@ -117,9 +378,54 @@ class NumericalSolver : public MathNumericalSolver
         const State& aState, const Instant& anInstant, const SystemOfEquationsWrapper& aSystemOfEquations
     );
 
+    /// @brief Perform numerical integration of an ensemble of states from a common start time to an end time.
+    ///
+    /// States are stored column-wise in a single matrix and advanced with shared steps, so that the system of
+    /// equations can evaluate the whole ensemble at once. With adaptive steppers, the step is controlled by the
+    /// worst sample of the ensemble.
+    ///
+    /// @param aStateArray Initial states for integration, sharing instant, frame and coordinate broker.
+    /// @param anInstant Time to integrate to.
+    /// @param aSystemOfEquations Ensemble system of equations to integrate.
+    /// @return Final states after integration, in the order of the initial states.
+    Array<State> integrateEnsembleTime(
+        const Array<State>& aStateArray,
+        const Instant& anInstant,
+        const EnsembleSystemOfEquationsWrapper& aSystemOfEquations
+    );
+
+    /// @brief Check if the solver supports fixed size integration
+    ///
+    /// Fixed size integration is available without logging and without a long horizon scheme.
+    ///
+    /// @return True if the solver supports fixed size integration
+    bool supportsFixedSizeIntegration() const;
+
+    /// @brief Perform numerical integration of a state of a size known at compile time, from a start time to an end
+    /// time.
+    ///
+    /// Counterpart of integrateTime in which stepper operations act on fixed size vectors, hence do not allocate and
+    /// can be fully unrolled. Explicitly instantiated for state sizes 6 (position, velocity) and 7 (position,
+    /// velocity, mass).
+    ///
+    /// @param aState Initial state for integration, of size StateSize.
+    /// @param anInstant Time to integrate to.
+    /// @param aSystemOfEquations Fixed size system of equations to integrate.
+    /// @return Final state after integration.
+    template <int StateSize>
+    State integrateFixedSizeTime(
+        const State& aState,
+        const Instant& anInstant,
+        const FixedSizeSystemOfEquationsWrapper<StateSize>& aSystemOfEquations
+    );
+
     /// @brief Perform numerical integration from a start time until either a condition or an end time
     /// is reached.
     ///
+    /// Steppers without native dense output (RungeKutta4, RungeKuttaCashKarp54, RungeKuttaFehlberg78) take their
+    /// natural steps, and the condition is located on a cubic Hermite interpolant of each step. Returned states are
+    /// then recomputed with the stepper itself, from the start of the step.
+    ///
     /// @param aState Initial state for integration.
     /// @param anInstant Maximum time to integrate to.
     /// @param aSystemOfEquations System of equations to integrate.
@@ -132,6 +438,26 @@ class NumericalSolver : public MathNumericalSolver
         const EventCondition& anEventCondition
     );
 
+    /// @brief Perform numerical integration to an end time, recording every occurrence of a set of event conditions.
+    ///
+    /// Conditions do not terminate the integration: they are all checked on each step, in a single pass. An
+    /// occurrence is recorded whenever a condition becomes satisfied over a step (i.e. it is satisfied at the end of
+    /// the step with respect to its start, and was not already satisfied at its start), and its instant is refined
+    /// on the dense output of the step, as for a single condition. Conditions already satisfied at the initial state
+    /// are not recorded, and at most one occurrence per condition is recorded per step.
+    ///
+    /// @param aState Initial state for integration.
+    /// @param anInstant End time to integrate to.
+    /// @param aSystemOfEquations System of equations to integrate.
+    /// @param anEventConditionArray Conditions to be checked.
+    /// @return Structure containing the final state and the event occurrences.
+    EventsSolution integrateTime(
+        const State& aState,
+        const Instant& anInstant,
+        const SystemOfEquationsWrapper& aSystemOfEquations,
+        const Array<Shared<EventCondition>>& anEventConditionArray
+    );
+
     /// @brief Undefined
     ///
     /// @return An undefined numerical solver
@@ -150,6 +476,29 @@ class NumericalSolver : public MathNumericalSolver
     /// @return A fixed step size numerical solver.
     static NumericalSolver FixedStepSize(const NumericalSolver::StepperType& aStepperType, const Real& aTimeStep);
 
+    /// @brief Create a long horizon numerical solver.
+    ///
+    /// Meant for long duration propagation (e.g. months of station keeping), where the stepper takes large constant
+    /// steps. Ensemble integration and sessions are not supported.
+    ///
+    /// @code{.cpp}
+    ///                  NumericalSolver numericalSolver = NumericalSolver::LongHorizon(
+    ///                      NumericalSolver::LongHorizonScheme::AdamsBashforthMoulton, 60.0
+    ///                  );
+    /// @endcode
+    ///
+    /// @param aLongHorizonScheme A long horizon scheme.
+    /// @param aTimeStep The (constant) time step to use for integration.
+    ///
+    /// @return A long horizon numerical solver.
+    static NumericalSolver LongHorizon(const LongHorizonScheme& aLongHorizonScheme, const Real& aTimeStep);
+
+    /// @brief Convert long horizon scheme to string
+    ///
+    /// @param aLongHorizonScheme A long horizon scheme
+    /// @return String
+    static String StringFromLongHorizonScheme(const LongHorizonScheme& aLongHorizonScheme);
+
     /// @brief Default conditional
     ///
     /// @param stateLogger A function that takes a `State` object and logs. Defaults to `nullptr`.
@@ -203,9 +552,21 @@ class NumericalSolver : public MathNumericalSolver
     const Array<MathNumericalSolver::Solution>& accessObservedStateVectors() const = delete;
 
    private:
+    class StateBatchLoggerDelivery;
+
     RootSolver rootSolver_;
-    Array<State> observedStates_;
+    StateHistory observedStateHistory_;
+    mutable Array<State> observedStates_;
+    mutable bool observedStatesAreBuilt_;
     std::function<void(const State&)> stateLogger_;
+    LongHorizonScheme longHorizonScheme_;
+    Shared<const std::atomic<bool>> cancellationFlagSPtr_;
+    Shared<Statistics> statisticsSPtr_;
+    Shared<std::mutex> statisticsMutexSPtr_;
+    Shared<StateBatchLoggerDelivery> stateBatchLoggerDeliverySPtr_;
+    Array<State> stateBatch_;
+    Real initialTimeStep_;
+    Real finalTimeStep_;
 
     /// @brief Constructor
     ///
@@ -234,7 +595,63 @@ class NumericalSolver : public MathNumericalSolver
         const std::function<void(const State&)>& stateLogger
     );
 
+    bool isAdaptive() const;
+
+    double getInitialSignedTimeStep(const double& aDurationInSeconds) const;
+
     void observeState(const State& aState);
+
+    void deliverStateBatch();
+
+    void resetObservedStates();
+
+    SystemOfEquationsWrapper applyCancellationFlag(const SystemOfEquationsWrapper& aSystemOfEquations) const;
+
+    SystemOfEquationsWrapper applyStatistics(
+        const SystemOfEquationsWrapper& aSystemOfEquations, Statistics* aStatisticsPtr
+    ) const;
+
+    template <class DenseStepper, class StateCreator>
+    RootSolver::Solution solveConditionTime(
+        const DenseStepper& aDenseStepper,
+        const StateCreator& aStateCreator,
+        const EventCondition& anEventCondition,
+        const std::function<double(const double&)>& aConditionChecker,
+        const double& aPreviousTime,
+        const double& aCurrentTime
+    ) const;
+
+    ConditionSolution integrateTimeToCondition(
+        const State& aState,
+        const Real& aDurationInSeconds,
+        const SystemOfEquationsWrapper& aSystemOfEquations,
+        const EventCondition& anEventCondition,
+        Statistics* aStatisticsPtr
+    );
+
+    template <class DenseStepper>
+    ConditionSolution integrateTimeToCondition(
+        DenseStepper& aDenseStepper,
+        const State& aState,
+        const Real& aDurationInSeconds,
+        const SystemOfEquationsWrapper& aSystemOfEquations,
+        const EventCondition& anEventCondition,
+        Statistics* aStatisticsPtr
+    );
+
+    template <class DenseStepper>
+    EventsSolution integrateTimeWithEvents(
+        DenseStepper& aDenseStepper,
+        const State& aState,
+        const Real& aDurationInSeconds,
+        const SystemOfEquationsWrapper& aSystemOfEquations,
+        const Array<Shared<EventCondition>>& anEventConditionArray,
+        Statistics* aStatisticsPtr
+    );
+
+    /// @brief Call a visitor with the dense stepper of the stepper type (or long horizon scheme), for a state
+    template <class Visitor>
+    auto visitDenseStepper(const State& aState, const Visitor& aVisitor);
 };
 
 }  // namespace state
@@ -0,0 +1,120 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateHistory__
+#define __OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateHistory__
+
+#include <vector>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateBroker.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace trajectory
+{
+namespace state
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::time::Instant;
+
+using ostk::astrodynamics::trajectory::State;
+
+/// @brief Columnar history of states sharing a frame and a coordinate broker
+///
+/// Instants are stored in one contiguous array, and coordinates in another, state after state, while the frame and
+/// the coordinate broker are held once for the whole history. States are built on access.
+class StateHistory
+{
+   public:
+    /// @brief Constructor, for an empty history
+    StateHistory();
+
+    /// @brief Check if history is empty
+    ///
+    /// @return True if history is empty
+    bool isEmpty() const;
+
+    /// @brief Get number of states
+    ///
+    /// @return Number of states
+    Size getSize() const;
+
+    /// @brief Access frame of the states
+    ///
+    /// @return Frame
+    const Shared<const Frame>& accessFrame() const;
+
+    /// @brief Access coordinate broker of the states
+    ///
+    /// @return Coordinate broker
+    const Shared<const CoordinateBroker>& accessCoordinateBroker() const;
+
+    /// @brief Access instant of a state
+    ///
+    /// @param anIndex A state index
+    /// @return Instant
+    const Instant& accessInstantAt(const Index& anIndex) const;
+
+    /// @brief Get a state
+    ///
+    /// @param anIndex A state index
+    /// @return State
+    State getStateAt(const Index& anIndex) const;
+
+    /// @brief Get all states
+    ///
+    /// @return Array of states
+    Array<State> getStates() const;
+
+    /// @brief Reserve storage for a number of states
+    ///
+    /// @param aStateCount A number of states
+    void reserve(const Size& aStateCount);
+
+    /// @brief Remove all states
+    void clear();
+
+    /// @brief Add a state
+    ///
+    /// The first state added sets the frame, coordinate broker and size of the history, to which the subsequent states
+    /// must conform.
+    ///
+    /// @param aState A state
+    void add(const State& aState);
+
+    /// @brief Add the states of another history
+    ///
+    /// @param aStateHistory A state history
+    /// @param aStartIndex Index of the first state of the other history to add. Defaults to 0.
+    void add(const StateHistory& aStateHistory, const Index& aStartIndex = 0);
+
+   private:
+    Shared<const Frame> frameSPtr_;
+    Shared<const CoordinateBroker> coordinateBrokerSPtr_;
+    Size stateSize_;
+    std::vector<Instant> instants_;
+    std::vector<double> coordinates_;
+};
+
+}  // namespace state
+}  // namespace trajectory
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
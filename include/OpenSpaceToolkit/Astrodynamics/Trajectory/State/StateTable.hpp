@@ -0,0 +1,170 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateTable__
+#define __OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateTable__
+
+#include <cstdint>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateBroker.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace trajectory
+{
+namespace state
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::MatrixXd;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::time::Instant;
+
+using ostk::astrodynamics::trajectory::State;
+
+/// @brief Columnar table of states sharing a frame and a coordinate broker
+///
+/// Instants are stored as a column of nanosecond offsets from an epoch, and coordinates as a column-major matrix with
+/// one row per state: each coordinate is a contiguous column, which columnar consumers (NumPy, pandas, Arrow) can
+/// share as is, without copying. The frame and the coordinate broker are held once for the whole table.
+class StateTable
+{
+   public:
+    using OffsetVector = Eigen::Matrix<std::int64_t, Eigen::Dynamic, 1>;
+
+    /// @brief Constructor
+    ///
+    /// @param anEpoch An epoch
+    /// @param anOffsetVector A vector of offsets from the epoch [ns], one per state
+    /// @param aCoordinateMatrix A matrix of coordinates, one row per state
+    /// @param aFrameSPtr A frame
+    /// @param aCoordinateBrokerSPtr A coordinate broker, describing the columns of the coordinate matrix
+    StateTable(
+        const Instant& anEpoch,
+        const OffsetVector& anOffsetVector,
+        const MatrixXd& aCoordinateMatrix,
+        const Shared<const Frame>& aFrameSPtr,
+        const Shared<const CoordinateBroker>& aCoordinateBrokerSPtr
+    );
+
+    /// @brief Equal to operator
+    ///
+    /// @param aStateTable A state table
+    /// @return True if state tables are equal
+    bool operator==(const StateTable& aStateTable) const;
+
+    /// @brief Not equal to operator
+    ///
+    /// @param aStateTable A state table
+    /// @return True if state tables are not equal
+    bool operator!=(const StateTable& aStateTable) const;
+
+    /// @brief Check if state table is defined
+    ///
+    /// @return True if state table is defined
+    bool isDefined() const;
+
+    /// @brief Get number of states
+    ///
+    /// @return Number of states
+    Size getSize() const;
+
+    /// @brief Access epoch
+    ///
+    /// @return Epoch
+    const Instant& accessEpoch() const;
+
+    /// @brief Access offsets from the epoch
+    ///
+    /// @return Vector of offsets [ns], one per state
+    const OffsetVector& accessOffsets() const;
+
+    /// @brief Access coordinates
+    ///
+    /// @return Matrix of coordinates, one row per state
+    const MatrixXd& accessCoordinates() const;
+
+    /// @brief Access coordinates of a subset
+    ///
+    /// @param aCoordinateSubsetSPtr A coordinate subset
+    /// @return Contiguous block of the coordinate matrix columns of the subset
+    Eigen::Ref<const MatrixXd> accessCoordinatesOf(const Shared<const CoordinateSubset>& aCoordinateSubsetSPtr) const;
+
+    /// @brief Access frame
+    ///
+    /// @return Frame
+    const Shared<const Frame>& accessFrame() const;
+
+    /// @brief Access coordinate broker
+    ///
+    /// @return Coordinate broker
+    const Shared<const CoordinateBroker>& accessCoordinateBroker() const;
+
+    /// @brief Get instant of a state
+    ///
+    /// @param anIndex A state index
+    /// @return Instant
+    Instant getInstantAt(const Index& anIndex) const;
+
+    /// @brief Get all instants
+    ///
+    /// @return Array of instants
+    Array<Instant> getInstants() const;
+
+    /// @brief Get a state
+    ///
+    /// @param anIndex A state index
+    /// @return State
+    State getStateAt(const Index& anIndex) const;
+
+    /// @brief Get all states
+    ///
+    /// @return Array of states
+    Array<State> getStates() const;
+
+    /// @brief Constructs an undefined state table
+    ///
+    /// @return Undefined state table
+    static StateTable Undefined();
+
+    /// @brief Constructs a state table from states
+    ///
+    /// The epoch is the instant of the first state. States expressed in another frame than the first one are
+    /// converted to the frame of the first one, and all states must share the coordinate subsets of the first one.
+    ///
+    /// @param aStateArray An array of states
+    /// @return State table
+    static StateTable FromStates(const Array<State>& aStateArray);
+
+   private:
+    Instant epoch_;
+    OffsetVector offsets_;
+    MatrixXd coordinates_;
+    Shared<const Frame> frameSPtr_;
+    Shared<const CoordinateBroker> coordinateBrokerSPtr_;
+};
+
+}  // namespace state
+}  // namespace trajectory
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
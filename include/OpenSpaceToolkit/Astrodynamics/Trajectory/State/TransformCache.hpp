@@ -0,0 +1,87 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_State_TransformCache__
+#define __OpenSpaceToolkit_Astrodynamics_Trajectory_State_TransformCache__
+
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace trajectory
+{
+namespace state
+{
+
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Transform;
+using ostk::physics::time::Instant;
+
+/// @brief Process-wide cache of frame transforms
+///
+/// Transforms are keyed by (from frame, to frame, instant), frames being identified by address (the cache holds on to
+/// them, so that an address cannot be reused while cached). The cache is thread-safe, and bounded: when full, the least
+/// recently used transform is evicted. Transforms are computed outside of the lock, GCRF to ITRF transforms following
+/// the EarthOrientation model.
+class TransformCache
+{
+   public:
+    /// @brief Default capacity
+    static constexpr Size DefaultCapacity = 4096;
+
+    /// @brief Get the transform between two frames at a given instant, computing it only if not cached
+    ///
+    /// @code{.cpp}
+    ///              Transform transform = TransformCache::Get(Frame::TEME(), Frame::GCRF(), anInstant) ;
+    /// @endcode
+    ///
+    /// @param aFromFrameSPtr A frame to transform from
+    /// @param aToFrameSPtr A frame to transform to
+    /// @param anInstant An instant
+    /// @return Transform
+    static Transform Get(
+        const Shared<const Frame>& aFromFrameSPtr, const Shared<const Frame>& aToFrameSPtr, const Instant& anInstant
+    );
+
+    /// @brief Get the number of cached transforms
+    ///
+    /// @return Number of cached transforms
+    static Size GetSize();
+
+    /// @brief Get the capacity
+    ///
+    /// @return Capacity (maximum number of cached transforms)
+    static Size GetCapacity();
+
+    /// @brief Set the capacity, evicting transforms if needed
+    ///
+    /// @param aCapacity A capacity (0 disables caching)
+    static void SetCapacity(const Size& aCapacity);
+
+    /// @brief Get the generation of the cache, incremented by each clear
+    ///
+    /// Caches of transforms layered on top of this one (e.g. per-thread caches) compare generations to find out whether
+    /// their transforms are stale.
+    ///
+    /// @return Generation
+    static Size GetGeneration();
+
+    /// @brief Clear the cache, incrementing its generation
+    static void Clear();
+};
+
+}  // namespace state
+}  // namespace trajectory
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
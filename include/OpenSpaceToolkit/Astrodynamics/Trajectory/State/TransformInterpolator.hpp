@@ -0,0 +1,115 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Astrodynamics_Trajectory_State_TransformInterpolator__
+#define __OpenSpaceToolkit_Astrodynamics_Trajectory_State_TransformInterpolator__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace trajectory
+{
+namespace state
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Real;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Transform;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+
+/// @brief Interpolator of the transform between two frames over an interval
+///
+/// Exact transforms are computed on a uniform grid of nodes spanning the interval, and interpolated in between: the
+/// orientation is spherically interpolated, while the translation, velocity and angular velocity are linearly
+/// interpolated. As a rotation at constant rate about a fixed axis is reproduced exactly, the Earth rotation angle of
+/// Earth-fixed transforms is retrieved at each instant, and only the slowly varying precession, nutation and polar
+/// motion are approximated. For GCRF to ITRF, the orientation error grows with the square of the step, at about 1e-16
+/// rad/s^2 times the step squared, i.e. below 0.1 mm on LEO and 1 mm on GEO positions with the default step.
+///
+/// Translations are interpolated linearly, hence the interpolator is meant for frames sharing their origin.
+class TransformInterpolator
+{
+   public:
+    /// @brief Constructor
+    ///
+    /// @code{.cpp}
+    ///              TransformInterpolator interpolator = {Frame::GCRF(), Frame::ITRF(), anInterval} ;
+    /// @endcode
+    ///
+    /// @param aFromFrameSPtr A frame to transform from
+    /// @param aToFrameSPtr A frame to transform to
+    /// @param anInterval An interval over which transforms are interpolated
+    /// @param aStep A step between exactly computed transforms. Defaults to 5 minutes.
+    TransformInterpolator(
+        const Shared<const Frame>& aFromFrameSPtr,
+        const Shared<const Frame>& aToFrameSPtr,
+        const Interval& anInterval,
+        const Duration& aStep = Duration::Minutes(5.0)
+    );
+
+    /// @brief Get the interval
+    ///
+    /// @return Interval
+    Interval getInterval() const;
+
+    /// @brief Get the step between exactly computed transforms
+    ///
+    /// @return Step
+    Duration getStep() const;
+
+    /// @brief Get the number of exactly computed transforms
+    ///
+    /// @return Number of transforms
+    Size getNodeCount() const;
+
+    /// @brief Get the transform at a given instant
+    ///
+    /// @param anInstant An instant within the interval
+    /// @return Transform
+    Transform getTransformAt(const Instant& anInstant) const;
+
+    /// @brief Interpolate between two transforms
+    ///
+    /// @param aPreviousTransform A transform at the start of the step
+    /// @param aNextTransform A transform at the end of the step
+    /// @param anInstant The instant of the interpolated transform
+    /// @param aRatio The ratio of the step elapsed at the instant, in [0, 1]
+    /// @return Interpolated transform
+    static Transform Interpolate(
+        const Transform& aPreviousTransform,
+        const Transform& aNextTransform,
+        const Instant& anInstant,
+        const Real& aRatio
+    );
+
+   private:
+    Shared<const Frame> fromFrameSPtr_;
+    Shared<const Frame> toFrameSPtr_;
+    Interval interval_;
+    Duration step_;
+    Array<Transform> nodeTransforms_;
+};
+
+}  // namespace state
+}  // namespace trajectory
+}  // namespace astrodynamics
+}  // namespace ostk
+
+#endif
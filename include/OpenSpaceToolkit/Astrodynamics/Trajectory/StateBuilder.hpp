@@ -4,9 +4,11 @@
 #define __OpenSpaceToolkit_Astrodynamics_Trajectory_StateBuilder__
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
 #include <OpenSpaceToolkit/Core/Type/Size.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
 
@@ -25,9 +27,11 @@ namespace trajectory
 {
 
 using ostk::core::container::Array;
+using ostk::core::type::Index;
 using ostk::core::type::Integer;
 using ostk::core::type::Shared;
 using ostk::core::type::Size;
+using ostk::core::type::String;
 
 using ostk::mathematics::object::VectorXd;
 
@@ -121,6 +125,25 @@ class StateBuilder
     /// @return A State with the CoordinateSubsets of the StateBuilder.
     const State expand(const State& aState, const State& defaultState) const;
 
+    /// @brief Produce States with the CoordinateSubsets specified by the StateBuilder.
+    ///
+    /// The mapping between the coordinate subsets of the input states and those of the StateBuilder is computed once
+    /// per coordinate broker, and shared by all the states using that broker.
+    ///
+    /// @param aStateArray the states from which the coordinates will be taken.
+    /// @return States with the CoordinateSubsets of the StateBuilder.
+    Array<State> reduce(const Array<State>& aStateArray) const;
+
+    /// @brief Produce States with the CoordinateSubsets specified by the StateBuilder.
+    ///
+    /// The mapping between the coordinate subsets of the input states and those of the StateBuilder is computed once
+    /// per coordinate broker, and shared by all the states using that broker.
+    ///
+    /// @param aStateArray the states from which the coordinates will be taken.
+    /// @param defaultState the state from which missing coordinates will be taken.
+    /// @return States with the CoordinateSubsets of the StateBuilder.
+    Array<State> expand(const Array<State>& aStateArray, const State& defaultState) const;
+
     /// @brief Accessor for the reference frame.
     ///
     /// @return The reference frame
@@ -153,8 +176,31 @@ class StateBuilder
     static StateBuilder Undefined();
 
    private:
+    /// @brief Contiguous run of coordinates copied to the output coordinates
+    struct CoordinateSegment
+    {
+        bool fromDefaultState;
+        Index sourceIndex;
+        Index destinationIndex;
+        Size size;
+    };
+
     Shared<const Frame> frameSPtr_;
     Shared<const CoordinateBroker> coordinatesBrokerSPtr_;
+
+    void validateState(const State& aState, const String& aName) const;
+
+    Array<CoordinateSegment> computeReductionSegments(const CoordinateBroker& aCoordinateBroker) const;
+
+    Array<CoordinateSegment> computeExpansionSegments(
+        const CoordinateBroker& aCoordinateBroker, const CoordinateBroker& aDefaultCoordinateBroker
+    ) const;
+
+    State buildFromSegments(
+        const Array<CoordinateSegment>& aCoordinateSegmentArray, const State& aState, const State& defaultState
+    ) const;
+
+    static void AddSegment(Array<CoordinateSegment>& aCoordinateSegmentArray, const CoordinateSegment& aSegment);
 };
 
 }  // namespace trajectory
@@ -0,0 +1,301 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <vector>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Access/AerFilter.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace access
+{
+
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+// Conversion of raw radians to degrees, for filters defined in degrees
+static const double degreesPerRadian = 180.0 / M_PI;
+
+bool AerFilter::operator()(const AER& anAer) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("AER filter");
+    }
+
+    return predicate_(
+        anAer.getAzimuth().inRadians(0.0, Real::TwoPi()),
+        anAer.getElevation().inRadians(-Real::Pi(), +Real::Pi()),
+        anAer.getRange().inMeters()
+    );
+}
+
+bool AerFilter::evaluate(const double& anAzimuth, const double& anElevation, const double& aRange) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("AER filter");
+    }
+
+    return predicate_(anAzimuth, anElevation, aRange);
+}
+
+bool AerFilter::isDefined() const
+{
+    return static_cast<bool>(predicate_);
+}
+
+AerFilter AerFilter::Undefined()
+{
+    return AerFilter(std::function<bool(const double&, const double&, const double&)>());
+}
+
+AerFilter AerFilter::Azimuth(const Interval<Real>& anAzimuthInterval)
+{
+    if (!anAzimuthInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Azimuth interval");
+    }
+
+    return {[anAzimuthInterval](const double& anAzimuth, const double&, const double&) -> bool
+            {
+                return anAzimuthInterval.contains(anAzimuth * degreesPerRadian);
+            }};
+}
+
+AerFilter AerFilter::Elevation(const Interval<Real>& anElevationInterval)
+{
+    if (!anElevationInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Elevation interval");
+    }
+
+    return {[anElevationInterval](const double&, const double& anElevation, const double&) -> bool
+            {
+                return anElevationInterval.contains(anElevation * degreesPerRadian);
+            }};
+}
+
+AerFilter AerFilter::Range(const Interval<Real>& aRangeInterval)
+{
+    if (!aRangeInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Range interval");
+    }
+
+    return {[aRangeInterval](const double&, const double&, const double& aRange) -> bool
+            {
+                return aRangeInterval.contains(aRange);
+            }};
+}
+
+AerFilter AerFilter::Ranges(
+    const Interval<Real>& anAzimuthInterval,
+    const Interval<Real>& anElevationInterval,
+    const Interval<Real>& aRangeInterval
+)
+{
+    return {[anAzimuthInterval, anElevationInterval, aRangeInterval](
+                const double& anAzimuth, const double& anElevation, const double& aRange
+            ) -> bool
+            {
+                return ((!anAzimuthInterval.isDefined()) || anAzimuthInterval.contains(anAzimuth * degreesPerRadian)) &&
+                       ((!anElevationInterval.isDefined()) ||
+                        anElevationInterval.contains(anElevation * degreesPerRadian)) &&
+                       ((!aRangeInterval.isDefined()) || aRangeInterval.contains(aRange));
+            }};
+}
+
+// Azimuth-elevation mask, as mask segments in radians, and uniform azimuth bins referencing the segment containing
+// their start azimuth. Bins are at least as fine as the mask points on average, so that an evaluation advances over
+// at most a few segments from its bin.
+
+namespace
+{
+
+struct ElevationMaskLookup
+{
+    std::vector<double> segmentStartAzimuths;    ///< Segment start azimuths [rad], increasing.
+    std::vector<double> segmentStartElevations;  ///< Minimum elevations at segment starts [rad].
+    std::vector<double> segmentSlopes;           ///< Minimum elevation slopes [rad/rad].
+    std::vector<Size> binSegmentIndices;         ///< Index of the segment containing each bin start azimuth.
+    double binsPerRadian = 0.0;
+
+    ElevationMaskLookup(const Map<Real, Real>& anAzimuthElevationMask)
+    {
+        const double radiansPerDegree = M_PI / 180.0;
+
+        // Mask points span [0, 360] deg, hence n points define n - 1 segments
+
+        for (auto it = anAzimuthElevationMask.begin(); std::next(it) != anAzimuthElevationMask.end(); ++it)
+        {
+            const auto nextIt = std::next(it);
+
+            const double startAzimuth = it->first * radiansPerDegree;
+            const double startElevation = it->second * radiansPerDegree;
+            const double endAzimuth = nextIt->first * radiansPerDegree;
+            const double endElevation = nextIt->second * radiansPerDegree;
+
+            segmentStartAzimuths.push_back(startAzimuth);
+            segmentStartElevations.push_back(startElevation);
+            segmentSlopes.push_back((endElevation - startElevation) / (endAzimuth - startAzimuth));
+        }
+
+        const Size binCount = std::max<Size>(360, 2 * segmentStartAzimuths.size());
+
+        binsPerRadian = static_cast<double>(binCount) / (2.0 * M_PI);
+        binSegmentIndices.resize(binCount);
+
+        Size segmentIndex = 0;
+
+        for (Size binIndex = 0; binIndex < binCount; ++binIndex)
+        {
+            const double binStartAzimuth = static_cast<double>(binIndex) / binsPerRadian;
+
+            while (((segmentIndex + 1) < segmentStartAzimuths.size()) &&
+                   (segmentStartAzimuths[segmentIndex + 1] <= binStartAzimuth))
+            {
+                ++segmentIndex;
+            }
+
+            binSegmentIndices[binIndex] = segmentIndex;
+        }
+    }
+
+    double computeMinimumElevation(const double& anAzimuth) const
+    {
+        const Size binIndex =
+            std::min<Size>(static_cast<Size>(std::max(anAzimuth, 0.0) * binsPerRadian), binSegmentIndices.size() - 1);
+
+        Size segmentIndex = binSegmentIndices[binIndex];
+
+        while (((segmentIndex + 1) < segmentStartAzimuths.size()) &&
+               (segmentStartAzimuths[segmentIndex + 1] <= anAzimuth))
+        {
+            ++segmentIndex;
+        }
+
+        return segmentStartElevations[segmentIndex] +
+               segmentSlopes[segmentIndex] * (anAzimuth - segmentStartAzimuths[segmentIndex]);
+    }
+};
+
+}  // namespace
+
+AerFilter AerFilter::Mask(const Map<Real, Real>& anAzimuthElevationMask, const Interval<Real>& aRangeInterval)
+{
+    if ((anAzimuthElevationMask.empty()) || (anAzimuthElevationMask.begin()->first < 0.0) ||
+        (anAzimuthElevationMask.rbegin()->first > 360.0))
+    {
+        throw ostk::core::error::runtime::Wrong("Azimuth-Elevation Mask");
+    }
+
+    for (const auto& azimuthElevationPair : anAzimuthElevationMask)
+    {
+        if ((azimuthElevationPair.second).abs() > 90.0)
+        {
+            throw ostk::core::error::runtime::Wrong("Azimuth-Elevation Mask");
+        }
+    }
+
+    Map<Real, Real> azimuthElevationMask = anAzimuthElevationMask;
+
+    if (azimuthElevationMask.begin()->first != 0.0)
+    {
+        azimuthElevationMask.insert({0.0, azimuthElevationMask.begin()->second});
+    }
+
+    if (azimuthElevationMask.rbegin()->first != 360.0)
+    {
+        azimuthElevationMask.insert({360.0, azimuthElevationMask.begin()->second});
+    }
+
+    const Shared<const ElevationMaskLookup> elevationMaskLookupSPtr =
+        std::make_shared<ElevationMaskLookup>(azimuthElevationMask);
+
+    return {[elevationMaskLookupSPtr, aRangeInterval](
+                const double& anAzimuth, const double& anElevation, const double& aRange
+            ) -> bool
+            {
+                return (anElevation >= elevationMaskLookupSPtr->computeMinimumElevation(anAzimuth)) &&
+                       ((!aRangeInterval.isDefined()) || aRangeInterval.contains(aRange));
+            }};
+}
+
+AerFilter AerFilter::And(const Array<AerFilter>& aFilterArray)
+{
+    for (const AerFilter& filter : aFilterArray)
+    {
+        if (!filter.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("AER filter");
+        }
+    }
+
+    return {[aFilterArray](const double& anAzimuth, const double& anElevation, const double& aRange) -> bool
+            {
+                for (const AerFilter& filter : aFilterArray)
+                {
+                    if (!filter.predicate_(anAzimuth, anElevation, aRange))
+                    {
+                        return false;
+                    }
+                }
+
+                return true;
+            }};
+}
+
+AerFilter AerFilter::Or(const Array<AerFilter>& aFilterArray)
+{
+    for (const AerFilter& filter : aFilterArray)
+    {
+        if (!filter.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("AER filter");
+        }
+    }
+
+    return {[aFilterArray](const double& anAzimuth, const double& anElevation, const double& aRange) -> bool
+            {
+                for (const AerFilter& filter : aFilterArray)
+                {
+                    if (filter.predicate_(anAzimuth, anElevation, aRange))
+                    {
+                        return true;
+                    }
+                }
+
+                return false;
+            }};
+}
+
+AerFilter AerFilter::Not(const AerFilter& aFilter)
+{
+    if (!aFilter.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("AER filter");
+    }
+
+    return {[aFilter](const double& anAzimuth, const double& anElevation, const double& aRange) -> bool
+            {
+                return !aFilter.predicate_(anAzimuth, anElevation, aRange);
+            }};
+}
+
+AerFilter::AerFilter(const std::function<bool(const double&, const double&, const double&)>& aPredicate)
+    : predicate_(aPredicate)
+{
+}
+
+}  // namespace access
+}  // namespace astrodynamics
+}  // namespace ostk
@@ -0,0 +1,549 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Access/CoverageGenerator.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace access
+{
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Transform;
+using ostk::physics::time::Instant;
+
+using ostk::astrodynamics::trajectory::State;
+
+// Upper bound of the deflection between the geodetic and geocentric verticals, with margin
+static const double verticalDeflectionMargin_rad = Angle::Degrees(0.5).inRadians();
+
+static const double latitudeBandWidth_rad = Angle::Degrees(1.0).inRadians();
+
+// Satellite geometry layout, shared with the device kernel: position [m] (3), direction (3), cosine of the Earth
+// central angle of the visibility cone, and that angle [rad]
+static const Size satelliteGeometryStride = 8;
+
+#ifdef OSTK_ASTRODYNAMICS_WITH_CUDA
+
+// Per-chunk visibility buffer size [B], one byte per grid point and instant
+static const Size deviceVisibilityBufferSize = 64 * 1024 * 1024;
+
+// Implemented in CoverageGenerator.cu
+namespace cuda
+{
+
+struct Grid;
+
+int GetDeviceCount();
+
+Grid* UploadGrid(
+    const double* aGridPositionArray,
+    const double* aGridVerticalArray,
+    const std::size_t aPointCount,
+    const char** anErrorMessage
+);
+
+void ReleaseGrid(Grid* aGridPtr);
+
+const char* ComputeVisibilities(
+    const Grid* aGridPtr,
+    const double* aSatelliteGeometryArray,
+    const std::size_t anInstantCount,
+    const std::size_t aSatelliteCount,
+    const double aSinMinimumElevation,
+    std::uint8_t* aVisibilityArray
+);
+
+}  // namespace cuda
+
+#endif
+
+CoverageGenerator::CoverageGenerator(
+    const Array<LLA>& aGridPointArray,
+    const Angle& aMinimumElevation,
+    const Shared<const Celestial>& aCelestialSPtr,
+    const Duration& aStep,
+    const Backend& aBackend
+)
+    : gridPoints_(aGridPointArray),
+      minimumElevation_(aMinimumElevation),
+      celestialSPtr_(aCelestialSPtr),
+      step_(aStep),
+      backend_(aBackend),
+      gridPositions_(Array<Vector3d>::Empty()),
+      gridVerticals_(Array<Vector3d>::Empty()),
+      bandWidth_rad_(latitudeBandWidth_rad),
+      bandIndices_(Array<Array<Index>>::Empty())
+{
+    if (!CoverageGenerator::IsBackendAvailable(this->backend_))
+    {
+        throw ostk::core::error::RuntimeError("CUDA coverage backend is not available.");
+    }
+
+    if (!this->isDefined())
+    {
+        return;
+    }
+
+    const Size bandCount = static_cast<Size>(std::ceil(M_PI / this->bandWidth_rad_));
+
+    this->bandIndices_ = Array<Array<Index>>(bandCount, Array<Index>::Empty());
+
+    this->gridPositions_.reserve(this->gridPoints_.getSize());
+    this->gridVerticals_.reserve(this->gridPoints_.getSize());
+
+    for (Index index = 0; index < this->gridPoints_.getSize(); ++index)
+    {
+        const LLA& gridPoint = this->gridPoints_[index];
+
+        const Vector3d position =
+            gridPoint.toCartesian(this->celestialSPtr_->getEquatorialRadius(), this->celestialSPtr_->getFlattening());
+
+        const double latitude_rad = gridPoint.getLatitude().inRadians();
+        const double longitude_rad = gridPoint.getLongitude().inRadians();
+
+        this->gridPositions_.add(position);
+        this->gridVerticals_.add(
+            {std::cos(latitude_rad) * std::cos(longitude_rad),
+             std::cos(latitude_rad) * std::sin(longitude_rad),
+             std::sin(latitude_rad)}
+        );
+
+        const double geocentricLatitude_rad = std::asin(position.z() / position.norm());
+
+        const Index bandIndex = std::min(
+            static_cast<Index>((geocentricLatitude_rad + M_PI / 2.0) / this->bandWidth_rad_), bandCount - 1
+        );
+
+        this->bandIndices_[bandIndex].add(index);
+    }
+}
+
+bool CoverageGenerator::isDefined() const
+{
+    return this->minimumElevation_.isDefined() && (this->celestialSPtr_ != nullptr) &&
+           this->celestialSPtr_->isDefined() && this->step_.isDefined() && this->step_.isStrictlyPositive();
+}
+
+Array<LLA> CoverageGenerator::getGridPoints() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Coverage Generator");
+    }
+
+    return this->gridPoints_;
+}
+
+Angle CoverageGenerator::getMinimumElevation() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Coverage Generator");
+    }
+
+    return this->minimumElevation_;
+}
+
+Duration CoverageGenerator::getStep() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Coverage Generator");
+    }
+
+    return this->step_;
+}
+
+CoverageGenerator::Backend CoverageGenerator::getBackend() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Coverage Generator");
+    }
+
+    return this->backend_;
+}
+
+Array<CoverageGenerator::PointCoverage> CoverageGenerator::computeCoverage(
+    const physics::time::Interval& anInterval, const Array<Trajectory>& aTrajectoryArray
+) const
+{
+    if (!anInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Coverage Generator");
+    }
+
+    for (const Trajectory& trajectory : aTrajectoryArray)
+    {
+        if (!trajectory.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Trajectory");
+        }
+    }
+
+    const Array<Instant> instants = anInterval.generateGrid(this->step_);
+
+    // Each satellite is evaluated once per instant
+
+    Array<Array<State>> statesArray = Array<Array<State>>::Empty();
+    statesArray.reserve(aTrajectoryArray.getSize());
+
+    for (const Trajectory& trajectory : aTrajectoryArray)
+    {
+        statesArray.add(trajectory.getStatesAt(instants));
+    }
+
+    const Shared<const Frame> fixedFrameSPtr = this->celestialSPtr_->accessFrame();
+
+    const double polarRadius_m =
+        this->celestialSPtr_->getEquatorialRadius().inMeters() * (1.0 - this->celestialSPtr_->getFlattening());
+
+    const double minimumElevation_rad = this->minimumElevation_.inRadians();
+    const double sinMinimumElevation = std::sin(minimumElevation_rad);
+
+    // The polar sphere and the vertical deflection margin make the visibility cone conservative
+
+    const double screeningElevation_rad = minimumElevation_rad - verticalDeflectionMargin_rad;
+
+    const Size pointCount = this->gridPoints_.getSize();
+    const Size satelliteCount = statesArray.getSize();
+
+    // Fills the satellite geometries at an instant: position and direction in the frame of the central body, cosine
+    // and value of the Earth central angle of the visibility cone
+
+    const auto computeSatelliteGeometries =
+        [&statesArray, &instants, &fixedFrameSPtr, polarRadius_m, screeningElevation_rad](
+            const Index& anInstantIndex, double* aSatelliteGeometryArray
+        ) -> void
+    {
+        const Instant& instant = instants[anInstantIndex];
+
+        // One transform per frame and instant, shared by the satellites expressed in that frame
+
+        Shared<const Frame> transformFrameSPtr = nullptr;
+        Transform transform = Transform::Undefined();
+
+        for (Index satelliteIndex = 0; satelliteIndex < statesArray.getSize(); ++satelliteIndex)
+        {
+            const State& state = statesArray[satelliteIndex][anInstantIndex];
+
+            Vector3d satellitePosition = state.accessPositionCoordinates();
+
+            if (state.accessFrame() != fixedFrameSPtr)
+            {
+                if (state.accessFrame() != transformFrameSPtr)
+                {
+                    transformFrameSPtr = state.accessFrame();
+                    transform = transformFrameSPtr->getTransformTo(fixedFrameSPtr, instant);
+                }
+
+                satellitePosition = transform.applyToPosition(satellitePosition);
+            }
+
+            const double satelliteRadius_m = satellitePosition.norm();
+            const Vector3d satelliteDirection = satellitePosition / satelliteRadius_m;
+
+            const double horizonRatio = polarRadius_m * std::cos(screeningElevation_rad) / satelliteRadius_m;
+
+            const double centralAngle_rad =
+                (horizonRatio < 1.0) ? std::min(std::acos(horizonRatio) - screeningElevation_rad, M_PI) : M_PI;
+
+            double* geometry = aSatelliteGeometryArray + (satelliteIndex * satelliteGeometryStride);
+
+            geometry[0] = satellitePosition.x();
+            geometry[1] = satellitePosition.y();
+            geometry[2] = satellitePosition.z();
+            geometry[3] = satelliteDirection.x();
+            geometry[4] = satelliteDirection.y();
+            geometry[5] = satelliteDirection.z();
+            geometry[6] = std::cos(centralAngle_rad);
+            geometry[7] = centralAngle_rad;
+        }
+    };
+
+    static const Index noIndex = std::numeric_limits<Index>::max();
+
+    std::vector<Index> lastVisibleIndices(pointCount, noIndex);
+    std::vector<Index> accessStartIndices(pointCount, noIndex);
+    Array<Array<physics::time::Interval>> accessIntervalsArray(pointCount, Array<physics::time::Interval>::Empty());
+
+    const auto recordVisibility =
+        [&instants, &lastVisibleIndices, &accessStartIndices, &accessIntervalsArray](
+            const Index& aPointIndex, const Index& anInstantIndex
+        ) -> void
+    {
+        const Index lastVisibleIndex = lastVisibleIndices[aPointIndex];
+
+        if (lastVisibleIndex == anInstantIndex)
+        {
+            return;
+        }
+
+        // Close the previous access of the point if it is not contiguous
+
+        if ((lastVisibleIndex == noIndex) || (lastVisibleIndex + 1 != anInstantIndex))
+        {
+            if (lastVisibleIndex != noIndex)
+            {
+                accessIntervalsArray[aPointIndex].add(physics::time::Interval::Closed(
+                    instants[accessStartIndices[aPointIndex]], instants[lastVisibleIndex]
+                ));
+            }
+
+            accessStartIndices[aPointIndex] = anInstantIndex;
+        }
+
+        lastVisibleIndices[aPointIndex] = anInstantIndex;
+    };
+
+    if (this->backend_ == Backend::CUDA)
+    {
+#ifdef OSTK_ASTRODYNAMICS_WITH_CUDA
+
+        std::vector<double> gridPositions(3 * pointCount);
+        std::vector<double> gridVerticals(3 * pointCount);
+
+        for (Index pointIndex = 0; pointIndex < pointCount; ++pointIndex)
+        {
+            for (Index axisIndex = 0; axisIndex < 3; ++axisIndex)
+            {
+                gridPositions[3 * pointIndex + axisIndex] = this->gridPositions_[pointIndex](axisIndex);
+                gridVerticals[3 * pointIndex + axisIndex] = this->gridVerticals_[pointIndex](axisIndex);
+            }
+        }
+
+        const char* errorMessage = nullptr;
+
+        const std::unique_ptr<cuda::Grid, void (*)(cuda::Grid*)> gridUPtr = {
+            cuda::UploadGrid(gridPositions.data(), gridVerticals.data(), pointCount, &errorMessage), &cuda::ReleaseGrid
+        };
+
+        if (gridUPtr == nullptr)
+        {
+            throw ostk::core::error::RuntimeError("Cannot upload coverage grid to device: [{}].", errorMessage);
+        }
+
+        // Instants are processed in chunks, bounding the size of the visibility buffer
+
+        const Size chunkInstantCount = std::max<Size>(deviceVisibilityBufferSize / std::max<Size>(pointCount, 1), 1);
+
+        std::vector<double> satelliteGeometries(chunkInstantCount * satelliteCount * satelliteGeometryStride);
+        std::vector<std::uint8_t> visibilities(chunkInstantCount * pointCount);
+
+        for (Index chunkStartIndex = 0; chunkStartIndex < instants.getSize(); chunkStartIndex += chunkInstantCount)
+        {
+            const Size instantCount = std::min(chunkInstantCount, instants.getSize() - chunkStartIndex);
+
+            for (Index instantOffset = 0; instantOffset < instantCount; ++instantOffset)
+            {
+                computeSatelliteGeometries(
+                    chunkStartIndex + instantOffset,
+                    satelliteGeometries.data() + (instantOffset * satelliteCount * satelliteGeometryStride)
+                );
+            }
+
+            errorMessage = cuda::ComputeVisibilities(
+                gridUPtr.get(),
+                satelliteGeometries.data(),
+                instantCount,
+                satelliteCount,
+                sinMinimumElevation,
+                visibilities.data()
+            );
+
+            if (errorMessage != nullptr)
+            {
+                throw ostk::core::error::RuntimeError("Cannot compute visibilities on device: [{}].", errorMessage);
+            }
+
+            for (Index instantOffset = 0; instantOffset < instantCount; ++instantOffset)
+            {
+                const std::uint8_t* instantVisibilities = visibilities.data() + (instantOffset * pointCount);
+
+                for (Index pointIndex = 0; pointIndex < pointCount; ++pointIndex)
+                {
+                    if (instantVisibilities[pointIndex] != 0)
+                    {
+                        recordVisibility(pointIndex, chunkStartIndex + instantOffset);
+                    }
+                }
+            }
+        }
+
+#else
+
+        throw ostk::core::error::RuntimeError("CUDA coverage backend is not available in this build.");
+
+#endif
+    }
+    else
+    {
+        const Size bandCount = this->bandIndices_.getSize();
+
+        const auto bandIndexAt = [this, bandCount](const double& aLatitude_rad) -> Index
+        {
+            const double clampedLatitude_rad = std::max(-M_PI / 2.0, std::min(aLatitude_rad, M_PI / 2.0));
+
+            return std::min(
+                static_cast<Index>((clampedLatitude_rad + M_PI / 2.0) / this->bandWidth_rad_), bandCount - 1
+            );
+        };
+
+        std::vector<double> satelliteGeometries(satelliteCount * satelliteGeometryStride);
+
+        for (Index instantIndex = 0; instantIndex < instants.getSize(); ++instantIndex)
+        {
+            computeSatelliteGeometries(instantIndex, satelliteGeometries.data());
+
+            for (Index satelliteIndex = 0; satelliteIndex < satelliteCount; ++satelliteIndex)
+            {
+                const double* geometry = satelliteGeometries.data() + (satelliteIndex * satelliteGeometryStride);
+
+                const Vector3d satellitePosition = {geometry[0], geometry[1], geometry[2]};
+                const Vector3d satelliteDirection = {geometry[3], geometry[4], geometry[5]};
+                const double cosCentralAngle = geometry[6];
+                const double centralAngle_rad = geometry[7];
+
+                const double satelliteLatitude_rad = std::asin(satelliteDirection.z());
+
+                const Index firstBandIndex = bandIndexAt(satelliteLatitude_rad - centralAngle_rad);
+                const Index lastBandIndex = bandIndexAt(satelliteLatitude_rad + centralAngle_rad);
+
+                for (Index bandIndex = firstBandIndex; bandIndex <= lastBandIndex; ++bandIndex)
+                {
+                    for (const Index& pointIndex : this->bandIndices_[bandIndex])
+                    {
+                        if (lastVisibleIndices[pointIndex] == instantIndex)
+                        {
+                            continue;
+                        }
+
+                        const Vector3d& pointPosition = this->gridPositions_[pointIndex];
+
+                        if (pointPosition.dot(satelliteDirection) < (cosCentralAngle * pointPosition.norm()))
+                        {
+                            continue;
+                        }
+
+                        const Vector3d lineOfSight = satellitePosition - pointPosition;
+
+                        if (this->gridVerticals_[pointIndex].dot(lineOfSight) <
+                            (sinMinimumElevation * lineOfSight.norm()))
+                        {
+                            continue;
+                        }
+
+                        recordVisibility(pointIndex, instantIndex);
+                    }
+                }
+            }
+        }
+    }
+
+    Array<PointCoverage> pointCoverages = Array<PointCoverage>::Empty();
+    pointCoverages.reserve(pointCount);
+
+    for (Index pointIndex = 0; pointIndex < pointCount; ++pointIndex)
+    {
+        if (lastVisibleIndices[pointIndex] != noIndex)
+        {
+            accessIntervalsArray[pointIndex].add(physics::time::Interval::Closed(
+                instants[accessStartIndices[pointIndex]], instants[lastVisibleIndices[pointIndex]]
+            ));
+        }
+
+        pointCoverages.add(CoverageGenerator::GeneratePointCoverage(accessIntervalsArray[pointIndex], anInterval));
+    }
+
+    return pointCoverages;
+}
+
+CoverageGenerator CoverageGenerator::Undefined()
+{
+    return {Array<LLA>::Empty(), Angle::Undefined(), nullptr, Duration::Undefined()};
+}
+
+bool CoverageGenerator::IsBackendAvailable(const Backend& aBackend)
+{
+    switch (aBackend)
+    {
+        case Backend::CPU:
+            return true;
+
+        case Backend::CUDA:
+#ifdef OSTK_ASTRODYNAMICS_WITH_CUDA
+            return cuda::GetDeviceCount() > 0;
+#else
+            return false;
+#endif
+
+        default:
+            return false;
+    }
+}
+
+CoverageGenerator::PointCoverage CoverageGenerator::GeneratePointCoverage(
+    const Array<physics::time::Interval>& anAccessIntervalArray, const physics::time::Interval& anInterval
+)
+{
+    Duration accessDuration = Duration::Zero();
+    Duration maximumRevisitDuration = Duration::Zero();
+    Duration totalRevisitDuration = Duration::Zero();
+    Size revisitCount = 0;
+
+    const auto addGap = [&maximumRevisitDuration, &totalRevisitDuration, &revisitCount](const Duration& aGapDuration)
+    {
+        if (!aGapDuration.isStrictlyPositive())
+        {
+            return;
+        }
+
+        maximumRevisitDuration = std::max(maximumRevisitDuration, aGapDuration);
+        totalRevisitDuration += aGapDuration;
+        ++revisitCount;
+    };
+
+    Instant previousEndInstant = anInterval.accessStart();
+
+    for (const physics::time::Interval& accessInterval : anAccessIntervalArray)
+    {
+        addGap(Duration::Between(previousEndInstant, accessInterval.accessStart()));
+
+        accessDuration += accessInterval.getDuration();
+
+        previousEndInstant = accessInterval.accessEnd();
+    }
+
+    addGap(Duration::Between(previousEndInstant, anInterval.accessEnd()));
+
+    return {
+        anAccessIntervalArray,
+        accessDuration,
+        maximumRevisitDuration,
+        (revisitCount > 0) ? (totalRevisitDuration / double(revisitCount)) : Duration::Zero(),
+    };
+}
+
+}  // namespace access
+}  // namespace astrodynamics
+}  // namespace ostk
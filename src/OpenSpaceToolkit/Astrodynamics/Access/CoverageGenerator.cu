@@ -0,0 +1,223 @@
+/// Apache License 2.0
+
+#include <cstddef>
+#include <cstdint>
+
+#include <cuda_runtime.h>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace access
+{
+namespace cuda
+{
+
+// Must match the satellite geometry layout of CoverageGenerator.cpp
+static constexpr std::size_t satelliteGeometryStride = 8;
+
+static constexpr unsigned int threadsPerBlock = 256;
+
+struct Grid
+{
+    double* positions;
+    double* verticals;
+    std::size_t pointCount;
+};
+
+// One thread per grid point and instant, testing the point against the visibility cone and the elevation mask of
+// every satellite, as the host path does for the points of the latitude bands below each satellite
+__global__ void VisibilityKernel(
+    const double* aGridPositionArray,
+    const double* aGridVerticalArray,
+    const std::size_t aPointCount,
+    const double* aSatelliteGeometryArray,
+    const std::size_t anInstantCount,
+    const std::size_t aSatelliteCount,
+    const double aSinMinimumElevation,
+    std::uint8_t* aVisibilityArray
+)
+{
+    const std::size_t index = static_cast<std::size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+
+    if (index >= (anInstantCount * aPointCount))
+    {
+        return;
+    }
+
+    const std::size_t instantIndex = index / aPointCount;
+    const std::size_t pointIndex = index % aPointCount;
+
+    const double* position = aGridPositionArray + (3 * pointIndex);
+    const double* vertical = aGridVerticalArray + (3 * pointIndex);
+
+    const double positionNorm =
+        sqrt(position[0] * position[0] + position[1] * position[1] + position[2] * position[2]);
+
+    const double* geometries = aSatelliteGeometryArray + (instantIndex * aSatelliteCount * satelliteGeometryStride);
+
+    std::uint8_t isVisible = 0;
+
+    for (std::size_t satelliteIndex = 0; (satelliteIndex < aSatelliteCount) && (isVisible == 0); ++satelliteIndex)
+    {
+        const double* geometry = geometries + (satelliteIndex * satelliteGeometryStride);
+
+        if ((position[0] * geometry[3] + position[1] * geometry[4] + position[2] * geometry[5]) <
+            (geometry[6] * positionNorm))
+        {
+            continue;
+        }
+
+        const double lineOfSight[3] = {
+            geometry[0] - position[0], geometry[1] - position[1], geometry[2] - position[2]
+        };
+
+        const double lineOfSightNorm =
+            sqrt(lineOfSight[0] * lineOfSight[0] + lineOfSight[1] * lineOfSight[1] + lineOfSight[2] * lineOfSight[2]);
+
+        if ((vertical[0] * lineOfSight[0] + vertical[1] * lineOfSight[1] + vertical[2] * lineOfSight[2]) <
+            (aSinMinimumElevation * lineOfSightNorm))
+        {
+            continue;
+        }
+
+        isVisible = 1;
+    }
+
+    aVisibilityArray[index] = isVisible;
+}
+
+int GetDeviceCount()
+{
+    int deviceCount = 0;
+
+    if (cudaGetDeviceCount(&deviceCount) != cudaSuccess)
+    {
+        return 0;
+    }
+
+    return deviceCount;
+}
+
+void ReleaseGrid(Grid* aGridPtr)
+{
+    if (aGridPtr == nullptr)
+    {
+        return;
+    }
+
+    cudaFree(aGridPtr->positions);
+    cudaFree(aGridPtr->verticals);
+
+    delete aGridPtr;
+}
+
+Grid* UploadGrid(
+    const double* aGridPositionArray,
+    const double* aGridVerticalArray,
+    const std::size_t aPointCount,
+    const char** anErrorMessage
+)
+{
+    Grid* gridPtr = new Grid {nullptr, nullptr, aPointCount};
+
+    const std::size_t size = 3 * aPointCount * sizeof(double);
+
+    cudaError_t error = cudaMalloc(&gridPtr->positions, size);
+
+    if (error == cudaSuccess)
+    {
+        error = cudaMalloc(&gridPtr->verticals, size);
+    }
+
+    if (error == cudaSuccess)
+    {
+        error = cudaMemcpy(gridPtr->positions, aGridPositionArray, size, cudaMemcpyHostToDevice);
+    }
+
+    if (error == cudaSuccess)
+    {
+        error = cudaMemcpy(gridPtr->verticals, aGridVerticalArray, size, cudaMemcpyHostToDevice);
+    }
+
+    if (error != cudaSuccess)
+    {
+        *anErrorMessage = cudaGetErrorString(error);
+
+        ReleaseGrid(gridPtr);
+
+        return nullptr;
+    }
+
+    return gridPtr;
+}
+
+const char* ComputeVisibilities(
+    const Grid* aGridPtr,
+    const double* aSatelliteGeometryArray,
+    const std::size_t anInstantCount,
+    const std::size_t aSatelliteCount,
+    const double aSinMinimumElevation,
+    std::uint8_t* aVisibilityArray
+)
+{
+    const std::size_t geometrySize = anInstantCount * aSatelliteCount * satelliteGeometryStride * sizeof(double);
+    const std::size_t visibilityCount = anInstantCount * aGridPtr->pointCount;
+
+    if (visibilityCount == 0)
+    {
+        return nullptr;
+    }
+
+    double* satelliteGeometries = nullptr;
+    std::uint8_t* visibilities = nullptr;
+
+    cudaError_t error = cudaMalloc(&satelliteGeometries, (geometrySize > 0) ? geometrySize : sizeof(double));
+
+    if (error == cudaSuccess)
+    {
+        error = cudaMalloc(&visibilities, visibilityCount * sizeof(std::uint8_t));
+    }
+
+    if ((error == cudaSuccess) && (geometrySize > 0))
+    {
+        error = cudaMemcpy(satelliteGeometries, aSatelliteGeometryArray, geometrySize, cudaMemcpyHostToDevice);
+    }
+
+    if (error == cudaSuccess)
+    {
+        const unsigned int blockCount =
+            static_cast<unsigned int>((visibilityCount + threadsPerBlock - 1) / threadsPerBlock);
+
+        VisibilityKernel<<<blockCount, threadsPerBlock>>>(
+            aGridPtr->positions,
+            aGridPtr->verticals,
+            aGridPtr->pointCount,
+            satelliteGeometries,
+            anInstantCount,
+            aSatelliteCount,
+            aSinMinimumElevation,
+            visibilities
+        );
+
+        error = cudaGetLastError();
+    }
+
+    if (error == cudaSuccess)
+    {
+        error = cudaMemcpy(
+            aVisibilityArray, visibilities, visibilityCount * sizeof(std::uint8_t), cudaMemcpyDeviceToHost
+        );
+    }
+
+    cudaFree(satelliteGeometries);
+    cudaFree(visibilities);
+
+    return (error == cudaSuccess) ? nullptr : cudaGetErrorString(error);
+}
+
+}  // namespace cuda
+}  // namespace access
+}  // namespace astrodynamics
+}  // namespace ostk
@@ -0,0 +1,365 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+
+#include <OpenSpaceToolkit/Core/Container/Pair.hpp>
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Access/CrosslinkGenerator.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Solver/TemporalConditionSolver.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/LazyState.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace access
+{
+
+using ostk::core::container::Pair;
+
+using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+
+using ostk::physics::coordinate::Frame;
+
+using ostk::astrodynamics::solver::TemporalConditionSolver;
+using ostk::astrodynamics::trajectory::state::LazyState;
+
+CrosslinkGenerator::CrosslinkGenerator(
+    const Shared<const Celestial>& anEarthSPtr,
+    const Interval<Real>& aRangeInterval,
+    const Length& aGrazingAltitude,
+    const Duration& aStep,
+    const Duration& aTolerance
+)
+    : earthSPtr_(anEarthSPtr),
+      rangeInterval_(aRangeInterval),
+      grazingAltitude_(aGrazingAltitude),
+      step_(aStep),
+      tolerance_(aTolerance)
+{
+}
+
+bool CrosslinkGenerator::isDefined() const
+{
+    return (this->earthSPtr_ != nullptr) && this->earthSPtr_->isDefined() && this->grazingAltitude_.isDefined() &&
+           this->step_.isDefined() && this->step_.isStrictlyPositive() && this->tolerance_.isDefined();
+}
+
+Interval<Real> CrosslinkGenerator::getRangeInterval() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Crosslink Generator");
+    }
+
+    return this->rangeInterval_;
+}
+
+Length CrosslinkGenerator::getGrazingAltitude() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Crosslink Generator");
+    }
+
+    return this->grazingAltitude_;
+}
+
+Duration CrosslinkGenerator::getStep() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Crosslink Generator");
+    }
+
+    return this->step_;
+}
+
+Duration CrosslinkGenerator::getTolerance() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Crosslink Generator");
+    }
+
+    return this->tolerance_;
+}
+
+bool CrosslinkGenerator::isActiveAt(
+    const Instant& anInstant, const Trajectory& aFromTrajectory, const Trajectory& aToTrajectory
+) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (!aFromTrajectory.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("From Trajectory");
+    }
+
+    if (!aToTrajectory.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("To Trajectory");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Crosslink Generator");
+    }
+
+    return this->isActive(aFromTrajectory.getStateAt(anInstant), aToTrajectory.getStateAt(anInstant), nullptr);
+}
+
+Array<Access> CrosslinkGenerator::computeAccesses(
+    const physics::time::Interval& anInterval, const Trajectory& aFromTrajectory, const Trajectory& aToTrajectory
+) const
+{
+    if (!aFromTrajectory.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("From Trajectory");
+    }
+
+    if (!aToTrajectory.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("To Trajectory");
+    }
+
+    return this->generateAccesses(
+        anInterval,
+        [&aFromTrajectory](const Instant& anInstant) -> State
+        {
+            return aFromTrajectory.getStateAt(anInstant);
+        },
+        [&aToTrajectory](const Instant& anInstant) -> State
+        {
+            return aToTrajectory.getStateAt(anInstant);
+        },
+        nullptr
+    );
+}
+
+Array<Access> CrosslinkGenerator::computeAccesses(
+    const physics::time::Interval& anInterval,
+    const Profile& aFromProfile,
+    const FieldOfView& aFieldOfView,
+    const Trajectory& aToTrajectory
+) const
+{
+    if (!aFromProfile.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("From Profile");
+    }
+
+    if (!aToTrajectory.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("To Trajectory");
+    }
+
+    if (!aFieldOfView.halfAngle.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Field of view half angle");
+    }
+
+    if (aFieldOfView.boresight.norm() == 0.0)
+    {
+        throw ostk::core::error::runtime::Wrong("Field of view boresight");
+    }
+
+    return this->generateAccesses(
+        anInterval,
+        [&aFromProfile](const Instant& anInstant) -> State
+        {
+            return aFromProfile.getStateAt(anInstant);
+        },
+        [&aToTrajectory](const Instant& anInstant) -> State
+        {
+            return aToTrajectory.getStateAt(anInstant);
+        },
+        &aFieldOfView
+    );
+}
+
+CrosslinkGenerator CrosslinkGenerator::Undefined()
+{
+    return {nullptr, Interval<Real>::Undefined(), Length::Undefined(), Duration::Undefined(), Duration::Undefined()};
+}
+
+Array<Access> CrosslinkGenerator::generateAccesses(
+    const physics::time::Interval& anInterval,
+    const std::function<State(const Instant&)>& aFromStateGetter,
+    const std::function<State(const Instant&)>& aToStateGetter,
+    const FieldOfView* aFieldOfViewPtr
+) const
+{
+    if (!anInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Crosslink Generator");
+    }
+
+    const TemporalConditionSolver temporalConditionSolver = {this->step_, this->tolerance_};
+
+    const Array<physics::time::Interval> accessIntervals = temporalConditionSolver.solve(
+        [this, &aFromStateGetter, &aToStateGetter, aFieldOfViewPtr](const Instant& anInstant) -> bool
+        {
+            return this->isActive(aFromStateGetter(anInstant), aToStateGetter(anInstant), aFieldOfViewPtr);
+        },
+        anInterval
+    );
+
+    Array<Access> accesses = Array<Access>::Empty();
+    accesses.reserve(accessIntervals.getSize());
+
+    for (const physics::time::Interval& accessInterval : accessIntervals)
+    {
+        const Access::Type type = ((anInterval.accessStart() != accessInterval.accessStart()) &&
+                                   (anInterval.accessEnd() != accessInterval.accessEnd()))
+                                    ? Access::Type::Complete
+                                    : Access::Type::Partial;
+
+        // Short-lived state cache, shared by the TCA search and the maximum elevation evaluation
+
+        std::map<Instant, Pair<State, State>> stateCache;
+
+        const std::function<Pair<State, State>(const Instant&)> getStatesAt =
+            [&stateCache, &aFromStateGetter, &aToStateGetter](const Instant& anInstant) -> Pair<State, State>
+        {
+            const auto stateCacheIt = stateCache.find(anInstant);
+
+            if (stateCacheIt != stateCache.end())
+            {
+                return stateCacheIt->second;
+            }
+
+            const Pair<State, State> states = {aFromStateGetter(anInstant), aToStateGetter(anInstant)};
+
+            stateCache.emplace(anInstant, states);
+
+            return states;
+        };
+
+        const Instant timeOfClosestApproach =
+            Generator::FindTimeOfClosestApproach(accessInterval, getStatesAt, this->tolerance_);
+
+        // Geocentric elevation above the local horizontal plane of the "from" satellite
+
+        const auto [fromState, toState] = getStatesAt(timeOfClosestApproach);
+
+        const Vector3d fromPositionCoordinates = CrosslinkGenerator::GetPositionCoordinates(fromState);
+        const Vector3d fromToVector = CrosslinkGenerator::GetPositionCoordinates(toState) - fromPositionCoordinates;
+
+        const double sineOfElevation =
+            fromPositionCoordinates.dot(fromToVector) / (fromPositionCoordinates.norm() * fromToVector.norm());
+
+        const Angle maxElevation = Angle::Radians(std::asin(std::clamp(sineOfElevation, -1.0, +1.0)));
+
+        accesses.add(Access {
+            type, accessInterval.getStart(), timeOfClosestApproach, accessInterval.getEnd(), maxElevation
+        });
+    }
+
+    return accesses;
+}
+
+bool CrosslinkGenerator::isActive(
+    const State& aFromState, const State& aToState, const FieldOfView* aFieldOfViewPtr
+) const
+{
+    const Vector3d fromPositionCoordinates = CrosslinkGenerator::GetPositionCoordinates(aFromState);
+    const Vector3d toPositionCoordinates = CrosslinkGenerator::GetPositionCoordinates(aToState);
+
+    const Vector3d fromToVector = toPositionCoordinates - fromPositionCoordinates;
+    const double range_m = fromToVector.norm();
+
+    // Range
+
+    if (this->rangeInterval_.isDefined() && (!this->rangeInterval_.contains(range_m)))
+    {
+        return false;
+    }
+
+    // Earth occultation: the ellipsoid raised by the grazing altitude is mapped to a sphere, by scaling the polar axis
+
+    const double grazingAltitude_m = this->grazingAltitude_.inMeters();
+    const double equatorialRadius_m = this->earthSPtr_->getEquatorialRadius().inMeters() + grazingAltitude_m;
+    const double polarRadius_m =
+        this->earthSPtr_->getEquatorialRadius().inMeters() * (1.0 - this->earthSPtr_->getFlattening()) +
+        grazingAltitude_m;
+
+    const Vector3d axisScaling = {1.0, 1.0, equatorialRadius_m / polarRadius_m};
+
+    const Vector3d scaledFromPositionCoordinates = fromPositionCoordinates.cwiseProduct(axisScaling);
+    const Vector3d scaledFromToVector = fromToVector.cwiseProduct(axisScaling);
+
+    const double scaledSquaredRange_m = scaledFromToVector.squaredNorm();
+
+    if (scaledSquaredRange_m > 0.0)
+    {
+        const double closestApproachRatio =
+            std::clamp(-scaledFromPositionCoordinates.dot(scaledFromToVector) / scaledSquaredRange_m, 0.0, 1.0);
+
+        const Vector3d closestApproachCoordinates =
+            scaledFromPositionCoordinates + closestApproachRatio * scaledFromToVector;
+
+        if (closestApproachCoordinates.norm() < equatorialRadius_m)
+        {
+            return false;
+        }
+    }
+
+    // Field of view, in the body frame of the "from" satellite
+
+    if (aFieldOfViewPtr != nullptr)
+    {
+        static const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+
+        if (aFromState.accessFrame() != gcrfSPtr)
+        {
+            throw ostk::core::error::RuntimeError("Field of view requires a profile expressed in GCRF.");
+        }
+
+        if (range_m == 0.0)
+        {
+            return false;
+        }
+
+        const Quaternion q_B_GCRF = aFromState.getAttitude();
+
+        const Vector3d lineOfSightDirection_B = q_B_GCRF * (fromToVector / range_m);
+
+        if (lineOfSightDirection_B.dot(aFieldOfViewPtr->boresight.normalized()) <
+            std::cos(aFieldOfViewPtr->halfAngle.inRadians()))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+Vector3d CrosslinkGenerator::GetPositionCoordinates(const State& aState)
+{
+    static const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+
+    if (aState.accessFrame() == gcrfSPtr)
+    {
+        return aState.accessPositionCoordinates();
+    }
+
+    return LazyState(aState, gcrfSPtr).accessPositionCoordinates();
+}
+
+}  // namespace access
+}  // namespace astrodynamics
+}  // namespace ostk
@@ -1,21 +1,39 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <limits>
+#include <map>
+#include <mutex>
+
 #include <nlopt.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Point.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Segment.hpp>
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Spherical/LLA.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Earth.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Access/Generator.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Solver/TemporalConditionSolver.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Tracer.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Model/Piecewise.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Model/Static.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/LazyState.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/TransformCache.hpp>
 
 using ostk::mathematics::geometry::d3::object::Point;
 using ostk::mathematics::geometry::d3::object::Segment;
 
 using ostk::astrodynamics::solver::TemporalConditionSolver;
+using ostk::astrodynamics::Tracer;
+using ostk::astrodynamics::trajectory::model::Piecewise;
+using ostk::astrodynamics::trajectory::state::LazyState;
+using ostk::astrodynamics::trajectory::state::TransformCache;
 using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Transform;
 using ostk::physics::coordinate::spherical::LLA;
 using ostk::physics::environment::Object;
 using ostk::physics::environment::object::celestial::Earth;
@@ -27,13 +45,23 @@ namespace astrodynamics
 namespace access
 {
 
+static Duration DurationSince(const std::chrono::steady_clock::time_point& aStartTime)
+{
+    return Duration::Seconds(std::chrono::duration<double>(std::chrono::steady_clock::now() - aStartTime).count());
+}
+
 Generator::Generator(const Environment& anEnvironment, const Duration& aStep, const Duration& aTolerance)
     : environment_(anEnvironment),
       step_(aStep),
       tolerance_(aTolerance),
       aerFilter_({}),
       accessFilter_({}),
-      stateFilter_({})
+      stateFilter_({}),
+      screeningIsEnabled_(false),
+      screeningMinimumElevation_(Angle::Undefined()),
+      screeningMaximumRange_(Length::Undefined()),
+      statisticsSPtr_(nullptr),
+      statisticsMutexSPtr_(nullptr)
 {
 }
 
@@ -50,7 +78,12 @@ Generator::Generator(
       tolerance_(aTolerance),
       aerFilter_(anAerFilter),
       accessFilter_(anAccessFilter),
-      stateFilter_(aStateFilter)
+      stateFilter_(aStateFilter),
+      screeningIsEnabled_(false),
+      screeningMinimumElevation_(Angle::Undefined()),
+      screeningMaximumRange_(Length::Undefined()),
+      statisticsSPtr_(nullptr),
+      statisticsMutexSPtr_(nullptr)
 {
 }
 
@@ -109,6 +142,53 @@ std::function<bool(const State&, const State&)> Generator::getStateFilter() cons
     return this->stateFilter_;
 }
 
+bool Generator::isScreeningEnabled() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Generator");
+    }
+
+    return this->screeningIsEnabled_;
+}
+
+Angle Generator::getScreeningMinimumElevation() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Generator");
+    }
+
+    return this->screeningMinimumElevation_;
+}
+
+Length Generator::getScreeningMaximumRange() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Generator");
+    }
+
+    return this->screeningMaximumRange_;
+}
+
+bool Generator::isStatisticsEnabled() const
+{
+    return this->statisticsSPtr_ != nullptr;
+}
+
+Generator::Statistics Generator::getStatistics() const
+{
+    if (!this->isStatisticsEnabled())
+    {
+        throw ostk::core::error::RuntimeError("Statistics are not enabled.");
+    }
+
+    const std::lock_guard<std::mutex> lock(*this->statisticsMutexSPtr_);
+
+    return *this->statisticsSPtr_;
+}
+
 std::function<bool(const Instant&)> Generator::getConditionFunction(
     const Trajectory& aFromTrajectory, const Trajectory& aToTrajectory
 ) const
@@ -140,35 +220,297 @@ Array<Access> Generator::computeAccesses(
     const physics::time::Interval& anInterval, const Trajectory& aFromTrajectory, const Trajectory& aToTrajectory
 ) const
 {
+    const Tracer::Span span("Generator::computeAccesses", "access");
+
+    // Statistics are accumulated locally, then recorded once
+
+    Statistics statistics;
+    Statistics* statisticsPtr = this->isStatisticsEnabled() ? &statistics : nullptr;
+
+    const Array<physics::time::Interval> accessIntervals =
+        this->computeAccessIntervals(anInterval, aFromTrajectory, aToTrajectory, statisticsPtr);
+
+    const Shared<const Celestial> earthSPtr = this->environment_.accessCelestialObjectWithName("Earth");
+
+    const Array<Access> accesses =
+        accessIntervals
+            .map<Access>(
+                [&anInterval, &aFromTrajectory, &aToTrajectory, &earthSPtr, statisticsPtr, this](
+                    const physics::time::Interval& anAccessInterval
+                ) -> Access
+                {
+                    return Generator::GenerateAccess(
+                        anAccessInterval,
+                        anInterval,
+                        aFromTrajectory,
+                        aToTrajectory,
+                        earthSPtr,
+                        this->tolerance_,
+                        statisticsPtr
+                    );
+                }
+            )
+            .getWhere(
+                [this](const Access& anAccess) -> bool
+                {
+                    return this->accessFilter_ ? this->accessFilter_(anAccess) : true;
+                }
+            );
+
+    if (statisticsPtr != nullptr)
+    {
+        this->recordStatistics(statistics);
+    }
+
+    return accesses;
+}
+
+Array<Array<Array<Access>>> Generator::computeAccesses(
+    const physics::time::Interval& anInterval,
+    const Array<Trajectory>& aFromTrajectoryArray,
+    const Array<Trajectory>& aToTrajectoryArray,
+    const Size& aThreadCount
+) const
+{
+    return this->computeAccesses(anInterval, aFromTrajectoryArray, aToTrajectoryArray, ExecutionContext(aThreadCount));
+}
+
+Array<Array<Array<Access>>> Generator::computeAccesses(
+    const physics::time::Interval& anInterval,
+    const Array<Trajectory>& aFromTrajectoryArray,
+    const Array<Trajectory>& aToTrajectoryArray,
+    const ExecutionContext& anExecutionContext
+) const
+{
+    const Tracer::Span span("Generator::computeAccesses", "access");
+
     if (!anInterval.isDefined())
     {
         throw ostk::core::error::runtime::Undefined("Interval");
     }
 
-    const TemporalConditionSolver temporalConditionSolver = {this->step_, this->tolerance_};
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Generator");
+    }
 
-    const Array<physics::time::Interval> accessIntervals =
-        temporalConditionSolver.solve(this->getConditionFunction(aFromTrajectory, aToTrajectory), anInterval);
+    const Size fromTrajectoryCount = aFromTrajectoryArray.getSize();
+    const Size toTrajectoryCount = aToTrajectoryArray.getSize();
+    const Size pairCount = fromTrajectoryCount * toTrajectoryCount;
 
-    const Shared<const Celestial> earthSPtr = this->environment_.accessCelestialObjectWithName("Earth");
+    Array<Array<Array<Access>>> accessesMatrix(
+        fromTrajectoryCount, Array<Array<Access>>(toTrajectoryCount, Array<Access>::Empty())
+    );
+
+    if (pairCount == 0)
+    {
+        return accessesMatrix;
+    }
+
+    anExecutionContext.parallelFor(
+        pairCount,
+        [this, &accessesMatrix, &anInterval, &aFromTrajectoryArray, &aToTrajectoryArray, toTrajectoryCount](
+        ) -> std::function<void(const Index&)>
+        {
+            // Each worker holds its own generator, hence its own environment instant
+
+            return [generator = Generator(*this),
+                    &accessesMatrix,
+                    &anInterval,
+                    &aFromTrajectoryArray,
+                    &aToTrajectoryArray,
+                    toTrajectoryCount](const Index& aPairIndex)
+            {
+                const Size fromIndex = aPairIndex / toTrajectoryCount;
+                const Size toIndex = aPairIndex % toTrajectoryCount;
+
+                // Trajectory models are immutable and safe to query from several threads (propagated models integrate
+                // on call-local solvers), hence trajectories are shared between workers rather than copied
+
+                const Trajectory& fromTrajectory = aFromTrajectoryArray[fromIndex];
+                const Trajectory& toTrajectory = aToTrajectoryArray[toIndex];
+
+                accessesMatrix[fromIndex][toIndex] =
+                    generator.computeAccesses(anInterval, fromTrajectory, toTrajectory);
+            };
+        }
+    );
+
+    return accessesMatrix;
+}
+
+Array<Access> Generator::computePiecewiseAccesses(
+    const physics::time::Interval& anInterval,
+    const Trajectory& aFromTrajectory,
+    const Trajectory& aToTrajectory,
+    const Size& aThreadCount
+) const
+{
+    const Tracer::Span span("Generator::computePiecewiseAccesses", "access");
+
+    if (!anInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    if (!aFromTrajectory.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("From Trajectory");
+    }
+
+    if (!aToTrajectory.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("To Trajectory");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Generator");
+    }
+
+    // Segments are bounded by the switch instants of the piecewise trajectories
 
-    return accessIntervals
-        .map<Access>(
-            [&anInterval, &aFromTrajectory, &aToTrajectory, &earthSPtr, this](
-                const physics::time::Interval& anAccessInterval
-            ) -> Access
+    Array<Instant> segmentBounds = {anInterval.getStart(), anInterval.getEnd()};
+
+    for (const Trajectory* trajectoryPtr : {&aFromTrajectory, &aToTrajectory})
+    {
+        if (trajectoryPtr->accessModel().is<Piecewise>())
+        {
+            for (const Instant& switchInstant :
+                 trajectoryPtr->accessModel().as<Piecewise>().getSwitchInstantsWithin(anInterval))
             {
-                return Generator::GenerateAccess(
-                    anAccessInterval, anInterval, aFromTrajectory, aToTrajectory, earthSPtr, this->tolerance_
-                );
+                segmentBounds.add(switchInstant);
             }
-        )
-        .getWhere(
-            [this](const Access& anAccess) -> bool
+        }
+    }
+
+    std::sort(segmentBounds.begin(), segmentBounds.end());
+    segmentBounds.erase(std::unique(segmentBounds.begin() + 1, segmentBounds.end()), segmentBounds.end());
+
+    if (segmentBounds.getSize() == 1)
+    {
+        segmentBounds.add(anInterval.getEnd());
+    }
+
+    const Size segmentCount = segmentBounds.getSize() - 1;
+
+    const auto accessPieceAt = [](const Trajectory& aTrajectory, const Instant& anInstant) -> const Trajectory&
+    {
+        return aTrajectory.accessModel().is<Piecewise>()
+                 ? aTrajectory.accessModel().as<Piecewise>().accessTrajectoryAt(anInstant)
+                 : aTrajectory;
+    };
+
+    Array<Array<physics::time::Interval>> segmentAccessIntervals(
+        segmentCount, Array<physics::time::Interval>::Empty()
+    );
+    Array<Statistics> segmentStatistics(segmentCount, Statistics());
+
+    const auto solveSegment =
+        [this, &anInterval, &aFromTrajectory, &aToTrajectory, &segmentBounds, &accessPieceAt, &segmentAccessIntervals,
+         &segmentStatistics](const Generator& aGenerator, const Index& aSegmentIndex) -> void
+    {
+        const Instant& segmentStart = segmentBounds[aSegmentIndex];
+        const Instant& segmentEnd = segmentBounds[aSegmentIndex + 1];
+
+        // Trajectory models may hold mutable state (e.g., numerical solvers), hence pieces are copied
+
+        const Trajectory fromTrajectory = accessPieceAt(aFromTrajectory, segmentStart);
+        const Trajectory toTrajectory = accessPieceAt(aToTrajectory, segmentStart);
+
+        // Segments are solved from the last grid instant of the whole interval at their start, for all segments to
+        // share the grid. Access intervals ending before the segment start are discarded.
+
+        const double gridStepCount =
+            std::floor((segmentStart - anInterval.getStart()).inSeconds() / this->step_.inSeconds());
+
+        const Instant gridStart = anInterval.getStart() + this->step_ * gridStepCount;
+
+        Statistics* statisticsPtr = this->isStatisticsEnabled() ? &segmentStatistics[aSegmentIndex] : nullptr;
+
+        const Array<physics::time::Interval> accessIntervals = aGenerator.computeAccessIntervals(
+            physics::time::Interval::Closed(gridStart, segmentEnd), fromTrajectory, toTrajectory, statisticsPtr
+        );
+
+        for (const physics::time::Interval& accessInterval : accessIntervals)
+        {
+            if ((aSegmentIndex > 0) && (accessInterval.accessEnd() <= segmentStart))
             {
-                return this->accessFilter_ ? this->accessFilter_(anAccess) : true;
+                continue;
             }
+
+            segmentAccessIntervals[aSegmentIndex].add(physics::time::Interval::Closed(
+                std::max(accessInterval.getStart(), segmentStart), accessInterval.getEnd()
+            ));
+        }
+    };
+
+    ExecutionContext(aThreadCount).parallelFor(
+        segmentCount,
+        [this, &solveSegment]() -> std::function<void(const Index&)>
+        {
+            // Each worker holds its own generator, hence its own environment instant
+
+            return [generator = Generator(*this), &solveSegment](const Index& aSegmentIndex)
+            {
+                solveSegment(generator, aSegmentIndex);
+            };
+        }
+    );
+
+    // Access intervals meeting at a switch instant are merged
+
+    Array<physics::time::Interval> accessIntervals = Array<physics::time::Interval>::Empty();
+
+    for (const Array<physics::time::Interval>& intervals : segmentAccessIntervals)
+    {
+        for (const physics::time::Interval& accessInterval : intervals)
+        {
+            if ((!accessIntervals.isEmpty()) &&
+                (accessIntervals.accessLast().accessEnd() == accessInterval.accessStart()))
+            {
+                accessIntervals.back() =
+                    physics::time::Interval::Closed(accessIntervals.back().getStart(), accessInterval.getEnd());
+            }
+            else
+            {
+                accessIntervals.add(accessInterval);
+            }
+        }
+    }
+
+    // Accesses are generated on the whole trajectories, as their closest approach may lie across a switch instant
+
+    Statistics statistics;
+    Statistics* statisticsPtr = this->isStatisticsEnabled() ? &statistics : nullptr;
+
+    const Shared<const Celestial> earthSPtr = this->environment_.accessCelestialObjectWithName("Earth");
+
+    Array<Access> accesses = Array<Access>::Empty();
+
+    for (const physics::time::Interval& accessInterval : accessIntervals)
+    {
+        const Access access = Generator::GenerateAccess(
+            accessInterval, anInterval, aFromTrajectory, aToTrajectory, earthSPtr, this->tolerance_, statisticsPtr
         );
+
+        if ((!this->accessFilter_) || this->accessFilter_(access))
+        {
+            accesses.add(access);
+        }
+    }
+
+    if (statisticsPtr != nullptr)
+    {
+        for (const Statistics& aSegmentStatistics : segmentStatistics)
+        {
+            this->recordStatistics(aSegmentStatistics);
+        }
+
+        this->recordStatistics(statistics);
+    }
+
+    return accesses;
 }
 
 void Generator::setStep(const Duration& aStep)
@@ -206,6 +548,56 @@ void Generator::setStateFilter(const std::function<bool(const State&, const Stat
     this->stateFilter_ = aStateFilter;
 }
 
+void Generator::enableScreening(const Angle& aMinimumElevation, const Length& aMaximumRange)
+{
+    if (aMinimumElevation.isDefined() &&
+        ((aMinimumElevation.inDegrees() < -90.0) || (aMinimumElevation.inDegrees() > +90.0)))
+    {
+        throw ostk::core::error::runtime::Wrong("Minimum elevation");
+    }
+
+    if (aMaximumRange.isDefined() && (aMaximumRange.inMeters() <= 0.0))
+    {
+        throw ostk::core::error::runtime::Wrong("Maximum range");
+    }
+
+    this->screeningIsEnabled_ = true;
+    this->screeningMinimumElevation_ = aMinimumElevation;
+    this->screeningMaximumRange_ = aMaximumRange;
+}
+
+void Generator::disableScreening()
+{
+    this->screeningIsEnabled_ = false;
+    this->screeningMinimumElevation_ = Angle::Undefined();
+    this->screeningMaximumRange_ = Length::Undefined();
+}
+
+void Generator::enableStatistics()
+{
+    if (!this->isStatisticsEnabled())
+    {
+        this->statisticsSPtr_ = std::make_shared<Statistics>();
+        this->statisticsMutexSPtr_ = std::make_shared<std::mutex>();
+    }
+}
+
+void Generator::disableStatistics()
+{
+    this->statisticsSPtr_ = nullptr;
+    this->statisticsMutexSPtr_ = nullptr;
+}
+
+void Generator::resetStatistics()
+{
+    if (this->isStatisticsEnabled())
+    {
+        const std::lock_guard<std::mutex> lock(*this->statisticsMutexSPtr_);
+
+        *this->statisticsSPtr_ = Statistics();
+    }
+}
+
 Generator Generator::Undefined()
 {
     return {Environment::Undefined()};
@@ -218,97 +610,105 @@ Generator Generator::AerRanges(
     const Environment& anEnvironment
 )
 {
-    using ostk::core::type::Real;
-
-    const Interval<Real> azimuthRange_deg = anAzimuthRange;
-    const Interval<Real> elevationRange_deg = anElevationRange;
-    const Interval<Real> rangeRange_m = aRangeRange;
-
-    // const Interval<Real> azimuthRange_deg = anAzimuthRange ; // anAzimuthRange.isDefined() ?
-    // Interval<Real>(anAzimuthRange.accessLowerBound().inDegrees(0.0, +360.0),
-    // anAzimuthRange.accessUpperBound().inDegrees(0.0, +360.0), anAzimuthRange.getType()) : Interval<Real>::Undefined()
-    // ; const Interval<Real> elevationRange_deg = anElevationRange ; // anElevationRange.isDefined() ?
-    // Interval<Real>(anElevationRange.accessLowerBound().inDegrees(-180.0, +180.0),
-    // anElevationRange.accessUpperBound().inDegrees(-180.0, +180.0), anElevationRange.getType()) :
-    // Interval<Real>::Undefined() ; const Interval<Real> rangeRange_m = aRangeRange ; // aRangeRange.isDefined() ?
-    // Interval<Real>(aRangeRange.accessLowerBound().inMeters(), aRangeRange.accessUpperBound().inMeters(),
-    // aRangeRange.getType()) : Interval<Real>::Undefined() ;
-
-    const std::function<bool(const AER&)> aerFilter =
-        [azimuthRange_deg, elevationRange_deg, rangeRange_m](const AER& anAER) -> bool
-    {
-        return ((!azimuthRange_deg.isDefined()) || azimuthRange_deg.contains(anAER.getAzimuth().inDegrees(0.0, +360.0))
-               ) &&
-               ((!elevationRange_deg.isDefined()) ||
-                elevationRange_deg.contains(anAER.getElevation().inDegrees(-180.0, +180.0))) &&
-               ((!rangeRange_m.isDefined()) || rangeRange_m.contains(anAER.getRange().inMeters()));
-    };
-
-    return {anEnvironment, aerFilter};
+    return {anEnvironment, AerFilter::Ranges(anAzimuthRange, anElevationRange, aRangeRange)};
 }
 
 Generator Generator::AerMask(
     const Map<Real, Real>& anAzimuthElevationMask, const Interval<Real>& aRangeRange, const Environment& anEnvironment
 )
 {
-    using ostk::core::container::Map;
-    using ostk::core::type::Real;
-
-    using ostk::mathematics::object::Vector2d;
+    return {anEnvironment, AerFilter::Mask(anAzimuthElevationMask, aRangeRange)};
+}
 
-    if ((anAzimuthElevationMask.empty()) || (anAzimuthElevationMask.begin()->first < 0.0) ||
-        (anAzimuthElevationMask.rbegin()->first > 360.0))
+Array<physics::time::Interval> Generator::computeAccessIntervals(
+    const physics::time::Interval& anInterval,
+    const Trajectory& aFromTrajectory,
+    const Trajectory& aToTrajectory,
+    Statistics* aStatisticsPtr
+) const
+{
+    if (!anInterval.isDefined())
     {
-        throw ostk::core::error::runtime::Wrong("Azimuth-Elevation Mask");
+        throw ostk::core::error::runtime::Undefined("Interval");
     }
 
-    for (const auto& azimuthElevationPair : anAzimuthElevationMask)
+    if (!aFromTrajectory.isDefined())
     {
-        if ((azimuthElevationPair.second).abs() > 90.0)
-        {
-            throw ostk::core::error::runtime::Wrong("Azimuth-Elevation Mask");
-        }
+        throw ostk::core::error::runtime::Undefined("From Trajectory");
     }
 
-    Map<Real, Real> anAzimuthElevationMask_deg = anAzimuthElevationMask;
-    const Interval<Real> rangeRange_m = aRangeRange;
-
-    if (anAzimuthElevationMask_deg.begin()->first != 0.0)
+    if (!aToTrajectory.isDefined())
     {
-        anAzimuthElevationMask_deg.insert({0.0, anAzimuthElevationMask_deg.begin()->second});
+        throw ostk::core::error::runtime::Undefined("To Trajectory");
     }
 
-    if (anAzimuthElevationMask_deg.rbegin()->first != 360.0)
+    if (!this->isDefined())
     {
-        anAzimuthElevationMask_deg.insert({360.0, anAzimuthElevationMask_deg.begin()->second});
+        throw ostk::core::error::runtime::Undefined("Generator");
     }
 
-    const std::function<bool(const AER&)> aerFilter = [anAzimuthElevationMask_deg,
-                                                       rangeRange_m](const AER& anAER) -> bool
-    {
-        const Real azimuth = anAER.getAzimuth().inDegrees(0.0, +360.0);
-        const Real elevation = anAER.getElevation().inDegrees(-180.0, +180.0);
+    static const Size statePrefetchChunkSize = 256;
 
-        auto itLow = anAzimuthElevationMask_deg.lower_bound(azimuth);
-        itLow--;
-        auto itUp = anAzimuthElevationMask_deg.upper_bound(azimuth);
+    // The solver grid is walked in order, hence grid states are prefetched in chunks
 
-        // Vector between the two successive mask data points with bounding azimuth values
+    GeneratorContext generatorContext = GeneratorContext(aFromTrajectory, aToTrajectory, environment_, *this);
 
-        const Vector2d lowToUpVector = {itUp->first - itLow->first, itUp->second - itLow->second};
+    generatorContext.enableStatePrefetching(anInterval.accessEnd(), this->step_, statePrefetchChunkSize);
+    generatorContext.setStatistics(aStatisticsPtr);
 
-        // Vector from data point with azimuth lower bound to tested point
+    TemporalConditionSolver temporalConditionSolver = {this->step_, this->tolerance_};
 
-        const Vector2d lowToPointVector = {azimuth - itLow->first, elevation - itLow->second};
+    if (aStatisticsPtr != nullptr)
+    {
+        temporalConditionSolver.enableStatistics();
+    }
 
-        // If the determinant of these two vectors is positive, the tested point lies above the function defined by the
-        // mask
+    const Array<physics::time::Interval> accessIntervals = temporalConditionSolver.solve(
+        [&generatorContext](const Instant& anInstant) -> bool
+        {
+            return generatorContext.isAccessActive(anInstant);
+        },
+        anInterval
+    );
 
-        return (lowToUpVector[0] * lowToPointVector[1] - lowToUpVector[1] * lowToPointVector[0] >= 0.0) &&
-               ((!rangeRange_m.isDefined()) || rangeRange_m.contains(anAER.getRange().inMeters()));
-    };
+    if (aStatisticsPtr != nullptr)
+    {
+        const TemporalConditionSolver::Statistics solverStatistics = temporalConditionSolver.getStatistics();
+
+        aStatisticsPtr->conditionEvaluationCount += solverStatistics.conditionEvaluationCount;
+        aStatisticsPtr->conditionEvaluationDuration += solverStatistics.conditionEvaluationDuration;
+        aStatisticsPtr->rootSolverCallCount += solverStatistics.rootSolverCallCount;
+        aStatisticsPtr->rootSolverIterationCount += solverStatistics.rootSolverIterationCount;
+        aStatisticsPtr->rootSolverDuration += solverStatistics.rootSolverDuration;
+    }
 
-    return {anEnvironment, aerFilter};
+    return accessIntervals;
+}
+
+void Generator::recordStatistics(const Statistics& aStatistics) const
+{
+    if (!this->isStatisticsEnabled())
+    {
+        return;
+    }
+
+    const std::lock_guard<std::mutex> lock(*this->statisticsMutexSPtr_);
+
+    Statistics& statistics = *this->statisticsSPtr_;
+
+    statistics.conditionEvaluationCount += aStatistics.conditionEvaluationCount;
+    statistics.conditionEvaluationDuration += aStatistics.conditionEvaluationDuration;
+    statistics.rootSolverCallCount += aStatistics.rootSolverCallCount;
+    statistics.rootSolverIterationCount += aStatistics.rootSolverIterationCount;
+    statistics.rootSolverDuration += aStatistics.rootSolverDuration;
+    statistics.stateQueryCount += aStatistics.stateQueryCount;
+    statistics.stateQueryDuration += aStatistics.stateQueryDuration;
+    statistics.lineOfSightCount += aStatistics.lineOfSightCount;
+    statistics.lineOfSightDuration += aStatistics.lineOfSightDuration;
+    statistics.aerCalculationCount += aStatistics.aerCalculationCount;
+    statistics.aerCalculationDuration += aStatistics.aerCalculationDuration;
+    statistics.timeOfClosestApproachEvaluationCount += aStatistics.timeOfClosestApproachEvaluationCount;
+    statistics.timeOfClosestApproachDuration += aStatistics.timeOfClosestApproachDuration;
 }
 
 Access Generator::GenerateAccess(
@@ -317,7 +717,8 @@ Access Generator::GenerateAccess(
     const Trajectory& aFromTrajectory,
     const Trajectory& aToTrajectory,
     const Shared<const Celestial> anEarthSPtr,
-    const Duration& aTolerance
+    const Duration& aTolerance,
+    Statistics* aStatisticsPtr
 )
 {
     const Access::Type type = ((aGlobalInterval.accessStart() != anAccessInterval.accessStart()) &&
@@ -325,23 +726,57 @@ Access Generator::GenerateAccess(
                                 ? Access::Type::Complete
                                 : Access::Type::Partial;
 
+    // Short-lived state cache, shared by the TCA search and the maximum elevation evaluation
+
+    std::map<Instant, Pair<State, State>> stateCache;
+
+    Size stateQueryCount = 0;
+
+    const std::function<Pair<State, State>(const Instant&)> getStatesAt =
+        [&stateCache, &stateQueryCount, &aFromTrajectory, &aToTrajectory](const Instant& anInstant
+        ) -> Pair<State, State>
+    {
+        ++stateQueryCount;
+
+        const auto stateCacheIt = stateCache.find(anInstant);
+
+        if (stateCacheIt != stateCache.end())
+        {
+            return stateCacheIt->second;
+        }
+
+        const Pair<State, State> states = GeneratorContext::GetStatesAt(anInstant, aFromTrajectory, aToTrajectory);
+
+        stateCache.emplace(anInstant, states);
+
+        return states;
+    };
+
+    const auto timeOfClosestApproachStartTime = std::chrono::steady_clock::now();
+
     const Instant acquisitionOfSignal = anAccessInterval.getStart();
     const Instant timeOfClosestApproach =
-        Generator::FindTimeOfClosestApproach(anAccessInterval, aFromTrajectory, aToTrajectory, aTolerance);
+        Generator::FindTimeOfClosestApproach(anAccessInterval, getStatesAt, aTolerance);
     const Instant lossOfSignal = anAccessInterval.getEnd();
 
-    const Angle maxElevation =
-        timeOfClosestApproach.isDefined()
-            ? Generator::CalculateElevationAt(timeOfClosestApproach, aFromTrajectory, aToTrajectory, anEarthSPtr)
-            : Angle::Undefined();
+    if (aStatisticsPtr != nullptr)
+    {
+        aStatisticsPtr->timeOfClosestApproachEvaluationCount += stateQueryCount;
+        aStatisticsPtr->timeOfClosestApproachDuration += DurationSince(timeOfClosestApproachStartTime);
+    }
+
+    // The TCA is one of the optimizer query instants, hence its states are retrieved from the cache
+
+    const Angle maxElevation = timeOfClosestApproach.isDefined()
+                                 ? Generator::CalculateElevationAt(timeOfClosestApproach, getStatesAt, anEarthSPtr)
+                                 : Angle::Undefined();
 
     return Access {type, acquisitionOfSignal, timeOfClosestApproach, lossOfSignal, maxElevation};
 }
 
 Instant Generator::FindTimeOfClosestApproach(
     const physics::time::Interval& anAccessInterval,
-    const Trajectory& aFromTrajectory,
-    const Trajectory& aToTrajectory,
+    const std::function<Pair<State, State>(const Instant&)>& aStatesGetter,
     const Duration& aTolerance
 )
 {
@@ -377,14 +812,7 @@ Instant Generator::FindTimeOfClosestApproach(
         return squaredRange_m;
     };
 
-    Context context = {
-        anAccessInterval.getStart(),
-        [&aFromTrajectory, &aToTrajectory](const Instant& anInstant) -> Pair<State, State>
-        {
-            return GeneratorContext::GetStatesAt(anInstant, aFromTrajectory, aToTrajectory);
-        },
-        GeneratorContext::GetPositionsFromStates
-    };
+    Context context = {anAccessInterval.getStart(), aStatesGetter, GeneratorContext::GetPositionsFromStates};
 
     nlopt::opt optimizer = {nlopt::LN_COBYLA, 1};
 
@@ -432,12 +860,11 @@ Instant Generator::FindTimeOfClosestApproach(
 
 Angle Generator::CalculateElevationAt(
     const Instant& anInstant,
-    const Trajectory& aFromTrajectory,
-    const Trajectory& aToTrajectory,
+    const std::function<Pair<State, State>(const Instant&)>& aStatesGetter,
     const Shared<const Celestial> anEarthSPtr
 )
 {
-    const auto [fromState, toState] = GeneratorContext::GetStatesAt(anInstant, aFromTrajectory, aToTrajectory);
+    const auto [fromState, toState] = aStatesGetter(anInstant);
     const auto [fromPosition, toPosition] = GeneratorContext::GetPositionsFromStates(fromState, toState);
 
     const AER aer = GeneratorContext::CalculateAer(anInstant, fromPosition, toPosition, anEarthSPtr);
@@ -448,30 +875,138 @@ Angle Generator::CalculateElevationAt(
 GeneratorContext::GeneratorContext(
     const Trajectory& aFromTrajectory,
     const Trajectory& aToTrajectory,
-    const Environment& anEnvironment,
+    const EnvironmentView& anEnvironmentView,
     const Generator& aGenerator
 )
     : fromTrajectory_(aFromTrajectory),
       toTrajectory_(aToTrajectory),
-      environment_(anEnvironment),
+      environment_(anEnvironmentView),
       earthSPtr_(environment_.accessCelestialObjectWithName("Earth")),  // [TBR] This is Earth specific
-      generator_(aGenerator)
+      generator_(aGenerator),
+      aerFilter_(aGenerator.isDefined() ? aGenerator.getAerFilter() : std::function<bool(const AER&)>()),
+      fromTrajectoryIsStationary_(false),
+      fromPositionCoordinates_ITRF_(Vector3d::Zero()),
+      fromItrfToNedRotation_(Matrix3d::Identity()),
+      fromStaticPosition_(Position::Undefined()),
+      toStaticPosition_(Position::Undefined()),
+      lineOfSightIsAnalytic_(true),
+      occultingCelestialSPtrs_(Array<Shared<const Celestial>>::Empty()),
+      prefetchChunkSize_(0),
+      prefetchStep_(Duration::Undefined()),
+      prefetchEndInstant_(Instant::Undefined()),
+      nextPrefetchInstant_(Instant::Undefined()),
+      prefetchedInstants_(Array<Instant>::Empty()),
+      prefetchedFromStates_(Array<State>::Empty()),
+      prefetchedToStates_(Array<State>::Empty()),
+      prefetchIndex_(0),
+      statisticsPtr_(nullptr)
 {
+    if (fromTrajectory_.isDefined() && fromTrajectory_.accessModel().is<trajectory::model::Static>())
+    {
+        fromStaticPosition_ = fromTrajectory_.accessModel().as<trajectory::model::Static>().accessPosition();
+
+        // Precompute the ITRF to NED rotation of stationary "from" trajectories, as it is time-invariant
+
+        if ((*fromStaticPosition_.accessFrame()) == (*Frame::ITRF()))
+        {
+            fromTrajectoryIsStationary_ = true;
+            fromPositionCoordinates_ITRF_ = fromStaticPosition_.accessCoordinates();
+            fromItrfToNedRotation_ =
+                GeneratorContext::ComputeItrfToNedRotation(fromPositionCoordinates_ITRF_, earthSPtr_);
+        }
+    }
+
+    if (toTrajectory_.isDefined() && toTrajectory_.accessModel().is<trajectory::model::Static>())
+    {
+        toStaticPosition_ = toTrajectory_.accessModel().as<trajectory::model::Static>().accessPosition();
+    }
+
+    // Celestial objects are spheroids in their own frame, hence their occultation is tested analytically
+
+    for (const Shared<const Object>& objectSPtr : environment_.accessObjects())
+    {
+        const Shared<const Celestial> celestialSPtr = std::dynamic_pointer_cast<const Celestial>(objectSPtr);
+
+        if ((celestialSPtr == nullptr) || (!celestialSPtr->isDefined()))
+        {
+            lineOfSightIsAnalytic_ = false;
+            occultingCelestialSPtrs_ = Array<Shared<const Celestial>>::Empty();
+
+            break;
+        }
+
+        occultingCelestialSPtrs_.add(celestialSPtr);
+    }
 }
 
 bool GeneratorContext::isAccessActive(const Instant& anInstant)
 {
     this->environment_.setInstant(anInstant);
 
-    const auto [fromState, toState] =
-        GeneratorContext::GetStatesAt(anInstant, this->fromTrajectory_, this->toTrajectory_);
+    // Native sensor filters are evaluated on the GCRF positions below, without converting the states twice. Without a
+    // custom state filter, only positions are queried, so that static trajectories skip state construction.
+
+    const std::function<bool(const State&, const State&)>& stateFilter = this->generator_.getStateFilter();
+    const SensorFilter* sensorFilterPtr = stateFilter.target<SensorFilter>();
+
+    const auto stateQueryStartTime = std::chrono::steady_clock::now();
+
+    const auto recordStateQuery = [this, &stateQueryStartTime]() -> void
+    {
+        if (this->statisticsPtr_ != nullptr)
+        {
+            this->statisticsPtr_->stateQueryCount++;
+            this->statisticsPtr_->stateQueryDuration += DurationSince(stateQueryStartTime);
+        }
+    };
+
+    Pair<Position, Position> positions = {Position::Undefined(), Position::Undefined()};
+
+    if (stateFilter && (sensorFilterPtr == nullptr))
+    {
+        const auto [fromState, toState] = this->getStatesAt(anInstant);
+
+        recordStateQuery();
 
-    if (this->generator_.getStateFilter() && (!this->generator_.getStateFilter()(fromState, toState)))
+        if (!stateFilter(fromState, toState))
+        {
+            return false;
+        }
+
+        positions = GeneratorContext::GetPositionsFromStates(fromState, toState);
+    }
+    else
+    {
+        positions = this->getPositionsAt(anInstant);
+
+        recordStateQuery();
+    }
+
+    const auto& [fromPosition, toPosition] = positions;
+
+    if ((sensorFilterPtr != nullptr) &&
+        (!sensorFilterPtr->evaluate(anInstant, toPosition.accessCoordinates(), fromPosition.accessCoordinates())))
     {
         return false;
     }
 
-    const auto [fromPosition, toPosition] = GeneratorContext::GetPositionsFromStates(fromState, toState);
+    // Coarse screening
+
+    if (this->generator_.isScreeningEnabled())
+    {
+        const bool passesScreening = GeneratorContext::PassesScreening(
+            fromPosition,
+            toPosition,
+            this->earthSPtr_,
+            this->generator_.getScreeningMinimumElevation(),
+            this->generator_.getScreeningMaximumRange()
+        );
+
+        if (!passesScreening)
+        {
+            return false;
+        }
+    }
 
     // Line of sight
 
@@ -482,11 +1017,29 @@ bool GeneratorContext::isAccessActive(const Instant& anInstant)
 
     if (fromPositionCoordinates != toPositionCoordinates)
     {
-        const Segment fromToSegment = {fromPositionCoordinates, toPositionCoordinates};
+        const auto lineOfSightStartTime = std::chrono::steady_clock::now();
+
+        bool lineOfSight = true;
 
-        const Object::Geometry fromToSegmentGeometry = {fromToSegment, commonFrameSPtr};
+        if (this->lineOfSightIsAnalytic_)
+        {
+            lineOfSight =
+                this->isLineOfSightClear(anInstant, fromPosition.accessCoordinates(), toPosition.accessCoordinates());
+        }
+        else
+        {
+            const Segment fromToSegment = {fromPositionCoordinates, toPositionCoordinates};
 
-        const bool lineOfSight = !this->environment_.intersects(fromToSegmentGeometry);
+            const Object::Geometry fromToSegmentGeometry = {fromToSegment, commonFrameSPtr};
+
+            lineOfSight = !this->environment_.intersects(fromToSegmentGeometry);
+        }
+
+        if (this->statisticsPtr_ != nullptr)
+        {
+            this->statisticsPtr_->lineOfSightCount++;
+            this->statisticsPtr_->lineOfSightDuration += DurationSince(lineOfSightStartTime);
+        }
 
         if (!lineOfSight)
         {
@@ -496,11 +1049,42 @@ bool GeneratorContext::isAccessActive(const Instant& anInstant)
 
     // AER filtering
 
-    if (this->generator_.getAerFilter())
+    if (this->aerFilter_)
     {
-        const AER aer = GeneratorContext::CalculateAer(anInstant, fromPosition, toPosition, this->earthSPtr_);
+        const auto aerCalculationStartTime = std::chrono::steady_clock::now();
+
+        const AerFilter* nativeAerFilterPtr = this->aerFilter_.target<AerFilter>();
+
+        // Native AER filters from stationary positions are evaluated on raw coordinates, without constructing an AER
+
+        if ((nativeAerFilterPtr != nullptr) && this->fromTrajectoryIsStationary_)
+        {
+            const Vector3d aerCoordinates = GeneratorContext::CalculateAerCoordinates(
+                anInstant, this->fromPositionCoordinates_ITRF_, this->fromItrfToNedRotation_, toPosition
+            );
+
+            if (this->statisticsPtr_ != nullptr)
+            {
+                this->statisticsPtr_->aerCalculationCount++;
+                this->statisticsPtr_->aerCalculationDuration += DurationSince(aerCalculationStartTime);
+            }
 
-        if (!this->generator_.getAerFilter()(aer))
+            return nativeAerFilterPtr->evaluate(aerCoordinates[0], aerCoordinates[1], aerCoordinates[2]);
+        }
+
+        const AER aer = this->fromTrajectoryIsStationary_
+                          ? GeneratorContext::CalculateAer(
+                                anInstant, this->fromPositionCoordinates_ITRF_, this->fromItrfToNedRotation_, toPosition
+                            )
+                          : GeneratorContext::CalculateAer(anInstant, fromPosition, toPosition, this->earthSPtr_);
+
+        if (this->statisticsPtr_ != nullptr)
+        {
+            this->statisticsPtr_->aerCalculationCount++;
+            this->statisticsPtr_->aerCalculationDuration += DurationSince(aerCalculationStartTime);
+        }
+
+        if (!this->aerFilter_(aer))
         {
             return false;
         }
@@ -509,6 +1093,181 @@ bool GeneratorContext::isAccessActive(const Instant& anInstant)
     return true;
 }
 
+bool GeneratorContext::isLineOfSightClear(
+    const Instant& anInstant, const Vector3d& aFromPositionCoordinates, const Vector3d& aToPositionCoordinates
+) const
+{
+    static const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+
+    for (const Shared<const Celestial>& celestialSPtr : this->occultingCelestialSPtrs_)
+    {
+        const Transform transform = TransformCache::Get(celestialSPtr->accessFrame(), gcrfSPtr, anInstant);
+
+        const double equatorialRadius_m = celestialSPtr->getEquatorialRadius().inMeters();
+        const double polarRadius_m = equatorialRadius_m * (1.0 - celestialSPtr->getFlattening());
+
+        const bool intersects = GeneratorContext::SegmentIntersectsSpheroid(
+            aFromPositionCoordinates,
+            aToPositionCoordinates,
+            transform.applyToPosition(Vector3d::Zero()),
+            transform.applyToVector(Vector3d::UnitZ()),
+            equatorialRadius_m,
+            polarRadius_m
+        );
+
+        if (intersects)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void GeneratorContext::enableStatePrefetching(
+    const Instant& anEndInstant, const Duration& aStep, const Size& aChunkSize
+)
+{
+    if (!anEndInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("End instant");
+    }
+
+    if (!aStep.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Step");
+    }
+
+    if (aStep <= Duration::Zero())
+    {
+        throw ostk::core::error::runtime::Wrong("Step");
+    }
+
+    this->prefetchChunkSize_ = aChunkSize;
+    this->prefetchStep_ = aStep;
+    this->prefetchEndInstant_ = anEndInstant;
+    this->nextPrefetchInstant_ = Instant::Undefined();
+    this->prefetchedInstants_ = Array<Instant>::Empty();
+    this->prefetchedFromStates_ = Array<State>::Empty();
+    this->prefetchedToStates_ = Array<State>::Empty();
+    this->prefetchIndex_ = 0;
+}
+
+Pair<State, State> GeneratorContext::getStatesAt(const Instant& anInstant)
+{
+    const Index index = this->getPrefetchIndexAt(anInstant);
+
+    // Static trajectories are not prefetched
+
+    const auto getStateAt =
+        [&anInstant, &index](const Trajectory& aTrajectory, const Array<State>& aStateArray) -> State
+    {
+        return (index < aStateArray.getSize()) ? aStateArray[index] : aTrajectory.getStateAt(anInstant);
+    };
+
+    return {
+        getStateAt(this->fromTrajectory_, this->prefetchedFromStates_),
+        getStateAt(this->toTrajectory_, this->prefetchedToStates_),
+    };
+}
+
+void GeneratorContext::setStatistics(Generator::Statistics* aStatisticsPtr)
+{
+    this->statisticsPtr_ = aStatisticsPtr;
+}
+
+void GeneratorContext::prefetchStates()
+{
+    // Grid instants are accumulated the same way as in the temporal condition solver, to match exactly
+
+    Array<Instant> instants = Array<Instant>::Empty();
+    instants.reserve(this->prefetchChunkSize_);
+
+    Instant instant = this->nextPrefetchInstant_;
+
+    while ((instants.getSize() < this->prefetchChunkSize_) && (instant <= this->prefetchEndInstant_))
+    {
+        instants.add(instant);
+        instant = instant + this->prefetchStep_;
+    }
+
+    this->nextPrefetchInstant_ = instant;
+
+    this->prefetchedFromStates_ = this->fromStaticPosition_.isDefined() ? Array<State>::Empty()
+                                                                         : this->fromTrajectory_.getStatesAt(instants);
+    this->prefetchedToStates_ =
+        this->toStaticPosition_.isDefined() ? Array<State>::Empty() : this->toTrajectory_.getStatesAt(instants);
+    this->prefetchedInstants_ = instants;
+    this->prefetchIndex_ = 0;
+}
+
+Index GeneratorContext::getPrefetchIndexAt(const Instant& anInstant)
+{
+    static const Index noIndex = std::numeric_limits<Index>::max();
+
+    if (this->prefetchChunkSize_ == 0)
+    {
+        return noIndex;
+    }
+
+    // The grid is anchored on the first queried instant
+
+    if (!this->nextPrefetchInstant_.isDefined())
+    {
+        this->nextPrefetchInstant_ = anInstant;
+    }
+
+    // Off-grid queries preceding the next grid instant must not trigger a prefetch
+
+    if ((this->prefetchIndex_ >= this->prefetchedInstants_.getSize()) && (anInstant >= this->nextPrefetchInstant_) &&
+        (this->nextPrefetchInstant_ <= this->prefetchEndInstant_))
+    {
+        this->prefetchStates();
+    }
+
+    if ((this->prefetchIndex_ < this->prefetchedInstants_.getSize()) &&
+        (this->prefetchedInstants_[this->prefetchIndex_] == anInstant))
+    {
+        return this->prefetchIndex_++;
+    }
+
+    return noIndex;
+}
+
+Pair<Position, Position> GeneratorContext::getPositionsAt(const Instant& anInstant)
+{
+    static const Shared<const Frame> commonFrameSPtr = Frame::GCRF();
+
+    const Index index = this->getPrefetchIndexAt(anInstant);
+
+    // Fixed positions share the cached transform of the instant with all other static trajectories
+
+    const auto getPositionAt = [&anInstant, &index](
+                                   const Position& aStaticPosition,
+                                   const Trajectory& aTrajectory,
+                                   const Array<State>& aStateArray
+                               ) -> Position
+    {
+        if (aStaticPosition.isDefined())
+        {
+            return Position::Meters(
+                TransformCache::Get(aStaticPosition.accessFrame(), commonFrameSPtr, anInstant)
+                    .applyToPosition(aStaticPosition.accessCoordinates()),
+                commonFrameSPtr
+            );
+        }
+
+        const State state = (index < aStateArray.getSize()) ? aStateArray[index] : aTrajectory.getStateAt(anInstant);
+
+        return Position::Meters(LazyState(state, commonFrameSPtr).accessPositionCoordinates(), commonFrameSPtr);
+    };
+
+    return {
+        getPositionAt(this->fromStaticPosition_, this->fromTrajectory_, this->prefetchedFromStates_),
+        getPositionAt(this->toStaticPosition_, this->toTrajectory_, this->prefetchedToStates_),
+    };
+}
+
 Pair<State, State> GeneratorContext::GetStatesAt(
     const Instant& anInstant, const Trajectory& aFromTrajectory, const Trajectory& aToTrajectory
 )
@@ -528,10 +1287,15 @@ Pair<Position, Position> GeneratorContext::GetPositionsFromStates(const State& a
 
     static const Shared<const Frame> commonFrameSPtr = Frame::GCRF();
 
-    const Position fromPosition = aFromState.getPosition().inFrame(commonFrameSPtr, aFromState.accessInstant());
-    const Position toPosition = aToState.getPosition().inFrame(commonFrameSPtr, aFromState.accessInstant());
+    // Trajectories are typically sampled at the same instants, hence share their transforms through the cache. Only
+    // the position is converted.
+
+    const auto getPositionInCommonFrame = [](const State& aState) -> Position
+    {
+        return Position::Meters(LazyState(aState, commonFrameSPtr).accessPositionCoordinates(), commonFrameSPtr);
+    };
 
-    return {fromPosition, toPosition};
+    return {getPositionInCommonFrame(aFromState), getPositionInCommonFrame(aToState)};
 }
 
 AER GeneratorContext::CalculateAer(
@@ -557,6 +1321,168 @@ AER GeneratorContext::CalculateAer(
     return AER::FromPositionToPosition(fromPosition_NED, toPosition_NED, true);
 }
 
+AER GeneratorContext::CalculateAer(
+    const Instant& anInstant,
+    const Vector3d& aFromPositionCoordinates_ITRF,
+    const Matrix3d& anItrfToNedRotation,
+    const Position& aToPosition
+)
+{
+    const Vector3d aerCoordinates = GeneratorContext::CalculateAerCoordinates(
+        anInstant, aFromPositionCoordinates_ITRF, anItrfToNedRotation, aToPosition
+    );
+
+    return {Angle::Radians(aerCoordinates[0]), Angle::Radians(aerCoordinates[1]), Length::Meters(aerCoordinates[2])};
+}
+
+Vector3d GeneratorContext::CalculateAerCoordinates(
+    const Instant& anInstant,
+    const Vector3d& aFromPositionCoordinates_ITRF,
+    const Matrix3d& anItrfToNedRotation,
+    const Position& aToPosition
+)
+{
+    static const Shared<const Frame> itrfSPtr = Frame::ITRF();
+
+    const Vector3d toPositionCoordinates_ITRF =
+        TransformCache::Get(aToPosition.accessFrame(), itrfSPtr, anInstant)
+            .applyToPosition(aToPosition.inUnit(Position::Unit::Meter).accessCoordinates());
+
+    const Vector3d fromToVector_NED =
+        anItrfToNedRotation * (toPositionCoordinates_ITRF - aFromPositionCoordinates_ITRF);
+
+    const double range_m = fromToVector_NED.norm();
+
+    if (range_m == 0.0)
+    {
+        return Vector3d::Zero();
+    }
+
+    const double elevation_rad = std::asin(std::clamp(-fromToVector_NED.z() / range_m, -1.0, +1.0));
+    double azimuth_rad = std::atan2(fromToVector_NED.y(), fromToVector_NED.x());
+
+    if (azimuth_rad < 0.0)
+    {
+        azimuth_rad += Real::TwoPi();
+    }
+
+    return {azimuth_rad, elevation_rad, range_m};
+}
+
+Matrix3d GeneratorContext::ComputeItrfToNedRotation(
+    const Vector3d& aPositionCoordinates_ITRF, const Shared<const Celestial> anEarthSPtr
+)
+{
+    const LLA lla = LLA::Cartesian(
+        aPositionCoordinates_ITRF, anEarthSPtr->getEquatorialRadius(), anEarthSPtr->getFlattening()
+    );
+
+    const double sinLatitude = std::sin(lla.getLatitude().inRadians());
+    const double cosLatitude = std::cos(lla.getLatitude().inRadians());
+    const double sinLongitude = std::sin(lla.getLongitude().inRadians());
+    const double cosLongitude = std::cos(lla.getLongitude().inRadians());
+
+    Matrix3d itrfToNedRotation;
+
+    itrfToNedRotation << -sinLatitude * cosLongitude, -sinLatitude * sinLongitude, +cosLatitude,  //
+        -sinLongitude, +cosLongitude, 0.0,                                                         //
+        -cosLatitude * cosLongitude, -cosLatitude * sinLongitude, -sinLatitude;
+
+    return itrfToNedRotation;
+}
+
+bool GeneratorContext::SegmentIntersectsSpheroid(
+    const Vector3d& aStartCoordinates,
+    const Vector3d& anEndCoordinates,
+    const Vector3d& aCenterCoordinates,
+    const Vector3d& aPolarAxis,
+    const double& anEquatorialRadius,
+    const double& aPolarRadius
+)
+{
+    static const double grazingTolerance_m = 1.0e-3;
+
+    // Scaling along the polar axis maps the spheroid to a sphere of equatorial radius
+
+    const double polarScaling = anEquatorialRadius / aPolarRadius - 1.0;
+
+    const auto toSphereCoordinates = [&aPolarAxis, &polarScaling](const Vector3d& aVector) -> Vector3d
+    {
+        return aVector + (polarScaling * aPolarAxis.dot(aVector)) * aPolarAxis;
+    };
+
+    const Vector3d startCoordinates = toSphereCoordinates(aStartCoordinates - aCenterCoordinates);
+    const Vector3d direction = toSphereCoordinates(anEndCoordinates - aStartCoordinates);
+
+    const double squaredLength = direction.squaredNorm();
+
+    const double closestApproachRatio =
+        (squaredLength > 0.0) ? std::clamp(-startCoordinates.dot(direction) / squaredLength, 0.0, 1.0) : 0.0;
+
+    const double closestApproachDistance = (startCoordinates + closestApproachRatio * direction).norm();
+
+    return closestApproachDistance < (anEquatorialRadius - grazingTolerance_m);
+}
+
+bool GeneratorContext::PassesScreening(
+    const Position& aFromPosition,
+    const Position& aToPosition,
+    const Shared<const Celestial> anEarthSPtr,
+    const Angle& aMinimumElevation,
+    const Length& aMaximumRange
+)
+{
+    using ostk::mathematics::object::Vector3d;
+
+    // Upper bound of the deflection between the geodetic and geocentric verticals, with margin
+    static const double verticalDeflectionMargin_rad = Angle::Degrees(0.5).inRadians();
+
+    const Vector3d fromCoordinates = aFromPosition.accessCoordinates();
+    const Vector3d toCoordinates = aToPosition.accessCoordinates();
+
+    const Vector3d fromToVector = toCoordinates - fromCoordinates;
+    const double range_m = fromToVector.norm();
+
+    if (range_m == 0.0)
+    {
+        return true;
+    }
+
+    // Maximum range
+
+    if (aMaximumRange.isDefined() && (range_m > aMaximumRange.inMeters()))
+    {
+        return false;
+    }
+
+    // Minimum geocentric elevation
+
+    const double fromRadius_m = fromCoordinates.norm();
+
+    if (aMinimumElevation.isDefined() && (fromRadius_m > 0.0))
+    {
+        const double sineOfElevation = fromCoordinates.dot(fromToVector) / (fromRadius_m * range_m);
+        const double elevation_rad = std::asin(std::clamp(sineOfElevation, -1.0, +1.0));
+
+        if (elevation_rad < (aMinimumElevation.inRadians() - verticalDeflectionMargin_rad))
+        {
+            return false;
+        }
+    }
+
+    // Earth occlusion: the polar sphere is enclosed by the Earth ellipsoid
+
+    const double polarRadius_m =
+        anEarthSPtr->getEquatorialRadius().inMeters() * (1.0 - anEarthSPtr->getFlattening());
+
+    const double closestApproachRatio =
+        std::clamp(-fromCoordinates.dot(fromToVector) / (range_m * range_m), 0.0, 1.0);
+
+    const Vector3d closestApproachCoordinates = fromCoordinates + closestApproachRatio * fromToVector;
+
+    return closestApproachCoordinates.norm() >= polarRadius_m;
+}
+
 }  // namespace access
 }  // namespace astrodynamics
 }  // namespace ostk
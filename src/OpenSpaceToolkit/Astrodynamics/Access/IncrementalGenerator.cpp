@@ -0,0 +1,206 @@
+/// Apache License 2.0
+
+#include <algorithm>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Access/IncrementalGenerator.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace access
+{
+
+IncrementalGenerator::IncrementalGenerator(
+    const Generator& aGenerator, const Trajectory& aFromTrajectory, const Trajectory& aToTrajectory
+)
+    : generator_(aGenerator),
+      fromTrajectory_(aFromTrajectory),
+      toTrajectory_(aToTrajectory),
+      interval_(physics::time::Interval::Undefined()),
+      accessIntervals_(Array<physics::time::Interval>::Empty()),
+      accesses_(Array<Access>::Empty())
+{
+}
+
+bool IncrementalGenerator::isDefined() const
+{
+    return this->generator_.isDefined() && this->fromTrajectory_.isDefined() && this->toTrajectory_.isDefined();
+}
+
+physics::time::Interval IncrementalGenerator::getInterval() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Incremental Generator");
+    }
+
+    return this->interval_;
+}
+
+Array<Access> IncrementalGenerator::computeAccesses(const physics::time::Interval& anInterval)
+{
+    if (!anInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Incremental Generator");
+    }
+
+    const Instant& startInstant = anInterval.accessStart();
+    const Instant& endInstant = anInterval.accessEnd();
+
+    const bool previousResultsAreReusable = this->interval_.isDefined() &&
+                                            (startInstant >= this->interval_.accessStart()) &&
+                                            (startInstant <= this->interval_.accessEnd());
+
+    Generator::Statistics statistics;
+    Generator::Statistics* statisticsPtr = this->generator_.isStatisticsEnabled() ? &statistics : nullptr;
+
+    Array<physics::time::Interval> accessIntervals = Array<physics::time::Interval>::Empty();
+
+    if (!previousResultsAreReusable)
+    {
+        accessIntervals = this->generator_.computeAccessIntervals(
+            anInterval, this->fromTrajectory_, this->toTrajectory_, statisticsPtr
+        );
+    }
+    else
+    {
+        const Instant& previousEndInstant = this->interval_.accessEnd();
+
+        const bool intervalIsExtended = endInstant > previousEndInstant;
+
+        Instant tailStartInstant = previousEndInstant;
+
+        // Retain previous access intervals overlapping the new interval, clipped to it
+
+        for (const auto& previousAccessInterval : this->accessIntervals_)
+        {
+            if (previousAccessInterval.accessEnd() <= startInstant)
+            {
+                continue;
+            }
+
+            if (previousAccessInterval.accessStart() >= endInstant)
+            {
+                break;
+            }
+
+            // An access touching the previous interval end may extend past it, hence it is re-evaluated
+
+            if (intervalIsExtended && (previousAccessInterval.accessEnd() == previousEndInstant))
+            {
+                tailStartInstant = std::max(previousAccessInterval.accessStart(), startInstant);
+                break;
+            }
+
+            accessIntervals.add(physics::time::Interval::Closed(
+                std::max(previousAccessInterval.accessStart(), startInstant),
+                std::min(previousAccessInterval.accessEnd(), endInstant)
+            ));
+        }
+
+        // Only the new tail is evaluated
+
+        if (intervalIsExtended)
+        {
+            const physics::time::Interval tailInterval = physics::time::Interval::Closed(tailStartInstant, endInstant);
+
+            accessIntervals.add(this->generator_.computeAccessIntervals(
+                tailInterval, this->fromTrajectory_, this->toTrajectory_, statisticsPtr
+            ));
+        }
+    }
+
+    // Generate accesses, reusing the post-processing of unchanged access intervals
+
+    const Shared<const Celestial> earthSPtr = this->generator_.environment_.accessCelestialObjectWithName("Earth");
+
+    Array<Access> accesses = Array<Access>::Empty();
+    accesses.reserve(accessIntervals.getSize());
+
+    Size previousAccessIndex = 0;
+
+    for (const auto& accessInterval : accessIntervals)
+    {
+        while ((previousAccessIndex < this->accessIntervals_.getSize()) &&
+               (this->accessIntervals_[previousAccessIndex].accessStart() < accessInterval.accessStart()))
+        {
+            ++previousAccessIndex;
+        }
+
+        const bool accessIsUnchanged = previousResultsAreReusable &&
+                                       (previousAccessIndex < this->accessIntervals_.getSize()) &&
+                                       (this->accessIntervals_[previousAccessIndex] == accessInterval);
+
+        if (!accessIsUnchanged)
+        {
+            accesses.add(Generator::GenerateAccess(
+                accessInterval,
+                anInterval,
+                this->fromTrajectory_,
+                this->toTrajectory_,
+                earthSPtr,
+                this->generator_.tolerance_,
+                statisticsPtr
+            ));
+
+            continue;
+        }
+
+        // The access type depends on the analysis interval, hence it is updated
+
+        const Access& previousAccess = this->accesses_[previousAccessIndex];
+
+        const Access::Type type =
+            ((accessInterval.accessStart() != startInstant) && (accessInterval.accessEnd() != endInstant))
+                ? Access::Type::Complete
+                : Access::Type::Partial;
+
+        accesses.add(Access(
+            type,
+            previousAccess.getAcquisitionOfSignal(),
+            previousAccess.getTimeOfClosestApproach(),
+            previousAccess.getLossOfSignal(),
+            previousAccess.getMaxElevation()
+        ));
+    }
+
+    if (statisticsPtr != nullptr)
+    {
+        this->generator_.recordStatistics(statistics);
+    }
+
+    this->interval_ = anInterval;
+    this->accessIntervals_ = accessIntervals;
+    this->accesses_ = accesses;
+
+    return accesses.getWhere(
+        [this](const Access& anAccess) -> bool
+        {
+            return this->generator_.accessFilter_ ? this->generator_.accessFilter_(anAccess) : true;
+        }
+    );
+}
+
+void IncrementalGenerator::reset()
+{
+    this->interval_ = physics::time::Interval::Undefined();
+    this->accessIntervals_ = Array<physics::time::Interval>::Empty();
+    this->accesses_ = Array<Access>::Empty();
+}
+
+IncrementalGenerator IncrementalGenerator::Undefined()
+{
+    return {Generator::Undefined(), Trajectory::Undefined(), Trajectory::Undefined()};
+}
+
+}  // namespace access
+}  // namespace astrodynamics
+}  // namespace ostk
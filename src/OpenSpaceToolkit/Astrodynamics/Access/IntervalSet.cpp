@@ -0,0 +1,282 @@
+/// Apache License 2.0
+
+#include <algorithm>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Access/IntervalSet.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace access
+{
+
+namespace
+{
+
+// Appends an interval to a sorted array, merging it with the last interval if they overlap or touch
+
+void AppendInterval(Array<Interval>& anIntervalArray, const Instant& aStartInstant, const Instant& anEndInstant)
+{
+    if (aStartInstant >= anEndInstant)
+    {
+        return;
+    }
+
+    if ((!anIntervalArray.isEmpty()) && (aStartInstant <= anIntervalArray.back().accessEnd()))
+    {
+        if (anEndInstant > anIntervalArray.back().accessEnd())
+        {
+            anIntervalArray.back() = Interval::Closed(anIntervalArray.back().accessStart(), anEndInstant);
+        }
+
+        return;
+    }
+
+    anIntervalArray.add(Interval::Closed(aStartInstant, anEndInstant));
+}
+
+}  // namespace
+
+IntervalSet::IntervalSet(const Array<Interval>& anIntervalArray)
+    : intervals_(Array<Interval>::Empty())
+{
+    for (const Interval& interval : anIntervalArray)
+    {
+        if (!interval.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Interval");
+        }
+    }
+
+    Array<Interval> sortedIntervals = anIntervalArray;
+
+    std::sort(
+        sortedIntervals.begin(),
+        sortedIntervals.end(),
+        [](const Interval& aFirstInterval, const Interval& aSecondInterval) -> bool
+        {
+            return aFirstInterval.accessStart() < aSecondInterval.accessStart();
+        }
+    );
+
+    this->intervals_.reserve(sortedIntervals.getSize());
+
+    for (const Interval& interval : sortedIntervals)
+    {
+        AppendInterval(this->intervals_, interval.accessStart(), interval.accessEnd());
+    }
+}
+
+bool IntervalSet::operator==(const IntervalSet& anIntervalSet) const
+{
+    return this->intervals_ == anIntervalSet.intervals_;
+}
+
+bool IntervalSet::operator!=(const IntervalSet& anIntervalSet) const
+{
+    return !((*this) == anIntervalSet);
+}
+
+bool IntervalSet::isEmpty() const
+{
+    return this->intervals_.isEmpty();
+}
+
+bool IntervalSet::contains(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    // Last interval starting at or before the instant
+
+    const auto intervalIt = std::upper_bound(
+        this->intervals_.begin(),
+        this->intervals_.end(),
+        anInstant,
+        [](const Instant& aValue, const Interval& anInterval) -> bool
+        {
+            return aValue < anInterval.accessStart();
+        }
+    );
+
+    if (intervalIt == this->intervals_.begin())
+    {
+        return false;
+    }
+
+    return anInstant <= std::prev(intervalIt)->accessEnd();
+}
+
+Size IntervalSet::getSize() const
+{
+    return this->intervals_.getSize();
+}
+
+const Array<Interval>& IntervalSet::accessIntervals() const
+{
+    return this->intervals_;
+}
+
+Duration IntervalSet::getDuration() const
+{
+    Duration duration = Duration::Zero();
+
+    for (const Interval& interval : this->intervals_)
+    {
+        duration += interval.getDuration();
+    }
+
+    return duration;
+}
+
+IntervalSet IntervalSet::unionWith(const IntervalSet& anIntervalSet) const
+{
+    const Array<Interval>& firstIntervals = this->intervals_;
+    const Array<Interval>& secondIntervals = anIntervalSet.intervals_;
+
+    IntervalSet intervalSet;
+    intervalSet.intervals_.reserve(firstIntervals.getSize() + secondIntervals.getSize());
+
+    Size firstIndex = 0;
+    Size secondIndex = 0;
+
+    while ((firstIndex < firstIntervals.getSize()) || (secondIndex < secondIntervals.getSize()))
+    {
+        const bool takeFirst =
+            (secondIndex == secondIntervals.getSize()) ||
+            ((firstIndex < firstIntervals.getSize()) &&
+             (firstIntervals[firstIndex].accessStart() <= secondIntervals[secondIndex].accessStart()));
+
+        const Interval& interval = takeFirst ? firstIntervals[firstIndex++] : secondIntervals[secondIndex++];
+
+        AppendInterval(intervalSet.intervals_, interval.accessStart(), interval.accessEnd());
+    }
+
+    return intervalSet;
+}
+
+IntervalSet IntervalSet::intersectionWith(const IntervalSet& anIntervalSet) const
+{
+    const Array<Interval>& firstIntervals = this->intervals_;
+    const Array<Interval>& secondIntervals = anIntervalSet.intervals_;
+
+    IntervalSet intervalSet;
+
+    Size firstIndex = 0;
+    Size secondIndex = 0;
+
+    while ((firstIndex < firstIntervals.getSize()) && (secondIndex < secondIntervals.getSize()))
+    {
+        const Interval& firstInterval = firstIntervals[firstIndex];
+        const Interval& secondInterval = secondIntervals[secondIndex];
+
+        const Instant& startInstant = std::max(firstInterval.accessStart(), secondInterval.accessStart());
+        const Instant& endInstant = std::min(firstInterval.accessEnd(), secondInterval.accessEnd());
+
+        if (startInstant < endInstant)
+        {
+            intervalSet.intervals_.add(Interval::Closed(startInstant, endInstant));
+        }
+
+        // Advance past the interval ending first, as it cannot overlap any further interval of the other set
+
+        if (firstInterval.accessEnd() < secondInterval.accessEnd())
+        {
+            ++firstIndex;
+        }
+        else
+        {
+            ++secondIndex;
+        }
+    }
+
+    return intervalSet;
+}
+
+IntervalSet IntervalSet::differenceWith(const IntervalSet& anIntervalSet) const
+{
+    const Array<Interval>& subtractedIntervals = anIntervalSet.intervals_;
+
+    IntervalSet intervalSet;
+
+    Size subtractedIndex = 0;
+
+    for (const Interval& interval : this->intervals_)
+    {
+        while ((subtractedIndex < subtractedIntervals.getSize()) &&
+               (subtractedIntervals[subtractedIndex].accessEnd() <= interval.accessStart()))
+        {
+            ++subtractedIndex;
+        }
+
+        Instant cursor = interval.accessStart();
+
+        // A subtracted interval extending past the current interval may overlap the next one, hence is not skipped
+
+        Size index = subtractedIndex;
+
+        while ((index < subtractedIntervals.getSize()) &&
+               (subtractedIntervals[index].accessStart() < interval.accessEnd()))
+        {
+            const Interval& subtractedInterval = subtractedIntervals[index];
+
+            if (subtractedInterval.accessStart() > cursor)
+            {
+                intervalSet.intervals_.add(Interval::Closed(cursor, subtractedInterval.accessStart()));
+            }
+
+            cursor = std::max(cursor, subtractedInterval.accessEnd());
+
+            if (subtractedInterval.accessEnd() >= interval.accessEnd())
+            {
+                break;
+            }
+
+            subtractedIndex = ++index;
+        }
+
+        if (cursor < interval.accessEnd())
+        {
+            intervalSet.intervals_.add(Interval::Closed(cursor, interval.accessEnd()));
+        }
+    }
+
+    return intervalSet;
+}
+
+IntervalSet IntervalSet::complementIn(const Interval& anInterval) const
+{
+    return IntervalSet(Array<Interval>({anInterval})).differenceWith(*this);
+}
+
+IntervalSet IntervalSet::Empty()
+{
+    return {};
+}
+
+IntervalSet IntervalSet::FromAccesses(const Array<Access>& anAccessArray)
+{
+    Array<Interval> intervals = Array<Interval>::Empty();
+    intervals.reserve(anAccessArray.getSize());
+
+    for (const Access& access : anAccessArray)
+    {
+        intervals.add(access.getInterval());
+    }
+
+    return {intervals};
+}
+
+IntervalSet::IntervalSet()
+    : intervals_(Array<Interval>::Empty())
+{
+}
+
+}  // namespace access
+}  // namespace astrodynamics
+}  // namespace ostk
@@ -0,0 +1,162 @@
+/// Apache License 2.0
+
+#include <algorithm>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Access/IntervalTree.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace access
+{
+
+IntervalTree::IntervalTree(const Array<Interval>& anIntervalArray)
+    : nodes_(Array<Node>::Empty())
+{
+    this->nodes_.reserve(anIntervalArray.getSize());
+
+    for (Index index = 0; index < anIntervalArray.getSize(); ++index)
+    {
+        const Interval& interval = anIntervalArray[index];
+
+        if (!interval.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Interval");
+        }
+
+        this->nodes_.add({interval.accessStart(), interval.accessEnd(), interval.accessEnd(), index});
+    }
+
+    std::sort(
+        this->nodes_.begin(),
+        this->nodes_.end(),
+        [](const Node& aFirstNode, const Node& aSecondNode) -> bool
+        {
+            return aFirstNode.startInstant < aSecondNode.startInstant;
+        }
+    );
+
+    if (!this->nodes_.isEmpty())
+    {
+        this->buildSubtree(0, this->nodes_.getSize());
+    }
+}
+
+Size IntervalTree::getSize() const
+{
+    return this->nodes_.getSize();
+}
+
+Array<Index> IntervalTree::queryContaining(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    Array<Index> indices = Array<Index>::Empty();
+
+    this->querySubtree(0, this->nodes_.getSize(), anInstant, anInstant, indices);
+
+    std::sort(indices.begin(), indices.end());
+
+    return indices;
+}
+
+Array<Index> IntervalTree::queryOverlapping(const Interval& anInterval) const
+{
+    if (!anInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    Array<Index> indices = Array<Index>::Empty();
+
+    this->querySubtree(0, this->nodes_.getSize(), anInterval.accessStart(), anInterval.accessEnd(), indices);
+
+    std::sort(indices.begin(), indices.end());
+
+    return indices;
+}
+
+IntervalTree IntervalTree::FromAccesses(const Array<Access>& anAccessArray)
+{
+    Array<Interval> intervals = Array<Interval>::Empty();
+    intervals.reserve(anAccessArray.getSize());
+
+    for (const Access& access : anAccessArray)
+    {
+        intervals.add(access.getInterval());
+    }
+
+    return {intervals};
+}
+
+Instant IntervalTree::buildSubtree(const Index& aBeginIndex, const Index& anEndIndex)
+{
+    // The subtree spanning [begin, end) is rooted at its middle node
+
+    const Index middleIndex = aBeginIndex + (anEndIndex - aBeginIndex) / 2;
+
+    Node& node = this->nodes_[middleIndex];
+
+    if (aBeginIndex < middleIndex)
+    {
+        node.subtreeEndInstant = std::max(node.subtreeEndInstant, this->buildSubtree(aBeginIndex, middleIndex));
+    }
+
+    if ((middleIndex + 1) < anEndIndex)
+    {
+        node.subtreeEndInstant = std::max(node.subtreeEndInstant, this->buildSubtree(middleIndex + 1, anEndIndex));
+    }
+
+    return node.subtreeEndInstant;
+}
+
+void IntervalTree::querySubtree(
+    const Index& aBeginIndex,
+    const Index& anEndIndex,
+    const Instant& aStartInstant,
+    const Instant& anEndInstant,
+    Array<Index>& anIndexArray
+) const
+{
+    if (aBeginIndex >= anEndIndex)
+    {
+        return;
+    }
+
+    const Index middleIndex = aBeginIndex + (anEndIndex - aBeginIndex) / 2;
+
+    const Node& node = this->nodes_[middleIndex];
+
+    // No interval of the subtree ends after the query starts
+
+    if (node.subtreeEndInstant < aStartInstant)
+    {
+        return;
+    }
+
+    this->querySubtree(aBeginIndex, middleIndex, aStartInstant, anEndInstant, anIndexArray);
+
+    // Intervals of the node and of its right subtree start after the query ends
+
+    if (node.startInstant > anEndInstant)
+    {
+        return;
+    }
+
+    if (node.endInstant >= aStartInstant)
+    {
+        anIndexArray.add(node.index);
+    }
+
+    this->querySubtree(middleIndex + 1, anEndIndex, aStartInstant, anEndInstant, anIndexArray);
+}
+
+}  // namespace access
+}  // namespace astrodynamics
+}  // namespace ostk
@@ -0,0 +1,335 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <cmath>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Access/SensorFilter.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/LazyState.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace access
+{
+
+using ostk::core::type::Index;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::physics::coordinate::Frame;
+
+using ostk::astrodynamics::trajectory::state::LazyState;
+
+bool SensorFilter::operator()(const State& aFromState, const State& aToState) const
+{
+    static const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+
+    if (aFromState.accessInstant() != aToState.accessInstant())
+    {
+        throw ostk::core::error::RuntimeError("Cannot evaluate sensor filter on states at different instants.");
+    }
+
+    const auto getPositionCoordinates = [](const State& aState) -> Vector3d
+    {
+        if (aState.accessFrame() == gcrfSPtr)
+        {
+            return aState.accessPositionCoordinates();
+        }
+
+        return LazyState(aState, gcrfSPtr).accessPositionCoordinates();
+    };
+
+    return this->evaluate(
+        aToState.accessInstant(), getPositionCoordinates(aToState), getPositionCoordinates(aFromState)
+    );
+}
+
+bool SensorFilter::evaluate(
+    const Instant& anInstant,
+    const Vector3d& anObserverPositionCoordinates,
+    const Vector3d& aTargetPositionCoordinates
+) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Sensor filter");
+    }
+
+    const Vector3d observerToTargetVector = aTargetPositionCoordinates - anObserverPositionCoordinates;
+
+    if (observerToTargetVector.isZero())
+    {
+        return false;
+    }
+
+    const Vector3d direction_S = this->getAttitudeAt(anInstant) * observerToTargetVector;
+
+    if (shape_ == Shape::Cone)
+    {
+        return direction_S.z() >= (cosineHalfAngle_ * direction_S.norm());
+    }
+
+    return (direction_S.z() > 0.0) && (std::abs(direction_S.x()) <= (tangentHorizontalHalfAngle_ * direction_S.z())) &&
+           (std::abs(direction_S.y()) <= (tangentVerticalHalfAngle_ * direction_S.z()));
+}
+
+bool SensorFilter::isDefined() const
+{
+    return (shape_ != Shape::Undefined) && profile_.isDefined() && interval_.isDefined() && step_.isDefined() &&
+           (!nodeAttitudes_.isEmpty());
+}
+
+SensorFilter::Shape SensorFilter::getShape() const
+{
+    return shape_;
+}
+
+physics::time::Interval SensorFilter::getInterval() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Sensor filter");
+    }
+
+    return interval_;
+}
+
+Duration SensorFilter::getStep() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Sensor filter");
+    }
+
+    return step_;
+}
+
+Quaternion SensorFilter::getAttitudeAt(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Sensor filter");
+    }
+
+    if (!interval_.contains(anInstant))
+    {
+        return this->computeAttitudeAt(anInstant);
+    }
+
+    const double stepRatio = (anInstant - interval_.accessStart()).inSeconds() / step_.inSeconds();
+
+    const Index nodeIndex =
+        std::min(static_cast<Index>(std::floor(stepRatio)), static_cast<Index>(nodeAttitudes_.getSize() - 2));
+
+    const double ratio = stepRatio - double(nodeIndex);
+
+    if (ratio == 0.0)
+    {
+        return nodeAttitudes_[nodeIndex];
+    }
+
+    return Quaternion::SLERP(nodeAttitudes_[nodeIndex], nodeAttitudes_[nodeIndex + 1], ratio);
+}
+
+SensorFilter SensorFilter::Undefined()
+{
+    return {
+        Shape::Undefined,
+        Profile::Undefined(),
+        Quaternion::Undefined(),
+        0.0,
+        0.0,
+        0.0,
+        physics::time::Interval::Undefined(),
+        Duration::Undefined(),
+    };
+}
+
+SensorFilter SensorFilter::Cone(
+    const Profile& aProfile,
+    const Quaternion& aSensorAttitude,
+    const Angle& aHalfAngle,
+    const physics::time::Interval& anInterval,
+    const Duration& aStep
+)
+{
+    if (!aHalfAngle.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Half angle");
+    }
+
+    const double halfAngle_deg = aHalfAngle.inDegrees();
+
+    if ((halfAngle_deg <= 0.0) || (halfAngle_deg > 180.0))
+    {
+        throw ostk::core::error::runtime::Wrong("Half angle");
+    }
+
+    return {
+        Shape::Cone,
+        aProfile,
+        aSensorAttitude,
+        std::cos(aHalfAngle.inRadians()),
+        0.0,
+        0.0,
+        anInterval,
+        aStep,
+    };
+}
+
+SensorFilter SensorFilter::Rectangle(
+    const Profile& aProfile,
+    const Quaternion& aSensorAttitude,
+    const Angle& aHorizontalHalfAngle,
+    const Angle& aVerticalHalfAngle,
+    const physics::time::Interval& anInterval,
+    const Duration& aStep
+)
+{
+    for (const Angle& halfAngle : {aHorizontalHalfAngle, aVerticalHalfAngle})
+    {
+        if (!halfAngle.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Half angle");
+        }
+
+        if ((halfAngle.inDegrees() <= 0.0) || (halfAngle.inDegrees() >= 90.0))
+        {
+            throw ostk::core::error::runtime::Wrong("Half angle");
+        }
+    }
+
+    return {
+        Shape::Rectangle,
+        aProfile,
+        aSensorAttitude,
+        0.0,
+        std::tan(aHorizontalHalfAngle.inRadians()),
+        std::tan(aVerticalHalfAngle.inRadians()),
+        anInterval,
+        aStep,
+    };
+}
+
+SensorFilter::SensorFilter(
+    const Shape& aShape,
+    const Profile& aProfile,
+    const Quaternion& aSensorAttitude,
+    const double& aCosineHalfAngle,
+    const double& aTangentHorizontalHalfAngle,
+    const double& aTangentVerticalHalfAngle,
+    const physics::time::Interval& anInterval,
+    const Duration& aStep
+)
+    : shape_(aShape),
+      profile_(aProfile),
+      q_S_B_(aSensorAttitude),
+      cosineHalfAngle_(aCosineHalfAngle),
+      tangentHorizontalHalfAngle_(aTangentHorizontalHalfAngle),
+      tangentVerticalHalfAngle_(aTangentVerticalHalfAngle),
+      interval_(anInterval),
+      step_(aStep),
+      nodeAttitudes_(Array<Quaternion>::Empty())
+{
+    if (shape_ == Shape::Undefined)
+    {
+        return;
+    }
+
+    if (!profile_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Profile");
+    }
+
+    if (!q_S_B_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Sensor attitude");
+    }
+
+    if (!interval_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    if ((!step_.isDefined()) || (!step_.isStrictlyPositive()))
+    {
+        throw ostk::core::error::runtime::Wrong("Step");
+    }
+
+    q_S_B_ = q_S_B_.toNormalized();
+
+    // At least one step, the last node lying at or after the end of the interval. Profile states are queried at once,
+    // for the profile model to share its computations across nodes.
+
+    const Size stepCount = std::max<Size>(
+        1, static_cast<Size>(std::ceil(interval_.getDuration().inSeconds() / step_.inSeconds()))
+    );
+
+    Array<Instant> nodeInstants = Array<Instant>::Empty();
+    nodeInstants.reserve(stepCount + 1);
+
+    for (Index nodeIndex = 0; nodeIndex <= stepCount; ++nodeIndex)
+    {
+        nodeInstants.add(interval_.accessStart() + step_ * double(nodeIndex));
+    }
+
+    const Array<State> nodeStates = profile_.getStatesAt(nodeInstants);
+
+    nodeAttitudes_.reserve(nodeStates.getSize());
+
+    for (const State& nodeState : nodeStates)
+    {
+        Quaternion q_S_GCRF = SensorFilter::ComputeSensorAttitude(q_S_B_, nodeState);
+
+        // Consecutive attitudes are brought to the same hemisphere, for the interpolation to follow the shortest arc
+
+        if (!nodeAttitudes_.isEmpty())
+        {
+            const Quaternion& q_previous = nodeAttitudes_.accessLast();
+
+            if ((q_previous.x() * q_S_GCRF.x() + q_previous.y() * q_S_GCRF.y() + q_previous.z() * q_S_GCRF.z() +
+                 q_previous.s() * q_S_GCRF.s()) < 0.0)
+            {
+                q_S_GCRF = Quaternion(
+                    -q_S_GCRF.x(), -q_S_GCRF.y(), -q_S_GCRF.z(), -q_S_GCRF.s(), Quaternion::Format::XYZS
+                );
+            }
+        }
+
+        nodeAttitudes_.add(q_S_GCRF);
+    }
+}
+
+Quaternion SensorFilter::computeAttitudeAt(const Instant& anInstant) const
+{
+    return SensorFilter::ComputeSensorAttitude(q_S_B_, profile_.getStateAt(anInstant));
+}
+
+Quaternion SensorFilter::ComputeSensorAttitude(const Quaternion& aSensorAttitude, const State& aProfileState)
+{
+    static const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+
+    if (aProfileState.accessFrame() != gcrfSPtr)
+    {
+        throw ostk::core::error::RuntimeError("Sensor filter requires a profile expressed in GCRF.");
+    }
+
+    return (aSensorAttitude * aProfileState.getAttitude()).toNormalized();
+}
+
+}  // namespace access
+}  // namespace astrodynamics
+}  // namespace ostk
@@ -0,0 +1,473 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <numeric>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Velocity.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Conjunction/AvoidanceManeuverSolver.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/ExecutionContext.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateBroker.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianPosition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianVelocity.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace conjunction
+{
+
+using ostk::core::type::Index;
+using ostk::core::type::Pair;
+using ostk::core::type::Shared;
+
+using ostk::mathematics::object::Matrix3d;
+using ostk::mathematics::object::MatrixXd;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Velocity;
+
+using ostk::astrodynamics::ExecutionContext;
+using ostk::astrodynamics::trajectory::State;
+using ostk::astrodynamics::trajectory::state::CoordinateBroker;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianPosition;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianVelocity;
+
+namespace
+{
+
+// Nominal state of the maneuvering object at a burn instant, with the sensitivities of its TCA position and velocity
+// to a velocity increment at the burn
+
+struct Burn
+{
+    State state;
+    Matrix3d rotation_GCRF_RTN;
+    Matrix3d positionSensitivity;
+    Matrix3d velocitySensitivity;
+};
+
+Matrix3d GetRotation_GCRF_RTN(const Vector3d& aPosition, const Vector3d& aVelocity)
+{
+    const Vector3d rAxis = aPosition.normalized();
+    const Vector3d nAxis = aPosition.cross(aVelocity).normalized();
+    const Vector3d tAxis = nAxis.cross(rAxis);
+
+    Matrix3d rotation_GCRF_RTN;
+    rotation_GCRF_RTN.col(0) = rAxis;
+    rotation_GCRF_RTN.col(1) = tAxis;
+    rotation_GCRF_RTN.col(2) = nAxis;
+
+    return rotation_GCRF_RTN;
+}
+
+// Miss distance in the encounter plane (normal to the relative velocity), insensitive to small TCA shifts
+
+double ComputeEncounterMissDistance(
+    const Vector3d& aFirstPosition,
+    const Vector3d& aFirstVelocity,
+    const Vector3d& aSecondPosition,
+    const Vector3d& aSecondVelocity
+)
+{
+    const Vector3d relativePosition = aSecondPosition - aFirstPosition;
+    const Vector3d relativeVelocity = aSecondVelocity - aFirstVelocity;
+
+    const double relativeSpeed = relativeVelocity.norm();
+
+    if (relativeSpeed == 0.0)
+    {
+        return relativePosition.norm();
+    }
+
+    const Vector3d yAxis = relativeVelocity / relativeSpeed;
+
+    return (relativePosition - relativePosition.dot(yAxis) * yAxis).norm();
+}
+
+bool IsRankedBefore(
+    const AvoidanceManeuverSolver::Candidate& aCandidate,
+    const AvoidanceManeuverSolver::Candidate& anotherCandidate,
+    const double& aCollisionProbabilityThreshold
+)
+{
+    const bool isAcceptable = aCandidate.collisionProbability <= aCollisionProbabilityThreshold;
+    const bool isOtherAcceptable = anotherCandidate.collisionProbability <= aCollisionProbabilityThreshold;
+
+    if (isAcceptable != isOtherAcceptable)
+    {
+        return isAcceptable;
+    }
+
+    if (isAcceptable && (aCandidate.deltaVMagnitude != anotherCandidate.deltaVMagnitude))
+    {
+        return aCandidate.deltaVMagnitude < anotherCandidate.deltaVMagnitude;
+    }
+
+    if (aCandidate.collisionProbability != anotherCandidate.collisionProbability)
+    {
+        return aCandidate.collisionProbability < anotherCandidate.collisionProbability;
+    }
+
+    return aCandidate.deltaVMagnitude < anotherCandidate.deltaVMagnitude;
+}
+
+}  // namespace
+
+AvoidanceManeuverSolver::AvoidanceManeuverSolver(
+    const Propagator& aPropagator,
+    const Length& aHardBodyRadius,
+    const Real& aCollisionProbabilityThreshold,
+    const Size& aRefinementCount,
+    const Size& aThreadCount
+)
+    : propagator_(aPropagator),
+      hardBodyRadius_(aHardBodyRadius),
+      collisionProbabilityThreshold_(aCollisionProbabilityThreshold),
+      refinementCount_(aRefinementCount),
+      threadCount_(aThreadCount)
+{
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const AvoidanceManeuverSolver& anAvoidanceManeuverSolver)
+{
+    anAvoidanceManeuverSolver.print(anOutputStream);
+
+    return anOutputStream;
+}
+
+bool AvoidanceManeuverSolver::isDefined() const
+{
+    return propagator_.isDefined() && hardBodyRadius_.isDefined() && collisionProbabilityThreshold_.isDefined();
+}
+
+Propagator AvoidanceManeuverSolver::getPropagator() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Avoidance maneuver solver");
+    }
+
+    return propagator_;
+}
+
+Length AvoidanceManeuverSolver::getHardBodyRadius() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Avoidance maneuver solver");
+    }
+
+    return hardBodyRadius_;
+}
+
+Real AvoidanceManeuverSolver::getCollisionProbabilityThreshold() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Avoidance maneuver solver");
+    }
+
+    return collisionProbabilityThreshold_;
+}
+
+Size AvoidanceManeuverSolver::getRefinementCount() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Avoidance maneuver solver");
+    }
+
+    return refinementCount_;
+}
+
+Size AvoidanceManeuverSolver::getThreadCount() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Avoidance maneuver solver");
+    }
+
+    return threadCount_;
+}
+
+Array<AvoidanceManeuverSolver::Candidate> AvoidanceManeuverSolver::solve(
+    const CDM& aCDM,
+    const Array<Duration>& aLeadTimeArray,
+    const Array<Vector3d>& aDirectionArray_RTN,
+    const Array<Real>& aDeltaVMagnitudeArray
+) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Avoidance maneuver solver");
+    }
+
+    if (!aCDM.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("CDM");
+    }
+
+    for (const Duration& leadTime : aLeadTimeArray)
+    {
+        if ((!leadTime.isDefined()) || (!leadTime.isStrictlyPositive()))
+        {
+            throw ostk::core::error::runtime::Wrong("Lead time");
+        }
+    }
+
+    for (const Vector3d& direction_RTN : aDirectionArray_RTN)
+    {
+        if (direction_RTN.norm() == 0.0)
+        {
+            throw ostk::core::error::runtime::Wrong("Direction");
+        }
+    }
+
+    for (const Real& deltaVMagnitude : aDeltaVMagnitudeArray)
+    {
+        if ((!deltaVMagnitude.isDefined()) || (deltaVMagnitude < 0.0))
+        {
+            throw ostk::core::error::runtime::Wrong("Delta-V magnitude");
+        }
+    }
+
+    const Size leadTimeCount = aLeadTimeArray.getSize();
+    const Size directionCount = aDirectionArray_RTN.getSize();
+    const Size magnitudeCount = aDeltaVMagnitudeArray.getSize();
+
+    const Size candidateCount = leadTimeCount * directionCount * magnitudeCount;
+
+    if (candidateCount == 0)
+    {
+        return Array<AvoidanceManeuverSolver::Candidate>::Empty();
+    }
+
+    const Instant tca = aCDM.getTCA();
+
+    const CDM::Data maneuveringObjectData = aCDM.getObjectDataAt(0);
+    const CDM::Data otherObjectData = aCDM.getObjectDataAt(1);
+
+    const State maneuveringState_GCRF = maneuveringObjectData.state.inFrame(Frame::GCRF());
+    const State otherState_GCRF = otherObjectData.state.inFrame(Frame::GCRF());
+
+    const Vector3d nominalPosition = maneuveringState_GCRF.getPosition().getCoordinates();
+    const Vector3d nominalVelocity = maneuveringState_GCRF.getVelocity().getCoordinates();
+    const Vector3d otherPosition = otherState_GCRF.getPosition().getCoordinates();
+    const Vector3d otherVelocity = otherState_GCRF.getVelocity().getCoordinates();
+
+    // Nominal trajectory and state transition matrices, in a single backward pass from TCA through the burn instants
+
+    Array<Index> leadTimeOrder(leadTimeCount, 0);
+    std::iota(leadTimeOrder.begin(), leadTimeOrder.end(), 0);
+    std::sort(
+        leadTimeOrder.begin(),
+        leadTimeOrder.end(),
+        [&aLeadTimeArray](const Index& anIndex, const Index& anotherIndex) -> bool
+        {
+            return aLeadTimeArray[anIndex] > aLeadTimeArray[anotherIndex];
+        }
+    );
+
+    Array<Instant> burnInstants = Array<Instant>::Empty();
+    burnInstants.reserve(leadTimeCount);
+
+    for (const Index& leadTimeIndex : leadTimeOrder)
+    {
+        burnInstants.add(tca - aLeadTimeArray[leadTimeIndex]);
+    }
+
+    const State nominalState = {
+        tca,
+        Position::Meters(nominalPosition, Frame::GCRF()),
+        Velocity::MetersPerSecond(nominalVelocity, Frame::GCRF()),
+    };
+
+    const Array<Pair<State, MatrixXd>> statesAndStateTransitionMatrices =
+        propagator_.calculateStatesAndStateTransitionMatricesAt(nominalState, burnInstants);
+
+    const Shared<CoordinateBroker>& coordinateBrokerSPtr = propagator_.accessCoordinateBroker();
+
+    const Index positionIndex = coordinateBrokerSPtr->getSubsetIndex(CartesianPosition::Default());
+    const Index velocityIndex = coordinateBrokerSPtr->getSubsetIndex(CartesianVelocity::Default());
+
+    Array<Burn> burns(leadTimeCount, {State::Undefined(), Matrix3d::Zero(), Matrix3d::Zero(), Matrix3d::Zero()});
+
+    for (Index k = 0; k < leadTimeCount; ++k)
+    {
+        const State& burnState = statesAndStateTransitionMatrices[k].first;
+
+        // Maps burn deviations onto TCA deviations (the propagated matrix maps TCA deviations onto the burn)
+
+        const MatrixXd stateTransitionMatrix = statesAndStateTransitionMatrices[k].second.inverse();
+
+        burns[leadTimeOrder[k]] = {
+            burnState,
+            GetRotation_GCRF_RTN(burnState.getPosition().getCoordinates(), burnState.getVelocity().getCoordinates()),
+            stateTransitionMatrix.block<3, 3>(positionIndex, velocityIndex),
+            stateTransitionMatrix.block<3, 3>(velocityIndex, velocityIndex),
+        };
+    }
+
+    const auto getDeltaV_GCRF = [&](const Index& aCandidateIndex) -> Vector3d
+    {
+        const Index leadTimeIndex = aCandidateIndex / (directionCount * magnitudeCount);
+        const Index directionIndex = (aCandidateIndex / magnitudeCount) % directionCount;
+        const Index magnitudeIndex = aCandidateIndex % magnitudeCount;
+
+        return burns[leadTimeIndex].rotation_GCRF_RTN * aDirectionArray_RTN[directionIndex].normalized() *
+               aDeltaVMagnitudeArray[magnitudeIndex];
+    };
+
+    const auto evaluate = [&](const Index& aCandidateIndex,
+                              const Vector3d& aPosition,
+                              const Vector3d& aVelocity,
+                              const bool& isRefined) -> AvoidanceManeuverSolver::Candidate
+    {
+        const Index leadTimeIndex = aCandidateIndex / (directionCount * magnitudeCount);
+        const Index directionIndex = (aCandidateIndex / magnitudeCount) % directionCount;
+        const Index magnitudeIndex = aCandidateIndex % magnitudeCount;
+
+        CDM::Data maneuveredObjectData = maneuveringObjectData;
+        maneuveredObjectData.state = {
+            tca,
+            Position::Meters(aPosition, Frame::GCRF()),
+            Velocity::MetersPerSecond(aVelocity, Frame::GCRF()),
+        };
+
+        return {
+            aLeadTimeArray[leadTimeIndex],
+            burns[leadTimeIndex].state.accessInstant(),
+            aDirectionArray_RTN[directionIndex].normalized(),
+            aDeltaVMagnitudeArray[magnitudeIndex],
+            Length::Meters(ComputeEncounterMissDistance(aPosition, aVelocity, otherPosition, otherVelocity)),
+            CDM::ComputeCollisionProbability(maneuveredObjectData, otherObjectData, hardBodyRadius_),
+            isRefined,
+        };
+    };
+
+    const ExecutionContext executionContext = {threadCount_};
+
+    // Linearized screening of all the candidates
+
+    const Array<AvoidanceManeuverSolver::Candidate> linearizedCandidates =
+        executionContext.map<AvoidanceManeuverSolver::Candidate>(
+            candidateCount,
+            [&](const Index& anIndex) -> AvoidanceManeuverSolver::Candidate
+            {
+                const Burn& burn = burns[anIndex / (directionCount * magnitudeCount)];
+                const Vector3d deltaV_GCRF = getDeltaV_GCRF(anIndex);
+
+                return evaluate(
+                    anIndex,
+                    nominalPosition + burn.positionSensitivity * deltaV_GCRF,
+                    nominalVelocity + burn.velocitySensitivity * deltaV_GCRF,
+                    false
+                );
+            }
+        );
+
+    const double collisionProbabilityThreshold = collisionProbabilityThreshold_;
+
+    const auto isRankedBefore = [&](const Index& anIndex, const Index& anotherIndex) -> bool
+    {
+        return IsRankedBefore(
+            linearizedCandidates[anIndex], linearizedCandidates[anotherIndex], collisionProbabilityThreshold
+        );
+    };
+
+    Array<Index> candidateOrder(candidateCount, 0);
+    std::iota(candidateOrder.begin(), candidateOrder.end(), 0);
+    std::stable_sort(candidateOrder.begin(), candidateOrder.end(), isRankedBefore);
+
+    // Refinement of the best candidates, by full propagation of the maneuvered states to TCA
+
+    const Size refinedCount = std::min<Size>(refinementCount_, candidateCount);
+
+    Array<State> maneuveredStates = Array<State>::Empty();
+    maneuveredStates.reserve(refinedCount);
+
+    for (Index k = 0; k < refinedCount; ++k)
+    {
+        const Index candidateIndex = candidateOrder[k];
+        const State& burnState = burns[candidateIndex / (directionCount * magnitudeCount)].state;
+
+        maneuveredStates.add({
+            burnState.accessInstant(),
+            burnState.getPosition(),
+            Velocity::MetersPerSecond(
+                burnState.getVelocity().getCoordinates() + getDeltaV_GCRF(candidateIndex), Frame::GCRF()
+            ),
+        });
+    }
+
+    const Array<State> refinedStates = propagator_.calculateStatesAt(maneuveredStates, tca, executionContext);
+
+    Array<AvoidanceManeuverSolver::Candidate> candidates = Array<AvoidanceManeuverSolver::Candidate>::Empty();
+    candidates.reserve(candidateCount);
+
+    for (Index k = 0; k < refinedCount; ++k)
+    {
+        const State refinedState_GCRF = refinedStates[k].inFrame(Frame::GCRF());
+
+        candidates.add(evaluate(
+            candidateOrder[k],
+            refinedState_GCRF.getPosition().getCoordinates(),
+            refinedState_GCRF.getVelocity().getCoordinates(),
+            true
+        ));
+    }
+
+    std::stable_sort(
+        candidates.begin(),
+        candidates.end(),
+        [collisionProbabilityThreshold](
+            const AvoidanceManeuverSolver::Candidate& aCandidate,
+            const AvoidanceManeuverSolver::Candidate& anotherCandidate
+        ) -> bool
+        {
+            return IsRankedBefore(aCandidate, anotherCandidate, collisionProbabilityThreshold);
+        }
+    );
+
+    for (Index k = refinedCount; k < candidateCount; ++k)
+    {
+        candidates.add(linearizedCandidates[candidateOrder[k]]);
+    }
+
+    return candidates;
+}
+
+void AvoidanceManeuverSolver::print(std::ostream& anOutputStream, bool displayDecorator) const
+{
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Avoidance Maneuver Solver") : void();
+
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Hard Body Radius:" << (hardBodyRadius_.isDefined() ? hardBodyRadius_.toString() : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Collision Probability Threshold:"
+        << (collisionProbabilityThreshold_.isDefined() ? collisionProbabilityThreshold_.toString() : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream) << "Refinement Count:" << refinementCount_;
+    ostk::core::utils::Print::Line(anOutputStream) << "Thread Count:" << threadCount_;
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+AvoidanceManeuverSolver AvoidanceManeuverSolver::Undefined()
+{
+    return {Propagator::Undefined(), Length::Undefined(), Real::Undefined()};
+}
+
+}  // namespace conjunction
+}  // namespace astrodynamics
+}  // namespace ostk
@@ -1,19 +1,1054 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Conjunction/Message/CCSDS/CDM.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/ExecutionContext.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace conjunction
+{
+namespace message
+{
+namespace ccsds
+{
+
+namespace
+{
+
+using ostk::mathematics::object::Matrix3d;
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Scale;
+
+// SpaceTrack CDM fields, read directly into a fixed table of values
+
+const Array<String> CommonFieldNames = {
+    "CCSDS_CDM_VERS",
+    "CREATION_DATE",
+    "ORIGINATOR",
+    "MESSAGE_FOR",
+    "CDM_ID",
+    "TCA",
+    "MISS_DISTANCE",
+    "COLLISION_PROBABILITY",
+    "COLLISION_PROBABILITY_METHOD",
+};
+
+const Array<String> ObjectFieldNames = {
+    "OBJECT",
+    "OBJECT_DESIGNATOR",
+    "CATALOG_NAME",
+    "OBJECT_NAME",
+    "INTERNATIONAL_DESIGNATOR",
+    "EPHEMERIS_NAME",
+    "COVARIANCE_METHOD",
+    "MANEUVERABLE",
+    "REF_FRAME",
+    "X",
+    "Y",
+    "Z",
+    "X_DOT",
+    "Y_DOT",
+    "Z_DOT",
+    "CR_R",
+    "CT_R",
+    "CT_T",
+    "CN_R",
+    "CN_T",
+    "CN_N",
+    "CRDOT_R",
+    "CRDOT_T",
+    "CRDOT_N",
+    "CRDOT_RDOT",
+    "CTDOT_R",
+    "CTDOT_T",
+    "CTDOT_N",
+    "CTDOT_RDOT",
+    "CTDOT_TDOT",
+    "CNDOT_R",
+    "CNDOT_T",
+    "CNDOT_N",
+    "CNDOT_RDOT",
+    "CNDOT_TDOT",
+    "CNDOT_NDOT",
+};
+
+struct CommonField
+{
+    enum : Index
+    {
+        CCSDSCDMVersion,
+        CreationDate,
+        Originator,
+        MessageFor,
+        CDMId,
+        TCA,
+        MissDistance,
+        CollisionProbability,
+        CollisionProbabilityMethod
+    };
+};
+
+struct ObjectField
+{
+    enum : Index
+    {
+        Object,
+        ObjectDesignator,
+        CatalogName,
+        ObjectName,
+        InternationalDesignator,
+        EphemerisName,
+        CovarianceMethod,
+        Maneuverable,
+        ReferenceFrame,
+        X,
+        Y,
+        Z,
+        XDot,
+        YDot,
+        ZDot,
+        CovarianceFirst  // Lower triangle of the position / velocity covariance, row by row
+    };
+};
+
+constexpr Index ObjectCount = 2;
+constexpr Index CommonFieldCount = 9;
+constexpr Index ObjectFieldCount = 36;
+constexpr Index FieldCount = CommonFieldCount + ObjectCount * ObjectFieldCount;
+
+// Missing and null fields are left empty (with a null data pointer)
+
+using FieldValues = std::array<std::string_view, FieldCount>;
+
+const Array<String>& FieldNames()
+{
+    static const Array<String> fieldNames = []() -> Array<String>
+    {
+        Array<String> names = CommonFieldNames;
+
+        for (Index objectIndex = 0; objectIndex < ObjectCount; ++objectIndex)
+        {
+            for (const String& objectFieldName : ObjectFieldNames)
+            {
+                names.add(String::Format("SAT{}_{}", objectIndex + 1, objectFieldName));
+            }
+        }
+
+        return names;
+    }();
+
+    return fieldNames;
+}
+
+const std::unordered_map<std::string_view, Index>& FieldIndices()
+{
+    static const std::unordered_map<std::string_view, Index> fieldIndices = []()
+    {
+        std::unordered_map<std::string_view, Index> indices;
+
+        for (Index fieldIndex = 0; fieldIndex < FieldCount; ++fieldIndex)
+        {
+            indices.emplace(std::string_view(FieldNames()[fieldIndex]), fieldIndex);
+        }
+
+        return indices;
+    }();
+
+    return fieldIndices;
+}
+
+// KVN keys are not prefixed: object keys follow an OBJECT line, and the message identifier is MESSAGE_ID
+
+const std::unordered_map<std::string_view, Index>& KVNCommonFieldIndices()
+{
+    static const std::unordered_map<std::string_view, Index> fieldIndices = []()
+    {
+        std::unordered_map<std::string_view, Index> indices;
+
+        for (Index fieldIndex = 0; fieldIndex < CommonFieldCount; ++fieldIndex)
+        {
+            if (fieldIndex != CommonField::CDMId)
+            {
+                indices.emplace(std::string_view(CommonFieldNames[fieldIndex]), fieldIndex);
+            }
+        }
+
+        indices.emplace("MESSAGE_ID", CommonField::CDMId);
+
+        return indices;
+    }();
+
+    return fieldIndices;
+}
+
+const std::unordered_map<std::string_view, Index>& KVNObjectFieldIndices()
+{
+    static const std::unordered_map<std::string_view, Index> fieldIndices = []()
+    {
+        std::unordered_map<std::string_view, Index> indices;
+
+        for (Index fieldIndex = 0; fieldIndex < ObjectFieldCount; ++fieldIndex)
+        {
+            indices.emplace(std::string_view(ObjectFieldNames[fieldIndex]), fieldIndex);
+        }
+
+        return indices;
+    }();
+
+    return fieldIndices;
+}
+
+String ReadFile(const File& aFile)
+{
+    if (!aFile.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("File");
+    }
+
+    if (!aFile.exists())
+    {
+        throw ostk::core::error::RuntimeError("File [{}] does not exist.", aFile.toString());
+    }
+
+    std::ifstream fileStream(aFile.getPath().toString(), std::ios::binary);
+
+    if (!fileStream.is_open())
+    {
+        throw ostk::core::error::RuntimeError("Cannot open file [{}].", aFile.toString());
+    }
+
+    fileStream.seekg(0, std::ios::end);
+
+    String contents;
+    contents.resize(static_cast<std::size_t>(fileStream.tellg()));
+
+    fileStream.seekg(0, std::ios::beg);
+    fileStream.read(&contents[0], contents.size());
+
+    return contents;
+}
+
+// JSON scanning, over flat objects of scalar values
+
+std::size_t SkipWhitespace(const std::string_view& aString, std::size_t aPosition)
+{
+    while ((aPosition < aString.size()) &&
+           ((aString[aPosition] == ' ') || (aString[aPosition] == '\n') || (aString[aPosition] == '\r') ||
+            (aString[aPosition] == '\t')))
+    {
+        ++aPosition;
+    }
+
+    return aPosition;
+}
+
+std::size_t SkipString(const std::string_view& aString, std::size_t aPosition)
+{
+    for (++aPosition; aPosition < aString.size(); ++aPosition)
+    {
+        if (aString[aPosition] == '\\')
+        {
+            ++aPosition;
+        }
+        else if (aString[aPosition] == '"')
+        {
+            return aPosition + 1;
+        }
+    }
+
+    throw ostk::core::error::runtime::Wrong("CDM string");
+}
+
+std::size_t SkipObject(const std::string_view& aString, std::size_t aPosition)
+{
+    Size depth = 0;
+
+    while (aPosition < aString.size())
+    {
+        const char character = aString[aPosition];
+
+        if (character == '"')
+        {
+            aPosition = SkipString(aString, aPosition);
+            continue;
+        }
+
+        if ((character == '{') || (character == '['))
+        {
+            ++depth;
+        }
+        else if ((character == '}') || (character == ']'))
+        {
+            if (--depth == 0)
+            {
+                return aPosition + 1;
+            }
+        }
+
+        ++aPosition;
+    }
+
+    throw ostk::core::error::runtime::Wrong("CDM object");
+}
+
+std::string_view ReadString(
+    const std::string_view& aString, std::size_t& aPosition, std::deque<std::string>& anUnescapedValues
+)
+{
+    const std::size_t end = SkipString(aString, aPosition);
+    const std::string_view value = aString.substr(aPosition + 1, end - aPosition - 2);
+
+    aPosition = end;
+
+    if (value.find('\\') == std::string_view::npos)
+    {
+        return value;
+    }
+
+    std::string unescapedValue;
+    unescapedValue.reserve(value.size());
+
+    for (std::size_t idx = 0; idx < value.size(); ++idx)
+    {
+        if ((value[idx] != '\\') || ((idx + 1) == value.size()))
+        {
+            unescapedValue.push_back(value[idx]);
+            continue;
+        }
+
+        const char escapedCharacter = value[++idx];
+
+        switch (escapedCharacter)
+        {
+            case 'n':
+                unescapedValue.push_back('\n');
+                break;
+
+            case 't':
+                unescapedValue.push_back('\t');
+                break;
+
+            case 'r':
+                unescapedValue.push_back('\r');
+                break;
+
+            case 'b':
+                unescapedValue.push_back('\b');
+                break;
+
+            case 'f':
+                unescapedValue.push_back('\f');
+                break;
+
+            case 'u':  // Kept verbatim, CDM fields are ASCII
+                unescapedValue.append("\\u");
+                break;
+
+            default:
+                unescapedValue.push_back(escapedCharacter);
+                break;
+        }
+    }
+
+    anUnescapedValues.push_back(std::move(unescapedValue));
+
+    return anUnescapedValues.back();
+}
+
+FieldValues ReadFieldValues(const std::string_view& aRecord, std::deque<std::string>& anUnescapedValues)
+{
+    FieldValues fieldValues;
+
+    std::size_t position = SkipWhitespace(aRecord, 1);
+
+    while ((position < aRecord.size()) && (aRecord[position] != '}'))
+    {
+        if (aRecord[position] != '"')
+        {
+            throw ostk::core::error::runtime::Wrong("CDM field");
+        }
+
+        const std::size_t keyEnd = SkipString(aRecord, position);
+        const std::string_view key = aRecord.substr(position + 1, keyEnd - position - 2);
+
+        position = SkipWhitespace(aRecord, keyEnd);
+
+        if ((position >= aRecord.size()) || (aRecord[position] != ':'))
+        {
+            throw ostk::core::error::runtime::Wrong("CDM field", String(std::string(key)));
+        }
+
+        position = SkipWhitespace(aRecord, position + 1);
+
+        if (position >= aRecord.size())
+        {
+            throw ostk::core::error::runtime::Wrong("CDM field", String(std::string(key)));
+        }
+
+        std::string_view value;
+
+        if (aRecord[position] == '"')
+        {
+            value = ReadString(aRecord, position, anUnescapedValues);
+        }
+        else if ((aRecord[position] == '{') || (aRecord[position] == '['))
+        {
+            position = SkipObject(aRecord, position);  // Nested values are not CDM fields
+        }
+        else
+        {
+            // Literal: number, boolean or null
+
+            const std::size_t valueStart = position;
+
+            while ((position < aRecord.size()) && (aRecord[position] != ',') && (aRecord[position] != '}') &&
+                   (aRecord[position] != ' ') && (aRecord[position] != '\n') && (aRecord[position] != '\r') &&
+                   (aRecord[position] != '\t'))
+            {
+                ++position;
+            }
+
+            value = aRecord.substr(valueStart, position - valueStart);
+
+            if (value == "null")
+            {
+                value = std::string_view();
+            }
+        }
+
+        const auto fieldIndexIt = FieldIndices().find(key);
+
+        if (fieldIndexIt != FieldIndices().end())
+        {
+            fieldValues[fieldIndexIt->second] = value;
+        }
+
+        position = SkipWhitespace(aRecord, position);
+
+        if ((position < aRecord.size()) && (aRecord[position] == ','))
+        {
+            position = SkipWhitespace(aRecord, position + 1);
+        }
+    }
+
+    return fieldValues;
+}
+
+// KVN scanning, one KEY = value [unit] line at a time
+
+std::string_view Trim(const std::string_view& aString)
+{
+    const std::size_t start = aString.find_first_not_of(" \t\r");
+
+    if (start == std::string_view::npos)
+    {
+        return aString.substr(0, 0);
+    }
+
+    const std::size_t end = aString.find_last_not_of(" \t\r");
+
+    return aString.substr(start, end - start + 1);
+}
+
+FieldValues ReadKVNFieldValues(const std::string_view& aString)
+{
+    FieldValues fieldValues;
+
+    Index objectIndex = ObjectCount;  // Header and relative metadata, until the first OBJECT line
+
+    for (std::size_t lineStart = 0; lineStart < aString.size();)
+    {
+        std::size_t lineEnd = aString.find('\n', lineStart);
+
+        if (lineEnd == std::string_view::npos)
+        {
+            lineEnd = aString.size();
+        }
+
+        const std::string_view line = Trim(aString.substr(lineStart, lineEnd - lineStart));
+
+        lineStart = lineEnd + 1;
+
+        if (line.empty() || (line.substr(0, 7) == "COMMENT"))
+        {
+            continue;
+        }
+
+        const std::size_t separatorPosition = line.find('=');
+
+        if (separatorPosition == std::string_view::npos)
+        {
+            throw ostk::core::error::runtime::Wrong("CDM line", String(std::string(line)));
+        }
+
+        const std::string_view key = Trim(line.substr(0, separatorPosition));
+        std::string_view value = Trim(line.substr(separatorPosition + 1));
+
+        // Drop the unit
+
+        if ((!value.empty()) && (value.back() == ']'))
+        {
+            const std::size_t unitStart = value.rfind('[');
+
+            if (unitStart != std::string_view::npos)
+            {
+                value = Trim(value.substr(0, unitStart));
+            }
+        }
+
+        if (key == "OBJECT")
+        {
+            if (value == "OBJECT1")
+            {
+                objectIndex = 0;
+            }
+            else if (value == "OBJECT2")
+            {
+                objectIndex = 1;
+            }
+            else
+            {
+                throw ostk::core::error::runtime::Wrong("CDM object", String(std::string(value)));
+            }
+        }
+
+        if (objectIndex == ObjectCount)
+        {
+            const auto fieldIndexIt = KVNCommonFieldIndices().find(key);
+
+            if (fieldIndexIt != KVNCommonFieldIndices().end())
+            {
+                fieldValues[fieldIndexIt->second] = value;
+            }
+        }
+        else
+        {
+            const auto fieldIndexIt = KVNObjectFieldIndices().find(key);
+
+            if (fieldIndexIt != KVNObjectFieldIndices().end())
+            {
+                fieldValues[CommonFieldCount + objectIndex * ObjectFieldCount + fieldIndexIt->second] = value;
+            }
+        }
+    }
+
+    return fieldValues;
+}
+
+// Field conversions
+
+std::string_view AccessField(const FieldValues& aFieldValues, const Index& aFieldIndex)
+{
+    const std::string_view value = aFieldValues[aFieldIndex];
+
+    if (value.data() == nullptr)
+    {
+        throw ostk::core::error::runtime::Undefined(FieldNames()[aFieldIndex]);
+    }
+
+    return value;
+}
+
+String GetString(const FieldValues& aFieldValues, const Index& aFieldIndex)
+{
+    return String(std::string(AccessField(aFieldValues, aFieldIndex)));
+}
+
+Real GetReal(const FieldValues& aFieldValues, const Index& aFieldIndex)
+{
+    const std::string_view value = AccessField(aFieldValues, aFieldIndex);
+
+    char buffer[64];
+
+    if ((value.empty()) || (value.size() >= sizeof(buffer)))
+    {
+        throw ostk::core::error::runtime::Wrong(FieldNames()[aFieldIndex], String(std::string(value)));
+    }
+
+    std::memcpy(buffer, value.data(), value.size());
+    buffer[value.size()] = '\0';
+
+    char* end = nullptr;
+    const double real = std::strtod(buffer, &end);
+
+    if (end != (buffer + value.size()))
+    {
+        throw ostk::core::error::runtime::Wrong(FieldNames()[aFieldIndex], String(std::string(value)));
+    }
+
+    return real;
+}
+
+Integer GetInteger(const FieldValues& aFieldValues, const Index& aFieldIndex)
+{
+    const std::string_view value = AccessField(aFieldValues, aFieldIndex);
+
+    Integer::ValueType integer = 0;
+
+    const auto [end, errorCode] = std::from_chars(value.data(), value.data() + value.size(), integer);
+
+    if ((value.empty()) || (errorCode != std::errc()) || (end != (value.data() + value.size())))
+    {
+        throw ostk::core::error::runtime::Wrong(FieldNames()[aFieldIndex], String(std::string(value)));
+    }
+
+    return integer;
+}
+
+// Fast path for the fixed ISO 8601 layout used by SpaceTrack (YYYY-MM-DDTHH:MM:SS[.ffffff])
+
+Instant GetInstant(const FieldValues& aFieldValues, const Index& aFieldIndex)
+{
+    const std::string_view value = AccessField(aFieldValues, aFieldIndex);
+
+    const auto readDigits = [&value](const std::size_t& aStart, const std::size_t& aCount, int& aResult) -> bool
+    {
+        aResult = 0;
+
+        for (std::size_t idx = aStart; idx < (aStart + aCount); ++idx)
+        {
+            if ((value[idx] < '0') || (value[idx] > '9'))
+            {
+                return false;
+            }
+
+            aResult = aResult * 10 + (value[idx] - '0');
+        }
+
+        return true;
+    };
+
+    int year = 0, month = 0, day = 0, hour = 0, minute = 0, second = 0;
+
+    bool isFixedLayout = (value.size() >= 19) && (value[4] == '-') && (value[7] == '-') && (value[10] == 'T') &&
+                         (value[13] == ':') && (value[16] == ':') && readDigits(0, 4, year) &&
+                         readDigits(5, 2, month) && readDigits(8, 2, day) && readDigits(11, 2, hour) &&
+                         readDigits(14, 2, minute) && readDigits(17, 2, second);
+
+    int fraction = 0;
+    std::size_t fractionDigitCount = 0;
+
+    if (isFixedLayout && (value.size() > 19))
+    {
+        fractionDigitCount = value.size() - 20;
+
+        if ((value[19] != '.') || (fractionDigitCount == 0) || (fractionDigitCount > 9) ||
+            (!readDigits(20, fractionDigitCount, fraction)))
+        {
+            // Other layouts go through the generic parser
+
+            isFixedLayout = false;
+        }
+    }
+
+    if (!isFixedLayout)
+    {
+        return Instant::DateTime(DateTime::Parse(String(std::string(value)), DateTime::Format::ISO8601), Scale::UTC);
+    }
+
+    for (std::size_t idx = fractionDigitCount; idx < 9; ++idx)
+    {
+        fraction *= 10;
+    }
+
+    return Instant::DateTime(
+        DateTime(
+            year,
+            month,
+            day,
+            hour,
+            minute,
+            second,
+            fraction / 1000000,
+            (fraction / 1000) % 1000,
+            fraction % 1000
+        ),
+        Scale::UTC
+    );
+}
+
+Shared<const Frame> GetFrame(const FieldValues& aFieldValues, const Index& aFieldIndex)
+{
+    const std::string_view referenceFrameString = AccessField(aFieldValues, aFieldIndex);
+
+    if (referenceFrameString == "ITRF")
+    {
+        return Frame::ITRF();
+    }
+
+    else if (referenceFrameString == "GCRF")
+    {
+        return Frame::GCRF();
+    }
+
+    else if (referenceFrameString == "EME2000")
+    {
+        return Frame::J2000(Theory::IAU_2006);
+    }
+
+    else
+    {
+        throw ostk::core::error::runtime::Wrong("Frame type in not supported for CCSDS CDM");
+    }
+}
+
+// WARNING:
+// TBI: Currently adapted to handle SpaceTrack CDM (following CCSDS format loosely)
+// TBI: Only use the mandatory fields from the CCSDS reference document
+// TBI: Set the other fields to Undefined() or String::Empty() (except `MESSAGE_FOR`) for now
+
+CDM BuildCDM(const FieldValues& aFieldValues)
+{
+    // Extract Conjunction Header
+
+    const CDM::Header header = CDM::Header {
+        GetString(aFieldValues, CommonField::CCSDSCDMVersion),
+        String::Empty(),
+        GetInstant(aFieldValues, CommonField::CreationDate),
+        GetString(aFieldValues, CommonField::Originator),
+        GetString(aFieldValues, CommonField::MessageFor),
+        GetString(aFieldValues, CommonField::CDMId)
+    };
+
+    // Extract Conjunction Relative Metadata
+
+    const Instant tca = GetInstant(aFieldValues, CommonField::TCA);
+
+    const CDM::RelativeMetadata relativeMetadata = CDM::RelativeMetadata {
+        String::Empty(),
+        tca,
+        Length::Meters(GetReal(aFieldValues, CommonField::MissDistance)),
+        Position::Undefined(),
+        Velocity::Undefined(),
+        Instant::Undefined(),
+        Instant::Undefined(),
+        String::Empty(),
+        String::Empty(),
+        Real::Undefined(),
+        Real::Undefined(),
+        Real::Undefined(),
+        Instant::Undefined(),
+        Instant::Undefined(),
+        GetReal(aFieldValues, CommonField::CollisionProbability),
+        GetString(aFieldValues, CommonField::CollisionProbabilityMethod)
+    };
+
+    // Extract Conjunction Objects Metadata and Data
+
+    Array<CDM::Metadata> metadataArray = Array<CDM::Metadata>::Empty();
+    Array<CDM::Data> dataArray = Array<CDM::Data>::Empty();
+
+    metadataArray.reserve(ObjectCount);
+    dataArray.reserve(ObjectCount);
+
+    for (Index objectIndex = 0; objectIndex < ObjectCount; ++objectIndex)
+    {
+        const Index offset = CommonFieldCount + objectIndex * ObjectFieldCount;
+
+        metadataArray.add(CDM::Metadata {
+            String::Empty(),
+            GetString(aFieldValues, offset + ObjectField::Object),
+            GetInteger(aFieldValues, offset + ObjectField::ObjectDesignator),
+            GetString(aFieldValues, offset + ObjectField::CatalogName),
+            GetString(aFieldValues, offset + ObjectField::ObjectName),
+            GetString(aFieldValues, offset + ObjectField::InternationalDesignator),
+            CDM::ObjectType::Payload,
+            String::Empty(),
+            String::Empty(),
+            String::Empty(),
+            String::Empty(),
+            GetString(aFieldValues, offset + ObjectField::EphemerisName),
+            GetString(aFieldValues, offset + ObjectField::CovarianceMethod),
+            GetString(aFieldValues, offset + ObjectField::Maneuverable),
+            String::Empty(),
+            GetString(aFieldValues, offset + ObjectField::ReferenceFrame),
+            String::Empty(),
+            String::Empty(),
+            String::Empty(),
+            false,
+            false,
+            false
+        });
+
+        // Construct Object Covariance Matrix, from its lower triangle
+
+        MatrixXd covarianceMatrix = MatrixXd::Zero(9, 9);
+
+        Index covarianceFieldIndex = offset + ObjectField::CovarianceFirst;
+
+        for (Index i = 0; i < 6; ++i)
+        {
+            for (Index j = 0; j <= i; ++j)
+            {
+                covarianceMatrix(i, j) = GetReal(aFieldValues, covarianceFieldIndex++);
+                covarianceMatrix(j, i) = covarianceMatrix(i, j);
+            }
+        }
 
-#include <OpenSpaceToolkit/Astrodynamics/Conjunction/Message/CCSDS/CDM.hpp>
+        const Shared<const Frame> referenceFrameSPtr = GetFrame(aFieldValues, offset + ObjectField::ReferenceFrame);
+
+        dataArray.add(CDM::Data {
+            Instant::Undefined(),
+            Instant::Undefined(),
+            Duration::Undefined(),
+            Duration::Undefined(),
+            Integer::Undefined(),
+            Integer::Undefined(),
+            Integer::Undefined(),
+            Integer::Undefined(),
+            Real::Undefined(),
+            Real::Undefined(),
+            Real::Undefined(),
+            Real::Undefined(),
+            Real::Undefined(),
+            Mass::Undefined(),
+            Real::Undefined(),
+            Real::Undefined(),
+            Real::Undefined(),
+            Real::Undefined(),
+            State(
+                tca,
+                Position::Meters(  // TBI: Add Position::Kilometers
+                    {GetReal(aFieldValues, offset + ObjectField::X) * 1000.0,
+                     GetReal(aFieldValues, offset + ObjectField::Y) * 1000.0,
+                     GetReal(aFieldValues, offset + ObjectField::Z) * 1000.0},
+                    referenceFrameSPtr
+                ),
+                Velocity::MetersPerSecond(  // TBI: Add Velocity::KilometersPerSecond
+                    {GetReal(aFieldValues, offset + ObjectField::XDot) * 1000.0,
+                     GetReal(aFieldValues, offset + ObjectField::YDot) * 1000.0,
+                     GetReal(aFieldValues, offset + ObjectField::ZDot) * 1000.0},
+                    referenceFrameSPtr
+                )
+            ),
+            covarianceMatrix
+        });
+    }
 
-namespace ostk
+    return CDM {header, relativeMetadata, metadataArray, dataArray};
+}
+
+// Collision probability, integrated over the hard body disk in the encounter plane
+
+static constexpr std::size_t QuadratureNodeCount = 64;
+
+struct GaussLegendreQuadrature
 {
-namespace astrodynamics
+    std::array<double, QuadratureNodeCount> nodes;
+    std::array<double, QuadratureNodeCount> weights;
+};
+
+const GaussLegendreQuadrature& AccessGaussLegendreQuadrature()
 {
-namespace conjunction
+    // Nodes are the roots of the Legendre polynomial of degree N, found by Newton iterations
+
+    static const GaussLegendreQuadrature quadrature = []() -> GaussLegendreQuadrature
+    {
+        GaussLegendreQuadrature gaussLegendreQuadrature;
+
+        const double nodeCount = static_cast<double>(QuadratureNodeCount);
+
+        for (std::size_t nodeIndex = 0; nodeIndex < QuadratureNodeCount; ++nodeIndex)
+        {
+            double node = std::cos(M_PI * (static_cast<double>(nodeIndex) + 0.75) / (nodeCount + 0.5));
+            double derivative = 1.0;
+
+            for (Size iteration = 0; iteration < 100; ++iteration)
+            {
+                double previousValue = 1.0;
+                double value = node;
+
+                for (std::size_t degree = 2; degree <= QuadratureNodeCount; ++degree)
+                {
+                    const double nextValue =
+                        ((2.0 * degree - 1.0) * node * value - (degree - 1.0) * previousValue) / degree;
+
+                    previousValue = value;
+                    value = nextValue;
+                }
+
+                derivative = nodeCount * (node * value - previousValue) / (node * node - 1.0);
+
+                const double step = value / derivative;
+
+                node -= step;
+
+                if (std::fabs(step) < 1e-15)
+                {
+                    break;
+                }
+            }
+
+            gaussLegendreQuadrature.nodes[nodeIndex] = node;
+            gaussLegendreQuadrature.weights[nodeIndex] = 2.0 / ((1.0 - node * node) * derivative * derivative);
+        }
+
+        return gaussLegendreQuadrature;
+    }();
+
+    return quadrature;
+}
+
+// Probability mass of a 2D Gaussian, given in its principal axes (mean {xm, zm}, standard deviations {sx, sz}), over
+// the disk of given radius centered on the origin. The z integral is analytical (erf), and the x integral uses a
+// fixed Gauss-Legendre rule in x = R sin(theta), restricted to the +/- 8 sigma support of the Gaussian
+
+double ComputeDiskProbability(
+    const double& aMeanX,
+    const double& aMeanZ,
+    const double& aStandardDeviationX,
+    const double& aStandardDeviationZ,
+    const double& aRadius
+)
 {
-namespace message
+    const auto clampedArcSine = [](const double& aValue) -> double
+    {
+        return std::asin(std::min(1.0, std::max(-1.0, aValue)));
+    };
+
+    const double lowerAngle = clampedArcSine((aMeanX - 8.0 * aStandardDeviationX) / aRadius);
+    const double upperAngle = clampedArcSine((aMeanX + 8.0 * aStandardDeviationX) / aRadius);
+
+    if (upperAngle <= lowerAngle)
+    {
+        return 0.0;
+    }
+
+    const GaussLegendreQuadrature& quadrature = AccessGaussLegendreQuadrature();
+
+    const double halfRange = 0.5 * (upperAngle - lowerAngle);
+    const double midAngle = 0.5 * (upperAngle + lowerAngle);
+    const double zScale = 1.0 / (M_SQRT2 * aStandardDeviationZ);
+
+    double sum = 0.0;
+
+    for (std::size_t nodeIndex = 0; nodeIndex < QuadratureNodeCount; ++nodeIndex)
+    {
+        const double angle = midAngle + halfRange * quadrature.nodes[nodeIndex];
+
+        const double cosine = std::cos(angle);
+        const double x = aRadius * std::sin(angle);
+        const double halfChord = aRadius * cosine;
+        const double normalizedX = (x - aMeanX) / aStandardDeviationX;
+
+        sum += quadrature.weights[nodeIndex] * cosine * std::exp(-0.5 * normalizedX * normalizedX) *
+               (std::erf((halfChord + aMeanZ) * zScale) + std::erf((halfChord - aMeanZ) * zScale));
+    }
+
+    return sum * halfRange * aRadius / (2.0 * std::sqrt(2.0 * M_PI) * aStandardDeviationX);
+}
+
+// Position covariance of an object in GCRF, from its RTN covariance
+
+Matrix3d GetPositionCovariance_GCRF(const State& aState_GCRF, const MatrixXd& aCovarianceMatrix_RTN)
 {
-namespace ccsds
+    if ((aCovarianceMatrix_RTN.rows() < 3) || (aCovarianceMatrix_RTN.cols() < 3))
+    {
+        throw ostk::core::error::runtime::Undefined("Covariance");
+    }
+
+    const Vector3d position = aState_GCRF.getPosition().getCoordinates();
+    const Vector3d velocity = aState_GCRF.getVelocity().getCoordinates();
+
+    const Vector3d rAxis = position.normalized();
+    const Vector3d nAxis = position.cross(velocity).normalized();
+    const Vector3d tAxis = nAxis.cross(rAxis);
+
+    Matrix3d rotation_RTN_GCRF;
+    rotation_RTN_GCRF.row(0) = rAxis.transpose();
+    rotation_RTN_GCRF.row(1) = tAxis.transpose();
+    rotation_RTN_GCRF.row(2) = nAxis.transpose();
+
+    const Matrix3d positionCovariance_RTN = aCovarianceMatrix_RTN.topLeftCorner<3, 3>();
+
+    return rotation_RTN_GCRF.transpose() * positionCovariance_RTN * rotation_RTN_GCRF;
+}
+
+Real ComputeFosterCollisionProbability(
+    const CDM::Data& aFirstObjectData, const CDM::Data& aSecondObjectData, const double& aHardBodyRadius
+)
 {
+    const State firstState = aFirstObjectData.state.inFrame(Frame::GCRF());
+    const State secondState = aSecondObjectData.state.inFrame(Frame::GCRF());
+
+    const Matrix3d combinedCovariance = GetPositionCovariance_GCRF(firstState, aFirstObjectData.covarianceMatrix) +
+                                        GetPositionCovariance_GCRF(secondState, aSecondObjectData.covarianceMatrix);
+
+    const Vector3d relativePosition =
+        secondState.getPosition().getCoordinates() - firstState.getPosition().getCoordinates();
+    const Vector3d relativeVelocity =
+        secondState.getVelocity().getCoordinates() - firstState.getVelocity().getCoordinates();
+
+    if (relativeVelocity.norm() == 0.0)
+    {
+        throw ostk::core::error::runtime::Wrong("Relative velocity");
+    }
+
+    // Encounter plane: normal to the relative velocity, with x along the miss vector
+
+    const Vector3d yAxis = relativeVelocity.normalized();
+
+    const Vector3d missVector = relativePosition - relativePosition.dot(yAxis) * yAxis;
+    const double missDistance = missVector.norm();
+
+    const Vector3d xAxis = (missDistance > 0.0) ? Vector3d(missVector / missDistance) : yAxis.unitOrthogonal();
+    const Vector3d zAxis = xAxis.cross(yAxis);
+
+    const double covarianceXX = xAxis.dot(combinedCovariance * xAxis);
+    const double covarianceXZ = xAxis.dot(combinedCovariance * zAxis);
+    const double covarianceZZ = zAxis.dot(combinedCovariance * zAxis);
+
+    // Principal axes of the projected covariance (closed form for a 2x2 symmetric matrix)
+
+    const double halfTrace = 0.5 * (covarianceXX + covarianceZZ);
+    const double halfDifference = 0.5 * (covarianceXX - covarianceZZ);
+    const double discriminant = std::sqrt(halfDifference * halfDifference + covarianceXZ * covarianceXZ);
+
+    const double minorVariance = halfTrace - discriminant;
+    const double majorVariance = halfTrace + discriminant;
+
+    if (!(minorVariance > 0.0))
+    {
+        throw ostk::core::error::runtime::Wrong("Covariance");
+    }
+
+    const double majorAxisAngle = 0.5 * std::atan2(2.0 * covarianceXZ, covarianceXX - covarianceZZ);
+
+    // Miss vector is {missDistance, 0.0} in the encounter plane, projected onto the minor and major axes
+
+    const double minorAxisMean = -missDistance * std::sin(majorAxisAngle);
+    const double majorAxisMean = missDistance * std::cos(majorAxisAngle);
+
+    return ComputeDiskProbability(
+        minorAxisMean, majorAxisMean, std::sqrt(minorVariance), std::sqrt(majorVariance), aHardBodyRadius
+    );
+}
+
+}  // namespace
 
 CDM::CDM(
     const CDM::Header& aHeader,
@@ -309,6 +1344,28 @@ String CDM::getObjectReferenceFrame(const Index& anIndex) const
     return objectMetadata.refFrame;
 }
 
+Real CDM::computeCollisionProbability(const Length& aHardBodyRadius) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("CDM");
+    }
+
+    if (!aHardBodyRadius.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Hard body radius");
+    }
+
+    if (aHardBodyRadius.inMeters() <= 0.0)
+    {
+        throw ostk::core::error::runtime::Wrong("Hard body radius");
+    }
+
+    return ComputeFosterCollisionProbability(
+        this->objectsData_.at(0), this->objectsData_.at(1), aHardBodyRadius.inMeters()
+    );
+}
+
 void CDM::print(std::ostream& anOutputStream, bool displayDecorator) const
 {
     using ostk::core::type::String;
@@ -350,299 +1407,220 @@ CDM CDM::Undefined()
 
 CDM CDM::Dictionary(const container::Dictionary& aDictionary)
 {
-    using ostk::physics::time::DateTime;
-    using ostk::physics::time::Scale;
+    FieldValues fieldValues;
 
-    // WARNING:
-    // TBI: Currently adapted to handle SpaceTrack CDM (following CCSDS format loosely)
-    // TBI: Only use the mandatory fields from the CCSDS reference document
-    // TBI: Set the other fields to Undefined() or String::Empty() (except `MESSAGE_FOR`) for now
-
-    // Utility Function (to be moved later)
-    const auto referenceFrameStringToFrame = [](const String& referenceFrameString) -> Shared<const Frame>
+    for (Index fieldIndex = 0; fieldIndex < FieldCount; ++fieldIndex)
     {
-        if (referenceFrameString == "ITRF")
-        {
-            return Frame::ITRF();
-        }
+        const container::Object& object = aDictionary[FieldNames()[fieldIndex]];
 
-        else if (referenceFrameString == "GCRF")
+        if (object.isString())
         {
-            return Frame::GCRF();
+            fieldValues[fieldIndex] = std::string_view(object.accessString());
         }
+    }
 
-        else if (referenceFrameString == "EME2000")
-        {
-            return Frame::J2000(Theory::IAU_2006);
-        }
+    return BuildCDM(fieldValues);
+}
 
-        else
-        {
-            throw ostk::core::error::runtime::Wrong("Frame type in not supported for CCSDS CDM");
-        }
-    };
+CDM CDM::Parse(const String& aString)
+{
+    using ostk::core::container::Object;
 
-    // Extract Conjunction Header
+    return CDM::Dictionary(Object::Parse(aString, Object::Format::JSON).accessDictionary());
+}
 
-    CDM::Header header = CDM::Header {
-        aDictionary["CCSDS_CDM_VERS"].getString(),
-        String::Empty(),
-        Instant::DateTime(
-            DateTime::Parse(aDictionary["CREATION_DATE"].getString(), DateTime::Format::ISO8601), Scale::UTC
-        ),
-        aDictionary["ORIGINATOR"].getString(),
-        aDictionary["MESSAGE_FOR"].getString(),
-        aDictionary["CDM_ID"].getString()
-    };
+CDM CDM::Load(const File& aFile)
+{
+    using ostk::core::container::Object;
 
-    // Extract Conjunction Relative Metadata
+    return CDM::Dictionary(Object::Load(aFile, Object::Format::JSON).accessDictionary());
+}
 
-    CDM::RelativeMetadata relativeMetadata = CDM::RelativeMetadata {
-        String::Empty(),
-        Instant::DateTime(DateTime::Parse(aDictionary["TCA"].getString(), DateTime::Format::ISO8601), Scale::UTC),
-        Length::Meters(Real::Parse(aDictionary["MISS_DISTANCE"].accessString())),
-        Position::Undefined(),
-        Velocity::Undefined(),
-        Instant::Undefined(),
-        Instant::Undefined(),
-        String::Empty(),
-        String::Empty(),
-        Real::Undefined(),
-        Real::Undefined(),
-        Real::Undefined(),
-        Instant::Undefined(),
-        Instant::Undefined(),
-        Real::Parse(aDictionary["COLLISION_PROBABILITY"].accessString()),
-        aDictionary["COLLISION_PROBABILITY_METHOD"].accessString()
-    };
+CDM CDM::ParseKVN(const String& aString)
+{
+    return BuildCDM(ReadKVNFieldValues(aString));
+}
 
-    // Extract Conjunction Objects Metadata
+CDM CDM::LoadKVN(const File& aFile)
+{
+    return CDM::ParseKVN(ReadFile(aFile));
+}
 
-    // Extract Object 1 Metadata
+Array<CDM> CDM::ParseArray(const String& aString, const Size& aThreadCount)
+{
+    return CDM::ParseArray(aString, ExecutionContext(aThreadCount));
+}
 
-    CDM::Metadata sat1ObjectMetadata = CDM::Metadata {
-        String::Empty(),
-        aDictionary["SAT1_OBJECT"].accessString(),
-        Integer::Parse(aDictionary["SAT1_OBJECT_DESIGNATOR"].accessString()),
-        aDictionary["SAT1_CATALOG_NAME"].accessString(),
-        aDictionary["SAT1_OBJECT_NAME"].accessString(),
-        aDictionary["SAT1_INTERNATIONAL_DESIGNATOR"].accessString(),
-        CDM::ObjectType::Payload,
-        String::Empty(),
-        String::Empty(),
-        String::Empty(),
-        String::Empty(),
-        aDictionary["SAT1_EPHEMERIS_NAME"].accessString(),
-        aDictionary["SAT1_COVARIANCE_METHOD"].accessString(),
-        aDictionary["SAT1_MANEUVERABLE"].accessString(),
-        String::Empty(),
-        aDictionary["SAT1_REF_FRAME"].accessString(),
-        String::Empty(),
-        String::Empty(),
-        String::Empty(),
-        false,
-        false,
-        false
-    };
+Array<CDM> CDM::ParseArray(const String& aString, const ExecutionContext& anExecutionContext)
+{
+    const std::string_view string = aString;
 
-    // Extract Object 2 Metadata
+    // Scan the array in place, to delimit its objects
 
-    CDM::Metadata sat2ObjectMetadata = CDM::Metadata {
-        String::Empty(),
-        aDictionary["SAT2_OBJECT"].accessString(),
-        Integer::Parse(aDictionary["SAT2_OBJECT_DESIGNATOR"].accessString()),
-        aDictionary["SAT2_CATALOG_NAME"].accessString(),
-        aDictionary["SAT2_OBJECT_NAME"].accessString(),
-        aDictionary["SAT2_INTERNATIONAL_DESIGNATOR"].accessString(),
-        CDM::ObjectType::Payload,
-        String::Empty(),
-        String::Empty(),
-        String::Empty(),
-        String::Empty(),
-        aDictionary["SAT2_EPHEMERIS_NAME"].accessString(),
-        aDictionary["SAT2_COVARIANCE_METHOD"].accessString(),
-        aDictionary["SAT2_MANEUVERABLE"].accessString(),
-        String::Empty(),
-        aDictionary["SAT2_REF_FRAME"].accessString(),
-        String::Empty(),
-        String::Empty(),
-        String::Empty(),
-        false,
-        false,
-        false
-    };
+    std::size_t position = SkipWhitespace(string, 0);
+
+    if ((position >= string.size()) || (string[position] != '['))
+    {
+        throw ostk::core::error::runtime::Wrong("CDM array");
+    }
+
+    std::vector<std::string_view> records;
+    records.reserve(std::count(aString.begin(), aString.end(), '{'));
 
-    Array<CDM::Metadata> metadataArray = {sat1ObjectMetadata, sat2ObjectMetadata};
+    position = SkipWhitespace(string, position + 1);
+
+    while ((position < string.size()) && (string[position] != ']'))
+    {
+        if (string[position] != '{')
+        {
+            throw ostk::core::error::runtime::Wrong("CDM array");
+        }
 
-    // Extract Conjunction Objects Data
+        const std::size_t recordStart = position;
 
-    // Extract Object 1 Data
+        position = SkipObject(string, position);
 
-    // Construct Object 1 Covariance Matrix, TBI: Use symmetric construction
+        records.push_back(string.substr(recordStart, position - recordStart));
 
-    MatrixXd object1CovarianceMatrix = MatrixXd::Zero(9, 9);
-    object1CovarianceMatrix(0, 0) = Real::Parse(aDictionary["SAT1_CR_R"].accessString());
-    object1CovarianceMatrix(1, 0) = Real::Parse(aDictionary["SAT1_CT_R"].accessString());
-    object1CovarianceMatrix(1, 1) = Real::Parse(aDictionary["SAT1_CT_T"].accessString());
-    object1CovarianceMatrix(2, 0) = Real::Parse(aDictionary["SAT1_CN_R"].accessString());
-    object1CovarianceMatrix(2, 1) = Real::Parse(aDictionary["SAT1_CN_T"].accessString());
-    object1CovarianceMatrix(2, 2) = Real::Parse(aDictionary["SAT1_CN_N"].accessString());
-    object1CovarianceMatrix(3, 0) = Real::Parse(aDictionary["SAT1_CRDOT_R"].accessString());
-    object1CovarianceMatrix(3, 1) = Real::Parse(aDictionary["SAT1_CRDOT_T"].accessString());
-    object1CovarianceMatrix(3, 2) = Real::Parse(aDictionary["SAT1_CRDOT_N"].accessString());
-    object1CovarianceMatrix(3, 3) = Real::Parse(aDictionary["SAT1_CRDOT_RDOT"].accessString());
-    object1CovarianceMatrix(4, 0) = Real::Parse(aDictionary["SAT1_CTDOT_R"].accessString());
-    object1CovarianceMatrix(4, 1) = Real::Parse(aDictionary["SAT1_CTDOT_T"].accessString());
-    object1CovarianceMatrix(4, 2) = Real::Parse(aDictionary["SAT1_CTDOT_N"].accessString());
-    object1CovarianceMatrix(4, 3) = Real::Parse(aDictionary["SAT1_CTDOT_RDOT"].accessString());
-    object1CovarianceMatrix(4, 4) = Real::Parse(aDictionary["SAT1_CTDOT_TDOT"].accessString());
-    object1CovarianceMatrix(5, 0) = Real::Parse(aDictionary["SAT1_CNDOT_R"].accessString());
-    object1CovarianceMatrix(5, 1) = Real::Parse(aDictionary["SAT1_CNDOT_T"].accessString());
-    object1CovarianceMatrix(5, 2) = Real::Parse(aDictionary["SAT1_CNDOT_N"].accessString());
-    object1CovarianceMatrix(5, 3) = Real::Parse(aDictionary["SAT1_CNDOT_RDOT"].accessString());
-    object1CovarianceMatrix(5, 4) = Real::Parse(aDictionary["SAT1_CNDOT_TDOT"].accessString());
-    object1CovarianceMatrix(5, 5) = Real::Parse(aDictionary["SAT1_CNDOT_NDOT"].accessString());
+        position = SkipWhitespace(string, position);
 
-    for (int i = 0; i < 5; i++)
-    {
-        for (int j = 1; j < 6; j++)
+        if ((position < string.size()) && (string[position] == ','))
         {
-            object1CovarianceMatrix(i, j) = object1CovarianceMatrix(j, i);
+            position = SkipWhitespace(string, position + 1);
         }
     }
 
-    String sat1RefFrameString = aDictionary["SAT1_REF_FRAME"].accessString();
-    Shared<const Frame> sat1RefFramePtr = referenceFrameStringToFrame(sat1RefFrameString);
+    if (position >= string.size())
+    {
+        throw ostk::core::error::runtime::Wrong("CDM array");
+    }
 
-    CDM::Data sat1ObjectData = CDM::Data {
-        Instant::Undefined(),
-        Instant::Undefined(),
-        Duration::Undefined(),
-        Duration::Undefined(),
-        Integer::Undefined(),
-        Integer::Undefined(),
-        Integer::Undefined(),
-        Integer::Undefined(),
-        Real::Undefined(),
-        Real::Undefined(),
-        Real::Undefined(),
-        Real::Undefined(),
-        Real::Undefined(),
-        Mass::Undefined(),
-        Real::Undefined(),
-        Real::Undefined(),
-        Real::Undefined(),
-        Real::Undefined(),
-        State(
-            Instant::DateTime(DateTime::Parse(aDictionary["TCA"].getString(), DateTime::Format::ISO8601), Scale::UTC),
-            Position::Meters(  // TBI: Add Position::Kilometers
-                {Real::Parse(aDictionary["SAT1_X"].accessString()) * 1000.0,
-                 Real::Parse(aDictionary["SAT1_Y"].accessString()) * 1000.0,
-                 Real::Parse(aDictionary["SAT1_Z"].accessString()) * 1000.0},
-                sat1RefFramePtr
-            ),
-            Velocity::MetersPerSecond(  // TBI: Add Velocity::KilometersPerSecond
-                {Real::Parse(aDictionary["SAT1_X_DOT"].accessString()) * 1000.0,
-                 Real::Parse(aDictionary["SAT1_Y_DOT"].accessString()) * 1000.0,
-                 Real::Parse(aDictionary["SAT1_Z_DOT"].accessString()) * 1000.0},
-                sat1RefFramePtr
-            )
-        ),
-        object1CovarianceMatrix
-    };
+    // Read the fields and build the CDMs, in parallel chunks
 
-    // Extract Object 2 Data
+    const Size recordCount = records.size();
 
-    // Construct Object 2 Covariance Matrix
+    Array<CDM> cdms(recordCount, CDM::Undefined());
 
-    MatrixXd object2CovarianceMatrix = MatrixXd::Zero(9, 9);
-    object2CovarianceMatrix(0, 0) = Real::Parse(aDictionary["SAT2_CR_R"].accessString());
-    object2CovarianceMatrix(1, 0) = Real::Parse(aDictionary["SAT2_CT_R"].accessString());
-    object2CovarianceMatrix(1, 1) = Real::Parse(aDictionary["SAT2_CT_T"].accessString());
-    object2CovarianceMatrix(2, 0) = Real::Parse(aDictionary["SAT2_CN_R"].accessString());
-    object2CovarianceMatrix(2, 1) = Real::Parse(aDictionary["SAT2_CN_T"].accessString());
-    object2CovarianceMatrix(2, 2) = Real::Parse(aDictionary["SAT2_CN_N"].accessString());
-    object2CovarianceMatrix(3, 0) = Real::Parse(aDictionary["SAT2_CRDOT_R"].accessString());
-    object2CovarianceMatrix(3, 1) = Real::Parse(aDictionary["SAT2_CRDOT_T"].accessString());
-    object2CovarianceMatrix(3, 2) = Real::Parse(aDictionary["SAT2_CRDOT_N"].accessString());
-    object2CovarianceMatrix(3, 3) = Real::Parse(aDictionary["SAT2_CRDOT_RDOT"].accessString());
-    object2CovarianceMatrix(4, 0) = Real::Parse(aDictionary["SAT2_CTDOT_R"].accessString());
-    object2CovarianceMatrix(4, 1) = Real::Parse(aDictionary["SAT2_CTDOT_T"].accessString());
-    object2CovarianceMatrix(4, 2) = Real::Parse(aDictionary["SAT2_CTDOT_N"].accessString());
-    object2CovarianceMatrix(4, 3) = Real::Parse(aDictionary["SAT2_CTDOT_RDOT"].accessString());
-    object2CovarianceMatrix(4, 4) = Real::Parse(aDictionary["SAT2_CTDOT_TDOT"].accessString());
-    object2CovarianceMatrix(5, 0) = Real::Parse(aDictionary["SAT2_CNDOT_R"].accessString());
-    object2CovarianceMatrix(5, 1) = Real::Parse(aDictionary["SAT2_CNDOT_T"].accessString());
-    object2CovarianceMatrix(5, 2) = Real::Parse(aDictionary["SAT2_CNDOT_N"].accessString());
-    object2CovarianceMatrix(5, 3) = Real::Parse(aDictionary["SAT2_CNDOT_RDOT"].accessString());
-    object2CovarianceMatrix(5, 4) = Real::Parse(aDictionary["SAT2_CNDOT_TDOT"].accessString());
-    object2CovarianceMatrix(5, 5) = Real::Parse(aDictionary["SAT2_CNDOT_NDOT"].accessString());
+    static constexpr Size ChunkSize = 64;
 
-    for (int i = 0; i < 5; i++)
-    {
-        for (int j = 1; j < 6; j++)
+    const Size chunkCount = (recordCount + ChunkSize - 1) / ChunkSize;
+
+    anExecutionContext.parallelFor(
+        chunkCount,
+        [&cdms, &records, recordCount]() -> std::function<void(const Index&)>
         {
-            object2CovarianceMatrix(i, j) = object2CovarianceMatrix(j, i);
+            // Each worker holds its own buffer of unescaped values
+
+            return [unescapedValues = std::deque<std::string>(), &cdms, &records, recordCount](
+                       const Index& aChunkIndex
+                   ) mutable
+            {
+                const Size recordEnd = std::min<Size>(recordCount, (aChunkIndex + 1) * ChunkSize);
+
+                for (Size recordIndex = aChunkIndex * ChunkSize; recordIndex < recordEnd; ++recordIndex)
+                {
+                    unescapedValues.clear();
+
+                    cdms[recordIndex] = BuildCDM(ReadFieldValues(records[recordIndex], unescapedValues));
+                }
+            };
         }
-    }
+    );
 
-    String sat2RefFrameString = aDictionary["SAT2_REF_FRAME"].accessString();
-    Shared<const Frame> sat2RefFramePtr = referenceFrameStringToFrame(sat2RefFrameString);
+    return cdms;
+}
 
-    CDM::Data sat2ObjectData = CDM::Data {
-        Instant::Undefined(),
-        Instant::Undefined(),
-        Duration::Undefined(),
-        Duration::Undefined(),
-        Integer::Undefined(),
-        Integer::Undefined(),
-        Integer::Undefined(),
-        Integer::Undefined(),
-        Real::Undefined(),
-        Real::Undefined(),
-        Real::Undefined(),
-        Real::Undefined(),
-        Real::Undefined(),
-        Mass::Undefined(),
-        Real::Undefined(),
-        Real::Undefined(),
-        Real::Undefined(),
-        Real::Undefined(),
-        State(
-            Instant::DateTime(DateTime::Parse(aDictionary["TCA"].getString(), DateTime::Format::ISO8601), Scale::UTC),
-            Position::Meters(
-                {Real::Parse(aDictionary["SAT2_X"].accessString()) * 1000.0,
-                 Real::Parse(aDictionary["SAT2_Y"].accessString()) * 1000.0,
-                 Real::Parse(aDictionary["SAT2_Z"].accessString()) * 1000.0},
-                sat2RefFramePtr
-            ),
-            Velocity::MetersPerSecond(
-                {Real::Parse(aDictionary["SAT2_X_DOT"].accessString()) * 1000.0,
-                 Real::Parse(aDictionary["SAT2_Y_DOT"].accessString()) * 1000.0,
-                 Real::Parse(aDictionary["SAT2_Z_DOT"].accessString()) * 1000.0},
-                sat2RefFramePtr
-            )
-        ),
-        object2CovarianceMatrix
-    };
+Array<CDM> CDM::LoadArray(const File& aFile, const Size& aThreadCount)
+{
+    return CDM::ParseArray(ReadFile(aFile), aThreadCount);
+}
 
-    Array<CDM::Data> dataArray = {sat1ObjectData, sat2ObjectData};
+Array<CDM> CDM::LoadArray(const File& aFile, const ExecutionContext& anExecutionContext)
+{
+    return CDM::ParseArray(ReadFile(aFile), anExecutionContext);
+}
 
-    return CDM {header, relativeMetadata, metadataArray, dataArray};
+Array<Real> CDM::ComputeCollisionProbabilities(
+    const Array<CDM>& aCDMArray, const Length& aHardBodyRadius, const Size& aThreadCount
+)
+{
+    return CDM::ComputeCollisionProbabilities(aCDMArray, aHardBodyRadius, ExecutionContext(aThreadCount));
 }
 
-CDM CDM::Parse(const String& aString)
+Array<Real> CDM::ComputeCollisionProbabilities(
+    const Array<CDM>& aCDMArray, const Length& aHardBodyRadius, const ExecutionContext& anExecutionContext
+)
 {
-    using ostk::core::container::Object;
+    if (!aHardBodyRadius.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Hard body radius");
+    }
 
-    return CDM::Dictionary(Object::Parse(aString, Object::Format::JSON).accessDictionary());
+    if (aHardBodyRadius.inMeters() <= 0.0)
+    {
+        throw ostk::core::error::runtime::Wrong("Hard body radius");
+    }
+
+    const double hardBodyRadius = aHardBodyRadius.inMeters();
+
+    const Size cdmCount = aCDMArray.getSize();
+
+    Array<Real> probabilities(cdmCount, Real::Undefined());
+
+    static constexpr Size ChunkSize = 256;
+
+    const Size chunkCount = (cdmCount + ChunkSize - 1) / ChunkSize;
+
+    anExecutionContext.parallelFor(
+        chunkCount,
+        [&aCDMArray, &probabilities, cdmCount, hardBodyRadius](const Index& aChunkIndex) -> void
+        {
+            const Size cdmEnd = std::min<Size>(cdmCount, (aChunkIndex + 1) * ChunkSize);
+
+            for (Size cdmIndex = aChunkIndex * ChunkSize; cdmIndex < cdmEnd; ++cdmIndex)
+            {
+                const CDM& cdm = aCDMArray[cdmIndex];
+
+                if (!cdm.isDefined())
+                {
+                    throw ostk::core::error::runtime::Undefined("CDM");
+                }
+
+                probabilities[cdmIndex] = ComputeFosterCollisionProbability(
+                    cdm.objectsData_.at(0), cdm.objectsData_.at(1), hardBodyRadius
+                );
+            }
+        }
+    );
+
+    return probabilities;
 }
 
-CDM CDM::Load(const File& aFile)
+Real CDM::ComputeCollisionProbability(
+    const CDM::Data& aFirstObjectData, const CDM::Data& aSecondObjectData, const Length& aHardBodyRadius
+)
 {
-    using ostk::core::container::Object;
+    if (!aFirstObjectData.state.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("First object state");
+    }
 
-    return CDM::Dictionary(Object::Load(aFile, Object::Format::JSON).accessDictionary());
+    if (!aSecondObjectData.state.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Second object state");
+    }
+
+    if (!aHardBodyRadius.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Hard body radius");
+    }
+
+    if (aHardBodyRadius.inMeters() <= 0.0)
+    {
+        throw ostk::core::error::runtime::Wrong("Hard body radius");
+    }
+
+    return ComputeFosterCollisionProbability(aFirstObjectData, aSecondObjectData, aHardBodyRadius.inMeters());
 }
 
 CDM::ObjectType CDM::ObjectTypeFromString(const String& aString)
@@ -0,0 +1,572 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Conjunction/Screener.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/RootSolver.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/SGP4.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace conjunction
+{
+
+using ostk::core::type::Integer;
+using ostk::core::type::Real;
+using ostk::core::type::String;
+
+using ostk::mathematics::object::MatrixXd;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Velocity;
+using ostk::physics::unit::Mass;
+
+using ostk::astrodynamics::RootSolver;
+using ostk::astrodynamics::trajectory::orbit::model::SGP4;
+using ostk::astrodynamics::trajectory::State;
+
+namespace
+{
+
+// Sampled GCRF trajectory of one object, together with its per-bucket bounding spheres
+
+struct Samples
+{
+    std::vector<Vector3d> positions;
+    std::vector<Vector3d> velocities;
+    std::vector<Vector3d> centers;
+    std::vector<double> radii;
+    double minimumRadius;
+    double maximumRadius;
+};
+
+struct Candidate
+{
+    Index firstObjectIndex;
+    Index secondObjectIndex;
+    Index bucketIndex;
+};
+
+using CellKey = std::tuple<std::int64_t, std::int64_t, std::int64_t>;
+
+std::pair<Vector3d, Vector3d> GetPositionAndVelocity_GCRF(const Trajectory& aTrajectory, const Instant& anInstant)
+{
+    const State state = aTrajectory.getStateAt(anInstant).inFrame(Frame::GCRF());
+
+    return {state.getPosition().getCoordinates(), state.getVelocity().getCoordinates()};
+}
+
+CellKey GetCellKey(const Vector3d& aPoint, const double& aCellSize)
+{
+    return {
+        static_cast<std::int64_t>(std::floor(aPoint.x() / aCellSize)),
+        static_cast<std::int64_t>(std::floor(aPoint.y() / aCellSize)),
+        static_cast<std::int64_t>(std::floor(aPoint.z() / aCellSize))
+    };
+}
+
+}  // namespace
+
+Screener::Screener(
+    const Length& aScreeningDistance, const Duration& aStep, const Duration& aTolerance, const Size& aThreadCount
+)
+    : screeningDistance_(aScreeningDistance),
+      step_(aStep),
+      tolerance_(aTolerance),
+      threadCount_(aThreadCount)
+{
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const Screener& aScreener)
+{
+    aScreener.print(anOutputStream);
+
+    return anOutputStream;
+}
+
+bool Screener::isDefined() const
+{
+    return screeningDistance_.isDefined() && step_.isDefined() && tolerance_.isDefined();
+}
+
+Length Screener::getScreeningDistance() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Screener");
+    }
+
+    return screeningDistance_;
+}
+
+Duration Screener::getStep() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Screener");
+    }
+
+    return step_;
+}
+
+Duration Screener::getTolerance() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Screener");
+    }
+
+    return tolerance_;
+}
+
+Size Screener::getThreadCount() const
+{
+    return threadCount_;
+}
+
+Array<Screener::Conjunction> Screener::screen(const Array<Trajectory>& aTrajectoryArray, const Interval& anInterval)
+    const
+{
+    return this->screen(aTrajectoryArray, anInterval, ExecutionContext(threadCount_));
+}
+
+Array<Screener::Conjunction> Screener::screen(
+    const Array<Trajectory>& aTrajectoryArray, const Interval& anInterval, const ExecutionContext& anExecutionContext
+) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Screener");
+    }
+
+    if (!anInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    if (!step_.isStrictlyPositive())
+    {
+        throw ostk::core::error::runtime::Wrong("Step");
+    }
+
+    if (!tolerance_.isStrictlyPositive())
+    {
+        throw ostk::core::error::runtime::Wrong("Tolerance");
+    }
+
+    const Size objectCount = aTrajectoryArray.getSize();
+    const Array<Instant> instants = anInterval.generateGrid(step_);
+
+    if ((objectCount < 2) || (instants.getSize() < 2))
+    {
+        return Array<Screener::Conjunction>::Empty();
+    }
+
+    const Size bucketCount = instants.getSize() - 1;
+    const double screeningDistance = screeningDistance_.inMeters();
+
+    std::vector<double> bucketDurations(bucketCount);
+
+    for (Index bucketIndex = 0; bucketIndex < bucketCount; ++bucketIndex)
+    {
+        bucketDurations[bucketIndex] = (instants[bucketIndex + 1] - instants[bucketIndex]).inSeconds();
+    }
+
+    // Sample every object on the grid, and bound its motion over each bucket by a sphere: centered on the chord
+    // midpoint, with a radius covering the chord and the deviation allowed by the object's acceleration (a * dt^2 / 8)
+
+    std::vector<Samples> samplesArray(objectCount);
+
+    anExecutionContext.parallelFor(
+        objectCount,
+        [&](const Index& anObjectIndex) -> void
+        {
+            // Trajectory models are immutable and safe to query from several threads (propagated models integrate on
+            // call-local solvers), hence trajectories are shared between workers rather than copied
+
+            const Trajectory& trajectory = aTrajectoryArray[anObjectIndex];
+
+            Samples& samples = samplesArray[anObjectIndex];
+
+            samples.positions.reserve(instants.getSize());
+            samples.velocities.reserve(instants.getSize());
+
+            for (const State& state : trajectory.getStatesAt(instants))
+            {
+                const State state_GCRF = state.inFrame(Frame::GCRF());
+
+                samples.positions.push_back(state_GCRF.getPosition().getCoordinates());
+                samples.velocities.push_back(state_GCRF.getVelocity().getCoordinates());
+            }
+
+            // Acceleration is estimated from sampled velocities, with a safety margin
+
+            double maximumAcceleration = 0.0;
+
+            for (Index bucketIndex = 0; bucketIndex < bucketCount; ++bucketIndex)
+            {
+                maximumAcceleration = std::max(
+                    maximumAcceleration,
+                    (samples.velocities[bucketIndex + 1] - samples.velocities[bucketIndex]).norm() /
+                        bucketDurations[bucketIndex]
+                );
+            }
+
+            maximumAcceleration *= 1.5;
+
+            samples.centers.resize(bucketCount);
+            samples.radii.resize(bucketCount);
+            samples.minimumRadius = std::numeric_limits<double>::max();
+            samples.maximumRadius = 0.0;
+
+            for (Index bucketIndex = 0; bucketIndex < bucketCount; ++bucketIndex)
+            {
+                const Vector3d& startPosition = samples.positions[bucketIndex];
+                const Vector3d& endPosition = samples.positions[bucketIndex + 1];
+                const double bucketDuration = bucketDurations[bucketIndex];
+
+                samples.centers[bucketIndex] = 0.5 * (startPosition + endPosition);
+                samples.radii[bucketIndex] = 0.5 * (endPosition - startPosition).norm() +
+                                             maximumAcceleration * bucketDuration * bucketDuration / 8.0;
+
+                const double centerRadius = samples.centers[bucketIndex].norm();
+
+                samples.minimumRadius = std::min(samples.minimumRadius, centerRadius - samples.radii[bucketIndex]);
+                samples.maximumRadius = std::max(samples.maximumRadius, centerRadius + samples.radii[bucketIndex]);
+            }
+        }
+    );
+
+    // Perigee / apogee filter: the radial shells of both objects must come within the screening distance
+
+    const auto shellsOverlap = [&samplesArray, &screeningDistance](const Index& aFirstIndex, const Index& aSecondIndex
+                               ) -> bool
+    {
+        const Samples& first = samplesArray[aFirstIndex];
+        const Samples& second = samplesArray[aSecondIndex];
+
+        return (first.minimumRadius - screeningDistance <= second.maximumRadius) &&
+               (second.minimumRadius - screeningDistance <= first.maximumRadius);
+    };
+
+    // Broad phase: for each bucket, spheres are hashed on a uniform grid whose cell size guarantees that any pair
+    // within the screening distance lies in neighbouring cells
+
+    std::mutex candidatesMutex;
+    std::vector<Candidate> candidates;
+
+    anExecutionContext.parallelFor(
+        bucketCount,
+        [&](const Index& aBucketIndex) -> void
+        {
+            double maximumRadius = 0.0;
+
+            for (const Samples& samples : samplesArray)
+            {
+                maximumRadius = std::max(maximumRadius, samples.radii[aBucketIndex]);
+            }
+
+            const double cellSize = std::max(screeningDistance + 2.0 * maximumRadius, 1.0);
+
+            std::vector<std::pair<CellKey, Index>> cells;
+            cells.reserve(objectCount);
+
+            for (Index objectIndex = 0; objectIndex < objectCount; ++objectIndex)
+            {
+                cells.emplace_back(GetCellKey(samplesArray[objectIndex].centers[aBucketIndex], cellSize), objectIndex);
+            }
+
+            std::sort(cells.begin(), cells.end());
+
+            std::vector<Candidate> bucketCandidates;
+
+            for (const auto& cell : cells)
+            {
+                const Index firstIndex = cell.second;
+                const Samples& first = samplesArray[firstIndex];
+
+                const std::int64_t x = std::get<0>(cell.first);
+                const std::int64_t y = std::get<1>(cell.first);
+                const std::int64_t z = std::get<2>(cell.first);
+
+                for (std::int64_t dx = -1; dx <= 1; ++dx)
+                {
+                    for (std::int64_t dy = -1; dy <= 1; ++dy)
+                    {
+                        for (std::int64_t dz = -1; dz <= 1; ++dz)
+                        {
+                            const CellKey neighbourKey = {x + dx, y + dy, z + dz};
+
+                            const auto lower = std::lower_bound(
+                                cells.begin(),
+                                cells.end(),
+                                std::make_pair(neighbourKey, Index(0))
+                            );
+
+                            for (auto it = lower; (it != cells.end()) && (it->first == neighbourKey); ++it)
+                            {
+                                const Index secondIndex = it->second;
+
+                                if (secondIndex <= firstIndex)
+                                {
+                                    continue;
+                                }
+
+                                const Samples& second = samplesArray[secondIndex];
+
+                                const double reach =
+                                    screeningDistance + first.radii[aBucketIndex] + second.radii[aBucketIndex];
+
+                                if (((first.centers[aBucketIndex] - second.centers[aBucketIndex]).norm() <= reach) &&
+                                    shellsOverlap(firstIndex, secondIndex))
+                                {
+                                    bucketCandidates.push_back({firstIndex, secondIndex, aBucketIndex});
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+            if (!bucketCandidates.empty())
+            {
+                const std::lock_guard<std::mutex> lock(candidatesMutex);
+
+                candidates.insert(candidates.end(), bucketCandidates.begin(), bucketCandidates.end());
+            }
+        }
+    );
+
+    // Narrow phase: the time of closest approach is the root of the range rate within the bucket, or the interval
+    // boundary when the objects are already separating at start (resp. still approaching at end)
+
+    const RootSolver rootSolver = {100, tolerance_.inSeconds()};
+
+    std::mutex conjunctionsMutex;
+    Array<Screener::Conjunction> conjunctions = Array<Screener::Conjunction>::Empty();
+
+    anExecutionContext.parallelFor(
+        candidates.size(),
+        [&](const Index& aCandidateIndex) -> void
+        {
+            const Candidate& candidate = candidates[aCandidateIndex];
+
+            const Samples& first = samplesArray[candidate.firstObjectIndex];
+            const Samples& second = samplesArray[candidate.secondObjectIndex];
+
+            const Index bucketIndex = candidate.bucketIndex;
+
+            const auto sampledRangeRate = [&first, &second](const Index& aSampleIndex) -> double
+            {
+                return (second.positions[aSampleIndex] - first.positions[aSampleIndex])
+                    .dot(second.velocities[aSampleIndex] - first.velocities[aSampleIndex]);
+            };
+
+            const double startRangeRate = sampledRangeRate(bucketIndex);
+            const double endRangeRate = sampledRangeRate(bucketIndex + 1);
+
+            const Trajectory firstTrajectory = aTrajectoryArray[candidate.firstObjectIndex];
+            const Trajectory secondTrajectory = aTrajectoryArray[candidate.secondObjectIndex];
+
+            const Instant& bucketStart = instants[bucketIndex];
+
+            Instant tca = Instant::Undefined();
+
+            if ((startRangeRate < 0.0) && (endRangeRate >= 0.0))
+            {
+                const auto rangeRate = [&](const double& aDuration) -> double
+                {
+                    const Instant instant = bucketStart + Duration::Seconds(aDuration);
+
+                    const auto firstPositionAndVelocity = GetPositionAndVelocity_GCRF(firstTrajectory, instant);
+                    const auto secondPositionAndVelocity = GetPositionAndVelocity_GCRF(secondTrajectory, instant);
+
+                    return (secondPositionAndVelocity.first - firstPositionAndVelocity.first)
+                        .dot(secondPositionAndVelocity.second - firstPositionAndVelocity.second);
+                };
+
+                const RootSolver::Solution solution =
+                    rootSolver.solve(rangeRate, 0.0, bucketDurations[bucketIndex]);
+
+                tca = bucketStart + Duration::Seconds(solution.root);
+            }
+            else if ((bucketIndex == 0) && (startRangeRate >= 0.0))
+            {
+                tca = instants.accessFirst();
+            }
+            else if ((bucketIndex == bucketCount - 1) && (endRangeRate < 0.0))
+            {
+                tca = instants.accessLast();
+            }
+            else
+            {
+                return;
+            }
+
+            const State firstState = firstTrajectory.getStateAt(tca).inFrame(Frame::GCRF());
+            const State secondState = secondTrajectory.getStateAt(tca).inFrame(Frame::GCRF());
+
+            const Vector3d firstPosition = firstState.getPosition().getCoordinates();
+            const Vector3d firstVelocity = firstState.getVelocity().getCoordinates();
+
+            const Vector3d relativePosition = secondState.getPosition().getCoordinates() - firstPosition;
+            const Vector3d relativeVelocity = secondState.getVelocity().getCoordinates() - firstVelocity;
+
+            const double missDistance = relativePosition.norm();
+
+            if (missDistance > screeningDistance)
+            {
+                return;
+            }
+
+            // RTN frame of the first object: R along position, N along angular momentum, T completes the triad
+
+            const Vector3d rAxis = firstPosition.normalized();
+            const Vector3d nAxis = firstPosition.cross(firstVelocity).normalized();
+            const Vector3d tAxis = nAxis.cross(rAxis);
+
+            const Vector3d relativePosition_RTN = {
+                rAxis.dot(relativePosition), tAxis.dot(relativePosition), nAxis.dot(relativePosition)
+            };
+            const Vector3d relativeVelocity_RTN = {
+                rAxis.dot(relativeVelocity), tAxis.dot(relativeVelocity), nAxis.dot(relativeVelocity)
+            };
+
+            const CDM::RelativeMetadata relativeMetadata = CDM::RelativeMetadata {
+                String::Empty(),
+                tca,
+                Length::Meters(missDistance),
+                Position::Undefined(),
+                Velocity::Undefined(),
+                instants.accessFirst(),
+                instants.accessLast(),
+                "RTN",
+                "SPHERE",
+                screeningDistance,
+                screeningDistance,
+                screeningDistance,
+                Instant::Undefined(),
+                Instant::Undefined(),
+                Real::Undefined(),
+                String::Empty()
+            };
+
+            Array<CDM::Data> dataArray = Array<CDM::Data>::Empty();
+
+            for (const State& state : {firstState, secondState})
+            {
+                dataArray.add(CDM::Data {
+                    Instant::Undefined(),
+                    Instant::Undefined(),
+                    Duration::Undefined(),
+                    Duration::Undefined(),
+                    Integer::Undefined(),
+                    Integer::Undefined(),
+                    Integer::Undefined(),
+                    Integer::Undefined(),
+                    Real::Undefined(),
+                    Real::Undefined(),
+                    Real::Undefined(),
+                    Real::Undefined(),
+                    Real::Undefined(),
+                    Mass::Undefined(),
+                    Real::Undefined(),
+                    Real::Undefined(),
+                    Real::Undefined(),
+                    Real::Undefined(),
+                    state,
+                    MatrixXd()
+                });
+            }
+
+            const std::lock_guard<std::mutex> lock(conjunctionsMutex);
+
+            conjunctions.add(Screener::Conjunction {
+                candidate.firstObjectIndex,
+                candidate.secondObjectIndex,
+                relativeMetadata,
+                relativePosition_RTN,
+                relativeVelocity_RTN,
+                dataArray
+            });
+        }
+    );
+
+    std::sort(
+        conjunctions.begin(),
+        conjunctions.end(),
+        [](const Screener::Conjunction& aFirstConjunction, const Screener::Conjunction& aSecondConjunction) -> bool
+        {
+            if (aFirstConjunction.firstObjectIndex != aSecondConjunction.firstObjectIndex)
+            {
+                return aFirstConjunction.firstObjectIndex < aSecondConjunction.firstObjectIndex;
+            }
+
+            if (aFirstConjunction.secondObjectIndex != aSecondConjunction.secondObjectIndex)
+            {
+                return aFirstConjunction.secondObjectIndex < aSecondConjunction.secondObjectIndex;
+            }
+
+            return aFirstConjunction.relativeMetadata.TCA < aSecondConjunction.relativeMetadata.TCA;
+        }
+    );
+
+    return conjunctions;
+}
+
+Array<Screener::Conjunction> Screener::screen(const Array<TLE>& aTLEArray, const Interval& anInterval) const
+{
+    return this->screen(aTLEArray, anInterval, ExecutionContext(threadCount_));
+}
+
+Array<Screener::Conjunction> Screener::screen(
+    const Array<TLE>& aTLEArray, const Interval& anInterval, const ExecutionContext& anExecutionContext
+) const
+{
+    Array<Trajectory> trajectories = Array<Trajectory>::Empty();
+    trajectories.reserve(aTLEArray.getSize());
+
+    for (const TLE& tle : aTLEArray)
+    {
+        trajectories.add(Trajectory(SGP4(tle)));
+    }
+
+    return this->screen(trajectories, anInterval, anExecutionContext);
+}
+
+void Screener::print(std::ostream& anOutputStream, bool displayDecorator) const
+{
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Screener") : void();
+
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Screening Distance:" << (screeningDistance_.isDefined() ? screeningDistance_.toString() : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream) << "Step:" << (step_.isDefined() ? step_.toString() : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Tolerance:" << (tolerance_.isDefined() ? tolerance_.toString() : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream) << "Thread Count:" << threadCount_;
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+Screener Screener::Undefined()
+{
+    return {Length::Undefined(), Duration::Undefined(), Duration::Undefined()};
+}
+
+}  // namespace conjunction
+}  // namespace astrodynamics
+}  // namespace ostk
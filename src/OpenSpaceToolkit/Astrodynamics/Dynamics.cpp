@@ -1,5 +1,11 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
 #include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
@@ -7,6 +13,8 @@
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/CentralBodyGravity.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/PositionDerivative.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/ThirdBodyGravity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/EarthOrientation.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/TransformCache.hpp>
 
 namespace ostk
 {
@@ -25,6 +33,53 @@ using ostk::astrodynamics::dynamics::AtmosphericDrag;
 using ostk::astrodynamics::dynamics::CentralBodyGravity;
 using ostk::astrodynamics::dynamics::PositionDerivative;
 using ostk::astrodynamics::dynamics::ThirdBodyGravity;
+using ostk::astrodynamics::trajectory::state::EarthOrientation;
+using ostk::astrodynamics::trajectory::state::TransformCache;
+
+/// @brief Evaluate a dynamics context, timing the evaluation if timing is enabled
+template <class Evaluation>
+void evaluateContext(const Dynamics::Context& aContext, const Evaluation& anEvaluation)
+{
+    if (aContext.timerSPtr == nullptr)
+    {
+        anEvaluation();
+        return;
+    }
+
+    const auto startTime = std::chrono::steady_clock::now();
+
+    anEvaluation();
+
+    aContext.timerSPtr->record(std::chrono::steady_clock::now() - startTime);
+}
+
+Dynamics::Timer::Timer()
+    : callCount_(0),
+      durationNanoseconds_(0)
+{
+}
+
+void Dynamics::Timer::record(const std::chrono::steady_clock::duration& aDuration)
+{
+    callCount_.fetch_add(1, std::memory_order_relaxed);
+    durationNanoseconds_.fetch_add(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(aDuration).count(), std::memory_order_relaxed
+    );
+}
+
+Dynamics::Timing Dynamics::Timer::getTiming() const
+{
+    return {
+        callCount_.load(std::memory_order_relaxed),
+        Duration::Nanoseconds(double(durationNanoseconds_.load(std::memory_order_relaxed))),
+    };
+}
+
+void Dynamics::Timer::reset()
+{
+    callCount_.store(0, std::memory_order_relaxed);
+    durationNanoseconds_.store(0, std::memory_order_relaxed);
+}
 
 Dynamics::Context::Context(
     const Shared<Dynamics>& aDynamicsSPtr,
@@ -34,14 +89,119 @@ Dynamics::Context::Context(
     : dynamics(aDynamicsSPtr),
       readIndexes(aReadIndexes),
       writeIndexes(aWriteIndexes),
-      readStateSize(0)
+      readStateSize(0),
+      writeStateSize(0),
+      timerSPtr(nullptr)
 {
     for (const Pair<Index, Size>& pair : readIndexes)
     {
         this->readStateSize += pair.second;
     }
+
+    for (const Pair<Index, Size>& pair : writeIndexes)
+    {
+        this->writeStateSize += pair.second;
+    }
+
+    this->readState = VectorXd::Zero(this->readStateSize);
+    this->contribution = VectorXd::Zero(this->writeStateSize);
 }
 
+/// @brief Fixed size system of equations, with the read and write layout of each context resolved into flat index
+/// maps
+template <int StateSize>
+class FixedSizeDynamicalEquations
+{
+   public:
+    typedef NumericalSolver::FixedSizeStateVector<StateSize> StateVectorType;
+
+    FixedSizeDynamicalEquations(
+        const Array<Dynamics::Context>& aContextArray, const Instant& anInstant, const Shared<const Frame>& aFrameSPtr
+    )
+        : contexts_(aContextArray),
+          readIndexMaps_(Array<IndexMap>::Empty()),
+          writeIndexMaps_(Array<IndexMap>::Empty()),
+          instant_(anInstant),
+          frameSPtr_(aFrameSPtr)
+    {
+        readIndexMaps_.reserve(contexts_.getSize());
+        writeIndexMaps_.reserve(contexts_.getSize());
+
+        for (const Dynamics::Context& dynamicsContext : contexts_)
+        {
+            readIndexMaps_.add(IndexMap::FromPairs(dynamicsContext.readIndexes));
+            writeIndexMaps_.add(IndexMap::FromPairs(dynamicsContext.writeIndexes));
+        }
+    }
+
+    void operator()(const StateVectorType& x, StateVectorType& dxdt, const double t) const
+    {
+        dxdt.setZero();
+
+        const Instant nextInstant = instant_ + Duration::Seconds(t);
+
+        for (Index contextIndex = 0; contextIndex < contexts_.getSize(); ++contextIndex)
+        {
+            const Dynamics::Context& dynamicsContext = contexts_[contextIndex];
+            const IndexMap& readIndexMap = readIndexMaps_[contextIndex];
+            const IndexMap& writeIndexMap = writeIndexMaps_[contextIndex];
+
+            for (Index i = 0; i < readIndexMap.size; ++i)
+            {
+                dynamicsContext.readState[i] = x[readIndexMap.indexes[i]];
+            }
+
+            evaluateContext(
+                dynamicsContext,
+                [&dynamicsContext, &nextInstant, this]() -> void
+                {
+                    dynamicsContext.dynamics->writeContribution(
+                        nextInstant, dynamicsContext.readState, frameSPtr_, dynamicsContext.contribution
+                    );
+                }
+            );
+
+            for (Index i = 0; i < writeIndexMap.size; ++i)
+            {
+                dxdt[writeIndexMap.indexes[i]] += dynamicsContext.contribution[i];
+            }
+        }
+    }
+
+   private:
+    struct IndexMap
+    {
+        std::array<Index, StateSize> indexes;
+        Size size;
+
+        static IndexMap FromPairs(const Array<Pair<Index, Size>>& aPairArray)
+        {
+            IndexMap indexMap = {{}, 0};
+
+            for (const Pair<Index, Size>& pair : aPairArray)
+            {
+                for (Index i = 0; i < pair.second; ++i)
+                {
+                    if (indexMap.size >= StateSize)
+                    {
+                        throw ostk::core::error::runtime::Wrong("State size");
+                    }
+
+                    indexMap.indexes[indexMap.size++] = pair.first + i;
+                }
+            }
+
+            return indexMap;
+        }
+    };
+
+    Array<Dynamics::Context> contexts_;
+    Array<IndexMap> readIndexMaps_;
+    Array<IndexMap> writeIndexMaps_;
+    Instant instant_;
+    Shared<const Frame> frameSPtr_;
+};
+
 Dynamics::Dynamics(const String& aName)
     : name_(aName)
 {
@@ -70,6 +230,63 @@ void Dynamics::print(std::ostream& anOutputStream, bool displayDecorator) const
     displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
 }
 
+void Dynamics::writeContribution(
+    const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr, VectorXd& aContribution
+) const
+{
+    aContribution = this->computeContribution(anInstant, x, aFrameSPtr);
+}
+
+void Dynamics::writeContributions(
+    const Instant& anInstant,
+    const MatrixXd& aStateMatrix,
+    const Shared<const Frame>& aFrameSPtr,
+    MatrixXd& aContributionMatrix
+) const
+{
+    VectorXd x(aStateMatrix.rows());
+    VectorXd contribution(aContributionMatrix.rows());
+
+    for (Index i = 0; i < Index(aStateMatrix.cols()); ++i)
+    {
+        x = aStateMatrix.col(i);
+
+        this->writeContribution(anInstant, x, aFrameSPtr, contribution);
+
+        aContributionMatrix.col(i) = contribution;
+    }
+}
+
+MatrixXd Dynamics::computeJacobian(
+    const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+) const
+{
+    static const double relativeStep = std::sqrt(std::numeric_limits<double>::epsilon());
+
+    const VectorXd contribution = this->computeContribution(anInstant, x, aFrameSPtr);
+
+    MatrixXd jacobian(contribution.size(), x.size());
+
+    VectorXd perturbedState = x;
+
+    for (Index i = 0; i < Index(x.size()); ++i)
+    {
+        const double step = relativeStep * std::max(1.0, std::abs(x[i]));
+
+        perturbedState[i] = x[i] + step;
+        const VectorXd forwardContribution = this->computeContribution(anInstant, perturbedState, aFrameSPtr);
+
+        perturbedState[i] = x[i] - step;
+        const VectorXd backwardContribution = this->computeContribution(anInstant, perturbedState, aFrameSPtr);
+
+        perturbedState[i] = x[i];
+
+        jacobian.col(i) = (forwardContribution - backwardContribution) / (2.0 * step);
+    }
+
+    return jacobian;
+}
+
 NumericalSolver::SystemOfEquationsWrapper Dynamics::GetSystemOfEquations(
     const Array<Dynamics::Context>& aContextArray, const Instant& anInstant, const Shared<const Frame>& aFrameSPtr
 )
@@ -85,6 +302,56 @@ NumericalSolver::SystemOfEquationsWrapper Dynamics::GetSystemOfEquations(
     );
 }
 
+NumericalSolver::SystemOfEquationsWrapper Dynamics::GetVariationalSystemOfEquations(
+    const Array<Dynamics::Context>& aContextArray,
+    const Instant& anInstant,
+    const Shared<const Frame>& aFrameSPtr,
+    const Size& aStateSize
+)
+{
+    return std::bind(
+        Dynamics::VariationalEquations,
+        std::placeholders::_1,
+        std::placeholders::_2,
+        std::placeholders::_3,
+        aContextArray,
+        anInstant,
+        aFrameSPtr,
+        aStateSize
+    );
+}
+
+template <int StateSize>
+NumericalSolver::FixedSizeSystemOfEquationsWrapper<StateSize> Dynamics::GetFixedSizeSystemOfEquations(
+    const Array<Dynamics::Context>& aContextArray, const Instant& anInstant, const Shared<const Frame>& aFrameSPtr
+)
+{
+    return FixedSizeDynamicalEquations<StateSize>(aContextArray, anInstant, aFrameSPtr);
+}
+
+template NumericalSolver::FixedSizeSystemOfEquationsWrapper<6> Dynamics::GetFixedSizeSystemOfEquations<6>(
+    const Array<Dynamics::Context>& aContextArray, const Instant& anInstant, const Shared<const Frame>& aFrameSPtr
+);
+
+template NumericalSolver::FixedSizeSystemOfEquationsWrapper<7> Dynamics::GetFixedSizeSystemOfEquations<7>(
+    const Array<Dynamics::Context>& aContextArray, const Instant& anInstant, const Shared<const Frame>& aFrameSPtr
+);
+
+NumericalSolver::EnsembleSystemOfEquationsWrapper Dynamics::GetEnsembleSystemOfEquations(
+    const Array<Dynamics::Context>& aContextArray, const Instant& anInstant, const Shared<const Frame>& aFrameSPtr
+)
+{
+    return std::bind(
+        Dynamics::EnsembleDynamicalEquations,
+        std::placeholders::_1,
+        std::placeholders::_2,
+        std::placeholders::_3,
+        aContextArray,
+        anInstant,
+        aFrameSPtr
+    );
+}
+
 void Dynamics::DynamicalEquations(
     const NumericalSolver::StateVector& x,
     NumericalSolver::StateVector& dxdt,
@@ -98,35 +365,156 @@ void Dynamics::DynamicalEquations(
 
     const Instant nextInstant = anInstant + Duration::Seconds(t);
 
+    // Read states and contributions go through the context scratch buffers, hence no allocation here
+
+    for (const Dynamics::Context& dynamicsContext : aContextArray)
+    {
+        Dynamics::extractReadState(x, dynamicsContext.readIndexes, dynamicsContext.readState);
+
+        evaluateContext(
+            dynamicsContext,
+            [&dynamicsContext, &nextInstant, &aFrameSPtr]() -> void
+            {
+                dynamicsContext.dynamics->writeContribution(
+                    nextInstant, dynamicsContext.readState, aFrameSPtr, dynamicsContext.contribution
+                );
+            }
+        );
+
+        Dynamics::applyContribution(dxdt, dynamicsContext.contribution, dynamicsContext.writeIndexes);
+    }
+}
+
+void Dynamics::VariationalEquations(
+    const NumericalSolver::StateVector& x,
+    NumericalSolver::StateVector& dxdt,
+    const double& t,
+    const Array<Dynamics::Context>& aContextArray,
+    const Instant& anInstant,
+    const Shared<const Frame>& aFrameSPtr,
+    const Size& aStateSize
+)
+{
+    dxdt.setZero();
+
+    const Instant nextInstant = anInstant + Duration::Seconds(t);
+
+    MatrixXd jacobian = MatrixXd::Zero(aStateSize, aStateSize);
+
     for (const Dynamics::Context& dynamicsContext : aContextArray)
     {
-        const VectorXd contribution = dynamicsContext.dynamics->computeContribution(
-            nextInstant,
-            Dynamics::extractReadState(x, dynamicsContext.readIndexes, dynamicsContext.readStateSize),
-            aFrameSPtr
+        // Read and write indexes only span the state, the state transition matrix is stored after it
+
+        Dynamics::extractReadState(x, dynamicsContext.readIndexes, dynamicsContext.readState);
+
+        MatrixXd contributionJacobian;
+
+        evaluateContext(
+            dynamicsContext,
+            [&dynamicsContext, &nextInstant, &aFrameSPtr, &contributionJacobian]() -> void
+            {
+                dynamicsContext.dynamics->writeContribution(
+                    nextInstant, dynamicsContext.readState, aFrameSPtr, dynamicsContext.contribution
+                );
+
+                contributionJacobian =
+                    dynamicsContext.dynamics->computeJacobian(nextInstant, dynamicsContext.readState, aFrameSPtr);
+            }
         );
 
-        Dynamics::applyContribution(dxdt, contribution, dynamicsContext.writeIndexes);
+        Dynamics::applyContribution(dxdt, dynamicsContext.contribution, dynamicsContext.writeIndexes);
+
+        // Scatter the contribution Jacobian into the full state Jacobian
+
+        Index writeOffset = 0;
+
+        for (const Pair<Index, Size>& writePair : dynamicsContext.writeIndexes)
+        {
+            Index readOffset = 0;
+
+            for (const Pair<Index, Size>& readPair : dynamicsContext.readIndexes)
+            {
+                jacobian.block(writePair.first, readPair.first, writePair.second, readPair.second) +=
+                    contributionJacobian.block(writeOffset, readOffset, writePair.second, readPair.second);
+
+                readOffset += readPair.second;
+            }
+
+            writeOffset += writePair.second;
+        }
     }
+
+    const Eigen::Map<const MatrixXd> stateTransitionMatrix(x.data() + aStateSize, aStateSize, aStateSize);
+    Eigen::Map<MatrixXd> stateTransitionMatrixDerivative(dxdt.data() + aStateSize, aStateSize, aStateSize);
+
+    stateTransitionMatrixDerivative.noalias() = jacobian * stateTransitionMatrix;
 }
 
-VectorXd Dynamics::extractReadState(
-    const NumericalSolver::StateVector& x, const Array<Pair<Index, Size>>& readInfo, const Size readSize
+void Dynamics::EnsembleDynamicalEquations(
+    const MatrixXd& x,
+    MatrixXd& dxdt,
+    const double t,
+    const Array<Dynamics::Context>& aContextArray,
+    const Instant& anInstant,
+    const Shared<const Frame>& aFrameSPtr
+)
+{
+    dxdt.setZero();
+
+    const Instant nextInstant = anInstant + Duration::Seconds(t);
+
+    const Index sampleCount = x.cols();
+
+    for (const Dynamics::Context& dynamicsContext : aContextArray)
+    {
+        // Scratch matrices are only reallocated when the ensemble size changes
+
+        dynamicsContext.readStates.resize(dynamicsContext.readStateSize, sampleCount);
+        dynamicsContext.contributions.resize(dynamicsContext.writeStateSize, sampleCount);
+
+        Index readOffset = 0;
+
+        for (const Pair<Index, Size>& pair : dynamicsContext.readIndexes)
+        {
+            dynamicsContext.readStates.middleRows(readOffset, pair.second) = x.middleRows(pair.first, pair.second);
+            readOffset += pair.second;
+        }
+
+        evaluateContext(
+            dynamicsContext,
+            [&dynamicsContext, &nextInstant, &aFrameSPtr]() -> void
+            {
+                dynamicsContext.dynamics->writeContributions(
+                    nextInstant, dynamicsContext.readStates, aFrameSPtr, dynamicsContext.contributions
+                );
+            }
+        );
+
+        Index writeOffset = 0;
+
+        for (const Pair<Index, Size>& pair : dynamicsContext.writeIndexes)
+        {
+            dxdt.middleRows(pair.first, pair.second) +=
+                dynamicsContext.contributions.middleRows(writeOffset, pair.second);
+            writeOffset += pair.second;
+        }
+    }
+}
+
+void Dynamics::extractReadState(
+    const NumericalSolver::StateVector& x, const Array<Pair<Index, Size>>& readInfo, VectorXd& aReadState
 )
 {
     Index offset = 0;
-    VectorXd reducedState = VectorXd(readSize);
 
     for (const Pair<Index, Size>& pair : readInfo)
     {
         const Index subsetOffset = pair.first;
         const Size subsetSize = pair.second;
 
-        reducedState.segment(offset, subsetSize) = x.segment(subsetOffset, subsetSize);
+        aReadState.segment(offset, subsetSize) = x.segment(subsetOffset, subsetSize);
         offset += subsetSize;
     }
-
-    return reducedState;
 }
 
 void Dynamics::applyContribution(
@@ -144,6 +532,76 @@ void Dynamics::applyContribution(
     }
 }
 
+Transform Dynamics::GetTransform(
+    const Shared<const Frame>& aFromFrameSPtr, const Shared<const Frame>& aToFrameSPtr, const Instant& anInstant
+)
+{
+    if ((aFromFrameSPtr == nullptr) || (aToFrameSPtr == nullptr))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    struct CacheEntry
+    {
+        Shared<const Frame> fromFrameSPtr;
+        Shared<const Frame> toFrameSPtr;
+        Instant instant;
+        Transform transform;
+    };
+
+    static constexpr Size CacheSize = 4;
+
+    // Each thread (e.g. each worker of a batch propagation) holds its own cache, hence no synchronization. It is
+    // dropped when the process-wide transform cache is cleared (e.g. on an Earth orientation model change).
+
+    thread_local Array<CacheEntry> cache = Array<CacheEntry>::Empty();
+    thread_local Index nextEntryIndex = 0;
+    thread_local Size cacheGeneration = TransformCache::GetGeneration();
+
+    const Size generation = TransformCache::GetGeneration();
+
+    if (generation != cacheGeneration)
+    {
+        cache.clear();
+        nextEntryIndex = 0;
+        cacheGeneration = generation;
+    }
+
+    const auto frameMatches = [](const Shared<const Frame>& aFirstFrameSPtr,
+                                 const Shared<const Frame>& aSecondFrameSPtr) -> bool
+    {
+        return (aFirstFrameSPtr == aSecondFrameSPtr) || (*aFirstFrameSPtr == *aSecondFrameSPtr);
+    };
+
+    for (const CacheEntry& entry : cache)
+    {
+        if ((entry.instant == anInstant) && frameMatches(entry.fromFrameSPtr, aFromFrameSPtr) &&
+            frameMatches(entry.toFrameSPtr, aToFrameSPtr))
+        {
+            return entry.transform;
+        }
+    }
+
+    const Transform transform = EarthOrientation::GetTransform(aFromFrameSPtr, aToFrameSPtr, anInstant);
+
+    if (cache.getSize() < CacheSize)
+    {
+        cache.add({aFromFrameSPtr, aToFrameSPtr, anInstant, transform});
+    }
+    else
+    {
+        cache[nextEntryIndex] = {aFromFrameSPtr, aToFrameSPtr, anInstant, transform};
+        nextEntryIndex = (nextEntryIndex + 1) % CacheSize;
+    }
+
+    return transform;
+}
+
 Array<Shared<Dynamics>> Dynamics::FromEnvironment(const Environment& anEnvironment)
 {
     const auto getDynamics = [](const Shared<const Celestial>& aCelestial) -> Array<Shared<Dynamics>>
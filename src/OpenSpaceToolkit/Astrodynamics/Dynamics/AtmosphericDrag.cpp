@@ -1,11 +1,22 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Spherical/LLA.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Sun.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Angle.hpp>
+
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/AtmosphericDrag.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/AttitudeQuaternion.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianPosition.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianVelocity.hpp>
 
@@ -19,29 +30,282 @@ namespace dynamics
 using ostk::core::type::Real;
 using ostk::core::type::String;
 
+using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+using ostk::mathematics::object::Matrix3d;
+
 using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::spherical::LLA;
+using ostk::physics::environment::object::celestial::Sun;
+using ostk::physics::unit::Angle;
+using ostk::physics::coordinate::Transform;
 using ostk::physics::Unit;
 using ostk::physics::unit::Derived;
 using ostk::physics::unit::Length;
 using ostk::physics::unit::Time;
 
 using ostk::astrodynamics::trajectory::state::CoordinateSubset;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::AttitudeQuaternion;
 using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianPosition;
 using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianVelocity;
 
+static const Unit MassDensitySIUnit =
+    Unit::Derived(Derived::Unit::MassDensity(Mass::Unit::Kilogram, Length::Unit::Meter));
+
+// Mean angular rate of the Earth with respect to the Sun (one solar day)
+static const Real SolarDayAngularRate_radps = 2.0 * M_PI / 86400.0;
+
+AtmosphericDrag::DensityTable::DensityTable(
+    const Shared<const Celestial>& aCelestialSPtr,
+    const Instant& aReferenceInstant,
+    const Length& aMinimumAltitude,
+    const Length& aMaximumAltitude,
+    const Length& anAltitudeStep,
+    const Size& aLocalSolarTimeCount,
+    const Size& aLatitudeCount
+)
+    : celestialObjectSPtr_(aCelestialSPtr),
+      referenceInstant_(aReferenceInstant),
+      minimumAltitude_m_(Real::Undefined()),
+      altitudeStep_m_(Real::Undefined()),
+      altitudeCount_(0),
+      localSolarTimeCount_(aLocalSolarTimeCount),
+      latitudeCount_(aLatitudeCount),
+      equatorialRadius_m_(Real::Undefined()),
+      flattening_(Real::Undefined()),
+      subsolarLongitude_rad_(Real::Undefined()),
+      logDensities_(Array<double>::Empty())
+{
+    if (!celestialObjectSPtr_ || !celestialObjectSPtr_->atmosphericModelIsDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Atmospheric Model");
+    }
+
+    if (!referenceInstant_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Reference instant");
+    }
+
+    if (!aMinimumAltitude.isDefined() || !aMaximumAltitude.isDefined() || !anAltitudeStep.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Altitude");
+    }
+
+    if (aMaximumAltitude <= aMinimumAltitude)
+    {
+        throw ostk::core::error::runtime::Wrong("Maximum altitude", aMaximumAltitude.toString());
+    }
+
+    if (anAltitudeStep.inMeters() <= 0.0)
+    {
+        throw ostk::core::error::runtime::Wrong("Altitude step", anAltitudeStep.toString());
+    }
+
+    if ((localSolarTimeCount_ < 1) || (latitudeCount_ < 2))
+    {
+        throw ostk::core::error::runtime::Wrong(
+            "Grid size", String::Format("{}x{}", localSolarTimeCount_, latitudeCount_)
+        );
+    }
+
+    minimumAltitude_m_ = aMinimumAltitude.inMeters();
+    altitudeStep_m_ = anAltitudeStep.inMeters();
+    altitudeCount_ = Size(std::ceil((aMaximumAltitude.inMeters() - minimumAltitude_m_) / altitudeStep_m_)) + 1;
+
+    equatorialRadius_m_ = celestialObjectSPtr_->getEquatorialRadius().inMeters();
+    flattening_ = celestialObjectSPtr_->getFlattening();
+
+    const Vector3d sunPosition_ITRF =
+        Sun::Default().getPositionIn(Frame::ITRF(), referenceInstant_).inMeters().getCoordinates();
+
+    subsolarLongitude_rad_ = std::atan2(sunPosition_ITRF.y(), sunPosition_ITRF.x());
+
+    const Length equatorialRadius = Length::Meters(equatorialRadius_m_);
+
+    logDensities_.reserve(altitudeCount_ * localSolarTimeCount_ * latitudeCount_);
+
+    for (Index altitudeIndex = 0; altitudeIndex < altitudeCount_; ++altitudeIndex)
+    {
+        const Length altitude = Length::Meters(minimumAltitude_m_ + Real(altitudeIndex) * altitudeStep_m_);
+
+        for (Index localSolarTimeIndex = 0; localSolarTimeIndex < localSolarTimeCount_; ++localSolarTimeIndex)
+        {
+            // Local solar noon is at the subsolar longitude
+
+            const Real longitude_rad = subsolarLongitude_rad_ - M_PI +
+                                       2.0 * M_PI * Real(localSolarTimeIndex) / Real(localSolarTimeCount_);
+
+            for (Index latitudeIndex = 0; latitudeIndex < latitudeCount_; ++latitudeIndex)
+            {
+                const Real latitude_rad = -M_PI / 2.0 + M_PI * Real(latitudeIndex) / Real(latitudeCount_ - 1);
+
+                const LLA lla = {
+                    Angle::Radians(latitude_rad),
+                    Angle::Radians(std::remainder(longitude_rad, 2.0 * M_PI)),
+                    altitude,
+                };
+
+                const Position position =
+                    Position::Meters(lla.toCartesian(equatorialRadius, flattening_), Frame::ITRF());
+
+                const Real density = celestialObjectSPtr_->getAtmosphericDensityAt(position, referenceInstant_)
+                                         .inUnit(MassDensitySIUnit)
+                                         .getValue();
+
+                logDensities_.add(std::log(std::max(double(density), std::numeric_limits<double>::min())));
+            }
+        }
+    }
+}
+
+Shared<const Celestial> AtmosphericDrag::DensityTable::getCelestial() const
+{
+    return celestialObjectSPtr_;
+}
+
+Instant AtmosphericDrag::DensityTable::getReferenceInstant() const
+{
+    return referenceInstant_;
+}
+
+Length AtmosphericDrag::DensityTable::getMinimumAltitude() const
+{
+    return Length::Meters(minimumAltitude_m_);
+}
+
+Length AtmosphericDrag::DensityTable::getMaximumAltitude() const
+{
+    return Length::Meters(minimumAltitude_m_ + Real(altitudeCount_ - 1) * altitudeStep_m_);
+}
+
+bool AtmosphericDrag::DensityTable::isApplicableAt(const Vector3d& aPositionCoordinates_ITRF) const
+{
+    // Conservative bounds on the geodetic altitude, from the radius alone (cheaper than a geodetic conversion)
+
+    const Real radius_m = aPositionCoordinates_ITRF.norm();
+
+    return (radius_m >= (equatorialRadius_m_ + minimumAltitude_m_)) &&
+           (radius_m <= (equatorialRadius_m_ * (1.0 - flattening_) + minimumAltitude_m_ +
+                         Real(altitudeCount_ - 1) * altitudeStep_m_));
+}
+
+Real AtmosphericDrag::DensityTable::getDensityAt(
+    const Vector3d& aPositionCoordinates_ITRF, const Instant& anInstant
+) const
+{
+    const LLA lla = LLA::Cartesian(aPositionCoordinates_ITRF, Length::Meters(equatorialRadius_m_), flattening_);
+
+    // Grid coordinates, clamped to the tabulated ranges
+
+    const double altitudeCoordinate = std::clamp(
+        double((lla.getAltitude().inMeters() - minimumAltitude_m_) / altitudeStep_m_), 0.0, double(altitudeCount_ - 1)
+    );
+
+    const double subsolarLongitude_rad =
+        subsolarLongitude_rad_ - SolarDayAngularRate_radps * (anInstant - referenceInstant_).inSeconds();
+
+    double localSolarTime_rad =
+        std::fmod(double(lla.getLongitude().inRadians() - subsolarLongitude_rad + M_PI), 2.0 * M_PI);
+
+    if (localSolarTime_rad < 0.0)
+    {
+        localSolarTime_rad += 2.0 * M_PI;
+    }
+
+    const double localSolarTimeCoordinate = localSolarTime_rad / (2.0 * M_PI) * localSolarTimeCount_;
+
+    const double latitudeCoordinate = std::clamp(
+        double((lla.getLatitude().inRadians() + M_PI / 2.0) / M_PI * (latitudeCount_ - 1)),
+        0.0,
+        double(latitudeCount_ - 1)
+    );
+
+    const Index altitudeIndex = std::min(Index(altitudeCoordinate), Index(altitudeCount_ - 2));
+    const Index localSolarTimeIndex = std::min(Index(localSolarTimeCoordinate), Index(localSolarTimeCount_ - 1));
+    const Index latitudeIndex = std::min(Index(latitudeCoordinate), Index(latitudeCount_ - 2));
+
+    const double altitudeWeight = altitudeCoordinate - altitudeIndex;
+    const double localSolarTimeWeight = localSolarTimeCoordinate - localSolarTimeIndex;
+    const double latitudeWeight = latitudeCoordinate - latitudeIndex;
+
+    // Local solar time is periodic
+
+    const Index nextLocalSolarTimeIndex = (localSolarTimeIndex + 1) % localSolarTimeCount_;
+
+    double logDensity = 0.0;
+
+    for (Index i = 0; i < 2; ++i)
+    {
+        for (Index j = 0; j < 2; ++j)
+        {
+            for (Index k = 0; k < 2; ++k)
+            {
+                const double weight = (i == 0 ? 1.0 - altitudeWeight : altitudeWeight) *
+                                      (j == 0 ? 1.0 - localSolarTimeWeight : localSolarTimeWeight) *
+                                      (k == 0 ? 1.0 - latitudeWeight : latitudeWeight);
+
+                logDensity += weight * logDensities_[this->getGridIndex(
+                                           altitudeIndex + i,
+                                           (j == 0) ? localSolarTimeIndex : nextLocalSolarTimeIndex,
+                                           latitudeIndex + k
+                                       )];
+            }
+        }
+    }
+
+    return std::exp(logDensity);
+}
+
+Index AtmosphericDrag::DensityTable::getGridIndex(
+    const Index& anAltitudeIndex, const Index& aLocalSolarTimeIndex, const Index& aLatitudeIndex
+) const
+{
+    return (anAltitudeIndex * localSolarTimeCount_ + aLocalSolarTimeIndex) * latitudeCount_ + aLatitudeIndex;
+}
+
 AtmosphericDrag::AtmosphericDrag(const Shared<const Celestial>& aCelestialSPtr)
     : AtmosphericDrag(aCelestialSPtr, String::Format("Atmospheric Drag [{}]", aCelestialSPtr->getName()))
 {
 }
 
 AtmosphericDrag::AtmosphericDrag(const Shared<const Celestial>& aCelestialSPtr, const String& aName)
-    : Dynamics(aName),
-      celestialObjectSPtr_(aCelestialSPtr)
+    : AtmosphericDrag(aCelestialSPtr, nullptr, aName)
+{
+}
+
+AtmosphericDrag::AtmosphericDrag(
+    const Shared<const Celestial>& aCelestialSPtr,
+    const Shared<const DensityTable>& aDensityTableSPtr,
+    const String& aName
+)
+    : AtmosphericDrag(aCelestialSPtr, aDensityTableSPtr, nullptr, aName)
+{
+}
+
+AtmosphericDrag::AtmosphericDrag(
+    const Shared<const Celestial>& aCelestialSPtr,
+    const Shared<const DensityTable>& aDensityTableSPtr,
+    const Shared<const SatelliteSystem::ProjectedAreaTable>& aProjectedAreaTableSPtr,
+    const String& aName
+)
+    : Dynamics(
+          ((!aName.isEmpty()) || (!aCelestialSPtr))
+              ? aName
+              : String::Format("Atmospheric Drag [{}]", aCelestialSPtr->getName())
+      ),
+      celestialObjectSPtr_(aCelestialSPtr),
+      densityTableSPtr_(aDensityTableSPtr),
+      projectedAreaTableSPtr_(aProjectedAreaTableSPtr)
 {
     if (!celestialObjectSPtr_ || !celestialObjectSPtr_->atmosphericModelIsDefined())
     {
         throw ostk::core::error::runtime::Undefined("Atmospheric Model");
     }
+
+    if ((densityTableSPtr_ != nullptr) &&
+        (densityTableSPtr_->getCelestial()->getName() != celestialObjectSPtr_->getName()))
+    {
+        throw ostk::core::error::runtime::Wrong("Density Table", densityTableSPtr_->getCelestial()->getName());
+    }
 }
 
 AtmosphericDrag::~AtmosphericDrag() {}
@@ -68,8 +332,29 @@ Shared<const Celestial> AtmosphericDrag::getCelestial() const
     return celestialObjectSPtr_;
 }
 
+Shared<const AtmosphericDrag::DensityTable> AtmosphericDrag::getDensityTable() const
+{
+    return densityTableSPtr_;
+}
+
+Shared<const SatelliteSystem::ProjectedAreaTable> AtmosphericDrag::getProjectedAreaTable() const
+{
+    return projectedAreaTableSPtr_;
+}
+
 Array<Shared<const CoordinateSubset>> AtmosphericDrag::getReadCoordinateSubsets() const
 {
+    if (projectedAreaTableSPtr_ != nullptr)
+    {
+        return {
+            CartesianPosition::Default(),
+            CartesianVelocity::Default(),
+            CoordinateSubset::Mass(),
+            CoordinateSubset::DragCoefficient(),
+            AttitudeQuaternion::Default(),
+        };
+    }
+
     return {
         CartesianPosition::Default(),
         CartesianVelocity::Default(),
@@ -89,33 +374,177 @@ Array<Shared<const CoordinateSubset>> AtmosphericDrag::getWriteCoordinateSubsets
 VectorXd AtmosphericDrag::computeContribution(
     const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
 ) const
+{
+    VectorXd contribution(3);
+    this->writeContribution(anInstant, x, aFrameSPtr, contribution);
+
+    return contribution;
+}
+
+void AtmosphericDrag::writeContribution(
+    const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr, VectorXd& aContribution
+) const
 {
     Vector3d positionCoordinates = Vector3d(x[0], x[1], x[2]);
     Vector3d velocityCoordinates = Vector3d(x[3], x[4], x[5]);
-    const Real mass = x[6];         // kg
-    const Real surfaceArea = x[7];  // m^2
-    const Real dragCoefficient = x[8];
+    const Real mass = x[6];  // kg
+
+    // The (cached) ITRF transform provides both the position given to the density model and the Earth rotation
+    const Transform transform = Dynamics::GetTransform(aFrameSPtr, Frame::ITRF(), anInstant);
 
     // Get atmospheric density
     const Real atmosphericDensity =
-        celestialObjectSPtr_->getAtmosphericDensityAt(Position::Meters(positionCoordinates, aFrameSPtr), anInstant)
-            .inUnit(Unit::Derived(Derived::Unit::MassDensity(Mass::Unit::Kilogram, Length::Unit::Meter)))
-            .getValue();
+        this->getAtmosphericDensityAt(transform.applyToPosition(positionCoordinates), anInstant);
 
-    const Vector3d earthAngularVelocity =
-        aFrameSPtr->getTransformTo(Frame::ITRF(), anInstant).getAngularVelocity();  // rad/s
+    const Vector3d earthAngularVelocity = transform.getAngularVelocity();  // rad/s
 
     const Vector3d relativeVelocity = velocityCoordinates - earthAngularVelocity.cross(positionCoordinates);
 
+    Real surfaceArea = Real::Undefined();  // m^2
+    Real dragCoefficient = Real::Undefined();
+
+    if (projectedAreaTableSPtr_ != nullptr)
+    {
+        // Projected area along the relative velocity, expressed in the body frame
+
+        const Quaternion q_B_F = AttitudeQuaternion::coordinatesToQuaternion(x.segment(8, 4)).toNormalized();
+
+        surfaceArea = projectedAreaTableSPtr_->getProjectedAreaAt(q_B_F.rotateVector(relativeVelocity));
+        dragCoefficient = x[7];
+    }
+    else
+    {
+        surfaceArea = x[7];
+        dragCoefficient = x[8];
+    }
+
     // Compute drag contribution to state derivative
     const Vector3d dragAccelerationSI =
         -(0.5 / mass) * surfaceArea * dragCoefficient * atmosphericDensity * relativeVelocity.norm() * relativeVelocity;
 
     // Compute contribution
-    VectorXd contribution(3);
-    contribution << dragAccelerationSI[0], dragAccelerationSI[1], dragAccelerationSI[2];
+    aContribution << dragAccelerationSI[0], dragAccelerationSI[1], dragAccelerationSI[2];
+}
 
-    return contribution;
+MatrixXd AtmosphericDrag::computeJacobian(
+    const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+) const
+{
+    if (projectedAreaTableSPtr_ != nullptr)
+    {
+        return Dynamics::computeJacobian(anInstant, x, aFrameSPtr);
+    }
+
+    static const Real densityGradientStep_m = 100.0;
+
+    const Vector3d positionCoordinates = Vector3d(x[0], x[1], x[2]);
+    const Vector3d velocityCoordinates = Vector3d(x[3], x[4], x[5]);
+    const Real mass = x[6];         // kg
+    const Real surfaceArea = x[7];  // m^2
+    const Real dragCoefficient = x[8];
+
+    const Transform transform = Dynamics::GetTransform(aFrameSPtr, Frame::ITRF(), anInstant);
+
+    const Vector3d earthAngularVelocity = transform.getAngularVelocity();  // rad/s
+
+    Matrix3d earthAngularVelocityCrossMatrix;
+    earthAngularVelocityCrossMatrix << 0.0, -earthAngularVelocity.z(), earthAngularVelocity.y(),
+        earthAngularVelocity.z(), 0.0, -earthAngularVelocity.x(), -earthAngularVelocity.y(), earthAngularVelocity.x(),
+        0.0;
+
+    const Vector3d relativeVelocity = velocityCoordinates - earthAngularVelocityCrossMatrix * positionCoordinates;
+    const double relativeSpeed = relativeVelocity.norm();
+
+    const Real atmosphericDensity =
+        this->getAtmosphericDensityAt(transform.applyToPosition(positionCoordinates), anInstant);
+
+    // Radial density gradient
+
+    const Vector3d radialDirection = positionCoordinates.normalized();
+
+    const Real densityRadialDerivative =
+        (this->getAtmosphericDensityAt(
+             transform.applyToPosition(positionCoordinates + densityGradientStep_m * radialDirection), anInstant
+         ) -
+         this->getAtmosphericDensityAt(
+             transform.applyToPosition(positionCoordinates - densityGradientStep_m * radialDirection), anInstant
+         )) /
+        (2.0 * densityGradientStep_m);
+
+    // a = -k rho |v_r| v_r, with k = Cd A / (2 m)
+
+    const double k = 0.5 * surfaceArea * dragCoefficient / mass;
+
+    const Vector3d dragAccelerationSI = -k * atmosphericDensity * relativeSpeed * relativeVelocity;
+
+    Matrix3d relativeVelocityJacobian = Matrix3d::Identity() * relativeSpeed;
+
+    if (relativeSpeed > 0.0)
+    {
+        relativeVelocityJacobian += relativeVelocity * relativeVelocity.transpose() / relativeSpeed;
+    }
+
+    const Matrix3d velocityJacobian = -k * atmosphericDensity * relativeVelocityJacobian;
+
+    MatrixXd jacobian = MatrixXd::Zero(3, 9);
+
+    jacobian.block<3, 3>(0, 0) = -velocityJacobian * earthAngularVelocityCrossMatrix -
+                                 k * relativeSpeed * densityRadialDerivative * relativeVelocity *
+                                     radialDirection.transpose();
+    jacobian.block<3, 3>(0, 3) = velocityJacobian;
+    jacobian.col(6) = -dragAccelerationSI / mass;
+    jacobian.col(7) = -(0.5 / mass) * dragCoefficient * atmosphericDensity * relativeSpeed * relativeVelocity;
+    jacobian.col(8) = -(0.5 / mass) * surfaceArea * atmosphericDensity * relativeSpeed * relativeVelocity;
+
+    return jacobian;
+}
+
+void AtmosphericDrag::writeContributions(
+    const Instant& anInstant,
+    const MatrixXd& aStateMatrix,
+    const Shared<const Frame>& aFrameSPtr,
+    MatrixXd& aContributionMatrix
+) const
+{
+    if (projectedAreaTableSPtr_ != nullptr)
+    {
+        Dynamics::writeContributions(anInstant, aStateMatrix, aFrameSPtr, aContributionMatrix);
+        return;
+    }
+
+    const Index sampleCount = aStateMatrix.cols();
+
+    // The frame transform is shared by all samples
+    const Transform transform = Dynamics::GetTransform(aFrameSPtr, Frame::ITRF(), anInstant);
+
+    // Get atmospheric densities
+    MatrixXd atmosphericDensities(1, sampleCount);
+
+    for (Index i = 0; i < sampleCount; ++i)
+    {
+        const Vector3d positionCoordinates = aStateMatrix.block(0, i, 3, 1);
+
+        atmosphericDensities(0, i) =
+            this->getAtmosphericDensityAt(transform.applyToPosition(positionCoordinates), anInstant);
+    }
+
+    const Vector3d earthAngularVelocity = transform.getAngularVelocity();  // rad/s
+
+    Matrix3d earthAngularVelocityCrossMatrix;
+    earthAngularVelocityCrossMatrix << 0.0, -earthAngularVelocity.z(), earthAngularVelocity.y(),
+        earthAngularVelocity.z(), 0.0, -earthAngularVelocity.x(), -earthAngularVelocity.y(), earthAngularVelocity.x(),
+        0.0;
+
+    const MatrixXd relativeVelocities =
+        aStateMatrix.middleRows(3, 3) - earthAngularVelocityCrossMatrix * aStateMatrix.topRows(3);
+
+    // Compute drag contributions to state derivatives, column-wise
+    const MatrixXd dragFactors = (-0.5 * aStateMatrix.row(7).array() * aStateMatrix.row(8).array() *
+                                  atmosphericDensities.array() * relativeVelocities.colwise().norm().array() /
+                                  aStateMatrix.row(6).array())
+                                     .matrix();
+
+    aContributionMatrix = (relativeVelocities.array().rowwise() * dragFactors.row(0).array()).matrix();
 }
 
 void AtmosphericDrag::print(std::ostream& anOutputStream, bool displayDecorator) const
@@ -126,9 +555,26 @@ void AtmosphericDrag::print(std::ostream& anOutputStream, bool displayDecorator)
 
     // TBI: Print Celestial once we have a proper implementation of Celestial::print
 
+    ostk::core::utils::Print::Line(anOutputStream) << "Density Table:" << (densityTableSPtr_ != nullptr);
+    ostk::core::utils::Print::Line(anOutputStream) << "Projected Area Table:" << (projectedAreaTableSPtr_ != nullptr);
+
     displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
 }
 
+Real AtmosphericDrag::getAtmosphericDensityAt(const Vector3d& aPositionCoordinates_ITRF, const Instant& anInstant)
+    const
+{
+    if ((densityTableSPtr_ != nullptr) && densityTableSPtr_->isApplicableAt(aPositionCoordinates_ITRF))
+    {
+        return densityTableSPtr_->getDensityAt(aPositionCoordinates_ITRF, anInstant);
+    }
+
+    return celestialObjectSPtr_
+        ->getAtmosphericDensityAt(Position::Meters(aPositionCoordinates_ITRF, Frame::ITRF()), anInstant)
+        .inUnit(MassDensitySIUnit)
+        .getValue();
+}
+
 }  // namespace dynamics
 }  // namespace astrodynamics
 }  // namespace ostk
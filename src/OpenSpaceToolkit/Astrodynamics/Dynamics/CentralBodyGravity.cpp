@@ -1,5 +1,7 @@
 /// Apache License 2.0
 
+#include <algorithm>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
@@ -14,13 +16,19 @@ namespace astrodynamics
 namespace dynamics
 {
 
+using ostk::mathematics::object::Matrix3d;
 using ostk::mathematics::object::Vector3d;
 
 using ostk::physics::coordinate::Position;
+using ostk::physics::unit::Derived;
+using ostk::physics::unit::Time;
 
 using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianPosition;
 using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianVelocity;
 
+static const Derived::Unit GravitationalParameterSIUnit =
+    Derived::Unit::GravitationalParameter(Length::Unit::Meter, Time::Unit::Second);
+
 CentralBodyGravity::CentralBodyGravity(const Shared<const Celestial>& aCelestialObjectSPtr)
     : CentralBodyGravity(
           aCelestialObjectSPtr, String::Format("Central Body Gravity [{}]", aCelestialObjectSPtr->getName())
@@ -29,13 +37,65 @@ CentralBodyGravity::CentralBodyGravity(const Shared<const Celestial>& aCelestial
 }
 
 CentralBodyGravity::CentralBodyGravity(const Shared<const Celestial>& aCelestialObjectSPtr, const String& aName)
-    : Dynamics(aName),
-      celestialObjectSPtr_(aCelestialObjectSPtr)
+    : CentralBodyGravity(aCelestialObjectSPtr, Array<AltitudeBand>::Empty(), aName)
+{
+}
+
+CentralBodyGravity::CentralBodyGravity(
+    const Shared<const Celestial>& aCelestialObjectSPtr,
+    const Array<AltitudeBand>& anAltitudeBandArray,
+    const String& aName
+)
+    : Dynamics(
+          ((!aName.isEmpty()) || (!aCelestialObjectSPtr))
+              ? aName
+              : String::Format("Central Body Gravity [{}]", aCelestialObjectSPtr->getName())
+      ),
+      celestialObjectSPtr_(aCelestialObjectSPtr),
+      altitudeBands_(anAltitudeBandArray),
+      altitudeBandMinimumRadii_(Array<Real>::Empty()),
+      gravitationalParameter_SI_(Real::Undefined())
 {
     if (!celestialObjectSPtr_ || !celestialObjectSPtr_->gravitationalModelIsDefined())
     {
         throw ostk::core::error::runtime::Undefined("Gravitational Model");
     }
+
+    gravitationalParameter_SI_ = celestialObjectSPtr_->getGravitationalParameter().in(GravitationalParameterSIUnit);
+
+    for (const AltitudeBand& altitudeBand : altitudeBands_)
+    {
+        if (!altitudeBand.minimumAltitude.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Altitude Band minimum altitude");
+        }
+
+        if (!altitudeBand.celestialObjectSPtr || !altitudeBand.celestialObjectSPtr->gravitationalModelIsDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Altitude Band Gravitational Model");
+        }
+    }
+
+    std::sort(
+        altitudeBands_.begin(),
+        altitudeBands_.end(),
+        [](const AltitudeBand& aFirstBand, const AltitudeBand& aSecondBand) -> bool
+        {
+            return aFirstBand.minimumAltitude < aSecondBand.minimumAltitude;
+        }
+    );
+
+    if (!altitudeBands_.isEmpty())
+    {
+        const Real equatorialRadius_m = celestialObjectSPtr_->getEquatorialRadius().inMeters();
+
+        altitudeBandMinimumRadii_.reserve(altitudeBands_.getSize());
+
+        for (const AltitudeBand& altitudeBand : altitudeBands_)
+        {
+            altitudeBandMinimumRadii_.add(equatorialRadius_m + altitudeBand.minimumAltitude.inMeters());
+        }
+    }
 }
 
 CentralBodyGravity::~CentralBodyGravity() {}
@@ -62,6 +122,11 @@ Shared<const Celestial> CentralBodyGravity::getCelestial() const
     return celestialObjectSPtr_;
 }
 
+Array<CentralBodyGravity::AltitudeBand> CentralBodyGravity::getAltitudeBands() const
+{
+    return altitudeBands_;
+}
+
 Array<Shared<const CoordinateSubset>> CentralBodyGravity::getReadCoordinateSubsets() const
 {
     return {
@@ -79,22 +144,50 @@ Array<Shared<const CoordinateSubset>> CentralBodyGravity::getWriteCoordinateSubs
 VectorXd CentralBodyGravity::computeContribution(
     const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
 ) const
+{
+    VectorXd contribution(3);
+    this->writeContribution(anInstant, x, aFrameSPtr, contribution);
+
+    return contribution;
+}
+
+void CentralBodyGravity::writeContribution(
+    const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr, VectorXd& aContribution
+) const
 {
     Vector3d positionCoordinates = {x[0], x[1], x[2]};
 
     // Obtain gravitational acceleration from current object
-    const Vector3d gravitationalAccelerationSI = celestialObjectSPtr_
-                                                     ->getGravitationalFieldAt(
+    const Vector3d gravitationalAccelerationSI = this->accessCelestialAt(positionCoordinates)
+                                                     .getGravitationalFieldAt(
                                                          Position::Meters(positionCoordinates, aFrameSPtr), anInstant
                                                      )  // TBI: Assumes x is given in GCRF
                                                      .inFrame(aFrameSPtr, anInstant)
                                                      .getValue();
 
     // Compute contribution
-    VectorXd contribution(3);
-    contribution << gravitationalAccelerationSI[0], gravitationalAccelerationSI[1], gravitationalAccelerationSI[2];
+    aContribution << gravitationalAccelerationSI[0], gravitationalAccelerationSI[1], gravitationalAccelerationSI[2];
+}
 
-    return contribution;
+MatrixXd CentralBodyGravity::computeJacobian(
+    [[maybe_unused]] const Instant& anInstant,
+    const VectorXd& x,
+    [[maybe_unused]] const Shared<const Frame>& aFrameSPtr
+) const
+{
+    const Vector3d positionCoordinates = {x[0], x[1], x[2]};
+
+    const double radius = positionCoordinates.norm();
+    const double radiusCubed = radius * radius * radius;
+
+    // d(-mu r / |r|^3) / dr = mu (3 r r^T / |r|^5 - I / |r|^3)
+
+    const Matrix3d jacobian =
+        gravitationalParameter_SI_ *
+        (3.0 * positionCoordinates * positionCoordinates.transpose() / (radiusCubed * radius * radius) -
+         Matrix3d::Identity() / radiusCubed);
+
+    return jacobian;
 }
 
 void CentralBodyGravity::print(std::ostream& anOutputStream, bool displayDecorator) const
@@ -105,9 +198,33 @@ void CentralBodyGravity::print(std::ostream& anOutputStream, bool displayDecorat
 
     // TBI: Print Celestial once we have a proper implementation of Celestial::print
 
+    ostk::core::utils::Print::Line(anOutputStream) << "Altitude Bands:" << altitudeBands_.getSize();
+
     displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
 }
 
+const Celestial& CentralBodyGravity::accessCelestialAt(const Vector3d& aPositionCoordinates) const
+{
+    if (altitudeBands_.isEmpty())
+    {
+        return *celestialObjectSPtr_;
+    }
+
+    // Bands are sorted by increasing minimum radius, select the highest one below the current radius
+
+    const Real radius_m = aPositionCoordinates.norm();
+
+    for (Index i = altitudeBandMinimumRadii_.getSize(); i > 0; --i)
+    {
+        if (radius_m >= altitudeBandMinimumRadii_[i - 1])
+        {
+            return *(altitudeBands_[i - 1].celestialObjectSPtr);
+        }
+    }
+
+    return *celestialObjectSPtr_;
+}
+
 }  // namespace dynamics
 }  // namespace astrodynamics
 }  // namespace ostk
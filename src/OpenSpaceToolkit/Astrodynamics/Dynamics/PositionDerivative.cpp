@@ -51,15 +51,44 @@ Array<Shared<const CoordinateSubset>> PositionDerivative::getWriteCoordinateSubs
 }
 
 VectorXd PositionDerivative::computeContribution(
-    [[maybe_unused]] const Instant& anInstant, const VectorXd& x, [[maybe_unused]] const Shared<const Frame>& aFrameSPtr
+    const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
 ) const
 {
     VectorXd contribution(3);
-    contribution << x[0], x[1], x[2];
+    this->writeContribution(anInstant, x, aFrameSPtr, contribution);
 
     return contribution;
 }
 
+void PositionDerivative::writeContribution(
+    [[maybe_unused]] const Instant& anInstant,
+    const VectorXd& x,
+    [[maybe_unused]] const Shared<const Frame>& aFrameSPtr,
+    VectorXd& aContribution
+) const
+{
+    aContribution << x[0], x[1], x[2];
+}
+
+MatrixXd PositionDerivative::computeJacobian(
+    [[maybe_unused]] const Instant& anInstant,
+    [[maybe_unused]] const VectorXd& x,
+    [[maybe_unused]] const Shared<const Frame>& aFrameSPtr
+) const
+{
+    return MatrixXd::Identity(3, 3);
+}
+
+void PositionDerivative::writeContributions(
+    [[maybe_unused]] const Instant& anInstant,
+    const MatrixXd& aStateMatrix,
+    [[maybe_unused]] const Shared<const Frame>& aFrameSPtr,
+    MatrixXd& aContributionMatrix
+) const
+{
+    aContributionMatrix = aStateMatrix;
+}
+
 void PositionDerivative::print(std::ostream& anOutputStream, bool displayDecorator) const
 {
     displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Position Derivative Dynamics") : void();
@@ -0,0 +1,227 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/SolarRadiationPressure.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Solver/EclipseSolver.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianPosition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianVelocity.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace dynamics
+{
+
+using ostk::astrodynamics::solver::EclipseSolver;
+using ostk::astrodynamics::trajectory::state::CoordinateSubset;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianPosition;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianVelocity;
+
+static const double AstronomicalUnit_m = 149597870700.0;
+
+SolarRadiationPressure::SolarRadiationPressure(
+    const Shared<const Celestial>& aSunSPtr,
+    const Shared<const Celestial>& anOccultingCelestialSPtr,
+    const Real& aReflectivityCoefficient,
+    const Shared<const ThirdBodyGravity::EphemerisTable>& aSunEphemerisTableSPtr,
+    const String& aName
+)
+    : Dynamics(aName.isEmpty() ? String("Solar Radiation Pressure") : aName),
+      sunSPtr_(aSunSPtr),
+      occultingCelestialSPtr_(anOccultingCelestialSPtr),
+      reflectivityCoefficient_(aReflectivityCoefficient),
+      sunEphemerisTableSPtr_(aSunEphemerisTableSPtr),
+      sunRadius_m_(0.0),
+      occultingRadius_m_(0.0)
+{
+    if ((sunSPtr_ == nullptr) || (!sunSPtr_->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Sun");
+    }
+
+    if ((occultingCelestialSPtr_ == nullptr) || (!occultingCelestialSPtr_->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Occulting celestial");
+    }
+
+    if (!reflectivityCoefficient_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Reflectivity coefficient");
+    }
+
+    if (reflectivityCoefficient_ < 0.0)
+    {
+        throw ostk::core::error::runtime::Wrong("Reflectivity coefficient", reflectivityCoefficient_.toString());
+    }
+
+    if ((sunEphemerisTableSPtr_ != nullptr) &&
+        (sunEphemerisTableSPtr_->getCelestial()->getName() != sunSPtr_->getName()))
+    {
+        throw ostk::core::error::runtime::Wrong("Ephemeris Table", sunEphemerisTableSPtr_->getCelestial()->getName());
+    }
+
+    sunRadius_m_ = sunSPtr_->getEquatorialRadius().inMeters();
+    occultingRadius_m_ = occultingCelestialSPtr_->getEquatorialRadius().inMeters();
+}
+
+SolarRadiationPressure::~SolarRadiationPressure() {}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const SolarRadiationPressure& aSolarRadiationPressure)
+{
+    aSolarRadiationPressure.print(anOutputStream);
+
+    return anOutputStream;
+}
+
+bool SolarRadiationPressure::isDefined() const
+{
+    return sunSPtr_->isDefined() && occultingCelestialSPtr_->isDefined() && reflectivityCoefficient_.isDefined();
+}
+
+Shared<const Celestial> SolarRadiationPressure::getSun() const
+{
+    return sunSPtr_;
+}
+
+Shared<const Celestial> SolarRadiationPressure::getOccultingCelestial() const
+{
+    return occultingCelestialSPtr_;
+}
+
+Real SolarRadiationPressure::getReflectivityCoefficient() const
+{
+    return reflectivityCoefficient_;
+}
+
+Shared<const ThirdBodyGravity::EphemerisTable> SolarRadiationPressure::getSunEphemerisTable() const
+{
+    return sunEphemerisTableSPtr_;
+}
+
+Array<Shared<const CoordinateSubset>> SolarRadiationPressure::getReadCoordinateSubsets() const
+{
+    return {
+        CartesianPosition::Default(),
+        CoordinateSubset::Mass(),
+        CoordinateSubset::SurfaceArea(),
+    };
+}
+
+Array<Shared<const CoordinateSubset>> SolarRadiationPressure::getWriteCoordinateSubsets() const
+{
+    return {
+        CartesianVelocity::Default(),
+    };
+}
+
+VectorXd SolarRadiationPressure::computeContribution(
+    const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+) const
+{
+    VectorXd contribution(3);
+    this->writeContribution(anInstant, x, aFrameSPtr, contribution);
+
+    return contribution;
+}
+
+void SolarRadiationPressure::writeContribution(
+    const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr, VectorXd& aContribution
+) const
+{
+    const Vector3d positionCoordinates = Vector3d(x[0], x[1], x[2]);
+    const Real mass = x[3];         // kg
+    const Real surfaceArea = x[4];  // m^2
+
+    const Vector3d sunPositionCoordinates = this->getSunPositionAt(anInstant, aFrameSPtr);
+
+    const double illuminationFraction = this->computeIlluminationFraction(positionCoordinates, sunPositionCoordinates);
+
+    if (illuminationFraction == 0.0)
+    {
+        aContribution.setZero();
+
+        return;
+    }
+
+    // Directed from the Sun to the spacecraft, scaled by the inverse square of their distance
+
+    const Vector3d sunToSpacecraft = positionCoordinates - sunPositionCoordinates;
+    const double sunDistance = sunToSpacecraft.norm();
+
+    const Vector3d solarRadiationPressureAccelerationSI =
+        (SolarRadiationPressure::SolarRadiationPressureAtAstronomicalUnit_SI * AstronomicalUnit_m * AstronomicalUnit_m *
+         reflectivityCoefficient_ * surfaceArea * illuminationFraction /
+         (mass * sunDistance * sunDistance * sunDistance)) *
+        sunToSpacecraft;
+
+    aContribution << solarRadiationPressureAccelerationSI[0], solarRadiationPressureAccelerationSI[1],
+        solarRadiationPressureAccelerationSI[2];
+}
+
+void SolarRadiationPressure::print(std::ostream& anOutputStream, bool displayDecorator) const
+{
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Solar Radiation Pressure Dynamics") : void();
+
+    Dynamics::print(anOutputStream, false);
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Occulting Celestial:" << occultingCelestialSPtr_->getName();
+    ostk::core::utils::Print::Line(anOutputStream) << "Reflectivity Coefficient:" << reflectivityCoefficient_;
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Sun Ephemeris Table:"
+        << ((sunEphemerisTableSPtr_ != nullptr) ? sunEphemerisTableSPtr_->getInterval().toString() : String("None"));
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+Vector3d SolarRadiationPressure::getSunPositionAt(const Instant& anInstant, const Shared<const Frame>& aFrameSPtr)
+    const
+{
+    if ((sunEphemerisTableSPtr_ != nullptr) && sunEphemerisTableSPtr_->isApplicableAt(anInstant, aFrameSPtr))
+    {
+        return sunEphemerisTableSPtr_->getPositionAt(anInstant);
+    }
+
+    return sunSPtr_->getPositionIn(aFrameSPtr, anInstant).inMeters().getCoordinates();
+}
+
+double SolarRadiationPressure::computeIlluminationFraction(
+    const Vector3d& aPositionCoordinates, const Vector3d& aSunPositionCoordinates
+) const
+{
+    // Spacecraft on the day side of the occulting body, or away from its shadow cones, are fully illuminated. The
+    // penumbra cone half angle is about (sun radius + occulting radius) / sun distance: its radius behind the occulting
+    // body is bounded with a twofold margin.
+
+    const double sunDistance = aSunPositionCoordinates.norm();
+    const Vector3d sunDirection = aSunPositionCoordinates / sunDistance;
+
+    const double behindDistance = -aPositionCoordinates.dot(sunDirection);
+
+    if (behindDistance <= 0.0)
+    {
+        return 1.0;
+    }
+
+    const double axisDistance = (aPositionCoordinates + behindDistance * sunDirection).norm();
+
+    const double penumbraRadiusBound =
+        occultingRadius_m_ +
+        2.0 * (sunRadius_m_ + occultingRadius_m_) * (behindDistance + occultingRadius_m_) / sunDistance;
+
+    if (axisDistance > penumbraRadiusBound)
+    {
+        return 1.0;
+    }
+
+    return EclipseSolver::ComputeIlluminationFraction(
+        aPositionCoordinates, aSunPositionCoordinates, Vector3d::Zero(), sunRadius_m_, occultingRadius_m_
+    );
+}
+
+}  // namespace dynamics
+}  // namespace astrodynamics
+}  // namespace ostk
@@ -1,9 +1,11 @@
 /// Apache License 2.0
 
+#include <algorithm>
 #include <numeric>
 
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/Tabulated.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateBroker.hpp>
@@ -16,12 +18,16 @@ namespace dynamics
 {
 
 using ostk::core::type::Index;
-
-using ostk::mathematics::object::VectorXd;
+using ostk::core::type::Size;
 
 using ostk::astrodynamics::trajectory::state::CoordinateBroker;
 
-const Shared<const Frame> Tabulated::DefaultContributionFrameSPtr = Frame::GCRF();
+const Shared<const Frame>& Tabulated::DefaultContributionFrame()
+{
+    static const Shared<const Frame> defaultContributionFrameSPtr = Frame::GCRF();
+
+    return defaultContributionFrameSPtr;
+}
 
 Tabulated::Tabulated(
     const Array<Instant>& anInstantArray,
@@ -34,7 +40,9 @@ Tabulated::Tabulated(
       instants_(anInstantArray),
       contributionProfile_(aContributionProfile),
       writeCoordinateSubsets_(aWriteCoordinateSubsets),
-      frameSPtr_(aFrameSPtr)
+      frameSPtr_(aFrameSPtr),
+      interpolationType_(anInterpolationType),
+      timestamps_(anInstantArray.getSize())
 {
     if (anInstantArray.getSize() != (Index)aContributionProfile.rows())
     {
@@ -58,24 +66,35 @@ Tabulated::Tabulated(
         );
     }
 
-    if (aFrameSPtr != DefaultContributionFrameSPtr)
+    if (aFrameSPtr != Tabulated::DefaultContributionFrame())
     {
         throw ostk::core::error::RuntimeError("Contributions must be expressed in an inertial frame.");
     }
 
-    VectorXd timestamps(anInstantArray.getSize());
     Index i = 0;
     for (const auto& instant : anInstantArray)
     {
-        timestamps(i) = (instant - anInstantArray.accessFirst()).inSeconds();
+        timestamps_(i) = (instant - anInstantArray.accessFirst()).inSeconds();
         ++i;
     }
 
+    // Linear interpolation is evaluated directly from the contribution profile, for all columns at once
+
+    if (anInterpolationType == Interpolator::Type::Linear)
+    {
+        if (anInstantArray.getSize() < 2)
+        {
+            throw ostk::core::error::RuntimeError("Linear interpolation requires at least two instants.");
+        }
+
+        return;
+    }
+
     interpolators_.reserve(aContributionProfile.cols());
     for (i = 0; i < (Index)aContributionProfile.cols(); ++i)
     {
         interpolators_.add(
-            Interpolator::GenerateInterpolator(anInterpolationType, timestamps, aContributionProfile.col(i))
+            Interpolator::GenerateInterpolator(anInterpolationType, timestamps_, aContributionProfile.col(i))
         );
     }
 }
@@ -157,8 +176,7 @@ const Shared<const Frame>& Tabulated::accessFrame() const
 
 Interpolator::Type Tabulated::getInterpolationType() const
 {
-    // Since all interpolators are of the same type, we can just return the type of the first one.
-    return interpolators_[0]->getInterpolationType();
+    return interpolationType_;
 }
 
 bool Tabulated::isDefined() const
@@ -177,7 +195,20 @@ Array<Shared<const CoordinateSubset>> Tabulated::getWriteCoordinateSubsets() con
 }
 
 VectorXd Tabulated::computeContribution(
-    const Instant& anInstant, [[maybe_unused]] const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+    const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
+) const
+{
+    VectorXd contribution(contributionProfile_.cols());
+    this->writeContribution(anInstant, x, aFrameSPtr, contribution);
+
+    return contribution;
+}
+
+void Tabulated::writeContribution(
+    const Instant& anInstant,
+    [[maybe_unused]] const VectorXd& x,
+    const Shared<const Frame>& aFrameSPtr,
+    VectorXd& aContribution
 ) const
 {
     // TBM: Allow frame conversion through `CoordinateSubset.inFrame` method, once we have a `CartesianAcceleration`
@@ -189,18 +220,109 @@ VectorXd Tabulated::computeContribution(
 
     if (anInstant < instants_.accessFirst() || anInstant > instants_.accessLast())
     {
-        return VectorXd::Zero(interpolators_.getSize());
+        aContribution.setZero();
+        return;
     }
 
     const double epoch = (anInstant - instants_.accessFirst()).inSeconds();
 
-    VectorXd contribution(interpolators_.getSize());
+    if (interpolationType_ == Interpolator::Type::Linear)
+    {
+        const Index k = this->findInterval(epoch);
+
+        const double intervalDuration = timestamps_(k + 1) - timestamps_(k);
+        const double ratio = (intervalDuration > 0.0) ? ((epoch - timestamps_(k)) / intervalDuration) : 0.0;
+
+        aContribution.noalias() = contributionProfile_.row(k).transpose() +
+                                  ratio * (contributionProfile_.row(k + 1) - contributionProfile_.row(k)).transpose();
+
+        return;
+    }
+
     for (Index i = 0; i < interpolators_.getSize(); ++i)
     {
-        contribution(i) = interpolators_[i]->evaluate(epoch);
+        aContribution(i) = interpolators_[i]->evaluate(epoch);
     }
+}
 
-    return contribution;
+Index Tabulated::findInterval(const double& anEpoch) const
+{
+    struct CursorEntry
+    {
+        const Tabulated* tabulatedPtr;
+        Index intervalIndex;
+    };
+
+    static constexpr Size CursorCount = 4;
+
+    // Each thread holds its own cursors, hence no synchronization. A cursor is only a hint: the interval it points to
+    // is always checked against the epoch.
+
+    thread_local Array<CursorEntry> cursors = Array<CursorEntry>::Empty();
+    thread_local Index nextCursorIndex = 0;
+
+    const Index lastIntervalIndex = static_cast<Index>(timestamps_.size()) - 2;
+
+    const auto contains = [this, &anEpoch](const Index& anIntervalIndex) -> bool
+    {
+        return (timestamps_(anIntervalIndex) <= anEpoch) && (anEpoch <= timestamps_(anIntervalIndex + 1));
+    };
+
+    CursorEntry* cursorPtr = nullptr;
+
+    for (CursorEntry& cursor : cursors)
+    {
+        if (cursor.tabulatedPtr == this)
+        {
+            cursorPtr = &cursor;
+            break;
+        }
+    }
+
+    if (cursorPtr == nullptr)
+    {
+        if (cursors.getSize() < CursorCount)
+        {
+            cursors.add({this, 0});
+            cursorPtr = &cursors.accessLast();
+        }
+        else
+        {
+            cursors[nextCursorIndex] = {this, 0};
+            cursorPtr = &cursors[nextCursorIndex];
+            nextCursorIndex = (nextCursorIndex + 1) % CursorCount;
+        }
+    }
+
+    Index intervalIndex = std::min(cursorPtr->intervalIndex, lastIntervalIndex);
+
+    // Integrators mostly query the same interval, or one of its neighbours
+
+    if (!contains(intervalIndex))
+    {
+        if ((intervalIndex < lastIntervalIndex) && contains(intervalIndex + 1))
+        {
+            ++intervalIndex;
+        }
+        else if ((intervalIndex > 0) && contains(intervalIndex - 1))
+        {
+            --intervalIndex;
+        }
+        else
+        {
+            const double* timestampsBegin = timestamps_.data();
+            const double* timestampsEnd = timestampsBegin + timestamps_.size();
+
+            const Index upperIndex =
+                static_cast<Index>(std::upper_bound(timestampsBegin, timestampsEnd, anEpoch) - timestampsBegin);
+
+            intervalIndex = std::min(std::max(upperIndex, Index(1)) - 1, lastIntervalIndex);
+        }
+    }
+
+    cursorPtr->intervalIndex = intervalIndex;
+
+    return intervalIndex;
 }
 
 void Tabulated::print(std::ostream& anOutputStream, bool displayDecorator) const
@@ -1,5 +1,8 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <cmath>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
@@ -14,23 +17,183 @@ namespace astrodynamics
 namespace dynamics
 {
 
+using ostk::core::type::Index;
 using ostk::core::type::String;
 
 using ostk::mathematics::object::Vector3d;
 
 using ostk::physics::coordinate::Position;
+using ostk::physics::unit::Derived;
+using ostk::physics::unit::Length;
+using ostk::physics::unit::Time;
 
 using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianPosition;
 using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianVelocity;
 
+static const Derived::Unit GravitationalParameterSIUnit =
+    Derived::Unit::GravitationalParameter(Length::Unit::Meter, Time::Unit::Second);
+
+ThirdBodyGravity::EphemerisTable::EphemerisTable(
+    const Shared<const Celestial>& aCelestialObjectSPtr,
+    const Interval& anInterval,
+    const Shared<const Frame>& aFrameSPtr,
+    const Duration& aSegmentDuration,
+    const Size& aDegree
+)
+    : celestialObjectSPtr_(aCelestialObjectSPtr),
+      interval_(anInterval),
+      frameSPtr_(aFrameSPtr),
+      segmentDuration_s_(Real::Undefined()),
+      coefficients_(Array<MatrixXd>::Empty())
+{
+    if ((celestialObjectSPtr_ == nullptr) || (!celestialObjectSPtr_->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Celestial");
+    }
+
+    if (!interval_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    if ((frameSPtr_ == nullptr) || (!frameSPtr_->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    if (!aSegmentDuration.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Segment duration");
+    }
+
+    if (!aSegmentDuration.isStrictlyPositive())
+    {
+        throw ostk::core::error::runtime::Wrong("Segment duration", aSegmentDuration.toString());
+    }
+
+    segmentDuration_s_ = aSegmentDuration.inSeconds();
+
+    const Real intervalDuration_s = interval_.getDuration().inSeconds();
+    const Size segmentCount = std::max(Size(1), Size(std::ceil(intervalDuration_s / segmentDuration_s_)));
+    const Size nodeCount = aDegree + 1;
+
+    coefficients_.reserve(segmentCount);
+
+    // Positions are sampled at the Chebyshev nodes of each segment, and projected onto the Chebyshev polynomials
+
+    MatrixXd nodePositions(3, nodeCount);
+
+    for (Index segmentIndex = 0; segmentIndex < segmentCount; ++segmentIndex)
+    {
+        const Real segmentMidpoint_s = (Real(segmentIndex) + 0.5) * segmentDuration_s_;
+
+        for (Index k = 0; k < nodeCount; ++k)
+        {
+            const Real tau = std::cos(M_PI * (Real(k) + 0.5) / Real(nodeCount));
+            const Instant nodeInstant =
+                interval_.accessStart() + Duration::Seconds(segmentMidpoint_s + 0.5 * segmentDuration_s_ * tau);
+
+            nodePositions.col(k) =
+                celestialObjectSPtr_->getPositionIn(frameSPtr_, nodeInstant).inMeters().getCoordinates();
+        }
+
+        MatrixXd coefficients = MatrixXd::Zero(3, nodeCount);
+
+        for (Index j = 0; j < nodeCount; ++j)
+        {
+            for (Index k = 0; k < nodeCount; ++k)
+            {
+                coefficients.col(j) +=
+                    nodePositions.col(k) * std::cos(M_PI * Real(j) * (Real(k) + 0.5) / Real(nodeCount));
+            }
+
+            coefficients.col(j) *= 2.0 / Real(nodeCount);
+        }
+
+        coefficients.col(0) *= 0.5;
+
+        coefficients_.add(coefficients);
+    }
+}
+
+Shared<const Celestial> ThirdBodyGravity::EphemerisTable::getCelestial() const
+{
+    return celestialObjectSPtr_;
+}
+
+Interval ThirdBodyGravity::EphemerisTable::getInterval() const
+{
+    return interval_;
+}
+
+Shared<const Frame> ThirdBodyGravity::EphemerisTable::getFrame() const
+{
+    return frameSPtr_;
+}
+
+bool ThirdBodyGravity::EphemerisTable::isApplicableAt(
+    const Instant& anInstant, const Shared<const Frame>& aFrameSPtr
+) const
+{
+    return (anInstant >= interval_.accessStart()) && (anInstant <= interval_.accessEnd()) &&
+           ((aFrameSPtr == frameSPtr_) || (*aFrameSPtr == *frameSPtr_));
+}
+
+Vector3d ThirdBodyGravity::EphemerisTable::getPositionAt(const Instant& anInstant) const
+{
+    if ((anInstant < interval_.accessStart()) || (anInstant > interval_.accessEnd()))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Instant [{}] is outside of the ephemeris table interval [{}].", anInstant.toString(), interval_.toString()
+        );
+    }
+
+    const Real elapsed_s = (anInstant - interval_.accessStart()).inSeconds();
+
+    const Index segmentIndex = std::min(Index(elapsed_s / segmentDuration_s_), Index(coefficients_.getSize() - 1));
+
+    const Real tau = 2.0 * (elapsed_s - Real(segmentIndex) * segmentDuration_s_) / segmentDuration_s_ - 1.0;
+
+    // Clenshaw recurrence
+
+    const MatrixXd& coefficients = coefficients_[segmentIndex];
+
+    Vector3d b1 = Vector3d::Zero();
+    Vector3d b2 = Vector3d::Zero();
+
+    for (Index j = coefficients.cols() - 1; j > 0; --j)
+    {
+        const Vector3d b0 = coefficients.col(j) + 2.0 * tau * b1 - b2;
+        b2 = b1;
+        b1 = b0;
+    }
+
+    return coefficients.col(0) + tau * b1 - b2;
+}
+
 ThirdBodyGravity::ThirdBodyGravity(const Shared<const Celestial>& aCelestialObjectSPtr)
     : ThirdBodyGravity(aCelestialObjectSPtr, String::Format("Third Body Gravity [{}]", aCelestialObjectSPtr->getName()))
 {
 }
 
 ThirdBodyGravity::ThirdBodyGravity(const Shared<const Celestial>& aCelestialObjectSPtr, const String& aName)
-    : Dynamics(aName),
-      celestialObjectSPtr_(aCelestialObjectSPtr)
+    : ThirdBodyGravity(aCelestialObjectSPtr, nullptr, aName)
+{
+}
+
+ThirdBodyGravity::ThirdBodyGravity(
+    const Shared<const Celestial>& aCelestialObjectSPtr,
+    const Shared<const EphemerisTable>& anEphemerisTableSPtr,
+    const String& aName
+)
+    : Dynamics(
+          ((!aName.isEmpty()) || (!aCelestialObjectSPtr))
+              ? aName
+              : String::Format("Third Body Gravity [{}]", aCelestialObjectSPtr->getName())
+      ),
+      celestialObjectSPtr_(aCelestialObjectSPtr),
+      ephemerisTableSPtr_(anEphemerisTableSPtr),
+      gravitationalParameter_SI_(Real::Undefined())
 {
     if (!celestialObjectSPtr_ || !celestialObjectSPtr_->gravitationalModelIsDefined())
     {
@@ -42,6 +205,16 @@ ThirdBodyGravity::ThirdBodyGravity(const Shared<const Celestial>& aCelestialObje
     {
         throw ostk::core::error::RuntimeError("Cannot calculate third body acceleration for the Earth yet.");
     }
+
+    if (ephemerisTableSPtr_ != nullptr)
+    {
+        if (ephemerisTableSPtr_->getCelestial()->getName() != celestialObjectSPtr_->getName())
+        {
+            throw ostk::core::error::runtime::Wrong("Ephemeris Table", ephemerisTableSPtr_->getCelestial()->getName());
+        }
+
+        gravitationalParameter_SI_ = celestialObjectSPtr_->getGravitationalParameter().in(GravitationalParameterSIUnit);
+    }
 }
 
 ThirdBodyGravity::~ThirdBodyGravity() {}
@@ -68,6 +241,11 @@ Shared<const Celestial> ThirdBodyGravity::getCelestial() const
     return celestialObjectSPtr_;
 }
 
+Shared<const ThirdBodyGravity::EphemerisTable> ThirdBodyGravity::getEphemerisTable() const
+{
+    return ephemerisTableSPtr_;
+}
+
 Array<Shared<const CoordinateSubset>> ThirdBodyGravity::getReadCoordinateSubsets() const
 {
     return {
@@ -86,6 +264,33 @@ VectorXd ThirdBodyGravity::computeContribution(
     const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr
 ) const
 {
+    VectorXd contribution(3);
+    this->writeContribution(anInstant, x, aFrameSPtr, contribution);
+
+    return contribution;
+}
+
+void ThirdBodyGravity::writeContribution(
+    const Instant& anInstant, const VectorXd& x, const Shared<const Frame>& aFrameSPtr, VectorXd& aContribution
+) const
+{
+    if ((ephemerisTableSPtr_ != nullptr) && ephemerisTableSPtr_->isApplicableAt(anInstant, aFrameSPtr))
+    {
+        // Point mass acceleration on the spacecraft, minus the one on the center of the central body
+
+        const Vector3d celestialPosition = ephemerisTableSPtr_->getPositionAt(anInstant);
+        const Vector3d relativePosition = celestialPosition - Vector3d(x[0], x[1], x[2]);
+
+        const double relativeDistance = relativePosition.norm();
+        const double celestialDistance = celestialPosition.norm();
+
+        aContribution = gravitationalParameter_SI_ *
+                        (relativePosition / (relativeDistance * relativeDistance * relativeDistance) -
+                         celestialPosition / (celestialDistance * celestialDistance * celestialDistance));
+
+        return;
+    }
+
     // Obtain 3rd body effect on center of Central Body (origin in GCRF) aka 3rd body correction
     // TBI: This fails for the earth as we cannot calculate the acceleration at the origin of the GCRF
     Vector3d gravitationalAccelerationSI =
@@ -101,10 +306,7 @@ VectorXd ThirdBodyGravity::computeContribution(
             .getValue();
 
     // Compute contribution
-    VectorXd contribution(3);
-    contribution << gravitationalAccelerationSI[0], gravitationalAccelerationSI[1], gravitationalAccelerationSI[2];
-
-    return contribution;
+    aContribution << gravitationalAccelerationSI[0], gravitationalAccelerationSI[1], gravitationalAccelerationSI[2];
 }
 
 void ThirdBodyGravity::print(std::ostream& anOutputStream, bool displayDecorator) const
@@ -115,6 +317,10 @@ void ThirdBodyGravity::print(std::ostream& anOutputStream, bool displayDecorator
 
     // TBI: Print Celestial once we have a proper implementation of Celestial::print
 
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Ephemeris Table:"
+        << ((ephemerisTableSPtr_ != nullptr) ? ephemerisTableSPtr_->getInterval().toString() : String("None"));
+
     displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
 }
 
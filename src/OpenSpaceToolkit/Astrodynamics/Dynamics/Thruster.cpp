@@ -1,5 +1,8 @@
 /// Apache License 2.0
 
+#include <cmath>
+#include <limits>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
@@ -22,7 +25,6 @@ namespace dynamics
 using ostk::mathematics::object::Vector3d;
 using ostk::mathematics::object::VectorXd;
 
-using ostk::physics::unit::Mass;
 
 using ostk::astrodynamics::trajectory::state::CoordinateSubset;
 using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianPosition;
@@ -36,6 +38,14 @@ Thruster::Thruster(
       guidanceLaw_(aGuidanceLaw),
       massFlowRateCache_(
           aSatelliteSystem.isDefined() ? aSatelliteSystem.accessPropulsionSystem().getMassFlowRate() : Real::Undefined()
+      ),
+      dryMassCache_(
+          aSatelliteSystem.isDefined() ? aSatelliteSystem.getMass().inKilograms()
+                                       : std::numeric_limits<double>::quiet_NaN()
+      ),
+      thrustCache_(
+          aSatelliteSystem.isDefined() ? double(aSatelliteSystem.accessPropulsionSystem().getThrust())
+                                       : std::numeric_limits<double>::quiet_NaN()
       )
 {
 }
@@ -86,19 +96,26 @@ VectorXd Thruster::computeContribution(
     const Vector3d positionCoordinates = {x[0], x[1], x[2]};
     const Vector3d velocityCoordinates = {x[3], x[4], x[5]};
 
-    if (x[6] <= satelliteSystem_.getMass().inKilograms())  // We compare against the dry mass of the Satellite
+    if (std::isnan(thrustCache_))
+    {
+        throw ostk::core::error::runtime::Undefined("Satellite System");
+    }
+
+    const double& mass = x[6];
+
+    if (mass <= dryMassCache_)  // We compare against the dry mass of the Satellite
     {
         throw ostk::core::error::RuntimeError("Out of fuel.");
     }
 
-    const Real maximumAccelerationMagnitude =
-        satelliteSystem_.accessPropulsionSystem().getAcceleration(Mass::Kilograms(x[6]));
+    // Same as PropulsionSystem::getAcceleration, without building a Mass
+    const double maximumAccelerationMagnitude = thrustCache_ / mass;
 
     const Vector3d acceleration = guidanceLaw_->calculateThrustAccelerationAt(
         anInstant, positionCoordinates, velocityCoordinates, maximumAccelerationMagnitude, aFrameSPtr
     );
 
-    const Real effectiveAccelerationFraction = acceleration.norm() / maximumAccelerationMagnitude;
+    const double effectiveAccelerationFraction = acceleration.norm() / maximumAccelerationMagnitude;
 
     // Compute contribution
     VectorXd contribution(4);
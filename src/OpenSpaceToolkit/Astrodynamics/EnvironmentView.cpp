@@ -0,0 +1,156 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/EnvironmentView.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+
+EnvironmentView::EnvironmentView(const Environment& anEnvironment)
+    : EnvironmentView(anEnvironment, anEnvironment.isDefined() ? anEnvironment.getInstant() : Instant::Undefined())
+{
+}
+
+EnvironmentView::EnvironmentView(const Environment& anEnvironment, const Instant& anInstant)
+    : EnvironmentView(
+          anEnvironment.isDefined() ? std::make_shared<const Array<Shared<const Object>>>(anEnvironment.accessObjects())
+                                    : nullptr,
+          anInstant
+      )
+{
+}
+
+bool EnvironmentView::isDefined() const
+{
+    return (this->objectsSPtr_ != nullptr) && this->instant_.isDefined();
+}
+
+Instant EnvironmentView::getInstant() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Environment view");
+    }
+
+    return this->instant_;
+}
+
+void EnvironmentView::setInstant(const Instant& anInstant)
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (this->objectsSPtr_ == nullptr)
+    {
+        throw ostk::core::error::runtime::Undefined("Environment view");
+    }
+
+    this->instant_ = anInstant;
+}
+
+const Array<Shared<const Object>>& EnvironmentView::accessObjects() const
+{
+    if (this->objectsSPtr_ == nullptr)
+    {
+        throw ostk::core::error::runtime::Undefined("Environment view");
+    }
+
+    return *this->objectsSPtr_;
+}
+
+Array<String> EnvironmentView::getObjectNames() const
+{
+    Array<String> objectNames = Array<String>::Empty();
+
+    for (const Shared<const Object>& objectSPtr : this->accessObjects())
+    {
+        objectNames.add(objectSPtr->getName());
+    }
+
+    return objectNames;
+}
+
+bool EnvironmentView::hasObjectWithName(const String& aName) const
+{
+    for (const Shared<const Object>& objectSPtr : this->accessObjects())
+    {
+        if (objectSPtr->getName() == aName)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+Shared<const Object> EnvironmentView::accessObjectWithName(const String& aName) const
+{
+    for (const Shared<const Object>& objectSPtr : this->accessObjects())
+    {
+        if (objectSPtr->getName() == aName)
+        {
+            return objectSPtr;
+        }
+    }
+
+    throw ostk::core::error::RuntimeError("No object with name [{}].", aName);
+}
+
+Shared<const Celestial> EnvironmentView::accessCelestialObjectWithName(const String& aName) const
+{
+    const Shared<const Celestial> celestialSPtr =
+        std::dynamic_pointer_cast<const Celestial>(this->accessObjectWithName(aName));
+
+    if (celestialSPtr == nullptr)
+    {
+        throw ostk::core::error::RuntimeError("Object with name [{}] is not celestial.", aName);
+    }
+
+    return celestialSPtr;
+}
+
+bool EnvironmentView::intersects(
+    const Object::Geometry& aGeometry, const Array<Shared<const Object>>& anObjectToIgnoreArray
+) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Environment view");
+    }
+
+    for (const Shared<const Object>& objectSPtr : *this->objectsSPtr_)
+    {
+        if (anObjectToIgnoreArray.contains(objectSPtr))
+        {
+            continue;
+        }
+
+        if (objectSPtr->getGeometryIn(aGeometry.accessFrame(), this->instant_).intersects(aGeometry))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+EnvironmentView EnvironmentView::Undefined()
+{
+    return {nullptr, Instant::Undefined()};
+}
+
+EnvironmentView::EnvironmentView(
+    const Shared<const Array<Shared<const Object>>>& anObjectArraySPtr, const Instant& anInstant
+)
+    : objectsSPtr_(anObjectArraySPtr),
+      instant_(anInstant)
+{
+}
+
+}  // namespace astrodynamics
+}  // namespace ostk
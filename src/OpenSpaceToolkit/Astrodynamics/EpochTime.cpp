@@ -0,0 +1,43 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/EpochTime.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+
+EpochTime::EpochTime(const Instant& anEpoch)
+    : epoch_(anEpoch)
+{
+}
+
+bool EpochTime::isDefined() const
+{
+    return epoch_.isDefined();
+}
+
+const Instant& EpochTime::accessEpoch() const
+{
+    return epoch_;
+}
+
+Instant EpochTime::getInstantAt(const double& aTime) const
+{
+    return epoch_ + Duration::Seconds(aTime);
+}
+
+double EpochTime::getTimeAt(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    return (anInstant - epoch_).inSeconds();
+}
+
+}  // namespace astrodynamics
+}  // namespace ostk
@@ -79,6 +79,20 @@ EventCondition::EventCondition(
 {
 }
 
+EventCondition::EventCondition(const EventCondition& anEventCondition)
+    : name_(anEventCondition.name_),
+      evaluator_(anEventCondition.evaluator_),
+      target_(anEventCondition.target_)
+{
+    const std::lock_guard<std::mutex> lock {*anEventCondition.cacheMutexSPtr_};
+
+    this->cachedStates_[0] = anEventCondition.cachedStates_[0];
+    this->cachedStates_[1] = anEventCondition.cachedStates_[1];
+    this->cachedValues_[0] = anEventCondition.cachedValues_[0];
+    this->cachedValues_[1] = anEventCondition.cachedValues_[1];
+    this->mostRecentCacheIndex_ = anEventCondition.mostRecentCacheIndex_;
+}
+
 EventCondition::~EventCondition() {}
 
 std::ostream& operator<<(std::ostream& anOutputStream, const EventCondition& anEventCondition)
@@ -116,6 +130,16 @@ void EventCondition::updateTarget(const State& aState)
     }
 }
 
+Shared<EventCondition> EventCondition::clone() const
+{
+    throw ostk::core::error::RuntimeError("Event Condition [{}] cannot be cloned.", name_);
+}
+
+Instant EventCondition::getTargetInstant() const
+{
+    return Instant::Undefined();
+}
+
 void EventCondition::print(std::ostream& anOutputStream, bool displayDecorator) const
 {
     displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Event Condition") : void();
@@ -128,5 +152,36 @@ void EventCondition::print(std::ostream& anOutputStream, bool displayDecorator)
     displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
 }
 
+Real EventCondition::evaluateWithCache(const State& aState) const
+{
+    {
+        const std::lock_guard<std::mutex> lock {*this->cacheMutexSPtr_};
+
+        for (Index cacheIndex = 0; cacheIndex < 2; ++cacheIndex)
+        {
+            if (this->cachedStates_[cacheIndex] == aState)
+            {
+                this->mostRecentCacheIndex_ = cacheIndex;
+
+                return this->cachedValues_[cacheIndex];
+            }
+        }
+    }
+
+    // The evaluator is called outside of the lock, as conditions may be shared across threads
+
+    const Real value = this->evaluator_(aState);
+
+    const std::lock_guard<std::mutex> lock {*this->cacheMutexSPtr_};
+
+    // The least recently used entry is replaced
+
+    this->mostRecentCacheIndex_ = 1 - this->mostRecentCacheIndex_;
+    this->cachedStates_[this->mostRecentCacheIndex_] = aState;
+    this->cachedValues_[this->mostRecentCacheIndex_] = value;
+
+    return value;
+}
+
 }  // namespace astrodynamics
 }  // namespace ostk
@@ -42,6 +42,11 @@ AngularCondition::AngularCondition(
 
 AngularCondition::~AngularCondition() {}
 
+Shared<EventCondition> AngularCondition::clone() const
+{
+    return std::make_shared<AngularCondition>(*this);
+}
+
 AngularCondition::Criterion AngularCondition::getCriterion() const
 {
     return criterion_;
@@ -90,7 +95,11 @@ void AngularCondition::print(std::ostream& anOutputStream, bool displayDecorator
 
 bool AngularCondition::isSatisfied(const State& currentState, const State& previousState) const
 {
-    return comparator_(evaluator_(currentState), evaluator_(previousState), (target_.value + target_.valueOffset));
+    // The previous state is evaluated first, as it is usually the (cached) current state of the previous step
+    const Real previousValue = this->evaluateWithCache(previousState);
+    const Real currentValue = this->evaluateWithCache(currentState);
+
+    return comparator_(currentValue, previousValue, (target_.value + target_.valueOffset));
 }
 
 AngularCondition AngularCondition::WithinRange(
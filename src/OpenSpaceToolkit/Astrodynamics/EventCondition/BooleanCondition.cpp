@@ -34,6 +34,11 @@ BooleanCondition::BooleanCondition(
 
 BooleanCondition::~BooleanCondition() {}
 
+Shared<EventCondition> BooleanCondition::clone() const
+{
+    return std::make_shared<BooleanCondition>(*this);
+}
+
 bool BooleanCondition::isInversed() const
 {
     return inverse_;
@@ -2,8 +2,16 @@
 
 #include <iostream>
 
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
 #include <OpenSpaceToolkit/Astrodynamics/EventCondition/COECondition.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler/COE.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/LazyState.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/TransformCache.hpp>
 
 namespace ostk
 {
@@ -12,18 +20,27 @@ namespace astrodynamics
 namespace eventcondition
 {
 
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
 using ostk::mathematics::object::Vector3d;
+using ostk::mathematics::object::Vector6d;
+using ostk::mathematics::object::VectorXd;
 
 using ostk::physics::coordinate::Frame;
-using ostk::physics::coordinate::Position;
-using ostk::physics::coordinate::Velocity;
+using ostk::physics::time::Instant;
 
+using ostk::physics::unit::Angle;
 using ostk::physics::unit::Derived;
 using ostk::physics::unit::Length;
 using ostk::physics::unit::Time;
 
 using ostk::astrodynamics::trajectory::orbit::model::kepler::COE;
 using ostk::astrodynamics::trajectory::State;
+using ostk::astrodynamics::trajectory::state::CoordinateBroker;
+using ostk::astrodynamics::trajectory::state::TransformCache;
+using ostk::astrodynamics::trajectory::state::LazyState;
 
 RealCondition COECondition::SemiMajorAxis(
     const RealCondition::Criterion& aCriterion,
@@ -149,39 +166,137 @@ std::function<Real(const State&)> COECondition::GenerateEvaluator(
     const COE::Element& anElement, const Shared<const Frame>& aFrameSPtr, const Derived& aGravitationalParameter
 )
 {
+    const Real gravitationalParameter_SI =
+        aGravitationalParameter.isDefined()
+            ? aGravitationalParameter.in(Derived::Unit::GravitationalParameter(Length::Unit::Meter, Time::Unit::Second))
+            : Real::Undefined();
+
     // The parameters must be captured by value as the function is being initialized during construction
-    return [anElement, aFrameSPtr, aGravitationalParameter](const State& aState) -> Real
+    return [anElement, aFrameSPtr, gravitationalParameter_SI](const State& aState) -> Real
     {
-        const State stateInFrame = aState.inFrame(aFrameSPtr);
-        const Position positionInFrame = stateInFrame.getPosition();
-        const Velocity velocityInFrame = stateInFrame.getVelocity();
+        const Vector6d coeVector = COECondition::CalculateCOEVector(aState, aFrameSPtr, gravitationalParameter_SI);
 
-        const COE coe = COE::Cartesian({positionInFrame, velocityInFrame}, aGravitationalParameter);
+        const Real eccentricity = coeVector[1];
+        const Angle trueAnomaly = Angle::Radians(coeVector[5]);
 
         switch (anElement)
         {
             case COE::Element::SemiMajorAxis:
-                return coe.getSemiMajorAxis().inMeters();
+                return coeVector[0];
             case COE::Element::Eccentricity:
-                return coe.getEccentricity();
+                return eccentricity;
             case COE::Element::Inclination:
-                return coe.getInclination().inRadians(0.0, Real::TwoPi());
+                return coeVector[2];
             case COE::Element::Aop:
-                return coe.getAop().inRadians(0.0, Real::TwoPi());
+                return coeVector[4];
             case COE::Element::Raan:
-                return coe.getRaan().inRadians(0.0, Real::TwoPi());
+                return coeVector[3];
             case COE::Element::TrueAnomaly:
-                return coe.getTrueAnomaly().inRadians(0.0, Real::TwoPi());
+                return coeVector[5];
             case COE::Element::MeanAnomaly:
-                return coe.getMeanAnomaly().inRadians(0.0, Real::TwoPi());
+                return COE::MeanAnomalyFromEccentricAnomaly(
+                           COE::EccentricAnomalyFromTrueAnomaly(trueAnomaly, eccentricity), eccentricity
+                )
+                    .inRadians(0.0, Real::TwoPi());
             case COE::Element::EccentricAnomaly:
-                return coe.getEccentricAnomaly().inRadians(0.0, Real::TwoPi());
+                return COE::EccentricAnomalyFromTrueAnomaly(trueAnomaly, eccentricity).inRadians(0.0, Real::TwoPi());
         }
 
         throw ostk::core::error::RuntimeError("Invalid element.");
     };
 }
 
+Vector6d COECondition::CalculateCOEVector(
+    const State& aState, const Shared<const Frame>& aFrameSPtr, const Real& aGravitationalParameter_SI
+)
+{
+    const auto calculateCOEVector = [&aState, &aFrameSPtr, &aGravitationalParameter_SI]() -> Vector6d
+    {
+        // Only the position and velocity are converted, the other coordinates of the state are not needed
+        const LazyState stateInFrame = {aState, aFrameSPtr};
+
+        Vector6d cartesianVector;
+        cartesianVector << stateInFrame.accessPositionCoordinates(), stateInFrame.accessVelocityCoordinates();
+
+        // Elements are computed on raw SI vectors, without going through the unit wrappers
+        return COE::CartesianToSIVector(cartesianVector, aGravitationalParameter_SI);
+    };
+
+    if (!aState.isDefined() || !aGravitationalParameter_SI.isDefined())
+    {
+        return calculateCOEVector();
+    }
+
+    struct CacheEntry
+    {
+        Instant instant;
+        Shared<const Frame> stateFrameSPtr;
+        Shared<const CoordinateBroker> coordinateBrokerSPtr;
+        VectorXd coordinates;
+        Shared<const Frame> frameSPtr;
+        double gravitationalParameter_SI;
+        Vector6d coeVector;
+    };
+
+    static constexpr Size CacheSize = 4;
+
+    // Each thread (e.g. each worker of a batch propagation) holds its own cache, hence no synchronization. Elements
+    // depend on frame transforms, hence the cache is dropped when the process-wide transform cache is cleared (e.g. on
+    // an Earth orientation model change).
+
+    thread_local Array<CacheEntry> cache = Array<CacheEntry>::Empty();
+    thread_local Index nextEntryIndex = 0;
+    thread_local Size cacheGeneration = TransformCache::GetGeneration();
+
+    const Size generation = TransformCache::GetGeneration();
+
+    if (generation != cacheGeneration)
+    {
+        cache.clear();
+        nextEntryIndex = 0;
+        cacheGeneration = generation;
+    }
+
+    const double gravitationalParameter_SI = aGravitationalParameter_SI;
+
+    for (const CacheEntry& entry : cache)
+    {
+        if ((entry.instant == aState.accessInstant()) && (entry.frameSPtr == aFrameSPtr) &&
+            (entry.stateFrameSPtr == aState.accessFrame()) &&
+            (entry.coordinateBrokerSPtr == aState.accessCoordinateBroker()) &&
+            (entry.gravitationalParameter_SI == gravitationalParameter_SI) &&
+            (entry.coordinates.size() == aState.accessCoordinates().size()) &&
+            (entry.coordinates == aState.accessCoordinates()))
+        {
+            return entry.coeVector;
+        }
+    }
+
+    const Vector6d coeVector = calculateCOEVector();
+
+    const CacheEntry entry = {
+        aState.accessInstant(),
+        aState.accessFrame(),
+        aState.accessCoordinateBroker(),
+        aState.accessCoordinates(),
+        aFrameSPtr,
+        gravitationalParameter_SI,
+        coeVector,
+    };
+
+    if (cache.getSize() < CacheSize)
+    {
+        cache.add(entry);
+    }
+    else
+    {
+        cache[nextEntryIndex] = entry;
+        nextEntryIndex = (nextEntryIndex + 1) % CacheSize;
+    }
+
+    return coeVector;
+}
+
 }  // namespace eventcondition
 }  // namespace astrodynamics
 }  // namespace ostk
@@ -22,10 +22,16 @@ InstantCondition::InstantCondition(const Criterion& aCriterion, const Instant& a
           (anInstant - Instant::J2000()).inSeconds()
       )
 {
+    isTimeBased_ = true;
 }
 
 InstantCondition::~InstantCondition() {}
 
+Shared<EventCondition> InstantCondition::clone() const
+{
+    return std::make_shared<InstantCondition>(*this);
+}
+
 Instant InstantCondition::getInstant() const
 {
     return Instant::J2000() + Duration::Seconds(getTarget().value);
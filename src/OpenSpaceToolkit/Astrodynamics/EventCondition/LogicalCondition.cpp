@@ -1,5 +1,11 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+
 #include <OpenSpaceToolkit/Astrodynamics/EventCondition/LogicalCondition.hpp>
 
 namespace ostk
@@ -9,18 +15,50 @@ namespace astrodynamics
 namespace eventcondition
 {
 
+using ostk::core::type::Index;
+
+// Number of evaluations of a compiled condition during which the cost of its event conditions is measured
+static const Size profiledEvaluationLimit = 16;
+
 LogicalCondition::LogicalCondition(
     const String& aName, const LogicalCondition::Type& aType, const Array<Shared<EventCondition>>& eventConditions
 )
     : EventCondition(aName, nullptr, 0.0),
       type_(aType),
       eventConditions_(eventConditions),
-      evaluator_(LogicalCondition::GenerateEvaluator(aType))
+      evaluator_(LogicalCondition::GenerateEvaluator(aType)),
+      isCompiled_(false),
+      compiledEventConditions_(Array<Shared<EventCondition>>::Empty()),
+      evaluationDurations_(),
+      decisionCounts_(),
+      profiledEvaluationCount_(0),
+      compilationMutexSPtr_(std::make_shared<std::mutex>())
 {
 }
 
 LogicalCondition::~LogicalCondition() {}
 
+Shared<EventCondition> LogicalCondition::clone() const
+{
+    Array<Shared<EventCondition>> eventConditions = Array<Shared<EventCondition>>::Empty();
+    eventConditions.reserve(eventConditions_.getSize());
+
+    for (const auto& eventCondition : eventConditions_)
+    {
+        eventConditions.add(eventCondition->clone());
+    }
+
+    const Shared<LogicalCondition> logicalConditionSPtr =
+        std::make_shared<LogicalCondition>(name_, type_, eventConditions);
+
+    if (isCompiled_)
+    {
+        logicalConditionSPtr->compile();
+    }
+
+    return logicalConditionSPtr;
+}
+
 LogicalCondition::Type LogicalCondition::getType() const
 {
     return type_;
@@ -39,8 +77,33 @@ void LogicalCondition::updateTarget(const State& aState)
     }
 }
 
+bool LogicalCondition::isCompiled() const
+{
+    return isCompiled_;
+}
+
+void LogicalCondition::compile()
+{
+    const std::lock_guard<std::mutex> lock(*compilationMutexSPtr_);
+
+    compiledEventConditions_ = Array<Shared<EventCondition>>::Empty();
+
+    collectCompiledEventConditions(eventConditions_);
+
+    evaluationDurations_.assign(compiledEventConditions_.getSize(), 0.0);
+    decisionCounts_.assign(compiledEventConditions_.getSize(), 0);
+    profiledEvaluationCount_ = 0;
+
+    isCompiled_ = true;
+}
+
 bool LogicalCondition::isSatisfied(const State& currentState, const State& previousState) const
 {
+    if (isCompiled_)
+    {
+        return isCompiledSatisfied(currentState, previousState);
+    }
+
     return evaluator_(eventConditions_, currentState, previousState);
 }
 
@@ -59,6 +122,125 @@ void LogicalCondition::print(std::ostream& anOutputStream, bool displayDecorator
     displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
 }
 
+void LogicalCondition::collectCompiledEventConditions(const Array<Shared<EventCondition>>& anEventConditionArray)
+{
+    for (const Shared<EventCondition>& eventConditionSPtr : anEventConditionArray)
+    {
+        const Shared<LogicalCondition> logicalConditionSPtr =
+            std::dynamic_pointer_cast<LogicalCondition>(eventConditionSPtr);
+
+        if (logicalConditionSPtr != nullptr)
+        {
+            // (a and b) and c is a and b and c
+
+            if (logicalConditionSPtr->type_ == type_)
+            {
+                collectCompiledEventConditions(logicalConditionSPtr->eventConditions_);
+
+                continue;
+            }
+
+            if (!logicalConditionSPtr->isCompiled())
+            {
+                logicalConditionSPtr->compile();
+            }
+        }
+
+        if (!compiledEventConditions_.contains(eventConditionSPtr))
+        {
+            compiledEventConditions_.add(eventConditionSPtr);
+        }
+    }
+}
+
+bool LogicalCondition::isCompiledSatisfied(const State& currentState, const State& previousState) const
+{
+    {
+        const std::lock_guard<std::mutex> lock(*compilationMutexSPtr_);
+
+        if (profiledEvaluationCount_ < profiledEvaluationLimit)
+        {
+            return profileCompiledSatisfied(currentState, previousState);
+        }
+    }
+
+    // Once profiled, the order of the event conditions is frozen
+
+    const bool decisiveValue = (type_ == Type::Or);
+
+    for (const Shared<EventCondition>& eventConditionSPtr : compiledEventConditions_)
+    {
+        if (eventConditionSPtr->isSatisfied(currentState, previousState) == decisiveValue)
+        {
+            return decisiveValue;
+        }
+    }
+
+    return !decisiveValue;
+}
+
+bool LogicalCondition::profileCompiledSatisfied(const State& currentState, const State& previousState) const
+{
+    // An event condition decides the outcome when false for a conjunction, and when true for a disjunction. All event
+    // conditions are evaluated while profiling, so that their costs and decision rates are measured.
+
+    const bool decisiveValue = (type_ == Type::Or);
+
+    bool isSatisfied = !decisiveValue;
+
+    for (Index index = 0; index < compiledEventConditions_.getSize(); ++index)
+    {
+        const auto startTime = std::chrono::steady_clock::now();
+
+        const bool value = compiledEventConditions_[index]->isSatisfied(currentState, previousState);
+
+        evaluationDurations_[index] +=
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+        if (value == decisiveValue)
+        {
+            ++decisionCounts_[index];
+            isSatisfied = decisiveValue;
+        }
+    }
+
+    if (++profiledEvaluationCount_ == profiledEvaluationLimit)
+    {
+        // Expected cost of ruling on the outcome, the decision count being offset so that it never vanishes
+
+        std::vector<double> costs(compiledEventConditions_.getSize());
+
+        for (Index index = 0; index < costs.size(); ++index)
+        {
+            costs[index] = evaluationDurations_[index] / double(decisionCounts_[index] + 1);
+        }
+
+        std::vector<Index> indices(costs.size());
+        std::iota(indices.begin(), indices.end(), 0);
+
+        std::stable_sort(
+            indices.begin(),
+            indices.end(),
+            [&costs](const Index& anIndex, const Index& anotherIndex) -> bool
+            {
+                return costs[anIndex] < costs[anotherIndex];
+            }
+        );
+
+        Array<Shared<EventCondition>> compiledEventConditions = Array<Shared<EventCondition>>::Empty();
+        compiledEventConditions.reserve(indices.size());
+
+        for (const Index& index : indices)
+        {
+            compiledEventConditions.add(compiledEventConditions_[index]);
+        }
+
+        compiledEventConditions_ = compiledEventConditions;
+    }
+
+    return isSatisfied;
+}
+
 LogicalCondition::evaluationSignature LogicalCondition::GenerateEvaluator(const LogicalCondition::Type& aType)
 {
     switch (aType)
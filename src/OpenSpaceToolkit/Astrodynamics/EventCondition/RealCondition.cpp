@@ -23,6 +23,7 @@ RealCondition::RealCondition(
     const Real& aTargetValue
 )
     : EventCondition(aName, anEvaluator, aTargetValue),
+      isTimeBased_(false),
       criterion_(aCriterion),
       comparator_(GenerateComparator(aCriterion))
 {
@@ -35,6 +36,7 @@ RealCondition::RealCondition(
     const Target& aTarget
 )
     : EventCondition(aName, anEvaluator, aTarget),
+      isTimeBased_(false),
       criterion_(aCriterion),
       comparator_(GenerateComparator(aCriterion))
 {
@@ -42,6 +44,11 @@ RealCondition::RealCondition(
 
 RealCondition::~RealCondition() {}
 
+Shared<EventCondition> RealCondition::clone() const
+{
+    return std::make_shared<RealCondition>(*this);
+}
+
 RealCondition::Criterion RealCondition::getCriterion() const
 {
     return criterion_;
@@ -57,14 +64,28 @@ void RealCondition::print(std::ostream& anOutputStream, bool displayDecorator) c
     displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
 }
 
+Instant RealCondition::getTargetInstant() const
+{
+    if (!isTimeBased_)
+    {
+        return Instant::Undefined();
+    }
+
+    return Instant::J2000() + Duration::Seconds(target_.value + target_.valueOffset);
+}
+
 Real RealCondition::evaluate(const State& aState) const
 {
-    return this->evaluator_(aState) - (target_.value + target_.valueOffset);
+    return this->evaluateWithCache(aState) - (target_.value + target_.valueOffset);
 }
 
 bool RealCondition::isSatisfied(const State& currentState, const State& previousState) const
 {
-    return comparator_(evaluate(currentState), evaluate(previousState));
+    // The previous state is evaluated first, as it is usually the (cached) current state of the previous step
+    const Real previousValue = evaluate(previousState);
+    const Real currentValue = evaluate(currentState);
+
+    return comparator_(currentValue, previousValue);
 }
 
 String RealCondition::StringFromCriterion(const Criterion& aCriterion)
@@ -95,7 +116,7 @@ String RealCondition::StringFromCriterion(const Criterion& aCriterion)
 
 RealCondition RealCondition::DurationCondition(const Criterion& aCriterion, const Duration& aDuration)
 {
-    return {
+    RealCondition durationCondition = {
         "Duration",
         aCriterion,
         [](const State& aState) -> Real
@@ -104,6 +125,10 @@ RealCondition RealCondition::DurationCondition(const Criterion& aCriterion, cons
         },
         {aDuration.inSeconds(), EventCondition::Target::Type::Relative}
     };
+
+    durationCondition.isTimeBased_ = true;
+
+    return durationCondition;
 }
 
 std::function<bool(const Real&, const Real&)> RealCondition::GenerateComparator(
@@ -0,0 +1,147 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <thread>
+
+#include <OpenSpaceToolkit/Astrodynamics/ExecutionContext.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+
+static std::atomic<Size> defaultThreadCount = {0};
+
+static thread_local bool isWorkerThread = false;
+
+ExecutionContext::ExecutionContext(const Size& aThreadCount)
+    : threadCount_(aThreadCount)
+{
+}
+
+Size ExecutionContext::getThreadCount() const
+{
+    return (this->threadCount_ > 0) ? this->threadCount_ : ExecutionContext::GetDefaultThreadCount();
+}
+
+void ExecutionContext::parallelFor(const Size& aTaskCount, const std::function<void(const Index&)>& aTask) const
+{
+    this->parallelFor(
+        aTaskCount,
+        [&aTask]() -> std::function<void(const Index&)>
+        {
+            return aTask;
+        }
+    );
+}
+
+void ExecutionContext::parallelFor(
+    const Size& aTaskCount, const std::function<std::function<void(const Index&)>()>& aTaskFactory
+) const
+{
+    if (aTaskCount == 0)
+    {
+        return;
+    }
+
+    // Nested operations run serially on the calling worker
+
+    const Size threadCount = isWorkerThread ? 1 : std::min<Size>(aTaskCount, this->getThreadCount());
+
+    static const Index noIndex = std::numeric_limits<Index>::max();
+
+    std::atomic<Index> taskIndexCounter = {0};
+    std::atomic<Index> failedTaskIndex = {noIndex};
+
+    std::mutex exceptionMutex;
+    std::exception_ptr exceptionPtr = nullptr;
+
+    const auto recordFailure = [&](const Index& aTaskIndex) -> void
+    {
+        const std::lock_guard<std::mutex> lock(exceptionMutex);
+
+        if (aTaskIndex < failedTaskIndex)
+        {
+            failedTaskIndex = aTaskIndex;
+            exceptionPtr = std::current_exception();
+        }
+    };
+
+    const auto work = [&]() -> void
+    {
+        const bool wasWorkerThread = isWorkerThread;
+
+        isWorkerThread = true;
+
+        std::function<void(const Index&)> task;
+
+        for (Index taskIndex = taskIndexCounter++; (taskIndex < aTaskCount) && (taskIndex < failedTaskIndex);
+             taskIndex = taskIndexCounter++)
+        {
+            try
+            {
+                if (!task)
+                {
+                    task = aTaskFactory();
+                }
+
+                task(taskIndex);
+            }
+            catch (...)
+            {
+                recordFailure(taskIndex);
+            }
+        }
+
+        isWorkerThread = wasWorkerThread;
+    };
+
+    if (threadCount <= 1)
+    {
+        work();
+    }
+    else
+    {
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount);
+
+        for (Size threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            threads.emplace_back(work);
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    if (exceptionPtr != nullptr)
+    {
+        std::rethrow_exception(exceptionPtr);
+    }
+}
+
+bool ExecutionContext::IsWorkerThread()
+{
+    return isWorkerThread;
+}
+
+Size ExecutionContext::GetDefaultThreadCount()
+{
+    const Size threadCount = defaultThreadCount;
+
+    return (threadCount > 0) ? threadCount : std::max<Size>(1, std::thread::hardware_concurrency());
+}
+
+void ExecutionContext::SetDefaultThreadCount(const Size& aThreadCount)
+{
+    defaultThreadCount = aThreadCount;
+}
+
+}  // namespace astrodynamics
+}  // namespace ostk
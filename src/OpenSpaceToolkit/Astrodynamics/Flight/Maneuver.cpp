@@ -16,12 +16,20 @@ namespace astrodynamics
 namespace flight
 {
 
+using ostk::mathematics::object::Matrix3d;
+
 using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
 
-const Shared<const Frame> Maneuver::DefaultAccelFrameSPtr = Frame::GCRF();
 const Duration Maneuver::MinimumRecommendedDuration = Duration::Seconds(30.0);
 const Duration Maneuver::MaximumRecommendedInterpolationInterval = Duration::Minutes(2.0);
 
+const Shared<const Frame>& Maneuver::DefaultAccelFrame()
+{
+    static const Shared<const Frame> defaultAccelFrameSPtr = Frame::GCRF();
+
+    return defaultAccelFrameSPtr;
+}
+
 Maneuver::Maneuver(
     const Array<Instant>& anInstantArray,
     const Array<Vector3d>& anAccelerationProfile,
@@ -161,6 +169,50 @@ Interval Maneuver::getInterval() const
     return Interval::Closed(instants_.accessFirst(), instants_.accessLast());
 }
 
+Array<Vector3d> Maneuver::getAccelerationProfileInLocalOrbitalFrame(
+    const Shared<const LocalOrbitalFrameFactory>& aLocalOrbitalFrameFactorySPtr, const Array<State>& aStateArray
+) const
+{
+    if ((aLocalOrbitalFrameFactorySPtr == nullptr) || (!aLocalOrbitalFrameFactorySPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Local Orbital Frame Factory");
+    }
+
+    if (aStateArray.getSize() != instants_.getSize())
+    {
+        throw ostk::core::error::RuntimeError(
+            "State array must have the same number of elements as the number of instants."
+        );
+    }
+
+    for (Size i = 0; i < instants_.getSize(); i++)
+    {
+        if (aStateArray[i].accessInstant() != instants_[i])
+        {
+            throw ostk::core::error::RuntimeError("State instants must match the maneuver instants.");
+        }
+    }
+
+    const Array<Matrix3d> rotationMatrices = aLocalOrbitalFrameFactorySPtr->generateRotationMatrices(aStateArray);
+
+    const Shared<const Frame>& parentFrameSPtr = aLocalOrbitalFrameFactorySPtr->accessParentFrame();
+    const bool isParentFrameDefault = (*parentFrameSPtr) == (*Maneuver::DefaultAccelFrame());
+
+    Array<Vector3d> accelerationProfile = Array<Vector3d>(instants_.getSize(), Vector3d::Zero());
+
+    for (Size i = 0; i < instants_.getSize(); i++)
+    {
+        const Vector3d acceleration_parentFrame =
+            isParentFrameDefault ? accelerationProfileDefaultFrame_[i]
+                                 : Maneuver::DefaultAccelFrame()->getTransformTo(parentFrameSPtr, instants_[i])
+                                       .applyToVector(accelerationProfileDefaultFrame_[i]);
+
+        accelerationProfile[i] = rotationMatrices[i] * acceleration_parentFrame;
+    }
+
+    return accelerationProfile;
+}
+
 Real Maneuver::calculateDeltaV() const
 {
     // Use simple forward trapezoidal rule to calculate the total delta-v
@@ -296,9 +348,48 @@ Maneuver Maneuver::ConstantMassFlowRateProfile(
     return {anInstantArray, anAccelerationProfile, aFrameSPtr, Array<Real>(anInstantArray.getSize(), aMassFlowRate)};
 }
 
+Maneuver Maneuver::LocalOrbitalFrameAccelerationProfile(
+    const Array<State>& aStateArray,
+    const Array<Vector3d>& anAccelerationProfile,
+    const Shared<const LocalOrbitalFrameFactory>& aLocalOrbitalFrameFactorySPtr,
+    const Array<Real>& aMassFlowRateProfile
+)
+{
+    if ((aLocalOrbitalFrameFactorySPtr == nullptr) || (!aLocalOrbitalFrameFactorySPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Local Orbital Frame Factory");
+    }
+
+    if (aStateArray.getSize() != anAccelerationProfile.getSize())
+    {
+        throw ostk::core::error::RuntimeError(
+            "Acceleration profile must have the same number of elements as the number of states."
+        );
+    }
+
+    const Array<Matrix3d> rotationMatrices = aLocalOrbitalFrameFactorySPtr->generateRotationMatrices(aStateArray);
+
+    Array<Instant> instants = Array<Instant>::Empty();
+    instants.reserve(aStateArray.getSize());
+
+    Array<Vector3d> accelerationProfile = Array<Vector3d>::Empty();
+    accelerationProfile.reserve(aStateArray.getSize());
+
+    for (Size i = 0; i < aStateArray.getSize(); i++)
+    {
+        instants.add(aStateArray[i].accessInstant());
+
+        // The rotation matrices are orthonormal, hence their transpose maps back to the parent frame
+
+        accelerationProfile.add(rotationMatrices[i].transpose() * anAccelerationProfile[i]);
+    }
+
+    return {instants, accelerationProfile, aLocalOrbitalFrameFactorySPtr->accessParentFrame(), aMassFlowRateProfile};
+}
+
 Array<Vector3d> Maneuver::convertAccelerationProfileFrame(const Shared<const Frame>& aFrameSPtr) const
 {
-    if (aFrameSPtr == Maneuver::DefaultAccelFrameSPtr)
+    if (aFrameSPtr == Maneuver::DefaultAccelFrame())
     {
         return accelerationProfileDefaultFrame_;
     }
@@ -307,7 +398,7 @@ Array<Vector3d> Maneuver::convertAccelerationProfileFrame(const Shared<const Fra
     Array<Vector3d> accelerationProfileInDefaultFrame = Array<Vector3d>(instants_.getSize(), Vector3d::Zero());
     for (Size i = 0; i < instants_.getSize(); i++)
     {
-        accelerationProfileInDefaultFrame[i] = aFrameSPtr->getTransformTo(Maneuver::DefaultAccelFrameSPtr, instants_[i])
+        accelerationProfileInDefaultFrame[i] = aFrameSPtr->getTransformTo(Maneuver::DefaultAccelFrame(), instants_[i])
                                                    .applyToVector(accelerationProfileDefaultFrame_[i]);
     }
     return accelerationProfileInDefaultFrame;
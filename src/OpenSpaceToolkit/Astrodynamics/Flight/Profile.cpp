@@ -91,6 +91,23 @@ Shared<const Frame> Profile::getBodyFrame(const String& aFrameName) const
     return modelUPtr_->getBodyFrame(aFrameName);
 }
 
+Profile Profile::tabulate(const Array<Instant>& anInstantArray) const
+{
+    using ostk::astrodynamics::flight::profile::model::Transform;
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Profile");
+    }
+
+    if (const Transform* transformModelPtr = dynamic_cast<const Transform*>(this->modelUPtr_.get()))
+    {
+        return {transformModelPtr->tabulate(anInstantArray)};
+    }
+
+    return *this;
+}
+
 void Profile::print(std::ostream& anOutputStream, bool displayDecorator) const
 {
     displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Flight Profile") : void();
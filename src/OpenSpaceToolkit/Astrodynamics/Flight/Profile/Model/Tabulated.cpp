@@ -1,5 +1,7 @@
 /// Apache License 2.0
 
+#include <algorithm>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
@@ -18,13 +20,31 @@ namespace profile
 namespace model
 {
 
+using ostk::core::type::Size;
+
 using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+using ostk::mathematics::object::VectorXd;
 
 Tabulated::Tabulated(const Array<State>& aStateArray)
     : Model(),
       states_(aStateArray),
+      instants_(Array<Instant>::Empty()),
+      coordinates_(13, aStateArray.getSize()),
       stateIndex_(0)
 {
+    instants_.reserve(states_.getSize());
+
+    for (Index i = 0; i < states_.getSize(); ++i)
+    {
+        const State& state = states_[i];
+
+        instants_.add(state.accessInstant());
+
+        coordinates_.col(i).segment<3>(0) = state.accessPositionCoordinates();
+        coordinates_.col(i).segment<3>(3) = state.accessVelocityCoordinates();
+        coordinates_.col(i).segment<4>(6) = state.getAttitude().toVector(Quaternion::Format::XYZS);
+        coordinates_.col(i).segment<3>(10) = state.getAngularVelocity();
+    }
 }
 
 Tabulated* Tabulated::clone() const
@@ -71,14 +91,6 @@ Interval Tabulated::getInterval() const
 
 State Tabulated::calculateStateAt(const Instant& anInstant) const
 {
-    using ostk::core::type::Real;
-
-    using ostk::mathematics::object::Vector3d;
-
-    using ostk::physics::coordinate::Position;
-    using ostk::physics::coordinate::Velocity;
-    using ostk::physics::time::Duration;
-
     if (!anInstant.isDefined())
     {
         throw ostk::core::error::runtime::Undefined("Instant");
@@ -89,50 +101,34 @@ State Tabulated::calculateStateAt(const Instant& anInstant) const
         throw ostk::core::error::runtime::Undefined("Tabulated");
     }
 
-    const Pair<const State*, const State*> stateRange = this->accessStateRangeAt(anInstant);
+    return this->interpolateStateAt(anInstant, stateIndex_);
+}
 
-    if ((stateRange.first != nullptr) && (stateRange.second != nullptr))
-    {
-        const State& previousState = *(stateRange.first);
-        const State& nextState = *(stateRange.second);
-
-        const Real ratio = Duration::Between(previousState.accessInstant(), anInstant).inSeconds() /
-                           Duration::Between(previousState.accessInstant(), nextState.accessInstant()).inSeconds();
-
-        return {
-            anInstant,
-            Position {
-                previousState.getPosition().accessCoordinates() +
-                    ratio *
-                        (nextState.getPosition().accessCoordinates() - previousState.getPosition().accessCoordinates()),
-                previousState.getPosition().getUnit(),
-                previousState.getPosition().accessFrame()
-            },
-            Velocity {
-                previousState.getVelocity().accessCoordinates() +
-                    ratio *
-                        (nextState.getVelocity().accessCoordinates() - previousState.getVelocity().accessCoordinates()),
-                previousState.getVelocity().getUnit(),
-                previousState.getVelocity().accessFrame()
-            },
-            Quaternion::SLERP(previousState.getAttitude(), nextState.getAttitude(), ratio),
-            previousState.getAngularVelocity() +
-                ratio * (nextState.getAngularVelocity() - previousState.getAngularVelocity()),
-            previousState.getFrame()
-        };
-    }
-    else if (stateRange.first != nullptr)
+Array<State> Tabulated::calculateStatesAt(const Array<Instant>& anInstantArray) const
+{
+    if (!this->isDefined())
     {
-        return *(stateRange.first);
+        throw ostk::core::error::runtime::Undefined("Tabulated");
     }
-    else if (stateRange.second != nullptr)
+
+    Array<State> states = Array<State>::Empty();
+    states.reserve(anInstantArray.getSize());
+
+    Index stateIndex = stateIndex_;
+
+    for (const Instant& instant : anInstantArray)
     {
-        return *(stateRange.second);
+        if (!instant.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Instant");
+        }
+
+        states.add(this->interpolateStateAt(instant, stateIndex));
     }
 
-    throw ostk::core::error::RuntimeError("Cannot calculate state at [{}].", anInstant.toString());
+    stateIndex_ = stateIndex;
 
-    return State::Undefined();
+    return states;
 }
 
 Axes Tabulated::getAxesAt(const Instant& anInstant) const
@@ -222,100 +218,79 @@ bool Tabulated::operator!=(const Model& aModel) const
     return !((*this) == aModel);
 }
 
-Pair<const State*, const State*> Tabulated::accessStateRangeAt(const Instant& anInstant) const
+Index Tabulated::locateStateIndex(const Instant& anInstant, const Index& aStateIndexHint) const
 {
-    using ostk::core::container::Unpack;
+    const Size stateCount = instants_.getSize();
+    const Index index = std::min<Index>(aStateIndexHint, stateCount - 1);
 
-    State const* previousStatePtr = nullptr;
-    State const* nextStatePtr = nullptr;
+    // Check the cached interval and the next one first, as consecutive queries are usually close in time
 
-    while (true)  // To be improved
+    if (instants_[index] <= anInstant)
     {
-        Unpack(previousStatePtr, nextStatePtr) = this->accessStateRangeAtIndex(stateIndex_);  // Check index cache
-
-        if ((previousStatePtr != nullptr) && (nextStatePtr != nullptr))
-        {
-            if ((previousStatePtr->accessInstant() <= anInstant) && (anInstant <= nextStatePtr->accessInstant()))
-            {
-                if (previousStatePtr->accessInstant() == anInstant)
-                {
-                    return {nullptr, previousStatePtr};
-                }
-                else if (nextStatePtr->accessInstant() == anInstant)
-                {
-                    return {nextStatePtr, nullptr};
-                }
-
-                return {previousStatePtr, nextStatePtr};
-            }
-            else
-            {
-                if (anInstant < previousStatePtr->accessInstant())
-                {
-                    if (stateIndex_ > 0)
-                    {
-                        stateIndex_--;
-                    }
-                    else
-                    {
-                        break;
-                    }
-                }
-                else
-                {
-                    if ((states_.getSize() > 0) && (stateIndex_ < (states_.getSize() - 1)))
-                    {
-                        stateIndex_++;
-                    }
-                    else
-                    {
-                        break;
-                    }
-                }
-            }
-        }
-        else if (previousStatePtr != nullptr)
+        if (((index + 1) == stateCount) || (anInstant < instants_[index + 1]))
         {
-            if (previousStatePtr->accessInstant() == anInstant)
-            {
-                return {nullptr, previousStatePtr};
-            }
-            else
-            {
-                if (anInstant < previousStatePtr->accessInstant())
-                {
-                    if (stateIndex_ > 0)
-                    {
-                        stateIndex_--;
-                    }
-                    else
-                    {
-                        break;
-                    }
-                }
-                else
-                {
-                    return {nullptr, nullptr};
-                }
-            }
+            return index;
         }
-        else
-        {
-            stateIndex_ = 0;
 
-            break;
+        if (((index + 2) == stateCount) || (anInstant < instants_[index + 2]))
+        {
+            return index + 1;
         }
     }
 
-    return {nullptr, nullptr};
+    return static_cast<Index>(std::upper_bound(instants_.begin(), instants_.end(), anInstant) - instants_.begin()) -
+           1;
 }
 
-Pair<const State*, const State*> Tabulated::accessStateRangeAtIndex(const Index& anIndex) const
+State Tabulated::interpolateStateAt(const Instant& anInstant, Index& aStateIndex) const
 {
-    const State* previousStatePtr = (anIndex < states_.getSize()) ? &(states_.at(anIndex)) : nullptr;
-    const State* nextStatePtr = ((anIndex + 1) < states_.getSize()) ? &(states_.at(anIndex + 1)) : nullptr;
+    using ostk::physics::coordinate::Position;
+    using ostk::physics::coordinate::Velocity;
+    using ostk::physics::time::Duration;
+
+    if ((anInstant < instants_.accessFirst()) || (anInstant > instants_.accessLast()))
+    {
+        throw ostk::core::error::RuntimeError("Cannot calculate state at [{}].", anInstant.toString());
+    }
+
+    aStateIndex = this->locateStateIndex(anInstant, aStateIndex);
+
+    if (instants_[aStateIndex] == anInstant)
+    {
+        return states_[aStateIndex];
+    }
 
-    return {previousStatePtr, nextStatePtr};
+    const Index nextStateIndex = aStateIndex + 1;
+
+    const double ratio = Duration::Between(instants_[aStateIndex], anInstant).inSeconds() /
+                         Duration::Between(instants_[aStateIndex], instants_[nextStateIndex]).inSeconds();
+
+    const VectorXd previousCoordinates = coordinates_.col(aStateIndex);
+    const VectorXd nextCoordinates = coordinates_.col(nextStateIndex);
+
+    const VectorXd coordinates = previousCoordinates + ratio * (nextCoordinates - previousCoordinates);
+
+    const Quaternion previousAttitude = {
+        previousCoordinates(6),
+        previousCoordinates(7),
+        previousCoordinates(8),
+        previousCoordinates(9),
+        Quaternion::Format::XYZS
+    };
+    const Quaternion nextAttitude = {
+        nextCoordinates(6), nextCoordinates(7), nextCoordinates(8), nextCoordinates(9), Quaternion::Format::XYZS
+    };
+
+    const Shared<const Frame> frameSPtr = states_[aStateIndex].accessFrame();
+
+    return {
+        anInstant,
+        Position::Meters(coordinates.segment<3>(0), frameSPtr),
+        Velocity::MetersPerSecond(coordinates.segment<3>(3), frameSPtr),
+        Quaternion::SLERP(previousAttitude, nextAttitude, ratio),
+        coordinates.segment<3>(10),
+        frameSPtr
+    };
 }
 
 }  // namespace model
@@ -1,5 +1,7 @@
 /// Apache License 2.0
 
+#include <algorithm>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
@@ -121,6 +123,59 @@ void Transform::print(std::ostream& anOutputStream, bool displayDecorator) const
     displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
 }
 
+Transform Transform::tabulate(const Array<Instant>& anInstantArray) const
+{
+    using ostk::physics::coordinate::Transform;
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Transform");
+    }
+
+    Array<Instant> instants = anInstantArray;
+
+    for (const Instant& instant : instants)
+    {
+        if (!instant.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Instant");
+        }
+    }
+
+    std::sort(instants.begin(), instants.end());
+    instants.erase(std::unique(instants.begin(), instants.end()), instants.end());
+
+    Array<Transform> transforms = Array<Transform>::Empty();
+    transforms.reserve(instants.getSize());
+
+    for (const Instant& instant : instants)
+    {
+        transforms.add(this->transformProvider_.getTransformAt(instant));
+    }
+
+    const Shared<const Array<Instant>> instantsSPtr = std::make_shared<const Array<Instant>>(std::move(instants));
+    const Shared<const Array<Transform>> transformsSPtr =
+        std::make_shared<const Array<Transform>>(std::move(transforms));
+
+    const DynamicProvider transformProvider = this->transformProvider_;
+
+    const DynamicProvider dynamicTransformProvider = {
+        [instantsSPtr, transformsSPtr, transformProvider](const Instant& anInstant) -> Transform
+        {
+            const auto instantIt = std::lower_bound(instantsSPtr->begin(), instantsSPtr->end(), anInstant);
+
+            if ((instantIt != instantsSPtr->end()) && (*instantIt == anInstant))
+            {
+                return transformsSPtr->at(instantIt - instantsSPtr->begin());
+            }
+
+            return transformProvider.getTransformAt(anInstant);
+        }
+    };
+
+    return {dynamicTransformProvider, this->frameSPtr_};
+}
+
 Transform Transform::Undefined()
 {
     return {DynamicProvider::Undefined(), Frame::Undefined()};
@@ -1,5 +1,8 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <cmath>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
@@ -14,6 +17,155 @@ namespace flight
 namespace system
 {
 
+SatelliteSystem::ProjectedAreaTable::ProjectedAreaTable(
+    const Composite& aGeometry, const Size& anAzimuthCount, const Size& anElevationCount
+)
+    : azimuthCount_(anAzimuthCount),
+      elevationCount_(anElevationCount),
+      projectedAreas_(Array<double>::Empty())
+{
+    if (!SatelliteSystem::ProjectedAreaTable::IsSupported(aGeometry))
+    {
+        throw ostk::core::error::runtime::Wrong("Geometry");
+    }
+
+    if (azimuthCount_ < 1)
+    {
+        throw ostk::core::error::runtime::Wrong("Azimuth count");
+    }
+
+    if (elevationCount_ < 2)
+    {
+        throw ostk::core::error::runtime::Wrong("Elevation count");
+    }
+
+    projectedAreas_.reserve(azimuthCount_ * elevationCount_);
+
+    for (Index azimuthIndex = 0; azimuthIndex < azimuthCount_; ++azimuthIndex)
+    {
+        const double azimuth_rad = 2.0 * M_PI * double(azimuthIndex) / double(azimuthCount_);
+
+        for (Index elevationIndex = 0; elevationIndex < elevationCount_; ++elevationIndex)
+        {
+            const double elevation_rad = -M_PI / 2.0 + M_PI * double(elevationIndex) / double(elevationCount_ - 1);
+
+            const Vector3d direction_B = {
+                std::cos(elevation_rad) * std::cos(azimuth_rad),
+                std::cos(elevation_rad) * std::sin(azimuth_rad),
+                std::sin(elevation_rad),
+            };
+
+            projectedAreas_.add(SatelliteSystem::ProjectedAreaTable::ComputeProjectedArea(aGeometry, direction_B));
+        }
+    }
+}
+
+Size SatelliteSystem::ProjectedAreaTable::getAzimuthCount() const
+{
+    return azimuthCount_;
+}
+
+Size SatelliteSystem::ProjectedAreaTable::getElevationCount() const
+{
+    return elevationCount_;
+}
+
+Real SatelliteSystem::ProjectedAreaTable::getProjectedAreaAt(const Vector3d& aDirection_B) const
+{
+    const double norm = aDirection_B.norm();
+
+    if (norm == 0.0)
+    {
+        throw ostk::core::error::runtime::Wrong("Direction");
+    }
+
+    // Grid coordinates, azimuth is periodic
+
+    double azimuth_rad = std::atan2(aDirection_B.y(), aDirection_B.x());
+
+    if (azimuth_rad < 0.0)
+    {
+        azimuth_rad += 2.0 * M_PI;
+    }
+
+    const double elevation_rad = std::asin(std::clamp(aDirection_B.z() / norm, -1.0, 1.0));
+
+    const double azimuthCoordinate = azimuth_rad / (2.0 * M_PI) * azimuthCount_;
+    const double elevationCoordinate =
+        std::clamp((elevation_rad + M_PI / 2.0) / M_PI * (elevationCount_ - 1), 0.0, double(elevationCount_ - 1));
+
+    const Index azimuthIndex = std::min(Index(azimuthCoordinate), Index(azimuthCount_ - 1));
+    const Index elevationIndex = std::min(Index(elevationCoordinate), Index(elevationCount_ - 2));
+
+    const double azimuthWeight = azimuthCoordinate - azimuthIndex;
+    const double elevationWeight = elevationCoordinate - elevationIndex;
+
+    const Index nextAzimuthIndex = (azimuthIndex + 1) % azimuthCount_;
+
+    const auto projectedAreaAt = [this](const Index& anAzimuthIndex, const Index& anElevationIndex) -> double
+    {
+        return projectedAreas_[anAzimuthIndex * elevationCount_ + anElevationIndex];
+    };
+
+    return (1.0 - azimuthWeight) * (1.0 - elevationWeight) * projectedAreaAt(azimuthIndex, elevationIndex) +
+           (1.0 - azimuthWeight) * elevationWeight * projectedAreaAt(azimuthIndex, elevationIndex + 1) +
+           azimuthWeight * (1.0 - elevationWeight) * projectedAreaAt(nextAzimuthIndex, elevationIndex) +
+           azimuthWeight * elevationWeight * projectedAreaAt(nextAzimuthIndex, elevationIndex + 1);
+}
+
+bool SatelliteSystem::ProjectedAreaTable::IsSupported(const Composite& aGeometry)
+{
+    if (!aGeometry.isDefined())
+    {
+        return false;
+    }
+
+    for (const auto& objectUPtr : aGeometry.accessObjects())
+    {
+        if ((!objectUPtr->is<Cuboid>()) && (!objectUPtr->is<Point>()))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+Real SatelliteSystem::ProjectedAreaTable::ComputeProjectedArea(const Composite& aGeometry, const Vector3d& aDirection_B)
+{
+    double projectedArea = 0.0;
+
+    for (const auto& objectUPtr : aGeometry.accessObjects())
+    {
+        if (objectUPtr->is<Point>())
+        {
+            continue;
+        }
+
+        if (!objectUPtr->is<Cuboid>())
+        {
+            throw ostk::core::error::runtime::Wrong("Geometry");
+        }
+
+        const Cuboid& cuboid = objectUPtr->as<Cuboid>();
+
+        const auto axes = cuboid.getAxes();
+        const auto extent = cuboid.getExtent();  // Half lengths
+
+        const double e0 = extent[0];
+        const double e1 = extent[1];
+        const double e2 = extent[2];
+
+        // Each pair of opposite faces projects onto its area, scaled by the cosine of the view angle
+
+        projectedArea += 4.0 * (e1 * e2 * std::abs(aDirection_B.dot(axes[0])) +
+                                e0 * e2 * std::abs(aDirection_B.dot(axes[1])) +
+                                e0 * e1 * std::abs(aDirection_B.dot(axes[2])));
+    }
+
+    return projectedArea;
+}
+
 SatelliteSystem::SatelliteSystem(
     const Mass& aDryMass,
     const Composite& aSatelliteGeometry,
@@ -26,7 +178,12 @@ SatelliteSystem::SatelliteSystem(
       inertiaTensor_(anInertiaTensor),
       crossSectionalSurfaceArea_(aCrossSectionalSurfaceArea),
       dragCoefficient_(aDragCoefficient),
-      propulsionSystem_(aPropulsionSystem)
+      propulsionSystem_(aPropulsionSystem),
+      projectedAreaTableSPtr_(
+          SatelliteSystem::ProjectedAreaTable::IsSupported(aSatelliteGeometry)
+              ? std::make_shared<const ProjectedAreaTable>(aSatelliteGeometry)
+              : nullptr
+      )
 {
 }
 
@@ -133,6 +290,11 @@ PropulsionSystem SatelliteSystem::getPropulsionSystem() const
     return this->accessPropulsionSystem();
 }
 
+Shared<const SatelliteSystem::ProjectedAreaTable> SatelliteSystem::getProjectedAreaTable() const
+{
+    return projectedAreaTableSPtr_;
+}
+
 SatelliteSystem SatelliteSystem::Undefined()
 {
     return {
@@ -53,17 +53,33 @@ Vector3d ConstantThrust::calculateThrustAccelerationAt(
     const Shared<const Frame>& outputFrameSPtr
 ) const
 {
-    const Shared<const Frame> localOrbitalFrameSPtr =
-        this->localOrbitalFrameDirection_.accessLocalOrbitalFrameFactory()->generateFrame(
-            anInstant, aPositionCoordinates, aVelocityCoordinates
-        );
+    const Shared<const LocalOrbitalFrameFactory>& localOrbitalFrameFactorySPtr =
+        this->localOrbitalFrameDirection_.accessLocalOrbitalFrameFactory();
 
-    const Quaternion q_requestedFrame_LOF =
-        localOrbitalFrameSPtr->getTransformTo(outputFrameSPtr, anInstant).getOrientation().normalize();
+    // The local orbital frame is resolved as a transform from its parent frame, without registering a frame at every
+    // evaluation
+
+    const Quaternion q_parentFrame_LOF =
+        localOrbitalFrameFactorySPtr->generateTransform(anInstant, aPositionCoordinates, aVelocityCoordinates)
+            .getOrientation()
+            .toConjugate()
+            .toNormalized();
 
     const Vector3d acceleration_LOF = aThrustAcceleration * this->localOrbitalFrameDirection_.getValue();
 
-    return q_requestedFrame_LOF.rotateVector(acceleration_LOF);
+    const Vector3d acceleration_parentFrame = q_parentFrame_LOF.rotateVector(acceleration_LOF);
+
+    const Shared<const Frame>& parentFrameSPtr = localOrbitalFrameFactorySPtr->accessParentFrame();
+
+    if ((parentFrameSPtr == outputFrameSPtr) || (*parentFrameSPtr == *outputFrameSPtr))
+    {
+        return acceleration_parentFrame;
+    }
+
+    const Quaternion q_requestedFrame_parentFrame =
+        parentFrameSPtr->getTransformTo(outputFrameSPtr, anInstant).getOrientation().toNormalized();
+
+    return q_requestedFrame_parentFrame.rotateVector(acceleration_parentFrame);
 }
 
 void ConstantThrust::print(std::ostream& anOutputStream, bool displayDecorator) const
@@ -1,11 +1,18 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <atomic>
+
+#include <Eigen/Core>
+#include <unsupported/Eigen/AutoDiff>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/Thruster.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/ExecutionContext.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/GuidanceLaw/QLaw.hpp>
-#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
-#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Segment.hpp>
 
 namespace ostk
 {
@@ -20,11 +27,41 @@ using ostk::mathematics::object::Vector6d;
 using ostk::mathematics::object::VectorXd;
 
 using ostk::physics::coordinate::Frame;
-using ostk::physics::coordinate::Position;
-using ostk::physics::coordinate::Velocity;
+using ostk::physics::unit::Time;
+
+using ostk::astrodynamics::dynamics::Thruster;
+using ostk::astrodynamics::trajectory::Segment;
+
+namespace
+{
+
+using AutoDiffScalar5d = Eigen::AutoDiffScalar<Vector5d>;
+
+static constexpr Size HeldDirectionCount = 4;
+static constexpr double DefaultDirectionUpdateThreshold = 1e-3;
+
+Size NextHeldDirectionKey()
+{
+    static std::atomic<Size> nextKey {0};
+
+    return nextKey.fetch_add(1, std::memory_order_relaxed);
+}
+
+double WrapAngleDifference(const double& anAngleDifference)
+{
+    return std::acos(std::cos(anAngleDifference));
+}
+
+AutoDiffScalar5d WrapAngleDifference(const AutoDiffScalar5d& anAngleDifference)
+{
+    // d(acos(cos(x)))/dx = sign(sin(x)), taken as zero where the wrapped difference is 0 or π
+    const double sinAngleDifference = std::sin(anAngleDifference.value());
+    const double slope = (sinAngleDifference > 0.0) - (sinAngleDifference < 0.0);
+
+    return {std::acos(std::cos(anAngleDifference.value())), slope * anAngleDifference.derivatives()};
+}
 
-using ostk::astrodynamics::trajectory::State;
-using ostk::astrodynamics::trajectory::state::CoordinateSubset;
+}  // namespace
 
 QLaw::Parameters::Parameters(
     const Map<COE::Element, Tuple<double, double>>& anElementWeightsMap,
@@ -105,19 +142,35 @@ QLaw::QLaw(
     const COE& aCOE,
     const Derived& aGravitationalParameter,
     const QLaw::Parameters& aParameterSet,
-    const GradientStrategy& aGradientStrategy
+    const GradientStrategy& aGradientStrategy,
+    const Duration& aDirectionUpdateInterval,
+    const Real& aDirectionUpdateThreshold
 )
     : GuidanceLaw("Q-Law"),
       parameters_(aParameterSet),
       mu_(aGravitationalParameter.in(aGravitationalParameter.getUnit())),
       targetCOEVector_(aCOE.getSIVector(COE::AnomalyType::True)),
       gravitationalParameter_(aGravitationalParameter),
+      gravitationalParameter_SI_(
+          aGravitationalParameter.in(Derived::Unit::GravitationalParameter(Length::Unit::Meter, Time::Unit::Second))
+      ),
       gradientStrategy_(aGradientStrategy),
       finiteDifferenceSolver_(
           FiniteDifferenceSolver(FiniteDifferenceSolver::Type::Central, 1e-3, Duration::Seconds(1e-6))
       ),
-      stateBuilder_(Frame::GCRF(), {std::make_shared<CoordinateSubset>("QLaw Element Vector", 5)})
+      directionUpdateInterval_(aDirectionUpdateInterval),
+      directionUpdateThreshold_(aDirectionUpdateThreshold),
+      heldDirectionKey_(NextHeldDirectionKey())
 {
+    if ((!directionUpdateInterval_.isDefined()) || directionUpdateInterval_.isNegative())
+    {
+        throw ostk::core::error::RuntimeError("Direction update interval must be defined and positive.");
+    }
+
+    if (directionUpdateThreshold_.isDefined() && (directionUpdateThreshold_ < 0.0))
+    {
+        throw ostk::core::error::RuntimeError("Direction update threshold must be positive.");
+    }
 }
 
 QLaw::~QLaw() {}
@@ -150,41 +203,125 @@ QLaw::GradientStrategy QLaw::getGradientStrategy() const
     return gradientStrategy_;
 }
 
+Duration QLaw::getDirectionUpdateInterval() const
+{
+    return directionUpdateInterval_;
+}
+
+Real QLaw::getDirectionUpdateThreshold() const
+{
+    return directionUpdateThreshold_;
+}
+
 Vector3d QLaw::calculateThrustAccelerationAt(
     [[maybe_unused]] const Instant& anInstant,
     const Vector3d& aPositionCoordinates,
     const Vector3d& aVelocityCoordinates,
     const Real& aThrustAcceleration,
-    const Shared<const Frame>& outputFrameSPtr
+    [[maybe_unused]] const Shared<const Frame>& outputFrameSPtr
 ) const
 {
-    const COE coe = COE::Cartesian(
-        {Position::Meters(aPositionCoordinates, outputFrameSPtr),
-         Velocity::MetersPerSecond(aVelocityCoordinates, outputFrameSPtr)},
-        gravitationalParameter_
-    );
+    Vector6d cartesianVector;
+    cartesianVector << aPositionCoordinates, aVelocityCoordinates;
 
-    Vector6d coeVector = coe.getSIVector(COE::AnomalyType::True);
+    Vector6d coeVector = COE::CartesianToSIVector(cartesianVector, gravitationalParameter_SI_);
 
     coeVector[1] = std::max(coeVector[1], 1e-4);
     coeVector[2] = std::max(coeVector[2], 1e-4);
 
-    const Vector3d thrustDirection = computeThrustDirection(coeVector, aThrustAcceleration);
+    const Vector5d coeVectorSegment = coeVector.segment(0, 5);
 
     const Matrix3d R_thetaRH_GCRF = QLaw::ThetaRHToGCRF(aPositionCoordinates, aVelocityCoordinates);
 
-    return aThrustAcceleration * R_thetaRH_GCRF * thrustDirection;
+    if (!directionUpdateInterval_.isStrictlyPositive() && !directionUpdateThreshold_.isDefined())
+    {
+        return aThrustAcceleration * R_thetaRH_GCRF * computeThrustDirection(coeVector, aThrustAcceleration);
+    }
+
+    // The thrust direction is held in the theta-R-H frame between updates
+
+    HeldDirection& heldDirection = accessHeldDirection();
+
+    if (!isHeldDirectionValidAt(heldDirection, anInstant, coeVectorSegment))
+    {
+        heldDirection.instant = anInstant;
+        heldDirection.coeVector = coeVectorSegment;
+        heldDirection.direction = computeThrustDirection(coeVector, aThrustAcceleration);
+    }
+
+    return aThrustAcceleration * R_thetaRH_GCRF * heldDirection.direction;
 }
 
-Vector5d QLaw::compute_dQ_dOE(const Vector5d& aCOEVector, const double& aThrustAcceleration) const
+QLaw::HeldDirection& QLaw::accessHeldDirection() const
+{
+    // Each thread holds its own directions, hence no synchronization. Copies of a guidance law share its key, as they
+    // share its parameters.
+
+    thread_local Array<HeldDirection> heldDirections = Array<HeldDirection>::Empty();
+    thread_local Index nextHeldDirectionIndex = 0;
+
+    for (HeldDirection& heldDirection : heldDirections)
+    {
+        if (heldDirection.key == heldDirectionKey_)
+        {
+            return heldDirection;
+        }
+    }
+
+    const HeldDirection heldDirection = {heldDirectionKey_, Instant::Undefined(), Vector5d::Zero(), Vector3d::Zero()};
+
+    if (heldDirections.getSize() < HeldDirectionCount)
+    {
+        heldDirections.add(heldDirection);
+
+        return heldDirections.accessLast();
+    }
+
+    HeldDirection& replacedHeldDirection = heldDirections[nextHeldDirectionIndex];
+    replacedHeldDirection = heldDirection;
+    nextHeldDirectionIndex = (nextHeldDirectionIndex + 1) % HeldDirectionCount;
+
+    return replacedHeldDirection;
+}
+
+bool QLaw::isHeldDirectionValidAt(
+    const HeldDirection& aHeldDirection, const Instant& anInstant, const Vector5d& aCOEVector
+) const
 {
-    if (gradientStrategy_ == GradientStrategy::Analytical)
+    if (!aHeldDirection.instant.isDefined())
     {
-        return computeAnalytical_dQ_dOE(aCOEVector, aThrustAcceleration);
+        return false;
     }
-    else
+
+    if (directionUpdateInterval_.isStrictlyPositive() &&
+        (Duration::Between(aHeldDirection.instant, anInstant).getAbsolute() >= directionUpdateInterval_))
+    {
+        return false;
+    }
+
+    // The elements are always checked, so that a direction held in one propagation is not reused from another state
+
+    const double threshold =
+        directionUpdateThreshold_.isDefined() ? double(directionUpdateThreshold_) : DefaultDirectionUpdateThreshold;
+
+    Vector5d elementsChange = (aCOEVector - aHeldDirection.coeVector).cwiseAbs();
+    elementsChange[0] /= aHeldDirection.coeVector[0];
+
+    return elementsChange.maxCoeff() <= threshold;
+}
+
+Vector5d QLaw::compute_dQ_dOE(const Vector5d& aCOEVector, const double& aThrustAcceleration) const
+{
+    switch (gradientStrategy_)
     {
-        return computeNumerical_dQ_dOE(aCOEVector, aThrustAcceleration);
+        case GradientStrategy::Analytical:
+            return computeAnalytical_dQ_dOE(aCOEVector, aThrustAcceleration);
+
+        case GradientStrategy::AutomaticDifferentiation:
+            return computeAutomaticDifferentiation_dQ_dOE(aCOEVector, aThrustAcceleration);
+
+        default:
+            return computeNumerical_dQ_dOE(aCOEVector, aThrustAcceleration);
     }
 }
 
@@ -237,7 +374,23 @@ Vector3d QLaw::computeThrustDirection(const Vector6d& aCOEVector, const double&
     return -thrustDirection.normalized();
 }
 
-double QLaw::computeQ(const Vector5d& aCOEVector, const double& aThrustAcceleration) const
+template <typename Scalar>
+Eigen::Matrix<Scalar, 5, 1> QLaw::evaluateDeltaCOE(const Eigen::Matrix<Scalar, 5, 1>& aCOEVector) const
+{
+    const Scalar raanDifference = aCOEVector[3] - targetCOEVector_[3];
+    const Scalar aopDifference = aCOEVector[4] - targetCOEVector_[4];
+
+    return Eigen::Matrix<Scalar, 5, 1> {
+        (aCOEVector[0] - targetCOEVector_[0]),
+        (aCOEVector[1] - targetCOEVector_[1]),
+        (aCOEVector[2] - targetCOEVector_[2]),
+        WrapAngleDifference(raanDifference),
+        WrapAngleDifference(aopDifference),
+    };
+}
+
+template <typename Scalar>
+Scalar QLaw::evaluateQ(const Eigen::Matrix<Scalar, 5, 1>& aCOEVector, const double& aThrustAcceleration) const
 {
     //                                                2
     //                                    ⎛  ⎛      T⎞⎞
@@ -248,51 +401,64 @@ double QLaw::computeQ(const Vector5d& aCOEVector, const double& aThrustAccelerat
     //                    ‾‾‾             ⎝     xx    ⎠
     //                    oe
 
+    using std::exp;
+    using std::pow;
+
     // (1 + W_p * P)
-    const double periapsisRadius = aCOEVector[0] * (1.0 - aCOEVector[1]);
-    const double P = std::exp(parameters_.k * (1.0 - (periapsisRadius / parameters_.minimumPeriapsisRadius_)));
+    const Scalar periapsisRadius = aCOEVector[0] * (1.0 - aCOEVector[1]);
+    const Scalar P = exp(parameters_.k * (1.0 - (periapsisRadius / parameters_.minimumPeriapsisRadius_)));
 
-    const double periapsisScaling = (1.0 + (parameters_.periapsisWeight * P));
+    const Scalar periapsisScaling = (1.0 + (parameters_.periapsisWeight * P));
 
     //   ⎛      T⎞
     // d ⎝oe, oe ⎠
-    const Vector5d deltaCOE = computeDeltaCOE(aCOEVector);
+    const Eigen::Matrix<Scalar, 5, 1> deltaCOE = evaluateDeltaCOE<Scalar>(aCOEVector);
 
     // S_oe
-    const Vector5d scalingCOE = {
-        std::pow(
-            (1.0 + std::pow(deltaCOE[0] / (parameters_.m * targetCOEVector_[0]), parameters_.n)), 1.0 / parameters_.r
-        ),
-        1.0,
-        1.0,
-        1.0,
-        1.0,
+    const Eigen::Matrix<Scalar, 5, 1> scalingCOE = {
+        pow((1.0 + pow(deltaCOE[0] / (parameters_.m * targetCOEVector_[0]), parameters_.n)), 1.0 / parameters_.r),
+        Scalar(1.0),
+        Scalar(1.0),
+        Scalar(1.0),
+        Scalar(1.0),
     };
 
     // oedot_xx
-    const Vector5d maximalCOE = computeOrbitalElementsMaximalChange(aCOEVector, aThrustAcceleration);
+    const Eigen::Matrix<Scalar, 5, 1> maximalCOE =
+        evaluateOrbitalElementsMaximalChange<Scalar>(aCOEVector, aThrustAcceleration);
 
-    const Vector5d deltaCOE_divided_maximalCOE = (deltaCOE.cwiseQuotient(maximalCOE));
+    const Eigen::Matrix<Scalar, 5, 1> deltaCOE_divided_maximalCOE = (deltaCOE.cwiseQuotient(maximalCOE));
 
-    return periapsisScaling * (parameters_.controlWeights_.cwiseProduct(scalingCOE)
+    return periapsisScaling * (parameters_.controlWeights_.cast<Scalar>()
+                                   .cwiseProduct(scalingCOE)
                                    .cwiseProduct(deltaCOE_divided_maximalCOE.cwiseProduct(deltaCOE_divided_maximalCOE)))
                                   .sum();
 }
 
-Vector5d QLaw::computeOrbitalElementsMaximalChange(const Vector5d& aCOEVector, const double& aThrustAcceleration) const
+template <typename Scalar>
+Eigen::Matrix<Scalar, 5, 1> QLaw::evaluateOrbitalElementsMaximalChange(
+    const Eigen::Matrix<Scalar, 5, 1>& aCOEVector, const double& aThrustAcceleration
+) const
 {
-    const double& semiMajorAxis = aCOEVector[0];
-    const double& eccentricity = aCOEVector[1];
-    const double& inclination = aCOEVector[2];
-    const double& argumentOfPeriapsis = aCOEVector[4];
+    using std::abs;
+    using std::cos;
+    using std::pow;
+    using std::sin;
+    using std::sqrt;
 
-    const double semiLatusRectum = COE::ComputeSemiLatusRectum(semiMajorAxis, eccentricity);
-    const double angularMomentum = COE::ComputeAngularMomentum(semiLatusRectum, gravitationalParameter_);
+    const Scalar& semiMajorAxis = aCOEVector[0];
+    const Scalar& eccentricity = aCOEVector[1];
+    const Scalar& inclination = aCOEVector[2];
+    const Scalar& argumentOfPeriapsis = aCOEVector[4];
+
+    // Same expressions as COE::ComputeSemiLatusRectum and COE::ComputeAngularMomentum, on the scalar type
+    const Scalar semiLatusRectum = semiMajorAxis * (1.0 - (eccentricity * eccentricity));
+    const Scalar angularMomentum = sqrt(gravitationalParameter_SI_ * semiLatusRectum);
 
     // common grouped terms
-    const double eccentricitySquared = eccentricity * eccentricity;
-    const double aop_sin = std::sin(argumentOfPeriapsis);
-    const double aop_cos = std::cos(argumentOfPeriapsis);
+    const Scalar eccentricitySquared = eccentricity * eccentricity;
+    const Scalar aop_sin = sin(argumentOfPeriapsis);
+    const Scalar aop_cos = cos(argumentOfPeriapsis);
 
     // Semi-Major Axis
     //
@@ -303,9 +469,9 @@ Vector5d QLaw::computeOrbitalElementsMaximalChange(const Vector5d& aCOEVector, c
     //                       ╲╱           μ⋅(1 - eccentricity)
     //
 
-    const double semiMajorAxis_xx =
+    const Scalar semiMajorAxis_xx =
         (2.0 * aThrustAcceleration *
-         std::sqrt(std::pow(semiMajorAxis, 3) * (1.0 + eccentricity) / (mu_ * (1.0 - eccentricity))));
+         sqrt(pow(semiMajorAxis, 3) * (1.0 + eccentricity) / (mu_ * (1.0 - eccentricity))));
 
     // Eccentricity
     //
@@ -313,7 +479,7 @@ Vector5d QLaw::computeOrbitalElementsMaximalChange(const Vector5d& aCOEVector, c
     // ─────────────────────────────────────
     //           angularMomentum
 
-    const double eccentricity_xx = 2.0 * semiLatusRectum * aThrustAcceleration / angularMomentum;
+    const Scalar eccentricity_xx = 2.0 * semiLatusRectum * aThrustAcceleration / angularMomentum;
 
     // Inclination
     //                                         aThrustAcceleration⋅semiLatusRectum
@@ -322,9 +488,9 @@ Vector5d QLaw::computeOrbitalElementsMaximalChange(const Vector5d& aCOEVector, c
     //                 ⎜                                             ╱               2      2                        ⎟
     // angularMomentum⋅⎝-eccentricity⋅│cos(argumentOfPeriapsis)│ + ╲╱ 1 - eccentricity ⋅ sin(argumentOfPeriapsis)    ⎠
 
-    const double inclination_xx = (semiLatusRectum * aThrustAcceleration) /
-                                  (angularMomentum * (std::sqrt(1.0 - (eccentricitySquared * aop_sin * aop_sin)) -
-                                                      eccentricity * std::abs(aop_cos)));
+    const Scalar inclination_xx = (semiLatusRectum * aThrustAcceleration) /
+                                  (angularMomentum * (sqrt(1.0 - (eccentricitySquared * aop_sin * aop_sin)) -
+                                                      eccentricity * abs(aop_cos)));
 
     // Right Ascension of the Ascending Node
     // clang-format off
@@ -335,33 +501,33 @@ Vector5d QLaw::computeOrbitalElementsMaximalChange(const Vector5d& aCOEVector, c
     // angularMomentum⋅⎝-eccentricity⋅│sin(argumentOfPeriapsis)│ + ╲╱1 - eccentricity ⋅ cos(argumentOfPeriapsis)⎠⋅sin(inclination)
     // clang-format on
 
-    const double rightAscensionOfAscendingNode_xx =
+    const Scalar rightAscensionOfAscendingNode_xx =
         (semiLatusRectum * aThrustAcceleration) /
-        (angularMomentum * std::sin(inclination) *
-         (std::sqrt(1.0 - (eccentricitySquared * aop_cos * aop_cos)) - eccentricity * std::abs(aop_sin)));
+        (angularMomentum * sin(inclination) *
+         (sqrt(1.0 - (eccentricitySquared * aop_cos * aop_cos)) - eccentricity * abs(aop_sin)));
 
     // Argument of Periapsis
     // Too complicated to print here. See the paper.
-    const double alpha = (1.0 - eccentricitySquared) / (2.0 * std::pow(eccentricity, 3));
-    const double beta = std::sqrt(alpha * alpha + 1.0 / 27.0);
+    const Scalar alpha = (1.0 - eccentricitySquared) / (2.0 * pow(eccentricity, 3));
+    const Scalar beta = sqrt(alpha * alpha + 1.0 / 27.0);
 
-    const double cosTheta_xx =
-        std::pow((alpha + beta), 1.0 / 3.0) - std::pow((beta - alpha), 1.0 / 3.0) - 1.0 / eccentricity;
-    const double r_xx = semiLatusRectum / (1.0 + (eccentricity * cosTheta_xx));
+    const Scalar cosTheta_xx =
+        pow((alpha + beta), 1.0 / 3.0) - pow((beta - alpha), 1.0 / 3.0) - 1.0 / eccentricity;
+    const Scalar r_xx = semiLatusRectum / (1.0 + (eccentricity * cosTheta_xx));
 
-    const double cosTheta_xxSquared = cosTheta_xx * cosTheta_xx;
+    const Scalar cosTheta_xxSquared = cosTheta_xx * cosTheta_xx;
 
-    const double argumentOfPeriapsisI_xx = (aThrustAcceleration / (eccentricity * angularMomentum)) *
-                                           std::sqrt(
+    const Scalar argumentOfPeriapsisI_xx = (aThrustAcceleration / (eccentricity * angularMomentum)) *
+                                           sqrt(
                                                semiLatusRectum * semiLatusRectum * cosTheta_xxSquared +
-                                               std::pow((semiLatusRectum + r_xx), 2) * (1.0 - cosTheta_xxSquared)
+                                               pow((semiLatusRectum + r_xx), 2) * (1.0 - cosTheta_xxSquared)
                                            );
 
-    const double argumentOfPeriapsisO_xx = rightAscensionOfAscendingNode_xx * std::abs(std::cos(inclination));
-    const double argumentOfPeriapsis_xx =
+    const Scalar argumentOfPeriapsisO_xx = rightAscensionOfAscendingNode_xx * abs(cos(inclination));
+    const Scalar argumentOfPeriapsis_xx =
         (argumentOfPeriapsisI_xx + parameters_.b * argumentOfPeriapsisO_xx) / (1.0 + parameters_.b);
 
-    return {
+    return Eigen::Matrix<Scalar, 5, 1> {
         semiMajorAxis_xx,
         eccentricity_xx,
         inclination_xx,
@@ -370,6 +536,16 @@ Vector5d QLaw::computeOrbitalElementsMaximalChange(const Vector5d& aCOEVector, c
     };
 }
 
+double QLaw::computeQ(const Vector5d& aCOEVector, const double& aThrustAcceleration) const
+{
+    return evaluateQ<double>(aCOEVector, aThrustAcceleration);
+}
+
+Vector5d QLaw::computeOrbitalElementsMaximalChange(const Vector5d& aCOEVector, const double& aThrustAcceleration) const
+{
+    return evaluateOrbitalElementsMaximalChange<double>(aCOEVector, aThrustAcceleration);
+}
+
 Matrix3d QLaw::ThetaRHToGCRF(const Vector3d& aPositionCoordinates, const Vector3d& aVelocityCoordinates)
 {
     const Vector3d R = aPositionCoordinates.normalized();
@@ -646,36 +822,173 @@ Vector5d QLaw::computeAnalytical_dQ_dOE(const Vector5d& aCOEVector, const double
 
 Vector5d QLaw::computeNumerical_dQ_dOE(const Vector5d& aCOEVector, const double& aThrustAcceleration) const
 {
-    const auto getQ = [this,
-                       &aThrustAcceleration](const State& aState, [[maybe_unused]] const Instant& anInstant) -> VectorXd
+    // Same scheme and step sizes as FiniteDifferenceSolver::computeJacobian, on stack-allocated vectors
+
+    const FiniteDifferenceSolver::Type type = finiteDifferenceSolver_.getType();
+    const double stepPercentage = finiteDifferenceSolver_.getStepPercentage();
+
+    const double Q =
+        (type == FiniteDifferenceSolver::Type::Central) ? 0.0 : this->computeQ(aCOEVector, aThrustAcceleration);
+
+    Vector5d dQ_dOE;
+    Vector5d perturbedCOEVector = aCOEVector;
+
+    for (Index i = 0; i < 5; ++i)
     {
-        const Vector5d& coeVector = aState.accessCoordinates();
+        const double relativeStepSize = aCOEVector[i] * stepPercentage;
+        const double stepSize = (relativeStepSize != 0.0) ? relativeStepSize : stepPercentage;
 
-        VectorXd coordinates(1);
-        coordinates << this->computeQ(coeVector, aThrustAcceleration);
+        switch (type)
+        {
+            case FiniteDifferenceSolver::Type::Forward:
+            {
+                perturbedCOEVector[i] = aCOEVector[i] + stepSize;
+                dQ_dOE[i] = (this->computeQ(perturbedCOEVector, aThrustAcceleration) - Q) / stepSize;
+                break;
+            }
+
+            case FiniteDifferenceSolver::Type::Backward:
+            {
+                perturbedCOEVector[i] = aCOEVector[i] - stepSize;
+                dQ_dOE[i] = (Q - this->computeQ(perturbedCOEVector, aThrustAcceleration)) / stepSize;
+                break;
+            }
+
+            case FiniteDifferenceSolver::Type::Central:
+            {
+                perturbedCOEVector[i] = aCOEVector[i] + stepSize;
+                const double forwardQ = this->computeQ(perturbedCOEVector, aThrustAcceleration);
+
+                perturbedCOEVector[i] = aCOEVector[i] - stepSize;
+                const double backwardQ = this->computeQ(perturbedCOEVector, aThrustAcceleration);
+
+                dQ_dOE[i] = (forwardQ - backwardQ) / (2.0 * stepSize);
+                break;
+            }
+
+            default:
+                throw ostk::core::error::runtime::Wrong("Finite Difference Solver Type.");
+        }
 
-        return coordinates;
-    };
+        perturbedCOEVector[i] = aCOEVector[i];
+    }
+
+    return dQ_dOE;
+}
+
+Vector5d QLaw::computeAutomaticDifferentiation_dQ_dOE(
+    const Vector5d& aCOEVector, const double& aThrustAcceleration
+) const
+{
+    // Each element is seeded with a unit derivative along its own direction, so that a single evaluation of Q on dual
+    // numbers carries the full gradient
+
+    Eigen::Matrix<AutoDiffScalar5d, 5, 1> coeVector;
 
-    const Vector5d jacobian = Eigen::Map<Vector5d>(
-        finiteDifferenceSolver_
-            .computeJacobian(stateBuilder_.build(Instant::J2000(), aCOEVector), Instant::J2000(), getQ, 1)
-            .data(),
-        5
+    for (Index i = 0; i < 5; ++i)
+    {
+        coeVector[i] = AutoDiffScalar5d(aCOEVector[i], 5, i);
+    }
+
+    return evaluateQ<AutoDiffScalar5d>(coeVector, aThrustAcceleration).derivatives();
+}
+
+Array<QLaw::SweepResult> QLaw::Sweep(
+    const COE& aCOE,
+    const Derived& aGravitationalParameter,
+    const Array<Parameters>& aParametersArray,
+    const State& aState,
+    const SatelliteSystem& aSatelliteSystem,
+    const Shared<EventCondition>& anEventConditionSPtr,
+    const Array<Shared<Dynamics>>& aDynamicsArray,
+    const NumericalSolver& aNumericalSolver,
+    const Duration& aMaximumPropagationDuration,
+    const GradientStrategy& aGradientStrategy,
+    const Size& aThreadCount
+)
+{
+    return QLaw::Sweep(
+        aCOE,
+        aGravitationalParameter,
+        aParametersArray,
+        aState,
+        aSatelliteSystem,
+        anEventConditionSPtr,
+        aDynamicsArray,
+        aNumericalSolver,
+        aMaximumPropagationDuration,
+        aGradientStrategy,
+        ExecutionContext(aThreadCount)
     );
+}
+
+Array<QLaw::SweepResult> QLaw::Sweep(
+    const COE& aCOE,
+    const Derived& aGravitationalParameter,
+    const Array<Parameters>& aParametersArray,
+    const State& aState,
+    const SatelliteSystem& aSatelliteSystem,
+    const Shared<EventCondition>& anEventConditionSPtr,
+    const Array<Shared<Dynamics>>& aDynamicsArray,
+    const NumericalSolver& aNumericalSolver,
+    const Duration& aMaximumPropagationDuration,
+    const GradientStrategy& aGradientStrategy,
+    const ExecutionContext& anExecutionContext
+)
+{
+    if (!aState.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State");
+    }
+
+    if (anEventConditionSPtr == nullptr)
+    {
+        throw ostk::core::error::runtime::Undefined("Event condition");
+    }
+
+    const Size runCount = aParametersArray.getSize();
+
+    if (runCount == 0)
+    {
+        return Array<SweepResult>::Empty();
+    }
 
-    return jacobian;
+    const Real specificImpulse = aSatelliteSystem.getPropulsionSystem().getSpecificImpulse();
+
+    return anExecutionContext.map<SweepResult>(
+        runCount,
+        [&](const Index& aRunIndex) -> SweepResult
+        {
+            // Each run holds its own guidance law, thruster and event condition, while the dynamics are shared
+
+            const Shared<Thruster> thrusterSPtr = std::make_shared<Thruster>(
+                aSatelliteSystem,
+                std::make_shared<QLaw>(aCOE, aGravitationalParameter, aParametersArray[aRunIndex], aGradientStrategy)
+            );
+
+            const Segment segment = Segment::Maneuver(
+                "QLaw Sweep",
+                anEventConditionSPtr->clone(),
+                thrusterSPtr,
+                aDynamicsArray,
+                aNumericalSolver,
+                Segment::StateRetention::Endpoints()
+            );
+
+            const Segment::Solution solution = segment.solve(aState, aMaximumPropagationDuration);
+
+            return {
+                solution.conditionIsSatisfied,
+                solution.getPropagationDuration(),
+                solution.computeDeltaV(specificImpulse),
+            };
+        }
+    );
 }
 
 Vector5d QLaw::computeDeltaCOE(const Vector5d& aCOEVector) const
 {
-    return {
-        (aCOEVector[0] - targetCOEVector_[0]),
-        (aCOEVector[1] - targetCOEVector_[1]),
-        (aCOEVector[2] - targetCOEVector_[2]),
-        (std::acos(std::cos((aCOEVector[3] - targetCOEVector_[3])))),
-        (std::acos(std::cos((aCOEVector[4] - targetCOEVector_[4])))),
-    };
+    return evaluateDeltaCOE<double>(aCOEVector);
 }
 
 Tuple<double, double> QLaw::computeEffectivity(
@@ -0,0 +1,213 @@
+/// Apache License 2.0
+
+#include <exception>
+#include <future>
+#include <map>
+#include <mutex>
+
+#include <OpenSpaceToolkit/Core/FileSystem/Directory.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Earth.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/ModelCache.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+
+using ostk::core::filesystem::Directory;
+using ostk::core::type::String;
+
+using ostk::physics::environment::object::celestial::Earth;
+
+namespace
+{
+
+// Entries are futures, so that the construction of a model happens outside of the lock, once, while concurrent
+// accesses to the same key wait for it
+
+template <class Type>
+class Entries
+{
+   public:
+    template <class Factory>
+    Shared<Type> access(const String& aKey, const Factory& aFactory)
+    {
+        std::promise<Shared<Type>> promise;
+        std::shared_future<Shared<Type>> future;
+
+        bool isConstructing = false;
+
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+
+            const auto entryIt = entries_.find(aKey);
+
+            if (entryIt != entries_.end())
+            {
+                future = entryIt->second;
+            }
+            else
+            {
+                future = promise.get_future().share();
+                entries_.emplace(aKey, future);
+                isConstructing = true;
+            }
+        }
+
+        if (isConstructing)
+        {
+            try
+            {
+                promise.set_value(aFactory());
+            }
+            catch (...)
+            {
+                promise.set_exception(std::current_exception());
+
+                // Failed constructions are not cached, so that they can be retried
+
+                const std::lock_guard<std::mutex> lock(mutex_);
+
+                entries_.erase(aKey);
+            }
+        }
+
+        return future.get();
+    }
+
+    Size getSize() const
+    {
+        const std::lock_guard<std::mutex> lock(mutex_);
+
+        return entries_.size();
+    }
+
+    void clear()
+    {
+        const std::lock_guard<std::mutex> lock(mutex_);
+
+        entries_.clear();
+    }
+
+   private:
+    mutable std::mutex mutex_;
+    std::map<String, std::shared_future<Shared<Type>>> entries_;
+};
+
+struct ModelCacheState
+{
+    Entries<EarthGravitationalModel> earthGravitationalModels;
+    Entries<EarthMagneticModel> earthMagneticModels;
+    Entries<EarthAtmosphericModel> earthAtmosphericModels;
+    Entries<Celestial> earths;
+};
+
+ModelCacheState& AccessModelCacheState()
+{
+    static ModelCacheState modelCacheState;
+
+    return modelCacheState;
+}
+
+String IntegerKey(const Integer& anInteger)
+{
+    return anInteger.isDefined() ? anInteger.toString() : "Undefined";
+}
+
+String EarthGravitationalModelKey(
+    const EarthGravitationalModel::Type& aType, const Integer& aDegree, const Integer& anOrder
+)
+{
+    return String::Format("{}|{}|{}", static_cast<int>(aType), IntegerKey(aDegree), IntegerKey(anOrder));
+}
+
+}  // namespace
+
+Shared<EarthGravitationalModel> ModelCache::AccessEarthGravitationalModel(
+    const EarthGravitationalModel::Type& aType, const Integer& aDegree, const Integer& anOrder
+)
+{
+    return AccessModelCacheState().earthGravitationalModels.access(
+        EarthGravitationalModelKey(aType, aDegree, anOrder),
+        [&aType, &aDegree, &anOrder]() -> Shared<EarthGravitationalModel>
+        {
+            return std::make_shared<EarthGravitationalModel>(aType, Directory::Undefined(), aDegree, anOrder);
+        }
+    );
+}
+
+Shared<EarthMagneticModel> ModelCache::AccessEarthMagneticModel(const EarthMagneticModel::Type& aType)
+{
+    return AccessModelCacheState().earthMagneticModels.access(
+        String::Format("{}", static_cast<int>(aType)),
+        [&aType]() -> Shared<EarthMagneticModel>
+        {
+            return std::make_shared<EarthMagneticModel>(aType);
+        }
+    );
+}
+
+Shared<EarthAtmosphericModel> ModelCache::AccessEarthAtmosphericModel(const EarthAtmosphericModel::Type& aType)
+{
+    return AccessModelCacheState().earthAtmosphericModels.access(
+        String::Format("{}", static_cast<int>(aType)),
+        [&aType]() -> Shared<EarthAtmosphericModel>
+        {
+            return std::make_shared<EarthAtmosphericModel>(aType);
+        }
+    );
+}
+
+Shared<Celestial> ModelCache::AccessEarth(
+    const EarthGravitationalModel::Type& aGravitationalModelType,
+    const Integer& aGravitationalModelDegree,
+    const Integer& aGravitationalModelOrder,
+    const EarthMagneticModel::Type& aMagneticModelType,
+    const EarthAtmosphericModel::Type& anAtmosphericModelType
+)
+{
+    const String key = String::Format(
+        "{}|{}|{}",
+        EarthGravitationalModelKey(aGravitationalModelType, aGravitationalModelDegree, aGravitationalModelOrder),
+        static_cast<int>(aMagneticModelType),
+        static_cast<int>(anAtmosphericModelType)
+    );
+
+    return AccessModelCacheState().earths.access(
+        key,
+        [&]() -> Shared<Celestial>
+        {
+            return std::make_shared<Earth>(Earth::FromModels(
+                ModelCache::AccessEarthGravitationalModel(
+                    aGravitationalModelType, aGravitationalModelDegree, aGravitationalModelOrder
+                ),
+                ModelCache::AccessEarthMagneticModel(aMagneticModelType),
+                ModelCache::AccessEarthAtmosphericModel(anAtmosphericModelType)
+            ));
+        }
+    );
+}
+
+Size ModelCache::GetSize()
+{
+    ModelCacheState& modelCacheState = AccessModelCacheState();
+
+    return modelCacheState.earthGravitationalModels.getSize() + modelCacheState.earthMagneticModels.getSize() +
+           modelCacheState.earthAtmosphericModels.getSize() + modelCacheState.earths.getSize();
+}
+
+void ModelCache::Clear()
+{
+    ModelCacheState& modelCacheState = AccessModelCacheState();
+
+    modelCacheState.earthGravitationalModels.clear();
+    modelCacheState.earthMagneticModels.clear();
+    modelCacheState.earthAtmosphericModels.clear();
+    modelCacheState.earths.clear();
+}
+
+}  // namespace astrodynamics
+}  // namespace ostk
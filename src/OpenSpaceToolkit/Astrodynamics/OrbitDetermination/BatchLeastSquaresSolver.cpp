@@ -0,0 +1,322 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <OpenSpaceToolkit/Core/Container/Pair.hpp>
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/OrbitDetermination/BatchLeastSquaresSolver.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateBroker.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianPosition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianVelocity.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace orbitdetermination
+{
+
+using ostk::core::container::Pair;
+using ostk::core::type::Index;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::time::Instant;
+
+using ostk::astrodynamics::trajectory::state::CoordinateBroker;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianPosition;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianVelocity;
+
+namespace
+{
+
+// Indices of the position and velocity coordinates (in this order) within the coordinates of a broker
+
+Array<Index> GetPositionVelocityIndices(const Shared<const CoordinateBroker>& aCoordinateBrokerSPtr)
+{
+    if ((!aCoordinateBrokerSPtr->hasSubset(CartesianPosition::Default())) ||
+        (!aCoordinateBrokerSPtr->hasSubset(CartesianVelocity::Default())))
+    {
+        throw ostk::core::error::RuntimeError("Cartesian position and velocity are required for orbit determination.");
+    }
+
+    const Index positionIndex = aCoordinateBrokerSPtr->getSubsetIndex(CartesianPosition::Default());
+    const Index velocityIndex = aCoordinateBrokerSPtr->getSubsetIndex(CartesianVelocity::Default());
+
+    return {
+        positionIndex,
+        positionIndex + 1,
+        positionIndex + 2,
+        velocityIndex,
+        velocityIndex + 1,
+        velocityIndex + 2,
+    };
+}
+
+}  // namespace
+
+BatchLeastSquaresSolver::BatchLeastSquaresSolver(
+    const Propagator& aPropagator, const Size& aMaximumIterationCount, const Real& aRelativeTolerance
+)
+    : propagator_(aPropagator),
+      maximumIterationCount_(aMaximumIterationCount),
+      relativeTolerance_(aRelativeTolerance)
+{
+    if (!propagator_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagator");
+    }
+
+    if (maximumIterationCount_ == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Maximum iteration count");
+    }
+
+    if ((!relativeTolerance_.isDefined()) || (relativeTolerance_ <= 0.0))
+    {
+        throw ostk::core::error::runtime::Wrong("Relative tolerance");
+    }
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const BatchLeastSquaresSolver& aSolver)
+{
+    aSolver.print(anOutputStream, true);
+
+    return anOutputStream;
+}
+
+const Propagator& BatchLeastSquaresSolver::accessPropagator() const
+{
+    return propagator_;
+}
+
+Size BatchLeastSquaresSolver::getMaximumIterationCount() const
+{
+    return maximumIterationCount_;
+}
+
+Real BatchLeastSquaresSolver::getRelativeTolerance() const
+{
+    return relativeTolerance_;
+}
+
+BatchLeastSquaresSolver::Analysis BatchLeastSquaresSolver::solve(
+    const State& anInitialGuessState,
+    const Array<Measurement>& aMeasurementArray,
+    const ExecutionContext& anExecutionContext
+) const
+{
+    if (!anInitialGuessState.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Initial guess state");
+    }
+
+    Size measurementSize = 0;
+
+    for (const Measurement& measurement : aMeasurementArray)
+    {
+        if (!measurement.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Measurement");
+        }
+
+        measurementSize += measurement.getSize();
+    }
+
+    if (measurementSize < 6)
+    {
+        throw ostk::core::error::RuntimeError(
+            "At least 6 measurement components are required to estimate a state, got [{}].", measurementSize
+        );
+    }
+
+    const Array<Index> stateIndices = GetPositionVelocityIndices(anInitialGuessState.accessCoordinateBroker());
+    const Array<Index> propagatorIndices = GetPositionVelocityIndices(propagator_.accessCoordinateBroker());
+
+    // Each measurement refers to one of the sorted, unique measurement instants, all propagated in a single pass
+
+    Array<Instant> instants = Array<Instant>::Empty();
+    instants.reserve(aMeasurementArray.getSize());
+
+    for (const Measurement& measurement : aMeasurementArray)
+    {
+        instants.add(measurement.accessInstant());
+    }
+
+    std::sort(instants.begin(), instants.end());
+    instants.erase(std::unique(instants.begin(), instants.end()), instants.end());
+
+    Array<Index> instantIndices = Array<Index>::Empty();
+    instantIndices.reserve(aMeasurementArray.getSize());
+
+    for (const Measurement& measurement : aMeasurementArray)
+    {
+        instantIndices.add(
+            std::lower_bound(instants.begin(), instants.end(), measurement.accessInstant()) - instants.begin()
+        );
+    }
+
+    State estimatedState = anInitialGuessState.inFrame(Frame::GCRF());
+
+    MatrixXd covariance;
+    Array<VectorXd> residuals = Array<VectorXd>::Empty();
+    Real rmsWeightedResidual = Real::Undefined();
+    bool hasConverged = false;
+    Size iterationCount = 0;
+
+    while (iterationCount < maximumIterationCount_)
+    {
+        ++iterationCount;
+
+        const Array<Pair<State, MatrixXd>> statesAndStateTransitionMatrices =
+            propagator_.calculateStatesAndStateTransitionMatricesAt(estimatedState, instants);
+
+        // State transition matrices restricted to the position and velocity, from the estimation epoch
+
+        Array<MatrixXd> stateTransitionMatrices = Array<MatrixXd>::Empty();
+        stateTransitionMatrices.reserve(instants.getSize());
+
+        for (const Pair<State, MatrixXd>& stateAndStateTransitionMatrix : statesAndStateTransitionMatrices)
+        {
+            MatrixXd stateTransitionMatrix(6, 6);
+
+            for (Index i = 0; i < 6; ++i)
+            {
+                for (Index j = 0; j < 6; ++j)
+                {
+                    stateTransitionMatrix(i, j) =
+                        stateAndStateTransitionMatrix.second(propagatorIndices[i], propagatorIndices[j]);
+                }
+            }
+
+            stateTransitionMatrices.add(stateTransitionMatrix);
+        }
+
+        const Array<Pair<VectorXd, MatrixXd>> residualsAndDesignMatrices =
+            anExecutionContext.map<Pair<VectorXd, MatrixXd>>(
+                aMeasurementArray.getSize(),
+                [&](const Index& anIndex) -> Pair<VectorXd, MatrixXd>
+                {
+                    const Measurement& measurement = aMeasurementArray[anIndex];
+                    const Index& instantIndex = instantIndices[anIndex];
+                    const State& state = statesAndStateTransitionMatrices[instantIndex].first;
+
+                    return {
+                        measurement.calculateResidual(state),
+                        measurement.calculatePartials(state) * stateTransitionMatrices[instantIndex],
+                    };
+                }
+            );
+
+        // Normal equations, accumulated in measurement order so that the solution does not depend on the scheduling
+
+        MatrixXd normalMatrix = MatrixXd::Zero(6, 6);
+        VectorXd normalVector = VectorXd::Zero(6);
+        double weightedSquaredResidualSum = 0.0;
+
+        residuals.clear();
+
+        for (Index k = 0; k < aMeasurementArray.getSize(); ++k)
+        {
+            const VectorXd& residual = residualsAndDesignMatrices[k].first;
+            const MatrixXd& designMatrix = residualsAndDesignMatrices[k].second;
+
+            const VectorXd weights = aMeasurementArray[k].getStandardDeviation().array().square().inverse();
+
+            normalMatrix += designMatrix.transpose() * weights.asDiagonal() * designMatrix;
+            normalVector += designMatrix.transpose() * weights.asDiagonal() * residual;
+            weightedSquaredResidualSum += residual.dot(weights.asDiagonal() * residual);
+
+            residuals.add(residual);
+        }
+
+        const Eigen::LDLT<MatrixXd> normalMatrixDecomposition = normalMatrix.ldlt();
+
+        if ((normalMatrixDecomposition.info() != Eigen::Success) ||
+            (normalMatrixDecomposition.rcond() < std::numeric_limits<double>::epsilon()))
+        {
+            throw ostk::core::error::RuntimeError(
+                "Normal matrix is singular: the measurements do not observe the state at iteration [{}].",
+                iterationCount
+            );
+        }
+
+        const MatrixXd inverseNormalMatrix = normalMatrixDecomposition.solve(MatrixXd::Identity(6, 6));
+        covariance = 0.5 * (inverseNormalMatrix + inverseNormalMatrix.transpose());
+
+        const Real previousRmsWeightedResidual = rmsWeightedResidual;
+        rmsWeightedResidual = std::sqrt(weightedSquaredResidualSum / measurementSize);
+
+        if ((rmsWeightedResidual == 0.0) ||
+            (previousRmsWeightedResidual.isDefined() &&
+             ((rmsWeightedResidual - previousRmsWeightedResidual).abs() <=
+              relativeTolerance_ * previousRmsWeightedResidual)))
+        {
+            hasConverged = true;
+            break;
+        }
+
+        // The last correction is not applied, so that the analysis is consistent with the returned estimate
+
+        if (iterationCount == maximumIterationCount_)
+        {
+            break;
+        }
+
+        const VectorXd correction = normalMatrixDecomposition.solve(normalVector);
+
+        VectorXd coordinates = estimatedState.getCoordinates();
+
+        for (Index i = 0; i < 6; ++i)
+        {
+            coordinates(stateIndices[i]) += correction(i);
+        }
+
+        estimatedState = {
+            estimatedState.accessInstant(),
+            coordinates,
+            estimatedState.accessFrame(),
+            estimatedState.accessCoordinateBroker(),
+        };
+    }
+
+    return {
+        estimatedState,
+        covariance,
+        iterationCount,
+        hasConverged,
+        rmsWeightedResidual,
+        residuals,
+    };
+}
+
+void BatchLeastSquaresSolver::print(std::ostream& anOutputStream, bool displayDecorator) const
+{
+    if (displayDecorator)
+    {
+        ostk::core::utils::Print::Header(anOutputStream, "Batch Least Squares Solver");
+    }
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Maximum iteration count:" << maximumIterationCount_;
+    ostk::core::utils::Print::Line(anOutputStream) << "Relative tolerance:" << relativeTolerance_.toString();
+
+    ostk::core::utils::Print::Separator(anOutputStream, "Propagator");
+
+    propagator_.print(anOutputStream, false);
+
+    if (displayDecorator)
+    {
+        ostk::core::utils::Print::Footer(anOutputStream);
+    }
+}
+
+}  // namespace orbitdetermination
+}  // namespace astrodynamics
+}  // namespace ostk
@@ -0,0 +1,404 @@
+/// Apache License 2.0
+
+#include <cmath>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/OrbitDetermination/Measurement.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace orbitdetermination
+{
+
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+
+Measurement::Measurement(
+    const Instant& anInstant,
+    const Measurement::Type& aType,
+    const VectorXd& aValue,
+    const VectorXd& aStandardDeviation,
+    const Shared<const Trajectory>& aStationTrajectorySPtr
+)
+    : instant_(anInstant),
+      type_(aType),
+      value_(aValue),
+      standardDeviation_(aStandardDeviation),
+      stationTrajectorySPtr_(aStationTrajectorySPtr)
+{
+    if (type_ == Measurement::Type::Undefined)
+    {
+        return;
+    }
+
+    const Size size = Measurement::SizeFromType(type_);
+
+    if (value_.size() != Eigen::Index(size))
+    {
+        throw ostk::core::error::runtime::Wrong("Value");
+    }
+
+    if ((standardDeviation_.size() != Eigen::Index(size)) || (!(standardDeviation_.array() > 0.0).all()))
+    {
+        throw ostk::core::error::runtime::Wrong("Standard deviation");
+    }
+}
+
+bool Measurement::operator==(const Measurement& aMeasurement) const
+{
+    if ((!this->isDefined()) || (!aMeasurement.isDefined()))
+    {
+        return false;
+    }
+
+    return (instant_ == aMeasurement.instant_) && (type_ == aMeasurement.type_) && (value_ == aMeasurement.value_) &&
+           (standardDeviation_ == aMeasurement.standardDeviation_) &&
+           (stationTrajectorySPtr_ == aMeasurement.stationTrajectorySPtr_);
+}
+
+bool Measurement::operator!=(const Measurement& aMeasurement) const
+{
+    return !((*this) == aMeasurement);
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const Measurement& aMeasurement)
+{
+    aMeasurement.print(anOutputStream, true);
+
+    return anOutputStream;
+}
+
+bool Measurement::isDefined() const
+{
+    return instant_.isDefined() && (type_ != Measurement::Type::Undefined) && (stationTrajectorySPtr_ != nullptr) &&
+           stationTrajectorySPtr_->isDefined();
+}
+
+const Instant& Measurement::accessInstant() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Measurement");
+    }
+
+    return instant_;
+}
+
+Measurement::Type Measurement::getType() const
+{
+    return type_;
+}
+
+VectorXd Measurement::getValue() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Measurement");
+    }
+
+    return value_;
+}
+
+VectorXd Measurement::getStandardDeviation() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Measurement");
+    }
+
+    return standardDeviation_;
+}
+
+Shared<const Trajectory> Measurement::getStationTrajectory() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Measurement");
+    }
+
+    return stationTrajectorySPtr_;
+}
+
+Size Measurement::getSize() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Measurement");
+    }
+
+    return Measurement::SizeFromType(type_);
+}
+
+VectorXd Measurement::calculateValue(const State& aState) const
+{
+    const VectorXd relativeState = this->calculateRelativeState(aState);
+
+    const Vector3d relativePosition = relativeState.head<3>();
+    const Vector3d relativeVelocity = relativeState.tail<3>();
+
+    const double range = relativePosition.norm();
+
+    VectorXd value(Measurement::SizeFromType(type_));
+
+    switch (type_)
+    {
+        case Measurement::Type::Range:
+            value(0) = range;
+            break;
+
+        case Measurement::Type::RangeRate:
+            value(0) = relativePosition.dot(relativeVelocity) / range;
+            break;
+
+        case Measurement::Type::Angles:
+            value(0) = std::atan2(relativePosition.y(), relativePosition.x());
+            value(1) = std::asin(relativePosition.z() / range);
+            break;
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Type");
+    }
+
+    return value;
+}
+
+VectorXd Measurement::calculateResidual(const State& aState) const
+{
+    VectorXd residual = value_ - this->calculateValue(aState);
+
+    if (type_ == Measurement::Type::Angles)
+    {
+        residual(0) = std::remainder(residual(0), 2.0 * M_PI);
+    }
+
+    return residual;
+}
+
+MatrixXd Measurement::calculatePartials(const State& aState) const
+{
+    const VectorXd relativeState = this->calculateRelativeState(aState);
+
+    const Vector3d relativePosition = relativeState.head<3>();
+    const Vector3d relativeVelocity = relativeState.tail<3>();
+
+    const double range = relativePosition.norm();
+    const Vector3d lineOfSight = relativePosition / range;
+
+    MatrixXd partials = MatrixXd::Zero(Measurement::SizeFromType(type_), 6);
+
+    switch (type_)
+    {
+        case Measurement::Type::Range:
+        {
+            partials.block<1, 3>(0, 0) = lineOfSight.transpose();
+            break;
+        }
+
+        case Measurement::Type::RangeRate:
+        {
+            const double rangeRate = lineOfSight.dot(relativeVelocity);
+
+            partials.block<1, 3>(0, 0) = ((relativeVelocity - rangeRate * lineOfSight) / range).transpose();
+            partials.block<1, 3>(0, 3) = lineOfSight.transpose();
+            break;
+        }
+
+        case Measurement::Type::Angles:
+        {
+            const double x = relativePosition.x();
+            const double y = relativePosition.y();
+            const double z = relativePosition.z();
+
+            const double projectedSquaredRange = x * x + y * y;
+            const double projectedRange = std::sqrt(projectedSquaredRange);
+
+            partials.block<1, 3>(0, 0) = Vector3d(-y, x, 0.0).transpose() / projectedSquaredRange;
+            partials.block<1, 3>(1, 0) =
+                Vector3d(-x * z, -y * z, projectedSquaredRange).transpose() / (range * range * projectedRange);
+            break;
+        }
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Type");
+    }
+
+    return partials;
+}
+
+void Measurement::print(std::ostream& anOutputStream, bool displayDecorator) const
+{
+    if (displayDecorator)
+    {
+        ostk::core::utils::Print::Header(anOutputStream, "Measurement");
+    }
+
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Instant:" << (instant_.isDefined() ? instant_.toString() : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream) << "Type:" << Measurement::StringFromType(type_);
+
+    if (type_ != Measurement::Type::Undefined)
+    {
+        for (Eigen::Index i = 0; i < value_.size(); ++i)
+        {
+            ostk::core::utils::Print::Line(anOutputStream)
+                << "Value:" << Real(value_(i)).toString() << "+/-" << Real(standardDeviation_(i)).toString();
+        }
+    }
+
+    if (displayDecorator)
+    {
+        ostk::core::utils::Print::Footer(anOutputStream);
+    }
+}
+
+Measurement Measurement::Undefined()
+{
+    return {
+        Instant::Undefined(),
+        Measurement::Type::Undefined,
+        VectorXd(),
+        VectorXd(),
+        nullptr,
+    };
+}
+
+Measurement Measurement::Range(
+    const Instant& anInstant,
+    const Length& aRange,
+    const Length& aStandardDeviation,
+    const Shared<const Trajectory>& aStationTrajectorySPtr
+)
+{
+    if ((!aRange.isDefined()) || (!aStandardDeviation.isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Range");
+    }
+
+    return {
+        anInstant,
+        Measurement::Type::Range,
+        VectorXd::Constant(1, aRange.inMeters()),
+        VectorXd::Constant(1, aStandardDeviation.inMeters()),
+        aStationTrajectorySPtr,
+    };
+}
+
+Measurement Measurement::RangeRate(
+    const Instant& anInstant,
+    const Real& aRangeRate,
+    const Real& aStandardDeviation,
+    const Shared<const Trajectory>& aStationTrajectorySPtr
+)
+{
+    if ((!aRangeRate.isDefined()) || (!aStandardDeviation.isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Range rate");
+    }
+
+    return {
+        anInstant,
+        Measurement::Type::RangeRate,
+        VectorXd::Constant(1, aRangeRate),
+        VectorXd::Constant(1, aStandardDeviation),
+        aStationTrajectorySPtr,
+    };
+}
+
+Measurement Measurement::Angles(
+    const Instant& anInstant,
+    const Angle& aRightAscension,
+    const Angle& aDeclination,
+    const Angle& aStandardDeviation,
+    const Shared<const Trajectory>& aStationTrajectorySPtr
+)
+{
+    if ((!aRightAscension.isDefined()) || (!aDeclination.isDefined()) || (!aStandardDeviation.isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Angles");
+    }
+
+    return {
+        anInstant,
+        Measurement::Type::Angles,
+        (VectorXd(2) << aRightAscension.inRadians(), aDeclination.inRadians()).finished(),
+        VectorXd::Constant(2, aStandardDeviation.inRadians()),
+        aStationTrajectorySPtr,
+    };
+}
+
+String Measurement::StringFromType(const Measurement::Type& aType)
+{
+    switch (aType)
+    {
+        case Measurement::Type::Undefined:
+            return "Undefined";
+
+        case Measurement::Type::Range:
+            return "Range";
+
+        case Measurement::Type::RangeRate:
+            return "RangeRate";
+
+        case Measurement::Type::Angles:
+            return "Angles";
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Type");
+    }
+}
+
+Size Measurement::SizeFromType(const Measurement::Type& aType)
+{
+    switch (aType)
+    {
+        case Measurement::Type::Range:
+        case Measurement::Type::RangeRate:
+            return 1;
+
+        case Measurement::Type::Angles:
+            return 2;
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Type");
+    }
+}
+
+VectorXd Measurement::calculateRelativeState(const State& aState) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Measurement");
+    }
+
+    if (!aState.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State");
+    }
+
+    if (aState.accessInstant() != instant_)
+    {
+        throw ostk::core::error::runtime::Wrong("State instant");
+    }
+
+    const State objectState = aState.inFrame(Frame::GCRF());
+    const State stationState = stationTrajectorySPtr_->getStateAt(instant_).inFrame(Frame::GCRF());
+
+    VectorXd relativeState(6);
+    relativeState.head<3>() = objectState.getPosition().getCoordinates() - stationState.getPosition().getCoordinates();
+    relativeState.tail<3>() = objectState.getVelocity().getCoordinates() - stationState.getVelocity().getCoordinates();
+
+    return relativeState;
+}
+
+}  // namespace orbitdetermination
+}  // namespace astrodynamics
+}  // namespace ostk
@@ -1,11 +1,15 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <cmath>
+
 #include <boost/math/tools/roots.hpp>
 
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/RootSolver.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Tracer.hpp>
 
 namespace ostk
 {
@@ -44,6 +48,8 @@ RootSolver::Solution RootSolver::bracketAndSolve(
     const double& aFactor
 ) const
 {
+    const Tracer::Span span("RootSolver::bracketAndSolve", "root solving");
+
     std::uintmax_t iteratorCount = maximumIterationCount_;
 
     std::pair<Real, Real> r = boost::math::tools::bracket_and_solve_root(
@@ -61,6 +67,8 @@ RootSolver::Solution RootSolver::solve(
     const std::function<double(const double&)>& aFunction, const double& aLowerBound, const double& anUpperBound
 ) const
 {
+    const Tracer::Span span("RootSolver::solve", "root solving");
+
     // account for the fact that the function may be decreasing
     const double lowerBound = std::min(aLowerBound, anUpperBound);
     const double upperBound = std::max(aLowerBound, anUpperBound);
@@ -81,6 +89,8 @@ RootSolver::Solution RootSolver::bisection(
     const std::function<double(const double&)>& aFunction, const double& aLowerBound, const double& anUpperBound
 ) const
 {
+    const Tracer::Span span("RootSolver::bisection", "root solving");
+
     // account for the fact that the function may be decreasing
     const double lowerBound = std::min(aLowerBound, anUpperBound);
     const double upperBound = std::max(aLowerBound, anUpperBound);
@@ -97,6 +107,199 @@ RootSolver::Solution RootSolver::bisection(
     };
 }
 
+RootSolver::Solution RootSolver::itp(
+    const std::function<double(const double&)>& aFunction, const double& aLowerBound, const double& anUpperBound
+) const
+{
+    const Tracer::Span span("RootSolver::itp", "root solving");
+
+    double lowerBound = std::min(aLowerBound, anUpperBound);
+    double upperBound = std::max(aLowerBound, anUpperBound);
+
+    double lowerValue = aFunction(lowerBound);
+    double upperValue = aFunction(upperBound);
+
+    if (lowerValue == 0.0)
+    {
+        return {lowerBound, 0, true};
+    }
+
+    if (upperValue == 0.0)
+    {
+        return {upperBound, 0, true};
+    }
+
+    if ((lowerValue * upperValue) > 0.0)
+    {
+        throw ostk::core::error::RuntimeError("Root is not bracketed in [{}, {}].", lowerBound, upperBound);
+    }
+
+    // Work on an increasing function
+
+    const double sign = (lowerValue < 0.0) ? 1.0 : -1.0;
+
+    lowerValue *= sign;
+    upperValue *= sign;
+
+    // Hyper-parameters recommended by the authors (kappa_2 = 2, n_0 = 1)
+
+    const double halfTolerance = 0.5 * double(tolerance_);
+    const double kappa1 = 0.2 / (upperBound - lowerBound);
+
+    // Iteration count of bisection to reach the tolerance, plus n_0
+
+    int maximumBisectionCount = static_cast<int>(maximumIterationCount_);
+
+    if (halfTolerance > 0.0)
+    {
+        const double bisectionCount = std::ceil(std::log2((upperBound - lowerBound) / (2.0 * halfTolerance)));
+
+        maximumBisectionCount = std::max(0, static_cast<int>(bisectionCount)) + 1;
+    }
+
+    Size iterationCount = 0;
+
+    while (((upperBound - lowerBound) > (2.0 * halfTolerance)) && (iterationCount < maximumIterationCount_))
+    {
+        const double width = upperBound - lowerBound;
+        const double midpoint = lowerBound + 0.5 * width;
+
+        const double projectionRadius =
+            halfTolerance * std::pow(2.0, maximumBisectionCount - static_cast<int>(iterationCount)) - 0.5 * width;
+        const double truncation = kappa1 * width * width;
+
+        // Interpolate
+
+        const double regulaFalsi = (upperValue * lowerBound - lowerValue * upperBound) / (upperValue - lowerValue);
+
+        // Truncate
+
+        const double direction = (midpoint >= regulaFalsi) ? 1.0 : -1.0;
+
+        const double truncated =
+            (truncation <= std::fabs(midpoint - regulaFalsi)) ? (regulaFalsi + direction * truncation) : midpoint;
+
+        // Project
+
+        const double x = (std::fabs(truncated - midpoint) <= projectionRadius)
+                           ? truncated
+                           : (midpoint - direction * projectionRadius);
+
+        const double value = sign * aFunction(x);
+
+        ++iterationCount;
+
+        if (value > 0.0)
+        {
+            upperBound = x;
+            upperValue = value;
+        }
+        else if (value < 0.0)
+        {
+            lowerBound = x;
+            lowerValue = value;
+        }
+        else
+        {
+            return {x, iterationCount, true};
+        }
+    }
+
+    return {
+        lowerBound + (upperBound - lowerBound) / 2.0,
+        iterationCount,
+        (upperBound - lowerBound) <= (2.0 * halfTolerance),
+    };
+}
+
+RootSolver::Solution RootSolver::newton(
+    const std::function<double(const double&)>& aFunction,
+    const std::function<double(const double&)>& aDerivative,
+    const double& aLowerBound,
+    const double& anUpperBound
+) const
+{
+    const Tracer::Span span("RootSolver::newton", "root solving");
+
+    const double lowerValue = aFunction(aLowerBound);
+    const double upperValue = aFunction(anUpperBound);
+
+    if (lowerValue == 0.0)
+    {
+        return {aLowerBound, 0, true};
+    }
+
+    if (upperValue == 0.0)
+    {
+        return {anUpperBound, 0, true};
+    }
+
+    if ((lowerValue * upperValue) > 0.0)
+    {
+        throw ostk::core::error::RuntimeError("Root is not bracketed in [{}, {}].", aLowerBound, anUpperBound);
+    }
+
+    // Orient the bracket so that the function is negative at its first end
+
+    double negativeBound = (lowerValue < 0.0) ? aLowerBound : anUpperBound;
+    double positiveBound = (lowerValue < 0.0) ? anUpperBound : aLowerBound;
+
+    double x = 0.5 * (aLowerBound + anUpperBound);
+    double previousStep = std::fabs(anUpperBound - aLowerBound);
+    double step = previousStep;
+
+    double value = aFunction(x);
+    double derivative = aDerivative(x);
+
+    Size iterationCount = 0;
+
+    while (iterationCount < maximumIterationCount_)
+    {
+        ++iterationCount;
+
+        const bool newtonStepLeavesBracket =
+            (((x - positiveBound) * derivative - value) * ((x - negativeBound) * derivative - value)) > 0.0;
+        const bool newtonStepIsSlow = std::fabs(2.0 * value) > std::fabs(previousStep * derivative);
+
+        previousStep = step;
+
+        if (newtonStepLeavesBracket || newtonStepIsSlow)
+        {
+            step = 0.5 * (positiveBound - negativeBound);
+            x = negativeBound + step;
+        }
+        else
+        {
+            step = value / derivative;
+            x -= step;
+        }
+
+        if (std::fabs(step) <= tolerance_)
+        {
+            return {x, iterationCount, true};
+        }
+
+        value = aFunction(x);
+        derivative = aDerivative(x);
+
+        if (value == 0.0)
+        {
+            return {x, iterationCount, true};
+        }
+
+        if (value < 0.0)
+        {
+            negativeBound = x;
+        }
+        else
+        {
+            positiveBound = x;
+        }
+    }
+
+    return {x, iterationCount, false};
+}
+
 void RootSolver::print(std::ostream& anOutputStream, bool displayDecorator) const
 {
     displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Root Solver") : void();
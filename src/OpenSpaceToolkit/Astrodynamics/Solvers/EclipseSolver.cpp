@@ -0,0 +1,392 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <cmath>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Solver/EclipseSolver.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Solver/TemporalConditionSolver.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/LazyState.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace solver
+{
+
+using ostk::core::type::Size;
+
+using ostk::physics::coordinate::Frame;
+
+using ostk::astrodynamics::trajectory::state::LazyState;
+
+namespace
+{
+
+// Celestial positions tabulated on a uniform grid, linearly interpolated in between
+
+class TabulatedPositions
+{
+   public:
+    TabulatedPositions(const Shared<const Celestial>& aCelestialSPtr, const Interval& anInterval, const Duration& aStep)
+        : startInstant_(anInterval.getStart()),
+          step_s_(aStep.inSeconds())
+    {
+        static const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+
+        const double duration_s = Duration::Between(anInterval.getStart(), anInterval.getEnd()).inSeconds();
+        const Size nodeCount = static_cast<Size>(std::ceil(duration_s / step_s_)) + 1;
+
+        positions_.reserve(nodeCount);
+
+        for (Size nodeIndex = 0; nodeIndex < nodeCount; ++nodeIndex)
+        {
+            const Instant instant = startInstant_ + Duration::Seconds(nodeIndex * step_s_);
+
+            positions_.add(aCelestialSPtr->getPositionIn(gcrfSPtr, instant).inMeters().getCoordinates());
+        }
+    }
+
+    Vector3d at(const Instant& anInstant) const
+    {
+        if (positions_.getSize() == 1)
+        {
+            return positions_.accessFirst();
+        }
+
+        const double elapsed_s = Duration::Between(startInstant_, anInstant).inSeconds();
+        const double nodePosition = std::clamp(elapsed_s / step_s_, 0.0, static_cast<double>(positions_.getSize() - 1));
+        const Size nodeIndex = std::min(static_cast<Size>(nodePosition), positions_.getSize() - 2);
+        const double ratio = nodePosition - static_cast<double>(nodeIndex);
+
+        return positions_[nodeIndex] + ratio * (positions_[nodeIndex + 1] - positions_[nodeIndex]);
+    }
+
+   private:
+    Instant startInstant_;
+    double step_s_;
+    Array<Vector3d> positions_;
+};
+
+// Apparent radii of the Sun and of the occulting body, and apparent separation of their centers [rad]
+
+struct ShadowGeometry
+{
+    double sunApparentRadius;
+    double occultingApparentRadius;
+    double separation;
+};
+
+ShadowGeometry ComputeShadowGeometry(
+    const Vector3d& aPositionCoordinates,
+    const Vector3d& aSunPositionCoordinates,
+    const Vector3d& anOccultingPositionCoordinates,
+    const double& aSunRadius,
+    const double& anOccultingRadius
+)
+{
+    const Vector3d toSun = aSunPositionCoordinates - aPositionCoordinates;
+    const Vector3d toOcculting = anOccultingPositionCoordinates - aPositionCoordinates;
+
+    const double sunDistance = toSun.norm();
+    const double occultingDistance = toOcculting.norm();
+
+    // Inside the occulting body: the apparent radius saturates at pi / 2
+
+    const double sunApparentRadius = std::asin(std::min(aSunRadius / sunDistance, 1.0));
+    const double occultingApparentRadius = std::asin(std::min(anOccultingRadius / occultingDistance, 1.0));
+
+    const double separation =
+        std::acos(std::clamp(toSun.dot(toOcculting) / (sunDistance * occultingDistance), -1.0, +1.0));
+
+    return {sunApparentRadius, occultingApparentRadius, separation};
+}
+
+}  // namespace
+
+EclipseSolver::EclipseSolver(
+    const Shared<const Celestial>& aSunSPtr,
+    const Shared<const Celestial>& anOccultingCelestialSPtr,
+    const Duration& aTimeStep,
+    const Duration& aTolerance,
+    const Duration& aMaximumTimeStep
+)
+    : sunSPtr_(aSunSPtr),
+      occultingCelestialSPtr_(anOccultingCelestialSPtr),
+      timeStep_(aTimeStep),
+      tolerance_(aTolerance),
+      maximumTimeStep_(aMaximumTimeStep)
+{
+}
+
+bool EclipseSolver::isDefined() const
+{
+    return (this->sunSPtr_ != nullptr) && this->sunSPtr_->isDefined() && (this->occultingCelestialSPtr_ != nullptr) &&
+           this->occultingCelestialSPtr_->isDefined() && this->timeStep_.isDefined() &&
+           this->timeStep_.isStrictlyPositive() && this->tolerance_.isDefined() && this->maximumTimeStep_.isDefined() &&
+           (this->maximumTimeStep_ >= this->timeStep_);
+}
+
+Duration EclipseSolver::getTimeStep() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Eclipse Solver");
+    }
+
+    return this->timeStep_;
+}
+
+Duration EclipseSolver::getTolerance() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Eclipse Solver");
+    }
+
+    return this->tolerance_;
+}
+
+Duration EclipseSolver::getMaximumTimeStep() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Eclipse Solver");
+    }
+
+    return this->maximumTimeStep_;
+}
+
+Real EclipseSolver::computeIlluminationFraction(const Instant& anInstant, const Vector3d& aPositionCoordinates) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Eclipse Solver");
+    }
+
+    static const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+
+    return EclipseSolver::ComputeIlluminationFraction(
+        aPositionCoordinates,
+        this->sunSPtr_->getPositionIn(gcrfSPtr, anInstant).inMeters().getCoordinates(),
+        this->occultingCelestialSPtr_->getPositionIn(gcrfSPtr, anInstant).inMeters().getCoordinates(),
+        this->sunSPtr_->getEquatorialRadius().inMeters(),
+        this->occultingCelestialSPtr_->getEquatorialRadius().inMeters()
+    );
+}
+
+Array<Interval> EclipseSolver::computeIntervals(
+    const Trajectory& aTrajectory, const Interval& anInterval, const Region& aRegion
+) const
+{
+    if (!aTrajectory.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Trajectory");
+    }
+
+    if (!anInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Eclipse Solver");
+    }
+
+    static const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+
+    // The Sun and occulting body positions vary slowly with respect to the satellite's: an hourly table keeps the
+    // interpolation error well below the tolerance of the boundary instants, while avoiding an ephemeris query per
+    // margin evaluation
+
+    static const Duration ephemerisStep = Duration::Hours(1.0);
+
+    const TabulatedPositions sunPositions = {this->sunSPtr_, anInterval, ephemerisStep};
+    const TabulatedPositions occultingPositions = {this->occultingCelestialSPtr_, anInterval, ephemerisStep};
+
+    const double sunRadius_m = this->sunSPtr_->getEquatorialRadius().inMeters();
+    const double occultingRadius_m = this->occultingCelestialSPtr_->getEquatorialRadius().inMeters();
+
+    const TemporalConditionSolver temporalConditionSolver = {this->timeStep_, this->tolerance_};
+
+    return temporalConditionSolver.solveAdaptive(
+        [&](const Instant& anInstant) -> double
+        {
+            const State state = aTrajectory.getStateAt(anInstant);
+
+            const Vector3d positionCoordinates = (state.accessFrame() == gcrfSPtr)
+                                                   ? state.accessPositionCoordinates()
+                                                   : LazyState(state, gcrfSPtr).accessPositionCoordinates();
+
+            return EclipseSolver::ComputeShadowFunction(
+                aRegion,
+                positionCoordinates,
+                sunPositions.at(anInstant),
+                occultingPositions.at(anInstant),
+                sunRadius_m,
+                occultingRadius_m
+            );
+        },
+        anInterval,
+        this->maximumTimeStep_
+    );
+}
+
+RealCondition EclipseSolver::generateEventCondition(
+    const Region& aRegion, const RealCondition::Criterion& aCriterion
+) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Eclipse Solver");
+    }
+
+    const Shared<const Celestial> sunSPtr = this->sunSPtr_;
+    const Shared<const Celestial> occultingCelestialSPtr = this->occultingCelestialSPtr_;
+
+    const std::function<Real(const State&)> evaluator =
+        [sunSPtr, occultingCelestialSPtr, aRegion](const State& aState) -> Real
+    {
+        static const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+
+        const Instant& instant = aState.accessInstant();
+
+        const Vector3d positionCoordinates = (aState.accessFrame() == gcrfSPtr)
+                                               ? aState.accessPositionCoordinates()
+                                               : LazyState(aState, gcrfSPtr).accessPositionCoordinates();
+
+        return EclipseSolver::ComputeShadowFunction(
+            aRegion,
+            positionCoordinates,
+            sunSPtr->getPositionIn(gcrfSPtr, instant).inMeters().getCoordinates(),
+            occultingCelestialSPtr->getPositionIn(gcrfSPtr, instant).inMeters().getCoordinates(),
+            sunSPtr->getEquatorialRadius().inMeters(),
+            occultingCelestialSPtr->getEquatorialRadius().inMeters()
+        );
+    };
+
+    return {
+        String::Format("{} {}", occultingCelestialSPtr->getName(), EclipseSolver::StringFromRegion(aRegion)),
+        aCriterion,
+        evaluator,
+    };
+}
+
+EclipseSolver EclipseSolver::Undefined()
+{
+    return {nullptr, nullptr, Duration::Undefined(), Duration::Undefined(), Duration::Undefined()};
+}
+
+String EclipseSolver::StringFromRegion(const Region& aRegion)
+{
+    switch (aRegion)
+    {
+        case Region::Sunlight:
+            return "Sunlight";
+
+        case Region::Penumbra:
+            return "Penumbra";
+
+        case Region::Umbra:
+            return "Umbra";
+
+        case Region::Shadow:
+            return "Shadow";
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Region");
+    }
+
+    return String::Empty();
+}
+
+double EclipseSolver::ComputeShadowFunction(
+    const Region& aRegion,
+    const Vector3d& aPositionCoordinates,
+    const Vector3d& aSunPositionCoordinates,
+    const Vector3d& anOccultingPositionCoordinates,
+    const double& aSunRadius,
+    const double& anOccultingRadius
+)
+{
+    const auto [a, b, c] = ComputeShadowGeometry(
+        aPositionCoordinates, aSunPositionCoordinates, anOccultingPositionCoordinates, aSunRadius, anOccultingRadius
+    );
+
+    // Penumbra cone boundary: the discs touch externally (c = a + b)
+    // Umbra cone boundary: the Sun disc is fully covered (c = b - a)
+
+    switch (aRegion)
+    {
+        case Region::Sunlight:
+            return c - (a + b);
+
+        case Region::Penumbra:
+            return std::min((a + b) - c, c - (b - a));
+
+        case Region::Umbra:
+            return (b - a) - c;
+
+        case Region::Shadow:
+            return (a + b) - c;
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Region");
+    }
+
+    return 0.0;
+}
+
+double EclipseSolver::ComputeIlluminationFraction(
+    const Vector3d& aPositionCoordinates,
+    const Vector3d& aSunPositionCoordinates,
+    const Vector3d& anOccultingPositionCoordinates,
+    const double& aSunRadius,
+    const double& anOccultingRadius
+)
+{
+    const auto [a, b, c] = ComputeShadowGeometry(
+        aPositionCoordinates, aSunPositionCoordinates, anOccultingPositionCoordinates, aSunRadius, anOccultingRadius
+    );
+
+    if (c >= (a + b))
+    {
+        return 1.0;
+    }
+
+    if (c <= (b - a))
+    {
+        return 0.0;
+    }
+
+    // Annular eclipse: the occulting disc lies fully within the Sun disc
+
+    if (c <= (a - b))
+    {
+        return 1.0 - (b * b) / (a * a);
+    }
+
+    // Partial overlap of the two discs (Montenbruck & Gill, Satellite Orbits, Eq. 3.85)
+
+    const double x = (c * c + a * a - b * b) / (2.0 * c);
+    const double y = std::sqrt(std::max(a * a - x * x, 0.0));
+
+    const double overlapArea = a * a * std::acos(std::clamp(x / a, -1.0, +1.0)) +
+                               b * b * std::acos(std::clamp((c - x) / b, -1.0, +1.0)) - c * y;
+
+    return std::clamp(1.0 - overlapArea / (M_PI * a * a), 0.0, 1.0);
+}
+
+}  // namespace solver
+}  // namespace astrodynamics
+}  // namespace ostk
@@ -1,7 +1,11 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <vector>
+
 #include <OpenSpaceToolkit/Core/Type/Size.hpp>
 
+#include <OpenSpaceToolkit/Astrodynamics/ExecutionContext.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Solver/FiniteDifferenceSolver.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/StateBuilder.hpp>
 
@@ -17,6 +21,7 @@ using ostk::core::type::Size;
 
 using ostk::physics::time::Duration;
 
+using ostk::astrodynamics::ExecutionContext;
 using ostk::astrodynamics::trajectory::StateBuilder;
 
 FiniteDifferenceSolver::FiniteDifferenceSolver(
@@ -54,91 +59,97 @@ MatrixXd FiniteDifferenceSolver::computeJacobian(
     const State& aState,
     const Array<Instant>& anInstantArray,
     const std::function<MatrixXd(const State&, const Array<Instant>&)>& generateStateCoordinates,
-    const Size& aCoordinatesDimension
+    const Size& aCoordinatesDimension,
+    const Size& aThreadCount
 ) const
 {
     const StateBuilder stateBuilder = {aState};
 
+    const Instant& instant = aState.accessInstant();
+    const Eigen::Ref<const VectorXd> coordinates = aState.accessCoordinates();
+
     const Size stateVectorDimension = aState.getSize();
     const Size numberOfInstants = anInstantArray.getSize();
 
-    std::function<MatrixXd(const Real&, VectorXd, const Index&)> computeBlock;
+    VectorXd stepSizes(stateVectorDimension);
 
-    switch (type_)
+    for (Index i = 0; i < stateVectorDimension; ++i)
     {
-        case FiniteDifferenceSolver::Type::Forward:
-            computeBlock = [&generateStateCoordinates,
-                            &stateBuilder,
-                            anInstant = aState.accessInstant(),
-                            &anInstantArray](const Real& aStepSize, VectorXd aCoordinateVector, const Index& anIndex)
-            {
-                const MatrixXd coordinates =
-                    generateStateCoordinates(stateBuilder.build(anInstant, aCoordinateVector), anInstantArray);
-
-                aCoordinateVector(anIndex) += aStepSize;
-                const MatrixXd forwardCoordinates =
-                    generateStateCoordinates(stateBuilder.build(anInstant, aCoordinateVector), anInstantArray);
-
-                const MatrixXd differencedCoordinates = (forwardCoordinates - coordinates) / aStepSize;
+        stepSizes(i) = (coordinates(i) * stepPercentage_ != 0.0) ? coordinates(i) * stepPercentage_ : stepPercentage_;
+    }
 
-                return differencedCoordinates;
-            };
-            break;
+    // The evaluated coordinate vectors are laid out as [perturbed columns..., baseline] for the one-sided schemes,
+    // evaluating the baseline once per Jacobian, and as [forward columns..., backward columns...] for the central one
 
-        case FiniteDifferenceSolver::Type::Backward:
-            computeBlock = [&generateStateCoordinates,
-                            &stateBuilder,
-                            anInstant = aState.accessInstant(),
-                            &anInstantArray](const Real& aStepSize, VectorXd aCoordinateVector, const Index& anIndex)
-            {
-                const MatrixXd coordinates =
-                    generateStateCoordinates(stateBuilder.build(anInstant, aCoordinateVector), anInstantArray);
+    const bool isCentral = type_ == FiniteDifferenceSolver::Type::Central;
+    const Size evaluationCount = isCentral ? 2 * stateVectorDimension : stateVectorDimension + 1;
 
-                aCoordinateVector(anIndex) -= aStepSize;
-                const MatrixXd backwardCoordinates =
-                    generateStateCoordinates(stateBuilder.build(anInstant, aCoordinateVector), anInstantArray);
+    Array<VectorXd> evaluationCoordinatesArray(evaluationCount, VectorXd(coordinates));
 
-                const MatrixXd differencedCoordinates = (coordinates - backwardCoordinates) / aStepSize;
+    for (Index i = 0; i < stateVectorDimension; ++i)
+    {
+        switch (type_)
+        {
+            case FiniteDifferenceSolver::Type::Forward:
+                evaluationCoordinatesArray[i](i) += stepSizes(i);
+                break;
+
+            case FiniteDifferenceSolver::Type::Backward:
+                evaluationCoordinatesArray[i](i) -= stepSizes(i);
+                break;
+
+            case FiniteDifferenceSolver::Type::Central:
+                evaluationCoordinatesArray[i](i) += stepSizes(i);
+                evaluationCoordinatesArray[stateVectorDimension + i](i) += stepSizes(i);
+                evaluationCoordinatesArray[stateVectorDimension + i](i) -= 2.0 * stepSizes(i);
+                break;
+
+            default:
+                throw ostk::core::error::runtime::Wrong("Finite Difference Solver Type.");
+        }
+    }
 
-                return differencedCoordinates;
-            };
-            break;
+    // Evaluations are independent, and are distributed over a pool of worker threads
 
-        case FiniteDifferenceSolver::Type::Central:
-            computeBlock = [&generateStateCoordinates,
-                            &stateBuilder,
-                            anInstant = aState.accessInstant(),
-                            &anInstantArray](const Real& aStepSize, VectorXd aCoordinateVector, const Index& anIndex)
-            {
-                // Perturb state forward
-                aCoordinateVector(anIndex) += aStepSize;
-                const MatrixXd forwardCoordinates =
-                    generateStateCoordinates(stateBuilder.build(anInstant, aCoordinateVector), anInstantArray);
-
-                // Perturb state backward
-                aCoordinateVector(anIndex) -= 2.0 * aStepSize;
-                const MatrixXd backwardCoordinates =
-                    generateStateCoordinates(stateBuilder.build(anInstant, aCoordinateVector), anInstantArray);
-
-                const MatrixXd differencedCoordinates = (forwardCoordinates - backwardCoordinates) / (2.0 * aStepSize);
-
-                return differencedCoordinates;
-            };
-            break;
+    Array<MatrixXd> evaluatedCoordinatesArray(evaluationCount, MatrixXd());
 
-        default:
-            throw ostk::core::error::runtime::Wrong("Finite Difference Solver Type.");
-    }
+    ExecutionContext(aThreadCount).parallelFor(
+        evaluationCount,
+        [&](const Index& anEvaluationIndex) -> void
+        {
+            evaluatedCoordinatesArray[anEvaluationIndex] = generateStateCoordinates(
+                stateBuilder.build(instant, evaluationCoordinatesArray[anEvaluationIndex]), anInstantArray
+            );
+        }
+    );
 
     MatrixXd A = MatrixXd::Zero(aCoordinatesDimension * numberOfInstants, stateVectorDimension);
 
     for (Index i = 0; i < stateVectorDimension; ++i)
     {
-        const Real stepSize = (aState.accessCoordinates()(i) * stepPercentage_ != 0.0)
-                                ? aState.accessCoordinates()(i) * stepPercentage_
-                                : stepPercentage_;
+        MatrixXd differencedCoordinates;
 
-        MatrixXd differencedCoordinates = computeBlock(stepSize, aState.getCoordinates(), i);
+        switch (type_)
+        {
+            case FiniteDifferenceSolver::Type::Forward:
+                differencedCoordinates =
+                    (evaluatedCoordinatesArray[i] - evaluatedCoordinatesArray[stateVectorDimension]) / stepSizes(i);
+                break;
+
+            case FiniteDifferenceSolver::Type::Backward:
+                differencedCoordinates =
+                    (evaluatedCoordinatesArray[stateVectorDimension] - evaluatedCoordinatesArray[i]) / stepSizes(i);
+                break;
+
+            case FiniteDifferenceSolver::Type::Central:
+                differencedCoordinates =
+                    (evaluatedCoordinatesArray[i] - evaluatedCoordinatesArray[stateVectorDimension + i]) /
+                    (2.0 * stepSizes(i));
+                break;
+
+            default:
+                break;
+        }
 
         const VectorXd columnStackedCoordinates =
             Eigen::Map<VectorXd>(differencedCoordinates.data(), differencedCoordinates.size());
@@ -153,8 +164,8 @@ MatrixXd FiniteDifferenceSolver::computeJacobian(
     const State& aState,
     const Instant& anInstant,
     const std::function<VectorXd(const State&, const Instant&)>& generateStateCoordinates,
-    const Size& aCoordinatesDimension
-
+    const Size& aCoordinatesDimension,
+    const Size& aThreadCount
 ) const
 {
     const auto generateStatesCoordinates =
@@ -167,7 +178,7 @@ MatrixXd FiniteDifferenceSolver::computeJacobian(
         return coordinatesMatrix;
     };
 
-    return computeJacobian(aState, {anInstant}, generateStatesCoordinates, aCoordinatesDimension);
+    return computeJacobian(aState, {anInstant}, generateStatesCoordinates, aCoordinatesDimension, aThreadCount);
 }
 
 VectorXd FiniteDifferenceSolver::computeGradient(
@@ -0,0 +1,699 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <vector>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Velocity.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Time.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Solver/LambertSolver.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace solver
+{
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Velocity;
+using ostk::physics::unit::Length;
+using ostk::physics::unit::Time;
+
+using ostk::astrodynamics::trajectory::orbit::model::Kepler;
+
+static const Derived::Unit GravitationalParameterSIUnit =
+    Derived::Unit::GravitationalParameter(Length::Unit::Meter, Time::Unit::Second);
+
+namespace
+{
+
+// Time of flight equation of Izzo (2015), in the non-dimensional universal variable x, with y = y(x, lambda)
+
+double ComputeY(const double& x, const double& lambda)
+{
+    return std::sqrt(1.0 - lambda * lambda * (1.0 - x * x));
+}
+
+double HypergeometricF(const double& z)
+{
+    if (z >= 1.0)
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    double result = 1.0;
+    double term = 1.0;
+
+    for (Size i = 0; i < 1000; ++i)
+    {
+        term *= (3.0 + i) * (1.0 + i) / (2.5 + i) * z / (i + 1.0);
+
+        const double previousResult = result;
+
+        result += term;
+
+        if (result == previousResult)
+        {
+            break;
+        }
+    }
+
+    return result;
+}
+
+double ComputeTimeOfFlight(const double& x, const double& y, const double& lambda, const Size& aRevolutionCount)
+{
+    // Near parabolic direct transfers use the series expansion (Battin), to avoid the cancellation of 1 - x^2
+
+    if ((aRevolutionCount == 0) && (x > std::sqrt(0.6)) && (x < std::sqrt(1.4)))
+    {
+        const double eta = y - lambda * x;
+        const double s1 = 0.5 * (1.0 - lambda - x * eta);
+        const double q = 4.0 / 3.0 * HypergeometricF(s1);
+
+        return 0.5 * (eta * eta * eta * q + 4.0 * lambda * eta);
+    }
+
+    double psi = 0.0;
+
+    if ((x >= -1.0) && (x < 1.0))
+    {
+        psi = std::acos(x * y + lambda * (1.0 - x * x));
+    }
+    else if (x > 1.0)
+    {
+        psi = std::asinh((y - x * lambda) * std::sqrt(x * x - 1.0));
+    }
+
+    return (((psi + aRevolutionCount * M_PI) / std::sqrt(std::abs(1.0 - x * x))) - x + lambda * y) / (1.0 - x * x);
+}
+
+struct Derivatives
+{
+    double first;
+    double second;
+    double third;
+};
+
+Derivatives ComputeTimeOfFlightDerivatives(const double& x, const double& y, const double& T, const double& lambda)
+{
+    const double lambda2 = lambda * lambda;
+    const double lambda3 = lambda2 * lambda;
+    const double oneMinusX2 = 1.0 - x * x;
+
+    const double first = (3.0 * T * x - 2.0 + 2.0 * lambda3 * x / y) / oneMinusX2;
+    const double second = (3.0 * T + 5.0 * x * first + 2.0 * (1.0 - lambda2) * lambda3 / (y * y * y)) / oneMinusX2;
+    const double third =
+        (7.0 * x * second + 8.0 * first - 6.0 * (1.0 - lambda2) * lambda3 * lambda2 * x / std::pow(y, 5)) /
+        oneMinusX2;
+
+    return {first, second, third};
+}
+
+// Minimum time of flight of a multi-revolution transfer, where the first derivative vanishes (Halley iterations)
+
+std::optional<double> ComputeMinimumTimeOfFlight(
+    const double& lambda, const Size& aRevolutionCount, const Size& aMaximumIterationCount, const double& aTolerance
+)
+{
+    double x = 0.1;
+
+    for (Size i = 0; i < aMaximumIterationCount; ++i)
+    {
+        const double y = ComputeY(x, lambda);
+        const Derivatives derivatives =
+            ComputeTimeOfFlightDerivatives(x, y, ComputeTimeOfFlight(x, y, lambda, aRevolutionCount), lambda);
+
+        const double nextX =
+            x - 2.0 * derivatives.first * derivatives.second /
+                    (2.0 * derivatives.second * derivatives.second - derivatives.first * derivatives.third);
+
+        if (!std::isfinite(nextX))
+        {
+            return std::nullopt;
+        }
+
+        if (std::abs(nextX - x) < aTolerance)
+        {
+            return ComputeTimeOfFlight(nextX, ComputeY(nextX, lambda), lambda, aRevolutionCount);
+        }
+
+        x = nextX;
+    }
+
+    return std::nullopt;
+}
+
+// Root of the time of flight equation (Householder iterations)
+
+std::optional<double> SolveTimeOfFlightEquation(
+    const double& anInitialX,
+    const double& aTimeOfFlight,
+    const double& lambda,
+    const Size& aRevolutionCount,
+    const Size& aMaximumIterationCount,
+    const double& aTolerance
+)
+{
+    double x = anInitialX;
+
+    for (Size i = 0; i < aMaximumIterationCount; ++i)
+    {
+        const double y = ComputeY(x, lambda);
+        const double T = ComputeTimeOfFlight(x, y, lambda, aRevolutionCount);
+        const double f = T - aTimeOfFlight;
+        const Derivatives d = ComputeTimeOfFlightDerivatives(x, y, T, lambda);
+
+        const double nextX =
+            x - f * (d.first * d.first - 0.5 * f * d.second) /
+                    (d.first * (d.first * d.first - f * d.second) + d.third * f * f / 6.0);
+
+        if (!std::isfinite(nextX))
+        {
+            return std::nullopt;
+        }
+
+        if (std::abs(nextX - x) < aTolerance)
+        {
+            return nextX;
+        }
+
+        x = nextX;
+    }
+
+    return std::nullopt;
+}
+
+}  // namespace
+
+bool LambertSolver::Transfer::isDefined() const
+{
+    return departureState.isDefined() && arrivalState.isDefined() && departureDeltaV.isDefined() &&
+           arrivalDeltaV.isDefined();
+}
+
+Real LambertSolver::Transfer::getTotalDeltaV() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Transfer");
+    }
+
+    return departureDeltaV + arrivalDeltaV;
+}
+
+LambertSolver::Transfer LambertSolver::Transfer::Undefined()
+{
+    return {
+        0,
+        State::Undefined(),
+        State::Undefined(),
+        Real::Undefined(),
+        Real::Undefined(),
+        COE::Undefined(),
+    };
+}
+
+const LambertSolver::Transfer& LambertSolver::TransferGrid::accessTransferAt(
+    const Index& aDepartureIndex, const Index& aTimeOfFlightIndex
+) const
+{
+    if ((aDepartureIndex >= departureInstants.getSize()) || (aTimeOfFlightIndex >= timesOfFlight.getSize()))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Transfer index [{}, {}] out of bounds [{}, {}].",
+            aDepartureIndex,
+            aTimeOfFlightIndex,
+            departureInstants.getSize(),
+            timesOfFlight.getSize()
+        );
+    }
+
+    return transfers[aDepartureIndex * timesOfFlight.getSize() + aTimeOfFlightIndex];
+}
+
+MatrixXd LambertSolver::TransferGrid::getDepartureDeltaVs() const
+{
+    MatrixXd deltaVs(departureInstants.getSize(), timesOfFlight.getSize());
+
+    for (Index i = 0; i < departureInstants.getSize(); ++i)
+    {
+        for (Index j = 0; j < timesOfFlight.getSize(); ++j)
+        {
+            const Transfer& transfer = this->accessTransferAt(i, j);
+
+            deltaVs(i, j) =
+                transfer.isDefined() ? transfer.departureDeltaV : std::numeric_limits<double>::quiet_NaN();
+        }
+    }
+
+    return deltaVs;
+}
+
+MatrixXd LambertSolver::TransferGrid::getArrivalDeltaVs() const
+{
+    MatrixXd deltaVs(departureInstants.getSize(), timesOfFlight.getSize());
+
+    for (Index i = 0; i < departureInstants.getSize(); ++i)
+    {
+        for (Index j = 0; j < timesOfFlight.getSize(); ++j)
+        {
+            const Transfer& transfer = this->accessTransferAt(i, j);
+
+            deltaVs(i, j) = transfer.isDefined() ? transfer.arrivalDeltaV : std::numeric_limits<double>::quiet_NaN();
+        }
+    }
+
+    return deltaVs;
+}
+
+MatrixXd LambertSolver::TransferGrid::getTotalDeltaVs() const
+{
+    return this->getDepartureDeltaVs() + this->getArrivalDeltaVs();
+}
+
+LambertSolver::LambertSolver(
+    const Derived& aGravitationalParameter,
+    const Size& aMaximumRevolutionCount,
+    const bool& isPrograde,
+    const Size& aMaximumIterationCount,
+    const Real& aTolerance
+)
+    : gravitationalParameter_(aGravitationalParameter),
+      maximumRevolutionCount_(aMaximumRevolutionCount),
+      isPrograde_(isPrograde),
+      maximumIterationCount_(aMaximumIterationCount),
+      tolerance_(aTolerance)
+{
+    if (!gravitationalParameter_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Gravitational parameter");
+    }
+
+    if (maximumIterationCount_ == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Maximum iteration count");
+    }
+
+    if ((!tolerance_.isDefined()) || (tolerance_ <= 0.0))
+    {
+        throw ostk::core::error::runtime::Wrong("Tolerance");
+    }
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const LambertSolver& aLambertSolver)
+{
+    aLambertSolver.print(anOutputStream, true);
+
+    return anOutputStream;
+}
+
+Derived LambertSolver::getGravitationalParameter() const
+{
+    return gravitationalParameter_;
+}
+
+Size LambertSolver::getMaximumRevolutionCount() const
+{
+    return maximumRevolutionCount_;
+}
+
+bool LambertSolver::isPrograde() const
+{
+    return isPrograde_;
+}
+
+Size LambertSolver::getMaximumIterationCount() const
+{
+    return maximumIterationCount_;
+}
+
+Real LambertSolver::getTolerance() const
+{
+    return tolerance_;
+}
+
+Array<LambertSolver::Solution> LambertSolver::solve(
+    const Vector3d& aDeparturePosition, const Vector3d& anArrivalPosition, const Duration& aTimeOfFlight
+) const
+{
+    if (!aTimeOfFlight.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Time of flight");
+    }
+
+    if (aTimeOfFlight.inSeconds() <= 0.0)
+    {
+        throw ostk::core::error::runtime::Wrong("Time of flight");
+    }
+
+    Array<LambertSolver::Solution> solutions = Array<LambertSolver::Solution>::Empty();
+
+    const double mu = gravitationalParameter_.in(GravitationalParameterSIUnit);
+    const double tolerance = tolerance_;
+
+    const double r1 = aDeparturePosition.norm();
+    const double r2 = anArrivalPosition.norm();
+    const double c = (anArrivalPosition - aDeparturePosition).norm();
+    const double s = 0.5 * (r1 + r2 + c);
+
+    const Vector3d r1Direction = aDeparturePosition / r1;
+    const Vector3d r2Direction = anArrivalPosition / r2;
+    const Vector3d normal = r1Direction.cross(r2Direction);
+
+    if ((!(r1 > 0.0)) || (!(r2 > 0.0)) || (normal.norm() < 1e-12))
+    {
+        return solutions;
+    }
+
+    const Vector3d normalDirection = normal.normalized();
+
+    // Transfer angles beyond 180 deg (with respect to the requested direction) have a negative lambda
+
+    double lambda = std::sqrt(1.0 - std::min(1.0, c / s));
+    Vector3d t1Direction = normalDirection.cross(r1Direction);
+    Vector3d t2Direction = normalDirection.cross(r2Direction);
+
+    if (normalDirection.z() < 0.0)
+    {
+        lambda = -lambda;
+        t1Direction = -t1Direction;
+        t2Direction = -t2Direction;
+    }
+
+    if (!isPrograde_)
+    {
+        lambda = -lambda;
+        t1Direction = -t1Direction;
+        t2Direction = -t2Direction;
+    }
+
+    const double T = std::sqrt(2.0 * mu / (s * s * s)) * aTimeOfFlight.inSeconds();
+
+    // Maximum feasible revolution count, below which the minimum time of flight of each count is reached
+
+    Size feasibleRevolutionCount = static_cast<Size>(std::floor(T / M_PI));
+    const double T00 = std::acos(lambda) + lambda * std::sqrt(1.0 - lambda * lambda);
+
+    if ((feasibleRevolutionCount > 0) && (T < T00 + feasibleRevolutionCount * M_PI))
+    {
+        const std::optional<double> minimumT =
+            ComputeMinimumTimeOfFlight(lambda, feasibleRevolutionCount, maximumIterationCount_, tolerance);
+
+        if (minimumT.has_value() && (T < minimumT.value()))
+        {
+            --feasibleRevolutionCount;
+        }
+    }
+
+    const double gamma = std::sqrt(0.5 * mu * s);
+    const double rho = (r1 - r2) / c;
+    const double sigma = std::sqrt(1.0 - rho * rho);
+
+    const auto addSolution = [&](const double& x, const Size& aRevolutionCount) -> void
+    {
+        const double y = ComputeY(x, lambda);
+
+        const double vr1 = gamma * ((lambda * y - x) - rho * (lambda * y + x)) / r1;
+        const double vr2 = -gamma * ((lambda * y - x) + rho * (lambda * y + x)) / r2;
+        const double vt1 = gamma * sigma * (y + lambda * x) / r1;
+        const double vt2 = gamma * sigma * (y + lambda * x) / r2;
+
+        solutions.add({
+            aRevolutionCount,
+            vr1 * r1Direction + vt1 * t1Direction,
+            vr2 * r2Direction + vt2 * t2Direction,
+        });
+    };
+
+    // Direct transfer
+
+    {
+        const double T1 = 2.0 * (1.0 - lambda * lambda * lambda) / 3.0;
+
+        double initialX = 0.0;
+
+        if (T >= T00)
+        {
+            initialX = std::pow(T00 / T, 2.0 / 3.0) - 1.0;
+        }
+        else if (T < T1)
+        {
+            initialX = 2.5 * T1 / T * (T1 - T) / (1.0 - std::pow(lambda, 5)) + 1.0;
+        }
+        else
+        {
+            initialX = std::pow(T00 / T, std::log2(T1 / T00)) - 1.0;
+        }
+
+        const std::optional<double> x =
+            SolveTimeOfFlightEquation(initialX, T, lambda, 0, maximumIterationCount_, tolerance);
+
+        if (x.has_value())
+        {
+            addSolution(x.value(), 0);
+        }
+    }
+
+    // Left and right branches of the multi-revolution transfers
+
+    for (Size revolutionCount = 1; revolutionCount <= std::min(maximumRevolutionCount_, feasibleRevolutionCount);
+         ++revolutionCount)
+    {
+        const double leftTerm = std::pow((revolutionCount * M_PI + M_PI) / (8.0 * T), 2.0 / 3.0);
+        const double rightTerm = std::pow((8.0 * T) / (revolutionCount * M_PI), 2.0 / 3.0);
+
+        for (const double initialX : {(leftTerm - 1.0) / (leftTerm + 1.0), (rightTerm - 1.0) / (rightTerm + 1.0)})
+        {
+            const std::optional<double> x =
+                SolveTimeOfFlightEquation(initialX, T, lambda, revolutionCount, maximumIterationCount_, tolerance);
+
+            if (x.has_value())
+            {
+                addSolution(x.value(), revolutionCount);
+            }
+        }
+    }
+
+    return solutions;
+}
+
+LambertSolver::Transfer LambertSolver::computeTransfer(const State& aDepartureState, const State& anArrivalState)
+    const
+{
+    if (!aDepartureState.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Departure state");
+    }
+
+    if (!anArrivalState.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Arrival state");
+    }
+
+    if (anArrivalState.accessInstant() <= aDepartureState.accessInstant())
+    {
+        throw ostk::core::error::runtime::Wrong("Arrival state instant");
+    }
+
+    const State departureState = aDepartureState.inFrame(Frame::GCRF());
+    const State arrivalState = anArrivalState.inFrame(Frame::GCRF());
+
+    const Vector3d departurePosition = departureState.getPosition().getCoordinates();
+    const Vector3d departureVelocity = departureState.getVelocity().getCoordinates();
+    const Vector3d arrivalPosition = arrivalState.getPosition().getCoordinates();
+    const Vector3d arrivalVelocity = arrivalState.getVelocity().getCoordinates();
+
+    const Array<LambertSolver::Solution> solutions = this->solve(
+        departurePosition, arrivalPosition, arrivalState.accessInstant() - departureState.accessInstant()
+    );
+
+    if (solutions.isEmpty())
+    {
+        return LambertSolver::Transfer::Undefined();
+    }
+
+    const auto totalDeltaV = [&departureVelocity, &arrivalVelocity](const LambertSolver::Solution& aSolution
+                             ) -> double
+    {
+        return (aSolution.departureVelocity - departureVelocity).norm() +
+               (arrivalVelocity - aSolution.arrivalVelocity).norm();
+    };
+
+    const LambertSolver::Solution& solution = *std::min_element(
+        solutions.begin(),
+        solutions.end(),
+        [&totalDeltaV](const LambertSolver::Solution& aFirstSolution, const LambertSolver::Solution& aSecondSolution
+        ) -> bool
+        {
+            return totalDeltaV(aFirstSolution) < totalDeltaV(aSecondSolution);
+        }
+    );
+
+    const Position transferDeparturePosition = Position::Meters(departurePosition, Frame::GCRF());
+    const Velocity transferDepartureVelocity = Velocity::MetersPerSecond(solution.departureVelocity, Frame::GCRF());
+
+    return {
+        solution.revolutionCount,
+        State(departureState.accessInstant(), transferDeparturePosition, transferDepartureVelocity),
+        State(
+            arrivalState.accessInstant(),
+            Position::Meters(arrivalPosition, Frame::GCRF()),
+            Velocity::MetersPerSecond(solution.arrivalVelocity, Frame::GCRF())
+        ),
+        (solution.departureVelocity - departureVelocity).norm(),
+        (arrivalVelocity - solution.arrivalVelocity).norm(),
+        COE::Cartesian({transferDeparturePosition, transferDepartureVelocity}, gravitationalParameter_),
+    };
+}
+
+LambertSolver::TransferGrid LambertSolver::computeTransferGrid(
+    const Trajectory& aDepartureTrajectory,
+    const Trajectory& anArrivalTrajectory,
+    const Array<Instant>& aDepartureInstantArray,
+    const Array<Duration>& aTimeOfFlightArray,
+    const ExecutionContext& anExecutionContext
+) const
+{
+    if (!aDepartureTrajectory.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Departure trajectory");
+    }
+
+    if (!anArrivalTrajectory.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Arrival trajectory");
+    }
+
+    for (const Duration& timeOfFlight : aTimeOfFlightArray)
+    {
+        if ((!timeOfFlight.isDefined()) || (timeOfFlight.inSeconds() <= 0.0))
+        {
+            throw ostk::core::error::runtime::Wrong("Time of flight");
+        }
+    }
+
+    const Size rowCount = aDepartureInstantArray.getSize();
+    const Size columnCount = aTimeOfFlightArray.getSize();
+    const Size cellCount = rowCount * columnCount;
+
+    // Trajectory states are calculated up front (with arrival instants sorted), so that cells only solve Lambert's
+    // problem and do not rely on the thread safety of the trajectory models
+
+    const Array<State> departureStates = aDepartureTrajectory.getStatesAt(aDepartureInstantArray);
+
+    std::vector<Index> arrivalOrder(cellCount);
+    std::iota(arrivalOrder.begin(), arrivalOrder.end(), 0);
+
+    const auto arrivalInstantAt = [&aDepartureInstantArray, &aTimeOfFlightArray, &columnCount](const Index& aCellIndex
+                                  ) -> Instant
+    {
+        return aDepartureInstantArray[aCellIndex / columnCount] + aTimeOfFlightArray[aCellIndex % columnCount];
+    };
+
+    std::stable_sort(
+        arrivalOrder.begin(),
+        arrivalOrder.end(),
+        [&arrivalInstantAt](const Index& aFirstIndex, const Index& aSecondIndex) -> bool
+        {
+            return arrivalInstantAt(aFirstIndex) < arrivalInstantAt(aSecondIndex);
+        }
+    );
+
+    Array<Instant> sortedArrivalInstants = Array<Instant>::Empty();
+    sortedArrivalInstants.reserve(cellCount);
+
+    for (const Index& cellIndex : arrivalOrder)
+    {
+        sortedArrivalInstants.add(arrivalInstantAt(cellIndex));
+    }
+
+    const Array<State> sortedArrivalStates = anArrivalTrajectory.getStatesAt(sortedArrivalInstants);
+
+    std::vector<Index> arrivalStateIndices(cellCount);
+
+    for (Index i = 0; i < cellCount; ++i)
+    {
+        arrivalStateIndices[arrivalOrder[i]] = i;
+    }
+
+    const Array<LambertSolver::Transfer> transfers = anExecutionContext.map<LambertSolver::Transfer>(
+        cellCount,
+        [this, &departureStates, &sortedArrivalStates, &arrivalStateIndices, &columnCount](const Index& aCellIndex
+        ) -> LambertSolver::Transfer
+        {
+            return this->computeTransfer(
+                departureStates[aCellIndex / columnCount], sortedArrivalStates[arrivalStateIndices[aCellIndex]]
+            );
+        }
+    );
+
+    return {
+        aDepartureInstantArray,
+        aTimeOfFlightArray,
+        transfers,
+    };
+}
+
+Orbit LambertSolver::computeOrbit(
+    const LambertSolver::Transfer& aTransfer, const Shared<const Celestial>& aCelestialObjectSPtr
+) const
+{
+    if (!aTransfer.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Transfer");
+    }
+
+    if ((aCelestialObjectSPtr == nullptr) || (!aCelestialObjectSPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Celestial object");
+    }
+
+    const Kepler keplerianModel = {
+        aTransfer.classicalOrbitalElements,
+        aTransfer.departureState.accessInstant(),
+        gravitationalParameter_,
+        aCelestialObjectSPtr->getEquatorialRadius(),
+        0.0,
+        0.0,
+        Kepler::PerturbationType::None,
+    };
+
+    return {keplerianModel, aCelestialObjectSPtr};
+}
+
+void LambertSolver::print(std::ostream& anOutputStream, bool displayDecorator) const
+{
+    if (displayDecorator)
+    {
+        ostk::core::utils::Print::Header(anOutputStream, "Lambert Solver");
+    }
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Gravitational parameter:" << gravitationalParameter_.toString();
+    ostk::core::utils::Print::Line(anOutputStream) << "Maximum revolution count:" << maximumRevolutionCount_;
+    ostk::core::utils::Print::Line(anOutputStream) << "Direction:" << (isPrograde_ ? "Prograde" : "Retrograde");
+    ostk::core::utils::Print::Line(anOutputStream) << "Maximum iteration count:" << maximumIterationCount_;
+    ostk::core::utils::Print::Line(anOutputStream) << "Tolerance:" << tolerance_.toString();
+
+    if (displayDecorator)
+    {
+        ostk::core::utils::Print::Footer(anOutputStream);
+    }
+}
+
+}  // namespace solver
+}  // namespace astrodynamics
+}  // namespace ostk
@@ -1,12 +1,21 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
 #include <boost/math/tools/roots.hpp>
 
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/EpochTime.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/RootSolver.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Solver/TemporalConditionSolver.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Tracer.hpp>
 
 namespace ostk
 {
@@ -15,12 +24,82 @@ namespace astrodynamics
 namespace solver
 {
 
+using ostk::physics::coordinate::Frame;
+
+namespace
+{
+
+std::int64_t ElapsedNanoseconds(const std::chrono::steady_clock::time_point& aStartTime)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - aStartTime)
+        .count();
+}
+
+}  // namespace
+
+TemporalConditionSolver::Snapshot::Snapshot(
+    const Instant& anInstant,
+    const Array<Trajectory>& aTrajectoryArray,
+    const Array<Shared<const Celestial>>& aCelestialArray
+)
+    : instant_(anInstant),
+      trajectories_(aTrajectoryArray),
+      celestialSPtrs_(aCelestialArray),
+      states_(aTrajectoryArray.getSize()),
+      celestialPositionCoordinates_(aCelestialArray.getSize())
+{
+}
+
+const Instant& TemporalConditionSolver::Snapshot::accessInstant() const
+{
+    return this->instant_;
+}
+
+const State& TemporalConditionSolver::Snapshot::accessState(const Index& aTrajectoryIndex) const
+{
+    if (aTrajectoryIndex >= this->states_.size())
+    {
+        throw ostk::core::error::runtime::Wrong("Trajectory index");
+    }
+
+    std::optional<State>& state = this->states_[aTrajectoryIndex];
+
+    if (!state.has_value())
+    {
+        state = this->trajectories_[aTrajectoryIndex].getStateAt(this->instant_);
+    }
+
+    return state.value();
+}
+
+const Vector3d& TemporalConditionSolver::Snapshot::accessCelestialPositionCoordinates(const Index& aCelestialIndex
+) const
+{
+    if (aCelestialIndex >= this->celestialPositionCoordinates_.size())
+    {
+        throw ostk::core::error::runtime::Wrong("Celestial index");
+    }
+
+    std::optional<Vector3d>& positionCoordinates = this->celestialPositionCoordinates_[aCelestialIndex];
+
+    if (!positionCoordinates.has_value())
+    {
+        static const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+
+        positionCoordinates =
+            this->celestialSPtrs_[aCelestialIndex]->getPositionIn(gcrfSPtr, this->instant_).inMeters().getCoordinates();
+    }
+
+    return positionCoordinates.value();
+}
+
 TemporalConditionSolver::TemporalConditionSolver(
     const Duration& aTimeStep, const Duration& aTolerance, const Size& aMaximumIterationCount
 )
     : timeStep_(aTimeStep),
       tolerance_(aTolerance),
-      maximumIterationCount_(aMaximumIterationCount)
+      maximumIterationCount_(aMaximumIterationCount),
+      statisticsSPtr_(nullptr)
 {
 }
 
@@ -39,6 +118,56 @@ Size TemporalConditionSolver::getMaximumIterationCount() const
     return this->maximumIterationCount_;
 }
 
+bool TemporalConditionSolver::isStatisticsEnabled() const
+{
+    return this->statisticsSPtr_ != nullptr;
+}
+
+TemporalConditionSolver::Statistics TemporalConditionSolver::getStatistics() const
+{
+    if (!this->isStatisticsEnabled())
+    {
+        throw ostk::core::error::RuntimeError("Statistics are not enabled.");
+    }
+
+    const StatisticsCounters& counters = *this->statisticsSPtr_;
+
+    Statistics statistics;
+
+    statistics.conditionEvaluationCount = counters.conditionEvaluationCount;
+    statistics.conditionEvaluationDuration = Duration::Nanoseconds(double(counters.conditionEvaluationDuration_ns));
+    statistics.rootSolverCallCount = counters.rootSolverCallCount;
+    statistics.rootSolverIterationCount = counters.rootSolverIterationCount;
+    statistics.rootSolverDuration = Duration::Nanoseconds(double(counters.rootSolverDuration_ns));
+
+    return statistics;
+}
+
+void TemporalConditionSolver::enableStatistics()
+{
+    if (!this->isStatisticsEnabled())
+    {
+        this->statisticsSPtr_ = std::make_shared<StatisticsCounters>();
+    }
+}
+
+void TemporalConditionSolver::disableStatistics()
+{
+    this->statisticsSPtr_ = nullptr;
+}
+
+void TemporalConditionSolver::resetStatistics()
+{
+    if (this->isStatisticsEnabled())
+    {
+        this->statisticsSPtr_->conditionEvaluationCount = 0;
+        this->statisticsSPtr_->conditionEvaluationDuration_ns = 0;
+        this->statisticsSPtr_->rootSolverCallCount = 0;
+        this->statisticsSPtr_->rootSolverIterationCount = 0;
+        this->statisticsSPtr_->rootSolverDuration_ns = 0;
+    }
+}
+
 Array<Interval> TemporalConditionSolver::solve(
     const TemporalConditionSolver::Condition& aCondition, const Interval& anInterval
 ) const
@@ -50,24 +179,66 @@ Array<Interval> TemporalConditionSolver::solve(
     const Array<TemporalConditionSolver::Condition>& aConditionArray, const Interval& anInterval
 ) const
 {
+    Array<Interval> intervals = Array<Interval>::Empty();
+
+    this->solve(
+        aConditionArray,
+        anInterval,
+        [&intervals](const Interval& aSolutionInterval) -> void
+        {
+            intervals.add(aSolutionInterval);
+        }
+    );
+
+    return intervals;
+}
+
+void TemporalConditionSolver::solve(
+    const TemporalConditionSolver::Condition& aCondition,
+    const Interval& anInterval,
+    const TemporalConditionSolver::IntervalCallback& anIntervalCallback
+) const
+{
+    this->solve(Array<TemporalConditionSolver::Condition>({aCondition}), anInterval, anIntervalCallback);
+}
+
+void TemporalConditionSolver::solve(
+    const Array<TemporalConditionSolver::Condition>& aConditionArray,
+    const Interval& anInterval,
+    const TemporalConditionSolver::IntervalCallback& anIntervalCallback
+) const
+{
+    const Tracer::Span span("TemporalConditionSolver::solve", "event search");
+
     if (!anInterval.isDefined())
     {
         throw ostk::core::error::runtime::Undefined("Interval");
     }
 
-    Array<Interval> intervals = Array<Interval>::Empty();
+    if (!anIntervalCallback)
+    {
+        throw ostk::core::error::runtime::Undefined("Interval callback");
+    }
+
+    if (this->timeStep_ <= Duration::Zero())
+    {
+        throw ostk::core::error::runtime::Wrong("Time step");
+    }
 
-    using ostk::physics::time::Scale;
+    // Instants are generated on the fly, following the same grid as Interval::generateGrid
 
-    const Array<Instant> instants = anInterval.generateGrid(timeStep_);
+    const Instant& startInstant = anInterval.accessStart();
+    const Instant& endInstant = anInterval.accessEnd();
 
     bool conditionIsMetCache = false;
     Instant conditionStartInstantCache = Instant::Undefined();
     Instant previousInstantCache = Instant::Undefined();
 
-    for (const auto& instant : instants)
+    Instant instant = startInstant;
+
+    while (true)
     {
-        const bool conditionIsMet = TemporalConditionSolver::EvaluateConditionAt(instant, aConditionArray);
+        const bool conditionIsMet = this->evaluateConditionAt(instant, aConditionArray);
 
         // If this is the first iteration
         if (!previousInstantCache.isDefined())
@@ -93,7 +264,7 @@ Array<Interval> TemporalConditionSolver::solve(
                 }
                 else
                 {
-                    intervals.add(Interval::Closed(conditionStartInstantCache, switchingInstant));
+                    anIntervalCallback(Interval::Closed(conditionStartInstantCache, switchingInstant));
                     conditionStartInstantCache = Instant::Undefined();
                 }
 
@@ -102,12 +273,193 @@ Array<Interval> TemporalConditionSolver::solve(
         }
 
         previousInstantCache = instant;
+
+        if (instant >= endInstant)
+        {
+            break;
+        }
+
+        instant = instant + this->timeStep_;
+
+        if (instant > endInstant)
+        {
+            instant = endInstant;
+        }
     }
 
     // Add interval if condition is met on the last iteration
     if (conditionIsMetCache)
     {
-        intervals.add(Interval::Closed(conditionStartInstantCache, instants.accessLast()));
+        anIntervalCallback(Interval::Closed(conditionStartInstantCache, previousInstantCache));
+    }
+}
+
+Array<Interval> TemporalConditionSolver::solve(
+    const Array<TemporalConditionSolver::StateCondition>& aStateConditionArray,
+    const Array<Trajectory>& aTrajectoryArray,
+    const Array<Shared<const Celestial>>& aCelestialArray,
+    const Interval& anInterval
+) const
+{
+    for (const Trajectory& trajectory : aTrajectoryArray)
+    {
+        if (!trajectory.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Trajectory");
+        }
+    }
+
+    for (const Shared<const Celestial>& celestialSPtr : aCelestialArray)
+    {
+        if ((celestialSPtr == nullptr) || (!celestialSPtr->isDefined()))
+        {
+            throw ostk::core::error::runtime::Undefined("Celestial");
+        }
+    }
+
+    // A single condition builds the snapshot, then evaluates the state conditions in order, short-circuiting on the
+    // first unmet one
+
+    const TemporalConditionSolver::Condition condition =
+        [&aStateConditionArray, &aTrajectoryArray, &aCelestialArray](const Instant& anInstant) -> bool
+    {
+        const Snapshot snapshot = {anInstant, aTrajectoryArray, aCelestialArray};
+
+        return std::all_of(
+            aStateConditionArray.begin(),
+            aStateConditionArray.end(),
+            [&snapshot](const TemporalConditionSolver::StateCondition& aStateCondition)
+            {
+                return aStateCondition(snapshot);
+            }
+        );
+    };
+
+    return this->solve(condition, anInterval);
+}
+
+Array<Interval> TemporalConditionSolver::solveAdaptive(
+    const TemporalConditionSolver::MarginFunction& aMarginFunction,
+    const Interval& anInterval,
+    const Duration& aMaximumTimeStep
+) const
+{
+    if (!anInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    if (!aMaximumTimeStep.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Maximum time step");
+    }
+
+    if (aMaximumTimeStep < this->timeStep_)
+    {
+        throw ostk::core::error::runtime::Wrong("Maximum time step");
+    }
+
+    // Fraction of the predicted time to crossing covered by a step
+    static const double stepSafetyFactor = 0.5;
+
+    // Largest step growth ratio between successive steps
+    static const double stepGrowthFactor = 2.0;
+
+    const Instant& startInstant = anInterval.accessStart();
+    const EpochTime startEpochTime = {startInstant};
+
+    const double intervalDuration_s = anInterval.getDuration().inSeconds();
+    const double minimumTimeStep_s = this->timeStep_.inSeconds();
+    const double maximumTimeStep_s = aMaximumTimeStep.inSeconds();
+
+    const auto evaluateMarginAt = [this, &startEpochTime, &aMarginFunction](const double& aDurationInSeconds) -> double
+    {
+        if (this->statisticsSPtr_ == nullptr)
+        {
+            return aMarginFunction(startEpochTime.getInstantAt(aDurationInSeconds));
+        }
+
+        const auto evaluationStartTime = std::chrono::steady_clock::now();
+
+        const double margin = aMarginFunction(startEpochTime.getInstantAt(aDurationInSeconds));
+
+        this->statisticsSPtr_->conditionEvaluationCount++;
+        this->statisticsSPtr_->conditionEvaluationDuration_ns += ElapsedNanoseconds(evaluationStartTime);
+
+        return margin;
+    };
+
+    const RootSolver rootSolver = RootSolver(this->maximumIterationCount_, this->tolerance_.inSeconds());
+
+    Array<Interval> intervals = Array<Interval>::Empty();
+
+    double previousTime_s = 0.0;
+    double previousMargin = evaluateMarginAt(previousTime_s);
+    double previousTimeStep_s = minimumTimeStep_s;
+    double marginRate = std::numeric_limits<double>::quiet_NaN();
+
+    bool conditionIsMetCache = previousMargin > 0.0;
+    Instant conditionStartInstantCache = conditionIsMetCache ? startInstant : Instant::Undefined();
+
+    while (previousTime_s < intervalDuration_s)
+    {
+        double timeStep_s = minimumTimeStep_s;
+
+        if (!std::isnan(marginRate))
+        {
+            const double maximumAllowedTimeStep_s =
+                std::max(minimumTimeStep_s, std::min(maximumTimeStep_s, stepGrowthFactor * previousTimeStep_s));
+
+            timeStep_s = (marginRate > 0.0) ? stepSafetyFactor * std::abs(previousMargin) / marginRate
+                                            : maximumAllowedTimeStep_s;
+
+            timeStep_s = std::clamp(timeStep_s, minimumTimeStep_s, maximumAllowedTimeStep_s);
+        }
+
+        const double time_s = std::min(previousTime_s + timeStep_s, intervalDuration_s);
+        const double margin = evaluateMarginAt(time_s);
+
+        const bool conditionIsMet = margin > 0.0;
+
+        if (conditionIsMet != conditionIsMetCache)
+        {
+            const auto rootSolverStartTime = std::chrono::steady_clock::now();
+
+            const RootSolver::Solution solution = rootSolver.solve(evaluateMarginAt, previousTime_s, time_s);
+
+            if (this->statisticsSPtr_ != nullptr)
+            {
+                this->statisticsSPtr_->rootSolverCallCount++;
+                this->statisticsSPtr_->rootSolverIterationCount += solution.iterationCount;
+                this->statisticsSPtr_->rootSolverDuration_ns += ElapsedNanoseconds(rootSolverStartTime);
+            }
+
+            const Instant switchingInstant = startEpochTime.getInstantAt(solution.root);
+
+            if (conditionIsMet)
+            {
+                conditionStartInstantCache = switchingInstant;
+            }
+            else
+            {
+                intervals.add(Interval::Closed(conditionStartInstantCache, switchingInstant));
+                conditionStartInstantCache = Instant::Undefined();
+            }
+
+            conditionIsMetCache = conditionIsMet;
+        }
+
+        marginRate = std::abs(margin - previousMargin) / (time_s - previousTime_s);
+
+        previousTimeStep_s = time_s - previousTime_s;
+        previousTime_s = time_s;
+        previousMargin = margin;
+    }
+
+    // Add interval if condition is met on the last iteration
+    if (conditionIsMetCache)
+    {
+        intervals.add(Interval::Closed(conditionStartInstantCache, anInterval.accessEnd()));
     }
 
     return intervals;
@@ -121,20 +473,48 @@ Instant TemporalConditionSolver::findSwitchingInstant(
 {
     const RootSolver rootSolver = RootSolver(this->maximumIterationCount_, this->tolerance_.inSeconds());
 
+    const EpochTime previousEpochTime = {aPreviousInstant};
+
+    const auto rootSolverStartTime = std::chrono::steady_clock::now();
+
     const auto result = rootSolver.solve(
-        [&aPreviousInstant, &aConditionArray](double aDurationInSeconds) -> double
+        [this, &previousEpochTime, &aConditionArray](double aDurationInSeconds) -> double
         {
-            return TemporalConditionSolver::EvaluateConditionAt(
-                       aPreviousInstant + Duration::Seconds(aDurationInSeconds), aConditionArray
-                   )
+            return this->evaluateConditionAt(previousEpochTime.getInstantAt(aDurationInSeconds), aConditionArray)
                      ? +1.0
                      : -1.0;
         },
         0.0,
-        Duration::Between(aPreviousInstant, aNextInstant).inSeconds()
+        previousEpochTime.getTimeAt(aNextInstant)
     );
 
-    return aPreviousInstant + Duration::Seconds(result.root);
+    if (this->statisticsSPtr_ != nullptr)
+    {
+        this->statisticsSPtr_->rootSolverCallCount++;
+        this->statisticsSPtr_->rootSolverIterationCount += result.iterationCount;
+        this->statisticsSPtr_->rootSolverDuration_ns += ElapsedNanoseconds(rootSolverStartTime);
+    }
+
+    return previousEpochTime.getInstantAt(result.root);
+}
+
+bool TemporalConditionSolver::evaluateConditionAt(
+    const Instant& anInstant, const Array<TemporalConditionSolver::Condition>& aConditionArray
+) const
+{
+    if (this->statisticsSPtr_ == nullptr)
+    {
+        return TemporalConditionSolver::EvaluateConditionAt(anInstant, aConditionArray);
+    }
+
+    const auto evaluationStartTime = std::chrono::steady_clock::now();
+
+    const bool conditionIsMet = TemporalConditionSolver::EvaluateConditionAt(anInstant, aConditionArray);
+
+    this->statisticsSPtr_->conditionEvaluationCount++;
+    this->statisticsSPtr_->conditionEvaluationDuration_ns += ElapsedNanoseconds(evaluationStartTime);
+
+    return conditionIsMet;
 }
 
 bool TemporalConditionSolver::EvaluateConditionAt(
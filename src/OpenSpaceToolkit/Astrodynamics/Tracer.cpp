@@ -0,0 +1,263 @@
+/// Apache License 2.0
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Tracer.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+
+namespace
+{
+
+struct TracerState
+{
+    std::atomic<bool> isEnabled = {false};
+    std::atomic<Size> threadCount = {0};
+
+    std::mutex mutex;
+    Array<Tracer::Event> events = Array<Tracer::Event>::Empty();
+    Size maximumEventCount = 0;
+    Size droppedEventCount = 0;
+    std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+};
+
+TracerState& AccessTracerState()
+{
+    static TracerState tracerState;
+
+    return tracerState;
+}
+
+Size GetThreadIndex()
+{
+    thread_local const Size threadIndex = AccessTracerState().threadCount.fetch_add(1, std::memory_order_relaxed);
+
+    return threadIndex;
+}
+
+Duration ToDuration(const std::chrono::steady_clock::duration& aDuration)
+{
+    return Duration::Nanoseconds(double(std::chrono::duration_cast<std::chrono::nanoseconds>(aDuration).count()));
+}
+
+void WriteJsonString(std::ostream& anOutputStream, const String& aString)
+{
+    anOutputStream << '"';
+
+    for (const char character : aString)
+    {
+        switch (character)
+        {
+            case '"':
+                anOutputStream << "\\\"";
+                break;
+
+            case '\\':
+                anOutputStream << "\\\\";
+                break;
+
+            case '\n':
+                anOutputStream << "\\n";
+                break;
+
+            case '\t':
+                anOutputStream << "\\t";
+                break;
+
+            default:
+                if (static_cast<unsigned char>(character) < 0x20)
+                {
+                    char escapedCharacter[7];
+                    std::snprintf(escapedCharacter, sizeof(escapedCharacter), "\\u%04x", character);
+                    anOutputStream << escapedCharacter;
+                }
+                else
+                {
+                    anOutputStream << character;
+                }
+        }
+    }
+
+    anOutputStream << '"';
+}
+
+}  // namespace
+
+Tracer::Span::Span(const char* aName, const char* aCategory)
+    : name_(aName),
+      category_(aCategory),
+      detail_(),
+      isActive_(AccessTracerState().isEnabled.load(std::memory_order_relaxed)),
+      startTime_()
+{
+    if (isActive_)
+    {
+        startTime_ = std::chrono::steady_clock::now();
+    }
+}
+
+Tracer::Span::Span(const char* aName, const char* aCategory, const String& aDetail)
+    : Span(aName, aCategory)
+{
+    if (isActive_)
+    {
+        detail_ = aDetail;
+    }
+}
+
+Tracer::Span::~Span()
+{
+    if (!isActive_)
+    {
+        return;
+    }
+
+    const std::chrono::steady_clock::time_point endTime = std::chrono::steady_clock::now();
+    const Size threadIndex = GetThreadIndex();
+
+    TracerState& tracerState = AccessTracerState();
+
+    const std::lock_guard<std::mutex> lock(tracerState.mutex);
+
+    if (tracerState.events.getSize() >= tracerState.maximumEventCount)
+    {
+        tracerState.droppedEventCount++;
+        return;
+    }
+
+    tracerState.events.add({
+        name_,
+        category_,
+        detail_,
+        ToDuration(startTime_ - tracerState.epoch),
+        ToDuration(endTime - startTime_),
+        threadIndex,
+    });
+}
+
+bool Tracer::IsEnabled()
+{
+    return AccessTracerState().isEnabled.load(std::memory_order_relaxed);
+}
+
+void Tracer::Enable(const Size& aMaximumEventCount)
+{
+    TracerState& tracerState = AccessTracerState();
+
+    const std::lock_guard<std::mutex> lock(tracerState.mutex);
+
+    if (tracerState.events.isEmpty() && (tracerState.droppedEventCount == 0))
+    {
+        tracerState.epoch = std::chrono::steady_clock::now();
+    }
+
+    tracerState.maximumEventCount = aMaximumEventCount;
+    tracerState.isEnabled.store(true, std::memory_order_relaxed);
+}
+
+void Tracer::Disable()
+{
+    AccessTracerState().isEnabled.store(false, std::memory_order_relaxed);
+}
+
+void Tracer::Clear()
+{
+    TracerState& tracerState = AccessTracerState();
+
+    const std::lock_guard<std::mutex> lock(tracerState.mutex);
+
+    tracerState.events.clear();
+    tracerState.droppedEventCount = 0;
+    tracerState.epoch = std::chrono::steady_clock::now();
+}
+
+Array<Tracer::Event> Tracer::GetEvents()
+{
+    TracerState& tracerState = AccessTracerState();
+
+    const std::lock_guard<std::mutex> lock(tracerState.mutex);
+
+    return tracerState.events;
+}
+
+Size Tracer::GetDroppedEventCount()
+{
+    TracerState& tracerState = AccessTracerState();
+
+    const std::lock_guard<std::mutex> lock(tracerState.mutex);
+
+    return tracerState.droppedEventCount;
+}
+
+String Tracer::ToChromeTrace()
+{
+    const Array<Event> events = Tracer::GetEvents();
+
+    std::ostringstream stream;
+
+    stream << std::fixed << std::setprecision(3);
+
+    // Complete events ("ph": "X"), with timestamps and durations in microseconds
+
+    stream << "{\"traceEvents\":[";
+
+    for (Size eventIndex = 0; eventIndex < events.getSize(); ++eventIndex)
+    {
+        const Event& event = events[eventIndex];
+
+        stream << ((eventIndex == 0) ? "\n" : ",\n");
+
+        stream << "{\"name\":";
+        WriteJsonString(stream, event.name);
+        stream << ",\"cat\":";
+        WriteJsonString(stream, event.category);
+        stream << ",\"ph\":\"X\",\"ts\":" << (event.startTime.inNanoseconds() / 1.0e3)
+               << ",\"dur\":" << (event.duration.inNanoseconds() / 1.0e3) << ",\"pid\":1,\"tid\":" << event.threadIndex;
+
+        if (!event.detail.isEmpty())
+        {
+            stream << ",\"args\":{\"detail\":";
+            WriteJsonString(stream, event.detail);
+            stream << "}";
+        }
+
+        stream << "}";
+    }
+
+    stream << "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"droppedEventCount\":" << Tracer::GetDroppedEventCount()
+           << "}}\n";
+
+    return stream.str();
+}
+
+void Tracer::Dump(const File& aFile)
+{
+    const String chromeTrace = Tracer::ToChromeTrace();
+
+    std::ofstream fileStream(aFile.getPath().toString(), std::ios::trunc);
+
+    if (!fileStream.is_open())
+    {
+        throw ostk::core::error::RuntimeError("Cannot open file [{}].", aFile.toString());
+    }
+
+    fileStream << chromeTrace;
+
+    if (!fileStream.good())
+    {
+        throw ostk::core::error::RuntimeError("Cannot write file [{}].", aFile.toString());
+    }
+}
+
+}  // namespace astrodynamics
+}  // namespace ostk
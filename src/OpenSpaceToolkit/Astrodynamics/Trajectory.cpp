@@ -3,6 +3,8 @@
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Model/Static.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Model/Tabulated.hpp>
@@ -12,20 +14,22 @@ namespace ostk
 namespace astrodynamics
 {
 
+using ostk::physics::time::Duration;
+
 using ostk::astrodynamics::trajectory::model::Tabulated;
 
 Trajectory::Trajectory(const Model& aModel)
-    : modelUPtr_(aModel.clone())
+    : modelSPtr_(aModel.clone())
 {
 }
 
 Trajectory::Trajectory(const Array<State>& aStateArray)
-    : modelUPtr_(std::make_unique<Tabulated>(aStateArray))
+    : modelSPtr_(std::make_shared<const Tabulated>(aStateArray))
 {
 }
 
 Trajectory::Trajectory(const Trajectory& aTrajectory)
-    : modelUPtr_((aTrajectory.modelUPtr_) != nullptr ? aTrajectory.modelUPtr_->clone() : nullptr)
+    : modelSPtr_(aTrajectory.modelSPtr_)
 {
 }
 
@@ -33,7 +37,7 @@ Trajectory& Trajectory::operator=(const Trajectory& aTrajectory)
 {
     if (this != &aTrajectory)
     {
-        modelUPtr_ = Unique<Model>(aTrajectory.modelUPtr_->clone());
+        modelSPtr_ = aTrajectory.modelSPtr_;
     }
 
     return *this;
@@ -46,7 +50,7 @@ bool Trajectory::operator==(const Trajectory& aTrajectory) const
         return false;
     }
 
-    return (*modelUPtr_) == (*aTrajectory.modelUPtr_);
+    return (*modelSPtr_) == (*aTrajectory.modelSPtr_);
 }
 
 bool Trajectory::operator!=(const Trajectory& aTrajectory) const
@@ -63,7 +67,7 @@ std::ostream& operator<<(std::ostream& anOutputStream, const Trajectory& aTrajec
 
 bool Trajectory::isDefined() const
 {
-    return (modelUPtr_ != nullptr) && modelUPtr_->isDefined();
+    return (modelSPtr_ != nullptr) && modelSPtr_->isDefined();
 }
 
 const Model& Trajectory::accessModel() const
@@ -73,12 +77,12 @@ const Model& Trajectory::accessModel() const
     //     throw ostk::core::error::runtime::Undefined("Trajectory") ;
     // }
 
-    if (modelUPtr_ == nullptr)
+    if (modelSPtr_ == nullptr)
     {
         throw ostk::core::error::runtime::Undefined("Model");
     }
 
-    return *modelUPtr_;
+    return *modelSPtr_;
 }
 
 State Trajectory::getStateAt(const Instant& anInstant) const
@@ -88,7 +92,7 @@ State Trajectory::getStateAt(const Instant& anInstant) const
         throw ostk::core::error::runtime::Undefined("Trajectory");
     }
 
-    return modelUPtr_->calculateStateAt(anInstant);
+    return modelSPtr_->calculateStateAt(anInstant);
 }
 
 Array<State> Trajectory::getStatesAt(const Array<Instant>& anInstantArray) const
@@ -98,7 +102,53 @@ Array<State> Trajectory::getStatesAt(const Array<Instant>& anInstantArray) const
         throw ostk::core::error::runtime::Undefined("Trajectory");
     }
 
-    return modelUPtr_->calculateStatesAt(anInstantArray);
+    return modelSPtr_->calculateStatesAt(anInstantArray);
+}
+
+Ephemeris Trajectory::getEphemerisAt(const Array<Instant>& anInstantArray) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Trajectory");
+    }
+
+    return modelSPtr_->calculateEphemerisAt(anInstantArray);
+}
+
+StateTable Trajectory::getStateTableAt(const Instant& anEpoch, const StateTable::OffsetVector& anOffsetVector) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Trajectory");
+    }
+
+    if (!anEpoch.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Epoch");
+    }
+
+    if (anOffsetVector.size() == 0)
+    {
+        return StateTable::Undefined();
+    }
+
+    Array<Instant> instants = Array<Instant>::Empty();
+    instants.reserve(anOffsetVector.size());
+
+    for (Index index = 0; index < Index(anOffsetVector.size()); ++index)
+    {
+        instants.add(anEpoch + Duration::Nanoseconds(double(anOffsetVector(index))));
+    }
+
+    const StateTable stateTable = StateTable::FromStates(modelSPtr_->calculateStatesAt(instants));
+
+    return {
+        anEpoch,
+        anOffsetVector,
+        stateTable.accessCoordinates(),
+        stateTable.accessFrame(),
+        stateTable.accessCoordinateBroker(),
+    };
 }
 
 void Trajectory::print(std::ostream& anOutputStream, bool displayDecorator) const
@@ -107,7 +157,7 @@ void Trajectory::print(std::ostream& anOutputStream, bool displayDecorator) cons
 
     ostk::core::utils::Print::Separator(anOutputStream, "Model");
 
-    modelUPtr_->print(anOutputStream, false);
+    modelSPtr_->print(anOutputStream, false);
 
     displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
 }
@@ -130,7 +180,7 @@ Trajectory Trajectory::Position(const physics::coordinate::Position& aPosition)
 }
 
 Trajectory::Trajectory()
-    : modelUPtr_(nullptr)
+    : modelSPtr_(nullptr)
 {
 }
 
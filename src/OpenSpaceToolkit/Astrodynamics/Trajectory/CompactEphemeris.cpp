@@ -0,0 +1,636 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/CompactEphemeris.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateBroker.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianPosition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianVelocity.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace trajectory
+{
+
+namespace
+{
+
+using ostk::core::type::String;
+
+using ostk::mathematics::object::VectorXd;
+
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Scale;
+
+using ostk::astrodynamics::trajectory::state::CoordinateBroker;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianPosition;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianVelocity;
+
+// File layout: a fixed size header, the time offsets, the anchors, then the position and velocity offsets
+
+static constexpr char CompactEphemerisMagic[8] = {'O', 'S', 'T', 'K', 'C', 'E', 'P', '1'};
+
+struct CompactEphemerisHeader
+{
+    char magic[8];
+    std::uint64_t rowCount;
+    std::uint64_t blockSize;
+    std::uint64_t hasVelocities;
+    char epoch[40];  // UTC
+    char frame[64];
+};
+
+static constexpr std::size_t CompactEphemerisHeaderSize = 160;
+
+static_assert(sizeof(CompactEphemerisHeader) <= CompactEphemerisHeaderSize, "Compact ephemeris header too large");
+
+const Shared<const CoordinateBroker>& PositionCoordinateBroker()
+{
+    static const Shared<const CoordinateBroker> coordinateBrokerSPtr =
+        std::make_shared<CoordinateBroker>(CoordinateBroker({CartesianPosition::Default()}));
+
+    return coordinateBrokerSPtr;
+}
+
+const Shared<const CoordinateBroker>& PositionVelocityCoordinateBroker()
+{
+    static const Shared<const CoordinateBroker> coordinateBrokerSPtr = std::make_shared<CoordinateBroker>(
+        CoordinateBroker({CartesianPosition::Default(), CartesianVelocity::Default()})
+    );
+
+    return coordinateBrokerSPtr;
+}
+
+Shared<const Frame> FrameWithName(const String& aFrameName)
+{
+    if (aFrameName == "GCRF")
+    {
+        return Frame::GCRF();
+    }
+
+    if (aFrameName == "ITRF")
+    {
+        return Frame::ITRF();
+    }
+
+    if (aFrameName == "TEME")
+    {
+        return Frame::TEME();
+    }
+
+    if (Frame::Exists(aFrameName))
+    {
+        return Frame::WithName(aFrameName);
+    }
+
+    throw ostk::core::error::runtime::Wrong("Frame");
+}
+
+Size BlockCount(const Size& aRowCount, const Size& aBlockSize)
+{
+    return (aRowCount + aBlockSize - 1) / aBlockSize;
+}
+
+}  // namespace
+
+CompactEphemeris::CompactEphemeris(const Ephemeris& anEphemeris, const Size& aBlockSize, const bool& storeVelocities)
+    : epoch_(Instant::Undefined()),
+      offsets_(),
+      blockSize_(aBlockSize),
+      anchors_(),
+      positionOffsets_(),
+      velocityOffsets_(),
+      frameSPtr_(nullptr)
+{
+    if (aBlockSize == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Block size");
+    }
+
+    if (!anEphemeris.isDefined())
+    {
+        return;
+    }
+
+    const Array<Instant>& instants = anEphemeris.accessInstants();
+    const MatrixXd& positions = anEphemeris.accessPositions();
+    const MatrixXd& velocities = anEphemeris.accessVelocities();
+
+    const Size rowCount = anEphemeris.getSize();
+    const Size blockCount = BlockCount(rowCount, aBlockSize);
+
+    epoch_ = instants.isEmpty() ? Instant::Undefined() : instants.accessFirst();
+    frameSPtr_ = anEphemeris.accessFrame();
+
+    offsets_.resize(rowCount);
+
+    for (Index i = 0; i < rowCount; ++i)
+    {
+        offsets_(i) = std::llround(double(Duration::Between(epoch_, instants[i]).inNanoseconds()));
+
+        if ((i > 0) && (offsets_(i) <= offsets_(i - 1)))
+        {
+            throw ostk::core::error::runtime::Wrong("Instant array");
+        }
+    }
+
+    anchors_.resize(blockCount, storeVelocities ? 6 : 3);
+    positionOffsets_.resize(rowCount, 3);
+    velocityOffsets_.resize(storeVelocities ? rowCount : 0, 3);
+
+    for (Index blockIndex = 0; blockIndex < blockCount; ++blockIndex)
+    {
+        const Index startIndex = blockIndex * aBlockSize;
+        const Size count = std::min(aBlockSize, rowCount - startIndex);
+        const Index anchorIndex = startIndex + count / 2;
+
+        anchors_.block<1, 3>(blockIndex, 0) = positions.row(anchorIndex);
+
+        positionOffsets_.middleRows(startIndex, count) =
+            (positions.middleRows(startIndex, count).rowwise() - positions.row(anchorIndex)).cast<float>();
+
+        if (storeVelocities)
+        {
+            anchors_.block<1, 3>(blockIndex, 3) = velocities.row(anchorIndex);
+
+            velocityOffsets_.middleRows(startIndex, count) =
+                (velocities.middleRows(startIndex, count).rowwise() - velocities.row(anchorIndex)).cast<float>();
+        }
+    }
+}
+
+bool CompactEphemeris::operator==(const CompactEphemeris& aCompactEphemeris) const
+{
+    if ((!this->isDefined()) || (!aCompactEphemeris.isDefined()))
+    {
+        return false;
+    }
+
+    if ((this->getSize() != aCompactEphemeris.getSize()) || (blockSize_ != aCompactEphemeris.blockSize_) ||
+        (this->hasVelocities() != aCompactEphemeris.hasVelocities()) ||
+        (*frameSPtr_ != *aCompactEphemeris.frameSPtr_))
+    {
+        return false;
+    }
+
+    if (this->getSize() == 0)
+    {
+        return true;
+    }
+
+    return (epoch_ == aCompactEphemeris.epoch_) && (offsets_ == aCompactEphemeris.offsets_) &&
+           (anchors_ == aCompactEphemeris.anchors_) && (positionOffsets_ == aCompactEphemeris.positionOffsets_) &&
+           (velocityOffsets_ == aCompactEphemeris.velocityOffsets_);
+}
+
+bool CompactEphemeris::operator!=(const CompactEphemeris& aCompactEphemeris) const
+{
+    return !((*this) == aCompactEphemeris);
+}
+
+bool CompactEphemeris::isDefined() const
+{
+    return (frameSPtr_ != nullptr) && frameSPtr_->isDefined();
+}
+
+bool CompactEphemeris::hasVelocities() const
+{
+    return anchors_.cols() == 6;
+}
+
+Size CompactEphemeris::getSize() const
+{
+    return offsets_.size();
+}
+
+Size CompactEphemeris::getBlockSize() const
+{
+    return blockSize_;
+}
+
+Size CompactEphemeris::getStorageSize() const
+{
+    return (offsets_.size() * sizeof(std::int64_t)) + (anchors_.size() * sizeof(double)) +
+           ((positionOffsets_.size() + velocityOffsets_.size()) * sizeof(float));
+}
+
+const Shared<const Frame>& CompactEphemeris::accessFrame() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Compact ephemeris");
+    }
+
+    return frameSPtr_;
+}
+
+Interval CompactEphemeris::getInterval() const
+{
+    if ((!this->isDefined()) || (this->getSize() == 0))
+    {
+        throw ostk::core::error::runtime::Undefined("Compact ephemeris");
+    }
+
+    return Interval::Closed(
+        epoch_, epoch_ + Duration::Nanoseconds(static_cast<double>(offsets_(offsets_.size() - 1)))
+    );
+}
+
+Array<Instant> CompactEphemeris::getInstants() const
+{
+    Array<Instant> instants = Array<Instant>::Empty();
+    instants.reserve(this->getSize());
+
+    for (Index i = 0; i < this->getSize(); ++i)
+    {
+        instants.add(epoch_ + Duration::Nanoseconds(static_cast<double>(offsets_(i))));
+    }
+
+    return instants;
+}
+
+MatrixXd CompactEphemeris::getPositions() const
+{
+    MatrixXd positions(this->getSize(), 3);
+
+    for (Index i = 0; i < this->getSize(); ++i)
+    {
+        positions.row(i) = this->positionAt(i).transpose();
+    }
+
+    return positions;
+}
+
+MatrixXd CompactEphemeris::getVelocities() const
+{
+    if (!this->hasVelocities())
+    {
+        throw ostk::core::error::runtime::Undefined("Velocities");
+    }
+
+    MatrixXd velocities(this->getSize(), 3);
+
+    for (Index i = 0; i < this->getSize(); ++i)
+    {
+        velocities.row(i) = this->velocityAt(i).transpose();
+    }
+
+    return velocities;
+}
+
+State CompactEphemeris::getStateAt(const Index& anIndex) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Compact ephemeris");
+    }
+
+    if (anIndex >= this->getSize())
+    {
+        throw ostk::core::error::runtime::Wrong("Index");
+    }
+
+    const Instant instant = epoch_ + Duration::Nanoseconds(static_cast<double>(offsets_(anIndex)));
+
+    if (!this->hasVelocities())
+    {
+        return {instant, VectorXd(this->positionAt(anIndex)), frameSPtr_, PositionCoordinateBroker()};
+    }
+
+    VectorXd coordinates(6);
+    coordinates << this->positionAt(anIndex), this->velocityAt(anIndex);
+
+    return {instant, coordinates, frameSPtr_, PositionVelocityCoordinateBroker()};
+}
+
+Array<State> CompactEphemeris::getStates() const
+{
+    Array<State> states = Array<State>::Empty();
+    states.reserve(this->getSize());
+
+    for (Index index = 0; index < this->getSize(); ++index)
+    {
+        states.add(this->getStateAt(index));
+    }
+
+    return states;
+}
+
+Ephemeris CompactEphemeris::toEphemeris() const
+{
+    if (!this->isDefined())
+    {
+        return Ephemeris::Undefined();
+    }
+
+    return {this->getInstants(), this->getPositions(), this->getVelocities(), frameSPtr_};
+}
+
+MatrixXd CompactEphemeris::calculatePositionsAt(const Array<Instant>& anInstantArray) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Compact ephemeris");
+    }
+
+    MatrixXd positions(anInstantArray.getSize(), 3);
+
+    Index intervalIndex = 0;
+    Vector3d position;
+
+    for (Index i = 0; i < anInstantArray.getSize(); ++i)
+    {
+        this->interpolateAt(anInstantArray[i], intervalIndex, position, nullptr);
+
+        positions.row(i) = position.transpose();
+    }
+
+    return positions;
+}
+
+Array<State> CompactEphemeris::calculateStatesAt(const Array<Instant>& anInstantArray) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Compact ephemeris");
+    }
+
+    Array<State> states = Array<State>::Empty();
+    states.reserve(anInstantArray.getSize());
+
+    // The interval found for an instant seeds the search for the next one, so sorted instants walk the rows
+    Index intervalIndex = 0;
+
+    Vector3d position;
+    Vector3d velocity;
+    VectorXd coordinates(6);
+
+    for (const Instant& instant : anInstantArray)
+    {
+        if (!this->hasVelocities())
+        {
+            this->interpolateAt(instant, intervalIndex, position, nullptr);
+
+            states.add(State(instant, VectorXd(position), frameSPtr_, PositionCoordinateBroker()));
+
+            continue;
+        }
+
+        this->interpolateAt(instant, intervalIndex, position, &velocity);
+
+        coordinates << position, velocity;
+
+        states.add(State(instant, coordinates, frameSPtr_, PositionVelocityCoordinateBroker()));
+    }
+
+    return states;
+}
+
+void CompactEphemeris::save(const File& aFile) const
+{
+    if (!aFile.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("File");
+    }
+
+    if ((!this->isDefined()) || (this->getSize() == 0))
+    {
+        throw ostk::core::error::runtime::Undefined("Compact ephemeris");
+    }
+
+    const String epochString = epoch_.getDateTime(Scale::UTC).toString();
+    const String frameName = frameSPtr_->getName();
+
+    CompactEphemerisHeader header = {};
+
+    if ((epochString.getLength() >= sizeof(header.epoch)) || (frameName.getLength() >= sizeof(header.frame)))
+    {
+        throw ostk::core::error::runtime::Wrong("Compact ephemeris header");
+    }
+
+    std::memcpy(header.magic, CompactEphemerisMagic, sizeof(CompactEphemerisMagic));
+    header.rowCount = this->getSize();
+    header.blockSize = blockSize_;
+    header.hasVelocities = this->hasVelocities() ? 1 : 0;
+    std::memcpy(header.epoch, epochString.data(), epochString.getLength());
+    std::memcpy(header.frame, frameName.data(), frameName.getLength());
+
+    std::ofstream stream(aFile.getPath().toString(), std::ios::binary | std::ios::trunc);
+
+    char headerBuffer[CompactEphemerisHeaderSize] = {};
+    std::memcpy(headerBuffer, &header, sizeof(CompactEphemerisHeader));
+
+    stream.write(headerBuffer, CompactEphemerisHeaderSize);
+    stream.write(reinterpret_cast<const char*>(offsets_.data()), offsets_.size() * sizeof(std::int64_t));
+    stream.write(reinterpret_cast<const char*>(anchors_.data()), anchors_.size() * sizeof(double));
+    stream.write(reinterpret_cast<const char*>(positionOffsets_.data()), positionOffsets_.size() * sizeof(float));
+    stream.write(reinterpret_cast<const char*>(velocityOffsets_.data()), velocityOffsets_.size() * sizeof(float));
+
+    if (!stream)
+    {
+        throw ostk::core::error::RuntimeError(String::Format("Cannot write file [{}].", aFile.toString()));
+    }
+}
+
+CompactEphemeris CompactEphemeris::Undefined()
+{
+    return {Ephemeris::Undefined()};
+}
+
+CompactEphemeris CompactEphemeris::Load(const File& aFile)
+{
+    if (!aFile.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("File");
+    }
+
+    if (!aFile.exists())
+    {
+        throw ostk::core::error::RuntimeError(String::Format("File [{}] does not exist.", aFile.toString()));
+    }
+
+    std::ifstream stream(aFile.getPath().toString(), std::ios::binary | std::ios::ate);
+
+    if (!stream)
+    {
+        throw ostk::core::error::RuntimeError(String::Format("Cannot open file [{}].", aFile.toString()));
+    }
+
+    const std::size_t fileSize = static_cast<std::size_t>(stream.tellg());
+
+    if (fileSize < CompactEphemerisHeaderSize)
+    {
+        throw ostk::core::error::runtime::Wrong("Compact ephemeris file");
+    }
+
+    stream.seekg(0);
+
+    char headerBuffer[CompactEphemerisHeaderSize] = {};
+    stream.read(headerBuffer, CompactEphemerisHeaderSize);
+
+    CompactEphemerisHeader header;
+    std::memcpy(&header, headerBuffer, sizeof(CompactEphemerisHeader));
+
+    if ((std::memcmp(header.magic, CompactEphemerisMagic, sizeof(CompactEphemerisMagic)) != 0) ||
+        (header.rowCount == 0) || (header.blockSize == 0) || (header.hasVelocities > 1))
+    {
+        throw ostk::core::error::runtime::Wrong("Compact ephemeris file");
+    }
+
+    const Size rowCount = header.rowCount;
+    const Size blockSize = header.blockSize;
+    const Size anchorColumnCount = (header.hasVelocities == 1) ? 6 : 3;
+    const Size velocityRowCount = (header.hasVelocities == 1) ? rowCount : 0;
+
+    if (fileSize != CompactEphemerisHeaderSize + (rowCount * sizeof(std::int64_t)) +
+                        (BlockCount(rowCount, blockSize) * anchorColumnCount * sizeof(double)) +
+                        ((rowCount + velocityRowCount) * 3 * sizeof(float)))
+    {
+        throw ostk::core::error::runtime::Wrong("Compact ephemeris file");
+    }
+
+    header.epoch[sizeof(header.epoch) - 1] = '\0';
+    header.frame[sizeof(header.frame) - 1] = '\0';
+
+    OffsetVector offsets(rowCount);
+    MatrixXd anchors(BlockCount(rowCount, blockSize), anchorColumnCount);
+    FloatMatrix positionOffsets(rowCount, 3);
+    FloatMatrix velocityOffsets(velocityRowCount, 3);
+
+    stream.read(reinterpret_cast<char*>(offsets.data()), offsets.size() * sizeof(std::int64_t));
+    stream.read(reinterpret_cast<char*>(anchors.data()), anchors.size() * sizeof(double));
+    stream.read(reinterpret_cast<char*>(positionOffsets.data()), positionOffsets.size() * sizeof(float));
+    stream.read(reinterpret_cast<char*>(velocityOffsets.data()), velocityOffsets.size() * sizeof(float));
+
+    if (!stream)
+    {
+        throw ostk::core::error::RuntimeError(String::Format("Cannot read file [{}].", aFile.toString()));
+    }
+
+    return {
+        Instant::DateTime(DateTime::Parse(String(header.epoch)), Scale::UTC),
+        offsets,
+        blockSize,
+        anchors,
+        positionOffsets,
+        velocityOffsets,
+        FrameWithName(String(header.frame)),
+    };
+}
+
+CompactEphemeris::CompactEphemeris(
+    const Instant& anEpoch,
+    const OffsetVector& anOffsetVector,
+    const Size& aBlockSize,
+    const MatrixXd& anAnchorMatrix,
+    const FloatMatrix& aPositionOffsetMatrix,
+    const FloatMatrix& aVelocityOffsetMatrix,
+    const Shared<const Frame>& aFrameSPtr
+)
+    : epoch_(anEpoch),
+      offsets_(anOffsetVector),
+      blockSize_(aBlockSize),
+      anchors_(anAnchorMatrix),
+      positionOffsets_(aPositionOffsetMatrix),
+      velocityOffsets_(aVelocityOffsetMatrix),
+      frameSPtr_(aFrameSPtr)
+{
+}
+
+Vector3d CompactEphemeris::positionAt(const Index& anIndex) const
+{
+    return anchors_.block<1, 3>(anIndex / blockSize_, 0).transpose() +
+           positionOffsets_.row(anIndex).transpose().cast<double>();
+}
+
+Vector3d CompactEphemeris::velocityAt(const Index& anIndex) const
+{
+    return anchors_.block<1, 3>(anIndex / blockSize_, 3).transpose() +
+           velocityOffsets_.row(anIndex).transpose().cast<double>();
+}
+
+Index CompactEphemeris::locateInterval(const std::int64_t& anOffset, const Index& anIntervalIndexHint) const
+{
+    const Index lastIntervalIndex = this->getSize() - 2;
+
+    if ((anIntervalIndexHint <= lastIntervalIndex) && (offsets_(anIntervalIndexHint) <= anOffset) &&
+        (anOffset <= offsets_(anIntervalIndexHint + 1)))
+    {
+        return anIntervalIndexHint;
+    }
+
+    const std::int64_t* offsetsBegin = offsets_.data();
+    const std::int64_t* offsetsEnd = offsetsBegin + offsets_.size();
+
+    const Index index = std::upper_bound(offsetsBegin, offsetsEnd, anOffset) - offsetsBegin;
+
+    return std::min<Index>(std::max<Index>(index, 1) - 1, lastIntervalIndex);
+}
+
+void CompactEphemeris::interpolateAt(
+    const Instant& anInstant, Index& anIntervalIndexHint, Vector3d& aPosition, Vector3d* aVelocityPtr
+) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (this->getSize() == 0)
+    {
+        throw ostk::core::error::runtime::Undefined("Compact ephemeris");
+    }
+
+    const std::int64_t offset = std::llround(double(Duration::Between(epoch_, anInstant).inNanoseconds()));
+
+    if ((offset < offsets_(0)) || (offset > offsets_(offsets_.size() - 1)))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Instant [{}] is outside of the compact ephemeris interval [{}].",
+            anInstant.toString(),
+            this->getInterval().toString()
+        );
+    }
+
+    if (this->getSize() == 1)
+    {
+        aPosition = this->positionAt(0);
+
+        if (aVelocityPtr != nullptr)
+        {
+            *aVelocityPtr = this->velocityAt(0);
+        }
+
+        return;
+    }
+
+    anIntervalIndexHint = this->locateInterval(offset, anIntervalIndexHint);
+
+    const Index i = anIntervalIndexHint;
+    const double ratio = double(offset - offsets_(i)) / double(offsets_(i + 1) - offsets_(i));
+
+    aPosition = (1.0 - ratio) * this->positionAt(i) + ratio * this->positionAt(i + 1);
+
+    if (aVelocityPtr != nullptr)
+    {
+        *aVelocityPtr = (1.0 - ratio) * this->velocityAt(i) + ratio * this->velocityAt(i + 1);
+    }
+}
+
+}  // namespace trajectory
+}  // namespace astrodynamics
+}  // namespace ostk
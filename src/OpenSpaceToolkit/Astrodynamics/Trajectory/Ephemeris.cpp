@@ -0,0 +1,183 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Ephemeris.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateBroker.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianPosition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianVelocity.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace trajectory
+{
+
+using ostk::mathematics::object::VectorXd;
+
+using ostk::astrodynamics::trajectory::state::CoordinateBroker;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianPosition;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianVelocity;
+
+Ephemeris::Ephemeris(
+    const Array<Instant>& anInstantArray,
+    const MatrixXd& aPositionMatrix,
+    const MatrixXd& aVelocityMatrix,
+    const Shared<const Frame>& aFrameSPtr
+)
+    : instants_(anInstantArray),
+      positions_(aPositionMatrix),
+      velocities_(aVelocityMatrix),
+      frameSPtr_(aFrameSPtr)
+{
+    if ((aPositionMatrix.rows() != Index(anInstantArray.getSize())) || (aPositionMatrix.cols() != 3))
+    {
+        throw ostk::core::error::runtime::Wrong("Position matrix");
+    }
+
+    if ((aVelocityMatrix.rows() != Index(anInstantArray.getSize())) || (aVelocityMatrix.cols() != 3))
+    {
+        throw ostk::core::error::runtime::Wrong("Velocity matrix");
+    }
+}
+
+bool Ephemeris::operator==(const Ephemeris& anEphemeris) const
+{
+    if ((!this->isDefined()) || (!anEphemeris.isDefined()))
+    {
+        return false;
+    }
+
+    return (this->instants_ == anEphemeris.instants_) && (*this->frameSPtr_ == *anEphemeris.frameSPtr_) &&
+           (this->positions_ == anEphemeris.positions_) && (this->velocities_ == anEphemeris.velocities_);
+}
+
+bool Ephemeris::operator!=(const Ephemeris& anEphemeris) const
+{
+    return !((*this) == anEphemeris);
+}
+
+bool Ephemeris::isDefined() const
+{
+    return (this->frameSPtr_ != nullptr) && this->frameSPtr_->isDefined();
+}
+
+Size Ephemeris::getSize() const
+{
+    return this->instants_.getSize();
+}
+
+const Array<Instant>& Ephemeris::accessInstants() const
+{
+    return this->instants_;
+}
+
+const Shared<const Frame>& Ephemeris::accessFrame() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ephemeris");
+    }
+
+    return this->frameSPtr_;
+}
+
+const MatrixXd& Ephemeris::accessPositions() const
+{
+    return this->positions_;
+}
+
+const MatrixXd& Ephemeris::accessVelocities() const
+{
+    return this->velocities_;
+}
+
+State Ephemeris::getStateAt(const Index& anIndex) const
+{
+    static const Shared<const CoordinateBroker> coordinateBrokerSPtr = std::make_shared<CoordinateBroker>(
+        CoordinateBroker({CartesianPosition::Default(), CartesianVelocity::Default()})
+    );
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ephemeris");
+    }
+
+    if (anIndex >= this->getSize())
+    {
+        throw ostk::core::error::runtime::Wrong("Index");
+    }
+
+    VectorXd coordinates(6);
+    coordinates << this->positions_.row(anIndex).transpose(), this->velocities_.row(anIndex).transpose();
+
+    return {this->instants_[anIndex], coordinates, this->frameSPtr_, coordinateBrokerSPtr};
+}
+
+Array<State> Ephemeris::getStates() const
+{
+    Array<State> states = Array<State>::Empty();
+    states.reserve(this->getSize());
+
+    for (Index index = 0; index < this->getSize(); ++index)
+    {
+        states.add(this->getStateAt(index));
+    }
+
+    return states;
+}
+
+Ephemeris Ephemeris::Undefined()
+{
+    return {Array<Instant>::Empty(), MatrixXd::Zero(0, 3), MatrixXd::Zero(0, 3), nullptr};
+}
+
+Ephemeris Ephemeris::FromStates(const Array<State>& aStateArray)
+{
+    if (aStateArray.isEmpty())
+    {
+        return Ephemeris::Undefined();
+    }
+
+    const Shared<const Frame> frameSPtr = aStateArray.accessFirst().accessFrame();
+
+    Array<Instant> instants = Array<Instant>::Empty();
+    instants.reserve(aStateArray.getSize());
+
+    MatrixXd positions(aStateArray.getSize(), 3);
+    MatrixXd velocities(aStateArray.getSize(), 3);
+
+    for (Index index = 0; index < aStateArray.getSize(); ++index)
+    {
+        const State& state = aStateArray[index];
+
+        if (!state.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("State");
+        }
+
+        instants.add(state.accessInstant());
+
+        if (state.accessFrame() == frameSPtr)
+        {
+            positions.row(index) = state.accessPositionCoordinates().transpose();
+            velocities.row(index) = state.accessVelocityCoordinates().transpose();
+        }
+        else
+        {
+            const State stateInFrame = state.inFrame(frameSPtr);
+
+            positions.row(index) = stateInFrame.accessPositionCoordinates().transpose();
+            velocities.row(index) = stateInFrame.accessVelocityCoordinates().transpose();
+        }
+    }
+
+    return {instants, positions, velocities, frameSPtr};
+}
+
+}  // namespace trajectory
+}  // namespace astrodynamics
+}  // namespace ostk
@@ -0,0 +1,261 @@
+/// Apache License 2.0
+
+#include <algorithm>
+
+#include <OpenSpaceToolkit/Core/Container/Map.hpp>
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/SolarRadiationPressure.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/ThirdBodyGravity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/ExecutionContext.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/FleetPropagator.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace trajectory
+{
+
+using ostk::core::container::Map;
+using ostk::core::type::String;
+
+using ostk::physics::environment::object::Celestial;
+
+using ostk::astrodynamics::Dynamics;
+using ostk::astrodynamics::dynamics::SolarRadiationPressure;
+using ostk::astrodynamics::dynamics::ThirdBodyGravity;
+using ostk::astrodynamics::ExecutionContext;
+
+FleetPropagator::FleetPropagator(
+    const Propagator& aPropagator,
+    const Shared<const AtmosphericDrag::DensityTable>& aDensityTableSPtr,
+    const Duration& anEphemerisSegmentDuration,
+    const Size& aThreadCount
+)
+    : propagator_(aPropagator),
+      densityTableSPtr_(aDensityTableSPtr),
+      ephemerisSegmentDuration_(anEphemerisSegmentDuration),
+      threadCount_(aThreadCount)
+{
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const FleetPropagator& aFleetPropagator)
+{
+    aFleetPropagator.print(anOutputStream);
+
+    return anOutputStream;
+}
+
+bool FleetPropagator::isDefined() const
+{
+    return propagator_.isDefined() && ephemerisSegmentDuration_.isDefined();
+}
+
+const Propagator& FleetPropagator::accessPropagator() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Fleet propagator");
+    }
+
+    return propagator_;
+}
+
+Shared<const AtmosphericDrag::DensityTable> FleetPropagator::getDensityTable() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Fleet propagator");
+    }
+
+    return densityTableSPtr_;
+}
+
+Duration FleetPropagator::getEphemerisSegmentDuration() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Fleet propagator");
+    }
+
+    return ephemerisSegmentDuration_;
+}
+
+Size FleetPropagator::getThreadCount() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Fleet propagator");
+    }
+
+    return threadCount_;
+}
+
+Propagator FleetPropagator::getSharedEnvironmentPropagator(const Interval& anInterval) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Fleet propagator");
+    }
+
+    if (!anInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    // One ephemeris table per celestial object, shared by all the dynamics that need its position
+
+    Map<String, Shared<const ThirdBodyGravity::EphemerisTable>> ephemerisTables;
+
+    const auto getEphemerisTable =
+        [&](const Shared<const Celestial>& aCelestialSPtr) -> Shared<const ThirdBodyGravity::EphemerisTable>
+    {
+        const String name = aCelestialSPtr->getName();
+
+        const auto ephemerisTableIt = ephemerisTables.find(name);
+
+        if (ephemerisTableIt != ephemerisTables.end())
+        {
+            return ephemerisTableIt->second;
+        }
+
+        const Shared<const ThirdBodyGravity::EphemerisTable> ephemerisTableSPtr =
+            std::make_shared<ThirdBodyGravity::EphemerisTable>(
+                aCelestialSPtr, anInterval, Propagator::IntegrationFrame(), this->ephemerisSegmentDuration_
+            );
+
+        ephemerisTables.insert({name, ephemerisTableSPtr});
+
+        return ephemerisTableSPtr;
+    };
+
+    Array<Shared<Dynamics>> dynamicsArray = Array<Shared<Dynamics>>::Empty();
+
+    for (const Shared<Dynamics>& dynamicsSPtr : propagator_.getDynamics())
+    {
+        if (const Shared<ThirdBodyGravity> thirdBodyGravitySPtr =
+                std::dynamic_pointer_cast<ThirdBodyGravity>(dynamicsSPtr))
+        {
+            if (thirdBodyGravitySPtr->getEphemerisTable() == nullptr)
+            {
+                dynamicsArray.add(std::make_shared<ThirdBodyGravity>(
+                    thirdBodyGravitySPtr->getCelestial(),
+                    getEphemerisTable(thirdBodyGravitySPtr->getCelestial()),
+                    thirdBodyGravitySPtr->getName()
+                ));
+
+                continue;
+            }
+        }
+        else if (const Shared<SolarRadiationPressure> solarRadiationPressureSPtr =
+                     std::dynamic_pointer_cast<SolarRadiationPressure>(dynamicsSPtr))
+        {
+            if (solarRadiationPressureSPtr->getSunEphemerisTable() == nullptr)
+            {
+                dynamicsArray.add(std::make_shared<SolarRadiationPressure>(
+                    solarRadiationPressureSPtr->getSun(),
+                    solarRadiationPressureSPtr->getOccultingCelestial(),
+                    solarRadiationPressureSPtr->getReflectivityCoefficient(),
+                    getEphemerisTable(solarRadiationPressureSPtr->getSun()),
+                    solarRadiationPressureSPtr->getName()
+                ));
+
+                continue;
+            }
+        }
+        else if (const Shared<AtmosphericDrag> atmosphericDragSPtr =
+                     std::dynamic_pointer_cast<AtmosphericDrag>(dynamicsSPtr))
+        {
+            if ((densityTableSPtr_ != nullptr) && (atmosphericDragSPtr->getDensityTable() == nullptr))
+            {
+                dynamicsArray.add(std::make_shared<AtmosphericDrag>(
+                    atmosphericDragSPtr->getCelestial(),
+                    densityTableSPtr_,
+                    atmosphericDragSPtr->getProjectedAreaTable(),
+                    atmosphericDragSPtr->getName()
+                ));
+
+                continue;
+            }
+        }
+
+        dynamicsArray.add(dynamicsSPtr);
+    }
+
+    Propagator propagator = propagator_;
+    propagator.setDynamics(dynamicsArray);
+
+    return propagator;
+}
+
+Array<Array<State>> FleetPropagator::calculateStatesAt(
+    const Array<State>& aStateArray, const Array<Instant>& anInstantArray
+) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Fleet propagator");
+    }
+
+    if (aStateArray.isEmpty())
+    {
+        return Array<Array<State>>::Empty();
+    }
+
+    for (const State& state : aStateArray)
+    {
+        if (!state.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("State");
+        }
+    }
+
+    if (anInstantArray.isEmpty())
+    {
+        return Array<Array<State>>(aStateArray.getSize(), Array<State>::Empty());
+    }
+
+    // Propagation interval, spanning all the initial states and output instants
+
+    Instant startInstant = anInstantArray.accessFirst();
+    Instant endInstant = anInstantArray.accessLast();
+
+    for (const State& state : aStateArray)
+    {
+        startInstant = std::min(startInstant, state.accessInstant());
+        endInstant = std::max(endInstant, state.accessInstant());
+    }
+
+    const Propagator propagator = this->getSharedEnvironmentPropagator(Interval::Closed(startInstant, endInstant));
+
+    return propagator.calculateStatesAt(aStateArray, anInstantArray, ExecutionContext(threadCount_));
+}
+
+void FleetPropagator::print(std::ostream& anOutputStream, bool displayDecorator) const
+{
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Fleet Propagator") : void();
+
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Density Table:" << ((densityTableSPtr_ != nullptr) ? "Shared" : "None");
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Ephemeris Segment Duration:"
+        << (ephemerisSegmentDuration_.isDefined() ? ephemerisSegmentDuration_.toString() : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream) << "Thread Count:" << threadCount_;
+
+    ostk::core::utils::Print::Separator(anOutputStream, "Propagator");
+
+    propagator_.print(anOutputStream, false);
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+FleetPropagator FleetPropagator::Undefined()
+{
+    return {Propagator::Undefined(), nullptr, Duration::Undefined()};
+}
+
+}  // namespace trajectory
+}  // namespace astrodynamics
+}  // namespace ostk
@@ -2,8 +2,11 @@
 
 #include <iostream>
 
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
@@ -23,7 +26,10 @@ namespace astrodynamics
 namespace trajectory
 {
 
+using ostk::core::container::Array;
+using ostk::core::type::Index;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 using ostk::mathematics::object::Vector3d;
 
@@ -56,14 +62,14 @@ Shared<const Frame> LocalOrbitalFrameFactory::generateFrame(
 {
     const String name = this->generateFrameName(anInstant, aPosition, aVelocity);
 
-    const Shared<const LocalOrbitalFrameTransformProvider> providerSPtr_ =
-        LocalOrbitalFrameTransformProvider::Construct(this->type_, anInstant, aPosition, aVelocity);
-
     if (const auto frameSPtr = FrameManager::Get().accessFrameWithName(name))
     {
         return frameSPtr;
     }
 
+    const Shared<const LocalOrbitalFrameTransformProvider> providerSPtr_ =
+        LocalOrbitalFrameTransformProvider::Construct(this->type_, anInstant, aPosition, aVelocity);
+
     const Shared<const Frame> frameSPtr =
         std::make_shared<const SharedFrameEnabler>(name, false, parentFrameSPtr_, providerSPtr_);
 
@@ -72,6 +78,78 @@ Shared<const Frame> LocalOrbitalFrameFactory::generateFrame(
     return frameSPtr;
 }
 
+Transform LocalOrbitalFrameFactory::generateTransform(
+    const Instant& anInstant, const Vector3d& aPosition, const Vector3d& aVelocity
+) const
+{
+    struct CacheEntry
+    {
+        LocalOrbitalFrameTransformProvider::Type type;
+        Instant instant;
+        Vector3d position;
+        Vector3d velocity;
+        Transform transform;
+    };
+
+    static constexpr Size CacheSize = 4;
+
+    // Each thread holds its own cache, hence no synchronization
+
+    thread_local Array<CacheEntry> cache = Array<CacheEntry>::Empty();
+    thread_local Index nextEntryIndex = 0;
+
+    for (const CacheEntry& entry : cache)
+    {
+        if ((entry.type == this->type_) && (entry.instant == anInstant) && (entry.position == aPosition) &&
+            (entry.velocity == aVelocity))
+        {
+            return entry.transform;
+        }
+    }
+
+    const Transform transform =
+        LocalOrbitalFrameTransformProvider::GenerateTransform(this->type_, anInstant, aPosition, aVelocity);
+
+    if (cache.getSize() < CacheSize)
+    {
+        cache.add({this->type_, anInstant, aPosition, aVelocity, transform});
+    }
+    else
+    {
+        cache[nextEntryIndex] = {this->type_, anInstant, aPosition, aVelocity, transform};
+        nextEntryIndex = (nextEntryIndex + 1) % CacheSize;
+    }
+
+    return transform;
+}
+
+Array<Matrix3d> LocalOrbitalFrameFactory::generateRotationMatrices(const Array<State>& aStateArray) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Local Orbital Frame Factory");
+    }
+
+    Array<State> statesInParentFrame = Array<State>::Empty();
+    statesInParentFrame.reserve(aStateArray.getSize());
+
+    for (const State& state : aStateArray)
+    {
+        if (!state.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("State");
+        }
+
+        statesInParentFrame.add(
+            ((state.accessFrame() == this->parentFrameSPtr_) || (*state.accessFrame() == *this->parentFrameSPtr_))
+                ? state
+                : state.inFrame(this->parentFrameSPtr_)
+        );
+    }
+
+    return LocalOrbitalFrameTransformProvider::GenerateRotationMatrices(this->type_, statesInParentFrame);
+}
+
 bool LocalOrbitalFrameFactory::isDefined() const
 {
     return (parentFrameSPtr_ != nullptr) && parentFrameSPtr_->isDefined() &&
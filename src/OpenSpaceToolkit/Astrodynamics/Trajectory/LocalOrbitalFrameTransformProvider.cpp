@@ -1,6 +1,7 @@
 /// Apache License 2.0
 
 #include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
@@ -20,6 +21,8 @@ namespace astrodynamics
 namespace trajectory
 {
 
+using ostk::core::type::Index;
+
 using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
 using ostk::mathematics::geometry::d3::transformation::rotation::RotationMatrix;
 
@@ -38,7 +41,7 @@ Shared<const LocalOrbitalFrameTransformProvider> LocalOrbitalFrameTransformProvi
 )
 {
     const Transform transform =
-        LocalOrbitalFrameTransformProvider::generateTransform(aType, anInstant, aPosition, aVelocity);
+        LocalOrbitalFrameTransformProvider::GenerateTransform(aType, anInstant, aPosition, aVelocity);
 
     return std::make_shared<LocalOrbitalFrameTransformProvider>(LocalOrbitalFrameTransformProvider(transform));
 }
@@ -107,7 +110,7 @@ LocalOrbitalFrameTransformProvider::LocalOrbitalFrameTransformProvider(const Tra
 {
 }
 
-Transform LocalOrbitalFrameTransformProvider::generateTransform(
+Transform LocalOrbitalFrameTransformProvider::GenerateTransform(
     const LocalOrbitalFrameTransformProvider::Type& aType,
     const Instant& anInstant,
     const Vector3d& aPosition,
@@ -260,6 +263,96 @@ Transform LocalOrbitalFrameTransformProvider::generateTransform(
     }
 }
 
+Array<Matrix3d> LocalOrbitalFrameTransformProvider::GenerateRotationMatrices(
+    const LocalOrbitalFrameTransformProvider::Type& aType, const Array<State>& aStateArray
+)
+{
+    Array<Matrix3d> rotationMatrices = Array<Matrix3d>::Empty();
+    rotationMatrices.reserve(aStateArray.getSize());
+
+    // The axes of the local orbital frame are the rows of the rotation matrix
+
+    const auto addRows =
+        [&rotationMatrices](const Vector3d& xAxis, const Vector3d& yAxis, const Vector3d& zAxis) -> void
+    {
+        Matrix3d rotationMatrix;
+
+        rotationMatrix.row(0) = xAxis;
+        rotationMatrix.row(1) = yAxis;
+        rotationMatrix.row(2) = zAxis;
+
+        rotationMatrices.add(rotationMatrix);
+    };
+
+    for (const State& state : aStateArray)
+    {
+        const Vector3d position = state.accessPositionCoordinates();
+        const Vector3d velocity = state.accessVelocityCoordinates();
+
+        switch (aType)
+        {
+            case LocalOrbitalFrameTransformProvider::Type::LVLH:
+            case LocalOrbitalFrameTransformProvider::Type::QSW:
+            {
+                const Vector3d xAxis = position.normalized();
+                const Vector3d zAxis = position.cross(velocity).normalized();
+
+                addRows(xAxis, zAxis.cross(xAxis), zAxis);
+                break;
+            }
+
+            case LocalOrbitalFrameTransformProvider::Type::VVLH:
+            {
+                const Vector3d zAxis = -position.normalized();
+                const Vector3d yAxis = -position.cross(velocity).normalized();
+
+                addRows(yAxis.cross(zAxis), yAxis, zAxis);
+                break;
+            }
+
+            case LocalOrbitalFrameTransformProvider::Type::TNW:
+            {
+                const Vector3d xAxis = velocity.normalized();
+                const Vector3d zAxis = position.cross(velocity).normalized();
+
+                addRows(xAxis, zAxis.cross(xAxis), zAxis);
+                break;
+            }
+
+            case LocalOrbitalFrameTransformProvider::Type::VNC:
+            {
+                const Vector3d xAxis = velocity.normalized();
+                const Vector3d yAxis = position.cross(velocity).normalized();
+
+                addRows(xAxis, yAxis, xAxis.cross(yAxis));
+                break;
+            }
+
+            default:
+            {
+                // Other types (e.g. NED) go through the full transform
+
+                const Transform transform = LocalOrbitalFrameTransformProvider::GenerateTransform(
+                    aType, state.accessInstant(), position, velocity
+                );
+                const Quaternion orientation = transform.getOrientation();
+
+                Matrix3d rotationMatrix;
+
+                for (Index columnIndex = 0; columnIndex < 3; ++columnIndex)
+                {
+                    rotationMatrix.col(columnIndex) = orientation.rotateVector(Vector3d::Unit(columnIndex));
+                }
+
+                rotationMatrices.add(rotationMatrix);
+                break;
+            }
+        }
+    }
+
+    return rotationMatrices;
+}
+
 }  // namespace trajectory
 }  // namespace astrodynamics
 }  // namespace ostk
@@ -37,6 +37,11 @@ Array<State> Model::calculateStatesAt(const Array<Instant>& anInstantArray) cons
     return stateArray;
 }
 
+Ephemeris Model::calculateEphemerisAt(const Array<Instant>& anInstantArray) const
+{
+    return Ephemeris::FromStates(this->calculateStatesAt(anInstantArray));
+}
+
 }  // namespace trajectory
 }  // namespace astrodynamics
 }  // namespace ostk
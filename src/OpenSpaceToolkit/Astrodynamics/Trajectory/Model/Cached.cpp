@@ -0,0 +1,228 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Model/Cached.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace trajectory
+{
+namespace model
+{
+
+using ostk::core::type::Index;
+
+Cached::Cached(const Trajectory& aTrajectory, const Size& aCapacity)
+    : Model(),
+      trajectory_(aTrajectory),
+      capacity_(aCapacity),
+      cacheSPtr_(std::make_shared<Cache>())
+{
+    if (capacity_ == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Capacity");
+    }
+}
+
+Cached* Cached::clone() const
+{
+    return new Cached(*this);
+}
+
+bool Cached::operator==(const Cached& aCachedModel) const
+{
+    if ((!this->isDefined()) || (!aCachedModel.isDefined()))
+    {
+        return false;
+    }
+
+    return (trajectory_ == aCachedModel.trajectory_) && (capacity_ == aCachedModel.capacity_);
+}
+
+bool Cached::operator!=(const Cached& aCachedModel) const
+{
+    return !((*this) == aCachedModel);
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const Cached& aCachedModel)
+{
+    aCachedModel.print(anOutputStream);
+
+    return anOutputStream;
+}
+
+bool Cached::isDefined() const
+{
+    return trajectory_.isDefined();
+}
+
+const Trajectory& Cached::accessTrajectory() const
+{
+    return trajectory_;
+}
+
+Size Cached::getCapacity() const
+{
+    return capacity_;
+}
+
+Size Cached::getSize() const
+{
+    const std::lock_guard<std::mutex> lock(cacheSPtr_->mutex);
+
+    return cacheSPtr_->stateList.size();
+}
+
+Size Cached::getHitCount() const
+{
+    const std::lock_guard<std::mutex> lock(cacheSPtr_->mutex);
+
+    return cacheSPtr_->hitCount;
+}
+
+Size Cached::getMissCount() const
+{
+    const std::lock_guard<std::mutex> lock(cacheSPtr_->mutex);
+
+    return cacheSPtr_->missCount;
+}
+
+void Cached::clear() const
+{
+    const std::lock_guard<std::mutex> lock(cacheSPtr_->mutex);
+
+    cacheSPtr_->stateMap.clear();
+    cacheSPtr_->stateList.clear();
+    cacheSPtr_->hitCount = 0;
+    cacheSPtr_->missCount = 0;
+}
+
+State Cached::calculateStateAt(const Instant& anInstant) const
+{
+    return this->calculateStatesAt({anInstant}).accessFirst();
+}
+
+Array<State> Cached::calculateStatesAt(const Array<Instant>& anInstantArray) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Cached");
+    }
+
+    Array<State> states = Array<State>(anInstantArray.getSize(), State::Undefined());
+
+    Array<Index> missingIndices = Array<Index>::Empty();
+    Array<Instant> missingInstants = Array<Instant>::Empty();
+
+    {
+        const std::lock_guard<std::mutex> lock(cacheSPtr_->mutex);
+
+        for (Index i = 0; i < anInstantArray.getSize(); ++i)
+        {
+            const Instant& instant = anInstantArray[i];
+
+            if (!instant.isDefined())
+            {
+                throw ostk::core::error::runtime::Undefined("Instant");
+            }
+
+            const auto stateMapIt = cacheSPtr_->stateMap.find(instant);
+
+            if (stateMapIt == cacheSPtr_->stateMap.end())
+            {
+                missingIndices.add(i);
+                missingInstants.add(instant);
+
+                continue;
+            }
+
+            // Move the state to the front of the list, as the most recently used
+
+            cacheSPtr_->stateList.splice(cacheSPtr_->stateList.begin(), cacheSPtr_->stateList, stateMapIt->second);
+
+            states[i] = stateMapIt->second->second;
+
+            ++cacheSPtr_->hitCount;
+        }
+    }
+
+    if (missingInstants.isEmpty())
+    {
+        return states;
+    }
+
+    // Missing states are calculated without holding the lock, so that concurrent callers are not serialized
+
+    const Array<State> missingStates = trajectory_.getStatesAt(missingInstants);
+
+    for (Index i = 0; i < missingIndices.getSize(); ++i)
+    {
+        states[missingIndices[i]] = missingStates[i];
+    }
+
+    this->cacheStates(missingInstants, missingStates);
+
+    return states;
+}
+
+void Cached::print(std::ostream& anOutputStream, bool displayDecorator) const
+{
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Cached") : void();
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Capacity:" << capacity_;
+    ostk::core::utils::Print::Line(anOutputStream) << "Size:" << this->getSize();
+    ostk::core::utils::Print::Line(anOutputStream) << "Hit count:" << this->getHitCount();
+    ostk::core::utils::Print::Line(anOutputStream) << "Miss count:" << this->getMissCount();
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+bool Cached::operator==(const Model& aModel) const
+{
+    const Cached* cachedModelPtr = dynamic_cast<const Cached*>(&aModel);
+
+    return (cachedModelPtr != nullptr) && this->operator==(*cachedModelPtr);
+}
+
+bool Cached::operator!=(const Model& aModel) const
+{
+    return !((*this) == aModel);
+}
+
+void Cached::cacheStates(const Array<Instant>& anInstantArray, const Array<State>& aStateArray) const
+{
+    const std::lock_guard<std::mutex> lock(cacheSPtr_->mutex);
+
+    for (Index i = 0; i < anInstantArray.getSize(); ++i)
+    {
+        const Instant& instant = anInstantArray[i];
+
+        ++cacheSPtr_->missCount;
+
+        // Another caller (or a repeated instant) may have cached the same instant in the meantime
+
+        if (cacheSPtr_->stateMap.find(instant) != cacheSPtr_->stateMap.end())
+        {
+            continue;
+        }
+
+        cacheSPtr_->stateList.push_front({instant, aStateArray[i]});
+        cacheSPtr_->stateMap.emplace(instant, cacheSPtr_->stateList.begin());
+
+        if (cacheSPtr_->stateList.size() > capacity_)
+        {
+            cacheSPtr_->stateMap.erase(cacheSPtr_->stateList.back().first);
+            cacheSPtr_->stateList.pop_back();
+        }
+    }
+}
+
+}  // namespace model
+}  // namespace trajectory
+}  // namespace astrodynamics
+}  // namespace ostk
@@ -0,0 +1,572 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <cmath>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Model/Chebyshev.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateBroker.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianPosition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianVelocity.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace trajectory
+{
+namespace model
+{
+
+using ostk::core::type::Real;
+using ostk::core::type::String;
+
+using ostk::mathematics::object::VectorXd;
+
+using ostk::astrodynamics::trajectory::state::CoordinateBroker;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianPosition;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianVelocity;
+
+static const Size MinimumDegree = 2;
+static const Size MaximumDegree = 30;
+
+// Segments are not halved below this duration [s] when fitting
+static const double MinimumSegmentDuration_s = 1.0;
+
+// Normalized time of the Chebyshev node (of the first kind) of a given index, decreasing with the index
+static double NodeTime(const Index& aNodeIndex, const Size& aNodeCount)
+{
+    return std::cos(M_PI * (double(aNodeIndex) + 0.5) / double(aNodeCount));
+}
+
+// Coefficients of the Chebyshev series interpolating values sampled at the Chebyshev nodes, one column per node
+static MatrixXd FitCoefficients(const MatrixXd& aNodeValueMatrix)
+{
+    const Size nodeCount = aNodeValueMatrix.cols();
+
+    MatrixXd coefficients = MatrixXd::Zero(aNodeValueMatrix.rows(), nodeCount);
+
+    for (Index j = 0; j < nodeCount; ++j)
+    {
+        for (Index k = 0; k < nodeCount; ++k)
+        {
+            coefficients.col(j) +=
+                aNodeValueMatrix.col(k) * std::cos(M_PI * double(j) * (double(k) + 0.5) / double(nodeCount));
+        }
+    }
+
+    coefficients *= 2.0 / double(nodeCount);
+    coefficients.col(0) *= 0.5;
+
+    return coefficients;
+}
+
+// Clenshaw recurrence
+static Vector3d EvaluateSeries(const MatrixXd& aCoefficientMatrix, const double& aNormalizedTime)
+{
+    Vector3d b1 = Vector3d::Zero();
+    Vector3d b2 = Vector3d::Zero();
+
+    for (Index j = aCoefficientMatrix.cols() - 1; j > 0; --j)
+    {
+        const Vector3d b0 = aCoefficientMatrix.col(j) + 2.0 * aNormalizedTime * b1 - b2;
+        b2 = b1;
+        b1 = b0;
+    }
+
+    return aCoefficientMatrix.col(0) + aNormalizedTime * b1 - b2;
+}
+
+Chebyshev::Chebyshev(const Array<Segment>& aSegmentArray, const Shared<const Frame>& aFrameSPtr)
+    : Model(),
+      segments_(aSegmentArray),
+      frameSPtr_(aFrameSPtr),
+      segmentStartTimes_(),
+      segmentDurations_()
+{
+    if (segments_.isEmpty())
+    {
+        return;
+    }
+
+    if ((frameSPtr_ == nullptr) || (!frameSPtr_->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    const Instant& startInstant = segments_.accessFirst().startInstant;
+    const Eigen::Index coefficientCount = segments_.accessFirst().positionCoefficients.cols();
+
+    segmentStartTimes_.reserve(segments_.getSize());
+    segmentDurations_.reserve(segments_.getSize());
+
+    for (Index segmentIndex = 0; segmentIndex < segments_.getSize(); ++segmentIndex)
+    {
+        const Segment& segment = segments_[segmentIndex];
+
+        if (!segment.startInstant.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Segment start instant");
+        }
+
+        if ((!segment.duration.isDefined()) || (!segment.duration.isStrictlyPositive()))
+        {
+            throw ostk::core::error::runtime::Wrong("Segment duration");
+        }
+
+        if ((coefficientCount == 0) || (segment.positionCoefficients.rows() != 3) ||
+            (segment.velocityCoefficients.rows() != 3) || (segment.positionCoefficients.cols() != coefficientCount) ||
+            (segment.velocityCoefficients.cols() != coefficientCount))
+        {
+            throw ostk::core::error::runtime::Wrong("Segment coefficients");
+        }
+
+        if ((segmentIndex > 0) &&
+            (segment.startInstant != (segments_[segmentIndex - 1].startInstant + segments_[segmentIndex - 1].duration)))
+        {
+            throw ostk::core::error::runtime::Wrong("Segment start instant");
+        }
+
+        segmentStartTimes_.push_back((segment.startInstant - startInstant).inSeconds());
+        segmentDurations_.push_back(segment.duration.inSeconds());
+    }
+}
+
+Chebyshev* Chebyshev::clone() const
+{
+    return new Chebyshev(*this);
+}
+
+bool Chebyshev::operator==(const Chebyshev& aChebyshevModel) const
+{
+    if ((!this->isDefined()) || (!aChebyshevModel.isDefined()))
+    {
+        return false;
+    }
+
+    if ((*frameSPtr_ != *aChebyshevModel.frameSPtr_) || (segments_.getSize() != aChebyshevModel.segments_.getSize()))
+    {
+        return false;
+    }
+
+    for (Index segmentIndex = 0; segmentIndex < segments_.getSize(); ++segmentIndex)
+    {
+        const Segment& segment = segments_[segmentIndex];
+        const Segment& otherSegment = aChebyshevModel.segments_[segmentIndex];
+
+        if ((segment.startInstant != otherSegment.startInstant) || (segment.duration != otherSegment.duration) ||
+            (segment.positionCoefficients.cols() != otherSegment.positionCoefficients.cols()) ||
+            (segment.positionCoefficients != otherSegment.positionCoefficients) ||
+            (segment.velocityCoefficients != otherSegment.velocityCoefficients))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool Chebyshev::operator!=(const Chebyshev& aChebyshevModel) const
+{
+    return !((*this) == aChebyshevModel);
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const Chebyshev& aChebyshevModel)
+{
+    aChebyshevModel.print(anOutputStream);
+
+    return anOutputStream;
+}
+
+bool Chebyshev::isDefined() const
+{
+    return !segments_.isEmpty();
+}
+
+Interval Chebyshev::getInterval() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Chebyshev");
+    }
+
+    return Interval::Closed(
+        segments_.accessFirst().startInstant, segments_.accessLast().startInstant + segments_.accessLast().duration
+    );
+}
+
+Shared<const Frame> Chebyshev::getFrame() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Chebyshev");
+    }
+
+    return frameSPtr_;
+}
+
+Size Chebyshev::getDegree() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Chebyshev");
+    }
+
+    return segments_.accessFirst().positionCoefficients.cols() - 1;
+}
+
+Size Chebyshev::getSegmentCount() const
+{
+    return segments_.getSize();
+}
+
+const Array<Chebyshev::Segment>& Chebyshev::accessSegments() const
+{
+    return segments_;
+}
+
+State Chebyshev::calculateStateAt(const Instant& anInstant) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Chebyshev");
+    }
+
+    return this->calculateStatesAt({anInstant}).accessFirst();
+}
+
+Array<State> Chebyshev::calculateStatesAt(const Array<Instant>& anInstantArray) const
+{
+    static const Shared<const CoordinateBroker> coordinateBrokerSPtr = std::make_shared<CoordinateBroker>(
+        CoordinateBroker({CartesianPosition::Default(), CartesianVelocity::Default()})
+    );
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Chebyshev");
+    }
+
+    Array<State> states = Array<State>::Empty();
+    states.reserve(anInstantArray.getSize());
+
+    Index segmentIndex = 0;
+
+    Vector3d position;
+    Vector3d velocity;
+    VectorXd coordinates(6);
+
+    for (const Instant& instant : anInstantArray)
+    {
+        this->evaluateAt(instant, segmentIndex, position, velocity);
+
+        coordinates.head<3>() = position;
+        coordinates.tail<3>() = velocity;
+
+        states.add(State(instant, coordinates, frameSPtr_, coordinateBrokerSPtr));
+    }
+
+    return states;
+}
+
+Ephemeris Chebyshev::calculateEphemerisAt(const Array<Instant>& anInstantArray) const
+{
+    if (anInstantArray.isEmpty())
+    {
+        return Ephemeris::Undefined();
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Chebyshev");
+    }
+
+    MatrixXd positions(anInstantArray.getSize(), 3);
+    MatrixXd velocities(anInstantArray.getSize(), 3);
+
+    Index segmentIndex = 0;
+
+    Vector3d position;
+    Vector3d velocity;
+
+    for (Index i = 0; i < anInstantArray.getSize(); ++i)
+    {
+        this->evaluateAt(anInstantArray[i], segmentIndex, position, velocity);
+
+        positions.row(i) = position.transpose();
+        velocities.row(i) = velocity.transpose();
+    }
+
+    return {anInstantArray, positions, velocities, frameSPtr_};
+}
+
+void Chebyshev::print(std::ostream& anOutputStream, bool displayDecorator) const
+{
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Chebyshev") : void();
+
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Start instant:" << (this->isDefined() ? this->getInterval().accessStart().toString() : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "End instant:" << (this->isDefined() ? this->getInterval().accessEnd().toString() : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Frame:" << (this->isDefined() ? frameSPtr_->getName() : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Degree:" << (this->isDefined() ? String::Format("{}", this->getDegree()) : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream) << "Segment count:" << segments_.getSize();
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+Chebyshev Chebyshev::Undefined()
+{
+    return {Array<Segment>::Empty(), nullptr};
+}
+
+Chebyshev Chebyshev::Fit(
+    const Propagator& aPropagator,
+    const State& aState,
+    const Interval& anInterval,
+    const Length& aPositionTolerance,
+    const Size& aDegree,
+    const Duration& aMaximumSegmentDuration
+)
+{
+    if (!aPropagator.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagator");
+    }
+
+    if (!aState.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State");
+    }
+
+    if (!anInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    if (!anInterval.getDuration().isStrictlyPositive())
+    {
+        throw ostk::core::error::runtime::Wrong("Interval");
+    }
+
+    if ((!aPositionTolerance.isDefined()) || (aPositionTolerance.inMeters() <= 0.0))
+    {
+        throw ostk::core::error::runtime::Wrong("Position tolerance");
+    }
+
+    if ((aDegree < MinimumDegree) || (aDegree > MaximumDegree))
+    {
+        throw ostk::core::error::runtime::Wrong("Degree");
+    }
+
+    if ((!aMaximumSegmentDuration.isDefined()) || (!aMaximumSegmentDuration.isStrictlyPositive()))
+    {
+        throw ostk::core::error::runtime::Wrong("Maximum segment duration");
+    }
+
+    const Instant& endInstant = anInterval.accessEnd();
+    const double positionTolerance_m = aPositionTolerance.inMeters();
+    const double maximumSegmentDuration_s = aMaximumSegmentDuration.inSeconds();
+    const Size nodeCount = aDegree + 1;
+
+    // Samples of a segment, in increasing time: the nodes, the midpoints in between (to check the fit), and the end of
+    // the segment. Node samples hold the node index, other samples hold the node count.
+
+    Array<double> sampleTimes = Array<double>::Empty();
+    Array<Index> sampleNodeIndices = Array<Index>::Empty();
+
+    for (Index k = nodeCount; k-- > 0;)
+    {
+        sampleTimes.add(NodeTime(k, nodeCount));
+        sampleNodeIndices.add(k);
+
+        if (k > 0)
+        {
+            sampleTimes.add(0.5 * (NodeTime(k, nodeCount) + NodeTime(k - 1, nodeCount)));
+            sampleNodeIndices.add(nodeCount);
+        }
+    }
+
+    sampleTimes.add(1.0);
+    sampleNodeIndices.add(nodeCount);
+
+    State segmentStartState = (aState.accessInstant() == anInterval.accessStart())
+                                ? aState
+                                : aPropagator.calculateStateAt(aState, anInterval.accessStart());
+
+    double segmentDuration_s = std::min<double>(maximumSegmentDuration_s, anInterval.getDuration().inSeconds());
+
+    Array<Segment> segments = Array<Segment>::Empty();
+
+    while (segmentStartState.accessInstant() < endInstant)
+    {
+        const Instant segmentStartInstant = segmentStartState.accessInstant();
+        const double remainingDuration_s = (endInstant - segmentStartInstant).inSeconds();
+
+        // The last segment absorbs a remainder shorter than a quarter of a segment
+
+        const bool isLastSegment = remainingDuration_s <= (1.25 * segmentDuration_s);
+        const double duration_s = isLastSegment ? remainingDuration_s : segmentDuration_s;
+
+        Array<Instant> sampleInstants = Array<Instant>::Empty();
+        sampleInstants.reserve(sampleTimes.getSize());
+
+        for (Index i = 0; i < sampleTimes.getSize(); ++i)
+        {
+            sampleInstants.add(
+                (isLastSegment && (i == sampleTimes.getSize() - 1))
+                    ? endInstant
+                    : segmentStartInstant + Duration::Seconds(0.5 * (sampleTimes[i] + 1.0) * duration_s)
+            );
+        }
+
+        const Array<State> sampleStates = aPropagator.calculateStatesAt(segmentStartState, sampleInstants);
+
+        MatrixXd nodePositions(3, nodeCount);
+        MatrixXd nodeVelocities(3, nodeCount);
+
+        for (Index i = 0; i < sampleStates.getSize(); ++i)
+        {
+            if (sampleNodeIndices[i] < nodeCount)
+            {
+                nodePositions.col(sampleNodeIndices[i]) = sampleStates[i].getPosition().getCoordinates();
+                nodeVelocities.col(sampleNodeIndices[i]) = sampleStates[i].getVelocity().getCoordinates();
+            }
+        }
+
+        const MatrixXd positionCoefficients = FitCoefficients(nodePositions);
+
+        // The fit is checked at the start, in between the nodes and at the end of the segment
+
+        double positionError_m =
+            (EvaluateSeries(positionCoefficients, -1.0) - segmentStartState.getPosition().getCoordinates()).norm();
+
+        for (Index i = 0; i < sampleStates.getSize(); ++i)
+        {
+            if (sampleNodeIndices[i] == nodeCount)
+            {
+                positionError_m = std::max(
+                    positionError_m,
+                    (EvaluateSeries(positionCoefficients, sampleTimes[i]) -
+                     sampleStates[i].getPosition().getCoordinates())
+                        .norm()
+                );
+            }
+        }
+
+        if (positionError_m > positionTolerance_m)
+        {
+            segmentDuration_s = 0.5 * duration_s;
+
+            if (segmentDuration_s < MinimumSegmentDuration_s)
+            {
+                throw ostk::core::error::RuntimeError(
+                    "Cannot fit a segment starting at [{}] within the position tolerance [{}].",
+                    segmentStartInstant.toString(),
+                    aPositionTolerance.toString()
+                );
+            }
+
+            continue;
+        }
+
+        const State& segmentEndState = sampleStates.accessLast();
+
+        segments.add({
+            segmentStartInstant,
+            segmentEndState.accessInstant() - segmentStartInstant,
+            positionCoefficients,
+            FitCoefficients(nodeVelocities),
+        });
+
+        segmentStartState = segmentEndState;
+
+        if (positionError_m < (0.1 * positionTolerance_m))
+        {
+            segmentDuration_s = std::min(maximumSegmentDuration_s, 1.5 * duration_s);
+        }
+        else
+        {
+            segmentDuration_s = duration_s;
+        }
+    }
+
+    return {segments, aState.accessFrame()};
+}
+
+bool Chebyshev::operator==(const Model& aModel) const
+{
+    const Chebyshev* chebyshevModelPtr = dynamic_cast<const Chebyshev*>(&aModel);
+
+    return (chebyshevModelPtr != nullptr) && this->operator==(*chebyshevModelPtr);
+}
+
+bool Chebyshev::operator!=(const Model& aModel) const
+{
+    return !((*this) == aModel);
+}
+
+Index Chebyshev::locateSegment(const double& aTime, const Index& aSegmentIndexHint) const
+{
+    const Index segmentCount = segmentStartTimes_.size();
+
+    // Sorted instants mostly fall within the segment of the previous instant, or within the next one
+
+    for (Index segmentIndex = aSegmentIndexHint; segmentIndex < std::min(aSegmentIndexHint + 2, segmentCount);
+         ++segmentIndex)
+    {
+        if ((segmentStartTimes_[segmentIndex] <= aTime) &&
+            ((segmentIndex + 1 == segmentCount) || (aTime < segmentStartTimes_[segmentIndex + 1])))
+        {
+            return segmentIndex;
+        }
+    }
+
+    const Index index =
+        std::upper_bound(segmentStartTimes_.begin(), segmentStartTimes_.end(), aTime) - segmentStartTimes_.begin();
+
+    return std::max<Index>(index, 1) - 1;
+}
+
+void Chebyshev::evaluateAt(
+    const Instant& anInstant, Index& aSegmentIndexHint, Vector3d& aPosition, Vector3d& aVelocity
+) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    const Instant& startInstant = segments_.accessFirst().startInstant;
+
+    if ((anInstant < startInstant) ||
+        (anInstant > (segments_.accessLast().startInstant + segments_.accessLast().duration)))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Instant [{}] is outside of the model interval [{}].",
+            anInstant.toString(),
+            this->getInterval().toString()
+        );
+    }
+
+    const double time_s = (anInstant - startInstant).inSeconds();
+
+    aSegmentIndexHint = this->locateSegment(time_s, aSegmentIndexHint);
+
+    const Segment& segment = segments_[aSegmentIndexHint];
+
+    const double normalizedTime = std::clamp(
+        2.0 * (time_s - segmentStartTimes_[aSegmentIndexHint]) / segmentDurations_[aSegmentIndexHint] - 1.0, -1.0, 1.0
+    );
+
+    aPosition = EvaluateSeries(segment.positionCoefficients, normalizedTime);
+    aVelocity = EvaluateSeries(segment.velocityCoefficients, normalizedTime);
+}
+
+}  // namespace model
+}  // namespace trajectory
+}  // namespace astrodynamics
+}  // namespace ostk
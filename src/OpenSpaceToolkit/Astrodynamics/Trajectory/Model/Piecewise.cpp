@@ -0,0 +1,278 @@
+/// Apache License 2.0
+
+#include <algorithm>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Model/Piecewise.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/SGP4.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace trajectory
+{
+namespace model
+{
+
+using ostk::physics::time::Duration;
+
+using ostk::astrodynamics::trajectory::orbit::model::SGP4;
+
+Piecewise::Piecewise(const Array<Trajectory>& aTrajectoryArray, const Array<Instant>& aSwitchInstantArray)
+    : Model(),
+      trajectories_(aTrajectoryArray),
+      switchInstants_(aSwitchInstantArray)
+{
+    if (trajectories_.isEmpty())
+    {
+        return;
+    }
+
+    if (switchInstants_.getSize() != (trajectories_.getSize() - 1))
+    {
+        throw ostk::core::error::runtime::Wrong("Switch instant count");
+    }
+
+    for (const Trajectory& trajectory : trajectories_)
+    {
+        if (!trajectory.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Trajectory");
+        }
+    }
+
+    for (Index switchIndex = 0; switchIndex < switchInstants_.getSize(); ++switchIndex)
+    {
+        if (!switchInstants_[switchIndex].isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Switch instant");
+        }
+
+        if ((switchIndex > 0) && (switchInstants_[switchIndex] <= switchInstants_[switchIndex - 1]))
+        {
+            throw ostk::core::error::RuntimeError("Switch instants must be strictly increasing.");
+        }
+    }
+}
+
+Piecewise* Piecewise::clone() const
+{
+    return new Piecewise(*this);
+}
+
+bool Piecewise::operator==(const Piecewise& aPiecewiseModel) const
+{
+    if ((!this->isDefined()) || (!aPiecewiseModel.isDefined()))
+    {
+        return false;
+    }
+
+    return (trajectories_ == aPiecewiseModel.trajectories_) && (switchInstants_ == aPiecewiseModel.switchInstants_);
+}
+
+bool Piecewise::operator!=(const Piecewise& aPiecewiseModel) const
+{
+    return !((*this) == aPiecewiseModel);
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const Piecewise& aPiecewiseModel)
+{
+    aPiecewiseModel.print(anOutputStream);
+
+    return anOutputStream;
+}
+
+bool Piecewise::isDefined() const
+{
+    return !trajectories_.isEmpty();
+}
+
+Size Piecewise::getPieceCount() const
+{
+    return trajectories_.getSize();
+}
+
+const Array<Trajectory>& Piecewise::accessTrajectories() const
+{
+    return trajectories_;
+}
+
+const Array<Instant>& Piecewise::accessSwitchInstants() const
+{
+    return switchInstants_;
+}
+
+Index Piecewise::getPieceIndexAt(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Piecewise");
+    }
+
+    const auto switchInstantIt = std::upper_bound(switchInstants_.begin(), switchInstants_.end(), anInstant);
+
+    return static_cast<Index>(std::distance(switchInstants_.begin(), switchInstantIt));
+}
+
+const Trajectory& Piecewise::accessTrajectoryAt(const Instant& anInstant) const
+{
+    return trajectories_[this->getPieceIndexAt(anInstant)];
+}
+
+Array<Instant> Piecewise::getSwitchInstantsWithin(const Interval& anInterval) const
+{
+    if (!anInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Piecewise");
+    }
+
+    Array<Instant> switchInstants = Array<Instant>::Empty();
+
+    for (const Instant& switchInstant : switchInstants_)
+    {
+        if ((switchInstant > anInterval.accessStart()) && (switchInstant < anInterval.accessEnd()))
+        {
+            switchInstants.add(switchInstant);
+        }
+    }
+
+    return switchInstants;
+}
+
+State Piecewise::calculateStateAt(const Instant& anInstant) const
+{
+    return this->accessTrajectoryAt(anInstant).getStateAt(anInstant);
+}
+
+Array<State> Piecewise::calculateStatesAt(const Array<Instant>& anInstantArray) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Piecewise");
+    }
+
+    Array<State> states = Array<State>::Empty();
+    states.reserve(anInstantArray.getSize());
+
+    Index runStartIndex = 0;
+
+    while (runStartIndex < anInstantArray.getSize())
+    {
+        const Index pieceIndex = this->getPieceIndexAt(anInstantArray[runStartIndex]);
+
+        Index runEndIndex = runStartIndex + 1;
+
+        while ((runEndIndex < anInstantArray.getSize()) &&
+               (this->getPieceIndexAt(anInstantArray[runEndIndex]) == pieceIndex))
+        {
+            ++runEndIndex;
+        }
+
+        const Array<Instant> runInstants = {
+            anInstantArray.begin() + runStartIndex, anInstantArray.begin() + runEndIndex
+        };
+
+        for (const State& state : trajectories_[pieceIndex].getStatesAt(runInstants))
+        {
+            states.add(state);
+        }
+
+        runStartIndex = runEndIndex;
+    }
+
+    return states;
+}
+
+void Piecewise::print(std::ostream& anOutputStream, bool displayDecorator) const
+{
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Piecewise") : void();
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Piece count:" << trajectories_.getSize();
+
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "First switch instant:"
+        << (switchInstants_.isEmpty() ? "Undefined" : switchInstants_.accessFirst().toString());
+
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Last switch instant:"
+        << (switchInstants_.isEmpty() ? "Undefined" : switchInstants_.accessLast().toString());
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+Piecewise Piecewise::TLEs(const Array<TLE>& aTleArray)
+{
+    if (aTleArray.isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("TLEs");
+    }
+
+    Array<TLE> tles = aTleArray;
+
+    std::sort(
+        tles.begin(),
+        tles.end(),
+        [](const TLE& aTle, const TLE& anotherTle) -> bool
+        {
+            return aTle.getEpoch() < anotherTle.getEpoch();
+        }
+    );
+
+    Array<Trajectory> trajectories = Array<Trajectory>::Empty();
+    Array<Instant> switchInstants = Array<Instant>::Empty();
+
+    trajectories.reserve(tles.getSize());
+    switchInstants.reserve(tles.getSize() - 1);
+
+    for (Index tleIndex = 0; tleIndex < tles.getSize(); ++tleIndex)
+    {
+        if (tleIndex > 0)
+        {
+            const Instant previousEpoch = tles[tleIndex - 1].getEpoch();
+            const Instant epoch = tles[tleIndex].getEpoch();
+
+            if (epoch == previousEpoch)
+            {
+                throw ostk::core::error::RuntimeError("TLE epochs must be distinct.");
+            }
+
+            switchInstants.add(previousEpoch + (epoch - previousEpoch) / 2.0);
+        }
+
+        trajectories.add(Trajectory(SGP4(tles[tleIndex])));
+    }
+
+    return {trajectories, switchInstants};
+}
+
+bool Piecewise::operator==(const Model& aModel) const
+{
+    const Piecewise* piecewiseModelPtr = dynamic_cast<const Piecewise*>(&aModel);
+
+    return (piecewiseModelPtr != nullptr) && this->operator==(*piecewiseModelPtr);
+}
+
+bool Piecewise::operator!=(const Model& aModel) const
+{
+    return !((*this) == aModel);
+}
+
+}  // namespace model
+}  // namespace trajectory
+}  // namespace astrodynamics
+}  // namespace ostk
@@ -52,6 +52,16 @@ bool Static::isDefined() const
     return position_.isDefined();
 }
 
+const Position& Static::accessPosition() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Static");
+    }
+
+    return position_;
+}
+
 State Static::calculateStateAt(const Instant& anInstant) const
 {
     using ostk::physics::coordinate::Position;
@@ -69,6 +79,31 @@ State Static::calculateStateAt(const Instant& anInstant) const
     return State(anInstant, position_, Velocity::MetersPerSecond({0.0, 0.0, 0.0}, position_.accessFrame()));
 }
 
+Array<State> Static::calculateStatesAt(const Array<Instant>& anInstantArray) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Static");
+    }
+
+    const Velocity velocity = Velocity::MetersPerSecond({0.0, 0.0, 0.0}, position_.accessFrame());
+
+    Array<State> stateArray = Array<State>::Empty();
+    stateArray.reserve(anInstantArray.getSize());
+
+    for (const Instant& instant : anInstantArray)
+    {
+        if (!instant.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Instant");
+        }
+
+        stateArray.add(State(instant, position_, velocity));
+    }
+
+    return stateArray;
+}
+
 void Static::print(std::ostream& anOutputStream, bool displayDecorator) const
 {
     using ostk::core::type::String;
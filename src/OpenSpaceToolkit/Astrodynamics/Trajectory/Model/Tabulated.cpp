@@ -1,10 +1,26 @@
 /// Apache License 2.0
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Model/Tabulated.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateBroker.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianPosition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianVelocity.hpp>
 
 namespace ostk
 {
@@ -15,8 +31,132 @@ namespace trajectory
 namespace model
 {
 
+namespace
+{
+
+using ostk::core::type::String;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Velocity;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+
+// Ephemeris file layout: a fixed size header, the timestamps column, then the coordinates, row by row
+
+static constexpr char EphemerisMagic[8] = {'O', 'S', 'T', 'K', 'E', 'P', 'H', '1'};
+static constexpr std::uint64_t EphemerisColumnCount = 6;
+
+struct EphemerisHeader
+{
+    char magic[8];
+    std::uint64_t rowCount;
+    std::uint64_t columnCount;
+    char epoch[40];  // UTC
+    char frame[64];
+};
+
+static constexpr std::size_t EphemerisHeaderSize = 128;
+
+static_assert(sizeof(EphemerisHeader) <= EphemerisHeaderSize, "Ephemeris header too large");
+
+// Read-only memory mapping of a file, unmapped on destruction
+
+class MappedFile
+{
+   public:
+    MappedFile(const String& aPath)
+    {
+        const int fileDescriptor = ::open(aPath.data(), O_RDONLY);
+
+        if (fileDescriptor < 0)
+        {
+            throw ostk::core::error::RuntimeError(String::Format("Cannot open file [{}].", aPath));
+        }
+
+        struct stat fileStatus;
+
+        if (::fstat(fileDescriptor, &fileStatus) != 0)
+        {
+            ::close(fileDescriptor);
+
+            throw ostk::core::error::RuntimeError(String::Format("Cannot read file [{}].", aPath));
+        }
+
+        size_ = static_cast<std::size_t>(fileStatus.st_size);
+
+        void* address = (size_ > 0) ? ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fileDescriptor, 0) : nullptr;
+
+        ::close(fileDescriptor);
+
+        if (address == MAP_FAILED)
+        {
+            throw ostk::core::error::RuntimeError(String::Format("Cannot map file [{}].", aPath));
+        }
+
+        address_ = address;
+    }
+
+    MappedFile(const MappedFile&) = delete;
+
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile()
+    {
+        if (address_ != nullptr)
+        {
+            ::munmap(address_, size_);
+        }
+    }
+
+    const char* accessData() const
+    {
+        return static_cast<const char*>(address_);
+    }
+
+    std::size_t getSize() const
+    {
+        return size_;
+    }
+
+   private:
+    void* address_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+Shared<const Frame> FrameWithName(const String& aFrameName)
+{
+    if (aFrameName == "GCRF")
+    {
+        return Frame::GCRF();
+    }
+
+    if (aFrameName == "ITRF")
+    {
+        return Frame::ITRF();
+    }
+
+    if (aFrameName == "TEME")
+    {
+        return Frame::TEME();
+    }
+
+    if (Frame::Exists(aFrameName))
+    {
+        return Frame::WithName(aFrameName);
+    }
+
+    throw ostk::core::error::runtime::Wrong("Frame");
+}
+
+// Steps are not halved below this duration [s] when sampling
+static constexpr double MinimumSampleStepDuration_s = 1.0e-3;
+
+}  // namespace
+
 Tabulated::Tabulated(const Array<State>& aStateArray, const Interpolator::Type& anInterpolationType)
-    : Model()
+    : Model(),
+      interpolationType_(anInterpolationType)
 {
     if (aStateArray.getSize() < 2)
     {
@@ -37,21 +177,95 @@ Tabulated::Tabulated(const Array<State>& aStateArray, const Interpolator::Type&
     firstState_ = aStateArray.accessFirst();
     lastState_ = aStateArray.accessLast();
 
-    VectorXd timestamps(stateArray.getSize());
-    MatrixXd coordinates(stateArray.getSize(), firstState_.getSize());
+    const Shared<VectorXd> timestampsSPtr = std::make_shared<VectorXd>(stateArray.getSize());
+    const Shared<RowMajorMatrixXd> coordinatesSPtr =
+        std::make_shared<RowMajorMatrixXd>(stateArray.getSize(), firstState_.getSize());
 
     for (Index i = 0; i < stateArray.getSize(); ++i)
     {
-        timestamps(i) = (stateArray[i].accessInstant() - firstState_.accessInstant()).inSeconds();
+        (*timestampsSPtr)(i) = (stateArray[i].accessInstant() - firstState_.accessInstant()).inSeconds();
 
-        coordinates.row(i) = stateArray[i].accessCoordinates();
+        coordinatesSPtr->row(i) = stateArray[i].accessCoordinates();
     }
 
-    interpolators_.reserve(coordinates.cols());
+    table_ = {
+        firstState_.accessInstant(),
+        stateArray.getSize(),
+        firstState_.getSize(),
+        timestampsSPtr->data(),
+        coordinatesSPtr->data(),
+        timestampsSPtr,
+        coordinatesSPtr,
+    };
 
-    for (Index i = 0; i < Size(coordinates.cols()); ++i)
+    if (anInterpolationType != Interpolator::Type::Linear)
     {
-        interpolators_.add(Interpolator::GenerateInterpolator(anInterpolationType, timestamps, coordinates.col(i)));
+        this->generateInterpolators();
+    }
+}
+
+Tabulated::Tabulated(
+    const Instant& anEpoch,
+    const VectorXd& aTimestampVector,
+    const MatrixXd& aCoordinateMatrix,
+    const Shared<const Frame>& aFrameSPtr,
+    const Shared<const CoordinateBroker>& aCoordinateBrokerSPtr,
+    const Interpolator::Type& anInterpolationType
+)
+    : Model(),
+      interpolationType_(anInterpolationType)
+{
+    const Shared<const VectorXd> timestampsSPtr = std::make_shared<const VectorXd>(aTimestampVector);
+    const Shared<const RowMajorMatrixXd> coordinatesSPtr = std::make_shared<const RowMajorMatrixXd>(aCoordinateMatrix);
+
+    this->setTable(
+        anEpoch,
+        Eigen::Map<const VectorXd>(timestampsSPtr->data(), timestampsSPtr->size()),
+        Eigen::Map<const RowMajorMatrixXd>(coordinatesSPtr->data(), coordinatesSPtr->rows(), coordinatesSPtr->cols()),
+        aFrameSPtr,
+        aCoordinateBrokerSPtr,
+        timestampsSPtr,
+        coordinatesSPtr
+    );
+}
+
+Tabulated::Tabulated(
+    const Instant& anEpoch,
+    const Eigen::Map<const VectorXd>& aTimestampVector,
+    const Eigen::Map<const RowMajorMatrixXd>& aCoordinateMatrix,
+    const Shared<const Frame>& aFrameSPtr,
+    const Shared<const CoordinateBroker>& aCoordinateBrokerSPtr,
+    const Interpolator::Type& anInterpolationType,
+    const Shared<const void>& aStorageSPtr
+)
+    : Model(),
+      interpolationType_(anInterpolationType)
+{
+    if (aStorageSPtr == nullptr)
+    {
+        throw ostk::core::error::runtime::Undefined("Storage");
+    }
+
+    this->setTable(
+        anEpoch, aTimestampVector, aCoordinateMatrix, aFrameSPtr, aCoordinateBrokerSPtr, aStorageSPtr, aStorageSPtr
+    );
+}
+
+Tabulated::Tabulated(
+    const State& aFirstState,
+    const State& aLastState,
+    const Tabulated::Table& aTable,
+    const Interpolator::Type& anInterpolationType
+)
+    : Model(),
+      firstState_(aFirstState),
+      lastState_(aLastState),
+      interpolationType_(anInterpolationType),
+      table_(aTable)
+{
+    if (anInterpolationType != Interpolator::Type::Linear)
+    {
+        this->generateInterpolators();
     }
 }
 
@@ -85,7 +299,7 @@ std::ostream& operator<<(std::ostream& anOutputStream, const Tabulated& aTabulat
 
 bool Tabulated::isDefined() const
 {
-    return !interpolators_.isEmpty() && firstState_.isDefined() && lastState_.isDefined();
+    return (table_.rowCount > 1) && firstState_.isDefined() && lastState_.isDefined();
 }
 
 Interval Tabulated::getInterval() const
@@ -105,8 +319,7 @@ Interpolator::Type Tabulated::getInterpolationType() const
         throw ostk::core::error::runtime::Undefined("Tabulated");
     }
 
-    // Since all interpolators are of the same type, we can just return the type of the first one.
-    return interpolators_[0]->getInterpolationType();
+    return interpolationType_;
 }
 
 State Tabulated::getFirstState() const
@@ -119,44 +332,51 @@ State Tabulated::getLastState() const
     return lastState_;
 }
 
-State Tabulated::calculateStateAt(const Instant& anInstant) const
+Instant Tabulated::getTableEpoch() const
 {
-    using ostk::core::type::Index;
-    using ostk::core::type::String;
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Tabulated");
+    }
 
-    using ostk::astrodynamics::trajectory::state::CoordinateBroker;
+    return table_.epoch;
+}
 
-    if (!anInstant.isDefined())
+Eigen::Map<const VectorXd> Tabulated::accessTimestamps() const
+{
+    if (!this->isDefined())
     {
-        throw ostk::core::error::runtime::Undefined("Instant");
+        throw ostk::core::error::runtime::Undefined("Tabulated");
     }
 
+    return {table_.timestamps, Eigen::Index(table_.rowCount)};
+}
+
+Eigen::Map<const Tabulated::RowMajorMatrixXd> Tabulated::accessCoordinates() const
+{
     if (!this->isDefined())
     {
         throw ostk::core::error::runtime::Undefined("Tabulated");
     }
 
-    if (anInstant < firstState_.accessInstant() || anInstant > lastState_.accessInstant())
+    return {table_.coordinates, Eigen::Index(table_.rowCount), Eigen::Index(table_.columnCount)};
+}
+
+State Tabulated::calculateStateAt(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
     {
-        throw ostk::core::error::RuntimeError(String::Format(
-            "Provided instant [{}] is outside of interpolation range [{}, {}].",
-            anInstant.toString(),
-            firstState_.accessInstant().toString(),
-            lastState_.accessInstant().toString()
-        ));
+        throw ostk::core::error::runtime::Undefined("Instant");
     }
 
-    VectorXd interpolatedCoordinates(interpolators_.getSize());
-
-    for (Index i = 0; i < interpolators_.getSize(); ++i)
+    if (!this->isDefined())
     {
-        interpolatedCoordinates(i) = interpolators_[i]->evaluate((anInstant - firstState_.accessInstant()).inSeconds());
+        throw ostk::core::error::runtime::Undefined("Tabulated");
     }
 
-    const Shared<const Frame>& frame = firstState_.accessFrame();
-    const Shared<const CoordinateBroker>& coordinatesBroker = firstState_.accessCoordinateBroker();
+    Index intervalIndex = 0;
 
-    return State(anInstant, interpolatedCoordinates, frame, coordinatesBroker);
+    return this->interpolateStateAt(anInstant, intervalIndex);
 }
 
 Array<State> Tabulated::calculateStatesAt(const Array<Instant>& anInstantArray) const
@@ -175,14 +395,94 @@ Array<State> Tabulated::calculateStatesAt(const Array<Instant>& anInstantArray)
 
     Array<State> stateArray = Array<State>(anInstantArray.getSize(), State::Undefined());
 
+    // The interval found for an instant seeds the search for the next one, so sorted instants walk the table
+    Index intervalIndex = 0;
+
     for (Index i = 0; i < anInstantArray.getSize(); ++i)
     {
-        stateArray[i] = this->calculateStateAt(anInstantArray[i]);
+        if (!anInstantArray[i].isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Instant");
+        }
+
+        stateArray[i] = this->interpolateStateAt(anInstantArray[i], intervalIndex);
     }
 
     return stateArray;
 }
 
+Ephemeris Tabulated::calculateEphemerisAt(const Array<Instant>& anInstantArray) const
+{
+    using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianPosition;
+    using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianVelocity;
+
+    if (anInstantArray.isEmpty())
+    {
+        return Ephemeris::Undefined();
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Tabulated");
+    }
+
+    const Index positionIndex = firstState_.accessCoordinateBroker()->getSubsetIndex(CartesianPosition::Default());
+    const Index velocityIndex = firstState_.accessCoordinateBroker()->getSubsetIndex(CartesianVelocity::Default());
+
+    MatrixXd positions(anInstantArray.getSize(), 3);
+    MatrixXd velocities(anInstantArray.getSize(), 3);
+
+    Index intervalIndex = 0;
+
+    for (Index i = 0; i < anInstantArray.getSize(); ++i)
+    {
+        if (!anInstantArray[i].isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Instant");
+        }
+
+        const VectorXd coordinates = this->interpolateCoordinatesAt(anInstantArray[i], intervalIndex);
+
+        positions.row(i) = coordinates.segment<3>(positionIndex).transpose();
+        velocities.row(i) = coordinates.segment<3>(velocityIndex).transpose();
+    }
+
+    return {anInstantArray, positions, velocities, firstState_.accessFrame()};
+}
+
+StateTable Tabulated::calculateStateTableAt(const Array<Instant>& anInstantArray) const
+{
+    if (anInstantArray.isEmpty())
+    {
+        return StateTable::Undefined();
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Tabulated");
+    }
+
+    const Instant& epoch = anInstantArray.accessFirst();
+
+    StateTable::OffsetVector offsets(anInstantArray.getSize());
+    MatrixXd coordinates(anInstantArray.getSize(), firstState_.getSize());
+
+    Index intervalIndex = 0;
+
+    for (Index i = 0; i < anInstantArray.getSize(); ++i)
+    {
+        if (!anInstantArray[i].isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Instant");
+        }
+
+        offsets(i) = std::llround(double(Duration::Between(epoch, anInstantArray[i]).inNanoseconds()));
+        coordinates.row(i) = this->interpolateCoordinatesAt(anInstantArray[i], intervalIndex).transpose();
+    }
+
+    return {epoch, offsets, coordinates, firstState_.accessFrame(), firstState_.accessCoordinateBroker()};
+}
+
 void Tabulated::print(std::ostream& anOutputStream, bool displayDecorator) const
 {
     using ostk::core::type::String;
@@ -229,6 +529,312 @@ void Tabulated::print(std::ostream& anOutputStream, bool displayDecorator) const
     displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
 }
 
+Tabulated Tabulated::LoadEphemeris(const File& aFile, const Interpolator::Type& anInterpolationType)
+{
+    if (!aFile.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("File");
+    }
+
+    if (!aFile.exists())
+    {
+        throw ostk::core::error::RuntimeError(String::Format("File [{}] does not exist.", aFile.toString()));
+    }
+
+    const Shared<const MappedFile> mappedFileSPtr = std::make_shared<const MappedFile>(aFile.getPath().toString());
+
+    if (mappedFileSPtr->getSize() < EphemerisHeaderSize)
+    {
+        throw ostk::core::error::runtime::Wrong("Ephemeris file");
+    }
+
+    EphemerisHeader header;
+    std::memcpy(&header, mappedFileSPtr->accessData(), sizeof(EphemerisHeader));
+
+    if ((std::memcmp(header.magic, EphemerisMagic, sizeof(EphemerisMagic)) != 0) ||
+        (header.columnCount != EphemerisColumnCount) || (header.rowCount < 2) ||
+        (mappedFileSPtr->getSize() !=
+         EphemerisHeaderSize + header.rowCount * (1 + header.columnCount) * sizeof(double)))
+    {
+        throw ostk::core::error::runtime::Wrong("Ephemeris file");
+    }
+
+    header.epoch[sizeof(header.epoch) - 1] = '\0';
+    header.frame[sizeof(header.frame) - 1] = '\0';
+
+    const Instant epoch = Instant::DateTime(DateTime::Parse(String(header.epoch)), Scale::UTC);
+    const Shared<const Frame> frameSPtr = FrameWithName(String(header.frame));
+
+    // Mapped pages are page aligned, and the header size keeps the columns aligned on doubles
+
+    const Size rowCount = header.rowCount;
+    const Size columnCount = header.columnCount;
+
+    const double* timestamps = reinterpret_cast<const double*>(mappedFileSPtr->accessData() + EphemerisHeaderSize);
+    const double* coordinates = timestamps + rowCount;
+
+    if ((timestamps[0] != 0.0) || (!(timestamps[rowCount - 1] > 0.0)))
+    {
+        throw ostk::core::error::runtime::Wrong("Ephemeris file");
+    }
+
+    const auto stateAtRow = [&](const Index& aRowIndex) -> State
+    {
+        const double* row = coordinates + aRowIndex * columnCount;
+
+        return {
+            epoch + Duration::Seconds(timestamps[aRowIndex]),
+            Position::Meters({row[0], row[1], row[2]}, frameSPtr),
+            Velocity::MetersPerSecond({row[3], row[4], row[5]}, frameSPtr),
+        };
+    };
+
+    const Tabulated::Table table = {
+        epoch,
+        rowCount,
+        columnCount,
+        timestamps,
+        coordinates,
+        mappedFileSPtr,
+        mappedFileSPtr,
+    };
+
+    return {stateAtRow(0), stateAtRow(rowCount - 1), table, anInterpolationType};
+}
+
+void Tabulated::SaveEphemeris(const Array<State>& aStateArray, const File& aFile)
+{
+    if (!aFile.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("File");
+    }
+
+    if (aStateArray.getSize() < 2)
+    {
+        throw ostk::core::error::runtime::Wrong("State array");
+    }
+
+    Array<State> stateArray = aStateArray;
+
+    std::sort(
+        stateArray.begin(),
+        stateArray.end(),
+        [](const auto& lhs, const auto& rhs)
+        {
+            return lhs.getInstant() < rhs.getInstant();
+        }
+    );
+
+    const Instant& epoch = stateArray.accessFirst().accessInstant();
+    const Shared<const Frame>& frameSPtr = stateArray.accessFirst().accessFrame();
+
+    const String epochString = epoch.getDateTime(Scale::UTC).toString();
+    const String frameName = frameSPtr->getName();
+
+    EphemerisHeader header = {};
+
+    if ((epochString.getLength() >= sizeof(header.epoch)) || (frameName.getLength() >= sizeof(header.frame)))
+    {
+        throw ostk::core::error::runtime::Wrong("Ephemeris header");
+    }
+
+    std::memcpy(header.magic, EphemerisMagic, sizeof(EphemerisMagic));
+    header.rowCount = stateArray.getSize();
+    header.columnCount = EphemerisColumnCount;
+    std::memcpy(header.epoch, epochString.data(), epochString.getLength());
+    std::memcpy(header.frame, frameName.data(), frameName.getLength());
+
+    VectorXd timestamps(stateArray.getSize());
+    RowMajorMatrixXd coordinates(stateArray.getSize(), EphemerisColumnCount);
+
+    for (Index i = 0; i < stateArray.getSize(); ++i)
+    {
+        const State state = stateArray[i].inFrame(frameSPtr);
+
+        timestamps(i) = (state.accessInstant() - epoch).inSeconds();
+
+        coordinates.row(i).head<3>() = state.getPosition().getCoordinates().transpose();
+        coordinates.row(i).tail<3>() = state.getVelocity().getCoordinates().transpose();
+    }
+
+    std::ofstream stream(aFile.getPath().toString(), std::ios::binary | std::ios::trunc);
+
+    char headerBuffer[EphemerisHeaderSize] = {};
+    std::memcpy(headerBuffer, &header, sizeof(EphemerisHeader));
+
+    stream.write(headerBuffer, EphemerisHeaderSize);
+    stream.write(reinterpret_cast<const char*>(timestamps.data()), timestamps.size() * sizeof(double));
+    stream.write(reinterpret_cast<const char*>(coordinates.data()), coordinates.size() * sizeof(double));
+
+    if (!stream)
+    {
+        throw ostk::core::error::RuntimeError(String::Format("Cannot write file [{}].", aFile.toString()));
+    }
+}
+
+Tabulated Tabulated::Sample(
+    const Propagator& aPropagator,
+    const State& aState,
+    const Interval& anInterval,
+    const Length& aPositionTolerance,
+    const Interpolator::Type& anInterpolationType,
+    const Duration& aMaximumStepDuration
+)
+{
+    if (!aPropagator.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagator");
+    }
+
+    if (!aState.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State");
+    }
+
+    if (!anInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    if (!anInterval.getDuration().isStrictlyPositive())
+    {
+        throw ostk::core::error::runtime::Wrong("Interval");
+    }
+
+    if ((!aPositionTolerance.isDefined()) || (aPositionTolerance.inMeters() <= 0.0))
+    {
+        throw ostk::core::error::runtime::Wrong("Position tolerance");
+    }
+
+    if ((!aMaximumStepDuration.isDefined()) || (!aMaximumStepDuration.isStrictlyPositive()))
+    {
+        throw ostk::core::error::runtime::Wrong("Maximum step duration");
+    }
+
+    const Instant& startInstant = anInterval.accessStart();
+    const Instant& endInstant = anInterval.accessEnd();
+    const double positionTolerance_m = aPositionTolerance.inMeters();
+
+    const State startState =
+        (aState.accessInstant() == startInstant) ? aState : aPropagator.calculateStateAt(aState, startInstant);
+
+    // Uniform grid of at most the maximum step duration (and of at least two steps, for the interpolators)
+
+    const Size stepCount = std::max<Size>(
+        2, Size(std::ceil(anInterval.getDuration().inSeconds() / aMaximumStepDuration.inSeconds()))
+    );
+
+    Array<Instant> gridInstants = Array<Instant>::Empty();
+    gridInstants.reserve(stepCount);
+
+    for (Index i = 1; i < stepCount; ++i)
+    {
+        gridInstants.add(startInstant + Duration::Seconds(anInterval.getDuration().inSeconds() * i / stepCount));
+    }
+
+    gridInstants.add(endInstant);
+
+    Array<State> states = {startState};
+    states.add(aPropagator.calculateStatesAt(startState, gridInstants));
+
+    // Linear interpolation only depends on the two samples bounding a step, so steps meeting the tolerance stay
+    // checked. Other interpolation types depend on neighbouring samples as well, so all the steps are checked again
+    // after each refinement.
+
+    const bool isInterpolationLocal = anInterpolationType == Interpolator::Type::Linear;
+
+    Array<bool> stepChecks(states.getSize() - 1, false);
+
+    while (true)
+    {
+        const Tabulated tabulated = {states, anInterpolationType};
+
+        Array<Index> stepIndices = Array<Index>::Empty();
+        Array<Instant> midInstants = Array<Instant>::Empty();
+
+        for (Index i = 0; i < stepChecks.getSize(); ++i)
+        {
+            if (!stepChecks[i])
+            {
+                const Instant& stepStartInstant = states[i].accessInstant();
+
+                stepIndices.add(i);
+                midInstants.add(stepStartInstant + (states[i + 1].accessInstant() - stepStartInstant) / 2.0);
+            }
+        }
+
+        if (midInstants.isEmpty())
+        {
+            return tabulated;
+        }
+
+        // Propagated and interpolated states in the middle of the steps to check, each in a single pass
+
+        const Array<State> propagatedMidStates = aPropagator.calculateStatesAt(startState, midInstants);
+        const Array<State> interpolatedMidStates = tabulated.calculateStatesAt(midInstants);
+
+        Array<State> refinedStates = Array<State>::Empty();
+        Array<bool> refinedStepChecks = Array<bool>::Empty();
+
+        refinedStates.reserve(states.getSize() + midInstants.getSize());
+        refinedStepChecks.reserve(stepChecks.getSize() + midInstants.getSize());
+
+        bool isRefined = false;
+        Index midStateIndex = 0;
+
+        for (Index i = 0; i < stepChecks.getSize(); ++i)
+        {
+            refinedStates.add(states[i]);
+
+            if (stepChecks[i])
+            {
+                refinedStepChecks.add(isInterpolationLocal);
+                continue;
+            }
+
+            const State& propagatedMidState = propagatedMidStates[midStateIndex];
+
+            const double positionError_m = (interpolatedMidStates[midStateIndex].getPosition().getCoordinates() -
+                                            propagatedMidState.getPosition().getCoordinates())
+                                               .norm();
+
+            ++midStateIndex;
+
+            if (positionError_m <= positionTolerance_m)
+            {
+                refinedStepChecks.add(isInterpolationLocal);
+                continue;
+            }
+
+            if ((states[i + 1].accessInstant() - states[i].accessInstant()).inSeconds() <
+                (2.0 * MinimumSampleStepDuration_s))
+            {
+                throw ostk::core::error::RuntimeError(
+                    "Cannot sample the step starting at [{}] within the position tolerance [{}].",
+                    states[i].accessInstant().toString(),
+                    aPositionTolerance.toString()
+                );
+            }
+
+            refinedStates.add(propagatedMidState);
+            refinedStepChecks.add(false);
+            refinedStepChecks.add(false);
+
+            isRefined = true;
+        }
+
+        refinedStates.add(states.accessLast());
+
+        if (!isRefined)
+        {
+            return tabulated;
+        }
+
+        states = refinedStates;
+        stepChecks = refinedStepChecks;
+    }
+}
+
 bool Tabulated::operator==(const Model& aModel) const
 {
     const Tabulated* tabulatedModelPtr = dynamic_cast<const Tabulated*>(&aModel);
@@ -241,6 +847,184 @@ bool Tabulated::operator!=(const Model& aModel) const
     return !((*this) == aModel);
 }
 
+void Tabulated::setTable(
+    const Instant& anEpoch,
+    const Eigen::Map<const VectorXd>& aTimestampVector,
+    const Eigen::Map<const RowMajorMatrixXd>& aCoordinateMatrix,
+    const Shared<const Frame>& aFrameSPtr,
+    const Shared<const CoordinateBroker>& aCoordinateBrokerSPtr,
+    const Shared<const void>& aTimestampsStorageSPtr,
+    const Shared<const void>& aCoordinatesStorageSPtr
+)
+{
+    if (!anEpoch.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Epoch");
+    }
+
+    if ((aFrameSPtr == nullptr) || (!aFrameSPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    if (aCoordinateBrokerSPtr == nullptr)
+    {
+        throw ostk::core::error::runtime::Undefined("Coordinate broker");
+    }
+
+    const Size rowCount = aTimestampVector.size();
+
+    if ((rowCount < 2) || (Size(aCoordinateMatrix.rows()) != rowCount) ||
+        (Size(aCoordinateMatrix.cols()) != aCoordinateBrokerSPtr->getNumberOfCoordinates()))
+    {
+        throw ostk::core::error::runtime::Wrong("Coordinates");
+    }
+
+    if ((!aTimestampVector.allFinite()) ||
+        (!std::is_sorted(aTimestampVector.data(), aTimestampVector.data() + rowCount)))
+    {
+        throw ostk::core::error::runtime::Wrong("Timestamps");
+    }
+
+    const auto stateAtRow = [&](const Index& aRowIndex) -> State
+    {
+        return {
+            anEpoch + Duration::Seconds(aTimestampVector(aRowIndex)),
+            VectorXd(aCoordinateMatrix.row(aRowIndex).transpose()),
+            aFrameSPtr,
+            aCoordinateBrokerSPtr,
+        };
+    };
+
+    firstState_ = stateAtRow(0);
+    lastState_ = stateAtRow(rowCount - 1);
+
+    table_ = {
+        anEpoch,
+        rowCount,
+        Size(aCoordinateMatrix.cols()),
+        aTimestampVector.data(),
+        aCoordinateMatrix.data(),
+        aTimestampsStorageSPtr,
+        aCoordinatesStorageSPtr,
+    };
+
+    if (interpolationType_ != Interpolator::Type::Linear)
+    {
+        this->generateInterpolators();
+    }
+}
+
+void Tabulated::generateInterpolators()
+{
+    const VectorXd timestamps = Eigen::Map<const VectorXd>(table_.timestamps, table_.rowCount);
+
+    interpolators_.reserve(table_.columnCount);
+
+    for (Index i = 0; i < table_.columnCount; ++i)
+    {
+        const VectorXd coordinates = Eigen::Map<const VectorXd, 0, Eigen::InnerStride<>>(
+            table_.coordinates + i, table_.rowCount, Eigen::InnerStride<>(table_.columnCount)
+        );
+
+        interpolators_.add(Interpolator::GenerateInterpolator(interpolationType_, timestamps, coordinates));
+    }
+}
+
+Index Tabulated::locateInterval(const double& aTimestamp, const Index& anIntervalIndexHint) const
+{
+    const Index timestampCount = table_.rowCount;
+    const Index lastIntervalIndex = timestampCount - 2;
+
+    const double* timestampsBegin = table_.timestamps;
+
+    Index lowerIndex = 0;
+    Index upperIndex = timestampCount;
+
+    if ((anIntervalIndexHint <= lastIntervalIndex) && (timestampsBegin[anIntervalIndexHint] <= aTimestamp))
+    {
+        // Gallop forward from the hint, to bound the search to a few samples for increasing timestamps
+
+        lowerIndex = anIntervalIndexHint;
+
+        Index step = 1;
+        Index probeIndex = lowerIndex + step;
+
+        while ((probeIndex < timestampCount) && (timestampsBegin[probeIndex] <= aTimestamp))
+        {
+            lowerIndex = probeIndex;
+            step *= 2;
+            probeIndex = lowerIndex + step;
+        }
+
+        upperIndex = std::min(probeIndex, timestampCount);
+    }
+
+    const Index index =
+        std::upper_bound(timestampsBegin + lowerIndex, timestampsBegin + upperIndex, aTimestamp) - timestampsBegin;
+
+    return std::min(std::max<Index>(index, 1) - 1, lastIntervalIndex);
+}
+
+VectorXd Tabulated::interpolateCoordinatesAt(const Instant& anInstant, Index& anIntervalIndexHint) const
+{
+    using ostk::core::type::String;
+
+    if (anInstant < firstState_.accessInstant() || anInstant > lastState_.accessInstant())
+    {
+        throw ostk::core::error::RuntimeError(String::Format(
+            "Provided instant [{}] is outside of interpolation range [{}, {}].",
+            anInstant.toString(),
+            firstState_.accessInstant().toString(),
+            lastState_.accessInstant().toString()
+        ));
+    }
+
+    const double timestamp = (anInstant - table_.epoch).inSeconds();
+
+    VectorXd interpolatedCoordinates;
+
+    if (interpolationType_ == Interpolator::Type::Linear)
+    {
+        anIntervalIndexHint = this->locateInterval(timestamp, anIntervalIndexHint);
+
+        const Index& i = anIntervalIndexHint;
+
+        const double intervalDuration = table_.timestamps[i + 1] - table_.timestamps[i];
+        const double ratio = (intervalDuration > 0.0) ? ((timestamp - table_.timestamps[i]) / intervalDuration) : 0.0;
+
+        const Eigen::Map<const VectorXd> lowerRow(table_.coordinates + i * table_.columnCount, table_.columnCount);
+        const Eigen::Map<const VectorXd> upperRow(
+            table_.coordinates + (i + 1) * table_.columnCount, table_.columnCount
+        );
+
+        interpolatedCoordinates = lowerRow + ratio * (upperRow - lowerRow);
+    }
+    else
+    {
+        interpolatedCoordinates.resize(interpolators_.getSize());
+
+        for (Index i = 0; i < interpolators_.getSize(); ++i)
+        {
+            interpolatedCoordinates(i) = interpolators_[i]->evaluate(timestamp);
+        }
+    }
+
+    return interpolatedCoordinates;
+}
+
+State Tabulated::interpolateStateAt(const Instant& anInstant, Index& anIntervalIndexHint) const
+{
+    using ostk::astrodynamics::trajectory::state::CoordinateBroker;
+
+    const VectorXd interpolatedCoordinates = this->interpolateCoordinatesAt(anInstant, anIntervalIndexHint);
+
+    const Shared<const Frame>& frame = firstState_.accessFrame();
+    const Shared<const CoordinateBroker>& coordinatesBroker = firstState_.accessCoordinateBroker();
+
+    return State(anInstant, interpolatedCoordinates, frame, coordinatesBroker);
+}
+
 }  // namespace model
 }  // namespace trajectory
 }  // namespace astrodynamics
@@ -1,5 +1,13 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <vector>
+
 #include <OpenSpaceToolkit/Core/Container/Tuple.hpp>
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
@@ -8,7 +16,6 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/RotationMatrix.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/RotationVector.hpp>
 
-#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Manager.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/Dynamic.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame/Utility.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Spherical/LLA.hpp>
@@ -55,6 +62,26 @@ using ostk::physics::unit::Mass;
 
 using ostk::astrodynamics::RootSolver;
 
+static const char PassSnapshotMagic[8] = {'O', 'S', 'T', 'K', 'P', 'S', 'S', '\0'};
+static const std::uint32_t PassSnapshotVersion = 1;
+static const std::uint32_t PassSnapshotByteOrderMark = 0x01020304;
+static const std::int64_t PassSnapshotUndefinedOffset = std::numeric_limits<std::int64_t>::min();
+
+struct PassSnapshotHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byteOrderMark;
+    std::uint64_t recordCount;
+    double epochOffset_ns;  // Model epoch, from J2000
+};
+
+struct PassSnapshotRecord
+{
+    std::int64_t revolutionNumber;
+    std::int64_t instantOffsets_ns[5];  // Ascending node, north point, descending node, south point and pass break
+};
+
 static const Derived::Unit GravitationalParameterSIUnit =
     Derived::Unit::GravitationalParameter(Length::Unit::Meter, ostk::physics::unit::Time::Unit::Second);
 
@@ -65,10 +92,27 @@ static const Real epsilon = 1e-6;
 
 static const RootSolver rootSolver = RootSolver::Default();
 
+// Orbital frames are constructed directly (rather than with `Frame::Construct`), as they are not registered in the
+// frame manager
+
+struct OrbitalFrameEnabler : public Frame
+{
+    OrbitalFrameEnabler(
+        const String& aName,
+        bool isQuasiInertial,
+        const Shared<const Frame>& aParentFrame,
+        const Shared<const ostk::physics::coordinate::frame::Provider>& aProvider
+    )
+        : Frame(aName, isQuasiInertial, aParentFrame, aProvider)
+    {
+    }
+};
+
 Orbit::Orbit(const orbit::Model& aModel, const Shared<const Celestial>& aCelestialObjectSPtr)
     : Trajectory(aModel),
       modelPtr_(dynamic_cast<const orbit::Model*>(&this->accessModel())),
-      celestialObjectSPtr_(aCelestialObjectSPtr)
+      celestialObjectSPtr_(aCelestialObjectSPtr),
+      cacheSPtr_(std::make_shared<Cache>())
 {
 }
 
@@ -79,42 +123,20 @@ Orbit::Orbit(
 )
     : Trajectory(orbit::model::Tabulated(aStateArray, anInitialRevolutionNumber)),
       modelPtr_(dynamic_cast<const orbit::Model*>(&this->accessModel())),
-      celestialObjectSPtr_(aCelestialObjectSPtr)
+      celestialObjectSPtr_(aCelestialObjectSPtr),
+      cacheSPtr_(std::make_shared<Cache>())
 {
 }
 
 Orbit::Orbit(const Orbit& anOrbit)
     : Trajectory(anOrbit),
       modelPtr_(dynamic_cast<const orbit::Model*>(&this->accessModel())),
-      celestialObjectSPtr_(anOrbit.celestialObjectSPtr_)
+      celestialObjectSPtr_(anOrbit.celestialObjectSPtr_),
+      cacheSPtr_(anOrbit.cacheSPtr_)
 {
 }
 
-Orbit::~Orbit()
-{
-    using FrameManager = ostk::physics::coordinate::frame::Manager;
-
-    static const Array<Orbit::FrameType> frameTypes = {
-        Orbit::FrameType::NED,
-        Orbit::FrameType::LVLH,
-        Orbit::FrameType::VVLH,
-        Orbit::FrameType::LVLHGD,
-        Orbit::FrameType::LVLHGDGT,
-        Orbit::FrameType::QSW,
-        Orbit::FrameType::TNW,
-        Orbit::FrameType::VNC
-    };
-
-    for (const auto& frameType : frameTypes)
-    {
-        const String frameName = this->generateFrameName(frameType);
-
-        if (FrameManager::Get().hasFrameWithName(frameName))
-        {
-            FrameManager::Get().removeFrameWithName(frameName);
-        }
-    }
-}
+Orbit::~Orbit() {}
 
 Orbit& Orbit::operator=(const Orbit& anOrbit)
 {
@@ -124,8 +146,7 @@ Orbit& Orbit::operator=(const Orbit& anOrbit)
 
         this->modelPtr_ = dynamic_cast<const orbit::Model*>(&this->accessModel());
         this->celestialObjectSPtr_ = anOrbit.celestialObjectSPtr_;
-
-        this->passMap_.clear();
+        this->cacheSPtr_ = anOrbit.cacheSPtr_;
     }
 
     return *this;
@@ -179,59 +200,22 @@ Pass Orbit::getPassWithRevolutionNumber(const Integer& aRevolutionNumber, const
         throw ostk::core::error::runtime::Undefined("Orbit");
     }
 
-    const std::lock_guard<std::mutex> lock {this->mutex_};
+    Pass currentPass = Pass::Undefined();
 
-    const auto getClosestPass = [this](const Integer& aRevolutionNumber) -> Pass
     {
-        if (this->passMap_.empty())
-        {
-            return Pass::Undefined();
-        }
-
-        // exact revolution number exists
-
-        if (this->passMap_.count(aRevolutionNumber))
-        {
-            return this->passMap_.at(aRevolutionNumber);
-        }
-
-        const auto lowerBoundMapIt = this->passMap_.lower_bound(aRevolutionNumber);
-
-        // Revolution number is greater than any existing revolution number in map
-        // {5, 6, 9, 10} -> aRevolutionNumber=12 -> return 10
-
-        if (lowerBoundMapIt == this->passMap_.end())
-        {
-            return this->passMap_.rbegin()->second;
-        }
-
-        // Revolution number is lesser than any existing revolution number in map
-        // {5, 6, 9, 10} -> aRevolutionNumber=4 -> return 5
+        const std::shared_lock<std::shared_mutex> lock {this->cacheSPtr_->passMutex};
 
-        if (lowerBoundMapIt == this->passMap_.begin())
+        if (this->cacheSPtr_->passMap.count(aRevolutionNumber))
         {
-            return this->passMap_.begin()->second;
+            return this->cacheSPtr_->passMap.at(aRevolutionNumber);
         }
 
-        // Closest revolution number is within the map
-
-        const auto closestPassMapIt = std::prev(lowerBoundMapIt);
-
-        // {5, 6, 9, 10} -> aRevolutionNumber=7 -> return 6
-        // lowerBoundMapIt = 9, closestPassMapIt = 6
-
-        if ((aRevolutionNumber - closestPassMapIt->first) < (lowerBoundMapIt->first - aRevolutionNumber))
-        {
-            return closestPassMapIt->second;
-        }
-
-        // {5, 6, 9, 10} -> aRevolutionNumber=8 -> return 9
-        // lowerBoundMapIt = 9, closestPassMapIt = 6
+        currentPass = this->getClosestPass(aRevolutionNumber);
+    }
 
-        return lowerBoundMapIt->second;
-    };
+    // Passes are computed outside of the lock, so that concurrent cache hits are not blocked, and cached once done
 
-    Pass currentPass = getClosestPass(aRevolutionNumber);
+    Map<Integer, Pass> computedPassMap;
 
     Integer currentRevolutionNumber =
         currentPass.isDefined() ? currentPass.getRevolutionNumber() : this->modelPtr_->getRevolutionNumberAtEpoch();
@@ -239,8 +223,8 @@ Pass Orbit::getPassWithRevolutionNumber(const Integer& aRevolutionNumber, const
     const bool isForwardPropagated = currentRevolutionNumber <= aRevolutionNumber;
     const Integer propagationSign = isForwardPropagated ? 1 : -1;
 
-    const auto computeCrossings = [this, &isForwardPropagated](
-                                      Instant previousInstant, const Duration& stepDuration
+    const auto computeCrossings = [this](
+                                      Instant previousInstant, const Duration& stepDuration, const bool isForward
                                   ) -> Tuple<Instant, Instant, Instant, Instant>
     {
         Instant northPointCrossing = Instant::Undefined();
@@ -251,8 +235,8 @@ Pass Orbit::getPassWithRevolutionNumber(const Integer& aRevolutionNumber, const
         const Instant epoch = this->modelPtr_->getEpoch();
 
         const State previousState = this->modelPtr_->calculateStateAt(previousInstant);
-        Real previousStateCoordinates_ECI_z = previousState.getPosition().accessCoordinates().z();
-        Real previousStateCoordinates_ECI_zdot = previousState.getVelocity().accessCoordinates().z();
+        Real previousStateCoordinates_ECI_z = previousState.accessPositionCoordinates().z();
+        Real previousStateCoordinates_ECI_zdot = previousState.accessVelocityCoordinates().z();
 
         const auto getZ = [this, &epoch](const double& aDurationInSeconds) -> Real
         {
@@ -275,8 +259,8 @@ Pass Orbit::getPassWithRevolutionNumber(const Integer& aRevolutionNumber, const
             const Instant currentInstant = previousInstant + stepDuration;
 
             const State currentState = this->modelPtr_->calculateStateAt(currentInstant);
-            const Real currentStateCoordinates_ECI_z = currentState.getPosition().accessCoordinates().z();
-            const Real currentStateCoordinates_ECI_zdot = currentState.getVelocity().accessCoordinates().z();
+            const Real currentStateCoordinates_ECI_z = currentState.accessPositionCoordinates().z();
+            const Real currentStateCoordinates_ECI_zdot = currentState.accessVelocityCoordinates().z();
 
             if ((previousStateCoordinates_ECI_z == 0.0) && (currentStateCoordinates_ECI_z == 0.0))
             {
@@ -300,7 +284,7 @@ Pass Orbit::getPassWithRevolutionNumber(const Integer& aRevolutionNumber, const
             {
                 const Instant crossingInstant = Orbit::GetCrossingInstant(epoch, previousInstant, currentInstant, getZ);
 
-                if (isForwardPropagated)
+                if (isForward)
                 {
                     descendingNodeCrossing = crossingInstant;
                 }
@@ -313,7 +297,7 @@ Pass Orbit::getPassWithRevolutionNumber(const Integer& aRevolutionNumber, const
             if ((previousStateCoordinates_ECI_z < 0.0) && (currentStateCoordinates_ECI_z >= 0.0))
             {
                 const Instant crossingInstant = Orbit::GetCrossingInstant(epoch, previousInstant, currentInstant, getZ);
-                if (isForwardPropagated)
+                if (isForward)
                 {
                     passBreakCrossing = crossingInstant;
                 }
@@ -341,12 +325,90 @@ Pass Orbit::getPassWithRevolutionNumber(const Integer& aRevolutionNumber, const
     Instant descendingNodeCrossing = Instant::Undefined();
     Instant passBreakCrossing = Instant::Undefined();
 
+    // For distant revolutions, start from the analytic estimate of the model (if any), and only refine it locally
+
+    if (std::abs(static_cast<int>(aRevolutionNumber - currentRevolutionNumber)) > 1)
+    {
+        const Instant estimatedAscendingNodeInstant =
+            this->modelPtr_->estimateAscendingNodeInstant(aRevolutionNumber);
+        const Instant estimatedPassBreakInstant = this->modelPtr_->estimateAscendingNodeInstant(aRevolutionNumber + 1);
+
+        if (estimatedAscendingNodeInstant.isDefined() && estimatedPassBreakInstant.isDefined() &&
+            (estimatedPassBreakInstant > estimatedAscendingNodeInstant))
+        {
+            const Duration estimatedPeriod = estimatedPassBreakInstant - estimatedAscendingNodeInstant;
+            const Duration searchStepDuration = std::min(aStepDuration, estimatedPeriod / 8.0);
+
+            const Instant epoch = this->modelPtr_->getEpoch();
+
+            const auto getZ = [this, &epoch](const double& aDurationInSeconds) -> Real
+            {
+                return this->modelPtr_->calculateStateAt(epoch + Duration::Seconds(aDurationInSeconds))
+                    .getPosition()
+                    .accessCoordinates()
+                    .z();
+            };
+
+            // Search the ascending node within half a period of the estimate, starting from the closest intervals
+
+            Instant ascendingNodeCrossing = Instant::Undefined();
+
+            const int maximumStepCount =
+                static_cast<int>(std::ceil(double(estimatedPeriod.inSeconds() / searchStepDuration.inSeconds()) / 2.0));
+
+            for (int stepCount = 0; (stepCount <= maximumStepCount) && !ascendingNodeCrossing.isDefined(); ++stepCount)
+            {
+                for (const int stepSign : {1, -1})
+                {
+                    if ((stepCount == 0) && (stepSign < 0))
+                    {
+                        continue;
+                    }
+
+                    const Instant lowerInstant = estimatedAscendingNodeInstant +
+                                                 searchStepDuration * (Real::Integer(stepSign * stepCount) - 0.5);
+                    const Instant upperInstant = lowerInstant + searchStepDuration;
+
+                    const Real lowerZ = getZ((lowerInstant - epoch).inSeconds());
+                    const Real upperZ = getZ((upperInstant - epoch).inSeconds());
+
+                    if ((lowerZ < 0.0) && (upperZ >= 0.0))
+                    {
+                        ascendingNodeCrossing = Orbit::GetCrossingInstant(epoch, lowerInstant, upperInstant, getZ);
+                        break;
+                    }
+                }
+            }
+
+            if (ascendingNodeCrossing.isDefined())
+            {
+                std::tie(northPointCrossing, descendingNodeCrossing, southPointCrossing, passBreakCrossing) =
+                    computeCrossings(ascendingNodeCrossing + Duration::Microseconds(1.0), searchStepDuration, true);
+
+                const Pass pass = {
+                    aRevolutionNumber,
+                    ascendingNodeCrossing,
+                    northPointCrossing,
+                    descendingNodeCrossing,
+                    southPointCrossing,
+                    passBreakCrossing,
+                };
+
+                computedPassMap.insert({pass.getRevolutionNumber(), pass});
+
+                this->cachePasses(computedPassMap);
+
+                return pass;
+            }
+        }
+    }
+
     if (!currentPass.isDefined())
     {
         const Instant previousInstant = this->modelPtr_->getEpoch();
 
         std::tie(northPointCrossing, descendingNodeCrossing, southPointCrossing, passBreakCrossing) =
-            computeCrossings(previousInstant, aStepDuration * Real::Integer(propagationSign));
+            computeCrossings(previousInstant, aStepDuration * Real::Integer(propagationSign), isForwardPropagated);
 
         const Instant crossingInstant =
             Real(this->modelPtr_->calculateStateAt(this->modelPtr_->getEpoch()).getPosition().accessCoordinates().z())
@@ -368,7 +430,7 @@ Pass Orbit::getPassWithRevolutionNumber(const Integer& aRevolutionNumber, const
 
         if (currentPass.isComplete())
         {
-            this->passMap_.insert({currentPass.getRevolutionNumber(), currentPass});
+            computedPassMap.insert({currentPass.getRevolutionNumber(), currentPass});
         }
     }
 
@@ -392,7 +454,7 @@ Pass Orbit::getPassWithRevolutionNumber(const Integer& aRevolutionNumber, const
                                           : currentPass.getStartInstant() - Duration::Microseconds(1.0);
 
         std::tie(northPointCrossing, descendingNodeCrossing, southPointCrossing, passBreakCrossing) =
-            computeCrossings(previousInstant, stepDuration * Real::Integer(propagationSign));
+            computeCrossings(previousInstant, stepDuration * Real::Integer(propagationSign), isForwardPropagated);
 
         currentRevolutionNumber += propagationSign;
 
@@ -409,12 +471,181 @@ Pass Orbit::getPassWithRevolutionNumber(const Integer& aRevolutionNumber, const
             passBreakCrossing,
         };
 
-        this->passMap_.insert({currentPass.getRevolutionNumber(), currentPass});
+        computedPassMap.insert({currentPass.getRevolutionNumber(), currentPass});
     }
 
+    this->cachePasses(computedPassMap);
+
     return currentPass;
 }
 
+Pass Orbit::getSampledPassWithRevolutionNumber(
+    const Integer& aRevolutionNumber, const Duration& aStepDuration, const Size& aWindowStepCount
+) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Orbit");
+    }
+
+    if (!aRevolutionNumber.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Revolution number");
+    }
+
+    if (!aStepDuration.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Step duration");
+    }
+
+    if (!aStepDuration.isStrictlyPositive())
+    {
+        throw ostk::core::error::runtime::Wrong("Step duration");
+    }
+
+    if (aWindowStepCount < 2)
+    {
+        throw ostk::core::error::runtime::Wrong("Window step count");
+    }
+
+    Pass closestPass = Pass::Undefined();
+
+    {
+        const std::shared_lock<std::shared_mutex> lock {this->cacheSPtr_->passMutex};
+
+        if (this->cacheSPtr_->passMap.count(aRevolutionNumber))
+        {
+            return this->cacheSPtr_->passMap.at(aRevolutionNumber);
+        }
+
+        closestPass = this->getClosestPass(aRevolutionNumber);
+    }
+
+    // The revolution numbers of the sampled passes are anchored on the closest known pass, or on the epoch
+
+    Map<Integer, Pass> computedPassMap;
+
+    Instant anchorInstant = closestPass.isDefined()
+                              ? closestPass.getStartInstant() + closestPass.getDuration() / 2.0
+                              : this->modelPtr_->getEpoch();
+    Integer anchorRevolutionNumber =
+        closestPass.isDefined() ? closestPass.getRevolutionNumber() : this->modelPtr_->getRevolutionNumberAtEpoch();
+
+    const bool isForwardPropagated = anchorRevolutionNumber <= aRevolutionNumber;
+
+    const Duration windowDuration = aStepDuration * Real(static_cast<double>(aWindowStepCount));
+
+    // The first window is centered on the anchor, so that the anchor pass can be complete. The following ones start
+    // (or end, when propagating backward) right before (or after) the anchor pass midpoint.
+
+    Instant windowStartInstant = anchorInstant - windowDuration / 2.0;
+
+    Array<Instant> instants = Array<Instant>::Empty();
+    instants.reserve(aWindowStepCount + 1);
+
+    while (true)
+    {
+        instants.clear();
+
+        for (Index i = 0; i <= aWindowStepCount; ++i)
+        {
+            instants.add(windowStartInstant + aStepDuration * Real(static_cast<double>(i)));
+        }
+
+        const Array<State> states = this->modelPtr_->calculateStatesAt(instants);
+
+        const Array<Pair<Index, Pass>> passes = Orbit::ComputePasses(states, 0);
+
+        // An anchor lying on an ascending node (e.g. the epoch) belongs to the pass starting there, the tolerance
+        // absorbing the interpolation error of the sampled node crossing
+
+        const Instant toleratedAnchorInstant = anchorInstant + Duration::Milliseconds(1.0);
+
+        Integer revolutionNumberOffset = Integer::Undefined();
+
+        for (const Pair<Index, Pass>& indexedPass : passes)
+        {
+            const Pass& pass = indexedPass.second;
+
+            const Instant& ascendingNodeInstant = pass.accessInstantAtAscendingNode();
+            const Instant& passBreakInstant = pass.accessInstantAtPassBreak();
+
+            if (((!ascendingNodeInstant.isDefined()) || (ascendingNodeInstant <= toleratedAnchorInstant)) &&
+                ((!passBreakInstant.isDefined()) || (toleratedAnchorInstant < passBreakInstant)))
+            {
+                revolutionNumberOffset = anchorRevolutionNumber - pass.getRevolutionNumber();
+                break;
+            }
+        }
+
+        if (!revolutionNumberOffset.isDefined())
+        {
+            throw ostk::core::error::RuntimeError(
+                "Cannot anchor sampled passes on revolution number [{}].", anchorRevolutionNumber.toString()
+            );
+        }
+
+        Pass firstCompletePass = Pass::Undefined();
+        Pass lastCompletePass = Pass::Undefined();
+
+        for (const Pair<Index, Pass>& indexedPass : passes)
+        {
+            const Pass& sampledPass = indexedPass.second;
+
+            if (!sampledPass.isComplete())
+            {
+                continue;
+            }
+
+            const Pass pass = {
+                sampledPass.getRevolutionNumber() + revolutionNumberOffset,
+                sampledPass.accessInstantAtAscendingNode(),
+                sampledPass.accessInstantAtNorthPoint(),
+                sampledPass.accessInstantAtDescendingNode(),
+                sampledPass.accessInstantAtSouthPoint(),
+                sampledPass.accessInstantAtPassBreak(),
+            };
+
+            computedPassMap.insert({pass.getRevolutionNumber(), pass});
+
+            if (!firstCompletePass.isDefined())
+            {
+                firstCompletePass = pass;
+            }
+
+            lastCompletePass = pass;
+        }
+
+        if (computedPassMap.count(aRevolutionNumber))
+        {
+            this->cachePasses(computedPassMap);
+
+            return computedPassMap.at(aRevolutionNumber);
+        }
+
+        const Pass& nextAnchorPass = isForwardPropagated ? lastCompletePass : firstCompletePass;
+
+        if ((!nextAnchorPass.isDefined()) ||
+            (isForwardPropagated ? (nextAnchorPass.getRevolutionNumber() <= anchorRevolutionNumber)
+                                 : (nextAnchorPass.getRevolutionNumber() >= anchorRevolutionNumber)))
+        {
+            throw ostk::core::error::RuntimeError(
+                "Sampling window of [{}] steps is too short to progress past revolution number [{}].",
+                aWindowStepCount,
+                anchorRevolutionNumber.toString()
+            );
+        }
+
+        anchorInstant = nextAnchorPass.getStartInstant() + nextAnchorPass.getDuration() / 2.0;
+        anchorRevolutionNumber = nextAnchorPass.getRevolutionNumber();
+
+        windowStartInstant = isForwardPropagated ? anchorInstant - aStepDuration
+                                                 : anchorInstant + aStepDuration - windowDuration;
+    }
+
+    return Pass::Undefined();
+}
+
 Shared<const Frame> Orbit::getOrbitalFrame(const Orbit::FrameType& aFrameType) const
 {
     using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
@@ -424,7 +655,6 @@ Shared<const Frame> Orbit::getOrbitalFrame(const Orbit::FrameType& aFrameType) c
 
     using ostk::physics::coordinate::spherical::LLA;
     using ostk::physics::time::Duration;
-    using FrameManager = ostk::physics::coordinate::frame::Manager;
     using DynamicProvider = ostk::physics::coordinate::frame::provider::Dynamic;
     using ostk::physics::coordinate::Transform;
 
@@ -433,21 +663,29 @@ Shared<const Frame> Orbit::getOrbitalFrame(const Orbit::FrameType& aFrameType) c
         throw ostk::core::error::runtime::Undefined("Orbit");
     }
 
-    const String frameName = this->generateFrameName(aFrameType);
+    const std::lock_guard<std::mutex> lock {this->cacheSPtr_->frameMutex};
 
-    if (FrameManager::Get().hasFrameWithName(frameName))
+    if (const auto frameMapIt = this->cacheSPtr_->frameMap.find(aFrameType);
+        frameMapIt != this->cacheSPtr_->frameMap.end())
     {
-        return FrameManager::Get().accessFrameWithName(frameName);
+        return frameMapIt->second;
     }
 
+    const String frameName = this->generateFrameName(aFrameType);
+
+    // The frame providers hold (cheap) copies of the trajectory and of the central body rather than this orbit, as the
+    // frames outlive it when shared with copies
+
+    const Trajectory trajectory = *this;
+    const Shared<const Celestial> celestialObjectSPtr = this->celestialObjectSPtr_;
+
     const auto generateDynamicProvider =
-        [this](const auto& anAttitudeGenerator, const Shared<const Frame>& aReferenceFrame) -> auto
+        [&trajectory](const auto& anAttitudeGenerator, const Shared<const Frame>& aReferenceFrame) -> auto
     {
         const Shared<const DynamicProvider> dynamicProviderSPtr = std::make_shared<const DynamicProvider>(
-            // TBM: Using `this` here will trigger a segfault if the Orbit is de-allocated while the Frame is used.
-            [this, anAttitudeGenerator, aReferenceFrame](const Instant& anInstant) -> Transform
+            [trajectory, anAttitudeGenerator, aReferenceFrame](const Instant& anInstant) -> Transform
             {
-                const State state = this->getStateAt(anInstant).inFrame(aReferenceFrame);
+                const State state = trajectory.getStateAt(anInstant).inFrame(aReferenceFrame);
 
                 const Vector3d x_GCRF = state.getPosition().accessCoordinates();
                 const Vector3d v_GCRF = state.getVelocity().accessCoordinates();
@@ -457,7 +695,7 @@ Shared<const Frame> Orbit::getOrbitalFrame(const Orbit::FrameType& aFrameType) c
                 const Duration delta = Duration::Seconds(0.1);  // TBM This should be a parameter
 
                 const Quaternion q_LOF_GCRF_next =
-                    anAttitudeGenerator(this->getStateAt(anInstant + delta).inFrame(Frame::GCRF()));
+                    anAttitudeGenerator(trajectory.getStateAt(anInstant + delta).inFrame(Frame::GCRF()));
 
                 const Quaternion q_LOF_next_LOF = (q_LOF_GCRF_next * q_LOF_GCRF.toConjugate()).toNormalized();
                 const RotationVector rv_LOF_next_LOF = RotationVector::Quaternion(q_LOF_next_LOF);
@@ -485,27 +723,27 @@ Shared<const Frame> Orbit::getOrbitalFrame(const Orbit::FrameType& aFrameType) c
     {
         case Orbit::FrameType::NED:
         {
-            const auto calculateAttitude = [this](const State& aState) -> Quaternion
+            const auto calculateAttitude = [trajectory, celestialObjectSPtr](const State& aState) -> Quaternion
             {
                 // Get state in central body centered, central body fixed frame
 
                 const State state =
-                    this->getStateAt(aState.getInstant()).inFrame(this->celestialObjectSPtr_->accessFrame());
+                    trajectory.getStateAt(aState.getInstant()).inFrame(celestialObjectSPtr->accessFrame());
 
                 // Express the state position in geodetic coordinates
 
                 const LLA lla = LLA::Cartesian(
                     state.getPosition().accessCoordinates(),
-                    this->celestialObjectSPtr_->getEquatorialRadius(),
-                    this->celestialObjectSPtr_->getFlattening()
+                    celestialObjectSPtr->getEquatorialRadius(),
+                    celestialObjectSPtr->getFlattening()
                 );
 
                 // Compute the NED frame to central body centered, central body fixed frame transform at position
 
                 const Transform transform = ostk::physics::coordinate::frame::utilities::NorthEastDownTransformAt(
                     lla,
-                    this->celestialObjectSPtr_->getEquatorialRadius(),
-                    celestialObjectSPtr_->getFlattening()
+                    celestialObjectSPtr->getEquatorialRadius(),
+                    celestialObjectSPtr->getFlattening()
                 );  // [TBM] This should be optimized: LLA <> ECEF calculation done twice
 
                 const Quaternion q_NED_GCRF = transform.getOrientation().toNormalized();
@@ -513,11 +751,11 @@ Shared<const Frame> Orbit::getOrbitalFrame(const Orbit::FrameType& aFrameType) c
                 return q_NED_GCRF;
             };
 
-            orbitalFrameSPtr = Frame::Construct(
+            orbitalFrameSPtr = std::make_shared<const OrbitalFrameEnabler>(
                 frameName,
                 false,
-                this->celestialObjectSPtr_->accessFrame(),
-                generateDynamicProvider(calculateAttitude, this->celestialObjectSPtr_->accessFrame())
+                celestialObjectSPtr->accessFrame(),
+                generateDynamicProvider(calculateAttitude, celestialObjectSPtr->accessFrame())
             );
 
             break;
@@ -545,7 +783,7 @@ Shared<const Frame> Orbit::getOrbitalFrame(const Orbit::FrameType& aFrameType) c
                 return q_LVLH_GCRF;
             };
 
-            orbitalFrameSPtr = Frame::Construct(
+            orbitalFrameSPtr = std::make_shared<const OrbitalFrameEnabler>(
                 frameName, false, Frame::GCRF(), generateDynamicProvider(calculateAttitude, Frame::GCRF())
             );
 
@@ -573,7 +811,7 @@ Shared<const Frame> Orbit::getOrbitalFrame(const Orbit::FrameType& aFrameType) c
                 return q_VVLH_GCRF;
             };
 
-            orbitalFrameSPtr = Frame::Construct(
+            orbitalFrameSPtr = std::make_shared<const OrbitalFrameEnabler>(
                 frameName, false, Frame::GCRF(), generateDynamicProvider(calculateAttitude, Frame::GCRF())
             );
 
@@ -600,7 +838,7 @@ Shared<const Frame> Orbit::getOrbitalFrame(const Orbit::FrameType& aFrameType) c
                 return q_TNW_GCRF;
             };
 
-            orbitalFrameSPtr = Frame::Construct(
+            orbitalFrameSPtr = std::make_shared<const OrbitalFrameEnabler>(
                 frameName, false, Frame::GCRF(), generateDynamicProvider(calculateAttitude, Frame::GCRF())
             );
 
@@ -627,7 +865,7 @@ Shared<const Frame> Orbit::getOrbitalFrame(const Orbit::FrameType& aFrameType) c
                 return q_VNC_GCRF;
             };
 
-            orbitalFrameSPtr = Frame::Construct(
+            orbitalFrameSPtr = std::make_shared<const OrbitalFrameEnabler>(
                 frameName, false, Frame::GCRF(), generateDynamicProvider(calculateAttitude, Frame::GCRF())
             );
 
@@ -640,14 +878,14 @@ Shared<const Frame> Orbit::getOrbitalFrame(const Orbit::FrameType& aFrameType) c
             // Z axis toward orbital momentum
             // Y axis toward velocity vector
 
-            const auto calculateAttitude = [this](const State& aState) -> Quaternion
+            const auto calculateAttitude = [celestialObjectSPtr](const State& aState) -> Quaternion
             {
                 // Express the state position in geodetic coordinates
 
                 const LLA lla = LLA::Cartesian(
-                    aState.inFrame(this->celestialObjectSPtr_->accessFrame()).getPosition().accessCoordinates(),
-                    this->celestialObjectSPtr_->getEquatorialRadius(),
-                    this->celestialObjectSPtr_->getFlattening()
+                    aState.inFrame(celestialObjectSPtr->accessFrame()).getPosition().accessCoordinates(),
+                    celestialObjectSPtr->getEquatorialRadius(),
+                    celestialObjectSPtr->getFlattening()
                 );
 
                 const Vector3d x_GCRF = aState.getPosition().accessCoordinates();
@@ -675,7 +913,7 @@ Shared<const Frame> Orbit::getOrbitalFrame(const Orbit::FrameType& aFrameType) c
                 return q_LVLHGD_GCRF;
             };
 
-            orbitalFrameSPtr = Frame::Construct(
+            orbitalFrameSPtr = std::make_shared<const OrbitalFrameEnabler>(
                 frameName, false, Frame::GCRF(), generateDynamicProvider(calculateAttitude, Frame::GCRF())
             );
 
@@ -688,15 +926,15 @@ Shared<const Frame> Orbit::getOrbitalFrame(const Orbit::FrameType& aFrameType) c
             // Z axis along orbital momentum
             // Y axis toward velocity vector
 
-            const auto calculateAttitude = [this](const State& aState) -> Quaternion
+            const auto calculateAttitude = [celestialObjectSPtr](const State& aState) -> Quaternion
             {
                 // TBM: We can calculate the geodetic vector in a simpler fashion, refer to FDTk profile.py
 
                 // Express the state position in geodetic coordinates
                 const LLA lla = LLA::Cartesian(
-                    aState.inFrame(this->celestialObjectSPtr_->accessFrame()).getPosition().accessCoordinates(),
-                    this->celestialObjectSPtr_->getEquatorialRadius(),
-                    this->celestialObjectSPtr_->getFlattening()
+                    aState.inFrame(celestialObjectSPtr->accessFrame()).getPosition().accessCoordinates(),
+                    celestialObjectSPtr->getEquatorialRadius(),
+                    celestialObjectSPtr->getFlattening()
                 );
 
                 const Vector3d x_GCRF = aState.getPosition().accessCoordinates();
@@ -723,14 +961,14 @@ Shared<const Frame> Orbit::getOrbitalFrame(const Orbit::FrameType& aFrameType) c
 
                 const COE coe = COE::Cartesian(
                     {aState.getPosition(), aState.getVelocity()},
-                    this->celestialObjectSPtr_->getGravitationalParameter()
+                    celestialObjectSPtr->getGravitationalParameter()
                 );
                 const Angle inclination = coe.getInclination();
-                const Derived meanMotion = coe.getMeanMotion(this->celestialObjectSPtr_->getGravitationalParameter());
+                const Derived meanMotion = coe.getMeanMotion(celestialObjectSPtr->getGravitationalParameter());
                 const Derived nodalPrecessionRate = coe.getNodalPrecessionRate(
-                    this->celestialObjectSPtr_->getGravitationalParameter(),
-                    this->celestialObjectSPtr_->getEquatorialRadius(),
-                    this->celestialObjectSPtr_->getJ2()
+                    celestialObjectSPtr->getGravitationalParameter(),
+                    celestialObjectSPtr->getEquatorialRadius(),
+                    celestialObjectSPtr->getJ2()
                 );
 
                 const bool isPassDescending = v_GCRF.z() < 0.0;
@@ -753,7 +991,7 @@ Shared<const Frame> Orbit::getOrbitalFrame(const Orbit::FrameType& aFrameType) c
                 return (q_LVLHGDGT_LVLHGD * q_LVLHGD_GCRF).toNormalized();
             };
 
-            orbitalFrameSPtr = Frame::Construct(
+            orbitalFrameSPtr = std::make_shared<const OrbitalFrameEnabler>(
                 frameName, false, Frame::GCRF(), generateDynamicProvider(calculateAttitude, Frame::GCRF())
             );
 
@@ -765,126 +1003,432 @@ Shared<const Frame> Orbit::getOrbitalFrame(const Orbit::FrameType& aFrameType) c
             break;
     }
 
-    FrameManager::Get().addFrame(orbitalFrameSPtr);
+    this->cacheSPtr_->frameMap.insert({aFrameType, orbitalFrameSPtr});
 
     return orbitalFrameSPtr;
 }
 
-void Orbit::print(std::ostream& anOutputStream, bool displayDecorator) const
+void Orbit::savePassSnapshot(const File& aFile) const
 {
-    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Orbit") : void();
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Orbit");
+    }
 
-    Trajectory::print(anOutputStream, false);
+    if (!aFile.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("File");
+    }
 
-    const std::lock_guard<std::mutex> lock {this->mutex_};
+    const Instant epoch = this->modelPtr_->getEpoch();
 
-    for (const auto& passIt : this->passMap_)
+    const auto toOffset = [&epoch](const Instant& anInstant) -> std::int64_t
     {
-        const Pass& pass = passIt.second;
+        return anInstant.isDefined()
+                 ? static_cast<std::int64_t>(std::llround(double(Duration::Between(epoch, anInstant).inNanoseconds())))
+                 : PassSnapshotUndefinedOffset;
+    };
 
-        ostk::core::utils::Print::Separator(anOutputStream, String::Format("Pass #{}", pass.getRevolutionNumber()));
+    std::vector<PassSnapshotRecord> records;
 
-        pass.print(anOutputStream, false);
+    {
+        const std::shared_lock<std::shared_mutex> lock {this->cacheSPtr_->passMutex};
+
+        records.reserve(this->cacheSPtr_->passMap.size());
+
+        for (const auto& passIt : this->cacheSPtr_->passMap)
+        {
+            const Pass& pass = passIt.second;
+
+            PassSnapshotRecord record;
+
+            record.revolutionNumber = static_cast<int>(pass.getRevolutionNumber());
+            record.instantOffsets_ns[0] = toOffset(pass.accessInstantAtAscendingNode());
+            record.instantOffsets_ns[1] = toOffset(pass.accessInstantAtNorthPoint());
+            record.instantOffsets_ns[2] = toOffset(pass.accessInstantAtDescendingNode());
+            record.instantOffsets_ns[3] = toOffset(pass.accessInstantAtSouthPoint());
+            record.instantOffsets_ns[4] = toOffset(pass.accessInstantAtPassBreak());
+
+            records.push_back(record);
+        }
     }
 
-    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
-}
+    PassSnapshotHeader header;
 
-Orbit Orbit::Undefined()
-{
-    return {Array<State>::Empty(), Integer::Undefined(), nullptr};
-}
+    std::memcpy(header.magic, PassSnapshotMagic, sizeof(PassSnapshotMagic));
+    header.version = PassSnapshotVersion;
+    header.byteOrderMark = PassSnapshotByteOrderMark;
+    header.recordCount = records.size();
+    header.epochOffset_ns = Duration::Between(Instant::J2000(), epoch).inNanoseconds();
 
-Orbit Orbit::Circular(
-    const Instant& anEpoch,
-    const Length& anAltitude,
-    const Angle& anInclination,
-    const Shared<const Celestial>& aCelestialObjectSPtr
-)
-{
-    using orbit::model::Kepler;
-    using orbit::model::kepler::COE;
+    std::ofstream fileStream(aFile.getPath().toString(), std::ios::binary | std::ios::trunc);
 
-    if (!anEpoch.isDefined())
+    if (!fileStream.is_open())
     {
-        throw ostk::core::error::runtime::Undefined("Epoch");
+        throw ostk::core::error::RuntimeError("Cannot open file [{}].", aFile.toString());
     }
 
-    if (!anAltitude.isDefined())
+    fileStream.write(reinterpret_cast<const char*>(&header), sizeof(PassSnapshotHeader));
+    fileStream.write(
+        reinterpret_cast<const char*>(records.data()),
+        static_cast<std::streamsize>(records.size() * sizeof(PassSnapshotRecord))
+    );
+
+    if (!fileStream.good())
     {
-        throw ostk::core::error::runtime::Undefined("Altitude");
+        throw ostk::core::error::RuntimeError("Cannot write file [{}].", aFile.toString());
     }
+}
 
-    if (!anInclination.isDefined())
+void Orbit::loadPassSnapshot(const File& aFile) const
+{
+    if (!this->isDefined())
     {
-        throw ostk::core::error::runtime::Undefined("Inclination");
+        throw ostk::core::error::runtime::Undefined("Orbit");
     }
 
-    if ((aCelestialObjectSPtr == nullptr) || (!aCelestialObjectSPtr->isDefined()))
+    if (!aFile.isDefined())
     {
-        throw ostk::core::error::runtime::Undefined("Celestial object");
+        throw ostk::core::error::runtime::Undefined("File");
     }
 
-    const Length semiMajorAxis = aCelestialObjectSPtr->getEquatorialRadius() + anAltitude;
-    const Real eccentricity = 0.0;
-    const Angle inclination = anInclination;
-    const Angle raan = Angle::Zero();
-    const Angle aop = Angle::Zero();
-    const Angle trueAnomaly = Angle::Zero();
+    if (!aFile.exists())
+    {
+        throw ostk::core::error::RuntimeError("File [{}] does not exist.", aFile.toString());
+    }
 
-    const COE coe = {semiMajorAxis, eccentricity, inclination, raan, aop, trueAnomaly};
+    std::ifstream fileStream(aFile.getPath().toString(), std::ios::binary);
 
-    const Kepler orbitalModel = {coe, anEpoch, (*aCelestialObjectSPtr), Kepler::PerturbationType::None, false};
+    if (!fileStream.is_open())
+    {
+        throw ostk::core::error::RuntimeError("Cannot open file [{}].", aFile.toString());
+    }
 
-    return {orbitalModel, aCelestialObjectSPtr};
-}
+    fileStream.seekg(0, std::ios::end);
 
-Orbit Orbit::Equatorial(
-    const Instant& anEpoch,
-    const Length& anApoapsisAltitude,
-    const Length& aPeriapsisAltitude,
-    const Shared<const Celestial>& aCelestialObjectSPtr
-)
-{
-    using orbit::model::Kepler;
-    using orbit::model::kepler::COE;
+    const std::size_t fileSize = static_cast<std::size_t>(fileStream.tellg());
 
-    if (!anEpoch.isDefined())
+    fileStream.seekg(0, std::ios::beg);
+
+    PassSnapshotHeader header;
+
+    if ((fileSize < sizeof(PassSnapshotHeader)) ||
+        (!fileStream.read(reinterpret_cast<char*>(&header), sizeof(PassSnapshotHeader))) ||
+        (std::memcmp(header.magic, PassSnapshotMagic, sizeof(PassSnapshotMagic)) != 0))
     {
-        throw ostk::core::error::runtime::Undefined("Epoch");
+        throw ostk::core::error::RuntimeError("File [{}] is not a pass snapshot.", aFile.toString());
     }
 
-    if (!anApoapsisAltitude.isDefined())
+    if (header.version != PassSnapshotVersion)
     {
-        throw ostk::core::error::runtime::Undefined("Apoapsis altitude");
+        throw ostk::core::error::RuntimeError(
+            "Pass snapshot version [{}] is not supported (expected [{}]).", header.version, PassSnapshotVersion
+        );
     }
 
-    if (!aPeriapsisAltitude.isDefined())
+    if (header.byteOrderMark != PassSnapshotByteOrderMark)
     {
-        throw ostk::core::error::runtime::Undefined("Periapsis altitude");
+        throw ostk::core::error::RuntimeError("Pass snapshot byte order is not supported.");
     }
 
-    if ((aCelestialObjectSPtr == nullptr) || (!aCelestialObjectSPtr->isDefined()))
+    if (((fileSize - sizeof(PassSnapshotHeader)) % sizeof(PassSnapshotRecord) != 0) ||
+        (header.recordCount != ((fileSize - sizeof(PassSnapshotHeader)) / sizeof(PassSnapshotRecord))))
     {
-        throw ostk::core::error::runtime::Undefined("Celestial object");
+        throw ostk::core::error::RuntimeError("Pass snapshot [{}] is truncated.", aFile.toString());
     }
 
-    if (anApoapsisAltitude < aPeriapsisAltitude)
+    const Instant epoch = this->modelPtr_->getEpoch();
+
+    // The epoch is stored as a floating point offset, hence the tolerance
+
+    if (std::abs(header.epochOffset_ns - double(Duration::Between(Instant::J2000(), epoch).inNanoseconds())) > 1e3)
     {
         throw ostk::core::error::RuntimeError(
-            "Apoapsis altitude [{}] lower than periapsis altitude [{}].",
-            anApoapsisAltitude.toString(),
-            aPeriapsisAltitude.toString()
+            "Pass snapshot [{}] was not saved from an orbit with epoch [{}].", aFile.toString(), epoch.toString()
         );
     }
 
-    const Real r_a = aCelestialObjectSPtr->getEquatorialRadius().inMeters() + anApoapsisAltitude.inMeters();
-    const Real r_p = aCelestialObjectSPtr->getEquatorialRadius().inMeters() + aPeriapsisAltitude.inMeters();
+    std::vector<PassSnapshotRecord> records(header.recordCount);
 
-    const Real eccentricity = (r_a - r_p) / (r_a + r_p);
-    const Length semiMajorAxis = Length::Meters(r_a / (1.0 + eccentricity));
-    const Angle inclination = Angle::Zero();
-    const Angle raan = Angle::Zero();
+    fileStream.read(
+        reinterpret_cast<char*>(records.data()),
+        static_cast<std::streamsize>(records.size() * sizeof(PassSnapshotRecord))
+    );
+
+    const auto fromOffset = [&epoch](const std::int64_t& anOffset) -> Instant
+    {
+        return (anOffset != PassSnapshotUndefinedOffset)
+                 ? epoch + Duration::Nanoseconds(static_cast<double>(anOffset))
+                 : Instant::Undefined();
+    };
+
+    Map<Integer, Pass> passMap;
+
+    for (const PassSnapshotRecord& record : records)
+    {
+        const Pass pass = {
+            Integer(static_cast<int>(record.revolutionNumber)),
+            fromOffset(record.instantOffsets_ns[0]),
+            fromOffset(record.instantOffsets_ns[1]),
+            fromOffset(record.instantOffsets_ns[2]),
+            fromOffset(record.instantOffsets_ns[3]),
+            fromOffset(record.instantOffsets_ns[4]),
+        };
+
+        passMap.insert({pass.getRevolutionNumber(), pass});
+    }
+
+    this->cachePasses(passMap);
+}
+
+MatrixXd Orbit::getGroundTrack(const Array<Instant>& anInstantArray) const
+{
+    using Eigen::ArrayXd;
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Orbit");
+    }
+
+    const Array<State> states = this->getStatesAt(anInstantArray);
+
+    const Shared<const Frame> fixedFrameSPtr = this->celestialObjectSPtr_->accessFrame();
+
+    const Eigen::Index count = static_cast<Eigen::Index>(states.getSize());
+
+    MatrixXd positions(3, count);
+
+    for (Eigen::Index index = 0; index < count; ++index)
+    {
+        const State& state = states[index];
+
+        const Vector3d position = state.accessPositionCoordinates();
+
+        positions.col(index) = (state.accessFrame() == fixedFrameSPtr)
+                                 ? position
+                                 : Vector3d(state.accessFrame()
+                                                ->getTransformTo(fixedFrameSPtr, state.accessInstant())
+                                                .applyToPosition(position));
+    }
+
+    // Bowring's closed form estimate, refined with two fixed-point iterations
+
+    const double a = this->celestialObjectSPtr_->getEquatorialRadius().inMeters();
+    const double f = this->celestialObjectSPtr_->getFlattening();
+    const double b = a * (1.0 - f);
+    const double e2 = f * (2.0 - f);
+    const double ep2 = (a * a - b * b) / (b * b);
+
+    const auto atan2 = [](const ArrayXd& aY, const ArrayXd& aX) -> ArrayXd
+    {
+        return aY.binaryExpr(
+            aX,
+            [](const double& y, const double& x) -> double
+            {
+                return std::atan2(y, x);
+            }
+        );
+    };
+
+    const ArrayXd x = positions.row(0).transpose().array();
+    const ArrayXd y = positions.row(1).transpose().array();
+    const ArrayXd z = positions.row(2).transpose().array();
+
+    const ArrayXd p = (x.square() + y.square()).sqrt();
+
+    const ArrayXd theta = atan2(z * a, p * b);
+
+    ArrayXd latitude = atan2(z + ep2 * b * theta.sin().cube(), p - e2 * a * theta.cos().cube());
+
+    const auto altitudeAt = [&p, &z, a, e2](const ArrayXd& aLatitude) -> ArrayXd
+    {
+        const ArrayXd N = a / (1.0 - e2 * aLatitude.sin().square()).sqrt();
+
+        return p * aLatitude.cos() + z * aLatitude.sin() - a * a / N;
+    };
+
+    for (Size iteration = 0; iteration < 2; ++iteration)
+    {
+        const ArrayXd N = a / (1.0 - e2 * latitude.sin().square()).sqrt();
+        const ArrayXd h = altitudeAt(latitude);
+
+        latitude = atan2(z, p * (1.0 - e2 * N / (N + h)));
+    }
+
+    MatrixXd groundTrack(count, 3);
+
+    groundTrack.col(0) = latitude.matrix();
+    groundTrack.col(1) = atan2(y, x).matrix();
+    groundTrack.col(2) = altitudeAt(latitude).matrix();
+
+    return groundTrack;
+}
+
+Array<COE> Orbit::getCOEsAt(const Array<Instant>& anInstantArray) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Orbit");
+    }
+
+    // Keplerian models propagate their elements natively
+
+    if (this->accessModel().is<Kepler>())
+    {
+        return this->accessModel().as<Kepler>().calculateCOEsAt(anInstantArray);
+    }
+
+    if (anInstantArray.isEmpty())
+    {
+        return Array<COE>::Empty();
+    }
+
+    static const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+
+    const Array<State> states = this->getStatesAt(anInstantArray);
+
+    const Eigen::Index count = static_cast<Eigen::Index>(states.getSize());
+
+    MatrixXd cartesianStates(count, 6);
+
+    for (Eigen::Index index = 0; index < count; ++index)
+    {
+        const State state = states[index].inFrame(gcrfSPtr);
+
+        cartesianStates.row(index).head<3>() = state.accessPositionCoordinates().transpose();
+        cartesianStates.row(index).tail<3>() = state.accessVelocityCoordinates().transpose();
+    }
+
+    const MatrixXd coeVectors = COE::CartesiansToSIVectors(
+        cartesianStates, this->celestialObjectSPtr_->getGravitationalParameter().in(GravitationalParameterSIUnit)
+    );
+
+    Array<COE> coes = Array<COE>::Empty();
+    coes.reserve(count);
+
+    for (Eigen::Index index = 0; index < count; ++index)
+    {
+        coes.add(COE::FromSIVector(coeVectors.row(index).transpose(), COE::AnomalyType::True));
+    }
+
+    return coes;
+}
+
+void Orbit::print(std::ostream& anOutputStream, bool displayDecorator) const
+{
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Orbit") : void();
+
+    Trajectory::print(anOutputStream, false);
+
+    const std::shared_lock<std::shared_mutex> lock {this->cacheSPtr_->passMutex};
+
+    for (const auto& passIt : this->cacheSPtr_->passMap)
+    {
+        const Pass& pass = passIt.second;
+
+        ostk::core::utils::Print::Separator(anOutputStream, String::Format("Pass #{}", pass.getRevolutionNumber()));
+
+        pass.print(anOutputStream, false);
+    }
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+Orbit Orbit::Undefined()
+{
+    return {Array<State>::Empty(), Integer::Undefined(), nullptr};
+}
+
+Orbit Orbit::Circular(
+    const Instant& anEpoch,
+    const Length& anAltitude,
+    const Angle& anInclination,
+    const Shared<const Celestial>& aCelestialObjectSPtr
+)
+{
+    using orbit::model::Kepler;
+    using orbit::model::kepler::COE;
+
+    if (!anEpoch.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Epoch");
+    }
+
+    if (!anAltitude.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Altitude");
+    }
+
+    if (!anInclination.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Inclination");
+    }
+
+    if ((aCelestialObjectSPtr == nullptr) || (!aCelestialObjectSPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Celestial object");
+    }
+
+    const Length semiMajorAxis = aCelestialObjectSPtr->getEquatorialRadius() + anAltitude;
+    const Real eccentricity = 0.0;
+    const Angle inclination = anInclination;
+    const Angle raan = Angle::Zero();
+    const Angle aop = Angle::Zero();
+    const Angle trueAnomaly = Angle::Zero();
+
+    const COE coe = {semiMajorAxis, eccentricity, inclination, raan, aop, trueAnomaly};
+
+    const Kepler orbitalModel = {coe, anEpoch, (*aCelestialObjectSPtr), Kepler::PerturbationType::None, false};
+
+    return {orbitalModel, aCelestialObjectSPtr};
+}
+
+Orbit Orbit::Equatorial(
+    const Instant& anEpoch,
+    const Length& anApoapsisAltitude,
+    const Length& aPeriapsisAltitude,
+    const Shared<const Celestial>& aCelestialObjectSPtr
+)
+{
+    using orbit::model::Kepler;
+    using orbit::model::kepler::COE;
+
+    if (!anEpoch.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Epoch");
+    }
+
+    if (!anApoapsisAltitude.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Apoapsis altitude");
+    }
+
+    if (!aPeriapsisAltitude.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Periapsis altitude");
+    }
+
+    if ((aCelestialObjectSPtr == nullptr) || (!aCelestialObjectSPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Celestial object");
+    }
+
+    if (anApoapsisAltitude < aPeriapsisAltitude)
+    {
+        throw ostk::core::error::RuntimeError(
+            "Apoapsis altitude [{}] lower than periapsis altitude [{}].",
+            anApoapsisAltitude.toString(),
+            aPeriapsisAltitude.toString()
+        );
+    }
+
+    const Real r_a = aCelestialObjectSPtr->getEquatorialRadius().inMeters() + anApoapsisAltitude.inMeters();
+    const Real r_p = aCelestialObjectSPtr->getEquatorialRadius().inMeters() + aPeriapsisAltitude.inMeters();
+
+    const Real eccentricity = (r_a - r_p) / (r_a + r_p);
+    const Length semiMajorAxis = Length::Meters(r_a / (1.0 + eccentricity));
+    const Angle inclination = Angle::Zero();
+    const Angle raan = Angle::Zero();
     const Angle aop = Angle::Zero();
     const Angle trueAnomaly = Angle::Zero();
 
@@ -969,6 +1513,136 @@ Orbit Orbit::GeoSynchronous(
     return {orbitalModel, aCelestialObjectSPtr};
 }
 
+// Sun-synchronous orbit design helpers, shared by the single and batch constructors
+
+static Angle CalculateSunSynchronousInclination(const Length& aSemiMajorAxis, const Celestial& aCelestialObject)
+{
+    /// @ref Capderou M., Handbook of Satellite Orbits: From Kepler to GPS, p.292
+
+    const Real a = aSemiMajorAxis.inMeters();
+    const Real R = aCelestialObject.getEquatorialRadius().inMeters();
+    const Real mu = aCelestialObject.getGravitationalParameter().in(GravitationalParameterSIUnit);
+    const Real j2 = aCelestialObject.getJ2();
+
+    const Real T_sid = 31558149.504;                                                 // [s] Sidereal year
+    const Real k_h = 3.0 / (4.0 * M_PI) * j2 * std::sqrt(mu / (R * R * R)) * T_sid;  // Sun-synchronicity constant
+
+    return Angle::Radians(std::acos(-1.0 / k_h * std::pow((a / R), (7.0 / 2.0))));
+}
+
+static Angle CalculateEquationOfTime(const Instant& anInstant)
+{
+    const Real julianDate = anInstant.getJulianDate(Scale::UTC);
+
+    // Julian Date of J2000.0
+
+    static const Real julianDate_J2000 = 2451545.0;
+
+    // Number of Julian centuries from J2000.0
+
+    const Real T_UT1 = (julianDate - julianDate_J2000) / 36525.0;
+
+    // Mean longitude of the Sun
+
+    const Real sunMeanLongitude_deg = std::fmod(280.460 + 36000.771 * T_UT1, 360.0);
+
+    // Mean anomaly of the Sun
+
+    const Real sunMeanAnomaly_rad = Angle::Degrees(std::fmod(357.5291092 + 35999.05034 * T_UT1, 360.0)).inRadians();
+
+    // Ecliptic latitude of the Sun
+
+    const Real sunEclipticLatitude_rad =
+        Angle::Degrees(std::fmod(
+                           sunMeanLongitude_deg + 1.914666471 * std::sin(sunMeanAnomaly_rad) +
+                               0.019994643 * std::sin(2.0 * sunMeanAnomaly_rad),
+                           360.0
+                       ))
+            .inRadians();
+
+    // Compute the equation of time
+
+    const Real equationOfTime_deg =
+        -1.914666471 * std::sin(sunMeanAnomaly_rad) - 0.019994643 * std::sin(2.0 * sunMeanAnomaly_rad) +
+        2.466 * std::sin(2.0 * sunEclipticLatitude_rad) - 0.0053 * std::sin(4.0 * sunEclipticLatitude_rad);
+
+    return Angle::Degrees(equationOfTime_deg);
+}
+
+static Angle CalculateMeanSolarTime(const Instant& anEpoch)
+{
+    Sun sun = Sun::Default();  // [TBM] This is a temporary solution
+
+    // Sun direction in GCRF
+
+    const Vector3d sunDirection_GCRF = sun.getPositionIn(Frame::GCRF(), anEpoch).getCoordinates().normalized();
+
+    // Sun Apparent Local Time (right ascension of the Sun in GCRF)
+    // https://en.wikipedia.org/wiki/Solar_time#Apparent_solar_time
+
+    const Angle apparentSolarTime = Angle::Radians(std::atan2(sunDirection_GCRF.y(), sunDirection_GCRF.x()));
+
+    // Equation of Time
+    // https://en.wikipedia.org/wiki/Equation_of_time
+
+    const Angle equationOfTime = CalculateEquationOfTime(anEpoch);
+
+    // Sun Mean Local Time
+    // https://en.wikipedia.org/wiki/Solar_time#Mean_solar_time
+
+    return apparentSolarTime + equationOfTime;
+}
+
+static Angle CalculateSunSynchronousRaan(const Angle& aMeanSolarTime, const Time& aLocalTimeAtDescendingNode)
+{
+    const Time localTimeAtAscendingNode = {
+        Uint8((aLocalTimeAtDescendingNode.getHour() + 12) % 24),
+        aLocalTimeAtDescendingNode.getMinute(),
+        aLocalTimeAtDescendingNode.getSecond(),
+        aLocalTimeAtDescendingNode.getMillisecond(),
+        aLocalTimeAtDescendingNode.getMicrosecond(),
+        aLocalTimeAtDescendingNode.getNanosecond()
+    };
+
+    const Real localTime = (localTimeAtAscendingNode.getHour() / 1.0) + (localTimeAtAscendingNode.getMinute() / 60.0) +
+                           (localTimeAtAscendingNode.getSecond() / 3600.0) +
+                           (localTimeAtAscendingNode.getMillisecond() / (3600.0 * 1e3)) +
+                           (localTimeAtAscendingNode.getMicrosecond() / (3600.0 * 1e6)) +
+                           (localTimeAtAscendingNode.getNanosecond() / (3600.0 * 1e9));
+
+    // Desired angle between the Sun and the ascending node
+
+    const Angle alpha = Angle::Degrees((localTime - 12.0) / 12.0 * 180.0);
+
+    // Right Ascension of the Ascending Node
+
+    return Angle::Radians(std::fmod(aMeanSolarTime.inRadians() + alpha.inRadians(), Real::TwoPi()));
+}
+
+static Orbit SunSynchronousOrbit(
+    const Instant& anEpoch,
+    const Length& anAltitude,
+    const Angle& aRaan,
+    const Shared<const Celestial>& aCelestialObjectSPtr,
+    const Angle& anArgumentOfLatitude
+)
+{
+    const Length semiMajorAxis = aCelestialObjectSPtr->getEquatorialRadius() + anAltitude;
+    const Real eccentricity = 0.0;
+    const Angle inclination = CalculateSunSynchronousInclination(semiMajorAxis, (*aCelestialObjectSPtr));
+    const Angle aop = Angle::Zero();
+    const Angle trueAnomaly = anArgumentOfLatitude - aop;
+
+    const COE coe = {semiMajorAxis, eccentricity, inclination, aRaan, aop, trueAnomaly};
+
+    const Kepler orbitalModel = {coe, anEpoch, (*aCelestialObjectSPtr), Kepler::PerturbationType::J2, false};
+
+    // [TBM] STK propagates SSOs in the TrueOfOrbitEpoch (true equator and true equinox of the Earth at the orbit epoch)
+    // frame, most likely to preserve the J2 symmetry around the true Z-axis (true equator normal).
+
+    return {orbitalModel, aCelestialObjectSPtr};
+}
+
 Orbit Orbit::SunSynchronous(
     const Instant& anEpoch,
     const Length& anAltitude,
@@ -1002,127 +1676,190 @@ Orbit Orbit::SunSynchronous(
         throw ostk::core::error::runtime::Undefined("Argument of latitude");
     }
 
-    const auto calculateSunSynchronousInclination = [&aCelestialObjectSPtr](const Length& aSemiMajorAxis) -> Angle
-    {
-        /// @ref Capderou M., Handbook of Satellite Orbits: From Kepler to GPS, p.292
-
-        const Real a = aSemiMajorAxis.inMeters();
-        const Real R = aCelestialObjectSPtr->getEquatorialRadius().inMeters();
-        const Real mu = aCelestialObjectSPtr->getGravitationalParameter().in(GravitationalParameterSIUnit);
-        const Real j2 = aCelestialObjectSPtr->getJ2();
+    const Angle raan = CalculateSunSynchronousRaan(CalculateMeanSolarTime(anEpoch), aLocalTimeAtDescendingNode);
 
-        const Real T_sid = 31558149.504;                                                 // [s] Sidereal year
-        const Real k_h = 3.0 / (4.0 * M_PI) * j2 * std::sqrt(mu / (R * R * R)) * T_sid;  // Sun-synchronicity constant
+    return SunSynchronousOrbit(anEpoch, anAltitude, raan, aCelestialObjectSPtr, anArgumentOfLatitude);
+}
 
-        return Angle::Radians(std::acos(-1.0 / k_h * std::pow((a / R), (7.0 / 2.0))));
-    };
+Array<Orbit> Orbit::SunSynchronous(
+    const Instant& anEpoch,
+    const Array<Length>& anAltitudeArray,
+    const Array<Time>& aLocalTimeAtDescendingNodeArray,
+    const Shared<const Celestial>& aCelestialObjectSPtr,
+    const Angle& anArgumentOfLatitude
+)
+{
+    if (!anEpoch.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Epoch");
+    }
 
-    const auto calculateEquationOfTime = [](const Instant& anInstant) -> Angle
+    if (anAltitudeArray.getSize() != aLocalTimeAtDescendingNodeArray.getSize())
     {
-        const Real julianDate = anInstant.getJulianDate(Scale::UTC);
+        throw ostk::core::error::RuntimeError(
+            "Altitude array size [{}] different from LTDN array size [{}].",
+            anAltitudeArray.getSize(),
+            aLocalTimeAtDescendingNodeArray.getSize()
+        );
+    }
 
-        // Julian Date of J2000.0
+    if ((aCelestialObjectSPtr == nullptr) || (!aCelestialObjectSPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Celestial object");
+    }
 
-        static const Real julianDate_J2000 = 2451545.0;
+    if (!anArgumentOfLatitude.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Argument of latitude");
+    }
 
-        // Number of Julian centuries from J2000.0
+    // The Sun position and the equation of time only depend on the epoch, hence are computed once
 
-        const Real T_UT1 = (julianDate - julianDate_J2000) / 36525.0;
+    const Angle meanSolarTime = CalculateMeanSolarTime(anEpoch);
 
-        // Mean longitude of the Sun
+    Array<Orbit> orbits = Array<Orbit>::Empty();
+    orbits.reserve(anAltitudeArray.getSize());
 
-        const Real sunMeanLongitude_deg = std::fmod(280.460 + 36000.771 * T_UT1, 360.0);
+    for (Index index = 0; index < anAltitudeArray.getSize(); ++index)
+    {
+        if (!anAltitudeArray[index].isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Altitude");
+        }
 
-        // Mean anomaly of the Sun
+        if (!aLocalTimeAtDescendingNodeArray[index].isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("LTDN");
+        }
 
-        const Real sunMeanAnomaly_rad = Angle::Degrees(std::fmod(357.5291092 + 35999.05034 * T_UT1, 360.0)).inRadians();
+        const Angle raan = CalculateSunSynchronousRaan(meanSolarTime, aLocalTimeAtDescendingNodeArray[index]);
 
-        // Ecliptic latitude of the Sun
+        orbits.add(
+            SunSynchronousOrbit(anEpoch, anAltitudeArray[index], raan, aCelestialObjectSPtr, anArgumentOfLatitude)
+        );
+    }
 
-        const Real sunEclipticLatitude_rad =
-            Angle::Degrees(std::fmod(
-                               sunMeanLongitude_deg + 1.914666471 * std::sin(sunMeanAnomaly_rad) +
-                                   0.019994643 * std::sin(2.0 * sunMeanAnomaly_rad),
-                               360.0
-                           ))
-                .inRadians();
+    return orbits;
+}
 
-        // Compute the equation of time
+Orbit Orbit::RepeatGroundTrack(
+    const Instant& anEpoch,
+    const Integer& aRevolutionCount,
+    const Integer& aDayCount,
+    const Angle& anInclination,
+    const Shared<const Celestial>& aCelestialObjectSPtr,
+    const Angle& aRaan,
+    const Angle& anArgumentOfLatitude
+)
+{
+    if (!anEpoch.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Epoch");
+    }
 
-        const Real equationOfTime_deg =
-            -1.914666471 * std::sin(sunMeanAnomaly_rad) - 0.019994643 * std::sin(2.0 * sunMeanAnomaly_rad) +
-            2.466 * std::sin(2.0 * sunEclipticLatitude_rad) - 0.0053 * std::sin(4.0 * sunEclipticLatitude_rad);
+    if ((!aRevolutionCount.isDefined()) || (aRevolutionCount <= 0))
+    {
+        throw ostk::core::error::runtime::Wrong("Revolution count");
+    }
 
-        return Angle::Degrees(equationOfTime_deg);
-    };
+    if ((!aDayCount.isDefined()) || (aDayCount <= 0))
+    {
+        throw ostk::core::error::runtime::Wrong("Day count");
+    }
 
-    const auto calculateRaan = [calculateEquationOfTime, &anEpoch](const Time& aLocalTimeAtAscendingNode) -> Angle
+    if (!anInclination.isDefined())
     {
-        const Real localTime = (aLocalTimeAtAscendingNode.getHour() / 1.0) +
-                               (aLocalTimeAtAscendingNode.getMinute() / 60.0) +
-                               (aLocalTimeAtAscendingNode.getSecond() / 3600.0) +
-                               (aLocalTimeAtAscendingNode.getMillisecond() / (3600.0 * 1e3)) +
-                               (aLocalTimeAtAscendingNode.getMicrosecond() / (3600.0 * 1e6)) +
-                               (aLocalTimeAtAscendingNode.getNanosecond() / (3600.0 * 1e9));
+        throw ostk::core::error::runtime::Undefined("Inclination");
+    }
 
-        Sun sun = Sun::Default();  // [TBM] This is a temporary solution
+    if ((aCelestialObjectSPtr == nullptr) || (!aCelestialObjectSPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Celestial object");
+    }
 
-        // Sun direction in GCRF
+    if (!aRaan.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("RAAN");
+    }
 
-        const Vector3d sunDirection_GCRF = sun.getPositionIn(Frame::GCRF(), anEpoch).getCoordinates().normalized();
+    if (!anArgumentOfLatitude.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Argument of latitude");
+    }
 
-        // Desired angle between the Sun and the ascending node
+    if (aCelestialObjectSPtr->getType() != Celestial::Type::Earth)
+    {
+        throw ostk::core::error::runtime::ToBeImplemented(
+            "Repeat ground track orbits currently not suppported for celestial bodies other than Earth"
+        );
+    }
 
-        const Angle alpha = Angle::Degrees((localTime - 12.0) / 12.0 * 180.0);
+    // [TBI] Add a way to get the rotation rate of each planet to generalize this
+    static const Real earthRotationRate_rad_s = 7.292115146706979e-5;
 
-        // Sun Apparent Local Time (right ascension of the Sun in GCRF)
-        // https://en.wikipedia.org/wiki/Solar_time#Apparent_solar_time
+    const Real mu = aCelestialObjectSPtr->getGravitationalParameter().in(GravitationalParameterSIUnit);
+    const Real R = aCelestialObjectSPtr->getEquatorialRadius().inMeters();
+    const Real j2 = aCelestialObjectSPtr->getJ2();
 
-        const Angle apparentSolarTime = Angle::Radians(std::atan2(sunDirection_GCRF.y(), sunDirection_GCRF.x()));
+    const Real cosInclination = std::cos(anInclination.inRadians());
+    const Real sinInclinationSquared = 1.0 - cosInclination * cosInclination;
 
-        // Equation of Time
-        // https://en.wikipedia.org/wiki/Equation_of_time
+    const Real revolutionCount = Real::Integer(aRevolutionCount);
+    const Real dayCount = Real::Integer(aDayCount);
 
-        const Angle equationOfTime = calculateEquationOfTime(anEpoch);
+    // The ground track repeats when the satellite completes the revolutions (nodal periods) in the time it takes the
+    // Earth to complete the days relative to the orbit plane: N * (dM/dt + dw/dt) = D * (w_E - dRAAN/dt). Secular
+    // rates are those of the J2 Kepler model, for a circular orbit.
 
-        // Sun Mean Local Time
-        // https://en.wikipedia.org/wiki/Solar_time#Mean_solar_time
+    const auto repeatCondition = [&](const double& aSemiMajorAxis) -> double
+    {
+        const Real n = std::sqrt(mu / (aSemiMajorAxis * aSemiMajorAxis * aSemiMajorAxis));
 
-        const Angle meanSolarTime = apparentSolarTime + equationOfTime;
+        const Real expr = (3.0 / 2.0) * j2 * std::pow((R / aSemiMajorAxis), 2);
 
-        // Right Ascension of the Ascending Node
+        const Real n_bar = n * (1.0 + expr * (1.0 - (3.0 / 2.0) * sinInclinationSquared));
 
-        const Angle raan = Angle::Radians(std::fmod(meanSolarTime.inRadians() + alpha.inRadians(), Real::TwoPi()));
+        const Real aop_dot = expr * (2.0 - (5.0 / 2.0) * sinInclinationSquared) * n_bar;
+        const Real raan_dot = -(expr * cosInclination * n_bar);
 
-        return raan;
+        return revolutionCount * (n_bar + aop_dot) - dayCount * (earthRotationRate_rad_s - raan_dot);
     };
 
-    const auto calculateLocalTimeAtAscendingNode = [&aLocalTimeAtDescendingNode]() -> Time
+    // Closed-form initial guess, from the unperturbed condition N * n = D * w_E. The J2 correction is well below a
+    // percent of the semi-major axis, hence within the bracket.
+
+    const Real initialGuess_m = std::cbrt(mu / std::pow(revolutionCount / dayCount * earthRotationRate_rad_s, 2));
+
+    const double lowerBound_m = initialGuess_m * 0.95;
+    const double upperBound_m = initialGuess_m * 1.05;
+
+    if ((lowerBound_m <= R) || ((repeatCondition(lowerBound_m) * repeatCondition(upperBound_m)) > 0.0))
     {
-        return {
-            Uint8((aLocalTimeAtDescendingNode.getHour() + 12) % 24),
-            aLocalTimeAtDescendingNode.getMinute(),
-            aLocalTimeAtDescendingNode.getSecond(),
-            aLocalTimeAtDescendingNode.getMillisecond(),
-            aLocalTimeAtDescendingNode.getMicrosecond(),
-            aLocalTimeAtDescendingNode.getNanosecond()
-        };
-    };
+        throw ostk::core::error::RuntimeError(
+            "Cannot find repeat ground track orbit with [{}] revolutions in [{}] days.",
+            aRevolutionCount.toString(),
+            aDayCount.toString()
+        );
+    }
 
-    const Length semiMajorAxis = aCelestialObjectSPtr->getEquatorialRadius() + anAltitude;
+    static const RootSolver repeatGroundTrackRootSolver = {100, 1e-6};
+
+    const RootSolver::Solution solution = repeatGroundTrackRootSolver.itp(repeatCondition, lowerBound_m, upperBound_m);
+
+    if (!solution.hasConverged)
+    {
+        throw ostk::core::error::RuntimeError("Repeat ground track solver did not converge.");
+    }
+
+    const Length semiMajorAxis = Length::Meters(solution.root);
     const Real eccentricity = 0.0;
-    const Angle inclination = calculateSunSynchronousInclination(semiMajorAxis);
-    const Angle raan = calculateRaan(calculateLocalTimeAtAscendingNode());
     const Angle aop = Angle::Zero();
     const Angle trueAnomaly = anArgumentOfLatitude - aop;
 
-    const COE coe = {semiMajorAxis, eccentricity, inclination, raan, aop, trueAnomaly};
+    const COE coe = {semiMajorAxis, eccentricity, anInclination, aRaan, aop, trueAnomaly};
 
     const Kepler orbitalModel = {coe, anEpoch, (*aCelestialObjectSPtr), Kepler::PerturbationType::J2, false};
 
-    // [TBM] STK propagates SSOs in the TrueOfOrbitEpoch (true equator and true equinox of the Earth at the orbit epoch)
-    // frame, most likely to preserve the J2 symmetry around the true Z-axis (true equator normal).
-
     return {orbitalModel, aCelestialObjectSPtr};
 }
 
@@ -1167,7 +1904,7 @@ String Orbit::StringFromFrameType(const Orbit::FrameType& aFrameType)
 
 String Orbit::generateFrameName(const Orbit::FrameType& aFrameType) const
 {
-    return String::Format("{} @ Orbit [{}]", Orbit::StringFromFrameType(aFrameType), fmt::ptr(this));
+    return String::Format("{} @ Orbit [{}]", Orbit::StringFromFrameType(aFrameType), fmt::ptr(this->cacheSPtr_.get()));
 }
 
 Array<Pair<Index, Pass>> Orbit::ComputePasses(const Array<State>& aStateArray, const Integer& anInitialRevolutionNumber)
@@ -1222,7 +1959,7 @@ Array<Pair<Index, Pass>> Orbit::ComputePasses(const Array<State>& aStateArray, c
     Integer revolutionNumber = anInitialRevolutionNumber;
 
     Instant previousPassEndInstant =
-        (Real(aStateArray.accessFirst().getPosition().accessCoordinates().z()).isNear(0.0, epsilon))
+        (Real(aStateArray.accessFirst().accessPositionCoordinates().z()).isNear(0.0, epsilon))
             ? aStateArray.accessFirst().accessInstant()
             : Instant::Undefined();
     Instant northPointCrossing = Instant::Undefined();
@@ -1236,8 +1973,8 @@ Array<Pair<Index, Pass>> Orbit::ComputePasses(const Array<State>& aStateArray, c
         {
             const Vector3d previousPositionCoordinates_ECI = previousStatePtr->getPosition().accessCoordinates();
             const Vector3d previousVelocityCoordinates_ECI = previousStatePtr->getVelocity().accessCoordinates();
-            const Vector3d currentPositionCoordinates_ECI = state.getPosition().accessCoordinates();
-            const Vector3d currentVelocityCoordinates_ECI = state.getVelocity().accessCoordinates();
+            const Vector3d currentPositionCoordinates_ECI = state.accessPositionCoordinates();
+            const Vector3d currentVelocityCoordinates_ECI = state.accessVelocityCoordinates();
 
             // North & South point crossings
             if (((previousVelocityCoordinates_ECI.z() > 0.0) && (currentVelocityCoordinates_ECI.z() <= 0.0)) ||
@@ -1313,6 +2050,296 @@ Array<Pair<Index, Pass>> Orbit::ComputePasses(const Array<State>& aStateArray, c
     return passMap;
 }
 
+// Crossing of a pass event, between two consecutive states of a state array
+
+struct PassCrossing
+{
+    enum class Type
+    {
+        NorthPoint,
+        SouthPoint,
+        DescendingNode,
+        PassBreak
+    };
+
+    Index stateIndex;  // Index of the state ending the interval
+    Type type;
+    Instant instant;
+};
+
+// Locates the crossing of z (or of its rate) between two states, on the cubic Hermite interpolant of the states
+// positions and velocities, without evaluating any model
+
+static Instant InterpolateCrossingInstant(
+    const State& aPreviousState, const State& aCurrentState, const bool& isRateCrossing
+)
+{
+    const Instant& previousInstant = aPreviousState.accessInstant();
+
+    const double h = (aCurrentState.accessInstant() - previousInstant).inSeconds();
+
+    if (h <= 0.0)
+    {
+        return previousInstant;
+    }
+
+    const double z0 = aPreviousState.accessPositionCoordinates().z();
+    const double z1 = aCurrentState.accessPositionCoordinates().z();
+    const double zDot0 = aPreviousState.accessVelocityCoordinates().z() * h;
+    const double zDot1 = aCurrentState.accessVelocityCoordinates().z() * h;
+
+    // Interpolant and its (scaled) derivative, over the normalized interval [0, 1]
+
+    const auto getZ = [z0, z1, zDot0, zDot1](const double& s) -> double
+    {
+        const double s2 = s * s;
+        const double s3 = s2 * s;
+
+        return (2.0 * s3 - 3.0 * s2 + 1.0) * z0 + (s3 - 2.0 * s2 + s) * zDot0 + (-2.0 * s3 + 3.0 * s2) * z1 +
+               (s3 - s2) * zDot1;
+    };
+
+    const auto getZDot = [z0, z1, zDot0, zDot1](const double& s) -> double
+    {
+        const double s2 = s * s;
+
+        return (6.0 * s2 - 6.0 * s) * (z0 - z1) + (3.0 * s2 - 4.0 * s + 1.0) * zDot0 + (3.0 * s2 - 2.0 * s) * zDot1;
+    };
+
+    const RootSolver::Solution solution =
+        isRateCrossing ? rootSolver.itp(getZDot, 0.0, 1.0) : rootSolver.itp(getZ, 0.0, 1.0);
+
+    if (!solution.hasConverged)
+    {
+        throw ostk::core::error::RuntimeError("Root solver did not converge.");
+    }
+
+    return previousInstant + Duration::Seconds(solution.root * h);
+}
+
+Array<Pair<Index, Pass>> Orbit::ComputePasses(
+    const Array<State>& aStateArray,
+    const Integer& anInitialRevolutionNumber,
+    const ExecutionContext& anExecutionContext
+)
+{
+    if (!anInitialRevolutionNumber.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Initial revolution number");
+    }
+
+    if (aStateArray.getSize() < 2)
+    {
+        throw ostk::core::error::RuntimeError(
+            "Greater than 2 states required to compute passes: {}", aStateArray.getSize()
+        );
+    }
+
+    for (Index i = 1; i < aStateArray.getSize(); ++i)
+    {
+        if (aStateArray[i - 1].accessInstant() > aStateArray[i].accessInstant())
+        {
+            throw ostk::core::error::RuntimeError("States are not in chronological order.");
+        }
+    }
+
+    // Crossings are located concurrently, over chunks of consecutive intervals. A few chunks per thread balance the
+    // load, while keeping chunks long enough to amortize their scheduling.
+
+    static const Size minimumChunkIntervalCount = 1000;
+
+    const Size intervalCount = aStateArray.getSize() - 1;
+    const Size chunkIntervalCount = std::max<Size>(
+        minimumChunkIntervalCount, (intervalCount / (4 * anExecutionContext.getThreadCount())) + 1
+    );
+    const Size chunkCount = (intervalCount + chunkIntervalCount - 1) / chunkIntervalCount;
+
+    const Array<Array<PassCrossing>> chunkCrossings = anExecutionContext.map<Array<PassCrossing>>(
+        chunkCount,
+        [&aStateArray, intervalCount, chunkIntervalCount](const Index& aChunkIndex) -> Array<PassCrossing>
+        {
+            Array<PassCrossing> crossings = Array<PassCrossing>::Empty();
+
+            const Index firstStateIndex = (aChunkIndex * chunkIntervalCount) + 1;
+            const Index lastStateIndex = std::min<Index>(firstStateIndex + chunkIntervalCount, intervalCount + 1);
+
+            for (Index stateIndex = firstStateIndex; stateIndex < lastStateIndex; ++stateIndex)
+            {
+                const State& previousState = aStateArray[stateIndex - 1];
+                const State& state = aStateArray[stateIndex];
+
+                const double previousZ = previousState.accessPositionCoordinates().z();
+                const double previousZDot = previousState.accessVelocityCoordinates().z();
+                const double currentZ = state.accessPositionCoordinates().z();
+                const double currentZDot = state.accessVelocityCoordinates().z();
+
+                // Same detection, and order within an interval, as the sequential pass computation
+
+                if (((previousZDot > 0.0) && (currentZDot <= 0.0)) || ((previousZDot < 0.0) && (currentZDot >= 0.0)))
+                {
+                    crossings.add(
+                        {stateIndex,
+                         (currentZ > 0.0) ? PassCrossing::Type::NorthPoint : PassCrossing::Type::SouthPoint,
+                         InterpolateCrossingInstant(previousState, state, true)}
+                    );
+                }
+
+                if ((previousZ > 0.0) && (currentZ <= 0.0))
+                {
+                    crossings.add(
+                        {stateIndex,
+                         PassCrossing::Type::DescendingNode,
+                         InterpolateCrossingInstant(previousState, state, false)}
+                    );
+                }
+
+                if ((previousZ < 0.0) && (currentZ >= 0.0))
+                {
+                    crossings.add(
+                        {stateIndex,
+                         PassCrossing::Type::PassBreak,
+                         InterpolateCrossingInstant(previousState, state, false)}
+                    );
+                }
+            }
+
+            return crossings;
+        }
+    );
+
+    // Passes are numbered sequentially, from the crossings of all chunks
+
+    Array<Pair<Index, Pass>> passMap = Array<Pair<Index, Pass>>::Empty();
+
+    Integer revolutionNumber = anInitialRevolutionNumber;
+
+    Instant previousPassEndInstant =
+        (Real(aStateArray.accessFirst().accessPositionCoordinates().z()).isNear(0.0, epsilon))
+            ? aStateArray.accessFirst().accessInstant()
+            : Instant::Undefined();
+    Instant northPointCrossing = Instant::Undefined();
+    Instant descendingNodeCrossing = Instant::Undefined();
+    Instant southPointCrossing = Instant::Undefined();
+
+    for (const Array<PassCrossing>& crossings : chunkCrossings)
+    {
+        for (const PassCrossing& crossing : crossings)
+        {
+            switch (crossing.type)
+            {
+                case PassCrossing::Type::NorthPoint:
+                    northPointCrossing = crossing.instant;
+                    break;
+
+                case PassCrossing::Type::SouthPoint:
+                    southPointCrossing = crossing.instant;
+                    break;
+
+                case PassCrossing::Type::DescendingNode:
+                    descendingNodeCrossing = crossing.instant;
+                    break;
+
+                case PassCrossing::Type::PassBreak:
+                {
+                    const Pass pass = {
+                        revolutionNumber,
+                        previousPassEndInstant,
+                        northPointCrossing,
+                        descendingNodeCrossing,
+                        southPointCrossing,
+                        crossing.instant,
+                    };
+
+                    passMap.add({crossing.stateIndex, pass});
+
+                    revolutionNumber++;
+                    previousPassEndInstant = crossing.instant;
+
+                    northPointCrossing = Instant::Undefined();
+                    descendingNodeCrossing = Instant::Undefined();
+                    southPointCrossing = Instant::Undefined();
+
+                    break;
+                }
+            }
+        }
+    }
+
+    // Add last partial pass
+
+    const Pass pass = {
+        revolutionNumber,
+        previousPassEndInstant,
+        northPointCrossing,
+        descendingNodeCrossing,
+        southPointCrossing,
+        Instant::Undefined(),
+    };
+
+    passMap.add({aStateArray.getSize(), pass});
+
+    return passMap;
+}
+
+void Orbit::cachePasses(const Map<Integer, Pass>& aPassMap) const
+{
+    const std::unique_lock<std::shared_mutex> lock {this->cacheSPtr_->passMutex};
+
+    // Passes already cached by a concurrent query are kept as is
+
+    this->cacheSPtr_->passMap.insert(aPassMap.begin(), aPassMap.end());
+}
+
+Pass Orbit::getClosestPass(const Integer& aRevolutionNumber) const
+{
+    if (this->cacheSPtr_->passMap.empty())
+    {
+        return Pass::Undefined();
+    }
+
+    // exact revolution number exists
+
+    if (this->cacheSPtr_->passMap.count(aRevolutionNumber))
+    {
+        return this->cacheSPtr_->passMap.at(aRevolutionNumber);
+    }
+
+    const auto lowerBoundMapIt = this->cacheSPtr_->passMap.lower_bound(aRevolutionNumber);
+
+    // Revolution number is greater than any existing revolution number in map
+    // {5, 6, 9, 10} -> aRevolutionNumber=12 -> return 10
+
+    if (lowerBoundMapIt == this->cacheSPtr_->passMap.end())
+    {
+        return this->cacheSPtr_->passMap.rbegin()->second;
+    }
+
+    // Revolution number is lesser than any existing revolution number in map
+    // {5, 6, 9, 10} -> aRevolutionNumber=4 -> return 5
+
+    if (lowerBoundMapIt == this->cacheSPtr_->passMap.begin())
+    {
+        return this->cacheSPtr_->passMap.begin()->second;
+    }
+
+    // Closest revolution number is within the map
+
+    const auto closestPassMapIt = std::prev(lowerBoundMapIt);
+
+    // {5, 6, 9, 10} -> aRevolutionNumber=7 -> return 6
+    // lowerBoundMapIt = 9, closestPassMapIt = 6
+
+    if ((aRevolutionNumber - closestPassMapIt->first) < (lowerBoundMapIt->first - aRevolutionNumber))
+    {
+        return closestPassMapIt->second;
+    }
+
+    // {5, 6, 9, 10} -> aRevolutionNumber=8 -> return 9
+    // lowerBoundMapIt = 9, closestPassMapIt = 6
+
+    return lowerBoundMapIt->second;
+}
+
 Instant Orbit::GetCrossingInstant(
     const Instant& anEpoch,
     const Instant& previousInstant,
@@ -1321,7 +2348,7 @@ Instant Orbit::GetCrossingInstant(
 )
 {
     const RootSolver::Solution solution =
-        rootSolver.bisection(getValue, (previousInstant - anEpoch).inSeconds(), (currentInstant - anEpoch).inSeconds());
+        rootSolver.itp(getValue, (previousInstant - anEpoch).inSeconds(), (currentInstant - anEpoch).inSeconds());
 
     if (!solution.hasConverged)
     {
@@ -0,0 +1,842 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IAU/Theory.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Velocity.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Message/CCSDS/OEM.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace trajectory
+{
+namespace orbit
+{
+namespace message
+{
+namespace ccsds
+{
+
+namespace
+{
+
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::frame::provider::iau::Theory;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Velocity;
+using ostk::physics::time::DateTime;
+
+std::string_view Trim(const std::string_view& aString)
+{
+    const std::size_t start = aString.find_first_not_of(" \t\r");
+
+    if (start == std::string_view::npos)
+    {
+        return aString.substr(0, 0);
+    }
+
+    const std::size_t end = aString.find_last_not_of(" \t\r");
+
+    return aString.substr(start, end - start + 1);
+}
+
+// Split a KEY = value line, dropping the unit if any
+
+bool SplitKeyValue(const std::string_view& aLine, std::string_view& aKey, std::string_view& aValue)
+{
+    const std::size_t separatorPosition = aLine.find('=');
+
+    if (separatorPosition == std::string_view::npos)
+    {
+        return false;
+    }
+
+    aKey = Trim(aLine.substr(0, separatorPosition));
+    aValue = Trim(aLine.substr(separatorPosition + 1));
+
+    if ((!aValue.empty()) && (aValue.back() == ']'))
+    {
+        const std::size_t unitStart = aValue.rfind('[');
+
+        if (unitStart != std::string_view::npos)
+        {
+            aValue = Trim(aValue.substr(0, unitStart));
+        }
+    }
+
+    return true;
+}
+
+Shared<const Frame> FrameFromName(const String& aFrameName)
+{
+    if ((aFrameName == "GCRF") || (aFrameName == "ICRF"))
+    {
+        return Frame::GCRF();
+    }
+
+    if (aFrameName == "EME2000")
+    {
+        return Frame::J2000(Theory::IAU_2006);
+    }
+
+    if (aFrameName.substr(0, 4) == "ITRF")  // ITRF, ITRF2000, ITRF-93, ...
+    {
+        return Frame::ITRF();
+    }
+
+    if (aFrameName == "TEME")
+    {
+        return Frame::TEME();
+    }
+
+    throw ostk::core::error::runtime::Wrong("OEM reference frame", aFrameName);
+}
+
+Scale ScaleFromName(const String& aTimeSystemName)
+{
+    if (aTimeSystemName == "UTC")
+    {
+        return Scale::UTC;
+    }
+
+    if (aTimeSystemName == "TAI")
+    {
+        return Scale::TAI;
+    }
+
+    if (aTimeSystemName == "TT")
+    {
+        return Scale::TT;
+    }
+
+    if (aTimeSystemName == "GPS")
+    {
+        return Scale::GPST;
+    }
+
+    if (aTimeSystemName == "TDB")
+    {
+        return Scale::TDB;
+    }
+
+    if (aTimeSystemName == "TCB")
+    {
+        return Scale::TCB;
+    }
+
+    if (aTimeSystemName == "TCG")
+    {
+        return Scale::TCG;
+    }
+
+    if (aTimeSystemName == "UT1")
+    {
+        return Scale::UT1;
+    }
+
+    throw ostk::core::error::runtime::Wrong("OEM time system", aTimeSystemName);
+}
+
+// Fast path for the calendar layout (YYYY-MM-DDTHH:MM:SS[.fffffffff]), other layouts go through the generic parser
+
+Instant ParseEpoch(const std::string_view& anEpochString, const Scale& aScale)
+{
+    const auto readDigits = [&anEpochString](const std::size_t& aStart, const std::size_t& aCount, int& aResult) -> bool
+    {
+        aResult = 0;
+
+        for (std::size_t idx = aStart; idx < (aStart + aCount); ++idx)
+        {
+            if ((anEpochString[idx] < '0') || (anEpochString[idx] > '9'))
+            {
+                return false;
+            }
+
+            aResult = aResult * 10 + (anEpochString[idx] - '0');
+        }
+
+        return true;
+    };
+
+    int year = 0, month = 0, day = 0, hour = 0, minute = 0, second = 0;
+
+    bool isFixedLayout = (anEpochString.size() >= 19) && (anEpochString[4] == '-') && (anEpochString[7] == '-') &&
+                         (anEpochString[10] == 'T') && (anEpochString[13] == ':') && (anEpochString[16] == ':') &&
+                         readDigits(0, 4, year) && readDigits(5, 2, month) && readDigits(8, 2, day) &&
+                         readDigits(11, 2, hour) && readDigits(14, 2, minute) && readDigits(17, 2, second);
+
+    int fraction = 0;
+    std::size_t fractionDigitCount = 0;
+
+    if (isFixedLayout && (anEpochString.size() > 19))
+    {
+        fractionDigitCount = anEpochString.size() - 20;
+
+        if ((anEpochString[19] != '.') || (fractionDigitCount == 0) || (fractionDigitCount > 9) ||
+            (!readDigits(20, fractionDigitCount, fraction)))
+        {
+            isFixedLayout = false;
+        }
+    }
+
+    if (!isFixedLayout)
+    {
+        return Instant::DateTime(
+            DateTime::Parse(String(std::string(anEpochString)), DateTime::Format::ISO8601), aScale
+        );
+    }
+
+    for (std::size_t idx = fractionDigitCount; idx < 9; ++idx)
+    {
+        fraction *= 10;
+    }
+
+    return Instant::DateTime(
+        DateTime(
+            year,
+            month,
+            day,
+            hour,
+            minute,
+            second,
+            fraction / 1000000,
+            (fraction / 1000) % 1000,
+            fraction % 1000
+        ),
+        aScale
+    );
+}
+
+std::string FormatEpoch(const Instant& anInstant, const Scale& aScale)
+{
+    const DateTime dateTime = anInstant.getDateTime(aScale);
+
+    char buffer[64];
+
+    std::snprintf(
+        buffer,
+        sizeof(buffer),
+        "%04d-%02d-%02dT%02d:%02d:%02d.%03d%03d%03d",
+        static_cast<int>(dateTime.accessDate().getYear()),
+        static_cast<int>(dateTime.accessDate().getMonth()),
+        static_cast<int>(dateTime.accessDate().getDay()),
+        static_cast<int>(dateTime.accessTime().getHour()),
+        static_cast<int>(dateTime.accessTime().getMinute()),
+        static_cast<int>(dateTime.accessTime().getSecond()),
+        static_cast<int>(dateTime.accessTime().getMillisecond()),
+        static_cast<int>(dateTime.accessTime().getMicrosecond()),
+        static_cast<int>(dateTime.accessTime().getNanosecond())
+    );
+
+    return buffer;
+}
+
+void AppendKeyValue(std::string& aBuffer, const std::string_view& aKey, const std::string_view& aValue)
+{
+    aBuffer.append(aKey);
+    aBuffer.append(" = ");
+    aBuffer.append(aValue);
+    aBuffer.push_back('\n');
+}
+
+}  // namespace
+
+OEM::Writer::Writer(const File& aFile, const OEM::Header& aHeader, const Size& aChunkSize)
+    : stream_(),
+      buffer_(),
+      chunkSize_(std::max<Size>(1, aChunkSize)),
+      bufferedStateCount_(0),
+      frameSPtr_(nullptr),
+      scale_(Scale::UTC)
+{
+    if (!aFile.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("File");
+    }
+
+    if (!aHeader.creationDate.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Creation date");
+    }
+
+    stream_.open(aFile.getPath().toString(), std::ios::out | std::ios::trunc);
+
+    if (!stream_.is_open())
+    {
+        throw ostk::core::error::RuntimeError("Cannot open file [{}].", aFile.toString());
+    }
+
+    AppendKeyValue(buffer_, "CCSDS_OEM_VERS", aHeader.version.isEmpty() ? "2.0" : aHeader.version.data());
+    AppendKeyValue(buffer_, "CREATION_DATE", FormatEpoch(aHeader.creationDate, Scale::UTC));
+    AppendKeyValue(buffer_, "ORIGINATOR", aHeader.originator);
+
+    this->flush();
+}
+
+OEM::Writer::~Writer()
+{
+    try
+    {
+        this->close();
+    }
+    catch (...)
+    {
+    }
+}
+
+bool OEM::Writer::isOpen() const
+{
+    return stream_.is_open();
+}
+
+void OEM::Writer::writeMetadata(const OEM::Metadata& aMetadata)
+{
+    if (!this->isOpen())
+    {
+        throw ostk::core::error::RuntimeError("OEM writer is closed.");
+    }
+
+    if ((!aMetadata.startTime.isDefined()) || (!aMetadata.stopTime.isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Metadata");
+    }
+
+    frameSPtr_ = FrameFromName(aMetadata.referenceFrame);
+    scale_ = ScaleFromName(aMetadata.timeSystem);
+
+    buffer_.append("\nMETA_START\n");
+    AppendKeyValue(buffer_, "OBJECT_NAME", aMetadata.objectName);
+    AppendKeyValue(buffer_, "OBJECT_ID", aMetadata.objectId);
+    AppendKeyValue(buffer_, "CENTER_NAME", aMetadata.centerName);
+    AppendKeyValue(buffer_, "REF_FRAME", aMetadata.referenceFrame);
+    AppendKeyValue(buffer_, "TIME_SYSTEM", aMetadata.timeSystem);
+    AppendKeyValue(buffer_, "START_TIME", FormatEpoch(aMetadata.startTime, scale_));
+    AppendKeyValue(buffer_, "STOP_TIME", FormatEpoch(aMetadata.stopTime, scale_));
+    buffer_.append("META_STOP\n\n");
+
+    this->flush();
+}
+
+void OEM::Writer::write(const State& aState)
+{
+    if (frameSPtr_ == nullptr)
+    {
+        throw ostk::core::error::runtime::Undefined("Metadata");
+    }
+
+    if (!this->isOpen())
+    {
+        throw ostk::core::error::RuntimeError("OEM writer is closed.");
+    }
+
+    const State state = aState.inFrame(frameSPtr_);
+
+    const Vector3d position = state.getPosition().getCoordinates() / 1e3;
+    const Vector3d velocity = state.getVelocity().getCoordinates() / 1e3;
+
+    char buffer[256];
+
+    std::snprintf(
+        buffer,
+        sizeof(buffer),
+        " %.6f %.6f %.6f %.9f %.9f %.9f\n",
+        position.x(),
+        position.y(),
+        position.z(),
+        velocity.x(),
+        velocity.y(),
+        velocity.z()
+    );
+
+    buffer_.append(FormatEpoch(state.accessInstant(), scale_));
+    buffer_.append(buffer);
+
+    if (++bufferedStateCount_ >= chunkSize_)
+    {
+        this->flush();
+    }
+}
+
+void OEM::Writer::write(const Array<State>& aStateArray)
+{
+    for (const State& state : aStateArray)
+    {
+        this->write(state);
+    }
+}
+
+void OEM::Writer::write(const Propagator& aPropagator, const State& aState, const Array<Instant>& anInstantArray)
+{
+    // Propagate chunk by chunk, restarting from the last propagated state
+
+    State state = aState;
+
+    for (Index chunkStart = 0; chunkStart < anInstantArray.getSize(); chunkStart += chunkSize_)
+    {
+        const Index chunkEnd = std::min<Index>(chunkStart + chunkSize_, anInstantArray.getSize());
+
+        Array<Instant> instants = Array<Instant>::Empty();
+        instants.insert(instants.end(), anInstantArray.begin() + chunkStart, anInstantArray.begin() + chunkEnd);
+
+        const Array<State> states = aPropagator.calculateStatesAt(state, instants);
+
+        this->write(states);
+
+        state = states.accessLast();
+    }
+}
+
+void OEM::Writer::close()
+{
+    if (!this->isOpen())
+    {
+        return;
+    }
+
+    this->flush();
+
+    stream_.close();
+}
+
+void OEM::Writer::flush()
+{
+    stream_.write(buffer_.data(), buffer_.size());
+    stream_.flush();
+
+    if (!stream_)
+    {
+        throw ostk::core::error::RuntimeError("Cannot write OEM.");
+    }
+
+    buffer_.clear();
+    bufferedStateCount_ = 0;
+}
+
+OEM::Reader::Reader(const File& aFile)
+    : stream_(),
+      path_(String::Empty()),
+      lineIndex_(0),
+      header_({String::Empty(), Instant::Undefined(), String::Empty()}),
+      metadata_({
+          String::Empty(),
+          String::Empty(),
+          String::Empty(),
+          String::Empty(),
+          String::Empty(),
+          Instant::Undefined(),
+          Instant::Undefined(),
+      }),
+      frameSPtr_(nullptr),
+      scale_(Scale::UTC),
+      hasMetadata_(false),
+      isSegmentExhausted_(true),
+      isMetadataPending_(false)
+{
+    if (!aFile.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("File");
+    }
+
+    if (!aFile.exists())
+    {
+        throw ostk::core::error::RuntimeError("File [{}] does not exist.", aFile.toString());
+    }
+
+    path_ = aFile.getPath().toString();
+
+    stream_.open(path_);
+
+    if (!stream_.is_open())
+    {
+        throw ostk::core::error::RuntimeError("Cannot open file [{}].", path_);
+    }
+
+    std::string line;
+
+    while (this->readLine(line))
+    {
+        if (line == "META_START")
+        {
+            isMetadataPending_ = true;
+            break;
+        }
+
+        std::string_view key;
+        std::string_view value;
+
+        if (!SplitKeyValue(line, key, value))
+        {
+            throw ostk::core::error::runtime::Wrong("OEM header line", String::Format("{}", lineIndex_));
+        }
+
+        if (key == "CCSDS_OEM_VERS")
+        {
+            header_.version = std::string(value);
+        }
+        else if (key == "CREATION_DATE")
+        {
+            header_.creationDate = ParseEpoch(value, Scale::UTC);
+        }
+        else if (key == "ORIGINATOR")
+        {
+            header_.originator = std::string(value);
+        }
+    }
+
+    if (header_.version.isEmpty())
+    {
+        throw ostk::core::error::runtime::Wrong("OEM header");
+    }
+}
+
+OEM::Header OEM::Reader::getHeader() const
+{
+    return header_;
+}
+
+OEM::Metadata OEM::Reader::getMetadata() const
+{
+    if (!hasMetadata_)
+    {
+        throw ostk::core::error::runtime::Undefined("Metadata");
+    }
+
+    return metadata_;
+}
+
+bool OEM::Reader::readMetadata()
+{
+    std::string line;
+
+    while (!isMetadataPending_)
+    {
+        if (!this->readLine(line))
+        {
+            hasMetadata_ = false;
+            isSegmentExhausted_ = true;
+
+            return false;
+        }
+
+        isMetadataPending_ = (line == "META_START");
+    }
+
+    OEM::Metadata metadata = {
+        String::Empty(),
+        String::Empty(),
+        String::Empty(),
+        String::Empty(),
+        String::Empty(),
+        Instant::Undefined(),
+        Instant::Undefined(),
+    };
+
+    std::string startTime;
+    std::string stopTime;
+
+    bool isMetadataComplete = false;
+
+    while (this->readLine(line))
+    {
+        if (line == "META_STOP")
+        {
+            isMetadataComplete = true;
+            break;
+        }
+
+        std::string_view key;
+        std::string_view value;
+
+        if (!SplitKeyValue(line, key, value))
+        {
+            throw ostk::core::error::runtime::Wrong("OEM metadata line", String::Format("{}", lineIndex_));
+        }
+
+        if (key == "OBJECT_NAME")
+        {
+            metadata.objectName = std::string(value);
+        }
+        else if (key == "OBJECT_ID")
+        {
+            metadata.objectId = std::string(value);
+        }
+        else if (key == "CENTER_NAME")
+        {
+            metadata.centerName = std::string(value);
+        }
+        else if (key == "REF_FRAME")
+        {
+            metadata.referenceFrame = std::string(value);
+        }
+        else if (key == "TIME_SYSTEM")
+        {
+            metadata.timeSystem = std::string(value);
+        }
+        else if (key == "START_TIME")
+        {
+            startTime = std::string(value);
+        }
+        else if (key == "STOP_TIME")
+        {
+            stopTime = std::string(value);
+        }
+    }
+
+    if (!isMetadataComplete)
+    {
+        throw ostk::core::error::runtime::Wrong("OEM metadata");
+    }
+
+    // Epochs are expressed in the segment time system, which may follow them
+
+    scale_ = ScaleFromName(metadata.timeSystem);
+    frameSPtr_ = FrameFromName(metadata.referenceFrame);
+
+    metadata.startTime = ParseEpoch(startTime, scale_);
+    metadata.stopTime = ParseEpoch(stopTime, scale_);
+
+    metadata_ = metadata;
+
+    hasMetadata_ = true;
+    isSegmentExhausted_ = false;
+    isMetadataPending_ = false;
+
+    return true;
+}
+
+Array<State> OEM::Reader::readStates(const Size& aMaximumCount)
+{
+    if (!hasMetadata_)
+    {
+        throw ostk::core::error::runtime::Undefined("Metadata");
+    }
+
+    Array<State> states = Array<State>::Empty();
+
+    std::string line;
+
+    while ((!isSegmentExhausted_) && (states.getSize() < aMaximumCount))
+    {
+        if (!this->readLine(line))
+        {
+            isSegmentExhausted_ = true;
+            break;
+        }
+
+        if (line == "META_START")
+        {
+            isSegmentExhausted_ = true;
+            isMetadataPending_ = true;
+            break;
+        }
+
+        if (line == "COVARIANCE_START")
+        {
+            while (this->readLine(line) && (line != "COVARIANCE_STOP"))
+            {
+            }
+
+            continue;
+        }
+
+        // EPOCH X Y Z X_DOT Y_DOT Z_DOT [X_DDOT Y_DDOT Z_DDOT]
+
+        const std::size_t epochEnd = line.find_first_of(" \t");
+
+        if (epochEnd == std::string::npos)
+        {
+            throw ostk::core::error::runtime::Wrong("OEM data line", String::Format("{}", lineIndex_));
+        }
+
+        double coordinates[6];
+
+        const char* cursor = line.c_str() + epochEnd;
+
+        for (double& coordinate : coordinates)
+        {
+            char* end = nullptr;
+
+            coordinate = std::strtod(cursor, &end);
+
+            if (end == cursor)
+            {
+                throw ostk::core::error::runtime::Wrong("OEM data line", String::Format("{}", lineIndex_));
+            }
+
+            cursor = end;
+        }
+
+        states.add({
+            ParseEpoch(std::string_view(line).substr(0, epochEnd), scale_),
+            Position::Meters({coordinates[0] * 1e3, coordinates[1] * 1e3, coordinates[2] * 1e3}, frameSPtr_),
+            Velocity::MetersPerSecond(
+                {coordinates[3] * 1e3, coordinates[4] * 1e3, coordinates[5] * 1e3}, frameSPtr_
+            ),
+        });
+    }
+
+    return states;
+}
+
+Tabulated OEM::Reader::readTabulated(const Interpolator::Type& anInterpolationType)
+{
+    Array<State> states = Array<State>::Empty();
+
+    for (Array<State> chunk = this->readStates(); !chunk.isEmpty(); chunk = this->readStates())
+    {
+        states.add(chunk);
+    }
+
+    return {states, anInterpolationType};
+}
+
+bool OEM::Reader::readLine(std::string& aLine)
+{
+    while (std::getline(stream_, aLine))
+    {
+        ++lineIndex_;
+
+        const std::string_view line = Trim(aLine);
+
+        if (line.empty() || (line.substr(0, 7) == "COMMENT"))
+        {
+            continue;
+        }
+
+        aLine = std::string(line);
+
+        return true;
+    }
+
+    return false;
+}
+
+OEM::OEM(const OEM::Header& aHeader, const Array<OEM::Segment>& aSegmentArray)
+    : header_(aHeader),
+      segments_(aSegmentArray)
+{
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const OEM& anOEM)
+{
+    anOEM.print(anOutputStream);
+
+    return anOutputStream;
+}
+
+bool OEM::isDefined() const
+{
+    return this->header_.creationDate.isDefined();
+}
+
+OEM::Header OEM::getHeader() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("OEM");
+    }
+
+    return this->header_;
+}
+
+Array<OEM::Segment> OEM::getSegments() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("OEM");
+    }
+
+    return this->segments_;
+}
+
+OEM::Segment OEM::getSegmentAt(const Index& anIndex) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("OEM");
+    }
+
+    return this->segments_.at(anIndex);
+}
+
+void OEM::print(std::ostream& anOutputStream, bool displayDecorator) const
+{
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Orbit Ephemeris Message") : void();
+
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Version:" << (this->header_.version.isEmpty() ? "Undefined" : this->header_.version);
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Creation date:"
+        << (this->header_.creationDate.isDefined() ? this->header_.creationDate.toString() : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Originator:" << (this->header_.originator.isEmpty() ? "Undefined" : this->header_.originator);
+    ostk::core::utils::Print::Line(anOutputStream) << "Segments:" << this->segments_.getSize();
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+void OEM::save(const File& aFile) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("OEM");
+    }
+
+    OEM::Writer writer = {aFile, this->header_};
+
+    for (const auto& segment : this->segments_)
+    {
+        writer.writeMetadata(segment.metadata);
+        writer.write(segment.states);
+    }
+
+    writer.close();
+}
+
+OEM OEM::Undefined()
+{
+    return {{String::Empty(), Instant::Undefined(), String::Empty()}, Array<OEM::Segment>::Empty()};
+}
+
+OEM OEM::Load(const File& aFile)
+{
+    OEM::Reader reader = {aFile};
+
+    Array<OEM::Segment> segments = Array<OEM::Segment>::Empty();
+
+    while (reader.readMetadata())
+    {
+        OEM::Segment segment = {reader.getMetadata(), Array<State>::Empty()};
+
+        for (Array<State> chunk = reader.readStates(); !chunk.isEmpty(); chunk = reader.readStates())
+        {
+            segment.states.add(chunk);
+        }
+
+        segments.add(segment);
+    }
+
+    return {reader.getHeader(), segments};
+}
+
+}  // namespace ccsds
+}  // namespace message
+}  // namespace orbit
+}  // namespace trajectory
+}  // namespace astrodynamics
+}  // namespace ostk
@@ -5,6 +5,7 @@
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Message/SpaceX/OPM.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Propagated.hpp>
 
 namespace ostk
 {
@@ -98,6 +99,56 @@ OPM::Deployment OPM::getDeploymentWithName(const String& aName) const
     throw ostk::core::error::RuntimeError("Deployment with name [{}] not found.", aName);
 }
 
+Array<State> OPM::toStates() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("OPM");
+    }
+
+    Array<State> states = Array<State>::Empty();
+    states.reserve(this->deployments_.getSize());
+
+    for (const auto& deployment : this->deployments_)
+    {
+        states.add(deployment.toState());
+    }
+
+    return states;
+}
+
+Array<State> OPM::calculateStatesAt(
+    const Propagator& aPropagator, const Instant& anInstant, const Size& aThreadCount
+) const
+{
+    return aPropagator.calculateStatesAt(this->toStates(), anInstant, aThreadCount);
+}
+
+Array<Orbit> OPM::generateOrbits(
+    const Propagator& aPropagator,
+    const Shared<const Celestial>& aCelestialObjectSPtr,
+    const Instant& anInstant,
+    const Size& aThreadCount
+) const
+{
+    using ostk::astrodynamics::trajectory::orbit::model::Propagated;
+
+    const Array<State> deploymentStates = this->toStates();
+    const Array<State> horizonStates = aPropagator.calculateStatesAt(deploymentStates, anInstant, aThreadCount);
+
+    Array<Orbit> orbits = Array<Orbit>::Empty();
+    orbits.reserve(deploymentStates.getSize());
+
+    for (Index index = 0; index < deploymentStates.getSize(); ++index)
+    {
+        const Propagated propagatedModel = {aPropagator, {deploymentStates[index], horizonStates[index]}};
+
+        orbits.add(Orbit(propagatedModel, aCelestialObjectSPtr));
+    }
+
+    return orbits;
+}
+
 void OPM::print(std::ostream& anOutputStream, bool displayDecorator) const
 {
     using ostk::core::type::String;
@@ -1,6 +1,11 @@
 /// Apache License 2.0
 
+#include <cmath>
+
+#include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
+
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler/COE.hpp>
 
 namespace ostk
 {
@@ -15,6 +20,96 @@ Model::Model() {}
 
 Model::~Model() {}
 
+Instant Model::estimateAscendingNodeInstant([[maybe_unused]] const Integer& aRevolutionNumber) const
+{
+    return Instant::Undefined();
+}
+
+Real Model::EstimateAscendingNodeDurationFromEpoch(
+    const Integer& aRevolutionCount,
+    const Real& anEccentricity,
+    const Real& anAop,
+    const Real& aMeanAnomaly,
+    const Real& aMeanMotion,
+    const Real& anAopRate,
+    const Real& aMeanMotionRate
+)
+{
+    using ostk::physics::unit::Angle;
+
+    using ostk::astrodynamics::trajectory::orbit::model::kepler::COE;
+
+    static const double twoPi = 2.0 * M_PI;
+    static const double tolerance = 1e-8;
+
+    const double eccentricity = anEccentricity;
+    const double aopAtEpoch_rad = anAop;
+    const double meanMotion_radSec = aMeanMotion;
+    const double aopRate_radSec = anAopRate;
+    const double halfMeanMotionRate_radSec2 = 0.5 * double(aMeanMotionRate);
+
+    // Mean anomaly at the ascending node, minus the opposite of the argument of perigee (periodic in the latter)
+
+    const auto computeEquationOfCenterAtAscendingNode = [eccentricity](const double& anAop_rad) -> double
+    {
+        const Angle eccentricAnomalyAtAscendingNode =
+            COE::EccentricAnomalyFromTrueAnomaly(Angle::Radians(-anAop_rad), eccentricity);
+        const double meanAnomalyAtAscendingNode_rad =
+            COE::MeanAnomalyFromEccentricAnomaly(eccentricAnomalyAtAscendingNode, eccentricity).inRadians();
+
+        return std::remainder(meanAnomalyAtAscendingNode_rad + anAop_rad, twoPi);
+    };
+
+    const double equationOfCenterAtEpoch_rad = computeEquationOfCenterAtAscendingNode(aopAtEpoch_rad);
+
+    // Phase elapsed since the ascending node starting the revolution at epoch (none if the epoch lies on it)
+
+    double elapsedPhase_rad = std::fmod(double(aMeanAnomaly) + aopAtEpoch_rad - equationOfCenterAtEpoch_rad, twoPi);
+
+    if (elapsedPhase_rad < 0.0)
+    {
+        elapsedPhase_rad += twoPi;
+    }
+
+    if ((twoPi - elapsedPhase_rad) < tolerance)
+    {
+        elapsedPhase_rad -= twoPi;
+    }
+
+    // Fixed point iterations on the drift of the equation of center, which is slow compared to the mean motion
+
+    const double meanArgumentOfLatitudeRate_radSec = meanMotion_radSec + aopRate_radSec;
+
+    double duration_s = 0.0;
+
+    for (int iteration = 0; iteration < 5; ++iteration)
+    {
+        const double phase_rad =
+            twoPi * static_cast<int>(aRevolutionCount) - elapsedPhase_rad +
+            computeEquationOfCenterAtAscendingNode(aopAtEpoch_rad + aopRate_radSec * duration_s) -
+            equationOfCenterAtEpoch_rad;
+
+        if (halfMeanMotionRate_radSec2 == 0.0)
+        {
+            duration_s = phase_rad / meanArgumentOfLatitudeRate_radSec;
+
+            continue;
+        }
+
+        const double discriminant = meanArgumentOfLatitudeRate_radSec * meanArgumentOfLatitudeRate_radSec +
+                                    4.0 * halfMeanMotionRate_radSec2 * phase_rad;
+
+        if (discriminant < 0.0)
+        {
+            return Real::Undefined();
+        }
+
+        duration_s = 2.0 * phase_rad / (meanArgumentOfLatitudeRate_radSec + std::sqrt(discriminant));
+    }
+
+    return duration_s;
+}
+
 }  // namespace orbit
 }  // namespace trajectory
 }  // namespace astrodynamics
@@ -1,5 +1,7 @@
 /// Apache License 2.0
 
+#include <algorithm>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
@@ -20,7 +22,8 @@ namespace blm
 {
 
 using ostk::core::type::Integer;
-using ostk::core::type::Size;
+
+using ostk::physics::unit::Time;
 
 BrouwerLyddaneMean::BrouwerLyddaneMean(
     const Length &aSemiMajorAxis,
@@ -80,6 +83,19 @@ Vector6d BrouwerLyddaneMean::Cartesian(
 {
     const COE coe = COE::Cartesian(aCartesianState, aGravitationalParameter);
 
+    const Real gravitationalParameter_SI =
+        aGravitationalParameter.in(Derived::Unit::GravitationalParameter(Length::Unit::Meter, Time::Unit::Second));
+
+    // Mean elements vector to cartesian state vector, on raw SI vectors
+    const auto toCartesianVector = [&gravitationalParameter_SI](const Vector6d &aCOEVector) -> Vector6d
+    {
+        Vector6d coeVector = aCOEVector;
+        coeVector[5] =
+            COE::TrueAnomalyFromMeanAnomaly(Angle::Radians(aCOEVector[5]), aCOEVector[1], 1e-15).inRadians();
+
+        return COE::SIVectorToCartesian(coeVector, gravitationalParameter_SI);
+    };
+
     bool possibleInaccuracyLongWritten = false;
     bool inaccuracyCriticalAngleWritten = false;
 
@@ -140,12 +156,7 @@ Vector6d BrouwerLyddaneMean::Cartesian(
     {
         coeVector[2] = Real::Pi() - coeVector[2];  // INC = 180 - INC
         coeVector[3] = -coeVector[3];              // RAAN = - RAAN
-        Position position = Position::Undefined();
-        Velocity velocity = Velocity::Undefined();
-        std::tie(position, velocity) = COE::FromSIVector(coeVector, COE::AnomalyType::Mean)
-                                           .getCartesianState(aGravitationalParameter, Frame::GCRF());
-        cartesian.segment(0, 3) = position.getCoordinates();
-        cartesian.segment(3, 3) = velocity.getCoordinates();
+        cartesian = toCartesianVector(coeVector);
 
         pseudoState = 1;
     }
@@ -217,12 +228,7 @@ Vector6d BrouwerLyddaneMean::Cartesian(
         brouwerLyddaneMean = brouwerLyddaneMeanFromMEE(modifiedEquinoctialElementsMean_2);
         coeVector_2 = toCOEVector(brouwerLyddaneMean);
 
-        const COE coe_2 = COE::FromSIVector(coeVector_2, COE::AnomalyType::Mean);
-        Position position2 = Position::Undefined();
-        Velocity velocity2 = Velocity::Undefined();
-        std::tie(position2, velocity2) = coe_2.getCartesianState(aGravitationalParameter, Frame::GCRF());
-        cartesian_2.segment(0, 3) = position2.getCoordinates();
-        cartesian_2.segment(3, 3) = velocity2.getCoordinates();
+        cartesian_2 = toCartesianVector(coeVector_2);
 
         const Vector6d delta = cartesian - cartesian_2;
 
@@ -266,6 +272,30 @@ Vector6d BrouwerLyddaneMean::Cartesian(
     return brouwerLyddaneMean;
 }
 
+void BrouwerLyddaneMean::ForEachInBatch(
+    const Size &aBatchSize,
+    const ExecutionContext &anExecutionContext,
+    const std::function<void(const Index &)> &aFunction
+)
+{
+    static constexpr Size ChunkSize = 16;
+
+    const Size chunkCount = (aBatchSize + ChunkSize - 1) / ChunkSize;
+
+    anExecutionContext.parallelFor(
+        chunkCount,
+        [aBatchSize, &aFunction](const Index &aChunkIndex) -> void
+        {
+            const Size end = std::min<Size>(aBatchSize, (aChunkIndex + 1) * ChunkSize);
+
+            for (Index index = aChunkIndex * ChunkSize; index < end; ++index)
+            {
+                aFunction(index);
+            }
+        }
+    );
+}
+
 }  // namespace blm
 }  // namespace model
 }  // namespace orbit
@@ -39,6 +39,26 @@ BrouwerLyddaneMeanLong::BrouwerLyddaneMeanLong(
 }
 
 COE BrouwerLyddaneMeanLong::toCOE() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("BrouwerLyddaneMeanLong");
+    }
+
+    return COE::FromSIVector(
+        BrouwerLyddaneMeanLong::ToCOEVector({
+            semiMajorAxis_.inMeters(),
+            eccentricity_,
+            inclination_.inRadians(),
+            raan_.inRadians(),
+            aop_.inRadians(),
+            anomaly_.inRadians(),
+        }),
+        COE::AnomalyType::Mean
+    );
+}
+
+Vector6d BrouwerLyddaneMeanLong::ToCOEVector(const Vector6d &aVector)
 {
     // ref:
     // https://github.com/ChristopherRabotin/GMAT/blob/37201a6290e7f7b941bc98ee973a527a5857104b/src/base/util/StateConversionUtil.cpp#L4206
@@ -61,12 +81,12 @@ COE BrouwerLyddaneMeanLong::toCOE() const
     const Real j4 = -0.1620429990000000E-5;
     const Real j5 = -0.2270711043920343E-6;
     const Real ae = 1.0;
-    Real smadp = semiMajorAxis_.inMeters() / re;
-    Real eccdp = eccentricity_;
-    Real incdp = inclination_.inRadians();
-    Real raandp = raan_.inRadians(0.0, Real::TwoPi());
-    Real aopdp = aop_.inRadians(0.0, Real::TwoPi());
-    Real meanAnom = anomaly_.inRadians(0.0, Real::TwoPi());
+    Real smadp = aVector[0] / re;
+    Real eccdp = aVector[1];
+    Real incdp = aVector[2];
+    Real raandp = mod(aVector[3], Real::TwoPi());
+    Real aopdp = mod(aVector[4], Real::TwoPi());
+    Real meanAnom = mod(aVector[5], Real::TwoPi());
 
     if (incdp > 3.0543261909900763)
     {
@@ -83,7 +103,7 @@ COE BrouwerLyddaneMeanLong::toCOE() const
         );
     }
 
-    const Real perigee = this->getPeriapsisRadius().inMeters();
+    const Real perigee = aVector[0] * (1.0 - aVector[1]);
     if (perigee < 3000000.0)
     {
         throw ostk::core::error::RuntimeError(
@@ -377,17 +397,14 @@ COE BrouwerLyddaneMeanLong::toCOE() const
         raan = Real::TwoPi() - raan;
     }
 
-    return COE::FromSIVector(
-        {
-            sma * equatorialRadius,
-            ecc,
-            inc,
-            raan,
-            aop,
-            ma,
-        },
-        COE::AnomalyType::Mean
-    );
+    return {
+        sma * equatorialRadius,
+        ecc,
+        inc,
+        raan,
+        aop,
+        ma,
+    };
 }
 
 BrouwerLyddaneMeanLong BrouwerLyddaneMeanLong::COE(const classicalOE &aCOE)
@@ -409,7 +426,7 @@ BrouwerLyddaneMeanLong BrouwerLyddaneMeanLong::Cartesian(
 {
     const auto toCOEVector = [](const Vector6d &aVector) -> Vector6d
     {
-        return BrouwerLyddaneMeanLong::FromSIVector(aVector).toCOE().getSIVector(COE::AnomalyType::Mean);
+        return BrouwerLyddaneMeanLong::ToCOEVector(aVector);
     };
 
     return BrouwerLyddaneMeanLong::FromSIVector(
@@ -417,6 +434,63 @@ BrouwerLyddaneMeanLong BrouwerLyddaneMeanLong::Cartesian(
     );
 }
 
+Array<BrouwerLyddaneMeanLong> BrouwerLyddaneMeanLong::FromCartesianStates(
+    const Array<COE::CartesianState> &aCartesianStateArray,
+    const Derived &aGravitationalParameter,
+    const Size &aThreadCount
+)
+{
+    return BrouwerLyddaneMeanLong::FromCartesianStates(
+        aCartesianStateArray, aGravitationalParameter, ExecutionContext(aThreadCount)
+    );
+}
+
+Array<BrouwerLyddaneMeanLong> BrouwerLyddaneMeanLong::FromCartesianStates(
+    const Array<COE::CartesianState> &aCartesianStateArray,
+    const Derived &aGravitationalParameter,
+    const ExecutionContext &anExecutionContext
+)
+{
+    Array<BrouwerLyddaneMeanLong> elementSets(aCartesianStateArray.getSize(), BrouwerLyddaneMeanLong::Undefined());
+
+    BrouwerLyddaneMean::ForEachInBatch(
+        aCartesianStateArray.getSize(),
+        anExecutionContext,
+        [&](const Index &anIndex) -> void
+        {
+            elementSets[anIndex] =
+                BrouwerLyddaneMeanLong::Cartesian(aCartesianStateArray[anIndex], aGravitationalParameter);
+        }
+    );
+
+    return elementSets;
+}
+
+Array<classicalOE> BrouwerLyddaneMeanLong::ToCOEs(
+    const Array<BrouwerLyddaneMeanLong> &anElementSetArray, const Size &aThreadCount
+)
+{
+    return BrouwerLyddaneMeanLong::ToCOEs(anElementSetArray, ExecutionContext(aThreadCount));
+}
+
+Array<classicalOE> BrouwerLyddaneMeanLong::ToCOEs(
+    const Array<BrouwerLyddaneMeanLong> &anElementSetArray, const ExecutionContext &anExecutionContext
+)
+{
+    Array<classicalOE> coes(anElementSetArray.getSize(), classicalOE::Undefined());
+
+    BrouwerLyddaneMean::ForEachInBatch(
+        anElementSetArray.getSize(),
+        anExecutionContext,
+        [&](const Index &anIndex) -> void
+        {
+            coes[anIndex] = anElementSetArray[anIndex].toCOE();
+        }
+    );
+
+    return coes;
+}
+
 BrouwerLyddaneMeanLong BrouwerLyddaneMeanLong::Undefined()
 {
     return {
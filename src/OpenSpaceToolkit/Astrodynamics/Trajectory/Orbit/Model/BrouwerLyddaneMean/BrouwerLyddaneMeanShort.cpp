@@ -39,6 +39,26 @@ BrouwerLyddaneMeanShort::BrouwerLyddaneMeanShort(
 }
 
 COE BrouwerLyddaneMeanShort::toCOE() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("BrouwerLyddaneMeanShort");
+    }
+
+    return COE::FromSIVector(
+        BrouwerLyddaneMeanShort::ToCOEVector({
+            semiMajorAxis_.inMeters(),
+            eccentricity_,
+            inclination_.inRadians(),
+            raan_.inRadians(),
+            aop_.inRadians(),
+            anomaly_.inRadians(),
+        }),
+        COE::AnomalyType::Mean
+    );
+}
+
+Vector6d BrouwerLyddaneMeanShort::ToCOEVector(const Vector6d &aVector)
 {
     // ref:
     // https://github.com/ChristopherRabotin/GMAT/blob/37201a6290e7f7b941bc98ee973a527a5857104b/src/base/util/StateConversionUtil.cpp#L3679
@@ -58,12 +78,12 @@ COE BrouwerLyddaneMeanShort::toCOE() const
     const Real re = EarthGravitationalModel::EGM2008.equatorialRadius_.inMeters();
     const Real j2 = 1.082626925638815E-03;
     const Real ae = 1.0;
-    Real smap = semiMajorAxis_.inMeters() / re;
-    Real eccp = eccentricity_;
-    Real incp = inclination_.inRadians();
-    Real raanp = raan_.inRadians(0.0, Real::TwoPi());
-    Real aopp = aop_.inRadians(0.0, Real::TwoPi());
-    Real meanAnomalyp = anomaly_.inRadians(0.0, Real::TwoPi());
+    Real smap = aVector[0] / re;
+    Real eccp = aVector[1];
+    Real incp = aVector[2];
+    Real raanp = mod(aVector[3], Real::TwoPi());
+    Real aopp = mod(aVector[4], Real::TwoPi());
+    Real meanAnomalyp = mod(aVector[5], Real::TwoPi());
 
     if ((incp < 0.0) || (incp > Real::Pi()))
     {
@@ -102,7 +122,7 @@ COE BrouwerLyddaneMeanShort::toCOE() const
         );
     }
 
-    const Real perigee = this->getPeriapsisRadius().inMeters();
+    const Real perigee = aVector[0] * (1.0 - aVector[1]);
     if (perigee < 3000000.0)
     {
         throw ostk::core::error::RuntimeError(
@@ -266,17 +286,14 @@ COE BrouwerLyddaneMeanShort::toCOE() const
         aop += Real::TwoPi();
     }
 
-    return COE::FromSIVector(
-        {
-            sma * equatorialRadius,
-            ecc1,
-            inc,
-            raan,
-            aop,
-            meanAnomaly,
-        },
-        COE::AnomalyType::Mean
-    );
+    return {
+        sma * equatorialRadius,
+        ecc1,
+        inc,
+        raan,
+        aop,
+        meanAnomaly,
+    };
 }
 
 BrouwerLyddaneMeanShort BrouwerLyddaneMeanShort::COE(const classicalOE &aCOE)
@@ -298,7 +315,7 @@ BrouwerLyddaneMeanShort BrouwerLyddaneMeanShort::Cartesian(
 {
     const auto toCOEVector = [](const Vector6d &aVector) -> Vector6d
     {
-        return BrouwerLyddaneMeanShort::FromSIVector(aVector).toCOE().getSIVector(COE::AnomalyType::Mean);
+        return BrouwerLyddaneMeanShort::ToCOEVector(aVector);
     };
 
     return BrouwerLyddaneMeanShort::FromSIVector(
@@ -306,6 +323,63 @@ BrouwerLyddaneMeanShort BrouwerLyddaneMeanShort::Cartesian(
     );
 }
 
+Array<BrouwerLyddaneMeanShort> BrouwerLyddaneMeanShort::FromCartesianStates(
+    const Array<COE::CartesianState> &aCartesianStateArray,
+    const Derived &aGravitationalParameter,
+    const Size &aThreadCount
+)
+{
+    return BrouwerLyddaneMeanShort::FromCartesianStates(
+        aCartesianStateArray, aGravitationalParameter, ExecutionContext(aThreadCount)
+    );
+}
+
+Array<BrouwerLyddaneMeanShort> BrouwerLyddaneMeanShort::FromCartesianStates(
+    const Array<COE::CartesianState> &aCartesianStateArray,
+    const Derived &aGravitationalParameter,
+    const ExecutionContext &anExecutionContext
+)
+{
+    Array<BrouwerLyddaneMeanShort> elementSets(aCartesianStateArray.getSize(), BrouwerLyddaneMeanShort::Undefined());
+
+    BrouwerLyddaneMean::ForEachInBatch(
+        aCartesianStateArray.getSize(),
+        anExecutionContext,
+        [&](const Index &anIndex) -> void
+        {
+            elementSets[anIndex] =
+                BrouwerLyddaneMeanShort::Cartesian(aCartesianStateArray[anIndex], aGravitationalParameter);
+        }
+    );
+
+    return elementSets;
+}
+
+Array<classicalOE> BrouwerLyddaneMeanShort::ToCOEs(
+    const Array<BrouwerLyddaneMeanShort> &anElementSetArray, const Size &aThreadCount
+)
+{
+    return BrouwerLyddaneMeanShort::ToCOEs(anElementSetArray, ExecutionContext(aThreadCount));
+}
+
+Array<classicalOE> BrouwerLyddaneMeanShort::ToCOEs(
+    const Array<BrouwerLyddaneMeanShort> &anElementSetArray, const ExecutionContext &anExecutionContext
+)
+{
+    Array<classicalOE> coes(anElementSetArray.getSize(), classicalOE::Undefined());
+
+    BrouwerLyddaneMean::ForEachInBatch(
+        anElementSetArray.getSize(),
+        anExecutionContext,
+        [&](const Index &anIndex) -> void
+        {
+            coes[anIndex] = anElementSetArray[anIndex].toCOE();
+        }
+    );
+
+    return coes;
+}
+
 BrouwerLyddaneMeanShort BrouwerLyddaneMeanShort::Undefined()
 {
     return {
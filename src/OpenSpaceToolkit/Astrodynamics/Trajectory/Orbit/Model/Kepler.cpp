@@ -1,5 +1,6 @@
 /// Apache License 2.0
 
+#include <cmath>
 #include <iostream>
 
 #include <OpenSpaceToolkit/Core/Error.hpp>
@@ -213,6 +214,172 @@ State Kepler::calculateStateAt(const Instant& anInstant) const
     return State::Undefined();
 }
 
+Array<State> Kepler::calculateStatesAt(const Array<Instant>& anInstantArray) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Kepler");
+    }
+
+    if (anInstantArray.isEmpty())
+    {
+        return Array<State>::Empty();
+    }
+
+    return this->calculateEphemerisAt(anInstantArray).getStates();
+}
+
+Ephemeris Kepler::calculateEphemerisAt(const Array<Instant>& anInstantArray) const
+{
+    using ostk::core::type::Size;
+
+    using ostk::mathematics::object::MatrixXd;
+    using ostk::mathematics::object::Vector3d;
+    using ostk::mathematics::object::VectorXd;
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Kepler");
+    }
+
+    if (anInstantArray.isEmpty())
+    {
+        return Ephemeris::Undefined();
+    }
+
+    // Orbital parameters at epoch
+
+    const double semiMajorAxis_m = coe_.getSemiMajorAxis().inMeters();
+    const double eccentricity = coe_.getEccentricity();
+    const double inclination_rad = coe_.getInclination().inRadians();
+    const double raanAtEpoch_rad = coe_.getRaan().inRadians();
+    const double aopAtEpoch_rad = coe_.getAop().inRadians();
+    const double gravitationalParameter_SI = gravitationalParameter_.in(GravitationalParameterSIUnit);
+
+    // Secular rates, computed once for the whole instant array
+
+    const Kepler::SecularRates secularRates = this->calculateSecularRates();
+
+    const double raanRate_radSec = secularRates.raanRate;
+    const double aopRate_radSec = secularRates.aopRate;
+
+    const Kepler::PropagatedAnomalies propagatedAnomalies = this->propagateAnomalies(anInstantArray, secularRates);
+
+    const VectorXd& durationsFromEpoch_s = propagatedAnomalies.durationsFromEpoch_s;
+    const VectorXd& trueAnomalies_rad = propagatedAnomalies.trueAnomalies_rad;
+
+    const Size instantCount = anInstantArray.getSize();
+
+    const double semiLatusRectum_m = semiMajorAxis_m * (1.0 - eccentricity * eccentricity);
+    const double velocityFactor = std::sqrt(gravitationalParameter_SI / semiLatusRectum_m);
+
+    const double cosInclination = std::cos(inclination_rad);
+    const double sinInclination = std::sin(inclination_rad);
+
+    static const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+
+    MatrixXd positions(instantCount, 3);
+    MatrixXd velocities(instantCount, 3);
+
+    for (Size index = 0; index < instantCount; ++index)
+    {
+        const double durationFromEpoch_s = durationsFromEpoch_s[index];
+        const double trueAnomaly_rad = trueAnomalies_rad[index];
+
+        // Perifocal position and velocity
+
+        const double cosTrueAnomaly = std::cos(trueAnomaly_rad);
+        const double sinTrueAnomaly = std::sin(trueAnomaly_rad);
+
+        const double radius_m = semiLatusRectum_m / (1.0 + eccentricity * cosTrueAnomaly);
+
+        const double x_pqw = radius_m * cosTrueAnomaly;
+        const double y_pqw = radius_m * sinTrueAnomaly;
+        const double vx_pqw = -velocityFactor * sinTrueAnomaly;
+        const double vy_pqw = velocityFactor * (eccentricity + cosTrueAnomaly);
+
+        // Perifocal to inertial rotation
+
+        const double raan_rad = raanAtEpoch_rad + raanRate_radSec * durationFromEpoch_s;
+        const double aop_rad = aopAtEpoch_rad + aopRate_radSec * durationFromEpoch_s;
+
+        const double cosRaan = std::cos(raan_rad);
+        const double sinRaan = std::sin(raan_rad);
+        const double cosAop = std::cos(aop_rad);
+        const double sinAop = std::sin(aop_rad);
+
+        const Vector3d p = {
+            cosRaan * cosAop - sinRaan * sinAop * cosInclination,
+            sinRaan * cosAop + cosRaan * sinAop * cosInclination,
+            sinAop * sinInclination,
+        };
+
+        const Vector3d q = {
+            -cosRaan * sinAop - sinRaan * cosAop * cosInclination,
+            -sinRaan * sinAop + cosRaan * cosAop * cosInclination,
+            cosAop * sinInclination,
+        };
+
+        positions.row(index) = (x_pqw * p + y_pqw * q).transpose();
+        velocities.row(index) = (vx_pqw * p + vy_pqw * q).transpose();
+    }
+
+    return {anInstantArray, positions, velocities, gcrfSPtr};
+}
+
+Array<COE> Kepler::calculateCOEsAt(const Array<Instant>& anInstantArray) const
+{
+    using ostk::core::type::Size;
+
+    using ostk::mathematics::object::VectorXd;
+
+    using ostk::physics::unit::Angle;
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Kepler");
+    }
+
+    if (anInstantArray.isEmpty())
+    {
+        return Array<COE>::Empty();
+    }
+
+    const Kepler::SecularRates secularRates = this->calculateSecularRates();
+
+    const Kepler::PropagatedAnomalies propagatedAnomalies = this->propagateAnomalies(anInstantArray, secularRates);
+
+    const VectorXd& durationsFromEpoch_s = propagatedAnomalies.durationsFromEpoch_s;
+    const VectorXd& trueAnomalies_rad = propagatedAnomalies.trueAnomalies_rad;
+
+    const double raanAtEpoch_rad = coe_.getRaan().inRadians();
+    const double aopAtEpoch_rad = coe_.getAop().inRadians();
+
+    const auto wrappedAngle = [](const double& anAngle_rad) -> Angle
+    {
+        return Angle::Radians(Angle::Radians(anAngle_rad).inRadians(0.0, Real::TwoPi()));
+    };
+
+    Array<COE> coes = Array<COE>::Empty();
+    coes.reserve(anInstantArray.getSize());
+
+    for (Size index = 0; index < anInstantArray.getSize(); ++index)
+    {
+        const double durationFromEpoch_s = durationsFromEpoch_s[index];
+
+        coes.add({
+            coe_.getSemiMajorAxis(),
+            coe_.getEccentricity(),
+            coe_.getInclination(),
+            wrappedAngle(raanAtEpoch_rad + secularRates.raanRate * durationFromEpoch_s),
+            wrappedAngle(aopAtEpoch_rad + secularRates.aopRate * durationFromEpoch_s),
+            wrappedAngle(trueAnomalies_rad[index]),
+        });
+    }
+
+    return coes;
+}
+
 Integer Kepler::calculateRevolutionNumberAt(const Instant& anInstant) const
 {
     if (!anInstant.isDefined())
@@ -252,6 +419,42 @@ Integer Kepler::calculateRevolutionNumberAt(const Instant& anInstant) const
     return Integer::Undefined();
 }
 
+Instant Kepler::estimateAscendingNodeInstant(const Integer& aRevolutionNumber) const
+{
+    using ostk::physics::time::Duration;
+
+    if (!aRevolutionNumber.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Revolution number");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Kepler");
+    }
+
+    const double eccentricity = coe_.getEccentricity();
+
+    if (eccentricity >= 1.0)
+    {
+        return Instant::Undefined();
+    }
+
+    const Kepler::SecularRates secularRates = this->calculateSecularRates();
+
+    const Real duration_s = Model::EstimateAscendingNodeDurationFromEpoch(
+        aRevolutionNumber - this->getRevolutionNumberAtEpoch(),
+        eccentricity,
+        coe_.getAop().inRadians(),
+        coe_.getMeanAnomaly().inRadians(),
+        secularRates.meanMotion,
+        secularRates.aopRate,
+        0.0
+    );
+
+    return duration_s.isDefined() ? epoch_ + Duration::Seconds(duration_s) : Instant::Undefined();
+}
+
 void Kepler::print(std::ostream& anOutputStream, bool displayDecorator) const
 {
     displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Kepler") : void();
@@ -408,6 +611,82 @@ State Kepler::CalculateNoneStateAt(
     return state;
 }
 
+Kepler::SecularRates Kepler::calculateSecularRates() const
+{
+    switch (perturbationType_)
+    {
+        case Kepler::PerturbationType::None:
+        {
+            const Real semiMajorAxis_m = coe_.getSemiMajorAxis().inMeters();
+            const Real gravitationalParameter_SI = gravitationalParameter_.in(GravitationalParameterSIUnit);
+
+            return {std::sqrt(gravitationalParameter_SI / std::pow(semiMajorAxis_m, 3)), 0.0, 0.0};
+        }
+
+        case Kepler::PerturbationType::J2:
+            return Kepler::CalculateJ2SecularRates(coe_, gravitationalParameter_, equatorialRadius_, j2_);
+
+        case Kepler::PerturbationType::J4:
+            return Kepler::CalculateJ4SecularRates(coe_, gravitationalParameter_, equatorialRadius_, j2_, j4_);
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Perturbation type");
+    }
+
+    return {Real::Undefined(), Real::Undefined(), Real::Undefined()};
+}
+
+Kepler::PropagatedAnomalies Kepler::propagateAnomalies(
+    const Array<Instant>& anInstantArray, const Kepler::SecularRates& aSecularRates
+) const
+{
+    using ostk::core::type::Size;
+
+    using ostk::mathematics::object::VectorXd;
+
+    using ostk::physics::time::Duration;
+
+    for (const auto& instant : anInstantArray)
+    {
+        if (!instant.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Instant");
+        }
+    }
+
+    const double eccentricity = coe_.getEccentricity();
+
+    const bool isCircular = std::abs(eccentricity) < double(Tolerance);
+
+    // The unperturbed circular case propagates the true anomaly directly, as Kepler::CalculateNoneStateAt does
+
+    const bool isTrueAnomalyPropagated = isCircular && (perturbationType_ == Kepler::PerturbationType::None);
+
+    const double anomalyAtEpoch_rad = isTrueAnomalyPropagated ? double(coe_.getTrueAnomaly().inRadians())
+                                                              : double(coe_.getMeanAnomaly().inRadians());
+
+    // Propagate the anomalies, and solve Kepler's equation for the whole instant array at once
+
+    const Size instantCount = anInstantArray.getSize();
+
+    VectorXd durationsFromEpoch_s(instantCount);
+
+    for (Size index = 0; index < instantCount; ++index)
+    {
+        durationsFromEpoch_s[index] = Duration::Between(epoch_, anInstantArray[index]).inSeconds();
+    }
+
+    const VectorXd anomalies_rad =
+        (anomalyAtEpoch_rad + aSecularRates.meanMotion * durationsFromEpoch_s.array()).matrix();
+
+    VectorXd trueAnomalies_rad =
+        isTrueAnomalyPropagated
+            ? anomalies_rad
+            : COE::TrueAnomaliesFromMeanAnomalies(anomalies_rad, VectorXd::Constant(1, eccentricity));
+
+    return {durationsFromEpoch_s, trueAnomalies_rad};
+}
+
 Integer Kepler::CalculateNoneRevolutionNumberAt(
     const COE& aClassicalOrbitalElementSet,
     const Instant& anEpoch,
@@ -424,39 +703,24 @@ Integer Kepler::CalculateNoneRevolutionNumberAt(
     return (durationFromEpoch.inSeconds() / orbitalPeriod.inSeconds()).floor() + 1;
 }
 
-State Kepler::CalculateJ2StateAt(
+Kepler::SecularRates Kepler::CalculateJ2SecularRates(
     const COE& aClassicalOrbitalElementSet,
-    const Instant& anEpoch,
     const Derived& aGravitationalParameter,
-    const Instant& anInstant,
     const Length& anEquatorialRadius,
     const Real& aJ2
 )
 {
-    using ostk::physics::time::Duration;
-    using ostk::physics::unit::Angle;
-    using ostk::physics::unit::Derived;
-    using ostk::physics::unit::Mass;
-    using ostk::physics::unit::Time;
-
     // Setup
 
     const Real equatorialRadius_m = anEquatorialRadius.inMeters();
 
     const Real gravitationalParameter_SI = aGravitationalParameter.in(GravitationalParameterSIUnit);
 
-    // Duration from epoch
-
-    const Real durationFromEpoch_s = Duration::Between(anEpoch, anInstant).inSeconds();
-
     // Orbital parameters at epoch
 
     const Real semiMajorAxisAtEpoch_m = aClassicalOrbitalElementSet.getSemiMajorAxis().inMeters();
     const Real eccentricityAtEpoch = aClassicalOrbitalElementSet.getEccentricity();
     const Real inclinationAtEpoch_rad = aClassicalOrbitalElementSet.getInclination().inRadians();
-    const Real raanAtEpoch_rad = aClassicalOrbitalElementSet.getRaan().inRadians();
-    const Real aopAtEpoch_rad = aClassicalOrbitalElementSet.getAop().inRadians();
-    const Real meanAnomalyAtEpoch_rad = aClassicalOrbitalElementSet.getMeanAnomaly().inRadians();
 
     // Calculation
     // Ref: http://www.s3l.be/usr/files/di/fi/2/Lecture06_AnalyticNumeric_2018-2019_201811142121.pdf
@@ -475,10 +739,117 @@ State Kepler::CalculateJ2StateAt(
     const Real n_bar = n * (1.0 + expr * std::sqrt(1.0 - eccentricityAtEpoch * eccentricityAtEpoch) *
                                       (1.0 - (3.0 / 2.0) * sinInclinationSquared));
 
-    const Real aop_bar_rad =
-        aopAtEpoch_rad + expr * (2.0 - (5.0 / 2.0) * sinInclinationSquared) * n_bar * durationFromEpoch_s;
-    const Real raan_bar_rad = raanAtEpoch_rad - expr * cosInclination * n_bar * durationFromEpoch_s;
-    const Real meanAnomaly_rad = meanAnomalyAtEpoch_rad + n_bar * durationFromEpoch_s;
+    const Real aop_dot = expr * (2.0 - (5.0 / 2.0) * sinInclinationSquared) * n_bar;
+    const Real raan_dot = -(expr * cosInclination * n_bar);
+
+    return {n_bar, raan_dot, aop_dot};
+}
+
+Kepler::SecularRates Kepler::CalculateJ4SecularRates(
+    const COE& aClassicalOrbitalElementSet,
+    const Derived& aGravitationalParameter,
+    const Length& anEquatorialRadius,
+    const Real& aJ2,
+    const Real& aJ4
+)
+{
+    // Setup
+
+    const Real equatorialRadius_m = anEquatorialRadius.inMeters();
+
+    const Real gravitationalParameter_SI = aGravitationalParameter.in(GravitationalParameterSIUnit);
+
+    // Orbital parameters at epoch
+
+    const Real semiMajorAxisAtEpoch_m = aClassicalOrbitalElementSet.getSemiMajorAxis().inMeters();
+    const Real eccentricityAtEpoch = aClassicalOrbitalElementSet.getEccentricity();
+    const Real inclinationAtEpoch_rad = aClassicalOrbitalElementSet.getInclination().inRadians();
+
+    // Calculation
+    // Ref: Vallado, D. A (2013). Fundamentals of Astrodynamics and Applications.
+    // Ref: Escobal, P. R (1965). Methods of Orbit Determination.
+
+    const Real n = std::sqrt(
+        gravitationalParameter_SI / (semiMajorAxisAtEpoch_m * semiMajorAxisAtEpoch_m * semiMajorAxisAtEpoch_m)
+    );
+    const Real p = semiMajorAxisAtEpoch_m * (1.0 - eccentricityAtEpoch * eccentricityAtEpoch);
+
+    const Real cosInclination = std::cos(inclinationAtEpoch_rad);
+    const Real sinInclination = std::sin(inclinationAtEpoch_rad);
+    const Real cosInclinationSquared = cosInclination * cosInclination;
+    const Real sinInclinationSquared = sinInclination * sinInclination;
+
+    const Real eccentricityAtEpochSquared = eccentricityAtEpoch * eccentricityAtEpoch;
+    const Real sqrtBeta = std::sqrt(1.0 - eccentricityAtEpochSquared);
+
+    const Real expr = (3.0 / 2.0) * aJ2 * std::pow((equatorialRadius_m / p), 2);
+
+    const Real n_bar =
+        n *
+        (1.0 + expr * sqrtBeta * ((1.0 - (3.0 / 2.0) * sinInclinationSquared)) +
+         3.0 / 128.0 * aJ2 * aJ2 * std::pow(equatorialRadius_m / p, 4) * sqrtBeta *
+             (16.0 * sqrtBeta + 25.0 * (1.0 - eccentricityAtEpochSquared) - 15.0 +
+              (30.0 - 96.0 * sqrtBeta - 90.0 * (1.0 - eccentricityAtEpochSquared)) * cosInclinationSquared +
+              (105.0 + 144.0 * sqrtBeta + 25.0 * (1.0 - eccentricityAtEpochSquared)) * std::pow(cosInclination, 4)) -
+         45.0 / 128.0 * aJ4 * eccentricityAtEpochSquared * std::pow(equatorialRadius_m / p, 4) * sqrtBeta *
+             (3.0 - 30.0 * cosInclinationSquared + 35.0 * std::pow(cosInclination, 4)));
+
+    const Real raan_dot =
+        -n_bar * expr * cosInclination *
+            (1.0 +
+             expr * ((3.0 / 2.0) + eccentricityAtEpochSquared / 6.0 - 2.0 * sqrtBeta -
+                     (5.0 / 3.0 - 5.0 / 24.0 * eccentricityAtEpochSquared - 3.0 * sqrtBeta) * sinInclinationSquared)) -
+        35.0 / 8.0 * n * aJ4 * std::pow(equatorialRadius_m / p, 4) * cosInclination *
+            (1.0 + (3.0 / 2.0) * eccentricityAtEpochSquared) * (12.0 - 21.0 * sinInclinationSquared) / 14.0;
+
+    const Real aop_dot =
+        n_bar * expr * (2.0 - (5.0 / 2.0) * sinInclinationSquared) *
+            (1.0 + expr * (2.0 + eccentricityAtEpochSquared / 2.0 - 2.0 * sqrtBeta -
+                           (43.0 / 24.0 - eccentricityAtEpochSquared / 48.0 - 3.0 * sqrtBeta) * sinInclinationSquared)
+            ) -
+        45.0 / 36.0 * aJ2 * aJ2 * n * std::pow(equatorialRadius_m / p, 4) * eccentricityAtEpochSquared *
+            std::pow(cosInclination, 4) -
+        35.0 / 8.0 * n * aJ4 * std::pow(equatorialRadius_m / p, 4) *
+            (12.0 / 7.0 - 93.0 / 14.0 * sinInclinationSquared + 21.0 / 4.0 * std::pow(sinInclination, 4) +
+             eccentricityAtEpochSquared *
+                 (27.0 / 14.0 - 189.0 / 28.0 * sinInclinationSquared + 81.0 / 16.0 * std::pow(sinInclination, 4)));
+
+    return {n_bar, raan_dot, aop_dot};
+}
+
+State Kepler::CalculateJ2StateAt(
+    const COE& aClassicalOrbitalElementSet,
+    const Instant& anEpoch,
+    const Derived& aGravitationalParameter,
+    const Instant& anInstant,
+    const Length& anEquatorialRadius,
+    const Real& aJ2
+)
+{
+    using ostk::physics::time::Duration;
+    using ostk::physics::unit::Angle;
+
+    // Duration from epoch
+
+    const Real durationFromEpoch_s = Duration::Between(anEpoch, anInstant).inSeconds();
+
+    // Orbital parameters at epoch
+
+    const Real semiMajorAxisAtEpoch_m = aClassicalOrbitalElementSet.getSemiMajorAxis().inMeters();
+    const Real eccentricityAtEpoch = aClassicalOrbitalElementSet.getEccentricity();
+    const Real inclinationAtEpoch_rad = aClassicalOrbitalElementSet.getInclination().inRadians();
+    const Real raanAtEpoch_rad = aClassicalOrbitalElementSet.getRaan().inRadians();
+    const Real aopAtEpoch_rad = aClassicalOrbitalElementSet.getAop().inRadians();
+    const Real meanAnomalyAtEpoch_rad = aClassicalOrbitalElementSet.getMeanAnomaly().inRadians();
+
+    // Secular rates
+
+    const Kepler::SecularRates secularRates =
+        Kepler::CalculateJ2SecularRates(aClassicalOrbitalElementSet, aGravitationalParameter, anEquatorialRadius, aJ2);
+
+    const Real aop_bar_rad = aopAtEpoch_rad + secularRates.aopRate * durationFromEpoch_s;
+    const Real raan_bar_rad = raanAtEpoch_rad + secularRates.raanRate * durationFromEpoch_s;
+    const Real meanAnomaly_rad = meanAnomalyAtEpoch_rad + secularRates.meanMotion * durationFromEpoch_s;
 
     // Orbital parameters at instant
 
@@ -678,15 +1049,6 @@ State Kepler::CalculateJ4StateAt(
 {
     using ostk::physics::time::Duration;
     using ostk::physics::unit::Angle;
-    using ostk::physics::unit::Derived;
-    using ostk::physics::unit::Mass;
-    using ostk::physics::unit::Time;
-
-    // Setup
-
-    const Real equatorialRadius_m = anEquatorialRadius.inMeters();
-
-    const Real gravitationalParameter_SI = aGravitationalParameter.in(GravitationalParameterSIUnit);
 
     // Duration from epoch
 
@@ -701,58 +1063,15 @@ State Kepler::CalculateJ4StateAt(
     const Real aopAtEpoch_rad = aClassicalOrbitalElementSet.getAop().inRadians();
     const Real meanAnomalyAtEpoch_rad = aClassicalOrbitalElementSet.getMeanAnomaly().inRadians();
 
-    // Calculation
-    // Ref: Vallado, D. A (2013). Fundamentals of Astrodynamics and Applications.
-    // Ref: Escobal, P. R (1965). Methods of Orbit Determination.
+    // Secular rates
 
-    const Real n = std::sqrt(
-        gravitationalParameter_SI / (semiMajorAxisAtEpoch_m * semiMajorAxisAtEpoch_m * semiMajorAxisAtEpoch_m)
+    const Kepler::SecularRates secularRates = Kepler::CalculateJ4SecularRates(
+        aClassicalOrbitalElementSet, aGravitationalParameter, anEquatorialRadius, aJ2, aJ4
     );
-    const Real p = semiMajorAxisAtEpoch_m * (1.0 - eccentricityAtEpoch * eccentricityAtEpoch);
-
-    const Real cosInclination = std::cos(inclinationAtEpoch_rad);
-    const Real sinInclination = std::sin(inclinationAtEpoch_rad);
-    const Real cosInclinationSquared = cosInclination * cosInclination;
-    const Real sinInclinationSquared = sinInclination * sinInclination;
-
-    const Real eccentricityAtEpochSquared = eccentricityAtEpoch * eccentricityAtEpoch;
-    const Real sqrtBeta = std::sqrt(1.0 - eccentricityAtEpochSquared);
-
-    const Real expr = (3.0 / 2.0) * aJ2 * std::pow((equatorialRadius_m / p), 2);
-
-    const Real n_bar =
-        n *
-        (1.0 + expr * sqrtBeta * ((1.0 - (3.0 / 2.0) * sinInclinationSquared)) +
-         3.0 / 128.0 * aJ2 * aJ2 * std::pow(equatorialRadius_m / p, 4) * sqrtBeta *
-             (16.0 * sqrtBeta + 25.0 * (1.0 - eccentricityAtEpochSquared) - 15.0 +
-              (30.0 - 96.0 * sqrtBeta - 90.0 * (1.0 - eccentricityAtEpochSquared)) * cosInclinationSquared +
-              (105.0 + 144.0 * sqrtBeta + 25.0 * (1.0 - eccentricityAtEpochSquared)) * std::pow(cosInclination, 4)) -
-         45.0 / 128.0 * aJ4 * eccentricityAtEpochSquared * std::pow(equatorialRadius_m / p, 4) * sqrtBeta *
-             (3.0 - 30.0 * cosInclinationSquared + 35.0 * std::pow(cosInclination, 4)));
-
-    const Real raan_dot =
-        -n_bar * expr * cosInclination *
-            (1.0 +
-             expr * ((3.0 / 2.0) + eccentricityAtEpochSquared / 6.0 - 2.0 * sqrtBeta -
-                     (5.0 / 3.0 - 5.0 / 24.0 * eccentricityAtEpochSquared - 3.0 * sqrtBeta) * sinInclinationSquared)) -
-        35.0 / 8.0 * n * aJ4 * std::pow(equatorialRadius_m / p, 4) * cosInclination *
-            (1.0 + (3.0 / 2.0) * eccentricityAtEpochSquared) * (12.0 - 21.0 * sinInclinationSquared) / 14.0;
-
-    const Real aop_dot =
-        n_bar * expr * (2.0 - (5.0 / 2.0) * sinInclinationSquared) *
-            (1.0 + expr * (2.0 + eccentricityAtEpochSquared / 2.0 - 2.0 * sqrtBeta -
-                           (43.0 / 24.0 - eccentricityAtEpochSquared / 48.0 - 3.0 * sqrtBeta) * sinInclinationSquared)
-            ) -
-        45.0 / 36.0 * aJ2 * aJ2 * n * std::pow(equatorialRadius_m / p, 4) * eccentricityAtEpochSquared *
-            std::pow(cosInclination, 4) -
-        35.0 / 8.0 * n * aJ4 * std::pow(equatorialRadius_m / p, 4) *
-            (12.0 / 7.0 - 93.0 / 14.0 * sinInclinationSquared + 21.0 / 4.0 * std::pow(sinInclination, 4) +
-             eccentricityAtEpochSquared *
-                 (27.0 / 14.0 - 189.0 / 28.0 * sinInclinationSquared + 81.0 / 16.0 * std::pow(sinInclination, 4)));
 
-    const Real raan_bar_rad = raanAtEpoch_rad + raan_dot * durationFromEpoch_s;
-    const Real aop_bar_rad = aopAtEpoch_rad + aop_dot * durationFromEpoch_s;
-    const Real meanAnomaly_rad = meanAnomalyAtEpoch_rad + n_bar * durationFromEpoch_s;
+    const Real raan_bar_rad = raanAtEpoch_rad + secularRates.raanRate * durationFromEpoch_s;
+    const Real aop_bar_rad = aopAtEpoch_rad + secularRates.aopRate * durationFromEpoch_s;
+    const Real meanAnomaly_rad = meanAnomalyAtEpoch_rad + secularRates.meanMotion * durationFromEpoch_s;
 
     // Orbital parameters at instant
 
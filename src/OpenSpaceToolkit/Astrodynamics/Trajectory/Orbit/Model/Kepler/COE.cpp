@@ -1,11 +1,14 @@
 /// Apache License 2.0
 
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
-#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/RotationMatrix.hpp>
-
 #include <OpenSpaceToolkit/Physics/Environment/Gravitational/Earth.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler/COE.hpp>
@@ -32,6 +35,25 @@ using ostk::physics::unit::Time;
 using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
 
 static const Real Tolerance = 1e-30;
+
+static const char SnapshotMagic[8] = {'O', 'S', 'T', 'K', 'C', 'O', 'E', '\0'};
+static const std::uint32_t SnapshotVersion = 1;
+static const std::uint32_t SnapshotByteOrderMark = 0x01020304;
+
+struct SnapshotHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byteOrderMark;
+    std::uint64_t recordCount;
+};
+
+struct SnapshotRecord
+{
+    double values[6];
+    std::uint32_t units[5];
+    std::uint32_t anomalyType;
+};
 static const Derived::Unit GravitationalParameterSIUnit =
     Derived::Unit::GravitationalParameter(Length::Unit::Meter, Time::Unit::Second);
 static const Derived::Unit AngularMomentumSIUnit = {
@@ -298,14 +320,6 @@ COE::CartesianState COE::getCartesianState(
     const Derived& aGravitationalParameter, const Shared<const Frame>& aFrameSPtr
 ) const
 {
-    using ostk::core::type::Shared;
-
-    using ostk::mathematics::geometry::d3::transformation::rotation::RotationMatrix;
-    using ostk::mathematics::object::Vector3d;
-
-    using ostk::physics::unit::Mass;
-    using ostk::physics::unit::Time;
-
     if (!aGravitationalParameter.isDefined())
     {
         throw ostk::core::error::runtime::Undefined("Gravitational parameter");
@@ -321,54 +335,22 @@ COE::CartesianState COE::getCartesianState(
         throw ostk::core::error::runtime::Undefined("COE");
     }
 
-    const Real a_m = semiMajorAxis_.inMeters();
-    const Real inclination_rad = inclination_.inRadians();
-    const Real raan_rad = raan_.inRadians();
-    const Real aop_rad = aop_.inRadians();
-    const Real nu_rad = anomaly_.inRadians();
-    const Real mu_SI = aGravitationalParameter.in(GravitationalParameterSIUnit);
-
-    const Real p_m = a_m * (1.0 - eccentricity_ * eccentricity_);
-
-    const Vector3d R_pqw = {
-        p_m * std::cos(nu_rad) / (1.0 + eccentricity_ * std::cos(nu_rad)),
-        p_m * std::sin(nu_rad) / (1.0 + eccentricity_ * std::cos(nu_rad)),
-        0.0,
-    };
-
-    const Vector3d V_pqw = {
-        -std::sqrt(mu_SI / p_m) * std::sin(nu_rad),
-        +std::sqrt(mu_SI / p_m) * (eccentricity_ + std::cos(nu_rad)),
-        0.0,
+    const Vector6d coeVector = {
+        semiMajorAxis_.inMeters(),
+        eccentricity_,
+        inclination_.inRadians(),
+        raan_.inRadians(),
+        aop_.inRadians(),
+        anomaly_.inRadians(),
     };
 
-    try
-    {
-        const Vector3d x_ECI = RotationMatrix::RZ(Angle::Radians(-raan_rad)) *
-                               RotationMatrix::RX(Angle::Radians(-inclination_rad)) *
-                               RotationMatrix::RZ(Angle::Radians(-aop_rad)) * R_pqw;
-        const Vector3d v_ECI = RotationMatrix::RZ(Angle::Radians(-raan_rad)) *
-                               RotationMatrix::RX(Angle::Radians(-inclination_rad)) *
-                               RotationMatrix::RZ(Angle::Radians(-aop_rad)) * V_pqw;
-
-        const Position position = Position::Meters(x_ECI, aFrameSPtr);
-        const Velocity velocity = Velocity::MetersPerSecond(v_ECI, aFrameSPtr);
-
-        return {
-            position,
-            velocity,
-        };
-    }
-    catch (const ostk::core::error::Exception& anException)
-    {
-        std::cout << "raan_rad = " << raan_rad << std::endl;
-        std::cout << "inclination_rad = " << inclination_rad << std::endl;
-        std::cout << "aop_rad = " << aop_rad << std::endl;
-        std::cout << "R_pqw = " << R_pqw << std::endl;
-        std::cout << "V_pqw = " << V_pqw << std::endl;
+    const Vector6d cartesianVector =
+        COE::SIVectorToCartesian(coeVector, aGravitationalParameter.in(GravitationalParameterSIUnit));
 
-        throw anException;
-    }
+    return {
+        Position::Meters(cartesianVector.head<3>(), aFrameSPtr),
+        Velocity::MetersPerSecond(cartesianVector.tail<3>(), aFrameSPtr),
+    };
 }
 
 Vector6d COE::getSIVector(const COE::AnomalyType& anAnomalyType) const
@@ -440,11 +422,6 @@ COE COE::Undefined()
 
 COE COE::Cartesian(const COE::CartesianState& aCartesianState, const Derived& aGravitationalParameter)
 {
-    using ostk::mathematics::object::Vector3d;
-
-    using ostk::physics::unit::Mass;
-    using ostk::physics::unit::Time;
-
     if ((!aCartesianState.first.isDefined()) || (!aCartesianState.second.isDefined()))
     {
         throw ostk::core::error::runtime::Undefined("Cartesian state");
@@ -455,17 +432,42 @@ COE COE::Cartesian(const COE::CartesianState& aCartesianState, const Derived& aG
         throw ostk::core::error::runtime::Undefined("Gravitational parameter");
     }
 
+    Vector6d cartesianVector;
+    cartesianVector << aCartesianState.first.accessCoordinates(), aCartesianState.second.accessCoordinates();
+
+    const Vector6d coeVector =
+        COE::CartesianToSIVector(cartesianVector, aGravitationalParameter.in(GravitationalParameterSIUnit));
+
+    return {
+        Length::Meters(coeVector[0]),
+        coeVector[1],
+        Angle::Radians(coeVector[2]),
+        Angle::Radians(coeVector[3]),
+        Angle::Radians(coeVector[4]),
+        Angle::Radians(coeVector[5]),
+    };
+}
+
+Vector6d COE::CartesianToSIVector(const Vector6d& aCartesianVector, const Real& aGravitationalParameter_SI)
+{
+    using ostk::mathematics::object::Vector3d;
+
+    if (!aGravitationalParameter_SI.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Gravitational parameter");
+    }
+
     static const Real tolerance = 1e-11;
 
-    const Real mu = aGravitationalParameter.in(GravitationalParameterSIUnit);
+    const Real& mu = aGravitationalParameter_SI;
 
     if (mu == 0.0)
     {
         throw ostk::core::error::runtime::Wrong("Gravitational parameter");
     }
 
-    const Vector3d& positionVector = aCartesianState.first.accessCoordinates();
-    const Vector3d& velocityVector = aCartesianState.second.accessCoordinates();
+    const Vector3d positionVector = aCartesianVector.head<3>();
+    const Vector3d velocityVector = aCartesianVector.tail<3>();
 
     const Real position = positionVector.norm();
     const Real velocity = velocityVector.norm();
@@ -632,14 +634,171 @@ COE COE::Cartesian(const COE::CartesianState& aCartesianState, const Derived& aG
         }
     }
 
-    return {
-        Length::Meters(a_m),
-        e,
-        Angle::Radians(i_rad),
-        Angle::Radians(raan_rad),
-        Angle::Radians(aop_rad),
-        Angle::Radians(nu_rad),
+    Vector6d coeVector;
+    coeVector << a_m, e, i_rad, raan_rad, aop_rad, nu_rad;
+
+    return coeVector;
+}
+
+Vector6d COE::SIVectorToCartesian(const Vector6d& aCOEVector, const Real& aGravitationalParameter_SI)
+{
+    using ostk::mathematics::object::Vector3d;
+
+    if (!aGravitationalParameter_SI.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Gravitational parameter");
+    }
+
+    const double a_m = aCOEVector[0];
+    const double e = aCOEVector[1];
+    const double mu_SI = aGravitationalParameter_SI;
+
+    const double cosI = std::cos(aCOEVector[2]);
+    const double sinI = std::sin(aCOEVector[2]);
+    const double cosRaan = std::cos(aCOEVector[3]);
+    const double sinRaan = std::sin(aCOEVector[3]);
+    const double cosAop = std::cos(aCOEVector[4]);
+    const double sinAop = std::sin(aCOEVector[4]);
+    const double cosNu = std::cos(aCOEVector[5]);
+    const double sinNu = std::sin(aCOEVector[5]);
+
+    const double p_m = a_m * (1.0 - e * e);
+    const double r_m = p_m / (1.0 + e * cosNu);
+    const double v_SI = std::sqrt(mu_SI / p_m);
+
+    // Perifocal (P, Q) basis expressed in the inertial frame, i.e. RZ(-raan) * RX(-i) * RZ(-aop) applied to X and Y
+
+    const Vector3d P = {
+        cosRaan * cosAop - sinRaan * sinAop * cosI,
+        sinRaan * cosAop + cosRaan * sinAop * cosI,
+        sinAop * sinI,
+    };
+
+    const Vector3d Q = {
+        -cosRaan * sinAop - sinRaan * cosAop * cosI,
+        -sinRaan * sinAop + cosRaan * cosAop * cosI,
+        cosAop * sinI,
     };
+
+    Vector6d cartesianVector;
+    cartesianVector << (r_m * cosNu) * P + (r_m * sinNu) * Q, (-v_SI * sinNu) * P + (v_SI * (e + cosNu)) * Q;
+
+    return cartesianVector;
+}
+
+MatrixXd COE::CartesiansToSIVectors(
+    const MatrixXd& aCartesianMatrix, const Real& aGravitationalParameter_SI, const AnomalyType& anAnomalyType
+)
+{
+    using Eigen::ArrayXd;
+
+    if (aCartesianMatrix.cols() != 6)
+    {
+        throw ostk::core::error::runtime::Wrong("Cartesian matrix");
+    }
+
+    MatrixXd coeMatrix(aCartesianMatrix.rows(), 6);
+
+    for (Eigen::Index i = 0; i < aCartesianMatrix.rows(); ++i)
+    {
+        coeMatrix.row(i) =
+            COE::CartesianToSIVector(aCartesianMatrix.row(i).transpose(), aGravitationalParameter_SI).transpose();
+    }
+
+    if (anAnomalyType == AnomalyType::True)
+    {
+        return coeMatrix;
+    }
+
+    const ArrayXd e = coeMatrix.col(1).array();
+    const ArrayXd nu = coeMatrix.col(5).array();
+
+    if ((e >= 1.0).any())
+    {
+        throw ostk::core::error::runtime::Wrong("Eccentricity");
+    }
+
+    const double twoPi = 2.0 * M_PI;
+
+    ArrayXd anomaly = 2.0 * ((1.0 - e).sqrt() * (0.5 * nu).sin())
+                                .binaryExpr(
+                                    (1.0 + e).sqrt() * (0.5 * nu).cos(),
+                                    [](const double y, const double x) -> double
+                                    {
+                                        return std::atan2(y, x);
+                                    }
+                                );
+
+    if (anAnomalyType == AnomalyType::Mean)
+    {
+        anomaly -= e * anomaly.sin();
+    }
+
+    coeMatrix.col(5) = (anomaly - twoPi * (anomaly / twoPi).floor()).matrix();
+
+    return coeMatrix;
+}
+
+MatrixXd COE::SIVectorsToCartesians(
+    const MatrixXd& aCOEMatrix, const Real& aGravitationalParameter_SI, const AnomalyType& anAnomalyType
+)
+{
+    using Eigen::ArrayXd;
+
+    if (aCOEMatrix.cols() != 6)
+    {
+        throw ostk::core::error::runtime::Wrong("COE matrix");
+    }
+
+    VectorXd trueAnomalies;
+
+    switch (anAnomalyType)
+    {
+        case AnomalyType::True:
+            trueAnomalies = aCOEMatrix.col(5);
+            break;
+
+        case AnomalyType::Mean:
+            trueAnomalies = COE::TrueAnomaliesFromMeanAnomalies(aCOEMatrix.col(5), aCOEMatrix.col(1));
+            break;
+
+        case AnomalyType::Eccentric:
+        {
+            const ArrayXd e = aCOEMatrix.col(1).array();
+            const ArrayXd E = aCOEMatrix.col(5).array();
+
+            if ((e < 0.0).any() || (e >= 1.0).any())
+            {
+                throw ostk::core::error::runtime::Wrong("Eccentricity");
+            }
+
+            trueAnomalies = (2.0 * ((1.0 + e).sqrt() * (0.5 * E).sin())
+                                       .binaryExpr(
+                                           (1.0 - e).sqrt() * (0.5 * E).cos(),
+                                           [](const double y, const double x) -> double
+                                           {
+                                               return std::atan2(y, x);
+                                           }
+                                       ))
+                                .matrix();
+            break;
+        }
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Anomaly type");
+    }
+
+    MatrixXd cartesianMatrix(aCOEMatrix.rows(), 6);
+
+    for (Eigen::Index i = 0; i < aCOEMatrix.rows(); ++i)
+    {
+        Vector6d coeVector = aCOEMatrix.row(i).transpose();
+        coeVector[5] = trueAnomalies[i];
+
+        cartesianMatrix.row(i) = COE::SIVectorToCartesian(coeVector, aGravitationalParameter_SI).transpose();
+    }
+
+    return cartesianMatrix;
 }
 
 COE COE::FromSIVector(const Vector6d& aCOEVector, const AnomalyType& anAnomalyType)
@@ -654,6 +813,150 @@ COE COE::FromSIVector(const Vector6d& aCOEVector, const AnomalyType& anAnomalyTy
     };
 }
 
+void COE::SaveSnapshot(const Array<COE>& aCOEArray, const File& aFile)
+{
+    using ostk::core::type::Index;
+
+    if (!aFile.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("File");
+    }
+
+    std::vector<SnapshotRecord> records(aCOEArray.getSize());
+
+    for (Index coeIndex = 0; coeIndex < aCOEArray.getSize(); ++coeIndex)
+    {
+        const COE& coe = aCOEArray[coeIndex];
+
+        if (!coe.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("COE");
+        }
+
+        SnapshotRecord& record = records[coeIndex];
+
+        record.values[0] = coe.semiMajorAxis_.in(coe.semiMajorAxis_.getUnit());
+        record.values[1] = coe.eccentricity_;
+        record.values[2] = coe.inclination_.in(coe.inclination_.getUnit());
+        record.values[3] = coe.raan_.in(coe.raan_.getUnit());
+        record.values[4] = coe.aop_.in(coe.aop_.getUnit());
+        record.values[5] = coe.anomaly_.in(coe.anomaly_.getUnit());
+
+        record.units[0] = static_cast<std::uint32_t>(coe.semiMajorAxis_.getUnit());
+        record.units[1] = static_cast<std::uint32_t>(coe.inclination_.getUnit());
+        record.units[2] = static_cast<std::uint32_t>(coe.raan_.getUnit());
+        record.units[3] = static_cast<std::uint32_t>(coe.aop_.getUnit());
+        record.units[4] = static_cast<std::uint32_t>(coe.anomaly_.getUnit());
+
+        record.anomalyType = static_cast<std::uint32_t>(coe.anomalyType_);
+    }
+
+    SnapshotHeader header;
+
+    std::memcpy(header.magic, SnapshotMagic, sizeof(SnapshotMagic));
+    header.version = SnapshotVersion;
+    header.byteOrderMark = SnapshotByteOrderMark;
+    header.recordCount = records.size();
+
+    std::ofstream fileStream(aFile.getPath().toString(), std::ios::binary | std::ios::trunc);
+
+    if (!fileStream.is_open())
+    {
+        throw ostk::core::error::RuntimeError("Cannot open file [{}].", aFile.toString());
+    }
+
+    fileStream.write(reinterpret_cast<const char*>(&header), sizeof(SnapshotHeader));
+    fileStream.write(
+        reinterpret_cast<const char*>(records.data()),
+        static_cast<std::streamsize>(records.size() * sizeof(SnapshotRecord))
+    );
+
+    if (!fileStream.good())
+    {
+        throw ostk::core::error::RuntimeError("Cannot write file [{}].", aFile.toString());
+    }
+}
+
+Array<COE> COE::LoadSnapshot(const File& aFile)
+{
+    if (!aFile.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("File");
+    }
+
+    if (!aFile.exists())
+    {
+        throw ostk::core::error::RuntimeError("File [{}] does not exist.", aFile.toString());
+    }
+
+    std::ifstream fileStream(aFile.getPath().toString(), std::ios::binary);
+
+    if (!fileStream.is_open())
+    {
+        throw ostk::core::error::RuntimeError("Cannot open file [{}].", aFile.toString());
+    }
+
+    fileStream.seekg(0, std::ios::end);
+
+    const std::size_t fileSize = static_cast<std::size_t>(fileStream.tellg());
+
+    fileStream.seekg(0, std::ios::beg);
+
+    SnapshotHeader header;
+
+    if ((fileSize < sizeof(SnapshotHeader)) ||
+        (!fileStream.read(reinterpret_cast<char*>(&header), sizeof(SnapshotHeader))) ||
+        (std::memcmp(header.magic, SnapshotMagic, sizeof(SnapshotMagic)) != 0))
+    {
+        throw ostk::core::error::RuntimeError("File [{}] is not a COE snapshot.", aFile.toString());
+    }
+
+    if (header.version != SnapshotVersion)
+    {
+        throw ostk::core::error::RuntimeError(
+            "COE snapshot version [{}] is not supported (expected [{}]).", header.version, SnapshotVersion
+        );
+    }
+
+    if (header.byteOrderMark != SnapshotByteOrderMark)
+    {
+        throw ostk::core::error::RuntimeError("COE snapshot byte order is not supported.");
+    }
+
+    if (((fileSize - sizeof(SnapshotHeader)) % sizeof(SnapshotRecord) != 0) ||
+        (header.recordCount != ((fileSize - sizeof(SnapshotHeader)) / sizeof(SnapshotRecord))))
+    {
+        throw ostk::core::error::RuntimeError("COE snapshot [{}] is truncated.", aFile.toString());
+    }
+
+    // Read all the records at once
+
+    std::vector<SnapshotRecord> records(header.recordCount);
+
+    fileStream.read(
+        reinterpret_cast<char*>(records.data()),
+        static_cast<std::streamsize>(records.size() * sizeof(SnapshotRecord))
+    );
+
+    Array<COE> coes = Array<COE>::Empty();
+    coes.reserve(records.size());
+
+    for (const SnapshotRecord& record : records)
+    {
+        coes.add(COE(
+            Length(record.values[0], static_cast<Length::Unit>(record.units[0])),
+            record.values[1],
+            Angle(record.values[2], static_cast<Angle::Unit>(record.units[1])),
+            Angle(record.values[3], static_cast<Angle::Unit>(record.units[2])),
+            Angle(record.values[4], static_cast<Angle::Unit>(record.units[3])),
+            Angle(record.values[5], static_cast<Angle::Unit>(record.units[4])),
+            static_cast<COE::AnomalyType>(record.anomalyType)
+        ));
+    }
+
+    return coes;
+}
+
 Angle COE::EccentricAnomalyFromTrueAnomaly(const Angle& aTrueAnomaly, const Real& anEccentricity)
 {
     if (!aTrueAnomaly.isDefined())
@@ -867,6 +1170,85 @@ Angle COE::TrueAnomalyFromMeanAnomaly(const Angle& aMeanAnomly, const Real& anEc
     );
 }
 
+VectorXd COE::EccentricAnomaliesFromMeanAnomalies(
+    const VectorXd& aMeanAnomalyVector, const VectorXd& anEccentricityVector, const Size& anIterationCount
+)
+{
+    using Eigen::ArrayXd;
+
+    const Eigen::Index count = aMeanAnomalyVector.size();
+
+    if ((anEccentricityVector.size() != 1) && (anEccentricityVector.size() != count))
+    {
+        throw ostk::core::error::runtime::Wrong("Eccentricity vector size");
+    }
+
+    const ArrayXd e = (anEccentricityVector.size() == 1) ? ArrayXd(ArrayXd::Constant(count, anEccentricityVector[0]))
+                                                         : ArrayXd(anEccentricityVector.array());
+
+    if ((e < 0.0).any() || (e >= 1.0).any())
+    {
+        throw ostk::core::error::runtime::Wrong("Eccentricity");
+    }
+
+    const ArrayXd e2 = e * e;
+    const ArrayXd e3 = e2 * e;
+
+    const double twoPi = 2.0 * M_PI;
+
+    const ArrayXd M = aMeanAnomalyVector.array() - twoPi * (aMeanAnomalyVector.array() / twoPi).floor();
+
+    // Starter (same as COE::EccentricAnomalyFromMeanAnomaly)
+
+    const ArrayXd cosM = M.cos();
+
+    ArrayXd E = M + (-0.5 * e3 + e + (e2 + 1.5 * cosM * e3) * cosM) * M.sin();
+
+    // Third order corrections, for a fixed iteration count
+
+    for (Size iteration = 0; iteration < anIterationCount; ++iteration)
+    {
+        const ArrayXd cosE = E.cos();
+        const ArrayXd sinE = E.sin();
+
+        const ArrayXd t2 = e * cosE - 1.0;
+        const ArrayXd t4 = e * sinE;
+        const ArrayXd t5 = M - E + t4;
+        const ArrayXd t6 = t5 / (0.5 * t5 * t4 / t2 + t2);
+
+        E -= t5 / ((0.5 * sinE - (1.0 / 6.0) * cosE * t6) * e * t6 + t2);
+    }
+
+    return E.matrix();
+}
+
+VectorXd COE::TrueAnomaliesFromMeanAnomalies(
+    const VectorXd& aMeanAnomalyVector, const VectorXd& anEccentricityVector, const Size& anIterationCount
+)
+{
+    using Eigen::ArrayXd;
+
+    const ArrayXd E =
+        COE::EccentricAnomaliesFromMeanAnomalies(aMeanAnomalyVector, anEccentricityVector, anIterationCount).array();
+
+    const ArrayXd e = (anEccentricityVector.size() == 1)
+                        ? ArrayXd(ArrayXd::Constant(E.size(), anEccentricityVector[0]))
+                        : ArrayXd(anEccentricityVector.array());
+
+    const ArrayXd nu = 2.0 * ((1.0 + e).sqrt() * (0.5 * E).sin())
+                                 .binaryExpr(
+                                     (1.0 - e).sqrt() * (0.5 * E).cos(),
+                                     [](const double y, const double x) -> double
+                                     {
+                                         return std::atan2(y, x);
+                                     }
+                                 );
+
+    const double twoPi = 2.0 * M_PI;
+
+    return (nu - twoPi * (nu / twoPi).floor()).matrix();
+}
+
 Real COE::ComputeSemiLatusRectum(const Real& aSemiMajorAxis, const Real& anEccentricity)
 {
     return aSemiMajorAxis * (1.0 - (anEccentricity * anEccentricity));
@@ -1,5 +1,9 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <iterator>
+#include <mutex>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
@@ -11,7 +15,10 @@
 #include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
 #include <OpenSpaceToolkit/Physics/Unit/Time.hpp>
 
+#include <OpenSpaceToolkit/Astrodynamics/ExecutionContext.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Propagated.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianPosition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianVelocity.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/StateBuilder.hpp>
 
 namespace ostk
@@ -25,6 +32,8 @@ namespace orbit
 namespace model
 {
 
+using ostk::core::type::Index;
+using ostk::core::type::Shared;
 using ostk::core::type::Size;
 
 using ostk::mathematics::object::Vector3d;
@@ -35,16 +44,36 @@ using ostk::physics::unit::Derived;
 using ostk::physics::unit::Length;
 using ostk::physics::unit::Time;
 
+using ostk::astrodynamics::trajectory::state::CoordinateBroker;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianPosition;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianVelocity;
 using ostk::astrodynamics::trajectory::StateBuilder;
 
 static const Derived::Unit GravitationalParameterSIUnit =
     Derived::Unit::GravitationalParameter(Length::Unit::Meter, Time::Unit::Second);
 
+Propagated::CachePolicy::CachePolicy(const Size& aMaximumStateCount, const Size& aMaximumMemorySize)
+    : maximumStateCount(aMaximumStateCount),
+      maximumMemorySize(aMaximumMemorySize)
+{
+}
+
+Propagated::CachePolicy Propagated::CachePolicy::Unbounded()
+{
+    return {0, 0};
+}
+
 Propagated::Propagated(const Propagator& aPropagator, const State& aState, const Integer& aRevolutionNumber)
     : Model(),
       propagator_(aPropagator),
       cachedStateArray_(1, aState),
-      initialRevolutionNumber_(aRevolutionNumber)
+      initialRevolutionNumber_(aRevolutionNumber),
+      hermiteInterpolationSpan_(Duration::Undefined()),
+      checkpointSpacing_(Duration::Undefined()),
+      cachePolicy_(CachePolicy::Unbounded()),
+      cacheEntries_(1, {true, 0}),
+      queryIndex_(0),
+      cacheMutex_()
 {
 }
 
@@ -54,11 +83,60 @@ Propagated::Propagated(
     : Model(),
       propagator_(aPropagator),
       cachedStateArray_(aCachedStateArray),
-      initialRevolutionNumber_(aRevolutionNumber)
+      initialRevolutionNumber_(aRevolutionNumber),
+      hermiteInterpolationSpan_(Duration::Undefined()),
+      checkpointSpacing_(Duration::Undefined()),
+      cachePolicy_(CachePolicy::Unbounded()),
+      cacheEntries_(Array<CacheEntry>::Empty()),
+      queryIndex_(0),
+      cacheMutex_()
 {
     sanitizeCachedArray();
 }
 
+Propagated::Propagated(const Propagated& aPropagatedModel)
+    : Model(aPropagatedModel),
+      propagator_(aPropagatedModel.propagator_),
+      cachedStateArray_(Array<State>::Empty()),
+      initialRevolutionNumber_(aPropagatedModel.initialRevolutionNumber_),
+      hermiteInterpolationSpan_(Duration::Undefined()),
+      checkpointSpacing_(Duration::Undefined()),
+      cachePolicy_(CachePolicy::Unbounded()),
+      cacheEntries_(Array<CacheEntry>::Empty()),
+      queryIndex_(0),
+      cacheMutex_()
+{
+    const std::lock_guard<std::mutex> lock(aPropagatedModel.cacheMutex_);
+
+    cachedStateArray_ = aPropagatedModel.cachedStateArray_;
+    hermiteInterpolationSpan_ = aPropagatedModel.hermiteInterpolationSpan_;
+    checkpointSpacing_ = aPropagatedModel.checkpointSpacing_;
+    cachePolicy_ = aPropagatedModel.cachePolicy_;
+    cacheEntries_ = aPropagatedModel.cacheEntries_;
+    queryIndex_ = aPropagatedModel.queryIndex_;
+}
+
+Propagated& Propagated::operator=(const Propagated& aPropagatedModel)
+{
+    if (this != &aPropagatedModel)
+    {
+        const std::scoped_lock lock(cacheMutex_, aPropagatedModel.cacheMutex_);
+
+        Model::operator=(aPropagatedModel);
+
+        propagator_ = aPropagatedModel.propagator_;
+        cachedStateArray_ = aPropagatedModel.cachedStateArray_;
+        initialRevolutionNumber_ = aPropagatedModel.initialRevolutionNumber_;
+        hermiteInterpolationSpan_ = aPropagatedModel.hermiteInterpolationSpan_;
+        checkpointSpacing_ = aPropagatedModel.checkpointSpacing_;
+        cachePolicy_ = aPropagatedModel.cachePolicy_;
+        cacheEntries_ = aPropagatedModel.cacheEntries_;
+        queryIndex_ = aPropagatedModel.queryIndex_;
+    }
+
+    return *this;
+}
+
 Propagated* Propagated::clone() const
 {
     return new Propagated(*this);
@@ -71,6 +149,15 @@ bool Propagated::operator==(const Propagated& aPropagatedModel) const
         return false;
     }
 
+    if (this == &aPropagatedModel)
+    {
+        return true;
+    }
+
+    // Queries of models with a defined checkpoint spacing insert into the cache, hence it is compared under the locks
+
+    const std::scoped_lock lock(cacheMutex_, aPropagatedModel.cacheMutex_);
+
     return (cachedStateArray_ == aPropagatedModel.cachedStateArray_) && (propagator_ == aPropagatedModel.propagator_);
 }
 
@@ -88,6 +175,10 @@ std::ostream& operator<<(std::ostream& anOutputStream, const Propagated& aPropag
 
 bool Propagated::isDefined() const
 {
+    // Queries of models shared between threads (e.g. by orbit copies) may insert checkpoints into the cache
+
+    const std::lock_guard<std::mutex> lock(cacheMutex_);
+
     return !cachedStateArray_.isEmpty() && propagator_.isDefined();
 }
 
@@ -98,6 +189,8 @@ Instant Propagated::getEpoch() const
         throw ostk::core::error::runtime::Undefined("Propagated");
     }
 
+    const std::lock_guard<std::mutex> lock(cacheMutex_);
+
     return cachedStateArray_[0].getInstant();
 }
 
@@ -134,6 +227,14 @@ State Propagated::calculateStateAt(const Instant& anInstant) const
 }
 
 Array<State> Propagated::calculateStatesAt(const Array<Instant>& anInstantArray) const
+{
+    // Windows are only processed in parallel on request, as this path is reached from parallel operations and from
+    // Python (holding the GIL) alike
+
+    return this->calculateStatesAt(anInstantArray, 1);
+}
+
+Array<State> Propagated::calculateStatesAt(const Array<Instant>& anInstantArray, const Size& aThreadCount) const
 {
     if (!this->isDefined())
     {
@@ -153,98 +254,191 @@ Array<State> Propagated::calculateStatesAt(const Array<Instant>& anInstantArray)
         }
     }
 
-    // Builder for output states based on cached array
-    StateBuilder outputStateBuilder = {this->cachedStateArray_.accessFirst()};
+    // Split the instants into independent windows: instants up to the first cached state and after the last one are
+    // propagated from it, instants between two cached states are interpolated between them. Windows hold copies of
+    // their cached states, so that the cache is only accessed under the lock.
 
-    Array<State> allStates = Array<State>::Empty();
-
-    // Maintain counter separately so as to only iterate once through instant array
+    struct Window
+    {
+        State state;
+        State nextState;
+        Array<Instant> instants;
+    };
 
-    Size j = 0;
+    Array<Window> windows = Array<Window>::Empty();
 
-    // Propagate states for instants < first cached State
+    Duration hermiteInterpolationSpan = Duration::Undefined();
+    Duration checkpointSpacing = Duration::Undefined();
 
-    Array<Instant> instants = Array<Instant>::Empty();
-    for (; j < anInstantArray.getSize(); ++j)
     {
-        if (anInstantArray[j] > this->cachedStateArray_.accessFirst().accessInstant())
-        {
-            break;
-        }
+        const std::lock_guard<std::mutex> lock(cacheMutex_);
 
-        instants.add(anInstantArray[j]);
-    }
+        hermiteInterpolationSpan = hermiteInterpolationSpan_;
+        checkpointSpacing = checkpointSpacing_;
 
-    allStates.add(propagator_.calculateStatesAt(this->cachedStateArray_.accessFirst(), instants));
+        // Maintain counter separately so as to only iterate once through instant array
 
-    // Propagate all instants between states
+        Size j = 0;
 
-    for (Size i = 0; i < this->cachedStateArray_.getSize() - 1; ++i)
-    {
-        const Instant& thisStateInstant = this->cachedStateArray_[i].accessInstant();
-        const Instant& nextStateInstant = this->cachedStateArray_[i + 1].accessInstant();
+        Array<Instant> instants = Array<Instant>::Empty();
+        for (; j < anInstantArray.getSize(); ++j)
+        {
+            if (anInstantArray[j] > this->cachedStateArray_.accessFirst().accessInstant())
+            {
+                break;
+            }
 
-        instants = Array<Instant>::Empty();
+            instants.add(anInstantArray[j]);
+        }
 
-        while (j < anInstantArray.getSize())
+        ++queryIndex_;
+
+        if (!instants.isEmpty())
         {
-            if (anInstantArray[j] >= nextStateInstant)
+            windows.add({this->cachedStateArray_.accessFirst(), State::Undefined(), instants});
+            this->touchCachedState(0);
+        }
+
+        for (Size i = 0; i < this->cachedStateArray_.getSize() - 1; ++i)
+        {
+            const Instant& thisStateInstant = this->cachedStateArray_[i].accessInstant();
+            const Instant& nextStateInstant = this->cachedStateArray_[i + 1].accessInstant();
+
+            instants = Array<Instant>::Empty();
+
+            while (j < anInstantArray.getSize())
             {
-                break;
+                if (anInstantArray[j] >= nextStateInstant)
+                {
+                    break;
+                }
+
+                if ((anInstantArray[j] >= thisStateInstant) && (anInstantArray[j] < nextStateInstant))
+                {
+                    instants.add(anInstantArray[j]);
+                }
+
+                ++j;
             }
 
-            if ((anInstantArray[j] >= thisStateInstant) && (anInstantArray[j] < nextStateInstant))
+            if (!instants.isEmpty())
             {
-                instants.add(anInstantArray[j]);
+                windows.add({this->cachedStateArray_[i], this->cachedStateArray_[i + 1], instants});
+                this->touchCachedState(i);
+                this->touchCachedState(i + 1);
             }
+        }
+
+        instants = Array<Instant>::Empty();
 
-            ++j;
+        for (; j < anInstantArray.getSize(); ++j)
+        {
+            instants.add(anInstantArray[j]);
         }
 
-        if (instants.isEmpty())
+        if (!instants.isEmpty())
         {
-            continue;
+            windows.add({this->cachedStateArray_.accessLast(), State::Undefined(), instants});
+            this->touchCachedState(this->cachedStateArray_.getSize() - 1);
+        }
+    }
+
+    // Builder for output states based on cached array
+    const StateBuilder outputStateBuilder = {windows.accessFirst().state};
+
+    const auto calculateWindowStates = [&outputStateBuilder, &hermiteInterpolationSpan, &checkpointSpacing](
+                                           const Propagator& aPropagator,
+                                           const Window& aWindow,
+                                           Array<State>& aCheckpointStateArray
+                                       ) -> Array<State>
+    {
+        const State& thisState = aWindow.state;
+
+        if (!aWindow.nextState.isDefined())
+        {
+            return Propagated::PropagateWithCheckpoints(
+                aPropagator, thisState, aWindow.instants, checkpointSpacing, aCheckpointStateArray
+            );
+        }
+
+        const State& nextState = aWindow.nextState;
+
+        if (Propagated::CanInterpolateHermite(thisState, nextState, hermiteInterpolationSpan))
+        {
+            return Propagated::InterpolateHermite(thisState, nextState, aWindow.instants);
         }
 
         // Forward propagation
-        Array<State> forwardStates = propagator_.calculateStatesAt(this->cachedStateArray_[i], instants);
+        const Array<State> forwardStates = aPropagator.calculateStatesAt(thisState, aWindow.instants);
 
         // Backward propagation
-        Array<State> backwardStates = propagator_.calculateStatesAt(this->cachedStateArray_[i + 1], instants);
+        const Array<State> backwardStates = aPropagator.calculateStatesAt(nextState, aWindow.instants);
 
-        Real durationBetweenStates = (nextStateInstant - thisStateInstant).inSeconds();
+        const Real durationBetweenStates = (nextState.accessInstant() - thisState.accessInstant()).inSeconds();
 
         // Take weighted average
         Array<State> averagedStates = Array<State>::Empty();
-        averagedStates.reserve(instants.getSize());
+        averagedStates.reserve(aWindow.instants.getSize());
 
-        for (Size k = 0; k < instants.getSize(); ++k)
+        for (Size k = 0; k < aWindow.instants.getSize(); ++k)
         {
-            Real forwardWeight =
-                (this->cachedStateArray_[i + 1].accessInstant() - instants[k]).inSeconds() / durationBetweenStates;
-            Real backwardWeight =
-                (instants[k] - this->cachedStateArray_[i].accessInstant()).inSeconds() / durationBetweenStates;
+            const Real forwardWeight =
+                (nextState.accessInstant() - aWindow.instants[k]).inSeconds() / durationBetweenStates;
+            const Real backwardWeight =
+                (aWindow.instants[k] - thisState.accessInstant()).inSeconds() / durationBetweenStates;
 
-            VectorXd coordinates =
+            const VectorXd coordinates =
                 (forwardStates[k].accessCoordinates() * forwardWeight +
                  backwardStates[k].accessCoordinates() * backwardWeight);
 
-            averagedStates.add(outputStateBuilder.build(instants[k], coordinates));
+            averagedStates.add(outputStateBuilder.build(aWindow.instants[k], coordinates));
         }
 
-        allStates.add(averagedStates);
-    }
+        return averagedStates;
+    };
+
+    // Windows are independent, and are distributed over the workers of an execution context (serially on the calling
+    // worker when nested within a parallel operation)
+
+    const Size windowCount = windows.getSize();
 
-    // Propagate any remaining instants forward in time
+    Array<Array<State>> windowStates(windowCount, Array<State>::Empty());
+    Array<Array<State>> windowCheckpointStates(windowCount, Array<State>::Empty());
 
-    instants = Array<Instant>::Empty();
+    // Propagation calls keep their integration state to themselves, hence workers share the propagator
 
-    for (; j < anInstantArray.getSize(); ++j)
+    ExecutionContext(aThreadCount)
+        .parallelFor(
+            windowCount,
+            [this, &calculateWindowStates, &windows, &windowStates, &windowCheckpointStates](const Index& aWindowIndex)
+            {
+                windowStates[aWindowIndex] =
+                    calculateWindowStates(propagator_, windows[aWindowIndex], windowCheckpointStates[aWindowIndex]);
+            }
+        );
+
+    if (checkpointSpacing.isDefined())
     {
-        instants.add(anInstantArray[j]);
+        const std::lock_guard<std::mutex> lock(cacheMutex_);
+
+        for (const Array<State>& checkpointStates : windowCheckpointStates)
+        {
+            for (const State& checkpointState : checkpointStates)
+            {
+                this->insertCachedState(checkpointState, false);
+            }
+        }
+
+        this->evictCachedStates();
     }
 
-    allStates.add(propagator_.calculateStatesAt(this->cachedStateArray_.accessLast(), instants));
+    Array<State> allStates = Array<State>::Empty();
+    allStates.reserve(anInstantArray.getSize());
+
+    for (const Array<State>& states : windowStates)
+    {
+        allStates.add(states);
+    }
 
     return allStates;
 }
@@ -261,7 +455,15 @@ Integer Propagated::calculateRevolutionNumberAt(const Instant& anInstant) const
         throw ostk::core::error::runtime::Undefined("Propagated");
     }
 
-    if (anInstant == cachedStateArray_[0].accessInstant())
+    State epochState = State::Undefined();
+
+    {
+        const std::lock_guard<std::mutex> lock(cacheMutex_);
+
+        epochState = cachedStateArray_[0];
+    }
+
+    if (anInstant == epochState.accessInstant())
     {
         return this->getRevolutionNumberAtEpoch();
     }
@@ -272,14 +474,14 @@ Integer Propagated::calculateRevolutionNumberAt(const Instant& anInstant) const
     const Derived gravitationalParameter = Earth::Spherical.gravitationalParameter_;
     const Real gravitationalParameter_SI = gravitationalParameter.in(GravitationalParameterSIUnit);
 
-    Position currentPosition = cachedStateArray_[0].getPosition();
-    Velocity currentVelocity = cachedStateArray_[0].getVelocity();
+    Position currentPosition = epochState.getPosition();
+    Velocity currentVelocity = epochState.getVelocity();
 
     Vector3d currentPositionCoordinates = currentPosition.inUnit(Position::Unit::Meter).accessCoordinates();
     Vector3d currentVelocityCoordinates = currentVelocity.inUnit(Velocity::Unit::MeterPerSecond).accessCoordinates();
 
     // Determine whether to count revolution numbers in forwards or backwards time and return function if duration is 0
-    Instant currentInstant = cachedStateArray_[0].getInstant();
+    Instant currentInstant = epochState.getInstant();
     const double durationInSecs = (anInstant - currentInstant).inSeconds();
     if (durationInSecs == 0.0)
     {
@@ -290,6 +492,7 @@ Integer Propagated::calculateRevolutionNumberAt(const Instant& anInstant) const
     // Propagate towards desired instant a fraction of an orbit at a time in while loop, exit when arrived at desired
     // instant
     Integer revolutionNumber = this->getRevolutionNumberAtEpoch();
+
     while (true)
     {
         // Calculate orbital period
@@ -311,7 +514,7 @@ Integer Propagated::calculateRevolutionNumberAt(const Instant& anInstant) const
 
         // Propagate for duration of this orbital period
         const State currentState = propagator_.calculateStateAt(
-            cachedStateArray_[0], cachedStateArray_[0].accessInstant() + (durationSign * orbitalPeriod)
+            epochState, epochState.accessInstant() + (durationSign * orbitalPeriod)
         );
 
         // Update the current instant position and velocity coordinates
@@ -333,6 +536,18 @@ const Array<State>& Propagated::accessCachedStateArray() const
     return cachedStateArray_;
 }
 
+Array<State> Propagated::getCachedStateArray() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagated");
+    }
+
+    const std::lock_guard<std::mutex> lock(cacheMutex_);
+
+    return cachedStateArray_;
+}
+
 const Propagator& Propagated::accessPropagator() const
 {
     if (!this->isDefined())
@@ -343,13 +558,89 @@ const Propagator& Propagated::accessPropagator() const
     return propagator_;
 }
 
+Duration Propagated::getHermiteInterpolationSpan() const
+{
+    const std::lock_guard<std::mutex> lock(cacheMutex_);
+
+    return hermiteInterpolationSpan_;
+}
+
+void Propagated::setHermiteInterpolationSpan(const Duration& aDuration)
+{
+    if (aDuration.isDefined() && (!aDuration.isStrictlyPositive()))
+    {
+        throw ostk::core::error::runtime::Wrong("Hermite interpolation span");
+    }
+
+    const std::lock_guard<std::mutex> lock(cacheMutex_);
+
+    hermiteInterpolationSpan_ = aDuration;
+}
+
+Duration Propagated::getCheckpointSpacing() const
+{
+    const std::lock_guard<std::mutex> lock(cacheMutex_);
+
+    return checkpointSpacing_;
+}
+
+void Propagated::setCheckpointSpacing(const Duration& aDuration)
+{
+    if (aDuration.isDefined() && (!aDuration.isStrictlyPositive()))
+    {
+        throw ostk::core::error::runtime::Wrong("Checkpoint spacing");
+    }
+
+    const std::lock_guard<std::mutex> lock(cacheMutex_);
+
+    checkpointSpacing_ = aDuration;
+}
+
+Propagated::CachePolicy Propagated::getCachePolicy() const
+{
+    const std::lock_guard<std::mutex> lock(cacheMutex_);
+
+    return cachePolicy_;
+}
+
+void Propagated::setCachePolicy(const Propagated::CachePolicy& aCachePolicy)
+{
+    const std::lock_guard<std::mutex> lock(cacheMutex_);
+
+    cachePolicy_ = aCachePolicy;
+
+    this->evictCachedStates();
+}
+
+void Propagated::addCachedState(const State& aState)
+{
+    if (!aState.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State");
+    }
+
+    const std::lock_guard<std::mutex> lock(cacheMutex_);
+
+    if (!this->insertCachedState(aState, false))
+    {
+        throw ostk::core::error::runtime::Wrong(
+            "State at same instant but different position/velocity found in cachedStateArray"
+        );
+    }
+
+    this->evictCachedStates();
+}
+
 void Propagated::setCachedStateArray(const Array<State>& aStateArray)
 {
+    const std::lock_guard<std::mutex> lock(cacheMutex_);
+
     this->cachedStateArray_ = aStateArray;
 
     sanitizeCachedArray();
-}
 
+    this->evictCachedStates();
+}
 void Propagated::print(std::ostream& anOutputStream, bool displayDecorator) const
 {
     displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Propagated") : void();
@@ -381,9 +672,195 @@ bool Propagated::operator!=(const trajectory::Model& aModel) const
     return !((*this) == aModel);
 }
 
+bool Propagated::insertCachedState(const State& aState, const bool& isAnchor) const
+{
+    const auto iterator = std::lower_bound(
+        cachedStateArray_.begin(),
+        cachedStateArray_.end(),
+        aState.accessInstant(),
+        [](const State& aCachedState, const Instant& anInstant) -> bool
+        {
+            return aCachedState.accessInstant() < anInstant;
+        }
+    );
+
+    if ((iterator != cachedStateArray_.end()) && (iterator->accessInstant() == aState.accessInstant()))
+    {
+        return (*iterator == aState);
+    }
+
+    const Size index = std::distance(cachedStateArray_.begin(), iterator);
+
+    cachedStateArray_.insert(iterator, aState);
+    cacheEntries_.insert(cacheEntries_.begin() + index, {isAnchor, queryIndex_});
+
+    return true;
+}
+
+Array<State> Propagated::PropagateWithCheckpoints(
+    const Propagator& aPropagator,
+    const State& aState,
+    const Array<Instant>& anInstantArray,
+    const Duration& aCheckpointSpacing,
+    Array<State>& aCheckpointStateArray
+)
+{
+    // Checkpoints are only laid forward of the cached state, so that the epoch is left unchanged
+
+    if ((!aCheckpointSpacing.isDefined()) || (anInstantArray.accessLast() <= aState.accessInstant()))
+    {
+        return aPropagator.calculateStatesAt(aState, anInstantArray);
+    }
+
+    // Merge the requested instants with the checkpoint instants, at multiples of the spacing from the cached state
+
+    Array<Instant> instants = Array<Instant>::Empty();
+    Array<bool> isRequested = Array<bool>::Empty();
+    Array<bool> isCheckpoint = Array<bool>::Empty();
+
+    Instant checkpointInstant = aState.accessInstant() + aCheckpointSpacing;
+
+    for (const Instant& instant : anInstantArray)
+    {
+        while (checkpointInstant < instant)
+        {
+            instants.add(checkpointInstant);
+            isRequested.add(false);
+            isCheckpoint.add(true);
+
+            checkpointInstant += aCheckpointSpacing;
+        }
+
+        // Repeated requested instants are only propagated once
+
+        if ((!instants.isEmpty()) && (instants.accessLast() == instant))
+        {
+            continue;
+        }
+
+        const bool isAlsoCheckpoint = (checkpointInstant == instant);
+
+        instants.add(instant);
+        isRequested.add(true);
+        isCheckpoint.add(isAlsoCheckpoint);
+
+        if (isAlsoCheckpoint)
+        {
+            checkpointInstant += aCheckpointSpacing;
+        }
+    }
+
+    const Array<State> mergedStates = aPropagator.calculateStatesAt(aState, instants);
+
+    Array<State> states = Array<State>::Empty();
+    states.reserve(anInstantArray.getSize());
+
+    for (Size k = 0; k < instants.getSize(); ++k)
+    {
+        if (isCheckpoint[k])
+        {
+            aCheckpointStateArray.add(mergedStates[k]);
+        }
+
+        if (isRequested[k])
+        {
+            states.add(mergedStates[k]);
+
+            while ((states.getSize() < anInstantArray.getSize()) &&
+                   (anInstantArray[states.getSize()] == instants[k]))
+            {
+                states.add(mergedStates[k]);
+            }
+        }
+    }
+
+    return states;
+}
+
+bool Propagated::CanInterpolateHermite(
+    const State& aState, const State& anotherState, const Duration& aHermiteInterpolationSpan
+)
+{
+    if (!aHermiteInterpolationSpan.isDefined())
+    {
+        return false;
+    }
+
+    if ((anotherState.accessInstant() - aState.accessInstant()) > aHermiteInterpolationSpan)
+    {
+        return false;
+    }
+
+    const Shared<const CoordinateBroker>& coordinateBrokerSPtr = aState.accessCoordinateBroker();
+
+    return (*aState.accessFrame() == *anotherState.accessFrame()) &&
+           (*coordinateBrokerSPtr == *anotherState.accessCoordinateBroker()) &&
+           coordinateBrokerSPtr->hasSubset(CartesianPosition::Default()) &&
+           coordinateBrokerSPtr->hasSubset(CartesianVelocity::Default());
+}
+
+Array<State> Propagated::InterpolateHermite(
+    const State& aState, const State& anotherState, const Array<Instant>& anInstantArray
+)
+{
+    const Shared<const CoordinateBroker>& coordinateBrokerSPtr = aState.accessCoordinateBroker();
+
+    const Index positionIndex = coordinateBrokerSPtr->getSubsetIndex(CartesianPosition::Default());
+    const Index velocityIndex = coordinateBrokerSPtr->getSubsetIndex(CartesianVelocity::Default());
+
+    const Eigen::Ref<const VectorXd> coordinates = aState.accessCoordinates();
+    const Eigen::Ref<const VectorXd> nextCoordinates = anotherState.accessCoordinates();
+
+    const Vector3d position = coordinates.segment<3>(positionIndex);
+    const Vector3d velocity = coordinates.segment<3>(velocityIndex);
+    const Vector3d nextPosition = nextCoordinates.segment<3>(positionIndex);
+    const Vector3d nextVelocity = nextCoordinates.segment<3>(velocityIndex);
+
+    const double duration = (anotherState.accessInstant() - aState.accessInstant()).inSeconds();
+
+    const StateBuilder stateBuilder = {aState};
+
+    Array<State> states = Array<State>::Empty();
+    states.reserve(anInstantArray.getSize());
+
+    for (const Instant& instant : anInstantArray)
+    {
+        const double s = (instant - aState.accessInstant()).inSeconds() / duration;
+        const double s2 = s * s;
+        const double s3 = s2 * s;
+
+        // Cubic Hermite basis functions and their derivatives (with respect to s)
+
+        const double h00 = 2.0 * s3 - 3.0 * s2 + 1.0;
+        const double h10 = s3 - 2.0 * s2 + s;
+        const double h01 = -2.0 * s3 + 3.0 * s2;
+        const double h11 = s3 - s2;
+
+        const double dh00 = 6.0 * s2 - 6.0 * s;
+        const double dh10 = 3.0 * s2 - 4.0 * s + 1.0;
+        const double dh01 = -6.0 * s2 + 6.0 * s;
+        const double dh11 = 3.0 * s2 - 2.0 * s;
+
+        // Coordinates other than position and velocity are interpolated linearly
+
+        VectorXd interpolatedCoordinates = (1.0 - s) * coordinates + s * nextCoordinates;
+
+        interpolatedCoordinates.segment<3>(positionIndex) =
+            h00 * position + h10 * duration * velocity + h01 * nextPosition + h11 * duration * nextVelocity;
+        interpolatedCoordinates.segment<3>(velocityIndex) =
+            (dh00 * position + dh01 * nextPosition) / duration + dh10 * velocity + dh11 * nextVelocity;
+
+        states.add(stateBuilder.build(instant, interpolatedCoordinates));
+    }
+
+    return states;
+}
+
 void Propagated::sanitizeCachedArray() const
 {
-    if (!this->isDefined())
+    // Called under the cache lock, hence not through isDefined
+
+    if (cachedStateArray_.isEmpty() || (!propagator_.isDefined()))
     {
         throw ostk::core::error::runtime::Undefined("Propagated");
     }
@@ -398,27 +875,96 @@ void Propagated::sanitizeCachedArray() const
         }
     );
 
-    cachedStateArray_.erase(std::unique(cachedStateArray_.begin(), cachedStateArray_.end()), cachedStateArray_.end());
+    // Remove duplicate states in a single pass, in place: states are only compared when their instants match, and
+    // states at a same instant must be identical
+
+    Size uniqueStateCount = 0;
 
-    // Check to see if there are any duplicated instants with different positions and velocities
-    Array<State> cachedStateArrayUnique(cachedStateArray_);
-    cachedStateArrayUnique.erase(
-        std::unique(
-            cachedStateArrayUnique.begin(),
-            cachedStateArrayUnique.end(),
-            [](const auto& lhs, const auto& rhs)
+    for (Size index = 0; index < cachedStateArray_.getSize(); ++index)
+    {
+        if ((uniqueStateCount > 0) &&
+            (cachedStateArray_[index].accessInstant() == cachedStateArray_[uniqueStateCount - 1].accessInstant()))
+        {
+            if (cachedStateArray_[index] != cachedStateArray_[uniqueStateCount - 1])
             {
-                return lhs.accessInstant() == rhs.accessInstant();
+                throw ostk::core::error::runtime::Wrong(
+                    "State array with States at same instant but different position/velocity were found in "
+                    "cachedStateArray"
+                );
             }
-        ),
-        cachedStateArrayUnique.end()
-    );
 
-    if (cachedStateArray_.getSize() != cachedStateArrayUnique.getSize())
+            continue;
+        }
+
+        if (index != uniqueStateCount)
+        {
+            cachedStateArray_[uniqueStateCount] = cachedStateArray_[index];
+        }
+
+        ++uniqueStateCount;
+    }
+
+    cachedStateArray_.erase(cachedStateArray_.begin() + uniqueStateCount, cachedStateArray_.end());
+
+    // Sanitized states are all anchors
+
+    cacheEntries_ = Array<CacheEntry>(cachedStateArray_.getSize(), {true, queryIndex_});
+}
+
+void Propagated::touchCachedState(const Size& aCachedStateIndex) const
+{
+    cacheEntries_[aCachedStateIndex].lastQueryIndex = queryIndex_;
+}
+
+void Propagated::evictCachedStates() const
+{
+    const auto estimateMemorySize = [](const State& aState) -> Size
     {
-        throw ostk::core::error::runtime::Wrong(
-            "State array with States at same instant but different position/velocity were found in cachedStateArray"
-        );
+        return sizeof(State) + aState.getSize() * sizeof(double);
+    };
+
+    Size memorySize = 0;
+
+    for (const State& state : cachedStateArray_)
+    {
+        memorySize += estimateMemorySize(state);
+    }
+
+    const auto exceedsPolicy = [this, &memorySize]() -> bool
+    {
+        const bool exceedsStateCount =
+            (cachePolicy_.maximumStateCount > 0) && (cachedStateArray_.getSize() > cachePolicy_.maximumStateCount);
+        const bool exceedsMemorySize =
+            (cachePolicy_.maximumMemorySize > 0) && (memorySize > cachePolicy_.maximumMemorySize);
+
+        return exceedsStateCount || exceedsMemorySize;
+    };
+
+    while (exceedsPolicy())
+    {
+        // Evict the least recently queried non anchor state, if any
+
+        Size evictedIndex = cachedStateArray_.getSize();
+
+        for (Size i = 0; i < cacheEntries_.getSize(); ++i)
+        {
+            if ((!cacheEntries_[i].isAnchor) &&
+                ((evictedIndex == cachedStateArray_.getSize()) ||
+                 (cacheEntries_[i].lastQueryIndex < cacheEntries_[evictedIndex].lastQueryIndex)))
+            {
+                evictedIndex = i;
+            }
+        }
+
+        if (evictedIndex == cachedStateArray_.getSize())
+        {
+            break;
+        }
+
+        memorySize -= estimateMemorySize(cachedStateArray_[evictedIndex]);
+
+        cachedStateArray_.erase(cachedStateArray_.begin() + evictedIndex);
+        cacheEntries_.erase(cacheEntries_.begin() + evictedIndex);
     }
 }
 
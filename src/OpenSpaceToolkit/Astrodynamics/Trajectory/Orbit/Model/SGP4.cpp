@@ -1,6 +1,11 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <cmath>
+#include <exception>
 #include <iostream>
+#include <limits>
+#include <vector>
 
 #include <sgp4/SGP4.h>
 
@@ -10,6 +15,7 @@
 #include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/SGP4.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/TransformCache.hpp>
 
 namespace ostk
 {
@@ -22,39 +28,120 @@ namespace orbit
 namespace model
 {
 
+using ostk::mathematics::object::Matrix3d;
+using ostk::mathematics::object::Vector3d;
+
 using ostk::physics::coordinate::Transform;
+using ostk::physics::time::Duration;
+
+using ostk::astrodynamics::trajectory::state::TransformCache;
+
+struct MeanElementRates
+{
+    double meanMotion_radSec;
+    double aopRate_radSec;  // J2 secular rate of the argument of perigee
+    double meanMotionRate_radSec2;
+};
+
+static MeanElementRates ComputeMeanElementRates(const TLE& aTle)
+{
+    using ostk::physics::unit::Angle;
+    using ostk::physics::unit::Derived;
+    using ostk::physics::unit::Time;
+
+    // WGS-72 constants, as used by SGP4
+
+    static const double gravitationalParameter_SI = 398600.8e9;
+    static const double equatorialRadius_m = 6378135.0;
+    static const double j2 = 0.001082616;
+
+    static const double twoPi = 2.0 * M_PI;
+    static const double secondsPerDay = 86400.0;
+
+    const double eccentricity = aTle.getEccentricity();
+    const double inclination_rad = aTle.getInclination().inRadians();
+
+    const double meanMotion_radSec =
+        aTle.getMeanMotion().in(Derived::Unit::AngularVelocity(Angle::Unit::Radian, Time::Unit::Second));
+    const double meanMotionRate_radSec2 =
+        2.0 * double(aTle.getMeanMotionFirstTimeDerivativeDividedByTwo()) * twoPi / (secondsPerDay * secondsPerDay);
+
+    const double semiMajorAxis_m = std::cbrt(gravitationalParameter_SI / (meanMotion_radSec * meanMotion_radSec));
+    const double semiLatusRectum_m = semiMajorAxis_m * (1.0 - eccentricity * eccentricity);
+    const double cosInclination = std::cos(inclination_rad);
+
+    const double aopRate_radSec = 0.75 * meanMotion_radSec * j2 * std::pow(equatorialRadius_m / semiLatusRectum_m, 2) *
+                                  (5.0 * cosInclination * cosInclination - 1.0);
+
+    return {meanMotion_radSec, aopRate_radSec, meanMotionRate_radSec2};
+}
 
 class SGP4::Impl
 {
    public:
-    Impl(const TLE& aTle);
+    Impl(const TLE& aTle, const SGP4::OutputFrame& anOutputFrame);
 
     Impl(const SGP4::Impl& anImpl) = delete;
 
     SGP4::Impl& operator=(const SGP4::Impl& anImpl) = delete;
 
+    const Shared<const Frame>& accessOutputFrame() const;
+
     State calculateStateAt(const Instant& anInstant) const;
 
+    void calculateCoordinatesAt(const Instant& anInstant, Vector3d& aPosition, Vector3d& aVelocity) const;
+
    private:
     const TLE& tle_;
+    const SGP4::OutputFrame outputFrame_;
     libsgp4::SGP4 sgp4_;
 
     Shared<const Frame> temeFrameOfEpochSPtr_;
 };
 
-SGP4::Impl::Impl(const TLE& aTle)
+SGP4::Impl::Impl(const TLE& aTle, const SGP4::OutputFrame& anOutputFrame)
     : tle_(aTle),
+      outputFrame_(anOutputFrame),
       sgp4_(libsgp4::Tle(tle_.getSatelliteName(), tle_.getFirstLine(), tle_.getSecondLine())),
       temeFrameOfEpochSPtr_(Frame::TEMEOfEpoch(tle_.getEpoch()))
 {
 }
 
+const Shared<const Frame>& SGP4::Impl::accessOutputFrame() const
+{
+    static const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+    static const Shared<const Frame> temeSPtr = Frame::TEME();
+
+    switch (this->outputFrame_)
+    {
+        case SGP4::OutputFrame::TEMEOfEpoch:
+            return this->temeFrameOfEpochSPtr_;
+
+        case SGP4::OutputFrame::TEME:
+            return temeSPtr;
+
+        default:
+            return gcrfSPtr;
+    }
+}
+
 State SGP4::Impl::calculateStateAt(const Instant& anInstant) const
 {
-    using ostk::mathematics::object::Vector3d;
+    Vector3d x_m;
+    Vector3d v_mps;
+
+    this->calculateCoordinatesAt(anInstant, x_m, v_mps);
+
+    const Shared<const Frame>& frameSPtr = this->accessOutputFrame();
 
-    using ostk::physics::time::Duration;
+    const Position position = {x_m, Position::Unit::Meter, frameSPtr};
+    const Velocity velocity = {v_mps, Velocity::Unit::MeterPerSecond, frameSPtr};
 
+    return {anInstant, position, velocity};
+}
+
+void SGP4::Impl::calculateCoordinatesAt(const Instant& anInstant, Vector3d& aPosition, Vector3d& aVelocity) const
+{
     const Real durationFromEpoch_min = Duration::Between(this->tle_.getEpoch(), anInstant).inMinutes();
 
     const libsgp4::Eci xv_TEME = this->sgp4_.FindPosition(durationFromEpoch_min);
@@ -65,29 +152,52 @@ State SGP4::Impl::calculateStateAt(const Instant& anInstant) const
     const Vector3d x_TEME_m = Vector3d(x_TEME_km.x, x_TEME_km.y, x_TEME_km.z) * 1e3;
     const Vector3d v_TEME_mps = Vector3d(v_TEME_kmps.x, v_TEME_kmps.y, v_TEME_kmps.z) * 1e3;
 
-    const Position position_TEME = {x_TEME_m, Position::Unit::Meter, this->temeFrameOfEpochSPtr_};
-    const Velocity velocity_TEME = {v_TEME_mps, Velocity::Unit::MeterPerSecond, this->temeFrameOfEpochSPtr_};
+    if (this->outputFrame_ == SGP4::OutputFrame::TEMEOfEpoch)
+    {
+        aPosition = x_TEME_m;
+        aVelocity = v_TEME_mps;
 
-    const State state_TEME = {anInstant, position_TEME, velocity_TEME};
+        return;
+    }
 
     static const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+    static const Shared<const Frame> temeSPtr = Frame::TEME();
+
+    // TEME of epoch is frozen at the TLE epoch, hence its transform to GCRF is the same at all instants, and is shared
+    // through the transform cache by all the models of this TLE
+
+    const Transform transform = TransformCache::Get(this->temeFrameOfEpochSPtr_, gcrfSPtr, this->tle_.getEpoch());
 
-    const State state_GCRF = state_TEME.inFrame(gcrfSPtr);
+    const Vector3d x_GCRF_m = transform.applyToPosition(x_TEME_m);
+    const Vector3d v_GCRF_mps = transform.applyToVelocity(x_TEME_m, v_TEME_mps);
+
+    if (this->outputFrame_ == SGP4::OutputFrame::TEME)
+    {
+        const Transform temeTransform = TransformCache::Get(gcrfSPtr, temeSPtr, anInstant);
 
-    return state_GCRF;
+        aPosition = temeTransform.applyToPosition(x_GCRF_m);
+        aVelocity = temeTransform.applyToVelocity(x_GCRF_m, v_GCRF_mps);
+
+        return;
+    }
+
+    aPosition = x_GCRF_m;
+    aVelocity = v_GCRF_mps;
 }
 
-SGP4::SGP4(const TLE& aTle)
+SGP4::SGP4(const TLE& aTle, const SGP4::OutputFrame& anOutputFrame)
     : Model(),
       tle_(aTle),
-      implUPtr_(std::make_unique<SGP4::Impl>(tle_))
+      outputFrame_(anOutputFrame),
+      implUPtr_(std::make_unique<SGP4::Impl>(tle_, outputFrame_))
 {
 }
 
 SGP4::SGP4(const SGP4& aSGP4Model)
     : Model(aSGP4Model),
       tle_(aSGP4Model.tle_),
-      implUPtr_(std::make_unique<SGP4::Impl>(tle_))
+      outputFrame_(aSGP4Model.outputFrame_),
+      implUPtr_(std::make_unique<SGP4::Impl>(tle_, outputFrame_))
 {
 }
 
@@ -100,8 +210,9 @@ SGP4& SGP4::operator=(const SGP4& aSGP4Model)
         Model::operator=(aSGP4Model);
 
         this->tle_ = aSGP4Model.tle_;
+        this->outputFrame_ = aSGP4Model.outputFrame_;
 
-        this->implUPtr_ = std::make_unique<SGP4::Impl>(tle_);
+        this->implUPtr_ = std::make_unique<SGP4::Impl>(tle_, outputFrame_);
     }
 
     return *this;
@@ -119,7 +230,7 @@ bool SGP4::operator==(const SGP4& aSGP4Model) const
         return false;
     }
 
-    return this->tle_ == aSGP4Model.tle_;
+    return (this->tle_ == aSGP4Model.tle_) && (this->outputFrame_ == aSGP4Model.outputFrame_);
 }
 
 bool SGP4::operator!=(const SGP4& aSGP4Model) const
@@ -149,6 +260,11 @@ TLE SGP4::getTle() const
     return this->tle_;
 }
 
+SGP4::OutputFrame SGP4::getOutputFrame() const
+{
+    return this->outputFrame_;
+}
+
 Instant SGP4::getEpoch() const
 {
     if (!this->isDefined())
@@ -184,6 +300,40 @@ State SGP4::calculateStateAt(const Instant& anInstant) const
     return this->implUPtr_->calculateStateAt(anInstant);
 }
 
+Ephemeris SGP4::calculateEphemerisAt(const Array<Instant>& anInstantArray) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("SGP4");
+    }
+
+    if (anInstantArray.isEmpty())
+    {
+        return Ephemeris::Undefined();
+    }
+
+    MatrixXd positions(anInstantArray.getSize(), 3);
+    MatrixXd velocities(anInstantArray.getSize(), 3);
+
+    Vector3d x_m;
+    Vector3d v_mps;
+
+    for (Size index = 0; index < anInstantArray.getSize(); ++index)
+    {
+        if (!anInstantArray[index].isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Instant");
+        }
+
+        this->implUPtr_->calculateCoordinatesAt(anInstantArray[index], x_m, v_mps);
+
+        positions.row(index) = x_m.transpose();
+        velocities.row(index) = v_mps.transpose();
+    }
+
+    return {anInstantArray, positions, velocities, this->implUPtr_->accessOutputFrame()};
+}
+
 Integer SGP4::calculateRevolutionNumberAt(const Instant& anInstant) const
 {
     if (!anInstant.isDefined())
@@ -201,15 +351,96 @@ Integer SGP4::calculateRevolutionNumberAt(const Instant& anInstant) const
         return this->getRevolutionNumberAtEpoch();
     }
 
+    static const double twoPi = 2.0 * M_PI;
+
+    // Initial guess from the unwrapped mean argument of latitude, which ignores the equation of center, then
+    // correction against the estimated ascending nodes bounding the revolution
+
+    const MeanElementRates rates = ComputeMeanElementRates(this->tle_);
+
+    const double duration_s = Duration::Between(this->tle_.getEpoch(), anInstant).inSeconds();
+
+    const double meanArgumentOfLatitudeAtEpoch_rad =
+        this->tle_.getAop().inRadians() + this->tle_.getMeanAnomaly().inRadians();
+    const double meanArgumentOfLatitude_rad = meanArgumentOfLatitudeAtEpoch_rad +
+                                              (rates.meanMotion_radSec + rates.aopRate_radSec) * duration_s +
+                                              0.5 * rates.meanMotionRate_radSec2 * duration_s * duration_s;
+
+    Integer revolutionNumber =
+        this->getRevolutionNumberAtEpoch() +
+        static_cast<int>(
+            std::floor(meanArgumentOfLatitude_rad / twoPi) - std::floor(meanArgumentOfLatitudeAtEpoch_rad / twoPi)
+        );
+
+    // The guess is off by at most one revolution for near-circular orbits, and by a couple for eccentric ones
+
+    static const Size maximumCorrectionCount = 4;
+
+    for (Size correctionIndex = 0; correctionIndex < maximumCorrectionCount; ++correctionIndex)
+    {
+        const Instant ascendingNodeInstant = this->estimateAscendingNodeInstant(revolutionNumber);
+
+        if (!ascendingNodeInstant.isDefined())
+        {
+            return Integer::Undefined();
+        }
+
+        if (ascendingNodeInstant > anInstant)
+        {
+            revolutionNumber -= 1;
+
+            continue;
+        }
+
+        const Instant nextAscendingNodeInstant = this->estimateAscendingNodeInstant(revolutionNumber + 1);
+
+        if (nextAscendingNodeInstant.isDefined() && (nextAscendingNodeInstant <= anInstant))
+        {
+            revolutionNumber += 1;
+
+            continue;
+        }
+
+        return revolutionNumber;
+    }
+
     return Integer::Undefined();
 }
 
+Instant SGP4::estimateAscendingNodeInstant(const Integer& aRevolutionNumber) const
+{
+    if (!aRevolutionNumber.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Revolution number");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("SGP4");
+    }
+
+    const MeanElementRates rates = ComputeMeanElementRates(this->tle_);
+
+    const Real duration_s = Model::EstimateAscendingNodeDurationFromEpoch(
+        aRevolutionNumber - this->getRevolutionNumberAtEpoch(),
+        this->tle_.getEccentricity(),
+        this->tle_.getAop().inRadians(),
+        this->tle_.getMeanAnomaly().inRadians(),
+        rates.meanMotion_radSec,
+        rates.aopRate_radSec,
+        rates.meanMotionRate_radSec2
+    );
+
+    return duration_s.isDefined() ? this->getEpoch() + Duration::Seconds(duration_s) : Instant::Undefined();
+}
+
 void SGP4::print(std::ostream& anOutputStream, bool displayDecorator) const
 {
     displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "SGP4") : void();
 
     ostk::core::utils::Print::Line(anOutputStream)
         << "Epoch:" << (this->getEpoch().isDefined() ? this->getEpoch().toString() : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream) << "Output Frame:" << SGP4::StringFromOutputFrame(outputFrame_);
 
     ostk::core::utils::Print::Separator(anOutputStream, "Two-Line Elements");
 
@@ -218,6 +449,113 @@ void SGP4::print(std::ostream& anOutputStream, bool displayDecorator) const
     displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
 }
 
+String SGP4::StringFromOutputFrame(const SGP4::OutputFrame& anOutputFrame)
+{
+    switch (anOutputFrame)
+    {
+        case SGP4::OutputFrame::GCRF:
+            return "GCRF";
+
+        case SGP4::OutputFrame::TEME:
+            return "TEME";
+
+        case SGP4::OutputFrame::TEMEOfEpoch:
+            return "TEMEOfEpoch";
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Output frame");
+    }
+
+    return String::Empty();
+}
+
+MatrixXd SGP4::CalculateCatalogStatesAt(
+    const Array<TLE>& aTleArray, const Array<Instant>& anInstantArray, const Size& aThreadCount
+)
+{
+    return SGP4::CalculateCatalogStatesAt(aTleArray, anInstantArray, ExecutionContext(aThreadCount));
+}
+
+MatrixXd SGP4::CalculateCatalogStatesAt(
+    const Array<TLE>& aTleArray, const Array<Instant>& anInstantArray, const ExecutionContext& anExecutionContext
+)
+{
+    for (const TLE& tle : aTleArray)
+    {
+        if (!tle.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("TLE");
+        }
+    }
+
+    for (const Instant& instant : anInstantArray)
+    {
+        if (!instant.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Instant");
+        }
+    }
+
+    const Size tleCount = aTleArray.getSize();
+    const Size instantCount = anInstantArray.getSize();
+
+    MatrixXd states = MatrixXd::Zero(6, instantCount * tleCount);
+
+    if (states.size() == 0)
+    {
+        return states;
+    }
+
+    static const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+    static const Shared<const Frame> temeSPtr = Frame::TEME();
+
+    anExecutionContext.parallelFor(
+        tleCount,
+        [&aTleArray, &anInstantArray, &states, tleCount, instantCount](const Index& aTleIndex) -> void
+        {
+            const TLE& tle = aTleArray[aTleIndex];
+
+            const libsgp4::SGP4 sgp4 = {libsgp4::Tle(tle.getSatelliteName(), tle.getFirstLine(), tle.getSecondLine())};
+
+            // TEME of epoch is TEME frozen at the TLE epoch: its rotation to GCRF is the same at all instants
+
+            const Transform transform = temeSPtr->getTransformTo(gcrfSPtr, tle.getEpoch());
+
+            Matrix3d R_GCRF_TEME;
+            R_GCRF_TEME.col(0) = transform.applyToVector({1.0, 0.0, 0.0});
+            R_GCRF_TEME.col(1) = transform.applyToVector({0.0, 1.0, 0.0});
+            R_GCRF_TEME.col(2) = transform.applyToVector({0.0, 0.0, 1.0});
+
+            const Matrix3d R_GCRF_TEME_m = R_GCRF_TEME * 1e3;
+
+            for (Size instantIndex = 0; instantIndex < instantCount; ++instantIndex)
+            {
+                auto state = states.col(instantIndex * tleCount + aTleIndex);
+
+                try
+                {
+                    const double durationFromEpoch_min =
+                        Duration::Between(tle.getEpoch(), anInstantArray[instantIndex]).inMinutes();
+
+                    const libsgp4::Eci xv_TEME = sgp4.FindPosition(durationFromEpoch_min);
+
+                    const libsgp4::Vector x_TEME_km = xv_TEME.Position();
+                    const libsgp4::Vector v_TEME_kmps = xv_TEME.Velocity();
+
+                    state.head<3>() = R_GCRF_TEME_m * Vector3d(x_TEME_km.x, x_TEME_km.y, x_TEME_km.z);
+                    state.tail<3>() = R_GCRF_TEME_m * Vector3d(v_TEME_kmps.x, v_TEME_kmps.y, v_TEME_kmps.z);
+                }
+                catch (const std::exception&)
+                {
+                    state.setConstant(std::numeric_limits<double>::quiet_NaN());
+                }
+            }
+        }
+    );
+
+    return states;
+}
+
 bool SGP4::operator==(const trajectory::Model& aModel) const
 {
     const SGP4* aSGP4ModelPtr = dynamic_cast<const SGP4*>(&aModel);
@@ -1,7 +1,13 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
 #include <iostream>
 #include <regex>
+#include <string_view>
+#include <vector>
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Error.hpp>
@@ -24,6 +30,60 @@ namespace model
 namespace sgp4
 {
 
+static const char SnapshotMagic[8] = {'O', 'S', 'T', 'K', 'T', 'L', 'E', '\0'};
+static const std::uint32_t SnapshotVersion = 1;
+static const std::uint32_t SnapshotByteOrderMark = 0x01020304;
+static const std::size_t SnapshotLineLength = 69;
+
+struct SnapshotHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byteOrderMark;
+    std::uint64_t recordCount;
+    std::uint64_t namesSize;
+};
+
+struct SnapshotRecord
+{
+    std::uint32_t nameOffset;
+    std::uint32_t nameLength;
+    char firstLine[SnapshotLineLength];
+    char secondLine[SnapshotLineLength];
+};
+
+static String ReadFile(const File& aFile)
+{
+    if (!aFile.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("File");
+    }
+
+    if (!aFile.exists())
+    {
+        throw ostk::core::error::RuntimeError("File [{}] does not exist.", aFile.toString());
+    }
+
+    // Read the whole file at once, rather than line by line
+
+    std::ifstream fileStream(aFile.getPath().toString(), std::ios::binary);
+
+    if (!fileStream.is_open())
+    {
+        throw ostk::core::error::RuntimeError("Cannot open file [{}].", aFile.toString());
+    }
+
+    fileStream.seekg(0, std::ios::end);
+
+    String contents;
+    contents.resize(static_cast<std::size_t>(fileStream.tellg()));
+
+    fileStream.seekg(0, std::ios::beg);
+    fileStream.read(contents.data(), static_cast<std::streamsize>(contents.size()));
+
+    return contents;
+}
+
 TLE::TLE(const String& aFirstLine, const String& aSecondLine)
     : satelliteName_(String::Empty()),
       firstLine_(aFirstLine),
@@ -435,6 +495,13 @@ void TLE::setRevolutionNumberAtEpoch(const Integer& aRevolutionNumberAtEpoch)
     }
 }
 
+TLE::TLE(String&& aSatelliteName, String&& aFirstLine, String&& aSecondLine, [[maybe_unused]] const bool& isValidated)
+    : satelliteName_(std::move(aSatelliteName)),
+      firstLine_(std::move(aFirstLine)),
+      secondLine_(std::move(aSecondLine))
+{
+}
+
 TLE TLE::Undefined()
 {
     return {String::Empty(), String::Empty(), String::Empty()};
@@ -556,6 +623,277 @@ TLE TLE::Load(const File& aFile)
     return TLE::Parse(tleString);
 }
 
+Array<TLE> TLE::ParseCatalog(const String& aString, const Size& aThreadCount)
+{
+    return TLE::ParseCatalog(aString, ExecutionContext(aThreadCount));
+}
+
+Array<TLE> TLE::ParseCatalog(const String& aString, const ExecutionContext& anExecutionContext)
+{
+    constexpr std::size_t lineLength = 69;
+
+    // Scan the lines in place
+
+    std::vector<std::string_view> lines;
+    lines.reserve(std::count(aString.begin(), aString.end(), '\n') + 1);
+
+    const std::string_view string = aString;
+
+    for (std::size_t lineStart = 0; lineStart < string.size();)
+    {
+        std::size_t lineEnd = string.find('\n', lineStart);
+
+        if (lineEnd == std::string_view::npos)
+        {
+            lineEnd = string.size();
+        }
+
+        std::string_view line = string.substr(lineStart, lineEnd - lineStart);
+
+        if ((!line.empty()) && (line.back() == '\r'))
+        {
+            line.remove_suffix(1);
+        }
+
+        if (!line.empty())
+        {
+            lines.push_back(line);
+        }
+
+        lineStart = lineEnd + 1;
+    }
+
+    // Group the lines into records: two element lines, optionally preceded by a name line
+
+    struct Record
+    {
+        std::string_view satelliteName;
+        std::string_view firstLine;
+        std::string_view secondLine;
+    };
+
+    const auto isElementLine = [lineLength](const std::string_view& aLine, const char aLineNumber) -> bool
+    {
+        return (aLine.size() == lineLength) && (aLine[0] == aLineNumber) && (aLine[1] == ' ');
+    };
+
+    std::vector<Record> records;
+    records.reserve(lines.size() / 2);
+
+    for (std::size_t i = 0; i < lines.size();)
+    {
+        if (((i + 1) < lines.size()) && isElementLine(lines[i], '1') && isElementLine(lines[i + 1], '2'))
+        {
+            records.push_back({std::string_view(), lines[i], lines[i + 1]});
+            i += 2;
+        }
+        else if (((i + 2) < lines.size()) && isElementLine(lines[i + 1], '1') && isElementLine(lines[i + 2], '2'))
+        {
+            records.push_back({lines[i], lines[i + 1], lines[i + 2]});
+            i += 3;
+        }
+        else
+        {
+            throw ostk::core::error::runtime::Wrong("TLE catalog line", String(std::string(lines[i])));
+        }
+    }
+
+    // Validate the checksums and build the TLEs, in parallel chunks
+
+    const auto isValidLine = [lineLength](const std::string_view& aLine) -> bool
+    {
+        int checksum = 0;
+
+        for (std::size_t idx = 0; idx < (lineLength - 1); ++idx)
+        {
+            const char character = aLine[idx];
+
+            checksum += ((character >= '0') && (character <= '9')) ? (character - '0') : ((character == '-') ? 1 : 0);
+        }
+
+        const char checksumCharacter = aLine[lineLength - 1];
+
+        return ((checksumCharacter >= '0') && (checksumCharacter <= '9')) &&
+               ((checksumCharacter - '0') == (checksum % 10));
+    };
+
+    const Size recordCount = records.size();
+
+    Array<TLE> tles(recordCount, TLE::Undefined());
+
+    static constexpr Size ChunkSize = 256;
+
+    const Size chunkCount = (recordCount + ChunkSize - 1) / ChunkSize;
+
+    anExecutionContext.parallelFor(
+        chunkCount,
+        [&tles, &records, &isValidLine, recordCount](const Index& aChunkIndex) -> void
+        {
+            const Size recordEnd = std::min<Size>(recordCount, (aChunkIndex + 1) * ChunkSize);
+
+            for (Size recordIndex = aChunkIndex * ChunkSize; recordIndex < recordEnd; ++recordIndex)
+            {
+                const Record& record = records[recordIndex];
+
+                if ((!isValidLine(record.firstLine)) || (!isValidLine(record.secondLine)))
+                {
+                    throw ostk::core::error::runtime::Wrong("TLE", String(std::string(record.firstLine)));
+                }
+
+                tles[recordIndex] = TLE(
+                    String(std::string(record.satelliteName)),
+                    String(std::string(record.firstLine)),
+                    String(std::string(record.secondLine)),
+                    true
+                );
+            }
+        }
+    );
+
+    return tles;
+}
+
+Array<TLE> TLE::LoadCatalog(const File& aFile, const Size& aThreadCount)
+{
+    return TLE::ParseCatalog(ReadFile(aFile), aThreadCount);
+}
+
+Array<TLE> TLE::LoadCatalog(const File& aFile, const ExecutionContext& anExecutionContext)
+{
+    return TLE::ParseCatalog(ReadFile(aFile), anExecutionContext);
+}
+
+void TLE::SaveCatalogSnapshot(const Array<TLE>& aTLEArray, const File& aFile)
+{
+    if (!aFile.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("File");
+    }
+
+    using ostk::core::type::Index;
+
+    std::vector<SnapshotRecord> records(aTLEArray.getSize());
+    String names;
+
+    for (Index tleIndex = 0; tleIndex < aTLEArray.getSize(); ++tleIndex)
+    {
+        const TLE& tle = aTLEArray[tleIndex];
+
+        if (!tle.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("TLE");
+        }
+
+        SnapshotRecord& record = records[tleIndex];
+
+        record.nameOffset = static_cast<std::uint32_t>(names.size());
+        record.nameLength = static_cast<std::uint32_t>(tle.satelliteName_.size());
+
+        std::memcpy(record.firstLine, tle.firstLine_.data(), SnapshotLineLength);
+        std::memcpy(record.secondLine, tle.secondLine_.data(), SnapshotLineLength);
+
+        names += tle.satelliteName_;
+    }
+
+    SnapshotHeader header;
+
+    std::memcpy(header.magic, SnapshotMagic, sizeof(SnapshotMagic));
+    header.version = SnapshotVersion;
+    header.byteOrderMark = SnapshotByteOrderMark;
+    header.recordCount = records.size();
+    header.namesSize = names.size();
+
+    std::ofstream fileStream(aFile.getPath().toString(), std::ios::binary | std::ios::trunc);
+
+    if (!fileStream.is_open())
+    {
+        throw ostk::core::error::RuntimeError("Cannot open file [{}].", aFile.toString());
+    }
+
+    fileStream.write(reinterpret_cast<const char*>(&header), sizeof(SnapshotHeader));
+    fileStream.write(
+        reinterpret_cast<const char*>(records.data()),
+        static_cast<std::streamsize>(records.size() * sizeof(SnapshotRecord))
+    );
+    fileStream.write(names.data(), static_cast<std::streamsize>(names.size()));
+
+    if (!fileStream.good())
+    {
+        throw ostk::core::error::RuntimeError("Cannot write file [{}].", aFile.toString());
+    }
+}
+
+Array<TLE> TLE::LoadCatalogSnapshot(const File& aFile)
+{
+    const String contents = ReadFile(aFile);
+
+    SnapshotHeader header;
+
+    if (contents.size() < sizeof(SnapshotHeader))
+    {
+        throw ostk::core::error::RuntimeError("File [{}] is not a TLE catalog snapshot.", aFile.toString());
+    }
+
+    std::memcpy(&header, contents.data(), sizeof(SnapshotHeader));
+
+    if (std::memcmp(header.magic, SnapshotMagic, sizeof(SnapshotMagic)) != 0)
+    {
+        throw ostk::core::error::RuntimeError("File [{}] is not a TLE catalog snapshot.", aFile.toString());
+    }
+
+    if (header.version != SnapshotVersion)
+    {
+        throw ostk::core::error::RuntimeError(
+            "TLE catalog snapshot version [{}] is not supported (expected [{}]).", header.version, SnapshotVersion
+        );
+    }
+
+    if (header.byteOrderMark != SnapshotByteOrderMark)
+    {
+        throw ostk::core::error::RuntimeError("TLE catalog snapshot byte order is not supported.");
+    }
+
+    const std::size_t recordsOffset = sizeof(SnapshotHeader);
+
+    if (header.recordCount > ((contents.size() - recordsOffset) / sizeof(SnapshotRecord)))
+    {
+        throw ostk::core::error::RuntimeError("TLE catalog snapshot [{}] is truncated.", aFile.toString());
+    }
+
+    const std::size_t namesOffset = recordsOffset + (header.recordCount * sizeof(SnapshotRecord));
+
+    if ((contents.size() - namesOffset) != header.namesSize)
+    {
+        throw ostk::core::error::RuntimeError("TLE catalog snapshot [{}] is truncated.", aFile.toString());
+    }
+
+    Array<TLE> tles = Array<TLE>::Empty();
+    tles.reserve(header.recordCount);
+
+    SnapshotRecord record;
+
+    for (std::size_t recordIndex = 0; recordIndex < header.recordCount; ++recordIndex)
+    {
+        std::memcpy(
+            &record, contents.data() + recordsOffset + (recordIndex * sizeof(SnapshotRecord)), sizeof(SnapshotRecord)
+        );
+
+        if ((static_cast<std::uint64_t>(record.nameOffset) + record.nameLength) > header.namesSize)
+        {
+            throw ostk::core::error::RuntimeError("TLE catalog snapshot [{}] is corrupted.", aFile.toString());
+        }
+
+        tles.add(TLE(
+            String(contents.substr(namesOffset + record.nameOffset, record.nameLength)),
+            String(std::string(record.firstLine, SnapshotLineLength)),
+            String(std::string(record.secondLine, SnapshotLineLength)),
+            true
+        ));
+    }
+
+    return tles;
+}
+
 TLE TLE::Construct(
     const String& aSatelliteName,
     const Integer& aSatelliteNumber,
@@ -784,8 +1122,9 @@ Integer TLE::GenerateChecksum(const String& aLine)
 
     for (Index idx = 0; idx < (aLine.getLength() - 1); ++idx)
     {
-        checksum +=
-            Integer::CanParse(aLine[idx]) ? static_cast<int>(Integer::Parse(aLine[idx])) : (aLine[idx] == '-' ? 1 : 0);
+        const char character = aLine[idx];
+
+        checksum += ((character >= '0') && (character <= '9')) ? (character - '0') : ((character == '-') ? 1 : 0);
     }
 
     checksum -= (checksum / 10) * 10;  // Last digit
@@ -0,0 +1,788 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+#include <OpenSpaceToolkit/Core/Container/Pair.hpp>
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Time.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/SemiAnalytical.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianPosition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianVelocity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/StateBuilder.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace trajectory
+{
+namespace orbit
+{
+namespace model
+{
+
+using ostk::core::container::Pair;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::unit::Length;
+using ostk::physics::unit::Time;
+
+using ostk::astrodynamics::trajectory::state::CoordinateSubset;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianPosition;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianVelocity;
+using ostk::astrodynamics::trajectory::StateBuilder;
+
+static const Derived::Unit GravitationalParameterSIUnit =
+    Derived::Unit::GravitationalParameter(Length::Unit::Meter, Time::Unit::Second);
+
+namespace
+{
+
+const Size QuadratureNodeCount = 32;       // Eccentric longitude nodes of the averaging quadrature
+const Size OsculatingStepCount = 256;      // RK4 steps over the revolution averaged into the initial mean elements
+const double VelocityIncrement_SI = 1e-3;  // Velocity increment of the finite difference element partials [m/s]
+
+double WrapAngle(const double& anAngle)
+{
+    return std::remainder(anAngle, 2.0 * M_PI);
+}
+
+void EquinoctialBasis(const double& p, const double& q, Vector3d& f, Vector3d& g)
+{
+    const double s = 1.0 + p * p + q * q;
+
+    f = Vector3d(1.0 - p * p + q * q, 2.0 * p * q, -2.0 * p) / s;
+    g = Vector3d(2.0 * p * q, 1.0 + p * p - q * q, 2.0 * q) / s;
+}
+
+/// Convert a cartesian position and velocity to equinoctial elements (a, h, k, p, q, lambda), lambda in [-pi, pi]
+Vector6d CartesianToEquinoctial(const Vector3d& aPosition, const Vector3d& aVelocity, const double& aMu)
+{
+    const double r = aPosition.norm();
+    const double a = 1.0 / ((2.0 / r) - (aVelocity.squaredNorm() / aMu));
+
+    const Vector3d angularMomentum = aPosition.cross(aVelocity);
+    const Vector3d w = angularMomentum.normalized();
+
+    const double p = w.x() / (1.0 + w.z());
+    const double q = -w.y() / (1.0 + w.z());
+
+    Vector3d f;
+    Vector3d g;
+    EquinoctialBasis(p, q, f, g);
+
+    const Vector3d eccentricityVector = (aVelocity.cross(angularMomentum) / aMu) - (aPosition / r);
+
+    const double k = eccentricityVector.dot(f);
+    const double h = eccentricityVector.dot(g);
+
+    const double X1 = aPosition.dot(f);
+    const double Y1 = aPosition.dot(g);
+
+    const double b = std::sqrt(1.0 - h * h - k * k);
+    const double beta = 1.0 / (1.0 + b);
+
+    const double cosF = k + (((1.0 - k * k * beta) * X1) - (h * k * beta * Y1)) / (a * b);
+    const double sinF = h + (((1.0 - h * h * beta) * Y1) - (h * k * beta * X1)) / (a * b);
+
+    const double F = std::atan2(sinF, cosF);
+
+    Vector6d elements;
+    elements << a, h, k, p, q, WrapAngle(F + h * std::cos(F) - k * std::sin(F));
+
+    return elements;
+}
+
+/// Solve the equinoctial Kepler equation for the eccentric longitude
+double SolveEccentricLongitude(const Vector6d& anElementVector)
+{
+    const double h = anElementVector[1];
+    const double k = anElementVector[2];
+    const double lambda = anElementVector[5];
+
+    double F = lambda;
+
+    for (Size i = 0; i < 50; ++i)
+    {
+        const double step =
+            (F + h * std::cos(F) - k * std::sin(F) - lambda) / (1.0 - h * std::sin(F) - k * std::cos(F));
+
+        F -= step;
+
+        if (std::abs(step) < 1e-14)
+        {
+            break;
+        }
+    }
+
+    return F;
+}
+
+/// Convert equinoctial elements, at a given eccentric longitude, to a cartesian position and velocity
+void EquinoctialToCartesian(
+    const Vector6d& anElementVector,
+    const double& anEccentricLongitude,
+    const double& aMu,
+    Vector3d& aPosition,
+    Vector3d& aVelocity
+)
+{
+    const double a = anElementVector[0];
+    const double h = anElementVector[1];
+    const double k = anElementVector[2];
+
+    Vector3d f;
+    Vector3d g;
+    EquinoctialBasis(anElementVector[3], anElementVector[4], f, g);
+
+    const double b = std::sqrt(1.0 - h * h - k * k);
+    const double beta = 1.0 / (1.0 + b);
+    const double n = std::sqrt(aMu / (a * a * a));
+
+    const double cosF = std::cos(anEccentricLongitude);
+    const double sinF = std::sin(anEccentricLongitude);
+
+    const double r = a * (1.0 - k * cosF - h * sinF);
+
+    const double X1 = a * (((1.0 - h * h * beta) * cosF) + (h * k * beta * sinF) - k);
+    const double Y1 = a * ((h * k * beta * cosF) + ((1.0 - k * k * beta) * sinF) - h);
+
+    const double X1Dot = (a * a * n / r) * ((h * k * beta * cosF) - ((1.0 - h * h * beta) * sinF));
+    const double Y1Dot = (a * a * n / r) * (((1.0 - k * k * beta) * cosF) - (h * k * beta * sinF));
+
+    aPosition = (X1 * f) + (Y1 * g);
+    aVelocity = (X1Dot * f) + (Y1Dot * g);
+}
+
+/// Integrate a RK4 step, from the derivative at the start of the step
+template <class Derivative>
+Vector6d IntegrateRK4(
+    const Derivative& aDerivative,
+    const double& aTime,
+    const Vector6d& aVector,
+    const Vector6d& aVectorDerivative,
+    const double& aStep
+)
+{
+    const Vector6d& k1 = aVectorDerivative;
+    const Vector6d k2 = aDerivative(aTime + aStep / 2.0, aVector + (aStep / 2.0) * k1);
+    const Vector6d k3 = aDerivative(aTime + aStep / 2.0, aVector + (aStep / 2.0) * k2);
+    const Vector6d k4 = aDerivative(aTime + aStep, aVector + aStep * k3);
+
+    return aVector + (aStep / 6.0) * (k1 + 2.0 * k2 + 2.0 * k3 + k4);
+}
+
+}  // namespace
+
+SemiAnalytical::SemiAnalytical(
+    const State& aState,
+    const Array<Shared<Dynamics>>& aDynamicsArray,
+    const Derived& aGravitationalParameter,
+    const Duration& aStepDuration,
+    const Integer& aRevolutionNumber
+)
+    : Model(),
+      initialState_(aState),
+      dynamics_(aDynamicsArray),
+      gravitationalParameter_(aGravitationalParameter),
+      stepDuration_(aStepDuration),
+      initialRevolutionNumber_(aRevolutionNumber),
+      coordinateBrokerSPtr_(std::make_shared<CoordinateBroker>()),
+      dynamicsContexts_(Array<Dynamics::Context>::Empty()),
+      stateVector_(),
+      positionIndex_(0),
+      velocityIndex_(0),
+      initialArgumentOfLatitude_(0.0),
+      nodes_(Array<Node>::Empty()),
+      nodesMutex_()
+{
+    if (!initialState_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State");
+    }
+
+    if (dynamics_.isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Dynamics");
+    }
+
+    if (!gravitationalParameter_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Gravitational parameter");
+    }
+
+    if (!stepDuration_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Step duration");
+    }
+
+    if (!stepDuration_.isStrictlyPositive())
+    {
+        throw ostk::core::error::runtime::Wrong("Step duration");
+    }
+
+    // Same coordinate layout as a propagator with these dynamics
+
+    for (const Shared<Dynamics>& dynamicsSPtr : dynamics_)
+    {
+        if (dynamicsSPtr == nullptr || !dynamicsSPtr->isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Dynamics");
+        }
+
+        Array<Pair<Index, Size>> readInfo = Array<Pair<Index, Size>>::Empty();
+        for (const Shared<const CoordinateSubset>& subset : dynamicsSPtr->getReadCoordinateSubsets())
+        {
+            readInfo.add({coordinateBrokerSPtr_->addSubset(subset), subset->getSize()});
+        }
+
+        Array<Pair<Index, Size>> writeInfo = Array<Pair<Index, Size>>::Empty();
+        for (const Shared<const CoordinateSubset>& subset : dynamicsSPtr->getWriteCoordinateSubsets())
+        {
+            writeInfo.add({coordinateBrokerSPtr_->addSubset(subset), subset->getSize()});
+        }
+
+        dynamicsContexts_.add({dynamicsSPtr, readInfo, writeInfo});
+    }
+
+    positionIndex_ = coordinateBrokerSPtr_->addSubset(CartesianPosition::Default());
+    velocityIndex_ = coordinateBrokerSPtr_->addSubset(CartesianVelocity::Default());
+
+    const StateBuilder stateBuilder = {Frame::GCRF(), coordinateBrokerSPtr_};
+
+    stateVector_ = stateBuilder.reduce(initialState_.inFrame(Frame::GCRF())).getCoordinates();
+
+    const Vector6d osculatingElements = CartesianToEquinoctial(
+        stateVector_.segment<3>(positionIndex_),
+        stateVector_.segment<3>(velocityIndex_),
+        gravitationalParameter_.in(GravitationalParameterSIUnit)
+    );
+
+    if (!(osculatingElements[0] > 0.0) ||
+        ((osculatingElements[1] * osculatingElements[1] + osculatingElements[2] * osculatingElements[2]) >= 1.0))
+    {
+        throw ostk::core::error::runtime::Wrong("Orbit (not elliptical)");
+    }
+
+    Node node;
+
+    node.time = 0.0;
+    node.elements = this->calculateInitialMeanElements();
+    node.rates = this->calculateMeanElementRates(0.0, node.elements);
+    node.rightAscension = std::atan2(node.elements[3], node.elements[4]);
+
+    nodes_.add(node);
+
+    initialArgumentOfLatitude_ = node.elements[5] - node.rightAscension;
+}
+
+SemiAnalytical::SemiAnalytical(const SemiAnalytical& aSemiAnalyticalModel)
+    : Model(aSemiAnalyticalModel),
+      initialState_(aSemiAnalyticalModel.initialState_),
+      dynamics_(aSemiAnalyticalModel.dynamics_),
+      gravitationalParameter_(aSemiAnalyticalModel.gravitationalParameter_),
+      stepDuration_(aSemiAnalyticalModel.stepDuration_),
+      initialRevolutionNumber_(aSemiAnalyticalModel.initialRevolutionNumber_),
+      coordinateBrokerSPtr_(aSemiAnalyticalModel.coordinateBrokerSPtr_),
+      dynamicsContexts_(aSemiAnalyticalModel.dynamicsContexts_),
+      stateVector_(aSemiAnalyticalModel.stateVector_),
+      positionIndex_(aSemiAnalyticalModel.positionIndex_),
+      velocityIndex_(aSemiAnalyticalModel.velocityIndex_),
+      initialArgumentOfLatitude_(aSemiAnalyticalModel.initialArgumentOfLatitude_),
+      nodes_(Array<Node>::Empty()),
+      nodesMutex_()
+{
+    const std::lock_guard<std::mutex> lock(aSemiAnalyticalModel.nodesMutex_);
+
+    nodes_ = aSemiAnalyticalModel.nodes_;
+}
+
+SemiAnalytical& SemiAnalytical::operator=(const SemiAnalytical& aSemiAnalyticalModel)
+{
+    if (this != &aSemiAnalyticalModel)
+    {
+        const std::scoped_lock lock(nodesMutex_, aSemiAnalyticalModel.nodesMutex_);
+
+        Model::operator=(aSemiAnalyticalModel);
+
+        initialState_ = aSemiAnalyticalModel.initialState_;
+        dynamics_ = aSemiAnalyticalModel.dynamics_;
+        gravitationalParameter_ = aSemiAnalyticalModel.gravitationalParameter_;
+        stepDuration_ = aSemiAnalyticalModel.stepDuration_;
+        initialRevolutionNumber_ = aSemiAnalyticalModel.initialRevolutionNumber_;
+        coordinateBrokerSPtr_ = aSemiAnalyticalModel.coordinateBrokerSPtr_;
+        dynamicsContexts_ = aSemiAnalyticalModel.dynamicsContexts_;
+        stateVector_ = aSemiAnalyticalModel.stateVector_;
+        positionIndex_ = aSemiAnalyticalModel.positionIndex_;
+        velocityIndex_ = aSemiAnalyticalModel.velocityIndex_;
+        initialArgumentOfLatitude_ = aSemiAnalyticalModel.initialArgumentOfLatitude_;
+        nodes_ = aSemiAnalyticalModel.nodes_;
+    }
+
+    return *this;
+}
+
+SemiAnalytical* SemiAnalytical::clone() const
+{
+    return new SemiAnalytical(*this);
+}
+
+bool SemiAnalytical::operator==(const SemiAnalytical& aSemiAnalyticalModel) const
+{
+    if ((!this->isDefined()) || (!aSemiAnalyticalModel.isDefined()))
+    {
+        return false;
+    }
+
+    return (initialState_ == aSemiAnalyticalModel.initialState_) && (dynamics_ == aSemiAnalyticalModel.dynamics_) &&
+           (gravitationalParameter_ == aSemiAnalyticalModel.gravitationalParameter_) &&
+           (stepDuration_ == aSemiAnalyticalModel.stepDuration_) &&
+           (initialRevolutionNumber_ == aSemiAnalyticalModel.initialRevolutionNumber_);
+}
+
+bool SemiAnalytical::operator!=(const SemiAnalytical& aSemiAnalyticalModel) const
+{
+    return !((*this) == aSemiAnalyticalModel);
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const SemiAnalytical& aSemiAnalyticalModel)
+{
+    aSemiAnalyticalModel.print(anOutputStream);
+
+    return anOutputStream;
+}
+
+bool SemiAnalytical::isDefined() const
+{
+    return initialState_.isDefined() && !dynamics_.isEmpty() && gravitationalParameter_.isDefined() &&
+           stepDuration_.isDefined();
+}
+
+const State& SemiAnalytical::accessInitialState() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("SemiAnalytical");
+    }
+
+    return initialState_;
+}
+
+Array<Shared<Dynamics>> SemiAnalytical::getDynamics() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("SemiAnalytical");
+    }
+
+    return dynamics_;
+}
+
+Derived SemiAnalytical::getGravitationalParameter() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("SemiAnalytical");
+    }
+
+    return gravitationalParameter_;
+}
+
+Duration SemiAnalytical::getStepDuration() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("SemiAnalytical");
+    }
+
+    return stepDuration_;
+}
+
+Instant SemiAnalytical::getEpoch() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("SemiAnalytical");
+    }
+
+    return initialState_.getInstant();
+}
+
+Integer SemiAnalytical::getRevolutionNumberAtEpoch() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("SemiAnalytical");
+    }
+
+    return initialRevolutionNumber_;
+}
+
+Vector6d SemiAnalytical::calculateMeanElementsAt(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("SemiAnalytical");
+    }
+
+    return this->interpolateElementsAt(
+        Duration::Between(initialState_.accessInstant(), anInstant).inSeconds(), nullptr
+    );
+}
+
+State SemiAnalytical::calculateStateAt(const Instant& anInstant) const
+{
+    return this->buildState(anInstant, this->calculateMeanElementsAt(anInstant));
+}
+
+Array<State> SemiAnalytical::calculateStatesAt(const Array<Instant>& anInstantArray) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("SemiAnalytical");
+    }
+
+    Array<State> states = Array<State>::Empty();
+    states.reserve(anInstantArray.getSize());
+
+    for (const Instant& instant : anInstantArray)
+    {
+        states.add(this->calculateStateAt(instant));
+    }
+
+    return states;
+}
+
+Integer SemiAnalytical::calculateRevolutionNumberAt(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("SemiAnalytical");
+    }
+
+    if (anInstant == initialState_.accessInstant())
+    {
+        return this->getRevolutionNumberAtEpoch();
+    }
+
+    // Revolutions start at the ascending node, where the mean argument of latitude crosses a multiple of 2 pi
+
+    double rightAscension = 0.0;
+
+    const Vector6d elements = this->interpolateElementsAt(
+        Duration::Between(initialState_.accessInstant(), anInstant).inSeconds(), &rightAscension
+    );
+
+    const double argumentOfLatitude = elements[5] - rightAscension;
+
+    return initialRevolutionNumber_ +
+           static_cast<int>(
+               std::floor(argumentOfLatitude / (2.0 * M_PI)) - std::floor(initialArgumentOfLatitude_ / (2.0 * M_PI))
+           );
+}
+
+void SemiAnalytical::print(std::ostream& anOutputStream, bool displayDecorator) const
+{
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Semi-Analytical") : void();
+
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Gravitational parameter:"
+        << (gravitationalParameter_.isDefined() ? gravitationalParameter_.toString() : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Step duration:" << (stepDuration_.isDefined() ? stepDuration_.toString() : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream) << "Dynamics count:" << dynamics_.getSize();
+
+    ostk::core::utils::Print::Separator(anOutputStream, "Initial State");
+
+    initialState_.print(anOutputStream, false);
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+bool SemiAnalytical::operator==(const trajectory::Model& aModel) const
+{
+    const SemiAnalytical* semiAnalyticalModelPtr = dynamic_cast<const SemiAnalytical*>(&aModel);
+
+    return (semiAnalyticalModelPtr != nullptr) && this->operator==(*semiAnalyticalModelPtr);
+}
+
+bool SemiAnalytical::operator!=(const trajectory::Model& aModel) const
+{
+    return !((*this) == aModel);
+}
+
+SemiAnalytical::Node SemiAnalytical::integrateNode(const Node& aNode, const double& aStep) const
+{
+    const auto derivative = [this](const double& aTime, const Vector6d& anElementVector) -> Vector6d
+    {
+        return this->calculateMeanElementRates(aTime, anElementVector);
+    };
+
+    Node node;
+
+    node.time = aNode.time + aStep;
+    node.elements = IntegrateRK4(derivative, aNode.time, aNode.elements, aNode.rates, aStep);
+    node.rates = this->calculateMeanElementRates(node.time, node.elements);
+    node.rightAscension =
+        aNode.rightAscension + WrapAngle(std::atan2(node.elements[3], node.elements[4]) - aNode.rightAscension);
+
+    return node;
+}
+
+Vector6d SemiAnalytical::calculateMeanElementRates(const double& aTime, const Vector6d& anElementVector) const
+{
+    const double mu = gravitationalParameter_.in(GravitationalParameterSIUnit);
+
+    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations = Dynamics::GetSystemOfEquations(
+        dynamicsContexts_, initialState_.accessInstant() + Duration::Seconds(aTime), Frame::GCRF()
+    );
+
+    VectorXd stateVector = stateVector_;
+    VectorXd stateDerivativeVector = VectorXd::Zero(stateVector_.size());
+
+    const double h = anElementVector[1];
+    const double k = anElementVector[2];
+
+    // Gauss equations dE/dt = (dE/dv) f, averaged over the mean longitude: nodes are equally spaced in eccentric
+    // longitude F, weighted by dlambda / dF = r / a
+
+    Vector6d rates = Vector6d::Zero();
+
+    for (Size i = 0; i < QuadratureNodeCount; ++i)
+    {
+        const double F = 2.0 * M_PI * double(i) / double(QuadratureNodeCount);
+
+        Vector3d position;
+        Vector3d velocity;
+        EquinoctialToCartesian(anElementVector, F, mu, position, velocity);
+
+        const Vector3d acceleration = this->calculateAcceleration(
+            systemOfEquations, position, velocity, 0.0, stateVector, stateDerivativeVector
+        );
+        const Vector3d perturbingAcceleration = acceleration + (mu / std::pow(position.norm(), 3)) * position;
+
+        const double weight = 1.0 - k * std::cos(F) - h * std::sin(F);
+
+        for (Index j = 0; j < 3; ++j)
+        {
+            Vector3d velocityPlus = velocity;
+            Vector3d velocityMinus = velocity;
+
+            velocityPlus[j] += VelocityIncrement_SI;
+            velocityMinus[j] -= VelocityIncrement_SI;
+
+            Vector6d partial = CartesianToEquinoctial(position, velocityPlus, mu) -
+                               CartesianToEquinoctial(position, velocityMinus, mu);
+            partial[5] = WrapAngle(partial[5]);
+
+            rates += (weight * perturbingAcceleration[j] / (2.0 * VelocityIncrement_SI)) * partial;
+        }
+    }
+
+    rates /= double(QuadratureNodeCount);
+
+    rates[5] += std::sqrt(mu / std::pow(anElementVector[0], 3));
+
+    return rates;
+}
+
+Vector6d SemiAnalytical::calculateInitialMeanElements() const
+{
+    const double mu = gravitationalParameter_.in(GravitationalParameterSIUnit);
+
+    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations =
+        Dynamics::GetSystemOfEquations(dynamicsContexts_, initialState_.accessInstant(), Frame::GCRF());
+
+    VectorXd stateVector = stateVector_;
+    VectorXd stateDerivativeVector = VectorXd::Zero(stateVector_.size());
+
+    const auto derivative = [this, &systemOfEquations, &stateVector, &stateDerivativeVector](
+                                const double& aTime, const Vector6d& aCartesianVector
+                            ) -> Vector6d
+    {
+        Vector6d cartesianDerivative;
+
+        cartesianDerivative << aCartesianVector.tail<3>(),
+            this->calculateAcceleration(
+                systemOfEquations,
+                aCartesianVector.head<3>(),
+                aCartesianVector.tail<3>(),
+                aTime,
+                stateVector,
+                stateDerivativeVector
+            );
+
+        return cartesianDerivative;
+    };
+
+    Vector6d cartesianVector;
+    cartesianVector << stateVector_.segment<3>(positionIndex_), stateVector_.segment<3>(velocityIndex_);
+
+    const Vector6d osculatingElements =
+        CartesianToEquinoctial(cartesianVector.head<3>(), cartesianVector.tail<3>(), mu);
+
+    const double period = 2.0 * M_PI * std::sqrt(std::pow(osculatingElements[0], 3) / mu);
+    const double step = period / double(OsculatingStepCount);
+
+    // Average the osculating elements over the revolution centered on the epoch (trapezoidal rule, exact for the
+    // periodic terms and centered for the secular ones), with a continuous mean longitude
+
+    double time = 0.0;
+
+    for (Size i = 0; i < OsculatingStepCount / 2; ++i)
+    {
+        cartesianVector =
+            IntegrateRK4(derivative, time, cartesianVector, derivative(time, cartesianVector), -step);
+        time -= step;
+    }
+
+    Vector6d elementSum = Vector6d::Zero();
+    double previousLongitude = 0.0;
+    double longitude = 0.0;
+
+    for (Size i = 0; i <= OsculatingStepCount; ++i)
+    {
+        Vector6d elements = CartesianToEquinoctial(cartesianVector.head<3>(), cartesianVector.tail<3>(), mu);
+
+        longitude = (i == 0) ? elements[5] : longitude + WrapAngle(elements[5] - previousLongitude);
+        previousLongitude = elements[5];
+        elements[5] = longitude;
+
+        elementSum += ((i == 0) || (i == OsculatingStepCount) ? 0.5 : 1.0) * elements;
+
+        if (i < OsculatingStepCount)
+        {
+            cartesianVector =
+                IntegrateRK4(derivative, time, cartesianVector, derivative(time, cartesianVector), step);
+            time += step;
+        }
+    }
+
+    return elementSum / double(OsculatingStepCount);
+}
+
+Vector3d SemiAnalytical::calculateAcceleration(
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+    const Vector3d& aPosition,
+    const Vector3d& aVelocity,
+    const double& aTime,
+    VectorXd& aStateVector,
+    VectorXd& aStateDerivativeVector
+) const
+{
+    aStateVector.segment<3>(positionIndex_) = aPosition;
+    aStateVector.segment<3>(velocityIndex_) = aVelocity;
+
+    aSystemOfEquations(aStateVector, aStateDerivativeVector, aTime);
+
+    return aStateDerivativeVector.segment<3>(velocityIndex_);
+}
+
+Vector6d SemiAnalytical::interpolateElementsAt(const double& aTime, double* aRightAscensionPtr) const
+{
+    const std::lock_guard<std::mutex> lock(nodesMutex_);
+
+    const double step = stepDuration_.inSeconds();
+
+    while (nodes_.accessLast().time < aTime)
+    {
+        nodes_.add(this->integrateNode(nodes_.accessLast(), step));
+    }
+
+    while (nodes_.accessFirst().time > aTime)
+    {
+        nodes_.insert(nodes_.begin(), this->integrateNode(nodes_.accessFirst(), -step));
+    }
+
+    if (nodes_.getSize() == 1)
+    {
+        if (aRightAscensionPtr != nullptr)
+        {
+            *aRightAscensionPtr = nodes_.accessFirst().rightAscension;
+        }
+
+        return nodes_.accessFirst().elements;
+    }
+
+    const auto iterator = std::upper_bound(
+        nodes_.begin(),
+        nodes_.end(),
+        aTime,
+        [](const double& aNodeTime, const Node& aNode) -> bool
+        {
+            return aNodeTime < aNode.time;
+        }
+    );
+
+    const Index index = std::min<Index>(
+        std::max<std::ptrdiff_t>(std::distance(nodes_.begin(), iterator) - 1, 0), nodes_.getSize() - 2
+    );
+
+    const Node& node = nodes_[index];
+    const Node& nextNode = nodes_[index + 1];
+
+    // Cubic Hermite interpolation, from the elements and their rates at both nodes
+
+    const double duration = nextNode.time - node.time;
+    const double s = (aTime - node.time) / duration;
+
+    const double h00 = (2.0 * s * s * s) - (3.0 * s * s) + 1.0;
+    const double h10 = (s * s * s) - (2.0 * s * s) + s;
+    const double h01 = (-2.0 * s * s * s) + (3.0 * s * s);
+    const double h11 = (s * s * s) - (s * s);
+
+    if (aRightAscensionPtr != nullptr)
+    {
+        *aRightAscensionPtr = node.rightAscension + s * (nextNode.rightAscension - node.rightAscension);
+    }
+
+    return (h00 * node.elements) + (h10 * duration * node.rates) + (h01 * nextNode.elements) +
+           (h11 * duration * nextNode.rates);
+}
+
+State SemiAnalytical::buildState(const Instant& anInstant, const Vector6d& anElementVector) const
+{
+    Vector3d position;
+    Vector3d velocity;
+    EquinoctialToCartesian(
+        anElementVector,
+        SolveEccentricLongitude(anElementVector),
+        gravitationalParameter_.in(GravitationalParameterSIUnit),
+        position,
+        velocity
+    );
+
+    VectorXd stateVector = stateVector_;
+    stateVector.segment<3>(positionIndex_) = position;
+    stateVector.segment<3>(velocityIndex_) = velocity;
+
+    const State state = StateBuilder(Frame::GCRF(), coordinateBrokerSPtr_).build(anInstant, stateVector);
+
+    const StateBuilder outputStateBuilder = {initialState_};
+
+    return outputStateBuilder.expand(state.inFrame(initialState_.accessFrame()), initialState_);
+}
+
+}  // namespace model
+}  // namespace orbit
+}  // namespace trajectory
+}  // namespace astrodynamics
+}  // namespace ostk
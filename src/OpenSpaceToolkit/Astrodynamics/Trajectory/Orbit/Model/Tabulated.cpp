@@ -27,6 +27,47 @@ Tabulated::Tabulated(
 {
 }
 
+Tabulated::Tabulated(
+    const Instant& anEpoch,
+    const VectorXd& aTimestampVector,
+    const MatrixXd& aCoordinateMatrix,
+    const Shared<const Frame>& aFrameSPtr,
+    const Shared<const CoordinateBroker>& aCoordinateBrokerSPtr,
+    const Integer& anInitialRevolutionNumber,
+    const Interpolator::Type& anInterpolationType
+)
+    : trajectory::orbit::Model(),
+      trajectory::model::Tabulated(
+          anEpoch, aTimestampVector, aCoordinateMatrix, aFrameSPtr, aCoordinateBrokerSPtr, anInterpolationType
+      ),
+      initialRevolutionNumber_(anInitialRevolutionNumber)
+{
+}
+
+Tabulated::Tabulated(
+    const Instant& anEpoch,
+    const Eigen::Map<const VectorXd>& aTimestampVector,
+    const Eigen::Map<const RowMajorMatrixXd>& aCoordinateMatrix,
+    const Shared<const Frame>& aFrameSPtr,
+    const Shared<const CoordinateBroker>& aCoordinateBrokerSPtr,
+    const Integer& anInitialRevolutionNumber,
+    const Interpolator::Type& anInterpolationType,
+    const Shared<const void>& aStorageSPtr
+)
+    : trajectory::orbit::Model(),
+      trajectory::model::Tabulated(
+          anEpoch,
+          aTimestampVector,
+          aCoordinateMatrix,
+          aFrameSPtr,
+          aCoordinateBrokerSPtr,
+          anInterpolationType,
+          aStorageSPtr
+      ),
+      initialRevolutionNumber_(anInitialRevolutionNumber)
+{
+}
+
 Tabulated* Tabulated::clone() const
 {
     return new Tabulated(*this);
@@ -1,5 +1,6 @@
 /// Apache License 2.0
 
+#include <algorithm>
 #include <typeindex>
 
 #include <OpenSpaceToolkit/Core/Container/Map.hpp>
@@ -32,6 +33,7 @@ using ostk::core::container::Map;
 using ostk::core::container::Pair;
 using ostk::core::type::Index;
 
+using ostk::mathematics::object::MatrixXd;
 using ostk::mathematics::object::VectorXd;
 
 using ostk::physics::coordinate::Position;
@@ -44,7 +46,79 @@ using ostk::astrodynamics::dynamics::Thruster;
 using ostk::astrodynamics::trajectory::state::CoordinateSubset;
 using ostk::astrodynamics::trajectory::StateBuilder;
 
-const Shared<const Frame> Propagator::IntegrationFrameSPtr = Frame::GCRF();
+const Shared<const Frame>& Propagator::IntegrationFrame()
+{
+    static const Shared<const Frame> integrationFrameSPtr = Frame::GCRF();
+
+    return integrationFrameSPtr;
+}
+
+Propagator::Session::Session(const Propagator& aPropagator, const State& aState)
+    : initialState_(aState),
+      state_(aState),
+      numericalSolverSession_(
+          [&aPropagator, &aState]() -> NumericalSolver::Session
+          {
+              if (!aPropagator.isDefined())
+              {
+                  throw ostk::core::error::runtime::Undefined("Propagator");
+              }
+
+              if (!aState.isDefined())
+              {
+                  throw ostk::core::error::runtime::Undefined("State");
+              }
+
+              aPropagator.validateDynamicsSet();
+
+              const StateBuilder solverStateBuilder = {
+                  Propagator::IntegrationFrame(), aPropagator.coordinatesBrokerSPtr_
+              };
+
+              const State solverInputState =
+                  solverStateBuilder.reduce(aState.inFrame(Propagator::IntegrationFrame()));
+
+              // The system of equations holds its own copy of the dynamics contexts, hence its own scratch buffers
+
+              return {
+                  aPropagator.numericalSolver_,
+                  solverInputState,
+                  Dynamics::GetSystemOfEquations(
+                      aPropagator.dynamicsContexts_,
+                      solverInputState.accessInstant(),
+                      Propagator::IntegrationFrame()
+                  ),
+              };
+          }()
+      )
+{
+}
+
+const State& Propagator::Session::accessState() const
+{
+    return state_;
+}
+
+State Propagator::Session::advanceTo(const Instant& anInstant)
+{
+    const State solverOutputState = numericalSolverSession_.integrateTime(anInstant);
+
+    const StateBuilder outputStateBuilder = {initialState_};
+
+    state_ = outputStateBuilder.expand(solverOutputState.inFrame(initialState_.accessFrame()), initialState_);
+
+    return state_;
+}
+
+State Propagator::Session::advanceBy(const Duration& aDuration)
+{
+    if (!aDuration.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Duration");
+    }
+
+    return this->advanceTo(state_.accessInstant() + aDuration);
+}
 
 Propagator::Propagator(const NumericalSolver& aNumericalSolver, const Array<Shared<Dynamics>>& aDynamicsArray)
     : dynamicsContexts_(),
@@ -92,7 +166,8 @@ Propagator::Propagator(
 Propagator::Propagator(const Propagator& aPropagator)
     : coordinatesBrokerSPtr_(std::make_shared<CoordinateBroker>(*aPropagator.coordinatesBrokerSPtr_)),
       dynamicsContexts_(aPropagator.dynamicsContexts_),
-      numericalSolver_(aPropagator.numericalSolver_)
+      numericalSolver_(aPropagator.numericalSolver_),
+      dynamicsTimingIsEnabled_(aPropagator.dynamicsTimingIsEnabled_)
 {
 }
 
@@ -103,6 +178,7 @@ Propagator& Propagator::operator=(const Propagator& aPropagator)
         coordinatesBrokerSPtr_ = std::make_shared<CoordinateBroker>(*aPropagator.coordinatesBrokerSPtr_);
         dynamicsContexts_ = aPropagator.dynamicsContexts_;
         numericalSolver_ = aPropagator.numericalSolver_;
+        dynamicsTimingIsEnabled_ = aPropagator.dynamicsTimingIsEnabled_;
     }
     return *this;
 }
@@ -116,7 +192,8 @@ bool Propagator::operator==(const Propagator& aPropagator) const
 
     return (
         numericalSolver_ == aPropagator.numericalSolver_ &&
-        *(coordinatesBrokerSPtr_) == *(aPropagator.coordinatesBrokerSPtr_)
+        ((coordinatesBrokerSPtr_ == aPropagator.coordinatesBrokerSPtr_) ||
+         (*(coordinatesBrokerSPtr_) == *(aPropagator.coordinatesBrokerSPtr_)))
     );
 }
 
@@ -157,6 +234,74 @@ const NumericalSolver& Propagator::accessNumericalSolver() const
     return numericalSolver_;
 }
 
+NumericalSolver::Statistics Propagator::getStatistics() const
+{
+    return numericalSolver_.getStatistics();
+}
+
+bool Propagator::isDynamicsTimingEnabled() const
+{
+    return dynamicsTimingIsEnabled_;
+}
+
+Map<String, Dynamics::Timing> Propagator::getDynamicsTimings() const
+{
+    if (!dynamicsTimingIsEnabled_)
+    {
+        throw ostk::core::error::RuntimeError("Dynamics timing is not enabled.");
+    }
+
+    Map<String, Dynamics::Timing> timings;
+
+    for (const Dynamics::Context& dynamicsContext : dynamicsContexts_)
+    {
+        const Dynamics::Timing timing = dynamicsContext.timerSPtr->getTiming();
+
+        Dynamics::Timing& cumulativeTiming = timings[dynamicsContext.dynamics->getName()];
+
+        cumulativeTiming.callCount += timing.callCount;
+        cumulativeTiming.duration += timing.duration;
+    }
+
+    return timings;
+}
+
+void Propagator::enableDynamicsTiming()
+{
+    if (dynamicsTimingIsEnabled_)
+    {
+        return;
+    }
+
+    for (Dynamics::Context& dynamicsContext : dynamicsContexts_)
+    {
+        dynamicsContext.timerSPtr = std::make_shared<Dynamics::Timer>();
+    }
+
+    dynamicsTimingIsEnabled_ = true;
+}
+
+void Propagator::disableDynamicsTiming()
+{
+    for (Dynamics::Context& dynamicsContext : dynamicsContexts_)
+    {
+        dynamicsContext.timerSPtr = nullptr;
+    }
+
+    dynamicsTimingIsEnabled_ = false;
+}
+
+void Propagator::resetDynamicsTiming()
+{
+    for (const Dynamics::Context& dynamicsContext : dynamicsContexts_)
+    {
+        if (dynamicsContext.timerSPtr != nullptr)
+        {
+            dynamicsContext.timerSPtr->reset();
+        }
+    }
+}
+
 Size Propagator::getNumberOfCoordinates() const
 {
     return this->accessCoordinateBroker()->getNumberOfCoordinates();
@@ -186,7 +331,7 @@ void Propagator::setDynamics(const Array<Shared<Dynamics>>& aDynamicsArray)
 
 void Propagator::addManeuver(const Maneuver& aManeuver, const Interpolator::Type& anInterpolationType)
 {
-    this->addDynamics(aManeuver.toTabulatedDynamics(IntegrationFrameSPtr, anInterpolationType));
+    this->addDynamics(aManeuver.toTabulatedDynamics(Propagator::IntegrationFrame(), anInterpolationType));
 }
 
 void Propagator::addDynamics(const Shared<Dynamics>& aDynamicsSPtr)
@@ -214,7 +359,14 @@ void Propagator::addDynamics(const Shared<Dynamics>& aDynamicsSPtr)
         writeInfo.add(indexAndSize);
     }
 
-    dynamicsContexts_.add({aDynamicsSPtr, readInfo, writeInfo});
+    Dynamics::Context dynamicsContext = {aDynamicsSPtr, readInfo, writeInfo};
+
+    if (dynamicsTimingIsEnabled_)
+    {
+        dynamicsContext.timerSPtr = std::make_shared<Dynamics::Timer>();
+    }
+
+    dynamicsContexts_.add(dynamicsContext);
 }
 
 void Propagator::clearDynamics()
@@ -232,21 +384,289 @@ State Propagator::calculateStateAt(const State& aState, const Instant& anInstant
 
     this->validateDynamicsSet();
 
-    const StateBuilder solverStateBuilder = {Propagator::IntegrationFrameSPtr, coordinatesBrokerSPtr_};
+    const StateBuilder solverStateBuilder = {Propagator::IntegrationFrame(), coordinatesBrokerSPtr_};
 
-    const State solverInputState = solverStateBuilder.reduce(aState.inFrame(Propagator::IntegrationFrameSPtr));
+    const State solverInputState = solverStateBuilder.reduce(aState.inFrame(Propagator::IntegrationFrame()));
 
-    const State solverOutputState = numericalSolver_.integrateTime(
-        solverInputState,
+    const State solverOutputState = this->integrateSolverState(solverInputState, anInstant);
+
+    const StateBuilder outputStateBuilder = {aState};
+
+    return outputStateBuilder.expand(solverOutputState.inFrame(aState.accessFrame()), aState);
+}
+
+State Propagator::integrateSolverState(const State& aSolverState, const Instant& anInstant) const
+{
+    const Instant& startInstant = aSolverState.accessInstant();
+
+    NumericalSolver numericalSolver = numericalSolver_.getCallCopy();
+
+    // Orbit-only states (position and velocity, possibly mass) go through the fixed size path
+
+    if (numericalSolver.supportsFixedSizeIntegration())
+    {
+        switch (aSolverState.getSize())
+        {
+            case 6:
+                return numericalSolver.integrateFixedSizeTime<6>(
+                    aSolverState,
+                    anInstant,
+                    Dynamics::GetFixedSizeSystemOfEquations<6>(
+                        dynamicsContexts_, startInstant, Propagator::IntegrationFrame()
+                    )
+                );
+
+            case 7:
+                return numericalSolver.integrateFixedSizeTime<7>(
+                    aSolverState,
+                    anInstant,
+                    Dynamics::GetFixedSizeSystemOfEquations<7>(
+                        dynamicsContexts_, startInstant, Propagator::IntegrationFrame()
+                    )
+                );
+
+            default:
+                break;
+        }
+    }
+
+    return numericalSolver.integrateTime(
+        aSolverState,
         anInstant,
-        Dynamics::GetSystemOfEquations(
-            dynamicsContexts_, solverInputState.accessInstant(), Propagator::IntegrationFrameSPtr
+        Dynamics::GetSystemOfEquations(dynamicsContexts_, startInstant, Propagator::IntegrationFrame())
+    );
+}
+
+Pair<State, MatrixXd> Propagator::calculateStateAndStateTransitionMatrixAt(
+    const State& aState, const Instant& anInstant
+) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagator");
+    }
+
+    this->validateDynamicsSet();
+
+    const StateBuilder solverStateBuilder = {Propagator::IntegrationFrame(), coordinatesBrokerSPtr_};
+
+    const State solverInputState = solverStateBuilder.reduce(aState.inFrame(Propagator::IntegrationFrame()));
+
+    const Size stateSize = solverInputState.getSize();
+
+    // The state transition matrix is appended (column-major) to the state, as an additional coordinate subset
+
+    const Shared<CoordinateBroker> augmentedCoordinatesBrokerSPtr =
+        std::make_shared<CoordinateBroker>(coordinatesBrokerSPtr_->getSubsets());
+    augmentedCoordinatesBrokerSPtr->addSubset(
+        std::make_shared<CoordinateSubset>("STATE_TRANSITION_MATRIX", stateSize * stateSize)
+    );
+
+    VectorXd augmentedCoordinates(stateSize + stateSize * stateSize);
+    augmentedCoordinates.head(stateSize) = solverInputState.accessCoordinates();
+    Eigen::Map<MatrixXd>(augmentedCoordinates.data() + stateSize, stateSize, stateSize).setIdentity();
+
+    const State augmentedInputState = {
+        solverInputState.accessInstant(),
+        augmentedCoordinates,
+        Propagator::IntegrationFrame(),
+        augmentedCoordinatesBrokerSPtr,
+    };
+
+    const State augmentedOutputState = numericalSolver_.getCallCopy().integrateTime(
+        augmentedInputState,
+        anInstant,
+        Dynamics::GetVariationalSystemOfEquations(
+            dynamicsContexts_, solverInputState.accessInstant(), Propagator::IntegrationFrame(), stateSize
         )
     );
 
+    const Eigen::Ref<const VectorXd> augmentedOutputCoordinates = augmentedOutputState.accessCoordinates();
+
+    const State solverOutputState = {
+        augmentedOutputState.accessInstant(),
+        augmentedOutputCoordinates.head(stateSize),
+        Propagator::IntegrationFrame(),
+        coordinatesBrokerSPtr_,
+    };
+
+    const MatrixXd stateTransitionMatrix =
+        Eigen::Map<const MatrixXd>(augmentedOutputCoordinates.data() + stateSize, stateSize, stateSize);
+
     const StateBuilder outputStateBuilder = {aState};
 
-    return outputStateBuilder.expand(solverOutputState.inFrame(aState.accessFrame()), aState);
+    return {
+        outputStateBuilder.expand(solverOutputState.inFrame(aState.accessFrame()), aState),
+        stateTransitionMatrix,
+    };
+}
+
+Array<Pair<State, MatrixXd>> Propagator::calculateStatesAndStateTransitionMatricesAt(
+    const State& aState, const Array<Instant>& anInstantArray
+) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagator");
+    }
+
+    if (!aState.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State");
+    }
+
+    if (anInstantArray.isEmpty())
+    {
+        return Array<Pair<State, MatrixXd>>::Empty();
+    }
+
+    for (Size k = 0; k < anInstantArray.getSize() - 1; ++k)
+    {
+        if (anInstantArray[k] > anInstantArray[k + 1])
+        {
+            throw ostk::core::error::runtime::Wrong("Unsorted Instant Array");
+        }
+    }
+
+    this->validateDynamicsSet();
+
+    const StateBuilder solverStateBuilder = {Propagator::IntegrationFrame(), coordinatesBrokerSPtr_};
+
+    const State solverInputState = solverStateBuilder.reduce(aState.inFrame(Propagator::IntegrationFrame()));
+
+    const Size stateSize = solverInputState.getSize();
+
+    const Instant& startInstant = solverInputState.accessInstant();
+
+    // The state transition matrix is appended (column-major) to the state, as an additional coordinate subset
+
+    const Shared<CoordinateBroker> augmentedCoordinatesBrokerSPtr =
+        std::make_shared<CoordinateBroker>(coordinatesBrokerSPtr_->getSubsets());
+    augmentedCoordinatesBrokerSPtr->addSubset(
+        std::make_shared<CoordinateSubset>("STATE_TRANSITION_MATRIX", stateSize * stateSize)
+    );
+
+    VectorXd augmentedCoordinates(stateSize + stateSize * stateSize);
+    augmentedCoordinates.head(stateSize) = solverInputState.accessCoordinates();
+    Eigen::Map<MatrixXd>(augmentedCoordinates.data() + stateSize, stateSize, stateSize).setIdentity();
+
+    const State augmentedInputState = {
+        startInstant,
+        augmentedCoordinates,
+        Propagator::IntegrationFrame(),
+        augmentedCoordinatesBrokerSPtr,
+    };
+
+    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations = Dynamics::GetVariationalSystemOfEquations(
+        dynamicsContexts_, startInstant, Propagator::IntegrationFrame(), stateSize
+    );
+
+    NumericalSolver numericalSolver = numericalSolver_.getCallCopy();
+
+    Array<Instant> forwardInstants;
+    forwardInstants.reserve(anInstantArray.getSize());
+    Array<Instant> backwardInstants;
+    backwardInstants.reserve(anInstantArray.getSize());
+
+    for (const Instant& anInstant : anInstantArray)
+    {
+        if (anInstant <= startInstant)
+        {
+            backwardInstants.add(anInstant);
+        }
+        else
+        {
+            forwardInstants.add(anInstant);
+        }
+    }
+
+    // forward propagation only
+    Array<State> forwardAugmentedStates;
+    if (!forwardInstants.isEmpty())
+    {
+        forwardAugmentedStates = numericalSolver.integrateTime(augmentedInputState, forwardInstants, systemOfEquations);
+    }
+
+    // backward propagation only
+    Array<State> backwardAugmentedStates;
+    if (!backwardInstants.isEmpty())
+    {
+        std::reverse(backwardInstants.begin(), backwardInstants.end());
+
+        backwardAugmentedStates =
+            numericalSolver.integrateTime(augmentedInputState, backwardInstants, systemOfEquations);
+
+        std::reverse(backwardAugmentedStates.begin(), backwardAugmentedStates.end());
+    }
+
+    const Array<State> augmentedOutputStates = backwardAugmentedStates + forwardAugmentedStates;
+
+    const StateBuilder outputStateBuilder = {aState};
+
+    Array<Pair<State, MatrixXd>> statesAndStateTransitionMatrices = Array<Pair<State, MatrixXd>>::Empty();
+    statesAndStateTransitionMatrices.reserve(augmentedOutputStates.getSize());
+
+    for (const State& augmentedOutputState : augmentedOutputStates)
+    {
+        const Eigen::Ref<const VectorXd> augmentedOutputCoordinates = augmentedOutputState.accessCoordinates();
+
+        const State solverOutputState = {
+            augmentedOutputState.accessInstant(),
+            augmentedOutputCoordinates.head(stateSize),
+            Propagator::IntegrationFrame(),
+            coordinatesBrokerSPtr_,
+        };
+
+        statesAndStateTransitionMatrices.add({
+            outputStateBuilder.expand(solverOutputState.inFrame(aState.accessFrame()), aState),
+            Eigen::Map<const MatrixXd>(augmentedOutputCoordinates.data() + stateSize, stateSize, stateSize),
+        });
+    }
+
+    return statesAndStateTransitionMatrices;
+}
+
+Array<Pair<State, MatrixXd>> Propagator::calculateStatesAndCovariancesAt(
+    const State& aState, const MatrixXd& aCovariance, const Array<Instant>& anInstantArray
+) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagator");
+    }
+
+    if (!aState.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State");
+    }
+
+    if (anInstantArray.isEmpty())
+    {
+        return Array<Pair<State, MatrixXd>>::Empty();
+    }
+
+    this->validateDynamicsSet();
+
+    const StateBuilder solverStateBuilder = {Propagator::IntegrationFrame(), coordinatesBrokerSPtr_};
+
+    const Size stateSize = solverStateBuilder.reduce(aState.inFrame(Propagator::IntegrationFrame())).getSize();
+
+    if ((aCovariance.rows() != Eigen::Index(stateSize)) || (aCovariance.cols() != Eigen::Index(stateSize)))
+    {
+        throw ostk::core::error::runtime::Wrong("Covariance");
+    }
+
+    Array<Pair<State, MatrixXd>> statesAndCovariances =
+        this->calculateStatesAndStateTransitionMatricesAt(aState, anInstantArray);
+
+    for (Pair<State, MatrixXd>& stateAndCovariance : statesAndCovariances)
+    {
+        const MatrixXd covariance = stateAndCovariance.second * aCovariance * stateAndCovariance.second.transpose();
+
+        stateAndCovariance.second = 0.5 * (covariance + covariance.transpose());
+    }
+
+    return statesAndCovariances;
 }
 
 NumericalSolver::ConditionSolution Propagator::calculateStateToCondition(
@@ -262,14 +682,14 @@ NumericalSolver::ConditionSolution Propagator::calculateStateToCondition(
 
     const Instant& startInstant = aState.accessInstant();
 
-    const StateBuilder solverStateBuilder = {Propagator::IntegrationFrameSPtr, coordinatesBrokerSPtr_};
+    const StateBuilder solverStateBuilder = {Propagator::IntegrationFrame(), coordinatesBrokerSPtr_};
 
-    const State solverInputState = solverStateBuilder.reduce(aState.inFrame(Propagator::IntegrationFrameSPtr));
+    const State solverInputState = solverStateBuilder.reduce(aState.inFrame(Propagator::IntegrationFrame()));
 
     NumericalSolver::ConditionSolution conditionSolution = numericalSolver_.integrateTime(
         solverInputState,
         anInstant,
-        Dynamics::GetSystemOfEquations(dynamicsContexts_, startInstant, Propagator::IntegrationFrameSPtr),
+        Dynamics::GetSystemOfEquations(dynamicsContexts_, startInstant, Propagator::IntegrationFrame()),
         anEventCondition
     );
 
@@ -280,7 +700,80 @@ NumericalSolver::ConditionSolution Propagator::calculateStateToCondition(
     return conditionSolution;
 }
 
+NumericalSolver::EventsSolution Propagator::calculateStateAndEventsAt(
+    const State& aState, const Instant& anInstant, const Array<Shared<EventCondition>>& anEventConditionArray
+) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagator");
+    }
+
+    this->validateDynamicsSet();
+
+    const Instant& startInstant = aState.accessInstant();
+
+    const StateBuilder solverStateBuilder = {Propagator::IntegrationFrame(), coordinatesBrokerSPtr_};
+
+    const State solverInputState = solverStateBuilder.reduce(aState.inFrame(Propagator::IntegrationFrame()));
+
+    NumericalSolver::EventsSolution eventsSolution = numericalSolver_.integrateTime(
+        solverInputState,
+        anInstant,
+        Dynamics::GetSystemOfEquations(dynamicsContexts_, startInstant, Propagator::IntegrationFrame()),
+        anEventConditionArray
+    );
+
+    const StateBuilder outputStateBuilder = {aState};
+
+    eventsSolution.state = outputStateBuilder.expand(eventsSolution.state.inFrame(aState.accessFrame()), aState);
+
+    for (NumericalSolver::EventOccurrence& eventOccurrence : eventsSolution.eventOccurrences)
+    {
+        eventOccurrence.state = outputStateBuilder.expand(eventOccurrence.state.inFrame(aState.accessFrame()), aState);
+    }
+
+    return eventsSolution;
+}
+
 Array<State> Propagator::calculateStatesAt(const State& aState, const Array<Instant>& anInstantArray) const
+{
+    const Array<State> solverOutputStates = this->calculateSolverStatesAt(aState, anInstantArray);
+
+    if (solverOutputStates.isEmpty())
+    {
+        return Array<State>::Empty();
+    }
+
+    const StateBuilder outputStateBuilder(aState);
+
+    return outputStateBuilder.expand(State::InFrame(solverOutputStates, aState.accessFrame()), aState);
+}
+
+StateHistory Propagator::calculateStateHistoryAt(const State& aState, const Array<Instant>& anInstantArray) const
+{
+    const Array<State> solverOutputStates = this->calculateSolverStatesAt(aState, anInstantArray);
+
+    StateHistory stateHistory = {};
+
+    if (solverOutputStates.isEmpty())
+    {
+        return stateHistory;
+    }
+
+    const StateBuilder outputStateBuilder(aState);
+
+    stateHistory.reserve(solverOutputStates.getSize());
+
+    for (const State& solverOutputState : solverOutputStates)
+    {
+        stateHistory.add(outputStateBuilder.expand(solverOutputState.inFrame(aState.accessFrame()), aState));
+    }
+
+    return stateHistory;
+}
+
+Array<State> Propagator::calculateSolverStatesAt(const State& aState, const Array<Instant>& anInstantArray) const
 {
     if (!this->isDefined())
     {
@@ -307,19 +800,19 @@ Array<State> Propagator::calculateStatesAt(const State& aState, const Array<Inst
 
     this->validateDynamicsSet();
 
-    const StateBuilder solverStateBuilder = {Propagator::IntegrationFrameSPtr, coordinatesBrokerSPtr_};
+    const StateBuilder solverStateBuilder = {Propagator::IntegrationFrame(), coordinatesBrokerSPtr_};
 
-    const State solverInputState = solverStateBuilder.reduce(aState.inFrame(Propagator::IntegrationFrameSPtr));
+    const State solverInputState = solverStateBuilder.reduce(aState.inFrame(Propagator::IntegrationFrame()));
 
     const Instant& startInstant = solverInputState.accessInstant();
 
+    NumericalSolver numericalSolver = numericalSolver_.getCallCopy();
+
     Array<Instant> forwardInstants;
     forwardInstants.reserve(anInstantArray.getSize());
     Array<Instant> backwardInstants;
     backwardInstants.reserve(anInstantArray.getSize());
 
-    const StateBuilder outputStateBuilder(aState);
-
     for (const Instant& anInstant : anInstantArray)
     {
         if (anInstant <= startInstant)
@@ -336,10 +829,10 @@ Array<State> Propagator::calculateStatesAt(const State& aState, const Array<Inst
     Array<State> forwardPropagatedStates;
     if (!forwardInstants.isEmpty())
     {
-        forwardPropagatedStates = numericalSolver_.integrateTime(
+        forwardPropagatedStates = numericalSolver.integrateTime(
             solverInputState,
             forwardInstants,
-            Dynamics::GetSystemOfEquations(dynamicsContexts_, startInstant, Propagator::IntegrationFrameSPtr)
+            Dynamics::GetSystemOfEquations(dynamicsContexts_, startInstant, Propagator::IntegrationFrame())
         );
     }
 
@@ -349,21 +842,341 @@ Array<State> Propagator::calculateStatesAt(const State& aState, const Array<Inst
     {
         std::reverse(backwardInstants.begin(), backwardInstants.end());
 
-        backwardPropagatedStates = numericalSolver_.integrateTime(
+        backwardPropagatedStates = numericalSolver.integrateTime(
             solverInputState,
             backwardInstants,
-            Dynamics::GetSystemOfEquations(dynamicsContexts_, startInstant, Propagator::IntegrationFrameSPtr)
+            Dynamics::GetSystemOfEquations(dynamicsContexts_, startInstant, Propagator::IntegrationFrame())
         );
 
         std::reverse(backwardPropagatedStates.begin(), backwardPropagatedStates.end());
     }
 
+    return backwardPropagatedStates + forwardPropagatedStates;
+}
+
+Array<State> Propagator::calculateStatesAt(
+    const Array<State>& aStateArray, const Instant& anInstant, const Size& aThreadCount
+) const
+{
+    return this->calculateStatesAt(aStateArray, anInstant, ExecutionContext(aThreadCount));
+}
+
+Array<State> Propagator::calculateStatesAt(
+    const Array<State>& aStateArray, const Instant& anInstant, const ExecutionContext& anExecutionContext
+) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagator");
+    }
+
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    const Size stateCount = aStateArray.getSize();
+
+    if (stateCount == 0)
+    {
+        return Array<State>::Empty();
+    }
+
+    for (const State& state : aStateArray)
+    {
+        if (!state.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("State");
+        }
+    }
+
+    this->validateDynamicsSet();
+
+    Array<State> outputStates(stateCount, State::Undefined());
+
+    anExecutionContext.parallelFor(
+        stateCount,
+        [this, &outputStates, &aStateArray, &anInstant](const Index& aStateIndex)
+        {
+            outputStates[aStateIndex] = this->calculateStateAt(aStateArray[aStateIndex], anInstant);
+        }
+    );
+
+    return outputStates;
+}
+
+Array<Array<State>> Propagator::calculateStatesAt(
+    const Array<State>& aStateArray, const Array<Instant>& anInstantArray, const Size& aThreadCount
+) const
+{
+    return this->calculateStatesAt(aStateArray, anInstantArray, ExecutionContext(aThreadCount));
+}
+
+Array<Array<State>> Propagator::calculateStatesAt(
+    const Array<State>& aStateArray, const Array<Instant>& anInstantArray, const ExecutionContext& anExecutionContext
+) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagator");
+    }
+
+    const Size stateCount = aStateArray.getSize();
+
+    if (stateCount == 0)
+    {
+        return Array<Array<State>>::Empty();
+    }
+
+    for (const State& state : aStateArray)
+    {
+        if (!state.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("State");
+        }
+    }
+
+    this->validateDynamicsSet();
+
+    Array<Array<State>> outputStateArrays(stateCount, Array<State>::Empty());
+
+    anExecutionContext.parallelFor(
+        stateCount,
+        [this, &outputStateArrays, &aStateArray, &anInstantArray](const Index& aStateIndex)
+        {
+            outputStateArrays[aStateIndex] = this->calculateStatesAt(aStateArray[aStateIndex], anInstantArray);
+        }
+    );
+
+    return outputStateArrays;
+}
+
+Array<State> Propagator::calculateStatesAt(
+    const State& aState,
+    const Array<Instant>& anInstantArray,
+    const Propagator& aCoarsePropagator,
+    const Real& aTolerance,
+    const Size& aMaximumIterationCount,
+    const Size& aThreadCount
+) const
+{
+    return this->calculateStatesAt(
+        aState, anInstantArray, aCoarsePropagator, aTolerance, aMaximumIterationCount, ExecutionContext(aThreadCount)
+    );
+}
+
+Array<State> Propagator::calculateStatesAt(
+    const State& aState,
+    const Array<Instant>& anInstantArray,
+    const Propagator& aCoarsePropagator,
+    const Real& aTolerance,
+    const Size& aMaximumIterationCount,
+    const ExecutionContext& anExecutionContext
+) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Propagator");
+    }
+
+    if (!aCoarsePropagator.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Coarse propagator");
+    }
+
+    if (!aState.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State");
+    }
+
+    if (!aTolerance.isDefined() || aTolerance <= 0.0)
+    {
+        throw ostk::core::error::runtime::Wrong("Tolerance");
+    }
+
+    if (anInstantArray.isEmpty())
+    {
+        return Array<State>::Empty();
+    }
+
+    for (Size k = 0; k < anInstantArray.getSize(); ++k)
+    {
+        const Instant& previousInstant = (k == 0) ? aState.accessInstant() : anInstantArray[k - 1];
+
+        if (anInstantArray[k] <= previousInstant)
+        {
+            throw ostk::core::error::runtime::Wrong("Unsorted Instant Array");
+        }
+    }
+
+    this->validateDynamicsSet();
+
+    const StateBuilder solverStateBuilder = {Propagator::IntegrationFrame(), coordinatesBrokerSPtr_};
+
+    const State solverInputState = solverStateBuilder.reduce(aState.inFrame(Propagator::IntegrationFrame()));
+
+    const Size windowCount = anInstantArray.getSize();
+
+    const auto boundaryInstant = [&](const Size& aBoundaryIndex) -> const Instant&
+    {
+        return (aBoundaryIndex == 0) ? solverInputState.accessInstant() : anInstantArray[aBoundaryIndex - 1];
+    };
+
+    const auto boundaryState = [&](const Size& aBoundaryIndex, const VectorXd& aCoordinates) -> State
+    {
+        return {
+            boundaryInstant(aBoundaryIndex),
+            aCoordinates,
+            Propagator::IntegrationFrame(),
+            solverInputState.accessCoordinateBroker()
+        };
+    };
+
+    const auto coarseStep = [&](const Size& aWindowIndex, const VectorXd& aCoordinates) -> VectorXd
+    {
+        return aCoarsePropagator
+            .calculateStateAt(boundaryState(aWindowIndex, aCoordinates), boundaryInstant(aWindowIndex + 1))
+            .getCoordinates();
+    };
+
+    // Boundary states (window start states, plus the final state), initially predicted by the coarse propagator
+
+    Array<VectorXd> boundaryCoordinates(windowCount + 1, solverInputState.getCoordinates());
+    Array<VectorXd> coarseCoordinates(windowCount, VectorXd());
+    Array<VectorXd> fineCoordinates(windowCount, VectorXd());
+
+    for (Size windowIndex = 0; windowIndex < windowCount; ++windowIndex)
+    {
+        coarseCoordinates[windowIndex] = coarseStep(windowIndex, boundaryCoordinates[windowIndex]);
+        boundaryCoordinates[windowIndex + 1] = coarseCoordinates[windowIndex];
+    }
+
+    // Each iteration makes at least one more window exact, hence windowCount iterations reproduce the sequential
+    // propagation
+
+    const Size iterationCount = std::min<Size>(std::max<Size>(aMaximumIterationCount, 1), windowCount);
+
+    for (Size iterationIndex = 0; iterationIndex < iterationCount; ++iterationIndex)
+    {
+        // Refine the windows in parallel. Windows before the iteration index start from converged states, and their
+        // fine solutions are left unchanged.
+
+        const Size firstWindowIndex = iterationIndex;
+
+        anExecutionContext.parallelFor(
+            windowCount - firstWindowIndex,
+            [this, &fineCoordinates, &boundaryCoordinates, &boundaryState, &boundaryInstant, firstWindowIndex](
+                const Index& aTaskIndex
+            )
+            {
+                const Size windowIndex = firstWindowIndex + aTaskIndex;
+
+                const State fineState = this->calculateStateAt(
+                    boundaryState(windowIndex, boundaryCoordinates[windowIndex]), boundaryInstant(windowIndex + 1)
+                );
+
+                fineCoordinates[windowIndex] = fineState.getCoordinates();
+            }
+        );
+
+        // Sequential Parareal correction: U[n + 1] = F(U_previous[n]) + G(U[n]) - G(U_previous[n])
+
+        Real maximumCorrection =
+            (fineCoordinates[firstWindowIndex] - boundaryCoordinates[firstWindowIndex + 1]).lpNorm<Eigen::Infinity>();
+
+        boundaryCoordinates[firstWindowIndex + 1] = fineCoordinates[firstWindowIndex];
+
+        for (Size windowIndex = firstWindowIndex + 1; windowIndex < windowCount; ++windowIndex)
+        {
+            const VectorXd coarseCoordinatesUpdate = coarseStep(windowIndex, boundaryCoordinates[windowIndex]);
+
+            const VectorXd correctedCoordinates =
+                fineCoordinates[windowIndex] + coarseCoordinatesUpdate - coarseCoordinates[windowIndex];
+
+            maximumCorrection = std::max<double>(
+                maximumCorrection,
+                (correctedCoordinates - boundaryCoordinates[windowIndex + 1]).lpNorm<Eigen::Infinity>()
+            );
+
+            coarseCoordinates[windowIndex] = coarseCoordinatesUpdate;
+            boundaryCoordinates[windowIndex + 1] = correctedCoordinates;
+        }
+
+        if (maximumCorrection < aTolerance)
+        {
+            break;
+        }
+    }
+
+    const StateBuilder outputStateBuilder(aState);
+
     Array<State> outputStates;
-    outputStates.reserve(backwardPropagatedStates.getSize() + forwardPropagatedStates.getSize());
+    outputStates.reserve(windowCount);
+
+    for (Size boundaryIndex = 1; boundaryIndex <= windowCount; ++boundaryIndex)
+    {
+        outputStates.add(outputStateBuilder.expand(
+            boundaryState(boundaryIndex, boundaryCoordinates[boundaryIndex]).inFrame(aState.accessFrame()), aState
+        ));
+    }
+
+    return outputStates;
+}
 
-    for (const State& solverOutputState : backwardPropagatedStates + forwardPropagatedStates)
+Array<State> Propagator::calculateEnsembleStatesAt(const Array<State>& aStateArray, const Instant& anInstant) const
+{
+    if (!this->isDefined())
     {
-        outputStates.add(outputStateBuilder.expand(solverOutputState.inFrame(aState.accessFrame()), aState));
+        throw ostk::core::error::runtime::Undefined("Propagator");
+    }
+
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (aStateArray.isEmpty())
+    {
+        return Array<State>::Empty();
+    }
+
+    for (const State& state : aStateArray)
+    {
+        if (!state.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("State");
+        }
+    }
+
+    this->validateDynamicsSet();
+
+    const StateBuilder solverStateBuilder = {Propagator::IntegrationFrame(), coordinatesBrokerSPtr_};
+
+    const Array<State> solverInputStates = aStateArray.map<State>(
+        [&solverStateBuilder](const State& aState) -> State
+        {
+            return solverStateBuilder.reduce(aState.inFrame(Propagator::IntegrationFrame()));
+        }
+    );
+
+    const Array<State> solverOutputStates = numericalSolver_.getCallCopy().integrateEnsembleTime(
+        solverInputStates,
+        anInstant,
+        Dynamics::GetEnsembleSystemOfEquations(
+            dynamicsContexts_, solverInputStates.accessFirst().accessInstant(), Propagator::IntegrationFrame()
+        )
+    );
+
+    Array<State> outputStates;
+    outputStates.reserve(aStateArray.getSize());
+
+    for (Index i = 0; i < aStateArray.getSize(); ++i)
+    {
+        const State& state = aStateArray[i];
+
+        const StateBuilder outputStateBuilder = {state};
+
+        outputStates.add(outputStateBuilder.expand(solverOutputStates[i].inFrame(state.accessFrame()), state));
     }
 
     return outputStates;
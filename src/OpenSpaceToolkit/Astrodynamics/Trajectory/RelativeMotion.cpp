@@ -0,0 +1,538 @@
+/// Apache License 2.0
+
+#include <cmath>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Velocity.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Time.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/RelativeMotion.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace trajectory
+{
+
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::Matrix3d;
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Velocity;
+using ostk::physics::time::Duration;
+using ostk::physics::unit::Length;
+using ostk::physics::unit::Time;
+
+static const Derived::Unit GravitationalParameterSIUnit =
+    Derived::Unit::GravitationalParameter(Length::Unit::Meter, Time::Unit::Second);
+
+namespace
+{
+
+using Matrix4d = Eigen::Matrix<double, 4, 4>;
+using Matrix6d = Eigen::Matrix<double, 6, 6>;
+
+/// Rotation from the parent frame to the QSW frame, whose rows are the QSW axes
+Matrix3d QSWRotation(const Vector3d& aPosition, const Vector3d& aVelocity)
+{
+    const Vector3d q = aPosition.normalized();
+    const Vector3d w = aPosition.cross(aVelocity).normalized();
+    const Vector3d s = w.cross(q);
+
+    Matrix3d rotation;
+    rotation.row(0) = q;
+    rotation.row(1) = s;
+    rotation.row(2) = w;
+
+    return rotation;
+}
+
+/// Angular velocity of the QSW frame, expressed in the QSW frame
+Vector3d QSWAngularVelocity(const Vector3d& aPosition, const Vector3d& aVelocity)
+{
+    return {0.0, 0.0, aPosition.cross(aVelocity).norm() / aPosition.squaredNorm()};
+}
+
+}  // namespace
+
+RelativeMotion::RelativeMotion(
+    const State& aTargetState, const Derived& aGravitationalParameter, const RelativeMotion::Type& aType
+)
+    : targetState_(State::Undefined()),
+      gravitationalParameter_(aGravitationalParameter),
+      type_(aType),
+      eccentricity_(0.0),
+      meanMotion_(0.0),
+      meanAnomalyAtEpoch_(0.0)
+{
+    if (!aTargetState.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Target state");
+    }
+
+    if (!gravitationalParameter_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Gravitational parameter");
+    }
+
+    if (type_ == RelativeMotion::Type::Undefined)
+    {
+        throw ostk::core::error::runtime::Undefined("Type");
+    }
+
+    targetState_ = aTargetState.inFrame(Frame::GCRF());
+
+    const double mu = gravitationalParameter_.in(GravitationalParameterSIUnit);
+
+    const Vector3d position = targetState_.getPosition().getCoordinates();
+    const Vector3d velocity = targetState_.getVelocity().getCoordinates();
+
+    const double semiMajorAxis = 1.0 / ((2.0 / position.norm()) - (velocity.squaredNorm() / mu));
+    const Vector3d eccentricityVector =
+        (velocity.cross(position.cross(velocity)) / mu) - (position / position.norm());
+
+    eccentricity_ = eccentricityVector.norm();
+
+    if ((!(semiMajorAxis > 0.0)) || (eccentricity_ >= 1.0))
+    {
+        throw ostk::core::error::runtime::Wrong("Target orbit (not elliptical)");
+    }
+
+    meanMotion_ = std::sqrt(mu / (semiMajorAxis * semiMajorAxis * semiMajorAxis));
+
+    // Mean anomaly from the eccentric anomaly, whose cosine and sine follow from the position and velocity
+
+    const double cosE = (1.0 - position.norm() / semiMajorAxis);
+    const double sinE = position.dot(velocity) / std::sqrt(mu * semiMajorAxis);
+    const double eccentricAnomaly = std::atan2(sinE, cosE);
+
+    meanAnomalyAtEpoch_ = eccentricAnomaly - eccentricity_ * std::sin(eccentricAnomaly);
+}
+
+RelativeMotion::RelativeMotion()
+    : targetState_(State::Undefined()),
+      gravitationalParameter_(Derived::Undefined()),
+      type_(RelativeMotion::Type::Undefined),
+      eccentricity_(0.0),
+      meanMotion_(0.0),
+      meanAnomalyAtEpoch_(0.0)
+{
+}
+
+bool RelativeMotion::operator==(const RelativeMotion& aRelativeMotion) const
+{
+    if ((!this->isDefined()) || (!aRelativeMotion.isDefined()))
+    {
+        return false;
+    }
+
+    return (targetState_ == aRelativeMotion.targetState_) &&
+           (gravitationalParameter_ == aRelativeMotion.gravitationalParameter_) && (type_ == aRelativeMotion.type_);
+}
+
+bool RelativeMotion::operator!=(const RelativeMotion& aRelativeMotion) const
+{
+    return !((*this) == aRelativeMotion);
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const RelativeMotion& aRelativeMotion)
+{
+    aRelativeMotion.print(anOutputStream);
+
+    return anOutputStream;
+}
+
+bool RelativeMotion::isDefined() const
+{
+    return targetState_.isDefined() && gravitationalParameter_.isDefined() &&
+           (type_ != RelativeMotion::Type::Undefined);
+}
+
+const State& RelativeMotion::accessTargetState() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Relative motion");
+    }
+
+    return targetState_;
+}
+
+Derived RelativeMotion::getGravitationalParameter() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Relative motion");
+    }
+
+    return gravitationalParameter_;
+}
+
+RelativeMotion::Type RelativeMotion::getType() const
+{
+    return type_;
+}
+
+Real RelativeMotion::getEccentricity() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Relative motion");
+    }
+
+    return eccentricity_;
+}
+
+Real RelativeMotion::getMeanMotion() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Relative motion");
+    }
+
+    return meanMotion_;
+}
+
+MatrixXd RelativeMotion::calculateStateTransitionMatrix(const Instant& aStartInstant, const Instant& anEndInstant)
+    const
+{
+    if (!aStartInstant.isDefined() || !anEndInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Relative motion");
+    }
+
+    switch (type_)
+    {
+        case RelativeMotion::Type::ClohessyWiltshire:
+            return this->calculateClohessyWiltshireStateTransitionMatrix(
+                Duration::Between(aStartInstant, anEndInstant).inSeconds()
+            );
+
+        case RelativeMotion::Type::YamanakaAnkersen:
+            return this->calculateYamanakaAnkersenStateTransitionMatrix(aStartInstant, anEndInstant);
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Type");
+    }
+}
+
+VectorXd RelativeMotion::calculateRelativeStateAt(
+    const VectorXd& aRelativeState, const Instant& aStartInstant, const Instant& anInstant
+) const
+{
+    if (aRelativeState.size() != 6)
+    {
+        throw ostk::core::error::runtime::Wrong("Relative state size");
+    }
+
+    return this->calculateStateTransitionMatrix(aStartInstant, anInstant) * aRelativeState;
+}
+
+MatrixXd RelativeMotion::calculateRelativeStatesAt(
+    const VectorXd& aRelativeState, const Instant& aStartInstant, const Array<Instant>& anInstantArray
+) const
+{
+    if (aRelativeState.size() != 6)
+    {
+        throw ostk::core::error::runtime::Wrong("Relative state size");
+    }
+
+    MatrixXd relativeStates = MatrixXd::Zero(anInstantArray.getSize(), 6);
+
+    for (Size i = 0; i < anInstantArray.getSize(); ++i)
+    {
+        relativeStates.row(i) =
+            (this->calculateStateTransitionMatrix(aStartInstant, anInstantArray[i]) * aRelativeState).transpose();
+    }
+
+    return relativeStates;
+}
+
+void RelativeMotion::print(std::ostream& anOutputStream, bool displayDecorator) const
+{
+    displayDecorator ? ostk::core::utils::Print::Header(anOutputStream, "Relative Motion") : void();
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Type:" << RelativeMotion::StringFromType(type_);
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Gravitational parameter:"
+        << (gravitationalParameter_.isDefined() ? gravitationalParameter_.toString() : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Eccentricity:" << (this->isDefined() ? Real(eccentricity_).toString() : "Undefined");
+
+    ostk::core::utils::Print::Separator(anOutputStream, "Target State");
+
+    targetState_.print(anOutputStream, false);
+
+    displayDecorator ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+RelativeMotion RelativeMotion::Undefined()
+{
+    return {};
+}
+
+VectorXd RelativeMotion::ComputeRelativeState(const State& aTargetState, const State& aChaserState)
+{
+    if (!aTargetState.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Target state");
+    }
+
+    if (!aChaserState.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Chaser state");
+    }
+
+    if (aTargetState.accessInstant() != aChaserState.accessInstant())
+    {
+        throw ostk::core::error::runtime::Wrong("Chaser state instant");
+    }
+
+    const State targetState = aTargetState.inFrame(Frame::GCRF());
+    const State chaserState = aChaserState.inFrame(Frame::GCRF());
+
+    const Vector3d targetPosition = targetState.getPosition().getCoordinates();
+    const Vector3d targetVelocity = targetState.getVelocity().getCoordinates();
+
+    const Matrix3d rotation = QSWRotation(targetPosition, targetVelocity);
+    const Vector3d angularVelocity = QSWAngularVelocity(targetPosition, targetVelocity);
+
+    const Vector3d relativePosition = rotation * (chaserState.getPosition().getCoordinates() - targetPosition);
+    const Vector3d relativeVelocity = rotation * (chaserState.getVelocity().getCoordinates() - targetVelocity) -
+                                      angularVelocity.cross(relativePosition);
+
+    VectorXd relativeState(6);
+    relativeState << relativePosition, relativeVelocity;
+
+    return relativeState;
+}
+
+State RelativeMotion::ComputeChaserState(const State& aTargetState, const VectorXd& aRelativeState)
+{
+    if (!aTargetState.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Target state");
+    }
+
+    if (aRelativeState.size() != 6)
+    {
+        throw ostk::core::error::runtime::Wrong("Relative state size");
+    }
+
+    const State targetState = aTargetState.inFrame(Frame::GCRF());
+
+    const Vector3d targetPosition = targetState.getPosition().getCoordinates();
+    const Vector3d targetVelocity = targetState.getVelocity().getCoordinates();
+
+    const Matrix3d rotation = QSWRotation(targetPosition, targetVelocity);
+    const Vector3d angularVelocity = QSWAngularVelocity(targetPosition, targetVelocity);
+
+    const Vector3d relativePosition = aRelativeState.head<3>();
+    const Vector3d relativeVelocity = aRelativeState.tail<3>();
+
+    const Vector3d chaserPosition = targetPosition + rotation.transpose() * relativePosition;
+    const Vector3d chaserVelocity =
+        targetVelocity + rotation.transpose() * (relativeVelocity + angularVelocity.cross(relativePosition));
+
+    const State chaserState = {
+        targetState.accessInstant(),
+        Position::Meters(chaserPosition, Frame::GCRF()),
+        Velocity::MetersPerSecond(chaserVelocity, Frame::GCRF()),
+    };
+
+    return chaserState.inFrame(aTargetState.accessFrame());
+}
+
+String RelativeMotion::StringFromType(const RelativeMotion::Type& aType)
+{
+    switch (aType)
+    {
+        case RelativeMotion::Type::Undefined:
+            return "Undefined";
+
+        case RelativeMotion::Type::ClohessyWiltshire:
+            return "Clohessy-Wiltshire";
+
+        case RelativeMotion::Type::YamanakaAnkersen:
+            return "Yamanaka-Ankersen";
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Type");
+    }
+
+    return String::Empty();
+}
+
+double RelativeMotion::calculateTrueAnomalyAt(const Instant& anInstant) const
+{
+    const double meanAnomaly =
+        meanAnomalyAtEpoch_ + meanMotion_ * Duration::Between(targetState_.accessInstant(), anInstant).inSeconds();
+
+    double eccentricAnomaly = meanAnomaly;
+
+    for (Size i = 0; i < 50; ++i)
+    {
+        const double step = (eccentricAnomaly - eccentricity_ * std::sin(eccentricAnomaly) - meanAnomaly) /
+                            (1.0 - eccentricity_ * std::cos(eccentricAnomaly));
+
+        eccentricAnomaly -= step;
+
+        if (std::abs(step) < 1e-14)
+        {
+            break;
+        }
+    }
+
+    // Continuous with the eccentric anomaly
+
+    const double beta = eccentricity_ / (1.0 + std::sqrt(1.0 - eccentricity_ * eccentricity_));
+
+    return eccentricAnomaly +
+           2.0 * std::atan2(beta * std::sin(eccentricAnomaly), 1.0 - beta * std::cos(eccentricAnomaly));
+}
+
+MatrixXd RelativeMotion::calculateClohessyWiltshireStateTransitionMatrix(const double& aDuration) const
+{
+    const double n = meanMotion_;
+    const double t = aDuration;
+
+    const double s = std::sin(n * t);
+    const double c = std::cos(n * t);
+
+    // Radial (x), along-track (y) and cross-track (z) motion
+
+    MatrixXd stateTransitionMatrix = MatrixXd::Zero(6, 6);
+
+    stateTransitionMatrix.row(0) << 4.0 - 3.0 * c, 0.0, 0.0, s / n, 2.0 * (1.0 - c) / n, 0.0;
+    stateTransitionMatrix.row(1) << 6.0 * (s - n * t), 1.0, 0.0, -2.0 * (1.0 - c) / n, (4.0 * s - 3.0 * n * t) / n, 0.0;
+    stateTransitionMatrix.row(2) << 0.0, 0.0, c, 0.0, 0.0, s / n;
+    stateTransitionMatrix.row(3) << 3.0 * n * s, 0.0, 0.0, c, 2.0 * s, 0.0;
+    stateTransitionMatrix.row(4) << -6.0 * n * (1.0 - c), 0.0, 0.0, -2.0 * s, 4.0 * c - 3.0, 0.0;
+    stateTransitionMatrix.row(5) << 0.0, 0.0, -n * s, 0.0, 0.0, c;
+
+    return stateTransitionMatrix;
+}
+
+MatrixXd RelativeMotion::calculateYamanakaAnkersenStateTransitionMatrix(
+    const Instant& aStartInstant, const Instant& anEndInstant
+) const
+{
+    const double e = eccentricity_;
+    const double k2 = meanMotion_ / std::pow(1.0 - e * e, 1.5);
+
+    const double startTrueAnomaly = this->calculateTrueAnomalyAt(aStartInstant);
+    const double endTrueAnomaly = this->calculateTrueAnomalyAt(anEndInstant);
+
+    const double J = k2 * Duration::Between(aStartInstant, anEndInstant).inSeconds();
+
+    // The formulation uses the LVLH frame of Yamanaka and Ankersen (x along-track, y opposite to the orbital
+    // momentum, z opposite to the position), and variables scaled by rho = 1 + e cos(theta), differentiated with
+    // respect to the true anomaly theta
+
+    Matrix6d qswToLVLH = Matrix6d::Zero();
+    qswToLVLH(0, 1) = 1.0;
+    qswToLVLH(1, 2) = -1.0;
+    qswToLVLH(2, 0) = -1.0;
+    qswToLVLH(3, 4) = 1.0;
+    qswToLVLH(4, 5) = -1.0;
+    qswToLVLH(5, 3) = -1.0;
+
+    const auto toScaled = [e, k2](const double& aTrueAnomaly) -> Matrix6d
+    {
+        const double rho = 1.0 + e * std::cos(aTrueAnomaly);
+
+        Matrix6d transform = Matrix6d::Zero();
+
+        for (Size i = 0; i < 3; ++i)
+        {
+            transform(i, i) = rho;
+            transform(i + 3, i) = -e * std::sin(aTrueAnomaly);
+            transform(i + 3, i + 3) = 1.0 / (k2 * rho);
+        }
+
+        return transform;
+    };
+
+    const auto fromScaled = [e, k2](const double& aTrueAnomaly) -> Matrix6d
+    {
+        const double rho = 1.0 + e * std::cos(aTrueAnomaly);
+
+        Matrix6d transform = Matrix6d::Zero();
+
+        for (Size i = 0; i < 3; ++i)
+        {
+            transform(i, i) = 1.0 / rho;
+            transform(i + 3, i) = k2 * e * std::sin(aTrueAnomaly);
+            transform(i + 3, i + 3) = k2 * rho;
+        }
+
+        return transform;
+    };
+
+    // In-plane motion (x, z, x', z'), through the pseudo-initial values
+
+    const double rho0 = 1.0 + e * std::cos(startTrueAnomaly);
+    const double s0 = rho0 * std::sin(startTrueAnomaly);
+    const double c0 = rho0 * std::cos(startTrueAnomaly);
+
+    Matrix4d inverseInitialMatrix;
+    inverseInitialMatrix << 1.0 - e * e, 3.0 * e * s0 / rho0 * (1.0 + 1.0 / rho0), -e * s0 * (1.0 + 1.0 / rho0),
+        -e * c0 + 2.0, 0.0, -3.0 * s0 / rho0 * (1.0 + e * e / rho0), s0 * (1.0 + 1.0 / rho0), c0 - 2.0 * e, 0.0,
+        -3.0 * (c0 / rho0 + e), c0 * (1.0 + 1.0 / rho0) + e, -s0, 0.0, 3.0 * rho0 + e * e - 1.0, -rho0 * rho0, e * s0;
+    inverseInitialMatrix /= (1.0 - e * e);
+
+    const double rho = 1.0 + e * std::cos(endTrueAnomaly);
+    const double s = rho * std::sin(endTrueAnomaly);
+    const double c = rho * std::cos(endTrueAnomaly);
+    const double sPrime = std::cos(endTrueAnomaly) + e * std::cos(2.0 * endTrueAnomaly);
+    const double cPrime = -(std::sin(endTrueAnomaly) + e * std::sin(2.0 * endTrueAnomaly));
+
+    Matrix4d finalMatrix;
+    finalMatrix << 1.0, -c * (1.0 + 1.0 / rho), s * (1.0 + 1.0 / rho), 3.0 * rho * rho * J, 0.0, s, c,
+        2.0 - 3.0 * e * s * J, 0.0, 2.0 * s, 2.0 * c - e, 3.0 * (1.0 - 2.0 * e * s * J), 0.0, sPrime, cPrime,
+        -3.0 * e * (sPrime * J + s / (rho * rho));
+
+    const Matrix4d inPlaneMatrix = finalMatrix * inverseInitialMatrix;
+
+    Matrix6d scaledMatrix = Matrix6d::Zero();
+
+    const Size inPlaneIndexes[4] = {0, 2, 3, 5};
+
+    for (Size i = 0; i < 4; ++i)
+    {
+        for (Size j = 0; j < 4; ++j)
+        {
+            scaledMatrix(inPlaneIndexes[i], inPlaneIndexes[j]) = inPlaneMatrix(i, j);
+        }
+    }
+
+    // Out-of-plane motion (y, y'), harmonic in the true anomaly
+
+    const double trueAnomalyDifference = endTrueAnomaly - startTrueAnomaly;
+
+    scaledMatrix(1, 1) = std::cos(trueAnomalyDifference);
+    scaledMatrix(1, 4) = std::sin(trueAnomalyDifference);
+    scaledMatrix(4, 1) = -std::sin(trueAnomalyDifference);
+    scaledMatrix(4, 4) = std::cos(trueAnomalyDifference);
+
+    return qswToLVLH.transpose() * fromScaled(endTrueAnomaly) * scaledMatrix * toScaled(startTrueAnomaly) * qswToLVLH;
+}
+
+}  // namespace trajectory
+}  // namespace astrodynamics
+}  // namespace ostk
@@ -2,12 +2,17 @@
 
 #include <numeric>
 
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/Quaternion.hpp>
+
 #include <OpenSpaceToolkit/Physics/Environment/Gravitational/Earth.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/Tabulated.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/EventCondition/RealCondition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Tracer.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Propagated.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Segment.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Sequence.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianVelocity.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/StateBuilder.hpp>
@@ -19,15 +24,42 @@ namespace astrodynamics
 namespace trajectory
 {
 
+using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+
 using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
 
 using TabulatedDynamics = ostk::astrodynamics::dynamics::Tabulated;
+using ostk::astrodynamics::eventcondition::RealCondition;
+using ostk::astrodynamics::Tracer;
 using ostk::astrodynamics::trajectory::orbit::model::Propagated;
 using ostk::astrodynamics::trajectory::Propagator;
 using ostk::astrodynamics::trajectory::state::CoordinateSubset;
 using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianVelocity;
 using ostk::astrodynamics::trajectory::StateBuilder;
 
+namespace
+{
+
+String SegmentTypeToString(const Segment::Type& aType)
+{
+    switch (aType)
+    {
+        case Segment::Type::Coast:
+            return "Coast";
+
+        case Segment::Type::Maneuver:
+            return "Maneuver";
+
+        case Segment::Type::ImpulsiveManeuver:
+            return "Impulsive Maneuver";
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Segment type");
+    }
+}
+
+}  // namespace
+
 Segment::Solution::Solution(
     const String& aName,
     const Array<Shared<Dynamics>>& aDynamicsArray,
@@ -39,7 +71,12 @@ Segment::Solution::Solution(
       dynamics(aDynamicsArray),
       states(aStates),
       conditionIsSatisfied(aConditionIsSatisfied),
-      segmentType(aSegmentType)
+      segmentType(aSegmentType),
+      integrationStatistics(),
+      finalTimeStep(Real::Undefined()),
+      propagatedSPtr_(nullptr),
+      propagatedStates_(Array<State>::Empty()),
+      propagatedDynamics_(Array<Shared<Dynamics>>::Empty())
 {
 }
 
@@ -91,7 +128,7 @@ Duration Segment::Solution::getPropagationDuration() const
 Real Segment::Solution::computeDeltaV(const Real& aSpecificImpulse) const
 {
     // TBM: This is only valid for constant thrust, constant Isp
-    if (this->segmentType != Segment::Type::Maneuver)
+    if (this->segmentType == Segment::Type::Coast)
     {
         return 0.0;
     }
@@ -102,7 +139,7 @@ Real Segment::Solution::computeDeltaV(const Real& aSpecificImpulse) const
 
 Mass Segment::Solution::computeDeltaMass() const
 {
-    if (this->segmentType != Segment::Type::Maneuver)
+    if (this->segmentType == Segment::Type::Coast)
     {
         return Mass::Kilograms(0.0);
     }
@@ -111,15 +148,35 @@ Mass Segment::Solution::computeDeltaMass() const
 }
 
 Array<Maneuver> Segment::Solution::extractManeuvers(const Shared<const Frame>& aFrameSPtr) const
+{
+    Array<ostk::astrodynamics::flight::Maneuver> extractedManeuvers =
+        Array<ostk::astrodynamics::flight::Maneuver>::Empty();
+
+    this->extractManeuvers(
+        aFrameSPtr,
+        [&extractedManeuvers](const ostk::astrodynamics::flight::Maneuver& aManeuver) -> void
+        {
+            extractedManeuvers.add(aManeuver);
+        }
+    );
+
+    return extractedManeuvers;
+}
+
+void Segment::Solution::extractManeuvers(
+    const Shared<const Frame>& aFrameSPtr,
+    const std::function<void(const ostk::astrodynamics::flight::Maneuver&)>& aManeuverCallback
+) const
 {
     if (this->states.isEmpty())
     {
         throw ostk::core::error::RuntimeError("No states exist within Segment Solution.");
     }
 
+    // Impulsive maneuvers have no thruster dynamics to extract a profile from
     if (this->segmentType != Segment::Type::Maneuver)
     {
-        return {};
+        return;
     }
 
     // Loop through dynamics to find Thruster dynamics
@@ -139,81 +196,63 @@ Array<Maneuver> Segment::Solution::extractManeuvers(const Shared<const Frame>& a
         throw ostk::core::error::RuntimeError("No Thruster dynamics found in Maneuvering segment.");
     }
 
-    const Array<Instant> instantArray = this->states.map<Instant>(
-        [](const State& aState) -> Instant
-        {
-            return aState.accessInstant();
-        }
-    );
+    const Array<Shared<const CoordinateSubset>> maneuverCoordinateSubsets = {
+        CartesianVelocity::Default(), CoordinateSubset::Mass()
+    };
 
-    const MatrixXd fullSegmentContributions = this->getDynamicsContribution(
-        thrusterDynamics, aFrameSPtr, {CartesianVelocity::Default(), CoordinateSubset::Mass()}
-    );
+    const StateBuilder builder = StateBuilder(aFrameSPtr, thrusterDynamics->getReadCoordinateSubsets());
+
+    // Contributions are computed state by state, and only the current block of thrusting states is held in memory
 
-    const Size numberOfStates = static_cast<Size>(fullSegmentContributions.rows());
+    Array<Instant> blockInstants = Array<Instant>::Empty();
+    Array<VectorXd> blockContributions = Array<VectorXd>::Empty();
 
-    // Check if there are any breaks in the thrusting (stop and start) and split the dynamics into separate maneuvers
-    Array<Pair<Size, Size>> maneuverBlockStartStopIndices = Array<Pair<Size, Size>>::Empty();
-    Integer maneuverStart = Integer::Undefined();
-    for (Size i = 0; i < numberOfStates; i++)
+    const auto emitBlock = [&]() -> void
     {
-        if (fullSegmentContributions.row(i).norm() != 0.0)  // If thrusting
-        {
-            // If a new block hasn't started yet, mark its start
-            if (!maneuverStart.isDefined())
-            {
-                maneuverStart = i;
-            }
+        MatrixXd blockContributionMatrix(blockContributions.getSize(), blockContributions.accessFirst().size());
 
-            // If end of segment is thrusting, close last block
-            if (i == numberOfStates - 1)
-            {
-                // Store stop index as i + 1 because you don't get a chance to "close this
-                // block" by seeing the thrust go to zero on the next iteration, since the loop ends on this iteration
-                maneuverBlockStartStopIndices.add(Pair<Size, Size>(maneuverStart, i + 1));
-            }
-        }
-        else  // If not thrusting
+        for (Index i = 0; i < blockContributions.getSize(); ++i)
         {
-            // If we have reached the end of a block, save the start and end indices
-            if (maneuverStart.isDefined())
-            {
-                maneuverBlockStartStopIndices.add(Pair<Size, Size>(maneuverStart, i));
-
-                maneuverStart = Integer::Undefined();  // Close the block by marking the start as underfined
-            }
+            blockContributionMatrix.row(i) = blockContributions[i];
         }
-    }
-
-    // If no thrusting has occured during this maneuvering segment (which is possible), return an empty array
-    if (maneuverBlockStartStopIndices.isEmpty())
-    {
-        return {};
-    }
 
-    Array<ostk::astrodynamics::flight::Maneuver> extractedManeuvers =
-        Array<ostk::astrodynamics::flight::Maneuver>::Empty();
-    for (const Pair<Size, Size>& startStopPair : maneuverBlockStartStopIndices)
-    {
-        const Size blockLength = startStopPair.second - startStopPair.first;
-        const Array<Instant> maneuverInstantsBlock =
-            Array<Instant>(instantArray.begin() + startStopPair.first, instantArray.begin() + startStopPair.second);
-        const MatrixXd maneuverContributionBlock =
-            fullSegmentContributions.block(startStopPair.first, 0, blockLength, fullSegmentContributions.cols());
-
-        extractedManeuvers.add(ostk::astrodynamics::flight::Maneuver::TabulatedDynamics(TabulatedDynamics(
-            maneuverInstantsBlock,
-            maneuverContributionBlock,
-            {CartesianVelocity::Default(), CoordinateSubset::Mass()},
+        aManeuverCallback(ostk::astrodynamics::flight::Maneuver::TabulatedDynamics(TabulatedDynamics(
+            blockInstants,
+            blockContributionMatrix,
+            maneuverCoordinateSubsets,
             aFrameSPtr,
             Interpolator::Type::Linear  // Don't actually need to interpolate, because we convert straight to a
                                         // maneuver, but specifying linear interpolation allows us to get away with
                                         // segments that only have two states, as opposed to needing more than two
                                         // states present to use the other higher order interpolators
         )));
+
+        blockInstants.clear();
+        blockContributions.clear();
+    };
+
+    for (const State& state : this->states)
+    {
+        const VectorXd contribution = thrusterDynamics->computeContribution(
+            state.accessInstant(), builder.reduce(state.inFrame(aFrameSPtr)).getCoordinates(), aFrameSPtr
+        );
+
+        if (contribution.norm() != 0.0)  // If thrusting
+        {
+            blockInstants.add(state.accessInstant());
+            blockContributions.add(contribution);
+        }
+        else if (!blockInstants.isEmpty())  // If a block of thrusting states has just ended
+        {
+            emitBlock();
+        }
     }
 
-    return extractedManeuvers;
+    // Close the last block if the segment ends while thrusting
+    if (!blockInstants.isEmpty())
+    {
+        emitBlock();
+    }
 }
 
 Array<State> Segment::Solution::calculateStatesAt(
@@ -246,15 +285,30 @@ Array<State> Segment::Solution::calculateStatesAt(
         }
     }
 
-    const Propagated propagated = {
+    return this->accessPropagated(aNumericalSolver).calculateStatesAt(anInstantArray);
+}
+
+const Propagated& Segment::Solution::accessPropagated(const NumericalSolver& aNumericalSolver) const
+{
+    // States and dynamics are public members, the cached model is rebuilt whenever they no longer match it
+
+    if (propagatedSPtr_ != nullptr)
+    {
+        const NumericalSolver& propagatedNumericalSolver = propagatedSPtr_->accessPropagator().accessNumericalSolver();
+
+        if ((propagatedNumericalSolver == aNumericalSolver) &&
+            (propagatedNumericalSolver.getLongHorizonScheme() == aNumericalSolver.getLongHorizonScheme()) &&
+            (propagatedDynamics_ == this->dynamics) && (propagatedStates_ == this->states))
         {
-            aNumericalSolver,
-            this->dynamics,
-        },
-        this->states,
-    };
+            return *propagatedSPtr_;
+        }
+    }
+
+    propagatedSPtr_ = std::make_shared<const Propagated>(Propagator(aNumericalSolver, this->dynamics), this->states);
+    propagatedStates_ = this->states;
+    propagatedDynamics_ = this->dynamics;
 
-    return propagated.calculateStatesAt(anInstantArray);
+    return *propagatedSPtr_;
 }
 
 MatrixXd Segment::Solution::getDynamicsContribution(
@@ -367,14 +421,14 @@ void Segment::Solution::print(std::ostream& anOutputStream, bool displayDecorato
     ostk::core::utils::Print::Line(anOutputStream)
         << "Condition satisfied:" << (this->conditionIsSatisfied ? "True" : "False");
     ostk::core::utils::Print::Line(anOutputStream)
-        << "Segment type:" << (this->segmentType == Segment::Type::Coast ? "Coast" : "Maneuver");
+        << "Segment type:" << SegmentTypeToString(this->segmentType);
 
     ostk::core::utils::Print::Line(anOutputStream) << "Start instant:" << accessStartInstant().toString();
     ostk::core::utils::Print::Line(anOutputStream) << "End instant:" << accessEndInstant().toString();
     ostk::core::utils::Print::Line(anOutputStream)
         << "Propagation duration:" << (accessEndInstant() - accessStartInstant()).toString();
 
-    if (this->segmentType == Segment::Type::Maneuver)
+    if (this->segmentType != Segment::Type::Coast)
     {
         ostk::core::utils::Print::Line(anOutputStream) << "Initial mass:" << getInitialMass().toString();
         ostk::core::utils::Print::Line(anOutputStream) << "Final mass:" << getFinalMass().toString();
@@ -387,6 +441,27 @@ void Segment::Solution::print(std::ostream& anOutputStream, bool displayDecorato
     }
 }
 
+void Segment::Solution::saveSnapshot(const File& aFile) const
+{
+    Sequence::Solution({*this}, true).saveSnapshot(aFile);
+}
+
+Segment::Solution Segment::Solution::LoadSnapshot(const File& aFile, const Array<Shared<Dynamics>>& aDynamicsArray)
+{
+    const Sequence::Solution sequenceSolution = Sequence::Solution::LoadSnapshot(aFile, aDynamicsArray);
+
+    if (sequenceSolution.segmentSolutions.getSize() != 1)
+    {
+        throw ostk::core::error::RuntimeError(
+            "Snapshot [{}] holds [{}] segment solutions, expected 1.",
+            aFile.toString(),
+            sequenceSolution.segmentSolutions.getSize()
+        );
+    }
+
+    return sequenceSolution.segmentSolutions.accessFirst();
+}
+
 std::ostream& operator<<(std::ostream& anOutputStream, const Segment::Solution& aSolution)
 {
     aSolution.print(anOutputStream);
@@ -394,18 +469,220 @@ std::ostream& operator<<(std::ostream& anOutputStream, const Segment::Solution&
     return anOutputStream;
 }
 
+Segment::StateRetention::StateRetention(const Type& aType, const Size& aStepCount, const Duration& aSpacing)
+    : type_(aType),
+      stepCount_(aStepCount),
+      spacing_(aSpacing)
+{
+}
+
+bool Segment::StateRetention::operator==(const StateRetention& aStateRetention) const
+{
+    if (type_ != aStateRetention.type_)
+    {
+        return false;
+    }
+
+    switch (type_)
+    {
+        case Type::EveryNthStep:
+            return stepCount_ == aStateRetention.stepCount_;
+
+        case Type::FixedSpacing:
+            return spacing_ == aStateRetention.spacing_;
+
+        default:
+            return true;
+    }
+}
+
+bool Segment::StateRetention::operator!=(const StateRetention& aStateRetention) const
+{
+    return !((*this) == aStateRetention);
+}
+
+Segment::StateRetention::Type Segment::StateRetention::getType() const
+{
+    return type_;
+}
+
+Size Segment::StateRetention::getStepCount() const
+{
+    return stepCount_;
+}
+
+Duration Segment::StateRetention::getSpacing() const
+{
+    return spacing_;
+}
+
+Array<State> Segment::StateRetention::apply(const Array<State>& aStateArray) const
+{
+    if (type_ == Type::All)
+    {
+        return aStateArray;
+    }
+
+    const Array<Index> retainedIndices = this->getRetainedIndices(
+        aStateArray.getSize(),
+        [&aStateArray](const Index& anIndex) -> const Instant&
+        {
+            return aStateArray[anIndex].accessInstant();
+        }
+    );
+
+    Array<State> retainedStates = Array<State>::Empty();
+    retainedStates.reserve(retainedIndices.getSize());
+
+    for (const Index& index : retainedIndices)
+    {
+        retainedStates.add(aStateArray[index]);
+    }
+
+    return retainedStates;
+}
+
+Array<State> Segment::StateRetention::apply(const StateHistory& aStateHistory) const
+{
+    const Array<Index> retainedIndices = this->getRetainedIndices(
+        aStateHistory.getSize(),
+        [&aStateHistory](const Index& anIndex) -> const Instant&
+        {
+            return aStateHistory.accessInstantAt(anIndex);
+        }
+    );
+
+    Array<State> retainedStates = Array<State>::Empty();
+    retainedStates.reserve(retainedIndices.getSize());
+
+    for (const Index& index : retainedIndices)
+    {
+        retainedStates.add(aStateHistory.getStateAt(index));
+    }
+
+    return retainedStates;
+}
+
+Array<Index> Segment::StateRetention::getRetainedIndices(
+    const Size& aStateCount, const std::function<const Instant&(const Index&)>& anInstantAccessor
+) const
+{
+    Array<Index> retainedIndices = Array<Index>::Empty();
+
+    if ((type_ == Type::All) || (aStateCount <= 2))
+    {
+        retainedIndices.reserve(aStateCount);
+
+        for (Index i = 0; i < aStateCount; ++i)
+        {
+            retainedIndices.add(i);
+        }
+
+        return retainedIndices;
+    }
+
+    const Index lastIndex = aStateCount - 1;
+
+    switch (type_)
+    {
+        case Type::Endpoints:
+        {
+            retainedIndices.add(0);
+
+            break;
+        }
+
+        case Type::EveryNthStep:
+        {
+            retainedIndices.reserve(lastIndex / stepCount_ + 2);
+
+            for (Index i = 0; i < lastIndex; i += stepCount_)
+            {
+                retainedIndices.add(i);
+            }
+
+            break;
+        }
+
+        case Type::FixedSpacing:
+        {
+            retainedIndices.add(0);
+
+            for (Index i = 1; i < lastIndex; ++i)
+            {
+                if ((anInstantAccessor(i) - anInstantAccessor(retainedIndices.accessLast())) >= spacing_)
+                {
+                    retainedIndices.add(i);
+                }
+            }
+
+            break;
+        }
+
+        default:
+            throw ostk::core::error::runtime::Wrong("State retention type");
+    }
+
+    retainedIndices.add(lastIndex);
+
+    return retainedIndices;
+}
+
+Segment::StateRetention Segment::StateRetention::All()
+{
+    return {Type::All, 1, Duration::Undefined()};
+}
+
+Segment::StateRetention Segment::StateRetention::Endpoints()
+{
+    return {Type::Endpoints, 0, Duration::Undefined()};
+}
+
+Segment::StateRetention Segment::StateRetention::EveryNthStep(const Size& aStepCount)
+{
+    if (aStepCount == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Step count");
+    }
+
+    return {Type::EveryNthStep, aStepCount, Duration::Undefined()};
+}
+
+Segment::StateRetention Segment::StateRetention::FixedSpacing(const Duration& aSpacing)
+{
+    if (!aSpacing.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Spacing");
+    }
+
+    if (!aSpacing.isStrictlyPositive())
+    {
+        throw ostk::core::error::runtime::Wrong("Spacing");
+    }
+
+    return {Type::FixedSpacing, 0, aSpacing};
+}
+
 Segment::Segment(
     const String& aName,
     const Segment::Type& aType,
     const Shared<EventCondition>& anEventConditionSPtr,
     const Array<Shared<Dynamics>>& aDynamicsArray,
-    const NumericalSolver& aNumericalSolver
+    const NumericalSolver& aNumericalSolver,
+    const StateRetention& aStateRetention,
+    const Vector3d& aDeltaV,
+    const Shared<const LocalOrbitalFrameFactory>& aLocalOrbitalFrameFactorySPtr,
+    const Real& aSpecificImpulse
 )
     : name_(aName),
       type_(aType),
       eventCondition_(anEventConditionSPtr),
       dynamics_(aDynamicsArray),
-      numericalSolver_(aNumericalSolver)
+      numericalSolver_(aNumericalSolver),
+      stateRetention_(aStateRetention),
+      deltaV_(aDeltaV),
+      localOrbitalFrameFactorySPtr_(aLocalOrbitalFrameFactorySPtr),
+      specificImpulse_(aSpecificImpulse)
 {
     if (eventCondition_ == nullptr)
     {
@@ -421,6 +698,29 @@ Segment::Segment(
     {
         throw ostk::core::error::runtime::Undefined("Numerical solver");
     }
+
+    if (type_ == Segment::Type::ImpulsiveManeuver)
+    {
+        if (!deltaV_.allFinite())
+        {
+            throw ostk::core::error::runtime::Undefined("Delta V");
+        }
+
+        if ((localOrbitalFrameFactorySPtr_ == nullptr) || (!localOrbitalFrameFactorySPtr_->isDefined()))
+        {
+            throw ostk::core::error::runtime::Undefined("Local orbital frame factory");
+        }
+
+        if (!specificImpulse_.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Specific impulse");
+        }
+
+        if (specificImpulse_ <= 0.0)
+        {
+            throw ostk::core::error::runtime::Wrong("Specific impulse");
+        }
+    }
 }
 
 std::ostream& operator<<(std::ostream& anOutputStream, const Segment& aSegment)
@@ -470,10 +770,54 @@ const NumericalSolver& Segment::accessNumericalSolver() const
     return numericalSolver_;
 }
 
-Segment::Solution Segment::solve(const State& aState, const Duration& maximumPropagationDuration) const
+Segment::StateRetention Segment::getStateRetention() const
+{
+    return stateRetention_;
+}
+
+Vector3d Segment::getDeltaV() const
 {
+    return deltaV_;
+}
+
+Shared<const LocalOrbitalFrameFactory> Segment::getLocalOrbitalFrameFactory() const
+{
+    return localOrbitalFrameFactorySPtr_;
+}
+
+Real Segment::getSpecificImpulse() const
+{
+    return specificImpulse_;
+}
+
+Segment::Solution Segment::solve(
+    const State& aState,
+    const Duration& maximumPropagationDuration,
+    const Shared<const std::atomic<bool>>& aCancellationFlagSPtr,
+    const Real& anInitialTimeStep
+) const
+{
+    const Tracer::Span span("Segment::solve", "trajectory", name_);
+
+    if (type_ == Segment::Type::ImpulsiveManeuver)
+    {
+        return this->solveImpulse(aState);
+    }
+
+    NumericalSolver numericalSolver = numericalSolver_;
+    numericalSolver.setCancellationFlag(aCancellationFlagSPtr);
+    numericalSolver.setInitialTimeStep(anInitialTimeStep);
+
+    // The segment integration is measured on its own, then recorded in the statistics of the segment solver
+
+    if (numericalSolver_.isStatisticsEnabled())
+    {
+        numericalSolver.disableStatistics();
+        numericalSolver.enableStatistics();
+    }
+
     const Propagator propagator = {
-        numericalSolver_,
+        numericalSolver,
         dynamics_,
     };
 
@@ -481,13 +825,38 @@ Segment::Solution Segment::solve(const State& aState, const Duration& maximumPro
         aState, aState.accessInstant() + maximumPropagationDuration, *eventCondition_
     );
 
-    return {
+    Segment::Solution solution = {
         name_,
         dynamics_,
-        propagator.accessNumericalSolver().accessObservedStates(),
+        stateRetention_.apply(propagator.accessNumericalSolver().accessObservedStateHistory()),
         conditionSolution.conditionIsSatisfied,
         type_,
     };
+
+    solution.finalTimeStep = propagator.accessNumericalSolver().getFinalTimeStep();
+
+    if (numericalSolver.isStatisticsEnabled())
+    {
+        solution.integrationStatistics = numericalSolver.getStatistics();
+        numericalSolver_.recordStatistics(solution.integrationStatistics);
+    }
+
+    return solution;
+}
+
+Segment Segment::clone() const
+{
+    return {
+        name_,
+        type_,
+        eventCondition_->clone(),
+        dynamics_,
+        numericalSolver_,
+        stateRetention_,
+        deltaV_,
+        localOrbitalFrameFactorySPtr_,
+        specificImpulse_,
+    };
 }
 
 void Segment::print(std::ostream& anOutputStream, bool displayDecorator) const
@@ -498,7 +867,14 @@ void Segment::print(std::ostream& anOutputStream, bool displayDecorator) const
     }
 
     ostk::core::utils::Print::Line(anOutputStream) << "Name:" << name_;
-    ostk::core::utils::Print::Line(anOutputStream) << "Type:" << (type_ == Segment::Type::Coast ? "Coast" : "Maneuver");
+    ostk::core::utils::Print::Line(anOutputStream) << "Type:" << SegmentTypeToString(type_);
+
+    if (type_ == Segment::Type::ImpulsiveManeuver)
+    {
+        ostk::core::utils::Print::Line(anOutputStream) << "Delta V:" << deltaV_.toString() << "[m/s]";
+        ostk::core::utils::Print::Line(anOutputStream) << "Specific impulse:" << specificImpulse_.toString() << "[s]";
+    }
+
     ostk::core::utils::Print::Separator(anOutputStream, "Event Condition");
     eventCondition_->print(anOutputStream, false);
     ostk::core::utils::Print::Line(anOutputStream);
@@ -523,7 +899,8 @@ Segment Segment::Coast(
     const String& aName,
     const Shared<EventCondition>& anEventConditionSPtr,
     const Array<Shared<Dynamics>>& aDynamicsArray,
-    const NumericalSolver& aNumericalSolver
+    const NumericalSolver& aNumericalSolver,
+    const StateRetention& aStateRetention
 )
 {
     return {
@@ -532,6 +909,7 @@ Segment Segment::Coast(
         anEventConditionSPtr,
         aDynamicsArray,
         aNumericalSolver,
+        aStateRetention,
     };
 }
 
@@ -540,7 +918,8 @@ Segment Segment::Maneuver(
     const Shared<EventCondition>& anEventConditionSPtr,
     const Shared<Thruster>& aThrusterDynamics,
     const Array<Shared<Dynamics>>& aDynamicsArray,
-    const NumericalSolver& aNumericalSolver
+    const NumericalSolver& aNumericalSolver,
+    const StateRetention& aStateRetention
 )
 {
     return {
@@ -549,6 +928,85 @@ Segment Segment::Maneuver(
         anEventConditionSPtr,
         aDynamicsArray + Array<Shared<Dynamics>> {aThrusterDynamics},
         aNumericalSolver,
+        aStateRetention,
+    };
+}
+
+Segment Segment::ImpulsiveManeuver(
+    const String& aName,
+    const Vector3d& aDeltaV,
+    const Shared<const LocalOrbitalFrameFactory>& aLocalOrbitalFrameFactorySPtr,
+    const Real& aSpecificImpulse,
+    const Array<Shared<Dynamics>>& aDynamicsArray,
+    const NumericalSolver& aNumericalSolver
+)
+{
+    // The burn takes no time, hence it ends as soon as it starts
+    const Shared<EventCondition> eventConditionSPtr = std::make_shared<RealCondition>(
+        RealCondition::DurationCondition(RealCondition::Criterion::AnyCrossing, Duration::Zero())
+    );
+
+    return {
+        aName,
+        Segment::Type::ImpulsiveManeuver,
+        eventConditionSPtr,
+        aDynamicsArray,
+        aNumericalSolver,
+        StateRetention::All(),
+        aDeltaV,
+        aLocalOrbitalFrameFactorySPtr,
+        aSpecificImpulse,
+    };
+}
+
+Segment::Solution Segment::solveImpulse(const State& aState) const
+{
+    const Shared<const CoordinateBroker>& coordinateBrokerSPtr = aState.accessCoordinateBroker();
+
+    if (!aState.hasSubset(CoordinateSubset::Mass()))
+    {
+        throw ostk::core::error::runtime::Undefined("Mass");
+    }
+
+    const Instant& instant = aState.accessInstant();
+    const Shared<const Frame> stateFrameSPtr = aState.accessFrame();
+    const Shared<const Frame>& parentFrameSPtr = localOrbitalFrameFactorySPtr_->accessParentFrame();
+
+    const State stateInParentFrame = aState.inFrame(parentFrameSPtr);
+
+    const Quaternion q_parentFrame_LOF = localOrbitalFrameFactorySPtr_
+                                             ->generateTransform(
+                                                 instant,
+                                                 stateInParentFrame.accessPositionCoordinates(),
+                                                 stateInParentFrame.accessVelocityCoordinates()
+                                             )
+                                             .getOrientation()
+                                             .toConjugate()
+                                             .toNormalized();
+
+    // A velocity increment is a free vector, hence only rotated between frames
+
+    const Vector3d deltaV_parentFrame = q_parentFrame_LOF.rotateVector(deltaV_);
+    const Vector3d deltaV_stateFrame =
+        ((parentFrameSPtr == stateFrameSPtr) || (*parentFrameSPtr == *stateFrameSPtr))
+            ? deltaV_parentFrame
+            : Vector3d(parentFrameSPtr->getTransformTo(stateFrameSPtr, instant).applyToVector(deltaV_parentFrame));
+
+    const Index velocityIndex = coordinateBrokerSPtr->getSubsetIndex(CartesianVelocity::Default());
+    const Index massIndex = coordinateBrokerSPtr->getSubsetIndex(CoordinateSubset::Mass());
+
+    VectorXd coordinates = aState.getCoordinates();
+
+    coordinates.segment<3>(velocityIndex) += deltaV_stateFrame;
+    coordinates(massIndex) *=
+        std::exp(-deltaV_.norm() / (specificImpulse_ * EarthGravitationalModel::gravityConstant));
+
+    return {
+        name_,
+        dynamics_,
+        {aState, State(instant, coordinates, stateFrameSPtr, coordinateBrokerSPtr)},
+        true,
+        type_,
     };
 }
 
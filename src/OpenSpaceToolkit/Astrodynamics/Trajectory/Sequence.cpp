@@ -1,12 +1,36 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <future>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
 #include <boost/log/core.hpp>
 #include <boost/log/expressions.hpp>
 #include <boost/log/trivial.hpp>
 
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 
+#include <OpenSpaceToolkit/Astrodynamics/Tracer.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Sequence.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateBroker.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/AngularVelocity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/AttitudeQuaternion.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianPosition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianVelocity.hpp>
 
 namespace ostk
 {
@@ -17,6 +41,177 @@ namespace trajectory
 
 using ostk::physics::time::Duration;
 
+namespace
+{
+
+using ostk::core::type::String;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Scale;
+
+using ostk::astrodynamics::trajectory::state::CoordinateBroker;
+using ostk::astrodynamics::trajectory::state::CoordinateSubset;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::AngularVelocity;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::AttitudeQuaternion;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianPosition;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianVelocity;
+
+// Solution snapshot layout:
+// - header
+// - frame names, then coordinate subset layouts (name and size of each subset), shared by all states
+// - segment solutions: name, type, condition flag, dynamics names, then states (frame index, layout index, instant
+//   offset from the header epoch [ns], coordinates)
+
+static const char SolutionSnapshotMagic[8] = {'O', 'S', 'T', 'K', 'S', 'O', 'L', '\0'};
+static const std::uint32_t SolutionSnapshotVersion = 1;
+static const std::uint32_t SolutionSnapshotByteOrderMark = 0x01020304;
+
+struct SolutionSnapshotHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byteOrderMark;
+    std::uint64_t segmentCount;
+    std::uint64_t executionIsComplete;
+    char epoch[64];  // UTC
+};
+
+class SnapshotWriter
+{
+   public:
+    template <typename T>
+    void write(const T& aValue)
+    {
+        buffer_.append(reinterpret_cast<const char*>(&aValue), sizeof(T));
+    }
+
+    void write(const String& aString)
+    {
+        this->write<std::uint64_t>(aString.size());
+        buffer_.append(aString);
+    }
+
+    void write(const double* aValueArray, const std::size_t& aValueCount)
+    {
+        buffer_.append(reinterpret_cast<const char*>(aValueArray), aValueCount * sizeof(double));
+    }
+
+    const std::string& accessBuffer() const
+    {
+        return buffer_;
+    }
+
+   private:
+    std::string buffer_;
+};
+
+class SnapshotReader
+{
+   public:
+    SnapshotReader(const std::string& aBuffer, const std::size_t& anOffset)
+        : buffer_(aBuffer),
+          offset_(anOffset)
+    {
+    }
+
+    template <typename T>
+    T read()
+    {
+        T value;
+        std::memcpy(&value, this->access(sizeof(T)), sizeof(T));
+
+        return value;
+    }
+
+    String readString()
+    {
+        const std::uint64_t size = this->read<std::uint64_t>();
+
+        return std::string(this->access(size), size);
+    }
+
+    void read(double* aValueArray, const std::size_t& aValueCount)
+    {
+        std::memcpy(aValueArray, this->access(aValueCount * sizeof(double)), aValueCount * sizeof(double));
+    }
+
+    bool isExhausted() const
+    {
+        return offset_ == buffer_.size();
+    }
+
+   private:
+    const std::string& buffer_;
+    std::size_t offset_;
+
+    const char* access(const std::size_t& aSize)
+    {
+        if (aSize > (buffer_.size() - offset_))
+        {
+            throw ostk::core::error::RuntimeError("Solution snapshot is truncated.");
+        }
+
+        const char* data = buffer_.data() + offset_;
+
+        offset_ += aSize;
+
+        return data;
+    }
+};
+
+Shared<const Frame> FrameWithName(const String& aFrameName)
+{
+    if (aFrameName == "GCRF")
+    {
+        return Frame::GCRF();
+    }
+
+    if (aFrameName == "ITRF")
+    {
+        return Frame::ITRF();
+    }
+
+    if (aFrameName == "TEME")
+    {
+        return Frame::TEME();
+    }
+
+    if (Frame::Exists(aFrameName))
+    {
+        return Frame::WithName(aFrameName);
+    }
+
+    throw ostk::core::error::RuntimeError("Frame [{}] does not exist.", aFrameName);
+}
+
+// Built-in subsets carry behavior (frame conversions, addition), others are restored as plain subsets
+
+Shared<const CoordinateSubset> CoordinateSubsetWithName(const String& aName, const Size& aSize)
+{
+    static const Array<Shared<const CoordinateSubset>> builtInCoordinateSubsets = {
+        CartesianPosition::Default(),
+        CartesianVelocity::Default(),
+        AttitudeQuaternion::Default(),
+        AngularVelocity::Default(),
+        CoordinateSubset::Mass(),
+        CoordinateSubset::SurfaceArea(),
+        CoordinateSubset::DragCoefficient(),
+    };
+
+    for (const Shared<const CoordinateSubset>& coordinateSubsetSPtr : builtInCoordinateSubsets)
+    {
+        if ((coordinateSubsetSPtr->getName() == aName) && (coordinateSubsetSPtr->getSize() == aSize))
+        {
+            return coordinateSubsetSPtr;
+        }
+    }
+
+    return std::make_shared<CoordinateSubset>(aName, aSize);
+}
+
+}  // namespace
+
 Sequence::Solution::Solution(const Array<Segment::Solution>& aSegmentSolutionArray, const bool& anExecutionIsComplete)
     : segmentSolutions(aSegmentSolutionArray),
       executionIsComplete(anExecutionIsComplete)
@@ -40,14 +235,23 @@ Array<State> Sequence::Solution::getStates() const
         throw ostk::core::error::RuntimeError("Segment solutions are empty.");
     }
 
-    Array<State> states = this->segmentSolutions.accessFirst().states;
+    Size stateCount = 0;
+
+    for (const Segment::Solution& segmentSolution : this->segmentSolutions)
+    {
+        stateCount += segmentSolution.states.getSize();
+    }
+
+    Array<State> states = Array<State>::Empty();
+    states.reserve(stateCount);
+
+    states.add(this->segmentSolutions.accessFirst().states);
 
     for (Index i = 1; i < this->segmentSolutions.getSize(); ++i)
     {
-        const Array<State>& segmentStates =
-            Array<State>(this->segmentSolutions[i].states.begin() + 1, this->segmentSolutions[i].states.end());
+        const Array<State>& segmentStates = this->segmentSolutions[i].states;
 
-        states.add(segmentStates);
+        states.insert(states.end(), segmentStates.begin() + 1, segmentStates.end());
     }
 
     return states;
@@ -88,36 +292,71 @@ Mass Sequence::Solution::computeDeltaMass() const
 Array<State> Sequence::Solution::calculateStatesAt(
     const Array<Instant>& anInstantArray, const NumericalSolver& aNumericalSolver
 ) const
+{
+    return this->calculateStatesAt(anInstantArray, aNumericalSolver, ExecutionContext(1));
+}
+
+Array<State> Sequence::Solution::calculateStatesAt(
+    const Array<Instant>& anInstantArray,
+    const NumericalSolver& aNumericalSolver,
+    const ExecutionContext& anExecutionContext
+) const
 {
     if (this->segmentSolutions.isEmpty())
     {
         throw ostk::core::error::RuntimeError("Segment solutions are empty.");
     }
 
-    Array<State> intermediateStates = Array<State>::Empty();
-
-    // Process the instant array so that it is done segment by segment
-    for (Size i = 0; i < this->segmentSolutions.getSize(); i++)
+    for (Size k = 1; k < anInstantArray.getSize(); ++k)
     {
-        const Segment::Solution& segmentSolution = this->segmentSolutions.at(i);
-        // Filter instants to be within segment bounds
-        Array<Instant> segmentInstants = Array<Instant>::Empty();
+        if (anInstantArray[k - 1] > anInstantArray[k])
+        {
+            throw ostk::core::error::runtime::Wrong("Unsorted Instant Array");
+        }
+    }
+
+    const Size segmentCount = this->segmentSolutions.getSize();
+
+    // Each segment takes the instants within [start, end), the last one also taking the end instant of the sequence
 
-        for (const Instant& instant : anInstantArray)
+    const Array<Array<State>> segmentStates = anExecutionContext.map<Array<State>>(
+        segmentCount,
+        [this, &anInstantArray, &aNumericalSolver, segmentCount](const Index& aSegmentIndex) -> Array<State>
         {
-            if ((instant >= segmentSolution.accessStartInstant()) && (instant < segmentSolution.accessEndInstant()))
-            {
-                segmentInstants.add(instant);
-            }
-            else if ((i == this->segmentSolutions.getSize() - 1) && (instant == this->accessEndInstant()))
-            {
-                segmentInstants.add(instant);
-            }
+            const Segment::Solution& segmentSolution = this->segmentSolutions.at(aSegmentIndex);
+
+            const auto beginIt =
+                std::lower_bound(anInstantArray.begin(), anInstantArray.end(), segmentSolution.accessStartInstant());
+            const auto endIt = std::max(
+                beginIt,
+                (aSegmentIndex == segmentCount - 1)
+                    ? std::upper_bound(anInstantArray.begin(), anInstantArray.end(), this->accessEndInstant())
+                    : std::lower_bound(anInstantArray.begin(), anInstantArray.end(), segmentSolution.accessEndInstant())
+            );
+
+            Array<Instant> segmentInstants = Array<Instant>::Empty();
+            segmentInstants.insert(segmentInstants.end(), beginIt, endIt);
+
+            return segmentSolution.calculateStatesAt(segmentInstants, aNumericalSolver);
         }
-        intermediateStates.add(segmentSolution.calculateStatesAt(segmentInstants, aNumericalSolver));
+    );
+
+    Size stateCount = 0;
+
+    for (const Array<State>& segmentStateArray : segmentStates)
+    {
+        stateCount += segmentStateArray.getSize();
+    }
+
+    Array<State> states = Array<State>::Empty();
+    states.reserve(stateCount);
+
+    for (const Array<State>& segmentStateArray : segmentStates)
+    {
+        states.insert(states.end(), segmentStateArray.begin(), segmentStateArray.end());
     }
 
-    return intermediateStates;
+    return states;
 }
 
 void Sequence::Solution::print(std::ostream& anOutputStream, bool displayDecorator) const
@@ -137,7 +376,7 @@ void Sequence::Solution::print(std::ostream& anOutputStream, bool displayDecorat
     {
         segmentSolution.print(anOutputStream, false);
 
-        if (segmentSolution.segmentType == Segment::Type::Maneuver)
+        if (segmentSolution.segmentType != Segment::Type::Coast)
         {
             hasManeuver = true;
         }
@@ -164,6 +403,289 @@ void Sequence::Solution::print(std::ostream& anOutputStream, bool displayDecorat
     }
 }
 
+void Sequence::Solution::saveSnapshot(const File& aFile) const
+{
+    if (!aFile.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("File");
+    }
+
+    Instant epoch = Instant::J2000();
+
+    for (const Segment::Solution& segmentSolution : this->segmentSolutions)
+    {
+        if (!segmentSolution.states.isEmpty())
+        {
+            epoch = segmentSolution.states.accessFirst().accessInstant();
+            break;
+        }
+    }
+
+    // Frames and coordinate subset layouts are stored once, and referred to by index
+
+    Array<String> frameNames = Array<String>::Empty();
+    std::unordered_map<const Frame*, std::uint32_t> frameIndices;
+
+    Array<Array<Shared<const CoordinateSubset>>> layouts = Array<Array<Shared<const CoordinateSubset>>>::Empty();
+    std::unordered_map<const CoordinateBroker*, std::uint32_t> layoutIndices;
+
+    SnapshotWriter bodyWriter;
+
+    for (const Segment::Solution& segmentSolution : this->segmentSolutions)
+    {
+        bodyWriter.write(segmentSolution.name);
+        bodyWriter.write<std::uint32_t>(static_cast<std::uint32_t>(segmentSolution.segmentType));
+        bodyWriter.write<std::uint32_t>(segmentSolution.conditionIsSatisfied ? 1 : 0);
+
+        bodyWriter.write<std::uint64_t>(segmentSolution.dynamics.getSize());
+
+        for (const Shared<Dynamics>& dynamicsSPtr : segmentSolution.dynamics)
+        {
+            bodyWriter.write(dynamicsSPtr->getName());
+        }
+
+        bodyWriter.write<std::uint64_t>(segmentSolution.states.getSize());
+
+        for (const State& state : segmentSolution.states)
+        {
+            if (!state.isDefined())
+            {
+                throw ostk::core::error::runtime::Undefined("State");
+            }
+
+            const Frame* framePtr = state.accessFrame().get();
+
+            auto frameIndexIt = frameIndices.find(framePtr);
+
+            if (frameIndexIt == frameIndices.end())
+            {
+                frameIndexIt = frameIndices.emplace(framePtr, frameNames.getSize()).first;
+                frameNames.add(framePtr->getName());
+            }
+
+            const CoordinateBroker* brokerPtr = state.accessCoordinateBroker().get();
+
+            auto layoutIndexIt = layoutIndices.find(brokerPtr);
+
+            if (layoutIndexIt == layoutIndices.end())
+            {
+                layoutIndexIt = layoutIndices.emplace(brokerPtr, layouts.getSize()).first;
+                layouts.add(brokerPtr->getSubsets());
+            }
+
+            bodyWriter.write<std::uint32_t>(frameIndexIt->second);
+            bodyWriter.write<std::uint32_t>(layoutIndexIt->second);
+            bodyWriter.write<std::int64_t>(static_cast<std::int64_t>(
+                std::llround(double(Duration::Between(epoch, state.accessInstant()).inNanoseconds()))
+            ));
+            bodyWriter.write(state.accessCoordinates().data(), state.accessCoordinates().size());
+        }
+    }
+
+    SnapshotWriter tableWriter;
+
+    tableWriter.write<std::uint64_t>(frameNames.getSize());
+
+    for (const String& frameName : frameNames)
+    {
+        tableWriter.write(frameName);
+    }
+
+    tableWriter.write<std::uint64_t>(layouts.getSize());
+
+    for (const Array<Shared<const CoordinateSubset>>& layout : layouts)
+    {
+        tableWriter.write<std::uint64_t>(layout.getSize());
+
+        for (const Shared<const CoordinateSubset>& coordinateSubsetSPtr : layout)
+        {
+            tableWriter.write(coordinateSubsetSPtr->getName());
+            tableWriter.write<std::uint64_t>(coordinateSubsetSPtr->getSize());
+        }
+    }
+
+    SolutionSnapshotHeader header = {};
+
+    const String epochString = epoch.getDateTime(Scale::UTC).toString();
+
+    std::memcpy(header.magic, SolutionSnapshotMagic, sizeof(SolutionSnapshotMagic));
+    header.version = SolutionSnapshotVersion;
+    header.byteOrderMark = SolutionSnapshotByteOrderMark;
+    header.segmentCount = this->segmentSolutions.getSize();
+    header.executionIsComplete = this->executionIsComplete ? 1 : 0;
+    std::memcpy(header.epoch, epochString.data(), std::min(epochString.size(), sizeof(header.epoch) - 1));
+
+    std::ofstream fileStream(aFile.getPath().toString(), std::ios::binary | std::ios::trunc);
+
+    if (!fileStream.is_open())
+    {
+        throw ostk::core::error::RuntimeError("Cannot open file [{}].", aFile.toString());
+    }
+
+    fileStream.write(reinterpret_cast<const char*>(&header), sizeof(SolutionSnapshotHeader));
+    fileStream.write(
+        tableWriter.accessBuffer().data(), static_cast<std::streamsize>(tableWriter.accessBuffer().size())
+    );
+    fileStream.write(bodyWriter.accessBuffer().data(), static_cast<std::streamsize>(bodyWriter.accessBuffer().size()));
+
+    if (!fileStream.good())
+    {
+        throw ostk::core::error::RuntimeError("Cannot write file [{}].", aFile.toString());
+    }
+}
+
+Sequence::Solution Sequence::Solution::LoadSnapshot(const File& aFile, const Array<Shared<Dynamics>>& aDynamicsArray)
+{
+    if (!aFile.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("File");
+    }
+
+    if (!aFile.exists())
+    {
+        throw ostk::core::error::RuntimeError("File [{}] does not exist.", aFile.toString());
+    }
+
+    std::ifstream fileStream(aFile.getPath().toString(), std::ios::binary);
+
+    if (!fileStream.is_open())
+    {
+        throw ostk::core::error::RuntimeError("Cannot open file [{}].", aFile.toString());
+    }
+
+    const std::string buffer((std::istreambuf_iterator<char>(fileStream)), std::istreambuf_iterator<char>());
+
+    SolutionSnapshotHeader header;
+
+    if ((buffer.size() < sizeof(SolutionSnapshotHeader)) ||
+        (std::memcmp(buffer.data(), SolutionSnapshotMagic, sizeof(SolutionSnapshotMagic)) != 0))
+    {
+        throw ostk::core::error::RuntimeError("File [{}] is not a solution snapshot.", aFile.toString());
+    }
+
+    std::memcpy(&header, buffer.data(), sizeof(SolutionSnapshotHeader));
+
+    if (header.version != SolutionSnapshotVersion)
+    {
+        throw ostk::core::error::RuntimeError(
+            "Solution snapshot version [{}] is not supported (expected [{}]).", header.version, SolutionSnapshotVersion
+        );
+    }
+
+    if (header.byteOrderMark != SolutionSnapshotByteOrderMark)
+    {
+        throw ostk::core::error::RuntimeError("Solution snapshot byte order is not supported.");
+    }
+
+    header.epoch[sizeof(header.epoch) - 1] = '\0';
+
+    const Instant epoch = Instant::DateTime(DateTime::Parse(String(header.epoch)), Scale::UTC);
+
+    SnapshotReader reader = {buffer, sizeof(SolutionSnapshotHeader)};
+
+    Array<Shared<const Frame>> frames = Array<Shared<const Frame>>::Empty();
+
+    for (std::uint64_t frameIndex = 0, frameCount = reader.read<std::uint64_t>(); frameIndex < frameCount;
+         ++frameIndex)
+    {
+        frames.add(FrameWithName(reader.readString()));
+    }
+
+    Array<Shared<const CoordinateBroker>> coordinateBrokers = Array<Shared<const CoordinateBroker>>::Empty();
+
+    for (std::uint64_t layoutIndex = 0, layoutCount = reader.read<std::uint64_t>(); layoutIndex < layoutCount;
+         ++layoutIndex)
+    {
+        Array<Shared<const CoordinateSubset>> coordinateSubsets = Array<Shared<const CoordinateSubset>>::Empty();
+
+        for (std::uint64_t subsetIndex = 0, subsetCount = reader.read<std::uint64_t>(); subsetIndex < subsetCount;
+             ++subsetIndex)
+        {
+            const String name = reader.readString();
+            const Size size = reader.read<std::uint64_t>();
+
+            coordinateSubsets.add(CoordinateSubsetWithName(name, size));
+        }
+
+        coordinateBrokers.add(std::make_shared<CoordinateBroker>(coordinateSubsets));
+    }
+
+    const auto findDynamics = [&aDynamicsArray](const String& aName) -> Shared<Dynamics>
+    {
+        for (const Shared<Dynamics>& dynamicsSPtr : aDynamicsArray)
+        {
+            if (dynamicsSPtr->getName() == aName)
+            {
+                return dynamicsSPtr;
+            }
+        }
+
+        throw ostk::core::error::RuntimeError("Dynamics [{}] not found.", aName);
+    };
+
+    Array<Segment::Solution> segmentSolutions = Array<Segment::Solution>::Empty();
+    segmentSolutions.reserve(header.segmentCount);
+
+    for (std::uint64_t segmentIndex = 0; segmentIndex < header.segmentCount; ++segmentIndex)
+    {
+        const String name = reader.readString();
+        const Segment::Type segmentType = static_cast<Segment::Type>(reader.read<std::uint32_t>());
+        const bool conditionIsSatisfied = reader.read<std::uint32_t>() != 0;
+
+        Array<Shared<Dynamics>> dynamics = Array<Shared<Dynamics>>::Empty();
+
+        for (std::uint64_t dynamicsIndex = 0, dynamicsCount = reader.read<std::uint64_t>();
+             dynamicsIndex < dynamicsCount;
+             ++dynamicsIndex)
+        {
+            const String dynamicsName = reader.readString();
+
+            if (!aDynamicsArray.isEmpty())
+            {
+                dynamics.add(findDynamics(dynamicsName));
+            }
+        }
+
+        const std::uint64_t stateCount = reader.read<std::uint64_t>();
+
+        Array<State> states = Array<State>::Empty();
+        states.reserve(stateCount);
+
+        for (std::uint64_t stateIndex = 0; stateIndex < stateCount; ++stateIndex)
+        {
+            const std::uint32_t frameIndex = reader.read<std::uint32_t>();
+            const std::uint32_t layoutIndex = reader.read<std::uint32_t>();
+            const std::int64_t offset = reader.read<std::int64_t>();
+
+            if ((frameIndex >= frames.getSize()) || (layoutIndex >= coordinateBrokers.getSize()))
+            {
+                throw ostk::core::error::RuntimeError("Solution snapshot [{}] is corrupted.", aFile.toString());
+            }
+
+            const Shared<const CoordinateBroker>& coordinateBrokerSPtr = coordinateBrokers[layoutIndex];
+
+            VectorXd coordinates(coordinateBrokerSPtr->getNumberOfCoordinates());
+            reader.read(coordinates.data(), coordinates.size());
+
+            states.add(State(
+                epoch + Duration::Nanoseconds(static_cast<double>(offset)),
+                coordinates,
+                frames[frameIndex],
+                coordinateBrokerSPtr
+            ));
+        }
+
+        segmentSolutions.add(Segment::Solution(name, dynamics, states, conditionIsSatisfied, segmentType));
+    }
+
+    if (!reader.isExhausted())
+    {
+        throw ostk::core::error::RuntimeError("Solution snapshot [{}] is corrupted.", aFile.toString());
+    }
+
+    return {segmentSolutions, header.executionIsComplete != 0};
+}
+
 std::ostream& operator<<(std::ostream& anOutputStream, const Sequence::Solution& aSolution)
 {
     aSolution.print(anOutputStream);
@@ -171,6 +693,39 @@ std::ostream& operator<<(std::ostream& anOutputStream, const Sequence::Solution&
     return anOutputStream;
 }
 
+Sequence::AsyncSolution::AsyncSolution(
+    const std::shared_future<Solution>& aFuture, const Shared<std::atomic<bool>>& aCancellationFlagSPtr
+)
+    : future_(aFuture),
+      cancellationFlagSPtr_(aCancellationFlagSPtr)
+{
+}
+
+bool Sequence::AsyncSolution::isReady() const
+{
+    return this->future_.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+bool Sequence::AsyncSolution::isCancelled() const
+{
+    return this->cancellationFlagSPtr_->load();
+}
+
+void Sequence::AsyncSolution::wait() const
+{
+    this->future_.wait();
+}
+
+Sequence::Solution Sequence::AsyncSolution::get() const
+{
+    return this->future_.get();
+}
+
+void Sequence::AsyncSolution::cancel()
+{
+    this->cancellationFlagSPtr_->store(true);
+}
+
 Sequence::Sequence(
     const Array<Segment>& aSegmentArray,
     const NumericalSolver& aNumericalSolver,
@@ -181,7 +736,8 @@ Sequence::Sequence(
     : segments_(aSegmentArray),
       numericalSolver_(aNumericalSolver),
       dynamics_(aDynamicsArray),
-      segmentPropagationDurationLimit_(maximumPropagationDuration)
+      segmentPropagationDurationLimit_(maximumPropagationDuration),
+      cachedSegmentSolutions_(Array<CachedSegmentSolution>::Empty())
 {
     if (verbosity == 5)
     {
@@ -250,6 +806,16 @@ void Sequence::addSegments(const Array<Segment>& aTrajectorySegmentArray)
     segments_.add(aTrajectorySegmentArray);
 }
 
+void Sequence::setSegment(const Index& anIndex, const Segment& aTrajectorySegment)
+{
+    if (anIndex >= segments_.getSize())
+    {
+        throw ostk::core::error::runtime::Wrong("Segment index");
+    }
+
+    segments_[anIndex] = aTrajectorySegment;
+}
+
 void Sequence::addCoastSegment(const Shared<EventCondition>& anEventConditionSPtr)
 {
     segments_.add(Segment::Coast("Coast", anEventConditionSPtr, dynamics_, numericalSolver_));
@@ -260,34 +826,292 @@ void Sequence::addManeuverSegment(const Shared<EventCondition>& anEventCondition
     segments_.add(Segment::Maneuver("Maneuver", anEventConditionSPtr, aThruster, dynamics_, numericalSolver_));
 }
 
+void Sequence::addImpulsiveManeuverSegment(
+    const Vector3d& aDeltaV,
+    const Shared<const LocalOrbitalFrameFactory>& aLocalOrbitalFrameFactorySPtr,
+    const Real& aSpecificImpulse
+)
+{
+    segments_.add(Segment::ImpulsiveManeuver(
+        "Impulsive Maneuver", aDeltaV, aLocalOrbitalFrameFactorySPtr, aSpecificImpulse, dynamics_, numericalSolver_
+    ));
+}
+
 Sequence::Solution Sequence::solve(const State& aState, const Size& aRepetitionCount) const
 {
+    return this->solveSegments(aState, aRepetitionCount, false);
+}
+
+Sequence::Solution Sequence::solveWarmStarted(const State& aState, const Size& aRepetitionCount) const
+{
+    return this->solveSegments(aState, aRepetitionCount, true);
+}
+
+void Sequence::clearSolutionCache()
+{
+    const std::lock_guard<std::mutex> lock {*cacheMutexSPtr_};
+
+    cachedSegmentSolutions_.clear();
+}
+
+Array<Sequence::Solution> Sequence::solve(
+    const Array<State>& aStateArray, const Size& aRepetitionCount, const Size& aThreadCount
+) const
+{
+    return this->solve(aStateArray, aRepetitionCount, ExecutionContext(aThreadCount));
+}
+
+Array<Sequence::Solution> Sequence::solve(
+    const Array<State>& aStateArray, const Size& aRepetitionCount, const ExecutionContext& anExecutionContext
+) const
+{
+    if (aRepetitionCount <= 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Repetition count.");
+    }
+
+    const Size stateCount = aStateArray.getSize();
+
+    if (stateCount == 0)
+    {
+        return Array<Solution>::Empty();
+    }
+
+    for (const State& state : aStateArray)
+    {
+        if (!state.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("State");
+        }
+    }
+
+    Array<Solution> solutions(stateCount, Solution(Array<Segment::Solution>::Empty(), false));
+
+    anExecutionContext.parallelFor(
+        stateCount,
+        [this, &solutions, &aStateArray, aRepetitionCount]() -> std::function<void(const Index&)>
+        {
+            // Each worker holds its own copy of the sequence, so that the targets updated at the start of each segment
+            // are isolated between runs
+
+            const Sequence sequence = this->getIsolatedCopy();
+
+            return [sequence, &solutions, &aStateArray, aRepetitionCount](const Index& aStateIndex)
+            {
+                solutions[aStateIndex] = sequence.solve(aStateArray[aStateIndex], aRepetitionCount);
+            };
+        }
+    );
+
+    return solutions;
+}
+
+Sequence::AsyncSolution Sequence::solveAsync(
+    const State& aState,
+    const Size& aRepetitionCount,
+    const std::function<void(const Segment::Solution&)>& aSegmentSolutionCallback
+) const
+{
+    if (aRepetitionCount <= 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Repetition count.");
+    }
+
+    // The background solve holds its own copy of the sequence, so that the targets updated at the start of each segment
+    // are isolated from the caller and from other solves
+
+    return Sequence::SolveAsync(
+        [sequence = this->getIsolatedCopy(), aState, aRepetitionCount, aSegmentSolutionCallback](
+            const Shared<const std::atomic<bool>>& aCancellationFlagSPtr
+        ) -> Solution
+        {
+            return sequence.solveSegments(
+                aState, aRepetitionCount, false, aSegmentSolutionCallback, aCancellationFlagSPtr
+            );
+        }
+    );
+}
+
+Sequence::AsyncSolution Sequence::solveToConditionAsync(
+    const State& aState,
+    const Shared<EventCondition>& anEventConditionSPtr,
+    const Duration& aMaximumPropagationDuration,
+    const std::function<void(const Segment::Solution&)>& aSegmentSolutionCallback
+) const
+{
+    if (anEventConditionSPtr == nullptr)
+    {
+        throw ostk::core::error::runtime::Undefined("Event condition");
+    }
+
+    // The background solve holds its own copies of the sequence and of the event condition, so that the targets updated
+    // at the start of each segment are isolated from the caller and from other solves
+
+    return Sequence::SolveAsync(
+        [sequence = this->getIsolatedCopy(),
+         aState,
+         eventConditionSPtr = anEventConditionSPtr->clone(),
+         aMaximumPropagationDuration,
+         aSegmentSolutionCallback](const Shared<const std::atomic<bool>>& aCancellationFlagSPtr) -> Solution
+        {
+            return sequence.solveSegmentsToCondition(
+                aState,
+                *eventConditionSPtr,
+                aMaximumPropagationDuration,
+                aSegmentSolutionCallback,
+                aCancellationFlagSPtr
+            );
+        }
+    );
+}
+
+Sequence Sequence::getIsolatedCopy() const
+{
+    // Segments are cloned, with their event conditions, whose targets are updated at the start of each segment
+
+    Sequence sequence = *this;
+
+    for (Segment& segment : sequence.segments_)
+    {
+        segment = segment.clone();
+    }
+
+    return sequence;
+}
+
+Sequence::Solution Sequence::solveSegments(
+    const State& aState,
+    const Size& aRepetitionCount,
+    const bool& useCache,
+    const std::function<void(const Segment::Solution&)>& aSegmentSolutionCallback,
+    const Shared<const std::atomic<bool>>& aCancellationFlagSPtr
+) const
+{
+    const Tracer::Span span("Sequence::solve", "trajectory");
+
     if (aRepetitionCount <= 0)
     {
         throw ostk::core::error::runtime::Wrong("Repetition count.");
     }
 
+    // The cache is held for the whole solve, so that concurrent warm-started solves do not interleave their entries
+
+    std::unique_lock<std::mutex> cacheLock;
+
+    if (useCache)
+    {
+        cacheLock = std::unique_lock<std::mutex>(*cacheMutexSPtr_);
+    }
+
     Array<Segment::Solution> segmentSolutions = Array<Segment::Solution>::Empty();
 
     State initialState = aState;
-    State finalState = State::Undefined();
+
+    Index segmentIndex = 0;
+    bool cacheIsValid = useCache;
+
+    // Consecutive segments integrated with the same solver start with the step size the previous one ended with
+
+    const NumericalSolver* previousNumericalSolverPtr = nullptr;
+    Real previousFinalTimeStep = Real::Undefined();
+
+    const auto solveSegment = [&](const Segment& aSegment, const Size& aRepetitionIndex) -> Segment::Solution
+    {
+        if (cacheIsValid && (segmentIndex < cachedSegmentSolutions_.getSize()))
+        {
+            const CachedSegmentSolution& cachedSegmentSolution = cachedSegmentSolutions_[segmentIndex];
+
+            if ((cachedSegmentSolution.initialState == initialState) &&
+                (cachedSegmentSolution.segmentPropagationDurationLimit == segmentPropagationDurationLimit_) &&
+                Sequence::SegmentsAreIdentical(cachedSegmentSolution.segment, aSegment))
+            {
+                BOOST_LOG_TRIVIAL(debug) << "Reusing solution of Segment [" << aSegment.getName() << "]." << std::endl;
+
+                return cachedSegmentSolution.solution;
+            }
+        }
+
+        // The following segments start from a new state, hence their cached solutions are stale
+
+        if (useCache)
+        {
+            cacheIsValid = false;
+
+            if (segmentIndex < cachedSegmentSolutions_.getSize())
+            {
+                cachedSegmentSolutions_.erase(
+                    cachedSegmentSolutions_.begin() + segmentIndex, cachedSegmentSolutions_.end()
+                );
+            }
+        }
+
+        aSegment.accessEventCondition()->updateTarget(initialState);
+
+        BOOST_LOG_TRIVIAL(debug) << "Solving Segment:\n" << aSegment << std::endl;
+
+        const Real initialTimeStep =
+            Sequence::GetInitialTimeStep(aSegment, previousNumericalSolverPtr, previousFinalTimeStep);
+
+        Segment::Solution segmentSolution =
+            aSegment.solve(initialState, segmentPropagationDurationLimit_, aCancellationFlagSPtr, initialTimeStep);
+
+        segmentSolution.name = String::Format(
+            "{} - {} - {}", segmentSolution.name, aSegment.getEventCondition()->getName(), aRepetitionIndex
+        );
+
+        BOOST_LOG_TRIVIAL(debug) << "\n" << segmentSolution << std::endl;
+
+        if (useCache)
+        {
+            cachedSegmentSolutions_.add({initialState, aSegment, segmentPropagationDurationLimit_, segmentSolution});
+        }
+
+        return segmentSolution;
+    };
+
+    const auto isCancelled = [&aCancellationFlagSPtr]() -> bool
+    {
+        return (aCancellationFlagSPtr != nullptr) && aCancellationFlagSPtr->load();
+    };
 
     for (Size i = 0; i < aRepetitionCount; ++i)
     {
         for (const Segment& segment : segments_)
         {
-            segment.accessEventCondition()->updateTarget(initialState);
+            if (isCancelled())
+            {
+                BOOST_LOG_TRIVIAL(warning) << "Sequence solve has been cancelled." << std::endl;
 
-            BOOST_LOG_TRIVIAL(debug) << "Solving Segment:\n" << segment << std::endl;
+                return {segmentSolutions, false};
+            }
 
-            Segment::Solution segmentSolution = segment.solve(initialState, segmentPropagationDurationLimit_);
+            try
+            {
+                segmentSolutions.add(solveSegment(segment, i));
+            }
+            catch (...)
+            {
+                if (!isCancelled())
+                {
+                    throw;
+                }
 
-            segmentSolution.name =
-                String::Format("{} - {} - {}", segmentSolution.name, segment.getEventCondition()->getName(), i);
+                BOOST_LOG_TRIVIAL(warning) << "Sequence solve has been cancelled." << std::endl;
 
-            BOOST_LOG_TRIVIAL(debug) << "\n" << segmentSolution << std::endl;
+                return {segmentSolutions, false};
+            }
 
-            segmentSolutions.add(segmentSolution);
+            const Segment::Solution& segmentSolution = segmentSolutions.accessLast();
+
+            ++segmentIndex;
+
+            previousNumericalSolverPtr = &segment.accessNumericalSolver();
+            previousFinalTimeStep = segmentSolution.finalTimeStep;
+
+            if (aSegmentSolutionCallback)
+            {
+                aSegmentSolutionCallback(segmentSolution);
+            }
 
             // Terminate Sequence unsuccessfully if the segment condition was not satisfied
             if (!segmentSolution.conditionIsSatisfied)
@@ -304,10 +1128,212 @@ Sequence::Solution Sequence::solve(const State& aState, const Size& aRepetitionC
     return {segmentSolutions, true};
 }
 
+Real Sequence::GetInitialTimeStep(
+    const Segment& aSegment, const NumericalSolver* aPreviousNumericalSolverPtr, const Real& aPreviousFinalTimeStep
+)
+{
+    // Impulsive maneuver segments have no final time step, the segment following one starts cold
+
+    if ((aPreviousNumericalSolverPtr == nullptr) || (!aPreviousFinalTimeStep.isDefined()) ||
+        (!((*aPreviousNumericalSolverPtr) == aSegment.accessNumericalSolver())))
+    {
+        return Real::Undefined();
+    }
+
+    return aPreviousFinalTimeStep;
+}
+
+bool Sequence::SegmentsAreIdentical(const Segment& aSegment, const Segment& anotherSegment)
+{
+    return (aSegment.getName() == anotherSegment.getName()) && (aSegment.getType() == anotherSegment.getType()) &&
+           (aSegment.accessEventCondition() == anotherSegment.accessEventCondition()) &&
+           (aSegment.accessDynamics() == anotherSegment.accessDynamics()) &&
+           (aSegment.accessNumericalSolver() == anotherSegment.accessNumericalSolver()) &&
+           (aSegment.getStateRetention() == anotherSegment.getStateRetention()) &&
+           (aSegment.getDeltaV() == anotherSegment.getDeltaV()) &&
+           (aSegment.getLocalOrbitalFrameFactory() == anotherSegment.getLocalOrbitalFrameFactory()) &&
+           (aSegment.getSpecificImpulse().isDefined() == anotherSegment.getSpecificImpulse().isDefined()) &&
+           ((!aSegment.getSpecificImpulse().isDefined()) ||
+            (aSegment.getSpecificImpulse() == anotherSegment.getSpecificImpulse()));
+}
+
+Sequence::TargetingSolution Sequence::solveTargeting(
+    const VectorXd& anInitialControlVector,
+    const std::function<State(const VectorXd&)>& anInitialStateGenerator,
+    const std::function<VectorXd(const Solution&)>& aConstraintGenerator,
+    const Real& aTolerance,
+    const Size& aMaximumIterationCount,
+    const MatrixXd& anInitialJacobian,
+    const Real& aRelativeStep
+) const
+{
+    if (anInitialControlVector.size() == 0)
+    {
+        throw ostk::core::error::runtime::Undefined("Initial control vector");
+    }
+
+    if (!anInitialStateGenerator)
+    {
+        throw ostk::core::error::runtime::Undefined("Initial state generator");
+    }
+
+    if (!aConstraintGenerator)
+    {
+        throw ostk::core::error::runtime::Undefined("Constraint generator");
+    }
+
+    if (!aTolerance.isDefined() || !aTolerance.isStrictlyPositive())
+    {
+        throw ostk::core::error::runtime::Wrong("Tolerance");
+    }
+
+    if (!aRelativeStep.isDefined() || !aRelativeStep.isStrictlyPositive())
+    {
+        throw ostk::core::error::runtime::Wrong("Relative step");
+    }
+
+    const Size controlCount = anInitialControlVector.size();
+    const double tolerance = aTolerance;
+    const double relativeStep = aRelativeStep;
+
+    Size propagationCount = 0;
+    Size jacobianEvaluationCount = 0;
+
+    const auto evaluate = [this, &anInitialStateGenerator, &aConstraintGenerator, &propagationCount](
+                              const VectorXd& aControlVector
+                          ) -> std::pair<Solution, VectorXd>
+    {
+        const Solution solution = this->solve(anInitialStateGenerator(aControlVector));
+        ++propagationCount;
+
+        return {solution, aConstraintGenerator(solution)};
+    };
+
+    VectorXd controls = anInitialControlVector;
+    auto [solution, constraints] = evaluate(controls);
+
+    const Size constraintCount = constraints.size();
+
+    if (constraintCount == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Constraints");
+    }
+
+    const auto computeJacobian =
+        [&evaluate, &jacobianEvaluationCount, relativeStep, controlCount, constraintCount](
+            const VectorXd& aControlVector, const VectorXd& aConstraintVector
+        ) -> MatrixXd
+    {
+        MatrixXd jacobian(constraintCount, controlCount);
+
+        for (Size controlIndex = 0; controlIndex < controlCount; ++controlIndex)
+        {
+            const double step = relativeStep * std::max(1.0, std::abs(aControlVector[controlIndex]));
+
+            VectorXd perturbedControls = aControlVector;
+            perturbedControls[controlIndex] += step;
+
+            const VectorXd perturbedConstraints = evaluate(perturbedControls).second;
+
+            if (Size(perturbedConstraints.size()) != constraintCount)
+            {
+                throw ostk::core::error::runtime::Wrong("Constraints");
+            }
+
+            jacobian.col(controlIndex) = (perturbedConstraints - aConstraintVector) / step;
+        }
+
+        ++jacobianEvaluationCount;
+
+        return jacobian;
+    };
+
+    if ((anInitialJacobian.size() != 0) &&
+        ((Size(anInitialJacobian.rows()) != constraintCount) || (Size(anInitialJacobian.cols()) != controlCount)))
+    {
+        throw ostk::core::error::runtime::Wrong("Initial Jacobian");
+    }
+
+    MatrixXd jacobian = anInitialJacobian;
+    bool jacobianIsEvaluated = false;
+
+    Size iterationCount = 0;
+
+    while ((constraints.norm() > tolerance) && (iterationCount < aMaximumIterationCount))
+    {
+        if (jacobian.size() == 0)
+        {
+            jacobian = computeJacobian(controls, constraints);
+            jacobianIsEvaluated = true;
+        }
+
+        const VectorXd controlStep = jacobian.completeOrthogonalDecomposition().solve(-constraints);
+
+        const VectorXd nextControls = controls + controlStep;
+        auto [nextSolution, nextConstraints] = evaluate(nextControls);
+
+        ++iterationCount;
+
+        if (Size(nextConstraints.size()) != constraintCount)
+        {
+            throw ostk::core::error::runtime::Wrong("Constraints");
+        }
+
+        // An updated (or seeded) Jacobian that does not decrease the constraints is re-evaluated, and the step retried
+
+        if ((nextConstraints.norm() >= constraints.norm()) && !jacobianIsEvaluated)
+        {
+            jacobian = computeJacobian(controls, constraints);
+            jacobianIsEvaluated = true;
+
+            continue;
+        }
+
+        // Broyden rank-one update
+
+        jacobian += ((nextConstraints - constraints - jacobian * controlStep) * controlStep.transpose()) /
+                    controlStep.squaredNorm();
+        jacobianIsEvaluated = false;
+
+        controls = nextControls;
+        constraints = nextConstraints;
+        solution = nextSolution;
+    }
+
+    return {
+        controls,
+        constraints,
+        jacobian,
+        solution,
+        iterationCount,
+        propagationCount,
+        jacobianEvaluationCount,
+        constraints.norm() <= tolerance,
+    };
+}
+
 Sequence::Solution Sequence::solveToCondition(
     const State& aState, const EventCondition& anEventCondition, const Duration& aMaximumPropagationDuration
 ) const
 {
+    return this->solveSegmentsToCondition(aState, anEventCondition, aMaximumPropagationDuration);
+}
+
+Sequence::Solution Sequence::solveSegmentsToCondition(
+    const State& aState,
+    const EventCondition& anEventCondition,
+    const Duration& aMaximumPropagationDuration,
+    const std::function<void(const Segment::Solution&)>& aSegmentSolutionCallback,
+    const Shared<const std::atomic<bool>>& aCancellationFlagSPtr
+) const
+{
+    const Tracer::Span span("Sequence::solveToCondition", "trajectory");
+
+    const auto isCancelled = [&aCancellationFlagSPtr]() -> bool
+    {
+        return (aCancellationFlagSPtr != nullptr) && aCancellationFlagSPtr->load();
+    };
+
     Array<Segment::Solution> segmentSolutions = Array<Segment::Solution>::Empty();
 
     State initialState = aState;
@@ -317,10 +1343,20 @@ Sequence::Solution Sequence::solveToCondition(
 
     Duration propagationDuration = Duration::Zero();
 
+    const NumericalSolver* previousNumericalSolverPtr = nullptr;
+    Real previousFinalTimeStep = Real::Undefined();
+
     while (!eventConditionIsSatisfied && propagationDuration <= aMaximumPropagationDuration)
     {
         for (const Segment& segment : segments_)
         {
+            if (isCancelled())
+            {
+                BOOST_LOG_TRIVIAL(warning) << "Sequence solve has been cancelled." << std::endl;
+
+                return {segmentSolutions, false};
+            }
+
             segment.accessEventCondition()->updateTarget(initialState);
 
             BOOST_LOG_TRIVIAL(debug) << "Solving Segment:\n" << segment << std::endl;
@@ -328,14 +1364,41 @@ Sequence::Solution Sequence::solveToCondition(
             const Duration segmentPropagationDurationLimit =
                 std::min(segmentPropagationDurationLimit_, aMaximumPropagationDuration - propagationDuration);
 
-            Segment::Solution segmentSolution = segment.solve(initialState, segmentPropagationDurationLimit);
+            try
+            {
+                segmentSolutions.add(segment.solve(
+                    initialState,
+                    segmentPropagationDurationLimit,
+                    aCancellationFlagSPtr,
+                    Sequence::GetInitialTimeStep(segment, previousNumericalSolverPtr, previousFinalTimeStep)
+                ));
+            }
+            catch (...)
+            {
+                if (!isCancelled())
+                {
+                    throw;
+                }
+
+                BOOST_LOG_TRIVIAL(warning) << "Sequence solve has been cancelled." << std::endl;
+
+                return {segmentSolutions, false};
+            }
+
+            Segment::Solution& segmentSolution = segmentSolutions.back();
+
+            previousNumericalSolverPtr = &segment.accessNumericalSolver();
+            previousFinalTimeStep = segmentSolution.finalTimeStep;
 
             segmentSolution.name =
                 String::Format("{} - {}", segmentSolution.name, segment.getEventCondition()->getName());
 
             BOOST_LOG_TRIVIAL(debug) << "\n" << segmentSolution << std::endl;
 
-            segmentSolutions.add(segmentSolution);
+            if (aSegmentSolutionCallback)
+            {
+                aSegmentSolutionCallback(segmentSolution);
+            }
 
             // Terminate Sequence unsuccessfully if the segment condition was not satisfied
             if (!segmentSolution.conditionIsSatisfied)
@@ -362,6 +1425,34 @@ Sequence::Solution Sequence::solveToCondition(
     return {segmentSolutions, false};
 }
 
+Sequence::AsyncSolution Sequence::SolveAsync(
+    const std::function<Solution(const Shared<const std::atomic<bool>>&)>& aSolver
+)
+{
+    const Shared<std::atomic<bool>> cancellationFlagSPtr = std::make_shared<std::atomic<bool>>(false);
+    const Shared<std::promise<Solution>> promiseSPtr = std::make_shared<std::promise<Solution>>();
+
+    const AsyncSolution asyncSolution = {promiseSPtr->get_future().share(), cancellationFlagSPtr};
+
+    // The thread is detached, so that dropping every handle does not block until the solve is over
+
+    std::thread(
+        [aSolver, cancellationFlagSPtr, promiseSPtr]() -> void
+        {
+            try
+            {
+                promiseSPtr->set_value(aSolver(cancellationFlagSPtr));
+            }
+            catch (...)
+            {
+                promiseSPtr->set_exception(std::current_exception());
+            }
+        }
+    ).detach();
+
+    return asyncSolution;
+}
+
 void Sequence::print(std::ostream& anOutputStream, bool displayDecorator) const
 {
     if (displayDecorator)
@@ -1,5 +1,9 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <map>
+#include <utility>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
@@ -9,6 +13,8 @@
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/AttitudeQuaternion.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianPosition.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianVelocity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/TransformCache.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/TransformInterpolator.hpp>
 
 namespace ostk
 {
@@ -24,6 +30,8 @@ using ostk::astrodynamics::trajectory::state::coordinatesubset::AngularVelocity;
 using ostk::astrodynamics::trajectory::state::coordinatesubset::AttitudeQuaternion;
 using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianPosition;
 using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianVelocity;
+using ostk::astrodynamics::trajectory::state::TransformCache;
+using ostk::astrodynamics::trajectory::state::TransformInterpolator;
 
 State::State(
     const Instant& anInstant,
@@ -32,11 +40,14 @@ State::State(
     const Shared<const CoordinateBroker>& aCoordinateBrokerSPtr
 )
     : instant_(anInstant),
-      coordinates_(aCoordinates),
+      inlineCoordinates_(),
+      heapCoordinates_(),
       frameSPtr_(aFrameSPtr),
       coordinatesBrokerSPtr_(aCoordinateBrokerSPtr)
 {
-    if (coordinatesBrokerSPtr_ && (Size)coordinates_.size() != coordinatesBrokerSPtr_->getNumberOfCoordinates())
+    this->setCoordinates(aCoordinates);
+
+    if (coordinatesBrokerSPtr_ && (Size)aCoordinates.size() != coordinatesBrokerSPtr_->getNumberOfCoordinates())
     {
         throw ostk::core::error::runtime::Wrong("Number of Coordinates");
     }
@@ -49,10 +60,12 @@ State::State(
     const Array<Shared<const CoordinateSubset>>& aCoordinateSubsetsArray
 )
     : instant_(anInstant),
-      coordinates_(aCoordinates),
+      inlineCoordinates_(),
+      heapCoordinates_(),
       frameSPtr_(aFrameSPtr),
       coordinatesBrokerSPtr_(std::make_shared<CoordinateBroker>(CoordinateBroker(aCoordinateSubsetsArray)))
 {
+    this->setCoordinates(aCoordinates);
 }
 
 State::State(const Instant& anInstant, const Position& aPosition, const Velocity& aVelocity)
@@ -87,7 +100,7 @@ State::State(const Instant& anInstant, const Position& aPosition, const Velocity
         CartesianVelocity::Default(),
     }));
 
-    this->coordinates_ = coordinates;
+    this->setCoordinates(coordinates);
     this->frameSPtr_ = aPosition.accessFrame();
     this->coordinatesBrokerSPtr_ = coordinatesBrokerSPtr;
 }
@@ -145,14 +158,15 @@ State::State(
          AngularVelocity::Default()}
     ));
 
-    this->coordinates_ = coordinates;
+    this->setCoordinates(coordinates);
     this->frameSPtr_ = aPosition.accessFrame();
     this->coordinatesBrokerSPtr_ = coordinatesBrokerSPtr;
 }
 
 State::State(const State& aState)
     : instant_(aState.instant_),
-      coordinates_(aState.coordinates_),
+      inlineCoordinates_(aState.inlineCoordinates_),
+      heapCoordinates_(aState.heapCoordinates_),
       frameSPtr_(aState.frameSPtr_),
       coordinatesBrokerSPtr_(aState.coordinatesBrokerSPtr_)
 {
@@ -163,7 +177,8 @@ State& State::operator=(const State& aState)
     if (this != &aState)
     {
         instant_ = aState.instant_;
-        coordinates_ = aState.coordinates_;
+        inlineCoordinates_ = aState.inlineCoordinates_;
+        heapCoordinates_ = aState.heapCoordinates_;
         frameSPtr_ = aState.frameSPtr_;
         coordinatesBrokerSPtr_ = aState.coordinatesBrokerSPtr_;
     }
@@ -192,6 +207,13 @@ bool State::operator==(const State& aState) const
         return false;
     }
 
+    // States sharing a broker share their coordinates layout
+
+    if (this->coordinatesBrokerSPtr_ == aState.coordinatesBrokerSPtr_)
+    {
+        return this->accessCoordinates() == aState.accessCoordinates();
+    }
+
     for (const Shared<const CoordinateSubset>& subset : this->coordinatesBrokerSPtr_->accessSubsets())
     {
         if (!aState.coordinatesBrokerSPtr_->hasSubset(subset))
@@ -199,7 +221,7 @@ bool State::operator==(const State& aState) const
             return false;
         }
 
-        if (this->extractCoordinate(subset) != aState.extractCoordinate(subset))
+        if (this->accessCoordinate(subset) != aState.accessCoordinate(subset))
         {
             return false;
         }
@@ -237,13 +259,16 @@ State State::operator+(const State& aState) const
 
     VectorXd addedCoordinates = VectorXd(this->coordinatesBrokerSPtr_->getNumberOfCoordinates());
     Index i = 0;
+    const VectorXd coordinates = this->accessCoordinates();
+    const VectorXd otherCoordinates = aState.accessCoordinates();
+
     for (const Shared<const CoordinateSubset>& subset : this->coordinatesBrokerSPtr_->accessSubsets())
     {
         Size subsetSize = subset->getSize();
         addedCoordinates.segment(i, subsetSize) = subset->add(
             this->instant_,
-            this->coordinates_,
-            aState.accessCoordinates(),
+            coordinates,
+            otherCoordinates,
             this->frameSPtr_,
             this->coordinatesBrokerSPtr_
         );
@@ -282,13 +307,16 @@ State State::operator-(const State& aState) const
 
     VectorXd subtractedCoordinates = VectorXd(this->coordinatesBrokerSPtr_->getNumberOfCoordinates());
     Index i = 0;
+    const VectorXd coordinates = this->accessCoordinates();
+    const VectorXd otherCoordinates = aState.accessCoordinates();
+
     for (const Shared<const CoordinateSubset>& subset : this->coordinatesBrokerSPtr_->accessSubsets())
     {
         Size subsetSize = subset->getSize();
         subtractedCoordinates.segment(i, subsetSize) = subset->subtract(
             this->instant_,
-            this->coordinates_,
-            aState.accessCoordinates(),
+            coordinates,
+            otherCoordinates,
             this->frameSPtr_,
             this->coordinatesBrokerSPtr_
         );
@@ -312,7 +340,10 @@ std::ostream& operator<<(std::ostream& anOutputStream, const State& aState)
 
 bool State::isDefined() const
 {
-    return this->instant_.isDefined() && this->coordinates_.isDefined() && (this->frameSPtr_ != nullptr) &&
+    const bool coordinatesAreDefined =
+        this->hasInlineCoordinates() ? this->inlineCoordinates_.isDefined() : this->heapCoordinates_.isDefined();
+
+    return this->instant_.isDefined() && coordinatesAreDefined && (this->frameSPtr_ != nullptr) &&
            this->frameSPtr_->isDefined() && (this->coordinatesBrokerSPtr_ != nullptr);
 }
 
@@ -336,14 +367,19 @@ const Shared<const Frame> State::accessFrame() const
     return this->frameSPtr_;
 }
 
-const VectorXd& State::accessCoordinates() const
+Eigen::Ref<const VectorXd> State::accessCoordinates() const
 {
     if (!this->isDefined())
     {
         throw ostk::core::error::runtime::Undefined("State");
     }
 
-    return this->coordinates_;
+    if (this->hasInlineCoordinates())
+    {
+        return this->inlineCoordinates_;
+    }
+
+    return this->heapCoordinates_;
 }
 
 const Shared<const CoordinateBroker>& State::accessCoordinateBroker() const
@@ -356,6 +392,27 @@ const Shared<const CoordinateBroker>& State::accessCoordinateBroker() const
     return this->coordinatesBrokerSPtr_;
 }
 
+Eigen::Ref<const VectorXd> State::accessCoordinate(const Shared<const CoordinateSubset>& aSubsetSPtr) const
+{
+    const Eigen::Ref<const VectorXd> coordinates = this->accessCoordinates();
+
+    return coordinates.segment(this->coordinatesBrokerSPtr_->getSubsetIndex(aSubsetSPtr), aSubsetSPtr->getSize());
+}
+
+Eigen::Ref<const Vector3d> State::accessPositionCoordinates() const
+{
+    return this->accessCoordinates().segment<3>(
+        this->coordinatesBrokerSPtr_->getSubsetIndex(CartesianPosition::Default())
+    );
+}
+
+Eigen::Ref<const Vector3d> State::accessVelocityCoordinates() const
+{
+    return this->accessCoordinates().segment<3>(
+        this->coordinatesBrokerSPtr_->getSubsetIndex(CartesianVelocity::Default())
+    );
+}
+
 Size State::getSize() const
 {
     if (!this->isDefined())
@@ -363,7 +420,7 @@ Size State::getSize() const
         throw ostk::core::error::runtime::Undefined("State");
     }
 
-    return this->coordinates_.size();
+    return this->hasInlineCoordinates() ? this->inlineCoordinates_.size() : this->heapCoordinates_.size();
 }
 
 Instant State::getInstant() const
@@ -383,7 +440,7 @@ Position State::getPosition() const
         throw ostk::core::error::runtime::Undefined("State");
     }
 
-    return Position::Meters(this->extractCoordinate(CartesianPosition::Default()), this->frameSPtr_);
+    return Position::Meters(this->accessPositionCoordinates(), this->frameSPtr_);
 }
 
 Velocity State::getVelocity() const
@@ -393,7 +450,7 @@ Velocity State::getVelocity() const
         throw ostk::core::error::runtime::Undefined("State");
     }
 
-    return Velocity::MetersPerSecond(this->extractCoordinate(CartesianVelocity::Default()), this->frameSPtr_);
+    return Velocity::MetersPerSecond(this->accessVelocityCoordinates(), this->frameSPtr_);
 }
 
 Quaternion State::getAttitude() const
@@ -443,12 +500,28 @@ bool State::hasSubset(const Shared<const CoordinateSubset>& aSubsetSPtr) const
 
 VectorXd State::extractCoordinate(const Shared<const CoordinateSubset>& aSubsetSPtr) const
 {
-    return this->coordinatesBrokerSPtr_->extractCoordinate(this->accessCoordinates(), aSubsetSPtr);
+    return this->accessCoordinate(aSubsetSPtr);
 }
 
 VectorXd State::extractCoordinates(const Array<Shared<const CoordinateSubset>>& aCoordinateSubsetsArray) const
 {
-    return this->coordinatesBrokerSPtr_->extractCoordinates(this->accessCoordinates(), aCoordinateSubsetsArray);
+    Size coordinateSubsetsSize = 0;
+    for (const Shared<const CoordinateSubset>& subset : aCoordinateSubsetsArray)
+    {
+        coordinateSubsetsSize += subset->getSize();
+    }
+
+    VectorXd coordinateSubsetsVector(coordinateSubsetsSize);
+
+    Index startIndex = 0;
+    for (const Shared<const CoordinateSubset>& subset : aCoordinateSubsetsArray)
+    {
+        coordinateSubsetsVector.segment(startIndex, subset->getSize()) = this->accessCoordinate(subset);
+
+        startIndex += subset->getSize();
+    }
+
+    return coordinateSubsetsVector;
 }
 
 State State::inFrame(const Shared<const Frame>& aFrameSPtr) const
@@ -465,15 +538,22 @@ State State::inFrame(const Shared<const Frame>& aFrameSPtr) const
 
     if (aFrameSPtr == this->frameSPtr_)
     {
-        return {this->instant_, this->coordinates_, this->frameSPtr_, this->coordinatesBrokerSPtr_};
+        return *this;
     }
 
+    return this->applyTransform(TransformCache::Get(this->frameSPtr_, aFrameSPtr, this->instant_), aFrameSPtr);
+}
+
+State State::applyTransform(const Transform& aTransform, const Shared<const Frame>& aFrameSPtr) const
+{
     VectorXd inFrameCoordinates = VectorXd(this->coordinatesBrokerSPtr_->getNumberOfCoordinates());
+    const VectorXd coordinates = this->accessCoordinates();
+
     Index i = 0;
     for (const Shared<const CoordinateSubset>& subset : this->coordinatesBrokerSPtr_->accessSubsets())
     {
-        const VectorXd subsetInFrame = subset->inFrame(
-            this->instant_, this->coordinates_, this->frameSPtr_, aFrameSPtr, this->coordinatesBrokerSPtr_
+        const VectorXd subsetInFrame = subset->applyTransform(
+            aTransform, this->instant_, coordinates, this->frameSPtr_, aFrameSPtr, this->coordinatesBrokerSPtr_
         );
 
         inFrameCoordinates.segment(i, subsetInFrame.size()) = subsetInFrame;
@@ -521,6 +601,143 @@ State State::Undefined()
     return {Instant::Undefined(), VectorXd(0), Frame::Undefined(), nullptr};
 }
 
+Array<State> State::InFrame(const Array<State>& aStateArray, const Shared<const Frame>& aFrameSPtr)
+{
+    if ((aFrameSPtr == nullptr) || (!aFrameSPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    Array<State> states = Array<State>::Empty();
+    states.reserve(aStateArray.getSize());
+
+    // Transforms from each frame at each instant, frames being held by the states
+
+    std::map<std::pair<const Frame*, Instant>, Transform> transforms;
+
+    for (const State& state : aStateArray)
+    {
+        if (!state.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("State");
+        }
+
+        if (state.frameSPtr_ == aFrameSPtr)
+        {
+            states.add(state);
+
+            continue;
+        }
+
+        const std::pair<const Frame*, Instant> key = {state.frameSPtr_.get(), state.instant_};
+
+        auto transformIterator = transforms.find(key);
+
+        if (transformIterator == transforms.end())
+        {
+            transformIterator =
+                transforms.emplace(key, TransformCache::Get(state.frameSPtr_, aFrameSPtr, state.instant_)).first;
+        }
+
+        states.add(state.applyTransform(transformIterator->second, aFrameSPtr));
+    }
+
+    return states;
+}
+
+Array<State> State::InFrame(
+    const Array<State>& aStateArray, const Shared<const Frame>& aFrameSPtr, const Duration& anInterpolationStep
+)
+{
+    if ((aFrameSPtr == nullptr) || (!aFrameSPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    // One interpolator per frame of the states, spanning the states expressed in that frame
+
+    std::map<const Frame*, std::pair<Instant, Instant>> frameIntervals;
+
+    for (const State& state : aStateArray)
+    {
+        if (!state.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("State");
+        }
+
+        if (state.frameSPtr_ == aFrameSPtr)
+        {
+            continue;
+        }
+
+        const auto frameIntervalIterator = frameIntervals.find(state.frameSPtr_.get());
+
+        if (frameIntervalIterator == frameIntervals.end())
+        {
+            frameIntervals.emplace(state.frameSPtr_.get(), std::make_pair(state.instant_, state.instant_));
+        }
+        else
+        {
+            frameIntervalIterator->second.first = std::min(frameIntervalIterator->second.first, state.instant_);
+            frameIntervalIterator->second.second = std::max(frameIntervalIterator->second.second, state.instant_);
+        }
+    }
+
+    std::map<const Frame*, TransformInterpolator> interpolators;
+
+    Array<State> states = Array<State>::Empty();
+    states.reserve(aStateArray.getSize());
+
+    for (const State& state : aStateArray)
+    {
+        if (state.frameSPtr_ == aFrameSPtr)
+        {
+            states.add(state);
+
+            continue;
+        }
+
+        auto interpolatorIterator = interpolators.find(state.frameSPtr_.get());
+
+        if (interpolatorIterator == interpolators.end())
+        {
+            const std::pair<Instant, Instant>& frameInterval = frameIntervals.at(state.frameSPtr_.get());
+
+            const TransformInterpolator interpolator = {
+                state.frameSPtr_,
+                aFrameSPtr,
+                physics::time::Interval::Closed(frameInterval.first, frameInterval.second),
+                anInterpolationStep,
+            };
+
+            interpolatorIterator = interpolators.emplace(state.frameSPtr_.get(), interpolator).first;
+        }
+
+        states.add(state.applyTransform(interpolatorIterator->second.getTransformAt(state.instant_), aFrameSPtr));
+    }
+
+    return states;
+}
+
+bool State::hasInlineCoordinates() const
+{
+    return this->heapCoordinates_.size() == 0;
+}
+
+void State::setCoordinates(const VectorXd& aCoordinates)
+{
+    if (Size(aCoordinates.size()) <= State::InlineCoordinatesCapacity)
+    {
+        this->inlineCoordinates_ = aCoordinates;
+        this->heapCoordinates_.resize(0);
+    }
+    else
+    {
+        this->inlineCoordinates_.resize(0);
+        this->heapCoordinates_ = aCoordinates;
+    }
+}
+
 }  // namespace trajectory
 }  // namespace astrodynamics
 }  // namespace ostk
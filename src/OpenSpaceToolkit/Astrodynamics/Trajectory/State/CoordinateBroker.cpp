@@ -1,5 +1,8 @@
 /// Apache License 2.0
 
+#include <cstdint>
+#include <limits>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Type/Size.hpp>
 
@@ -14,10 +17,25 @@ namespace trajectory
 namespace state
 {
 
+static const Index noSubsetIndex = std::numeric_limits<Index>::max();
+
+// Mix of a subset handle and its starting index. Mixes are summed, so that the hash does not depend on the order in
+// which subsets were added.
+static Size HashSubset(const Index& aHandle, const Index& anIndex)
+{
+    std::uint64_t hash = (std::uint64_t(aHandle) + 1) * 0x9E3779B97F4A7C15ULL + std::uint64_t(anIndex);
+
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+
+    return Size(hash ^ (hash >> 31));
+}
+
 CoordinateBroker::CoordinateBroker()
     : nextCoordinateSubsetIndex_(0),
       coordinateSubsets_({}),
-      coordinateSubsetsIndexMap_({})
+      coordinateSubsetIndices_(),
+      hash_(0)
 {
 }
 
@@ -32,6 +50,16 @@ CoordinateBroker::CoordinateBroker(const Array<Shared<const CoordinateSubset>>&
 
 bool CoordinateBroker::operator==(const CoordinateBroker& aCoordinateBroker) const
 {
+    if (this == &aCoordinateBroker)
+    {
+        return true;
+    }
+
+    if (this->hash_ != aCoordinateBroker.hash_)
+    {
+        return false;
+    }
+
     if (this->getNumberOfCoordinates() != aCoordinateBroker.getNumberOfCoordinates())
     {
         return false;
@@ -42,15 +70,14 @@ bool CoordinateBroker::operator==(const CoordinateBroker& aCoordinateBroker) con
         return false;
     }
 
-    for (const auto& element : this->coordinateSubsetsIndexMap_)
+    for (const Shared<const CoordinateSubset>& subset : this->coordinateSubsets_)
     {
-        const String id = element.first;
-        if (!aCoordinateBroker.hasSubset(id))
+        if (!aCoordinateBroker.hasSubset(*subset))
         {
             return false;
         }
 
-        if (element.second != aCoordinateBroker.getSubsetIndex(id))
+        if (this->getSubsetIndex(*subset) != aCoordinateBroker.getSubsetIndex(*subset))
         {
             return false;
         }
@@ -76,7 +103,12 @@ Size CoordinateBroker::getNumberOfCoordinates() const
 
 Size CoordinateBroker::getNumberOfSubsets() const
 {
-    return (size_t)this->coordinateSubsetsIndexMap_.size();
+    return this->coordinateSubsets_.getSize();
+}
+
+Size CoordinateBroker::hash() const
+{
+    return this->hash_;
 }
 
 Array<Shared<const CoordinateSubset>> CoordinateBroker::getSubsets() const
@@ -86,32 +118,56 @@ Array<Shared<const CoordinateSubset>> CoordinateBroker::getSubsets() const
 
 Index CoordinateBroker::addSubset(const Shared<const CoordinateSubset>& aCoordinateSubsetSPtr)
 {
-    const auto search = this->coordinateSubsetsIndexMap_.find(aCoordinateSubsetSPtr->getId());
-
-    if (search != this->coordinateSubsetsIndexMap_.end())
+    if (this->hasSubset(*aCoordinateSubsetSPtr))
     {
-        return search->second;
+        return this->getSubsetIndex(*aCoordinateSubsetSPtr);
     }
 
+    const Index handle = aCoordinateSubsetSPtr->getHandle();
     const Index coordinatesSubsetIndex = this->nextCoordinateSubsetIndex_;
 
+    if (handle >= this->coordinateSubsetIndices_.size())
+    {
+        this->coordinateSubsetIndices_.resize(handle + 1, noSubsetIndex);
+    }
+
     this->coordinateSubsets_.add(aCoordinateSubsetSPtr);
-    this->coordinateSubsetsIndexMap_.insert({aCoordinateSubsetSPtr->getId(), this->nextCoordinateSubsetIndex_});
+    this->coordinateSubsetIndices_[handle] = coordinatesSubsetIndex;
     this->nextCoordinateSubsetIndex_ += aCoordinateSubsetSPtr->getSize();
+    this->hash_ += HashSubset(handle, coordinatesSubsetIndex);
 
     return coordinatesSubsetIndex;
 }
 
 bool CoordinateBroker::hasSubset(const Shared<const CoordinateSubset>& aCoordinateSubsetSPtr) const
 {
-    return this->hasSubset(aCoordinateSubsetSPtr->getId());
+    return this->hasSubset(*aCoordinateSubsetSPtr);
+}
+
+Index CoordinateBroker::getSubsetIndex(const Shared<const CoordinateSubset>& aCoordinateSubsetSPtr) const
+{
+    return this->getSubsetIndex(*aCoordinateSubsetSPtr);
+}
+
+Eigen::Ref<const VectorXd> CoordinateBroker::accessCoordinate(
+    const VectorXd& aFullCoordinatesVector, const CoordinateSubset& aCoordinateSubset
+) const
+{
+    return aFullCoordinatesVector.segment(this->getSubsetIndex(aCoordinateSubset), aCoordinateSubset.getSize());
+}
+
+Eigen::Ref<const VectorXd> CoordinateBroker::accessCoordinate(
+    const VectorXd& aFullCoordinatesVector, const Shared<const CoordinateSubset>& aCoordinateSubsetSPtr
+) const
+{
+    return this->accessCoordinate(aFullCoordinatesVector, *aCoordinateSubsetSPtr);
 }
 
 VectorXd CoordinateBroker::extractCoordinate(
     const VectorXd& aFullCoordinatesVector, const CoordinateSubset& aCoordinateSubset
 ) const
 {
-    return aFullCoordinatesVector.segment(this->getSubsetIndex(aCoordinateSubset.getId()), aCoordinateSubset.getSize());
+    return this->accessCoordinate(aFullCoordinatesVector, aCoordinateSubset);
 }
 
 VectorXd CoordinateBroker::extractCoordinates(
@@ -130,7 +186,7 @@ VectorXd CoordinateBroker::extractCoordinates(
     for (const auto& subset : aCoordinateSubsetsArray)
     {
         coordinateSubsetsVector.segment(startIndex, subset->getSize()) =
-            aFullCoordinatesVector.segment(this->getSubsetIndex(subset->getId()), subset->getSize());
+            aFullCoordinatesVector.segment(this->getSubsetIndex(*subset), subset->getSize());
 
         startIndex += subset->getSize();
     }
@@ -145,21 +201,22 @@ VectorXd CoordinateBroker::extractCoordinate(
     return this->extractCoordinate(aFullCoordinatesVector, *aCoordinateSubsetSPtr);
 }
 
-bool CoordinateBroker::hasSubset(const String& anId) const
+bool CoordinateBroker::hasSubset(const CoordinateSubset& aCoordinateSubset) const
 {
-    return this->coordinateSubsetsIndexMap_.count(anId) > 0;
+    const Index handle = aCoordinateSubset.getHandle();
+
+    return (handle < this->coordinateSubsetIndices_.size()) &&
+           (this->coordinateSubsetIndices_[handle] != noSubsetIndex);
 }
 
-Index CoordinateBroker::getSubsetIndex(const String& anId) const
+Index CoordinateBroker::getSubsetIndex(const CoordinateSubset& aCoordinateSubset) const
 {
-    auto search = this->coordinateSubsetsIndexMap_.find(anId);
-
-    if (search == this->coordinateSubsetsIndexMap_.end())
+    if (!this->hasSubset(aCoordinateSubset))
     {
-        throw ostk::core::error::RuntimeError("Coordinates subset [{}] not found", anId);
+        throw ostk::core::error::RuntimeError("Coordinates subset [{}] not found", aCoordinateSubset.getId());
     }
 
-    return search->second;
+    return this->coordinateSubsetIndices_[aCoordinateSubset.getHandle()];
 }
 
 }  // namespace state
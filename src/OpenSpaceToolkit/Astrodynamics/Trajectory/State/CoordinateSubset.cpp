@@ -1,5 +1,8 @@
 /// Apache License 2.0
 
+#include <mutex>
+#include <unordered_map>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateBroker.hpp>
@@ -14,10 +17,21 @@ namespace trajectory
 namespace state
 {
 
+static Index InternId(const String& anId)
+{
+    static std::mutex mutex;
+    static std::unordered_map<String, Index> handles;
+
+    const std::lock_guard<std::mutex> lock(mutex);
+
+    return handles.emplace(anId, handles.size()).first->second;
+}
+
 CoordinateSubset::CoordinateSubset(const String& aName, const Size& aSize)
     : name_(aName),
       size_(aSize),
-      id_(aName + " | " + std::to_string(aSize))
+      id_(aName + " | " + std::to_string(aSize)),
+      handle_(0)
 {
     if (aName.isEmpty())
     {
@@ -28,11 +42,13 @@ CoordinateSubset::CoordinateSubset(const String& aName, const Size& aSize)
     {
         throw ostk::core::error::runtime::Wrong("Size");
     }
+
+    this->handle_ = InternId(this->id_);
 }
 
 bool CoordinateSubset::operator==(const CoordinateSubset& aCoordinateSubset) const
 {
-    return this->id_ == aCoordinateSubset.id_;
+    return this->handle_ == aCoordinateSubset.handle_;
 }
 
 bool CoordinateSubset::operator!=(const CoordinateSubset& aCoordinateSubset) const
@@ -50,6 +66,11 @@ String CoordinateSubset::getId() const
     return id_;
 }
 
+Index CoordinateSubset::getHandle() const
+{
+    return handle_;
+}
+
 String CoordinateSubset::getName() const
 {
     return name_;
@@ -102,6 +123,18 @@ VectorXd CoordinateSubset::inFrame(
     return coordinates;
 }
 
+VectorXd CoordinateSubset::applyTransform(
+    [[maybe_unused]] const Transform& aTransform,
+    const Instant& anInstant,
+    const VectorXd& aFullCoordinatesVector,
+    const Shared<const Frame>& fromFrameSPtr,
+    const Shared<const Frame>& toFrameSPtr,
+    const Shared<const CoordinateBroker>& aCoordinateBrokerSPtr
+) const
+{
+    return this->inFrame(anInstant, aFullCoordinatesVector, fromFrameSPtr, toFrameSPtr, aCoordinateBrokerSPtr);
+}
+
 Shared<const CoordinateSubset> CoordinateSubset::Mass()
 {
     static const Shared<const CoordinateSubset> mass = std::make_shared<CoordinateSubset>("MASS", 1);
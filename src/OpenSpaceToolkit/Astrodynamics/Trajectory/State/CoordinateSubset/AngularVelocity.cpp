@@ -3,6 +3,7 @@
 #include <OpenSpaceToolkit/Core/Error.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/AngularVelocity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/TransformCache.hpp>
 
 namespace ostk
 {
@@ -20,6 +21,8 @@ using ostk::mathematics::object::Vector3d;
 using ostk::physics::coordinate::Position;
 using ostk::physics::coordinate::Velocity;
 
+using ostk::astrodynamics::trajectory::state::TransformCache;
+
 AngularVelocity::AngularVelocity(const Shared<const AttitudeQuaternion>& aAttitudeQuaternionSPtr, const String& aName)
     : CoordinateSubset(aName, 3),
       attitudeQuaternionSPtr_(aAttitudeQuaternionSPtr)
@@ -35,18 +38,35 @@ VectorXd AngularVelocity::inFrame(
     const Shared<const Frame>& toFrame,
     const Shared<const CoordinateBroker>& aCoordinateBrokerSPtr
 ) const
+{
+    return this->applyTransform(
+        TransformCache::Get(fromFrame, toFrame, anInstant),
+        anInstant,
+        aFullCoordinatesVector,
+        fromFrame,
+        toFrame,
+        aCoordinateBrokerSPtr
+    );
+}
+
+VectorXd AngularVelocity::applyTransform(
+    const Transform& aTransform,
+    const Instant& anInstant,
+    const VectorXd& aFullCoordinatesVector,
+    const Shared<const Frame>& fromFrame,
+    const Shared<const Frame>& toFrame,
+    const Shared<const CoordinateBroker>& aCoordinateBrokerSPtr
+) const
 {
     const VectorXd coordinates = aCoordinateBrokerSPtr->extractCoordinate(aFullCoordinatesVector, *this);
 
-    const VectorXd attitudeCoordinatesInFrame = this->attitudeQuaternionSPtr_->inFrame(
-        anInstant, aFullCoordinatesVector, fromFrame, toFrame, aCoordinateBrokerSPtr
+    const VectorXd attitudeCoordinatesInFrame = this->attitudeQuaternionSPtr_->applyTransform(
+        aTransform, anInstant, aFullCoordinatesVector, fromFrame, toFrame, aCoordinateBrokerSPtr
     );
     const Quaternion quaternionInFrame =
         AttitudeQuaternion::coordinatesToQuaternion(attitudeCoordinatesInFrame).toNormalized();
 
-    const Transform transform = fromFrame->getTransformTo(toFrame, anInstant);
-
-    const Vector3d coordinatesInFrame = coordinates - quaternionInFrame * transform.getAngularVelocity();
+    const Vector3d coordinatesInFrame = coordinates - quaternionInFrame * aTransform.getAngularVelocity();
     return VectorXd::Map(coordinatesInFrame.data(), static_cast<Eigen::Index>(3));
 }
 
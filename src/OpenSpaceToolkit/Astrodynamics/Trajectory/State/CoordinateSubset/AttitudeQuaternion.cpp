@@ -3,6 +3,7 @@
 #include <OpenSpaceToolkit/Core/Error.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/AttitudeQuaternion.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/TransformCache.hpp>
 
 namespace ostk
 {
@@ -19,6 +20,8 @@ using ostk::mathematics::object::Vector3d;
 
 using ostk::physics::coordinate::Position;
 
+using ostk::astrodynamics::trajectory::state::TransformCache;
+
 AttitudeQuaternion::AttitudeQuaternion(const String& aName)
     : CoordinateSubset(aName, 4)
 {
@@ -33,14 +36,31 @@ VectorXd AttitudeQuaternion::inFrame(
     const Shared<const Frame>& toFrame,
     const Shared<const CoordinateBroker>& aCoordinateBrokerSPtr
 ) const
+{
+    return this->applyTransform(
+        TransformCache::Get(fromFrame, toFrame, anInstant),
+        anInstant,
+        aFullCoordinatesVector,
+        fromFrame,
+        toFrame,
+        aCoordinateBrokerSPtr
+    );
+}
+
+VectorXd AttitudeQuaternion::applyTransform(
+    const Transform& aTransform,
+    [[maybe_unused]] const Instant& anInstant,
+    const VectorXd& aFullCoordinatesVector,
+    [[maybe_unused]] const Shared<const Frame>& fromFrame,
+    [[maybe_unused]] const Shared<const Frame>& toFrame,
+    const Shared<const CoordinateBroker>& aCoordinateBrokerSPtr
+) const
 {
     const VectorXd coordinates = aCoordinateBrokerSPtr->extractCoordinate(aFullCoordinatesVector, *this);
 
     const Quaternion quaternion = coordinatesToQuaternion(coordinates);
 
-    const Transform transform = fromFrame->getTransformTo(toFrame, anInstant);
-
-    const Quaternion quaternionInFrame = quaternion * transform.getOrientation().toConjugate();
+    const Quaternion quaternionInFrame = quaternion * aTransform.getOrientation().toConjugate();
 
     return quaterionToCoordinates(quaternionInFrame);
 }
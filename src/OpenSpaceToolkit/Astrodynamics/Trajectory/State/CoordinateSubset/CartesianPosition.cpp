@@ -3,6 +3,7 @@
 #include <OpenSpaceToolkit/Core/Error.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianPosition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/TransformCache.hpp>
 
 namespace ostk
 {
@@ -17,7 +18,7 @@ namespace coordinatesubset
 
 using ostk::mathematics::object::Vector3d;
 
-using ostk::physics::coordinate::Position;
+using ostk::astrodynamics::trajectory::state::TransformCache;
 
 CartesianPosition::CartesianPosition(const String& aName)
     : CoordinateSubset(aName, 3)
@@ -57,13 +58,30 @@ VectorXd CartesianPosition::inFrame(
     const Shared<const Frame>& toFrame,
     const Shared<const CoordinateBroker>& aCoordinateBrokerSPtr
 ) const
+{
+    return this->applyTransform(
+        TransformCache::Get(fromFrame, toFrame, anInstant),
+        anInstant,
+        aFullCoordinatesVector,
+        fromFrame,
+        toFrame,
+        aCoordinateBrokerSPtr
+    );
+}
+
+VectorXd CartesianPosition::applyTransform(
+    const Transform& aTransform,
+    [[maybe_unused]] const Instant& anInstant,
+    const VectorXd& aFullCoordinatesVector,
+    [[maybe_unused]] const Shared<const Frame>& fromFrame,
+    [[maybe_unused]] const Shared<const Frame>& toFrame,
+    const Shared<const CoordinateBroker>& aCoordinateBrokerSPtr
+) const
 {
     VectorXd positionCoordinates = aCoordinateBrokerSPtr->extractCoordinate(aFullCoordinatesVector, *this);
 
     Vector3d toFrameCoordinates =
-        Position::Meters({positionCoordinates(0), positionCoordinates(1), positionCoordinates(2)}, fromFrame)
-            .inFrame(toFrame, anInstant)
-            .getCoordinates();
+        aTransform.applyToPosition({positionCoordinates(0), positionCoordinates(1), positionCoordinates(2)});
 
     return VectorXd::Map(toFrameCoordinates.data(), static_cast<Eigen::Index>(3));
 }
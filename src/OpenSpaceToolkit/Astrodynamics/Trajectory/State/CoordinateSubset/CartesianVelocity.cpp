@@ -3,6 +3,7 @@
 #include <OpenSpaceToolkit/Core/Error.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianVelocity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/TransformCache.hpp>
 
 namespace ostk
 {
@@ -17,8 +18,7 @@ namespace coordinatesubset
 
 using ostk::mathematics::object::Vector3d;
 
-using ostk::physics::coordinate::Position;
-using ostk::physics::coordinate::Velocity;
+using ostk::astrodynamics::trajectory::state::TransformCache;
 
 CartesianVelocity::CartesianVelocity(const Shared<const CartesianPosition>& aCartesianPositionSPtr, const String& aName)
     : CoordinateSubset(aName, aCartesianPositionSPtr->getSize()),
@@ -59,19 +59,34 @@ VectorXd CartesianVelocity::inFrame(
     const Shared<const Frame>& toFrame,
     const Shared<const CoordinateBroker>& aCoordinateBrokerSPtr
 ) const
+{
+    return this->applyTransform(
+        TransformCache::Get(fromFrame, toFrame, anInstant),
+        anInstant,
+        aFullCoordinatesVector,
+        fromFrame,
+        toFrame,
+        aCoordinateBrokerSPtr
+    );
+}
+
+VectorXd CartesianVelocity::applyTransform(
+    const Transform& aTransform,
+    [[maybe_unused]] const Instant& anInstant,
+    const VectorXd& aFullCoordinatesVector,
+    [[maybe_unused]] const Shared<const Frame>& fromFrame,
+    [[maybe_unused]] const Shared<const Frame>& toFrame,
+    const Shared<const CoordinateBroker>& aCoordinateBrokerSPtr
+) const
 {
     const VectorXd positionCoordinates =
         aCoordinateBrokerSPtr->extractCoordinate(aFullCoordinatesVector, this->cartesianPositionSPtr_);
     const VectorXd velocityCoordinates = aCoordinateBrokerSPtr->extractCoordinate(aFullCoordinatesVector, *this);
 
-    Vector3d toFrameCoordinates =
-        Velocity::MetersPerSecond({velocityCoordinates(0), velocityCoordinates(1), velocityCoordinates(2)}, fromFrame)
-            .inFrame(
-                Position::Meters({positionCoordinates(0), positionCoordinates(1), positionCoordinates(2)}, fromFrame),
-                toFrame,
-                anInstant
-            )
-            .getCoordinates();
+    Vector3d toFrameCoordinates = aTransform.applyToVelocity(
+        {positionCoordinates(0), positionCoordinates(1), positionCoordinates(2)},
+        {velocityCoordinates(0), velocityCoordinates(1), velocityCoordinates(2)}
+    );
 
     return VectorXd::Map(toFrameCoordinates.data(), static_cast<Eigen::Index>(3));
 }
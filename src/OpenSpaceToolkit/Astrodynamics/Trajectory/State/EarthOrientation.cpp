@@ -0,0 +1,157 @@
+/// Apache License 2.0
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/EarthOrientation.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/TransformCache.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/TransformInterpolator.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace trajectory
+{
+namespace state
+{
+
+namespace
+{
+
+std::atomic<EarthOrientation::Model> model = {EarthOrientation::Model::Full};
+std::atomic<double> interpolationStep_s = {3600.0};
+
+// Incremented on each change of the step, invalidating the grid nodes kept by threads
+std::atomic<std::uint64_t> generation = {0};
+
+struct GridCell
+{
+    std::uint64_t generation = 0;
+    std::int64_t nodeIndex = 0;
+    Transform previousTransform = Transform::Undefined();
+    Transform nextTransform = Transform::Undefined();
+};
+
+bool IsFrame(const Shared<const Frame>& aFrameSPtr, const Shared<const Frame>& aReferenceFrameSPtr)
+{
+    return (aFrameSPtr == aReferenceFrameSPtr) || (*aFrameSPtr == *aReferenceFrameSPtr);
+}
+
+Transform ComputeInterpolatedGcrfToItrfTransform(const Instant& anInstant)
+{
+    static const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+    static const Shared<const Frame> itrfSPtr = Frame::ITRF();
+
+    static const Instant referenceInstant = Instant::J2000();
+
+    thread_local GridCell cell;
+
+    const std::uint64_t currentGeneration = generation;
+    const double step_s = interpolationStep_s;
+
+    const double stepRatio = (anInstant - referenceInstant).inSeconds() / step_s;
+    const std::int64_t nodeIndex = static_cast<std::int64_t>(std::floor(stepRatio));
+
+    const auto computeNodeTransform = [&](const std::int64_t& aNodeIndex) -> Transform
+    {
+        return gcrfSPtr->getTransformTo(itrfSPtr, referenceInstant + Duration::Seconds(step_s * double(aNodeIndex)));
+    };
+
+    const bool cellIsValid = cell.previousTransform.isDefined() && (cell.generation == currentGeneration);
+
+    if ((!cellIsValid) || (cell.nodeIndex != nodeIndex))
+    {
+        // Moving on to the next cell, as along a propagation, reuses the shared node
+
+        if (cellIsValid && (nodeIndex == (cell.nodeIndex + 1)))
+        {
+            cell.previousTransform = cell.nextTransform;
+        }
+        else
+        {
+            cell.previousTransform = computeNodeTransform(nodeIndex);
+        }
+
+        cell.nextTransform = computeNodeTransform(nodeIndex + 1);
+        cell.nodeIndex = nodeIndex;
+        cell.generation = currentGeneration;
+    }
+
+    return TransformInterpolator::Interpolate(
+        cell.previousTransform, cell.nextTransform, anInstant, stepRatio - double(nodeIndex)
+    );
+}
+
+}  // namespace
+
+EarthOrientation::Model EarthOrientation::GetModel()
+{
+    return model;
+}
+
+void EarthOrientation::SetModel(const EarthOrientation::Model& aModel)
+{
+    model = aModel;
+
+    TransformCache::Clear();
+}
+
+Duration EarthOrientation::GetInterpolationStep()
+{
+    return Duration::Seconds(interpolationStep_s);
+}
+
+void EarthOrientation::SetInterpolationStep(const Duration& aStep)
+{
+    if ((!aStep.isDefined()) || (!aStep.isStrictlyPositive()))
+    {
+        throw ostk::core::error::runtime::Wrong("Step");
+    }
+
+    interpolationStep_s = aStep.inSeconds();
+    generation++;
+
+    TransformCache::Clear();
+}
+
+Transform EarthOrientation::GetTransform(
+    const Shared<const Frame>& aFromFrameSPtr, const Shared<const Frame>& aToFrameSPtr, const Instant& anInstant
+)
+{
+    if ((aFromFrameSPtr == nullptr) || (aToFrameSPtr == nullptr))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (model == EarthOrientation::Model::Interpolated)
+    {
+        static const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+        static const Shared<const Frame> itrfSPtr = Frame::ITRF();
+
+        if (IsFrame(aFromFrameSPtr, gcrfSPtr) && IsFrame(aToFrameSPtr, itrfSPtr))
+        {
+            return ComputeInterpolatedGcrfToItrfTransform(anInstant);
+        }
+
+        if (IsFrame(aFromFrameSPtr, itrfSPtr) && IsFrame(aToFrameSPtr, gcrfSPtr))
+        {
+            return ComputeInterpolatedGcrfToItrfTransform(anInstant).getInverse();
+        }
+    }
+
+    return aFromFrameSPtr->getTransformTo(aToFrameSPtr, anInstant);
+}
+
+}  // namespace state
+}  // namespace trajectory
+}  // namespace astrodynamics
+}  // namespace ostk
@@ -0,0 +1,116 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/LazyState.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/TransformCache.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace trajectory
+{
+namespace state
+{
+
+LazyState::LazyState(const State& aState, const Shared<const Frame>& aFrameSPtr)
+    : state_(aState),
+      frameSPtr_(aFrameSPtr),
+      isIdentity_(false),
+      transform_(Transform::Undefined()),
+      positionIsComputed_(false),
+      velocityIsComputed_(false),
+      positionCoordinates_(Vector3d::Zero()),
+      velocityCoordinates_(Vector3d::Zero()),
+      stateInFrame_(State::Undefined())
+{
+    if ((aFrameSPtr == nullptr) || (!aFrameSPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    if (!aState.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State");
+    }
+
+    this->isIdentity_ = (aState.accessFrame() == aFrameSPtr);
+}
+
+const State& LazyState::accessSourceState() const
+{
+    return this->state_;
+}
+
+const Instant& LazyState::accessInstant() const
+{
+    return this->state_.accessInstant();
+}
+
+const Shared<const Frame>& LazyState::accessFrame() const
+{
+    return this->frameSPtr_;
+}
+
+bool LazyState::isTransformComputed() const
+{
+    return this->transform_.isDefined();
+}
+
+const Vector3d& LazyState::accessPositionCoordinates() const
+{
+    if (!this->positionIsComputed_)
+    {
+        const Vector3d positionCoordinates = this->state_.accessPositionCoordinates();
+
+        this->positionCoordinates_ =
+            this->isIdentity_ ? positionCoordinates : this->accessTransform().applyToPosition(positionCoordinates);
+        this->positionIsComputed_ = true;
+    }
+
+    return this->positionCoordinates_;
+}
+
+const Vector3d& LazyState::accessVelocityCoordinates() const
+{
+    if (!this->velocityIsComputed_)
+    {
+        const Vector3d positionCoordinates = this->state_.accessPositionCoordinates();
+        const Vector3d velocityCoordinates = this->state_.accessVelocityCoordinates();
+
+        this->velocityCoordinates_ =
+            this->isIdentity_ ? velocityCoordinates
+                              : this->accessTransform().applyToVelocity(positionCoordinates, velocityCoordinates);
+        this->velocityIsComputed_ = true;
+    }
+
+    return this->velocityCoordinates_;
+}
+
+const State& LazyState::accessState() const
+{
+    if (!this->stateInFrame_.isDefined())
+    {
+        // The transform is shared with the coordinate accessors through the transform cache
+        this->stateInFrame_ = this->state_.inFrame(this->frameSPtr_);
+    }
+
+    return this->stateInFrame_;
+}
+
+const Transform& LazyState::accessTransform() const
+{
+    if (!this->transform_.isDefined())
+    {
+        this->transform_ =
+            TransformCache::Get(this->state_.accessFrame(), this->frameSPtr_, this->state_.accessInstant());
+    }
+
+    return this->transform_;
+}
+
+}  // namespace state
+}  // namespace trajectory
+}  // namespace astrodynamics
+}  // namespace ostk
@@ -1,12 +1,29 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <limits>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
 #include <boost/numeric/odeint.hpp>
 #include <boost/numeric/odeint/external/eigen/eigen.hpp>
 
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/EventCondition/BooleanCondition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/EventCondition/RealCondition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/EpochTime.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/RootSolver.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Tracer.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/AttitudeQuaternion.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/NumericalSolver.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/StateBuilder.hpp>
 
@@ -21,104 +38,2051 @@ namespace state
 
 using namespace boost::numeric::odeint;
 
+using ostk::mathematics::object::Vector3d;
+
 using ostk::physics::time::Duration;
 
+using ostk::astrodynamics::EpochTime;
+using ostk::astrodynamics::eventcondition::BooleanCondition;
+using ostk::astrodynamics::eventcondition::RealCondition;
 using ostk::astrodynamics::RootSolver;
+using ostk::astrodynamics::Tracer;
 using ostk::astrodynamics::trajectory::StateBuilder;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::AttitudeQuaternion;
 
 typedef runge_kutta_dopri5<NumericalSolver::StateVector> dense_stepper_type_5;
 
-NumericalSolver::NumericalSolver(
-    const NumericalSolver::LogType& aLogType,
-    const NumericalSolver::StepperType& aStepperType,
-    const Real& aTimeStep,
-    const Real& aRelativeTolerance,
-    const Real& anAbsoluteTolerance,
-    const RootSolver& aRootSolver
+typedef runge_kutta4<NumericalSolver::StateVector> stepper_type_4;
+typedef runge_kutta_cash_karp54<NumericalSolver::StateVector> error_stepper_type_54;
+typedef runge_kutta_fehlberg78<NumericalSolver::StateVector> error_stepper_type_78;
+
+typedef adams_bashforth_moulton<8, NumericalSolver::StateVector> multistep_stepper_type_8;
+
+typedef runge_kutta4<MatrixXd, double, MatrixXd, double, vector_space_algebra> ensemble_stepper_type_4;
+typedef runge_kutta_cash_karp54<MatrixXd, double, MatrixXd, double, vector_space_algebra> ensemble_stepper_type_54;
+typedef runge_kutta_dopri5<MatrixXd, double, MatrixXd, double, vector_space_algebra> ensemble_stepper_type_5;
+typedef runge_kutta_fehlberg78<MatrixXd, double, MatrixXd, double, vector_space_algebra> ensemble_stepper_type_78;
+
+/// @brief Two-stage Gauss-Legendre collocation stepper
+///
+/// Implicit, fourth order, symplectic and time-reversible: on conservative dynamics the energy error stays bounded
+/// instead of drifting, whatever the number of steps. Stage equations are solved by fixed-point iteration.
+class GaussLegendreStepper
+{
+   public:
+    typedef stepper_tag stepper_category;
+
+    GaussLegendreStepper()
+    {
+    }
+
+    void do_step(
+        const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+        NumericalSolver::StateVector& aStateVector,
+        const NumericalSolver::StateVector& aDerivative,
+        const double& aTime,
+        const double& aStepSize
+    )
+    {
+        static const double sqrt3 = std::sqrt(3.0);
+
+        static const double c1 = 0.5 - sqrt3 / 6.0;
+        static const double c2 = 0.5 + sqrt3 / 6.0;
+        static const double a11 = 0.25;
+        static const double a12 = 0.25 - sqrt3 / 6.0;
+        static const double a21 = 0.25 + sqrt3 / 6.0;
+        static const double a22 = 0.25;
+
+        static const Size maximumIterationCount = 50;
+        static const double relativeTolerance = 1.0e-14;
+
+        // Stage derivatives are initialized with the derivative at the start of the step
+
+        firstStageDerivative_ = aDerivative;
+        secondStageDerivative_ = aDerivative;
+
+        for (Size i = 0; i < maximumIterationCount; ++i)
+        {
+            firstStageState_ =
+                aStateVector + aStepSize * (a11 * firstStageDerivative_ + a12 * secondStageDerivative_);
+            secondStageState_ =
+                aStateVector + aStepSize * (a21 * firstStageDerivative_ + a22 * secondStageDerivative_);
+
+            previousFirstStageDerivative_ = firstStageDerivative_;
+            previousSecondStageDerivative_ = secondStageDerivative_;
+
+            aSystemOfEquations(firstStageState_, firstStageDerivative_, aTime + c1 * aStepSize);
+            aSystemOfEquations(secondStageState_, secondStageDerivative_, aTime + c2 * aStepSize);
+
+            const double increment = std::abs(aStepSize) *
+                                     std::max((firstStageDerivative_ - previousFirstStageDerivative_).norm(),
+                                              (secondStageDerivative_ - previousSecondStageDerivative_).norm());
+
+            if (increment <= relativeTolerance * std::max(1.0, aStateVector.norm()))
+            {
+                break;
+            }
+        }
+
+        aStateVector += (0.5 * aStepSize) * (firstStageDerivative_ + secondStageDerivative_);
+    }
+
+   private:
+    NumericalSolver::StateVector firstStageState_;
+    NumericalSolver::StateVector secondStageState_;
+    NumericalSolver::StateVector firstStageDerivative_;
+    NumericalSolver::StateVector secondStageDerivative_;
+    NumericalSolver::StateVector previousFirstStageDerivative_;
+    NumericalSolver::StateVector previousSecondStageDerivative_;
+};
+
+/// @brief Fourth order Runge-Kutta-Munthe-Kaas stepper
+///
+/// Integrates the attitude quaternion of the state (if any) on the unit quaternion manifold, and the other coordinates
+/// with the classic fourth order Runge-Kutta scheme (of which it is the Lie group generalization).
+///
+/// With q the attitude quaternion, the dynamics are written q' = A q, where A = q' q* is a pure quaternion (the
+/// derivative of a unit quaternion is orthogonal to it). Stages move along q = exp(u) q0, the algebra element u being
+/// integrated through the inverse derivative of the exponential map. Quaternions stay normalized to round off, whatever
+/// the step, hence attitude dynamics do not need small steps or renormalization to stay accurate.
+class MuntheKaasStepper
+{
+   public:
+    typedef stepper_tag stepper_category;
+
+    /// @brief Constructor
+    ///
+    /// @param aState A state, whose attitude quaternion (AttitudeQuaternion::Default) is integrated on the unit
+    /// quaternion manifold
+    MuntheKaasStepper(const State& aState)
+        : quaternionIndex_(
+              aState.accessCoordinateBroker()->hasSubset(AttitudeQuaternion::Default())
+                  ? aState.accessCoordinateBroker()->getSubsetIndex(AttitudeQuaternion::Default())
+                  : MuntheKaasStepper::NoQuaternionIndex
+          )
+    {
+    }
+
+    void do_step(
+        const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+        NumericalSolver::StateVector& aStateVector,
+        const NumericalSolver::StateVector& aDerivative,
+        const double& aTime,
+        const double& aStepSize
+    )
+    {
+        if (quaternionIndex_ == MuntheKaasStepper::NoQuaternionIndex)
+        {
+            rungeKutta4Stepper_.do_step(aSystemOfEquations, aStateVector, aDerivative, aTime, aStepSize);
+            return;
+        }
+
+        const Eigen::Quaterniond initialQuaternion = MuntheKaasStepper::GetQuaternion(aStateVector, quaternionIndex_);
+
+        // Stage algebra elements and increments, with the classic Runge-Kutta tableau
+
+        const Vector3d firstIncrement = aStepSize * this->getAlgebraElement(aStateVector, aDerivative);
+
+        stageState_ = aStateVector + (0.5 * aStepSize) * aDerivative;
+        this->setStageQuaternion(initialQuaternion, 0.5 * firstIncrement);
+        aSystemOfEquations(stageState_, secondStageDerivative_, aTime + 0.5 * aStepSize);
+        const Vector3d secondIncrement =
+            aStepSize * MuntheKaasStepper::InverseExponentialDerivative(
+                            0.5 * firstIncrement, this->getAlgebraElement(stageState_, secondStageDerivative_)
+                        );
+
+        stageState_ = aStateVector + (0.5 * aStepSize) * secondStageDerivative_;
+        this->setStageQuaternion(initialQuaternion, 0.5 * secondIncrement);
+        aSystemOfEquations(stageState_, thirdStageDerivative_, aTime + 0.5 * aStepSize);
+        const Vector3d thirdIncrement =
+            aStepSize * MuntheKaasStepper::InverseExponentialDerivative(
+                            0.5 * secondIncrement, this->getAlgebraElement(stageState_, thirdStageDerivative_)
+                        );
+
+        stageState_ = aStateVector + aStepSize * thirdStageDerivative_;
+        this->setStageQuaternion(initialQuaternion, thirdIncrement);
+        aSystemOfEquations(stageState_, fourthStageDerivative_, aTime + aStepSize);
+        const Vector3d fourthIncrement =
+            aStepSize * MuntheKaasStepper::InverseExponentialDerivative(
+                            thirdIncrement, this->getAlgebraElement(stageState_, fourthStageDerivative_)
+                        );
+
+        aStateVector += (aStepSize / 6.0) * (aDerivative + 2.0 * secondStageDerivative_ +
+                                             2.0 * thirdStageDerivative_ + fourthStageDerivative_);
+
+        MuntheKaasStepper::SetQuaternion(
+            aStateVector,
+            quaternionIndex_,
+            MuntheKaasStepper::Exponential(
+                (firstIncrement + 2.0 * secondIncrement + 2.0 * thirdIncrement + fourthIncrement) / 6.0
+            ) * initialQuaternion
+        );
+    }
+
+   private:
+    static constexpr Index NoQuaternionIndex = std::numeric_limits<Index>::max();
+
+    Index quaternionIndex_;
+
+    stepper_type_4 rungeKutta4Stepper_;  // Without attitude quaternion
+
+    NumericalSolver::StateVector stageState_;
+    NumericalSolver::StateVector secondStageDerivative_;
+    NumericalSolver::StateVector thirdStageDerivative_;
+    NumericalSolver::StateVector fourthStageDerivative_;
+
+    // Algebra element A = q' q*, as a vector
+
+    Vector3d getAlgebraElement(
+        const NumericalSolver::StateVector& aStateVector, const NumericalSolver::StateVector& aDerivative
+    ) const
+    {
+        return (MuntheKaasStepper::GetQuaternion(aDerivative, quaternionIndex_) *
+                MuntheKaasStepper::GetQuaternion(aStateVector, quaternionIndex_).conjugate())
+            .vec();
+    }
+
+    void setStageQuaternion(const Eigen::Quaterniond& anInitialQuaternion, const Vector3d& anAlgebraElement)
+    {
+        MuntheKaasStepper::SetQuaternion(
+            stageState_, quaternionIndex_, MuntheKaasStepper::Exponential(anAlgebraElement) * anInitialQuaternion
+        );
+    }
+
+    // Coordinates are stored in XYZS order, as Eigen quaternion coefficients
+
+    static Eigen::Quaterniond GetQuaternion(const NumericalSolver::StateVector& aStateVector, const Index& anIndex)
+    {
+        return Eigen::Quaterniond(Eigen::Vector4d(aStateVector.segment<4>(anIndex)));
+    }
+
+    static void SetQuaternion(
+        NumericalSolver::StateVector& aStateVector, const Index& anIndex, const Eigen::Quaterniond& aQuaternion
+    )
+    {
+        aStateVector.segment<4>(anIndex) = aQuaternion.coeffs();
+    }
+
+    // Exponential of a pure quaternion
+
+    static Eigen::Quaterniond Exponential(const Vector3d& anAlgebraElement)
+    {
+        const double angle = anAlgebraElement.norm();
+
+        if (angle < 1.0e-12)
+        {
+            return Eigen::Quaterniond(1.0, anAlgebraElement.x(), anAlgebraElement.y(), anAlgebraElement.z())
+                .normalized();
+        }
+
+        const Vector3d axis = (std::sin(angle) / angle) * anAlgebraElement;
+
+        return Eigen::Quaterniond(std::cos(angle), axis.x(), axis.y(), axis.z());
+    }
+
+    // Inverse derivative of the exponential map, truncated to the terms required at fourth order. The bracket of pure
+    // quaternions is [u, v] = u v - v u = 2 u x v.
+
+    static Vector3d InverseExponentialDerivative(const Vector3d& anAlgebraElement, const Vector3d& aVector)
+    {
+        const Vector3d bracket = 2.0 * anAlgebraElement.cross(aVector);
+
+        return aVector - 0.5 * bracket + (2.0 / 12.0) * anAlgebraElement.cross(bracket);
+    }
+};
+
+template <class Stepper>
+struct IsMultistepStepper : std::false_type
+{
+};
+
+template <size_t StepCount, class... Types>
+struct IsMultistepStepper<adams_bashforth_moulton<StepCount, Types...>> : std::true_type
+{
+};
+
+/// @brief Dense output for steppers without native dense output
+///
+/// Steps are taken with the underlying (controlled, fixed step or multistep) stepper. States within the last step are
+/// interpolated with a cubic Hermite polynomial, built from the states and derivatives at both ends of the step, or
+/// recomputed with a single step stepper. Derivatives are only computed when needed: single step steppers reuse them
+/// as their first stage, multistep steppers only need them to interpolate.
+template <class Stepper>
+class HermiteDenseOutput
+{
+   public:
+    HermiteDenseOutput(const Stepper& aStepper)
+        : stepper_(aStepper),
+          systemOfEquationsPtr_(nullptr),
+          previousTime_(0.0),
+          currentTime_(0.0),
+          stepSize_(0.0),
+          rejectedStepCount_(0),
+          previousDerivativeIsComputed_(false),
+          currentDerivativeIsComputed_(false)
+    {
+    }
+
+    void initialize(const NumericalSolver::StateVector& aStateVector, const double& aTime, const double& aStepSize)
+    {
+        currentState_ = aStateVector;
+        currentTime_ = aTime;
+        stepSize_ = aStepSize;
+        currentDerivativeIsComputed_ = false;
+    }
+
+    std::pair<double, double> do_step(const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations)
+    {
+        systemOfEquationsPtr_ = &aSystemOfEquations;
+
+        if constexpr (!IsMultistepStepper<Stepper>::value)
+        {
+            this->computeCurrentDerivative();
+        }
+
+        previousState_ = currentState_;
+        previousTime_ = currentTime_;
+        std::swap(previousDerivative_, currentDerivative_);
+        previousDerivativeIsComputed_ = currentDerivativeIsComputed_;
+        currentDerivativeIsComputed_ = false;
+
+        if constexpr (std::is_same<typename Stepper::stepper_category, controlled_stepper_tag>::value)
+        {
+            controlled_step_result stepResult = fail;
+
+            while (stepResult == fail)
+            {
+                stepResult =
+                    stepper_.try_step(aSystemOfEquations, currentState_, previousDerivative_, currentTime_, stepSize_);
+
+                if (stepResult == fail)
+                {
+                    ++rejectedStepCount_;
+                }
+            }
+        }
+        else if constexpr (IsMultistepStepper<Stepper>::value)
+        {
+            // Multistep steppers keep their own history of derivatives, and bootstrap it on their first steps
+
+            stepper_.do_step(aSystemOfEquations, currentState_, currentTime_, stepSize_);
+            currentTime_ += stepSize_;
+        }
+        else
+        {
+            stepper_.do_step(aSystemOfEquations, currentState_, previousDerivative_, currentTime_, stepSize_);
+            currentTime_ += stepSize_;
+        }
+
+        return {previousTime_, currentTime_};
+    }
+
+    void calc_state(const double& aTime, NumericalSolver::StateVector& aStateVector) const
+    {
+        this->computePreviousDerivative();
+        this->computeCurrentDerivative();
+
+        const double stepSize = currentTime_ - previousTime_;
+        const double theta = (aTime - previousTime_) / stepSize;
+        const double theta2 = theta * theta;
+        const double theta3 = theta2 * theta;
+
+        aStateVector = (2.0 * theta3 - 3.0 * theta2 + 1.0) * previousState_ +
+                       ((theta3 - 2.0 * theta2 + theta) * stepSize) * previousDerivative_ +
+                       (-2.0 * theta3 + 3.0 * theta2) * currentState_ +
+                       ((theta3 - theta2) * stepSize) * currentDerivative_;
+    }
+
+    void calc_step_state(
+        const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+        const double& aTime,
+        NumericalSolver::StateVector& aStateVector
+    )
+    {
+        if (aTime == currentTime_)
+        {
+            aStateVector = currentState_;
+            return;
+        }
+
+        aStateVector = previousState_;
+
+        if (aTime == previousTime_)
+        {
+            return;
+        }
+
+        if constexpr (std::is_same<typename Stepper::stepper_category, controlled_stepper_tag>::value)
+        {
+            integrate_adaptive(stepper_, aSystemOfEquations, aStateVector, previousTime_, aTime, aTime - previousTime_);
+        }
+        else if constexpr (IsMultistepStepper<Stepper>::value)
+        {
+            // A partial step would break the constant step history, it is taken with a high order single step
+            // stepper instead
+
+            this->computePreviousDerivative();
+
+            error_stepper_type_78().do_step(
+                aSystemOfEquations, aStateVector, previousDerivative_, previousTime_, aTime - previousTime_
+            );
+        }
+        else
+        {
+            stepper_.do_step(
+                aSystemOfEquations, aStateVector, previousDerivative_, previousTime_, aTime - previousTime_
+            );
+        }
+    }
+
+    const NumericalSolver::StateVector& current_state() const
+    {
+        return currentState_;
+    }
+
+    double current_time() const
+    {
+        return currentTime_;
+    }
+
+    const NumericalSolver::StateVector& previous_state() const
+    {
+        return previousState_;
+    }
+
+    double previous_time() const
+    {
+        return previousTime_;
+    }
+
+    double current_time_step() const
+    {
+        return stepSize_;
+    }
+
+    Size rejected_step_count() const
+    {
+        return rejectedStepCount_;
+    }
+
+   private:
+    Stepper stepper_;
+    const NumericalSolver::SystemOfEquationsWrapper* systemOfEquationsPtr_;
+
+    NumericalSolver::StateVector previousState_;
+    NumericalSolver::StateVector currentState_;
+    mutable NumericalSolver::StateVector previousDerivative_;
+    mutable NumericalSolver::StateVector currentDerivative_;
+    double previousTime_;
+    double currentTime_;
+    double stepSize_;
+    Size rejectedStepCount_;
+    mutable bool previousDerivativeIsComputed_;
+    mutable bool currentDerivativeIsComputed_;
+
+    void computePreviousDerivative() const
+    {
+        if (!previousDerivativeIsComputed_)
+        {
+            previousDerivative_.resize(previousState_.size());
+            (*systemOfEquationsPtr_)(previousState_, previousDerivative_, previousTime_);
+            previousDerivativeIsComputed_ = true;
+        }
+    }
+
+    void computeCurrentDerivative() const
+    {
+        if (!currentDerivativeIsComputed_)
+        {
+            currentDerivative_.resize(currentState_.size());
+            (*systemOfEquationsPtr_)(currentState_, currentDerivative_, currentTime_);
+            currentDerivativeIsComputed_ = true;
+        }
+    }
+};
+
+/// @brief Calculate the state at a time within the last step of a dense stepper, with its native dense output
+template <class DenseStepper>
+void calculateStepState(
+    DenseStepper& aDenseStepper,
+    [[maybe_unused]] const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+    const double& aTime,
+    NumericalSolver::StateVector& aStateVector
 )
-    : MathNumericalSolver(aLogType, aStepperType, aTimeStep, aRelativeTolerance, anAbsoluteTolerance),
-      rootSolver_(aRootSolver),
-      observedStates_(),
-      stateLogger_(nullptr)
 {
+    aDenseStepper.calc_state(aTime, aStateVector);
 }
 
-const Array<State>& NumericalSolver::accessObservedStates() const
+/// @brief Calculate the state at a time within the last step of a Hermite dense stepper, with the stepper itself
+template <class Stepper>
+void calculateStepState(
+    HermiteDenseOutput<Stepper>& aDenseStepper,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+    const double& aTime,
+    NumericalSolver::StateVector& aStateVector
+)
 {
-    if (!this->isDefined())
+    aDenseStepper.calc_step_state(aSystemOfEquations, aTime, aStateVector);
+}
+
+/// @brief Record an accepted step in statistics
+void recordStep(NumericalSolver::Statistics& aStatistics, const double& aStepSize, const Size& aRejectedStepCount)
+{
+    const Duration stepDuration = Duration::Seconds(std::abs(aStepSize));
+
+    aStatistics.stepCount++;
+    aStatistics.rejectedStepCount += aRejectedStepCount;
+    aStatistics.cumulativeStepDuration += stepDuration;
+
+    if (!aStatistics.minimumStepDuration.isDefined() || (stepDuration < aStatistics.minimumStepDuration))
     {
-        throw ostk::core::error::runtime::Undefined("NumericalSolver");
+        aStatistics.minimumStepDuration = stepDuration;
     }
 
-    return observedStates_;
+    if (!aStatistics.maximumStepDuration.isDefined() || (stepDuration > aStatistics.maximumStepDuration))
+    {
+        aStatistics.maximumStepDuration = stepDuration;
+    }
 }
 
-RootSolver NumericalSolver::getRootSolver() const
+/// @brief Number of step attempts of a Runge-Kutta stepper, inferred from its number of evaluations
+///
+/// Each attempt evaluates every stage of the stepper. The first same as last (FSAL) Dormand-Prince stepper reuses the
+/// last stage of an attempt as the first stage of the next one, hence only evaluates the initial derivative once in
+/// addition to its six evaluations per attempt.
+Size stepAttemptCount(const NumericalSolver::StepperType& aStepperType, const Size& anEvaluationCount)
 {
-    if (!this->isDefined())
+    switch (aStepperType)
     {
-        throw ostk::core::error::runtime::Undefined("NumericalSolver");
+        case NumericalSolver::StepperType::RungeKutta4:
+            return anEvaluationCount / 4;
+
+        case NumericalSolver::StepperType::RungeKuttaCashKarp54:
+        case NumericalSolver::StepperType::RungeKuttaDopri5:
+            return anEvaluationCount / 6;
+
+        case NumericalSolver::StepperType::RungeKuttaFehlberg78:
+            return anEvaluationCount / 13;
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Stepper type");
     }
+}
 
-    return rootSolver_;
+/// @brief Take a step with a native dense stepper (Dormand-Prince), recording it in statistics
+template <class DenseStepper>
+std::pair<double, double> takeStep(
+    DenseStepper& aDenseStepper,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+    NumericalSolver::Statistics* aStatisticsPtr
+)
+{
+    if (aStatisticsPtr == nullptr)
+    {
+        return aDenseStepper.do_step(aSystemOfEquations);
+    }
+
+    // Rejected attempts are hidden by the dense stepper, they are inferred from the evaluations of the step
+
+    const Size evaluationCount = aStatisticsPtr->evaluationCount;
+
+    const std::pair<double, double> step = aDenseStepper.do_step(aSystemOfEquations);
+
+    const Size attemptCount = std::max<Size>(
+        stepAttemptCount(
+            NumericalSolver::StepperType::RungeKuttaDopri5, aStatisticsPtr->evaluationCount - evaluationCount
+        ),
+        1
+    );
+
+    recordStep(*aStatisticsPtr, step.second - step.first, attemptCount - 1);
+
+    return step;
 }
 
-Array<State> NumericalSolver::getObservedStates() const
+/// @brief Take a step with a Hermite dense stepper, recording it in statistics
+template <class Stepper>
+std::pair<double, double> takeStep(
+    HermiteDenseOutput<Stepper>& aDenseStepper,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+    NumericalSolver::Statistics* aStatisticsPtr
+)
 {
-    return accessObservedStates();
+    const Size rejectedStepCount = aDenseStepper.rejected_step_count();
+
+    const std::pair<double, double> step = aDenseStepper.do_step(aSystemOfEquations);
+
+    if (aStatisticsPtr != nullptr)
+    {
+        recordStep(
+            *aStatisticsPtr, step.second - step.first, aDenseStepper.rejected_step_count() - rejectedStepCount
+        );
+    }
+
+    return step;
 }
 
-Array<State> NumericalSolver::integrateTime(
-    const State& aState,
-    const Array<Instant>& anInstantArray,
-    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations
+/// @brief Integrate with a dense stepper through monotonic durations, calculating the states at each duration within
+/// the stepper steps
+template <class DenseStepper>
+Array<NumericalSolver::StateVector> integrateDenseDurations(
+    DenseStepper& aDenseStepper,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+    const NumericalSolver::StateVector& aStateVector,
+    const Array<Real>& aDurationArray,
+    const double& aSignedTimeStep,
+    NumericalSolver::Statistics* aStatisticsPtr
 )
 {
-    const Array<Real> durationArray = anInstantArray.map<Real>(
-        [&aState](const Instant& anInstant) -> Real
+    const bool isForward = aSignedTimeStep > 0.0;
+
+    aDenseStepper.initialize(aStateVector, 0.0, aSignedTimeStep);
+
+    NumericalSolver::StateVector stateVector = aStateVector;
+
+    Array<NumericalSolver::StateVector> stateVectors;
+    stateVectors.reserve(aDurationArray.getSize());
+
+    for (const Real& duration : aDurationArray)
+    {
+        while (isForward ? (aDenseStepper.current_time() < duration) : (aDenseStepper.current_time() > duration))
         {
-            return (anInstant - aState.accessInstant()).inSeconds();
+            takeStep(aDenseStepper, aSystemOfEquations, aStatisticsPtr);
         }
-    );
 
-    const Array<NumericalSolver::Solution> solutions =
-        MathNumericalSolver::integrateDuration(aState.accessCoordinates(), durationArray, aSystemOfEquations);
+        if (duration != 0.0)
+        {
+            calculateStepState(aDenseStepper, aSystemOfEquations, duration, stateVector);
+        }
 
-    Array<State> states;
-    states.reserve(solutions.getSize());
-    for (Index i = 0; i < solutions.getSize(); ++i)
+        stateVectors.add(stateVector);
+    }
+
+    return stateVectors;
+}
+
+/// @brief Delivery of batches of states to a logger, on the calling thread or on a background thread
+///
+/// Logger calls are serialized. Exceptions thrown by the logger propagate to the caller when delivering on the calling
+/// thread, and are kept until the next flush otherwise.
+class NumericalSolver::StateBatchLoggerDelivery
+{
+   public:
+    StateBatchLoggerDelivery(
+        const NumericalSolver::StateBatchLogger& aStateBatchLogger, const Size& aBatchSize, const bool isAsynchronous
+    )
+        : stateBatchLogger_(aStateBatchLogger),
+          batchSize_(aBatchSize),
+          isAsynchronous_(isAsynchronous),
+          isDelivering_(false),
+          isStopping_(false),
+          exceptionPtr_(nullptr)
     {
-        const NumericalSolver::Solution& solution = solutions.at(i);
-        const State state = {
-            anInstantArray[i],
-            solution.first,
-            aState.accessFrame(),
-            aState.accessCoordinateBroker(),
-        };
-        states.add(state);
+        if (isAsynchronous_)
+        {
+            thread_ = std::thread(&StateBatchLoggerDelivery::run, this);
+        }
     }
 
-    return states;
+    ~StateBatchLoggerDelivery()
+    {
+        if (thread_.joinable())
+        {
+            {
+                const std::lock_guard<std::mutex> lock(mutex_);
+                isStopping_ = true;
+            }
+
+            condition_.notify_all();
+
+            thread_.join();
+        }
+    }
+
+    const Size& accessBatchSize() const
+    {
+        return batchSize_;
+    }
+
+    void deliver(Array<State>&& aStateBatch)
+    {
+        if (!isAsynchronous_)
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+
+            stateBatchLogger_(aStateBatch);
+
+            return;
+        }
+
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+            pendingStateBatches_.push_back(std::move(aStateBatch));
+        }
+
+        condition_.notify_all();
+    }
+
+    void flush()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        condition_.wait(
+            lock,
+            [this]() -> bool
+            {
+                return pendingStateBatches_.empty() && (!isDelivering_);
+            }
+        );
+
+        if (exceptionPtr_ != nullptr)
+        {
+            const std::exception_ptr exceptionPtr = exceptionPtr_;
+            exceptionPtr_ = nullptr;
+
+            std::rethrow_exception(exceptionPtr);
+        }
+    }
+
+   private:
+    NumericalSolver::StateBatchLogger stateBatchLogger_;
+    Size batchSize_;
+    bool isAsynchronous_;
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::deque<Array<State>> pendingStateBatches_;
+    bool isDelivering_;
+    bool isStopping_;
+    std::exception_ptr exceptionPtr_;
+    std::thread thread_;
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        while (true)
+        {
+            condition_.wait(
+                lock,
+                [this]() -> bool
+                {
+                    return isStopping_ || (!pendingStateBatches_.empty());
+                }
+            );
+
+            // Pending batches are still delivered once stopping
+
+            if (pendingStateBatches_.empty())
+            {
+                return;
+            }
+
+            const Array<State> stateBatch = std::move(pendingStateBatches_.front());
+            pendingStateBatches_.pop_front();
+
+            isDelivering_ = true;
+
+            lock.unlock();
+
+            std::exception_ptr exceptionPtr = nullptr;
+
+            try
+            {
+                stateBatchLogger_(stateBatch);
+            }
+            catch (...)
+            {
+                exceptionPtr = std::current_exception();
+            }
+
+            lock.lock();
+
+            if ((exceptionPtr != nullptr) && (exceptionPtr_ == nullptr))
+            {
+                exceptionPtr_ = exceptionPtr;
+            }
+
+            isDelivering_ = false;
+
+            condition_.notify_all();
+        }
+    }
+};
+
+/// @brief Deliver the last batch of logged states when an integration ends, including when it fails
+class StateBatchDeliveryGuard
+{
+   public:
+    StateBatchDeliveryGuard(const std::function<void()>& aDeliveryFunction)
+        : deliveryFunction_(aDeliveryFunction),
+          uncaughtExceptionCount_(std::uncaught_exceptions())
+    {
+    }
+
+    ~StateBatchDeliveryGuard() noexcept(false)
+    {
+        if (std::uncaught_exceptions() == uncaughtExceptionCount_)
+        {
+            deliveryFunction_();
+
+            return;
+        }
+
+        // Unwinding from a failed integration, whose failure takes precedence over failures of the logger
+
+        try
+        {
+            deliveryFunction_();
+        }
+        catch (...)
+        {
+        }
+    }
+
+   private:
+    std::function<void()> deliveryFunction_;
+    int uncaughtExceptionCount_;
+};
+
+class NumericalSolver::Session::Stepper
+{
+   public:
+    Stepper(
+        const NumericalSolver& aNumericalSolver,
+        const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+        const State& aState
+    )
+        : stepperType_(aNumericalSolver.getStepperType()),
+          systemOfEquations_(aSystemOfEquations),
+          stateBuilder_(aState),
+          startInstant_(aState.accessInstant()),
+          time_(0.0),
+          stepSize_(aNumericalSolver.getTimeStep()),
+          stateVector_(aState.accessCoordinates()),
+          denseStepper_(make_dense_output(
+              double(aNumericalSolver.getAbsoluteTolerance()),
+              double(aNumericalSolver.getRelativeTolerance()),
+              dense_stepper_type_5()
+          )),
+          cashKarpStepper_(make_controlled(
+              double(aNumericalSolver.getAbsoluteTolerance()),
+              double(aNumericalSolver.getRelativeTolerance()),
+              error_stepper_type_54()
+          )),
+          fehlbergStepper_(make_controlled(
+              double(aNumericalSolver.getAbsoluteTolerance()),
+              double(aNumericalSolver.getRelativeTolerance()),
+              error_stepper_type_78()
+          ))
+    {
+        if (stepperType_ == NumericalSolver::StepperType::RungeKuttaDopri5)
+        {
+            denseStepper_.initialize(stateVector_, time_, stepSize_);
+        }
+    }
+
+    State integrateTo(const Instant& anInstant)
+    {
+        this->integrateToTime((anInstant - startInstant_).inSeconds());
+
+        return stateBuilder_.build(anInstant, stateVector_);
+    }
+
+   private:
+    const NumericalSolver::StepperType stepperType_;
+    const NumericalSolver::SystemOfEquationsWrapper systemOfEquations_;
+    const StateBuilder stateBuilder_;
+    const Instant startInstant_;
+
+    double time_;
+    double stepSize_;
+    NumericalSolver::StateVector stateVector_;
+
+    stepper_type_4 rungeKuttaStepper_;
+    result_of::make_dense_output<dense_stepper_type_5>::type denseStepper_;
+    result_of::make_controlled<error_stepper_type_54>::type cashKarpStepper_;
+    result_of::make_controlled<error_stepper_type_78>::type fehlbergStepper_;
+
+    void integrateToTime(const double& aTime)
+    {
+        if (aTime < time_)
+        {
+            throw ostk::core::error::RuntimeError("Cannot integrate backward in time within a session.");
+        }
+
+        if (aTime == time_)
+        {
+            return;
+        }
+
+        switch (stepperType_)
+        {
+            case NumericalSolver::StepperType::RungeKuttaDopri5:
+            {
+                while (denseStepper_.current_time() < aTime)
+                {
+                    denseStepper_.do_step(systemOfEquations_);
+                }
+
+                denseStepper_.calc_state(aTime, stateVector_);
+                time_ = aTime;
+                break;
+            }
+
+            case NumericalSolver::StepperType::RungeKutta4:
+            {
+                while (time_ < aTime)
+                {
+                    const double stepSize = std::min(stepSize_, aTime - time_);
+
+                    rungeKuttaStepper_.do_step(systemOfEquations_, stateVector_, time_, stepSize);
+                    time_ = (stepSize < stepSize_) ? aTime : (time_ + stepSize);
+                }
+                break;
+            }
+
+            case NumericalSolver::StepperType::RungeKuttaCashKarp54:
+                integrateControlledTo(cashKarpStepper_, aTime);
+                break;
+
+            case NumericalSolver::StepperType::RungeKuttaFehlberg78:
+                integrateControlledTo(fehlbergStepper_, aTime);
+                break;
+
+            default:
+                throw ostk::core::error::runtime::Wrong("Stepper type");
+        }
+    }
+
+    template <class ControlledStepper>
+    void integrateControlledTo(ControlledStepper& aControlledStepper, const double& aTime)
+    {
+        while (time_ < aTime)
+        {
+            // Steps shortened to land on the target time do not override the natural step size
+
+            const bool stepIsShortened = (aTime - time_) < stepSize_;
+
+            double time = time_;
+            double stepSize = stepIsShortened ? (aTime - time_) : stepSize_;
+
+            if (aControlledStepper.try_step(systemOfEquations_, stateVector_, time, stepSize) == success)
+            {
+                time_ = stepIsShortened ? aTime : time;
+
+                if (!stepIsShortened || (stepSize > stepSize_))
+                {
+                    stepSize_ = stepSize;
+                }
+            }
+            else
+            {
+                stepSize_ = stepSize;
+            }
+        }
+    }
+};
+
+NumericalSolver::Session::Session(
+    const NumericalSolver& aNumericalSolver,
+    const State& aState,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations
+)
+    : state_(aState),
+      stepperUPtr_(nullptr)
+{
+    if (!aState.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State");
+    }
+
+    if (!aNumericalSolver.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Numerical Solver");
+    }
+
+    if (aNumericalSolver.getLongHorizonScheme() != NumericalSolver::LongHorizonScheme::Undefined)
+    {
+        throw ostk::core::error::runtime::ToBeImplemented("Sessions with a long horizon scheme");
+    }
+
+    stepperUPtr_ = std::make_unique<Stepper>(aNumericalSolver, aSystemOfEquations, aState);
+}
+
+NumericalSolver::Session::Session(Session&& aSession) = default;
+
+NumericalSolver::Session& NumericalSolver::Session::operator=(Session&& aSession) = default;
+
+NumericalSolver::Session::~Session() = default;
+
+const State& NumericalSolver::Session::accessState() const
+{
+    return state_;
+}
+
+State NumericalSolver::Session::integrateTime(const Instant& anInstant)
+{
+    const Tracer::Span span("NumericalSolver::Session::integrateTime", "integration");
+
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (anInstant < state_.accessInstant())
+    {
+        throw ostk::core::error::RuntimeError("Cannot integrate backward in time within a session.");
+    }
+
+    state_ = stepperUPtr_->integrateTo(anInstant);
+
+    return state_;
+}
+
+Duration NumericalSolver::Statistics::getMeanStepDuration() const
+{
+    if (stepCount == 0)
+    {
+        return Duration::Undefined();
+    }
+
+    return Duration::Seconds(cumulativeStepDuration.inSeconds() / double(stepCount));
+}
+
+NumericalSolver::NumericalSolver(
+    const NumericalSolver::LogType& aLogType,
+    const NumericalSolver::StepperType& aStepperType,
+    const Real& aTimeStep,
+    const Real& aRelativeTolerance,
+    const Real& anAbsoluteTolerance,
+    const RootSolver& aRootSolver
+)
+    : MathNumericalSolver(aLogType, aStepperType, aTimeStep, aRelativeTolerance, anAbsoluteTolerance),
+      rootSolver_(aRootSolver),
+      observedStateHistory_(),
+      observedStates_(),
+      observedStatesAreBuilt_(true),
+      stateLogger_(nullptr),
+      longHorizonScheme_(NumericalSolver::LongHorizonScheme::Undefined),
+      cancellationFlagSPtr_(nullptr),
+      statisticsSPtr_(nullptr),
+      statisticsMutexSPtr_(nullptr),
+      stateBatchLoggerDeliverySPtr_(nullptr),
+      stateBatch_(),
+      initialTimeStep_(Real::Undefined()),
+      finalTimeStep_(Real::Undefined())
+{
+}
+
+const Array<State>& NumericalSolver::accessObservedStates() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("NumericalSolver");
+    }
+
+    if (!observedStatesAreBuilt_)
+    {
+        observedStates_ = observedStateHistory_.getStates();
+        observedStatesAreBuilt_ = true;
+    }
+
+    return observedStates_;
+}
+
+const StateHistory& NumericalSolver::accessObservedStateHistory() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("NumericalSolver");
+    }
+
+    return observedStateHistory_;
+}
+
+RootSolver NumericalSolver::getRootSolver() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("NumericalSolver");
+    }
+
+    return rootSolver_;
+}
+
+NumericalSolver::LongHorizonScheme NumericalSolver::getLongHorizonScheme() const
+{
+    return longHorizonScheme_;
+}
+
+Array<State> NumericalSolver::getObservedStates() const
+{
+    return accessObservedStates();
+}
+
+void NumericalSolver::setCancellationFlag(const Shared<const std::atomic<bool>>& aCancellationFlagSPtr)
+{
+    cancellationFlagSPtr_ = aCancellationFlagSPtr;
+}
+
+void NumericalSolver::setInitialTimeStep(const Real& anInitialTimeStep)
+{
+    if (anInitialTimeStep.isDefined() && (anInitialTimeStep.isZero() || anInitialTimeStep.isInfinity()))
+    {
+        throw ostk::core::error::runtime::Wrong("Initial time step");
+    }
+
+    initialTimeStep_ = anInitialTimeStep;
+}
+
+Real NumericalSolver::getInitialTimeStep() const
+{
+    return initialTimeStep_;
+}
+
+Real NumericalSolver::getFinalTimeStep() const
+{
+    return finalTimeStep_;
+}
+
+void NumericalSolver::setStateBatchLogger(
+    const NumericalSolver::StateBatchLogger& aStateBatchLogger, const Size& aBatchSize, const bool isAsynchronous
+)
+{
+    if ((aStateBatchLogger != nullptr) && (aBatchSize == 0))
+    {
+        throw ostk::core::error::runtime::Wrong("Batch size");
+    }
+
+    stateBatch_.clear();
+
+    stateBatchLoggerDeliverySPtr_ =
+        (aStateBatchLogger != nullptr)
+            ? std::make_shared<StateBatchLoggerDelivery>(aStateBatchLogger, aBatchSize, isAsynchronous)
+            : nullptr;
+}
+
+void NumericalSolver::flushStateBatchLogger() const
+{
+    if (stateBatchLoggerDeliverySPtr_ != nullptr)
+    {
+        stateBatchLoggerDeliverySPtr_->flush();
+    }
+}
+
+bool NumericalSolver::isStatisticsEnabled() const
+{
+    return statisticsSPtr_ != nullptr;
+}
+
+NumericalSolver::Statistics NumericalSolver::getStatistics() const
+{
+    if (!this->isStatisticsEnabled())
+    {
+        throw ostk::core::error::RuntimeError("Statistics are not enabled.");
+    }
+
+    const std::lock_guard<std::mutex> lock(*statisticsMutexSPtr_);
+
+    return *statisticsSPtr_;
+}
+
+void NumericalSolver::enableStatistics()
+{
+    if (!this->isStatisticsEnabled())
+    {
+        statisticsSPtr_ = std::make_shared<Statistics>();
+        statisticsMutexSPtr_ = std::make_shared<std::mutex>();
+    }
+}
+
+void NumericalSolver::disableStatistics()
+{
+    statisticsSPtr_ = nullptr;
+    statisticsMutexSPtr_ = nullptr;
+}
+
+void NumericalSolver::resetStatistics()
+{
+    if (this->isStatisticsEnabled())
+    {
+        const std::lock_guard<std::mutex> lock(*statisticsMutexSPtr_);
+
+        *statisticsSPtr_ = Statistics();
+    }
+}
+
+void NumericalSolver::recordStatistics(const NumericalSolver::Statistics& aStatistics) const
+{
+    if (!this->isStatisticsEnabled())
+    {
+        return;
+    }
+
+    const std::lock_guard<std::mutex> lock(*statisticsMutexSPtr_);
+
+    Statistics& statistics = *statisticsSPtr_;
+
+    statistics.evaluationCount += aStatistics.evaluationCount;
+    statistics.stepCount += aStatistics.stepCount;
+    statistics.rejectedStepCount += aStatistics.rejectedStepCount;
+    statistics.cumulativeStepDuration += aStatistics.cumulativeStepDuration;
+
+    if (aStatistics.minimumStepDuration.isDefined() &&
+        (!statistics.minimumStepDuration.isDefined() ||
+         (aStatistics.minimumStepDuration < statistics.minimumStepDuration)))
+    {
+        statistics.minimumStepDuration = aStatistics.minimumStepDuration;
+    }
+
+    if (aStatistics.maximumStepDuration.isDefined() &&
+        (!statistics.maximumStepDuration.isDefined() ||
+         (aStatistics.maximumStepDuration > statistics.maximumStepDuration)))
+    {
+        statistics.maximumStepDuration = aStatistics.maximumStepDuration;
+    }
+}
+
+NumericalSolver NumericalSolver::getCallCopy() const
+{
+    // Built from the settings rather than copied, so that the observed states of previous integrations are not copied
+
+    NumericalSolver numericalSolver = {
+        this->getLogType(),
+        this->getStepperType(),
+        this->getTimeStep(),
+        this->getRelativeTolerance(),
+        this->getAbsoluteTolerance(),
+        rootSolver_,
+        stateLogger_,
+    };
+
+    numericalSolver.longHorizonScheme_ = longHorizonScheme_;
+    numericalSolver.cancellationFlagSPtr_ = cancellationFlagSPtr_;
+    numericalSolver.statisticsSPtr_ = statisticsSPtr_;
+    numericalSolver.statisticsMutexSPtr_ = statisticsMutexSPtr_;
+    numericalSolver.stateBatchLoggerDeliverySPtr_ = stateBatchLoggerDeliverySPtr_;
+    numericalSolver.initialTimeStep_ = initialTimeStep_;
+
+    return numericalSolver;
+}
+
+Array<State> NumericalSolver::integrateTime(
+    const State& aState,
+    const Array<Instant>& anInstantArray,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations
+)
+{
+    const Tracer::Span span("NumericalSolver::integrateTime", "integration");
+
+    // Statistics are accumulated locally, then recorded once
+
+    Statistics statistics;
+    Statistics* statisticsPtr = this->isStatisticsEnabled() ? &statistics : nullptr;
+
+    const SystemOfEquationsWrapper systemOfEquations =
+        this->applyCancellationFlag(this->applyStatistics(aSystemOfEquations, statisticsPtr));
+
+    const Array<Real> durationArray = anInstantArray.map<Real>(
+        [&aState](const Instant& anInstant) -> Real
+        {
+            return (anInstant - aState.accessInstant()).inSeconds();
+        }
+    );
+
+    // With a dense stepper, steps are not constrained by output instants, which are interpolated instead. Logged
+    // Dopri5 integrations take the regular path, whose observer logs every step.
+
+    const bool isLongHorizon = longHorizonScheme_ != NumericalSolver::LongHorizonScheme::Undefined;
+    const bool isDenseDopri5 = (stepperType_ == NumericalSolver::StepperType::RungeKuttaDopri5) &&
+                               (this->getLogType() == NumericalSolver::LogType::NoLog);
+
+    if ((isDenseDopri5 || isLongHorizon) && !durationArray.isEmpty())
+    {
+        const double signedTimeStep = getSignedTimeStep(durationArray.accessLast());
+        const bool isForward = signedTimeStep > 0.0;
+
+        bool durationsAreMonotonic = true;
+        double previousDuration = 0.0;
+
+        for (const Real& duration : durationArray)
+        {
+            if (isForward ? (duration < previousDuration) : (duration > previousDuration))
+            {
+                durationsAreMonotonic = false;
+                break;
+            }
+
+            previousDuration = duration;
+        }
+
+        if (durationsAreMonotonic)
+        {
+            const StateBuilder stateBuilder = {aState};
+
+            Array<NumericalSolver::StateVector> stateVectors = Array<NumericalSolver::StateVector>::Empty();
+
+            switch (longHorizonScheme_)
+            {
+                case NumericalSolver::LongHorizonScheme::Undefined:
+                {
+                    auto stepper = make_dense_output(absoluteTolerance_, relativeTolerance_, dense_stepper_type_5());
+                    stateVectors = integrateDenseDurations(
+                        stepper,
+                        systemOfEquations,
+                        aState.accessCoordinates(),
+                        durationArray,
+                        signedTimeStep,
+                        statisticsPtr
+                    );
+                    break;
+                }
+
+                case NumericalSolver::LongHorizonScheme::AdamsBashforthMoulton:
+                {
+                    HermiteDenseOutput<multistep_stepper_type_8> stepper = {multistep_stepper_type_8()};
+                    stateVectors = integrateDenseDurations(
+                        stepper,
+                        systemOfEquations,
+                        aState.accessCoordinates(),
+                        durationArray,
+                        signedTimeStep,
+                        statisticsPtr
+                    );
+                    break;
+                }
+
+                case NumericalSolver::LongHorizonScheme::GaussLegendre:
+                {
+                    HermiteDenseOutput<GaussLegendreStepper> stepper = {GaussLegendreStepper()};
+                    stateVectors = integrateDenseDurations(
+                        stepper,
+                        systemOfEquations,
+                        aState.accessCoordinates(),
+                        durationArray,
+                        signedTimeStep,
+                        statisticsPtr
+                    );
+                    break;
+                }
+
+                case NumericalSolver::LongHorizonScheme::RungeKuttaMuntheKaas:
+                {
+                    HermiteDenseOutput<MuntheKaasStepper> stepper = {MuntheKaasStepper(aState)};
+                    stateVectors = integrateDenseDurations(
+                        stepper,
+                        systemOfEquations,
+                        aState.accessCoordinates(),
+                        durationArray,
+                        signedTimeStep,
+                        statisticsPtr
+                    );
+                    break;
+                }
+
+                default:
+                    throw ostk::core::error::runtime::Wrong("Long horizon scheme");
+            }
+
+            Array<State> states;
+            states.reserve(durationArray.getSize());
+
+            for (Index i = 0; i < durationArray.getSize(); ++i)
+            {
+                states.add(stateBuilder.build(anInstantArray[i], stateVectors[i]));
+            }
+
+            if (statisticsPtr != nullptr)
+            {
+                this->recordStatistics(statistics);
+            }
+
+            return states;
+        }
+
+        if (isLongHorizon)
+        {
+            // Long horizon schemes have no step size control to fall back on, each instant is integrated separately
+
+            Array<State> states;
+            states.reserve(anInstantArray.getSize());
+
+            for (const Instant& instant : anInstantArray)
+            {
+                states.add(this->integrateTime(aState, Array<Instant> {instant}, aSystemOfEquations).accessFirst());
+            }
+
+            return states;
+        }
+    }
+
+    const Array<NumericalSolver::Solution> solutions =
+        MathNumericalSolver::integrateDuration(aState.accessCoordinates(), durationArray, systemOfEquations);
+
+    Array<State> states;
+    states.reserve(solutions.getSize());
+    for (Index i = 0; i < solutions.getSize(); ++i)
+    {
+        const NumericalSolver::Solution& solution = solutions.at(i);
+        const State state = {
+            anInstantArray[i],
+            solution.first,
+            aState.accessFrame(),
+            aState.accessCoordinateBroker(),
+        };
+        states.add(state);
+    }
+
+    if (statisticsPtr != nullptr)
+    {
+        this->recordStatistics(statistics);
+    }
+
+    return states;
+}
+
+State NumericalSolver::integrateTime(
+    const State& aState, const Instant& anEndTime, const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations
+)
+{
+    const Tracer::Span span("NumericalSolver::integrateTime", "integration");
+
+    // A warm start needs control over the first step, which the underlying solver does not give: integrate with the
+    // dense stepper instead, without events
+
+    if (initialTimeStep_.isDefined() && this->isAdaptive())
+    {
+        const Array<Shared<EventCondition>> eventConditions = Array<Shared<EventCondition>>::Empty();
+
+        return this->integrateTime(aState, anEndTime, aSystemOfEquations, eventConditions).state;
+    }
+
+    resetObservedStates();
+    observedStateHistory_.add(aState);
+
+    if (longHorizonScheme_ != NumericalSolver::LongHorizonScheme::Undefined)
+    {
+        return this->integrateTime(aState, Array<Instant> {anEndTime}, aSystemOfEquations).accessFirst();
+    }
+
+    Statistics statistics;
+    Statistics* statisticsPtr = this->isStatisticsEnabled() ? &statistics : nullptr;
+
+    const SystemOfEquationsWrapper systemOfEquations =
+        this->applyCancellationFlag(this->applyStatistics(aSystemOfEquations, statisticsPtr));
+
+    const StateBuilder stateBuilder = {aState};
+    const EpochTime epochTime = {aState.accessInstant()};
+
+    const NumericalSolver::Solution solution = MathNumericalSolver::integrateDuration(
+        aState.accessCoordinates(), epochTime.getTimeAt(anEndTime), systemOfEquations
+    );
+
+    double previousTime = 0.0;
+    double lastStepSize = 0.0;
+    double penultimateStepSize = 0.0;
+
+    for (const auto& state : MathNumericalSolver::getObservedStateVectors())
+    {
+        observedStateHistory_.add(stateBuilder.build(epochTime.getInstantAt(state.second), state.first));
+
+        if (state.second != previousTime)
+        {
+            if (statisticsPtr != nullptr)
+            {
+                recordStep(statistics, state.second - previousTime, 0);
+            }
+
+            penultimateStepSize = lastStepSize;
+            lastStepSize = std::abs(state.second - previousTime);
+            previousTime = state.second;
+        }
+    }
+
+    // The last step is cut short to end at the requested instant, the previous one is the last step chosen freely
+
+    finalTimeStep_ = (penultimateStepSize > 0.0) ? penultimateStepSize : lastStepSize;
+
+    if (finalTimeStep_ == 0.0)
+    {
+        finalTimeStep_ = Real::Undefined();
+    }
+
+    if (statisticsPtr != nullptr)
+    {
+        // Steps are taken by the underlying solver, rejected steps are inferred from the evaluations
+
+        const Size attemptCount = stepAttemptCount(stepperType_, statistics.evaluationCount);
+
+        statistics.rejectedStepCount =
+            (attemptCount > statistics.stepCount) ? (attemptCount - statistics.stepCount) : 0;
+
+        this->recordStatistics(statistics);
+    }
+
+    return stateBuilder.build(anEndTime, solution.first);
+}
+
+Array<State> NumericalSolver::integrateEnsembleTime(
+    const Array<State>& aStateArray,
+    const Instant& anEndTime,
+    const NumericalSolver::EnsembleSystemOfEquationsWrapper& aSystemOfEquations
+)
+{
+    const Tracer::Span span("NumericalSolver::integrateEnsembleTime", "integration");
+
+    if (longHorizonScheme_ != NumericalSolver::LongHorizonScheme::Undefined)
+    {
+        throw ostk::core::error::runtime::ToBeImplemented("Ensemble integration with a long horizon scheme");
+    }
+
+    if (aStateArray.isEmpty())
+    {
+        return Array<State>::Empty();
+    }
+
+    const State& firstState = aStateArray.accessFirst();
+
+    for (const State& state : aStateArray)
+    {
+        if ((state.accessInstant() != firstState.accessInstant()) ||
+            (*state.accessFrame() != *firstState.accessFrame()) ||
+            (*state.accessCoordinateBroker() != *firstState.accessCoordinateBroker()))
+        {
+            throw ostk::core::error::runtime::Wrong("State Array");
+        }
+    }
+
+    const Size sampleCount = aStateArray.getSize();
+
+    MatrixXd stateMatrix(firstState.getSize(), sampleCount);
+
+    for (Index i = 0; i < sampleCount; ++i)
+    {
+        stateMatrix.col(i) = aStateArray[i].accessCoordinates();
+    }
+
+    // Steps follow the sign of the integration duration
+
+    const double duration = (anEndTime - firstState.accessInstant()).inSeconds();
+    const double timeStep = (duration < 0.0) ? -double(this->getTimeStep()) : double(this->getTimeStep());
+
+    const auto systemOfEquations = [&aSystemOfEquations](const MatrixXd& x, MatrixXd& dxdt, const double t) -> void
+    {
+        aSystemOfEquations(x, dxdt, t);
+    };
+
+    if (duration != 0.0)
+    {
+        const double absoluteTolerance = this->getAbsoluteTolerance();
+        const double relativeTolerance = this->getRelativeTolerance();
+
+        switch (this->getStepperType())
+        {
+            case NumericalSolver::StepperType::RungeKutta4:
+                integrate_adaptive(ensemble_stepper_type_4(), systemOfEquations, stateMatrix, 0.0, duration, timeStep);
+                break;
+
+            case NumericalSolver::StepperType::RungeKuttaCashKarp54:
+                integrate_adaptive(
+                    make_controlled(absoluteTolerance, relativeTolerance, ensemble_stepper_type_54()),
+                    systemOfEquations,
+                    stateMatrix,
+                    0.0,
+                    duration,
+                    timeStep
+                );
+                break;
+
+            case NumericalSolver::StepperType::RungeKuttaDopri5:
+                integrate_adaptive(
+                    make_controlled(absoluteTolerance, relativeTolerance, ensemble_stepper_type_5()),
+                    systemOfEquations,
+                    stateMatrix,
+                    0.0,
+                    duration,
+                    timeStep
+                );
+                break;
+
+            case NumericalSolver::StepperType::RungeKuttaFehlberg78:
+                integrate_adaptive(
+                    make_controlled(absoluteTolerance, relativeTolerance, ensemble_stepper_type_78()),
+                    systemOfEquations,
+                    stateMatrix,
+                    0.0,
+                    duration,
+                    timeStep
+                );
+                break;
+
+            default:
+                throw ostk::core::error::runtime::Wrong("Stepper type");
+        }
+    }
+
+    const StateBuilder stateBuilder = {firstState};
+
+    Array<State> states;
+    states.reserve(sampleCount);
+
+    for (Index i = 0; i < sampleCount; ++i)
+    {
+        states.add(stateBuilder.build(anEndTime, stateMatrix.col(i)));
+    }
+
+    return states;
+}
+
+bool NumericalSolver::supportsFixedSizeIntegration() const
+{
+    return (this->getLogType() == NumericalSolver::LogType::NoLog) &&
+           (longHorizonScheme_ == NumericalSolver::LongHorizonScheme::Undefined);
+}
+
+template <int StateSize>
+State NumericalSolver::integrateFixedSizeTime(
+    const State& aState,
+    const Instant& anEndTime,
+    const NumericalSolver::FixedSizeSystemOfEquationsWrapper<StateSize>& aSystemOfEquations
+)
+{
+    const Tracer::Span span("NumericalSolver::integrateFixedSizeTime", "integration");
+
+    typedef NumericalSolver::FixedSizeStateVector<StateSize> StateVectorType;
+
+    typedef runge_kutta4<StateVectorType, double, StateVectorType, double, vector_space_algebra>
+        fixed_size_stepper_type_4;
+    typedef runge_kutta_cash_karp54<StateVectorType, double, StateVectorType, double, vector_space_algebra>
+        fixed_size_stepper_type_54;
+    typedef runge_kutta_dopri5<StateVectorType, double, StateVectorType, double, vector_space_algebra>
+        fixed_size_stepper_type_5;
+    typedef runge_kutta_fehlberg78<StateVectorType, double, StateVectorType, double, vector_space_algebra>
+        fixed_size_stepper_type_78;
+
+    if (!this->supportsFixedSizeIntegration())
+    {
+        throw ostk::core::error::runtime::Wrong("Fixed size integration");
+    }
+
+    if (aState.getSize() != StateSize)
+    {
+        throw ostk::core::error::runtime::Wrong("State size");
+    }
+
+    const StateBuilder stateBuilder = {aState};
+    const EpochTime epochTime = {aState.accessInstant()};
+
+    StateVectorType stateVector = aState.accessCoordinates();
+
+    const double duration = epochTime.getTimeAt(anEndTime);
+
+    Statistics statistics;
+    Statistics* statisticsPtr = this->isStatisticsEnabled() ? &statistics : nullptr;
+
+    const auto systemOfEquations =
+        [&aSystemOfEquations, &statistics](const StateVectorType& x, StateVectorType& dxdt, const double t) -> void
+    {
+        ++statistics.evaluationCount;
+
+        aSystemOfEquations(x, dxdt, t);
+    };
+
+    resetObservedStates();
+
+    double previousTime = 0.0;
+
+    const auto observer = [this, &epochTime, &stateBuilder, statisticsPtr, &previousTime](
+                              const StateVectorType& x, const double t
+                          ) -> void
+    {
+        observedStateHistory_.add(stateBuilder.build(epochTime.getInstantAt(t), NumericalSolver::StateVector(x)));
+
+        if ((statisticsPtr != nullptr) && (t != previousTime))
+        {
+            recordStep(*statisticsPtr, t - previousTime, 0);
+            previousTime = t;
+        }
+    };
+
+    if (duration == 0.0)
+    {
+        observedStateHistory_.add(aState);
+
+        return aState;
+    }
+
+    const double signedTimeStep = getSignedTimeStep(duration);
+    const double absoluteTolerance = this->getAbsoluteTolerance();
+    const double relativeTolerance = this->getRelativeTolerance();
+
+    switch (this->getStepperType())
+    {
+        case NumericalSolver::StepperType::RungeKutta4:
+            integrate_adaptive(
+                fixed_size_stepper_type_4(), systemOfEquations, stateVector, 0.0, duration, signedTimeStep, observer
+            );
+            break;
+
+        case NumericalSolver::StepperType::RungeKuttaCashKarp54:
+            integrate_adaptive(
+                make_controlled(absoluteTolerance, relativeTolerance, fixed_size_stepper_type_54()),
+                systemOfEquations,
+                stateVector,
+                0.0,
+                duration,
+                signedTimeStep,
+                observer
+            );
+            break;
+
+        case NumericalSolver::StepperType::RungeKuttaDopri5:
+            integrate_adaptive(
+                make_controlled(absoluteTolerance, relativeTolerance, fixed_size_stepper_type_5()),
+                systemOfEquations,
+                stateVector,
+                0.0,
+                duration,
+                signedTimeStep,
+                observer
+            );
+            break;
+
+        case NumericalSolver::StepperType::RungeKuttaFehlberg78:
+            integrate_adaptive(
+                make_controlled(absoluteTolerance, relativeTolerance, fixed_size_stepper_type_78()),
+                systemOfEquations,
+                stateVector,
+                0.0,
+                duration,
+                signedTimeStep,
+                observer
+            );
+            break;
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Stepper type");
+    }
+
+    if (statisticsPtr != nullptr)
+    {
+        const Size attemptCount = stepAttemptCount(this->getStepperType(), statistics.evaluationCount);
+
+        statistics.rejectedStepCount =
+            (attemptCount > statistics.stepCount) ? (attemptCount - statistics.stepCount) : 0;
+
+        this->recordStatistics(statistics);
+    }
+
+    return stateBuilder.build(anEndTime, NumericalSolver::StateVector(stateVector));
+}
+
+template State NumericalSolver::integrateFixedSizeTime<6>(
+    const State& aState,
+    const Instant& anEndTime,
+    const NumericalSolver::FixedSizeSystemOfEquationsWrapper<6>& aSystemOfEquations
+);
+
+template State NumericalSolver::integrateFixedSizeTime<7>(
+    const State& aState,
+    const Instant& anEndTime,
+    const NumericalSolver::FixedSizeSystemOfEquationsWrapper<7>& aSystemOfEquations
+);
+
+template <class DenseStepper, class StateCreator>
+RootSolver::Solution NumericalSolver::solveConditionTime(
+    const DenseStepper& aDenseStepper,
+    const StateCreator& aStateCreator,
+    const EventCondition& anEventCondition,
+    const std::function<double(const double&)>& aConditionChecker,
+    const double& aPreviousTime,
+    const double& aCurrentTime
+) const
+{
+    // Real conditions are solved on their (continuous) value, which converges in a handful of iterations, and only
+    // builds a single state per iteration. Other conditions (and boolean ones) are bisected on their satisfaction.
+
+    const RealCondition* realConditionPtr = dynamic_cast<const RealCondition*>(&anEventCondition);
+
+    if ((realConditionPtr != nullptr) && (dynamic_cast<const BooleanCondition*>(&anEventCondition) == nullptr))
+    {
+        NumericalSolver::StateVector stateVector(aDenseStepper.current_state());
+
+        const auto evaluateCondition = [realConditionPtr, &aDenseStepper, &aStateCreator, &stateVector](
+                                           const double& aTime
+                                       ) -> double
+        {
+            aDenseStepper.calc_state(aTime, stateVector);
+
+            return realConditionPtr->evaluate(aStateCreator(stateVector, aTime));
+        };
+
+        const double previousValue = evaluateCondition(aPreviousTime);
+        const double currentValue = evaluateCondition(aCurrentTime);
+
+        if ((previousValue * currentValue) < 0.0)
+        {
+            return rootSolver_.solve(evaluateCondition, aPreviousTime, aCurrentTime);
+        }
+    }
+
+    return rootSolver_.bisection(aConditionChecker, aPreviousTime, aCurrentTime);
+}
+
+template <class DenseStepper>
+NumericalSolver::ConditionSolution NumericalSolver::integrateTimeToCondition(
+    DenseStepper& aDenseStepper,
+    const State& aState,
+    const Real& aDurationInSeconds,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+    const EventCondition& anEventCondition,
+    NumericalSolver::Statistics* aStatisticsPtr
+)
+{
+    const StateBuilder stateBuilder = {aState};
+    const EpochTime epochTime = {aState.accessInstant()};
+
+    const auto createState = [&stateBuilder, &epochTime](const VectorXd& aStateVector, const double& aTime) -> State
+    {
+        return stateBuilder.build(epochTime.getInstantAt(aTime), aStateVector);
+    };
+
+    // Ensure that the time step is the correct sign
+    const double signedTimeStep = this->getInitialSignedTimeStep(aDurationInSeconds);
+
+    // initialize stepper
+    double currentTime = 0.0;
+    aDenseStepper.initialize(NumericalSolver::StateVector(aState.accessCoordinates()), currentTime, signedTimeStep);
+
+    // do first step
+    double previousTime;
+    std::tie(previousTime, currentTime) = takeStep(aDenseStepper, aSystemOfEquations, aStatisticsPtr);
+
+    State previousState = createState(aDenseStepper.current_state(), aDenseStepper.current_time());
+    observeState(previousState);
+
+    bool conditionSatisfied = false;
+
+    // account for integration direction
+    std::function<bool(const double&)> checkTimeLimit;
+    if (aDurationInSeconds > 0.0)
+    {
+        checkTimeLimit = [&aDurationInSeconds](const double& aTime) -> bool
+        {
+            return aTime < aDurationInSeconds;
+        };
+    }
+    else
+    {
+        checkTimeLimit = [&aDurationInSeconds](const double& aTime) -> bool
+        {
+            return aTime > aDurationInSeconds;
+        };
+    }
+
+    State currentState = State::Undefined();
+
+    while (checkTimeLimit(currentTime))
+    {
+        std::tie(previousTime, currentTime) = takeStep(aDenseStepper, aSystemOfEquations, aStatisticsPtr);
+        currentState = createState(aDenseStepper.current_state(), currentTime);
+
+        conditionSatisfied = anEventCondition.isSatisfied(currentState, previousState);
+
+        if (conditionSatisfied)
+        {
+            break;
+        }
+
+        observeState(currentState);
+        previousState = currentState;
+    }
+
+    if (!conditionSatisfied)
+    {
+        NumericalSolver::StateVector currentStateVector(aDenseStepper.current_state());
+        calculateStepState(aDenseStepper, aSystemOfEquations, aDurationInSeconds, currentStateVector);
+
+        return {
+            createState(currentStateVector, aDurationInSeconds),
+            false,
+            0,
+            false,
+        };
+    }
+
+    // The state at the start of the step is the previous state, built once rather than at each root solver iteration
+    const auto checkCondition =
+        [&anEventCondition, &aDenseStepper, &createState, &previousState](const double& aTime) -> double
+    {
+        NumericalSolver::StateVector stateVector(aDenseStepper.current_state());
+        aDenseStepper.calc_state(aTime, stateVector);
+
+        return anEventCondition.isSatisfied(createState(stateVector, aTime), previousState) ? 1.0 : -1.0;
+    };
+
+    // Condition at previousTime => True
+    // Condition at currentTime => True
+    // Initial state satisfies the condition, return the initial state
+    if (checkCondition(previousTime) == checkCondition(currentTime))
+    {
+        return {
+            aState,
+            true,
+            0,
+            true,
+        };
+    }
+
+    // Condition at previousTime => False
+    // Condition at currentTime => True
+    // Search for the exact time of the condition change
+    const RootSolver::Solution solution = this->solveConditionTime(
+        aDenseStepper, createState, anEventCondition, checkCondition, previousTime, currentTime
+    );
+    NumericalSolver::StateVector solutionStateVector(aState.accessCoordinates().size());
+    const double solutionTime = solution.root;
+
+    calculateStepState(aDenseStepper, aSystemOfEquations, solutionTime, solutionStateVector);
+    const State solutionState = createState(solutionStateVector, solutionTime);
+    observeState(solutionState);
+
+    return {
+        solutionState,
+        true,
+        solution.iterationCount,
+        solution.hasConverged,
+    };
 }
 
-State NumericalSolver::integrateTime(
-    const State& aState, const Instant& anEndTime, const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations
+template <class DenseStepper>
+NumericalSolver::EventsSolution NumericalSolver::integrateTimeWithEvents(
+    DenseStepper& aDenseStepper,
+    const State& aState,
+    const Real& aDurationInSeconds,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+    const Array<Shared<EventCondition>>& anEventConditionArray,
+    NumericalSolver::Statistics* aStatisticsPtr
 )
 {
-    observedStates_ = {aState};
-
     const StateBuilder stateBuilder = {aState};
+    const EpochTime epochTime = {aState.accessInstant()};
 
-    const NumericalSolver::Solution solution = MathNumericalSolver::integrateDuration(
-        aState.accessCoordinates(), (anEndTime - aState.accessInstant()).inSeconds(), aSystemOfEquations
+    const auto createState = [&stateBuilder, &epochTime](const VectorXd& aStateVector, const double& aTime) -> State
+    {
+        return stateBuilder.build(epochTime.getInstantAt(aTime), aStateVector);
+    };
+
+    const bool isForward = aDurationInSeconds > 0.0;
+    const double durationInSeconds = aDurationInSeconds;
+
+    const auto isWithinTimeLimit = [isForward, durationInSeconds](const double& aTime) -> bool
+    {
+        return isForward ? (aTime <= durationInSeconds) : (aTime >= durationInSeconds);
+    };
+
+    double currentTime = 0.0;
+    aDenseStepper.initialize(
+        NumericalSolver::StateVector(aState.accessCoordinates()),
+        currentTime,
+        this->getInitialSignedTimeStep(aDurationInSeconds)
     );
 
-    for (const auto& state : MathNumericalSolver::getObservedStateVectors())
+    Array<EventOccurrence> eventOccurrences = Array<EventOccurrence>::Empty();
+    Array<EventOccurrence> stepEventOccurrences = Array<EventOccurrence>::Empty();
+
+    State previousState = aState;
+    double previousTime = 0.0;
+
+    // All conditions are checked on every step: an occurrence is recorded when a condition becomes satisfied over the
+    // step, then its instant is refined on the dense output of the step
+
+    while (isForward ? (currentTime < durationInSeconds) : (currentTime > durationInSeconds))
     {
-        observedStates_.add(stateBuilder.build(aState.accessInstant() + Duration::Seconds(state.second), state.first));
+        std::tie(previousTime, currentTime) = takeStep(aDenseStepper, aSystemOfEquations, aStatisticsPtr);
+        const State currentState = createState(aDenseStepper.current_state(), currentTime);
+
+        stepEventOccurrences.clear();
+
+        for (Index conditionIndex = 0; conditionIndex < anEventConditionArray.getSize(); ++conditionIndex)
+        {
+            const EventCondition& eventCondition = *anEventConditionArray[conditionIndex];
+
+            if ((!eventCondition.isSatisfied(currentState, previousState)) ||
+                eventCondition.isSatisfied(previousState, previousState))
+            {
+                continue;
+            }
+
+            const auto checkCondition =
+                [&eventCondition, &aDenseStepper, &createState, &previousState](const double& aTime) -> double
+            {
+                NumericalSolver::StateVector stateVector(aDenseStepper.current_state());
+                aDenseStepper.calc_state(aTime, stateVector);
+
+                return eventCondition.isSatisfied(createState(stateVector, aTime), previousState) ? 1.0 : -1.0;
+            };
+
+            const RootSolver::Solution solution = this->solveConditionTime(
+                aDenseStepper, createState, eventCondition, checkCondition, previousTime, currentTime
+            );
+
+            // The last step may overshoot the end time
+
+            if (!isWithinTimeLimit(solution.root))
+            {
+                continue;
+            }
+
+            NumericalSolver::StateVector solutionStateVector(aState.accessCoordinates().size());
+            calculateStepState(aDenseStepper, aSystemOfEquations, solution.root, solutionStateVector);
+
+            stepEventOccurrences.add({
+                conditionIndex,
+                createState(solutionStateVector, solution.root),
+                solution.iterationCount,
+                solution.hasConverged,
+            });
+        }
+
+        // Occurrences within a step are ordered in integration direction, conditions occurring at the same instant
+        // keep their order
+
+        std::stable_sort(
+            stepEventOccurrences.begin(),
+            stepEventOccurrences.end(),
+            [isForward](const EventOccurrence& aFirstOccurrence, const EventOccurrence& aSecondOccurrence) -> bool
+            {
+                return isForward
+                         ? (aFirstOccurrence.state.accessInstant() < aSecondOccurrence.state.accessInstant())
+                         : (aFirstOccurrence.state.accessInstant() > aSecondOccurrence.state.accessInstant());
+            }
+        );
+
+        for (const EventOccurrence& eventOccurrence : stepEventOccurrences)
+        {
+            observeState(eventOccurrence.state);
+            eventOccurrences.add(eventOccurrence);
+        }
+
+        if (isWithinTimeLimit(currentTime) && (currentTime != durationInSeconds))
+        {
+            observeState(currentState);
+        }
+
+        previousState = currentState;
     }
 
-    return stateBuilder.build(anEndTime, solution.first);
+    NumericalSolver::StateVector finalStateVector(aDenseStepper.current_state());
+    calculateStepState(aDenseStepper, aSystemOfEquations, durationInSeconds, finalStateVector);
+
+    const State finalState = createState(finalStateVector, durationInSeconds);
+    observeState(finalState);
+
+    return {
+        finalState,
+        eventOccurrences,
+    };
 }
 
 NumericalSolver::ConditionSolution NumericalSolver::integrateTime(
@@ -128,24 +2092,20 @@ NumericalSolver::ConditionSolution NumericalSolver::integrateTime(
     const EventCondition& anEventCondition
 )
 {
-    if (stepperType_ != NumericalSolver::StepperType::RungeKuttaDopri5)
-    {
-        throw ostk::core::error::runtime::ToBeImplemented(
-            "Integrating with conditions is only supported with RungeKuttaDopri5 stepper type."
-        );
-    }
+    const Tracer::Span span("NumericalSolver::integrateTimeToCondition", "integration");
 
-    observedStates_ = {aState};
+    resetObservedStates();
+    observedStateHistory_.add(aState);
 
-    const StateBuilder stateBuilder = {aState};
+    const StateBatchDeliveryGuard stateBatchDeliveryGuard(
+        [this]() -> void
+        {
+            this->deliverStateBatch();
+        }
+    );
 
     const Real aDurationInSeconds = (anInstant - aState.accessInstant()).inSeconds();
 
-    const auto createState = [&stateBuilder, &aState](const VectorXd& aStateVector, const double& aTime) -> State
-    {
-        return stateBuilder.build(aState.accessInstant() + Duration::Seconds(aTime), aStateVector);
-    };
-
     if (aDurationInSeconds.isZero())
     {
         return {
@@ -156,115 +2116,216 @@ NumericalSolver::ConditionSolution NumericalSolver::integrateTime(
         };
     }
 
-    // Ensure that the time step is the correct sign
-    const double signedTimeStep = getSignedTimeStep(aDurationInSeconds);
+    // Conditions that only depend on time are met at their target instant: integrate to it directly, without
+    // checking the condition at every step. Loggers still see every step of the regular path.
 
-    // TBI: Adapt this to any dense stepper type
-    auto stepper = make_dense_output(absoluteTolerance_, relativeTolerance_, dense_stepper_type_5());
+    const Instant targetInstant = anEventCondition.getTargetInstant();
+    const RealCondition* realConditionPtr = dynamic_cast<const RealCondition*>(&anEventCondition);
 
-    // initialize stepper
-    double currentTime = 0.0;
-    stepper.initialize(aState.accessCoordinates(), currentTime, signedTimeStep);
+    if (targetInstant.isDefined() && (realConditionPtr != nullptr) &&
+        ((stateLogger_ == nullptr) || (getLogType() == NumericalSolver::LogType::NoLog)) &&
+        (stateBatchLoggerDeliverySPtr_ == nullptr))
+    {
+        const RealCondition::Criterion criterion = realConditionPtr->getCriterion();
+        const bool isForward = aDurationInSeconds > 0.0;
 
-    // do first step
-    double previousTime;
-    std::tie(previousTime, currentTime) = stepper.do_step(aSystemOfEquations);
+        const bool canBeReached =
+            isForward ? ((targetInstant > aState.accessInstant()) &&
+                         (criterion != RealCondition::Criterion::NegativeCrossing) &&
+                         (criterion != RealCondition::Criterion::StrictlyNegative))
+                      : ((targetInstant < aState.accessInstant()) &&
+                         (criterion != RealCondition::Criterion::PositiveCrossing) &&
+                         (criterion != RealCondition::Criterion::StrictlyPositive));
 
-    State previousState = createState(stepper.current_state(), stepper.current_time());
-    observeState(previousState);
+        if (canBeReached)
+        {
+            const bool conditionIsSatisfied = isForward ? (targetInstant <= anInstant) : (targetInstant >= anInstant);
 
-    bool conditionSatisfied = false;
+            const State state =
+                this->integrateTime(aState, conditionIsSatisfied ? targetInstant : anInstant, aSystemOfEquations);
 
-    // account for integration direction
-    std::function<bool(const double&)> checkTimeLimit;
-    if (aDurationInSeconds > 0.0)
-    {
-        checkTimeLimit = [&aDurationInSeconds](const double& aTime) -> bool
-        {
-            return aTime < aDurationInSeconds;
-        };
+            return {
+                state,
+                conditionIsSatisfied,
+                0,
+                conditionIsSatisfied,
+            };
+        }
     }
-    else
+
+    // Statistics are accumulated locally, then recorded once
+
+    Statistics statistics;
+    Statistics* statisticsPtr = this->isStatisticsEnabled() ? &statistics : nullptr;
+
+    const SystemOfEquationsWrapper systemOfEquations =
+        this->applyCancellationFlag(this->applyStatistics(aSystemOfEquations, statisticsPtr));
+
+    const ConditionSolution conditionSolution = this->integrateTimeToCondition(
+        aState, aDurationInSeconds, systemOfEquations, anEventCondition, statisticsPtr
+    );
+
+    if (statisticsPtr != nullptr)
     {
-        checkTimeLimit = [&aDurationInSeconds](const double& aTime) -> bool
-        {
-            return aTime > aDurationInSeconds;
-        };
+        this->recordStatistics(statistics);
     }
 
-    State currentState = State::Undefined();
+    return conditionSolution;
+}
 
-    while (checkTimeLimit(currentTime))
+template <class Visitor>
+auto NumericalSolver::visitDenseStepper(const State& aState, const Visitor& aVisitor)
+{
+    switch (longHorizonScheme_)
     {
-        std::tie(previousTime, currentTime) = stepper.do_step(aSystemOfEquations);
-        currentState = createState(stepper.current_state(), currentTime);
+        case NumericalSolver::LongHorizonScheme::Undefined:
+            break;
 
-        conditionSatisfied = anEventCondition.isSatisfied(currentState, previousState);
+        case NumericalSolver::LongHorizonScheme::AdamsBashforthMoulton:
+        {
+            HermiteDenseOutput<multistep_stepper_type_8> stepper = {multistep_stepper_type_8()};
+            return aVisitor(stepper);
+        }
 
-        if (conditionSatisfied)
+        case NumericalSolver::LongHorizonScheme::GaussLegendre:
         {
-            break;
+            HermiteDenseOutput<GaussLegendreStepper> stepper = {GaussLegendreStepper()};
+            return aVisitor(stepper);
         }
 
-        observeState(currentState);
-        previousState = currentState;
+        case NumericalSolver::LongHorizonScheme::RungeKuttaMuntheKaas:
+        {
+            HermiteDenseOutput<MuntheKaasStepper> stepper = {MuntheKaasStepper(aState)};
+            return aVisitor(stepper);
+        }
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Long horizon scheme");
     }
 
-    if (!conditionSatisfied)
+    switch (stepperType_)
     {
-        NumericalSolver::StateVector currentStateVector(stepper.current_state());
-        stepper.calc_state(aDurationInSeconds, currentStateVector);
+        case NumericalSolver::StepperType::RungeKuttaDopri5:
+        {
+            auto stepper = make_dense_output(absoluteTolerance_, relativeTolerance_, dense_stepper_type_5());
+            return aVisitor(stepper);
+        }
 
-        return {
-            createState(currentStateVector, aDurationInSeconds),
-            false,
-            0,
-            false,
-        };
+        case NumericalSolver::StepperType::RungeKutta4:
+        {
+            HermiteDenseOutput<stepper_type_4> stepper = {stepper_type_4()};
+            return aVisitor(stepper);
+        }
+
+        case NumericalSolver::StepperType::RungeKuttaCashKarp54:
+        {
+            HermiteDenseOutput<result_of::make_controlled<error_stepper_type_54>::type> stepper = {
+                make_controlled(absoluteTolerance_, relativeTolerance_, error_stepper_type_54())
+            };
+            return aVisitor(stepper);
+        }
+
+        case NumericalSolver::StepperType::RungeKuttaFehlberg78:
+        {
+            HermiteDenseOutput<result_of::make_controlled<error_stepper_type_78>::type> stepper = {
+                make_controlled(absoluteTolerance_, relativeTolerance_, error_stepper_type_78())
+            };
+            return aVisitor(stepper);
+        }
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Stepper type");
     }
+}
+
+NumericalSolver::EventsSolution NumericalSolver::integrateTime(
+    const State& aState,
+    const Instant& anInstant,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+    const Array<Shared<EventCondition>>& anEventConditionArray
+)
+{
+    const Tracer::Span span("NumericalSolver::integrateTimeWithEvents", "integration");
 
-    const auto checkCondition = [&anEventCondition, &stepper, &createState](const double& aTime) -> double
+    for (const Shared<EventCondition>& eventConditionSPtr : anEventConditionArray)
     {
-        NumericalSolver::StateVector stateVector(stepper.current_state());
-        stepper.calc_state(aTime, stateVector);
+        if (eventConditionSPtr == nullptr)
+        {
+            throw ostk::core::error::runtime::Undefined("Event condition");
+        }
+    }
 
-        const bool isSatisfied = anEventCondition.isSatisfied(
-            createState(stateVector, aTime), createState(stepper.previous_state(), stepper.previous_time())
-        );
+    resetObservedStates();
+    observedStateHistory_.add(aState);
 
-        return isSatisfied ? 1.0 : -1.0;
-    };
+    const StateBatchDeliveryGuard stateBatchDeliveryGuard(
+        [this]() -> void
+        {
+            this->deliverStateBatch();
+        }
+    );
 
-    // Condition at previousTime => True
-    // Condition at currentTime => True
-    // Initial state satisfies the condition, return the initial state
-    if (checkCondition(previousTime) == checkCondition(currentTime))
+    const Real durationInSeconds = (anInstant - aState.accessInstant()).inSeconds();
+
+    if (durationInSeconds.isZero())
     {
         return {
             aState,
-            true,
-            0,
-            true,
+            Array<EventOccurrence>::Empty(),
         };
     }
 
-    // Condition at previousTime => False
-    // Condition at currentTime => True
-    // Search for the exact time of the condition change
-    const RootSolver::Solution solution = rootSolver_.bisection(checkCondition, previousTime, currentTime);
-    NumericalSolver::StateVector solutionStateVector(aState.accessCoordinates().size());
-    const double solutionTime = solution.root;
+    // Statistics are accumulated locally, then recorded once
 
-    stepper.calc_state(solutionTime, solutionStateVector);
-    const State solutionState = createState(solutionStateVector, solutionTime);
-    observeState(solutionState);
+    Statistics statistics;
+    Statistics* statisticsPtr = this->isStatisticsEnabled() ? &statistics : nullptr;
 
-    return {
-        solutionState,
-        true,
-        solution.iterationCount,
-        solution.hasConverged,
-    };
+    const SystemOfEquationsWrapper systemOfEquations =
+        this->applyCancellationFlag(this->applyStatistics(aSystemOfEquations, statisticsPtr));
+
+    const EventsSolution eventsSolution = this->visitDenseStepper(
+        aState,
+        [&](auto& aDenseStepper) -> EventsSolution
+        {
+            const EventsSolution solution = this->integrateTimeWithEvents(
+                aDenseStepper, aState, durationInSeconds, systemOfEquations, anEventConditionArray, statisticsPtr
+            );
+
+            finalTimeStep_ = std::abs(aDenseStepper.current_time_step());
+
+            return solution;
+        }
+    );
+
+    if (statisticsPtr != nullptr)
+    {
+        this->recordStatistics(statistics);
+    }
+
+    return eventsSolution;
+}
+
+NumericalSolver::ConditionSolution NumericalSolver::integrateTimeToCondition(
+    const State& aState,
+    const Real& aDurationInSeconds,
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations,
+    const EventCondition& anEventCondition,
+    NumericalSolver::Statistics* aStatisticsPtr
+)
+{
+    return this->visitDenseStepper(
+        aState,
+        [&](auto& aDenseStepper) -> ConditionSolution
+        {
+            const ConditionSolution solution = this->integrateTimeToCondition(
+                aDenseStepper, aState, aDurationInSeconds, aSystemOfEquations, anEventCondition, aStatisticsPtr
+            );
+
+            finalTimeStep_ = std::abs(aDenseStepper.current_time_step());
+
+            return solution;
+        }
+    );
 }
 
 NumericalSolver NumericalSolver::Undefined()
@@ -311,6 +2372,60 @@ NumericalSolver NumericalSolver::FixedStepSize(const NumericalSolver::StepperTyp
     };
 }
 
+NumericalSolver NumericalSolver::LongHorizon(
+    const NumericalSolver::LongHorizonScheme& aLongHorizonScheme, const Real& aTimeStep
+)
+{
+    if (aLongHorizonScheme == NumericalSolver::LongHorizonScheme::Undefined)
+    {
+        throw ostk::core::error::runtime::Wrong("Long horizon scheme");
+    }
+
+    if (!aTimeStep.isDefined() || (aTimeStep <= 0.0))
+    {
+        throw ostk::core::error::runtime::Wrong("Time step");
+    }
+
+    // The stepper type is only used by the integrations that do not support long horizon schemes
+
+    NumericalSolver numericalSolver = {
+        NumericalSolver::LogType::NoLog,
+        NumericalSolver::StepperType::RungeKutta4,
+        aTimeStep,
+        1.0,
+        1.0,
+        RootSolver::Default(),
+        nullptr,
+    };
+
+    numericalSolver.longHorizonScheme_ = aLongHorizonScheme;
+
+    return numericalSolver;
+}
+
+String NumericalSolver::StringFromLongHorizonScheme(const NumericalSolver::LongHorizonScheme& aLongHorizonScheme)
+{
+    switch (aLongHorizonScheme)
+    {
+        case NumericalSolver::LongHorizonScheme::Undefined:
+            return "Undefined";
+
+        case NumericalSolver::LongHorizonScheme::AdamsBashforthMoulton:
+            return "AdamsBashforthMoulton";
+
+        case NumericalSolver::LongHorizonScheme::GaussLegendre:
+            return "GaussLegendre";
+
+        case NumericalSolver::LongHorizonScheme::RungeKuttaMuntheKaas:
+            return "RungeKuttaMuntheKaas";
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Long horizon scheme");
+    }
+
+    return String::Empty();
+}
+
 NumericalSolver NumericalSolver::DefaultConditional(const std::function<void(const State&)>& stateLogger)
 {
     return NumericalSolver::Conditional(5.0, 1.0e-12, 1.0e-12, stateLogger);
@@ -348,19 +2463,120 @@ NumericalSolver::NumericalSolver(
 )
     : MathNumericalSolver(aLogType, aStepperType, aTimeStep, aRelativeTolerance, anAbsoluteTolerance),
       rootSolver_(aRootSolver),
+      observedStateHistory_(),
       observedStates_(),
-      stateLogger_(stateLogger)
+      observedStatesAreBuilt_(true),
+      stateLogger_(stateLogger),
+      longHorizonScheme_(NumericalSolver::LongHorizonScheme::Undefined),
+      cancellationFlagSPtr_(nullptr),
+      statisticsSPtr_(nullptr),
+      statisticsMutexSPtr_(nullptr),
+      stateBatchLoggerDeliverySPtr_(nullptr),
+      stateBatch_(),
+      initialTimeStep_(Real::Undefined()),
+      finalTimeStep_(Real::Undefined())
 {
 }
 
+bool NumericalSolver::isAdaptive() const
+{
+    return (longHorizonScheme_ == NumericalSolver::LongHorizonScheme::Undefined) &&
+           (stepperType_ != NumericalSolver::StepperType::RungeKutta4);
+}
+
+double NumericalSolver::getInitialSignedTimeStep(const double& aDurationInSeconds) const
+{
+    // Fixed step steppers keep their configured step, on which their accuracy depends
+
+    if (!initialTimeStep_.isDefined() || !this->isAdaptive())
+    {
+        return getSignedTimeStep(aDurationInSeconds);
+    }
+
+    const double initialTimeStep = initialTimeStep_.abs();
+
+    return (aDurationInSeconds >= 0.0) ? initialTimeStep : -initialTimeStep;
+}
+
 void NumericalSolver::observeState(const State& aState)
 {
-    observedStates_.add(aState);
+    observedStateHistory_.add(aState);
 
     if (stateLogger_ != nullptr && getLogType() != NumericalSolver::LogType::NoLog)
     {
         stateLogger_(aState);
     }
+
+    if (stateBatchLoggerDeliverySPtr_ != nullptr)
+    {
+        stateBatch_.add(aState);
+
+        if (stateBatch_.getSize() >= stateBatchLoggerDeliverySPtr_->accessBatchSize())
+        {
+            this->deliverStateBatch();
+        }
+    }
+}
+
+void NumericalSolver::deliverStateBatch()
+{
+    if ((stateBatchLoggerDeliverySPtr_ == nullptr) || stateBatch_.isEmpty())
+    {
+        return;
+    }
+
+    Array<State> stateBatch = Array<State>::Empty();
+    std::swap(stateBatch, stateBatch_);
+
+    stateBatchLoggerDeliverySPtr_->deliver(std::move(stateBatch));
+}
+
+NumericalSolver::SystemOfEquationsWrapper NumericalSolver::applyCancellationFlag(
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations
+) const
+{
+    if (cancellationFlagSPtr_ == nullptr)
+    {
+        return aSystemOfEquations;
+    }
+
+    return [cancellationFlagSPtr = cancellationFlagSPtr_, aSystemOfEquations](
+               const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double t
+           ) -> void
+    {
+        if (cancellationFlagSPtr->load(std::memory_order_relaxed))
+        {
+            throw ostk::core::error::RuntimeError("Numerical integration has been cancelled.");
+        }
+
+        aSystemOfEquations(x, dxdt, t);
+    };
+}
+
+NumericalSolver::SystemOfEquationsWrapper NumericalSolver::applyStatistics(
+    const NumericalSolver::SystemOfEquationsWrapper& aSystemOfEquations, NumericalSolver::Statistics* aStatisticsPtr
+) const
+{
+    if (aStatisticsPtr == nullptr)
+    {
+        return aSystemOfEquations;
+    }
+
+    return [aStatisticsPtr, aSystemOfEquations](
+               const NumericalSolver::StateVector& x, NumericalSolver::StateVector& dxdt, const double t
+           ) -> void
+    {
+        ++aStatisticsPtr->evaluationCount;
+
+        aSystemOfEquations(x, dxdt, t);
+    };
+}
+
+void NumericalSolver::resetObservedStates()
+{
+    observedStateHistory_.clear();
+    observedStates_ = Array<State>::Empty();
+    observedStatesAreBuilt_ = false;
 }
 
 }  // namespace state
@@ -0,0 +1,204 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/StateHistory.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace trajectory
+{
+namespace state
+{
+
+using ostk::mathematics::object::VectorXd;
+
+StateHistory::StateHistory()
+    : frameSPtr_(nullptr),
+      coordinateBrokerSPtr_(nullptr),
+      stateSize_(0),
+      instants_(),
+      coordinates_()
+{
+}
+
+bool StateHistory::isEmpty() const
+{
+    return this->instants_.empty();
+}
+
+Size StateHistory::getSize() const
+{
+    return this->instants_.size();
+}
+
+const Shared<const Frame>& StateHistory::accessFrame() const
+{
+    if (this->isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("State history");
+    }
+
+    return this->frameSPtr_;
+}
+
+const Shared<const CoordinateBroker>& StateHistory::accessCoordinateBroker() const
+{
+    if (this->isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("State history");
+    }
+
+    return this->coordinateBrokerSPtr_;
+}
+
+const Instant& StateHistory::accessInstantAt(const Index& anIndex) const
+{
+    if (anIndex >= this->getSize())
+    {
+        throw ostk::core::error::runtime::Wrong("Index");
+    }
+
+    return this->instants_[anIndex];
+}
+
+State StateHistory::getStateAt(const Index& anIndex) const
+{
+    if (anIndex >= this->getSize())
+    {
+        throw ostk::core::error::runtime::Wrong("Index");
+    }
+
+    return {
+        this->instants_[anIndex],
+        Eigen::Map<const VectorXd>(this->coordinates_.data() + anIndex * this->stateSize_, this->stateSize_),
+        this->frameSPtr_,
+        this->coordinateBrokerSPtr_,
+    };
+}
+
+Array<State> StateHistory::getStates() const
+{
+    Array<State> states = Array<State>::Empty();
+    states.reserve(this->getSize());
+
+    for (Index index = 0; index < this->getSize(); ++index)
+    {
+        states.add(this->getStateAt(index));
+    }
+
+    return states;
+}
+
+void StateHistory::reserve(const Size& aStateCount)
+{
+    this->instants_.reserve(aStateCount);
+
+    if (this->stateSize_ > 0)
+    {
+        this->coordinates_.reserve(aStateCount * this->stateSize_);
+    }
+}
+
+void StateHistory::clear()
+{
+    this->frameSPtr_ = nullptr;
+    this->coordinateBrokerSPtr_ = nullptr;
+    this->stateSize_ = 0;
+    this->instants_.clear();
+    this->coordinates_.clear();
+}
+
+void StateHistory::add(const State& aState)
+{
+    if (!aState.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State");
+    }
+
+    const Eigen::Ref<const VectorXd> coordinates = aState.accessCoordinates();
+
+    if (this->isEmpty())
+    {
+        this->frameSPtr_ = aState.accessFrame();
+        this->coordinateBrokerSPtr_ = aState.accessCoordinateBroker();
+        this->stateSize_ = coordinates.size();
+
+        this->coordinates_.reserve(this->instants_.capacity() * this->stateSize_);
+    }
+    else
+    {
+        const Shared<const Frame> frameSPtr = aState.accessFrame();
+        const Shared<const CoordinateBroker>& coordinateBrokerSPtr = aState.accessCoordinateBroker();
+
+        if ((frameSPtr != this->frameSPtr_) && !(*frameSPtr == *this->frameSPtr_))
+        {
+            throw ostk::core::error::runtime::Wrong("State frame");
+        }
+
+        if ((coordinateBrokerSPtr != this->coordinateBrokerSPtr_) &&
+            (*coordinateBrokerSPtr != *this->coordinateBrokerSPtr_))
+        {
+            throw ostk::core::error::runtime::Wrong("State coordinate broker");
+        }
+
+        if (Size(coordinates.size()) != this->stateSize_)
+        {
+            throw ostk::core::error::runtime::Wrong("State size");
+        }
+    }
+
+    this->instants_.push_back(aState.accessInstant());
+    this->coordinates_.insert(this->coordinates_.end(), coordinates.data(), coordinates.data() + coordinates.size());
+}
+
+void StateHistory::add(const StateHistory& aStateHistory, const Index& aStartIndex)
+{
+    if (aStartIndex >= aStateHistory.getSize())
+    {
+        return;
+    }
+
+    if (this->isEmpty())
+    {
+        this->frameSPtr_ = aStateHistory.frameSPtr_;
+        this->coordinateBrokerSPtr_ = aStateHistory.coordinateBrokerSPtr_;
+        this->stateSize_ = aStateHistory.stateSize_;
+    }
+    else
+    {
+        if ((aStateHistory.frameSPtr_ != this->frameSPtr_) && !(*aStateHistory.frameSPtr_ == *this->frameSPtr_))
+        {
+            throw ostk::core::error::runtime::Wrong("State frame");
+        }
+
+        if ((aStateHistory.coordinateBrokerSPtr_ != this->coordinateBrokerSPtr_) &&
+            (*aStateHistory.coordinateBrokerSPtr_ != *this->coordinateBrokerSPtr_))
+        {
+            throw ostk::core::error::runtime::Wrong("State coordinate broker");
+        }
+
+        if (aStateHistory.stateSize_ != this->stateSize_)
+        {
+            throw ostk::core::error::runtime::Wrong("State size");
+        }
+    }
+
+    this->instants_.insert(
+        this->instants_.end(), aStateHistory.instants_.begin() + aStartIndex, aStateHistory.instants_.end()
+    );
+    this->coordinates_.insert(
+        this->coordinates_.end(),
+        aStateHistory.coordinates_.begin() + aStartIndex * aStateHistory.stateSize_,
+        aStateHistory.coordinates_.end()
+    );
+}
+
+}  // namespace state
+}  // namespace trajectory
+}  // namespace astrodynamics
+}  // namespace ostk
@@ -0,0 +1,258 @@
+/// Apache License 2.0
+
+#include <cmath>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/StateTable.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace trajectory
+{
+namespace state
+{
+
+using ostk::mathematics::object::VectorXd;
+
+using ostk::physics::time::Duration;
+
+StateTable::StateTable(
+    const Instant& anEpoch,
+    const OffsetVector& anOffsetVector,
+    const MatrixXd& aCoordinateMatrix,
+    const Shared<const Frame>& aFrameSPtr,
+    const Shared<const CoordinateBroker>& aCoordinateBrokerSPtr
+)
+    : epoch_(anEpoch),
+      offsets_(anOffsetVector),
+      coordinates_(aCoordinateMatrix),
+      frameSPtr_(aFrameSPtr),
+      coordinateBrokerSPtr_(aCoordinateBrokerSPtr)
+{
+    if (aCoordinateMatrix.rows() != anOffsetVector.rows())
+    {
+        throw ostk::core::error::runtime::Wrong("Coordinate matrix");
+    }
+
+    if ((aCoordinateBrokerSPtr != nullptr) &&
+        (aCoordinateMatrix.cols() != Index(aCoordinateBrokerSPtr->getNumberOfCoordinates())))
+    {
+        throw ostk::core::error::runtime::Wrong("Coordinate matrix");
+    }
+}
+
+bool StateTable::operator==(const StateTable& aStateTable) const
+{
+    if ((!this->isDefined()) || (!aStateTable.isDefined()))
+    {
+        return false;
+    }
+
+    if ((*this->frameSPtr_ != *aStateTable.frameSPtr_) ||
+        (*this->coordinateBrokerSPtr_ != *aStateTable.coordinateBrokerSPtr_) ||
+        (this->getSize() != aStateTable.getSize()) || (this->coordinates_ != aStateTable.coordinates_))
+    {
+        return false;
+    }
+
+    for (Index index = 0; index < this->getSize(); ++index)
+    {
+        if (this->getInstantAt(index) != aStateTable.getInstantAt(index))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool StateTable::operator!=(const StateTable& aStateTable) const
+{
+    return !((*this) == aStateTable);
+}
+
+bool StateTable::isDefined() const
+{
+    return this->epoch_.isDefined() && (this->frameSPtr_ != nullptr) && this->frameSPtr_->isDefined() &&
+           (this->coordinateBrokerSPtr_ != nullptr);
+}
+
+Size StateTable::getSize() const
+{
+    return this->offsets_.size();
+}
+
+const Instant& StateTable::accessEpoch() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State table");
+    }
+
+    return this->epoch_;
+}
+
+const StateTable::OffsetVector& StateTable::accessOffsets() const
+{
+    return this->offsets_;
+}
+
+const MatrixXd& StateTable::accessCoordinates() const
+{
+    return this->coordinates_;
+}
+
+Eigen::Ref<const MatrixXd> StateTable::accessCoordinatesOf(
+    const Shared<const CoordinateSubset>& aCoordinateSubsetSPtr
+) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State table");
+    }
+
+    return this->coordinates_.middleCols(
+        this->coordinateBrokerSPtr_->getSubsetIndex(aCoordinateSubsetSPtr), aCoordinateSubsetSPtr->getSize()
+    );
+}
+
+const Shared<const Frame>& StateTable::accessFrame() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State table");
+    }
+
+    return this->frameSPtr_;
+}
+
+const Shared<const CoordinateBroker>& StateTable::accessCoordinateBroker() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State table");
+    }
+
+    return this->coordinateBrokerSPtr_;
+}
+
+Instant StateTable::getInstantAt(const Index& anIndex) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State table");
+    }
+
+    if (anIndex >= this->getSize())
+    {
+        throw ostk::core::error::runtime::Wrong("Index");
+    }
+
+    return this->epoch_ + Duration::Nanoseconds(static_cast<double>(this->offsets_(anIndex)));
+}
+
+Array<Instant> StateTable::getInstants() const
+{
+    Array<Instant> instants = Array<Instant>::Empty();
+    instants.reserve(this->getSize());
+
+    for (Index index = 0; index < this->getSize(); ++index)
+    {
+        instants.add(this->getInstantAt(index));
+    }
+
+    return instants;
+}
+
+State StateTable::getStateAt(const Index& anIndex) const
+{
+    const Instant instant = this->getInstantAt(anIndex);
+
+    return {
+        instant,
+        VectorXd(this->coordinates_.row(anIndex).transpose()),
+        this->frameSPtr_,
+        this->coordinateBrokerSPtr_,
+    };
+}
+
+Array<State> StateTable::getStates() const
+{
+    Array<State> states = Array<State>::Empty();
+    states.reserve(this->getSize());
+
+    for (Index index = 0; index < this->getSize(); ++index)
+    {
+        states.add(this->getStateAt(index));
+    }
+
+    return states;
+}
+
+StateTable StateTable::Undefined()
+{
+    return {Instant::Undefined(), OffsetVector::Zero(0), MatrixXd::Zero(0, 0), nullptr, nullptr};
+}
+
+StateTable StateTable::FromStates(const Array<State>& aStateArray)
+{
+    if (aStateArray.isEmpty())
+    {
+        return StateTable::Undefined();
+    }
+
+    const State& firstState = aStateArray.accessFirst();
+
+    if (!firstState.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State");
+    }
+
+    const Instant& epoch = firstState.accessInstant();
+    const Shared<const Frame> frameSPtr = firstState.accessFrame();
+    const Shared<const CoordinateBroker>& coordinateBrokerSPtr = firstState.accessCoordinateBroker();
+
+    OffsetVector offsets(aStateArray.getSize());
+    MatrixXd coordinates(aStateArray.getSize(), coordinateBrokerSPtr->getNumberOfCoordinates());
+
+    for (Index index = 0; index < aStateArray.getSize(); ++index)
+    {
+        const State& state = aStateArray[index];
+
+        if (!state.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("State");
+        }
+
+        if ((state.accessCoordinateBroker() != coordinateBrokerSPtr) &&
+            (*state.accessCoordinateBroker() != *coordinateBrokerSPtr))
+        {
+            throw ostk::core::error::RuntimeError("States do not share the same coordinate subsets.");
+        }
+
+        offsets(index) = std::llround(double(Duration::Between(epoch, state.accessInstant()).inNanoseconds()));
+
+        if (state.accessFrame() == frameSPtr)
+        {
+            coordinates.row(index) = state.accessCoordinates().transpose();
+        }
+        else
+        {
+            coordinates.row(index) = state.inFrame(frameSPtr).accessCoordinates().transpose();
+        }
+    }
+
+    return {epoch, offsets, coordinates, frameSPtr, coordinateBrokerSPtr};
+}
+
+}  // namespace state
+}  // namespace trajectory
+}  // namespace astrodynamics
+}  // namespace ostk
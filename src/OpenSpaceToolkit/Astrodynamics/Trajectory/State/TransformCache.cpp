@@ -0,0 +1,169 @@
+/// Apache License 2.0
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <mutex>
+#include <tuple>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/EarthOrientation.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/TransformCache.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace trajectory
+{
+namespace state
+{
+
+namespace
+{
+
+using Key = std::tuple<std::uintptr_t, std::uintptr_t, Instant>;
+
+struct Entry
+{
+    Key key;
+    Shared<const Frame> fromFrameSPtr;
+    Shared<const Frame> toFrameSPtr;
+    Transform transform;
+};
+
+struct Storage
+{
+    std::mutex mutex;
+    std::atomic<Size> generation {0};
+    Size capacity = TransformCache::DefaultCapacity;
+    std::list<Entry> entries;  // Most recently used first
+    std::map<Key, std::list<Entry>::iterator> entryMap;
+
+    void evict()
+    {
+        while (entries.size() > capacity)
+        {
+            entryMap.erase(entries.back().key);
+            entries.pop_back();
+        }
+    }
+};
+
+Storage& AccessStorage()
+{
+    static Storage storage;
+
+    return storage;
+}
+
+}  // namespace
+
+Transform TransformCache::Get(
+    const Shared<const Frame>& aFromFrameSPtr, const Shared<const Frame>& aToFrameSPtr, const Instant& anInstant
+)
+{
+    if ((aFromFrameSPtr == nullptr) || (aToFrameSPtr == nullptr))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    const Key key = {
+        reinterpret_cast<std::uintptr_t>(aFromFrameSPtr.get()),
+        reinterpret_cast<std::uintptr_t>(aToFrameSPtr.get()),
+        anInstant
+    };
+
+    Storage& storage = AccessStorage();
+
+    {
+        const std::lock_guard<std::mutex> lock(storage.mutex);
+
+        const auto entryMapIterator = storage.entryMap.find(key);
+
+        if (entryMapIterator != storage.entryMap.end())
+        {
+            storage.entries.splice(storage.entries.begin(), storage.entries, entryMapIterator->second);
+
+            return entryMapIterator->second->transform;
+        }
+    }
+
+    const Size generation = storage.generation;
+
+    const Transform transform = EarthOrientation::GetTransform(aFromFrameSPtr, aToFrameSPtr, anInstant);
+
+    const std::lock_guard<std::mutex> lock(storage.mutex);
+
+    // Another thread may have cached the same transform in the meantime, or cleared the cache (e.g. on an Earth
+    // orientation model change), in which case the transform may be stale
+
+    if ((storage.capacity > 0) && (storage.generation == generation) &&
+        (storage.entryMap.find(key) == storage.entryMap.end()))
+    {
+        storage.entries.push_front({key, aFromFrameSPtr, aToFrameSPtr, transform});
+        storage.entryMap.emplace(key, storage.entries.begin());
+
+        storage.evict();
+    }
+
+    return transform;
+}
+
+Size TransformCache::GetSize()
+{
+    Storage& storage = AccessStorage();
+
+    const std::lock_guard<std::mutex> lock(storage.mutex);
+
+    return storage.entries.size();
+}
+
+Size TransformCache::GetCapacity()
+{
+    Storage& storage = AccessStorage();
+
+    const std::lock_guard<std::mutex> lock(storage.mutex);
+
+    return storage.capacity;
+}
+
+void TransformCache::SetCapacity(const Size& aCapacity)
+{
+    Storage& storage = AccessStorage();
+
+    const std::lock_guard<std::mutex> lock(storage.mutex);
+
+    storage.capacity = aCapacity;
+
+    storage.evict();
+}
+
+Size TransformCache::GetGeneration()
+{
+    return AccessStorage().generation;
+}
+
+void TransformCache::Clear()
+{
+    Storage& storage = AccessStorage();
+
+    const std::lock_guard<std::mutex> lock(storage.mutex);
+
+    storage.entryMap.clear();
+    storage.entries.clear();
+
+    ++storage.generation;
+}
+
+}  // namespace state
+}  // namespace trajectory
+}  // namespace astrodynamics
+}  // namespace ostk
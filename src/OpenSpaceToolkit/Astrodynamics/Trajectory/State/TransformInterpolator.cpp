@@ -0,0 +1,156 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <cmath>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/Quaternion.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/TransformInterpolator.hpp>
+
+namespace ostk
+{
+namespace astrodynamics
+{
+namespace trajectory
+{
+namespace state
+{
+
+using ostk::core::type::Index;
+
+using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+using ostk::mathematics::object::Vector3d;
+
+TransformInterpolator::TransformInterpolator(
+    const Shared<const Frame>& aFromFrameSPtr,
+    const Shared<const Frame>& aToFrameSPtr,
+    const Interval& anInterval,
+    const Duration& aStep
+)
+    : fromFrameSPtr_(aFromFrameSPtr),
+      toFrameSPtr_(aToFrameSPtr),
+      interval_(anInterval),
+      step_(aStep),
+      nodeTransforms_(Array<Transform>::Empty())
+{
+    if ((fromFrameSPtr_ == nullptr) || (!fromFrameSPtr_->isDefined()) || (toFrameSPtr_ == nullptr) ||
+        (!toFrameSPtr_->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    if (!interval_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    if ((!step_.isDefined()) || (!step_.isStrictlyPositive()))
+    {
+        throw ostk::core::error::runtime::Wrong("Step");
+    }
+
+    // At least one step, the last node lying at or after the end of the interval
+
+    const Size stepCount = std::max<Size>(
+        1, static_cast<Size>(std::ceil(interval_.getDuration().inSeconds() / step_.inSeconds()))
+    );
+
+    nodeTransforms_.reserve(stepCount + 1);
+
+    for (Index nodeIndex = 0; nodeIndex <= stepCount; ++nodeIndex)
+    {
+        nodeTransforms_.add(
+            fromFrameSPtr_->getTransformTo(toFrameSPtr_, interval_.accessStart() + step_ * double(nodeIndex))
+        );
+    }
+}
+
+Interval TransformInterpolator::getInterval() const
+{
+    return interval_;
+}
+
+Duration TransformInterpolator::getStep() const
+{
+    return step_;
+}
+
+Size TransformInterpolator::getNodeCount() const
+{
+    return nodeTransforms_.getSize();
+}
+
+Transform TransformInterpolator::getTransformAt(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (!interval_.contains(anInstant))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Instant [{}] is out of the interpolation interval [{}].", anInstant.toString(), interval_.toString()
+        );
+    }
+
+    const double stepRatio = (anInstant - interval_.accessStart()).inSeconds() / step_.inSeconds();
+
+    const Index nodeIndex =
+        std::min(static_cast<Index>(std::floor(stepRatio)), static_cast<Index>(nodeTransforms_.getSize() - 2));
+
+    return TransformInterpolator::Interpolate(
+        nodeTransforms_[nodeIndex], nodeTransforms_[nodeIndex + 1], anInstant, stepRatio - double(nodeIndex)
+    );
+}
+
+Transform TransformInterpolator::Interpolate(
+    const Transform& aPreviousTransform, const Transform& aNextTransform, const Instant& anInstant, const Real& aRatio
+)
+{
+    const double ratio = aRatio;
+
+    if (ratio == 0.0)
+    {
+        return aPreviousTransform;
+    }
+
+    const auto interpolate = [ratio](const Vector3d& aPreviousVector, const Vector3d& aNextVector) -> Vector3d
+    {
+        return aPreviousVector + ratio * (aNextVector - aPreviousVector);
+    };
+
+    // Both orientations are brought to the same hemisphere, for the interpolation to follow the shortest arc
+
+    const Quaternion previousOrientation = aPreviousTransform.getOrientation();
+    Quaternion nextOrientation = aNextTransform.getOrientation();
+
+    if ((previousOrientation.x() * nextOrientation.x() + previousOrientation.y() * nextOrientation.y() +
+         previousOrientation.z() * nextOrientation.z() + previousOrientation.s() * nextOrientation.s()) < 0.0)
+    {
+        nextOrientation = Quaternion(
+            -nextOrientation.x(),
+            -nextOrientation.y(),
+            -nextOrientation.z(),
+            -nextOrientation.s(),
+            Quaternion::Format::XYZS
+        );
+    }
+
+    return Transform::Passive(
+        anInstant,
+        interpolate(aPreviousTransform.getTranslation(), aNextTransform.getTranslation()),
+        interpolate(aPreviousTransform.getVelocity(), aNextTransform.getVelocity()),
+        Quaternion::SLERP(previousOrientation, nextOrientation, ratio),
+        interpolate(aPreviousTransform.getAngularVelocity(), aNextTransform.getAngularVelocity())
+    );
+}
+
+}  // namespace state
+}  // namespace trajectory
+}  // namespace astrodynamics
+}  // namespace ostk
@@ -129,98 +129,86 @@ const State StateBuilder::reduce(const State& aState) const
         throw ostk::core::error::runtime::Undefined("StateBuilder");
     }
 
-    if (!aState.isDefined())
+    this->validateState(aState, "State");
+
+    return this->buildFromSegments(this->computeReductionSegments(*aState.accessCoordinateBroker()), aState, aState);
+}
+
+const State StateBuilder::expand(const State& aState, const State& defaultState) const
+{
+    if (!this->isDefined())
     {
-        throw ostk::core::error::runtime::Undefined("State");
+        throw ostk::core::error::runtime::Undefined("StateBuilder");
     }
 
-    if (aState.accessFrame() != this->frameSPtr_)
+    this->validateState(aState, "State");
+    this->validateState(defaultState, "Default State");
+
+    return this->buildFromSegments(
+        this->computeExpansionSegments(*aState.accessCoordinateBroker(), *defaultState.accessCoordinateBroker()),
+        aState,
+        defaultState
+    );
+}
+
+Array<State> StateBuilder::reduce(const Array<State>& aStateArray) const
+{
+    if (!this->isDefined())
     {
-        throw ostk::core::error::runtime::Wrong("State Frame");
+        throw ostk::core::error::runtime::Undefined("StateBuilder");
     }
 
-    VectorXd coordinates = VectorXd(this->coordinatesBrokerSPtr_->getNumberOfCoordinates());
-    Integer nextIndex = 0;
+    Array<State> states = Array<State>::Empty();
+    states.reserve(aStateArray.getSize());
 
-    for (const auto& subset : this->coordinatesBrokerSPtr_->getSubsets())
+    const CoordinateBroker* coordinateBrokerPtr = nullptr;
+    Array<CoordinateSegment> segments = Array<CoordinateSegment>::Empty();
+
+    for (const State& state : aStateArray)
     {
-        if (!aState.accessCoordinateBroker()->hasSubset(subset))
+        this->validateState(state, "State");
+
+        if (state.accessCoordinateBroker().get() != coordinateBrokerPtr)
         {
-            throw ostk::core::error::RuntimeError("Missing CoordinateSubset: [{}]", subset->getName());
+            coordinateBrokerPtr = state.accessCoordinateBroker().get();
+            segments = this->computeReductionSegments(*coordinateBrokerPtr);
         }
 
-        const VectorXd subsetCoordinates = aState.extractCoordinate(subset);
-        coordinates.segment(nextIndex, subsetCoordinates.size()) = subsetCoordinates;
-        nextIndex += subsetCoordinates.size();
+        states.add(this->buildFromSegments(segments, state, state));
     }
 
-    return this->build(aState.accessInstant(), coordinates);
+    return states;
 }
 
-const State StateBuilder::expand(const State& aState, const State& defaultState) const
+Array<State> StateBuilder::expand(const Array<State>& aStateArray, const State& defaultState) const
 {
     if (!this->isDefined())
     {
         throw ostk::core::error::runtime::Undefined("StateBuilder");
     }
 
-    if (!aState.isDefined())
-    {
-        throw ostk::core::error::runtime::Undefined("State");
-    }
+    this->validateState(defaultState, "Default State");
 
-    if (aState.accessFrame() != this->frameSPtr_)
-    {
-        throw ostk::core::error::runtime::Wrong("State Frame");
-    }
+    Array<State> states = Array<State>::Empty();
+    states.reserve(aStateArray.getSize());
 
-    if (!defaultState.isDefined())
-    {
-        throw ostk::core::error::runtime::Undefined("Default State");
-    }
+    const CoordinateBroker* coordinateBrokerPtr = nullptr;
+    Array<CoordinateSegment> segments = Array<CoordinateSegment>::Empty();
 
-    if (defaultState.accessFrame() != this->frameSPtr_)
+    for (const State& state : aStateArray)
     {
-        throw ostk::core::error::runtime::Wrong("Default State Frame");
-    }
-
-    VectorXd coordinates = VectorXd(this->coordinatesBrokerSPtr_->getNumberOfCoordinates());
-    Integer nextIndex = 0;
-    Integer nonDefaultSubsetDetections = 0;
-
-    for (const auto& subset : this->coordinatesBrokerSPtr_->getSubsets())
-    {
-        bool subsetDetected = false;
-        VectorXd subsetCoordinates;
-
-        if (aState.accessCoordinateBroker()->hasSubset(subset))
-        {
-            subsetDetected = true;
-            nonDefaultSubsetDetections++;
-            subsetCoordinates = aState.extractCoordinate(subset);
-        }
-
-        if (!subsetDetected && defaultState.accessCoordinateBroker()->hasSubset(subset))
-        {
-            subsetDetected = true;
-            subsetCoordinates = defaultState.extractCoordinate(subset);
-        }
+        this->validateState(state, "State");
 
-        if (!subsetDetected)
+        if (state.accessCoordinateBroker().get() != coordinateBrokerPtr)
         {
-            throw ostk::core::error::RuntimeError("Missing CoordinateSubset: [{}]", subset->getName());
+            coordinateBrokerPtr = state.accessCoordinateBroker().get();
+            segments = this->computeExpansionSegments(*coordinateBrokerPtr, *defaultState.accessCoordinateBroker());
         }
 
-        coordinates.segment(nextIndex, subsetCoordinates.size()) = subsetCoordinates;
-        nextIndex += subsetCoordinates.size();
+        states.add(this->buildFromSegments(segments, state, defaultState));
     }
 
-    if (Size(nonDefaultSubsetDetections) != aState.accessCoordinateBroker()->getNumberOfSubsets())
-    {
-        throw ostk::core::error::RuntimeError("The operation is not an expansion");
-    }
-
-    return this->build(aState.accessInstant(), coordinates);
+    return states;
 }
 
 const Shared<const Frame> StateBuilder::accessFrame() const
@@ -288,6 +276,120 @@ StateBuilder StateBuilder::Undefined()
     return {Frame::Undefined(), nullptr};
 }
 
+void StateBuilder::validateState(const State& aState, const String& aName) const
+{
+    if (!aState.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined(aName);
+    }
+
+    if (aState.accessFrame() != this->frameSPtr_)
+    {
+        throw ostk::core::error::runtime::Wrong(aName + " Frame");
+    }
+}
+
+Array<StateBuilder::CoordinateSegment> StateBuilder::computeReductionSegments(
+    const CoordinateBroker& aCoordinateBroker
+) const
+{
+    Array<CoordinateSegment> segments = Array<CoordinateSegment>::Empty();
+    Index destinationIndex = 0;
+
+    for (const Shared<const CoordinateSubset>& subset : this->coordinatesBrokerSPtr_->accessSubsets())
+    {
+        if (!aCoordinateBroker.hasSubset(subset))
+        {
+            throw ostk::core::error::RuntimeError("Missing CoordinateSubset: [{}]", subset->getName());
+        }
+
+        StateBuilder::AddSegment(
+            segments, {false, aCoordinateBroker.getSubsetIndex(subset), destinationIndex, subset->getSize()}
+        );
+
+        destinationIndex += subset->getSize();
+    }
+
+    return segments;
+}
+
+Array<StateBuilder::CoordinateSegment> StateBuilder::computeExpansionSegments(
+    const CoordinateBroker& aCoordinateBroker, const CoordinateBroker& aDefaultCoordinateBroker
+) const
+{
+    Array<CoordinateSegment> segments = Array<CoordinateSegment>::Empty();
+    Index destinationIndex = 0;
+    Size nonDefaultSubsetDetections = 0;
+
+    for (const Shared<const CoordinateSubset>& subset : this->coordinatesBrokerSPtr_->accessSubsets())
+    {
+        if (aCoordinateBroker.hasSubset(subset))
+        {
+            nonDefaultSubsetDetections++;
+
+            StateBuilder::AddSegment(
+                segments, {false, aCoordinateBroker.getSubsetIndex(subset), destinationIndex, subset->getSize()}
+            );
+        }
+        else if (aDefaultCoordinateBroker.hasSubset(subset))
+        {
+            StateBuilder::AddSegment(
+                segments, {true, aDefaultCoordinateBroker.getSubsetIndex(subset), destinationIndex, subset->getSize()}
+            );
+        }
+        else
+        {
+            throw ostk::core::error::RuntimeError("Missing CoordinateSubset: [{}]", subset->getName());
+        }
+
+        destinationIndex += subset->getSize();
+    }
+
+    if (nonDefaultSubsetDetections != aCoordinateBroker.getNumberOfSubsets())
+    {
+        throw ostk::core::error::RuntimeError("The operation is not an expansion");
+    }
+
+    return segments;
+}
+
+State StateBuilder::buildFromSegments(
+    const Array<CoordinateSegment>& aCoordinateSegmentArray, const State& aState, const State& defaultState
+) const
+{
+    const Eigen::Ref<const VectorXd> coordinates = aState.accessCoordinates();
+    const Eigen::Ref<const VectorXd> defaultCoordinates = defaultState.accessCoordinates();
+
+    VectorXd outputCoordinates(this->coordinatesBrokerSPtr_->getNumberOfCoordinates());
+
+    for (const CoordinateSegment& segment : aCoordinateSegmentArray)
+    {
+        outputCoordinates.segment(segment.destinationIndex, segment.size) =
+            (segment.fromDefaultState ? defaultCoordinates : coordinates).segment(segment.sourceIndex, segment.size);
+    }
+
+    return this->build(aState.accessInstant(), outputCoordinates);
+}
+
+void StateBuilder::AddSegment(Array<CoordinateSegment>& aCoordinateSegmentArray, const CoordinateSegment& aSegment)
+{
+    // Subsets laid out contiguously in the same source are copied at once
+
+    if (!aCoordinateSegmentArray.isEmpty())
+    {
+        CoordinateSegment& lastSegment = aCoordinateSegmentArray.back();
+
+        if ((lastSegment.fromDefaultState == aSegment.fromDefaultState) &&
+            (lastSegment.sourceIndex + lastSegment.size == aSegment.sourceIndex))
+        {
+            lastSegment.size += aSegment.size;
+            return;
+        }
+    }
+
+    aCoordinateSegmentArray.add(aSegment);
+}
+
 }  // namespace trajectory
 }  // namespace astrodynamics
 }  // namespace ostk
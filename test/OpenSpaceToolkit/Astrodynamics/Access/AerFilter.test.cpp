@@ -0,0 +1,204 @@
+/// Apache License 2.0
+
+#include <cmath>
+#include <iterator>
+
+#include <OpenSpaceToolkit/Core/Container/Map.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Interval.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Spherical/AER.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Access/AerFilter.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Map;
+using ostk::core::type::Real;
+
+using ostk::mathematics::object::Interval;
+
+using ostk::physics::coordinate::spherical::AER;
+using ostk::physics::unit::Angle;
+using ostk::physics::unit::Length;
+
+using ostk::astrodynamics::access::AerFilter;
+
+class OpenSpaceToolkit_Astrodynamics_Access_AerFilter : public ::testing::Test
+{
+   protected:
+    static AER Aer(const Real& anAzimuth, const Real& anElevation, const Real& aRange)
+    {
+        return {Angle::Degrees(anAzimuth), Angle::Degrees(anElevation), Length::Meters(aRange)};
+    }
+
+    const Interval<Real> elevationInterval_ = Interval<Real>::Closed(10.0, 90.0);
+    const Interval<Real> rangeInterval_ = Interval<Real>::Closed(0.0, 2.0e6);
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_AerFilter, Intervals)
+{
+    {
+        const AerFilter aerFilter = AerFilter::Elevation(elevationInterval_);
+
+        EXPECT_TRUE(aerFilter.isDefined());
+        EXPECT_TRUE(aerFilter(Aer(0.0, 45.0, 1.0e7)));
+        EXPECT_FALSE(aerFilter(Aer(0.0, 5.0, 1.0e6)));
+    }
+
+    {
+        const AerFilter aerFilter = AerFilter::Azimuth(Interval<Real>::Closed(90.0, 180.0));
+
+        EXPECT_TRUE(aerFilter(Aer(120.0, 0.0, 1.0e6)));
+        EXPECT_FALSE(aerFilter(Aer(270.0, 0.0, 1.0e6)));
+    }
+
+    {
+        const AerFilter aerFilter = AerFilter::Range(rangeInterval_);
+
+        EXPECT_TRUE(aerFilter(Aer(0.0, 0.0, 1.0e6)));
+        EXPECT_FALSE(aerFilter(Aer(0.0, 45.0, 3.0e6)));
+    }
+
+    {
+        const AerFilter aerFilter = AerFilter::Ranges(Interval<Real>::Undefined(), elevationInterval_, rangeInterval_);
+
+        EXPECT_TRUE(aerFilter(Aer(300.0, 45.0, 1.0e6)));
+        EXPECT_FALSE(aerFilter(Aer(300.0, 5.0, 1.0e6)));
+        EXPECT_FALSE(aerFilter(Aer(300.0, 45.0, 3.0e6)));
+    }
+
+    {
+        EXPECT_ANY_THROW(AerFilter::Elevation(Interval<Real>::Undefined()));
+        EXPECT_ANY_THROW(AerFilter::Range(Interval<Real>::Undefined()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_AerFilter, Mask)
+{
+    {
+        const Map<Real, Real> mask = {{0.0, 10.0}, {180.0, 30.0}};
+
+        const AerFilter aerFilter = AerFilter::Mask(mask, rangeInterval_);
+
+        EXPECT_TRUE(aerFilter(Aer(90.0, 25.0, 1.0e6)));
+        EXPECT_FALSE(aerFilter(Aer(90.0, 15.0, 1.0e6)));
+        EXPECT_FALSE(aerFilter(Aer(90.0, 25.0, 3.0e6)));
+    }
+
+    {
+        EXPECT_ANY_THROW(AerFilter::Mask({}, rangeInterval_));
+        EXPECT_ANY_THROW(AerFilter::Mask({{0.0, 95.0}}, rangeInterval_));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_AerFilter, MaskLookup)
+{
+    // Dense mask, evaluated against a direct linear interpolation between mask points
+
+    {
+        Map<Real, Real> mask;
+
+        for (int index = 0; index < 3600; ++index)
+        {
+            const double azimuth = index * 0.1;
+
+            mask.insert({azimuth, 20.0 + 15.0 * std::sin(azimuth * M_PI / 18.0)});
+        }
+
+        const AerFilter aerFilter = AerFilter::Mask(mask, Interval<Real>::Undefined());
+
+        for (int index = 0; index < 7200; ++index)
+        {
+            const double azimuth = index * 0.05 + 0.01;
+
+            const auto upperIt = mask.upper_bound(azimuth);
+            const auto lowerIt = std::prev(upperIt);
+
+            // The mask wraps around to its first point at 360 deg
+
+            const double lowerAzimuth = lowerIt->first;
+            const double lowerElevation = lowerIt->second;
+            const double upperAzimuth = (upperIt != mask.end()) ? double(upperIt->first) : 360.0;
+            const double upperElevation =
+                (upperIt != mask.end()) ? double(upperIt->second) : double(mask.begin()->second);
+
+            const double minimumElevation = lowerElevation + (upperElevation - lowerElevation) *
+                                                                 (azimuth - lowerAzimuth) /
+                                                                 (upperAzimuth - lowerAzimuth);
+
+            EXPECT_TRUE(aerFilter(Aer(azimuth, minimumElevation + 1.0e-6, 1.0e6))) << azimuth;
+            EXPECT_FALSE(aerFilter(Aer(azimuth, minimumElevation - 1.0e-6, 1.0e6))) << azimuth;
+        }
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_AerFilter, Evaluate)
+{
+    {
+        const Map<Real, Real> mask = {{0.0, 10.0}, {180.0, 30.0}};
+
+        const AerFilter aerFilter = AerFilter::Mask(mask, rangeInterval_);
+
+        EXPECT_TRUE(aerFilter.evaluate(M_PI / 2.0, 25.0 * M_PI / 180.0, 1.0e6));
+        EXPECT_FALSE(aerFilter.evaluate(M_PI / 2.0, 15.0 * M_PI / 180.0, 1.0e6));
+        EXPECT_FALSE(aerFilter.evaluate(M_PI / 2.0, 25.0 * M_PI / 180.0, 3.0e6));
+    }
+
+    {
+        const AerFilter aerFilter =
+            AerFilter::And({AerFilter::Elevation(elevationInterval_), AerFilter::Range(rangeInterval_)});
+
+        EXPECT_EQ(aerFilter(Aer(0.0, 45.0, 1.0e6)), aerFilter.evaluate(0.0, M_PI / 4.0, 1.0e6));
+        EXPECT_EQ(aerFilter(Aer(0.0, 5.0, 1.0e6)), aerFilter.evaluate(0.0, 5.0 * M_PI / 180.0, 1.0e6));
+    }
+
+    {
+        EXPECT_THROW(AerFilter::Undefined().evaluate(0.0, 0.0, 0.0), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_AerFilter, Composition)
+{
+    const AerFilter elevationFilter = AerFilter::Elevation(elevationInterval_);
+    const AerFilter rangeFilter = AerFilter::Range(rangeInterval_);
+
+    {
+        const AerFilter aerFilter = AerFilter::And({elevationFilter, rangeFilter});
+
+        EXPECT_TRUE(aerFilter(Aer(0.0, 45.0, 1.0e6)));
+        EXPECT_FALSE(aerFilter(Aer(0.0, 5.0, 1.0e6)));
+        EXPECT_FALSE(aerFilter(Aer(0.0, 45.0, 3.0e6)));
+    }
+
+    {
+        const AerFilter aerFilter = AerFilter::Or({elevationFilter, rangeFilter});
+
+        EXPECT_TRUE(aerFilter(Aer(0.0, 5.0, 1.0e6)));
+        EXPECT_TRUE(aerFilter(Aer(0.0, 45.0, 3.0e6)));
+        EXPECT_FALSE(aerFilter(Aer(0.0, 5.0, 3.0e6)));
+    }
+
+    {
+        const AerFilter aerFilter = AerFilter::Not(elevationFilter);
+
+        EXPECT_FALSE(aerFilter(Aer(0.0, 45.0, 1.0e6)));
+        EXPECT_TRUE(aerFilter(Aer(0.0, 5.0, 1.0e6)));
+    }
+
+    {
+        EXPECT_ANY_THROW(AerFilter::And({elevationFilter, AerFilter::Undefined()}));
+        EXPECT_ANY_THROW(AerFilter::Not(AerFilter::Undefined()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_AerFilter, Undefined)
+{
+    {
+        EXPECT_FALSE(AerFilter::Undefined().isDefined());
+        EXPECT_THROW(AerFilter::Undefined()(Aer(0.0, 45.0, 1.0e6)), ostk::core::error::runtime::Undefined);
+    }
+}
@@ -0,0 +1,305 @@
+/// Apache License 2.0
+
+#include <algorithm>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Interval.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Spherical/LLA.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Earth.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Access/CoverageGenerator.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Access/Generator.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler/COE.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Real;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::spherical::LLA;
+using ostk::physics::Environment;
+using ostk::physics::environment::gravitational::Earth;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::time::Scale;
+using ostk::physics::unit::Angle;
+using ostk::physics::unit::Length;
+
+using ostk::astrodynamics::Access;
+using ostk::astrodynamics::access::CoverageGenerator;
+using ostk::astrodynamics::access::Generator;
+using ostk::astrodynamics::Trajectory;
+using ostk::astrodynamics::trajectory::Orbit;
+using ostk::astrodynamics::trajectory::orbit::model::Kepler;
+using ostk::astrodynamics::trajectory::orbit::model::kepler::COE;
+
+class OpenSpaceToolkit_Astrodynamics_Access_CoverageGenerator : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        for (const Real& raan_deg : {0.0, 120.0})
+        {
+            const COE coe = {
+                Length::Kilometers(7000.0),
+                0.0,
+                Angle::Degrees(60.0),
+                Angle::Degrees(raan_deg),
+                Angle::Degrees(0.0),
+                Angle::Degrees(0.0),
+            };
+
+            const Kepler keplerianModel = {
+                coe,
+                this->startInstant_,
+                Earth::EGM2008.gravitationalParameter_,
+                Earth::EGM2008.equatorialRadius_,
+                Earth::EGM2008.J2_,
+                Earth::EGM2008.J4_,
+                Kepler::PerturbationType::None
+            };
+
+            this->satellites_.add(Orbit(keplerianModel, this->earthSPtr_));
+        }
+    }
+
+    const Environment environment_ = Environment::Default();
+    const Shared<const Celestial> earthSPtr_ = environment_.accessCelestialObjectWithName("Earth");
+
+    const Instant startInstant_ = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+    const Interval interval_ = Interval::Closed(startInstant_, startInstant_ + Duration::Hours(12.0));
+
+    const Array<LLA> gridPoints_ = {
+        LLA(Angle::Degrees(0.0), Angle::Degrees(0.0), Length::Meters(0.0)),
+        LLA(Angle::Degrees(30.0), Angle::Degrees(-60.0), Length::Meters(100.0)),
+        LLA(Angle::Degrees(55.0), Angle::Degrees(100.0), Length::Meters(0.0)),
+        LLA(Angle::Degrees(-45.0), Angle::Degrees(170.0), Length::Meters(0.0)),
+        LLA(Angle::Degrees(89.0), Angle::Degrees(0.0), Length::Meters(0.0)),
+    };
+
+    Array<Trajectory> satellites_ = Array<Trajectory>::Empty();
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_CoverageGenerator, Constructor)
+{
+    {
+        EXPECT_NO_THROW(CoverageGenerator(this->gridPoints_, Angle::Degrees(10.0), this->earthSPtr_));
+    }
+
+    {
+        const CoverageGenerator coverageGenerator = {
+            this->gridPoints_, Angle::Degrees(10.0), this->earthSPtr_, Duration::Seconds(30.0)
+        };
+
+        EXPECT_TRUE(coverageGenerator.isDefined());
+        EXPECT_EQ(this->gridPoints_.getSize(), coverageGenerator.getGridPoints().getSize());
+        EXPECT_EQ(Angle::Degrees(10.0), coverageGenerator.getMinimumElevation());
+        EXPECT_EQ(Duration::Seconds(30.0), coverageGenerator.getStep());
+        EXPECT_EQ(CoverageGenerator::Backend::CPU, coverageGenerator.getBackend());
+    }
+
+    {
+        EXPECT_FALSE(CoverageGenerator(this->gridPoints_, Angle::Undefined(), this->earthSPtr_).isDefined());
+        EXPECT_FALSE(CoverageGenerator(this->gridPoints_, Angle::Degrees(10.0), nullptr).isDefined());
+        EXPECT_FALSE(
+            CoverageGenerator(this->gridPoints_, Angle::Degrees(10.0), this->earthSPtr_, Duration::Zero()).isDefined()
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_CoverageGenerator, ComputeCoverage)
+{
+    const Duration step = Duration::Minutes(1.0);
+
+    const CoverageGenerator coverageGenerator = {this->gridPoints_, Angle::Degrees(10.0), this->earthSPtr_, step};
+
+    const Array<CoverageGenerator::PointCoverage> pointCoverages =
+        coverageGenerator.computeCoverage(this->interval_, this->satellites_);
+
+    ASSERT_EQ(this->gridPoints_.getSize(), pointCoverages.getSize());
+
+    // Reference: accesses of each grid point with each satellite, merged
+
+    Generator generator = Generator::AerRanges(
+        ostk::mathematics::object::Interval<Real>::Closed(0.0, 360.0),
+        ostk::mathematics::object::Interval<Real>::Closed(10.0, 90.0),
+        ostk::mathematics::object::Interval<Real>::Closed(0.0, 1.0e10),
+        this->environment_
+    );
+
+    generator.setStep(step);
+
+    for (Size pointIndex = 0; pointIndex < this->gridPoints_.getSize(); ++pointIndex)
+    {
+        const Trajectory gridPointTrajectory = Trajectory::Position(Position::Meters(
+            this->gridPoints_[pointIndex].toCartesian(Earth::EGM2008.equatorialRadius_, Earth::EGM2008.flattening_),
+            Frame::ITRF()
+        ));
+
+        Array<Interval> referenceAccessIntervals = Array<Interval>::Empty();
+
+        for (const Trajectory& satellite : this->satellites_)
+        {
+            for (const Access& access : generator.computeAccesses(this->interval_, gridPointTrajectory, satellite))
+            {
+                referenceAccessIntervals.add(access.getInterval());
+            }
+        }
+
+        std::sort(
+            referenceAccessIntervals.begin(),
+            referenceAccessIntervals.end(),
+            [](const Interval& anInterval, const Interval& anotherInterval) -> bool
+            {
+                return anInterval.accessStart() < anotherInterval.accessStart();
+            }
+        );
+
+        Array<Interval> mergedReferenceAccessIntervals = Array<Interval>::Empty();
+
+        for (const Interval& referenceAccessInterval : referenceAccessIntervals)
+        {
+            if (!mergedReferenceAccessIntervals.isEmpty() &&
+                (referenceAccessInterval.accessStart() <= mergedReferenceAccessIntervals.back().accessEnd()))
+            {
+                const Interval lastInterval = mergedReferenceAccessIntervals.back();
+
+                mergedReferenceAccessIntervals.back() = Interval::Closed(
+                    lastInterval.accessStart(), std::max(lastInterval.accessEnd(), referenceAccessInterval.accessEnd())
+                );
+
+                continue;
+            }
+
+            mergedReferenceAccessIntervals.add(referenceAccessInterval);
+        }
+
+        const CoverageGenerator::PointCoverage& pointCoverage = pointCoverages[pointIndex];
+
+        ASSERT_EQ(mergedReferenceAccessIntervals.getSize(), pointCoverage.accessIntervals.getSize());
+
+        Duration accessDuration = Duration::Zero();
+
+        for (Size accessIndex = 0; accessIndex < mergedReferenceAccessIntervals.getSize(); ++accessIndex)
+        {
+            const Interval& referenceAccessInterval = mergedReferenceAccessIntervals[accessIndex];
+            const Interval& accessInterval = pointCoverage.accessIntervals[accessIndex];
+
+            // Access intervals are resolved to the step
+
+            EXPECT_TRUE(accessInterval.accessStart().isNear(referenceAccessInterval.accessStart(), step));
+            EXPECT_TRUE(accessInterval.accessEnd().isNear(referenceAccessInterval.accessEnd(), step));
+
+            accessDuration += accessInterval.getDuration();
+        }
+
+        EXPECT_EQ(accessDuration, pointCoverage.accessDuration);
+        EXPECT_GE(pointCoverage.maximumRevisitDuration, pointCoverage.meanRevisitDuration);
+        EXPECT_LE(pointCoverage.maximumRevisitDuration, this->interval_.getDuration());
+
+        if (pointCoverage.accessIntervals.isEmpty())
+        {
+            EXPECT_EQ(this->interval_.getDuration(), pointCoverage.maximumRevisitDuration);
+            EXPECT_EQ(this->interval_.getDuration(), pointCoverage.meanRevisitDuration);
+        }
+    }
+
+    // The near-polar grid point is out of reach of the 60 deg inclined orbits
+
+    EXPECT_TRUE(pointCoverages[4].accessIntervals.isEmpty());
+    EXPECT_FALSE(pointCoverages[0].accessIntervals.isEmpty());
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_CoverageGenerator, ComputeCoverage_Backend)
+{
+    EXPECT_TRUE(CoverageGenerator::IsBackendAvailable(CoverageGenerator::Backend::CPU));
+
+    if (!CoverageGenerator::IsBackendAvailable(CoverageGenerator::Backend::CUDA))
+    {
+        EXPECT_ANY_THROW(CoverageGenerator(
+            this->gridPoints_,
+            Angle::Degrees(10.0),
+            this->earthSPtr_,
+            Duration::Minutes(1.0),
+            CoverageGenerator::Backend::CUDA
+        ));
+
+        GTEST_SKIP() << "CUDA backend is not available.";
+    }
+
+    const CoverageGenerator cpuCoverageGenerator = {
+        this->gridPoints_,
+        Angle::Degrees(10.0),
+        this->earthSPtr_,
+        Duration::Minutes(1.0),
+        CoverageGenerator::Backend::CPU
+    };
+    const CoverageGenerator cudaCoverageGenerator = {
+        this->gridPoints_,
+        Angle::Degrees(10.0),
+        this->earthSPtr_,
+        Duration::Minutes(1.0),
+        CoverageGenerator::Backend::CUDA
+    };
+
+    const Array<CoverageGenerator::PointCoverage> cpuPointCoverages =
+        cpuCoverageGenerator.computeCoverage(this->interval_, this->satellites_);
+    const Array<CoverageGenerator::PointCoverage> cudaPointCoverages =
+        cudaCoverageGenerator.computeCoverage(this->interval_, this->satellites_);
+
+    ASSERT_EQ(cpuPointCoverages.getSize(), cudaPointCoverages.getSize());
+
+    for (Size index = 0; index < cpuPointCoverages.getSize(); ++index)
+    {
+        EXPECT_EQ(cpuPointCoverages[index].accessIntervals, cudaPointCoverages[index].accessIntervals);
+        EXPECT_EQ(cpuPointCoverages[index].maximumRevisitDuration, cudaPointCoverages[index].maximumRevisitDuration);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_CoverageGenerator, ComputeCoverage_Empty)
+{
+    const CoverageGenerator coverageGenerator = {this->gridPoints_, Angle::Degrees(10.0), this->earthSPtr_};
+
+    {
+        const Array<CoverageGenerator::PointCoverage> pointCoverages =
+            coverageGenerator.computeCoverage(this->interval_, Array<Trajectory>::Empty());
+
+        ASSERT_EQ(this->gridPoints_.getSize(), pointCoverages.getSize());
+
+        for (const CoverageGenerator::PointCoverage& pointCoverage : pointCoverages)
+        {
+            EXPECT_TRUE(pointCoverage.accessIntervals.isEmpty());
+            EXPECT_EQ(Duration::Zero(), pointCoverage.accessDuration);
+            EXPECT_EQ(this->interval_.getDuration(), pointCoverage.maximumRevisitDuration);
+        }
+    }
+
+    {
+        const CoverageGenerator emptyCoverageGenerator = {Array<LLA>::Empty(), Angle::Degrees(10.0), this->earthSPtr_};
+
+        EXPECT_TRUE(emptyCoverageGenerator.computeCoverage(this->interval_, this->satellites_).isEmpty());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_CoverageGenerator, ComputeCoverage_Undefined)
+{
+    const CoverageGenerator coverageGenerator = {this->gridPoints_, Angle::Degrees(10.0), this->earthSPtr_};
+
+    EXPECT_ANY_THROW(coverageGenerator.computeCoverage(Interval::Undefined(), this->satellites_));
+    EXPECT_ANY_THROW(coverageGenerator.computeCoverage(this->interval_, {Trajectory::Undefined()}));
+    EXPECT_ANY_THROW(CoverageGenerator::Undefined().computeCoverage(this->interval_, this->satellites_));
+    EXPECT_ANY_THROW(CoverageGenerator::Undefined().getGridPoints());
+}
@@ -0,0 +1,264 @@
+/// Apache License 2.0
+
+#include <cmath>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/Quaternion.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Interval.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Access.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Access/CrosslinkGenerator.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/Profile.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler/COE.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Real;
+using ostk::core::type::Shared;
+
+using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::Environment;
+using ostk::physics::environment::gravitational::Earth;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::time::Scale;
+using ostk::physics::unit::Angle;
+using ostk::physics::unit::Length;
+
+using ostk::astrodynamics::Access;
+using ostk::astrodynamics::access::CrosslinkGenerator;
+using ostk::astrodynamics::flight::Profile;
+using ostk::astrodynamics::Trajectory;
+using ostk::astrodynamics::trajectory::Orbit;
+using ostk::astrodynamics::trajectory::orbit::model::Kepler;
+using ostk::astrodynamics::trajectory::orbit::model::kepler::COE;
+
+class OpenSpaceToolkit_Astrodynamics_Access_CrosslinkGenerator : public ::testing::Test
+{
+   protected:
+    // Circular equatorial orbit, with a given semi-major axis and true anomaly at the start instant
+    Orbit generateOrbit(const Length& aSemiMajorAxis, const Angle& aTrueAnomaly) const
+    {
+        const COE coe = {
+            aSemiMajorAxis,
+            0.0,
+            Angle::Degrees(0.0),
+            Angle::Degrees(0.0),
+            Angle::Degrees(0.0),
+            aTrueAnomaly,
+        };
+
+        const Kepler keplerianModel = {
+            coe,
+            this->startInstant_,
+            Earth::EGM2008.gravitationalParameter_,
+            Earth::EGM2008.equatorialRadius_,
+            Earth::EGM2008.J2_,
+            Earth::EGM2008.J4_,
+            Kepler::PerturbationType::None
+        };
+
+        return {keplerianModel, this->earthSPtr_};
+    }
+
+    const Environment environment_ = Environment::Default();
+    const Shared<const Celestial> earthSPtr_ = environment_.accessCelestialObjectWithName("Earth");
+
+    const Instant startInstant_ = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+    const Interval interval_ = Interval::Closed(startInstant_, startInstant_ + Duration::Hours(12.0));
+
+    const ostk::mathematics::object::Interval<Real> rangeInterval_ =
+        ostk::mathematics::object::Interval<Real>::Closed(0.0, 1.0e7);
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_CrosslinkGenerator, Constructor)
+{
+    {
+        EXPECT_NO_THROW(CrosslinkGenerator(this->earthSPtr_, this->rangeInterval_, Length::Kilometers(100.0)));
+    }
+
+    {
+        const CrosslinkGenerator crosslinkGenerator = {
+            this->earthSPtr_,
+            this->rangeInterval_,
+            Length::Kilometers(100.0),
+            Duration::Seconds(30.0),
+            Duration::Milliseconds(1.0),
+        };
+
+        EXPECT_TRUE(crosslinkGenerator.isDefined());
+        EXPECT_EQ(this->rangeInterval_, crosslinkGenerator.getRangeInterval());
+        EXPECT_EQ(Length::Kilometers(100.0), crosslinkGenerator.getGrazingAltitude());
+        EXPECT_EQ(Duration::Seconds(30.0), crosslinkGenerator.getStep());
+        EXPECT_EQ(Duration::Milliseconds(1.0), crosslinkGenerator.getTolerance());
+    }
+
+    {
+        EXPECT_FALSE(CrosslinkGenerator(nullptr, this->rangeInterval_, Length::Kilometers(100.0)).isDefined());
+        EXPECT_FALSE(CrosslinkGenerator(this->earthSPtr_, this->rangeInterval_, Length::Undefined()).isDefined());
+        EXPECT_FALSE(
+            CrosslinkGenerator(this->earthSPtr_, this->rangeInterval_, Length::Kilometers(100.0), Duration::Zero())
+                .isDefined()
+        );
+
+        EXPECT_FALSE(CrosslinkGenerator::Undefined().isDefined());
+        EXPECT_ANY_THROW(CrosslinkGenerator::Undefined().getStep());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_CrosslinkGenerator, IsActiveAt)
+{
+    // Satellites on the same circular orbit, 30 deg apart: the chord clears the Earth by ~380 km
+
+    const Trajectory fromTrajectory = this->generateOrbit(Length::Kilometers(7000.0), Angle::Degrees(0.0));
+    const Trajectory toTrajectory = this->generateOrbit(Length::Kilometers(7000.0), Angle::Degrees(30.0));
+
+    {
+        const CrosslinkGenerator crosslinkGenerator = {
+            this->earthSPtr_, this->rangeInterval_, Length::Kilometers(100.0)
+        };
+
+        EXPECT_TRUE(crosslinkGenerator.isActiveAt(this->startInstant_, fromTrajectory, toTrajectory));
+    }
+
+    {
+        const CrosslinkGenerator crosslinkGenerator = {
+            this->earthSPtr_, this->rangeInterval_, Length::Kilometers(500.0)
+        };
+
+        EXPECT_FALSE(crosslinkGenerator.isActiveAt(this->startInstant_, fromTrajectory, toTrajectory));
+    }
+
+    {
+        const CrosslinkGenerator crosslinkGenerator = {
+            this->earthSPtr_, ostk::mathematics::object::Interval<Real>::Closed(0.0, 3.0e6), Length::Kilometers(100.0)
+        };
+
+        EXPECT_FALSE(crosslinkGenerator.isActiveAt(this->startInstant_, fromTrajectory, toTrajectory));
+    }
+
+    {
+        EXPECT_ANY_THROW(
+            CrosslinkGenerator::Undefined().isActiveAt(this->startInstant_, fromTrajectory, toTrajectory)
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_CrosslinkGenerator, ComputeAccesses)
+{
+    // Satellites at different altitudes drift relative to each other, hence are periodically occulted by the Earth
+
+    const Trajectory fromTrajectory = this->generateOrbit(Length::Kilometers(7000.0), Angle::Degrees(0.0));
+    const Trajectory toTrajectory = this->generateOrbit(Length::Kilometers(7500.0), Angle::Degrees(0.0));
+
+    const CrosslinkGenerator crosslinkGenerator = {this->earthSPtr_, this->rangeInterval_, Length::Kilometers(100.0)};
+
+    const Array<Access> accesses = crosslinkGenerator.computeAccesses(this->interval_, fromTrajectory, toTrajectory);
+
+    ASSERT_FALSE(accesses.isEmpty());
+
+    const Duration margin = Duration::Seconds(1.0);
+
+    for (const Access& access : accesses)
+    {
+        EXPECT_TRUE(access.isDefined());
+        EXPECT_TRUE(access.getInterval().contains(access.getTimeOfClosestApproach()));
+
+        EXPECT_TRUE(crosslinkGenerator.isActiveAt(
+            access.getAcquisitionOfSignal() + margin, fromTrajectory, toTrajectory
+        ));
+        EXPECT_TRUE(crosslinkGenerator.isActiveAt(access.getLossOfSignal() - margin, fromTrajectory, toTrajectory));
+
+        if (access.isComplete())
+        {
+            EXPECT_FALSE(crosslinkGenerator.isActiveAt(
+                access.getAcquisitionOfSignal() - margin, fromTrajectory, toTrajectory
+            ));
+            EXPECT_FALSE(crosslinkGenerator.isActiveAt(
+                access.getLossOfSignal() + margin, fromTrajectory, toTrajectory
+            ));
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(
+            CrosslinkGenerator::Undefined().computeAccesses(this->interval_, fromTrajectory, toTrajectory)
+        );
+        EXPECT_ANY_THROW(crosslinkGenerator.computeAccesses(Interval::Undefined(), fromTrajectory, toTrajectory));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_CrosslinkGenerator, ComputeAccessesWithFieldOfView)
+{
+    // Satellites on the same circular orbit, 30 deg apart: the line of sight rotates once per orbit, hence an
+    // inertially pointed field of view sees the "to" satellite once per orbit
+
+    const Orbit fromOrbit = this->generateOrbit(Length::Kilometers(7000.0), Angle::Degrees(0.0));
+    const Trajectory toTrajectory = this->generateOrbit(Length::Kilometers(7000.0), Angle::Degrees(30.0));
+
+    const Profile fromProfile = Profile::InertialPointing(fromOrbit, Quaternion::Unit());
+
+    const CrosslinkGenerator crosslinkGenerator = {this->earthSPtr_, this->rangeInterval_, Length::Kilometers(100.0)};
+
+    const Angle halfAngle = Angle::Degrees(10.0);
+
+    // Boresight along the initial line of sight, at 105 deg from the X axis
+
+    const CrosslinkGenerator::FieldOfView fieldOfView = {
+        {std::cos(105.0 * M_PI / 180.0), std::sin(105.0 * M_PI / 180.0), 0.0},
+        halfAngle,
+    };
+
+    const Array<Access> accesses =
+        crosslinkGenerator.computeAccesses(this->interval_, fromProfile, fieldOfView, toTrajectory);
+
+    ASSERT_FALSE(accesses.isEmpty());
+
+    EXPECT_EQ(this->startInstant_, accesses.accessFirst().getAcquisitionOfSignal());
+
+    const Duration period = fromOrbit.accessModel().as<Kepler>().getClassicalOrbitalElements().getOrbitalPeriod(
+        Earth::EGM2008.gravitationalParameter_
+    );
+
+    const Duration expectedDuration = period * (2.0 * halfAngle.inDegrees() / 360.0);
+
+    for (const Access& access : accesses)
+    {
+        if (access.isComplete())
+        {
+            EXPECT_NEAR(expectedDuration.inSeconds(), access.getDuration().inSeconds(), 1.0);
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(crosslinkGenerator.computeAccesses(
+            this->interval_, fromProfile, {Vector3d::Zero(), halfAngle}, toTrajectory
+        ));
+        EXPECT_ANY_THROW(crosslinkGenerator.computeAccesses(
+            this->interval_, fromProfile, {Vector3d::X(), Angle::Undefined()}, toTrajectory
+        ));
+    }
+}
@@ -1,6 +1,7 @@
 /// Apache License 2.0
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Pair.hpp>
 #include <OpenSpaceToolkit/Core/Container/Table.hpp>
 #include <OpenSpaceToolkit/Core/Container/Tuple.hpp>
 #include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
@@ -12,6 +13,7 @@
 #include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Earth.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Access/Generator.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Model/Piecewise.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler/COE.hpp>
@@ -21,19 +23,26 @@
 #include <Global.test.hpp>
 
 using ostk::core::container::Array;
+using ostk::core::container::Pair;
 using ostk::core::container::Table;
 using ostk::core::container::Tuple;
 using ostk::core::filesystem::File;
 using ostk::core::filesystem::Path;
 using ostk::core::type::Real;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 
+using ostk::mathematics::object::Matrix3d;
+using ostk::mathematics::object::Vector3d;
+
 using ostk::physics::coordinate::Frame;
 using ostk::physics::coordinate::Position;
 using ostk::physics::coordinate::spherical::AER;
 using ostk::physics::coordinate::spherical::LLA;
 using ostk::physics::coordinate::Velocity;
 using ostk::physics::Environment;
+using ostk::physics::environment::object::Celestial;
 using ostk::physics::environment::gravitational::Earth;
 using ostk::physics::time::DateTime;
 using ostk::physics::time::Duration;
@@ -46,7 +55,9 @@ using ostk::physics::unit::Length;
 
 using ostk::astrodynamics::Access;
 using ostk::astrodynamics::access::Generator;
+using ostk::astrodynamics::access::GeneratorContext;
 using ostk::astrodynamics::Trajectory;
+using ostk::astrodynamics::trajectory::model::Piecewise;
 using ostk::astrodynamics::trajectory::Orbit;
 using ostk::astrodynamics::trajectory::orbit::model::Kepler;
 using ostk::astrodynamics::trajectory::orbit::model::kepler::COE;
@@ -646,6 +657,366 @@ TEST(OpenSpaceToolkit_Astrodynamics_Access_Generator, ComputeAccesses_4)
     }
 }
 
+TEST(OpenSpaceToolkit_Astrodynamics_Access_Generator, ComputeAccesses_5)
+{
+    const Environment environment = Environment::Default();
+
+    const Generator generator = {environment};
+
+    const Instant startInstant = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+    const Instant endInstant = Instant::DateTime(DateTime(2018, 1, 1, 12, 0, 0), Scale::UTC);
+
+    const Interval interval = Interval::Closed(startInstant, endInstant);
+
+    const auto generateGroundStationTrajectory = [](const LLA& aGroundStationLla) -> Trajectory
+    {
+        const Position groundStationPosition = Position::Meters(
+            aGroundStationLla.toCartesian(Earth::EGM2008.equatorialRadius_, Earth::EGM2008.flattening_), Frame::ITRF()
+        );
+
+        return Trajectory::Position(groundStationPosition);
+    };
+
+    const auto generateSatelliteOrbit = [&environment, &startInstant](const Angle& aRaan) -> Orbit
+    {
+        const COE coe = {
+            Length::Kilometers(7000.0),
+            0.0,
+            Angle::Degrees(+45.0),
+            aRaan,
+            Angle::Degrees(0.0),
+            Angle::Degrees(0.0),
+        };
+
+        const Kepler keplerianModel = {
+            coe,
+            startInstant,
+            Earth::EGM2008.gravitationalParameter_,
+            Earth::EGM2008.equatorialRadius_,
+            Earth::EGM2008.J2_,
+            Earth::EGM2008.J4_,
+            Kepler::PerturbationType::None
+        };
+
+        return {keplerianModel, environment.accessCelestialObjectWithName("Earth")};
+    };
+
+    const Array<Trajectory> fromTrajectories = {
+        generateGroundStationTrajectory({Angle::Degrees(0.0), Angle::Degrees(0.0), Length::Meters(20.0)}),
+        generateGroundStationTrajectory({Angle::Degrees(30.0), Angle::Degrees(60.0), Length::Meters(20.0)}),
+    };
+
+    const Array<Trajectory> toTrajectories = {
+        generateSatelliteOrbit(Angle::Degrees(0.0)),
+        generateSatelliteOrbit(Angle::Degrees(90.0)),
+        generateSatelliteOrbit(Angle::Degrees(180.0)),
+    };
+
+    {
+        for (const Size threadCount : {0, 1, 4})
+        {
+            const Array<Array<Array<Access>>> accessesMatrix =
+                generator.computeAccesses(interval, fromTrajectories, toTrajectories, threadCount);
+
+            ASSERT_EQ(fromTrajectories.getSize(), accessesMatrix.getSize());
+
+            for (Size fromIndex = 0; fromIndex < fromTrajectories.getSize(); ++fromIndex)
+            {
+                ASSERT_EQ(toTrajectories.getSize(), accessesMatrix[fromIndex].getSize());
+
+                for (Size toIndex = 0; toIndex < toTrajectories.getSize(); ++toIndex)
+                {
+                    const Array<Access> referenceAccesses =
+                        generator.computeAccesses(interval, fromTrajectories[fromIndex], toTrajectories[toIndex]);
+
+                    EXPECT_EQ(referenceAccesses, accessesMatrix[fromIndex][toIndex]);
+                }
+            }
+        }
+    }
+
+    {
+        const Array<Array<Array<Access>>> accessesMatrix =
+            generator.computeAccesses(interval, Array<Trajectory>::Empty(), toTrajectories);
+
+        EXPECT_TRUE(accessesMatrix.isEmpty());
+    }
+
+    {
+        EXPECT_ANY_THROW(generator.computeAccesses(Interval::Undefined(), fromTrajectories, toTrajectories));
+        EXPECT_ANY_THROW(Generator::Undefined().computeAccesses(interval, fromTrajectories, toTrajectories));
+        EXPECT_ANY_THROW(
+            generator.computeAccesses(interval, fromTrajectories, Array<Trajectory>({Trajectory::Undefined()}))
+        );
+    }
+}
+
+TEST(OpenSpaceToolkit_Astrodynamics_Access_Generator, Screening)
+{
+    const Environment environment = Environment::Default();
+
+    {
+        Generator generator = {environment};
+
+        EXPECT_FALSE(generator.isScreeningEnabled());
+        EXPECT_FALSE(generator.getScreeningMinimumElevation().isDefined());
+        EXPECT_FALSE(generator.getScreeningMaximumRange().isDefined());
+
+        generator.enableScreening(Angle::Degrees(10.0), Length::Kilometers(3000.0));
+
+        EXPECT_TRUE(generator.isScreeningEnabled());
+        EXPECT_EQ(Angle::Degrees(10.0), generator.getScreeningMinimumElevation());
+        EXPECT_EQ(Length::Kilometers(3000.0), generator.getScreeningMaximumRange());
+
+        generator.disableScreening();
+
+        EXPECT_FALSE(generator.isScreeningEnabled());
+        EXPECT_FALSE(generator.getScreeningMinimumElevation().isDefined());
+        EXPECT_FALSE(generator.getScreeningMaximumRange().isDefined());
+
+        EXPECT_ANY_THROW(generator.enableScreening(Angle::Degrees(100.0)));
+        EXPECT_ANY_THROW(generator.enableScreening(Angle::Undefined(), Length::Meters(-1.0)));
+    }
+
+    {
+        EXPECT_ANY_THROW(Generator::Undefined().isScreeningEnabled());
+        EXPECT_ANY_THROW(Generator::Undefined().getScreeningMinimumElevation());
+        EXPECT_ANY_THROW(Generator::Undefined().getScreeningMaximumRange());
+    }
+
+    {
+        const Instant startInstant = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+        const Instant endInstant = Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC);
+
+        const Interval interval = Interval::Closed(startInstant, endInstant);
+
+        const LLA groundStationLla = {Angle::Degrees(0.0), Angle::Degrees(0.0), Length::Meters(20.0)};
+
+        const Trajectory groundStationTrajectory = Trajectory::Position(Position::Meters(
+            groundStationLla.toCartesian(Earth::EGM2008.equatorialRadius_, Earth::EGM2008.flattening_), Frame::ITRF()
+        ));
+
+        const COE coe = {
+            Length::Kilometers(7000.0),
+            0.0,
+            Angle::Degrees(+45.0),
+            Angle::Degrees(0.0),
+            Angle::Degrees(0.0),
+            Angle::Degrees(0.0),
+        };
+
+        const Kepler keplerianModel = {
+            coe,
+            startInstant,
+            Earth::EGM2008.gravitationalParameter_,
+            Earth::EGM2008.equatorialRadius_,
+            Earth::EGM2008.J2_,
+            Earth::EGM2008.J4_,
+            Kepler::PerturbationType::None
+        };
+
+        const Orbit satelliteOrbit = {keplerianModel, environment.accessCelestialObjectWithName("Earth")};
+
+        const ostk::mathematics::object::Interval<Real> azimuthRange =
+            ostk::mathematics::object::Interval<Real>::Closed(0.0, 360.0);
+        const ostk::mathematics::object::Interval<Real> elevationRange =
+            ostk::mathematics::object::Interval<Real>::Closed(10.0, 90.0);
+        const ostk::mathematics::object::Interval<Real> rangeRange =
+            ostk::mathematics::object::Interval<Real>::Closed(0.0, 3000e3);
+
+        const Generator generator = Generator::AerRanges(azimuthRange, elevationRange, rangeRange, environment);
+
+        Generator screenedGenerator = generator;
+        screenedGenerator.enableScreening(Angle::Degrees(10.0), Length::Kilometers(3000.0));
+
+        const Array<Access> accesses = generator.computeAccesses(interval, groundStationTrajectory, satelliteOrbit);
+        const Array<Access> screenedAccesses =
+            screenedGenerator.computeAccesses(interval, groundStationTrajectory, satelliteOrbit);
+
+        ASSERT_FALSE(accesses.isEmpty());
+        ASSERT_EQ(accesses.getSize(), screenedAccesses.getSize());
+
+        for (Size i = 0; i < accesses.getSize(); ++i)
+        {
+            EXPECT_EQ(accesses[i], screenedAccesses[i]);
+        }
+    }
+}
+
+TEST(OpenSpaceToolkit_Astrodynamics_Access_Generator, Statistics)
+{
+    const Environment environment = Environment::Default();
+
+    const Instant startInstant = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+    const Instant endInstant = Instant::DateTime(DateTime(2018, 1, 1, 12, 0, 0), Scale::UTC);
+
+    const Interval interval = Interval::Closed(startInstant, endInstant);
+
+    const Position groundStationPosition = Position::Meters(
+        LLA(Angle::Degrees(30.0), Angle::Degrees(0.0), Length::Meters(20.0))
+            .toCartesian(Earth::EGM2008.equatorialRadius_, Earth::EGM2008.flattening_),
+        Frame::ITRF()
+    );
+
+    const Trajectory fromTrajectory = Trajectory::Position(groundStationPosition);
+
+    const COE coe = {
+        Length::Kilometers(7000.0),
+        0.0,
+        Angle::Degrees(45.0),
+        Angle::Degrees(0.0),
+        Angle::Degrees(0.0),
+        Angle::Degrees(0.0),
+    };
+
+    const Kepler keplerianModel = {
+        coe,
+        startInstant,
+        Earth::EGM2008.gravitationalParameter_,
+        Earth::EGM2008.equatorialRadius_,
+        Earth::EGM2008.J2_,
+        Earth::EGM2008.J4_,
+        Kepler::PerturbationType::None
+    };
+
+    const Trajectory toTrajectory = Orbit(keplerianModel, environment.accessCelestialObjectWithName("Earth"));
+
+    {
+        Generator generator = Generator::AerRanges(
+            ostk::mathematics::object::Interval<Real>::Closed(0.0, 360.0),
+            ostk::mathematics::object::Interval<Real>::Closed(0.0, 90.0),
+            ostk::mathematics::object::Interval<Real>::Closed(0.0, 1.0e10),
+            environment
+        );
+
+        EXPECT_FALSE(generator.isStatisticsEnabled());
+        EXPECT_ANY_THROW(generator.getStatistics());
+
+        generator.enableStatistics();
+
+        EXPECT_TRUE(generator.isStatisticsEnabled());
+
+        const Array<Access> accesses = generator.computeAccesses(interval, fromTrajectory, toTrajectory);
+
+        ASSERT_FALSE(accesses.isEmpty());
+
+        const Generator::Statistics statistics = generator.getStatistics();
+
+        EXPECT_LT(0, statistics.conditionEvaluationCount);
+        EXPECT_EQ(statistics.conditionEvaluationCount, statistics.stateQueryCount);
+        EXPECT_LE(statistics.lineOfSightCount, statistics.conditionEvaluationCount);
+        EXPECT_LE(statistics.aerCalculationCount, statistics.lineOfSightCount);
+        EXPECT_LT(0, statistics.aerCalculationCount);
+        EXPECT_LT(0, statistics.rootSolverCallCount);
+        EXPECT_LT(0, statistics.rootSolverIterationCount);
+        EXPECT_LT(0, statistics.timeOfClosestApproachEvaluationCount);
+        EXPECT_LE(Duration::Zero(), statistics.conditionEvaluationDuration);
+        EXPECT_LE(Duration::Zero(), statistics.timeOfClosestApproachDuration);
+
+        // Statistics accumulate over calls, including from batch workers
+
+        generator.computeAccesses(interval, Array<Trajectory>({fromTrajectory}), Array<Trajectory>({toTrajectory}), 2);
+
+        EXPECT_EQ(2 * statistics.conditionEvaluationCount, generator.getStatistics().conditionEvaluationCount);
+
+        generator.resetStatistics();
+
+        EXPECT_EQ(0, generator.getStatistics().conditionEvaluationCount);
+
+        generator.disableStatistics();
+
+        EXPECT_FALSE(generator.isStatisticsEnabled());
+        EXPECT_EQ(accesses, generator.computeAccesses(interval, fromTrajectory, toTrajectory));
+    }
+}
+
+TEST(OpenSpaceToolkit_Astrodynamics_Access_Generator, ComputePiecewiseAccesses)
+{
+    const Environment environment = Environment::Default();
+
+    const TLE tle = {
+        "1 39419U 13066D   18248.44969859 -.00000394  00000-0 -31796-4 0  9997",
+        "2 39419  97.6313 314.6863 0012643 218.7350 141.2966 14.93878994260975"
+    };
+
+    const Instant startInstant = tle.getEpoch();
+    const Instant endInstant = startInstant + Duration::Days(1.0);
+
+    const Interval interval = Interval::Closed(startInstant, endInstant);
+
+    const Trajectory groundStationTrajectory = Trajectory::Position(Position::Meters(
+        LLA(Angle::Degrees(78.0), Angle::Degrees(15.0), Length::Meters(20.0))
+            .toCartesian(Earth::EGM2008.equatorialRadius_, Earth::EGM2008.flattening_),
+        Frame::ITRF()
+    ));
+
+    const Trajectory satelliteTrajectory = Trajectory(SGP4(tle));
+
+    // Identical pieces, so that accesses spanning a switch instant are expected to be merged back
+
+    const Trajectory piecewiseTrajectory = Trajectory(Piecewise(
+        {satelliteTrajectory, satelliteTrajectory, satelliteTrajectory},
+        {startInstant + Duration::Hours(6.0), startInstant + Duration::Hours(13.0)}
+    ));
+
+    const Generator generator = Generator::AerRanges(
+        ostk::mathematics::object::Interval<Real>::Closed(0.0, 360.0),
+        ostk::mathematics::object::Interval<Real>::Closed(5.0, 90.0),
+        ostk::mathematics::object::Interval<Real>::Closed(0.0, 1.0e10),
+        environment
+    );
+
+    {
+        const Array<Access> referenceAccesses =
+            generator.computeAccesses(interval, groundStationTrajectory, satelliteTrajectory);
+
+        ASSERT_FALSE(referenceAccesses.isEmpty());
+
+        for (const Size threadCount : {1, 4})
+        {
+            const Array<Access> accesses = generator.computePiecewiseAccesses(
+                interval, groundStationTrajectory, piecewiseTrajectory, threadCount
+            );
+
+            ASSERT_EQ(referenceAccesses.getSize(), accesses.getSize());
+
+            for (Size i = 0; i < accesses.getSize(); ++i)
+            {
+                EXPECT_TRUE(accesses[i].getAcquisitionOfSignal().isNear(
+                    referenceAccesses[i].getAcquisitionOfSignal(), Duration::Seconds(1.0)
+                ));
+                EXPECT_TRUE(accesses[i].getLossOfSignal().isNear(
+                    referenceAccesses[i].getLossOfSignal(), Duration::Seconds(1.0)
+                ));
+                EXPECT_TRUE(accesses[i].getTimeOfClosestApproach().isNear(
+                    referenceAccesses[i].getTimeOfClosestApproach(), Duration::Seconds(1.0)
+                ));
+            }
+        }
+    }
+
+    {
+        // Non-piecewise trajectories are processed as a single segment
+
+        EXPECT_EQ(
+            generator.computeAccesses(interval, groundStationTrajectory, satelliteTrajectory),
+            generator.computePiecewiseAccesses(interval, groundStationTrajectory, satelliteTrajectory)
+        );
+    }
+
+    {
+        EXPECT_ANY_THROW(Generator::Undefined().computePiecewiseAccesses(
+            interval, groundStationTrajectory, piecewiseTrajectory
+        ));
+        EXPECT_ANY_THROW(generator.computePiecewiseAccesses(
+            Interval::Undefined(), groundStationTrajectory, piecewiseTrajectory
+        ));
+        EXPECT_ANY_THROW(
+            generator.computePiecewiseAccesses(interval, Trajectory::Undefined(), piecewiseTrajectory)
+        );
+    }
+}
+
 TEST(OpenSpaceToolkit_Astrodynamics_Access_Generator, SetStep)
 {
     {
@@ -950,3 +1321,275 @@ TEST(OpenSpaceToolkit_Astrodynamics_Access_Generator, AerMask)
         }
     }
 }
+
+TEST(OpenSpaceToolkit_Astrodynamics_Access_GeneratorContext, CalculateAer)
+{
+    const Environment environment = Environment::Default();
+    const Shared<const Celestial> earthSPtr = environment.accessCelestialObjectWithName("Earth");
+
+    {
+        const Instant instant = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+
+        const LLA groundStationLla = {Angle::Degrees(37.0), Angle::Degrees(-122.0), Length::Meters(50.0)};
+
+        const Vector3d groundStationCoordinates_ITRF =
+            groundStationLla.toCartesian(Earth::EGM2008.equatorialRadius_, Earth::EGM2008.flattening_);
+
+        const Matrix3d itrfToNedRotation =
+            GeneratorContext::ComputeItrfToNedRotation(groundStationCoordinates_ITRF, earthSPtr);
+
+        const Position groundStationPosition =
+            Position::Meters(groundStationCoordinates_ITRF, Frame::ITRF()).inFrame(Frame::GCRF(), instant);
+
+        for (const Vector3d& offset_ITRF :
+             {Vector3d(300e3, 0.0, 0.0), Vector3d(0.0, -500e3, 200e3), Vector3d(-100e3, 100e3, 900e3)})
+        {
+            const Position satellitePosition =
+                Position::Meters(groundStationCoordinates_ITRF + offset_ITRF, Frame::ITRF())
+                    .inFrame(Frame::GCRF(), instant);
+
+            const AER referenceAer =
+                GeneratorContext::CalculateAer(instant, groundStationPosition, satellitePosition, earthSPtr);
+
+            const AER aer = GeneratorContext::CalculateAer(
+                instant, groundStationCoordinates_ITRF, itrfToNedRotation, satellitePosition
+            );
+
+            EXPECT_NEAR(
+                referenceAer.getAzimuth().inDegrees(0.0, +360.0), aer.getAzimuth().inDegrees(0.0, +360.0), 1e-8
+            );
+            EXPECT_NEAR(
+                referenceAer.getElevation().inDegrees(-180.0, +180.0),
+                aer.getElevation().inDegrees(-180.0, +180.0),
+                1e-8
+            );
+            EXPECT_NEAR(referenceAer.getRange().inMeters(), aer.getRange().inMeters(), 1e-6);
+        }
+    }
+}
+
+TEST(OpenSpaceToolkit_Astrodynamics_Access_GeneratorContext, SegmentIntersectsSpheroid)
+{
+    // Spheroid of equatorial radius 2 m and polar radius 1 m
+
+    {
+        const Vector3d center = Vector3d::Zero();
+        const Vector3d polarAxis = Vector3d::UnitZ();
+
+        const auto intersects = [&center, &polarAxis](const Vector3d& aStart, const Vector3d& anEnd) -> bool
+        {
+            return GeneratorContext::SegmentIntersectsSpheroid(aStart, anEnd, center, polarAxis, 2.0, 1.0);
+        };
+
+        EXPECT_TRUE(intersects({-3.0, 0.0, 0.0}, {+3.0, 0.0, 0.0}));
+        EXPECT_TRUE(intersects({-3.0, 0.0, 0.9}, {+3.0, 0.0, 0.9}));
+        EXPECT_FALSE(intersects({-3.0, 0.0, 1.1}, {+3.0, 0.0, 1.1}));
+        EXPECT_FALSE(intersects({-3.0, 0.0, 0.0}, {-2.5, 0.0, 0.0}));
+        EXPECT_FALSE(intersects({0.0, -3.0, 0.0}, {0.0, -3.0, 5.0}));
+
+        // Segments from the surface intersect the spheroid only below the horizon
+
+        EXPECT_FALSE(intersects({2.0, 0.0, 0.0}, {3.0, 0.0, 1.0}));
+        EXPECT_FALSE(intersects({2.0, 0.0, 0.0}, {2.0, 3.0, 0.0}));
+        EXPECT_TRUE(intersects({2.0, 0.0, 0.0}, {-3.0, 0.0, 0.1}));
+    }
+
+    // Offset spheroid, with a polar axis along X
+
+    {
+        const Vector3d center = {10.0, 0.0, 0.0};
+        const Vector3d polarAxis = Vector3d::UnitX();
+
+        EXPECT_TRUE(GeneratorContext::SegmentIntersectsSpheroid(
+            {10.9, -3.0, 0.0}, {10.9, +3.0, 0.0}, center, polarAxis, 2.0, 1.0
+        ));
+        EXPECT_FALSE(GeneratorContext::SegmentIntersectsSpheroid(
+            {11.1, -3.0, 0.0}, {11.1, +3.0, 0.0}, center, polarAxis, 2.0, 1.0
+        ));
+        EXPECT_TRUE(GeneratorContext::SegmentIntersectsSpheroid(
+            {10.0, -3.0, 1.9}, {10.0, +3.0, 1.9}, center, polarAxis, 2.0, 1.0
+        ));
+    }
+}
+
+TEST(OpenSpaceToolkit_Astrodynamics_Access_GeneratorContext, StatePrefetching)
+{
+    const Environment environment = Environment::Default();
+
+    const Generator generator = {environment};
+
+    const Instant startInstant = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+    const Instant endInstant = Instant::DateTime(DateTime(2018, 1, 1, 1, 0, 0), Scale::UTC);
+
+    const Position groundStationPosition = Position::Meters(
+        LLA(Angle::Degrees(0.0), Angle::Degrees(0.0), Length::Meters(20.0))
+            .toCartesian(Earth::EGM2008.equatorialRadius_, Earth::EGM2008.flattening_),
+        Frame::ITRF()
+    );
+
+    const Trajectory fromTrajectory = Trajectory::Position(groundStationPosition);
+
+    const COE coe = {
+        Length::Kilometers(7000.0),
+        0.0,
+        Angle::Degrees(45.0),
+        Angle::Degrees(0.0),
+        Angle::Degrees(0.0),
+        Angle::Degrees(0.0),
+    };
+
+    const Kepler keplerianModel = {
+        coe,
+        startInstant,
+        Earth::EGM2008.gravitationalParameter_,
+        Earth::EGM2008.equatorialRadius_,
+        Earth::EGM2008.J2_,
+        Earth::EGM2008.J4_,
+        Kepler::PerturbationType::None
+    };
+
+    const Trajectory toTrajectory = Orbit(keplerianModel, environment.accessCelestialObjectWithName("Earth"));
+
+    {
+        GeneratorContext generatorContext = {fromTrajectory, toTrajectory, environment, generator};
+
+        generatorContext.enableStatePrefetching(endInstant, Duration::Minutes(1.0), 7);
+
+        // Grid instants, interleaved with off-grid instants
+
+        Instant instant = startInstant;
+
+        while (instant <= endInstant)
+        {
+            for (const Instant& queryInstant : {instant, instant + Duration::Seconds(20.0)})
+            {
+                const auto [fromState, toState] = generatorContext.getStatesAt(queryInstant);
+                const auto [referenceFromState, referenceToState] =
+                    GeneratorContext::GetStatesAt(queryInstant, fromTrajectory, toTrajectory);
+
+                EXPECT_EQ(referenceFromState, fromState);
+                EXPECT_EQ(referenceToState, toState);
+            }
+
+            instant = instant + Duration::Minutes(1.0);
+        }
+    }
+
+    {
+        const std::function<bool(const Instant&)> conditionFunction =
+            generator.getConditionFunction(fromTrajectory, toTrajectory);
+
+        GeneratorContext generatorContext = {fromTrajectory, toTrajectory, environment, generator};
+
+        generatorContext.enableStatePrefetching(endInstant, generator.getStep(), 256);
+
+        Instant instant = startInstant;
+
+        while (instant <= endInstant)
+        {
+            EXPECT_EQ(conditionFunction(instant), generatorContext.isAccessActive(instant));
+
+            instant = instant + generator.getStep();
+        }
+    }
+
+    {
+        GeneratorContext generatorContext = {fromTrajectory, toTrajectory, environment, generator};
+
+        EXPECT_ANY_THROW(generatorContext.enableStatePrefetching(Instant::Undefined(), Duration::Minutes(1.0), 7));
+        EXPECT_ANY_THROW(generatorContext.enableStatePrefetching(endInstant, Duration::Undefined(), 7));
+        EXPECT_ANY_THROW(generatorContext.enableStatePrefetching(endInstant, Duration::Zero(), 7));
+    }
+}
+
+TEST(OpenSpaceToolkit_Astrodynamics_Access_GeneratorContext, StaticTrajectories)
+{
+    const Environment environment = Environment::Default();
+
+    const Instant startInstant = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+    const Instant endInstant = Instant::DateTime(DateTime(2018, 1, 1, 6, 0, 0), Scale::UTC);
+
+    const Position groundStationPosition = Position::Meters(
+        LLA(Angle::Degrees(30.0), Angle::Degrees(10.0), Length::Meters(20.0))
+            .toCartesian(Earth::EGM2008.equatorialRadius_, Earth::EGM2008.flattening_),
+        Frame::ITRF()
+    );
+
+    const Trajectory groundStationTrajectory = Trajectory::Position(groundStationPosition);
+
+    const COE coe = {
+        Length::Kilometers(7000.0),
+        0.0,
+        Angle::Degrees(45.0),
+        Angle::Degrees(0.0),
+        Angle::Degrees(0.0),
+        Angle::Degrees(0.0),
+    };
+
+    const Kepler keplerianModel = {
+        coe,
+        startInstant,
+        Earth::EGM2008.gravitationalParameter_,
+        Earth::EGM2008.equatorialRadius_,
+        Earth::EGM2008.J2_,
+        Earth::EGM2008.J4_,
+        Kepler::PerturbationType::None
+    };
+
+    const Trajectory satelliteTrajectory = Orbit(keplerianModel, environment.accessCelestialObjectWithName("Earth"));
+
+    // Positions of static trajectories are transformed directly, matching the states path (forced by a state filter)
+
+    const Generator generator = {environment};
+    const Generator stateFilterGenerator = {
+        environment, {}, {}, [](const State&, const State&) -> bool
+        {
+            return true;
+        }
+    };
+
+    const Array<Pair<Trajectory, Trajectory>> trajectoryPairs = {
+        {groundStationTrajectory, satelliteTrajectory},
+        {satelliteTrajectory, groundStationTrajectory},
+    };
+
+    for (const auto& [fromTrajectory, toTrajectory] : trajectoryPairs)
+    {
+        GeneratorContext generatorContext = {fromTrajectory, toTrajectory, environment, generator};
+        GeneratorContext stateFilterGeneratorContext = {
+            fromTrajectory, toTrajectory, environment, stateFilterGenerator
+        };
+
+        generatorContext.enableStatePrefetching(endInstant, Duration::Minutes(1.0), 16);
+
+        Size activeCount = 0;
+
+        Instant instant = startInstant;
+
+        while (instant <= endInstant)
+        {
+            const bool isAccessActive = generatorContext.isAccessActive(instant);
+
+            EXPECT_EQ(stateFilterGeneratorContext.isAccessActive(instant), isAccessActive);
+
+            activeCount += isAccessActive ? 1 : 0;
+
+            instant = instant + Duration::Minutes(1.0);
+        }
+
+        EXPECT_GT(activeCount, 0);
+    }
+
+    // States of static trajectories are not prefetched, but still returned
+
+    {
+        GeneratorContext generatorContext = {satelliteTrajectory, groundStationTrajectory, environment, generator};
+
+        generatorContext.enableStatePrefetching(endInstant, Duration::Minutes(1.0), 16);
+
+        const auto [fromState, toState] = generatorContext.getStatesAt(startInstant);
+
+        EXPECT_EQ(satelliteTrajectory.getStateAt(startInstant), fromState);
+        EXPECT_EQ(groundStationTrajectory.getStateAt(startInstant), toState);
+    }
+}
@@ -0,0 +1,189 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Spherical/LLA.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Earth.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Access/IncrementalGenerator.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler/COE.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Size;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::spherical::LLA;
+using ostk::physics::Environment;
+using ostk::physics::environment::gravitational::Earth;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::time::Scale;
+using ostk::physics::unit::Angle;
+using ostk::physics::unit::Length;
+
+using ostk::astrodynamics::Access;
+using ostk::astrodynamics::access::Generator;
+using ostk::astrodynamics::access::IncrementalGenerator;
+using ostk::astrodynamics::Trajectory;
+using ostk::astrodynamics::trajectory::Orbit;
+using ostk::astrodynamics::trajectory::orbit::model::Kepler;
+using ostk::astrodynamics::trajectory::orbit::model::kepler::COE;
+
+class OpenSpaceToolkit_Astrodynamics_Access_IncrementalGenerator : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        const Position groundStationPosition = Position::Meters(
+            LLA(Angle::Degrees(30.0), Angle::Degrees(0.0), Length::Meters(20.0))
+                .toCartesian(Earth::EGM2008.equatorialRadius_, Earth::EGM2008.flattening_),
+            Frame::ITRF()
+        );
+
+        this->fromTrajectory_ = Trajectory::Position(groundStationPosition);
+
+        const COE coe = {
+            Length::Kilometers(7000.0),
+            0.0,
+            Angle::Degrees(45.0),
+            Angle::Degrees(0.0),
+            Angle::Degrees(0.0),
+            Angle::Degrees(0.0),
+        };
+
+        const Kepler keplerianModel = {
+            coe,
+            this->startInstant_,
+            Earth::EGM2008.gravitationalParameter_,
+            Earth::EGM2008.equatorialRadius_,
+            Earth::EGM2008.J2_,
+            Earth::EGM2008.J4_,
+            Kepler::PerturbationType::None
+        };
+
+        this->toTrajectory_ = Orbit(keplerianModel, this->environment_.accessCelestialObjectWithName("Earth"));
+    }
+
+    void expectAccessesNear(const Array<Access>& aReferenceAccessArray, const Array<Access>& anAccessArray) const
+    {
+        ASSERT_EQ(aReferenceAccessArray.getSize(), anAccessArray.getSize());
+
+        for (Size i = 0; i < anAccessArray.getSize(); ++i)
+        {
+            const Access& referenceAccess = aReferenceAccessArray[i];
+            const Access& access = anAccessArray[i];
+
+            EXPECT_EQ(referenceAccess.getType(), access.getType());
+            EXPECT_TRUE(access.getAcquisitionOfSignal().isNear(
+                referenceAccess.getAcquisitionOfSignal(), Duration::Milliseconds(1.0)
+            ));
+            EXPECT_TRUE(
+                access.getLossOfSignal().isNear(referenceAccess.getLossOfSignal(), Duration::Milliseconds(1.0))
+            );
+        }
+    }
+
+    const Environment environment_ = Environment::Default();
+    const Generator generator_ = {environment_};
+
+    const Instant startInstant_ = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+
+    Trajectory fromTrajectory_ = Trajectory::Undefined();
+    Trajectory toTrajectory_ = Trajectory::Undefined();
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_IncrementalGenerator, Constructor)
+{
+    {
+        EXPECT_NO_THROW(IncrementalGenerator(generator_, fromTrajectory_, toTrajectory_));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_IncrementalGenerator, IsDefined)
+{
+    {
+        EXPECT_TRUE(IncrementalGenerator(generator_, fromTrajectory_, toTrajectory_).isDefined());
+        EXPECT_FALSE(IncrementalGenerator(generator_, Trajectory::Undefined(), toTrajectory_).isDefined());
+        EXPECT_FALSE(IncrementalGenerator::Undefined().isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_IncrementalGenerator, GetInterval)
+{
+    {
+        IncrementalGenerator incrementalGenerator = {generator_, fromTrajectory_, toTrajectory_};
+
+        EXPECT_FALSE(incrementalGenerator.getInterval().isDefined());
+
+        const Interval interval = Interval::Closed(startInstant_, startInstant_ + Duration::Hours(6.0));
+
+        incrementalGenerator.computeAccesses(interval);
+
+        EXPECT_EQ(interval, incrementalGenerator.getInterval());
+
+        incrementalGenerator.reset();
+
+        EXPECT_FALSE(incrementalGenerator.getInterval().isDefined());
+    }
+
+    {
+        EXPECT_ANY_THROW(IncrementalGenerator::Undefined().getInterval());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_IncrementalGenerator, ComputeAccesses)
+{
+    // Rolling window
+
+    {
+        IncrementalGenerator incrementalGenerator = {generator_, fromTrajectory_, toTrajectory_};
+
+        const Duration windowDuration = Duration::Hours(12.0);
+
+        for (Size tickIndex = 0; tickIndex < 8; ++tickIndex)
+        {
+            const Instant windowStartInstant = startInstant_ + Duration::Minutes(47.0 * tickIndex);
+            const Interval interval = Interval::Closed(windowStartInstant, windowStartInstant + windowDuration);
+
+            const Array<Access> referenceAccesses =
+                generator_.computeAccesses(interval, fromTrajectory_, toTrajectory_);
+
+            expectAccessesNear(referenceAccesses, incrementalGenerator.computeAccesses(interval));
+        }
+    }
+
+    // Shrinking, then non-overlapping intervals
+
+    {
+        IncrementalGenerator incrementalGenerator = {generator_, fromTrajectory_, toTrajectory_};
+
+        for (const Interval& interval : {
+                 Interval::Closed(startInstant_, startInstant_ + Duration::Hours(12.0)),
+                 Interval::Closed(startInstant_ + Duration::Hours(1.0), startInstant_ + Duration::Hours(9.0)),
+                 Interval::Closed(startInstant_ + Duration::Hours(20.0), startInstant_ + Duration::Hours(30.0)),
+             })
+        {
+            const Array<Access> referenceAccesses =
+                generator_.computeAccesses(interval, fromTrajectory_, toTrajectory_);
+
+            expectAccessesNear(referenceAccesses, incrementalGenerator.computeAccesses(interval));
+        }
+    }
+
+    {
+        IncrementalGenerator incrementalGenerator = {generator_, fromTrajectory_, toTrajectory_};
+
+        EXPECT_ANY_THROW(incrementalGenerator.computeAccesses(Interval::Undefined()));
+        EXPECT_ANY_THROW(IncrementalGenerator::Undefined().computeAccesses(
+            Interval::Closed(startInstant_, startInstant_ + Duration::Hours(1.0))
+        ));
+    }
+}
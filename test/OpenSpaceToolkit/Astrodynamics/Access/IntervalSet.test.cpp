@@ -0,0 +1,207 @@
+/// Apache License 2.0
+
+#include <random>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Access.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Access/IntervalSet.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Size;
+
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::time::Scale;
+using ostk::physics::unit::Angle;
+
+using ostk::astrodynamics::Access;
+using ostk::astrodynamics::access::IntervalSet;
+
+class OpenSpaceToolkit_Astrodynamics_Access_IntervalSet : public ::testing::Test
+{
+   protected:
+    // Interval from minute offsets with respect to the reference instant
+    Interval interval(const double& aStartMinute, const double& anEndMinute) const
+    {
+        return Interval::Closed(
+            this->referenceInstant_ + Duration::Minutes(aStartMinute),
+            this->referenceInstant_ + Duration::Minutes(anEndMinute)
+        );
+    }
+
+    Array<Interval> generateRandomIntervals(std::mt19937& aGenerator, const Size& aCount) const
+    {
+        std::uniform_int_distribution<int> startDistribution(0, 1000);
+        std::uniform_int_distribution<int> durationDistribution(1, 30);
+
+        Array<Interval> intervals = Array<Interval>::Empty();
+
+        for (Size index = 0; index < aCount; ++index)
+        {
+            const int start = startDistribution(aGenerator);
+            intervals.add(this->interval(start, start + durationDistribution(aGenerator)));
+        }
+
+        return intervals;
+    }
+
+    const Instant referenceInstant_ = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_IntervalSet, Constructor)
+{
+    {
+        const IntervalSet intervalSet = {{
+            this->interval(50.0, 60.0),
+            this->interval(0.0, 10.0),
+            this->interval(5.0, 20.0),
+            this->interval(20.0, 30.0),
+            this->interval(40.0, 40.0),
+        }};
+
+        EXPECT_EQ(2, intervalSet.getSize());
+        EXPECT_EQ(this->interval(0.0, 30.0), intervalSet.accessIntervals()[0]);
+        EXPECT_EQ(this->interval(50.0, 60.0), intervalSet.accessIntervals()[1]);
+        EXPECT_EQ(Duration::Minutes(40.0), intervalSet.getDuration());
+    }
+
+    {
+        EXPECT_TRUE(IntervalSet::Empty().isEmpty());
+        EXPECT_TRUE(IntervalSet(Array<Interval>::Empty()).isEmpty());
+    }
+
+    {
+        EXPECT_ANY_THROW(IntervalSet({Interval::Undefined()}));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_IntervalSet, FromAccesses)
+{
+    const Array<Access> accesses = {
+        Access(
+            Access::Type::Complete,
+            this->referenceInstant_ + Duration::Minutes(10.0),
+            this->referenceInstant_ + Duration::Minutes(15.0),
+            this->referenceInstant_ + Duration::Minutes(20.0),
+            Angle::Degrees(45.0)
+        ),
+        Access(
+            Access::Type::Partial,
+            this->referenceInstant_,
+            this->referenceInstant_ + Duration::Minutes(2.0),
+            this->referenceInstant_ + Duration::Minutes(5.0),
+            Angle::Degrees(10.0)
+        ),
+    };
+
+    const IntervalSet intervalSet = IntervalSet::FromAccesses(accesses);
+
+    EXPECT_EQ(IntervalSet({this->interval(0.0, 5.0), this->interval(10.0, 20.0)}), intervalSet);
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_IntervalSet, Contains)
+{
+    const IntervalSet intervalSet = {{this->interval(0.0, 10.0), this->interval(20.0, 30.0)}};
+
+    EXPECT_TRUE(intervalSet.contains(this->referenceInstant_));
+    EXPECT_TRUE(intervalSet.contains(this->referenceInstant_ + Duration::Minutes(10.0)));
+    EXPECT_FALSE(intervalSet.contains(this->referenceInstant_ + Duration::Minutes(15.0)));
+    EXPECT_TRUE(intervalSet.contains(this->referenceInstant_ + Duration::Minutes(25.0)));
+    EXPECT_FALSE(intervalSet.contains(this->referenceInstant_ - Duration::Minutes(1.0)));
+    EXPECT_FALSE(intervalSet.contains(this->referenceInstant_ + Duration::Minutes(31.0)));
+
+    EXPECT_ANY_THROW(intervalSet.contains(Instant::Undefined()));
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_IntervalSet, SetOperations)
+{
+    const IntervalSet firstIntervalSet = {{this->interval(0.0, 10.0), this->interval(20.0, 30.0)}};
+    const IntervalSet secondIntervalSet = {{this->interval(5.0, 25.0), this->interval(30.0, 40.0)}};
+
+    {
+        EXPECT_EQ(IntervalSet({this->interval(0.0, 40.0)}), firstIntervalSet.unionWith(secondIntervalSet));
+        EXPECT_EQ(firstIntervalSet, firstIntervalSet.unionWith(IntervalSet::Empty()));
+    }
+
+    {
+        EXPECT_EQ(
+            IntervalSet({this->interval(5.0, 10.0), this->interval(20.0, 25.0)}),
+            firstIntervalSet.intersectionWith(secondIntervalSet)
+        );
+        EXPECT_TRUE(firstIntervalSet.intersectionWith(IntervalSet::Empty()).isEmpty());
+    }
+
+    {
+        EXPECT_EQ(
+            IntervalSet({this->interval(0.0, 5.0), this->interval(25.0, 30.0)}),
+            firstIntervalSet.differenceWith(secondIntervalSet)
+        );
+        EXPECT_EQ(
+            IntervalSet({this->interval(10.0, 20.0), this->interval(30.0, 40.0)}),
+            secondIntervalSet.differenceWith(firstIntervalSet)
+        );
+        EXPECT_EQ(firstIntervalSet, firstIntervalSet.differenceWith(IntervalSet::Empty()));
+    }
+
+    {
+        EXPECT_EQ(
+            IntervalSet({this->interval(-10.0, 0.0), this->interval(10.0, 20.0), this->interval(30.0, 35.0)}),
+            firstIntervalSet.complementIn(this->interval(-10.0, 35.0))
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_IntervalSet, SetOperationsAgainstSampling)
+{
+    // Set operations are checked on a one minute grid, offset by half a minute to stay clear of interval bounds
+
+    std::mt19937 generator(42);
+
+    for (Size trial = 0; trial < 20; ++trial)
+    {
+        const IntervalSet firstIntervalSet = {this->generateRandomIntervals(generator, 40)};
+        const IntervalSet secondIntervalSet = {this->generateRandomIntervals(generator, 40)};
+
+        const IntervalSet unionSet = firstIntervalSet.unionWith(secondIntervalSet);
+        const IntervalSet intersectionSet = firstIntervalSet.intersectionWith(secondIntervalSet);
+        const IntervalSet differenceSet = firstIntervalSet.differenceWith(secondIntervalSet);
+
+        for (int minute = -10; minute < 1050; ++minute)
+        {
+            const Instant instant = this->referenceInstant_ + Duration::Minutes(minute + 0.5);
+
+            const bool firstContains = firstIntervalSet.contains(instant);
+            const bool secondContains = secondIntervalSet.contains(instant);
+
+            EXPECT_EQ(firstContains || secondContains, unionSet.contains(instant));
+            EXPECT_EQ(firstContains && secondContains, intersectionSet.contains(instant));
+            EXPECT_EQ(firstContains && !secondContains, differenceSet.contains(instant));
+        }
+
+        // Results remain sorted and disjoint
+
+        for (const IntervalSet& intervalSet : {unionSet, intersectionSet, differenceSet})
+        {
+            for (Size index = 1; index < intervalSet.getSize(); ++index)
+            {
+                EXPECT_LT(
+                    intervalSet.accessIntervals()[index - 1].accessEnd(),
+                    intervalSet.accessIntervals()[index].accessStart()
+                );
+            }
+        }
+    }
+}
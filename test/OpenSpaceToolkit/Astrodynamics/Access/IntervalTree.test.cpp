@@ -0,0 +1,156 @@
+/// Apache License 2.0
+
+#include <random>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Access.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Access/IntervalTree.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::time::Scale;
+using ostk::physics::unit::Angle;
+
+using ostk::astrodynamics::Access;
+using ostk::astrodynamics::access::IntervalTree;
+
+class OpenSpaceToolkit_Astrodynamics_Access_IntervalTree : public ::testing::Test
+{
+   protected:
+    // Interval from minute offsets with respect to the reference instant
+    Interval interval(const double& aStartMinute, const double& anEndMinute) const
+    {
+        return Interval::Closed(
+            this->referenceInstant_ + Duration::Minutes(aStartMinute),
+            this->referenceInstant_ + Duration::Minutes(anEndMinute)
+        );
+    }
+
+    const Instant referenceInstant_ = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_IntervalTree, Constructor)
+{
+    {
+        EXPECT_EQ(0, IntervalTree(Array<Interval>::Empty()).getSize());
+        EXPECT_TRUE(IntervalTree(Array<Interval>::Empty()).queryContaining(this->referenceInstant_).isEmpty());
+    }
+
+    {
+        EXPECT_ANY_THROW(IntervalTree({Interval::Undefined()}));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_IntervalTree, Query)
+{
+    const IntervalTree intervalTree = {{
+        this->interval(20.0, 30.0),
+        this->interval(0.0, 100.0),
+        this->interval(25.0, 26.0),
+        this->interval(40.0, 50.0),
+    }};
+
+    EXPECT_EQ(4, intervalTree.getSize());
+
+    {
+        const auto queryContaining = [this, &intervalTree](const double& aMinute) -> Array<Index>
+        {
+            return intervalTree.queryContaining(this->referenceInstant_ + Duration::Minutes(aMinute));
+        };
+
+        EXPECT_EQ(Array<Index>({0, 1, 2}), queryContaining(25.0));
+        EXPECT_EQ(Array<Index>({0, 1}), queryContaining(30.0));
+        EXPECT_EQ(Array<Index>({1}), queryContaining(35.0));
+        EXPECT_TRUE(queryContaining(101.0).isEmpty());
+    }
+
+    {
+        EXPECT_EQ(Array<Index>({0, 1, 3}), intervalTree.queryOverlapping(this->interval(28.0, 45.0)));
+        EXPECT_EQ(Array<Index>({1, 3}), intervalTree.queryOverlapping(this->interval(50.0, 60.0)));
+    }
+
+    {
+        EXPECT_ANY_THROW(intervalTree.queryContaining(Instant::Undefined()));
+        EXPECT_ANY_THROW(intervalTree.queryOverlapping(Interval::Undefined()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_IntervalTree, QueryAgainstBruteForce)
+{
+    std::mt19937 generator(42);
+
+    std::uniform_int_distribution<int> startDistribution(0, 1000);
+    std::uniform_int_distribution<int> durationDistribution(0, 60);
+
+    Array<Interval> intervals = Array<Interval>::Empty();
+
+    for (Size index = 0; index < 500; ++index)
+    {
+        const int start = startDistribution(generator);
+        intervals.add(this->interval(start, start + durationDistribution(generator)));
+    }
+
+    const IntervalTree intervalTree = {intervals};
+
+    for (Size trial = 0; trial < 200; ++trial)
+    {
+        const int start = startDistribution(generator);
+        const Interval queryInterval = this->interval(start, start + durationDistribution(generator));
+
+        Array<Index> expectedIndices = Array<Index>::Empty();
+
+        for (Index index = 0; index < intervals.getSize(); ++index)
+        {
+            if ((intervals[index].accessStart() <= queryInterval.accessEnd()) &&
+                (intervals[index].accessEnd() >= queryInterval.accessStart()))
+            {
+                expectedIndices.add(index);
+            }
+        }
+
+        EXPECT_EQ(expectedIndices, intervalTree.queryOverlapping(queryInterval));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_IntervalTree, FromAccesses)
+{
+    const Array<Access> accesses = {
+        Access(
+            Access::Type::Complete,
+            this->referenceInstant_ + Duration::Minutes(10.0),
+            this->referenceInstant_ + Duration::Minutes(15.0),
+            this->referenceInstant_ + Duration::Minutes(20.0),
+            Angle::Degrees(45.0)
+        ),
+        Access(
+            Access::Type::Partial,
+            this->referenceInstant_,
+            this->referenceInstant_ + Duration::Minutes(2.0),
+            this->referenceInstant_ + Duration::Minutes(5.0),
+            Angle::Degrees(10.0)
+        ),
+    };
+
+    const IntervalTree intervalTree = IntervalTree::FromAccesses(accesses);
+
+    EXPECT_EQ(Array<Index>({0}), intervalTree.queryContaining(this->referenceInstant_ + Duration::Minutes(12.0)));
+    EXPECT_EQ(Array<Index>({1}), intervalTree.queryContaining(this->referenceInstant_ + Duration::Minutes(1.0)));
+}
@@ -0,0 +1,333 @@
+/// Apache License 2.0
+
+#include <cmath>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/Quaternion.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Environment.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Access.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Access/Generator.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Access/SensorFilter.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/Profile.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler/COE.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::Environment;
+using ostk::physics::environment::gravitational::Earth;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::time::Scale;
+using ostk::physics::unit::Angle;
+using ostk::physics::unit::Length;
+
+using ostk::astrodynamics::Access;
+using ostk::astrodynamics::access::Generator;
+using ostk::astrodynamics::access::SensorFilter;
+using ostk::astrodynamics::flight::Profile;
+using ostk::astrodynamics::Trajectory;
+using ostk::astrodynamics::trajectory::Orbit;
+using ostk::astrodynamics::trajectory::orbit::model::Kepler;
+using ostk::astrodynamics::trajectory::orbit::model::kepler::COE;
+using ostk::astrodynamics::trajectory::State;
+
+class OpenSpaceToolkit_Astrodynamics_Access_SensorFilter : public ::testing::Test
+{
+   protected:
+    // Circular orbit, at 45 deg of inclination
+    Orbit generateOrbit() const
+    {
+        const COE coe = {
+            Length::Kilometers(7000.0),
+            0.0,
+            Angle::Degrees(45.0),
+            Angle::Degrees(0.0),
+            Angle::Degrees(0.0),
+            Angle::Degrees(0.0),
+        };
+
+        const Kepler keplerianModel = {
+            coe,
+            this->startInstant_,
+            Earth::EGM2008.gravitationalParameter_,
+            Earth::EGM2008.equatorialRadius_,
+            Earth::EGM2008.J2_,
+            Earth::EGM2008.J4_,
+            Kepler::PerturbationType::None
+        };
+
+        return {keplerianModel, this->earthSPtr_};
+    }
+
+    const Environment environment_ = Environment::Default();
+    const Shared<const Celestial> earthSPtr_ = environment_.accessCelestialObjectWithName("Earth");
+
+    const Instant startInstant_ = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+    const Interval interval_ = Interval::Closed(startInstant_, startInstant_ + Duration::Hours(6.0));
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_SensorFilter, Constructor)
+{
+    const Profile profile = Profile::InertialPointing(this->generateOrbit(), Quaternion::Unit());
+
+    {
+        const SensorFilter sensorFilter = SensorFilter::Cone(
+            profile, Quaternion::Unit(), Angle::Degrees(10.0), this->interval_, Duration::Seconds(30.0)
+        );
+
+        EXPECT_TRUE(sensorFilter.isDefined());
+        EXPECT_EQ(SensorFilter::Shape::Cone, sensorFilter.getShape());
+        EXPECT_EQ(this->interval_, sensorFilter.getInterval());
+        EXPECT_EQ(Duration::Seconds(30.0), sensorFilter.getStep());
+    }
+
+    {
+        const SensorFilter sensorFilter = SensorFilter::Rectangle(
+            profile, Quaternion::Unit(), Angle::Degrees(10.0), Angle::Degrees(5.0), this->interval_
+        );
+
+        EXPECT_TRUE(sensorFilter.isDefined());
+        EXPECT_EQ(SensorFilter::Shape::Rectangle, sensorFilter.getShape());
+        EXPECT_EQ(Duration::Seconds(10.0), sensorFilter.getStep());
+    }
+
+    {
+        EXPECT_FALSE(SensorFilter::Undefined().isDefined());
+        EXPECT_EQ(SensorFilter::Shape::Undefined, SensorFilter::Undefined().getShape());
+
+        EXPECT_ANY_THROW(SensorFilter::Undefined().getInterval());
+        EXPECT_ANY_THROW(SensorFilter::Undefined().getAttitudeAt(this->startInstant_));
+        EXPECT_ANY_THROW(SensorFilter::Undefined().evaluate(this->startInstant_, Vector3d::Zero(), Vector3d::Z()));
+    }
+
+    {
+        EXPECT_ANY_THROW(SensorFilter::Cone(profile, Quaternion::Unit(), Angle::Degrees(0.0), this->interval_));
+        EXPECT_ANY_THROW(SensorFilter::Cone(profile, Quaternion::Unit(), Angle::Undefined(), this->interval_));
+        EXPECT_ANY_THROW(SensorFilter::Rectangle(
+            profile, Quaternion::Unit(), Angle::Degrees(90.0), Angle::Degrees(5.0), this->interval_
+        ));
+        EXPECT_ANY_THROW(
+            SensorFilter::Cone(Profile::Undefined(), Quaternion::Unit(), Angle::Degrees(10.0), this->interval_)
+        );
+        EXPECT_ANY_THROW(SensorFilter::Cone(profile, Quaternion::Unit(), Angle::Degrees(10.0), Interval::Undefined()));
+        EXPECT_ANY_THROW(
+            SensorFilter::Cone(profile, Quaternion::Unit(), Angle::Degrees(10.0), this->interval_, Duration::Zero())
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_SensorFilter, Evaluate)
+{
+    // Body frame aligned with GCRF: the boresight is the GCRF Z axis
+
+    const Profile profile = Profile::InertialPointing(this->generateOrbit(), Quaternion::Unit());
+
+    const Vector3d observerPositionCoordinates = {7.0e6, 0.0, 0.0};
+
+    const auto direction = [](const double& anXAngle_deg, const double& aYAngle_deg) -> Vector3d
+    {
+        return {std::tan(anXAngle_deg * M_PI / 180.0), std::tan(aYAngle_deg * M_PI / 180.0), 1.0};
+    };
+
+    {
+        const SensorFilter sensorFilter =
+            SensorFilter::Cone(profile, Quaternion::Unit(), Angle::Degrees(10.0), this->interval_);
+
+        const auto evaluate = [&sensorFilter, &observerPositionCoordinates, this](const Vector3d& aDirection) -> bool
+        {
+            return sensorFilter.evaluate(
+                this->startInstant_ + Duration::Minutes(7.0),
+                observerPositionCoordinates,
+                observerPositionCoordinates + 1.0e6 * aDirection
+            );
+        };
+
+        EXPECT_TRUE(evaluate(direction(0.0, 0.0)));
+        EXPECT_TRUE(evaluate(direction(9.0, 0.0)));
+        EXPECT_TRUE(evaluate(direction(0.0, -9.0)));
+        EXPECT_FALSE(evaluate(direction(8.0, 8.0)));
+        EXPECT_FALSE(evaluate(direction(11.0, 0.0)));
+        EXPECT_FALSE(evaluate(-Vector3d::Z()));
+
+        EXPECT_FALSE(
+            sensorFilter.evaluate(this->startInstant_, observerPositionCoordinates, observerPositionCoordinates)
+        );
+    }
+
+    {
+        const SensorFilter sensorFilter = SensorFilter::Rectangle(
+            profile, Quaternion::Unit(), Angle::Degrees(10.0), Angle::Degrees(5.0), this->interval_
+        );
+
+        const auto evaluate = [&sensorFilter, &observerPositionCoordinates, this](const Vector3d& aDirection) -> bool
+        {
+            return sensorFilter.evaluate(
+                this->startInstant_ + Duration::Minutes(7.0),
+                observerPositionCoordinates,
+                observerPositionCoordinates + 1.0e6 * aDirection
+            );
+        };
+
+        EXPECT_TRUE(evaluate(direction(0.0, 0.0)));
+        EXPECT_TRUE(evaluate(direction(9.0, 4.0)));
+        EXPECT_TRUE(evaluate(direction(-9.0, -4.0)));
+        EXPECT_FALSE(evaluate(direction(11.0, 0.0)));
+        EXPECT_FALSE(evaluate(direction(0.0, 6.0)));
+        EXPECT_FALSE(evaluate(-Vector3d::Z()));
+    }
+
+    {
+        // Sensor rotated by 90 deg about the body X axis: the boresight lies along the GCRF Y axis
+
+        const Quaternion q_S_B = Quaternion::XYZS(std::sin(M_PI / 4.0), 0.0, 0.0, std::cos(M_PI / 4.0));
+
+        const SensorFilter sensorFilter = SensorFilter::Cone(profile, q_S_B, Angle::Degrees(10.0), this->interval_);
+
+        const Vector3d boresight_GCRF = q_S_B.toConjugate() * Vector3d::Z();
+
+        EXPECT_NEAR(1.0, std::abs(boresight_GCRF.y()), 1e-12);
+
+        EXPECT_TRUE(sensorFilter.evaluate(
+            this->startInstant_, observerPositionCoordinates, observerPositionCoordinates + 1.0e6 * boresight_GCRF
+        ));
+        EXPECT_FALSE(sensorFilter.evaluate(
+            this->startInstant_, observerPositionCoordinates, observerPositionCoordinates - 1.0e6 * boresight_GCRF
+        ));
+        EXPECT_FALSE(sensorFilter.evaluate(
+            this->startInstant_, observerPositionCoordinates, observerPositionCoordinates + 1.0e6 * Vector3d::Z()
+        ));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_SensorFilter, GetAttitudeAt)
+{
+    // Nadir pointing rotates at the orbital rate about the orbit normal, which the interpolation reproduces
+
+    const Profile profile = Profile::NadirPointing(this->generateOrbit(), Orbit::FrameType::VVLH);
+
+    const SensorFilter sensorFilter =
+        SensorFilter::Cone(profile, Quaternion::Unit(), Angle::Degrees(10.0), this->interval_, Duration::Minutes(1.0));
+
+    for (const Instant& instant : {
+             this->startInstant_,
+             this->startInstant_ + Duration::Seconds(30.0),
+             this->startInstant_ + Duration::Seconds(4567.8),
+             this->interval_.getEnd(),
+             this->interval_.getEnd() + Duration::Minutes(10.0),
+         })
+    {
+        const Quaternion q_B_GCRF = profile.getStateAt(instant).getAttitude();
+        const Quaternion q_S_GCRF = sensorFilter.getAttitudeAt(instant);
+
+        for (const Vector3d& vector : {Vector3d::X(), Vector3d::Y(), Vector3d::Z()})
+        {
+            EXPECT_TRUE(((q_S_GCRF * vector) - (q_B_GCRF * vector)).norm() < 1e-9) << instant.toString();
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(sensorFilter.getAttitudeAt(Instant::Undefined()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Access_SensorFilter, Generator)
+{
+    // Nadir pointing satellite over a ground target: the native evaluation matches a closure calling back the filter
+
+    const Orbit orbit = this->generateOrbit();
+    const Profile profile = Profile::NadirPointing(orbit, Orbit::FrameType::VVLH);
+
+    // Ground target below the satellite, one hour into the interval
+
+    const Vector3d subSatelliteDirection_ITRF = orbit.getStateAt(this->startInstant_ + Duration::Hours(1.0))
+                                                    .inFrame(Frame::ITRF())
+                                                    .getPosition()
+                                                    .getCoordinates()
+                                                    .normalized();
+
+    const Trajectory targetTrajectory = Trajectory::Position(
+        Position::Meters(subSatelliteDirection_ITRF * Earth::EGM2008.equatorialRadius_.inMeters(), Frame::ITRF())
+    );
+
+    const SensorFilter sensorFilter =
+        SensorFilter::Cone(profile, Quaternion::Unit(), Angle::Degrees(30.0), this->interval_);
+
+    Generator nativeGenerator = {this->environment_};
+    nativeGenerator.setStateFilter(sensorFilter);
+
+    Generator closureGenerator = {this->environment_};
+    closureGenerator.setStateFilter(
+        [&sensorFilter](const State& aFromState, const State& aToState) -> bool
+        {
+            return sensorFilter(aFromState, aToState);
+        }
+    );
+
+    const Array<Access> unfilteredAccesses =
+        Generator(this->environment_).computeAccesses(this->interval_, targetTrajectory, orbit);
+    const Array<Access> nativeAccesses = nativeGenerator.computeAccesses(this->interval_, targetTrajectory, orbit);
+    const Array<Access> closureAccesses = closureGenerator.computeAccesses(this->interval_, targetTrajectory, orbit);
+
+    ASSERT_FALSE(nativeAccesses.isEmpty());
+    ASSERT_EQ(closureAccesses.getSize(), nativeAccesses.getSize());
+
+    for (Size index = 0; index < nativeAccesses.getSize(); ++index)
+    {
+        EXPECT_TRUE(nativeAccesses[index].getAcquisitionOfSignal().isNear(
+            closureAccesses[index].getAcquisitionOfSignal(), Duration::Milliseconds(1.0)
+        ));
+        EXPECT_TRUE(nativeAccesses[index].getLossOfSignal().isNear(
+            closureAccesses[index].getLossOfSignal(), Duration::Milliseconds(1.0)
+        ));
+    }
+
+    // The field of view only shortens the accesses
+
+    Duration unfilteredDuration = Duration::Zero();
+    Duration nativeDuration = Duration::Zero();
+
+    for (const Access& access : unfilteredAccesses)
+    {
+        unfilteredDuration += access.getDuration();
+    }
+
+    for (const Access& access : nativeAccesses)
+    {
+        nativeDuration += access.getDuration();
+    }
+
+    EXPECT_LT(nativeDuration, unfilteredDuration);
+}
@@ -0,0 +1,291 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Velocity.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Conjunction/AvoidanceManeuverSolver.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/CentralBodyGravity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/PositionDerivative.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/NumericalSolver.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::filesystem::File;
+using ostk::core::filesystem::Path;
+using ostk::core::type::Index;
+using ostk::core::type::Real;
+using ostk::core::type::Shared;
+
+using ostk::mathematics::object::Matrix3d;
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Velocity;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::environment::object::celestial::Earth;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::unit::Length;
+
+using ostk::astrodynamics::conjunction::AvoidanceManeuverSolver;
+using ostk::astrodynamics::conjunction::message::ccsds::CDM;
+using ostk::astrodynamics::Dynamics;
+using ostk::astrodynamics::dynamics::CentralBodyGravity;
+using ostk::astrodynamics::dynamics::PositionDerivative;
+using ostk::astrodynamics::trajectory::Propagator;
+using ostk::astrodynamics::trajectory::State;
+using ostk::astrodynamics::trajectory::state::NumericalSolver;
+
+class OpenSpaceToolkit_Astrodynamics_Conjunction_AvoidanceManeuverSolver : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        const Shared<Celestial> earthSPtr = std::make_shared<Celestial>(Earth::Spherical());
+
+        const Array<Shared<Dynamics>> dynamics = {
+            std::make_shared<PositionDerivative>(),
+            std::make_shared<CentralBodyGravity>(earthSPtr),
+        };
+
+        this->propagator_ = {this->numericalSolver_, dynamics};
+
+        // Head-on crossing of an equatorial and a polar circular orbit at TCA, each object with an isotropic position
+        // covariance of 5000 m^2 (combined sigma of 100 m)
+
+        const CDM cdm = CDM::Load(
+            File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Astrodynamics/Conjunction/Message/CCSDS/CDM/cdm.json"))
+        );
+
+        const Instant tca = cdm.getTCA();
+
+        MatrixXd covarianceMatrix = MatrixXd::Zero(9, 9);
+        covarianceMatrix.topLeftCorner<3, 3>() = Matrix3d::Identity() * 5000.0;
+
+        Array<CDM::Data> dataArray = cdm.getDataArray();
+
+        dataArray[0].state = State(
+            tca,
+            Position::Meters({7000000.0, 0.0, 0.0}, Frame::GCRF()),
+            Velocity::MetersPerSecond({0.0, 7546.05, 0.0}, Frame::GCRF())
+        );
+        dataArray[0].covarianceMatrix = covarianceMatrix;
+
+        dataArray[1].state = State(
+            tca,
+            Position::Meters({7000000.0, 0.0, 0.0}, Frame::GCRF()),
+            Velocity::MetersPerSecond({0.0, 0.0, 7546.05}, Frame::GCRF())
+        );
+        dataArray[1].covarianceMatrix = covarianceMatrix;
+
+        this->cdm_ = {cdm.getHeader(), cdm.getRelativeMetadata(), cdm.getMetadataArray(), dataArray};
+
+        this->solver_ = std::make_shared<AvoidanceManeuverSolver>(this->propagator_, Length::Meters(20.0), 1e-4, 5, 2);
+    }
+
+    const NumericalSolver numericalSolver_ = {
+        NumericalSolver::LogType::NoLog,
+        NumericalSolver::StepperType::RungeKuttaFehlberg78,
+        5.0,
+        1.0e-12,
+        1.0e-12,
+    };
+
+    const Array<Duration> leadTimes_ = {Duration::Minutes(10.0), Duration::Minutes(30.0)};
+    const Array<Vector3d> directions_RTN_ = {
+        {0.0, 1.0, 0.0},
+        {0.0, -2.0, 0.0},
+        {1.0, 0.0, 0.0},
+        {0.0, 0.0, 1.0},
+    };
+    const Array<Real> deltaVMagnitudes_ = {0.0, 0.05, 0.1, 0.5};
+
+    Propagator propagator_ = Propagator::Undefined();
+    CDM cdm_ = CDM::Undefined();
+    Shared<AvoidanceManeuverSolver> solver_ = nullptr;
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Conjunction_AvoidanceManeuverSolver, Constructor)
+{
+    {
+        EXPECT_NO_THROW(AvoidanceManeuverSolver solver(propagator_, Length::Meters(20.0)););
+    }
+
+    {
+        EXPECT_NO_THROW(AvoidanceManeuverSolver solver(propagator_, Length::Meters(20.0), 1e-5, 10, 4););
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Conjunction_AvoidanceManeuverSolver, StreamOperator)
+{
+    {
+        testing::internal::CaptureStdout();
+
+        EXPECT_NO_THROW(std::cout << *solver_ << std::endl);
+
+        EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Conjunction_AvoidanceManeuverSolver, IsDefined)
+{
+    {
+        EXPECT_TRUE(solver_->isDefined());
+    }
+
+    {
+        EXPECT_FALSE(AvoidanceManeuverSolver::Undefined().isDefined());
+        EXPECT_FALSE(AvoidanceManeuverSolver(Propagator::Undefined(), Length::Meters(20.0)).isDefined());
+        EXPECT_FALSE(AvoidanceManeuverSolver(propagator_, Length::Undefined()).isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Conjunction_AvoidanceManeuverSolver, Getters)
+{
+    {
+        EXPECT_EQ(Length::Meters(20.0), solver_->getHardBodyRadius());
+        EXPECT_EQ(1e-4, solver_->getCollisionProbabilityThreshold());
+        EXPECT_EQ(5, solver_->getRefinementCount());
+        EXPECT_EQ(2, solver_->getThreadCount());
+        EXPECT_NO_THROW(solver_->getPropagator());
+    }
+
+    {
+        EXPECT_ANY_THROW(AvoidanceManeuverSolver::Undefined().getPropagator());
+        EXPECT_ANY_THROW(AvoidanceManeuverSolver::Undefined().getHardBodyRadius());
+        EXPECT_ANY_THROW(AvoidanceManeuverSolver::Undefined().getCollisionProbabilityThreshold());
+        EXPECT_ANY_THROW(AvoidanceManeuverSolver::Undefined().getRefinementCount());
+        EXPECT_ANY_THROW(AvoidanceManeuverSolver::Undefined().getThreadCount());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Conjunction_AvoidanceManeuverSolver, Solve)
+{
+    const Array<AvoidanceManeuverSolver::Candidate> candidates =
+        solver_->solve(cdm_, leadTimes_, directions_RTN_, deltaVMagnitudes_);
+
+    {
+        ASSERT_EQ(32, candidates.getSize());
+
+        for (Index i = 0; i < candidates.getSize(); ++i)
+        {
+            EXPECT_EQ(i < 5, candidates[i].isRefined);
+            EXPECT_NEAR(1.0, candidates[i].direction_RTN.norm(), 1e-15);
+            EXPECT_EQ(cdm_.getTCA() - candidates[i].leadTime, candidates[i].instant);
+        }
+    }
+
+    {
+        // Best candidate: smallest velocity increment meeting the threshold, refined
+
+        const AvoidanceManeuverSolver::Candidate& bestCandidate = candidates[0];
+
+        EXPECT_TRUE(bestCandidate.isRefined);
+        EXPECT_LE(bestCandidate.collisionProbability, 1e-4);
+        EXPECT_GT(bestCandidate.missDistance.inMeters(), 300.0);
+
+        for (const AvoidanceManeuverSolver::Candidate& candidate : candidates)
+        {
+            if (candidate.collisionProbability <= 1e-4)
+            {
+                EXPECT_GE(candidate.deltaVMagnitude, bestCandidate.deltaVMagnitude);
+            }
+        }
+    }
+
+    {
+        // Unmaneuvered candidates keep the nominal probability of collision
+
+        const Real nominalCollisionProbability = cdm_.computeCollisionProbability(Length::Meters(20.0));
+
+        for (const AvoidanceManeuverSolver::Candidate& candidate : candidates)
+        {
+            if (candidate.deltaVMagnitude == 0.0)
+            {
+                EXPECT_FALSE(candidate.isRefined);
+                EXPECT_NEAR(0.0, candidate.missDistance.inMeters(), 1e-3);
+                EXPECT_NEAR(nominalCollisionProbability, candidate.collisionProbability, 1e-12);
+            }
+        }
+    }
+
+    {
+        // Linearized screening matches full propagation for small velocity increments
+
+        const AvoidanceManeuverSolver linearizedSolver = {propagator_, Length::Meters(20.0), 1e-4, 0, 2};
+
+        const Array<AvoidanceManeuverSolver::Candidate> linearizedCandidates =
+            linearizedSolver.solve(cdm_, leadTimes_, directions_RTN_, deltaVMagnitudes_);
+
+        ASSERT_EQ(32, linearizedCandidates.getSize());
+
+        for (Index i = 0; i < 5; ++i)
+        {
+            const AvoidanceManeuverSolver::Candidate& refinedCandidate = candidates[i];
+
+            bool isFound = false;
+
+            for (const AvoidanceManeuverSolver::Candidate& linearizedCandidate : linearizedCandidates)
+            {
+                EXPECT_FALSE(linearizedCandidate.isRefined);
+
+                if ((linearizedCandidate.leadTime == refinedCandidate.leadTime) &&
+                    (linearizedCandidate.direction_RTN == refinedCandidate.direction_RTN) &&
+                    (linearizedCandidate.deltaVMagnitude == refinedCandidate.deltaVMagnitude))
+                {
+                    isFound = true;
+
+                    EXPECT_NEAR(
+                        refinedCandidate.missDistance.inMeters(),
+                        linearizedCandidate.missDistance.inMeters(),
+                        1.0 + 1e-3 * refinedCandidate.missDistance.inMeters()
+                    );
+                }
+            }
+
+            EXPECT_TRUE(isFound);
+        }
+    }
+
+    {
+        EXPECT_TRUE(solver_->solve(cdm_, Array<Duration>::Empty(), directions_RTN_, deltaVMagnitudes_).isEmpty());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Conjunction_AvoidanceManeuverSolver, Solve_Errors)
+{
+    {
+        EXPECT_ANY_THROW(
+            AvoidanceManeuverSolver::Undefined().solve(cdm_, leadTimes_, directions_RTN_, deltaVMagnitudes_)
+        );
+        EXPECT_ANY_THROW(solver_->solve(CDM::Undefined(), leadTimes_, directions_RTN_, deltaVMagnitudes_));
+    }
+
+    {
+        EXPECT_ANY_THROW(solver_->solve(cdm_, {Duration::Minutes(0.0)}, directions_RTN_, deltaVMagnitudes_));
+        EXPECT_ANY_THROW(solver_->solve(cdm_, {Duration::Minutes(-10.0)}, directions_RTN_, deltaVMagnitudes_));
+        EXPECT_ANY_THROW(solver_->solve(cdm_, leadTimes_, {Vector3d::Zero()}, deltaVMagnitudes_));
+        EXPECT_ANY_THROW(solver_->solve(cdm_, leadTimes_, directions_RTN_, {-0.1}));
+    }
+}
@@ -6,10 +6,14 @@
 
 using ostk::core::container::Array;
 using ostk::core::filesystem::File;
+using ostk::core::type::Index;
 using ostk::core::type::Real;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 
+using ostk::mathematics::object::Matrix3d;
 using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::Vector3d;
 
 using ostk::physics::coordinate::Frame;
 using ostk::physics::coordinate::Position;
@@ -22,6 +26,7 @@ using ostk::physics::unit::Length;
 using ostk::physics::unit::Mass;
 
 using ostk::astrodynamics::conjunction::message::ccsds::CDM;
+using ostk::astrodynamics::ExecutionContext;
 using ostk::astrodynamics::trajectory::State;
 
 class OpenSpaceToolkit_Astrodynamics_Conjunction_Message_CCSDS_CDM : public ::testing::Test
@@ -620,6 +625,287 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Conjunction_Message_CCSDS_CDM, Load)
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Conjunction_Message_CCSDS_CDM, ParseKVN)
+{
+    {
+        EXPECT_ANY_THROW(CDM::ParseKVN(String::Empty()));
+        EXPECT_ANY_THROW(CDM::ParseKVN("CCSDS_CDM_VERS 1.0"));
+        EXPECT_ANY_THROW(CDM::ParseKVN("OBJECT = OBJECT3"));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Conjunction_Message_CCSDS_CDM, LoadKVN)
+{
+    using ostk::core::filesystem::File;
+    using ostk::core::filesystem::Path;
+
+    {
+        const CDM cdm = CDM::LoadKVN(
+            File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Astrodynamics/Conjunction/Message/CCSDS/CDM/cdm.kvn"))
+        );
+
+        EXPECT_EQ("1.0", cdm.getCCSDSCDMVersion());
+        EXPECT_EQ(Instant::DateTime(DateTime(2022, 12, 24, 14, 39, 27), Scale::UTC), cdm.getCreationDate());
+        EXPECT_EQ("CSpOC", cdm.getOriginator());
+        EXPECT_EQ("YAM-2", cdm.getMessageFor());
+        EXPECT_EQ("000048911_conj_000015331_2022361132859_35814431361113", cdm.getMessageId());
+        EXPECT_EQ(Instant::DateTime(DateTime(2022, 12, 27, 13, 28, 59, 451), Scale::UTC), cdm.getTCA());
+        EXPECT_EQ(Length::Meters(912.0), cdm.getMissDistance());
+        EXPECT_EQ(7.480082e-19, cdm.getCollisionProbability());
+        EXPECT_EQ("FOSTER-1992", cdm.getCollisionProbabilityMethod());
+
+        EXPECT_EQ(48911, cdm.getObjectDesignator(0));
+        EXPECT_EQ("YAM-2", cdm.getObjectName(0));
+        EXPECT_EQ("2021-059AJ", cdm.getObjectInternationalDesignator(0));
+        EXPECT_EQ("N/A", cdm.getObjectManeuverability(0));
+        EXPECT_EQ("ITRF", cdm.getObjectReferenceFrame(0));
+
+        EXPECT_EQ(15331, cdm.getObjectDesignator(1));
+        EXPECT_EQ("COSMOS 1602", cdm.getObjectName(1));
+
+        const CDM::Data data = cdm.getObjectDataAt(0);
+
+        EXPECT_TRUE(data.state.getPosition().getCoordinates().isApprox(
+            Position::Meters({-4988121.543, -1691845.004, -4469436.766}, Frame::ITRF()).getCoordinates(), 1e-12
+        ));
+        EXPECT_TRUE(data.state.getVelocity().getCoordinates().isApprox(
+            Velocity::MetersPerSecond({-5122.270454, 54.268387, 5699.421225}, Frame::ITRF()).getCoordinates(), 1e-12
+        ));
+
+        EXPECT_EQ(1881.911997152914, data.covarianceMatrix(0, 0));
+        EXPECT_EQ(-311833.2113028035, data.covarianceMatrix(1, 0));
+        EXPECT_EQ(-311833.2113028035, data.covarianceMatrix(0, 1));
+        EXPECT_EQ(0.00005613394470054705, data.covarianceMatrix(5, 5));
+    }
+
+    {
+        EXPECT_ANY_THROW(CDM::LoadKVN(File::Undefined()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Conjunction_Message_CCSDS_CDM, ParseArray)
+{
+    using ostk::core::filesystem::File;
+    using ostk::core::filesystem::Path;
+
+    const File file =
+        File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Astrodynamics/Conjunction/Message/CCSDS/CDM/cdm.json"));
+
+    const CDM cdm = CDM::Load(file);
+
+    {
+        const String string = String::Format("[{}]", file.getContents());
+
+        for (const Size threadCount : Array<Size> {1, 2})
+        {
+            const Array<CDM> cdms = CDM::ParseArray(string, threadCount);
+
+            ASSERT_EQ(1, cdms.getSize());
+
+            const CDM& parsedCDM = cdms[0];
+
+            EXPECT_EQ(cdm.getCCSDSCDMVersion(), parsedCDM.getCCSDSCDMVersion());
+            EXPECT_EQ(cdm.getCreationDate(), parsedCDM.getCreationDate());
+            EXPECT_EQ(cdm.getOriginator(), parsedCDM.getOriginator());
+            EXPECT_EQ(cdm.getMessageFor(), parsedCDM.getMessageFor());
+            EXPECT_EQ(cdm.getMessageId(), parsedCDM.getMessageId());
+            EXPECT_EQ(cdm.getTCA(), parsedCDM.getTCA());
+            EXPECT_EQ(cdm.getMissDistance(), parsedCDM.getMissDistance());
+            EXPECT_EQ(cdm.getCollisionProbability(), parsedCDM.getCollisionProbability());
+            EXPECT_EQ(cdm.getCollisionProbabilityMethod(), parsedCDM.getCollisionProbabilityMethod());
+
+            for (const Index objectIndex : Array<Index> {0, 1})
+            {
+                EXPECT_EQ(cdm.getObjectDesignator(objectIndex), parsedCDM.getObjectDesignator(objectIndex));
+                EXPECT_EQ(cdm.getObjectName(objectIndex), parsedCDM.getObjectName(objectIndex));
+                EXPECT_EQ(
+                    cdm.getObjectInternationalDesignator(objectIndex),
+                    parsedCDM.getObjectInternationalDesignator(objectIndex)
+                );
+                EXPECT_EQ(cdm.getObjectReferenceFrame(objectIndex), parsedCDM.getObjectReferenceFrame(objectIndex));
+
+                const CDM::Data data = cdm.getObjectDataAt(objectIndex);
+                const CDM::Data parsedData = parsedCDM.getObjectDataAt(objectIndex);
+
+                EXPECT_EQ(data.state, parsedData.state);
+                EXPECT_EQ(data.covarianceMatrix, parsedData.covarianceMatrix);
+            }
+        }
+    }
+
+    {
+        const String contents = file.getContents();
+        const String string = String::Format("[{}, {}, {}]", contents, contents, contents);
+
+        const Array<CDM> cdms = CDM::ParseArray(string, ExecutionContext(2));
+
+        ASSERT_EQ(3, cdms.getSize());
+
+        for (const CDM& parsedCDM : cdms)
+        {
+            EXPECT_EQ(cdm.getMessageId(), parsedCDM.getMessageId());
+            EXPECT_EQ(cdm.getTCA(), parsedCDM.getTCA());
+        }
+    }
+
+    {
+        EXPECT_TRUE(CDM::ParseArray("[]").isEmpty());
+        EXPECT_TRUE(CDM::ParseArray(" [ \n ] ").isEmpty());
+        EXPECT_TRUE(CDM::ParseArray("[]", ExecutionContext(2)).isEmpty());
+    }
+
+    {
+        EXPECT_ANY_THROW(CDM::ParseArray(String::Empty()));
+        EXPECT_ANY_THROW(CDM::ParseArray("{}"));
+        EXPECT_ANY_THROW(CDM::ParseArray("[{}]"));
+        EXPECT_ANY_THROW(CDM::ParseArray(String::Format("[{}", file.getContents())));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Conjunction_Message_CCSDS_CDM, LoadArray)
+{
+    using ostk::core::filesystem::File;
+    using ostk::core::filesystem::Path;
+
+    {
+        const CDM cdm = CDM::Load(
+            File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Astrodynamics/Conjunction/Message/CCSDS/CDM/cdm.json"))
+        );
+
+        const Array<CDM> cdms = CDM::LoadArray(
+            File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Astrodynamics/Conjunction/Message/CCSDS/CDM/cdms.json"))
+        );
+
+        ASSERT_EQ(2, cdms.getSize());
+
+        EXPECT_EQ(cdm.getMessageId(), cdms[0].getMessageId());
+        EXPECT_EQ(cdm.getTCA(), cdms[0].getTCA());
+
+        EXPECT_EQ("406320987", cdms[1].getMessageId());
+        EXPECT_EQ(Instant::DateTime(DateTime(2022, 12, 27, 13, 28, 59, 500), Scale::UTC), cdms[1].getTCA());
+        EXPECT_EQ(
+            Position::Meters({1234500.0, 0.0, 0.0}, Frame::ITRF()).getCoordinates().x(),
+            cdms[1].getObjectDataAt(0).state.getPosition().getCoordinates().x()
+        );
+    }
+
+    {
+        EXPECT_ANY_THROW(CDM::LoadArray(File::Undefined()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Conjunction_Message_CCSDS_CDM, ComputeCollisionProbability)
+{
+    // Crossing objects, each with an isotropic position covariance of 5000 m^2 (combined sigma of 100 m)
+
+    const auto generateCDM = [this](const Vector3d& anOffset) -> CDM
+    {
+        const Instant tca = this->cdm_.getTCA();
+
+        MatrixXd covarianceMatrix = MatrixXd::Zero(9, 9);
+        covarianceMatrix.topLeftCorner<3, 3>() = Matrix3d::Identity() * 5000.0;
+
+        Array<CDM::Data> dataArray = this->cdm_.getDataArray();
+
+        dataArray[0].state = State(
+            tca,
+            Position::Meters({7000000.0, 0.0, 0.0}, Frame::GCRF()),
+            Velocity::MetersPerSecond({0.0, 7500.0, 0.0}, Frame::GCRF())
+        );
+        dataArray[0].covarianceMatrix = covarianceMatrix;
+
+        dataArray[1].state = State(
+            tca,
+            Position::Meters(Vector3d(7000000.0, 0.0, 0.0) + anOffset, Frame::GCRF()),
+            Velocity::MetersPerSecond({0.0, 0.0, 7500.0}, Frame::GCRF())
+        );
+        dataArray[1].covarianceMatrix = covarianceMatrix;
+
+        return {
+            this->cdm_.getHeader(), this->cdm_.getRelativeMetadata(), this->cdm_.getMetadataArray(), dataArray
+        };
+    };
+
+    {
+        const CDM cdm = generateCDM({0.0, 0.0, 0.0});
+
+        // Zero miss distance: 1 - exp(-R^2 / (2 sigma^2))
+
+        EXPECT_NEAR(
+            1.0 - std::exp(-400.0 / 20000.0), cdm.computeCollisionProbability(Length::Meters(20.0)), 1e-10
+        );
+    }
+
+    {
+        // Miss distance of 50 / sqrt(2) m in the encounter plane
+
+        const CDM cdm = generateCDM({0.0, 0.0, 50.0});
+
+        EXPECT_NEAR(1.8613214629e-02, cdm.computeCollisionProbability(Length::Meters(20.0)), 1e-10);
+        EXPECT_GT(
+            cdm.computeCollisionProbability(Length::Meters(20.0)), cdm.computeCollisionProbability(Length::Meters(1.0))
+        );
+    }
+
+    {
+        const Array<CDM> cdms = {
+            generateCDM({0.0, 0.0, 0.0}),
+            generateCDM({0.0, 0.0, 50.0}),
+            generateCDM({0.0, 0.0, 5000.0}),
+        };
+
+        const Array<Real> probabilities = CDM::ComputeCollisionProbabilities(cdms, Length::Meters(20.0), 2);
+
+        ASSERT_EQ(3, probabilities.getSize());
+
+        for (Index i = 0; i < cdms.getSize(); ++i)
+        {
+            EXPECT_DOUBLE_EQ(cdms[i].computeCollisionProbability(Length::Meters(20.0)), probabilities[i]);
+        }
+
+        EXPECT_EQ(0.0, probabilities[2]);
+
+        EXPECT_EQ(
+            probabilities, CDM::ComputeCollisionProbabilities(cdms, Length::Meters(20.0), ExecutionContext(2))
+        );
+
+        EXPECT_TRUE(CDM::ComputeCollisionProbabilities(Array<CDM>::Empty(), Length::Meters(20.0)).isEmpty());
+    }
+
+    {
+        const CDM cdm = generateCDM({0.0, 0.0, 50.0});
+
+        EXPECT_DOUBLE_EQ(
+            cdm.computeCollisionProbability(Length::Meters(20.0)),
+            CDM::ComputeCollisionProbability(cdm.getObjectDataAt(0), cdm.getObjectDataAt(1), Length::Meters(20.0))
+        );
+
+        EXPECT_ANY_THROW(
+            CDM::ComputeCollisionProbability(cdm.getObjectDataAt(0), cdm.getObjectDataAt(1), Length::Undefined())
+        );
+
+        CDM::Data undefinedData = cdm.getObjectDataAt(0);
+        undefinedData.state = State::Undefined();
+
+        EXPECT_ANY_THROW(
+            CDM::ComputeCollisionProbability(undefinedData, cdm.getObjectDataAt(1), Length::Meters(20.0))
+        );
+    }
+
+    {
+        const CDM cdm = generateCDM({0.0, 0.0, 0.0});
+
+        EXPECT_ANY_THROW(cdm.computeCollisionProbability(Length::Undefined()));
+        EXPECT_ANY_THROW(cdm.computeCollisionProbability(Length::Meters(0.0)));
+        EXPECT_ANY_THROW(CDM::Undefined().computeCollisionProbability(Length::Meters(20.0)));
+        EXPECT_ANY_THROW(this->cdm_.computeCollisionProbability(Length::Meters(20.0)));
+        EXPECT_ANY_THROW(CDM::ComputeCollisionProbabilities({cdm, CDM::Undefined()}, Length::Meters(20.0)));
+        EXPECT_ANY_THROW(CDM::ComputeCollisionProbabilities(
+            {cdm, CDM::Undefined()}, Length::Meters(20.0), ExecutionContext(2)
+        ));
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Conjunction_Message_CCSDS_CDM, ObjectTypeFromString)
 {
     {
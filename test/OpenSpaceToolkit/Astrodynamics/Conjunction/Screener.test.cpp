@@ -0,0 +1,257 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Physics/Environment.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/Earth.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Conjunction/Screener.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler/COE.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/SGP4/TLE.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Size;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::Environment;
+using ostk::physics::environment::gravitational::Earth;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::time::Scale;
+using ostk::physics::unit::Angle;
+using ostk::physics::unit::Length;
+
+using ostk::astrodynamics::conjunction::Screener;
+using ostk::astrodynamics::ExecutionContext;
+using ostk::astrodynamics::Trajectory;
+using ostk::astrodynamics::trajectory::Orbit;
+using ostk::astrodynamics::trajectory::orbit::model::Kepler;
+using ostk::astrodynamics::trajectory::orbit::model::kepler::COE;
+using ostk::astrodynamics::trajectory::orbit::model::sgp4::TLE;
+
+class OpenSpaceToolkit_Astrodynamics_Conjunction_Screener : public ::testing::Test
+{
+   protected:
+    Orbit generateCircularOrbit(const Length& aSemiMajorAxis, const Angle& anInclination) const
+    {
+        const COE coe = {
+            aSemiMajorAxis, 0.0, anInclination, Angle::Degrees(0.0), Angle::Degrees(0.0), Angle::Degrees(0.0)
+        };
+
+        const Kepler keplerianModel = {
+            coe,
+            this->epoch_,
+            Earth::EGM2008.gravitationalParameter_,
+            Earth::EGM2008.equatorialRadius_,
+            Earth::EGM2008.J2_,
+            Earth::EGM2008.J4_,
+            Kepler::PerturbationType::None
+        };
+
+        return {keplerianModel, this->environment_.accessCelestialObjectWithName("Earth")};
+    }
+
+    const Environment environment_ = Environment::Default();
+    const Instant epoch_ = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+    const Screener screener_ = {Length::Kilometers(5.0), Duration::Seconds(30.0), Duration::Milliseconds(1.0), 2};
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Conjunction_Screener, Constructor)
+{
+    {
+        EXPECT_NO_THROW(Screener screener(Length::Kilometers(5.0)););
+    }
+
+    {
+        EXPECT_NO_THROW(
+            Screener screener(Length::Kilometers(5.0), Duration::Seconds(60.0), Duration::Milliseconds(10.0), 4);
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Conjunction_Screener, StreamOperator)
+{
+    {
+        testing::internal::CaptureStdout();
+
+        EXPECT_NO_THROW(std::cout << screener_ << std::endl);
+
+        EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Conjunction_Screener, IsDefined)
+{
+    {
+        EXPECT_TRUE(screener_.isDefined());
+    }
+
+    {
+        EXPECT_FALSE(Screener::Undefined().isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Conjunction_Screener, Getters)
+{
+    {
+        EXPECT_EQ(Length::Kilometers(5.0), screener_.getScreeningDistance());
+        EXPECT_EQ(Duration::Seconds(30.0), screener_.getStep());
+        EXPECT_EQ(Duration::Milliseconds(1.0), screener_.getTolerance());
+        EXPECT_EQ(2, screener_.getThreadCount());
+    }
+
+    {
+        EXPECT_ANY_THROW(Screener::Undefined().getScreeningDistance());
+        EXPECT_ANY_THROW(Screener::Undefined().getStep());
+        EXPECT_ANY_THROW(Screener::Undefined().getTolerance());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Conjunction_Screener, Screen)
+{
+    {
+        // Equatorial and polar orbits with the same radius cross at the ascending node, at epoch
+
+        const Array<Trajectory> trajectories = {
+            generateCircularOrbit(Length::Kilometers(7000.0), Angle::Degrees(0.0)),
+            generateCircularOrbit(Length::Kilometers(7000.0), Angle::Degrees(90.0)),
+            generateCircularOrbit(Length::Kilometers(7100.0), Angle::Degrees(0.0)),
+        };
+
+        const Interval interval =
+            Interval::Closed(epoch_ - Duration::Minutes(20.25), epoch_ + Duration::Minutes(20.0));
+
+        const Array<Screener::Conjunction> conjunctions = screener_.screen(trajectories, interval);
+
+        ASSERT_EQ(1, conjunctions.getSize());
+
+        const Screener::Conjunction& conjunction = conjunctions[0];
+
+        EXPECT_EQ(0, conjunction.firstObjectIndex);
+        EXPECT_EQ(1, conjunction.secondObjectIndex);
+
+        EXPECT_GT(Duration::Milliseconds(10.0), (conjunction.relativeMetadata.TCA - epoch_).getAbsolute());
+        EXPECT_GT(100.0, conjunction.relativeMetadata.missDistance.inMeters());
+        EXPECT_EQ(interval.getStart(), conjunction.relativeMetadata.startScreenPeriod);
+        EXPECT_EQ(interval.getEnd(), conjunction.relativeMetadata.endScreenPeriod);
+        EXPECT_EQ("RTN", conjunction.relativeMetadata.screenVolumeFrame);
+        EXPECT_EQ("SPHERE", conjunction.relativeMetadata.screenVolumeShape);
+        EXPECT_DOUBLE_EQ(5000.0, conjunction.relativeMetadata.screenVolumeX);
+
+        EXPECT_NEAR(
+            conjunction.relativeMetadata.missDistance.inMeters(), conjunction.relativePosition_RTN.norm(), 1e-6
+        );
+
+        // Both velocities are orthogonal to the position at the ascending node, hence the relative velocity is too
+
+        EXPECT_NEAR(0.0, conjunction.relativeVelocity_RTN.x(), 1e-3);
+
+        ASSERT_EQ(2, conjunction.dataArray.getSize());
+
+        for (const auto& data : conjunction.dataArray)
+        {
+            EXPECT_EQ(conjunction.relativeMetadata.TCA, data.state.accessInstant());
+            EXPECT_EQ(*Frame::GCRF(), *data.state.accessFrame());
+        }
+    }
+
+    {
+        const Array<Trajectory> trajectories = {
+            generateCircularOrbit(Length::Kilometers(7000.0), Angle::Degrees(0.0)),
+            generateCircularOrbit(Length::Kilometers(7100.0), Angle::Degrees(90.0)),
+        };
+
+        const Interval interval = Interval::Closed(epoch_, epoch_ + Duration::Hours(3.0));
+
+        EXPECT_TRUE(screener_.screen(trajectories, interval).isEmpty());
+    }
+
+    {
+        const Array<Trajectory> trajectories = {
+            generateCircularOrbit(Length::Kilometers(7000.0), Angle::Degrees(0.0)),
+        };
+
+        const Interval interval = Interval::Closed(epoch_, epoch_ + Duration::Hours(1.0));
+
+        EXPECT_TRUE(screener_.screen(trajectories, interval).isEmpty());
+    }
+
+    {
+        const Array<Trajectory> trajectories = {
+            generateCircularOrbit(Length::Kilometers(7000.0), Angle::Degrees(0.0)),
+            generateCircularOrbit(Length::Kilometers(7000.0), Angle::Degrees(90.0)),
+        };
+
+        const Interval interval = Interval::Closed(epoch_, epoch_ + Duration::Hours(1.0));
+
+        EXPECT_ANY_THROW(Screener::Undefined().screen(trajectories, interval));
+        EXPECT_ANY_THROW(screener_.screen(trajectories, Interval::Undefined()));
+        EXPECT_ANY_THROW(Screener(Length::Kilometers(5.0), Duration::Zero()).screen(trajectories, interval));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Conjunction_Screener, Screen_ExecutionContext)
+{
+    const Array<Trajectory> trajectories = {
+        generateCircularOrbit(Length::Kilometers(7000.0), Angle::Degrees(0.0)),
+        generateCircularOrbit(Length::Kilometers(7000.0), Angle::Degrees(90.0)),
+        generateCircularOrbit(Length::Kilometers(7000.0), Angle::Degrees(45.0)),
+        generateCircularOrbit(Length::Kilometers(7100.0), Angle::Degrees(0.0)),
+    };
+
+    const Interval interval = Interval::Closed(epoch_ - Duration::Minutes(20.25), epoch_ + Duration::Hours(2.0));
+
+    const Array<Screener::Conjunction> referenceConjunctions = screener_.screen(trajectories, interval);
+
+    ASSERT_FALSE(referenceConjunctions.isEmpty());
+
+    // Conjunctions do not depend on the thread count of the execution context
+
+    for (const Size threadCount : {1, 3, 8})
+    {
+        const Array<Screener::Conjunction> conjunctions =
+            screener_.screen(trajectories, interval, ExecutionContext(threadCount));
+
+        ASSERT_EQ(referenceConjunctions.getSize(), conjunctions.getSize());
+
+        for (Size i = 0; i < conjunctions.getSize(); ++i)
+        {
+            EXPECT_EQ(referenceConjunctions[i].firstObjectIndex, conjunctions[i].firstObjectIndex);
+            EXPECT_EQ(referenceConjunctions[i].secondObjectIndex, conjunctions[i].secondObjectIndex);
+            EXPECT_EQ(referenceConjunctions[i].relativeMetadata.TCA, conjunctions[i].relativeMetadata.TCA);
+            EXPECT_EQ(
+                referenceConjunctions[i].relativeMetadata.missDistance,
+                conjunctions[i].relativeMetadata.missDistance
+            );
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(Screener::Undefined().screen(trajectories, interval, ExecutionContext(2)));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Conjunction_Screener, Screen_TLE)
+{
+    {
+        // Identical TLEs are co-located, hence the closest approach is reached at the start of the interval
+
+        const TLE tle = {
+            "1 25544U 98067A   18231.17878740  .00000187  00000-0  10196-4 0  9994",
+            "2 25544  51.6447  64.7824 0005971  73.1467  36.4366 15.53848234128316"
+        };
+
+        const Interval interval = Interval::Closed(tle.getEpoch(), tle.getEpoch() + Duration::Hours(1.0));
+
+        const Array<Screener::Conjunction> conjunctions = screener_.screen(Array<TLE> {tle, tle}, interval);
+
+        ASSERT_EQ(1, conjunctions.getSize());
+
+        EXPECT_EQ(interval.getStart(), conjunctions[0].relativeMetadata.TCA);
+        EXPECT_DOUBLE_EQ(0.0, conjunctions[0].relativeMetadata.missDistance.inMeters());
+    }
+}
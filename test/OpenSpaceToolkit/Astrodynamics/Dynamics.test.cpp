@@ -5,12 +5,14 @@
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/EarthOrientation.hpp>
 
 #include <Global.test.hpp>
 
 using ostk::core::container::Array;
 using ostk::core::container::Pair;
 using ostk::core::type::Index;
+using ostk::core::type::Real;
 using ostk::core::type::Shared;
 using ostk::core::type::Size;
 using ostk::core::type::String;
@@ -19,11 +21,14 @@ using ostk::mathematics::object::VectorXd;
 
 using ostk::physics::coordinate::Frame;
 using ostk::physics::Environment;
+using ostk::physics::coordinate::Transform;
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 
 using ostk::astrodynamics::Dynamics;
 using ostk::astrodynamics::trajectory::state::CoordinateBroker;
 using ostk::astrodynamics::trajectory::state::CoordinateSubset;
+using ostk::astrodynamics::trajectory::state::EarthOrientation;
 using ostk::astrodynamics::trajectory::state::NumericalSolver;
 
 class DynamicsMock : public Dynamics
@@ -88,3 +93,63 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics, FromEnvironment)
         EXPECT_NO_THROW(Dynamics::FromEnvironment(Environment::Default()));
     }
 }
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics, GetTransform)
+{
+    const Instant instant = Instant::J2000();
+
+    {
+        const Transform transform = Dynamics::GetTransform(Frame::GCRF(), Frame::ITRF(), instant);
+
+        EXPECT_EQ(Frame::GCRF()->getTransformTo(Frame::ITRF(), instant), transform);
+
+        // Served from the cache
+        EXPECT_EQ(transform, Dynamics::GetTransform(Frame::GCRF(), Frame::ITRF(), instant));
+    }
+
+    {
+        for (Index i = 0; i < 10; ++i)
+        {
+            const Instant stageInstant = instant + Duration::Seconds(Real(i));
+
+            EXPECT_EQ(
+                Frame::GCRF()->getTransformTo(Frame::ITRF(), stageInstant),
+                Dynamics::GetTransform(Frame::GCRF(), Frame::ITRF(), stageInstant)
+            );
+            EXPECT_EQ(
+                Frame::ITRF()->getTransformTo(Frame::GCRF(), stageInstant),
+                Dynamics::GetTransform(Frame::ITRF(), Frame::GCRF(), stageInstant)
+            );
+        }
+    }
+
+    {
+        // Cached transforms are dropped when the Earth orientation model changes
+
+        const Instant offNodeInstant = instant + Duration::Minutes(20.0);
+
+        const Transform fullTransform = Dynamics::GetTransform(Frame::GCRF(), Frame::ITRF(), offNodeInstant);
+
+        EarthOrientation::SetModel(EarthOrientation::Model::Interpolated);
+
+        const Transform interpolatedTransform =
+            EarthOrientation::GetTransform(Frame::GCRF(), Frame::ITRF(), offNodeInstant);
+
+        EXPECT_NE(fullTransform, interpolatedTransform);
+        EXPECT_EQ(interpolatedTransform, Dynamics::GetTransform(Frame::GCRF(), Frame::ITRF(), offNodeInstant));
+
+        EarthOrientation::SetModel(EarthOrientation::Model::Full);
+
+        EXPECT_EQ(fullTransform, Dynamics::GetTransform(Frame::GCRF(), Frame::ITRF(), offNodeInstant));
+    }
+
+    {
+        EXPECT_THROW(
+            Dynamics::GetTransform(nullptr, Frame::ITRF(), instant), ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            Dynamics::GetTransform(Frame::GCRF(), Frame::ITRF(), Instant::Undefined()),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
@@ -21,8 +21,10 @@
 #include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Moon.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Sun.hpp>
 #include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Unit.hpp>
 #include <OpenSpaceToolkit/Physics/Unit/Mass.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
@@ -30,6 +32,7 @@
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/CentralBodyGravity.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/PositionDerivative.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/AttitudeQuaternion.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianPosition.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianVelocity.hpp>
 
@@ -48,17 +51,20 @@ using ostk::mathematics::geometry::d3::object::Cuboid;
 using ostk::mathematics::geometry::d3::object::Point;
 using ostk::mathematics::object::Matrix3d;
 using ostk::mathematics::object::Vector3d;
+using ostk::mathematics::object::MatrixXd;
 using ostk::mathematics::object::VectorXd;
 
 using ostk::physics::coordinate::Frame;
 using ostk::physics::coordinate::Position;
 using ostk::physics::coordinate::Velocity;
+using ostk::physics::Unit;
 using ostk::physics::environment::ephemeris::Analytical;
 using ostk::physics::environment::object::Celestial;
 using ostk::physics::environment::object::celestial::Earth;
 using ostk::physics::environment::object::celestial::Moon;
 using ostk::physics::environment::object::celestial::Sun;
 using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 using ostk::physics::time::Scale;
 using ostk::physics::unit::Derived;
@@ -75,6 +81,7 @@ using ostk::astrodynamics::dynamics::CentralBodyGravity;
 using ostk::astrodynamics::dynamics::PositionDerivative;
 using ostk::astrodynamics::flight::system::SatelliteSystem;
 using ostk::astrodynamics::trajectory::state::CoordinateSubset;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::AttitudeQuaternion;
 using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianPosition;
 using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianVelocity;
 
@@ -245,3 +252,171 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_AtmosphericDrag, ComputeContribut
     EXPECT_GT(5e-11, -0.0000278707803890 - contribution[1]);
     EXPECT_GT(5e-11, -0.0000000000197640 - contribution[2]);
 }
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_AtmosphericDrag, ComputeJacobian)
+{
+    const AtmosphericDrag atmosphericDrag(earthSPtr_);
+
+    const MatrixXd jacobian = atmosphericDrag.computeJacobian(startInstant_, startStateVector_, Frame::GCRF());
+    const MatrixXd finiteDifferenceJacobian =
+        atmosphericDrag.Dynamics::computeJacobian(startInstant_, startStateVector_, Frame::GCRF());
+
+    EXPECT_EQ(3, jacobian.rows());
+    EXPECT_EQ(9, jacobian.cols());
+
+    // Position, velocity and (mass, surface area, drag coefficient) blocks have different scales
+    for (const Pair<Index, Size>& block : Array<Pair<Index, Size>> {{0, 3}, {3, 3}, {6, 3}})
+    {
+        const MatrixXd jacobianBlock = jacobian.middleCols(block.first, block.second);
+        const MatrixXd finiteDifferenceJacobianBlock = finiteDifferenceJacobian.middleCols(block.first, block.second);
+
+        EXPECT_GT(1e-3 * jacobianBlock.norm(), (jacobianBlock - finiteDifferenceJacobianBlock).norm());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_AtmosphericDrag, DensityTable)
+{
+    {
+        EXPECT_THROW(
+            AtmosphericDrag::DensityTable(
+                earthSPtr_, Instant::Undefined(), Length::Kilometers(200.0), Length::Kilometers(1000.0)
+            ),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            AtmosphericDrag::DensityTable(
+                earthSPtr_, startInstant_, Length::Kilometers(1000.0), Length::Kilometers(200.0)
+            ),
+            ostk::core::error::runtime::Wrong
+        );
+    }
+
+    {
+        const AtmosphericDrag::DensityTable densityTable = {
+            earthSPtr_,
+            startInstant_,
+            Length::Kilometers(300.0),
+            Length::Kilometers(800.0),
+            Length::Kilometers(5.0),
+            12,
+            7,
+        };
+
+        EXPECT_EQ(earthSPtr_, densityTable.getCelestial());
+        EXPECT_EQ(startInstant_, densityTable.getReferenceInstant());
+        EXPECT_EQ(Length::Kilometers(300.0), densityTable.getMinimumAltitude());
+        EXPECT_EQ(Length::Kilometers(800.0), densityTable.getMaximumAltitude());
+
+        EXPECT_TRUE(densityTable.isApplicableAt({7000000.0, 0.0, 0.0}));
+        EXPECT_FALSE(densityTable.isApplicableAt({6578137.0, 0.0, 0.0}));
+        EXPECT_FALSE(densityTable.isApplicableAt({7378137.0, 0.0, 0.0}));
+
+        const Unit massDensitySIUnit =
+            Unit::Derived(Derived::Unit::MassDensity(Mass::Unit::Kilogram, Length::Unit::Meter));
+
+        for (const Vector3d& position_ITRF : Array<Vector3d> {
+                 {7000000.0, 0.0, 0.0},
+                 {0.0, 6850000.0, 1000000.0},
+                 {-4000000.0, 3000000.0, 4500000.0},
+                 {1000000.0, -2000000.0, -6500000.0},
+             })
+        {
+            for (const Duration& offset : {Duration::Zero(), Duration::Hours(5.5), Duration::Days(2.0)})
+            {
+                const Instant instant = startInstant_ + offset;
+
+                const Real expectedDensity =
+                    earthSPtr_->getAtmosphericDensityAt(Position::Meters(position_ITRF, Frame::ITRF()), instant)
+                        .inUnit(massDensitySIUnit)
+                        .getValue();
+
+                EXPECT_NEAR(1.0, densityTable.getDensityAt(position_ITRF, instant) / expectedDensity, 1e-2);
+            }
+        }
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_AtmosphericDrag, ComputeContribution_DensityTable)
+{
+    const Shared<const AtmosphericDrag::DensityTable> densityTableSPtr =
+        std::make_shared<AtmosphericDrag::DensityTable>(
+            earthSPtr_, startInstant_, Length::Kilometers(200.0), Length::Kilometers(1000.0)
+        );
+
+    const AtmosphericDrag atmosphericDrag = {earthSPtr_};
+    const AtmosphericDrag tabulatedAtmosphericDrag = {earthSPtr_, densityTableSPtr};
+
+    EXPECT_EQ(densityTableSPtr, tabulatedAtmosphericDrag.getDensityTable());
+    EXPECT_EQ(nullptr, atmosphericDrag.getDensityTable());
+    EXPECT_EQ(atmosphericDrag.getName(), tabulatedAtmosphericDrag.getName());
+
+    const VectorXd expectedContribution =
+        atmosphericDrag.computeContribution(startInstant_, startStateVector_, Frame::GCRF());
+    const VectorXd contribution =
+        tabulatedAtmosphericDrag.computeContribution(startInstant_, startStateVector_, Frame::GCRF());
+
+    EXPECT_GT(1e-2, (contribution - expectedContribution).norm() / expectedContribution.norm());
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_AtmosphericDrag, ComputeContribution_ProjectedAreaTable)
+{
+    // Cuboid with projected areas of 24, 12 and 8 m^2 along the body X, Y and Z axes
+
+    const Composite geometry = Composite(Cuboid(
+        Point(0.0, 0.0, 0.0),
+        {Vector3d {1.0, 0.0, 0.0}, Vector3d {0.0, 1.0, 0.0}, Vector3d {0.0, 0.0, 1.0}},
+        {1.0, 2.0, 3.0}
+    ));
+
+    const Shared<const SatelliteSystem::ProjectedAreaTable> projectedAreaTableSPtr =
+        std::make_shared<SatelliteSystem::ProjectedAreaTable>(geometry);
+
+    const AtmosphericDrag atmosphericDrag = {earthSPtr_};
+    const AtmosphericDrag attitudeAtmosphericDrag = {earthSPtr_, nullptr, projectedAreaTableSPtr};
+
+    {
+        EXPECT_EQ(projectedAreaTableSPtr, attitudeAtmosphericDrag.getProjectedAreaTable());
+        EXPECT_EQ(nullptr, atmosphericDrag.getProjectedAreaTable());
+        EXPECT_EQ(atmosphericDrag.getName(), attitudeAtmosphericDrag.getName());
+
+        const Array<Shared<const CoordinateSubset>> subsets = attitudeAtmosphericDrag.getReadCoordinateSubsets();
+
+        EXPECT_EQ(5, subsets.size());
+        EXPECT_EQ(CoordinateSubset::DragCoefficient(), subsets[3]);
+        EXPECT_EQ(AttitudeQuaternion::Default(), subsets[4]);
+    }
+
+    const auto computeExpectedContribution = [this, &atmosphericDrag](const Real& aSurfaceArea) -> VectorXd
+    {
+        VectorXd stateVector = startStateVector_;
+        stateVector[7] = aSurfaceArea;
+
+        return atmosphericDrag.computeContribution(startInstant_, stateVector, Frame::GCRF());
+    };
+
+    // Relative velocity along the body Y axis
+
+    {
+        VectorXd stateVector(12);
+        stateVector << startStateVector_.head(7), startStateVector_[8], 0.0, 0.0, 0.0, 1.0;
+
+        const VectorXd expectedContribution = computeExpectedContribution(12.0);
+        const VectorXd contribution =
+            attitudeAtmosphericDrag.computeContribution(startInstant_, stateVector, Frame::GCRF());
+
+        EXPECT_GT(1e-3, (contribution - expectedContribution).norm() / expectedContribution.norm());
+    }
+
+    // Relative velocity along the body X axis (rotation of 90 deg about Z)
+
+    {
+        VectorXd stateVector(12);
+        stateVector << startStateVector_.head(7), startStateVector_[8], 0.0, 0.0, std::sqrt(0.5), std::sqrt(0.5);
+
+        const VectorXd expectedContribution = computeExpectedContribution(24.0);
+        const VectorXd contribution =
+            attitudeAtmosphericDrag.computeContribution(startInstant_, stateVector, Frame::GCRF());
+
+        EXPECT_GT(1e-3, (contribution - expectedContribution).norm() / expectedContribution.norm());
+    }
+}
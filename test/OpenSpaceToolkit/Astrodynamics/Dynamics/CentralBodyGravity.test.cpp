@@ -7,6 +7,7 @@
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
 #include <OpenSpaceToolkit/Core/Type/Size.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
 
 #include <OpenSpaceToolkit/Physics/Environment/Ephemeris/Analytical.hpp>
@@ -33,6 +34,7 @@ using ostk::core::type::Shared;
 using ostk::core::type::Size;
 using ostk::core::type::String;
 
+using ostk::mathematics::object::MatrixXd;
 using ostk::mathematics::object::VectorXd;
 
 using ostk::physics::coordinate::Frame;
@@ -137,6 +139,31 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_CentralBodyGravity, Constructor)
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_CentralBodyGravity, Constructor_AltitudeBands)
+{
+    {
+        EXPECT_NO_THROW(CentralBodyGravity centralBodyGravity(
+            sphericalEarthSPtr_, {{Length::Kilometers(1000.0), std::make_shared<Celestial>(Earth::Spherical())}}
+        ));
+    }
+
+    {
+        EXPECT_THROW(
+            CentralBodyGravity centralBodyGravity(
+                sphericalEarthSPtr_, {{Length::Undefined(), std::make_shared<Celestial>(Earth::Spherical())}}
+            ),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+
+    {
+        EXPECT_THROW(
+            CentralBodyGravity centralBodyGravity(sphericalEarthSPtr_, {{Length::Kilometers(1000.0), nullptr}}),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_CentralBodyGravity, IsDefined)
 {
     {
@@ -193,6 +220,36 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_CentralBodyGravity, GetCelestial)
     EXPECT_TRUE(centralBodyGravity.getCelestial() == sphericalEarthSPtr_);
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_CentralBodyGravity, GetAltitudeBands)
+{
+    {
+        const CentralBodyGravity centralBodyGravity(sphericalEarthSPtr_);
+
+        EXPECT_TRUE(centralBodyGravity.getAltitudeBands().isEmpty());
+    }
+
+    {
+        const Shared<Celestial> lowBandCelestialSPtr = std::make_shared<Celestial>(Earth::Spherical());
+        const Shared<Celestial> highBandCelestialSPtr = std::make_shared<Celestial>(Earth::Spherical());
+
+        const CentralBodyGravity centralBodyGravity(
+            sphericalEarthSPtr_,
+            {
+                {Length::Kilometers(5000.0), highBandCelestialSPtr},
+                {Length::Kilometers(1000.0), lowBandCelestialSPtr},
+            }
+        );
+
+        const Array<CentralBodyGravity::AltitudeBand> altitudeBands = centralBodyGravity.getAltitudeBands();
+
+        ASSERT_EQ(2, altitudeBands.getSize());
+        EXPECT_EQ(Length::Kilometers(1000.0), altitudeBands[0].minimumAltitude);
+        EXPECT_EQ(lowBandCelestialSPtr, altitudeBands[0].celestialObjectSPtr);
+        EXPECT_EQ(Length::Kilometers(5000.0), altitudeBands[1].minimumAltitude);
+        EXPECT_EQ(highBandCelestialSPtr, altitudeBands[1].celestialObjectSPtr);
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_CentralBodyGravity, GetReadCoordinateSubsets)
 {
     const CentralBodyGravity centralBodyGravity = CentralBodyGravity(sphericalEarthSPtr_);
@@ -225,3 +282,66 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_CentralBodyGravity, ComputeContri
     EXPECT_GT(1e-15, 0.0 - contribution[1]);
     EXPECT_GT(1e-15, 0.0 - contribution[2]);
 }
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_CentralBodyGravity, WriteContribution)
+{
+    const CentralBodyGravity centralBodyGravity(sphericalEarthSPtr_);
+
+    VectorXd contribution = VectorXd::Zero(3);
+
+    centralBodyGravity.writeContribution(startInstant_, startStateVector_.segment(0, 3), Frame::GCRF(), contribution);
+
+    EXPECT_EQ(
+        centralBodyGravity.computeContribution(startInstant_, startStateVector_.segment(0, 3), Frame::GCRF()),
+        contribution
+    );
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_CentralBodyGravity, ComputeJacobian)
+{
+    const CentralBodyGravity centralBodyGravity(sphericalEarthSPtr_);
+
+    const VectorXd position = startStateVector_.segment(0, 3);
+
+    const MatrixXd jacobian = centralBodyGravity.computeJacobian(startInstant_, position, Frame::GCRF());
+    const MatrixXd finiteDifferenceJacobian =
+        centralBodyGravity.Dynamics::computeJacobian(startInstant_, position, Frame::GCRF());
+
+    EXPECT_EQ(3, jacobian.rows());
+    EXPECT_EQ(3, jacobian.cols());
+    EXPECT_GT(1e-6 * jacobian.norm(), (jacobian - finiteDifferenceJacobian).norm());
+    EXPECT_GT(1e-12 * jacobian.norm(), (jacobian - jacobian.transpose()).norm());
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_CentralBodyGravity, ComputeContribution_AltitudeBands)
+{
+    const Shared<Celestial> earthSPtr = std::make_shared<Celestial>(Earth::EGM2008(20, 20));
+
+    const VectorXd fullContribution = CentralBodyGravity(earthSPtr).computeContribution(
+        startInstant_, startStateVector_.segment(0, 3), Frame::GCRF()
+    );
+    const VectorXd sphericalContribution = CentralBodyGravity(sphericalEarthSPtr_)
+                                               .computeContribution(
+                                                   startInstant_, startStateVector_.segment(0, 3), Frame::GCRF()
+                                               );
+
+    // The start state altitude is about 622 km
+
+    {
+        const CentralBodyGravity centralBodyGravity(earthSPtr, {{Length::Kilometers(100.0), sphericalEarthSPtr_}});
+
+        EXPECT_EQ(
+            sphericalContribution,
+            centralBodyGravity.computeContribution(startInstant_, startStateVector_.segment(0, 3), Frame::GCRF())
+        );
+    }
+
+    {
+        const CentralBodyGravity centralBodyGravity(earthSPtr, {{Length::Kilometers(1000.0), sphericalEarthSPtr_}});
+
+        EXPECT_EQ(
+            fullContribution,
+            centralBodyGravity.computeContribution(startInstant_, startStateVector_.segment(0, 3), Frame::GCRF())
+        );
+    }
+}
@@ -0,0 +1,252 @@
+/// Apache License 2.0
+
+#include <cmath>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Moon.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Sun.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/SolarRadiationPressure.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/ThirdBodyGravity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Solver/EclipseSolver.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianPosition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianVelocity.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Real;
+using ostk::core::type::Shared;
+
+using ostk::mathematics::object::Vector3d;
+using ostk::mathematics::object::VectorXd;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::environment::object::celestial::Earth;
+using ostk::physics::environment::object::celestial::Moon;
+using ostk::physics::environment::object::celestial::Sun;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::time::Scale;
+
+using ostk::astrodynamics::dynamics::SolarRadiationPressure;
+using ostk::astrodynamics::dynamics::ThirdBodyGravity;
+using ostk::astrodynamics::solver::EclipseSolver;
+using ostk::astrodynamics::trajectory::state::CoordinateSubset;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianPosition;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianVelocity;
+
+class OpenSpaceToolkit_Astrodynamics_Dynamics_SolarRadiationPressure : public ::testing::Test
+{
+   protected:
+    // Equinox, the Sun is (nearly) along +X in GCRF
+    const Instant startInstant_ = Instant::DateTime(DateTime(2021, 3, 20, 12, 0, 0), Scale::UTC);
+    const Shared<Celestial> sunSPtr_ = std::make_shared<Celestial>(Sun::Spherical());
+    const Shared<Celestial> earthSPtr_ = std::make_shared<Celestial>(Earth::Spherical());
+
+    const double reflectivityCoefficient_ = 1.5;
+    const double mass_ = 100.0;       // kg
+    const double surfaceArea_ = 2.0;  // m^2
+
+    const SolarRadiationPressure defaultSolarRadiationPressure_ = {sunSPtr_, earthSPtr_, reflectivityCoefficient_};
+
+    VectorXd getStateVector(const Vector3d& aPositionCoordinates) const
+    {
+        VectorXd stateVector(5);
+        stateVector << aPositionCoordinates, mass_, surfaceArea_;
+
+        return stateVector;
+    }
+
+    // Unshadowed acceleration, from the Sun to the spacecraft
+    Vector3d getSunlitAcceleration(const Vector3d& aPositionCoordinates, const Vector3d& aSunPositionCoordinates) const
+    {
+        static const double astronomicalUnit_m = 149597870700.0;
+
+        const Vector3d sunToSpacecraft = aPositionCoordinates - aSunPositionCoordinates;
+
+        return SolarRadiationPressure::SolarRadiationPressureAtAstronomicalUnit_SI * reflectivityCoefficient_ *
+               surfaceArea_ / mass_ * std::pow(astronomicalUnit_m / sunToSpacecraft.norm(), 2) *
+               sunToSpacecraft.normalized();
+    }
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_SolarRadiationPressure, Constructor)
+{
+    {
+        EXPECT_NO_THROW(SolarRadiationPressure(sunSPtr_, earthSPtr_, 1.0));
+        EXPECT_NO_THROW(SolarRadiationPressure(sunSPtr_, earthSPtr_, 1.0, nullptr, "test"));
+    }
+
+    {
+        EXPECT_THROW(SolarRadiationPressure(nullptr, earthSPtr_, 1.0), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(SolarRadiationPressure(sunSPtr_, nullptr, 1.0), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(
+            SolarRadiationPressure(sunSPtr_, earthSPtr_, Real::Undefined()), ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(SolarRadiationPressure(sunSPtr_, earthSPtr_, -1.0), ostk::core::error::runtime::Wrong);
+    }
+
+    {
+        const Shared<const ThirdBodyGravity::EphemerisTable> moonEphemerisTableSPtr =
+            std::make_shared<ThirdBodyGravity::EphemerisTable>(
+                std::make_shared<Celestial>(Moon::Spherical()),
+                Interval::Closed(startInstant_, startInstant_ + Duration::Days(1.0)),
+                Frame::GCRF()
+            );
+
+        EXPECT_THROW(
+            SolarRadiationPressure(sunSPtr_, earthSPtr_, 1.0, moonEphemerisTableSPtr),
+            ostk::core::error::runtime::Wrong
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_SolarRadiationPressure, Getters)
+{
+    EXPECT_TRUE(defaultSolarRadiationPressure_.isDefined());
+    EXPECT_EQ("Solar Radiation Pressure", defaultSolarRadiationPressure_.getName());
+    EXPECT_EQ(sunSPtr_, defaultSolarRadiationPressure_.getSun());
+    EXPECT_EQ(earthSPtr_, defaultSolarRadiationPressure_.getOccultingCelestial());
+    EXPECT_EQ(Real(reflectivityCoefficient_), defaultSolarRadiationPressure_.getReflectivityCoefficient());
+    EXPECT_EQ(nullptr, defaultSolarRadiationPressure_.getSunEphemerisTable());
+
+    EXPECT_EQ(
+        Array<Shared<const CoordinateSubset>>(
+            {CartesianPosition::Default(), CoordinateSubset::Mass(), CoordinateSubset::SurfaceArea()}
+        ),
+        defaultSolarRadiationPressure_.getReadCoordinateSubsets()
+    );
+    EXPECT_EQ(
+        Array<Shared<const CoordinateSubset>>({CartesianVelocity::Default()}),
+        defaultSolarRadiationPressure_.getWriteCoordinateSubsets()
+    );
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_SolarRadiationPressure, Print)
+{
+    testing::internal::CaptureStdout();
+
+    EXPECT_NO_THROW(defaultSolarRadiationPressure_.print(std::cout, true));
+    EXPECT_NO_THROW(defaultSolarRadiationPressure_.print(std::cout, false));
+    EXPECT_NO_THROW(std::cout << defaultSolarRadiationPressure_ << std::endl);
+
+    EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_SolarRadiationPressure, ComputeContribution)
+{
+    const Vector3d sunPositionCoordinates =
+        sunSPtr_->getPositionIn(Frame::GCRF(), startInstant_).inMeters().getCoordinates();
+
+    // Sunlit, on the day side
+
+    {
+        const Vector3d positionCoordinates = {7000000.0, 0.0, 0.0};
+
+        const VectorXd contribution = defaultSolarRadiationPressure_.computeContribution(
+            startInstant_, getStateVector(positionCoordinates), Frame::GCRF()
+        );
+
+        const Vector3d expectedContribution = getSunlitAcceleration(positionCoordinates, sunPositionCoordinates);
+
+        ASSERT_EQ(3, contribution.size());
+        EXPECT_GT(1e-12, (contribution - expectedContribution).norm() / expectedContribution.norm());
+        EXPECT_NEAR(4.56e-6 * 1.5 * 2.0 / 100.0, contribution.norm(), 3.5e-2 * contribution.norm());
+    }
+
+    // Umbra, on the night side
+
+    {
+        const VectorXd contribution = defaultSolarRadiationPressure_.computeContribution(
+            startInstant_, getStateVector(-7000000.0 * sunPositionCoordinates.normalized()), Frame::GCRF()
+        );
+
+        EXPECT_TRUE(contribution.isZero(0.0));
+    }
+
+    // Around the orbit, through penumbra: the illumination fraction matches the conic shadow model
+
+    {
+        const Vector3d sunDirection = sunPositionCoordinates.normalized();
+        const Vector3d normalDirection = sunDirection.cross(Vector3d::UnitZ()).normalized();
+
+        const double sunRadius_m = sunSPtr_->getEquatorialRadius().inMeters();
+        const double earthRadius_m = earthSPtr_->getEquatorialRadius().inMeters();
+
+        Index penumbraCount = 0;
+
+        for (Index i = 0; i < 3600; ++i)
+        {
+            const double angle = 2.0 * M_PI * double(i) / 3600.0;
+
+            const Vector3d positionCoordinates =
+                42164000.0 * (std::cos(angle) * sunDirection + std::sin(angle) * normalDirection);
+
+            const double illuminationFraction = EclipseSolver::ComputeIlluminationFraction(
+                positionCoordinates, sunPositionCoordinates, Vector3d::Zero(), sunRadius_m, earthRadius_m
+            );
+
+            if ((illuminationFraction > 0.0) && (illuminationFraction < 1.0))
+            {
+                ++penumbraCount;
+            }
+
+            const VectorXd contribution = defaultSolarRadiationPressure_.computeContribution(
+                startInstant_, getStateVector(positionCoordinates), Frame::GCRF()
+            );
+
+            const Vector3d sunlitContribution = getSunlitAcceleration(positionCoordinates, sunPositionCoordinates);
+
+            EXPECT_GT(
+                1e-12 * sunlitContribution.norm(), (contribution - illuminationFraction * sunlitContribution).norm()
+            ) << i;
+        }
+
+        EXPECT_LT(0, penumbraCount);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_SolarRadiationPressure, ComputeContribution_EphemerisTable)
+{
+    const Shared<const ThirdBodyGravity::EphemerisTable> sunEphemerisTableSPtr =
+        std::make_shared<ThirdBodyGravity::EphemerisTable>(
+            sunSPtr_, Interval::Closed(startInstant_, startInstant_ + Duration::Days(1.0)), Frame::GCRF()
+        );
+
+    const SolarRadiationPressure solarRadiationPressure = {
+        sunSPtr_, earthSPtr_, reflectivityCoefficient_, sunEphemerisTableSPtr
+    };
+
+    EXPECT_EQ(sunEphemerisTableSPtr, solarRadiationPressure.getSunEphemerisTable());
+
+    const VectorXd stateVector = getStateVector({7000000.0, 1000000.0, 0.0});
+
+    for (const Duration& offset : {Duration::Zero(), Duration::Hours(7.3), Duration::Days(1.0), Duration::Days(2.0)})
+    {
+        const Instant instant = startInstant_ + offset;
+
+        const VectorXd expectedContribution =
+            defaultSolarRadiationPressure_.computeContribution(instant, stateVector, Frame::GCRF());
+        const VectorXd contribution = solarRadiationPressure.computeContribution(instant, stateVector, Frame::GCRF());
+
+        EXPECT_GT(1e-8, (contribution - expectedContribution).norm() / expectedContribution.norm());
+    }
+}
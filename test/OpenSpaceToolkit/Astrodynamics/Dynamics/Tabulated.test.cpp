@@ -440,3 +440,65 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_Tabulated, ComputeContribution)
         }
     }
 }
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_Tabulated, ComputeContribution_Linear)
+{
+    const VectorXd x;  // Not used
+
+    const Tabulated tabulated = {
+        defaultInstants_,
+        contributionProfile_,
+        defaultWriteCoordinateSubsets_,
+        defaultFrameSPtr_,
+        Interpolator::Type::Linear,
+    };
+
+    EXPECT_EQ(Interpolator::Type::Linear, tabulated.getInterpolationType());
+
+    MatrixXd otherContributionProfile = 2.0 * contributionProfile_;
+
+    const Tabulated otherTabulated = {
+        defaultInstants_,
+        otherContributionProfile,
+        defaultWriteCoordinateSubsets_,
+        defaultFrameSPtr_,
+        Interpolator::Type::Linear,
+    };
+
+    const auto expectedContribution = [this](const double& anEpoch) -> VectorXd
+    {
+        const Index k = std::min(static_cast<Index>(anEpoch / 5.0), Index(2));
+        const double ratio = (anEpoch - 5.0 * k) / 5.0;
+
+        return contributionProfile_.row(k).transpose() +
+               ratio * (contributionProfile_.row(k + 1) - contributionProfile_.row(k)).transpose();
+    };
+
+    // Forward, backward and far jumping queries, interleaved between two tabulated dynamics
+
+    const Array<double> epochs = {0.0, 1.0, 4.0, 5.0, 6.5, 9.9, 10.0, 7.5, 2.5, 14.0, 15.0, 0.5, 12.5, 3.0};
+
+    for (const double& epoch : epochs)
+    {
+        const Instant instant = defaultInstants_.accessFirst() + Duration::Seconds(epoch);
+
+        const VectorXd contribution = tabulated.computeContribution(instant, x, defaultFrameSPtr_);
+        const VectorXd otherContribution = otherTabulated.computeContribution(instant, x, defaultFrameSPtr_);
+
+        EXPECT_TRUE((contribution - expectedContribution(epoch)).norm() < 1e-12) << epoch;
+        EXPECT_TRUE((otherContribution - 2.0 * expectedContribution(epoch)).norm() < 1e-12) << epoch;
+    }
+
+    {
+        EXPECT_THROW(
+            Tabulated(
+                {defaultInstants_.accessFirst()},
+                contributionProfile_.topRows(1),
+                defaultWriteCoordinateSubsets_,
+                defaultFrameSPtr_,
+                Interpolator::Type::Linear
+            ),
+            ostk::core::error::RuntimeError
+        );
+    }
+}
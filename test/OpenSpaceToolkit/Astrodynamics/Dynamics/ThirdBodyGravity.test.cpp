@@ -14,7 +14,9 @@
 #include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Moon.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Sun.hpp>
 #include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
@@ -30,10 +32,12 @@
 using ostk::core::container::Array;
 using ostk::core::container::Pair;
 using ostk::core::type::Index;
+using ostk::core::type::Real;
 using ostk::core::type::Shared;
 using ostk::core::type::Size;
 using ostk::core::type::String;
 
+using ostk::mathematics::object::Vector3d;
 using ostk::mathematics::object::VectorXd;
 
 using ostk::physics::coordinate::Frame;
@@ -43,7 +47,9 @@ using ostk::physics::environment::object::celestial::Earth;
 using ostk::physics::environment::object::celestial::Moon;
 using ostk::physics::environment::object::celestial::Sun;
 using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
 using ostk::physics::time::Scale;
 using ostk::physics::unit::Derived;
 using ostk::physics::unit::Length;
@@ -235,3 +241,90 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_ThirdBodyGravity, ComputeContribu
     EXPECT_GT(1e-15, 2.948717888154649e-07 - contribution[1]);
     EXPECT_GT(1e-15, 1.301648617451192e-07 - contribution[2]);
 }
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_ThirdBodyGravity, EphemerisTable)
+{
+    const Interval interval = Interval::Closed(startInstant_, startInstant_ + Duration::Days(3.5));
+
+    {
+        EXPECT_THROW(
+            ThirdBodyGravity::EphemerisTable(nullptr, interval, Frame::GCRF()), ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            ThirdBodyGravity::EphemerisTable(sphericalMoonSPtr_, Interval::Undefined(), Frame::GCRF()),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            ThirdBodyGravity::EphemerisTable(sphericalMoonSPtr_, interval, Frame::GCRF(), Duration::Zero()),
+            ostk::core::error::runtime::Wrong
+        );
+    }
+
+    {
+        const ThirdBodyGravity::EphemerisTable ephemerisTable = {sphericalMoonSPtr_, interval, Frame::GCRF()};
+
+        EXPECT_EQ(sphericalMoonSPtr_, ephemerisTable.getCelestial());
+        EXPECT_EQ(interval, ephemerisTable.getInterval());
+        EXPECT_EQ(Frame::GCRF(), ephemerisTable.getFrame());
+
+        EXPECT_TRUE(ephemerisTable.isApplicableAt(startInstant_, Frame::GCRF()));
+        EXPECT_FALSE(ephemerisTable.isApplicableAt(startInstant_, Frame::ITRF()));
+        EXPECT_FALSE(ephemerisTable.isApplicableAt(startInstant_ - Duration::Seconds(1.0), Frame::GCRF()));
+
+        for (Index i = 0; i <= 84; ++i)
+        {
+            const Instant instant = startInstant_ + Duration::Hours(Real(i) + 0.3);
+
+            if (!ephemerisTable.isApplicableAt(instant, Frame::GCRF()))
+            {
+                continue;
+            }
+
+            const Vector3d expectedPosition =
+                sphericalMoonSPtr_->getPositionIn(Frame::GCRF(), instant).inMeters().getCoordinates();
+
+            EXPECT_GT(1.0, (ephemerisTable.getPositionAt(instant) - expectedPosition).norm()) << instant.toString();
+        }
+
+        EXPECT_THROW(
+            ephemerisTable.getPositionAt(startInstant_ + Duration::Days(4.0)), ostk::core::error::RuntimeError
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_ThirdBodyGravity, ComputeContribution_EphemerisTable)
+{
+    const Shared<const ThirdBodyGravity::EphemerisTable> ephemerisTableSPtr =
+        std::make_shared<ThirdBodyGravity::EphemerisTable>(
+            sphericalMoonSPtr_, Interval::Closed(startInstant_, startInstant_ + Duration::Days(1.0)), Frame::GCRF()
+        );
+
+    {
+        const Shared<Celestial> sunSPtr = std::make_shared<Celestial>(Sun::Spherical());
+
+        EXPECT_THROW(ThirdBodyGravity(sunSPtr, ephemerisTableSPtr), ostk::core::error::runtime::Wrong);
+    }
+
+    {
+        const ThirdBodyGravity thirdBodyGravity = {sphericalMoonSPtr_, ephemerisTableSPtr};
+
+        EXPECT_EQ(ephemerisTableSPtr, thirdBodyGravity.getEphemerisTable());
+        EXPECT_EQ(defaultThirdBodyGravity_.getName(), thirdBodyGravity.getName());
+
+        for (const Duration& offset : {Duration::Zero(), Duration::Hours(7.3), Duration::Days(1.0)})
+        {
+            const Instant instant = startInstant_ + offset;
+
+            const VectorXd expectedContribution =
+                defaultThirdBodyGravity_.computeContribution(instant, startStateVector_, Frame::GCRF());
+            const VectorXd contribution =
+                thirdBodyGravity.computeContribution(instant, startStateVector_, Frame::GCRF());
+
+            EXPECT_GT(1e-8, (contribution - expectedContribution).norm() / expectedContribution.norm());
+        }
+    }
+
+    {
+        EXPECT_EQ(nullptr, defaultThirdBodyGravity_.getEphemerisTable());
+    }
+}
@@ -3,6 +3,7 @@
 #include <gmock/gmock.h>
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
 
@@ -161,4 +162,26 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_Thruster, ComputeContribution)
 
         EXPECT_TRUE(acceleration.isNear(expectedAcceleration, 1e-12));
     }
+
+    {
+        VectorXd coordinates(7);
+        coordinates << 7000000.0, 0.0, 0.0, 0.0, 7546.05329, 0.0, 100.0;
+
+        EXPECT_THROW(
+            defaultThruster_.computeContribution(Instant::J2000(), coordinates, Frame::GCRF()),
+            ostk::core::error::RuntimeError
+        );
+    }
+
+    {
+        const Thruster thruster = {SatelliteSystem::Undefined(), defaultGuidanceLaw_, defaultName_};
+
+        VectorXd coordinates(7);
+        coordinates << 7000000.0, 0.0, 0.0, 0.0, 7546.05329, 0.0, 105.0;
+
+        EXPECT_THROW(
+            thruster.computeContribution(Instant::J2000(), coordinates, Frame::GCRF()),
+            ostk::core::error::runtime::Undefined
+        );
+    }
 }
@@ -0,0 +1,175 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Segment.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Environment.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/EnvironmentView.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/ExecutionContext.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Shared;
+
+using ostk::mathematics::geometry::d3::object::Point;
+using ostk::mathematics::geometry::d3::object::Segment;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::Environment;
+using ostk::physics::environment::Object;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+
+using ostk::astrodynamics::EnvironmentView;
+using ostk::astrodynamics::ExecutionContext;
+
+class OpenSpaceToolkit_Astrodynamics_EnvironmentView : public ::testing::Test
+{
+   protected:
+    const Environment environment_ = Environment::Default();
+
+    const Instant instant_ = environment_.getInstant();
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_EnvironmentView, Constructor)
+{
+    {
+        const EnvironmentView environmentView = {this->environment_};
+
+        EXPECT_TRUE(environmentView.isDefined());
+        EXPECT_EQ(this->instant_, environmentView.getInstant());
+        EXPECT_EQ(this->environment_.getObjectNames(), environmentView.getObjectNames());
+    }
+
+    {
+        const Instant instant = this->instant_ + Duration::Hours(1.0);
+
+        const EnvironmentView environmentView = {this->environment_, instant};
+
+        EXPECT_EQ(instant, environmentView.getInstant());
+    }
+
+    {
+        EXPECT_FALSE(EnvironmentView(Environment::Undefined()).isDefined());
+        EXPECT_FALSE(EnvironmentView::Undefined().isDefined());
+
+        EXPECT_ANY_THROW(EnvironmentView::Undefined().getInstant());
+        EXPECT_ANY_THROW(EnvironmentView::Undefined().accessObjects());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_EnvironmentView, AccessObjects)
+{
+    const EnvironmentView environmentView = {this->environment_};
+
+    // Objects are shared with the environment, not cloned
+
+    ASSERT_EQ(this->environment_.accessObjects().getSize(), environmentView.accessObjects().getSize());
+
+    for (Index index = 0; index < environmentView.accessObjects().getSize(); ++index)
+    {
+        EXPECT_EQ(this->environment_.accessObjects()[index], environmentView.accessObjects()[index]);
+    }
+
+    {
+        EXPECT_TRUE(environmentView.hasObjectWithName("Earth"));
+        EXPECT_FALSE(environmentView.hasObjectWithName("Pluto"));
+
+        EXPECT_EQ(
+            this->environment_.accessCelestialObjectWithName("Earth"),
+            environmentView.accessCelestialObjectWithName("Earth")
+        );
+
+        EXPECT_ANY_THROW(environmentView.accessObjectWithName("Pluto"));
+        EXPECT_ANY_THROW(environmentView.accessCelestialObjectWithName("Pluto"));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_EnvironmentView, SetInstant)
+{
+    const EnvironmentView environmentView = {this->environment_};
+
+    EnvironmentView otherEnvironmentView = environmentView;
+
+    const Instant instant = this->instant_ + Duration::Days(1.0);
+
+    otherEnvironmentView.setInstant(instant);
+
+    EXPECT_EQ(instant, otherEnvironmentView.getInstant());
+    EXPECT_EQ(this->instant_, environmentView.getInstant());
+    EXPECT_EQ(this->instant_, this->environment_.getInstant());
+
+    EXPECT_EQ(&environmentView.accessObjects(), &otherEnvironmentView.accessObjects());
+
+    EXPECT_ANY_THROW(otherEnvironmentView.setInstant(Instant::Undefined()));
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_EnvironmentView, Intersects)
+{
+    const Shared<const Frame> frameSPtr = Frame::GCRF();
+
+    const Segment throughEarthSegment = {Point(-1.0e7, 0.0, 0.0), Point(1.0e7, 0.0, 0.0)};
+    const Segment aboveEarthSegment = {Point(1.0e7, -1.0e6, 0.0), Point(1.0e7, 1.0e6, 0.0)};
+
+    const Object::Geometry throughEarthGeometry = {throughEarthSegment, frameSPtr};
+    const Object::Geometry aboveEarthGeometry = {aboveEarthSegment, frameSPtr};
+
+    {
+        const EnvironmentView environmentView = {this->environment_};
+
+        EXPECT_TRUE(environmentView.intersects(throughEarthGeometry));
+        EXPECT_FALSE(environmentView.intersects(aboveEarthGeometry));
+        EXPECT_FALSE(environmentView.intersects(throughEarthGeometry, {environmentView.accessObjectWithName("Earth")}));
+
+        EXPECT_EQ(
+            this->environment_.intersects(throughEarthGeometry), environmentView.intersects(throughEarthGeometry)
+        );
+    }
+
+    {
+        EXPECT_ANY_THROW(EnvironmentView::Undefined().intersects(throughEarthGeometry));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_EnvironmentView, Concurrency)
+{
+    // Views of a shared environment are moved in time concurrently, without affecting each other
+
+    const EnvironmentView environmentView = {this->environment_};
+
+    const Segment throughEarthSegment = {Point(-1.0e7, 0.0, 0.0), Point(1.0e7, 0.0, 0.0)};
+    const Object::Geometry throughEarthGeometry = {throughEarthSegment, Frame::GCRF()};
+
+    const Array<bool> intersections = ExecutionContext(4).map<bool>(
+        64,
+        [&environmentView, &throughEarthGeometry, this](const Index& anIndex) -> bool
+        {
+            EnvironmentView threadEnvironmentView = environmentView;
+
+            const Instant instant = this->instant_ + Duration::Minutes(static_cast<double>(anIndex));
+
+            threadEnvironmentView.setInstant(instant);
+
+            return (threadEnvironmentView.getInstant() == instant) &&
+                   threadEnvironmentView.intersects(throughEarthGeometry);
+        }
+    );
+
+    for (const bool intersection : intersections)
+    {
+        EXPECT_TRUE(intersection);
+    }
+
+    EXPECT_EQ(this->instant_, environmentView.getInstant());
+}
@@ -0,0 +1,74 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/EpochTime.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+
+using ostk::astrodynamics::EpochTime;
+
+class OpenSpaceToolkit_Astrodynamics_EpochTime : public ::testing::Test
+{
+   protected:
+    const Instant epoch_ = Instant::DateTime(DateTime(2023, 1, 1, 0, 0, 0), Scale::UTC);
+    const EpochTime epochTime_ = {epoch_};
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_EpochTime, Constructor)
+{
+    {
+        EXPECT_NO_THROW(EpochTime epochTime(epoch_));
+    }
+
+    {
+        EXPECT_TRUE(epochTime_.isDefined());
+        EXPECT_EQ(epoch_, epochTime_.accessEpoch());
+    }
+
+    {
+        EXPECT_FALSE(EpochTime(Instant::Undefined()).isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_EpochTime, GetInstantAt)
+{
+    {
+        EXPECT_EQ(epoch_, epochTime_.getInstantAt(0.0));
+        EXPECT_EQ(epoch_ + Duration::Minutes(1.0), epochTime_.getInstantAt(60.0));
+        EXPECT_EQ(epoch_ - Duration::Milliseconds(500.0), epochTime_.getInstantAt(-0.5));
+    }
+
+    {
+        EXPECT_ANY_THROW(EpochTime(Instant::Undefined()).getInstantAt(0.0));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_EpochTime, GetTimeAt)
+{
+    {
+        EXPECT_EQ(0.0, epochTime_.getTimeAt(epoch_));
+        EXPECT_EQ(60.0, epochTime_.getTimeAt(epoch_ + Duration::Minutes(1.0)));
+        EXPECT_EQ(-0.5, epochTime_.getTimeAt(epoch_ - Duration::Milliseconds(500.0)));
+    }
+
+    {
+        for (const double time : {-86400.0, -1.0e-3, 0.0, 1.0e-3, 12345.678, 86400.0})
+        {
+            EXPECT_NEAR(time, epochTime_.getTimeAt(epochTime_.getInstantAt(time)), 1e-9);
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(epochTime_.getTimeAt(Instant::Undefined()));
+        EXPECT_ANY_THROW(EpochTime(Instant::Undefined()).getTimeAt(epoch_));
+    }
+}
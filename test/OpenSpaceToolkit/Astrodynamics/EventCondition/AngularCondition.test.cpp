@@ -4,6 +4,7 @@
 
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
@@ -22,6 +23,7 @@ using ostk::core::container::Array;
 using ostk::core::container::Pair;
 using ostk::core::type::Real;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 
 using ostk::mathematics::object::VectorXd;
@@ -309,6 +311,35 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_EventCondition_AngularCondition, isSatisfi
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_EventCondition_AngularCondition, isSatisfied_CachedEvaluation)
+{
+    Size evaluationCount = 0;
+
+    const AngularCondition condition = {
+        defaultName_,
+        AngularCondition::Criterion::PositiveCrossing,
+        [&evaluationCount](const State& aState) -> Real
+        {
+            ++evaluationCount;
+            return aState.accessCoordinates()[0];
+        },
+        defaultTargetAngle_,
+    };
+
+    const Array<State> states = {
+        generateState(Angle::Degrees(0.0).inRadians()),
+        generateState(Angle::Degrees(0.5).inRadians()),
+        generateState(Angle::Degrees(1.5).inRadians()),
+        generateState(Angle::Degrees(2.0).inRadians()),
+    };
+
+    EXPECT_FALSE(condition.isSatisfied(states[1], states[0]));
+    EXPECT_TRUE(condition.isSatisfied(states[2], states[1]));
+    EXPECT_FALSE(condition.isSatisfied(states[3], states[2]));
+
+    EXPECT_EQ(4, evaluationCount);
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_EventCondition_AngularCondition, StringFromCriterion)
 {
     EXPECT_TRUE(
@@ -1,8 +1,10 @@
 /// Apache License 2.0
 
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Tuple.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
 
@@ -12,12 +14,14 @@
 #include <OpenSpaceToolkit/Physics/Unit/Derived.hpp>
 #include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
 #include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Time.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/EventCondition/COECondition.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler/COE.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateBroker.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianPosition.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianVelocity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/EarthOrientation.hpp>
 
 #include <Global.test.hpp>
 
@@ -25,18 +29,22 @@ using ostk::core::container::Array;
 using ostk::core::container::Tuple;
 using ostk::core::type::Real;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 
+using ostk::mathematics::object::Vector6d;
 using ostk::mathematics::object::VectorXd;
 
 using ostk::physics::coordinate::Frame;
 using ostk::physics::coordinate::Position;
 using ostk::physics::coordinate::Velocity;
 using ostk::physics::environment::gravitational::Earth;
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 using ostk::physics::unit::Angle;
 using ostk::physics::unit::Derived;
 using ostk::physics::unit::Length;
+using ostk::physics::unit::Time;
 
 using ostk::astrodynamics::EventCondition;
 using ostk::astrodynamics::eventcondition::AngularCondition;
@@ -47,6 +55,7 @@ using ostk::astrodynamics::trajectory::State;
 using ostk::astrodynamics::trajectory::state::CoordinateBroker;
 using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianPosition;
 using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianVelocity;
+using ostk::astrodynamics::trajectory::state::EarthOrientation;
 
 class OpenSpaceToolkit_Astrodynamics_EventCondition_COECondition
     : public ::testing::TestWithParam<Tuple<COE::Element, Real, Real>>
@@ -322,3 +331,87 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_EventCondition_COECondition, EccentricAnom
         EXPECT_TRUE(condition.isSatisfied(previousState_, currentState_));
     }
 }
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_EventCondition_COECondition, SharedEvaluation)
+{
+    // Conditions computing elements in different frames or with different gravitational parameters do not share
+    // cached elements, and states sharing an instant are told apart by their coordinates
+
+    const Derived otherGravitationalParameter = Earth::EGM2008.gravitationalParameter_;
+
+    const Array<Tuple<RealCondition, Shared<const Frame>, Derived>> conditions = {
+        {COECondition::SemiMajorAxis(
+             RealCondition::Criterion::AnyCrossing, defaultFrame_, Length::Meters(7e6), gravitationalParameter_
+         ),
+         defaultFrame_,
+         gravitationalParameter_},
+        {COECondition::SemiMajorAxis(
+             RealCondition::Criterion::AnyCrossing, Frame::GCRF(), Length::Meters(7e6), gravitationalParameter_
+         ),
+         Frame::GCRF(),
+         gravitationalParameter_},
+        {COECondition::SemiMajorAxis(
+             RealCondition::Criterion::AnyCrossing, defaultFrame_, Length::Meters(7e6), otherGravitationalParameter
+         ),
+         defaultFrame_,
+         otherGravitationalParameter},
+    };
+
+    Array<State> states = {currentState_, previousState_};
+
+    for (const Real& trueAnomaly_deg : {10.0, 50.0, 90.0, 130.0, 170.0})
+    {
+        const auto cartesianState =
+            COE(Length::Kilometers(7000.0),
+                0.1,
+                Angle::Degrees(45.0),
+                Angle::Degrees(10.0),
+                Angle::Degrees(20.0),
+                Angle::Degrees(trueAnomaly_deg))
+                .getCartesianState(Earth::EGM2008.gravitationalParameter_, defaultFrame_);
+
+        states.add({defaultInstant_, cartesianState.first, cartesianState.second});
+    }
+
+    for (Size iteration = 0; iteration < 2; ++iteration)
+    {
+        for (const State& state : states)
+        {
+            for (const auto& condition : conditions)
+            {
+                const State stateInFrame = state.inFrame(std::get<1>(condition));
+
+                const Real referenceSemiMajorAxis =
+                    COE::Cartesian({stateInFrame.getPosition(), stateInFrame.getVelocity()}, std::get<2>(condition))
+                        .getSemiMajorAxis()
+                        .inMeters();
+
+                EXPECT_NEAR(referenceSemiMajorAxis, std::get<0>(condition).getEvaluator()(state), 1e-3);
+            }
+        }
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_EventCondition_COECondition, CalculateCOEVector_EarthOrientationModel)
+{
+    // Cached elements are dropped when the Earth orientation model changes
+
+    const Real gravitationalParameter_SI =
+        gravitationalParameter_.in(Derived::Unit::GravitationalParameter(Length::Unit::Meter, Time::Unit::Second));
+
+    const State state =
+        State(defaultInstant_ + Duration::Minutes(20.0), currentState_.getPosition(), currentState_.getVelocity())
+            .inFrame(Frame::ITRF());
+
+    const Vector6d fullCOEVector = COECondition::CalculateCOEVector(state, Frame::GCRF(), gravitationalParameter_SI);
+
+    EarthOrientation::SetModel(EarthOrientation::Model::Interpolated);
+
+    const Vector6d interpolatedCOEVector =
+        COECondition::CalculateCOEVector(state, Frame::GCRF(), gravitationalParameter_SI);
+
+    EarthOrientation::SetModel(EarthOrientation::Model::Full);
+
+    EXPECT_NE(fullCOEVector, interpolatedCOEVector);
+    EXPECT_EQ(fullCOEVector, COECondition::CalculateCOEVector(state, Frame::GCRF(), gravitationalParameter_SI));
+}
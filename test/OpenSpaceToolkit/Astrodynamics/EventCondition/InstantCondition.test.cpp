@@ -56,6 +56,10 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_EventCondition_InstantCondition, Getters)
     {
         EXPECT_TRUE(defaultCondition_.getInstant() == defaultInstant_);
     }
+
+    {
+        EXPECT_EQ(defaultInstant_, defaultCondition_.getTargetInstant());
+    }
 }
 
 TEST_F(OpenSpaceToolkit_Astrodynamics_EventCondition_InstantCondition, evaluate)
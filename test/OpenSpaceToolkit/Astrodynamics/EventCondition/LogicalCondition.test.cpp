@@ -1,5 +1,8 @@
 /// Apache License 2.0
 
+#include <chrono>
+#include <thread>
+
 #include <gmock/gmock.h>
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
@@ -23,6 +26,7 @@
 using ostk::core::container::Array;
 using ostk::core::type::Real;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 
 using ostk::mathematics::object::VectorXd;
@@ -106,6 +110,35 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_EventCondition_LogicalCondition, UpdateTar
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_EventCondition_LogicalCondition, Clone)
+{
+    {
+        const Shared<RealCondition> durationConditionSPtr = std::make_shared<RealCondition>(
+            RealCondition::DurationCondition(RealCondition::Criterion::AnyCrossing, Duration::Seconds(30.0))
+        );
+
+        const LogicalCondition logicalCondition = LogicalCondition(defaultName_, defaultType_, {durationConditionSPtr});
+
+        const Shared<LogicalCondition> cloneSPtr =
+            std::dynamic_pointer_cast<LogicalCondition>(logicalCondition.clone());
+
+        ASSERT_NE(nullptr, cloneSPtr);
+        EXPECT_EQ(logicalCondition.getType(), cloneSPtr->getType());
+        ASSERT_EQ(1, cloneSPtr->getEventConditions().getSize());
+
+        // Child conditions are cloned, so that their targets are independent
+
+        EXPECT_NE(durationConditionSPtr, cloneSPtr->getEventConditions()[0]);
+
+        cloneSPtr->updateTarget(State(
+            defaultInstant_ + Duration::Seconds(60.0), defaultCoordinates_, defaultFrame_, defaultCoordinateBroker_
+        ));
+
+        EXPECT_EQ(0.0, durationConditionSPtr->getTarget().valueOffset);
+        EXPECT_NE(0.0, cloneSPtr->getEventConditions()[0]->getTarget().valueOffset);
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_EventCondition_LogicalCondition, Print)
 {
     {
@@ -225,3 +258,128 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_EventCondition_LogicalCondition, Or)
         EXPECT_FALSE(logicalCondition.isSatisfied(defaultState_, defaultState_));
     }
 }
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_EventCondition_LogicalCondition, Compile)
+{
+    const auto generateState = [this](const double& aValue) -> State
+    {
+        VectorXd coordinates(1);
+        coordinates << aValue;
+
+        return {
+            defaultInstant_ + Duration::Seconds(aValue),
+            coordinates,
+            defaultFrame_,
+            std::make_shared<CoordinateBroker>(CoordinateBroker({std::make_shared<CoordinateSubset>("X", 1)})),
+        };
+    };
+
+    const auto generateCrossingCondition = [](const Real& aTarget) -> Shared<EventCondition>
+    {
+        return std::make_shared<RealCondition>(
+            "Crossing",
+            RealCondition::Criterion::PositiveCrossing,
+            [](const State& aState) -> Real
+            {
+                return aState.accessCoordinates()[0];
+            },
+            aTarget
+        );
+    };
+
+    const auto generatePositiveCondition = [](const Real& aTarget) -> Shared<EventCondition>
+    {
+        return std::make_shared<RealCondition>(
+            "Positive",
+            RealCondition::Criterion::StrictlyPositive,
+            [](const State& aState) -> Real
+            {
+                return aState.accessCoordinates()[0];
+            },
+            aTarget
+        );
+    };
+
+    // Compilation preserves the outcome of nested conditions
+
+    {
+        const Shared<EventCondition> aboveOneSPtr = generatePositiveCondition(1.0);
+
+        const Array<Shared<EventCondition>> eventConditions = {
+            std::make_shared<LogicalCondition>(
+                "Nested And", LogicalCondition::Type::And, Array<Shared<EventCondition>> {aboveOneSPtr, aboveOneSPtr}
+            ),
+            std::make_shared<LogicalCondition>(
+                "Nested Or",
+                LogicalCondition::Type::Or,
+                Array<Shared<EventCondition>> {generateCrossingCondition(2.5), generatePositiveCondition(4.0)}
+            ),
+            generatePositiveCondition(-1.0),
+        };
+
+        const LogicalCondition referenceLogicalCondition = {defaultName_, LogicalCondition::Type::And, eventConditions};
+
+        LogicalCondition logicalCondition = {defaultName_, LogicalCondition::Type::And, eventConditions};
+
+        EXPECT_FALSE(logicalCondition.isCompiled());
+
+        logicalCondition.compile();
+
+        EXPECT_TRUE(logicalCondition.isCompiled());
+        EXPECT_EQ(eventConditions, logicalCondition.getEventConditions());
+
+        for (Size i = 0; i < 100; ++i)
+        {
+            const State previousState = generateState(0.1 * i - 2.0);
+            const State currentState = generateState(0.1 * (i + 1) - 2.0);
+
+            EXPECT_EQ(
+                referenceLogicalCondition.isSatisfied(currentState, previousState),
+                logicalCondition.isSatisfied(currentState, previousState)
+            );
+        }
+
+        const Shared<LogicalCondition> cloneSPtr =
+            std::dynamic_pointer_cast<LogicalCondition>(logicalCondition.clone());
+
+        EXPECT_TRUE(cloneSPtr->isCompiled());
+        EXPECT_EQ(
+            logicalCondition.isSatisfied(generateState(4.5), generateState(4.4)),
+            cloneSPtr->isSatisfied(generateState(4.5), generateState(4.4))
+        );
+    }
+
+    // Costly event conditions are short-circuited once profiled
+
+    {
+        Size costlyEvaluationCount = 0;
+
+        const Shared<EventCondition> costlyConditionSPtr = std::make_shared<BooleanCondition>(
+            "Costly",
+            BooleanCondition::Criterion::StrictlyPositive,
+            [&costlyEvaluationCount](const State& aState) -> bool
+            {
+                ++costlyEvaluationCount;
+
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+
+                return aState.accessCoordinates()[0] > 0.0;
+            }
+        );
+
+        LogicalCondition logicalCondition = {
+            defaultName_, LogicalCondition::Type::And, {costlyConditionSPtr, alwaysFalseBooleanCondition_}
+        };
+
+        logicalCondition.compile();
+
+        for (Size i = 0; i < 40; ++i)
+        {
+            EXPECT_FALSE(logicalCondition.isSatisfied(generateState(2.0 * i + 1.0), generateState(2.0 * i)));
+        }
+
+        // Two evaluations per profiled step, none afterwards
+
+        EXPECT_EQ(32, costlyEvaluationCount);
+    }
+}
@@ -4,6 +4,7 @@
 
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
@@ -21,6 +22,7 @@
 using ostk::core::container::Array;
 using ostk::core::type::Real;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 
 using ostk::mathematics::object::VectorXd;
@@ -29,6 +31,7 @@ using ostk::physics::coordinate::Frame;
 using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 
+using ostk::astrodynamics::EventCondition;
 using ostk::astrodynamics::eventcondition::RealCondition;
 using ostk::astrodynamics::trajectory::State;
 using ostk::astrodynamics::trajectory::state::CoordinateBroker;
@@ -106,6 +109,30 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_EventCondition_RealCondition, Getters)
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_EventCondition_RealCondition, Clone)
+{
+    {
+        const Shared<EventCondition> cloneSPtr = defaultCondition_.clone();
+
+        ASSERT_NE(nullptr, std::dynamic_pointer_cast<RealCondition>(cloneSPtr));
+        EXPECT_EQ(defaultName_, cloneSPtr->getName());
+        EXPECT_EQ(defaultCondition_.getTarget(), cloneSPtr->getTarget());
+        EXPECT_EQ(defaultCondition_.evaluate(generateState(2.0)), cloneSPtr->evaluate(generateState(2.0)));
+    }
+
+    {
+        const RealCondition condition =
+            RealCondition::DurationCondition(RealCondition::Criterion::StrictlyPositive, Duration::Minutes(1.0));
+
+        const Shared<EventCondition> cloneSPtr = condition.clone();
+
+        cloneSPtr->updateTarget(generateState(0.0, Instant::J2000() + Duration::Minutes(1.0)));
+
+        EXPECT_EQ(0.0, condition.getTarget().valueOffset);
+        EXPECT_EQ(60.0, cloneSPtr->getTarget().valueOffset);
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_EventCondition_RealCondition, evaluate)
 {
     {
@@ -194,6 +221,45 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_EventCondition_RealCondition, isSatisfied)
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_EventCondition_RealCondition, isSatisfied_CachedEvaluation)
+{
+    Size evaluationCount = 0;
+
+    const RealCondition condition = {
+        "name",
+        RealCondition::Criterion::AnyCrossing,
+        [&evaluationCount](const State& aState) -> Real
+        {
+            ++evaluationCount;
+            return aState.accessCoordinates()[0];
+        },
+        defaultTarget_,
+    };
+
+    // Stepping: the previous state is the current state of the previous step
+
+    const Array<State> states = {generateState(0.0), generateState(0.5), generateState(2.0), generateState(3.0)};
+
+    EXPECT_FALSE(condition.isSatisfied(states[1], states[0]));
+    EXPECT_TRUE(condition.isSatisfied(states[2], states[1]));
+    EXPECT_FALSE(condition.isSatisfied(states[3], states[2]));
+
+    EXPECT_EQ(4, evaluationCount);
+
+    // Root finding: the previous state is fixed
+
+    EXPECT_TRUE(condition.isSatisfied(generateState(1.5), states[0]));
+    EXPECT_FALSE(condition.isSatisfied(generateState(0.75), states[0]));
+    EXPECT_TRUE(condition.isSatisfied(generateState(1.25), states[0]));
+
+    EXPECT_EQ(8, evaluationCount);
+
+    // States sharing an instant are told apart by their coordinates
+
+    EXPECT_TRUE(condition.isSatisfied(generateState(2.0, defaultInstant_), generateState(0.0, defaultInstant_)));
+    EXPECT_FALSE(condition.isSatisfied(generateState(3.0, defaultInstant_ + Duration::Seconds(1.0)), states[3]));
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_EventCondition_RealCondition, DurationCondition)
 {
     {
@@ -212,6 +278,16 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_EventCondition_RealCondition, DurationCond
             generateState(0.0, Instant::J2000() + Duration::Minutes(2.1)), generateState(0.0, Instant::J2000())
         ));
     }
+
+    {
+        RealCondition condition =
+            RealCondition::DurationCondition(RealCondition::Criterion::AnyCrossing, Duration::Minutes(1.0));
+
+        condition.updateTarget(generateState(0.0, Instant::J2000() + Duration::Minutes(1.0)));
+
+        EXPECT_EQ(Instant::J2000() + Duration::Minutes(2.0), condition.getTargetInstant());
+        EXPECT_FALSE(defaultCondition_.getTargetInstant().isDefined());
+    }
 }
 
 TEST_F(OpenSpaceToolkit_Astrodynamics_EventCondition_RealCondition, StringFromCriterion)
@@ -0,0 +1,207 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/ExecutionContext.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+using ostk::astrodynamics::ExecutionContext;
+
+class OpenSpaceToolkit_Astrodynamics_ExecutionContext : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        ExecutionContext::SetDefaultThreadCount(0);
+    }
+
+    void TearDown() override
+    {
+        ExecutionContext::SetDefaultThreadCount(0);
+    }
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_ExecutionContext, GetThreadCount)
+{
+    {
+        EXPECT_EQ(4, ExecutionContext(4).getThreadCount());
+        EXPECT_EQ(std::max<Size>(1, std::thread::hardware_concurrency()), ExecutionContext().getThreadCount());
+    }
+
+    {
+        ExecutionContext::SetDefaultThreadCount(3);
+
+        EXPECT_EQ(3, ExecutionContext::GetDefaultThreadCount());
+        EXPECT_EQ(3, ExecutionContext().getThreadCount());
+        EXPECT_EQ(4, ExecutionContext(4).getThreadCount());
+
+        ExecutionContext::SetDefaultThreadCount(0);
+
+        EXPECT_EQ(std::max<Size>(1, std::thread::hardware_concurrency()), ExecutionContext::GetDefaultThreadCount());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_ExecutionContext, ParallelFor)
+{
+    for (const Size threadCount : {1, 2, 4, 16})
+    {
+        const Size taskCount = 1000;
+
+        std::vector<std::atomic<Size>> callCounts(taskCount);
+
+        ExecutionContext(threadCount)
+            .parallelFor(
+                taskCount,
+                [&callCounts](const Index& anIndex) -> void
+                {
+                    ++callCounts[anIndex];
+                }
+            );
+
+        for (const std::atomic<Size>& callCount : callCounts)
+        {
+            EXPECT_EQ(1, callCount.load());
+        }
+    }
+
+    {
+        EXPECT_NO_THROW(ExecutionContext(4).parallelFor(0, [](const Index&) -> void {}));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_ExecutionContext, ParallelFor_TaskFactory)
+{
+    const Size threadCount = 4;
+    const Size taskCount = 100;
+
+    std::atomic<Size> factoryCallCount = {0};
+    std::atomic<Size> taskCallCount = {0};
+
+    ExecutionContext(threadCount)
+        .parallelFor(
+            taskCount,
+            [&]() -> std::function<void(const Index&)>
+            {
+                ++factoryCallCount;
+
+                return [&taskCallCount](const Index&) -> void
+                {
+                    ++taskCallCount;
+                };
+            }
+        );
+
+    EXPECT_EQ(taskCount, taskCallCount.load());
+    EXPECT_LE(1, factoryCallCount.load());
+    EXPECT_GE(threadCount, factoryCallCount.load());
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_ExecutionContext, Map)
+{
+    const auto task = [](const Index& anIndex) -> double
+    {
+        return static_cast<double>(anIndex * anIndex);
+    };
+
+    const Array<double> referenceValues = ExecutionContext(1).map<double>(500, task);
+
+    ASSERT_EQ(500, referenceValues.getSize());
+
+    for (Index index = 0; index < referenceValues.getSize(); ++index)
+    {
+        EXPECT_EQ(static_cast<double>(index * index), referenceValues[index]);
+    }
+
+    for (const Size threadCount : {2, 4, 16})
+    {
+        EXPECT_EQ(referenceValues, ExecutionContext(threadCount).map<double>(500, task));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_ExecutionContext, Exception)
+{
+    for (const Size threadCount : {1, 4})
+    {
+        std::atomic<Size> lowerTaskCallCount = {0};
+
+        try
+        {
+            ExecutionContext(threadCount)
+                .parallelFor(
+                    100,
+                    [&lowerTaskCallCount](const Index& anIndex) -> void
+                    {
+                        if ((anIndex == 20) || (anIndex == 60))
+                        {
+                            throw std::runtime_error(std::to_string(anIndex));
+                        }
+
+                        if (anIndex < 20)
+                        {
+                            ++lowerTaskCallCount;
+                        }
+                    }
+                );
+
+            FAIL();
+        }
+        catch (const std::runtime_error& anError)
+        {
+            EXPECT_EQ(std::string("20"), anError.what());
+        }
+
+        EXPECT_EQ(20, lowerTaskCallCount.load());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_ExecutionContext, Nested)
+{
+    EXPECT_FALSE(ExecutionContext::IsWorkerThread());
+
+    std::atomic<Size> nestedTaskCallCount = {0};
+    std::atomic<bool> nestedOnOtherThread = {false};
+
+    ExecutionContext(4).parallelFor(
+        8,
+        [&](const Index&) -> void
+        {
+            EXPECT_TRUE(ExecutionContext::IsWorkerThread());
+
+            const std::thread::id threadId = std::this_thread::get_id();
+
+            ExecutionContext(4).parallelFor(
+                10,
+                [&](const Index&) -> void
+                {
+                    if (std::this_thread::get_id() != threadId)
+                    {
+                        nestedOnOtherThread = true;
+                    }
+
+                    ++nestedTaskCallCount;
+                }
+            );
+
+            EXPECT_TRUE(ExecutionContext::IsWorkerThread());
+        }
+    );
+
+    EXPECT_EQ(80, nestedTaskCallCount.load());
+    EXPECT_FALSE(nestedOnOtherThread.load());
+
+    EXPECT_FALSE(ExecutionContext::IsWorkerThread());
+}
@@ -11,6 +11,8 @@
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Velocity.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
@@ -20,6 +22,8 @@
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/Tabulated.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Flight/Maneuver.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Flight/System/PropulsionSystem.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/LocalOrbitalFrameFactory.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianVelocity.hpp>
 
@@ -38,6 +42,8 @@ using ostk::mathematics::object::Vector3d;
 using ostk::mathematics::object::VectorXd;
 
 using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Velocity;
 using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 using ostk::physics::time::Interval;
@@ -47,6 +53,8 @@ using ostk::astrodynamics::Dynamics;
 using TabulatedDynamics = ostk::astrodynamics::dynamics::Tabulated;
 using ostk::astrodynamics::flight::Maneuver;
 using ostk::astrodynamics::flight::system::PropulsionSystem;
+using ostk::astrodynamics::trajectory::LocalOrbitalFrameFactory;
+using ostk::astrodynamics::trajectory::State;
 using ostk::astrodynamics::trajectory::state::CoordinateSubset;
 using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianVelocity;
 
@@ -670,3 +678,70 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Flight_Maneuver, ConstantMassFlowRateProfi
         );
     }
 }
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Flight_Maneuver, LocalOrbitalFrameAccelerationProfile)
+{
+    Array<State> states = Array<State>::Empty();
+
+    for (Size i = 0; i < defaultInstants_.getSize(); i++)
+    {
+        const Real angle = 1.0e-3 * (defaultInstants_[i] - defaultInstants_[0]).inSeconds();
+
+        states.add(State(
+            defaultInstants_[i],
+            Position::Meters({7.0e6 * std::cos(angle), 7.0e6 * std::sin(angle), 0.0}, defaultFrameSPtr_),
+            Velocity::MetersPerSecond({-7.0e3 * std::sin(angle), 7.0e3 * std::cos(angle), 0.0}, defaultFrameSPtr_)
+        ));
+    }
+
+    const Shared<const LocalOrbitalFrameFactory> vncFactorySPtr = LocalOrbitalFrameFactory::VNC(defaultFrameSPtr_);
+
+    {
+        const Maneuver maneuver = Maneuver::LocalOrbitalFrameAccelerationProfile(
+            states, defaultAccelerationProfileDefaultFrame_, vncFactorySPtr, defaultMassFlowRateProfile_
+        );
+
+        EXPECT_EQ(maneuver.getInstants(), defaultInstants_);
+        EXPECT_EQ(maneuver.getMassFlowRateProfile(), defaultMassFlowRateProfile_);
+
+        // Accelerations along the velocity, the orbital momentum and the co-normal (here the radial direction)
+
+        const Array<Vector3d> accelerationProfile = maneuver.getAccelerationProfile(defaultFrameSPtr_);
+
+        const Real angle = 1.0e-3 * (defaultInstants_[2] - defaultInstants_[0]).inSeconds();
+
+        EXPECT_TRUE(accelerationProfile[0].isNear(Vector3d {0.0, 1.0e-3, 0.0}, 1e-15));
+        EXPECT_TRUE(accelerationProfile[1].isNear(Vector3d {0.0, 0.0, 1.0e-3}, 1e-15));
+        EXPECT_TRUE(accelerationProfile[2].isNear(Vector3d {std::cos(angle), std::sin(angle), 0.0} * 1.0e-3, 1e-15));
+
+        const Array<Vector3d> accelerationProfileInLocalOrbitalFrame =
+            maneuver.getAccelerationProfileInLocalOrbitalFrame(vncFactorySPtr, states);
+
+        for (Size i = 0; i < defaultInstants_.getSize(); i++)
+        {
+            EXPECT_TRUE(
+                accelerationProfileInLocalOrbitalFrame[i].isNear(defaultAccelerationProfileDefaultFrame_[i], 1e-15)
+            );
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(Maneuver::LocalOrbitalFrameAccelerationProfile(
+            states,
+            defaultAccelerationProfileDefaultFrame_,
+            LocalOrbitalFrameFactory::Undefined(),
+            defaultMassFlowRateProfile_
+        ));
+        EXPECT_ANY_THROW(Maneuver::LocalOrbitalFrameAccelerationProfile(
+            Array<State>(states.begin(), states.begin() + 2),
+            defaultAccelerationProfileDefaultFrame_,
+            vncFactorySPtr,
+            defaultMassFlowRateProfile_
+        ));
+
+        EXPECT_ANY_THROW(defaultManeuver_.getAccelerationProfileInLocalOrbitalFrame(nullptr, states));
+        EXPECT_ANY_THROW(defaultManeuver_.getAccelerationProfileInLocalOrbitalFrame(
+            vncFactorySPtr, Array<State>(states.begin(), states.begin() + 2)
+        ));
+    }
+}
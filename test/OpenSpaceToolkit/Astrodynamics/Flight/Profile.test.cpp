@@ -230,6 +230,58 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Flight_Profile, GetBodyFrame)
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Flight_Profile, Tabulate)
+{
+    {
+        const Instant startInstant = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+
+        const Array<Instant> instants = {
+            startInstant + Duration::Seconds(60.0),
+            startInstant,
+            startInstant + Duration::Seconds(30.0),
+            startInstant + Duration::Seconds(30.0),
+        };
+
+        const Profile tabulatedProfile = profile_.tabulate(instants);
+
+        EXPECT_TRUE(tabulatedProfile.isDefined());
+
+        const Array<Instant> queryInstants = {
+            startInstant,
+            startInstant + Duration::Seconds(30.0),
+            startInstant + Duration::Seconds(45.0),
+            startInstant + Duration::Seconds(60.0),
+        };
+
+        for (const Instant& queryInstant : queryInstants)
+        {
+            const State referenceState = profile_.getStateAt(queryInstant);
+            const State state = tabulatedProfile.getStateAt(queryInstant);
+
+            EXPECT_VECTORS_ALMOST_EQUAL(state.getCoordinates(), referenceState.getCoordinates(), 1e-12);
+            EXPECT_EQ(state.getFrame(), referenceState.getFrame());
+        }
+
+        const Shared<const Frame> referenceBodyFrameSPtr = profile_.getBodyFrame("Reference Body");
+        const Shared<const Frame> tabulatedBodyFrameSPtr = tabulatedProfile.getBodyFrame("Tabulated Body");
+
+        for (const Instant& queryInstant : queryInstants)
+        {
+            const Quaternion referenceOrientation =
+                referenceBodyFrameSPtr->getTransformTo(Frame::GCRF(), queryInstant).getOrientation();
+            const Quaternion orientation =
+                tabulatedBodyFrameSPtr->getTransformTo(Frame::GCRF(), queryInstant).getOrientation();
+
+            EXPECT_TRUE(orientation.isNear(referenceOrientation, Angle::Degrees(1e-9)));
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(Profile::Undefined().tabulate({Instant::J2000()}));
+        EXPECT_ANY_THROW(profile_.tabulate({Instant::Undefined()}));
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Flight_Profile, Undefined)
 {
     {
@@ -7,6 +7,7 @@
 
 using ostk::core::container::Array;
 using ostk::core::container::String;
+using ostk::core::type::Index;
 
 using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
 using ostk::mathematics::object::Vector3d;
@@ -160,6 +161,53 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Flight_Profile_Models_Tabulated, Calculate
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Flight_Profile_Models_Tabulated, CalculateStatesAt)
+{
+    using ostk::physics::time::Duration;
+
+    {
+        const Instant startInstant = states_.accessFirst().accessInstant();
+
+        const Array<Instant> instants = {
+            startInstant + Duration::Seconds(30.0),
+            startInstant + Duration::Seconds(5.0),
+            startInstant,
+            startInstant + Duration::Seconds(15.0),
+            startInstant + Duration::Seconds(20.0),
+        };
+
+        const Array<State> states = tabulated_.calculateStatesAt(instants);
+
+        ASSERT_EQ(states.getSize(), instants.getSize());
+
+        for (Index i = 0; i < instants.getSize(); ++i)
+        {
+            const Tabulated tabulated = {states_};
+            const State expectedState = tabulated.calculateStateAt(instants[i]);
+
+            EXPECT_EQ(states[i].getInstant(), instants[i]);
+            EXPECT_VECTORS_ALMOST_EQUAL(states[i].getCoordinates(), expectedState.getCoordinates(), 1e-12);
+        }
+
+        EXPECT_EQ(states[0], states_.accessLast());
+        EXPECT_EQ(states[2], states_.accessFirst());
+    }
+
+    {
+        const Array<Instant> instants = {
+            states_.accessFirst().accessInstant(),
+            states_.accessLast().accessInstant() + Duration::Seconds(1.0),
+        };
+
+        EXPECT_THROW(tabulated_.calculateStatesAt(instants), ostk::core::error::RuntimeError);
+    }
+
+    {
+        const Tabulated tabulated = {{}};
+        EXPECT_THROW(tabulated.calculateStatesAt({}), ostk::core::error::runtime::Undefined);
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Flight_Profile_Models_Tabulated, getAxesAt)
 {
     // undefined
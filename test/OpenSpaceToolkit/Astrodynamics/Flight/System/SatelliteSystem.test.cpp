@@ -1,5 +1,7 @@
 /// Apache License 2.0
 
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
@@ -15,6 +17,7 @@
 
 #include <Global.test.hpp>
 
+using ostk::core::container::Array;
 using ostk::core::type::Integer;
 using ostk::core::type::Real;
 using ostk::core::type::String;
@@ -536,6 +539,77 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Flight_System_SatelliteSystem, GetPropulsi
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Flight_System_SatelliteSystem, GetProjectedAreaTable)
+{
+    {
+        EXPECT_NE(nullptr, satelliteSystem_.getProjectedAreaTable());
+    }
+
+    {
+        const SatelliteSystem satelliteSystem = satelliteSystem_;
+
+        EXPECT_EQ(satelliteSystem_.getProjectedAreaTable(), satelliteSystem.getProjectedAreaTable());
+    }
+
+    {
+        EXPECT_EQ(nullptr, SatelliteSystem::Undefined().getProjectedAreaTable());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Flight_System_SatelliteSystem, ProjectedAreaTable)
+{
+    {
+        EXPECT_THROW(
+            SatelliteSystem::ProjectedAreaTable(Composite::Undefined()), ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            SatelliteSystem::ProjectedAreaTable(satelliteGeometry_, 0, 37), ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            SatelliteSystem::ProjectedAreaTable(satelliteGeometry_, 72, 1), ostk::core::error::runtime::Wrong
+        );
+    }
+
+    {
+        const SatelliteSystem::ProjectedAreaTable projectedAreaTable = {satelliteGeometry_};
+
+        EXPECT_EQ(72, projectedAreaTable.getAzimuthCount());
+        EXPECT_EQ(37, projectedAreaTable.getElevationCount());
+
+        // Grid nodes are exact
+
+        EXPECT_NEAR(24.0, projectedAreaTable.getProjectedAreaAt({1.0, 0.0, 0.0}), 1e-12);
+        EXPECT_NEAR(24.0, projectedAreaTable.getProjectedAreaAt({-2.0, 0.0, 0.0}), 1e-12);
+        EXPECT_NEAR(12.0, projectedAreaTable.getProjectedAreaAt({0.0, 1.0, 0.0}), 1e-12);
+        EXPECT_NEAR(12.0, projectedAreaTable.getProjectedAreaAt({0.0, -1.0, 0.0}), 1e-12);
+        EXPECT_NEAR(8.0, projectedAreaTable.getProjectedAreaAt({0.0, 0.0, 1.0}), 1e-12);
+        EXPECT_NEAR(8.0, projectedAreaTable.getProjectedAreaAt({0.0, 0.0, -1.0}), 1e-12);
+
+        // Off-grid directions are interpolated
+
+        for (const Vector3d& direction : Array<Vector3d> {
+                 {1.0, 1.0, 0.1},
+                 {-0.3, 0.7, 0.5},
+                 {0.2, -0.9, -0.4},
+                 {1.0, -0.01, 0.0},
+             })
+        {
+            EXPECT_NEAR(
+                SatelliteSystem::ProjectedAreaTable::ComputeProjectedArea(satelliteGeometry_, direction.normalized()),
+                projectedAreaTable.getProjectedAreaAt(direction),
+                0.1
+            );
+        }
+
+        EXPECT_THROW(projectedAreaTable.getProjectedAreaAt({0.0, 0.0, 0.0}), ostk::core::error::runtime::Wrong);
+    }
+
+    {
+        EXPECT_TRUE(SatelliteSystem::ProjectedAreaTable::IsSupported(satelliteGeometry_));
+        EXPECT_FALSE(SatelliteSystem::ProjectedAreaTable::IsSupported(Composite::Undefined()));
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Flight_System_SatelliteSystem, Undefined)
 {
     {
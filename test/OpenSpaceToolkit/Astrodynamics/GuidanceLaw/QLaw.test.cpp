@@ -11,10 +11,12 @@
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/CentralBodyGravity.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/PositionDerivative.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/Thruster.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/EventCondition/RealCondition.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Flight/System/PropulsionSystem.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Flight/System/SatelliteSystem.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/GuidanceLaw/QLaw.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Segment.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianPosition.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianVelocity.hpp>
@@ -39,6 +41,7 @@ using ostk::mathematics::geometry::d3::object::Cuboid;
 using ostk::mathematics::geometry::d3::object::Point;
 
 using ostk::physics::coordinate::Frame;
+using ostk::physics::environment::object::Celestial;
 using ostk::physics::environment::object::celestial::Earth;
 using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
@@ -52,11 +55,14 @@ using ostk::astrodynamics::Dynamics;
 using ostk::astrodynamics::dynamics::CentralBodyGravity;
 using ostk::astrodynamics::dynamics::PositionDerivative;
 using ostk::astrodynamics::dynamics::Thruster;
+using ostk::astrodynamics::eventcondition::RealCondition;
+using ostk::astrodynamics::ExecutionContext;
 using ostk::astrodynamics::flight::system::PropulsionSystem;
 using ostk::astrodynamics::flight::system::SatelliteSystem;
 using ostk::astrodynamics::guidancelaw::QLaw;
 using ostk::astrodynamics::trajectory::orbit::model::kepler::COE;
 using ostk::astrodynamics::trajectory::Propagator;
+using ostk::astrodynamics::trajectory::Segment;
 using ostk::astrodynamics::trajectory::State;
 using ostk::astrodynamics::trajectory::state::CoordinateBroker;
 using ostk::astrodynamics::trajectory::state::CoordinateSubset;
@@ -180,6 +186,19 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_Thruster_GuidanceLaw_QLaw, Constr
     EXPECT_NO_THROW(QLaw qlaw(targetCOE_, gravitationalParameter_, parameters_));
 
     EXPECT_THROW(QLaw qlaw(targetCOE_, gravitationalParameter_, {{}}), ostk::core::error::RuntimeError);
+
+    EXPECT_THROW(
+        QLaw qlaw(targetCOE_, gravitationalParameter_, parameters_, gradientStrategy_, Duration::Seconds(-1.0)),
+        ostk::core::error::RuntimeError
+    );
+    EXPECT_THROW(
+        QLaw qlaw(targetCOE_, gravitationalParameter_, parameters_, gradientStrategy_, Duration::Undefined()),
+        ostk::core::error::RuntimeError
+    );
+    EXPECT_THROW(
+        QLaw qlaw(targetCOE_, gravitationalParameter_, parameters_, gradientStrategy_, Duration::Zero(), -1.0),
+        ostk::core::error::RuntimeError
+    );
 }
 
 TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_Thruster_GuidanceLaw_QLaw, GetParameters)
@@ -197,6 +216,19 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_Thruster_GuidanceLaw_QLaw, GetGra
     EXPECT_EQ(qlaw_.getGradientStrategy(), gradientStrategy_);
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_Thruster_GuidanceLaw_QLaw, GetDirectionUpdateInterval)
+{
+    EXPECT_EQ(qlaw_.getDirectionUpdateInterval(), Duration::Zero());
+    EXPECT_FALSE(qlaw_.getDirectionUpdateThreshold().isDefined());
+
+    const QLaw qlaw = {
+        targetCOE_, gravitationalParameter_, parameters_, gradientStrategy_, Duration::Minutes(1.0), 1e-3
+    };
+
+    EXPECT_EQ(qlaw.getDirectionUpdateInterval(), Duration::Minutes(1.0));
+    EXPECT_EQ(qlaw.getDirectionUpdateThreshold(), 1e-3);
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_Thruster_GuidanceLaw_QLaw, ComputeOrbitalElementsMaximalChange)
 {
     {
@@ -487,6 +519,31 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_Thruster_GuidanceLaw_QLaw, Comput
             EXPECT_LT(relativeError, 1e-5);
         }
     }
+
+    {
+        const Tuple<QLaw, Vector6d, Real> parameters =
+            getQLawFullTargeting(QLaw::GradientStrategy::AutomaticDifferentiation);
+        const QLaw qlaw = std::get<0>(parameters);
+        const Vector6d currentCOEVector = std::get<1>(parameters);
+        const Real thrustAcceleration = std::get<2>(parameters);
+
+        const Vector5d dQ_dOE = qlaw.compute_dQ_dOE(currentCOEVector.segment(0, 5), thrustAcceleration);
+
+        // calculated analtyically by using sympy
+        const Vector5d expected_dQ_dOE = {
+            -4451831.72900846,
+            304679993012117.0,
+            478538188797579.0,
+            -99677391.4654718,
+            1306605416901.52,
+        };
+
+        for (Size i = 0; i < 5; ++i)
+        {
+            const double relativeError = std::abs((dQ_dOE(i) - expected_dQ_dOE(i)) / expected_dQ_dOE(i));
+            EXPECT_LT(relativeError, 1e-6);
+        }
+    }
 }
 
 TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_Thruster_GuidanceLaw_QLaw, CalculateThrustAccelerationAt)
@@ -582,3 +639,349 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_Thruster_GuidanceLaw_QLaw, Calcul
         }
     }
 }
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_Thruster_GuidanceLaw_QLaw, CalculateThrustAccelerationAt_HeldDirection)
+{
+    const Vector3d positionCoordinates = initialState_.getPosition().getCoordinates();
+    const Vector3d velocityCoordinates = initialState_.getVelocity().getCoordinates();
+
+    // Further along the same orbit
+
+    const COE laterCOE = {
+        Length::Meters(7000.0e3),
+        0.01,
+        Angle::Degrees(0.05),
+        Angle::Degrees(0.0),
+        Angle::Degrees(0.0),
+        Angle::Degrees(0.6),
+    };
+
+    const COE::CartesianState laterCartesianState = laterCOE.getCartesianState(gravitationalParameter_, Frame::GCRF());
+
+    const Instant laterInstant = initialState_.accessInstant() + Duration::Seconds(10.0);
+    const Vector3d laterPositionCoordinates = laterCartesianState.first.getCoordinates();
+    const Vector3d laterVelocityCoordinates = laterCartesianState.second.getCoordinates();
+
+    const Vector3d referenceAcceleration = qlaw_.calculateThrustAccelerationAt(
+        laterInstant, laterPositionCoordinates, laterVelocityCoordinates, thrustAcceleration_, Frame::GCRF()
+    );
+
+    // On another orbit
+
+    const Vector3d perturbedPositionCoordinates = positionCoordinates + 10.0 * velocityCoordinates;
+    const Vector3d perturbedVelocityCoordinates = velocityCoordinates * 1.001;
+
+    const Vector3d perturbedReferenceAcceleration = qlaw_.calculateThrustAccelerationAt(
+        laterInstant, perturbedPositionCoordinates, perturbedVelocityCoordinates, thrustAcceleration_, Frame::GCRF()
+    );
+
+    // Held in the theta-R-H frame within the update interval
+
+    {
+        const QLaw qlaw = {targetCOE_, gravitationalParameter_, parameters_, gradientStrategy_, Duration::Minutes(1.0)};
+
+        const Vector3d acceleration = qlaw.calculateThrustAccelerationAt(
+            initialState_.accessInstant(), positionCoordinates, velocityCoordinates, thrustAcceleration_, Frame::GCRF()
+        );
+
+        const Matrix3d R_thetaRH_GCRF = QLaw::ThetaRHToGCRF(positionCoordinates, velocityCoordinates);
+        const Vector3d heldDirection = R_thetaRH_GCRF.transpose() * acceleration / thrustAcceleration_;
+
+        const Vector3d laterAcceleration = qlaw.calculateThrustAccelerationAt(
+            laterInstant, laterPositionCoordinates, laterVelocityCoordinates, thrustAcceleration_, Frame::GCRF()
+        );
+
+        EXPECT_TRUE(laterAcceleration.isNear(
+            thrustAcceleration_ * QLaw::ThetaRHToGCRF(laterPositionCoordinates, laterVelocityCoordinates) *
+                heldDirection,
+            1e-15
+        ));
+        EXPECT_FALSE(laterAcceleration.isNear(referenceAcceleration, 1e-12));
+
+        // Recomputed once the update interval has elapsed
+
+        const Vector3d updatedAcceleration = qlaw.calculateThrustAccelerationAt(
+            laterInstant + Duration::Minutes(1.0),
+            laterPositionCoordinates,
+            laterVelocityCoordinates,
+            thrustAcceleration_,
+            Frame::GCRF()
+        );
+
+        EXPECT_TRUE(updatedAcceleration.isNear(referenceAcceleration, 1e-15));
+    }
+
+    // Recomputed when the orbital elements move beyond the threshold, which defaults to 1e-3 with an interval only
+
+    {
+        const Array<QLaw> qlaws = {
+            {targetCOE_, gravitationalParameter_, parameters_, gradientStrategy_, Duration::Minutes(1.0), 1e-6},
+            {targetCOE_, gravitationalParameter_, parameters_, gradientStrategy_, Duration::Minutes(1.0)},
+        };
+
+        for (const QLaw& qlaw : qlaws)
+        {
+            qlaw.calculateThrustAccelerationAt(
+                initialState_.accessInstant(),
+                positionCoordinates,
+                velocityCoordinates,
+                thrustAcceleration_,
+                Frame::GCRF()
+            );
+
+            const Vector3d perturbedAcceleration = qlaw.calculateThrustAccelerationAt(
+                laterInstant,
+                perturbedPositionCoordinates,
+                perturbedVelocityCoordinates,
+                thrustAcceleration_,
+                Frame::GCRF()
+            );
+
+            EXPECT_TRUE(perturbedAcceleration.isNear(perturbedReferenceAcceleration, 1e-15));
+        }
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_Thruster_GuidanceLaw_QLaw, HeldDirection_Propagations)
+{
+    const SatelliteSystem satelliteSystem = SatelliteSystem::Default();
+
+    const Shared<RealCondition> eventConditionSPtr = std::make_shared<RealCondition>(
+        RealCondition::DurationCondition(RealCondition::Criterion::AnyCrossing, Duration::Minutes(5.0))
+    );
+
+    const Array<Shared<Dynamics>> dynamics = {
+        std::make_shared<PositionDerivative>(),
+        std::make_shared<CentralBodyGravity>(std::make_shared<Celestial>(Earth::Spherical())),
+    };
+
+    const NumericalSolver numericalSolver = {
+        NumericalSolver::LogType::NoLog,
+        NumericalSolver::StepperType::RungeKuttaDopri5,
+        5.0,
+        1.0e-12,
+        1.0e-12,
+    };
+
+    const auto solve = [&satelliteSystem, &eventConditionSPtr, &dynamics, &numericalSolver](
+                           const Shared<QLaw>& aQLawSPtr, const State& anInitialState
+                       ) -> State
+    {
+        const Segment segment = Segment::Maneuver(
+            "QLaw",
+            eventConditionSPtr->clone(),
+            std::make_shared<Thruster>(satelliteSystem, aQLawSPtr),
+            dynamics,
+            numericalSolver
+        );
+
+        return segment.solve(anInitialState, Duration::Days(1.0)).states.accessLast();
+    };
+
+    const auto makeInitialState = [this](const Length& aSemiMajorAxis) -> State
+    {
+        const COE coe = {
+            aSemiMajorAxis,
+            0.01,
+            Angle::Degrees(0.05),
+            Angle::Degrees(0.0),
+            Angle::Degrees(0.0),
+            Angle::Degrees(0.0),
+        };
+
+        const COE::CartesianState cartesianState = coe.getCartesianState(gravitationalParameter_, Frame::GCRF());
+
+        VectorXd coordinates(7);
+        coordinates << cartesianState.first.getCoordinates(), cartesianState.second.getCoordinates(), 200.0;
+
+        return {
+            initialState_.accessInstant(),
+            coordinates,
+            Frame::GCRF(),
+            {CartesianPosition::Default(), CartesianVelocity::Default(), CoordinateSubset::Mass()}
+        };
+    };
+
+    const State firstInitialState = makeInitialState(Length::Meters(7000.0e3));
+    const State secondInitialState = makeInitialState(Length::Meters(7100.0e3));
+
+    const auto makeQLaw = [this]() -> Shared<QLaw>
+    {
+        return std::make_shared<QLaw>(
+            targetCOE_, gravitationalParameter_, parameters_, gradientStrategy_, Duration::Minutes(10.0)
+        );
+    };
+
+    // Back-to-back propagations within one update interval, from different states, with one guidance law
+
+    const Shared<QLaw> qlawSPtr = makeQLaw();
+
+    const State firstState = solve(qlawSPtr, firstInitialState);
+    const State secondState = solve(qlawSPtr, secondInitialState);
+
+    // The second propagation does not reuse the direction held by the first one
+
+    EXPECT_EQ(solve(makeQLaw(), firstInitialState).getCoordinates(), firstState.getCoordinates());
+    EXPECT_EQ(solve(makeQLaw(), secondInitialState).getCoordinates(), secondState.getCoordinates());
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Dynamics_Thruster_GuidanceLaw_QLaw, Sweep)
+{
+    VectorXd coordinates(7);
+    coordinates << initialState_.getPosition().getCoordinates(), initialState_.getVelocity().getCoordinates(), 200.0;
+
+    const State initialState = {
+        initialState_.accessInstant(),
+        coordinates,
+        Frame::GCRF(),
+        {CartesianPosition::Default(), CartesianVelocity::Default(), CoordinateSubset::Mass()}
+    };
+
+    const SatelliteSystem satelliteSystem = SatelliteSystem::Default();
+
+    const Shared<RealCondition> eventConditionSPtr = std::make_shared<RealCondition>(
+        RealCondition::DurationCondition(RealCondition::Criterion::AnyCrossing, Duration::Minutes(10.0))
+    );
+
+    const Array<Shared<Dynamics>> dynamics = {
+        std::make_shared<PositionDerivative>(),
+        std::make_shared<CentralBodyGravity>(std::make_shared<Celestial>(Earth::Spherical())),
+    };
+
+    const NumericalSolver numericalSolver = {
+        NumericalSolver::LogType::NoLog,
+        NumericalSolver::StepperType::RungeKuttaDopri5,
+        5.0,
+        1.0e-12,
+        1.0e-12,
+    };
+
+    const QLaw::Parameters alternativeParameters = {
+        {
+            {COE::Element::SemiMajorAxis, {1.0, 100.0}},
+            {COE::Element::Eccentricity, {2.0, 1e-3}},
+        },
+        3,
+        4,
+        2,
+        0.01,
+        100,
+        1.0,
+        Length::Kilometers(6578.0),
+    };
+
+    const Array<QLaw::Parameters> parametersArray = {parameters_, alternativeParameters, parameters_};
+
+    {
+        const Array<QLaw::SweepResult> results = QLaw::Sweep(
+            targetCOE_,
+            gravitationalParameter_,
+            Array<QLaw::Parameters>::Empty(),
+            initialState,
+            satelliteSystem,
+            eventConditionSPtr,
+            dynamics,
+            numericalSolver
+        );
+
+        EXPECT_TRUE(results.isEmpty());
+    }
+
+    {
+        EXPECT_THROW(
+            QLaw::Sweep(
+                targetCOE_,
+                gravitationalParameter_,
+                parametersArray,
+                State::Undefined(),
+                satelliteSystem,
+                eventConditionSPtr,
+                dynamics,
+                numericalSolver
+            ),
+            ostk::core::error::runtime::Undefined
+        );
+
+        EXPECT_THROW(
+            QLaw::Sweep(
+                targetCOE_,
+                gravitationalParameter_,
+                parametersArray,
+                initialState,
+                satelliteSystem,
+                nullptr,
+                dynamics,
+                numericalSolver
+            ),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+
+    {
+        const Array<QLaw::SweepResult> results = QLaw::Sweep(
+            targetCOE_,
+            gravitationalParameter_,
+            parametersArray,
+            initialState,
+            satelliteSystem,
+            eventConditionSPtr,
+            dynamics,
+            numericalSolver,
+            Duration::Days(1.0),
+            gradientStrategy_,
+            2
+        );
+
+        ASSERT_EQ(results.getSize(), parametersArray.getSize());
+
+        for (Size i = 0; i < parametersArray.getSize(); ++i)
+        {
+            const Segment segment = Segment::Maneuver(
+                "QLaw",
+                eventConditionSPtr->clone(),
+                std::make_shared<Thruster>(
+                    satelliteSystem,
+                    std::make_shared<QLaw>(targetCOE_, gravitationalParameter_, parametersArray[i], gradientStrategy_)
+                ),
+                dynamics,
+                numericalSolver
+            );
+
+            const Segment::Solution solution = segment.solve(initialState, Duration::Days(1.0));
+
+            EXPECT_TRUE(results[i].conditionIsSatisfied);
+            EXPECT_EQ(results[i].timeOfFlight, solution.getPropagationDuration());
+            EXPECT_NEAR(
+                results[i].deltaV,
+                solution.computeDeltaV(satelliteSystem.getPropulsionSystem().getSpecificImpulse()),
+                1e-12
+            );
+        }
+
+        EXPECT_EQ(results[0].timeOfFlight, results[2].timeOfFlight);
+        EXPECT_EQ(results[0].deltaV, results[2].deltaV);
+
+        const Array<QLaw::SweepResult> executionContextResults = QLaw::Sweep(
+            targetCOE_,
+            gravitationalParameter_,
+            parametersArray,
+            initialState,
+            satelliteSystem,
+            eventConditionSPtr,
+            dynamics,
+            numericalSolver,
+            Duration::Days(1.0),
+            gradientStrategy_,
+            ExecutionContext(3)
+        );
+
+        ASSERT_EQ(results.getSize(), executionContextResults.getSize());
+
+        for (Size i = 0; i < results.getSize(); ++i)
+        {
+            EXPECT_EQ(results[i].conditionIsSatisfied, executionContextResults[i].conditionIsSatisfied);
+            EXPECT_EQ(results[i].timeOfFlight, executionContextResults[i].timeOfFlight);
+            EXPECT_EQ(results[i].deltaV, executionContextResults[i].deltaV);
+        }
+    }
+}
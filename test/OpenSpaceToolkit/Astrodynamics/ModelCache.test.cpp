@@ -0,0 +1,179 @@
+/// Apache License 2.0
+
+#include <thread>
+#include <vector>
+
+#include <OpenSpaceToolkit/Core/Type/Integer.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/ModelCache.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Integer;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::physics::environment::object::Celestial;
+using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
+using EarthMagneticModel = ostk::physics::environment::magnetic::Earth;
+using EarthAtmosphericModel = ostk::physics::environment::atmospheric::Earth;
+
+using ostk::astrodynamics::ModelCache;
+
+class OpenSpaceToolkit_Astrodynamics_ModelCache : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        ModelCache::Clear();
+    }
+
+    void TearDown() override
+    {
+        ModelCache::Clear();
+    }
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_ModelCache, AccessEarthGravitationalModel)
+{
+    {
+        EXPECT_EQ(0, ModelCache::GetSize());
+
+        const Shared<EarthGravitationalModel> modelSPtr =
+            ModelCache::AccessEarthGravitationalModel(EarthGravitationalModel::Type::Spherical);
+
+        EXPECT_NE(nullptr, modelSPtr);
+        EXPECT_EQ(1, ModelCache::GetSize());
+
+        EXPECT_EQ(modelSPtr, ModelCache::AccessEarthGravitationalModel(EarthGravitationalModel::Type::Spherical));
+        EXPECT_EQ(1, ModelCache::GetSize());
+    }
+
+    {
+        const Shared<EarthGravitationalModel> modelSPtr =
+            ModelCache::AccessEarthGravitationalModel(EarthGravitationalModel::Type::EGM96, 10, 10);
+
+        EXPECT_EQ(modelSPtr, ModelCache::AccessEarthGravitationalModel(EarthGravitationalModel::Type::EGM96, 10, 10));
+        EXPECT_NE(modelSPtr, ModelCache::AccessEarthGravitationalModel(EarthGravitationalModel::Type::EGM96, 20, 20));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_ModelCache, AccessEarthMagneticModel)
+{
+    {
+        const Shared<EarthMagneticModel> modelSPtr =
+            ModelCache::AccessEarthMagneticModel(EarthMagneticModel::Type::Undefined);
+
+        EXPECT_NE(nullptr, modelSPtr);
+        EXPECT_EQ(modelSPtr, ModelCache::AccessEarthMagneticModel(EarthMagneticModel::Type::Undefined));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_ModelCache, AccessEarthAtmosphericModel)
+{
+    {
+        const Shared<EarthAtmosphericModel> modelSPtr =
+            ModelCache::AccessEarthAtmosphericModel(EarthAtmosphericModel::Type::Exponential);
+
+        EXPECT_NE(nullptr, modelSPtr);
+        EXPECT_EQ(modelSPtr, ModelCache::AccessEarthAtmosphericModel(EarthAtmosphericModel::Type::Exponential));
+        EXPECT_NE(modelSPtr, ModelCache::AccessEarthAtmosphericModel(EarthAtmosphericModel::Type::Undefined));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_ModelCache, AccessEarth)
+{
+    {
+        const Shared<Celestial> earthSPtr = ModelCache::AccessEarth(
+            EarthGravitationalModel::Type::Spherical,
+            Integer::Undefined(),
+            Integer::Undefined(),
+            EarthMagneticModel::Type::Undefined,
+            EarthAtmosphericModel::Type::Exponential
+        );
+
+        EXPECT_NE(nullptr, earthSPtr);
+        EXPECT_EQ("Earth", earthSPtr->getName());
+        EXPECT_TRUE(earthSPtr->gravitationalModelIsDefined());
+        EXPECT_TRUE(earthSPtr->atmosphericModelIsDefined());
+
+        // The Earth and its three models are cached
+
+        EXPECT_EQ(4, ModelCache::GetSize());
+
+        EXPECT_EQ(
+            earthSPtr,
+            ModelCache::AccessEarth(
+                EarthGravitationalModel::Type::Spherical,
+                Integer::Undefined(),
+                Integer::Undefined(),
+                EarthMagneticModel::Type::Undefined,
+                EarthAtmosphericModel::Type::Exponential
+            )
+        );
+
+        // Models are shared with Earth objects built from other model combinations
+
+        const Shared<Celestial> otherEarthSPtr = ModelCache::AccessEarth(EarthGravitationalModel::Type::Spherical);
+
+        EXPECT_NE(earthSPtr, otherEarthSPtr);
+        EXPECT_FALSE(otherEarthSPtr->atmosphericModelIsDefined());
+        EXPECT_EQ(6, ModelCache::GetSize());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_ModelCache, Clear)
+{
+    {
+        const Shared<EarthGravitationalModel> modelSPtr =
+            ModelCache::AccessEarthGravitationalModel(EarthGravitationalModel::Type::Spherical);
+
+        ModelCache::Clear();
+
+        EXPECT_EQ(0, ModelCache::GetSize());
+
+        // Models handed out beforehand remain valid
+
+        EXPECT_NE(nullptr, modelSPtr);
+        EXPECT_NE(modelSPtr, ModelCache::AccessEarthGravitationalModel(EarthGravitationalModel::Type::Spherical));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_ModelCache, ConcurrentAccess)
+{
+    {
+        const Size threadCount = 8;
+
+        std::vector<Shared<EarthGravitationalModel>> modelSPtrs(threadCount, nullptr);
+
+        std::vector<std::thread> threads;
+
+        for (Size threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            threads.emplace_back(
+                [&modelSPtrs, threadIndex]() -> void
+                {
+                    modelSPtrs[threadIndex] =
+                        ModelCache::AccessEarthGravitationalModel(EarthGravitationalModel::Type::EGM96, 10, 10);
+                }
+            );
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (const Shared<EarthGravitationalModel>& modelSPtr : modelSPtrs)
+        {
+            EXPECT_NE(nullptr, modelSPtr);
+            EXPECT_EQ(modelSPtrs[0], modelSPtr);
+        }
+
+        EXPECT_EQ(1, ModelCache::GetSize());
+    }
+}
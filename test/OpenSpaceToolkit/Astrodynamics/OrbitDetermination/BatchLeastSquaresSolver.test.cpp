@@ -0,0 +1,267 @@
+/// Apache License 2.0
+
+#include <cmath>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Velocity.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/CentralBodyGravity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/PositionDerivative.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/ExecutionContext.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/OrbitDetermination/BatchLeastSquaresSolver.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/OrbitDetermination/Measurement.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/NumericalSolver.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::VectorXd;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Velocity;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::environment::object::celestial::Earth;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+using ostk::physics::unit::Length;
+
+using ostk::astrodynamics::Dynamics;
+using ostk::astrodynamics::dynamics::CentralBodyGravity;
+using ostk::astrodynamics::dynamics::PositionDerivative;
+using ostk::astrodynamics::ExecutionContext;
+using ostk::astrodynamics::orbitdetermination::BatchLeastSquaresSolver;
+using ostk::astrodynamics::orbitdetermination::Measurement;
+using ostk::astrodynamics::Trajectory;
+using ostk::astrodynamics::trajectory::Propagator;
+using ostk::astrodynamics::trajectory::State;
+using ostk::astrodynamics::trajectory::state::NumericalSolver;
+
+class OpenSpaceToolkit_Astrodynamics_OrbitDetermination_BatchLeastSquaresSolver : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        const Shared<Celestial> earthSPtr = std::make_shared<Celestial>(Earth::Spherical());
+
+        const Array<Shared<Dynamics>> dynamics = {
+            std::make_shared<PositionDerivative>(),
+            std::make_shared<CentralBodyGravity>(earthSPtr),
+        };
+
+        this->propagator_ = {this->numericalSolver_, dynamics};
+
+        this->solver_ = std::make_shared<BatchLeastSquaresSolver>(this->propagator_);
+
+        // Range, range rate and angles from three ground stations, every 5 minutes over 3 hours, with a deterministic
+        // noise of the order of the standard deviations
+
+        const Array<Shared<const Trajectory>> stations = {
+            std::make_shared<Trajectory>(Trajectory::Position(Position::Meters({6378137.0, 0.0, 0.0}, Frame::ITRF()))),
+            std::make_shared<Trajectory>(Trajectory::Position(Position::Meters({0.0, 6378137.0, 0.0}, Frame::ITRF()))),
+            std::make_shared<Trajectory>(
+                Trajectory::Position(Position::Meters({4500000.0, 0.0, 4500000.0}, Frame::ITRF()))
+            ),
+        };
+
+        const Array<Measurement::Type> types = {
+            Measurement::Type::Range,
+            Measurement::Type::RangeRate,
+            Measurement::Type::Angles,
+        };
+
+        const Array<double> standardDeviations = {1.0, 1.0e-3, 1.0e-6};
+
+        Array<Instant> instants = Array<Instant>::Empty();
+
+        for (Index k = 0; k <= 36; ++k)
+        {
+            instants.add(this->epoch_ + Duration::Minutes(5.0 * k));
+        }
+
+        const Array<State> truthStates = this->propagator_.calculateStatesAt(this->truthState_, instants);
+
+        Index noiseIndex = 0;
+
+        for (Index k = 0; k < instants.getSize(); ++k)
+        {
+            for (Index i = 0; i < stations.getSize(); ++i)
+            {
+                const Size size = Measurement::SizeFromType(types[i]);
+
+                const Measurement modeledMeasurement = {
+                    instants[k],
+                    types[i],
+                    VectorXd::Zero(size),
+                    VectorXd::Constant(size, standardDeviations[i]),
+                    stations[i],
+                };
+
+                VectorXd value = modeledMeasurement.calculateValue(truthStates[k]);
+
+                for (Index j = 0; j < size; ++j)
+                {
+                    value(j) += standardDeviations[i] * std::sin(1.7 * noiseIndex++);
+                }
+
+                this->measurements_.add(
+                    {instants[k], types[i], value, VectorXd::Constant(size, standardDeviations[i]), stations[i]}
+                );
+            }
+        }
+
+        this->initialGuessState_ = {
+            this->epoch_,
+            Position::Meters({7001000.0, 0.0, 0.0}, Frame::GCRF()),
+            Velocity::MetersPerSecond({0.0, 5336.865450622126, 5335.865450622126}, Frame::GCRF()),
+        };
+    }
+
+    const NumericalSolver numericalSolver_ = {
+        NumericalSolver::LogType::NoLog,
+        NumericalSolver::StepperType::RungeKuttaFehlberg78,
+        5.0,
+        1.0e-12,
+        1.0e-12,
+    };
+
+    const Instant epoch_ = Instant::DateTime(DateTime(2024, 1, 1, 0, 0, 0), Scale::UTC);
+
+    const State truthState_ = {
+        epoch_,
+        Position::Meters({7000000.0, 0.0, 0.0}, Frame::GCRF()),
+        Velocity::MetersPerSecond({0.0, 5335.865450622126, 5335.865450622126}, Frame::GCRF()),
+    };
+
+    Propagator propagator_ = Propagator::Undefined();
+    Shared<BatchLeastSquaresSolver> solver_ = nullptr;
+    Array<Measurement> measurements_ = Array<Measurement>::Empty();
+    State initialGuessState_ = State::Undefined();
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_OrbitDetermination_BatchLeastSquaresSolver, Constructor)
+{
+    {
+        EXPECT_NO_THROW(BatchLeastSquaresSolver(propagator_, 10, 1e-8));
+    }
+
+    {
+        EXPECT_THROW(BatchLeastSquaresSolver(Propagator::Undefined()), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(BatchLeastSquaresSolver(propagator_, 0), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(BatchLeastSquaresSolver(propagator_, 10, 0.0), ostk::core::error::runtime::Wrong);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_OrbitDetermination_BatchLeastSquaresSolver, StreamOperator)
+{
+    {
+        testing::internal::CaptureStdout();
+
+        EXPECT_NO_THROW(std::cout << *solver_ << std::endl);
+
+        EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_OrbitDetermination_BatchLeastSquaresSolver, Getters)
+{
+    {
+        EXPECT_EQ(propagator_, solver_->accessPropagator());
+        EXPECT_EQ(20, solver_->getMaximumIterationCount());
+        EXPECT_EQ(1e-6, solver_->getRelativeTolerance());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_OrbitDetermination_BatchLeastSquaresSolver, Solve)
+{
+    {
+        const BatchLeastSquaresSolver::Analysis analysis = solver_->solve(initialGuessState_, measurements_);
+
+        EXPECT_TRUE(analysis.hasConverged);
+        EXPECT_GE(10, analysis.iterationCount);
+
+        EXPECT_EQ(epoch_, analysis.estimatedState.accessInstant());
+        EXPECT_EQ(Frame::GCRF(), analysis.estimatedState.accessFrame());
+
+        EXPECT_GT(
+            2.0,
+            (analysis.estimatedState.getPosition().getCoordinates() - truthState_.getPosition().getCoordinates()).norm()
+        );
+        EXPECT_GT(
+            1.0e-2,
+            (analysis.estimatedState.getVelocity().getCoordinates() - truthState_.getVelocity().getCoordinates()).norm()
+        );
+
+        EXPECT_LT(0.3, analysis.rmsWeightedResidual);
+        EXPECT_GT(1.0, analysis.rmsWeightedResidual);
+
+        ASSERT_EQ(measurements_.getSize(), analysis.residuals.getSize());
+
+        for (Index k = 0; k < measurements_.getSize(); ++k)
+        {
+            EXPECT_EQ(Eigen::Index(measurements_[k].getSize()), analysis.residuals[k].size());
+        }
+
+        ASSERT_EQ(6, analysis.covariance.rows());
+        ASSERT_EQ(6, analysis.covariance.cols());
+
+        EXPECT_TRUE(analysis.covariance.isApprox(analysis.covariance.transpose()));
+        EXPECT_TRUE((analysis.covariance.diagonal().array() > 0.0).all());
+
+        // Parallel evaluation of the measurements does not change the solution
+
+        const BatchLeastSquaresSolver::Analysis serialAnalysis =
+            solver_->solve(initialGuessState_, measurements_, ExecutionContext(1));
+
+        EXPECT_EQ(analysis.iterationCount, serialAnalysis.iterationCount);
+        EXPECT_EQ(analysis.estimatedState.getCoordinates(), serialAnalysis.estimatedState.getCoordinates());
+        EXPECT_EQ(analysis.covariance, serialAnalysis.covariance);
+    }
+
+    {
+        const BatchLeastSquaresSolver::Analysis analysis =
+            BatchLeastSquaresSolver(propagator_, 1).solve(initialGuessState_, measurements_);
+
+        EXPECT_FALSE(analysis.hasConverged);
+        EXPECT_EQ(1, analysis.iterationCount);
+        EXPECT_EQ(initialGuessState_.getCoordinates(), analysis.estimatedState.getCoordinates());
+    }
+
+    {
+        EXPECT_THROW(solver_->solve(State::Undefined(), measurements_), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(
+            solver_->solve(initialGuessState_, {measurements_[0], Measurement::Undefined()}),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            solver_->solve(initialGuessState_, {measurements_[0], measurements_[1], measurements_[2]}),
+            ostk::core::error::RuntimeError
+        );
+    }
+}
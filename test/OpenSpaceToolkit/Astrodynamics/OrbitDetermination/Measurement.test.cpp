@@ -0,0 +1,377 @@
+/// Apache License 2.0
+
+#include <cmath>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Velocity.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Angle.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/OrbitDetermination/Measurement.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Real;
+using ostk::core::type::Shared;
+
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::Vector3d;
+using ostk::mathematics::object::VectorXd;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Velocity;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+using ostk::physics::unit::Angle;
+using ostk::physics::unit::Length;
+
+using ostk::astrodynamics::orbitdetermination::Measurement;
+using ostk::astrodynamics::Trajectory;
+using ostk::astrodynamics::trajectory::State;
+
+class OpenSpaceToolkit_Astrodynamics_OrbitDetermination_Measurement : public ::testing::Test
+{
+   protected:
+    State buildState(const VectorXd& aCoordinates) const
+    {
+        return {
+            this->instant_,
+            Position::Meters(aCoordinates.head<3>(), Frame::GCRF()),
+            Velocity::MetersPerSecond(aCoordinates.tail<3>(), Frame::GCRF()),
+        };
+    }
+
+    // Central finite differences of the modeled value, with respect to the GCRF position and velocity
+
+    MatrixXd calculateNumericalPartials(const Measurement& aMeasurement) const
+    {
+        MatrixXd partials(aMeasurement.getSize(), 6);
+
+        for (Index j = 0; j < 6; ++j)
+        {
+            const double step = (j < 3) ? 1.0 : 1.0e-3;
+
+            VectorXd forwardCoordinates = this->coordinates_;
+            forwardCoordinates(j) += step;
+
+            VectorXd backwardCoordinates = this->coordinates_;
+            backwardCoordinates(j) -= step;
+
+            partials.col(j) = (aMeasurement.calculateValue(this->buildState(forwardCoordinates)) -
+                               aMeasurement.calculateValue(this->buildState(backwardCoordinates))) /
+                              (2.0 * step);
+        }
+
+        return partials;
+    }
+
+    const Instant instant_ = Instant::DateTime(DateTime(2024, 1, 1, 0, 0, 0), Scale::UTC);
+
+    const Shared<const Trajectory> stationSPtr_ =
+        std::make_shared<Trajectory>(Trajectory::Position(Position::Meters({6378137.0, 0.0, 0.0}, Frame::ITRF())));
+
+    const VectorXd coordinates_ = (VectorXd(6) << 5000000.0, 4000000.0, 3000000.0, -4500.0, 5000.0, 2500.0).finished();
+
+    const State state_ = this->buildState(coordinates_);
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_OrbitDetermination_Measurement, Constructor)
+{
+    {
+        EXPECT_NO_THROW(Measurement(
+            instant_, Measurement::Type::Range, VectorXd::Constant(1, 1.0e6), VectorXd::Constant(1, 10.0), stationSPtr_
+        ));
+    }
+
+    {
+        EXPECT_THROW(
+            Measurement(
+                instant_,
+                Measurement::Type::Angles,
+                VectorXd::Constant(1, 0.1),
+                VectorXd::Constant(2, 1.0e-5),
+                stationSPtr_
+            ),
+            ostk::core::error::runtime::Wrong
+        );
+    }
+
+    {
+        EXPECT_THROW(
+            Measurement(
+                instant_,
+                Measurement::Type::Range,
+                VectorXd::Constant(1, 1.0e6),
+                VectorXd::Constant(1, 0.0),
+                stationSPtr_
+            ),
+            ostk::core::error::runtime::Wrong
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_OrbitDetermination_Measurement, EqualToOperator)
+{
+    const Measurement measurement =
+        Measurement::Range(instant_, Length::Meters(1.0e6), Length::Meters(10.0), stationSPtr_);
+
+    {
+        EXPECT_TRUE(measurement == measurement);
+        EXPECT_FALSE(measurement != measurement);
+    }
+
+    {
+        EXPECT_FALSE(
+            measurement == Measurement::Range(instant_, Length::Meters(2.0e6), Length::Meters(10.0), stationSPtr_)
+        );
+        EXPECT_FALSE(measurement == Measurement::Undefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_OrbitDetermination_Measurement, StreamOperator)
+{
+    {
+        testing::internal::CaptureStdout();
+
+        EXPECT_NO_THROW(
+            std::cout << Measurement::Angles(
+                             instant_, Angle::Degrees(10.0), Angle::Degrees(20.0), Angle::Radians(1.0e-5), stationSPtr_
+                         )
+                      << std::endl
+        );
+
+        EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_OrbitDetermination_Measurement, IsDefined)
+{
+    {
+        EXPECT_TRUE(Measurement::RangeRate(instant_, 100.0, 0.01, stationSPtr_).isDefined());
+    }
+
+    {
+        EXPECT_FALSE(Measurement::Undefined().isDefined());
+        EXPECT_FALSE(Measurement::RangeRate(instant_, 100.0, 0.01, nullptr).isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_OrbitDetermination_Measurement, Getters)
+{
+    {
+        const Measurement measurement = Measurement::Angles(
+            instant_, Angle::Degrees(10.0), Angle::Degrees(20.0), Angle::Radians(1.0e-5), stationSPtr_
+        );
+
+        EXPECT_EQ(instant_, measurement.accessInstant());
+        EXPECT_EQ(Measurement::Type::Angles, measurement.getType());
+        EXPECT_EQ(2, measurement.getSize());
+        EXPECT_NEAR(Angle::Degrees(10.0).inRadians(), measurement.getValue()(0), 1e-15);
+        EXPECT_NEAR(Angle::Degrees(20.0).inRadians(), measurement.getValue()(1), 1e-15);
+        EXPECT_EQ(VectorXd::Constant(2, 1.0e-5), measurement.getStandardDeviation());
+        EXPECT_EQ(stationSPtr_, measurement.getStationTrajectory());
+    }
+
+    {
+        EXPECT_THROW(Measurement::Undefined().accessInstant(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(Measurement::Undefined().getValue(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(Measurement::Undefined().getStandardDeviation(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(Measurement::Undefined().getStationTrajectory(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(Measurement::Undefined().getSize(), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_OrbitDetermination_Measurement, CalculateValue)
+{
+    const State stationState = stationSPtr_->getStateAt(instant_).inFrame(Frame::GCRF());
+
+    const Vector3d relativePosition = coordinates_.head<3>() - stationState.getPosition().getCoordinates();
+    const Vector3d relativeVelocity = coordinates_.tail<3>() - stationState.getVelocity().getCoordinates();
+
+    {
+        const Measurement measurement =
+            Measurement::Range(instant_, Length::Meters(0.0), Length::Meters(10.0), stationSPtr_);
+
+        EXPECT_NEAR(relativePosition.norm(), measurement.calculateValue(state_)(0), 1e-6);
+    }
+
+    {
+        const Measurement measurement = Measurement::RangeRate(instant_, 0.0, 0.01, stationSPtr_);
+
+        EXPECT_NEAR(
+            relativePosition.dot(relativeVelocity) / relativePosition.norm(),
+            measurement.calculateValue(state_)(0),
+            1e-9
+        );
+    }
+
+    {
+        const Measurement measurement =
+            Measurement::Angles(instant_, Angle::Zero(), Angle::Zero(), Angle::Radians(1.0e-5), stationSPtr_);
+
+        const VectorXd value = measurement.calculateValue(state_);
+
+        const Vector3d lineOfSight = {
+            std::cos(value(1)) * std::cos(value(0)),
+            std::cos(value(1)) * std::sin(value(0)),
+            std::sin(value(1)),
+        };
+
+        EXPECT_GT(1e-12, (lineOfSight - relativePosition.normalized()).norm());
+    }
+
+    {
+        const Measurement measurement =
+            Measurement::Range(instant_, Length::Meters(0.0), Length::Meters(10.0), stationSPtr_);
+
+        const State laterState = {instant_ + Duration::Seconds(1.0), state_.getPosition(), state_.getVelocity()};
+
+        EXPECT_THROW(measurement.calculateValue(laterState), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(measurement.calculateValue(State::Undefined()), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(Measurement::Undefined().calculateValue(state_), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_OrbitDetermination_Measurement, CalculateResidual)
+{
+    {
+        const Measurement measurement =
+            Measurement::Range(instant_, Length::Meters(0.0), Length::Meters(10.0), stationSPtr_);
+
+        const VectorXd modeledValue = measurement.calculateValue(state_);
+
+        const Measurement offsetMeasurement =
+            Measurement::Range(instant_, Length::Meters(modeledValue(0) + 25.0), Length::Meters(10.0), stationSPtr_);
+
+        EXPECT_NEAR(25.0, offsetMeasurement.calculateResidual(state_)(0), 1e-6);
+    }
+
+    {
+        const Measurement measurement =
+            Measurement::Angles(instant_, Angle::Zero(), Angle::Zero(), Angle::Radians(1.0e-5), stationSPtr_);
+
+        const VectorXd modeledValue = measurement.calculateValue(state_);
+
+        // Right ascension residuals are wrapped around the circle
+
+        const Measurement offsetMeasurement = Measurement::Angles(
+            instant_,
+            Angle::Radians(modeledValue(0) + 2.0 * M_PI + 1.0e-4),
+            Angle::Radians(modeledValue(1) - 2.0e-4),
+            Angle::Radians(1.0e-5),
+            stationSPtr_
+        );
+
+        const VectorXd residual = offsetMeasurement.calculateResidual(state_);
+
+        EXPECT_NEAR(1.0e-4, residual(0), 1e-10);
+        EXPECT_NEAR(-2.0e-4, residual(1), 1e-10);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_OrbitDetermination_Measurement, CalculatePartials)
+{
+    const Array<Measurement> measurements = {
+        Measurement::Range(instant_, Length::Meters(0.0), Length::Meters(10.0), stationSPtr_),
+        Measurement::RangeRate(instant_, 0.0, 0.01, stationSPtr_),
+        Measurement::Angles(instant_, Angle::Zero(), Angle::Zero(), Angle::Radians(1.0e-5), stationSPtr_),
+    };
+
+    for (const Measurement& measurement : measurements)
+    {
+        const MatrixXd partials = measurement.calculatePartials(state_);
+        const MatrixXd numericalPartials = this->calculateNumericalPartials(measurement);
+
+        ASSERT_EQ(measurement.getSize(), partials.rows());
+        ASSERT_EQ(6, partials.cols());
+
+        EXPECT_GT(1e-6 * numericalPartials.norm(), (partials - numericalPartials).norm())
+            << Measurement::StringFromType(measurement.getType()) << std::endl
+            << partials << std::endl
+            << numericalPartials;
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_OrbitDetermination_Measurement, Undefined)
+{
+    {
+        EXPECT_NO_THROW(Measurement::Undefined());
+        EXPECT_EQ(Measurement::Type::Undefined, Measurement::Undefined().getType());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_OrbitDetermination_Measurement, Factories)
+{
+    {
+        const Measurement measurement =
+            Measurement::Range(instant_, Length::Kilometers(1000.0), Length::Meters(10.0), stationSPtr_);
+
+        EXPECT_EQ(Measurement::Type::Range, measurement.getType());
+        EXPECT_EQ(1.0e6, measurement.getValue()(0));
+        EXPECT_EQ(10.0, measurement.getStandardDeviation()(0));
+    }
+
+    {
+        const Measurement measurement = Measurement::RangeRate(instant_, -250.0, 0.01, stationSPtr_);
+
+        EXPECT_EQ(Measurement::Type::RangeRate, measurement.getType());
+        EXPECT_EQ(-250.0, measurement.getValue()(0));
+        EXPECT_EQ(0.01, measurement.getStandardDeviation()(0));
+    }
+
+    {
+        EXPECT_THROW(
+            Measurement::Range(instant_, Length::Undefined(), Length::Meters(10.0), stationSPtr_),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            Measurement::RangeRate(instant_, Real::Undefined(), 0.01, stationSPtr_),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            Measurement::Angles(instant_, Angle::Undefined(), Angle::Zero(), Angle::Radians(1.0e-5), stationSPtr_),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(Measurement::RangeRate(instant_, 100.0, -0.01, stationSPtr_), ostk::core::error::runtime::Wrong);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_OrbitDetermination_Measurement, StringFromType)
+{
+    {
+        EXPECT_EQ("Undefined", Measurement::StringFromType(Measurement::Type::Undefined));
+        EXPECT_EQ("Range", Measurement::StringFromType(Measurement::Type::Range));
+        EXPECT_EQ("RangeRate", Measurement::StringFromType(Measurement::Type::RangeRate));
+        EXPECT_EQ("Angles", Measurement::StringFromType(Measurement::Type::Angles));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_OrbitDetermination_Measurement, SizeFromType)
+{
+    {
+        EXPECT_EQ(1, Measurement::SizeFromType(Measurement::Type::Range));
+        EXPECT_EQ(1, Measurement::SizeFromType(Measurement::Type::RangeRate));
+        EXPECT_EQ(2, Measurement::SizeFromType(Measurement::Type::Angles));
+        EXPECT_THROW(Measurement::SizeFromType(Measurement::Type::Undefined), ostk::core::error::runtime::Wrong);
+    }
+}
@@ -1,5 +1,7 @@
 /// Apache License 2.0
 
+#include <cmath>
+
 #include <OpenSpaceToolkit/Astrodynamics/RootSolver.hpp>
 
 #include <Global.test.hpp>
@@ -76,6 +78,105 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_RootSolver, Bisection)
     EXPECT_NO_THROW(defaultRootSolver_.bisection(func, 1.0, 5.0));
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_RootSolver, Itp)
+{
+    const auto func = [](const double& x)
+    {
+        return (x * x) - 4;
+    };
+
+    {
+        const RootSolver::Solution solution = defaultRootSolver_.itp(func, 1.0, 5.0);
+        const RootSolver::Solution bisectionSolution = defaultRootSolver_.bisection(func, 1.0, 5.0);
+
+        EXPECT_TRUE(solution.hasConverged);
+        EXPECT_NEAR(2.0, solution.root, 1e-12);
+        EXPECT_LT(solution.iterationCount, bisectionSolution.iterationCount);
+    }
+
+    {
+        const RootSolver::Solution solution = defaultRootSolver_.itp(func, 5.0, 1.0);
+
+        EXPECT_NEAR(2.0, solution.root, 1e-12);
+    }
+
+    {
+        const RootSolver::Solution solution = defaultRootSolver_.itp(
+            [&func](const double& x)
+            {
+                return -func(x);
+            },
+            1.0,
+            5.0
+        );
+
+        EXPECT_NEAR(2.0, solution.root, 1e-12);
+    }
+
+    // The iteration count is bounded by the one of bisection, plus one, even for flat functions
+
+    {
+        const auto steepFunc = [](const double& x)
+        {
+            return std::pow(x - 1.0, 11.0);
+        };
+
+        const RootSolver::Solution solution = defaultRootSolver_.itp(steepFunc, 0.0, 3.0);
+
+        EXPECT_TRUE(solution.hasConverged);
+        EXPECT_NEAR(1.0, solution.root, 1e-12);
+        EXPECT_LE(solution.iterationCount, std::ceil(std::log2(3.0 / defaultTolerance_)) + 1);
+    }
+
+    {
+        EXPECT_ANY_THROW(defaultRootSolver_.itp(func, 3.0, 5.0));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_RootSolver, Newton)
+{
+    const auto func = [](const double& x)
+    {
+        return (x * x) - 4;
+    };
+
+    const auto derivative = [](const double& x)
+    {
+        return 2.0 * x;
+    };
+
+    {
+        const RootSolver::Solution solution = defaultRootSolver_.newton(func, derivative, 1.0, 5.0);
+
+        EXPECT_TRUE(solution.hasConverged);
+        EXPECT_NEAR(2.0, solution.root, 1e-12);
+        EXPECT_GT(10, solution.iterationCount);
+    }
+
+    // Newton steps leaving the bracket (here from a vanishing derivative) fall back to bisection
+
+    {
+        const auto cubicFunc = [](const double& x)
+        {
+            return (x * x * x) - (2.0 * x) - 5.0;
+        };
+
+        const auto cubicDerivative = [](const double& x)
+        {
+            return (3.0 * x * x) - 2.0;
+        };
+
+        const RootSolver::Solution solution = defaultRootSolver_.newton(cubicFunc, cubicDerivative, -1.0, 3.0);
+
+        EXPECT_TRUE(solution.hasConverged);
+        EXPECT_NEAR(2.0945514815423265, solution.root, 1e-10);
+    }
+
+    {
+        EXPECT_ANY_THROW(defaultRootSolver_.newton(func, derivative, 3.0, 5.0));
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_RootSolver, Print)
 {
     {
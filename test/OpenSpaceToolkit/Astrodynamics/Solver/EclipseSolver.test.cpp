@@ -0,0 +1,381 @@
+/// Apache License 2.0
+
+#include <cmath>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Environment.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/EventCondition/RealCondition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Solver/EclipseSolver.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler/COE.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Shared;
+
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::Environment;
+using ostk::physics::environment::gravitational::Earth;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::time::Scale;
+using ostk::physics::unit::Angle;
+using ostk::physics::unit::Length;
+
+using ostk::astrodynamics::eventcondition::RealCondition;
+using ostk::astrodynamics::solver::EclipseSolver;
+using ostk::astrodynamics::trajectory::Orbit;
+using ostk::astrodynamics::trajectory::orbit::model::Kepler;
+using ostk::astrodynamics::trajectory::orbit::model::kepler::COE;
+using ostk::astrodynamics::trajectory::State;
+
+class OpenSpaceToolkit_Astrodynamics_Solvers_EclipseSolver : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        const COE coe = {
+            Length::Kilometers(7000.0),
+            0.0,
+            Angle::Degrees(0.0),
+            Angle::Degrees(0.0),
+            Angle::Degrees(0.0),
+            Angle::Degrees(0.0),
+        };
+
+        const Kepler keplerianModel = {
+            coe,
+            this->startInstant_,
+            Earth::EGM2008.gravitationalParameter_,
+            Earth::EGM2008.equatorialRadius_,
+            Earth::EGM2008.J2_,
+            Earth::EGM2008.J4_,
+            Kepler::PerturbationType::None
+        };
+
+        this->orbit_ = Orbit(keplerianModel, this->earthSPtr_);
+    }
+
+    const Environment environment_ = Environment::Default();
+    const Shared<const Celestial> sunSPtr_ = environment_.accessCelestialObjectWithName("Sun");
+    const Shared<const Celestial> earthSPtr_ = environment_.accessCelestialObjectWithName("Earth");
+
+    const Instant startInstant_ = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+    const Interval interval_ = Interval::Closed(startInstant_, startInstant_ + Duration::Hours(12.0));
+
+    const EclipseSolver eclipseSolver_ = {sunSPtr_, earthSPtr_};
+
+    Orbit orbit_ = Orbit::Undefined();
+
+    // Synthetic geometry: Sun along +X at 1 AU, occulting body at the origin
+
+    const double sunRadius_ = 6.957e8;
+    const double occultingRadius_ = 6.378e6;
+    const Vector3d sunPositionCoordinates_ = {1.496e11, 0.0, 0.0};
+    const Vector3d occultingPositionCoordinates_ = Vector3d::Zero();
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_EclipseSolver, Constructor)
+{
+    {
+        EXPECT_NO_THROW(EclipseSolver(this->sunSPtr_, this->earthSPtr_));
+    }
+
+    {
+        const EclipseSolver eclipseSolver = {
+            this->sunSPtr_,
+            this->earthSPtr_,
+            Duration::Seconds(10.0),
+            Duration::Milliseconds(10.0),
+            Duration::Minutes(5.0),
+        };
+
+        EXPECT_TRUE(eclipseSolver.isDefined());
+        EXPECT_EQ(Duration::Seconds(10.0), eclipseSolver.getTimeStep());
+        EXPECT_EQ(Duration::Milliseconds(10.0), eclipseSolver.getTolerance());
+        EXPECT_EQ(Duration::Minutes(5.0), eclipseSolver.getMaximumTimeStep());
+    }
+
+    {
+        EXPECT_FALSE(EclipseSolver(nullptr, this->earthSPtr_).isDefined());
+        EXPECT_FALSE(EclipseSolver(this->sunSPtr_, nullptr).isDefined());
+
+        // Maximum time step below the time step
+
+        const EclipseSolver eclipseSolver = {
+            this->sunSPtr_,
+            this->earthSPtr_,
+            Duration::Minutes(1.0),
+            Duration::Milliseconds(1.0),
+            Duration::Seconds(30.0),
+        };
+
+        EXPECT_FALSE(eclipseSolver.isDefined());
+
+        EXPECT_FALSE(EclipseSolver::Undefined().isDefined());
+        EXPECT_ANY_THROW(EclipseSolver::Undefined().getTimeStep());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_EclipseSolver, StringFromRegion)
+{
+    EXPECT_EQ("Sunlight", EclipseSolver::StringFromRegion(EclipseSolver::Region::Sunlight));
+    EXPECT_EQ("Penumbra", EclipseSolver::StringFromRegion(EclipseSolver::Region::Penumbra));
+    EXPECT_EQ("Umbra", EclipseSolver::StringFromRegion(EclipseSolver::Region::Umbra));
+    EXPECT_EQ("Shadow", EclipseSolver::StringFromRegion(EclipseSolver::Region::Shadow));
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_EclipseSolver, ComputeShadowFunction)
+{
+    const auto shadowFunction =
+        [this](const EclipseSolver::Region& aRegion, const Vector3d& aPositionCoordinates) -> double
+    {
+        return EclipseSolver::ComputeShadowFunction(
+            aRegion,
+            aPositionCoordinates,
+            this->sunPositionCoordinates_,
+            this->occultingPositionCoordinates_,
+            this->sunRadius_,
+            this->occultingRadius_
+        );
+    };
+
+    // Sunlit side
+
+    {
+        const Vector3d positionCoordinates = {7.0e6, 0.0, 0.0};
+
+        EXPECT_GT(shadowFunction(EclipseSolver::Region::Sunlight, positionCoordinates), 0.0);
+        EXPECT_LT(shadowFunction(EclipseSolver::Region::Penumbra, positionCoordinates), 0.0);
+        EXPECT_LT(shadowFunction(EclipseSolver::Region::Umbra, positionCoordinates), 0.0);
+        EXPECT_LT(shadowFunction(EclipseSolver::Region::Shadow, positionCoordinates), 0.0);
+    }
+
+    // Anti-Sun direction: deep in the umbra
+
+    {
+        const Vector3d positionCoordinates = {-7.0e6, 0.0, 0.0};
+
+        EXPECT_LT(shadowFunction(EclipseSolver::Region::Sunlight, positionCoordinates), 0.0);
+        EXPECT_LT(shadowFunction(EclipseSolver::Region::Penumbra, positionCoordinates), 0.0);
+        EXPECT_GT(shadowFunction(EclipseSolver::Region::Umbra, positionCoordinates), 0.0);
+        EXPECT_GT(shadowFunction(EclipseSolver::Region::Shadow, positionCoordinates), 0.0);
+    }
+
+    // Behind the limb, at the occulting radius from the shadow axis: within the penumbra
+
+    {
+        const Vector3d positionCoordinates = {-7.0e6, this->occultingRadius_, 0.0};
+
+        EXPECT_LT(shadowFunction(EclipseSolver::Region::Sunlight, positionCoordinates), 0.0);
+        EXPECT_GT(shadowFunction(EclipseSolver::Region::Penumbra, positionCoordinates), 0.0);
+        EXPECT_LT(shadowFunction(EclipseSolver::Region::Umbra, positionCoordinates), 0.0);
+        EXPECT_GT(shadowFunction(EclipseSolver::Region::Shadow, positionCoordinates), 0.0);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_EclipseSolver, ComputeIlluminationFraction)
+{
+    const auto illuminationFraction = [this](const Vector3d& aPositionCoordinates) -> double
+    {
+        return EclipseSolver::ComputeIlluminationFraction(
+            aPositionCoordinates,
+            this->sunPositionCoordinates_,
+            this->occultingPositionCoordinates_,
+            this->sunRadius_,
+            this->occultingRadius_
+        );
+    };
+
+    {
+        EXPECT_EQ(1.0, illuminationFraction({7.0e6, 0.0, 0.0}));
+        EXPECT_EQ(0.0, illuminationFraction({-7.0e6, 0.0, 0.0}));
+
+        const double penumbraIlluminationFraction = illuminationFraction({-7.0e6, this->occultingRadius_, 0.0});
+
+        EXPECT_GT(penumbraIlluminationFraction, 0.0);
+        EXPECT_LT(penumbraIlluminationFraction, 1.0);
+    }
+
+    // Illumination increases monotonically across the penumbra (about 65 km wide, 7000 km behind the limb)
+
+    {
+        double previousIlluminationFraction = 0.0;
+
+        for (double offset_m = this->occultingRadius_ - 50.0e3; offset_m <= this->occultingRadius_ + 50.0e3;
+             offset_m += 1.0e3)
+        {
+            const double fraction = illuminationFraction({-7.0e6, offset_m, 0.0});
+
+            EXPECT_GE(fraction, previousIlluminationFraction);
+
+            previousIlluminationFraction = fraction;
+        }
+
+        EXPECT_EQ(1.0, previousIlluminationFraction);
+    }
+
+    // Annular eclipse: a small occulting body, far from the satellite, fully within the Sun disc
+
+    {
+        const double occultingRadius = 1.0e3;
+        const Vector3d positionCoordinates = {-1.0e9, 0.0, 0.0};
+
+        const double sunApparentRadius = std::asin(this->sunRadius_ / (this->sunPositionCoordinates_.x() + 1.0e9));
+        const double occultingApparentRadius = std::asin(occultingRadius / 1.0e9);
+
+        EXPECT_NEAR(
+            1.0 - (occultingApparentRadius * occultingApparentRadius) / (sunApparentRadius * sunApparentRadius),
+            EclipseSolver::ComputeIlluminationFraction(
+                positionCoordinates,
+                this->sunPositionCoordinates_,
+                this->occultingPositionCoordinates_,
+                this->sunRadius_,
+                occultingRadius
+            ),
+            1e-12
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_EclipseSolver, ComputeIntervals)
+{
+    // An equatorial LEO orbit in January (Sun declination of -23 deg) is eclipsed once per orbit
+
+    const Array<Interval> shadowIntervals =
+        this->eclipseSolver_.computeIntervals(this->orbit_, this->interval_, EclipseSolver::Region::Shadow);
+    const Array<Interval> umbraIntervals =
+        this->eclipseSolver_.computeIntervals(this->orbit_, this->interval_, EclipseSolver::Region::Umbra);
+    const Array<Interval> penumbraIntervals =
+        this->eclipseSolver_.computeIntervals(this->orbit_, this->interval_, EclipseSolver::Region::Penumbra);
+    const Array<Interval> sunlightIntervals =
+        this->eclipseSolver_.computeIntervals(this->orbit_, this->interval_, EclipseSolver::Region::Sunlight);
+
+    ASSERT_FALSE(umbraIntervals.isEmpty());
+
+    EXPECT_EQ(shadowIntervals.getSize(), umbraIntervals.getSize());
+    EXPECT_FALSE(penumbraIntervals.isEmpty());
+
+    // Each umbra interval is nested within a shadow interval, between two penumbra intervals
+
+    for (const Interval& umbraInterval : umbraIntervals)
+    {
+        bool isNested = false;
+
+        for (const Interval& shadowInterval : shadowIntervals)
+        {
+            isNested = isNested || shadowInterval.contains(umbraInterval);
+        }
+
+        EXPECT_TRUE(isNested);
+
+        EXPECT_EQ(
+            0.0,
+            this->eclipseSolver_.computeIlluminationFraction(
+                umbraInterval.getCenter(),
+                this->orbit_.getStateAt(umbraInterval.getCenter()).inFrame(Frame::GCRF()).getPosition().getCoordinates()
+            )
+        );
+    }
+
+    // Sunlight and shadow intervals partition the analysis interval
+
+    Duration totalDuration = Duration::Zero();
+
+    for (const Interval& interval : shadowIntervals)
+    {
+        totalDuration += interval.getDuration();
+    }
+
+    for (const Interval& interval : sunlightIntervals)
+    {
+        totalDuration += interval.getDuration();
+    }
+
+    EXPECT_NEAR(this->interval_.getDuration().inSeconds(), totalDuration.inSeconds(), 1e-2);
+
+    // Region boundaries
+
+    const Duration margin = Duration::Seconds(1.0);
+
+    for (const Interval& shadowInterval : shadowIntervals)
+    {
+        if ((shadowInterval.getStart() != this->interval_.getStart()) &&
+            (shadowInterval.getEnd() != this->interval_.getEnd()))
+        {
+            const auto illuminationFractionAt = [this](const Instant& anInstant) -> double
+            {
+                return this->eclipseSolver_.computeIlluminationFraction(
+                    anInstant, this->orbit_.getStateAt(anInstant).inFrame(Frame::GCRF()).getPosition().getCoordinates()
+                );
+            };
+
+            EXPECT_EQ(1.0, illuminationFractionAt(shadowInterval.getStart() - margin));
+            EXPECT_LT(illuminationFractionAt(shadowInterval.getStart() + margin), 1.0);
+            EXPECT_LT(illuminationFractionAt(shadowInterval.getEnd() - margin), 1.0);
+            EXPECT_EQ(1.0, illuminationFractionAt(shadowInterval.getEnd() + margin));
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(
+            EclipseSolver::Undefined().computeIntervals(this->orbit_, this->interval_, EclipseSolver::Region::Umbra)
+        );
+        EXPECT_ANY_THROW(
+            this->eclipseSolver_.computeIntervals(Orbit::Undefined(), this->interval_, EclipseSolver::Region::Umbra)
+        );
+        EXPECT_ANY_THROW(
+            this->eclipseSolver_.computeIntervals(this->orbit_, Interval::Undefined(), EclipseSolver::Region::Umbra)
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_EclipseSolver, GenerateEventCondition)
+{
+    const RealCondition condition = this->eclipseSolver_.generateEventCondition(
+        EclipseSolver::Region::Umbra, RealCondition::Criterion::PositiveCrossing
+    );
+
+    EXPECT_EQ("Earth Umbra", condition.getName());
+    EXPECT_EQ(RealCondition::Criterion::PositiveCrossing, condition.getCriterion());
+
+    const Array<Interval> umbraIntervals =
+        this->eclipseSolver_.computeIntervals(this->orbit_, this->interval_, EclipseSolver::Region::Umbra);
+
+    ASSERT_FALSE(umbraIntervals.isEmpty());
+
+    const Instant centerInstant = umbraIntervals.accessFirst().getCenter();
+
+    const State state = this->orbit_.getStateAt(centerInstant).inFrame(Frame::GCRF());
+
+    EXPECT_GT(condition.evaluate(state), 0.0);
+
+    {
+        EXPECT_ANY_THROW(EclipseSolver::Undefined().generateEventCondition(
+            EclipseSolver::Region::Umbra, RealCondition::Criterion::PositiveCrossing
+        ));
+    }
+}
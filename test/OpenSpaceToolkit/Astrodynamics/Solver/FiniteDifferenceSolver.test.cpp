@@ -1,7 +1,10 @@
 /// Apache License 2.0
 
+#include <atomic>
+
 #include <gtest/gtest.h>
 
+#include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Type/Size.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Solver/FiniteDifferenceSolver.hpp>
@@ -215,6 +218,87 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_FiniteDifferenceSolver, ComputeJac
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_FiniteDifferenceSolver, ComputeJacobian_ThreadCount)
+{
+    const Array<Instant> instants = {
+        Instant::J2000() + Duration::Seconds(100.0),
+        Instant::J2000() + Duration::Seconds(200.0),
+    };
+
+    {
+        for (const FiniteDifferenceSolver::Type& type :
+             {FiniteDifferenceSolver::Type::Central,
+              FiniteDifferenceSolver::Type::Forward,
+              FiniteDifferenceSolver::Type::Backward})
+        {
+            const FiniteDifferenceSolver solver = {type, defaultStepPercentage_, defaultStepDuration_};
+
+            const MatrixXd serialJacobian =
+                solver.computeJacobian(initialState_, instants, generateStatesCoordinates, 2, 1);
+            const MatrixXd parallelJacobian =
+                solver.computeJacobian(initialState_, instants, generateStatesCoordinates, 2, 4);
+
+            EXPECT_EQ(serialJacobian, parallelJacobian);
+        }
+    }
+
+    {
+        std::atomic<Size> evaluationCount = {0};
+
+        const auto countingGenerateStatesCoordinates =
+            [this, &evaluationCount](const State& aState, const Array<Instant>& anInstantArray) -> MatrixXd
+        {
+            ++evaluationCount;
+
+            return generateStatesCoordinates(aState, anInstantArray);
+        };
+
+        {
+            const FiniteDifferenceSolver solver = {
+                FiniteDifferenceSolver::Type::Forward,
+                defaultStepPercentage_,
+                defaultStepDuration_,
+            };
+
+            solver.computeJacobian(initialState_, instants, countingGenerateStatesCoordinates, 2);
+
+            EXPECT_EQ(evaluationCount.load(), 3);
+        }
+
+        evaluationCount = 0;
+
+        {
+            const FiniteDifferenceSolver solver = {
+                FiniteDifferenceSolver::Type::Central,
+                defaultStepPercentage_,
+                defaultStepDuration_,
+            };
+
+            solver.computeJacobian(initialState_, instants, countingGenerateStatesCoordinates, 2);
+
+            EXPECT_EQ(evaluationCount.load(), 4);
+        }
+    }
+
+    {
+        const FiniteDifferenceSolver solver = {
+            FiniteDifferenceSolver::Type::Central,
+            defaultStepPercentage_,
+            defaultStepDuration_,
+        };
+
+        const auto throwingGenerateStatesCoordinates = [](const State&, const Array<Instant>&) -> MatrixXd
+        {
+            throw ostk::core::error::RuntimeError("Failed evaluation.");
+        };
+
+        EXPECT_THROW(
+            solver.computeJacobian(initialState_, instants, throwingGenerateStatesCoordinates, 2, 4),
+            ostk::core::error::RuntimeError
+        );
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_FiniteDifferenceSolver, ComputeGradient)
 {
     VectorXd expectedGradient(2);
@@ -0,0 +1,345 @@
+/// Apache License 2.0
+
+#include <cmath>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Angle.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Derived.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/ExecutionContext.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Solver/LambertSolver.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler/COE.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Shared;
+
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Velocity;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::environment::object::celestial::Earth;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+using ostk::physics::unit::Angle;
+using ostk::physics::unit::Derived;
+using ostk::physics::unit::Length;
+
+using ostk::astrodynamics::ExecutionContext;
+using ostk::astrodynamics::solver::LambertSolver;
+using ostk::astrodynamics::trajectory::Orbit;
+using ostk::astrodynamics::trajectory::orbit::model::Kepler;
+using ostk::astrodynamics::trajectory::orbit::model::kepler::COE;
+using ostk::astrodynamics::trajectory::State;
+
+class OpenSpaceToolkit_Astrodynamics_Solver_LambertSolver : public ::testing::Test
+{
+   protected:
+    // Position reached from a departure position and velocity, on a Keplerian orbit
+
+    Vector3d calculateArrivalPosition(
+        const Vector3d& aDeparturePosition, const Vector3d& aDepartureVelocity, const Duration& aTimeOfFlight
+    ) const
+    {
+        const COE coe = COE::Cartesian(
+            {Position::Meters(aDeparturePosition, Frame::GCRF()),
+             Velocity::MetersPerSecond(aDepartureVelocity, Frame::GCRF())},
+            this->gravitationalParameter_
+        );
+
+        const Kepler keplerianModel = {
+            coe,
+            this->epoch_,
+            this->gravitationalParameter_,
+            this->earthSPtr_->getEquatorialRadius(),
+            0.0,
+            0.0,
+            Kepler::PerturbationType::None,
+        };
+
+        return keplerianModel.calculateStateAt(this->epoch_ + aTimeOfFlight).getPosition().getCoordinates();
+    }
+
+    const Shared<const Celestial> earthSPtr_ = std::make_shared<Celestial>(Earth::Spherical());
+    const Derived gravitationalParameter_ = earthSPtr_->getGravitationalParameter();
+    const Instant epoch_ = Instant::DateTime(DateTime(2024, 1, 1, 0, 0, 0), Scale::UTC);
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solver_LambertSolver, Constructor)
+{
+    {
+        const LambertSolver lambertSolver = {this->gravitationalParameter_};
+
+        EXPECT_EQ(this->gravitationalParameter_, lambertSolver.getGravitationalParameter());
+        EXPECT_EQ(0, lambertSolver.getMaximumRevolutionCount());
+        EXPECT_TRUE(lambertSolver.isPrograde());
+        EXPECT_EQ(35, lambertSolver.getMaximumIterationCount());
+        EXPECT_EQ(1e-11, lambertSolver.getTolerance());
+    }
+
+    {
+        EXPECT_THROW(LambertSolver(Derived::Undefined()), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(LambertSolver(this->gravitationalParameter_, 0, true, 0), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(LambertSolver(this->gravitationalParameter_, 0, true, 35, 0.0), ostk::core::error::runtime::Wrong);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solver_LambertSolver, Print)
+{
+    const LambertSolver lambertSolver = {this->gravitationalParameter_, 2};
+
+    testing::internal::CaptureStdout();
+
+    EXPECT_NO_THROW(lambertSolver.print(std::cout, true));
+    EXPECT_NO_THROW(std::cout << lambertSolver << std::endl);
+    EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solver_LambertSolver, Solve)
+{
+    // Vallado, Fundamentals of Astrodynamics and Applications, Example 7-5
+
+    {
+        const LambertSolver lambertSolver = {this->gravitationalParameter_};
+
+        const Array<LambertSolver::Solution> solutions = lambertSolver.solve(
+            {15945340.0, 0.0, 0.0}, {12214838.99, 10249467.31, 0.0}, Duration::Minutes(76.0)
+        );
+
+        ASSERT_EQ(1, solutions.getSize());
+
+        EXPECT_EQ(0, solutions[0].revolutionCount);
+        EXPECT_TRUE(solutions[0].departureVelocity.isApprox(Vector3d(2058.913, 2915.965, 0.0), 1e-5));
+        EXPECT_TRUE(solutions[0].arrivalVelocity.isApprox(Vector3d(-3451.565, 910.315, 0.0), 1e-5));
+    }
+
+    // Direct and multi-revolution transfers, in both directions, reach the arrival position
+
+    {
+        const Vector3d departurePosition = {7000000.0, 0.0, 0.0};
+        const Vector3d arrivalPosition = {-3000000.0, 9000000.0, 2000000.0};
+
+        for (const bool isPrograde : {true, false})
+        {
+            const LambertSolver lambertSolver = {this->gravitationalParameter_, 3, isPrograde};
+
+            for (const Duration& timeOfFlight :
+                 {Duration::Seconds(1800.0), Duration::Seconds(20000.0), Duration::Seconds(40000.0)})
+            {
+                const Array<LambertSolver::Solution> solutions =
+                    lambertSolver.solve(departurePosition, arrivalPosition, timeOfFlight);
+
+                ASSERT_FALSE(solutions.isEmpty());
+                EXPECT_EQ(0, solutions[0].revolutionCount);
+
+                for (const LambertSolver::Solution& solution : solutions)
+                {
+                    EXPECT_LE(solution.revolutionCount, 3);
+
+                    const Vector3d normal = departurePosition.cross(solution.departureVelocity);
+
+                    EXPECT_EQ(isPrograde, normal.z() > 0.0);
+                    EXPECT_LT(
+                        (this->calculateArrivalPosition(departurePosition, solution.departureVelocity, timeOfFlight) -
+                         arrivalPosition)
+                            .norm(),
+                        1e-2
+                    );
+                }
+            }
+
+            // Three complete revolutions fit in 40000 s, with two branches each
+
+            EXPECT_EQ(7, lambertSolver.solve(departurePosition, arrivalPosition, Duration::Seconds(40000.0)).getSize());
+            EXPECT_EQ(1, lambertSolver.solve(departurePosition, arrivalPosition, Duration::Seconds(1800.0)).getSize());
+        }
+    }
+
+    {
+        const LambertSolver lambertSolver = {this->gravitationalParameter_};
+
+        EXPECT_TRUE(lambertSolver.solve({7000000.0, 0.0, 0.0}, {-8000000.0, 0.0, 0.0}, Duration::Hours(1.0)).isEmpty());
+
+        EXPECT_THROW(
+            lambertSolver.solve({7000000.0, 0.0, 0.0}, {0.0, 7000000.0, 0.0}, Duration::Undefined()),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            lambertSolver.solve({7000000.0, 0.0, 0.0}, {0.0, 7000000.0, 0.0}, Duration::Zero()),
+            ostk::core::error::runtime::Wrong
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solver_LambertSolver, ComputeTransfer)
+{
+    const Orbit departureOrbit =
+        Orbit::Circular(this->epoch_, Length::Kilometers(600.0), Angle::Degrees(50.0), this->earthSPtr_);
+    const Orbit arrivalOrbit =
+        Orbit::Circular(this->epoch_, Length::Kilometers(1200.0), Angle::Degrees(55.0), this->earthSPtr_);
+
+    const State departureState = departureOrbit.getStateAt(this->epoch_);
+    const State arrivalState = arrivalOrbit.getStateAt(this->epoch_ + Duration::Minutes(70.0));
+
+    {
+        const LambertSolver lambertSolver = {this->gravitationalParameter_, 1};
+
+        const LambertSolver::Transfer transfer = lambertSolver.computeTransfer(departureState, arrivalState);
+
+        ASSERT_TRUE(transfer.isDefined());
+
+        EXPECT_EQ(departureState.accessInstant(), transfer.departureState.accessInstant());
+        EXPECT_EQ(arrivalState.accessInstant(), transfer.arrivalState.accessInstant());
+        EXPECT_NEAR(
+            (transfer.departureState.getVelocity().getCoordinates() - departureState.getVelocity().getCoordinates())
+                .norm(),
+            transfer.departureDeltaV,
+            1e-9
+        );
+        EXPECT_NEAR(
+            (arrivalState.getVelocity().getCoordinates() - transfer.arrivalState.getVelocity().getCoordinates())
+                .norm(),
+            transfer.arrivalDeltaV,
+            1e-9
+        );
+        EXPECT_NEAR(transfer.departureDeltaV + transfer.arrivalDeltaV, transfer.getTotalDeltaV(), 1e-9);
+
+        // The transfer is the one of lowest total delta-V among all solutions
+
+        const Array<LambertSolver::Solution> solutions = lambertSolver.solve(
+            departureState.getPosition().getCoordinates(),
+            arrivalState.getPosition().getCoordinates(),
+            arrivalState.accessInstant() - departureState.accessInstant()
+        );
+
+        for (const LambertSolver::Solution& solution : solutions)
+        {
+            const double totalDeltaV =
+                (solution.departureVelocity - departureState.getVelocity().getCoordinates()).norm() +
+                (arrivalState.getVelocity().getCoordinates() - solution.arrivalVelocity).norm();
+
+            EXPECT_LE(transfer.getTotalDeltaV(), totalDeltaV + 1e-9);
+        }
+
+        // The orbit of the transfer, built on request, reaches the arrival position
+
+        const Orbit transferOrbit = lambertSolver.computeOrbit(transfer, this->earthSPtr_);
+
+        EXPECT_LT(
+            (transferOrbit.getStateAt(arrivalState.accessInstant()).getPosition().getCoordinates() -
+             arrivalState.getPosition().getCoordinates())
+                .norm(),
+            1e-2
+        );
+    }
+
+    {
+        const LambertSolver lambertSolver = {this->gravitationalParameter_};
+
+        EXPECT_THROW(
+            lambertSolver.computeTransfer(State::Undefined(), arrivalState), ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            lambertSolver.computeTransfer(arrivalState, departureState), ostk::core::error::runtime::Wrong
+        );
+        EXPECT_FALSE(LambertSolver::Transfer::Undefined().isDefined());
+        EXPECT_THROW(LambertSolver::Transfer::Undefined().getTotalDeltaV(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(
+            lambertSolver.computeOrbit(LambertSolver::Transfer::Undefined(), this->earthSPtr_),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solver_LambertSolver, ComputeTransferGrid)
+{
+    const Orbit departureOrbit =
+        Orbit::Circular(this->epoch_, Length::Kilometers(600.0), Angle::Degrees(50.0), this->earthSPtr_);
+    const Orbit arrivalOrbit =
+        Orbit::Circular(this->epoch_, Length::Kilometers(1200.0), Angle::Degrees(55.0), this->earthSPtr_);
+
+    Array<Instant> departureInstants = Array<Instant>::Empty();
+    Array<Duration> timesOfFlight = Array<Duration>::Empty();
+
+    for (Index i = 0; i < 6; ++i)
+    {
+        departureInstants.add(this->epoch_ + Duration::Minutes(10.0 * i));
+    }
+
+    for (Index j = 0; j < 5; ++j)
+    {
+        timesOfFlight.add(Duration::Minutes(30.0 + 25.0 * j));
+    }
+
+    const LambertSolver lambertSolver = {this->gravitationalParameter_, 1};
+
+    const LambertSolver::TransferGrid transferGrid = lambertSolver.computeTransferGrid(
+        departureOrbit, arrivalOrbit, departureInstants, timesOfFlight, ExecutionContext(4)
+    );
+
+    ASSERT_EQ(30, transferGrid.transfers.getSize());
+
+    const MatrixXd departureDeltaVs = transferGrid.getDepartureDeltaVs();
+    const MatrixXd arrivalDeltaVs = transferGrid.getArrivalDeltaVs();
+    const MatrixXd totalDeltaVs = transferGrid.getTotalDeltaVs();
+
+    EXPECT_EQ(6, totalDeltaVs.rows());
+    EXPECT_EQ(5, totalDeltaVs.cols());
+    EXPECT_TRUE(totalDeltaVs.isApprox(departureDeltaVs + arrivalDeltaVs));
+
+    // Cells match the transfers computed one by one, whatever the thread count
+
+    const LambertSolver::TransferGrid serialTransferGrid = lambertSolver.computeTransferGrid(
+        departureOrbit, arrivalOrbit, departureInstants, timesOfFlight, ExecutionContext(1)
+    );
+
+    EXPECT_TRUE(totalDeltaVs == serialTransferGrid.getTotalDeltaVs());
+
+    for (Index i = 0; i < departureInstants.getSize(); ++i)
+    {
+        for (Index j = 0; j < timesOfFlight.getSize(); ++j)
+        {
+            const LambertSolver::Transfer transfer = lambertSolver.computeTransfer(
+                departureOrbit.getStateAt(departureInstants[i]),
+                arrivalOrbit.getStateAt(departureInstants[i] + timesOfFlight[j])
+            );
+
+            const LambertSolver::Transfer& gridTransfer = transferGrid.accessTransferAt(i, j);
+
+            ASSERT_TRUE(gridTransfer.isDefined());
+            EXPECT_EQ(transfer.revolutionCount, gridTransfer.revolutionCount);
+            EXPECT_NEAR(transfer.getTotalDeltaV(), totalDeltaVs(i, j), 1e-6);
+            EXPECT_EQ(departureInstants[i] + timesOfFlight[j], gridTransfer.arrivalState.accessInstant());
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(transferGrid.accessTransferAt(6, 0));
+
+        EXPECT_THROW(
+            lambertSolver.computeTransferGrid(departureOrbit, arrivalOrbit, departureInstants, {Duration::Zero()}),
+            ostk::core::error::runtime::Wrong
+        );
+    }
+}
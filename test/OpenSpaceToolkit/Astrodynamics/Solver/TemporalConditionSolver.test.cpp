@@ -0,0 +1,419 @@
+/// Apache License 2.0
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Environment.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Solver/TemporalConditionSolver.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::Environment;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::time::Scale;
+
+using ostk::astrodynamics::solver::TemporalConditionSolver;
+using ostk::astrodynamics::Trajectory;
+using ostk::astrodynamics::trajectory::State;
+
+class OpenSpaceToolkit_Astrodynamics_Solvers_TemporalConditionSolver : public ::testing::Test
+{
+   protected:
+    const Instant startInstant_ = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+    const Interval interval_ = Interval::Closed(startInstant_, startInstant_ + Duration::Hours(12.0));
+
+    // Sine wave with a 100 minutes period, above the threshold for a short fraction of each period
+
+    const double period_s_ = 6000.0;
+    const double threshold_ = 0.9;
+
+    const TemporalConditionSolver::MarginFunction marginFunction_ = [this](const Instant& anInstant) -> double
+    {
+        return std::sin(2.0 * M_PI * (anInstant - startInstant_).inSeconds() / period_s_) - threshold_;
+    };
+
+    const TemporalConditionSolver::Condition condition_ = [this](const Instant& anInstant) -> bool
+    {
+        return marginFunction_(anInstant) > 0.0;
+    };
+
+    const TemporalConditionSolver temporalConditionSolver_ = {Duration::Seconds(30.0), Duration::Milliseconds(1.0)};
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_TemporalConditionSolver, Constructor)
+{
+    {
+        EXPECT_NO_THROW(TemporalConditionSolver(Duration::Seconds(30.0), Duration::Milliseconds(1.0)));
+    }
+
+    {
+        EXPECT_NO_THROW(TemporalConditionSolver(Duration::Seconds(30.0), Duration::Milliseconds(1.0), 100));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_TemporalConditionSolver, Getters)
+{
+    {
+        EXPECT_EQ(Duration::Seconds(30.0), temporalConditionSolver_.getTimeStep());
+        EXPECT_EQ(Duration::Milliseconds(1.0), temporalConditionSolver_.getTolerance());
+        EXPECT_EQ(DEFAULT_MAXIMUM_ITERATION_COUNT, temporalConditionSolver_.getMaximumIterationCount());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_TemporalConditionSolver, Solve)
+{
+    {
+        const Array<Interval> intervals = temporalConditionSolver_.solve(condition_, interval_);
+
+        EXPECT_EQ(8, intervals.getSize());
+    }
+
+    {
+        const Array<Interval> intervals = temporalConditionSolver_.solve(
+            [](const Instant&) -> bool
+            {
+                return true;
+            },
+            interval_
+        );
+
+        ASSERT_EQ(1, intervals.getSize());
+        EXPECT_EQ(interval_, intervals.accessFirst());
+    }
+
+    {
+        EXPECT_ANY_THROW(temporalConditionSolver_.solve(condition_, Interval::Undefined()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_TemporalConditionSolver, SolveStreaming)
+{
+    {
+        const Array<Interval> referenceIntervals = temporalConditionSolver_.solve(condition_, interval_);
+
+        Array<Interval> intervals = Array<Interval>::Empty();
+
+        temporalConditionSolver_.solve(
+            condition_,
+            interval_,
+            [&intervals](const Interval& anInterval) -> void
+            {
+                intervals.add(anInterval);
+            }
+        );
+
+        EXPECT_EQ(referenceIntervals, intervals);
+    }
+
+    {
+        Array<Interval> intervals = Array<Interval>::Empty();
+
+        temporalConditionSolver_.solve(
+            Array<TemporalConditionSolver::Condition>({condition_, condition_}),
+            interval_,
+            [&intervals](const Interval& anInterval) -> void
+            {
+                intervals.add(anInterval);
+            }
+        );
+
+        EXPECT_EQ(temporalConditionSolver_.solve(condition_, interval_), intervals);
+    }
+
+    {
+        // Grid not aligned with the interval end
+
+        const Interval interval = Interval::Closed(startInstant_, startInstant_ + Duration::Seconds(100.0));
+
+        Array<Interval> intervals = Array<Interval>::Empty();
+
+        temporalConditionSolver_.solve(
+            [](const Instant&) -> bool
+            {
+                return true;
+            },
+            interval,
+            [&intervals](const Interval& anInterval) -> void
+            {
+                intervals.add(anInterval);
+            }
+        );
+
+        ASSERT_EQ(1, intervals.getSize());
+        EXPECT_EQ(interval, intervals.accessFirst());
+    }
+
+    {
+        EXPECT_ANY_THROW(temporalConditionSolver_.solve(condition_, interval_, {}));
+        EXPECT_ANY_THROW(temporalConditionSolver_.solve(
+            condition_,
+            Interval::Undefined(),
+            [](const Interval&) -> void {}
+        ));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_TemporalConditionSolver, SolveAdaptive)
+{
+    {
+        Size conditionEvaluationCount = 0;
+
+        const Array<Interval> referenceIntervals = temporalConditionSolver_.solve(
+            [this, &conditionEvaluationCount](const Instant& anInstant) -> bool
+            {
+                ++conditionEvaluationCount;
+                return condition_(anInstant);
+            },
+            interval_
+        );
+
+        Size marginEvaluationCount = 0;
+
+        const Array<Interval> intervals = temporalConditionSolver_.solveAdaptive(
+            [this, &marginEvaluationCount](const Instant& anInstant) -> double
+            {
+                ++marginEvaluationCount;
+                return marginFunction_(anInstant);
+            },
+            interval_,
+            Duration::Minutes(20.0)
+        );
+
+        ASSERT_EQ(referenceIntervals.getSize(), intervals.getSize());
+
+        for (Size i = 0; i < intervals.getSize(); ++i)
+        {
+            EXPECT_TRUE(intervals[i].getStart().isNear(referenceIntervals[i].getStart(), Duration::Milliseconds(10.0))
+            );
+            EXPECT_TRUE(intervals[i].getEnd().isNear(referenceIntervals[i].getEnd(), Duration::Milliseconds(10.0)));
+        }
+
+        EXPECT_LT(marginEvaluationCount, conditionEvaluationCount);
+    }
+
+    {
+        const Array<Interval> intervals = temporalConditionSolver_.solveAdaptive(
+            [](const Instant&) -> double
+            {
+                return 1.0;
+            },
+            interval_,
+            Duration::Minutes(20.0)
+        );
+
+        ASSERT_EQ(1, intervals.getSize());
+        EXPECT_EQ(interval_, intervals.accessFirst());
+    }
+
+    {
+        const Array<Interval> intervals = temporalConditionSolver_.solveAdaptive(
+            [](const Instant&) -> double
+            {
+                return -1.0;
+            },
+            interval_,
+            Duration::Minutes(20.0)
+        );
+
+        EXPECT_TRUE(intervals.isEmpty());
+    }
+
+    {
+        EXPECT_ANY_THROW(
+            temporalConditionSolver_.solveAdaptive(marginFunction_, Interval::Undefined(), Duration::Minutes(20.0))
+        );
+        EXPECT_ANY_THROW(temporalConditionSolver_.solveAdaptive(marginFunction_, interval_, Duration::Undefined()));
+        EXPECT_ANY_THROW(temporalConditionSolver_.solveAdaptive(marginFunction_, interval_, Duration::Seconds(1.0)));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_TemporalConditionSolver, SolveStateConditions)
+{
+    const Trajectory stationTrajectory = Trajectory::Position(Position::Meters({6378137.0, 0.0, 0.0}, Frame::ITRF()));
+
+    const Shared<const Celestial> sunSPtr = Environment::Default().accessCelestialObjectWithName("Sun");
+
+    const Array<Trajectory> trajectories = {stationTrajectory};
+    const Array<Shared<const Celestial>> celestials = {sunSPtr};
+
+    {
+        const TemporalConditionSolver::StateCondition timeCondition =
+            [this](const TemporalConditionSolver::Snapshot& aSnapshot) -> bool
+        {
+            return condition_(aSnapshot.accessInstant());
+        };
+
+        // States and celestial positions are cached within a snapshot
+
+        const TemporalConditionSolver::StateCondition stateCondition =
+            [](const TemporalConditionSolver::Snapshot& aSnapshot) -> bool
+        {
+            const State& state = aSnapshot.accessState(0);
+
+            EXPECT_EQ(&state, &aSnapshot.accessState(0));
+            EXPECT_EQ(
+                &aSnapshot.accessCelestialPositionCoordinates(0), &aSnapshot.accessCelestialPositionCoordinates(0)
+            );
+
+            return state.accessInstant() == aSnapshot.accessInstant() &&
+                   aSnapshot.accessCelestialPositionCoordinates(0).norm() > 1.4e11;
+        };
+
+        const Array<Interval> referenceIntervals = temporalConditionSolver_.solve(condition_, interval_);
+
+        const Array<Interval> intervals =
+            temporalConditionSolver_.solve({timeCondition, stateCondition}, trajectories, celestials, interval_);
+
+        ASSERT_EQ(referenceIntervals.getSize(), intervals.getSize());
+
+        for (Size i = 0; i < intervals.getSize(); ++i)
+        {
+            EXPECT_EQ(referenceIntervals[i], intervals[i]);
+        }
+    }
+
+    // Conditions are short-circuited on the first unmet one
+
+    {
+        Size evaluationCount = 0;
+
+        const Array<Interval> intervals = temporalConditionSolver_.solve(
+            {
+                [](const TemporalConditionSolver::Snapshot&) -> bool
+                {
+                    return false;
+                },
+                [&evaluationCount](const TemporalConditionSolver::Snapshot&) -> bool
+                {
+                    ++evaluationCount;
+                    return true;
+                },
+            },
+            trajectories,
+            celestials,
+            interval_
+        );
+
+        EXPECT_TRUE(intervals.isEmpty());
+        EXPECT_EQ(0, evaluationCount);
+    }
+
+    {
+        const TemporalConditionSolver::StateCondition outOfRangeCondition =
+            [](const TemporalConditionSolver::Snapshot& aSnapshot) -> bool
+        {
+            return aSnapshot.accessState(1).isDefined();
+        };
+
+        EXPECT_ANY_THROW(temporalConditionSolver_.solve({outOfRangeCondition}, trajectories, celestials, interval_));
+        EXPECT_ANY_THROW(temporalConditionSolver_.solve({}, {Trajectory::Undefined()}, celestials, interval_));
+        EXPECT_ANY_THROW(temporalConditionSolver_.solve({}, trajectories, {nullptr}, interval_));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Solvers_TemporalConditionSolver, Statistics)
+{
+    {
+        TemporalConditionSolver temporalConditionSolver = temporalConditionSolver_;
+
+        EXPECT_FALSE(temporalConditionSolver.isStatisticsEnabled());
+        EXPECT_ANY_THROW(temporalConditionSolver.getStatistics());
+
+        temporalConditionSolver.enableStatistics();
+
+        EXPECT_TRUE(temporalConditionSolver.isStatisticsEnabled());
+        EXPECT_EQ(0, temporalConditionSolver.getStatistics().conditionEvaluationCount);
+
+        Size conditionEvaluationCount = 0;
+
+        const Array<Interval> intervals = temporalConditionSolver.solve(
+            [this, &conditionEvaluationCount](const Instant& anInstant) -> bool
+            {
+                ++conditionEvaluationCount;
+                return condition_(anInstant);
+            },
+            interval_
+        );
+
+        const TemporalConditionSolver::Statistics statistics = temporalConditionSolver.getStatistics();
+
+        EXPECT_EQ(conditionEvaluationCount, statistics.conditionEvaluationCount);
+        // The last interval is closed by the end of the analysis interval, without refinement
+        EXPECT_EQ(2 * intervals.getSize() - 1, statistics.rootSolverCallCount);
+        EXPECT_LT(0, statistics.rootSolverIterationCount);
+        EXPECT_LE(Duration::Zero(), statistics.conditionEvaluationDuration);
+        EXPECT_LE(Duration::Zero(), statistics.rootSolverDuration);
+
+        temporalConditionSolver.resetStatistics();
+
+        EXPECT_EQ(0, temporalConditionSolver.getStatistics().conditionEvaluationCount);
+
+        temporalConditionSolver.disableStatistics();
+
+        EXPECT_FALSE(temporalConditionSolver.isStatisticsEnabled());
+    }
+
+    {
+        // Copies share the statistics, and record them concurrently
+
+        TemporalConditionSolver temporalConditionSolver = temporalConditionSolver_;
+
+        temporalConditionSolver.enableStatistics();
+
+        temporalConditionSolver.solve(condition_, interval_);
+
+        const TemporalConditionSolver::Statistics referenceStatistics = temporalConditionSolver.getStatistics();
+
+        temporalConditionSolver.resetStatistics();
+
+        const Size threadCount = 4;
+
+        std::vector<std::thread> threads;
+
+        for (Size i = 0; i < threadCount; ++i)
+        {
+            threads.emplace_back(
+                [this, temporalConditionSolver]() -> void
+                {
+                    temporalConditionSolver.solve(condition_, interval_);
+                }
+            );
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        const TemporalConditionSolver::Statistics statistics = temporalConditionSolver.getStatistics();
+
+        EXPECT_EQ(threadCount * referenceStatistics.conditionEvaluationCount, statistics.conditionEvaluationCount);
+        EXPECT_EQ(threadCount * referenceStatistics.rootSolverCallCount, statistics.rootSolverCallCount);
+        EXPECT_EQ(threadCount * referenceStatistics.rootSolverIterationCount, statistics.rootSolverIterationCount);
+    }
+}
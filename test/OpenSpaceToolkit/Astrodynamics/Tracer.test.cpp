@@ -0,0 +1,170 @@
+/// Apache License 2.0
+
+#include <fstream>
+#include <sstream>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/RootSolver.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Tracer.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::filesystem::File;
+using ostk::core::filesystem::Path;
+using ostk::core::type::String;
+
+using ostk::astrodynamics::RootSolver;
+using ostk::astrodynamics::Tracer;
+
+class OpenSpaceToolkit_Astrodynamics_Tracer : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        Tracer::Disable();
+        Tracer::Clear();
+    }
+
+    void TearDown() override
+    {
+        Tracer::Disable();
+        Tracer::Clear();
+    }
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Tracer, Disabled)
+{
+    {
+        EXPECT_FALSE(Tracer::IsEnabled());
+
+        {
+            const Tracer::Span span("Span", "test");
+        }
+
+        EXPECT_TRUE(Tracer::GetEvents().isEmpty());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Tracer, Span)
+{
+    {
+        Tracer::Enable();
+
+        EXPECT_TRUE(Tracer::IsEnabled());
+
+        {
+            const Tracer::Span outerSpan("Outer", "test", "detail");
+
+            {
+                const Tracer::Span innerSpan("Inner", "test");
+            }
+        }
+
+        const Array<Tracer::Event> events = Tracer::GetEvents();
+
+        ASSERT_EQ(events.getSize(), 2);
+
+        // Events are recorded in order of completion
+
+        EXPECT_EQ(events[0].name, "Inner");
+        EXPECT_EQ(events[0].category, "test");
+        EXPECT_TRUE(events[0].detail.isEmpty());
+
+        EXPECT_EQ(events[1].name, "Outer");
+        EXPECT_EQ(events[1].detail, "detail");
+
+        EXPECT_LE(events[1].startTime, events[0].startTime);
+        EXPECT_GE(events[1].duration, events[0].duration);
+        EXPECT_EQ(events[0].threadIndex, events[1].threadIndex);
+    }
+
+    {
+        Tracer::Disable();
+
+        {
+            const Tracer::Span span("Span", "test");
+        }
+
+        EXPECT_EQ(Tracer::GetEvents().getSize(), 2);
+
+        Tracer::Clear();
+
+        EXPECT_TRUE(Tracer::GetEvents().isEmpty());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Tracer, MaximumEventCount)
+{
+    {
+        Tracer::Enable(2);
+
+        for (int index = 0; index < 5; ++index)
+        {
+            const Tracer::Span span("Span", "test");
+        }
+
+        EXPECT_EQ(Tracer::GetEvents().getSize(), 2);
+        EXPECT_EQ(Tracer::GetDroppedEventCount(), 3);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Tracer, RootSolver)
+{
+    {
+        Tracer::Enable();
+
+        RootSolver::Default().solve(
+            [](const double& x) -> double
+            {
+                return x * x - 4.0;
+            },
+            0.0,
+            5.0
+        );
+
+        const Array<Tracer::Event> events = Tracer::GetEvents();
+
+        ASSERT_EQ(events.getSize(), 1);
+        EXPECT_EQ(events[0].name, "RootSolver::solve");
+        EXPECT_EQ(events[0].category, "root solving");
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Tracer, ToChromeTrace)
+{
+    {
+        Tracer::Enable();
+
+        {
+            const Tracer::Span span("Span", "test", "a \"quoted\" detail");
+        }
+
+        const String chromeTrace = Tracer::ToChromeTrace();
+
+        EXPECT_EQ(chromeTrace.find("{\"traceEvents\":["), 0);
+        EXPECT_NE(chromeTrace.find("\"name\":\"Span\",\"cat\":\"test\",\"ph\":\"X\""), String::npos);
+        EXPECT_NE(chromeTrace.find("\"args\":{\"detail\":\"a \\\"quoted\\\" detail\"}"), String::npos);
+        EXPECT_NE(chromeTrace.find("\"droppedEventCount\":0"), String::npos);
+    }
+
+    {
+        const File file = File::Path(Path::Parse("/tmp/OpenSpaceToolkit_Astrodynamics_Tracer_ToChromeTrace.json"));
+
+        Tracer::Dump(file);
+
+        std::ifstream fileStream(file.getPath().toString());
+        std::stringstream buffer;
+        buffer << fileStream.rdbuf();
+
+        EXPECT_EQ(buffer.str(), Tracer::ToChromeTrace());
+    }
+
+    {
+        EXPECT_ANY_THROW(Tracer::Dump(File::Path(Path::Parse("/does/not/exist/trace.json"))));
+    }
+}
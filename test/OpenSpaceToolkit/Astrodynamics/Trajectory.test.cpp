@@ -520,6 +520,144 @@ TEST(OpenSpaceToolkit_Astrodynamics_Trajectory, GetStatesAt)
     }
 }
 
+TEST(OpenSpaceToolkit_Astrodynamics_Trajectory, GetEphemerisAt)
+{
+    using ostk::core::container::Array;
+    using ostk::core::type::Shared;
+    using ostk::core::type::Size;
+
+    using ostk::physics::coordinate::Frame;
+    using ostk::physics::coordinate::Position;
+    using ostk::physics::coordinate::Velocity;
+    using ostk::physics::time::DateTime;
+    using ostk::physics::time::Instant;
+    using ostk::physics::time::Scale;
+
+    using ostk::astrodynamics::Trajectory;
+    using ostk::astrodynamics::trajectory::Ephemeris;
+    using ostk::astrodynamics::trajectory::model::Tabulated;
+    using ostk::astrodynamics::trajectory::State;
+
+    {
+        const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+
+        const Array<State> states = {
+            {Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC),
+             Position::Meters({0.0, 0.0, 0.0}, gcrfSPtr),
+             Velocity::MetersPerSecond({1.0, 0.0, 0.0}, gcrfSPtr)},
+            {Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 2), Scale::UTC),
+             Position::Meters({2.0, 0.0, 0.0}, gcrfSPtr),
+             Velocity::MetersPerSecond({1.0, 0.0, 0.0}, gcrfSPtr)}
+        };
+
+        const Trajectory trajectory = {Tabulated(states)};
+
+        const Array<Instant> instants = {
+            Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0, 500), Scale::UTC),
+            states.at(1).accessInstant(),
+            states.at(0).accessInstant(),
+        };
+
+        const Ephemeris ephemeris = trajectory.getEphemerisAt(instants);
+
+        ASSERT_TRUE(ephemeris.isDefined());
+        ASSERT_EQ(instants.getSize(), ephemeris.getSize());
+
+        EXPECT_EQ(instants, ephemeris.accessInstants());
+        EXPECT_EQ(*gcrfSPtr, *ephemeris.accessFrame());
+
+        EXPECT_DOUBLE_EQ(0.5, ephemeris.accessPositions()(0, 0));
+        EXPECT_DOUBLE_EQ(2.0, ephemeris.accessPositions()(1, 0));
+        EXPECT_DOUBLE_EQ(0.0, ephemeris.accessPositions()(2, 0));
+
+        const Array<State> referenceStates = trajectory.getStatesAt(instants);
+
+        for (Size index = 0; index < instants.getSize(); ++index)
+        {
+            EXPECT_EQ(referenceStates[index], ephemeris.getStateAt(index));
+        }
+
+        EXPECT_FALSE(trajectory.getEphemerisAt(Array<Instant>::Empty()).isDefined());
+        EXPECT_ANY_THROW(trajectory.getEphemerisAt({Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 3), Scale::UTC)}));
+    }
+
+    {
+        EXPECT_ANY_THROW(Trajectory::Undefined().getEphemerisAt(
+            {Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC)}
+        ));
+    }
+}
+
+TEST(OpenSpaceToolkit_Astrodynamics_Trajectory, GetStateTableAt)
+{
+    using ostk::core::container::Array;
+    using ostk::core::type::Shared;
+    using ostk::core::type::Size;
+
+    using ostk::physics::coordinate::Frame;
+    using ostk::physics::coordinate::Position;
+    using ostk::physics::coordinate::Velocity;
+    using ostk::physics::time::DateTime;
+    using ostk::physics::time::Duration;
+    using ostk::physics::time::Instant;
+    using ostk::physics::time::Scale;
+
+    using ostk::astrodynamics::Trajectory;
+    using ostk::astrodynamics::trajectory::model::Tabulated;
+    using ostk::astrodynamics::trajectory::State;
+    using ostk::astrodynamics::trajectory::state::StateTable;
+
+    {
+        const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+
+        const Array<State> states = {
+            {Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC),
+             Position::Meters({0.0, 0.0, 0.0}, gcrfSPtr),
+             Velocity::MetersPerSecond({1.0, 0.0, 0.0}, gcrfSPtr)},
+            {Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 2), Scale::UTC),
+             Position::Meters({2.0, 0.0, 0.0}, gcrfSPtr),
+             Velocity::MetersPerSecond({1.0, 0.0, 0.0}, gcrfSPtr)}
+        };
+
+        const Trajectory trajectory = {Tabulated(states)};
+
+        const Instant epoch = states.at(0).accessInstant();
+
+        StateTable::OffsetVector offsets(3);
+        offsets << 500000000, 2000000000, 0;
+
+        const StateTable stateTable = trajectory.getStateTableAt(epoch, offsets);
+
+        ASSERT_TRUE(stateTable.isDefined());
+        ASSERT_EQ(3, stateTable.getSize());
+
+        EXPECT_EQ(epoch, stateTable.accessEpoch());
+        EXPECT_EQ(offsets, stateTable.accessOffsets());
+        EXPECT_EQ(*gcrfSPtr, *stateTable.accessFrame());
+
+        EXPECT_DOUBLE_EQ(0.5, stateTable.accessCoordinates()(0, 0));
+        EXPECT_DOUBLE_EQ(2.0, stateTable.accessCoordinates()(1, 0));
+        EXPECT_DOUBLE_EQ(0.0, stateTable.accessCoordinates()(2, 0));
+
+        const Array<State> referenceStates = trajectory.getStatesAt(stateTable.getInstants());
+
+        for (Size index = 0; index < stateTable.getSize(); ++index)
+        {
+            EXPECT_EQ(referenceStates[index], stateTable.getStateAt(index));
+        }
+
+        EXPECT_FALSE(trajectory.getStateTableAt(epoch, StateTable::OffsetVector::Zero(0)).isDefined());
+        EXPECT_ANY_THROW(trajectory.getStateTableAt(Instant::Undefined(), offsets));
+        EXPECT_ANY_THROW(trajectory.getStateTableAt(epoch + Duration::Seconds(3.0), offsets));
+    }
+
+    {
+        EXPECT_ANY_THROW(Trajectory::Undefined().getStateTableAt(
+            Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC), StateTable::OffsetVector::Zero(1)
+        ));
+    }
+}
+
 TEST(OpenSpaceToolkit_Astrodynamics_Trajectory, Print)
 {
     using ostk::core::container::Array;
@@ -0,0 +1,217 @@
+/// Apache License 2.0
+
+#include <cmath>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/CompactEphemeris.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Ephemeris.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::filesystem::File;
+using ostk::core::filesystem::Path;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+
+using ostk::astrodynamics::trajectory::CompactEphemeris;
+using ostk::astrodynamics::trajectory::Ephemeris;
+using ostk::astrodynamics::trajectory::State;
+
+class OpenSpaceToolkit_Astrodynamics_Trajectory_CompactEphemeris : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        // Circular orbit of 7000 km radius, sampled every minute
+
+        const double radius = 7000000.0;
+        const double angularRate = 2.0 * M_PI / 5828.5;
+
+        for (Size i = 0; i < 200; ++i)
+        {
+            const double angle = angularRate * 60.0 * i;
+
+            this->instants_.add(Instant::J2000() + Duration::Minutes(1.0 * i));
+
+            this->positions_.row(i) << radius * std::cos(angle), radius * std::sin(angle), 0.0;
+            this->velocities_.row(i) << -radius * angularRate * std::sin(angle),
+                radius * angularRate * std::cos(angle), 0.0;
+        }
+
+        this->ephemeris_ = {this->instants_, this->positions_, this->velocities_, Frame::GCRF()};
+    }
+
+    Array<Instant> instants_ = Array<Instant>::Empty();
+    MatrixXd positions_ = MatrixXd::Zero(200, 3);
+    MatrixXd velocities_ = MatrixXd::Zero(200, 3);
+    Ephemeris ephemeris_ = Ephemeris::Undefined();
+
+    const File file_ =
+        File::Path(Path::Parse("/tmp/OpenSpaceToolkit_Astrodynamics_Trajectory_CompactEphemeris.bin"));
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_CompactEphemeris, Constructor)
+{
+    {
+        const CompactEphemeris compactEphemeris = {this->ephemeris_};
+
+        EXPECT_TRUE(compactEphemeris.isDefined());
+        EXPECT_TRUE(compactEphemeris.hasVelocities());
+        EXPECT_EQ(200, compactEphemeris.getSize());
+        EXPECT_EQ(32, compactEphemeris.getBlockSize());
+        EXPECT_EQ(Frame::GCRF(), compactEphemeris.accessFrame());
+        EXPECT_EQ(
+            Interval::Closed(this->instants_.accessFirst(), this->instants_.accessLast()),
+            compactEphemeris.getInterval()
+        );
+        EXPECT_EQ(this->instants_, compactEphemeris.getInstants());
+    }
+
+    {
+        const CompactEphemeris compactEphemeris = {this->ephemeris_, 16, false};
+
+        EXPECT_FALSE(compactEphemeris.hasVelocities());
+        EXPECT_EQ(16, compactEphemeris.getBlockSize());
+        EXPECT_THROW(compactEphemeris.getVelocities(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(compactEphemeris.toEphemeris(), ostk::core::error::runtime::Undefined);
+    }
+
+    {
+        Array<Instant> unsortedInstants = this->instants_;
+        std::swap(unsortedInstants[3], unsortedInstants[4]);
+
+        EXPECT_THROW(
+            CompactEphemeris(Ephemeris(unsortedInstants, this->positions_, this->velocities_, Frame::GCRF())),
+            ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(CompactEphemeris(this->ephemeris_, 0), ostk::core::error::runtime::Wrong);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_CompactEphemeris, GetStorageSize)
+{
+    // 8 bytes of time offset and 12 bytes per position and velocity, against 56 bytes for a full precision ephemeris
+
+    EXPECT_LT(CompactEphemeris(this->ephemeris_).getStorageSize(), 200 * 34);
+    EXPECT_LT(CompactEphemeris(this->ephemeris_, 32, false).getStorageSize(), 200 * 21);
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_CompactEphemeris, GetStates)
+{
+    const CompactEphemeris compactEphemeris = {this->ephemeris_};
+
+    {
+        EXPECT_TRUE(compactEphemeris.getPositions().isApprox(this->positions_, 1e-7));
+        EXPECT_TRUE(compactEphemeris.getVelocities().isApprox(this->velocities_, 1e-7));
+        EXPECT_TRUE(compactEphemeris.toEphemeris().accessPositions().isApprox(this->positions_, 1e-7));
+    }
+
+    {
+        const Array<State> states = compactEphemeris.getStates();
+
+        ASSERT_EQ(200, states.getSize());
+
+        for (Size i = 0; i < states.getSize(); ++i)
+        {
+            EXPECT_EQ(this->instants_[i], states[i].accessInstant());
+            EXPECT_LT((states[i].getPosition().getCoordinates() - Vector3d(this->positions_.row(i))).norm(), 2.0);
+        }
+    }
+
+    {
+        const State state = CompactEphemeris(this->ephemeris_, 32, false).getStateAt(5);
+
+        EXPECT_EQ(3, state.getSize());
+        EXPECT_THROW(compactEphemeris.getStateAt(200), ostk::core::error::runtime::Wrong);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_CompactEphemeris, CalculateStatesAt)
+{
+    const CompactEphemeris compactEphemeris = {this->ephemeris_};
+
+    {
+        Array<Instant> instants = Array<Instant>::Empty();
+
+        for (Size i = 0; i < 150; ++i)
+        {
+            instants.add(this->instants_.accessFirst() + Duration::Seconds(79.3 * i));
+        }
+
+        const Array<State> states = compactEphemeris.calculateStatesAt(instants);
+        const MatrixXd positions = compactEphemeris.calculatePositionsAt(instants);
+
+        ASSERT_EQ(instants.getSize(), states.getSize());
+
+        for (Size i = 0; i < instants.getSize(); ++i)
+        {
+            EXPECT_EQ(instants[i], states[i].accessInstant());
+            EXPECT_EQ(6, states[i].getSize());
+            EXPECT_TRUE(states[i].getPosition().getCoordinates().isApprox(Vector3d(positions.row(i)), 1e-12));
+
+            // Linear interpolation over a minute of a circular orbit stays within a few kilometers
+
+            EXPECT_NEAR(7000000.0, positions.row(i).norm(), 5000.0);
+        }
+
+        EXPECT_EQ(
+            compactEphemeris.getStateAt(10).getPosition(),
+            compactEphemeris.calculateStatesAt({this->instants_[10]}).accessFirst().getPosition()
+        );
+    }
+
+    {
+        EXPECT_ANY_THROW(compactEphemeris.calculateStatesAt({this->instants_.accessFirst() - Duration::Seconds(1.0)}));
+        EXPECT_ANY_THROW(compactEphemeris.calculateStatesAt({this->instants_.accessLast() + Duration::Seconds(1.0)}));
+        EXPECT_ANY_THROW(compactEphemeris.calculateStatesAt({Instant::Undefined()}));
+        EXPECT_ANY_THROW(CompactEphemeris::Undefined().calculateStatesAt({this->instants_.accessFirst()}));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_CompactEphemeris, Save_Load)
+{
+    for (const bool storeVelocities : {true, false})
+    {
+        const CompactEphemeris compactEphemeris = {this->ephemeris_, 32, storeVelocities};
+
+        compactEphemeris.save(this->file_);
+
+        EXPECT_EQ(compactEphemeris, CompactEphemeris::Load(this->file_));
+
+        this->file_.remove();
+    }
+
+    {
+        EXPECT_ANY_THROW(CompactEphemeris::Load(this->file_));
+        EXPECT_ANY_THROW(CompactEphemeris::Undefined().save(this->file_));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_CompactEphemeris, Undefined)
+{
+    EXPECT_FALSE(CompactEphemeris::Undefined().isDefined());
+    EXPECT_EQ(0, CompactEphemeris::Undefined().getSize());
+    EXPECT_FALSE(CompactEphemeris::Undefined() == CompactEphemeris::Undefined());
+    EXPECT_THROW(CompactEphemeris::Undefined().accessFrame(), ostk::core::error::runtime::Undefined);
+}
@@ -0,0 +1,151 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Ephemeris.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+
+using ostk::astrodynamics::trajectory::Ephemeris;
+using ostk::astrodynamics::trajectory::State;
+
+class OpenSpaceToolkit_Astrodynamics_Trajectory_Ephemeris : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        for (Size i = 0; i < 4; ++i)
+        {
+            this->instants_.add(Instant::J2000() + Duration::Seconds(10.0 * i));
+
+            this->positions_.row(i) << 7000000.0 + i, 1.0 * i, 2.0 * i;
+            this->velocities_.row(i) << 0.0, 7546.0 + i, 3.0 * i;
+        }
+    }
+
+    Array<Instant> instants_ = Array<Instant>::Empty();
+    MatrixXd positions_ = MatrixXd::Zero(4, 3);
+    MatrixXd velocities_ = MatrixXd::Zero(4, 3);
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Ephemeris, Constructor)
+{
+    {
+        const Ephemeris ephemeris = {this->instants_, this->positions_, this->velocities_, Frame::GCRF()};
+
+        EXPECT_TRUE(ephemeris.isDefined());
+        EXPECT_EQ(this->instants_.getSize(), ephemeris.getSize());
+        EXPECT_EQ(this->instants_, ephemeris.accessInstants());
+        EXPECT_EQ(Frame::GCRF(), ephemeris.accessFrame());
+        EXPECT_EQ(this->positions_, ephemeris.accessPositions());
+        EXPECT_EQ(this->velocities_, ephemeris.accessVelocities());
+    }
+
+    {
+        EXPECT_THROW(
+            Ephemeris(this->instants_, MatrixXd::Zero(3, 3), this->velocities_, Frame::GCRF()),
+            ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            Ephemeris(this->instants_, this->positions_, MatrixXd::Zero(4, 6), Frame::GCRF()),
+            ostk::core::error::runtime::Wrong
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Ephemeris, EqualToOperator)
+{
+    const Ephemeris ephemeris = {this->instants_, this->positions_, this->velocities_, Frame::GCRF()};
+
+    EXPECT_TRUE(ephemeris == ephemeris);
+    EXPECT_FALSE(ephemeris != ephemeris);
+
+    EXPECT_FALSE(ephemeris == Ephemeris(this->instants_, this->positions_, this->velocities_, Frame::ITRF()));
+    EXPECT_FALSE(ephemeris == Ephemeris(this->instants_, 2.0 * this->positions_, this->velocities_, Frame::GCRF()));
+    EXPECT_FALSE(ephemeris == Ephemeris::Undefined());
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Ephemeris, GetStateAt)
+{
+    const Ephemeris ephemeris = {this->instants_, this->positions_, this->velocities_, Frame::GCRF()};
+
+    for (Size i = 0; i < this->instants_.getSize(); ++i)
+    {
+        const State state = ephemeris.getStateAt(i);
+
+        EXPECT_EQ(this->instants_[i], state.accessInstant());
+        EXPECT_EQ(Frame::GCRF(), state.accessFrame());
+        EXPECT_EQ(Vector3d(this->positions_.row(i).transpose()), state.accessPositionCoordinates());
+        EXPECT_EQ(Vector3d(this->velocities_.row(i).transpose()), state.accessVelocityCoordinates());
+    }
+
+    EXPECT_THROW(ephemeris.getStateAt(this->instants_.getSize()), ostk::core::error::runtime::Wrong);
+    EXPECT_THROW(Ephemeris::Undefined().getStateAt(0), ostk::core::error::runtime::Undefined);
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Ephemeris, GetStates)
+{
+    const Ephemeris ephemeris = {this->instants_, this->positions_, this->velocities_, Frame::GCRF()};
+
+    const Array<State> states = ephemeris.getStates();
+
+    ASSERT_EQ(this->instants_.getSize(), states.getSize());
+
+    for (Size i = 0; i < states.getSize(); ++i)
+    {
+        EXPECT_EQ(ephemeris.getStateAt(i), states[i]);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Ephemeris, Undefined)
+{
+    EXPECT_FALSE(Ephemeris::Undefined().isDefined());
+    EXPECT_EQ(0, Ephemeris::Undefined().getSize());
+    EXPECT_THROW(Ephemeris::Undefined().accessFrame(), ostk::core::error::runtime::Undefined);
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Ephemeris, FromStates)
+{
+    const Ephemeris ephemeris = {this->instants_, this->positions_, this->velocities_, Frame::GCRF()};
+
+    {
+        EXPECT_EQ(ephemeris, Ephemeris::FromStates(ephemeris.getStates()));
+    }
+
+    {
+        Array<State> states = ephemeris.getStates();
+        states[1] = states[1].inFrame(Frame::ITRF());
+
+        const Ephemeris ephemerisFromStates = Ephemeris::FromStates(states);
+
+        EXPECT_EQ(Frame::GCRF(), ephemerisFromStates.accessFrame());
+        EXPECT_TRUE(ephemerisFromStates.accessPositions().isApprox(this->positions_, 1e-12));
+        EXPECT_TRUE(ephemerisFromStates.accessVelocities().isApprox(this->velocities_, 1e-12));
+    }
+
+    {
+        EXPECT_FALSE(Ephemeris::FromStates(Array<State>::Empty()).isDefined());
+        EXPECT_THROW(Ephemeris::FromStates({State::Undefined()}), ostk::core::error::runtime::Undefined);
+    }
+}
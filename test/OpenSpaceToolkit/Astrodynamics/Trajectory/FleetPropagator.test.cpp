@@ -0,0 +1,289 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Velocity.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Moon.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Sun.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/AtmosphericDrag.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/CentralBodyGravity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/PositionDerivative.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/SolarRadiationPressure.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/ThirdBodyGravity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/FleetPropagator.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/NumericalSolver.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Real;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Velocity;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::environment::object::celestial::Earth;
+using ostk::physics::environment::object::celestial::Moon;
+using ostk::physics::environment::object::celestial::Sun;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::time::Scale;
+using ostk::physics::unit::Length;
+
+using ostk::astrodynamics::Dynamics;
+using ostk::astrodynamics::dynamics::AtmosphericDrag;
+using ostk::astrodynamics::dynamics::CentralBodyGravity;
+using ostk::astrodynamics::dynamics::PositionDerivative;
+using ostk::astrodynamics::dynamics::SolarRadiationPressure;
+using ostk::astrodynamics::dynamics::ThirdBodyGravity;
+using ostk::astrodynamics::trajectory::FleetPropagator;
+using ostk::astrodynamics::trajectory::Propagator;
+using ostk::astrodynamics::trajectory::State;
+using ostk::astrodynamics::trajectory::state::NumericalSolver;
+
+class OpenSpaceToolkit_Astrodynamics_Trajectory_FleetPropagator : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        this->propagator_ = {
+            numericalSolver_,
+            {
+                std::make_shared<PositionDerivative>(),
+                std::make_shared<CentralBodyGravity>(earthSPtr_),
+                std::make_shared<ThirdBodyGravity>(sunSPtr_),
+                std::make_shared<ThirdBodyGravity>(moonSPtr_),
+            },
+        };
+
+        this->fleetPropagator_ = {propagator_, nullptr, Duration::Days(1.0), 2};
+
+        // Three satellites on different orbits, at the same epoch
+
+        const Array<Vector3d> positions = {
+            {7000.0e3, 0.0, 0.0},
+            {0.0, 7200.0e3, 0.0},
+            {-4949.7e3, -4949.7e3, 0.0},
+        };
+
+        const Array<Vector3d> velocities = {
+            {0.0, 5335.865450622126, 5335.865450622126},
+            {-7440.0, 0.0, 0.0},
+            {3792.0, -3792.0, 5000.0},
+        };
+
+        for (Size i = 0; i < positions.getSize(); ++i)
+        {
+            this->states_.add(State(
+                startInstant_,
+                Position::Meters(positions[i], Frame::GCRF()),
+                Velocity::MetersPerSecond(velocities[i], Frame::GCRF())
+            ));
+        }
+
+        for (Size i = 1; i <= 6; ++i)
+        {
+            this->instants_.add(startInstant_ + Duration::Hours(Real(i)));
+        }
+    }
+
+    const NumericalSolver numericalSolver_ = {
+        NumericalSolver::LogType::NoLog,
+        NumericalSolver::StepperType::RungeKuttaFehlberg78,
+        5.0,
+        1.0e-12,
+        1.0e-12,
+    };
+
+    const Instant startInstant_ = Instant::DateTime(DateTime(2021, 3, 20, 12, 0, 0), Scale::UTC);
+
+    const Shared<const Celestial> earthSPtr_ = std::make_shared<Celestial>(Earth::Spherical());
+    const Shared<const Celestial> sunSPtr_ = std::make_shared<Celestial>(Sun::Spherical());
+    const Shared<const Celestial> moonSPtr_ = std::make_shared<Celestial>(Moon::Spherical());
+
+    Propagator propagator_ = Propagator::Undefined();
+    FleetPropagator fleetPropagator_ = FleetPropagator::Undefined();
+
+    Array<State> states_ = Array<State>::Empty();
+    Array<Instant> instants_ = Array<Instant>::Empty();
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_FleetPropagator, Constructor)
+{
+    {
+        EXPECT_NO_THROW(FleetPropagator fleetPropagator(propagator_));
+    }
+
+    {
+        const Shared<const AtmosphericDrag::DensityTable> densityTableSPtr =
+            std::make_shared<AtmosphericDrag::DensityTable>(
+                earthSPtr_, startInstant_, Length::Kilometers(200.0), Length::Kilometers(1000.0)
+            );
+
+        EXPECT_NO_THROW(FleetPropagator fleetPropagator(propagator_, densityTableSPtr, Duration::Hours(12.0), 4));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_FleetPropagator, StreamOperator)
+{
+    {
+        testing::internal::CaptureStdout();
+
+        EXPECT_NO_THROW(std::cout << fleetPropagator_ << std::endl);
+
+        EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_FleetPropagator, IsDefined)
+{
+    {
+        EXPECT_TRUE(fleetPropagator_.isDefined());
+    }
+
+    {
+        EXPECT_FALSE(FleetPropagator::Undefined().isDefined());
+        EXPECT_FALSE(FleetPropagator(propagator_, nullptr, Duration::Undefined()).isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_FleetPropagator, Getters)
+{
+    {
+        EXPECT_EQ(propagator_, fleetPropagator_.accessPropagator());
+        EXPECT_EQ(nullptr, fleetPropagator_.getDensityTable());
+        EXPECT_EQ(Duration::Days(1.0), fleetPropagator_.getEphemerisSegmentDuration());
+        EXPECT_EQ(2, fleetPropagator_.getThreadCount());
+    }
+
+    {
+        EXPECT_ANY_THROW(FleetPropagator::Undefined().accessPropagator());
+        EXPECT_ANY_THROW(FleetPropagator::Undefined().getDensityTable());
+        EXPECT_ANY_THROW(FleetPropagator::Undefined().getEphemerisSegmentDuration());
+        EXPECT_ANY_THROW(FleetPropagator::Undefined().getThreadCount());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_FleetPropagator, GetSharedEnvironmentPropagator)
+{
+    const Interval interval = Interval::Closed(startInstant_, startInstant_ + Duration::Hours(6.0));
+
+    {
+        const Shared<const ThirdBodyGravity::EphemerisTable> moonEphemerisTableSPtr =
+            std::make_shared<ThirdBodyGravity::EphemerisTable>(moonSPtr_, interval, Frame::GCRF());
+
+        const Propagator propagator = {
+            numericalSolver_,
+            {
+                std::make_shared<PositionDerivative>(),
+                std::make_shared<CentralBodyGravity>(earthSPtr_),
+                std::make_shared<ThirdBodyGravity>(sunSPtr_),
+                std::make_shared<ThirdBodyGravity>(moonSPtr_, moonEphemerisTableSPtr),
+                std::make_shared<SolarRadiationPressure>(sunSPtr_, earthSPtr_, 1.5),
+            },
+        };
+
+        const FleetPropagator fleetPropagator = {propagator};
+
+        const Propagator sharedEnvironmentPropagator = fleetPropagator.getSharedEnvironmentPropagator(interval);
+
+        const Array<Shared<Dynamics>> dynamics = sharedEnvironmentPropagator.getDynamics();
+
+        ASSERT_EQ(propagator.getDynamics().getSize(), dynamics.getSize());
+
+        const Shared<const ThirdBodyGravity> sunGravitySPtr = std::dynamic_pointer_cast<ThirdBodyGravity>(dynamics[2]);
+        const Shared<const ThirdBodyGravity> moonGravitySPtr = std::dynamic_pointer_cast<ThirdBodyGravity>(dynamics[3]);
+        const Shared<const SolarRadiationPressure> solarRadiationPressureSPtr =
+            std::dynamic_pointer_cast<SolarRadiationPressure>(dynamics[4]);
+
+        ASSERT_NE(nullptr, sunGravitySPtr);
+        ASSERT_NE(nullptr, moonGravitySPtr);
+        ASSERT_NE(nullptr, solarRadiationPressureSPtr);
+
+        EXPECT_NE(nullptr, sunGravitySPtr->getEphemerisTable());
+        EXPECT_EQ(sunGravitySPtr->getEphemerisTable(), solarRadiationPressureSPtr->getSunEphemerisTable());
+        EXPECT_EQ(moonEphemerisTableSPtr, moonGravitySPtr->getEphemerisTable());
+        EXPECT_DOUBLE_EQ(1.5, solarRadiationPressureSPtr->getReflectivityCoefficient());
+
+        EXPECT_EQ(propagator.getDynamics()[0], dynamics[0]);
+        EXPECT_EQ(propagator.getDynamics()[1], dynamics[1]);
+
+        // The original propagator is left untouched
+
+        EXPECT_EQ(
+            nullptr, std::dynamic_pointer_cast<ThirdBodyGravity>(propagator.getDynamics()[2])->getEphemerisTable()
+        );
+    }
+
+    {
+        EXPECT_ANY_THROW(FleetPropagator::Undefined().getSharedEnvironmentPropagator(interval));
+        EXPECT_ANY_THROW(fleetPropagator_.getSharedEnvironmentPropagator(Interval::Undefined()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_FleetPropagator, CalculateStatesAt)
+{
+    {
+        const Array<Array<State>> fleetStates = fleetPropagator_.calculateStatesAt(states_, instants_);
+
+        ASSERT_EQ(states_.getSize(), fleetStates.getSize());
+
+        for (Size i = 0; i < states_.getSize(); ++i)
+        {
+            const Array<State> referenceStates = propagator_.calculateStatesAt(states_[i], instants_);
+
+            ASSERT_EQ(instants_.getSize(), fleetStates[i].getSize());
+
+            for (Size j = 0; j < instants_.getSize(); ++j)
+            {
+                EXPECT_EQ(instants_[j], fleetStates[i][j].accessInstant());
+
+                const Vector3d positionDifference = fleetStates[i][j].getPosition().getCoordinates() -
+                                                    referenceStates[j].getPosition().getCoordinates();
+
+                EXPECT_LT(positionDifference.norm(), 1e-2);
+            }
+        }
+    }
+
+    {
+        EXPECT_TRUE(fleetPropagator_.calculateStatesAt(Array<State>::Empty(), instants_).isEmpty());
+
+        const Array<Array<State>> fleetStates = fleetPropagator_.calculateStatesAt(states_, Array<Instant>::Empty());
+
+        ASSERT_EQ(states_.getSize(), fleetStates.getSize());
+
+        for (const Array<State>& states : fleetStates)
+        {
+            EXPECT_TRUE(states.isEmpty());
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(FleetPropagator::Undefined().calculateStatesAt(states_, instants_));
+        EXPECT_ANY_THROW(fleetPropagator_.calculateStatesAt({states_[0], State::Undefined()}, instants_));
+    }
+}
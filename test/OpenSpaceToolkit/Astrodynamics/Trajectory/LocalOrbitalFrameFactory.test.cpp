@@ -1,10 +1,13 @@
 /// Apache License 2.0
 
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/Quaternion.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
@@ -18,14 +21,18 @@
 
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/LocalOrbitalFrameFactory.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/LocalOrbitalFrameTransformProvider.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
 
 #include <Global.test.hpp>
 
+using ostk::core::container::Array;
 using ostk::core::type::Real;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 
 using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+using ostk::mathematics::object::Matrix3d;
 using ostk::mathematics::object::Vector3d;
 using ostk::mathematics::object::VectorXd;
 
@@ -44,6 +51,7 @@ using ostk::physics::coordinate::Transform;
 
 using ostk::astrodynamics::trajectory::LocalOrbitalFrameFactory;
 using ostk::astrodynamics::trajectory::LocalOrbitalFrameTransformProvider;
+using ostk::astrodynamics::trajectory::State;
 
 class OpenSpaceToolkit_Astrodynamics_Trajectory_LocalOrbitalFrameFactory : public ::testing::Test
 {
@@ -146,3 +154,91 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_LocalOrbitalFrameFactory, Gener
         EXPECT_ANY_THROW(localOrbitalFrame->getTransformTo(gcrfSPtr_, Instant::J2000()));
     }
 }
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_LocalOrbitalFrameFactory, GenerateTransform)
+{
+    {
+        for (const auto& localOrbitalFrameFactorySPtr :
+             {LocalOrbitalFrameFactory::NED(gcrfSPtr_),
+              LocalOrbitalFrameFactory::LVLH(gcrfSPtr_),
+              LocalOrbitalFrameFactory::VVLH(gcrfSPtr_),
+              LocalOrbitalFrameFactory::QSW(gcrfSPtr_),
+              LocalOrbitalFrameFactory::TNW(gcrfSPtr_),
+              LocalOrbitalFrameFactory::VNC(gcrfSPtr_)})
+        {
+            const Transform transform =
+                localOrbitalFrameFactorySPtr->generateTransform(instant_, position_, velocity_);
+
+            const Shared<const Frame> localOrbitalFrame =
+                localOrbitalFrameFactorySPtr->generateFrame(instant_, position_, velocity_);
+
+            const Transform referenceTransform = gcrfSPtr_->getTransformTo(localOrbitalFrame, instant_);
+
+            EXPECT_TRUE(transform.getOrientation().isNear(referenceTransform.getOrientation(), Angle::Radians(1e-12)));
+            EXPECT_TRUE(transform.getTranslation().isNear(referenceTransform.getTranslation(), 1e-6));
+
+            // Repeated requests are served from the cache
+
+            EXPECT_EQ(transform, localOrbitalFrameFactorySPtr->generateTransform(instant_, position_, velocity_));
+        }
+    }
+
+    {
+        const Transform transform = LOFFactorySPtr_->generateTransform(instant_, position_, velocity_);
+        const Transform otherTransform =
+            LocalOrbitalFrameFactory::QSW(gcrfSPtr_)->generateTransform(instant_, position_, velocity_);
+
+        EXPECT_FALSE(transform.getOrientation().isNear(otherTransform.getOrientation(), Angle::Radians(1e-6)));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_LocalOrbitalFrameFactory, GenerateRotationMatrices)
+{
+    const Array<State> states = {
+        State(instant_, Position::Meters(position_, gcrfSPtr_), Velocity::MetersPerSecond(velocity_, gcrfSPtr_)),
+        State(
+            instant_ + Duration::Minutes(1.0),
+            Position::Meters({0.0, 7000000.0, 0.0}, gcrfSPtr_),
+            Velocity::MetersPerSecond({-7500.0, 0.0, 10.0}, gcrfSPtr_)
+        ),
+    };
+
+    {
+        for (const auto& localOrbitalFrameFactorySPtr :
+             {LocalOrbitalFrameFactory::NED(gcrfSPtr_),
+              LocalOrbitalFrameFactory::LVLH(gcrfSPtr_),
+              LocalOrbitalFrameFactory::VVLH(gcrfSPtr_),
+              LocalOrbitalFrameFactory::QSW(gcrfSPtr_),
+              LocalOrbitalFrameFactory::TNW(gcrfSPtr_),
+              LocalOrbitalFrameFactory::VNC(gcrfSPtr_)})
+        {
+            const Array<Matrix3d> rotationMatrices = localOrbitalFrameFactorySPtr->generateRotationMatrices(states);
+
+            ASSERT_EQ(states.getSize(), rotationMatrices.getSize());
+
+            for (Size i = 0; i < states.getSize(); ++i)
+            {
+                const Quaternion orientation =
+                    localOrbitalFrameFactorySPtr
+                        ->generateTransform(
+                            states[i].accessInstant(),
+                            states[i].getPosition().accessCoordinates(),
+                            states[i].getVelocity().accessCoordinates()
+                        )
+                        .getOrientation();
+
+                for (const Vector3d& vector : {Vector3d {1.0, 2.0, 3.0}, Vector3d {-4.0, 0.5, 1.0}})
+                {
+                    EXPECT_TRUE((rotationMatrices[i] * vector).isNear(orientation.rotateVector(vector), 1e-12));
+                }
+            }
+        }
+    }
+
+    {
+        EXPECT_TRUE(LOFFactorySPtr_->generateRotationMatrices(Array<State>::Empty()).isEmpty());
+
+        EXPECT_ANY_THROW(LocalOrbitalFrameFactory::Undefined()->generateRotationMatrices(states));
+        EXPECT_ANY_THROW(LOFFactorySPtr_->generateRotationMatrices({State::Undefined()}));
+    }
+}
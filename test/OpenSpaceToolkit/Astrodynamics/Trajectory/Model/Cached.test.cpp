@@ -0,0 +1,203 @@
+/// Apache License 2.0
+
+#include <thread>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Model/Cached.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/SGP4.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/SGP4/TLE.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+
+using ostk::astrodynamics::Trajectory;
+using ostk::astrodynamics::trajectory::model::Cached;
+using ostk::astrodynamics::trajectory::orbit::model::SGP4;
+using ostk::astrodynamics::trajectory::orbit::model::sgp4::TLE;
+using ostk::astrodynamics::trajectory::State;
+
+class OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Cached : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        for (Index minute = 0; minute < 10; ++minute)
+        {
+            this->instants_.add(this->tle_.getEpoch() + Duration::Minutes(double(minute)));
+        }
+    }
+
+    const TLE tle_ = {
+        "1 39419U 13066D   18248.44969859 -.00000394  00000-0 -31796-4 0  9997",
+        "2 39419  97.6313 314.6863 0012643 218.7350 141.2966 14.93878994260975"
+    };
+
+    const Trajectory trajectory_ = {SGP4(tle_)};
+
+    Array<Instant> instants_ = Array<Instant>::Empty();
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Cached, Constructor)
+{
+    {
+        const Cached cached = {this->trajectory_};
+
+        EXPECT_TRUE(cached.isDefined());
+        EXPECT_EQ(Cached::DefaultCapacity, cached.getCapacity());
+        EXPECT_EQ(0, cached.getSize());
+        EXPECT_EQ(this->trajectory_, cached.accessTrajectory());
+    }
+
+    {
+        EXPECT_FALSE(Cached(Trajectory::Undefined()).isDefined());
+    }
+
+    {
+        EXPECT_ANY_THROW(Cached(this->trajectory_, 0));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Cached, EqualToOperator)
+{
+    const Cached cached = {this->trajectory_, 16};
+
+    EXPECT_TRUE(cached == cached);
+    EXPECT_FALSE(cached != cached);
+
+    EXPECT_TRUE(cached == Cached(this->trajectory_, 16));
+    EXPECT_FALSE(cached == Cached(this->trajectory_, 32));
+    EXPECT_FALSE(cached == Cached(Trajectory::Undefined(), 16));
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Cached, CalculateStatesAt)
+{
+    {
+        const Cached cached = {this->trajectory_};
+
+        const Array<State> states = cached.calculateStatesAt(this->instants_);
+
+        ASSERT_EQ(this->instants_.getSize(), states.getSize());
+
+        for (Index index = 0; index < this->instants_.getSize(); ++index)
+        {
+            EXPECT_EQ(this->trajectory_.getStateAt(this->instants_[index]), states[index]);
+        }
+
+        EXPECT_EQ(this->instants_.getSize(), cached.getSize());
+        EXPECT_EQ(0, cached.getHitCount());
+        EXPECT_EQ(this->instants_.getSize(), cached.getMissCount());
+
+        // Cached states are reused, missing ones are calculated
+
+        const Instant laterInstant = this->instants_.accessLast() + Duration::Minutes(1.0);
+
+        EXPECT_EQ(states[3], cached.calculateStateAt(this->instants_[3]));
+        EXPECT_EQ(
+            Array<State>({states[0], this->trajectory_.getStateAt(laterInstant)}),
+            cached.calculateStatesAt({this->instants_[0], laterInstant})
+        );
+
+        EXPECT_EQ(this->instants_.getSize() + 1, cached.getSize());
+        EXPECT_EQ(2, cached.getHitCount());
+        EXPECT_EQ(this->instants_.getSize() + 1, cached.getMissCount());
+
+        cached.clear();
+
+        EXPECT_EQ(0, cached.getSize());
+        EXPECT_EQ(0, cached.getHitCount());
+        EXPECT_EQ(0, cached.getMissCount());
+    }
+
+    // Least recently used states are evicted
+
+    {
+        const Cached cached = {this->trajectory_, 4};
+
+        cached.calculateStatesAt({this->instants_[0], this->instants_[1], this->instants_[2], this->instants_[3]});
+        cached.calculateStateAt(this->instants_[0]);
+        cached.calculateStateAt(this->instants_[4]);
+
+        EXPECT_EQ(4, cached.getSize());
+        EXPECT_EQ(1, cached.getHitCount());
+
+        cached.calculateStateAt(this->instants_[0]);
+
+        EXPECT_EQ(2, cached.getHitCount());
+
+        cached.calculateStateAt(this->instants_[1]);
+
+        EXPECT_EQ(2, cached.getHitCount());
+        EXPECT_EQ(6, cached.getMissCount());
+    }
+
+    {
+        EXPECT_ANY_THROW(Cached(this->trajectory_).calculateStateAt(Instant::Undefined()));
+        EXPECT_ANY_THROW(Cached(Trajectory::Undefined()).calculateStatesAt(this->instants_));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Cached, SharedCache)
+{
+    // Copies of a trajectory share the cache of its model
+
+    const Trajectory trajectory = {Cached(this->trajectory_)};
+    const Trajectory trajectoryCopy = trajectory;
+
+    const Array<State> states = trajectory.getStatesAt(this->instants_);
+
+    EXPECT_EQ(states, trajectoryCopy.getStatesAt(this->instants_));
+
+    const Cached& cached = trajectoryCopy.accessModel().as<Cached>();
+
+    EXPECT_EQ(this->instants_.getSize(), cached.getHitCount());
+    EXPECT_EQ(this->instants_.getSize(), cached.getMissCount());
+
+    // Concurrent calls are supported
+
+    Array<std::thread> threads = Array<std::thread>::Empty();
+
+    for (Index threadIndex = 0; threadIndex < 4; ++threadIndex)
+    {
+        threads.add(std::thread(
+            [&trajectory, &states, this]() -> void
+            {
+                for (Index index = 0; index < this->instants_.getSize(); ++index)
+                {
+                    EXPECT_EQ(states[index], trajectory.getStateAt(this->instants_[index]));
+                }
+            }
+        ));
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(this->instants_.getSize(), cached.getMissCount());
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Cached, Print)
+{
+    const Cached cached = {this->trajectory_};
+
+    testing::internal::CaptureStdout();
+
+    EXPECT_NO_THROW(cached.print(std::cout, true));
+    EXPECT_NO_THROW(cached.print(std::cout, false));
+    EXPECT_NO_THROW(std::cout << cached << std::endl);
+
+    EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+}
@@ -0,0 +1,222 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Velocity.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/CentralBodyGravity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/PositionDerivative.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Model/Chebyshev.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/NumericalSolver.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Shared;
+
+using ostk::mathematics::object::MatrixXd;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Velocity;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::environment::object::celestial::Earth;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::time::Scale;
+using ostk::physics::unit::Length;
+
+using ostk::astrodynamics::dynamics::CentralBodyGravity;
+using ostk::astrodynamics::dynamics::PositionDerivative;
+using ostk::astrodynamics::trajectory::model::Chebyshev;
+using ostk::astrodynamics::trajectory::Propagator;
+using ostk::astrodynamics::trajectory::State;
+using ostk::astrodynamics::trajectory::state::NumericalSolver;
+
+class OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Chebyshev : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        this->propagator_ = {
+            NumericalSolver::Default(),
+            {
+                std::make_shared<PositionDerivative>(),
+                std::make_shared<CentralBodyGravity>(std::make_shared<Celestial>(Earth::Spherical())),
+            },
+        };
+
+        this->chebyshev_ = Chebyshev::Fit(this->propagator_, this->state_, this->interval_, Length::Meters(1.0));
+    }
+
+    const Instant startInstant_ = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+    const Interval interval_ = Interval::Closed(startInstant_, startInstant_ + Duration::Hours(3.0));
+
+    const State state_ = {
+        startInstant_,
+        Position::Meters({7000000.0, 0.0, 0.0}, Frame::GCRF()),
+        Velocity::MetersPerSecond({0.0, 5335.865450622126, 5335.865450622126}, Frame::GCRF()),
+    };
+
+    Propagator propagator_ = Propagator::Undefined();
+    Chebyshev chebyshev_ = Chebyshev::Undefined();
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Chebyshev, Constructor)
+{
+    {
+        EXPECT_TRUE(this->chebyshev_.isDefined());
+        EXPECT_FALSE(Chebyshev::Undefined().isDefined());
+    }
+
+    {
+        const Chebyshev::Segment segment = {
+            this->startInstant_,
+            Duration::Minutes(10.0),
+            MatrixXd::Zero(3, 4),
+            MatrixXd::Zero(3, 4),
+        };
+
+        EXPECT_NO_THROW(Chebyshev({segment}, Frame::GCRF()));
+
+        EXPECT_ANY_THROW(Chebyshev({segment}, nullptr));
+        EXPECT_ANY_THROW(Chebyshev({segment, segment}, Frame::GCRF()));
+        EXPECT_ANY_THROW(Chebyshev(
+            {{this->startInstant_, Duration::Zero(), MatrixXd::Zero(3, 4), MatrixXd::Zero(3, 4)}}, Frame::GCRF()
+        ));
+        EXPECT_ANY_THROW(Chebyshev(
+            {{this->startInstant_, Duration::Minutes(10.0), MatrixXd::Zero(3, 4), MatrixXd::Zero(3, 5)}},
+            Frame::GCRF()
+        ));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Chebyshev, Getters)
+{
+    {
+        EXPECT_EQ(this->interval_, this->chebyshev_.getInterval());
+        EXPECT_EQ(Frame::GCRF(), this->chebyshev_.getFrame());
+        EXPECT_EQ(12, this->chebyshev_.getDegree());
+        EXPECT_EQ(this->chebyshev_.getSegmentCount(), this->chebyshev_.accessSegments().getSize());
+
+        // A few segments per revolution, instead of hundreds of tabulated states
+
+        EXPECT_GT(this->chebyshev_.getSegmentCount(), 1);
+        EXPECT_LT(this->chebyshev_.getSegmentCount(), 100);
+    }
+
+    {
+        EXPECT_ANY_THROW(Chebyshev::Undefined().getInterval());
+        EXPECT_ANY_THROW(Chebyshev::Undefined().getFrame());
+        EXPECT_ANY_THROW(Chebyshev::Undefined().getDegree());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Chebyshev, CalculateStatesAt)
+{
+    {
+        const Array<Instant> instants = this->interval_.generateGrid(Duration::Seconds(37.0));
+
+        const Array<State> referenceStates = this->propagator_.calculateStatesAt(this->state_, instants);
+        const Array<State> states = this->chebyshev_.calculateStatesAt(instants);
+
+        ASSERT_EQ(instants.getSize(), states.getSize());
+
+        for (Index i = 0; i < instants.getSize(); ++i)
+        {
+            EXPECT_EQ(instants[i], states[i].accessInstant());
+            EXPECT_EQ(Frame::GCRF(), states[i].accessFrame());
+
+            EXPECT_LT(
+                (states[i].getPosition().getCoordinates() - referenceStates[i].getPosition().getCoordinates()).norm(),
+                2.0
+            );
+            EXPECT_LT(
+                (states[i].getVelocity().getCoordinates() - referenceStates[i].getVelocity().getCoordinates()).norm(),
+                1e-2
+            );
+        }
+
+        for (Index i = 0; i < instants.getSize(); i += 17)
+        {
+            EXPECT_EQ(states[i], this->chebyshev_.calculateStateAt(instants[i]));
+        }
+    }
+
+    {
+        EXPECT_TRUE(this->chebyshev_.calculateStatesAt(Array<Instant>::Empty()).isEmpty());
+    }
+
+    {
+        EXPECT_ANY_THROW(this->chebyshev_.calculateStateAt(Instant::Undefined()));
+        EXPECT_ANY_THROW(this->chebyshev_.calculateStateAt(this->startInstant_ - Duration::Seconds(1.0)));
+        EXPECT_ANY_THROW(this->chebyshev_.calculateStateAt(this->interval_.accessEnd() + Duration::Seconds(1.0)));
+        EXPECT_ANY_THROW(Chebyshev::Undefined().calculateStateAt(this->startInstant_));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Chebyshev, CalculateEphemerisAt)
+{
+    {
+        const Array<Instant> instants = this->interval_.generateGrid(Duration::Minutes(1.0));
+
+        const Array<State> states = this->chebyshev_.calculateStatesAt(instants);
+
+        EXPECT_EQ(states, this->chebyshev_.calculateEphemerisAt(instants).getStates());
+    }
+
+    {
+        EXPECT_FALSE(this->chebyshev_.calculateEphemerisAt(Array<Instant>::Empty()).isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Chebyshev, Fit)
+{
+    {
+        const Chebyshev chebyshev = Chebyshev::Fit(
+            this->propagator_, this->state_, this->interval_, Length::Meters(1.0), 12, Duration::Minutes(5.0)
+        );
+
+        for (const Chebyshev::Segment& segment : chebyshev.accessSegments())
+        {
+            EXPECT_LE(segment.duration, Duration::Minutes(5.0));
+        }
+
+        EXPECT_EQ(this->interval_, chebyshev.getInterval());
+    }
+
+    {
+        EXPECT_ANY_THROW(
+            Chebyshev::Fit(Propagator::Undefined(), this->state_, this->interval_, Length::Meters(1.0))
+        );
+        EXPECT_ANY_THROW(
+            Chebyshev::Fit(this->propagator_, State::Undefined(), this->interval_, Length::Meters(1.0))
+        );
+        EXPECT_ANY_THROW(
+            Chebyshev::Fit(this->propagator_, this->state_, Interval::Undefined(), Length::Meters(1.0))
+        );
+        EXPECT_ANY_THROW(Chebyshev::Fit(this->propagator_, this->state_, this->interval_, Length::Meters(0.0)));
+        EXPECT_ANY_THROW(Chebyshev::Fit(this->propagator_, this->state_, this->interval_, Length::Meters(1.0), 1));
+        EXPECT_ANY_THROW(
+            Chebyshev::Fit(this->propagator_, this->state_, this->interval_, Length::Meters(1.0), 12, Duration::Zero())
+        );
+    }
+}
@@ -0,0 +1,184 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Model/Piecewise.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/SGP4.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/SGP4/TLE.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+
+using ostk::astrodynamics::Trajectory;
+using ostk::astrodynamics::trajectory::model::Piecewise;
+using ostk::astrodynamics::trajectory::orbit::model::SGP4;
+using ostk::astrodynamics::trajectory::orbit::model::sgp4::TLE;
+using ostk::astrodynamics::trajectory::State;
+
+class OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Piecewise : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        this->laterTle_.setEpoch(this->tle_.getEpoch() + Duration::Days(1.0));
+    }
+
+    const TLE tle_ = {
+        "1 39419U 13066D   18248.44969859 -.00000394  00000-0 -31796-4 0  9997",
+        "2 39419  97.6313 314.6863 0012643 218.7350 141.2966 14.93878994260975"
+    };
+
+    TLE laterTle_ = tle_;
+
+    const Trajectory firstTrajectory_ = Trajectory::Position(Position::Meters({7.0e6, 0.0, 0.0}, Frame::GCRF()));
+    const Trajectory secondTrajectory_ = Trajectory::Position(Position::Meters({0.0, 7.0e6, 0.0}, Frame::GCRF()));
+    const Trajectory thirdTrajectory_ = Trajectory::Position(Position::Meters({0.0, 0.0, 7.0e6}, Frame::GCRF()));
+
+    const Instant firstSwitchInstant_ = tle_.getEpoch();
+    const Instant secondSwitchInstant_ = tle_.getEpoch() + Duration::Hours(1.0);
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Piecewise, Constructor)
+{
+    {
+        const Piecewise piecewise = {
+            {this->firstTrajectory_, this->secondTrajectory_, this->thirdTrajectory_},
+            {this->firstSwitchInstant_, this->secondSwitchInstant_},
+        };
+
+        EXPECT_TRUE(piecewise.isDefined());
+        EXPECT_EQ(3, piecewise.getPieceCount());
+        EXPECT_EQ(2, piecewise.accessSwitchInstants().getSize());
+    }
+
+    {
+        EXPECT_TRUE(Piecewise({this->firstTrajectory_}, Array<Instant>::Empty()).isDefined());
+        EXPECT_FALSE(Piecewise(Array<Trajectory>::Empty(), Array<Instant>::Empty()).isDefined());
+    }
+
+    {
+        EXPECT_ANY_THROW(Piecewise({this->firstTrajectory_, this->secondTrajectory_}, Array<Instant>::Empty()));
+        EXPECT_ANY_THROW(Piecewise(
+            {this->firstTrajectory_, this->secondTrajectory_, this->thirdTrajectory_},
+            {this->secondSwitchInstant_, this->firstSwitchInstant_}
+        ));
+        EXPECT_ANY_THROW(Piecewise({this->firstTrajectory_, Trajectory::Undefined()}, {this->firstSwitchInstant_}));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Piecewise, EqualToOperator)
+{
+    const Piecewise piecewise = {{this->firstTrajectory_, this->secondTrajectory_}, {this->firstSwitchInstant_}};
+
+    EXPECT_TRUE(piecewise == piecewise);
+    EXPECT_FALSE(piecewise != piecewise);
+
+    EXPECT_FALSE(
+        piecewise == Piecewise({this->firstTrajectory_, this->secondTrajectory_}, {this->secondSwitchInstant_})
+    );
+    EXPECT_FALSE(piecewise == Piecewise(Array<Trajectory>::Empty(), Array<Instant>::Empty()));
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Piecewise, GetPieceIndexAt)
+{
+    const Piecewise piecewise = {
+        {this->firstTrajectory_, this->secondTrajectory_, this->thirdTrajectory_},
+        {this->firstSwitchInstant_, this->secondSwitchInstant_},
+    };
+
+    EXPECT_EQ(0, piecewise.getPieceIndexAt(this->firstSwitchInstant_ - Duration::Days(10.0)));
+    EXPECT_EQ(1, piecewise.getPieceIndexAt(this->firstSwitchInstant_));
+    EXPECT_EQ(1, piecewise.getPieceIndexAt(this->firstSwitchInstant_ + Duration::Minutes(30.0)));
+    EXPECT_EQ(2, piecewise.getPieceIndexAt(this->secondSwitchInstant_));
+    EXPECT_EQ(2, piecewise.getPieceIndexAt(this->secondSwitchInstant_ + Duration::Days(10.0)));
+
+    EXPECT_EQ(this->secondTrajectory_, piecewise.accessTrajectoryAt(this->firstSwitchInstant_));
+
+    {
+        const Interval interval =
+            Interval::Closed(this->firstSwitchInstant_ - Duration::Minutes(1.0), this->secondSwitchInstant_);
+
+        EXPECT_EQ(Array<Instant>({this->firstSwitchInstant_}), piecewise.getSwitchInstantsWithin(interval));
+    }
+
+    {
+        EXPECT_ANY_THROW(piecewise.getPieceIndexAt(Instant::Undefined()));
+        EXPECT_ANY_THROW(
+            Piecewise(Array<Trajectory>::Empty(), Array<Instant>::Empty()).getPieceIndexAt(this->firstSwitchInstant_)
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Piecewise, CalculateStatesAt)
+{
+    const Piecewise piecewise = {
+        {this->firstTrajectory_, this->secondTrajectory_, this->thirdTrajectory_},
+        {this->firstSwitchInstant_, this->secondSwitchInstant_},
+    };
+
+    Array<Instant> instants = Array<Instant>::Empty();
+
+    for (int minute = -30; minute <= 90; minute += 10)
+    {
+        instants.add(this->firstSwitchInstant_ + Duration::Minutes(minute));
+    }
+
+    // Out of order instants are supported
+
+    instants.add(this->firstSwitchInstant_ - Duration::Minutes(5.0));
+
+    const Array<State> states = piecewise.calculateStatesAt(instants);
+
+    ASSERT_EQ(instants.getSize(), states.getSize());
+
+    for (Index index = 0; index < instants.getSize(); ++index)
+    {
+        EXPECT_EQ(instants[index], states[index].accessInstant());
+        EXPECT_EQ(piecewise.calculateStateAt(instants[index]), states[index]);
+        EXPECT_EQ(
+            piecewise.accessTrajectoryAt(instants[index]).getStateAt(instants[index]).getPosition(),
+            states[index].getPosition()
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Piecewise, TLEs)
+{
+    const Piecewise piecewise = Piecewise::TLEs({this->laterTle_, this->tle_});
+
+    EXPECT_EQ(2, piecewise.getPieceCount());
+    EXPECT_EQ(Array<Instant>({this->tle_.getEpoch() + Duration::Hours(12.0)}), piecewise.accessSwitchInstants());
+
+    EXPECT_EQ(Trajectory(SGP4(this->tle_)), piecewise.accessTrajectories()[0]);
+    EXPECT_EQ(Trajectory(SGP4(this->laterTle_)), piecewise.accessTrajectories()[1]);
+
+    {
+        const Trajectory trajectory = {piecewise};
+
+        const Instant instant = this->tle_.getEpoch() + Duration::Hours(18.0);
+
+        EXPECT_EQ(Trajectory(SGP4(this->laterTle_)).getStateAt(instant), trajectory.getStateAt(instant));
+    }
+
+    {
+        EXPECT_ANY_THROW(Piecewise::TLEs(Array<TLE>::Empty()));
+        EXPECT_ANY_THROW(Piecewise::TLEs({this->tle_, this->tle_}));
+    }
+}
@@ -0,0 +1,78 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Model/Static.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+
+using ostk::astrodynamics::trajectory::model::Static;
+using ostk::astrodynamics::trajectory::State;
+
+class OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Static : public ::testing::Test
+{
+   protected:
+    const Position position_ = Position::Meters({6378137.0, 0.0, 0.0}, Frame::ITRF());
+    const Static static_ = {position_};
+
+    const Instant instant_ = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Static, AccessPosition)
+{
+    {
+        EXPECT_EQ(this->position_, this->static_.accessPosition());
+    }
+
+    {
+        EXPECT_ANY_THROW(Static(Position::Undefined()).accessPosition());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Static, CalculateStatesAt)
+{
+    {
+        const Array<Instant> instants = {
+            this->instant_,
+            this->instant_ + Duration::Minutes(1.0),
+            this->instant_ + Duration::Hours(1.0),
+        };
+
+        const Array<State> states = this->static_.calculateStatesAt(instants);
+
+        ASSERT_EQ(instants.getSize(), states.getSize());
+
+        for (Index index = 0; index < instants.getSize(); ++index)
+        {
+            EXPECT_EQ(this->static_.calculateStateAt(instants[index]), states[index]);
+        }
+    }
+
+    {
+        EXPECT_TRUE(this->static_.calculateStatesAt(Array<Instant>::Empty()).isEmpty());
+    }
+
+    {
+        EXPECT_ANY_THROW(this->static_.calculateStatesAt({this->instant_, Instant::Undefined()}));
+        EXPECT_ANY_THROW(Static(Position::Undefined()).calculateStatesAt({this->instant_}));
+    }
+}
@@ -0,0 +1,383 @@
+/// Apache License 2.0
+
+#include <fstream>
+
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/CentralBodyGravity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/PositionDerivative.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Model/Tabulated.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/NumericalSolver.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::filesystem::File;
+using ostk::core::filesystem::Path;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::mathematics::curvefitting::Interpolator;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Velocity;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::environment::object::celestial::Earth;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::time::Scale;
+using ostk::physics::unit::Length;
+
+using ostk::astrodynamics::dynamics::CentralBodyGravity;
+using ostk::astrodynamics::dynamics::PositionDerivative;
+using ostk::astrodynamics::trajectory::model::Tabulated;
+using ostk::astrodynamics::trajectory::Propagator;
+using ostk::astrodynamics::trajectory::State;
+using ostk::astrodynamics::trajectory::state::NumericalSolver;
+
+class OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Tabulated : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+
+        for (Size i = 0; i < 100; ++i)
+        {
+            const double t = 60.0 * i;
+
+            this->states_.add({
+                this->epoch_ + Duration::Seconds(t),
+                Position::Meters({7.0e6 * std::cos(t / 900.0), 7.0e6 * std::sin(t / 900.0), 1.0e3 * t}, gcrfSPtr),
+                Velocity::MetersPerSecond(
+                    {-7.0e6 / 900.0 * std::sin(t / 900.0), 7.0e6 / 900.0 * std::cos(t / 900.0), 1.0e3}, gcrfSPtr
+                ),
+            });
+        }
+    }
+
+    const Instant epoch_ = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+    Array<State> states_ = Array<State>::Empty();
+    File ephemerisFile_ =
+        File::Path(Path::Parse("/tmp/OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Tabulated_Ephemeris.bin"));
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Tabulated, SaveEphemeris_LoadEphemeris)
+{
+    {
+        Tabulated::SaveEphemeris(states_, ephemerisFile_);
+
+        for (const auto& interpolationType :
+             {Interpolator::Type::Linear, Interpolator::Type::BarycentricRational, Interpolator::Type::CubicSpline})
+        {
+            const Tabulated tabulated = {states_, interpolationType};
+            const Tabulated loadedTabulated = Tabulated::LoadEphemeris(ephemerisFile_, interpolationType);
+
+            ASSERT_TRUE(loadedTabulated.isDefined());
+
+            EXPECT_EQ(tabulated.getInterval(), loadedTabulated.getInterval());
+            EXPECT_EQ(interpolationType, loadedTabulated.getInterpolationType());
+            EXPECT_EQ(*Frame::GCRF(), *loadedTabulated.getFirstState().accessFrame());
+
+            Array<Instant> instants = Array<Instant>::Empty();
+
+            for (Size i = 0; i < 200; ++i)
+            {
+                instants.add(epoch_ + Duration::Seconds(29.7 * i));
+            }
+
+            const Array<State> states = tabulated.calculateStatesAt(instants);
+            const Array<State> loadedStates = loadedTabulated.calculateStatesAt(instants);
+
+            for (Size i = 0; i < instants.getSize(); ++i)
+            {
+                EXPECT_EQ(states[i].accessInstant(), loadedStates[i].accessInstant());
+                EXPECT_TRUE(states[i].accessCoordinates().isApprox(loadedStates[i].accessCoordinates(), 1e-12));
+            }
+
+            EXPECT_TRUE(loadedTabulated.calculateStateAt(states_.accessLast().accessInstant())
+                            .accessCoordinates()
+                            .isApprox(states_.accessLast().accessCoordinates(), 1e-12));
+        }
+
+        ephemerisFile_.remove();
+    }
+
+    {
+        // States are sorted before being saved
+
+        Array<State> reversedStates = states_;
+        std::reverse(reversedStates.begin(), reversedStates.end());
+
+        Tabulated::SaveEphemeris(reversedStates, ephemerisFile_);
+
+        const Tabulated loadedTabulated = Tabulated::LoadEphemeris(ephemerisFile_);
+
+        EXPECT_EQ(epoch_, loadedTabulated.getFirstState().accessInstant());
+        EXPECT_EQ(states_.accessLast().accessInstant(), loadedTabulated.getLastState().accessInstant());
+
+        ephemerisFile_.remove();
+    }
+
+    {
+        EXPECT_ANY_THROW(Tabulated::SaveEphemeris(states_, File::Undefined()));
+        EXPECT_ANY_THROW(Tabulated::SaveEphemeris({states_.accessFirst()}, ephemerisFile_));
+
+        EXPECT_ANY_THROW(Tabulated::LoadEphemeris(File::Undefined()));
+        EXPECT_ANY_THROW(Tabulated::LoadEphemeris(ephemerisFile_));
+    }
+
+    {
+        // Truncated file
+
+        Tabulated::SaveEphemeris(states_, ephemerisFile_);
+
+        {
+            std::ofstream stream(ephemerisFile_.getPath().toString(), std::ios::binary | std::ios::trunc);
+            stream << "OSTKEPH1";
+        }
+
+        EXPECT_ANY_THROW(Tabulated::LoadEphemeris(ephemerisFile_));
+
+        ephemerisFile_.remove();
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Tabulated, Constructor_Table)
+{
+    using ostk::mathematics::object::MatrixXd;
+    using ostk::mathematics::object::VectorXd;
+
+    VectorXd timestamps(states_.getSize());
+    MatrixXd coordinates(states_.getSize(), 6);
+
+    for (Size i = 0; i < states_.getSize(); ++i)
+    {
+        timestamps(i) = (states_[i].accessInstant() - epoch_).inSeconds() + 30.0;
+        coordinates.row(i) = states_[i].accessCoordinates().transpose();
+    }
+
+    const Instant tableEpoch = epoch_ - Duration::Seconds(30.0);
+
+    Array<Instant> instants = Array<Instant>::Empty();
+
+    for (Size i = 0; i < 200; ++i)
+    {
+        instants.add(epoch_ + Duration::Seconds(29.7 * i));
+    }
+
+    for (const auto& interpolationType :
+         {Interpolator::Type::Linear, Interpolator::Type::BarycentricRational, Interpolator::Type::CubicSpline})
+    {
+        const Tabulated tabulated = {states_, interpolationType};
+
+        {
+            const Tabulated tableTabulated = {
+                tableEpoch,
+                timestamps,
+                coordinates,
+                Frame::GCRF(),
+                states_.accessFirst().accessCoordinateBroker(),
+                interpolationType,
+            };
+
+            ASSERT_TRUE(tableTabulated.isDefined());
+
+            EXPECT_EQ(tabulated.getInterval(), tableTabulated.getInterval());
+            EXPECT_EQ(tableEpoch, tableTabulated.getTableEpoch());
+            EXPECT_EQ(timestamps, tableTabulated.accessTimestamps());
+            EXPECT_EQ(coordinates, MatrixXd(tableTabulated.accessCoordinates()));
+
+            const Array<State> states = tabulated.calculateStatesAt(instants);
+            const Array<State> tableStates = tableTabulated.calculateStatesAt(instants);
+
+            for (Size i = 0; i < instants.getSize(); ++i)
+            {
+                EXPECT_EQ(states[i].accessInstant(), tableStates[i].accessInstant());
+                EXPECT_TRUE(states[i].accessCoordinates().isApprox(tableStates[i].accessCoordinates(), 1e-12));
+            }
+        }
+
+        {
+            // Buffers are referenced, and kept alive by the model
+
+            const Shared<const Tabulated::RowMajorMatrixXd> coordinatesSPtr =
+                std::make_shared<const Tabulated::RowMajorMatrixXd>(coordinates);
+
+            const Tabulated tableTabulated = {
+                tableEpoch,
+                Eigen::Map<const VectorXd>(timestamps.data(), timestamps.size()),
+                Eigen::Map<const Tabulated::RowMajorMatrixXd>(
+                    coordinatesSPtr->data(), coordinatesSPtr->rows(), coordinatesSPtr->cols()
+                ),
+                Frame::GCRF(),
+                states_.accessFirst().accessCoordinateBroker(),
+                interpolationType,
+                coordinatesSPtr,
+            };
+
+            EXPECT_EQ(timestamps.data(), tableTabulated.accessTimestamps().data());
+            EXPECT_EQ(coordinatesSPtr->data(), tableTabulated.accessCoordinates().data());
+
+            EXPECT_TRUE(tabulated.calculateStateAt(instants[57]).accessCoordinates().isApprox(
+                tableTabulated.calculateStateAt(instants[57]).accessCoordinates(), 1e-12
+            ));
+        }
+    }
+
+    {
+        const auto makeTabulated = [&](const VectorXd& aTimestampVector, const MatrixXd& aCoordinateMatrix) -> Tabulated
+        {
+            return {
+                tableEpoch,
+                aTimestampVector,
+                aCoordinateMatrix,
+                Frame::GCRF(),
+                states_.accessFirst().accessCoordinateBroker(),
+            };
+        };
+
+        VectorXd unsortedTimestamps = timestamps;
+        std::swap(unsortedTimestamps(0), unsortedTimestamps(1));
+
+        EXPECT_THROW(makeTabulated(unsortedTimestamps, coordinates), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(makeTabulated(timestamps, coordinates.leftCols(3)), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(makeTabulated(timestamps.head(1), coordinates.topRows(1)), ostk::core::error::runtime::Wrong);
+
+        EXPECT_THROW(
+            Tabulated(
+                Instant::Undefined(),
+                timestamps,
+                coordinates,
+                Frame::GCRF(),
+                states_.accessFirst().accessCoordinateBroker()
+            ),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            Tabulated(
+                tableEpoch,
+                Eigen::Map<const VectorXd>(timestamps.data(), timestamps.size()),
+                Eigen::Map<const Tabulated::RowMajorMatrixXd>(nullptr, 0, 6),
+                Frame::GCRF(),
+                states_.accessFirst().accessCoordinateBroker(),
+                Interpolator::Type::Linear,
+                nullptr
+            ),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Model_Tabulated, Sample)
+{
+    const Propagator propagator = {
+        NumericalSolver::Default(),
+        {
+            std::make_shared<PositionDerivative>(),
+            std::make_shared<CentralBodyGravity>(std::make_shared<Celestial>(Earth::Spherical())),
+        },
+    };
+
+    // Eccentric orbit, harder to interpolate around perigee than around apogee
+
+    const State state = {
+        epoch_,
+        Position::Meters({7000000.0, 0.0, 0.0}, Frame::GCRF()),
+        Velocity::MetersPerSecond({0.0, 6500.0, 6500.0}, Frame::GCRF()),
+    };
+
+    const Interval interval = Interval::Closed(epoch_, epoch_ + Duration::Hours(3.0));
+
+    Array<Instant> checkInstants = Array<Instant>::Empty();
+
+    for (Size i = 0; i <= 1080; ++i)
+    {
+        checkInstants.add(epoch_ + Duration::Seconds(10.0 * i));
+    }
+
+    const Array<State> propagatedStates = propagator.calculateStatesAt(state, checkInstants);
+
+    for (const auto& [interpolationType, positionTolerance] : Array<std::pair<Interpolator::Type, Length>> {
+             {Interpolator::Type::Linear, Length::Kilometers(1.0)},
+             {Interpolator::Type::BarycentricRational, Length::Meters(1.0)},
+             {Interpolator::Type::CubicSpline, Length::Meters(10.0)},
+         })
+    {
+        const Tabulated tabulated =
+            Tabulated::Sample(propagator, state, interval, positionTolerance, interpolationType);
+
+        ASSERT_TRUE(tabulated.isDefined());
+
+        EXPECT_EQ(interval, tabulated.getInterval());
+        EXPECT_EQ(interpolationType, tabulated.getInterpolationType());
+
+        // Fewer samples than a fixed 10 s grid, yet the interpolation meets the tolerance in between the samples
+
+        const Size sampleCount = tabulated.accessTimestamps().size();
+
+        EXPECT_LT(sampleCount, checkInstants.getSize());
+
+        const Array<State> interpolatedStates = tabulated.calculateStatesAt(checkInstants);
+
+        for (Size i = 0; i < checkInstants.getSize(); ++i)
+        {
+            EXPECT_LT(
+                (interpolatedStates[i].getPosition().getCoordinates() -
+                 propagatedStates[i].getPosition().getCoordinates())
+                    .norm(),
+                2.0 * positionTolerance.inMeters()
+            );
+        }
+
+        // Steps are no longer than the maximum step duration
+
+        const auto timestamps = tabulated.accessTimestamps();
+
+        for (Size i = 1; i < sampleCount; ++i)
+        {
+            EXPECT_LE(timestamps(i) - timestamps(i - 1), 600.0 + 1e-6);
+        }
+    }
+
+    {
+        // Samples are denser where the trajectory is harder to interpolate
+
+        const Tabulated tabulated =
+            Tabulated::Sample(propagator, state, interval, Length::Kilometers(1.0), Interpolator::Type::Linear);
+
+        const auto timestamps = tabulated.accessTimestamps();
+
+        double minimumStep_s = timestamps(1) - timestamps(0);
+        double maximumStep_s = minimumStep_s;
+
+        for (Size i = 1; i < Size(timestamps.size()); ++i)
+        {
+            minimumStep_s = std::min(minimumStep_s, timestamps(i) - timestamps(i - 1));
+            maximumStep_s = std::max(maximumStep_s, timestamps(i) - timestamps(i - 1));
+        }
+
+        EXPECT_GT(maximumStep_s, 2.0 * minimumStep_s);
+    }
+
+    {
+        EXPECT_ANY_THROW(Tabulated::Sample(Propagator::Undefined(), state, interval, Length::Meters(1.0)));
+        EXPECT_ANY_THROW(Tabulated::Sample(propagator, State::Undefined(), interval, Length::Meters(1.0)));
+        EXPECT_ANY_THROW(Tabulated::Sample(propagator, state, Interval::Undefined(), Length::Meters(1.0)));
+        EXPECT_ANY_THROW(Tabulated::Sample(propagator, state, Interval::Closed(epoch_, epoch_), Length::Meters(1.0)));
+        EXPECT_ANY_THROW(Tabulated::Sample(propagator, state, interval, Length::Meters(0.0)));
+        EXPECT_ANY_THROW(Tabulated::Sample(
+            propagator, state, interval, Length::Meters(1.0), Interpolator::Type::Linear, Duration::Zero()
+        ));
+    }
+}
@@ -1,5 +1,8 @@
 /// Apache License 2.0
 
+#include <sstream>
+#include <thread>
+
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Map.hpp>
 #include <OpenSpaceToolkit/Core/Container/Table.hpp>
@@ -9,8 +12,11 @@
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/RotationMatrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
 
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Manager.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Spherical/LLA.hpp>
 #include <OpenSpaceToolkit/Physics/Environment.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Earth.hpp>
 #include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
@@ -22,6 +28,7 @@
 #include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
 #include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
 
+#include <OpenSpaceToolkit/Astrodynamics/ExecutionContext.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler/COE.hpp>
@@ -42,13 +49,16 @@ using ostk::core::type::Index;
 using ostk::core::type::Integer;
 using ostk::core::type::Real;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 
 using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+using ostk::mathematics::object::MatrixXd;
 using ostk::mathematics::object::Vector3d;
 using ostk::mathematics::object::VectorXd;
 
 using ostk::physics::coordinate::Frame;
 using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::spherical::LLA;
 using ostk::physics::coordinate::Velocity;
 using ostk::physics::Environment;
 using ostk::physics::environment::object::Celestial;
@@ -64,6 +74,7 @@ using ostk::physics::unit::Derived;
 using ostk::physics::unit::Length;
 using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
 
+using ostk::astrodynamics::ExecutionContext;
 using ostk::astrodynamics::trajectory::Orbit;
 using ostk::astrodynamics::trajectory::orbit::model::Kepler;
 using ostk::astrodynamics::trajectory::orbit::model::kepler::COE;
@@ -570,6 +581,87 @@ TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit, ComputePasses)
     }
 }
 
+TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit, ComputePassesInParallel)
+{
+    const Environment environment = Environment::Default();
+
+    const COE coe = {
+        Length::Kilometers(7000.0),
+        0.001,
+        Angle::Degrees(97.0),
+        Angle::Degrees(10.0),
+        Angle::Degrees(20.0),
+        Angle::Degrees(30.0),
+    };
+
+    const Instant epoch = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+
+    const Kepler keplerianModel = {
+        coe,
+        epoch,
+        EarthGravitationalModel::EGM2008.gravitationalParameter_,
+        EarthGravitationalModel::EGM2008.equatorialRadius_,
+        EarthGravitationalModel::EGM2008.J2_,
+        EarthGravitationalModel::EGM2008.J4_,
+        Kepler::PerturbationType::J2
+    };
+
+    const Orbit orbit = {keplerianModel, environment.accessCelestialObjectWithName("Earth")};
+
+    // States span several chunks, whose crossings are merged into the same passes as the sequential computation
+
+    const Array<Instant> instants =
+        Interval::Closed(epoch, epoch + Duration::Days(2.0)).generateGrid(Duration::Seconds(60.0));
+    const Array<State> states = orbit.getStatesAt(instants);
+
+    const Array<Pair<Index, Pass>> referencePassMap = Orbit::ComputePasses(states, 5);
+
+    const auto expectInstantsNear = [](const Instant& aReferenceInstant, const Instant& anInstant) -> void
+    {
+        ASSERT_EQ(aReferenceInstant.isDefined(), anInstant.isDefined());
+
+        if (aReferenceInstant.isDefined())
+        {
+            EXPECT_LT(std::abs((anInstant - aReferenceInstant).inSeconds()), 1e-2);
+        }
+    };
+
+    for (const Size threadCount : {1, 4})
+    {
+        const Array<Pair<Index, Pass>> passMap = Orbit::ComputePasses(states, 5, ExecutionContext(threadCount));
+
+        ASSERT_EQ(referencePassMap.getSize(), passMap.getSize());
+
+        for (Index index = 0; index < passMap.getSize(); ++index)
+        {
+            const Pass& referencePass = referencePassMap[index].second;
+            const Pass& pass = passMap[index].second;
+
+            EXPECT_EQ(referencePassMap[index].first, passMap[index].first);
+            EXPECT_EQ(referencePass.getRevolutionNumber(), pass.getRevolutionNumber());
+            EXPECT_EQ(referencePass.getType(), pass.getType());
+
+            expectInstantsNear(referencePass.accessInstantAtAscendingNode(), pass.accessInstantAtAscendingNode());
+            expectInstantsNear(referencePass.accessInstantAtNorthPoint(), pass.accessInstantAtNorthPoint());
+            expectInstantsNear(referencePass.accessInstantAtDescendingNode(), pass.accessInstantAtDescendingNode());
+            expectInstantsNear(referencePass.accessInstantAtSouthPoint(), pass.accessInstantAtSouthPoint());
+            expectInstantsNear(referencePass.accessInstantAtPassBreak(), pass.accessInstantAtPassBreak());
+        }
+    }
+
+    {
+        EXPECT_THROW(
+            Orbit::ComputePasses(states, Integer::Undefined(), ExecutionContext()), ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            Orbit::ComputePasses({states.accessFirst()}, 1, ExecutionContext()), ostk::core::error::RuntimeError
+        );
+        EXPECT_THROW(
+            Orbit::ComputePasses({states[1], states[0]}, 1, ExecutionContext()), ostk::core::error::RuntimeError
+        );
+    }
+}
+
 TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit, GetPassWithRevolutionNumber)
 {
     {
@@ -884,6 +976,569 @@ TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit, GetPassWithRevolutionNumbe
     }
 }
 
+TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit, GetPassWithRevolutionNumber_Concurrent)
+{
+    const Environment environment = Environment::Default();
+
+    const COE coe = {
+        Length::Kilometers(7000.0),
+        0.0,
+        Angle::Degrees(45.0),
+        Angle::Degrees(0.0),
+        Angle::Degrees(0.0),
+        Angle::Degrees(0.0),
+    };
+
+    const Instant epoch = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+
+    const Kepler keplerianModel = {
+        coe,
+        epoch,
+        EarthGravitationalModel::EGM2008.gravitationalParameter_,
+        EarthGravitationalModel::EGM2008.equatorialRadius_,
+        EarthGravitationalModel::EGM2008.J2_,
+        EarthGravitationalModel::EGM2008.J4_,
+        Kepler::PerturbationType::None
+    };
+
+    const Orbit orbit = {keplerianModel, environment.accessCelestialObjectWithName("Earth")};
+
+    const Table referenceData = Table::Load(
+        File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler/Test_1/"
+                               "Satellite Passes.csv")),
+        Table::Format::CSV,
+        true
+    );
+
+    Array<Integer> referenceRevolutionNumbers = Array<Integer>::Empty();
+    Array<Pair<Instant, Instant>> referenceInstants = Array<Pair<Instant, Instant>>::Empty();
+
+    for (const auto &referenceRow : referenceData)
+    {
+        referenceRevolutionNumbers.add(referenceRow[0].accessInteger());
+        referenceInstants.add(
+            {Instant::DateTime(DateTime::Parse(referenceRow[1].accessString()), Scale::UTC),
+             Instant::DateTime(DateTime::Parse(referenceRow[2].accessString()), Scale::UTC)}
+        );
+    }
+
+    // Each thread queries all the revolutions, half of them in reverse order, so that cache hits and misses interleave
+
+    const Size threadCount = 4;
+
+    Array<Array<Pass>> threadPasses(threadCount, Array<Pass>::Empty());
+
+    std::vector<std::thread> threads;
+
+    for (Size threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+    {
+        threads.emplace_back(
+            [&orbit, &referenceRevolutionNumbers, &threadPasses, threadIndex]() -> void
+            {
+                const Size revolutionCount = referenceRevolutionNumbers.getSize();
+
+                Array<Pass> passes(revolutionCount, Pass::Undefined());
+
+                for (Size i = 0; i < revolutionCount; ++i)
+                {
+                    const Size index = (threadIndex % 2 == 0) ? i : (revolutionCount - 1 - i);
+
+                    passes[index] = orbit.getPassWithRevolutionNumber(referenceRevolutionNumbers[index]);
+                }
+
+                threadPasses[threadIndex] = passes;
+            }
+        );
+    }
+
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    for (const auto &passes : threadPasses)
+    {
+        ASSERT_EQ(referenceRevolutionNumbers.getSize(), passes.getSize());
+
+        for (Size index = 0; index < passes.getSize(); ++index)
+        {
+            const Pass &pass = passes[index];
+
+            ASSERT_TRUE(pass.isDefined());
+
+            EXPECT_EQ(referenceRevolutionNumbers[index], pass.getRevolutionNumber());
+
+            EXPECT_GT(
+                Duration::Microseconds(1.0),
+                Duration::Between(referenceInstants[index].first, pass.accessInstantAtAscendingNode()).getAbsolute()
+            );
+            EXPECT_GT(
+                Duration::Microseconds(1.0),
+                Duration::Between(referenceInstants[index].second, pass.accessInstantAtPassBreak()).getAbsolute()
+            );
+        }
+    }
+}
+
+TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit, Copy)
+{
+    using FrameManager = ostk::physics::coordinate::frame::Manager;
+
+    const Environment environment = Environment::Default();
+
+    const COE coe = {
+        Length::Kilometers(7000.0),
+        0.0,
+        Angle::Degrees(45.0),
+        Angle::Degrees(0.0),
+        Angle::Degrees(0.0),
+        Angle::Degrees(0.0),
+    };
+
+    const Instant epoch = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+
+    const Kepler keplerianModel = {
+        coe,
+        epoch,
+        EarthGravitationalModel::EGM2008.gravitationalParameter_,
+        EarthGravitationalModel::EGM2008.equatorialRadius_,
+        EarthGravitationalModel::EGM2008.J2_,
+        EarthGravitationalModel::EGM2008.J4_,
+        Kepler::PerturbationType::None
+    };
+
+    Shared<const Frame> lvlhFrameSPtr = nullptr;
+
+    {
+        Orbit copiedOrbit = Orbit::Undefined();
+
+        {
+            const Orbit orbit = {keplerianModel, environment.accessCelestialObjectWithName("Earth")};
+
+            const Pass pass = orbit.getPassWithRevolutionNumber(2);
+
+            lvlhFrameSPtr = orbit.getOrbitalFrame(Orbit::FrameType::LVLH);
+
+            copiedOrbit = orbit;
+
+            // Copies share the model, the passes and the orbital frames
+
+            EXPECT_EQ(&orbit.accessModel(), &copiedOrbit.accessModel());
+            EXPECT_EQ(lvlhFrameSPtr, copiedOrbit.getOrbitalFrame(Orbit::FrameType::LVLH));
+
+            std::stringstream stream;
+
+            copiedOrbit.print(stream, false);
+
+            EXPECT_NE(std::string::npos, stream.str().find("Pass #2"));
+        }
+
+        EXPECT_EQ(lvlhFrameSPtr, copiedOrbit.getOrbitalFrame(Orbit::FrameType::LVLH));
+    }
+
+    // Orbital frames are not registered, and remain valid once the orbits are destructed
+
+    EXPECT_FALSE(FrameManager::Get().hasFrameWithName(lvlhFrameSPtr->getName()));
+
+    EXPECT_NO_THROW(lvlhFrameSPtr->getTransformTo(Frame::GCRF(), epoch + Duration::Minutes(10.0)));
+}
+
+TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit, GetOrbitalFrameOutlivingOrbit)
+{
+    const Environment environment = Environment::Default();
+
+    const COE coe = {
+        Length::Kilometers(7000.0),
+        0.0,
+        Angle::Degrees(45.0),
+        Angle::Degrees(0.0),
+        Angle::Degrees(0.0),
+        Angle::Degrees(0.0),
+    };
+
+    const Instant epoch = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+
+    const Kepler keplerianModel = {
+        coe,
+        epoch,
+        EarthGravitationalModel::EGM2008.gravitationalParameter_,
+        EarthGravitationalModel::EGM2008.equatorialRadius_,
+        EarthGravitationalModel::EGM2008.J2_,
+        EarthGravitationalModel::EGM2008.J4_,
+        Kepler::PerturbationType::None
+    };
+
+    // Geodetic frames are generated by an orbit, which is destroyed before they are used through a copy
+
+    Orbit copiedOrbit = Orbit::Undefined();
+
+    Shared<const Frame> nedFrameSPtr = nullptr;
+    Shared<const Frame> lvlhgdFrameSPtr = nullptr;
+    Shared<const Frame> lvlhgdgtFrameSPtr = nullptr;
+
+    {
+        const Orbit orbit = {keplerianModel, environment.accessCelestialObjectWithName("Earth")};
+
+        nedFrameSPtr = orbit.getOrbitalFrame(Orbit::FrameType::NED);
+        lvlhgdFrameSPtr = orbit.getOrbitalFrame(Orbit::FrameType::LVLHGD);
+        lvlhgdgtFrameSPtr = orbit.getOrbitalFrame(Orbit::FrameType::LVLHGDGT);
+
+        copiedOrbit = orbit;
+    }
+
+    const Instant instant = epoch + Duration::Minutes(10.0);
+    const Position earthCenter = Position::Meters({0.0, 0.0, 0.0}, Frame::GCRF());
+
+    {
+        // The central body is below the orbit, along the down axis of NED
+
+        const Vector3d earthCenterDirection_NED =
+            earthCenter.inFrame(nedFrameSPtr, instant).getCoordinates().normalized();
+
+        EXPECT_GT(earthCenterDirection_NED.z(), 0.99);
+    }
+
+    for (const auto& frameSPtr : {lvlhgdFrameSPtr, lvlhgdgtFrameSPtr})
+    {
+        // The central body is along the geodetic X axis of LVLHGD and LVLHGDGT
+
+        const Vector3d earthCenterDirection = earthCenter.inFrame(frameSPtr, instant).getCoordinates().normalized();
+
+        EXPECT_GT(std::abs(earthCenterDirection.x()), 0.99);
+    }
+
+    EXPECT_EQ(nedFrameSPtr, copiedOrbit.getOrbitalFrame(Orbit::FrameType::NED));
+    EXPECT_EQ(lvlhgdFrameSPtr, copiedOrbit.getOrbitalFrame(Orbit::FrameType::LVLHGD));
+}
+
+TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit, GetSampledPassWithRevolutionNumber)
+{
+    // Environment setup
+
+    const Environment environment = Environment::Default();
+
+    // Orbit setup
+
+    const Length semiMajorAxis = Length::Kilometers(7000.0);
+    const Real eccentricity = 0.0;
+    const Angle inclination = Angle::Degrees(45.0);
+    const Angle raan = Angle::Degrees(0.0);
+    const Angle aop = Angle::Degrees(0.0);
+    const Angle trueAnomaly = Angle::Degrees(0.0);
+
+    const COE coe = {semiMajorAxis, eccentricity, inclination, raan, aop, trueAnomaly};
+
+    const Instant epoch = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+    const Derived gravitationalParameter = EarthGravitationalModel::EGM2008.gravitationalParameter_;
+    const Length equatorialRadius = EarthGravitationalModel::EGM2008.equatorialRadius_;
+    const Real J2 = EarthGravitationalModel::EGM2008.J2_;
+    const Real J4 = EarthGravitationalModel::EGM2008.J4_;
+
+    const Kepler keplerianModel = {
+        coe, epoch, gravitationalParameter, equatorialRadius, J2, J4, Kepler::PerturbationType::None
+    };
+
+    // Reference data setup
+
+    const Table referenceData = Table::Load(
+        File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler/Test_1/"
+                               "Satellite Passes.csv")),
+        Table::Format::CSV,
+        true
+    );
+
+    const auto expectPassNearReference = [](const Pass& aPass, const auto& aReferenceRow) -> void
+    {
+        const Integer referenceRevolutionNumber = aReferenceRow[0].accessInteger();
+        const Instant referencePassStartInstant =
+            Instant::DateTime(DateTime::Parse(aReferenceRow[1].accessString()), Scale::UTC);
+        const Instant referencePassEndInstant =
+            Instant::DateTime(DateTime::Parse(aReferenceRow[2].accessString()), Scale::UTC);
+
+        EXPECT_TRUE(aPass.isDefined());
+
+        EXPECT_EQ(Pass::Type::Complete, aPass.getType());
+        EXPECT_EQ(referenceRevolutionNumber, aPass.getRevolutionNumber());
+
+        EXPECT_GT(
+            Duration::Milliseconds(1.0),
+            Duration::Between(referencePassStartInstant, aPass.accessInstantAtAscendingNode()).getAbsolute()
+        );
+        EXPECT_GT(
+            Duration::Milliseconds(1.0),
+            Duration::Between(referencePassEndInstant, aPass.accessInstantAtPassBreak()).getAbsolute()
+        );
+    };
+
+    // Forward
+
+    {
+        const Orbit orbit = {keplerianModel, environment.accessCelestialObjectWithName("Earth")};
+
+        for (const auto &referenceRow : referenceData)
+        {
+            expectPassNearReference(
+                orbit.getSampledPassWithRevolutionNumber(referenceRow[0].accessInteger()), referenceRow
+            );
+        }
+    }
+
+    // Backward, before the epoch
+
+    {
+        const Orbit orbit = {keplerianModel, environment.accessCelestialObjectWithName("Earth")};
+        const Orbit referenceOrbit = {keplerianModel, environment.accessCelestialObjectWithName("Earth")};
+
+        for (const Integer revolutionNumber : {-2, 0, -1})
+        {
+            const Pass pass = orbit.getSampledPassWithRevolutionNumber(revolutionNumber);
+            const Pass referencePass = referenceOrbit.getPassWithRevolutionNumber(revolutionNumber);
+
+            EXPECT_EQ(Pass::Type::Complete, pass.getType());
+            EXPECT_EQ(referencePass.getRevolutionNumber(), pass.getRevolutionNumber());
+
+            EXPECT_GT(
+                Duration::Milliseconds(1.0),
+                Duration::Between(referencePass.accessInstantAtAscendingNode(), pass.accessInstantAtAscendingNode())
+                    .getAbsolute()
+            );
+            EXPECT_GT(
+                Duration::Milliseconds(1.0),
+                Duration::Between(referencePass.accessInstantAtPassBreak(), pass.accessInstantAtPassBreak())
+                    .getAbsolute()
+            );
+        }
+    }
+
+    {
+        const Orbit orbit = {keplerianModel, environment.accessCelestialObjectWithName("Earth")};
+
+        EXPECT_THROW(Orbit::Undefined().getSampledPassWithRevolutionNumber(1), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(
+            orbit.getSampledPassWithRevolutionNumber(Integer::Undefined()), ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            orbit.getSampledPassWithRevolutionNumber(1, Duration::Seconds(-1.0)), ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            orbit.getSampledPassWithRevolutionNumber(1, Duration::Minutes(1.0), 1), ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            orbit.getSampledPassWithRevolutionNumber(10, Duration::Minutes(1.0), 10), ostk::core::error::RuntimeError
+        );
+    }
+}
+
+TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit, PassSnapshot)
+{
+    const Environment environment = Environment::Default();
+
+    const COE coe = {
+        Length::Kilometers(7000.0),
+        0.001,
+        Angle::Degrees(45.0),
+        Angle::Degrees(10.0),
+        Angle::Degrees(20.0),
+        Angle::Degrees(30.0),
+    };
+
+    const auto constructOrbit = [&environment, &coe](const Instant& anEpoch) -> Orbit
+    {
+        const Kepler keplerianModel = {
+            coe,
+            anEpoch,
+            EarthGravitationalModel::EGM2008.gravitationalParameter_,
+            EarthGravitationalModel::EGM2008.equatorialRadius_,
+            EarthGravitationalModel::EGM2008.J2_,
+            EarthGravitationalModel::EGM2008.J4_,
+            Kepler::PerturbationType::J2
+        };
+
+        return {keplerianModel, environment.accessCelestialObjectWithName("Earth")};
+    };
+
+    const Instant epoch = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+
+    File snapshotFile = File::Path(Path::Parse("/tmp/OpenSpaceToolkit_Astrodynamics_Orbit_PassSnapshot.passes"));
+
+    {
+        const Orbit orbit = constructOrbit(epoch);
+
+        Array<Pass> passes = Array<Pass>::Empty();
+
+        for (const Integer revolutionNumber : {-2, 1, 2, 3, 4, 5})
+        {
+            passes.add(orbit.getPassWithRevolutionNumber(revolutionNumber));
+        }
+
+        orbit.savePassSnapshot(snapshotFile);
+
+        const Orbit restoredOrbit = constructOrbit(epoch);
+
+        restoredOrbit.loadPassSnapshot(snapshotFile);
+
+        for (const Pass& pass : passes)
+        {
+            EXPECT_EQ(pass, restoredOrbit.getPassWithRevolutionNumber(pass.getRevolutionNumber()));
+        }
+
+        // Reloading keeps the cached passes
+
+        EXPECT_NO_THROW(restoredOrbit.loadPassSnapshot(snapshotFile));
+        EXPECT_EQ(passes[0], restoredOrbit.getPassWithRevolutionNumber(-2));
+    }
+
+    {
+        const Orbit emptyOrbit = constructOrbit(epoch);
+
+        emptyOrbit.savePassSnapshot(snapshotFile);
+
+        const Orbit restoredOrbit = constructOrbit(epoch);
+
+        EXPECT_NO_THROW(restoredOrbit.loadPassSnapshot(snapshotFile));
+    }
+
+    {
+        EXPECT_ANY_THROW(constructOrbit(epoch + Duration::Seconds(1.0)).loadPassSnapshot(snapshotFile));
+        EXPECT_ANY_THROW(constructOrbit(epoch).savePassSnapshot(File::Undefined()));
+        EXPECT_ANY_THROW(constructOrbit(epoch).loadPassSnapshot(File::Undefined()));
+        EXPECT_ANY_THROW(constructOrbit(epoch).loadPassSnapshot(File::Path(Path::Parse("/does/not/exist.passes"))));
+        EXPECT_ANY_THROW(Orbit::Undefined().savePassSnapshot(snapshotFile));
+    }
+
+    snapshotFile.remove();
+}
+
+TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit, GetGroundTrack)
+{
+    const Environment environment = Environment::Default();
+
+    const Shared<const Celestial> earthSPtr = environment.accessCelestialObjectWithName("Earth");
+
+    const Instant epoch = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+
+    const Array<Instant> instants =
+        Interval::Closed(epoch, epoch + Duration::Hours(3.0)).generateGrid(Duration::Minutes(1.0));
+
+    for (const Real& eccentricity : {0.0, 0.1, 0.7})
+    {
+        const COE coe = {
+            Length::Kilometers(7000.0) / (1.0 - eccentricity),
+            eccentricity,
+            Angle::Degrees(97.0),
+            Angle::Degrees(10.0),
+            Angle::Degrees(20.0),
+            Angle::Degrees(30.0),
+        };
+
+        const Kepler keplerianModel = {
+            coe,
+            epoch,
+            EarthGravitationalModel::EGM2008.gravitationalParameter_,
+            EarthGravitationalModel::EGM2008.equatorialRadius_,
+            EarthGravitationalModel::EGM2008.J2_,
+            EarthGravitationalModel::EGM2008.J4_,
+            Kepler::PerturbationType::None
+        };
+
+        const Orbit orbit = {keplerianModel, earthSPtr};
+
+        const MatrixXd groundTrack = orbit.getGroundTrack(instants);
+
+        ASSERT_EQ(instants.getSize(), Size(groundTrack.rows()));
+        ASSERT_EQ(3, groundTrack.cols());
+
+        for (Index index = 0; index < instants.getSize(); ++index)
+        {
+            const Vector3d position =
+                orbit.getStateAt(instants[index]).inFrame(earthSPtr->accessFrame()).getPosition().accessCoordinates();
+
+            const LLA lla = LLA::Cartesian(position, earthSPtr->getEquatorialRadius(), earthSPtr->getFlattening());
+
+            EXPECT_NEAR(lla.getLatitude().inRadians(), groundTrack(index, 0), 1e-9);
+            EXPECT_NEAR(lla.getLongitude().inRadians(), groundTrack(index, 1), 1e-9);
+            EXPECT_NEAR(lla.getAltitude().inMeters(), groundTrack(index, 2), 1e-3);
+        }
+    }
+
+    {
+        const Orbit orbit = Orbit::SunSynchronous(epoch, Length::Kilometers(500.0), Time::Midnight(), earthSPtr);
+
+        EXPECT_EQ(0, orbit.getGroundTrack(Array<Instant>::Empty()).rows());
+    }
+
+    {
+        EXPECT_ANY_THROW(Orbit::Undefined().getGroundTrack(instants));
+    }
+}
+
+TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit, GetCOEsAt)
+{
+    const Environment environment = Environment::Default();
+
+    const Shared<const Celestial> earthSPtr = environment.accessCelestialObjectWithName("Earth");
+
+    const Derived gravitationalParameter = earthSPtr->getGravitationalParameter();
+
+    const auto expectCOEsMatchStates = [&gravitationalParameter](const Orbit& anOrbit, const Array<Instant>& anInstants)
+    {
+        const Array<COE> coes = anOrbit.getCOEsAt(anInstants);
+
+        ASSERT_EQ(anInstants.getSize(), coes.getSize());
+
+        for (Index index = 0; index < anInstants.getSize(); ++index)
+        {
+            const State state = anOrbit.getStateAt(anInstants[index]).inFrame(Frame::GCRF());
+
+            const COE::CartesianState cartesianState =
+                coes[index].getCartesianState(gravitationalParameter, Frame::GCRF());
+
+            EXPECT_GT(1e-3, (cartesianState.first.accessCoordinates() - state.accessPositionCoordinates()).norm());
+            EXPECT_GT(1e-6, (cartesianState.second.accessCoordinates() - state.accessVelocityCoordinates()).norm());
+        }
+    };
+
+    {
+        const Instant epoch = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+
+        const Array<Instant> instants =
+            Interval::Closed(epoch, epoch + Duration::Hours(3.0)).generateGrid(Duration::Minutes(1.0));
+
+        const COE coe = {
+            Length::Kilometers(7000.0),
+            0.01,
+            Angle::Degrees(97.0),
+            Angle::Degrees(10.0),
+            Angle::Degrees(20.0),
+            Angle::Degrees(30.0),
+        };
+
+        const Kepler keplerianModel = {coe, epoch, *earthSPtr, Kepler::PerturbationType::None, false};
+
+        expectCOEsMatchStates({keplerianModel, earthSPtr}, instants);
+    }
+
+    {
+        const TLE tle = {
+            "1 25544U 98067A   18231.17878740  .00000187  00000-0  10196-4 0  9994",
+            "2 25544  51.6447  64.7824 0005971  73.1467  36.4366 15.53848234128316"
+        };
+
+        const Orbit orbit = {SGP4(tle), earthSPtr};
+
+        const Array<Instant> instants = Interval::Closed(tle.getEpoch(), tle.getEpoch() + Duration::Hours(3.0))
+                                            .generateGrid(Duration::Minutes(1.0));
+
+        expectCOEsMatchStates(orbit, instants);
+
+        EXPECT_TRUE(orbit.getCOEsAt(Array<Instant>::Empty()).isEmpty());
+    }
+
+    {
+        EXPECT_ANY_THROW(Orbit::Undefined().getCOEsAt({Instant::J2000()}));
+    }
+}
+
 TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit, GetOrbitalFrame)
 {
     using ostk::mathematics::geometry::d3::transformation::rotation::RotationMatrix;
@@ -1762,3 +2417,120 @@ TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit, SunSynchronous)
     //     }
     // }
 }
+
+TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit, SunSynchronousArray)
+{
+    const Instant epoch = Instant::DateTime(DateTime::Parse("2018-01-01 00:00:00"), Scale::UTC);
+    const Shared<const Celestial> earthSPtr = Environment::Default().accessCelestialObjectWithName("Earth");
+
+    {
+        const Array<Length> altitudes = {
+            Length::Kilometers(400.0), Length::Kilometers(500.0), Length::Kilometers(800.0)
+        };
+        const Array<Time> localTimesAtDescendingNode = {
+            Time::Parse("06:00:00"), Time::Parse("10:30:00"), Time::Parse("22:15:30")
+        };
+
+        const Array<Orbit> orbits =
+            Orbit::SunSynchronous(epoch, altitudes, localTimesAtDescendingNode, earthSPtr, Angle::Degrees(30.0));
+
+        ASSERT_EQ(altitudes.getSize(), orbits.getSize());
+
+        for (Index index = 0; index < orbits.getSize(); ++index)
+        {
+            const Orbit referenceOrbit = Orbit::SunSynchronous(
+                epoch, altitudes[index], localTimesAtDescendingNode[index], earthSPtr, Angle::Degrees(30.0)
+            );
+
+            EXPECT_EQ(
+                referenceOrbit.accessModel().as<Kepler>().getClassicalOrbitalElements(),
+                orbits[index].accessModel().as<Kepler>().getClassicalOrbitalElements()
+            );
+        }
+    }
+
+    {
+        EXPECT_TRUE(Orbit::SunSynchronous(epoch, Array<Length>::Empty(), Array<Time>::Empty(), earthSPtr).isEmpty());
+    }
+
+    {
+        EXPECT_THROW(
+            Orbit::SunSynchronous(epoch, {Length::Kilometers(500.0)}, Array<Time>::Empty(), earthSPtr),
+            ostk::core::error::RuntimeError
+        );
+        EXPECT_THROW(
+            Orbit::SunSynchronous(Instant::Undefined(), {Length::Kilometers(500.0)}, {Time::Midnight()}, earthSPtr),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            Orbit::SunSynchronous(epoch, {Length::Undefined()}, {Time::Midnight()}, earthSPtr),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            Orbit::SunSynchronous(epoch, {Length::Kilometers(500.0)}, {Time::Undefined()}, earthSPtr),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            Orbit::SunSynchronous(epoch, {Length::Kilometers(500.0)}, {Time::Midnight()}, nullptr),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit, RepeatGroundTrack)
+{
+    const Instant epoch = Instant::DateTime(DateTime::Parse("2018-01-01 00:00:00"), Scale::UTC);
+    const Shared<const Celestial> earthSPtr = Environment::Default().accessCelestialObjectWithName("Earth");
+
+    // The ground track repeats at the ascending node following the last revolution of the cycle
+
+    {
+        const Array<Tuple<Integer, Integer, Angle>> scenarios = {
+            {15, 1, Angle::Degrees(98.0)},
+            {29, 2, Angle::Degrees(51.6)},
+            {43, 3, Angle::Degrees(0.0)},
+        };
+
+        for (const auto& [revolutionCount, dayCount, inclination] : scenarios)
+        {
+            const Orbit orbit = Orbit::RepeatGroundTrack(
+                epoch, revolutionCount, dayCount, inclination, earthSPtr, Angle::Degrees(20.0)
+            );
+
+            const Instant cycleEndInstant =
+                orbit.getPassWithRevolutionNumber(revolutionCount + 1).accessInstantAtAscendingNode();
+
+            const Vector3d startPosition_ITRF =
+                orbit.getStateAt(epoch).inFrame(Frame::ITRF()).getPosition().accessCoordinates();
+            const Vector3d endPosition_ITRF =
+                orbit.getStateAt(cycleEndInstant).inFrame(Frame::ITRF()).getPosition().accessCoordinates();
+
+            EXPECT_LT((endPosition_ITRF - startPosition_ITRF).norm(), 1000.0);
+        }
+    }
+
+    {
+        EXPECT_THROW(
+            Orbit::RepeatGroundTrack(Instant::Undefined(), 15, 1, Angle::Degrees(98.0), earthSPtr),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            Orbit::RepeatGroundTrack(epoch, 0, 1, Angle::Degrees(98.0), earthSPtr), ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            Orbit::RepeatGroundTrack(epoch, 15, -1, Angle::Degrees(98.0), earthSPtr), ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            Orbit::RepeatGroundTrack(epoch, 15, 1, Angle::Undefined(), earthSPtr), ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            Orbit::RepeatGroundTrack(epoch, 15, 1, Angle::Degrees(98.0), nullptr), ostk::core::error::runtime::Undefined
+        );
+
+        // Orbits inside the central body
+
+        EXPECT_THROW(
+            Orbit::RepeatGroundTrack(epoch, 20, 1, Angle::Degrees(98.0), earthSPtr), ostk::core::error::RuntimeError
+        );
+    }
+}
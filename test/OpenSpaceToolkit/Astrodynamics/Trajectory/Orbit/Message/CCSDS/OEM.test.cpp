@@ -0,0 +1,284 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Message/CCSDS/OEM.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::filesystem::File;
+using ostk::core::filesystem::Path;
+using ostk::core::type::Size;
+
+using ostk::mathematics::curvefitting::Interpolator;
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Velocity;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::time::Scale;
+
+using ostk::astrodynamics::trajectory::model::Tabulated;
+using ostk::astrodynamics::trajectory::orbit::message::ccsds::OEM;
+using ostk::astrodynamics::trajectory::Propagator;
+using ostk::astrodynamics::trajectory::State;
+
+class OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Message_CCSDS_OEM : public ::testing::Test
+{
+   protected:
+    const File oemFile_ =
+        File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Message/CCSDS/OEM/oem.txt"));
+    File outputFile_ = File::Path(Path::Parse("/tmp/OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Message_OEM.oem"));
+
+    const Instant epoch_ = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+    const OEM::Header header_ = {"2.0", epoch_, "OSTK"};
+    const OEM::Metadata metadata_ = {
+        "SATELLITE",
+        "2018-001A",
+        "EARTH",
+        "GCRF",
+        "UTC",
+        epoch_,
+        epoch_ + Duration::Minutes(10.0),
+    };
+    const State state_ = {
+        epoch_,
+        Position::Meters({7000.0e3, 0.0, 0.0}, Frame::GCRF()),
+        Velocity::MetersPerSecond({0.0, 5335.865450622126, 5335.865450622126}, Frame::GCRF()),
+    };
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Message_CCSDS_OEM, Load)
+{
+    {
+        const OEM oem = OEM::Load(oemFile_);
+
+        EXPECT_TRUE(oem.isDefined());
+
+        EXPECT_EQ("2.0", oem.getHeader().version);
+        EXPECT_EQ(Instant::DateTime(DateTime(1996, 11, 4, 17, 22, 31), Scale::UTC), oem.getHeader().creationDate);
+        EXPECT_EQ("NASA/JPL", oem.getHeader().originator);
+
+        ASSERT_EQ(2, oem.getSegments().getSize());
+
+        const OEM::Segment firstSegment = oem.getSegmentAt(0);
+
+        EXPECT_EQ("MARS GLOBAL SURVEYOR", firstSegment.metadata.objectName);
+        EXPECT_EQ("1996-062A", firstSegment.metadata.objectId);
+        EXPECT_EQ("EARTH", firstSegment.metadata.centerName);
+        EXPECT_EQ("GCRF", firstSegment.metadata.referenceFrame);
+        EXPECT_EQ("UTC", firstSegment.metadata.timeSystem);
+        EXPECT_EQ(
+            Instant::DateTime(DateTime(1996, 12, 18, 12, 0, 0, 331), Scale::UTC), firstSegment.metadata.startTime
+        );
+        EXPECT_EQ(
+            Instant::DateTime(DateTime(1996, 12, 18, 12, 2, 0, 331), Scale::UTC), firstSegment.metadata.stopTime
+        );
+
+        ASSERT_EQ(3, firstSegment.states.getSize());
+
+        EXPECT_EQ(firstSegment.metadata.startTime, firstSegment.states[0].accessInstant());
+        EXPECT_EQ(*Frame::GCRF(), *firstSegment.states[0].accessFrame());
+        EXPECT_TRUE(firstSegment.states[0].getPosition().getCoordinates().isApprox(
+            Vector3d(2789.619e3, -280.045e3, -1746.755e3), 1e-12
+        ));
+        EXPECT_TRUE(firstSegment.states[0].getVelocity().getCoordinates().isApprox(
+            Vector3d(4.73372e3, -2.49586e3, -1.04195e3), 1e-12
+        ));
+
+        // Accelerations are ignored and the covariance block is skipped
+
+        const OEM::Segment secondSegment = oem.getSegmentAt(1);
+
+        EXPECT_EQ("EME2000", secondSegment.metadata.referenceFrame);
+        ASSERT_EQ(3, secondSegment.states.getSize());
+        EXPECT_EQ(secondSegment.metadata.stopTime, secondSegment.states[2].accessInstant());
+    }
+
+    {
+        EXPECT_ANY_THROW(OEM::Load(File::Undefined()));
+        EXPECT_ANY_THROW(OEM::Load(File::Path(Path::Parse("/does/not/exist.oem"))));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Message_CCSDS_OEM, Reader)
+{
+    {
+        OEM::Reader reader = {oemFile_};
+
+        EXPECT_EQ("NASA/JPL", reader.getHeader().originator);
+        EXPECT_ANY_THROW(reader.getMetadata());
+        EXPECT_ANY_THROW(reader.readStates());
+
+        ASSERT_TRUE(reader.readMetadata());
+
+        EXPECT_EQ("GCRF", reader.getMetadata().referenceFrame);
+
+        const Array<State> firstChunk = reader.readStates(2);
+        const Array<State> secondChunk = reader.readStates(2);
+
+        EXPECT_EQ(2, firstChunk.getSize());
+        EXPECT_EQ(1, secondChunk.getSize());
+        EXPECT_TRUE(reader.readStates(2).isEmpty());
+
+        ASSERT_TRUE(reader.readMetadata());
+
+        const Tabulated tabulated = reader.readTabulated(Interpolator::Type::Linear);
+
+        EXPECT_TRUE(tabulated.isDefined());
+        EXPECT_EQ(reader.getMetadata().startTime, tabulated.getInterval().getStart());
+        EXPECT_EQ(reader.getMetadata().stopTime, tabulated.getInterval().getEnd());
+
+        EXPECT_FALSE(reader.readMetadata());
+    }
+
+    {
+        // Unread states are skipped when advancing to the next segment
+
+        OEM::Reader reader = {oemFile_};
+
+        ASSERT_TRUE(reader.readMetadata());
+        EXPECT_EQ(1, reader.readStates(1).getSize());
+
+        ASSERT_TRUE(reader.readMetadata());
+        EXPECT_EQ("EME2000", reader.getMetadata().referenceFrame);
+        EXPECT_EQ(3, reader.readStates().getSize());
+
+        EXPECT_FALSE(reader.readMetadata());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Message_CCSDS_OEM, Writer)
+{
+    {
+        Array<State> states = Array<State>::Empty();
+
+        for (Size i = 0; i <= 10; ++i)
+        {
+            states.add(State(
+                epoch_ + Duration::Minutes(i),
+                Position::Meters({7000.0e3 + i, 1.0e3 * i, -1.0e3 * i}, Frame::GCRF()),
+                Velocity::MetersPerSecond({1.0 * i, 7.5e3, 0.5 * i}, Frame::GCRF())
+            ));
+        }
+
+        {
+            OEM::Writer writer = {outputFile_, header_, 3};
+
+            EXPECT_TRUE(writer.isOpen());
+            EXPECT_ANY_THROW(writer.write(states));
+
+            writer.writeMetadata(metadata_);
+            writer.write(states);
+            writer.close();
+
+            EXPECT_FALSE(writer.isOpen());
+            EXPECT_ANY_THROW(writer.writeMetadata(metadata_));
+        }
+
+        const OEM oem = OEM::Load(outputFile_);
+
+        EXPECT_EQ(header_.creationDate, oem.getHeader().creationDate);
+        EXPECT_EQ(header_.originator, oem.getHeader().originator);
+
+        ASSERT_EQ(1, oem.getSegments().getSize());
+
+        const OEM::Segment segment = oem.getSegmentAt(0);
+
+        EXPECT_EQ(metadata_.objectName, segment.metadata.objectName);
+        EXPECT_EQ(metadata_.startTime, segment.metadata.startTime);
+        EXPECT_EQ(metadata_.stopTime, segment.metadata.stopTime);
+
+        ASSERT_EQ(states.getSize(), segment.states.getSize());
+
+        for (Size i = 0; i < states.getSize(); ++i)
+        {
+            EXPECT_EQ(states[i].accessInstant(), segment.states[i].accessInstant());
+            EXPECT_TRUE(states[i].getPosition().getCoordinates().isApprox(
+                segment.states[i].getPosition().getCoordinates(), 1e-12
+            ));
+            EXPECT_TRUE(states[i].getVelocity().getCoordinates().isApprox(
+                segment.states[i].getVelocity().getCoordinates(), 1e-12
+            ));
+        }
+
+        // Saving a loaded message is lossless
+
+        oem.save(outputFile_);
+
+        EXPECT_EQ(segment.states, OEM::Load(outputFile_).getSegmentAt(0).states);
+
+        outputFile_.remove();
+    }
+
+    {
+        // Propagated states are streamed chunk by chunk
+
+        const Propagator propagator = Propagator::Default();
+
+        const Array<Instant> instants =
+            Interval::Closed(epoch_, epoch_ + Duration::Minutes(10.0)).generateGrid(Duration::Seconds(10.0));
+
+        {
+            OEM::Writer writer = {outputFile_, header_, 16};
+
+            writer.writeMetadata(metadata_);
+            writer.write(propagator, state_, instants);
+        }
+
+        const Array<State> expectedStates = propagator.calculateStatesAt(state_, instants);
+
+        OEM::Reader reader = {outputFile_};
+
+        ASSERT_TRUE(reader.readMetadata());
+
+        const Array<State> states = reader.readStates(instants.getSize() + 1);
+
+        ASSERT_EQ(instants.getSize(), states.getSize());
+
+        for (Size i = 0; i < states.getSize(); ++i)
+        {
+            EXPECT_EQ(instants[i], states[i].accessInstant());
+            EXPECT_TRUE(expectedStates[i].getPosition().getCoordinates().isApprox(
+                states[i].getPosition().getCoordinates(), 1e-9
+            ));
+        }
+
+        outputFile_.remove();
+    }
+
+    {
+        EXPECT_ANY_THROW(OEM::Writer(File::Undefined(), header_));
+        EXPECT_ANY_THROW(OEM::Writer(outputFile_, {"2.0", Instant::Undefined(), "OSTK"}));
+
+        OEM::Writer writer = {outputFile_, header_};
+
+        OEM::Metadata metadata = metadata_;
+        metadata.referenceFrame = "UNKNOWN";
+
+        EXPECT_ANY_THROW(writer.writeMetadata(metadata));
+
+        writer.close();
+
+        outputFile_.remove();
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Message_CCSDS_OEM, Undefined)
+{
+    {
+        EXPECT_FALSE(OEM::Undefined().isDefined());
+        EXPECT_ANY_THROW(OEM::Undefined().getHeader());
+        EXPECT_ANY_THROW(OEM::Undefined().getSegments());
+        EXPECT_ANY_THROW(OEM::Undefined().save(outputFile_));
+    }
+}
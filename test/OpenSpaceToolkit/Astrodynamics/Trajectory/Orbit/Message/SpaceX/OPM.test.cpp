@@ -1,6 +1,7 @@
 /// Apache License 2.0
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Environment.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Message/SpaceX/OPM.hpp>
 
@@ -319,3 +320,76 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Message_SpaceX_OPM, Deplo
         EXPECT_EQ(deployment.velocity, deploymentState.getVelocity());
     }
 }
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Message_SpaceX_OPM, ToStates)
+{
+    using ostk::astrodynamics::trajectory::State;
+
+    {
+        const Array<State> states = this->opm_.toStates();
+
+        ASSERT_EQ(2, states.getSize());
+
+        EXPECT_EQ(this->opm_.getDeploymentAt(0).toState(), states[0]);
+        EXPECT_EQ(this->opm_.getDeploymentAt(1).toState(), states[1]);
+    }
+
+    {
+        EXPECT_ANY_THROW(OPM::Undefined().toStates());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Message_SpaceX_OPM, CalculateStatesAt)
+{
+    using ostk::core::filesystem::Path;
+
+    using ostk::physics::Environment;
+
+    using ostk::astrodynamics::trajectory::Orbit;
+    using ostk::astrodynamics::trajectory::Propagator;
+    using ostk::astrodynamics::trajectory::State;
+
+    const OPM opm = OPM::Load(File::Path(
+        Path::Parse("/app/test/OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Message/SpaceX/OPM/opm_1.yaml")
+    ));
+
+    const Environment environment = Environment::Default();
+    const Propagator propagator = Propagator::Default(environment);
+
+    const Instant horizon = opm.getHeader().launchDate + Duration::Hours(6.0);
+
+    {
+        const Array<State> states = opm.calculateStatesAt(propagator, horizon, 2);
+
+        ASSERT_EQ(2, states.getSize());
+
+        for (Size index = 0; index < states.getSize(); ++index)
+        {
+            const State expectedState = propagator.calculateStateAt(opm.getDeploymentAt(index).toState(), horizon);
+
+            EXPECT_EQ(horizon, states[index].accessInstant());
+            EXPECT_TRUE(states[index].inFrame(Frame::GCRF())
+                            .getCoordinates()
+                            .isApprox(expectedState.inFrame(Frame::GCRF()).getCoordinates(), 1e-12));
+        }
+    }
+
+    {
+        const Array<Orbit> orbits =
+            opm.generateOrbits(propagator, environment.accessCelestialObjectWithName("Earth"), horizon, 2);
+
+        ASSERT_EQ(2, orbits.getSize());
+
+        for (Size index = 0; index < orbits.getSize(); ++index)
+        {
+            const State deploymentState = opm.getDeploymentAt(index).toState();
+
+            EXPECT_TRUE(orbits[index].isDefined());
+            EXPECT_TRUE(orbits[index]
+                            .getStateAt(deploymentState.accessInstant())
+                            .inFrame(Frame::ITRF())
+                            .getCoordinates()
+                            .isApprox(deploymentState.getCoordinates(), 1e-9));
+        }
+    }
+}
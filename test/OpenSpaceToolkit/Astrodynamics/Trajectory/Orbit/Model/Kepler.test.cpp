@@ -30,6 +30,7 @@ using ostk::core::filesystem::File;
 using ostk::core::filesystem::Path;
 using ostk::core::type::Real;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 
 using ostk::mathematics::object::Vector3d;
 
@@ -47,6 +48,7 @@ using ostk::physics::unit::Angle;
 using ostk::physics::unit::Derived;
 using ostk::physics::unit::Length;
 
+using ostk::astrodynamics::trajectory::Ephemeris;
 using ostk::astrodynamics::trajectory::Orbit;
 using ostk::astrodynamics::trajectory::orbit::model::Kepler;
 using ostk::astrodynamics::trajectory::orbit::model::kepler::COE;
@@ -802,3 +804,302 @@ TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Kepler, Test_6)
         }
     }
 }
+
+TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Kepler, CalculateStatesAt)
+{
+    {
+        const Instant epoch = Instant::DateTime(DateTime::Parse("2018-01-01 00:00:00"), Scale::UTC);
+        const Derived gravitationalParameter = Earth::EGM2008.gravitationalParameter_;
+        const Length equatorialRadius = Earth::EGM2008.equatorialRadius_;
+        const Real J2 = Earth::EGM2008.J2_;
+        const Real J4 = Earth::EGM2008.J4_;
+
+        const Array<Instant> instants =
+            Interval::Closed(epoch - Duration::Hours(2.0), epoch + Duration::Hours(6.0))
+                .generateGrid(Duration::Seconds(37.0));
+
+        for (const auto& eccentricity : Array<Real> {0.0, 0.1, 0.7})
+        {
+            const COE coe = {
+                Length::Kilometers(7000.0 / (1.0 - eccentricity)),
+                eccentricity,
+                Angle::Degrees(97.5),
+                Angle::Degrees(20.0),
+                Angle::Degrees(30.0),
+                Angle::Degrees(40.0)
+            };
+
+            for (const auto& perturbationType :
+                 {Kepler::PerturbationType::None, Kepler::PerturbationType::J2, Kepler::PerturbationType::J4})
+            {
+                const Kepler keplerianModel = {
+                    coe, epoch, gravitationalParameter, equatorialRadius, J2, J4, perturbationType
+                };
+
+                const Array<State> states = keplerianModel.calculateStatesAt(instants);
+
+                ASSERT_EQ(instants.getSize(), states.getSize());
+
+                for (Size index = 0; index < instants.getSize(); ++index)
+                {
+                    const State referenceState = keplerianModel.calculateStateAt(instants[index]);
+
+                    EXPECT_EQ(instants[index], states[index].accessInstant());
+                    EXPECT_EQ(*Frame::GCRF(), *states[index].accessFrame());
+
+                    EXPECT_GT(
+                        1e-6,
+                        (states[index].getPosition().accessCoordinates() -
+                         referenceState.getPosition().accessCoordinates())
+                            .norm()
+                    );
+                    EXPECT_GT(
+                        1e-9,
+                        (states[index].getVelocity().accessCoordinates() -
+                         referenceState.getVelocity().accessCoordinates())
+                            .norm()
+                    );
+                }
+            }
+        }
+    }
+
+    {
+        const Kepler keplerianModel = {
+            COE::Undefined(),
+            Instant::J2000(),
+            Earth::EGM2008.gravitationalParameter_,
+            Earth::EGM2008.equatorialRadius_,
+            Earth::EGM2008.J2_,
+            Earth::EGM2008.J4_,
+            Kepler::PerturbationType::None
+        };
+
+        EXPECT_ANY_THROW(keplerianModel.calculateStatesAt({Instant::J2000()}));
+    }
+}
+
+TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Kepler, CalculateEphemerisAt)
+{
+    {
+        const Instant epoch = Instant::DateTime(DateTime::Parse("2018-01-01 00:00:00"), Scale::UTC);
+
+        const COE coe = {
+            Length::Kilometers(7500.0),
+            0.1,
+            Angle::Degrees(97.5),
+            Angle::Degrees(20.0),
+            Angle::Degrees(30.0),
+            Angle::Degrees(40.0)
+        };
+
+        const Kepler keplerianModel = {
+            coe,
+            epoch,
+            Earth::EGM2008.gravitationalParameter_,
+            Earth::EGM2008.equatorialRadius_,
+            Earth::EGM2008.J2_,
+            Earth::EGM2008.J4_,
+            Kepler::PerturbationType::J2
+        };
+
+        const Array<Instant> instants =
+            Interval::Closed(epoch, epoch + Duration::Hours(3.0)).generateGrid(Duration::Seconds(60.0));
+
+        const Ephemeris ephemeris = keplerianModel.calculateEphemerisAt(instants);
+
+        ASSERT_TRUE(ephemeris.isDefined());
+        ASSERT_EQ(instants.getSize(), ephemeris.getSize());
+
+        EXPECT_EQ(*Frame::GCRF(), *ephemeris.accessFrame());
+
+        for (Size index = 0; index < instants.getSize(); ++index)
+        {
+            const State referenceState = keplerianModel.calculateStateAt(instants[index]);
+
+            EXPECT_GT(
+                1e-6,
+                (ephemeris.accessPositions().row(index).transpose() - referenceState.accessPositionCoordinates())
+                    .norm()
+            );
+            EXPECT_GT(
+                1e-9,
+                (ephemeris.accessVelocities().row(index).transpose() - referenceState.accessVelocityCoordinates())
+                    .norm()
+            );
+        }
+
+        EXPECT_FALSE(keplerianModel.calculateEphemerisAt(Array<Instant>::Empty()).isDefined());
+        EXPECT_ANY_THROW(keplerianModel.calculateEphemerisAt({Instant::Undefined()}));
+    }
+}
+
+TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Kepler, CalculateCOEsAt)
+{
+    {
+        const Instant epoch = Instant::DateTime(DateTime::Parse("2018-01-01 00:00:00"), Scale::UTC);
+        const Derived gravitationalParameter = Earth::EGM2008.gravitationalParameter_;
+
+        const Array<Instant> instants =
+            Interval::Closed(epoch - Duration::Hours(1.0), epoch + Duration::Hours(3.0))
+                .generateGrid(Duration::Seconds(60.0));
+
+        for (const auto& eccentricity : Array<Real> {0.0, 0.1})
+        {
+            const COE coe = {
+                Length::Kilometers(7500.0),
+                eccentricity,
+                Angle::Degrees(97.5),
+                Angle::Degrees(20.0),
+                Angle::Degrees(30.0),
+                Angle::Degrees(40.0)
+            };
+
+            for (const auto& perturbationType : {Kepler::PerturbationType::None, Kepler::PerturbationType::J2})
+            {
+                const Kepler keplerianModel = {
+                    coe,
+                    epoch,
+                    gravitationalParameter,
+                    Earth::EGM2008.equatorialRadius_,
+                    Earth::EGM2008.J2_,
+                    Earth::EGM2008.J4_,
+                    perturbationType
+                };
+
+                const Array<COE> coes = keplerianModel.calculateCOEsAt(instants);
+
+                ASSERT_EQ(instants.getSize(), coes.getSize());
+
+                // Elements reproduce the states of the model
+
+                for (Size index = 0; index < instants.getSize(); ++index)
+                {
+                    const State referenceState = keplerianModel.calculateStateAt(instants[index]);
+
+                    const COE::CartesianState cartesianState =
+                        coes[index].getCartesianState(gravitationalParameter, Frame::GCRF());
+
+                    EXPECT_EQ(coe.getSemiMajorAxis(), coes[index].getSemiMajorAxis());
+                    EXPECT_EQ(coe.getInclination(), coes[index].getInclination());
+
+                    EXPECT_GT(
+                        1e-3,
+                        (cartesianState.first.accessCoordinates() - referenceState.accessPositionCoordinates()).norm()
+                    );
+                    EXPECT_GT(
+                        1e-6,
+                        (cartesianState.second.accessCoordinates() - referenceState.accessVelocityCoordinates()).norm()
+                    );
+                }
+            }
+        }
+    }
+
+    {
+        const Instant epoch = Instant::DateTime(DateTime::Parse("2018-01-01 00:00:00"), Scale::UTC);
+
+        const COE coe = {
+            Length::Kilometers(7500.0),
+            0.1,
+            Angle::Degrees(97.5),
+            Angle::Degrees(20.0),
+            Angle::Degrees(30.0),
+            Angle::Degrees(40.0)
+        };
+
+        const Kepler keplerianModel = {
+            coe,
+            epoch,
+            Earth::EGM2008.gravitationalParameter_,
+            Earth::EGM2008.equatorialRadius_,
+            Earth::EGM2008.J2_,
+            Earth::EGM2008.J4_,
+            Kepler::PerturbationType::None
+        };
+
+        EXPECT_TRUE(keplerianModel.calculateCOEsAt(Array<Instant>::Empty()).isEmpty());
+        EXPECT_ANY_THROW(keplerianModel.calculateCOEsAt({Instant::Undefined()}));
+    }
+}
+
+TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Kepler, EstimateAscendingNodeInstant)
+{
+    {
+        const Instant epoch = Instant::DateTime(DateTime::Parse("2018-01-01 00:00:00"), Scale::UTC);
+        const Derived gravitationalParameter = Earth::EGM2008.gravitationalParameter_;
+        const Length equatorialRadius = Earth::EGM2008.equatorialRadius_;
+        const Real J2 = Earth::EGM2008.J2_;
+        const Real J4 = Earth::EGM2008.J4_;
+
+        for (const auto& eccentricity : Array<Real> {0.0, 0.1, 0.7})
+        {
+            const COE coe = {
+                Length::Kilometers(7000.0 / (1.0 - eccentricity)),
+                eccentricity,
+                Angle::Degrees(97.5),
+                Angle::Degrees(20.0),
+                Angle::Degrees(30.0),
+                Angle::Degrees(40.0)
+            };
+
+            for (const auto& perturbationType :
+                 {Kepler::PerturbationType::None, Kepler::PerturbationType::J2, Kepler::PerturbationType::J4})
+            {
+                const Kepler keplerianModel = {
+                    coe, epoch, gravitationalParameter, equatorialRadius, J2, J4, perturbationType
+                };
+
+                Instant previousInstant = Instant::Undefined();
+
+                for (const auto& revolutionNumber : {-3, 1, 2, 3, 100})
+                {
+                    const Instant instant = keplerianModel.estimateAscendingNodeInstant(revolutionNumber);
+
+                    ASSERT_TRUE(instant.isDefined());
+
+                    if (previousInstant.isDefined())
+                    {
+                        EXPECT_LT(previousInstant, instant);
+                    }
+
+                    // The revolution at epoch started before the epoch, at the previous ascending node
+
+                    if (revolutionNumber == 1)
+                    {
+                        EXPECT_LT(instant, epoch);
+                    }
+
+                    if (revolutionNumber == 2)
+                    {
+                        EXPECT_GT(instant, epoch);
+                    }
+
+                    const State state = keplerianModel.calculateStateAt(instant);
+
+                    const Real z = state.getPosition().accessCoordinates().z();
+                    const Real zDot = state.getVelocity().accessCoordinates().z();
+
+                    EXPECT_GT(zDot, 0.0);
+                    EXPECT_GT(0.1, std::abs(z / zDot));
+
+                    previousInstant = instant;
+                }
+            }
+        }
+    }
+
+    {
+        const Kepler keplerianModel = {
+            COE::Undefined(),
+            Instant::J2000(),
+            Earth::EGM2008.gravitationalParameter_,
+            Earth::EGM2008.equatorialRadius_,
+            Earth::EGM2008.J2_,
+            Earth::EGM2008.J4_,
+            Kepler::PerturbationType::None
+        };
+
+        EXPECT_ANY_THROW(keplerianModel.estimateAscendingNodeInstant(1));
+    }
+}
@@ -2,6 +2,7 @@
 
 #include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
 
@@ -15,9 +16,11 @@
 
 #include <Global.test.hpp>
 
+using ostk::core::container::Array;
 using ostk::core::container::Tuple;
 using ostk::core::type::Index;
 using ostk::core::type::Real;
+using ostk::core::type::Size;
 
 using ostk::mathematics::object::Vector3d;
 using ostk::mathematics::object::Vector6d;
@@ -31,6 +34,7 @@ using ostk::physics::unit::Angle;
 using ostk::physics::unit::Derived;
 using ostk::physics::unit::Length;
 
+using ostk::astrodynamics::ExecutionContext;
 using ostk::astrodynamics::trajectory::orbit::model::blm::BrouwerLyddaneMeanLong;
 using ostk::astrodynamics::trajectory::orbit::model::kepler::COE;
 
@@ -323,6 +327,83 @@ TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Kepler_BrouwerLyddane
     }
 }
 
+TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Kepler_BrouwerLyddaneMeanLong, FromCartesianStates)
+{
+    const Derived gravitationalParameter = EarthGravitationalModel::EGM2008.gravitationalParameter_;
+
+    {
+        Array<COE::CartesianState> cartesianStates = Array<COE::CartesianState>::Empty();
+
+        for (Index i = 0; i < 40; ++i)
+        {
+            const COE coe = {
+                Length::Kilometers(6900.0 + 25.0 * i),
+                0.001 + 0.002 * (i % 5),
+                Angle::Degrees(20.0 + 3.0 * i),
+                Angle::Degrees(10.0 * i),
+                Angle::Degrees(15.0 * i),
+                Angle::Degrees(9.0 * i),
+            };
+
+            cartesianStates.add(coe.getCartesianState(gravitationalParameter, Frame::GCRF()));
+        }
+
+        for (const Size threadCount : {1, 4})
+        {
+            const Array<BrouwerLyddaneMeanLong> elementSets =
+                BrouwerLyddaneMeanLong::FromCartesianStates(cartesianStates, gravitationalParameter, threadCount);
+
+            ASSERT_EQ(cartesianStates.getSize(), elementSets.getSize());
+
+            for (Index i = 0; i < cartesianStates.getSize(); ++i)
+            {
+                EXPECT_EQ(
+                    BrouwerLyddaneMeanLong::Cartesian(cartesianStates[i], gravitationalParameter), elementSets[i]
+                );
+            }
+
+            const Array<COE> coes = BrouwerLyddaneMeanLong::ToCOEs(elementSets, threadCount);
+
+            ASSERT_EQ(elementSets.getSize(), coes.getSize());
+
+            for (Index i = 0; i < elementSets.getSize(); ++i)
+            {
+                EXPECT_EQ(elementSets[i].toCOE(), coes[i]);
+            }
+        }
+
+        {
+            const Array<BrouwerLyddaneMeanLong> elementSets =
+                BrouwerLyddaneMeanLong::FromCartesianStates(cartesianStates, gravitationalParameter, ExecutionContext(3));
+
+            EXPECT_EQ(BrouwerLyddaneMeanLong::FromCartesianStates(cartesianStates, gravitationalParameter, 1), elementSets);
+            EXPECT_EQ(BrouwerLyddaneMeanLong::ToCOEs(elementSets, 1), BrouwerLyddaneMeanLong::ToCOEs(elementSets, ExecutionContext(3)));
+        }
+    }
+
+    {
+        const Array<COE::CartesianState> cartesianStates = Array<COE::CartesianState>::Empty();
+
+        EXPECT_TRUE(BrouwerLyddaneMeanLong::FromCartesianStates(cartesianStates, gravitationalParameter).isEmpty());
+        EXPECT_TRUE(BrouwerLyddaneMeanLong::ToCOEs(Array<BrouwerLyddaneMeanLong>::Empty()).isEmpty());
+    }
+
+    {
+        const COE coe = {
+            Length::Meters(2000000.0),
+            0.1,
+            Angle::Degrees(97.80765762597238),
+            Angle::Degrees(19.06529544678578),
+            Angle::Degrees(68.50632506660459),
+            Angle::Degrees(291.4817543658902),
+        };
+
+        EXPECT_ANY_THROW(BrouwerLyddaneMeanLong::FromCartesianStates(
+            {coe.getCartesianState(gravitationalParameter, Frame::GCRF())}, gravitationalParameter, 2
+        ));
+    }
+}
+
 TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Kepler_BrouwerLyddaneMeanLong, Undefined)
 {
     {
@@ -20,8 +20,10 @@
 using ostk::core::container::Array;
 using ostk::core::container::Tuple;
 using ostk::core::type::Real;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 
+using ostk::mathematics::object::MatrixXd;
 using ostk::mathematics::object::Vector3d;
 using ostk::mathematics::object::Vector6d;
 
@@ -33,6 +35,7 @@ using ostk::physics::time::Duration;
 using ostk::physics::unit::Angle;
 using ostk::physics::unit::Derived;
 using ostk::physics::unit::Length;
+using ostk::physics::unit::Time;
 
 using ostk::astrodynamics::trajectory::orbit::model::blm::BrouwerLyddaneMeanLong;
 using ostk::astrodynamics::trajectory::orbit::model::blm::BrouwerLyddaneMeanShort;
@@ -624,6 +627,171 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Kepler_COE, FromSIV
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Kepler_COE, CartesianToSIVector)
+{
+    const Derived gravitationalParameter = Earth::EGM2008.gravitationalParameter_;
+    const Real gravitationalParameter_SI =
+        gravitationalParameter.in(Derived::Unit::GravitationalParameter(Length::Unit::Meter, Time::Unit::Second));
+
+    {
+        const Array<COE> coes = {
+            coe_,
+            COE(defaultSemiMajorAxis_,
+                0.0,
+                defaultInclination_,
+                defaultRaan_,
+                defaultAop_,
+                defaultTrueAnomaly_),
+            COE(defaultSemiMajorAxis_,
+                defaultEccentricity_,
+                Angle::Degrees(0.0),
+                Angle::Degrees(0.0),
+                defaultAop_,
+                defaultTrueAnomaly_),
+            COE(defaultSemiMajorAxis_,
+                0.0,
+                Angle::Degrees(0.0),
+                Angle::Degrees(0.0),
+                Angle::Degrees(0.0),
+                defaultTrueAnomaly_),
+        };
+
+        for (const COE& coe : coes)
+        {
+            const COE::CartesianState cartesianState = coe.getCartesianState(gravitationalParameter, Frame::GCRF());
+
+            Vector6d cartesianVector;
+            cartesianVector << cartesianState.first.getCoordinates(), cartesianState.second.getCoordinates();
+
+            const Vector6d coeVector = COE::CartesianToSIVector(cartesianVector, gravitationalParameter_SI);
+            const Vector6d expectedCOEVector =
+                COE::Cartesian(cartesianState, gravitationalParameter).getSIVector(COE::AnomalyType::True);
+
+            EXPECT_TRUE(coeVector.isApprox(expectedCOEVector, 1e-12));
+        }
+    }
+
+    {
+        const Vector6d cartesianVector = Vector6d::Zero();
+
+        EXPECT_THROW(
+            COE::CartesianToSIVector(cartesianVector, gravitationalParameter_SI), ostk::core::error::runtime::Wrong
+        );
+    }
+
+    {
+        const COE::CartesianState cartesianState = coe_.getCartesianState(gravitationalParameter, Frame::GCRF());
+
+        Vector6d cartesianVector;
+        cartesianVector << cartesianState.first.getCoordinates(), cartesianState.second.getCoordinates();
+
+        EXPECT_THROW(
+            COE::CartesianToSIVector(cartesianVector, Real::Undefined()), ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(COE::CartesianToSIVector(cartesianVector, 0.0), ostk::core::error::runtime::Wrong);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Kepler_COE, SIVectorToCartesian)
+{
+    const Derived gravitationalParameter = Earth::EGM2008.gravitationalParameter_;
+    const Real gravitationalParameter_SI =
+        gravitationalParameter.in(Derived::Unit::GravitationalParameter(Length::Unit::Meter, Time::Unit::Second));
+
+    {
+        const Vector6d cartesianVector =
+            COE::SIVectorToCartesian(coe_.getSIVector(COE::AnomalyType::True), gravitationalParameter_SI);
+
+        const COE::CartesianState cartesianState = coe_.getCartesianState(gravitationalParameter, Frame::GCRF());
+
+        EXPECT_TRUE(cartesianVector.head<3>().isApprox(cartesianState.first.getCoordinates(), 1e-12));
+        EXPECT_TRUE(cartesianVector.tail<3>().isApprox(cartesianState.second.getCoordinates(), 1e-12));
+
+        const Vector6d coeVector = COE::CartesianToSIVector(cartesianVector, gravitationalParameter_SI);
+
+        EXPECT_TRUE(coeVector.isApprox(coe_.getSIVector(COE::AnomalyType::True), 1e-12));
+    }
+
+    {
+        EXPECT_THROW(
+            COE::SIVectorToCartesian(coe_.getSIVector(COE::AnomalyType::True), Real::Undefined()),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Kepler_COE, CartesiansToSIVectors_SIVectorsToCartesians)
+{
+    const Derived gravitationalParameter = Earth::EGM2008.gravitationalParameter_;
+    const Real gravitationalParameter_SI =
+        gravitationalParameter.in(Derived::Unit::GravitationalParameter(Length::Unit::Meter, Time::Unit::Second));
+
+    const Array<COE> coes = {
+        coe_,
+        {Length::Kilometers(7200.0), 0.001, Angle::Degrees(98.0), Angle::Degrees(200.0), Angle::Degrees(90.0),
+         Angle::Degrees(300.0)},
+        {Length::Kilometers(26000.0), 0.7, Angle::Degrees(63.4), Angle::Degrees(10.0), Angle::Degrees(270.0),
+         Angle::Degrees(170.0)},
+    };
+
+    MatrixXd cartesianMatrix(coes.getSize(), 6);
+
+    for (Size i = 0; i < coes.getSize(); ++i)
+    {
+        cartesianMatrix.row(i) =
+            COE::SIVectorToCartesian(coes[i].getSIVector(COE::AnomalyType::True), gravitationalParameter_SI)
+                .transpose();
+    }
+
+    for (const auto anomalyType : {COE::AnomalyType::True, COE::AnomalyType::Mean, COE::AnomalyType::Eccentric})
+    {
+        const MatrixXd coeMatrix = COE::CartesiansToSIVectors(cartesianMatrix, gravitationalParameter_SI, anomalyType);
+
+        ASSERT_EQ(cartesianMatrix.rows(), coeMatrix.rows());
+
+        for (Size i = 0; i < coes.getSize(); ++i)
+        {
+            EXPECT_TRUE(coeMatrix.row(i).transpose().isApprox(coes[i].getSIVector(anomalyType), 1e-10));
+        }
+
+        const MatrixXd outputCartesianMatrix =
+            COE::SIVectorsToCartesians(coeMatrix, gravitationalParameter_SI, anomalyType);
+
+        EXPECT_TRUE(outputCartesianMatrix.isApprox(cartesianMatrix, 1e-10));
+    }
+
+    {
+        EXPECT_EQ(0, COE::CartesiansToSIVectors(MatrixXd(0, 6), gravitationalParameter_SI).rows());
+    }
+
+    {
+        EXPECT_THROW(
+            COE::CartesiansToSIVectors(MatrixXd::Zero(2, 3), gravitationalParameter_SI),
+            ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            COE::SIVectorsToCartesians(MatrixXd::Zero(2, 3), gravitationalParameter_SI),
+            ostk::core::error::runtime::Wrong
+        );
+
+        MatrixXd hyperbolicCoeMatrix(1, 6);
+        hyperbolicCoeMatrix << -7.0e6, 1.5, 0.1, 0.2, 0.3, 0.4;
+
+        EXPECT_THROW(
+            COE::SIVectorsToCartesians(hyperbolicCoeMatrix, gravitationalParameter_SI, COE::AnomalyType::Mean),
+            ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            COE::CartesiansToSIVectors(
+                COE::SIVectorsToCartesians(hyperbolicCoeMatrix, gravitationalParameter_SI),
+                gravitationalParameter_SI,
+                COE::AnomalyType::Mean
+            ),
+            ostk::core::error::runtime::Wrong
+        );
+    }
+}
+
 // TEST (OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Kepler_COE, EccentricAnomalyFromTrueAnomaly)
 // {
 
@@ -699,6 +867,40 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Kepler_COE, FromSIV
 
 // }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Kepler_COE, Snapshot)
+{
+    using ostk::core::filesystem::File;
+    using ostk::core::filesystem::Path;
+
+    {
+        const Array<COE> coes = {
+            coe_,
+            COE::FromSIVector({7.0e6, 0.01, 0.5, 1.0, 1.5, 2.0}, COE::AnomalyType::Mean),
+            {Length::Meters(6.8e6),
+             0.0,
+             Angle::Radians(1.0),
+             Angle::Degrees(0.0),
+             Angle::Degrees(0.0),
+             Angle::Degrees(90.0)},
+        };
+
+        File snapshotFile = File::Path(Path::Parse("/tmp/OpenSpaceToolkit_Astrodynamics_COE_Snapshot.coes"));
+
+        COE::SaveSnapshot(coes, snapshotFile);
+
+        EXPECT_EQ(coes, COE::LoadSnapshot(snapshotFile));
+
+        snapshotFile.remove();
+    }
+
+    {
+        EXPECT_ANY_THROW(COE::SaveSnapshot({COE::Undefined()}, File::Path(Path::Parse("/tmp/undefined.coes"))));
+        EXPECT_ANY_THROW(COE::SaveSnapshot({coe_}, File::Undefined()));
+        EXPECT_ANY_THROW(COE::LoadSnapshot(File::Undefined()));
+        EXPECT_ANY_THROW(COE::LoadSnapshot(File::Path(Path::Parse("/does/not/exist.coes"))));
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Kepler_COE, EccentricAnomalyFromMeanAnomaly)
 {
     {
@@ -745,6 +947,66 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Kepler_COE, TrueAno
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Kepler_COE, EccentricAnomaliesFromMeanAnomalies)
+{
+    using ostk::mathematics::object::VectorXd;
+
+    {
+        const VectorXd meanAnomalies = VectorXd::LinSpaced(1000, -10.0, 10.0);
+
+        for (const double eccentricity : {0.0, 0.05, 0.5, 0.9, 0.99})
+        {
+            const VectorXd eccentricAnomalies =
+                COE::EccentricAnomaliesFromMeanAnomalies(meanAnomalies, VectorXd::Constant(1, eccentricity));
+            const VectorXd trueAnomalies =
+                COE::TrueAnomaliesFromMeanAnomalies(meanAnomalies, VectorXd::Constant(1, eccentricity));
+
+            ASSERT_EQ(meanAnomalies.size(), eccentricAnomalies.size());
+            ASSERT_EQ(meanAnomalies.size(), trueAnomalies.size());
+
+            for (Eigen::Index index = 0; index < meanAnomalies.size(); ++index)
+            {
+                const Angle referenceEccentricAnomaly =
+                    COE::EccentricAnomalyFromMeanAnomaly(Angle::Radians(meanAnomalies[index]), eccentricity, 1e-12);
+                const Angle referenceTrueAnomaly =
+                    COE::TrueAnomalyFromMeanAnomaly(Angle::Radians(meanAnomalies[index]), eccentricity, 1e-12);
+
+                EXPECT_NEAR(
+                    referenceEccentricAnomaly.inRadians(0.0, Real::TwoPi()), eccentricAnomalies[index], 1e-10
+                );
+                EXPECT_NEAR(referenceTrueAnomaly.inRadians(0.0, Real::TwoPi()), trueAnomalies[index], 1e-10);
+
+                EXPECT_GE(eccentricAnomalies[index], 0.0);
+                EXPECT_LT(eccentricAnomalies[index], Real::TwoPi());
+            }
+        }
+    }
+
+    {
+        const VectorXd meanAnomalies = VectorXd::LinSpaced(11, 0.0, 6.0);
+        const VectorXd eccentricities = VectorXd::LinSpaced(11, 0.0, 0.9);
+
+        const VectorXd eccentricAnomalies = COE::EccentricAnomaliesFromMeanAnomalies(meanAnomalies, eccentricities);
+
+        for (Eigen::Index index = 0; index < meanAnomalies.size(); ++index)
+        {
+            EXPECT_NEAR(
+                meanAnomalies[index],
+                eccentricAnomalies[index] - eccentricities[index] * std::sin(eccentricAnomalies[index]),
+                1e-12
+            );
+        }
+    }
+
+    {
+        EXPECT_TRUE(COE::EccentricAnomaliesFromMeanAnomalies(VectorXd(0), VectorXd::Constant(1, 0.1)).size() == 0);
+
+        EXPECT_ANY_THROW(COE::EccentricAnomaliesFromMeanAnomalies(VectorXd::Zero(3), VectorXd::Zero(2)));
+        EXPECT_ANY_THROW(COE::EccentricAnomaliesFromMeanAnomalies(VectorXd::Zero(3), VectorXd::Constant(1, 1.0)));
+        EXPECT_ANY_THROW(COE::EccentricAnomaliesFromMeanAnomalies(VectorXd::Zero(3), VectorXd::Constant(1, -0.1)));
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Kepler_COE, StringFromElement)
 {
     const Array<Tuple<COE::Element, String>> testCases = {
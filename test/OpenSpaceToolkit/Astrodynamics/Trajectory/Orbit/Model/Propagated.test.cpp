@@ -1,6 +1,7 @@
 /// Apache License 2.0
 
 #include <numeric>
+#include <thread>
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Table.hpp>
@@ -23,6 +24,7 @@
 
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/CentralBodyGravity.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/PositionDerivative.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/ExecutionContext.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Propagated.hpp>
@@ -35,6 +37,7 @@ using ostk::core::container::Array;
 using ostk::core::container::Table;
 using ostk::core::filesystem::File;
 using ostk::core::filesystem::Path;
+using ostk::core::type::Index;
 using ostk::core::type::Integer;
 using ostk::core::type::Real;
 using ostk::core::type::Shared;
@@ -62,6 +65,7 @@ using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth
 using ostk::astrodynamics::Dynamics;
 using ostk::astrodynamics::dynamics::CentralBodyGravity;
 using ostk::astrodynamics::dynamics::PositionDerivative;
+using ostk::astrodynamics::ExecutionContext;
 using ostk::astrodynamics::flight::system::SatelliteSystem;
 using ostk::astrodynamics::trajectory::Orbit;
 using ostk::astrodynamics::trajectory::orbit::model::Propagated;
@@ -455,6 +459,97 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagated, Calcula
 
         validatePropagatedStates(cachedStateArray);
     }
+
+    // Test that windows processed in parallel give the same states, in the same order, as a single worker
+
+    {
+        Array<State> cachedStateArray = Array<State>::Empty();
+        for (Size i = 10; i < 50; i += 5)
+        {
+            cachedStateArray.add(getState(i));
+        }
+
+        const Propagated propagatedModel = {propagator_, cachedStateArray};
+
+        const Array<State> referenceStateArray = propagatedModel.calculateStatesAt(instantArray, 1);
+
+        ASSERT_EQ(instantArray.getSize(), referenceStateArray.getSize());
+
+        for (const Size threadCount : Array<Size>({0, 3}))
+        {
+            EXPECT_EQ(referenceStateArray, propagatedModel.calculateStatesAt(instantArray, threadCount));
+        }
+
+        EXPECT_EQ(referenceStateArray, propagatedModel.calculateStatesAt(instantArray));
+
+        // Nested within a parallel operation, windows are processed serially on each worker
+
+        const Array<Array<State>> nestedStateArrays = ExecutionContext(2).map<Array<State>>(
+            4,
+            [&propagatedModel, &instantArray](const Index&) -> Array<State>
+            {
+                return propagatedModel.calculateStatesAt(instantArray, 0);
+            }
+        );
+
+        for (const Array<State>& nestedStateArray : nestedStateArrays)
+        {
+            EXPECT_EQ(referenceStateArray, nestedStateArray);
+        }
+    }
+
+    // Test Hermite interpolation between cached states, two minutes apart
+
+    {
+        Array<State> cachedStateArray = Array<State>::Empty();
+        for (Size i = 0; i < instantArray.getSize(); i += 2)
+        {
+            cachedStateArray.add(getState(i));
+        }
+
+        Propagated propagatedModel = {propagator_, cachedStateArray};
+
+        EXPECT_FALSE(propagatedModel.getHermiteInterpolationSpan().isDefined());
+
+        propagatedModel.setHermiteInterpolationSpan(Duration::Minutes(2.0));
+
+        EXPECT_EQ(Duration::Minutes(2.0), propagatedModel.getHermiteInterpolationSpan());
+
+        const Array<State> interpolatedStateArray = propagatedModel.calculateStatesAt(instantArray);
+
+        ASSERT_EQ(instantArray.getSize(), interpolatedStateArray.getSize());
+
+        for (Size i = 0; i < interpolatedStateArray.getSize(); i++)
+        {
+            const double positionError =
+                (interpolatedStateArray[i].getPosition().accessCoordinates() - referencePositionArray[i]).norm();
+            const double velocityError =
+                (interpolatedStateArray[i].getVelocity().accessCoordinates() - referenceVelocityArray[i]).norm();
+
+            EXPECT_EQ(instantArray[i], interpolatedStateArray[i].getInstant());
+            EXPECT_GT(1e-1, positionError);
+            EXPECT_GT(1e-3, velocityError);
+        }
+
+        // Windows longer than the span are propagated
+
+        propagatedModel.setHermiteInterpolationSpan(Duration::Minutes(1.0));
+
+        const Array<State> propagatedStateArray = propagatedModel.calculateStatesAt(instantArray);
+
+        for (Size i = 0; i < propagatedStateArray.getSize(); i++)
+        {
+            EXPECT_GT(
+                2e-7, (propagatedStateArray[i].getPosition().accessCoordinates() - referencePositionArray[i]).norm()
+            );
+        }
+
+        propagatedModel.setHermiteInterpolationSpan(Duration::Undefined());
+
+        EXPECT_FALSE(propagatedModel.getHermiteInterpolationSpan().isDefined());
+
+        EXPECT_THROW(propagatedModel.setHermiteInterpolationSpan(Duration::Zero()), ostk::core::error::runtime::Wrong);
+    }
 }
 
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagated, CalculateRevolutionNumberAt)
@@ -616,6 +711,222 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagated, AccessC
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagated, AddCachedState)
+{
+    const Instant startInstant = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+
+    const auto getState = [this, &startInstant](const Real& aMinuteCount) -> State
+    {
+        return {startInstant + Duration::Minutes(aMinuteCount), defaultPosition_, defaultVelocity_};
+    };
+
+    const auto getCachedInstants = [](const Propagated& aPropagatedModel) -> Array<Instant>
+    {
+        return aPropagatedModel.accessCachedStateArray().map<Instant>(
+            [](const State& aState) -> Instant
+            {
+                return aState.getInstant();
+            }
+        );
+    };
+
+    Propagated propagatedModel = {propagator_, getState(0.0)};
+
+    EXPECT_EQ(0, propagatedModel.getCachePolicy().maximumStateCount);
+    EXPECT_EQ(0, propagatedModel.getCachePolicy().maximumMemorySize);
+
+    // States are inserted in chronological order
+
+    {
+        propagatedModel.addCachedState(getState(3.0));
+        propagatedModel.addCachedState(getState(1.0));
+        propagatedModel.addCachedState(getState(2.0));
+        propagatedModel.addCachedState(getState(1.0));
+
+        EXPECT_EQ(
+            Array<Instant>({
+                getState(0.0).getInstant(),
+                getState(1.0).getInstant(),
+                getState(2.0).getInstant(),
+                getState(3.0).getInstant(),
+            }),
+            getCachedInstants(propagatedModel)
+        );
+
+        const State conflictingState = {
+            getState(1.0).getInstant(), Position::Meters({7000000.0, 1.0, 0.0}, gcrfSPtr_), defaultVelocity_
+        };
+
+        EXPECT_THROW(propagatedModel.addCachedState(conflictingState), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(propagatedModel.addCachedState(State::Undefined()), ostk::core::error::runtime::Undefined);
+    }
+
+    // Least recently queried states are evicted first, anchor states are kept
+
+    {
+        propagatedModel.calculateStatesAt({startInstant + Duration::Minutes(2.5)});
+
+        propagatedModel.setCachePolicy({3, 0});
+
+        EXPECT_EQ(3, propagatedModel.getCachePolicy().maximumStateCount);
+        EXPECT_EQ(
+            Array<Instant>({
+                getState(0.0).getInstant(),
+                getState(2.0).getInstant(),
+                getState(3.0).getInstant(),
+            }),
+            getCachedInstants(propagatedModel)
+        );
+
+        propagatedModel.addCachedState(getState(4.0));
+
+        EXPECT_EQ(3, propagatedModel.accessCachedStateArray().getSize());
+        EXPECT_EQ(getState(4.0).getInstant(), propagatedModel.accessCachedStateArray().accessLast().getInstant());
+
+        propagatedModel.setCachePolicy({0, 1});
+
+        EXPECT_EQ(Array<Instant>({getState(0.0).getInstant()}), getCachedInstants(propagatedModel));
+
+        propagatedModel.setCachePolicy(Propagated::CachePolicy::Unbounded());
+        propagatedModel.addCachedState(getState(5.0));
+
+        EXPECT_EQ(2, propagatedModel.accessCachedStateArray().getSize());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagated, CheckpointSpacing)
+{
+    const Propagated referenceModel = {propagator_, defaultState_};
+
+    {
+        Propagated propagatedModel = {propagator_, defaultState_};
+
+        EXPECT_FALSE(propagatedModel.getCheckpointSpacing().isDefined());
+
+        EXPECT_THROW(propagatedModel.setCheckpointSpacing(Duration::Zero()), ostk::core::error::runtime::Wrong);
+
+        propagatedModel.setCheckpointSpacing(Duration::Minutes(10.0));
+
+        EXPECT_EQ(Duration::Minutes(10.0), propagatedModel.getCheckpointSpacing());
+
+        // Checkpoints are laid every ten minutes, up to the queried instant
+
+        const Instant instant = defaultInstant_ + Duration::Minutes(60.0);
+
+        const State state = propagatedModel.calculateStateAt(instant);
+
+        EXPECT_EQ(7, propagatedModel.accessCachedStateArray().getSize());
+        EXPECT_EQ(instant, propagatedModel.accessCachedStateArray().accessLast().getInstant());
+        EXPECT_EQ(defaultInstant_, propagatedModel.getEpoch());
+        EXPECT_GT(
+            1e-3,
+            (state.getPosition().accessCoordinates() -
+             referenceModel.calculateStateAt(instant).getPosition().accessCoordinates())
+                .norm()
+        );
+
+        // Backward queries do not add checkpoints
+
+        propagatedModel.calculateStateAt(defaultInstant_ - Duration::Minutes(30.0));
+
+        EXPECT_EQ(7, propagatedModel.accessCachedStateArray().getSize());
+
+        // Checkpoints are subject to the cache policy
+
+        propagatedModel.setCachePolicy({3, 0});
+
+        EXPECT_EQ(3, propagatedModel.accessCachedStateArray().getSize());
+        EXPECT_EQ(defaultInstant_, propagatedModel.getEpoch());
+
+        propagatedModel.setCheckpointSpacing(Duration::Undefined());
+
+        EXPECT_FALSE(propagatedModel.getCheckpointSpacing().isDefined());
+    }
+
+    // Concurrent queries
+
+    {
+        Propagated propagatedModel = {propagator_, defaultState_};
+
+        propagatedModel.setCheckpointSpacing(Duration::Minutes(5.0));
+
+        const Size threadCount = 4;
+
+        Array<State> states(threadCount, State::Undefined());
+
+        std::vector<std::thread> threads;
+
+        for (Size threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            threads.emplace_back(
+                [&propagatedModel, &states, threadIndex, this]() -> void
+                {
+                    states[threadIndex] = propagatedModel.calculateStateAt(
+                        defaultInstant_ + Duration::Minutes(20.0 * (threadIndex + 1))
+                    );
+                }
+            );
+        }
+
+        // The cache is read consistently while queries insert checkpoints into it
+
+        Size inconsistentReadCount = 0;
+
+        threads.emplace_back(
+            [&propagatedModel, &inconsistentReadCount]() -> void
+            {
+                for (Size i = 0; i < 100; ++i)
+                {
+                    const Array<State> cachedStateArray = propagatedModel.getCachedStateArray();
+
+                    if ((!propagatedModel.isDefined()) || cachedStateArray.isEmpty())
+                    {
+                        ++inconsistentReadCount;
+                    }
+
+                    for (Size j = 0; j + 1 < cachedStateArray.getSize(); ++j)
+                    {
+                        if (cachedStateArray[j].getInstant() >= cachedStateArray[j + 1].getInstant())
+                        {
+                            ++inconsistentReadCount;
+                        }
+                    }
+                }
+            }
+        );
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(0, inconsistentReadCount);
+
+        for (Size threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            const Instant instant = defaultInstant_ + Duration::Minutes(20.0 * (threadIndex + 1));
+
+            EXPECT_EQ(instant, states[threadIndex].getInstant());
+            EXPECT_GT(
+                1e-3,
+                (states[threadIndex].getPosition().accessCoordinates() -
+                 referenceModel.calculateStateAt(instant).getPosition().accessCoordinates())
+                    .norm()
+            );
+        }
+
+        const Array<State> cachedStateArray = propagatedModel.getCachedStateArray();
+
+        EXPECT_EQ(propagatedModel.accessCachedStateArray(), cachedStateArray);
+        EXPECT_LT(1, cachedStateArray.getSize());
+
+        for (Size i = 0; i < cachedStateArray.getSize() - 1; ++i)
+        {
+            EXPECT_LT(cachedStateArray[i].getInstant(), cachedStateArray[i + 1].getInstant());
+        }
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagated, SetCachedStateArray)
 {
     // Current state and instant setup
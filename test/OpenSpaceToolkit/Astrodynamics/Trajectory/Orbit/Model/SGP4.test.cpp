@@ -223,3 +223,187 @@ TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_SGP4, Test_1)
         }
     }
 }
+
+TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_SGP4, CalculateCatalogStatesAt)
+{
+    using ostk::core::container::Array;
+    using ostk::core::type::Size;
+
+    using ostk::mathematics::object::MatrixXd;
+
+    using ostk::physics::time::Duration;
+    using ostk::physics::time::Instant;
+
+    using ostk::astrodynamics::ExecutionContext;
+    using ostk::astrodynamics::trajectory::orbit::model::SGP4;
+    using ostk::astrodynamics::trajectory::orbit::model::sgp4::TLE;
+    using ostk::astrodynamics::trajectory::State;
+
+    {
+        const Array<TLE> tles = {
+            TLE(
+                "1 25544U 98067A   18207.57531344  .00001549  00000-0  30766-4 0  9995",
+                "2 25544  51.6395 182.3890 0004258   3.1656 107.7911 15.54015933124641"
+            ),
+            TLE(
+                "1 25544U 98067A   18231.17878740  .00000187  00000-0  10196-4 0  9994",
+                "2 25544  51.6447  64.7824 0005971  73.1467  36.4366 15.53848234128316"
+            ),
+        };
+
+        Array<Instant> instants = Array<Instant>::Empty();
+        for (Size i = 0; i < 5; ++i)
+        {
+            instants.add(tles[0].getEpoch() + Duration::Minutes(60.0 * i));
+        }
+
+        for (const Size threadCount : Array<Size>({0, 1, 2}))
+        {
+            const MatrixXd states = SGP4::CalculateCatalogStatesAt(tles, instants, threadCount);
+
+            ASSERT_EQ(6, states.rows());
+            ASSERT_EQ(Size(instants.getSize() * tles.getSize()), Size(states.cols()));
+
+            for (Size tleIndex = 0; tleIndex < tles.getSize(); ++tleIndex)
+            {
+                const SGP4 sgp4Model = {tles[tleIndex]};
+
+                for (Size instantIndex = 0; instantIndex < instants.getSize(); ++instantIndex)
+                {
+                    const State referenceState = sgp4Model.calculateStateAt(instants[instantIndex]);
+
+                    const auto state = states.col(instantIndex * tles.getSize() + tleIndex);
+
+                    EXPECT_GT(1e-2, (state.head<3>() - referenceState.getPosition().accessCoordinates()).norm());
+                    EXPECT_GT(1e-5, (state.tail<3>() - referenceState.getVelocity().accessCoordinates()).norm());
+                }
+            }
+        }
+
+        EXPECT_EQ(
+            SGP4::CalculateCatalogStatesAt(tles, instants, 1),
+            SGP4::CalculateCatalogStatesAt(tles, instants, ExecutionContext(2))
+        );
+    }
+
+    {
+        EXPECT_EQ(0, SGP4::CalculateCatalogStatesAt(Array<TLE>::Empty(), Array<Instant>::Empty()).size());
+
+        EXPECT_ANY_THROW(SGP4::CalculateCatalogStatesAt(
+            {TLE(
+                "1 25544U 98067A   18207.57531344  .00001549  00000-0  30766-4 0  9995",
+                "2 25544  51.6395 182.3890 0004258   3.1656 107.7911 15.54015933124641"
+            )},
+            {Instant::Undefined()}
+        ));
+    }
+}
+
+TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_SGP4, OutputFrame)
+{
+    using ostk::physics::coordinate::Frame;
+    using ostk::physics::time::Duration;
+    using ostk::physics::time::Instant;
+
+    using ostk::astrodynamics::trajectory::orbit::model::SGP4;
+    using ostk::astrodynamics::trajectory::orbit::model::sgp4::TLE;
+    using ostk::astrodynamics::trajectory::State;
+
+    const TLE tle = {
+        "1 25544U 98067A   18207.57531344  .00001549  00000-0  30766-4 0  9995",
+        "2 25544  51.6395 182.3890 0004258   3.1656 107.7911 15.54015933124641"
+    };
+
+    const SGP4 gcrfModel = {tle};
+    const SGP4 temeModel = {tle, SGP4::OutputFrame::TEME};
+    const SGP4 temeOfEpochModel = {tle, SGP4::OutputFrame::TEMEOfEpoch};
+
+    EXPECT_EQ(SGP4::OutputFrame::GCRF, gcrfModel.getOutputFrame());
+    EXPECT_EQ(SGP4::OutputFrame::TEME, temeModel.getOutputFrame());
+    EXPECT_EQ(SGP4::OutputFrame::TEMEOfEpoch, temeOfEpochModel.getOutputFrame());
+
+    EXPECT_NE(gcrfModel, temeOfEpochModel);
+    EXPECT_EQ(temeOfEpochModel, SGP4(temeOfEpochModel));
+
+    EXPECT_EQ("GCRF", SGP4::StringFromOutputFrame(SGP4::OutputFrame::GCRF));
+    EXPECT_EQ("TEME", SGP4::StringFromOutputFrame(SGP4::OutputFrame::TEME));
+    EXPECT_EQ("TEMEOfEpoch", SGP4::StringFromOutputFrame(SGP4::OutputFrame::TEMEOfEpoch));
+
+    const Instant instant = tle.getEpoch() + Duration::Hours(6.0);
+
+    const State state_GCRF = gcrfModel.calculateStateAt(instant);
+    const State state_TEME = temeModel.calculateStateAt(instant);
+    const State state_TEMEOfEpoch = temeOfEpochModel.calculateStateAt(instant);
+
+    EXPECT_EQ(*Frame::GCRF(), *state_GCRF.accessFrame());
+    EXPECT_EQ(*Frame::TEME(), *state_TEME.accessFrame());
+    EXPECT_EQ(*Frame::TEMEOfEpoch(tle.getEpoch()), *state_TEMEOfEpoch.accessFrame());
+
+    for (const State& state : {state_TEME, state_TEMEOfEpoch})
+    {
+        const State state_inGCRF = state.inFrame(Frame::GCRF());
+
+        EXPECT_GT(
+            1e-3, (state_inGCRF.getPosition().accessCoordinates() - state_GCRF.getPosition().accessCoordinates()).norm()
+        );
+        EXPECT_GT(
+            1e-6, (state_inGCRF.getVelocity().accessCoordinates() - state_GCRF.getVelocity().accessCoordinates()).norm()
+        );
+    }
+}
+
+TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_SGP4, CalculateRevolutionNumberAt)
+{
+    using ostk::core::type::Integer;
+
+    using ostk::physics::Environment;
+    using ostk::physics::time::Duration;
+    using ostk::physics::time::Instant;
+
+    using ostk::astrodynamics::trajectory::Orbit;
+    using ostk::astrodynamics::trajectory::orbit::model::SGP4;
+    using ostk::astrodynamics::trajectory::orbit::model::sgp4::TLE;
+    using ostk::astrodynamics::trajectory::orbit::Pass;
+
+    const TLE tle = {
+        "1 25544U 98067A   18207.57531344  .00001549  00000-0  30766-4 0  9995",
+        "2 25544  51.6395 182.3890 0004258   3.1656 107.7911 15.54015933124641"
+    };
+
+    const SGP4 sgp4Model = {tle};
+
+    {
+        EXPECT_EQ(tle.getRevolutionNumberAtEpoch(), sgp4Model.calculateRevolutionNumberAt(tle.getEpoch()));
+    }
+
+    // Revolution numbers are consistent with the passes found by the orbit, within their ascending nodes
+
+    {
+        const Orbit orbit = {sgp4Model, Environment::Default().accessCelestialObjectWithName("Earth")};
+
+        for (const Integer& revolutionNumber : {Integer(12462), Integer(12464), Integer(12465), Integer(12480)})
+        {
+            const Pass pass = orbit.getPassWithRevolutionNumber(revolutionNumber);
+
+            const Instant ascendingNodeInstant = pass.accessInstantAtAscendingNode();
+            const Instant passBreakInstant = pass.accessInstantAtPassBreak();
+
+            EXPECT_EQ(
+                revolutionNumber,
+                sgp4Model.calculateRevolutionNumberAt(
+                    ascendingNodeInstant + Duration::Between(ascendingNodeInstant, passBreakInstant) / 2.0
+                )
+            );
+            EXPECT_EQ(
+                revolutionNumber, sgp4Model.calculateRevolutionNumberAt(ascendingNodeInstant + Duration::Minutes(1.0))
+            );
+            EXPECT_EQ(
+                revolutionNumber, sgp4Model.calculateRevolutionNumberAt(passBreakInstant - Duration::Minutes(1.0))
+            );
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(sgp4Model.calculateRevolutionNumberAt(Instant::Undefined()));
+    }
+}
@@ -1173,6 +1173,134 @@ TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_SGP4_TLE, Load)
     }
 }
 
+TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_SGP4_TLE, LoadCatalog)
+{
+    using ostk::core::container::Array;
+    using ostk::core::filesystem::File;
+    using ostk::core::filesystem::Path;
+    using ostk::core::type::String;
+
+    using ostk::astrodynamics::ExecutionContext;
+    using ostk::astrodynamics::trajectory::orbit::model::sgp4::TLE;
+
+    {
+        const File activeTlesFile =
+            File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/SGP4/TLE/active.txt"
+            ));
+
+        const Array<TLE> tles = TLE::LoadCatalog(activeTlesFile);
+
+        EXPECT_EQ(2458, tles.getSize());
+
+        std::istringstream allTlesStream {activeTlesFile.getContents()};
+
+        String satelliteName;
+        String firstLine;
+        String secondLine;
+
+        for (const auto& tle : tles)
+        {
+            std::getline(allTlesStream, satelliteName);
+            std::getline(allTlesStream, firstLine);
+            std::getline(allTlesStream, secondLine);
+
+            EXPECT_EQ(TLE::Parse(String::Format("{}\n{}\n{}\n", satelliteName, firstLine, secondLine)), tle);
+            EXPECT_EQ(satelliteName, tle.getSatelliteName());
+        }
+
+        EXPECT_EQ(tles, TLE::LoadCatalog(activeTlesFile, 1));
+        EXPECT_EQ(tles, TLE::LoadCatalog(activeTlesFile, 3));
+        EXPECT_EQ(tles, TLE::LoadCatalog(activeTlesFile, ExecutionContext(2)));
+        EXPECT_EQ(tles, TLE::ParseCatalog(activeTlesFile.getContents(), ExecutionContext(4)));
+    }
+
+    {
+        const String catalog =
+            "1 25544U 98067A   18231.17878740  .00000187  00000-0  10196-4 0  9994\r\n"
+            "2 25544  51.6447  64.7824 0005971  73.1467  36.4366 15.53848234128316\r\n"
+            "\r\n"
+            "ISS (ZARYA)\r\n"
+            "1 25544U 98067A   18231.17878740  .00000187  00000-0  10196-4 0  9994\r\n"
+            "2 25544  51.6447  64.7824 0005971  73.1467  36.4366 15.53848234128316";
+
+        const Array<TLE> tles = TLE::ParseCatalog(catalog);
+
+        ASSERT_EQ(2, tles.getSize());
+
+        EXPECT_EQ(String::Empty(), tles[0].getSatelliteName());
+        EXPECT_EQ("ISS (ZARYA)", tles[1].getSatelliteName());
+        EXPECT_EQ(tles[0].getFirstLine(), tles[1].getFirstLine());
+        EXPECT_EQ("2 25544  51.6447  64.7824 0005971  73.1467  36.4366 15.53848234128316", tles[1].getSecondLine());
+        EXPECT_EQ(25544, tles[1].getSatelliteNumber());
+    }
+
+    {
+        EXPECT_TRUE(TLE::ParseCatalog(String::Empty()).isEmpty());
+    }
+
+    {
+        EXPECT_ANY_THROW(TLE::ParseCatalog("ISS (ZARYA)\n"));
+        EXPECT_ANY_THROW(TLE::ParseCatalog(
+            "1 25544U 98067A   18231.17878740  .00000187  00000-0  10196-4 0  9995\n"
+            "2 25544  51.6447  64.7824 0005971  73.1467  36.4366 15.53848234128316\n"
+        ));
+        EXPECT_ANY_THROW(TLE::LoadCatalog(File::Undefined()));
+        EXPECT_ANY_THROW(TLE::LoadCatalog(File::Path(Path::Parse("/does/not/exist.txt"))));
+    }
+}
+
+TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_SGP4_TLE, CatalogSnapshot)
+{
+    using ostk::core::container::Array;
+    using ostk::core::filesystem::File;
+    using ostk::core::filesystem::Path;
+    using ostk::core::type::Size;
+
+    using ostk::astrodynamics::trajectory::orbit::model::sgp4::TLE;
+
+    {
+        const Array<TLE> tles = TLE::LoadCatalog(
+            File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/SGP4/TLE/active.txt"
+            ))
+        );
+
+        File snapshotFile = File::Path(Path::Parse("/tmp/OpenSpaceToolkit_Astrodynamics_TLE_CatalogSnapshot.tles"));
+
+        TLE::SaveCatalogSnapshot(tles, snapshotFile);
+
+        const Array<TLE> loadedTles = TLE::LoadCatalogSnapshot(snapshotFile);
+
+        ASSERT_EQ(tles.getSize(), loadedTles.getSize());
+
+        for (Size index = 0; index < tles.getSize(); ++index)
+        {
+            EXPECT_EQ(tles[index], loadedTles[index]);
+            EXPECT_EQ(tles[index].getSatelliteName(), loadedTles[index].getSatelliteName());
+        }
+
+        snapshotFile.remove();
+    }
+
+    {
+        File snapshotFile = File::Path(Path::Parse("/tmp/OpenSpaceToolkit_Astrodynamics_TLE_CatalogSnapshot.tles"));
+
+        TLE::SaveCatalogSnapshot(Array<TLE>::Empty(), snapshotFile);
+
+        EXPECT_TRUE(TLE::LoadCatalogSnapshot(snapshotFile).isEmpty());
+
+        snapshotFile.remove();
+    }
+
+    {
+        EXPECT_ANY_THROW(TLE::SaveCatalogSnapshot({TLE::Undefined()}, File::Undefined()));
+        EXPECT_ANY_THROW(TLE::LoadCatalogSnapshot(File::Undefined()));
+        EXPECT_ANY_THROW(TLE::LoadCatalogSnapshot(
+            File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/SGP4/TLE/active.txt"
+            ))
+        ));
+    }
+}
+
 TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_SGP4_TLE, Construct)
 {
     using ostk::core::type::Integer;
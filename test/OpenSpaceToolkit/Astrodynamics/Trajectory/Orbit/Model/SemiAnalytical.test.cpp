@@ -0,0 +1,261 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Integer.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Derived.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Time.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/CentralBodyGravity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/PositionDerivative.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Propagated.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/SemiAnalytical.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/NumericalSolver.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Integer;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::Vector6d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Velocity;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::environment::object::celestial::Earth;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+using ostk::physics::unit::Derived;
+using ostk::physics::unit::Length;
+using ostk::physics::unit::Time;
+using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
+
+using ostk::astrodynamics::Dynamics;
+using ostk::astrodynamics::dynamics::CentralBodyGravity;
+using ostk::astrodynamics::dynamics::PositionDerivative;
+using ostk::astrodynamics::trajectory::orbit::model::Propagated;
+using ostk::astrodynamics::trajectory::orbit::model::SemiAnalytical;
+using ostk::astrodynamics::trajectory::Propagator;
+using ostk::astrodynamics::trajectory::State;
+using ostk::astrodynamics::trajectory::state::NumericalSolver;
+
+class OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_SemiAnalytical : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        this->sphericalDynamics_ = {
+            std::make_shared<PositionDerivative>(),
+            std::make_shared<CentralBodyGravity>(std::make_shared<Celestial>(Earth::Spherical())),
+        };
+        this->j2Dynamics_ = {
+            std::make_shared<PositionDerivative>(),
+            std::make_shared<CentralBodyGravity>(std::make_shared<Celestial>(Earth::EGM96(2, 0))),
+        };
+
+        this->state_ = {
+            this->instant_,
+            Position::Meters({7000000.0, 0.0, 0.0}, Frame::GCRF()),
+            Velocity::MetersPerSecond({0.0, 5335.865450622126, 5335.865450622126}, Frame::GCRF()),
+        };
+    }
+
+    const Instant instant_ = Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC);
+    const Derived gravitationalParameter_ = EarthGravitationalModel::EGM96.gravitationalParameter_;
+    const NumericalSolver numericalSolver_ = {
+        NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaFehlberg78, 5.0, 1.0e-12, 1.0e-12
+    };
+
+    Array<Shared<Dynamics>> sphericalDynamics_ = Array<Shared<Dynamics>>::Empty();
+    Array<Shared<Dynamics>> j2Dynamics_ = Array<Shared<Dynamics>>::Empty();
+    State state_ = State::Undefined();
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_SemiAnalytical, Constructor)
+{
+    {
+        EXPECT_NO_THROW(SemiAnalytical(this->state_, this->sphericalDynamics_, this->gravitationalParameter_));
+        EXPECT_NO_THROW(SemiAnalytical(
+            this->state_, this->sphericalDynamics_, this->gravitationalParameter_, Duration::Hours(12.0), 5
+        ));
+    }
+
+    {
+        EXPECT_THROW(
+            SemiAnalytical(State::Undefined(), this->sphericalDynamics_, this->gravitationalParameter_),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            SemiAnalytical(this->state_, Array<Shared<Dynamics>>::Empty(), this->gravitationalParameter_),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            SemiAnalytical(this->state_, this->sphericalDynamics_, Derived::Undefined()),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            SemiAnalytical(this->state_, this->sphericalDynamics_, this->gravitationalParameter_, Duration::Zero()),
+            ostk::core::error::runtime::Wrong
+        );
+    }
+
+    {
+        const State hyperbolicState = {
+            this->instant_,
+            Position::Meters({7000000.0, 0.0, 0.0}, Frame::GCRF()),
+            Velocity::MetersPerSecond({0.0, 12000.0, 0.0}, Frame::GCRF()),
+        };
+
+        EXPECT_THROW(
+            SemiAnalytical(hyperbolicState, this->sphericalDynamics_, this->gravitationalParameter_),
+            ostk::core::error::runtime::Wrong
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_SemiAnalytical, EqualToOperator)
+{
+    const SemiAnalytical semiAnalytical = {this->state_, this->sphericalDynamics_, this->gravitationalParameter_};
+
+    EXPECT_TRUE(semiAnalytical == semiAnalytical);
+    EXPECT_TRUE(semiAnalytical == SemiAnalytical(semiAnalytical));
+    EXPECT_FALSE(semiAnalytical != SemiAnalytical(semiAnalytical));
+    EXPECT_FALSE(
+        semiAnalytical ==
+        SemiAnalytical(this->state_, this->sphericalDynamics_, this->gravitationalParameter_, Duration::Hours(1.0))
+    );
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_SemiAnalytical, Accessors)
+{
+    const SemiAnalytical semiAnalytical = {
+        this->state_, this->sphericalDynamics_, this->gravitationalParameter_, Duration::Hours(12.0), 5
+    };
+
+    EXPECT_TRUE(semiAnalytical.isDefined());
+    EXPECT_EQ(this->state_, semiAnalytical.accessInitialState());
+    EXPECT_EQ(this->sphericalDynamics_, semiAnalytical.getDynamics());
+    EXPECT_EQ(this->gravitationalParameter_, semiAnalytical.getGravitationalParameter());
+    EXPECT_EQ(Duration::Hours(12.0), semiAnalytical.getStepDuration());
+    EXPECT_EQ(this->instant_, semiAnalytical.getEpoch());
+    EXPECT_EQ(5, semiAnalytical.getRevolutionNumberAtEpoch());
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_SemiAnalytical, Print)
+{
+    const SemiAnalytical semiAnalytical = {this->state_, this->sphericalDynamics_, this->gravitationalParameter_};
+
+    testing::internal::CaptureStdout();
+
+    EXPECT_NO_THROW(semiAnalytical.print(std::cout, true));
+    EXPECT_NO_THROW(std::cout << semiAnalytical << std::endl);
+    EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_SemiAnalytical, CalculateMeanElementsAt)
+{
+    // Without perturbations, mean elements are the osculating ones, and only the mean longitude varies
+
+    const SemiAnalytical semiAnalytical = {this->state_, this->sphericalDynamics_, this->gravitationalParameter_};
+
+    const Vector6d initialElements = semiAnalytical.calculateMeanElementsAt(this->instant_);
+    const Vector6d elements = semiAnalytical.calculateMeanElementsAt(this->instant_ + Duration::Days(3.0));
+
+    const double gravitationalParameter_SI = this->gravitationalParameter_.in(
+        Derived::Unit::GravitationalParameter(Length::Unit::Meter, Time::Unit::Second)
+    );
+    const double meanMotion = std::sqrt(gravitationalParameter_SI / std::pow(initialElements[0], 3));
+
+    EXPECT_NEAR(7000000.0, initialElements[0], 10.0);
+    EXPECT_TRUE(elements.head<5>().isApprox(initialElements.head<5>(), 1e-9));
+    EXPECT_NEAR(meanMotion * Duration::Days(3.0).inSeconds(), elements[5] - initialElements[5], 1e-6);
+
+    EXPECT_THROW(semiAnalytical.calculateMeanElementsAt(Instant::Undefined()), ostk::core::error::runtime::Undefined);
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_SemiAnalytical, CalculateStatesAt)
+{
+    {
+        const SemiAnalytical semiAnalytical = {this->state_, this->sphericalDynamics_, this->gravitationalParameter_};
+
+        EXPECT_LT(
+            (semiAnalytical.calculateStateAt(this->instant_).getPosition().getCoordinates() -
+             this->state_.getPosition().getCoordinates())
+                .norm(),
+            10.0
+        );
+    }
+
+    // Against numerical propagation with J2: mean and osculating states differ by the short periodic terms, within
+    // tens of kilometers, forward and backward of the epoch
+
+    {
+        const SemiAnalytical semiAnalytical = {this->state_, this->j2Dynamics_, this->gravitationalParameter_};
+        const Propagated propagated = {Propagator(this->numericalSolver_, this->j2Dynamics_), this->state_};
+
+        Array<Instant> instants = Array<Instant>::Empty();
+
+        for (Size i = 0; i < 9; ++i)
+        {
+            instants.add(this->instant_ + Duration::Hours(-24.0 + 6.0 * i));
+        }
+
+        const Array<State> states = semiAnalytical.calculateStatesAt(instants);
+        const Array<State> referenceStates = propagated.calculateStatesAt(instants);
+
+        ASSERT_EQ(instants.getSize(), states.getSize());
+
+        for (Size i = 0; i < states.getSize(); ++i)
+        {
+            EXPECT_EQ(instants[i], states[i].accessInstant());
+            EXPECT_LT(
+                (states[i].getPosition().getCoordinates() - referenceStates[i].getPosition().getCoordinates()).norm(),
+                30000.0
+            );
+        }
+
+        EXPECT_EQ(states[5], semiAnalytical.calculateStateAt(instants[5]));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_SemiAnalytical, CalculateRevolutionNumberAt)
+{
+    // Circular orbit of about 97 minutes, a quarter of revolution past the ascending node
+
+    const State state = {
+        this->instant_,
+        Position::Meters({0.0, 4949747.468305833, 4949747.468305833}, Frame::GCRF()),
+        Velocity::MetersPerSecond({-7546.049108166282, 0.0, 0.0}, Frame::GCRF()),
+    };
+
+    const SemiAnalytical semiAnalytical = {
+        state, this->sphericalDynamics_, this->gravitationalParameter_, Duration::Hours(6.0), 5
+    };
+
+    EXPECT_EQ(5, semiAnalytical.calculateRevolutionNumberAt(this->instant_));
+    EXPECT_EQ(5, semiAnalytical.calculateRevolutionNumberAt(this->instant_ + Duration::Minutes(60.0)));
+    EXPECT_EQ(6, semiAnalytical.calculateRevolutionNumberAt(this->instant_ + Duration::Minutes(85.0)));
+    EXPECT_EQ(4, semiAnalytical.calculateRevolutionNumberAt(this->instant_ - Duration::Minutes(30.0)));
+    EXPECT_EQ(20, semiAnalytical.calculateRevolutionNumberAt(this->instant_ + Duration::Days(1.0)));
+
+    EXPECT_THROW(
+        semiAnalytical.calculateRevolutionNumberAt(Instant::Undefined()), ostk::core::error::runtime::Undefined
+    );
+}
@@ -219,3 +219,48 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Tabulated, Calculat
         }
     }
 }
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Tabulated, CalculateStatesAt_UnsortedInstants)
+{
+    loadData();
+
+    const Tabulated tabulated(states_, 0, Interpolator::Type::Linear);
+
+    const Instant startInstant = states_.accessFirst().accessInstant();
+    const Duration span = states_.accessLast().accessInstant() - startInstant;
+
+    Array<Instant> instants = Array<Instant>::Empty();
+
+    for (Index i = 0; i <= 20; ++i)
+    {
+        instants.add(startInstant + span * (double((7 * i) % 21) / 20.0));
+    }
+
+    const Array<State> states = tabulated.calculateStatesAt(instants);
+
+    ASSERT_EQ(instants.getSize(), states.getSize());
+
+    for (Index i = 0; i < instants.getSize(); ++i)
+    {
+        EXPECT_EQ(instants[i], states[i].accessInstant());
+        const State expectedState = tabulated.calculateStateAt(instants[i]);
+
+        EXPECT_TRUE(states[i].getCoordinates().isApprox(expectedState.getCoordinates(), 1e-15));
+    }
+
+    {
+        EXPECT_TRUE(tabulated.calculateStateAt(startInstant).getCoordinates().isApprox(
+            states_.accessFirst().getCoordinates(), 1e-15
+        ));
+        EXPECT_TRUE(tabulated.calculateStateAt(states_.accessLast().accessInstant())
+                        .getCoordinates()
+                        .isApprox(states_.accessLast().getCoordinates(), 1e-15));
+    }
+
+    {
+        EXPECT_THROW(
+            tabulated.calculateStatesAt({startInstant, startInstant - Duration::Seconds(1.0)}),
+            ostk::core::error::RuntimeError
+        );
+    }
+}
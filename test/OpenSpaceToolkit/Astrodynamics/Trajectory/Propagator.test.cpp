@@ -1,12 +1,17 @@
 /// Apache License 2.0
 
 #include <numeric>
+#include <thread>
+#include <vector>
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Map.hpp>
+#include <OpenSpaceToolkit/Core/Container/Pair.hpp>
 #include <OpenSpaceToolkit/Core/Container/Table.hpp>
 #include <OpenSpaceToolkit/Core/FileSystem/Directory.hpp>
 #include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
 #include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
@@ -39,7 +44,9 @@
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/Tabulated.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/ThirdBodyGravity.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/Thruster.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/EventCondition.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/EventCondition/InstantCondition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/EventCondition/RealCondition.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Flight/Maneuver.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Flight/System/PropulsionSystem.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Flight/System/SatelliteSystem.hpp>
@@ -59,11 +66,14 @@
 #include <Global.test.hpp>
 
 using ostk::core::container::Array;
+using ostk::core::container::Map;
+using ostk::core::container::Pair;
 using ostk::core::container::Table;
 using ostk::core::container::Tuple;
 using ostk::core::filesystem::Directory;
 using ostk::core::filesystem::File;
 using ostk::core::filesystem::Path;
+using ostk::core::type::Index;
 using ostk::core::type::Integer;
 using ostk::core::type::Real;
 using ostk::core::type::Shared;
@@ -99,6 +109,8 @@ using ostk::physics::time::Scale;
 using ostk::physics::unit::Mass;
 
 using ostk::astrodynamics::Dynamics;
+using ostk::astrodynamics::EventCondition;
+using ostk::astrodynamics::ExecutionContext;
 using ostk::astrodynamics::dynamics::AtmosphericDrag;
 using ostk::astrodynamics::dynamics::CentralBodyGravity;
 using ostk::astrodynamics::dynamics::PositionDerivative;
@@ -106,6 +118,7 @@ using TabulatedDynamics = ostk::astrodynamics::dynamics::Tabulated;
 using ostk::astrodynamics::dynamics::ThirdBodyGravity;
 using ostk::astrodynamics::dynamics::Thruster;
 using ostk::astrodynamics::eventcondition::InstantCondition;
+using ostk::astrodynamics::eventcondition::RealCondition;
 using ostk::astrodynamics::flight::Maneuver;
 using ostk::astrodynamics::flight::system::PropulsionSystem;
 using ostk::astrodynamics::flight::system::SatelliteSystem;
@@ -120,6 +133,7 @@ using ostk::astrodynamics::trajectory::state::CoordinateSubset;
 using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianPosition;
 using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianVelocity;
 using ostk::astrodynamics::trajectory::state::NumericalSolver;
+using ostk::astrodynamics::trajectory::state::StateHistory;
 using ostk::astrodynamics::trajectory::StateBuilder;
 
 class OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagator : public ::testing::Test
@@ -445,6 +459,68 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagator, Getters
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagator, DynamicsTiming)
+{
+    const State state = {
+        Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC),
+        Position::Meters({7000000.0, 0.0, 0.0}, gcrfSPtr_),
+        Velocity::MetersPerSecond({0.0, 5335.865450622126, 5335.865450622126}, gcrfSPtr_),
+    };
+
+    {
+        EXPECT_FALSE(defaultPropagator_.isDynamicsTimingEnabled());
+        EXPECT_THROW(defaultPropagator_.getDynamicsTimings(), ostk::core::error::RuntimeError);
+    }
+
+    {
+        Propagator propagator = {defaultNumericalSolver_, defaultDynamics_};
+
+        propagator.enableDynamicsTiming();
+
+        EXPECT_TRUE(propagator.isDynamicsTimingEnabled());
+
+        propagator.calculateStateAt(state, state.accessInstant() + Duration::Minutes(10.0));
+
+        const Map<String, Dynamics::Timing> timings = propagator.getDynamicsTimings();
+
+        EXPECT_EQ(timings.size(), defaultDynamics_.getSize());
+
+        for (const Shared<Dynamics>& dynamicsSPtr : defaultDynamics_)
+        {
+            const Dynamics::Timing& timing = timings.at(dynamicsSPtr->getName());
+
+            EXPECT_GT(timing.callCount, 0);
+            EXPECT_TRUE(timing.duration.isPositive());
+        }
+
+        // Every dynamics is evaluated once per system evaluation
+
+        EXPECT_EQ(
+            timings.at(defaultDynamics_[0]->getName()).callCount, timings.at(defaultDynamics_[1]->getName()).callCount
+        );
+
+        // Copies share the timers
+
+        const Propagator propagatorCopy = propagator;
+
+        propagatorCopy.calculateStateAt(state, state.accessInstant() + Duration::Minutes(10.0));
+
+        EXPECT_EQ(
+            propagator.getDynamicsTimings().at(defaultDynamics_[0]->getName()).callCount,
+            2 * timings.at(defaultDynamics_[0]->getName()).callCount
+        );
+
+        propagator.resetDynamicsTiming();
+
+        EXPECT_EQ(propagator.getDynamicsTimings().at(defaultDynamics_[0]->getName()).callCount, 0);
+
+        propagator.disableDynamicsTiming();
+
+        EXPECT_FALSE(propagator.isDynamicsTimingEnabled());
+        EXPECT_THROW(propagator.getDynamicsTimings(), ostk::core::error::RuntimeError);
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagator, SetDynamics)
 {
     {
@@ -882,6 +958,105 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagator, Calcula
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagator, CalculateStateAndEventsAt)
+{
+    const State state = {
+        Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC),
+        Position::Meters({7000000.0, 0.0, 0.0}, gcrfSPtr_),
+        Velocity::MetersPerSecond({0.0, 5335.865450622126, 5335.865450622126}, gcrfSPtr_),
+    };
+    const Instant endInstant = state.accessInstant() + Duration::Hours(4.0);
+
+    const auto calculateZ = [](const State& aState) -> Real
+    {
+        return aState.getPosition().accessCoordinates()[2];
+    };
+
+    const Array<Shared<EventCondition>> eventConditions = {
+        std::make_shared<RealCondition>("Ascending node", RealCondition::Criterion::PositiveCrossing, calculateZ),
+        std::make_shared<RealCondition>("Descending node", RealCondition::Criterion::NegativeCrossing, calculateZ),
+    };
+
+    const Propagator propagator = {defaultRKD5_, defaultDynamics_};
+
+    // Nodes are all detected in a single pass, alternating between descending and ascending nodes
+
+    {
+        const NumericalSolver::EventsSolution eventsSolution =
+            propagator.calculateStateAndEventsAt(state, endInstant, eventConditions);
+
+        const Array<Index> expectedConditionIndices = {1, 0, 1, 0};
+
+        ASSERT_EQ(expectedConditionIndices.getSize(), eventsSolution.eventOccurrences.getSize());
+
+        for (Index i = 0; i < expectedConditionIndices.getSize(); ++i)
+        {
+            const NumericalSolver::EventOccurrence& eventOccurrence = eventsSolution.eventOccurrences[i];
+
+            EXPECT_EQ(expectedConditionIndices[i], eventOccurrence.conditionIndex);
+            EXPECT_TRUE(eventOccurrence.rootSolverHasConverged);
+            EXPECT_EQ(state.getFrame(), eventOccurrence.state.getFrame());
+            EXPECT_NEAR(0.0, calculateZ(eventOccurrence.state), 1e-3);
+
+            if (i > 0)
+            {
+                EXPECT_LT(
+                    eventsSolution.eventOccurrences[i - 1].state.accessInstant(), eventOccurrence.state.accessInstant()
+                );
+            }
+        }
+
+        const State endState = propagator.calculateStateAt(state, endInstant);
+
+        EXPECT_EQ(endInstant, eventsSolution.state.accessInstant());
+        EXPECT_TRUE(eventsSolution.state.getCoordinates().isApprox(endState.getCoordinates(), 1e-10));
+
+        // Occurrences match the corresponding single condition propagations
+
+        const NumericalSolver::ConditionSolution descendingNodeSolution =
+            propagator.calculateStateToCondition(state, endInstant, *eventConditions[1]);
+
+        EXPECT_NEAR(
+            0.0,
+            (eventsSolution.eventOccurrences[0].state.accessInstant() - descendingNodeSolution.state.accessInstant())
+                .inSeconds(),
+            1e-6
+        );
+
+        const NumericalSolver::ConditionSolution ascendingNodeSolution = propagator.calculateStateToCondition(
+            eventsSolution.eventOccurrences[0].state, endInstant, *eventConditions[0]
+        );
+
+        EXPECT_NEAR(
+            0.0,
+            (eventsSolution.eventOccurrences[1].state.accessInstant() - ascendingNodeSolution.state.accessInstant())
+                .inSeconds(),
+            1e-6
+        );
+    }
+
+    // Output states respect the input frame
+
+    {
+        const NumericalSolver::EventsSolution eventsSolution =
+            propagator.calculateStateAndEventsAt(state.inFrame(Frame::ITRF()), endInstant, eventConditions);
+
+        EXPECT_EQ(Frame::ITRF(), eventsSolution.state.getFrame());
+
+        for (const NumericalSolver::EventOccurrence& eventOccurrence : eventsSolution.eventOccurrences)
+        {
+            EXPECT_EQ(Frame::ITRF(), eventOccurrence.state.getFrame());
+        }
+    }
+
+    {
+        EXPECT_THROW(
+            Propagator::Undefined().calculateStateAndEventsAt(state, endInstant, eventConditions),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagator, CalculateStatesAt)
 {
     // Test exception for unsorted instant array
@@ -1207,6 +1382,701 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagator, Calcula
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagator, CalculateStatesAt_StateArray)
+{
+    const Instant startInstant = Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC);
+    const Instant endInstant = startInstant + Duration::Minutes(30.0);
+
+    Array<State> stateArray = Array<State>::Empty();
+
+    for (Size i = 0; i < 8; ++i)
+    {
+        const Real radius = 7000000.0 + 10000.0 * i;
+
+        stateArray.add({
+            startInstant,
+            Position::Meters({radius, 0.0, 0.0}, gcrfSPtr_),
+            Velocity::MetersPerSecond({0.0, 5335.865450622126, 5335.865450622126}, gcrfSPtr_),
+        });
+    }
+
+    {
+        for (const Size threadCount : Array<Size>({0, 1, 3}))
+        {
+            const Array<State> outputStates = defaultPropagator_.calculateStatesAt(stateArray, endInstant, threadCount);
+
+            ASSERT_EQ(stateArray.getSize(), outputStates.getSize());
+
+            for (Size i = 0; i < stateArray.getSize(); ++i)
+            {
+                const State referenceState = defaultPropagator_.calculateStateAt(stateArray[i], endInstant);
+
+                EXPECT_EQ(endInstant, outputStates[i].getInstant());
+                EXPECT_EQ(referenceState.getCoordinates(), outputStates[i].getCoordinates());
+            }
+        }
+    }
+
+    {
+        EXPECT_TRUE(defaultPropagator_.calculateStatesAt(Array<State>::Empty(), endInstant).isEmpty());
+    }
+
+    {
+        EXPECT_THROW(
+            defaultPropagator_.calculateStatesAt(stateArray, Instant::Undefined()),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            defaultPropagator_.calculateStatesAt({stateArray[0], State::Undefined()}, endInstant),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            Propagator::Undefined().calculateStatesAt(stateArray, endInstant), ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagator, CalculateStatesAt_StateArrayInstantArray)
+{
+    const Instant startInstant = Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC);
+
+    const Array<Instant> instants = {
+        startInstant - Duration::Minutes(10.0),
+        startInstant + Duration::Minutes(15.0),
+        startInstant + Duration::Minutes(30.0),
+    };
+
+    Array<State> stateArray = Array<State>::Empty();
+
+    for (Size i = 0; i < 5; ++i)
+    {
+        const Real radius = 7000000.0 + 10000.0 * i;
+
+        stateArray.add({
+            startInstant,
+            Position::Meters({radius, 0.0, 0.0}, gcrfSPtr_),
+            Velocity::MetersPerSecond({0.0, 5335.865450622126, 5335.865450622126}, gcrfSPtr_),
+        });
+    }
+
+    {
+        for (const Size threadCount : Array<Size>({0, 1, 2}))
+        {
+            const Array<Array<State>> outputStateArrays =
+                defaultPropagator_.calculateStatesAt(stateArray, instants, threadCount);
+
+            ASSERT_EQ(stateArray.getSize(), outputStateArrays.getSize());
+
+            for (Size i = 0; i < stateArray.getSize(); ++i)
+            {
+                EXPECT_EQ(defaultPropagator_.calculateStatesAt(stateArray[i], instants), outputStateArrays[i]);
+            }
+        }
+    }
+
+    {
+        EXPECT_TRUE(defaultPropagator_.calculateStatesAt(Array<State>::Empty(), instants).isEmpty());
+    }
+
+    {
+        EXPECT_THROW(
+            defaultPropagator_.calculateStatesAt({stateArray[0], State::Undefined()}, instants),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            defaultPropagator_.calculateStatesAt(stateArray, {instants[1], instants[0]}),
+            ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            Propagator::Undefined().calculateStatesAt(stateArray, instants), ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagator, CalculateStatesAt_Concurrent)
+{
+    const Instant startInstant = Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC);
+
+    Array<Instant> instants = Array<Instant>::Empty();
+
+    for (Size i = 1; i <= 10; ++i)
+    {
+        instants.add(startInstant + Duration::Minutes(3.0 * i));
+    }
+
+    Array<State> stateArray = Array<State>::Empty();
+
+    for (Size i = 0; i < 8; ++i)
+    {
+        const Real radius = 7000000.0 + 10000.0 * i;
+
+        stateArray.add({
+            startInstant,
+            Position::Meters({radius, 0.0, 0.0}, gcrfSPtr_),
+            Velocity::MetersPerSecond({0.0, 5335.865450622126, 5335.865450622126}, gcrfSPtr_),
+        });
+    }
+
+    Array<State> referenceStates = Array<State>::Empty();
+    Array<Array<State>> referenceStateArrays = Array<Array<State>>::Empty();
+
+    for (const State& state : stateArray)
+    {
+        referenceStates.add(defaultPropagator_.calculateStateAt(state, instants.accessLast()));
+        referenceStateArrays.add(defaultPropagator_.calculateStatesAt(state, instants));
+    }
+
+    // A single propagator is shared between threads, without copies
+
+    {
+        const Propagator& propagator = defaultPropagator_;
+
+        Array<State> states(stateArray.getSize(), State::Undefined());
+        Array<Array<State>> stateArrays(stateArray.getSize(), Array<State>::Empty());
+
+        std::vector<std::thread> threads;
+
+        for (Size i = 0; i < stateArray.getSize(); ++i)
+        {
+            threads.emplace_back(
+                [&, i]() -> void
+                {
+                    states[i] = propagator.calculateStateAt(stateArray[i], instants.accessLast());
+                    stateArrays[i] = propagator.calculateStatesAt(stateArray[i], instants);
+                }
+            );
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (Size i = 0; i < stateArray.getSize(); ++i)
+        {
+            EXPECT_EQ(referenceStates[i].getCoordinates(), states[i].getCoordinates());
+
+            ASSERT_EQ(referenceStateArrays[i].getSize(), stateArrays[i].getSize());
+
+            for (Size j = 0; j < instants.getSize(); ++j)
+            {
+                EXPECT_EQ(referenceStateArrays[i][j].getCoordinates(), stateArrays[i][j].getCoordinates());
+            }
+        }
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagator, CalculateStateHistoryAt)
+{
+    const Instant startInstant = Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC);
+
+    const State state = {
+        startInstant,
+        Position::Meters({7000000.0, 0.0, 0.0}, gcrfSPtr_),
+        Velocity::MetersPerSecond({0.0, 5335.865450622126, 5335.865450622126}, gcrfSPtr_),
+    };
+
+    const Array<Instant> instants = {
+        startInstant - Duration::Minutes(10.0),
+        startInstant + Duration::Minutes(5.0),
+        startInstant + Duration::Minutes(20.0),
+    };
+
+    {
+        const StateHistory stateHistory = defaultPropagator_.calculateStateHistoryAt(state, instants);
+        const Array<State> states = defaultPropagator_.calculateStatesAt(state, instants);
+
+        ASSERT_EQ(instants.getSize(), stateHistory.getSize());
+
+        EXPECT_EQ(state.accessFrame(), stateHistory.accessFrame());
+        EXPECT_EQ(states, stateHistory.getStates());
+    }
+
+    {
+        EXPECT_TRUE(defaultPropagator_.calculateStateHistoryAt(state, Array<Instant>::Empty()).isEmpty());
+    }
+
+    {
+        EXPECT_THROW(
+            defaultPropagator_.calculateStateHistoryAt(State::Undefined(), instants),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            defaultPropagator_.calculateStateHistoryAt(state, {instants[1], instants[0]}),
+            ostk::core::error::runtime::Wrong
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagator, CalculateStateAt_FixedSize)
+{
+    const Instant startInstant = Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC);
+    const Instant endInstant = startInstant + Duration::Hours(2.0);
+
+    const State state = {
+        startInstant,
+        Position::Meters({7000000.0, 0.0, 0.0}, gcrfSPtr_),
+        Velocity::MetersPerSecond({0.0, 5335.865450622126, 5335.865450622126}, gcrfSPtr_),
+    };
+
+    // Position and velocity states go through the fixed size path, which must match the dynamic size path
+
+    {
+        EXPECT_TRUE(defaultPropagator_.accessNumericalSolver().supportsFixedSizeIntegration());
+
+        const State fixedSizeState = defaultPropagator_.calculateStateAt(state, endInstant);
+        const State dynamicSizeState = defaultPropagator_.calculateStatesAt(state, {endInstant}).accessFirst();
+
+        EXPECT_EQ(endInstant, fixedSizeState.getInstant());
+        EXPECT_EQ(state.accessFrame(), fixedSizeState.accessFrame());
+        EXPECT_LT(
+            (fixedSizeState.getPosition().getCoordinates() - dynamicSizeState.getPosition().getCoordinates()).norm(),
+            1e-6
+        );
+        EXPECT_LT(
+            (fixedSizeState.getVelocity().getCoordinates() - dynamicSizeState.getVelocity().getCoordinates()).norm(),
+            1e-9
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagator, CalculateStatesAt_Parareal)
+{
+    const Instant startInstant = Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC);
+
+    const State state = {
+        startInstant,
+        Position::Meters({7000000.0, 0.0, 0.0}, gcrfSPtr_),
+        Velocity::MetersPerSecond({0.0, 5335.865450622126, 5335.865450622126}, gcrfSPtr_),
+    };
+
+    Array<Instant> instantArray = Array<Instant>::Empty();
+
+    for (Size i = 1; i <= 8; ++i)
+    {
+        instantArray.add(startInstant + Duration::Minutes(30.0 * i));
+    }
+
+    const Propagator coarsePropagator = {
+        NumericalSolver::FixedStepSize(NumericalSolver::StepperType::RungeKutta4, 120.0), defaultDynamics_
+    };
+
+    {
+        const Array<State> referenceStates = defaultPropagator_.calculateStatesAt(state, instantArray);
+
+        for (const Size threadCount : Array<Size>({0, 1, 3}))
+        {
+            const Array<State> outputStates =
+                defaultPropagator_.calculateStatesAt(state, instantArray, coarsePropagator, 1e-6, 10, threadCount);
+
+            ASSERT_EQ(instantArray.getSize(), outputStates.getSize());
+
+            for (Size i = 0; i < instantArray.getSize(); ++i)
+            {
+                EXPECT_EQ(instantArray[i], outputStates[i].getInstant());
+                EXPECT_EQ(state.accessFrame(), outputStates[i].accessFrame());
+                EXPECT_LT(
+                    (referenceStates[i].getPosition().getCoordinates() - outputStates[i].getPosition().getCoordinates())
+                        .norm(),
+                    1e-3
+                );
+            }
+        }
+    }
+
+    // As many iterations as windows reproduce the window by window sequential propagation
+
+    {
+        const Array<State> outputStates =
+            defaultPropagator_.calculateStatesAt(state, instantArray, coarsePropagator, 1e-12, instantArray.getSize());
+
+        State referenceState = state;
+
+        for (Size i = 0; i < instantArray.getSize(); ++i)
+        {
+            referenceState = defaultPropagator_.calculateStateAt(referenceState, instantArray[i]);
+
+            EXPECT_TRUE(referenceState.getCoordinates().isApprox(outputStates[i].getCoordinates(), 1e-12));
+        }
+    }
+
+    // Boundary states do not depend on the thread count of the execution context
+
+    {
+        const Array<State> referenceStates =
+            defaultPropagator_.calculateStatesAt(state, instantArray, coarsePropagator, 1e-6, 10, 1);
+
+        const Array<State> outputStates =
+            defaultPropagator_.calculateStatesAt(state, instantArray, coarsePropagator, 1e-6, 10, ExecutionContext(3));
+
+        ASSERT_EQ(referenceStates.getSize(), outputStates.getSize());
+
+        for (Size i = 0; i < referenceStates.getSize(); ++i)
+        {
+            EXPECT_EQ(referenceStates[i].getCoordinates(), outputStates[i].getCoordinates());
+        }
+    }
+
+    {
+        EXPECT_TRUE(defaultPropagator_.calculateStatesAt(state, Array<Instant>::Empty(), coarsePropagator).isEmpty());
+    }
+
+    {
+        EXPECT_THROW(
+            defaultPropagator_.calculateStatesAt(state, {instantArray[1], instantArray[0]}, coarsePropagator),
+            ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            defaultPropagator_.calculateStatesAt(state, {startInstant}, coarsePropagator),
+            ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            defaultPropagator_.calculateStatesAt(state, instantArray, coarsePropagator, 0.0),
+            ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            defaultPropagator_.calculateStatesAt(state, instantArray, Propagator::Undefined()),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            defaultPropagator_.calculateStatesAt(State::Undefined(), instantArray, coarsePropagator),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagator, CalculateEnsembleStatesAt)
+{
+    const Instant startInstant = Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC);
+
+    Array<State> stateArray = Array<State>::Empty();
+
+    for (Size i = 0; i < 8; ++i)
+    {
+        stateArray.add({
+            startInstant,
+            Position::Meters({7000000.0 + 100.0 * i, 0.0, 0.0}, gcrfSPtr_),
+            Velocity::MetersPerSecond({0.0, 5335.865450622126, 5335.865450622126 + 0.1 * i}, gcrfSPtr_),
+        });
+    }
+
+    {
+        const Array<Instant> endInstants = {
+            startInstant + Duration::Minutes(30.0),
+            startInstant - Duration::Minutes(30.0),
+        };
+
+        for (const Instant& endInstant : endInstants)
+        {
+            const Array<State> outputStates = defaultPropagator_.calculateEnsembleStatesAt(stateArray, endInstant);
+
+            ASSERT_EQ(stateArray.getSize(), outputStates.getSize());
+
+            for (Size i = 0; i < stateArray.getSize(); ++i)
+            {
+                const State referenceState = defaultPropagator_.calculateStateAt(stateArray[i], endInstant);
+
+                EXPECT_EQ(endInstant, outputStates[i].getInstant());
+                EXPECT_EQ(stateArray[i].getFrame(), outputStates[i].getFrame());
+                EXPECT_GT(
+                    1e-3,
+                    (referenceState.getPosition().getCoordinates() - outputStates[i].getPosition().getCoordinates())
+                        .norm()
+                );
+            }
+        }
+    }
+
+    {
+        EXPECT_TRUE(defaultPropagator_.calculateEnsembleStatesAt(Array<State>::Empty(), startInstant).isEmpty());
+    }
+
+    {
+        const State shiftedState = {
+            startInstant + Duration::Seconds(1.0),
+            Position::Meters({7000000.0, 0.0, 0.0}, gcrfSPtr_),
+            Velocity::MetersPerSecond({0.0, 5335.865450622126, 5335.865450622126}, gcrfSPtr_),
+        };
+
+        EXPECT_THROW(
+            defaultPropagator_.calculateEnsembleStatesAt(
+                {stateArray[0], shiftedState}, startInstant + Duration::Minutes(30.0)
+            ),
+            ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            Propagator::Undefined().calculateEnsembleStatesAt(stateArray, startInstant),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagator, CalculateStateAndStateTransitionMatrixAt)
+{
+    const Instant startInstant = Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC);
+    const Instant endInstant = startInstant + Duration::Minutes(30.0);
+
+    const State state = {
+        startInstant,
+        Position::Meters({7000000.0, 0.0, 0.0}, gcrfSPtr_),
+        Velocity::MetersPerSecond({0.0, 5335.865450622126, 5335.865450622126}, gcrfSPtr_),
+    };
+
+    {
+        const Pair<State, MatrixXd> stateAndStateTransitionMatrix =
+            defaultPropagator_.calculateStateAndStateTransitionMatrixAt(state, endInstant);
+
+        const State& outputState = stateAndStateTransitionMatrix.first;
+        const MatrixXd& stateTransitionMatrix = stateAndStateTransitionMatrix.second;
+
+        const State referenceState = defaultPropagator_.calculateStateAt(state, endInstant);
+
+        EXPECT_EQ(endInstant, outputState.getInstant());
+        EXPECT_GT(
+            1e-3, (referenceState.getPosition().getCoordinates() - outputState.getPosition().getCoordinates()).norm()
+        );
+
+        ASSERT_EQ(6, stateTransitionMatrix.rows());
+        ASSERT_EQ(6, stateTransitionMatrix.cols());
+
+        // Compare against central differences of the propagated state
+
+        const VectorXd perturbations = (VectorXd(6) << 1.0, 1.0, 1.0, 1.0e-3, 1.0e-3, 1.0e-3).finished();
+
+        for (Index i = 0; i < 6; ++i)
+        {
+            VectorXd forwardCoordinates = state.getCoordinates();
+            VectorXd backwardCoordinates = state.getCoordinates();
+            forwardCoordinates(i) += perturbations(i);
+            backwardCoordinates(i) -= perturbations(i);
+
+            const State forwardState = defaultPropagator_.calculateStateAt(
+                {startInstant, forwardCoordinates, gcrfSPtr_, state.accessCoordinateBroker()}, endInstant
+            );
+            const State backwardState = defaultPropagator_.calculateStateAt(
+                {startInstant, backwardCoordinates, gcrfSPtr_, state.accessCoordinateBroker()}, endInstant
+            );
+
+            const VectorXd column =
+                (forwardState.getCoordinates() - backwardState.getCoordinates()) / (2.0 * perturbations(i));
+
+            EXPECT_GT(1e-4 * column.norm(), (column - stateTransitionMatrix.col(i)).norm());
+        }
+    }
+
+    {
+        EXPECT_THROW(
+            Propagator::Undefined().calculateStateAndStateTransitionMatrixAt(state, endInstant),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagator, CalculateStatesAndStateTransitionMatricesAt)
+{
+    const Instant startInstant = Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC);
+
+    const State state = {
+        startInstant,
+        Position::Meters({7000000.0, 0.0, 0.0}, gcrfSPtr_),
+        Velocity::MetersPerSecond({0.0, 5335.865450622126, 5335.865450622126}, gcrfSPtr_),
+    };
+
+    {
+        const Array<Instant> instants = {
+            startInstant - Duration::Minutes(10.0),
+            startInstant,
+            startInstant + Duration::Minutes(15.0),
+            startInstant + Duration::Minutes(30.0),
+        };
+
+        const Array<Pair<State, MatrixXd>> statesAndStateTransitionMatrices =
+            defaultPropagator_.calculateStatesAndStateTransitionMatricesAt(state, instants);
+
+        ASSERT_EQ(instants.getSize(), statesAndStateTransitionMatrices.getSize());
+
+        for (Index i = 0; i < instants.getSize(); ++i)
+        {
+            const State& outputState = statesAndStateTransitionMatrices[i].first;
+            const MatrixXd& stateTransitionMatrix = statesAndStateTransitionMatrices[i].second;
+
+            EXPECT_EQ(instants[i], outputState.getInstant());
+
+            ASSERT_EQ(6, stateTransitionMatrix.rows());
+            ASSERT_EQ(6, stateTransitionMatrix.cols());
+
+            const Pair<State, MatrixXd> referenceStateAndStateTransitionMatrix =
+                defaultPropagator_.calculateStateAndStateTransitionMatrixAt(state, instants[i]);
+
+            EXPECT_GT(
+                1e-3,
+                (referenceStateAndStateTransitionMatrix.first.getPosition().getCoordinates() -
+                 outputState.getPosition().getCoordinates())
+                    .norm()
+            );
+            EXPECT_GT(
+                1e-4 * referenceStateAndStateTransitionMatrix.second.norm(),
+                (referenceStateAndStateTransitionMatrix.second - stateTransitionMatrix).norm()
+            );
+        }
+
+        EXPECT_TRUE(statesAndStateTransitionMatrices[1].second.isApprox(MatrixXd::Identity(6, 6)));
+    }
+
+    {
+        EXPECT_TRUE(
+            defaultPropagator_.calculateStatesAndStateTransitionMatricesAt(state, Array<Instant>::Empty()).isEmpty()
+        );
+    }
+
+    {
+        EXPECT_THROW(
+            defaultPropagator_.calculateStatesAndStateTransitionMatricesAt(
+                state, {startInstant + Duration::Minutes(30.0), startInstant}
+            ),
+            ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            Propagator::Undefined().calculateStatesAndStateTransitionMatricesAt(
+                state, {startInstant + Duration::Minutes(30.0)}
+            ),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagator, CalculateStatesAndCovariancesAt)
+{
+    const Instant startInstant = Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC);
+
+    const State state = {
+        startInstant,
+        Position::Meters({7000000.0, 0.0, 0.0}, gcrfSPtr_),
+        Velocity::MetersPerSecond({0.0, 5335.865450622126, 5335.865450622126}, gcrfSPtr_),
+    };
+
+    const VectorXd standardDeviations = (VectorXd(6) << 100.0, 200.0, 50.0, 0.1, 0.2, 0.05).finished();
+    const MatrixXd covariance = standardDeviations.cwiseAbs2().asDiagonal();
+
+    {
+        const Array<Instant> instants = {
+            startInstant - Duration::Minutes(10.0),
+            startInstant,
+            startInstant + Duration::Minutes(15.0),
+            startInstant + Duration::Minutes(30.0),
+        };
+
+        const Array<Pair<State, MatrixXd>> statesAndCovariances =
+            defaultPropagator_.calculateStatesAndCovariancesAt(state, covariance, instants);
+
+        ASSERT_EQ(instants.getSize(), statesAndCovariances.getSize());
+
+        for (Index i = 0; i < instants.getSize(); ++i)
+        {
+            const State& outputState = statesAndCovariances[i].first;
+            const MatrixXd& outputCovariance = statesAndCovariances[i].second;
+
+            EXPECT_EQ(instants[i], outputState.getInstant());
+
+            ASSERT_EQ(6, outputCovariance.rows());
+            ASSERT_EQ(6, outputCovariance.cols());
+
+            const Pair<State, MatrixXd> referenceStateAndStateTransitionMatrix =
+                defaultPropagator_.calculateStateAndStateTransitionMatrixAt(state, instants[i]);
+
+            const MatrixXd& stateTransitionMatrix = referenceStateAndStateTransitionMatrix.second;
+            const MatrixXd referenceCovariance = stateTransitionMatrix * covariance * stateTransitionMatrix.transpose();
+
+            EXPECT_GT(
+                1e-3,
+                (referenceStateAndStateTransitionMatrix.first.getPosition().getCoordinates() -
+                 outputState.getPosition().getCoordinates())
+                    .norm()
+            );
+            EXPECT_GT(1e-4 * referenceCovariance.norm(), (referenceCovariance - outputCovariance).norm());
+            EXPECT_TRUE(outputCovariance.isApprox(outputCovariance.transpose()));
+        }
+
+        EXPECT_TRUE(statesAndCovariances[1].second.isApprox(covariance));
+    }
+
+    {
+        EXPECT_TRUE(
+            defaultPropagator_.calculateStatesAndCovariancesAt(state, covariance, Array<Instant>::Empty()).isEmpty()
+        );
+    }
+
+    {
+        const Array<Instant> instants = {startInstant + Duration::Minutes(30.0)};
+
+        EXPECT_THROW(
+            defaultPropagator_.calculateStatesAndCovariancesAt(state, MatrixXd::Identity(3, 3), instants),
+            ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            defaultPropagator_.calculateStatesAndCovariancesAt(
+                state, covariance, {startInstant + Duration::Minutes(30.0), startInstant}
+            ),
+            ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            Propagator::Undefined().calculateStatesAndCovariancesAt(state, covariance, instants),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagator, Session)
+{
+    const State state = {
+        Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC),
+        Position::Meters({7000000.0, 0.0, 0.0}, gcrfSPtr_),
+        Velocity::MetersPerSecond({0.0, 5335.865450622126, 5335.865450622126}, gcrfSPtr_),
+    };
+
+    {
+        const Array<Propagator> propagators = {
+            defaultPropagator_,
+            {defaultRKD5_, defaultDynamics_},
+        };
+
+        for (const Propagator& propagator : propagators)
+        {
+            Propagator::Session session = {propagator, state};
+
+            EXPECT_EQ(state, session.accessState());
+
+            for (Size i = 1; i <= 30; ++i)
+            {
+                const Instant instant = state.getInstant() + Duration::Seconds(60.0 * i);
+
+                const State sessionState =
+                    (i % 2 == 0) ? session.advanceTo(instant) : session.advanceBy(Duration::Seconds(60.0));
+
+                const State referenceState = propagator.calculateStateAt(state, instant);
+
+                EXPECT_EQ(instant, sessionState.getInstant());
+                EXPECT_EQ(sessionState, session.accessState());
+                EXPECT_GT(
+                    1e-3,
+                    (referenceState.getPosition().getCoordinates() - sessionState.getPosition().getCoordinates())
+                        .norm()
+                );
+            }
+
+            EXPECT_ANY_THROW(session.advanceTo(state.getInstant()));
+            EXPECT_ANY_THROW(session.advanceBy(Duration::Seconds(-1.0)));
+        }
+    }
+
+    {
+        EXPECT_THROW(Propagator::Session(Propagator::Undefined(), state), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(
+            Propagator::Session(defaultPropagator_, State::Undefined()), ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Orbit_Model_Propagator, Default)
 {
     {
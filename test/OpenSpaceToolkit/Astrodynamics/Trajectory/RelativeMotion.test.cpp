@@ -0,0 +1,302 @@
+/// Apache License 2.0
+
+#include <cmath>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Velocity.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Derived.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Time.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/CentralBodyGravity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Dynamics/PositionDerivative.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/RelativeMotion.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/NumericalSolver.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::Vector3d;
+using ostk::mathematics::object::VectorXd;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Velocity;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::environment::object::celestial::Earth;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+using ostk::physics::unit::Derived;
+using ostk::physics::unit::Length;
+using ostk::physics::unit::Time;
+using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
+
+using ostk::astrodynamics::dynamics::CentralBodyGravity;
+using ostk::astrodynamics::dynamics::PositionDerivative;
+using ostk::astrodynamics::trajectory::Propagator;
+using ostk::astrodynamics::trajectory::RelativeMotion;
+using ostk::astrodynamics::trajectory::State;
+using ostk::astrodynamics::trajectory::state::NumericalSolver;
+
+class OpenSpaceToolkit_Astrodynamics_Trajectory_RelativeMotion : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        this->propagator_ = {
+            this->numericalSolver_,
+            {
+                std::make_shared<PositionDerivative>(),
+                std::make_shared<CentralBodyGravity>(std::make_shared<Celestial>(Earth::Spherical())),
+            },
+        };
+
+        this->relativeState_ = VectorXd(6);
+        this->relativeState_ << 100.0, -200.0, 50.0, 0.1, -0.05, 0.02;
+    }
+
+    // Target at the perigee of an orbit of 7500 km semi-major axis, of a given eccentricity
+
+    State targetStateWithEccentricity(const double& anEccentricity) const
+    {
+        const double mu = this->gravitationalParameter_.in(
+            Derived::Unit::GravitationalParameter(Length::Unit::Meter, Time::Unit::Second)
+        );
+
+        const double perigeeRadius = 7500000.0 * (1.0 - anEccentricity);
+        const double perigeeVelocity = std::sqrt(mu * (1.0 + anEccentricity) / perigeeRadius);
+
+        return {
+            this->instant_,
+            Position::Meters({perigeeRadius, 0.0, 0.0}, Frame::GCRF()),
+            Velocity::MetersPerSecond(
+                {0.0, perigeeVelocity * std::cos(0.7), perigeeVelocity * std::sin(0.7)}, Frame::GCRF()
+            ),
+        };
+    }
+
+    const Instant instant_ = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+    const Derived gravitationalParameter_ = EarthGravitationalModel::EGM2008.gravitationalParameter_;
+    const NumericalSolver numericalSolver_ = {
+        NumericalSolver::LogType::NoLog, NumericalSolver::StepperType::RungeKuttaFehlberg78, 5.0, 1.0e-12, 1.0e-12
+    };
+
+    Propagator propagator_ = Propagator::Undefined();
+    VectorXd relativeState_;
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_RelativeMotion, Constructor)
+{
+    {
+        const RelativeMotion relativeMotion = {this->targetStateWithEccentricity(0.1), this->gravitationalParameter_};
+
+        EXPECT_TRUE(relativeMotion.isDefined());
+        EXPECT_EQ(RelativeMotion::Type::YamanakaAnkersen, relativeMotion.getType());
+        EXPECT_NEAR(0.1, relativeMotion.getEccentricity(), 1e-12);
+        EXPECT_EQ(this->gravitationalParameter_, relativeMotion.getGravitationalParameter());
+        EXPECT_EQ(this->instant_, relativeMotion.accessTargetState().accessInstant());
+    }
+
+    {
+        EXPECT_THROW(
+            RelativeMotion(State::Undefined(), this->gravitationalParameter_), ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            RelativeMotion(this->targetStateWithEccentricity(0.1), Derived::Undefined()),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            RelativeMotion(
+                this->targetStateWithEccentricity(0.1), this->gravitationalParameter_, RelativeMotion::Type::Undefined
+            ),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            RelativeMotion(this->targetStateWithEccentricity(1.5), this->gravitationalParameter_),
+            ostk::core::error::runtime::Wrong
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_RelativeMotion, EqualToOperator)
+{
+    const RelativeMotion relativeMotion = {this->targetStateWithEccentricity(0.1), this->gravitationalParameter_};
+
+    EXPECT_TRUE(relativeMotion == relativeMotion);
+    EXPECT_FALSE(
+        relativeMotion == RelativeMotion(
+                              this->targetStateWithEccentricity(0.1),
+                              this->gravitationalParameter_,
+                              RelativeMotion::Type::ClohessyWiltshire
+                          )
+    );
+    EXPECT_FALSE(RelativeMotion::Undefined() == RelativeMotion::Undefined());
+    EXPECT_TRUE(relativeMotion != RelativeMotion::Undefined());
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_RelativeMotion, Print)
+{
+    const RelativeMotion relativeMotion = {this->targetStateWithEccentricity(0.1), this->gravitationalParameter_};
+
+    testing::internal::CaptureStdout();
+
+    EXPECT_NO_THROW(relativeMotion.print(std::cout, true));
+    EXPECT_NO_THROW(std::cout << relativeMotion << std::endl);
+    EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_RelativeMotion, ComputeRelativeState)
+{
+    const State targetState = this->targetStateWithEccentricity(0.1);
+
+    const State chaserState = RelativeMotion::ComputeChaserState(targetState, this->relativeState_);
+
+    EXPECT_EQ(targetState.accessInstant(), chaserState.accessInstant());
+    EXPECT_TRUE(RelativeMotion::ComputeRelativeState(targetState, chaserState).isApprox(this->relativeState_, 1e-9));
+
+    {
+        EXPECT_THROW(
+            RelativeMotion::ComputeRelativeState(targetState, State::Undefined()), ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            RelativeMotion::ComputeRelativeState(
+                targetState, this->propagator_.calculateStateAt(chaserState, this->instant_ + Duration::Minutes(1.0))
+            ),
+            ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            RelativeMotion::ComputeChaserState(targetState, VectorXd::Zero(3)), ostk::core::error::runtime::Wrong
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_RelativeMotion, CalculateStateTransitionMatrix)
+{
+    const RelativeMotion relativeMotion = {this->targetStateWithEccentricity(0.3), this->gravitationalParameter_};
+
+    const Instant startInstant = this->instant_ + Duration::Minutes(10.0);
+    const Instant intermediateInstant = this->instant_ + Duration::Minutes(45.0);
+    const Instant endInstant = this->instant_ + Duration::Minutes(200.0);
+
+    {
+        EXPECT_TRUE(relativeMotion.calculateStateTransitionMatrix(startInstant, startInstant)
+                        .isApprox(MatrixXd::Identity(6, 6), 1e-12));
+    }
+
+    // Transitions compose, and are inverted by swapping the instants
+
+    {
+        const MatrixXd stateTransitionMatrix = relativeMotion.calculateStateTransitionMatrix(startInstant, endInstant);
+
+        EXPECT_TRUE((relativeMotion.calculateStateTransitionMatrix(intermediateInstant, endInstant) *
+                     relativeMotion.calculateStateTransitionMatrix(startInstant, intermediateInstant))
+                        .isApprox(stateTransitionMatrix, 1e-9));
+        EXPECT_TRUE((relativeMotion.calculateStateTransitionMatrix(endInstant, startInstant) * stateTransitionMatrix)
+                        .isApprox(MatrixXd::Identity(6, 6), 1e-9));
+    }
+
+    // Yamanaka-Ankersen reduces to Clohessy-Wiltshire for circular orbits
+
+    {
+        const State targetState = this->targetStateWithEccentricity(0.0);
+
+        const MatrixXd yamanakaAnkersenMatrix =
+            RelativeMotion(targetState, this->gravitationalParameter_, RelativeMotion::Type::YamanakaAnkersen)
+                .calculateStateTransitionMatrix(startInstant, endInstant);
+        const MatrixXd clohessyWiltshireMatrix =
+            RelativeMotion(targetState, this->gravitationalParameter_, RelativeMotion::Type::ClohessyWiltshire)
+                .calculateStateTransitionMatrix(startInstant, endInstant);
+
+        EXPECT_LT(
+            (yamanakaAnkersenMatrix * this->relativeState_ - clohessyWiltshireMatrix * this->relativeState_).norm(),
+            1e-3
+        );
+    }
+
+    {
+        EXPECT_THROW(
+            relativeMotion.calculateStateTransitionMatrix(Instant::Undefined(), endInstant),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            RelativeMotion::Undefined().calculateStateTransitionMatrix(startInstant, endInstant),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_RelativeMotion, CalculateRelativeStatesAt)
+{
+    // Against the difference of numerically propagated target and chaser states: the linearization error is about a
+    // meter for a separation of a few hundred meters, over a revolution
+
+    for (const double eccentricity : {0.0, 0.1, 0.5})
+    {
+        const State targetState = this->targetStateWithEccentricity(eccentricity);
+        const State chaserState = RelativeMotion::ComputeChaserState(targetState, this->relativeState_);
+
+        Array<Instant> instants = Array<Instant>::Empty();
+
+        for (Size i = 1; i <= 10; ++i)
+        {
+            instants.add(this->instant_ + Duration::Seconds(500.0 * i));
+        }
+
+        const Array<State> targetStates = this->propagator_.calculateStatesAt(targetState, instants);
+        const Array<State> chaserStates = this->propagator_.calculateStatesAt(chaserState, instants);
+
+        const RelativeMotion yamanakaAnkersen = {targetState, this->gravitationalParameter_};
+        const RelativeMotion clohessyWiltshire = {
+            targetState, this->gravitationalParameter_, RelativeMotion::Type::ClohessyWiltshire
+        };
+
+        const MatrixXd relativeStates =
+            yamanakaAnkersen.calculateRelativeStatesAt(this->relativeState_, this->instant_, instants);
+
+        ASSERT_EQ(10, relativeStates.rows());
+        ASSERT_EQ(6, relativeStates.cols());
+
+        for (Size i = 0; i < instants.getSize(); ++i)
+        {
+            const VectorXd referenceRelativeState =
+                RelativeMotion::ComputeRelativeState(targetStates[i], chaserStates[i]);
+
+            EXPECT_LT((VectorXd(relativeStates.row(i).transpose()) - referenceRelativeState).head<3>().norm(), 5.0);
+            EXPECT_TRUE(relativeStates.row(i).transpose().isApprox(
+                yamanakaAnkersen.calculateRelativeStateAt(this->relativeState_, this->instant_, instants[i]), 1e-12
+            ));
+
+            if (eccentricity == 0.0)
+            {
+                EXPECT_LT(
+                    (clohessyWiltshire.calculateRelativeStateAt(this->relativeState_, this->instant_, instants[i]) -
+                     referenceRelativeState)
+                        .head<3>()
+                        .norm(),
+                    5.0
+                );
+            }
+        }
+    }
+}
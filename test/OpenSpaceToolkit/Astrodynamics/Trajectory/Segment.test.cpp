@@ -2,6 +2,8 @@
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Map.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
 #include <OpenSpaceToolkit/Core/Type/Size.hpp>
@@ -42,7 +44,9 @@
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/LocalOrbitalFrameDirection.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/LocalOrbitalFrameFactory.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Orbit/Model/Kepler/COE.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Propagator.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Segment.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Sequence.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateBroker.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset.hpp>
@@ -54,12 +58,15 @@
 
 using ostk::core::container::Array;
 using ostk::core::container::Map;
+using ostk::core::filesystem::File;
+using ostk::core::filesystem::Path;
 using ostk::core::type::Real;
 using ostk::core::type::Shared;
 using ostk::core::type::Size;
 using ostk::core::type::String;
 
 using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::Vector3d;
 using ostk::mathematics::object::VectorXd;
 
 using ostk::physics::coordinate::Frame;
@@ -94,7 +101,9 @@ using ostk::astrodynamics::guidancelaw::QLaw;
 using ostk::astrodynamics::trajectory::LocalOrbitalFrameDirection;
 using ostk::astrodynamics::trajectory::LocalOrbitalFrameFactory;
 using ostk::astrodynamics::trajectory::orbit::model::kepler::COE;
+using ostk::astrodynamics::trajectory::Propagator;
 using ostk::astrodynamics::trajectory::Segment;
+using ostk::astrodynamics::trajectory::Sequence;
 using ostk::astrodynamics::trajectory::State;
 using ostk::astrodynamics::trajectory::state::CoordinateBroker;
 using ostk::astrodynamics::trajectory::state::CoordinateSubset;
@@ -504,6 +513,24 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Segment, SegmentSolution_Extrac
                     maneuvers[1].getInstants()[j]
                 );
             }
+
+            // Streamed maneuvers are emitted in chronological order, and match the extracted ones
+            Size maneuverIndex = 0;
+            maneuveringSegmentSolution.extractManeuvers(
+                defaultFrameSPtr_,
+                [&maneuvers, &maneuverIndex](const Maneuver& aManeuver) -> void
+                {
+                    ASSERT_LT(maneuverIndex, maneuvers.getSize());
+                    EXPECT_EQ(maneuvers[maneuverIndex].getInstants(), aManeuver.getInstants());
+                    EXPECT_EQ(
+                        maneuvers[maneuverIndex].getMassFlowRateProfile(), aManeuver.getMassFlowRateProfile()
+                    );
+
+                    ++maneuverIndex;
+                }
+            );
+
+            EXPECT_EQ(maneuvers.getSize(), maneuverIndex);
         }
 
         // Check that when no thrusting is performed in a maneuvering segment that no maneuvers are outputted
@@ -604,6 +631,40 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Segment, SegmentSolution_Calcul
         }
         EXPECT_EQ(defaultState_, propagatedStates[0]);
     }
+
+    // Test that repeated queries reuse the propagated model, which follows changes of the solution states
+    {
+        const Array<Instant> instantArray = {
+            defaultState_.getInstant() + Duration::Seconds(30.0), defaultState_.getInstant() + Duration::Seconds(90.0)
+        };
+
+        const State state1 = {
+            defaultState_.getInstant() + Duration::Minutes(2.0),
+            defaultState_.getPosition(),
+            defaultState_.getVelocity(),
+        };
+
+        Segment::Solution segmentSolution =
+            Segment::Solution(defaultName_, defaultDynamics_, {defaultState_, state1}, true, Segment::Type::Coast);
+
+        const Array<State> firstPropagatedStates =
+            segmentSolution.calculateStatesAt(instantArray, defaultNumericalSolver_);
+        const Array<State> secondPropagatedStates =
+            segmentSolution.calculateStatesAt(instantArray, defaultNumericalSolver_);
+
+        EXPECT_EQ(firstPropagatedStates, secondPropagatedStates);
+
+        const State propagatedState1 = Propagator(defaultNumericalSolver_, defaultDynamics_)
+                                           .calculateStateAt(defaultState_, state1.getInstant());
+
+        segmentSolution.states = {defaultState_, propagatedState1};
+
+        const Array<State> updatedPropagatedStates =
+            segmentSolution.calculateStatesAt(instantArray, defaultNumericalSolver_);
+
+        ASSERT_EQ(instantArray.getSize(), updatedPropagatedStates.getSize());
+        EXPECT_NE(firstPropagatedStates[1], updatedPropagatedStates[1]);
+    }
 }
 
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Segment, SegmentSolution_GetDynamicsContribution)
@@ -836,6 +897,47 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Segment, SegmentSolution_Stream
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Segment, SegmentSolution_Snapshot)
+{
+    File file = File::Path(Path::Parse("/tmp/OpenSpaceToolkit_Astrodynamics_Trajectory_Segment_Solution.sols"));
+
+    {
+        const Segment::Solution segmentSolution = Segment::Solution(
+            defaultName_,
+            defaultDynamics_,
+            {initialStateWithMass_, intermediateStateWithMass_, finalStateWithMass_},
+            false,
+            Segment::Type::Maneuver
+        );
+
+        segmentSolution.saveSnapshot(file);
+
+        const Segment::Solution loadedSegmentSolution = Segment::Solution::LoadSnapshot(file, defaultDynamics_);
+
+        EXPECT_EQ(segmentSolution.name, loadedSegmentSolution.name);
+        EXPECT_EQ(segmentSolution.conditionIsSatisfied, loadedSegmentSolution.conditionIsSatisfied);
+        EXPECT_EQ(segmentSolution.segmentType, loadedSegmentSolution.segmentType);
+        EXPECT_EQ(segmentSolution.dynamics, loadedSegmentSolution.dynamics);
+        EXPECT_EQ(segmentSolution.states, loadedSegmentSolution.states);
+        EXPECT_EQ(segmentSolution.getFinalMass(), loadedSegmentSolution.getFinalMass());
+
+        file.remove();
+    }
+
+    {
+        // Sequence solution snapshots with several segments are rejected
+
+        const Segment::Solution segmentSolution =
+            Segment::Solution(defaultName_, defaultDynamics_, {defaultState_}, true, Segment::Type::Coast);
+
+        Sequence::Solution({segmentSolution, segmentSolution}, true).saveSnapshot(file);
+
+        EXPECT_THROW(Segment::Solution::LoadSnapshot(file), ostk::core::error::RuntimeError);
+
+        file.remove();
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Segment, Coast)
 {
     {
@@ -879,6 +981,55 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Segment, Maneuver)
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Segment, ImpulsiveManeuver)
+{
+    const Shared<const LocalOrbitalFrameFactory> vncFactorySPtr = LocalOrbitalFrameFactory::VNC(defaultFrameSPtr_);
+
+    {
+        const Segment segment = Segment::ImpulsiveManeuver(
+            defaultName_, {1.0, 0.0, 0.0}, vncFactorySPtr, 300.0, defaultDynamics_, defaultNumericalSolver_
+        );
+
+        EXPECT_EQ(Segment::Type::ImpulsiveManeuver, segment.getType());
+        EXPECT_EQ(Vector3d(1.0, 0.0, 0.0), segment.getDeltaV());
+        EXPECT_EQ(vncFactorySPtr, segment.getLocalOrbitalFrameFactory());
+        EXPECT_EQ(300.0, segment.getSpecificImpulse());
+        EXPECT_NE(nullptr, segment.accessEventCondition());
+    }
+
+    {
+        EXPECT_THROW(
+            Segment::ImpulsiveManeuver(
+                defaultName_, {1.0, 0.0, 0.0}, nullptr, 300.0, defaultDynamics_, defaultNumericalSolver_
+            ),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+
+    {
+        EXPECT_THROW(
+            Segment::ImpulsiveManeuver(
+                defaultName_,
+                {1.0, 0.0, 0.0},
+                vncFactorySPtr,
+                Real::Undefined(),
+                defaultDynamics_,
+                defaultNumericalSolver_
+            ),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+
+    {
+        EXPECT_THROW(
+            Segment::ImpulsiveManeuver(
+                defaultName_, {1.0, 0.0, 0.0}, vncFactorySPtr, 0.0, defaultDynamics_, defaultNumericalSolver_
+            ),
+            ostk::core::error::runtime::Wrong
+        );
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Segment, GetName)
 {
     EXPECT_EQ(defaultName_, defaultCoastSegment_.getName());
@@ -959,6 +1110,222 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Segment, Solve)
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Segment, Solve_InitialTimeStep)
+{
+    const Segment::Solution coldSolution = defaultCoastSegment_.solve(defaultState_);
+
+    ASSERT_TRUE(coldSolution.finalTimeStep.isDefined());
+    EXPECT_LT(0.0, coldSolution.finalTimeStep);
+
+    // Starting with the final time step of a previous solution does not change the solution beyond the tolerances
+
+    const Segment::Solution warmSolution =
+        defaultCoastSegment_.solve(defaultState_, Duration::Days(30.0), nullptr, coldSolution.finalTimeStep);
+
+    EXPECT_TRUE(warmSolution.conditionIsSatisfied);
+    EXPECT_TRUE(warmSolution.finalTimeStep.isDefined());
+    EXPECT_EQ(coldSolution.states.accessLast().accessInstant(), warmSolution.states.accessLast().accessInstant());
+    EXPECT_TRUE(warmSolution.states.accessLast().accessPositionCoordinates().isNear(
+        coldSolution.states.accessLast().accessPositionCoordinates(), 1e-3
+    ));
+
+    // Impulsive maneuvers are not integrated
+
+    const Segment impulsiveManeuverSegment = Segment::ImpulsiveManeuver(
+        defaultName_,
+        {10.0, 0.0, 0.0},
+        LocalOrbitalFrameFactory::VNC(defaultFrameSPtr_),
+        300.0,
+        defaultDynamics_,
+        defaultNumericalSolver_
+    );
+
+    EXPECT_FALSE(impulsiveManeuverSegment.solve(initialStateWithMass_).finalTimeStep.isDefined());
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Segment, Solve_ImpulsiveManeuver)
+{
+    const Real specificImpulse = 300.0;
+
+    const Segment segment = Segment::ImpulsiveManeuver(
+        defaultName_,
+        {10.0, 0.0, 0.0},
+        LocalOrbitalFrameFactory::VNC(defaultFrameSPtr_),
+        specificImpulse,
+        defaultDynamics_,
+        defaultNumericalSolver_
+    );
+
+    {
+        const Segment::Solution solution = segment.solve(initialStateWithMass_);
+
+        ASSERT_EQ(2, solution.states.getSize());
+        EXPECT_TRUE(solution.conditionIsSatisfied);
+        EXPECT_EQ(Segment::Type::ImpulsiveManeuver, solution.segmentType);
+        EXPECT_EQ(initialStateWithMass_, solution.states.accessFirst());
+        EXPECT_EQ(Duration::Zero(), solution.getPropagationDuration());
+
+        const State& finalState = solution.states.accessLast();
+
+        const Vector3d initialVelocity = initialStateWithMass_.accessVelocityCoordinates();
+        const Vector3d expectedVelocity = initialVelocity + 10.0 * initialVelocity.normalized();
+
+        EXPECT_TRUE(finalState.accessPositionCoordinates().isApprox(initialStateWithMass_.accessPositionCoordinates()));
+        EXPECT_TRUE(finalState.accessVelocityCoordinates().isNear(expectedVelocity, 1e-9));
+
+        const Real expectedFinalMass =
+            200.0 * std::exp(-10.0 / (specificImpulse * EarthGravitationalModel::gravityConstant));
+
+        EXPECT_NEAR(expectedFinalMass, solution.getFinalMass().inKilograms(), 1e-12);
+        EXPECT_NEAR(200.0 - expectedFinalMass, solution.computeDeltaMass().inKilograms(), 1e-12);
+        EXPECT_NEAR(10.0, solution.computeDeltaV(specificImpulse), 1e-9);
+        EXPECT_TRUE(solution.extractManeuvers(defaultFrameSPtr_).isEmpty());
+    }
+
+    {
+        EXPECT_THROW(segment.solve(defaultState_), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Segment, StateRetention)
+{
+    Array<State> states = Array<State>::Empty();
+
+    for (Size i = 0; i < 11; ++i)
+    {
+        states.add({
+            defaultState_.accessInstant() + Duration::Seconds(10.0 * i),
+            defaultState_.getPosition(),
+            defaultState_.getVelocity(),
+        });
+    }
+
+    const auto instantsOf = [](const Array<State>& aStateArray) -> Array<Instant>
+    {
+        Array<Instant> instants = Array<Instant>::Empty();
+
+        for (const State& state : aStateArray)
+        {
+            instants.add(state.accessInstant());
+        }
+
+        return instants;
+    };
+
+    {
+        EXPECT_EQ(Segment::StateRetention::Type::All, Segment::StateRetention::All().getType());
+        EXPECT_EQ(states.getSize(), Segment::StateRetention::All().apply(states).getSize());
+    }
+
+    {
+        const Array<State> retainedStates = Segment::StateRetention::Endpoints().apply(states);
+
+        ASSERT_EQ(2, retainedStates.getSize());
+        EXPECT_EQ(states.accessFirst(), retainedStates.accessFirst());
+        EXPECT_EQ(states.accessLast(), retainedStates.accessLast());
+    }
+
+    {
+        const Segment::StateRetention stateRetention = Segment::StateRetention::EveryNthStep(4);
+
+        EXPECT_EQ(4, stateRetention.getStepCount());
+
+        EXPECT_EQ(
+            Array<Instant>({
+                states[0].accessInstant(),
+                states[4].accessInstant(),
+                states[8].accessInstant(),
+                states[10].accessInstant(),
+            }),
+            instantsOf(stateRetention.apply(states))
+        );
+    }
+
+    {
+        const Segment::StateRetention stateRetention = Segment::StateRetention::FixedSpacing(Duration::Seconds(25.0));
+
+        EXPECT_EQ(Duration::Seconds(25.0), stateRetention.getSpacing());
+
+        EXPECT_EQ(
+            Array<Instant>({
+                states[0].accessInstant(),
+                states[3].accessInstant(),
+                states[6].accessInstant(),
+                states[9].accessInstant(),
+                states[10].accessInstant(),
+            }),
+            instantsOf(stateRetention.apply(states))
+        );
+    }
+
+    {
+        const Array<State> singleState = {defaultState_};
+
+        EXPECT_EQ(singleState, Segment::StateRetention::Endpoints().apply(singleState));
+        EXPECT_TRUE(Segment::StateRetention::Endpoints().apply(Array<State>::Empty()).isEmpty());
+    }
+
+    {
+        EXPECT_THROW(Segment::StateRetention::EveryNthStep(0), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(Segment::StateRetention::FixedSpacing(Duration::Zero()), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(
+            Segment::StateRetention::FixedSpacing(Duration::Undefined()), ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Segment, Solve_StateRetention)
+{
+    const Segment::Solution referenceSolution = defaultCoastSegment_.solve(defaultState_);
+
+    ASSERT_GT(referenceSolution.states.getSize(), 2);
+
+    {
+        EXPECT_EQ(Segment::StateRetention::Type::All, defaultCoastSegment_.getStateRetention().getType());
+    }
+
+    {
+        const Segment segment = Segment::Coast(
+            defaultName_,
+            defaultInstantCondition_,
+            defaultDynamics_,
+            defaultNumericalSolver_,
+            Segment::StateRetention::Endpoints()
+        );
+
+        EXPECT_EQ(Segment::StateRetention::Type::Endpoints, segment.getStateRetention().getType());
+
+        const Segment::Solution solution = segment.solve(defaultState_);
+
+        ASSERT_EQ(2, solution.states.getSize());
+        EXPECT_EQ(referenceSolution.states.accessFirst(), solution.states.accessFirst());
+        EXPECT_EQ(referenceSolution.states.accessLast(), solution.states.accessLast());
+        EXPECT_TRUE(solution.conditionIsSatisfied);
+    }
+
+    {
+        const Segment segment = Segment::Coast(
+            defaultName_,
+            defaultInstantCondition_,
+            defaultDynamics_,
+            defaultNumericalSolver_,
+            Segment::StateRetention::FixedSpacing(Duration::Minutes(5.0))
+        );
+
+        const Segment::Solution solution = segment.solve(defaultState_);
+
+        EXPECT_LE(solution.states.getSize(), 5);
+        EXPECT_EQ(referenceSolution.states.accessLast(), solution.states.accessLast());
+
+        for (Size i = 1; i + 1 < solution.states.getSize(); ++i)
+        {
+            EXPECT_GE(
+                solution.states[i].accessInstant() - solution.states[i - 1].accessInstant(), Duration::Minutes(5.0)
+            );
+        }
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Segment, Print)
 {
     testing::internal::CaptureStdout();
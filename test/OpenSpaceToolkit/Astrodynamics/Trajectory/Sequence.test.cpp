@@ -1,5 +1,10 @@
 /// Apache License 2.0
 
+#include <future>
+
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Velocity.hpp>
@@ -14,6 +19,7 @@
 #include <OpenSpaceToolkit/Astrodynamics/Dynamics/Thruster.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/EventCondition/COECondition.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/EventCondition/InstantCondition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/ExecutionContext.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/GuidanceLaw/ConstantThrust.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/LocalOrbitalFrameFactory.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Segment.hpp>
@@ -25,6 +31,8 @@
 #include <Global.test.hpp>
 
 using ostk::core::container::Array;
+using ostk::core::filesystem::File;
+using ostk::core::filesystem::Path;
 using ostk::core::type::Index;
 using ostk::core::type::Real;
 using ostk::core::type::Shared;
@@ -34,6 +42,7 @@ using ostk::mathematics::geometry::d3::object::Composite;
 using ostk::mathematics::geometry::d3::object::Cuboid;
 using ostk::mathematics::geometry::d3::object::Point;
 using ostk::mathematics::object::Matrix3d;
+using ostk::mathematics::object::MatrixXd;
 using ostk::mathematics::object::Vector3d;
 using ostk::mathematics::object::VectorXd;
 
@@ -59,6 +68,7 @@ using ostk::astrodynamics::dynamics::CentralBodyGravity;
 using ostk::astrodynamics::dynamics::PositionDerivative;
 using ostk::astrodynamics::dynamics::Thruster;
 using ostk::astrodynamics::EventCondition;
+using ostk::astrodynamics::ExecutionContext;
 using ostk::astrodynamics::eventcondition::AngularCondition;
 using ostk::astrodynamics::eventcondition::COECondition;
 using ostk::astrodynamics::eventcondition::InstantCondition;
@@ -269,6 +279,55 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Sequence, SequenceSolution_Calc
 
         EXPECT_EQ(propagatedStatesOutsideSequence.getSize(), 0);
     }
+
+    // Test unsorted states failure
+    {
+        const Sequence::Solution sequenceSolution = {{segmentSolution1, segmentSolution2}, true};
+
+        EXPECT_THROW(
+            sequenceSolution.calculateStatesAt(
+                {
+                    state2.getInstant() + Duration::Minutes(0.5),
+                    state1.getInstant() + Duration::Minutes(0.5),
+                },
+                defaultNumericalSolver_
+            ),
+            ostk::core::error::runtime::Wrong
+        );
+    }
+
+    // Test parallel calculation matches the sequential one
+    {
+        const Sequence::Solution sequenceSolution = {{segmentSolution1, segmentSolution2}, true};
+
+        Array<Instant> instants = Array<Instant>::Empty();
+
+        for (Size i = 0; i <= 27; ++i)
+        {
+            instants.add(state1.getInstant() + Duration::Seconds(5.0 * i) - Duration::Seconds(10.0));
+        }
+
+        const Array<State> referenceStates = sequenceSolution.calculateStatesAt(instants, defaultNumericalSolver_);
+
+        // Instants before the sequence start are skipped, the sequence end instant is included
+
+        ASSERT_EQ(referenceStates.getSize(), 25);
+        EXPECT_EQ(referenceStates.accessFirst().getInstant(), state1.getInstant());
+        EXPECT_EQ(referenceStates.accessLast().getInstant(), state3.getInstant());
+
+        for (const Size threadCount : {1, 2, 4})
+        {
+            const Array<State> states =
+                sequenceSolution.calculateStatesAt(instants, defaultNumericalSolver_, ExecutionContext(threadCount));
+
+            ASSERT_EQ(states.getSize(), referenceStates.getSize());
+
+            for (Size i = 0; i < states.getSize(); ++i)
+            {
+                EXPECT_EQ(states[i], referenceStates[i]);
+            }
+        }
+    }
 }
 
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Sequence, SequenceSolution_Print)
@@ -298,6 +357,62 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Sequence, SequenceSolution_Stre
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Sequence, SequenceSolution_Snapshot)
+{
+    File file = File::Path(Path::Parse("/tmp/OpenSpaceToolkit_Astrodynamics_Trajectory_Sequence_Solution.sols"));
+
+    {
+        const Sequence::Solution sequenceSolution = defaultSequence_.solve(defaultState_, defaultRepetitionCount_);
+
+        sequenceSolution.saveSnapshot(file);
+
+        const Sequence::Solution loadedSequenceSolution = Sequence::Solution::LoadSnapshot(file, defaultDynamics_);
+
+        EXPECT_EQ(sequenceSolution.executionIsComplete, loadedSequenceSolution.executionIsComplete);
+
+        ASSERT_EQ(sequenceSolution.segmentSolutions.getSize(), loadedSequenceSolution.segmentSolutions.getSize());
+
+        for (Index i = 0; i < sequenceSolution.segmentSolutions.getSize(); ++i)
+        {
+            const Segment::Solution& segmentSolution = sequenceSolution.segmentSolutions[i];
+            const Segment::Solution& loadedSegmentSolution = loadedSequenceSolution.segmentSolutions[i];
+
+            EXPECT_EQ(segmentSolution.name, loadedSegmentSolution.name);
+            EXPECT_EQ(segmentSolution.conditionIsSatisfied, loadedSegmentSolution.conditionIsSatisfied);
+            EXPECT_EQ(segmentSolution.segmentType, loadedSegmentSolution.segmentType);
+            EXPECT_EQ(segmentSolution.dynamics, loadedSegmentSolution.dynamics);
+            EXPECT_EQ(segmentSolution.states, loadedSegmentSolution.states);
+        }
+
+        // Without dynamics, solutions are loaded without dynamics
+
+        const Sequence::Solution solutionWithoutDynamics = Sequence::Solution::LoadSnapshot(file);
+
+        EXPECT_TRUE(solutionWithoutDynamics.segmentSolutions.accessFirst().dynamics.isEmpty());
+        EXPECT_EQ(sequenceSolution.getStates(), solutionWithoutDynamics.getStates());
+
+        // Stored dynamics must all be provided
+
+        EXPECT_THROW(
+            Sequence::Solution::LoadSnapshot(file, {defaultDynamics_.accessFirst()}), ostk::core::error::RuntimeError
+        );
+
+        file.remove();
+    }
+
+    {
+        EXPECT_THROW(
+            Sequence::Solution({defaultSegmentSolution_}, true).saveSnapshot(File::Undefined()),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(Sequence::Solution::LoadSnapshot(File::Undefined()), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(
+            Sequence::Solution::LoadSnapshot(File::Path(Path::Parse("/does/not/exist.sols"))),
+            ostk::core::error::RuntimeError
+        );
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Sequence, Constructor)
 {
     {
@@ -430,6 +545,39 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Sequence, AddManeuverSegment)
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Sequence, AddImpulsiveManeuverSegment)
+{
+    {
+        const Size segmentsCount = defaultSequence_.getSegments().getSize();
+
+        defaultSequence_.addImpulsiveManeuverSegment(
+            {1.0, 0.0, 0.0}, LocalOrbitalFrameFactory::VNC(Frame::GCRF()), 300.0
+        );
+
+        EXPECT_TRUE(defaultSequence_.getSegments().getSize() == segmentsCount + 1);
+        EXPECT_EQ(Segment::Type::ImpulsiveManeuver, defaultSequence_.getSegments().accessLast().getType());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Sequence, SetSegment)
+{
+    {
+        const Segment segment =
+            Segment::Coast("Replacement", defaultCondition_, defaultDynamics_, defaultNumericalSolver_);
+
+        defaultSequence_.setSegment(0, segment);
+
+        EXPECT_EQ("Replacement", defaultSequence_.getSegments()[0].getName());
+    }
+
+    {
+        EXPECT_THROW(
+            defaultSequence_.setSegment(defaultSequence_.getSegments().getSize(), coastSegment_),
+            ostk::core::error::runtime::Wrong
+        );
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Sequence, Solve)
 {
     // default solve
@@ -448,6 +596,7 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Sequence, Solve)
         for (const Segment::Solution& segmentSolution : solution.segmentSolutions)
         {
             EXPECT_TRUE(segmentSolution.states.getSize() > 0);
+            EXPECT_TRUE(segmentSolution.finalTimeStep.isDefined());
 
             const Real targetAngle = defaultCondition_->getEvaluator()(segmentSolution.states.accessLast());
             EXPECT_NEAR(targetAngle, defaultCondition_->getTargetAngle().inRadians(0.0, Real::TwoPi()), 1e-6);
@@ -725,6 +874,553 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Sequence, Solve_3)
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Sequence, Solve_ImpulsiveManeuver)
+{
+    const Size repetitionCount = 3;
+    const Real deltaV = 2.0;
+    const Real specificImpulse = 220.0;
+    const Real initialMass = 100.0;
+
+    const Shared<RealCondition> durationCondition = std::make_shared<RealCondition>(
+        RealCondition::DurationCondition(RealCondition::Criterion::StrictlyPositive, Duration::Minutes(10.0))
+    );
+
+    Sequence sequence = {
+        Array<Segment>::Empty(),
+        defaultNumericalSolver_,
+        defaultDynamics_,
+        Duration::Days(1.0),
+    };
+
+    sequence.addImpulsiveManeuverSegment(
+        {deltaV, 0.0, 0.0}, LocalOrbitalFrameFactory::VNC(Frame::GCRF()), specificImpulse
+    );
+    sequence.addCoastSegment(durationCondition);
+
+    const Shared<const CoordinateBroker> coordinatesBrokerSPtr = std::make_shared<CoordinateBroker>(CoordinateBroker({
+        CartesianPosition::Default(),
+        CartesianVelocity::Default(),
+        CoordinateSubset::Mass(),
+    }));
+
+    VectorXd coordinates(7);
+    coordinates << 7000000.0, 0.0, 0.0, 0.0, 7546.05329, 0.0, initialMass;
+    const State state = {
+        Instant::J2000(),
+        coordinates,
+        Frame::GCRF(),
+        coordinatesBrokerSPtr,
+    };
+
+    const Sequence::Solution solution = sequence.solve(state, repetitionCount);
+
+    EXPECT_TRUE(solution.executionIsComplete);
+    EXPECT_EQ(2 * repetitionCount, solution.segmentSolutions.getSize());
+
+    for (Size i = 0; i < repetitionCount; ++i)
+    {
+        const Segment::Solution& impulseSolution = solution.segmentSolutions[2 * i];
+
+        EXPECT_EQ(Segment::Type::ImpulsiveManeuver, impulseSolution.segmentType);
+        EXPECT_EQ(2, impulseSolution.states.getSize());
+        EXPECT_EQ(Duration::Zero(), impulseSolution.getPropagationDuration());
+        EXPECT_NEAR(
+            deltaV,
+            (impulseSolution.states.accessLast().accessVelocityCoordinates() -
+             impulseSolution.states.accessFirst().accessVelocityCoordinates())
+                .norm(),
+            1e-9
+        );
+    }
+
+    EXPECT_NEAR((solution.accessEndInstant() - Instant::J2000()).inSeconds(), 600.0 * Real(repetitionCount), 1e-6);
+    const Real totalDeltaV = deltaV * Real(repetitionCount);
+    const Real expectedFinalMass =
+        initialMass * std::exp(-totalDeltaV / (specificImpulse * EarthGravitationalModel::gravityConstant));
+
+    EXPECT_NEAR(expectedFinalMass, solution.getFinalMass().inKilograms(), 1e-12);
+    EXPECT_NEAR(totalDeltaV, solution.computeDeltaV(specificImpulse), 1e-9);
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Sequence, Solve_Batch)
+{
+    const Size repetitionCount = 2;
+
+    const Shared<RealCondition> durationCondition = std::make_shared<RealCondition>(
+        RealCondition::DurationCondition(RealCondition::Criterion::StrictlyPositive, Duration::Seconds(30.0))
+    );
+
+    const Array<Segment> segments = {
+        Segment::Coast("Duration", durationCondition, defaultDynamics_, defaultNumericalSolver_),
+        coastSegment_,
+    };
+
+    const Sequence sequence = {
+        segments,
+        defaultNumericalSolver_,
+        defaultDynamics_,
+        Duration::Days(1.0),
+    };
+
+    Array<State> initialStates = Array<State>::Empty();
+
+    for (Size i = 0; i < 6; ++i)
+    {
+        initialStates.add({
+            defaultState_.accessInstant() + Duration::Minutes(10.0 * i),
+            Position::Meters({7000000.0 + 10000.0 * i, 0.0, 0.0}, Frame::GCRF()),
+            Velocity::MetersPerSecond({0.0, 7546.05329, 0.0}, Frame::GCRF()),
+        });
+    }
+
+    {
+        EXPECT_THROW(sequence.solve(initialStates, 0), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(sequence.solve({State::Undefined()}), ostk::core::error::runtime::Undefined);
+        EXPECT_TRUE(sequence.solve(Array<State>::Empty()).isEmpty());
+    }
+
+    {
+        const Real targetValueOffset = durationCondition->getTarget().valueOffset;
+
+        const Array<Sequence::Solution> solutions = sequence.solve(initialStates, repetitionCount, 3);
+
+        ASSERT_EQ(initialStates.getSize(), solutions.getSize());
+
+        // Relative targets of the original event conditions are left untouched
+
+        EXPECT_EQ(targetValueOffset, durationCondition->getTarget().valueOffset);
+
+        for (Size i = 0; i < initialStates.getSize(); ++i)
+        {
+            const Sequence::Solution referenceSolution = sequence.solve(initialStates[i], repetitionCount);
+            const Sequence::Solution& solution = solutions[i];
+
+            EXPECT_TRUE(solution.executionIsComplete);
+            ASSERT_EQ(referenceSolution.segmentSolutions.getSize(), solution.segmentSolutions.getSize());
+
+            EXPECT_EQ(
+                (solution.segmentSolutions[0].accessEndInstant() - initialStates[i].accessInstant()),
+                Duration::Seconds(30.0)
+            );
+
+            for (Size j = 0; j < solution.segmentSolutions.getSize(); ++j)
+            {
+                EXPECT_EQ(referenceSolution.segmentSolutions[j].name, solution.segmentSolutions[j].name);
+                EXPECT_EQ(
+                    referenceSolution.segmentSolutions[j].accessEndInstant(),
+                    solution.segmentSolutions[j].accessEndInstant()
+                );
+                EXPECT_TRUE(referenceSolution.segmentSolutions[j]
+                                .states.accessLast()
+                                .getCoordinates()
+                                .isApprox(solution.segmentSolutions[j].states.accessLast().getCoordinates(), 1e-12));
+            }
+        }
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Sequence, SolveWarmStarted)
+{
+    Size evaluationCount = 0;
+
+    const Shared<RealCondition> countingDurationCondition = std::make_shared<RealCondition>(
+        "Counting Duration",
+        RealCondition::Criterion::StrictlyPositive,
+        [&evaluationCount](const State& aState) -> Real
+        {
+            ++evaluationCount;
+
+            return (aState.accessInstant() - Instant::J2000()).inSeconds();
+        },
+        EventCondition::Target(60.0, EventCondition::Target::Type::Relative)
+    );
+
+    Sequence sequence = {
+        {
+            Segment::Coast("Coast", countingDurationCondition, defaultDynamics_, defaultNumericalSolver_),
+            Segment::Coast("True Anomaly", defaultCondition_, defaultDynamics_, defaultNumericalSolver_),
+        },
+        defaultNumericalSolver_,
+        defaultDynamics_,
+        Duration::Days(1.0),
+    };
+
+    const Sequence::Solution referenceSolution = sequence.solve(defaultState_, 2);
+
+    {
+        EXPECT_THROW(sequence.solveWarmStarted(defaultState_, 0), ostk::core::error::runtime::Wrong);
+    }
+
+    // The first warm-started solve propagates all segments
+
+    evaluationCount = 0;
+
+    const Sequence::Solution firstSolution = sequence.solveWarmStarted(defaultState_, 2);
+
+    EXPECT_GT(evaluationCount, 0);
+    ASSERT_EQ(referenceSolution.segmentSolutions.getSize(), firstSolution.segmentSolutions.getSize());
+
+    for (Size i = 0; i < referenceSolution.segmentSolutions.getSize(); ++i)
+    {
+        EXPECT_EQ(referenceSolution.segmentSolutions[i].name, firstSolution.segmentSolutions[i].name);
+        EXPECT_EQ(referenceSolution.segmentSolutions[i].states, firstSolution.segmentSolutions[i].states);
+    }
+
+    // Unchanged segments are reused
+
+    {
+        evaluationCount = 0;
+
+        const Sequence::Solution solution = sequence.solveWarmStarted(defaultState_, 2);
+
+        EXPECT_EQ(0, evaluationCount);
+        EXPECT_TRUE(solution.executionIsComplete);
+        ASSERT_EQ(firstSolution.segmentSolutions.getSize(), solution.segmentSolutions.getSize());
+
+        for (Size i = 0; i < firstSolution.segmentSolutions.getSize(); ++i)
+        {
+            EXPECT_EQ(firstSolution.segmentSolutions[i].states, solution.segmentSolutions[i].states);
+        }
+    }
+
+    // Segments are propagated again from the first changed one
+
+    {
+        const Shared<AngularCondition> otherCondition = std::make_shared<AngularCondition>(COECondition::TrueAnomaly(
+            AngularCondition::Criterion::AnyCrossing,
+            Frame::GCRF(),
+            Angle::Degrees(90.0),
+            EarthGravitationalModel::EGM2008.gravitationalParameter_
+        ));
+
+        sequence.setSegment(
+            1, Segment::Coast("True Anomaly", otherCondition, defaultDynamics_, defaultNumericalSolver_)
+        );
+
+        evaluationCount = 0;
+
+        const Sequence::Solution solution = sequence.solveWarmStarted(defaultState_, 2);
+
+        // The first segment is reused, while the second repetition of the first segment starts from a new state
+
+        EXPECT_GT(evaluationCount, 0);
+        EXPECT_EQ(firstSolution.segmentSolutions[0].states, solution.segmentSolutions[0].states);
+        EXPECT_NE(
+            firstSolution.segmentSolutions[1].accessEndInstant(), solution.segmentSolutions[1].accessEndInstant()
+        );
+        EXPECT_EQ(solution.segmentSolutions[3].accessEndInstant(), sequence.solve(defaultState_, 2).accessEndInstant());
+    }
+
+    // A new initial state invalidates all cached segments
+
+    {
+        const State initialState = {
+            defaultState_.accessInstant() + Duration::Minutes(1.0),
+            defaultState_.getPosition(),
+            defaultState_.getVelocity(),
+        };
+
+        const Sequence::Solution solution = sequence.solveWarmStarted(initialState, 1);
+
+        EXPECT_EQ(initialState.accessInstant(), solution.accessStartInstant());
+        EXPECT_TRUE(solution.segmentSolutions[0].accessEndInstant().isNear(
+            initialState.accessInstant() + Duration::Seconds(60.0), Duration::Microseconds(1.0)
+        ));
+    }
+
+    // Clearing the cache propagates all segments
+
+    {
+        sequence.clearSolutionCache();
+
+        evaluationCount = 0;
+
+        sequence.solveWarmStarted(defaultState_, 1);
+
+        EXPECT_GT(evaluationCount, 0);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Sequence, SolveAsync)
+{
+    const Sequence sequence = {
+        {
+            Segment::Coast(
+                "First Coast",
+                std::make_shared<RealCondition>(
+                    RealCondition::DurationCondition(RealCondition::Criterion::AnyCrossing, Duration::Minutes(1.0))
+                ),
+                defaultDynamics_,
+                defaultNumericalSolver_
+            ),
+            coastSegment_,
+        },
+        defaultNumericalSolver_,
+        defaultDynamics_,
+        defaultMaximumPropagationDuration_,
+    };
+
+    // Segment solutions are streamed to the callback as they complete
+
+    {
+        Array<Segment::Solution> streamedSegmentSolutions = Array<Segment::Solution>::Empty();
+
+        Sequence::AsyncSolution asyncSolution = sequence.solveAsync(
+            defaultState_,
+            2,
+            [&streamedSegmentSolutions](const Segment::Solution& aSegmentSolution) -> void
+            {
+                streamedSegmentSolutions.add(aSegmentSolution);
+            }
+        );
+
+        const Sequence::Solution solution = asyncSolution.get();
+        const Sequence::Solution referenceSolution = sequence.solve(defaultState_, 2);
+
+        EXPECT_TRUE(asyncSolution.isReady());
+        EXPECT_FALSE(asyncSolution.isCancelled());
+        EXPECT_TRUE(solution.executionIsComplete);
+
+        ASSERT_EQ(referenceSolution.segmentSolutions.getSize(), solution.segmentSolutions.getSize());
+        ASSERT_EQ(referenceSolution.segmentSolutions.getSize(), streamedSegmentSolutions.getSize());
+
+        for (Size i = 0; i < referenceSolution.segmentSolutions.getSize(); ++i)
+        {
+            EXPECT_EQ(referenceSolution.segmentSolutions[i].name, solution.segmentSolutions[i].name);
+            EXPECT_EQ(referenceSolution.segmentSolutions[i].states, solution.segmentSolutions[i].states);
+            EXPECT_EQ(referenceSolution.segmentSolutions[i].states, streamedSegmentSolutions[i].states);
+        }
+    }
+
+    // A cancelled solve returns the segment solutions completed before cancellation
+
+    {
+        Shared<Sequence::AsyncSolution> asyncSolutionSPtr = nullptr;
+        std::promise<void> handleIsSet;
+        std::shared_future<void> handleIsSetFuture = handleIsSet.get_future().share();
+
+        Size streamedSegmentSolutionCount = 0;
+
+        asyncSolutionSPtr = std::make_shared<Sequence::AsyncSolution>(sequence.solveAsync(
+            defaultState_,
+            2,
+            [&asyncSolutionSPtr, &handleIsSetFuture, &streamedSegmentSolutionCount](const Segment::Solution&) -> void
+            {
+                handleIsSetFuture.wait();
+
+                ++streamedSegmentSolutionCount;
+
+                asyncSolutionSPtr->cancel();
+            }
+        ));
+
+        handleIsSet.set_value();
+
+        const Sequence::Solution solution = asyncSolutionSPtr->get();
+
+        EXPECT_TRUE(asyncSolutionSPtr->isCancelled());
+        EXPECT_FALSE(solution.executionIsComplete);
+        EXPECT_EQ(1, solution.segmentSolutions.getSize());
+        EXPECT_EQ(1, streamedSegmentSolutionCount);
+    }
+
+    // Overlapping solves of the same sequence from different states hold their own relative targets
+
+    {
+        const Shared<RealCondition> durationCondition = std::make_shared<RealCondition>(
+            RealCondition::DurationCondition(RealCondition::Criterion::StrictlyPositive, Duration::Seconds(30.0))
+        );
+
+        const Sequence relativeSequence = {
+            {
+                Segment::Coast("Duration", durationCondition, defaultDynamics_, defaultNumericalSolver_),
+                coastSegment_,
+            },
+            defaultNumericalSolver_,
+            defaultDynamics_,
+            defaultMaximumPropagationDuration_,
+        };
+
+        const Real targetValueOffset = durationCondition->getTarget().valueOffset;
+
+        const Array<State> initialStates = {
+            defaultState_,
+            {
+                defaultState_.accessInstant() + Duration::Minutes(10.0),
+                Position::Meters({7010000.0, 0.0, 0.0}, Frame::GCRF()),
+                Velocity::MetersPerSecond({0.0, 7546.05329, 0.0}, Frame::GCRF()),
+            },
+        };
+
+        // Both solves are held on their first segment solution until the two of them are started
+
+        std::promise<void> solvesAreStarted;
+        std::shared_future<void> solvesAreStartedFuture = solvesAreStarted.get_future().share();
+
+        const auto waitForSolves = [&solvesAreStartedFuture](const Segment::Solution&) -> void
+        {
+            solvesAreStartedFuture.wait();
+        };
+
+        Sequence::AsyncSolution firstAsyncSolution = relativeSequence.solveAsync(initialStates[0], 2, waitForSolves);
+        Sequence::AsyncSolution secondAsyncSolution = relativeSequence.solveAsync(initialStates[1], 2, waitForSolves);
+
+        solvesAreStarted.set_value();
+
+        const Array<Sequence::Solution> solutions = {firstAsyncSolution.get(), secondAsyncSolution.get()};
+
+        EXPECT_EQ(targetValueOffset, durationCondition->getTarget().valueOffset);
+
+        for (Size i = 0; i < initialStates.getSize(); ++i)
+        {
+            const Sequence::Solution referenceSolution = relativeSequence.solve(initialStates[i], 2);
+            const Sequence::Solution& solution = solutions[i];
+
+            EXPECT_TRUE(solution.executionIsComplete);
+            ASSERT_EQ(referenceSolution.segmentSolutions.getSize(), solution.segmentSolutions.getSize());
+
+            EXPECT_EQ(
+                (solution.segmentSolutions[0].accessEndInstant() - initialStates[i].accessInstant()),
+                Duration::Seconds(30.0)
+            );
+
+            for (Size j = 0; j < solution.segmentSolutions.getSize(); ++j)
+            {
+                EXPECT_EQ(referenceSolution.segmentSolutions[j].states, solution.segmentSolutions[j].states);
+            }
+        }
+    }
+
+    // Background solve to condition
+
+    {
+        const Shared<InstantCondition> eventConditionSPtr = std::make_shared<InstantCondition>(
+            InstantCondition::Criterion::StrictlyPositive, defaultState_.accessInstant() + Duration::Minutes(30.0)
+        );
+
+        const Sequence::Solution solution = sequence.solveToConditionAsync(defaultState_, eventConditionSPtr).get();
+        const Sequence::Solution referenceSolution = sequence.solveToCondition(defaultState_, *eventConditionSPtr);
+
+        EXPECT_EQ(referenceSolution.executionIsComplete, solution.executionIsComplete);
+        EXPECT_EQ(referenceSolution.segmentSolutions.getSize(), solution.segmentSolutions.getSize());
+        EXPECT_EQ(referenceSolution.accessEndInstant(), solution.accessEndInstant());
+    }
+
+    {
+        EXPECT_THROW(sequence.solveAsync(defaultState_, 0), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(sequence.solveToConditionAsync(defaultState_, nullptr), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Sequence, SolveTargeting)
+{
+    const Sequence sequence = {
+        {Segment::Coast(
+            "Coast",
+            std::make_shared<InstantCondition>(
+                InstantCondition::Criterion::AnyCrossing, defaultState_.accessInstant() + Duration::Minutes(30.0)
+            ),
+            defaultDynamics_,
+            defaultNumericalSolver_
+        )},
+        defaultNumericalSolver_,
+        defaultDynamics_,
+        Duration::Days(1.0),
+    };
+
+    // Target the final position reached with a velocity offset, by adjusting the initial velocity
+
+    const auto generateInitialState = [this](const VectorXd& aControlVector) -> State
+    {
+        return {
+            defaultState_.accessInstant(),
+            defaultState_.getPosition(),
+            Velocity::MetersPerSecond(Vector3d(aControlVector), Frame::GCRF()),
+        };
+    };
+
+    const auto getFinalPosition = [](const Sequence::Solution& aSolution) -> Vector3d
+    {
+        return aSolution.segmentSolutions.accessLast().states.accessLast().getPosition().accessCoordinates();
+    };
+
+    const VectorXd initialControls = defaultState_.getVelocity().accessCoordinates();
+    const Vector3d velocityOffset = {1.0, 2.0, -0.5};
+
+    const Vector3d targetPosition =
+        getFinalPosition(sequence.solve(generateInitialState(initialControls + velocityOffset)));
+
+    const auto computeConstraints = [&](const Sequence::Solution& aSolution) -> VectorXd
+    {
+        return getFinalPosition(aSolution) - targetPosition;
+    };
+
+    {
+        const Sequence::TargetingSolution targetingSolution =
+            sequence.solveTargeting(initialControls, generateInitialState, computeConstraints, 1e-3);
+
+        EXPECT_TRUE(targetingSolution.hasConverged);
+        EXPECT_GT(1e-3, targetingSolution.constraints.norm());
+        EXPECT_TRUE(targetingSolution.controls.isApprox(initialControls + velocityOffset, 1e-7));
+        EXPECT_EQ(3, targetingSolution.jacobian.rows());
+        EXPECT_EQ(3, targetingSolution.jacobian.cols());
+        EXPECT_TRUE(targetingSolution.solution.executionIsComplete);
+
+        // Each iteration costs a single sequence solve, besides the finite difference Jacobian evaluations
+
+        EXPECT_GE(targetingSolution.jacobianEvaluationCount, 1);
+        EXPECT_EQ(
+            1 + 3 * targetingSolution.jacobianEvaluationCount + targetingSolution.iterationCount,
+            targetingSolution.propagationCount
+        );
+        EXPECT_LT(targetingSolution.propagationCount, (2 * 3 + 1) * targetingSolution.iterationCount);
+    }
+
+    // A seeded Jacobian saves the initial finite difference evaluation
+
+    {
+        const MatrixXd jacobian =
+            sequence.solveTargeting(initialControls, generateInitialState, computeConstraints, 1e-3).jacobian;
+
+        const Sequence::TargetingSolution targetingSolution =
+            sequence.solveTargeting(initialControls, generateInitialState, computeConstraints, 1e-3, 20, jacobian);
+
+        EXPECT_TRUE(targetingSolution.hasConverged);
+        EXPECT_GT(1e-3, targetingSolution.constraints.norm());
+    }
+
+    // A maximum iteration count of zero leaves the controls untouched
+
+    {
+        const Sequence::TargetingSolution targetingSolution =
+            sequence.solveTargeting(initialControls, generateInitialState, computeConstraints, 1e-3, 0);
+
+        EXPECT_FALSE(targetingSolution.hasConverged);
+        EXPECT_EQ(0, targetingSolution.iterationCount);
+        EXPECT_EQ(initialControls, targetingSolution.controls);
+    }
+
+    {
+        EXPECT_THROW(
+            sequence.solveTargeting(VectorXd(), generateInitialState, computeConstraints),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            sequence.solveTargeting(initialControls, nullptr, computeConstraints), ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            sequence.solveTargeting(initialControls, generateInitialState, computeConstraints, 0.0),
+            ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            sequence.solveTargeting(
+                initialControls, generateInitialState, computeConstraints, 1e-3, 20, MatrixXd::Identity(2, 3)
+            ),
+            ostk::core::error::runtime::Wrong
+        );
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_Sequence, Print)
 {
     {
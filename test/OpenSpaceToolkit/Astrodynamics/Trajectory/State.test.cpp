@@ -12,6 +12,7 @@
 
 using ostk::core::container::Array;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 
 using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
 using ostk::mathematics::object::Vector3d;
@@ -1230,6 +1231,110 @@ TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_State, ExtractCoordinate)
     }
 }
 
+TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_State, AccessCoordinate)
+{
+    {
+        const Instant instant = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+        VectorXd coordinates(6);
+        coordinates << 1.0, 2.0, 3.0, 4.0, 5.0, 6.0;
+        const Shared<const CoordinateBroker> brokerSPtr = std::make_shared<CoordinateBroker>(
+            CoordinateBroker({CartesianPosition::Default(), CartesianVelocity::Default()})
+        );
+        const State aState = {instant, coordinates, Frame::GCRF(), brokerSPtr};
+
+        const double* data = aState.accessCoordinates().data();
+
+        EXPECT_EQ(coordinates.segment(3, 3), aState.accessCoordinate(CartesianVelocity::Default()));
+        EXPECT_EQ(data + 3, aState.accessCoordinate(CartesianVelocity::Default()).data());
+
+        EXPECT_EQ(Vector3d(1.0, 2.0, 3.0), aState.accessPositionCoordinates());
+        EXPECT_EQ(data, aState.accessPositionCoordinates().data());
+
+        EXPECT_EQ(Vector3d(4.0, 5.0, 6.0), aState.accessVelocityCoordinates());
+        EXPECT_EQ(data + 3, aState.accessVelocityCoordinates().data());
+
+        EXPECT_ANY_THROW(aState.accessCoordinate(AttitudeQuaternion::Default()));
+    }
+
+    {
+        const Instant instant = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+        VectorXd coordinates(3);
+        coordinates << 1.0, 2.0, 3.0;
+        const Shared<const CoordinateBroker> brokerSPtr =
+            std::make_shared<CoordinateBroker>(CoordinateBroker({CartesianPosition::Default()}));
+        const State aState = {instant, coordinates, Frame::GCRF(), brokerSPtr};
+
+        EXPECT_EQ(Vector3d(1.0, 2.0, 3.0), aState.accessPositionCoordinates());
+        EXPECT_ANY_THROW(aState.accessVelocityCoordinates());
+    }
+
+    {
+        EXPECT_ANY_THROW(State::Undefined().accessPositionCoordinates());
+        EXPECT_ANY_THROW(State::Undefined().accessCoordinate(CartesianPosition::Default()));
+    }
+}
+
+TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_State, CoordinatesStorage)
+{
+    const Instant instant = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+
+    const auto isStoredInline = [](const State& aState) -> bool
+    {
+        const char* data = reinterpret_cast<const char*>(aState.accessCoordinates().data());
+        const char* object = reinterpret_cast<const char*>(&aState);
+
+        return (data >= object) && (data < object + sizeof(State));
+    };
+
+    {
+        VectorXd coordinates(13);
+        coordinates << 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 0.0, 0.0, 0.0, 1.0, 0.1, 0.2, 0.3;
+        const State state = {
+            instant,
+            coordinates,
+            Frame::GCRF(),
+            {CartesianPosition::Default(),
+             CartesianVelocity::Default(),
+             AttitudeQuaternion::Default(),
+             AngularVelocity::Default()},
+        };
+
+        EXPECT_TRUE(isStoredInline(state));
+        EXPECT_EQ(coordinates, state.accessCoordinates());
+
+        const State stateCopy = state;
+        State assignedState = State::Undefined();
+        assignedState = state;
+
+        EXPECT_TRUE(isStoredInline(stateCopy));
+        EXPECT_TRUE(isStoredInline(assignedState));
+        EXPECT_EQ(state, stateCopy);
+        EXPECT_EQ(state, assignedState);
+    }
+
+    {
+        const VectorXd coordinates = VectorXd::LinSpaced(42, 0.0, 41.0);
+        const State state = {
+            instant,
+            coordinates,
+            Frame::GCRF(),
+            {CartesianPosition::Default(),
+             CartesianVelocity::Default(),
+             std::make_shared<CoordinateSubset>("STATE_TRANSITION_MATRIX", 36)},
+        };
+
+        EXPECT_FALSE(isStoredInline(state));
+        EXPECT_EQ(42, state.getSize());
+        EXPECT_EQ(coordinates, state.accessCoordinates());
+        EXPECT_EQ(coordinates.segment(3, 3), state.accessVelocityCoordinates());
+
+        const State stateCopy = state;
+
+        EXPECT_EQ(state, stateCopy);
+        EXPECT_NE(state.accessCoordinates().data(), stateCopy.accessCoordinates().data());
+    }
+}
+
 TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_State, ExtractCoordinates)
 {
     {
@@ -1323,6 +1428,97 @@ TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_State, InFrame)
     }
 }
 
+TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_State, InFrame_Array)
+{
+    const Instant instant = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+    const Quaternion attitude = Quaternion(-0.003, -0.904, 0.301, 0.304, Quaternion::Format::XYZS);
+    const Vector3d angularVelocity = {-1.0, -2.0, -3.0};
+
+    Array<State> states = Array<State>::Empty();
+
+    for (const Instant& stateInstant : {instant, instant, instant + ostk::physics::time::Duration::Minutes(1.0)})
+    {
+        const Position position = Position::Meters({7.0e6, 1.0e3 * states.getSize(), 0.0}, Frame::GCRF());
+        const Velocity velocity = Velocity::MetersPerSecond({0.0, 8.0e3, 1.0 * states.getSize()}, Frame::GCRF());
+
+        states.add({stateInstant, position, velocity, attitude, angularVelocity, Frame::GCRF()});
+    }
+
+    states.add(State(
+        instant,
+        Position::Meters({7.0e6, 0.0, 0.0}, Frame::ITRF()),
+        Velocity::MetersPerSecond({0.0, 8.0e3, 0.0}, Frame::ITRF())
+    ));
+
+    {
+        const Array<State> statesITRF = State::InFrame(states, Frame::ITRF());
+
+        ASSERT_EQ(states.getSize(), statesITRF.getSize());
+
+        for (Size i = 0; i < states.getSize(); ++i)
+        {
+            EXPECT_EQ(states[i].inFrame(Frame::ITRF()), statesITRF[i]);
+            EXPECT_EQ(Frame::ITRF(), statesITRF[i].getFrame());
+        }
+    }
+
+    {
+        EXPECT_TRUE(State::InFrame(Array<State>::Empty(), Frame::ITRF()).isEmpty());
+    }
+
+    {
+        EXPECT_ANY_THROW(State::InFrame(states, Frame::Undefined()));
+        EXPECT_ANY_THROW(State::InFrame({states[0], State::Undefined()}, Frame::ITRF()));
+    }
+}
+
+TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_State, InFrame_Array_Interpolated)
+{
+    const Instant startInstant = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+
+    Array<State> states = Array<State>::Empty();
+
+    for (Size i = 0; i < 120; ++i)
+    {
+        states.add(State(
+            startInstant + ostk::physics::time::Duration::Seconds(37.0 * i),
+            Position::Meters({7.0e6, 1.0e3 * i, 0.0}, Frame::GCRF()),
+            Velocity::MetersPerSecond({0.0, 7.5e3, 1.0 * i}, Frame::GCRF())
+        ));
+    }
+
+    states.add(State(
+        startInstant,
+        Position::Meters({7.0e6, 0.0, 0.0}, Frame::ITRF()),
+        Velocity::MetersPerSecond({0.0, 7.5e3, 0.0}, Frame::ITRF())
+    ));
+
+    {
+        const Array<State> statesITRF =
+            State::InFrame(states, Frame::ITRF(), ostk::physics::time::Duration::Minutes(5.0));
+
+        ASSERT_EQ(states.getSize(), statesITRF.getSize());
+
+        for (Size i = 0; i < states.getSize(); ++i)
+        {
+            const State referenceState = states[i].inFrame(Frame::ITRF());
+
+            EXPECT_EQ(referenceState.getInstant(), statesITRF[i].getInstant());
+            EXPECT_EQ(Frame::ITRF(), statesITRF[i].getFrame());
+            EXPECT_TRUE(statesITRF[i].getPosition().getCoordinates().isNear(
+                referenceState.getPosition().getCoordinates(), 1e-4
+            ));
+            EXPECT_TRUE(statesITRF[i].getVelocity().getCoordinates().isNear(
+                referenceState.getVelocity().getCoordinates(), 1e-6
+            ));
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(State::InFrame(states, Frame::ITRF(), ostk::physics::time::Duration::Zero()));
+    }
+}
+
 TEST(OpenSpaceToolkit_Astrodynamics_Trajectory_State, Undefined)
 {
     {
@@ -319,6 +319,47 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_CoordinateBroker, Operati
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_CoordinateBroker, GetSubsetIndex)
+{
+    {
+        const CoordinateBroker broker = CoordinateBroker({subset_1, subset_2, subset_3});
+
+        EXPECT_EQ(0, broker.getSubsetIndex(subset_1));
+        EXPECT_EQ(1, broker.getSubsetIndex(subset_2));
+        EXPECT_EQ(3, broker.getSubsetIndex(subset_3));
+        EXPECT_EQ(0, broker.getSubsetIndex(subsetDuplicate));
+    }
+
+    {
+        const CoordinateBroker broker = CoordinateBroker({subset_2});
+
+        EXPECT_EQ(0, broker.getSubsetIndex(subset_2));
+        EXPECT_THROW(broker.getSubsetIndex(subset_1), ostk::core::error::RuntimeError);
+        EXPECT_THROW(
+            broker.getSubsetIndex(std::make_shared<CoordinateSubset>("NEVER_ADDED", 7)), ostk::core::error::RuntimeError
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_CoordinateBroker, Hash)
+{
+    {
+        EXPECT_EQ(CoordinateBroker().hash(), CoordinateBroker().hash());
+    }
+
+    {
+        const CoordinateBroker broker = {{subset_1, subset_2}};
+
+        EXPECT_EQ(broker.hash(), CoordinateBroker({subset_1, subset_2}).hash());
+        EXPECT_EQ(broker.hash(), CoordinateBroker({subsetDuplicate, subset_2}).hash());
+        EXPECT_EQ(broker.hash(), CoordinateBroker({subset_1, subset_2, subset_1}).hash());
+
+        EXPECT_NE(broker.hash(), CoordinateBroker().hash());
+        EXPECT_NE(broker.hash(), CoordinateBroker({subset_2, subset_1}).hash());
+        EXPECT_NE(broker.hash(), CoordinateBroker({subset_1, subset_4}).hash());
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_CoordinateBroker, ExtractCoordinate)
 {
     {
@@ -349,6 +390,30 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_CoordinateBroker, Extract
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_CoordinateBroker, AccessCoordinate)
+{
+    {
+        CoordinateBroker broker = CoordinateBroker();
+        broker.addSubset(subset_1);
+        broker.addSubset(subset_2);
+        broker.addSubset(subset_3);
+
+        VectorXd fullCoordinatesVector(6);
+        fullCoordinatesVector << 0.0, 1.0, 2.0, 3.0, 4.0, 5.0;
+
+        const Eigen::Ref<const VectorXd> subset_3_coordinates =
+            broker.accessCoordinate(fullCoordinatesVector, subset_3);
+        EXPECT_EQ(3, subset_3_coordinates.size());
+        EXPECT_EQ(fullCoordinatesVector.data() + 3, subset_3_coordinates.data());
+
+        fullCoordinatesVector(4) = 10.0;
+
+        EXPECT_EQ(10.0, subset_3_coordinates(1));
+
+        EXPECT_ANY_THROW(broker.accessCoordinate(fullCoordinatesVector, subset_4));
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_CoordinateBroker, ExtractCoordinates)
 {
     {
@@ -82,6 +82,18 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_CoordinateSubset, Hash)
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_CoordinateSubset, GetHandle)
+{
+    {
+        EXPECT_EQ(defaultCoordinateSubset_.getHandle(), CoordinateSubset(defaultName_, defaultSize_).getHandle());
+    }
+
+    {
+        EXPECT_NE(defaultCoordinateSubset_.getHandle(), CoordinateSubset("OTHER", defaultSize_).getHandle());
+        EXPECT_NE(defaultCoordinateSubset_.getHandle(), CoordinateSubset(defaultName_, defaultSize_ + 1).getHandle());
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_CoordinateSubset, Getters)
 {
     {
@@ -174,6 +186,31 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_CoordinateSubset, InFrame
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_CoordinateSubset, ApplyTransform)
+{
+    {
+        const Instant instant = Instant::J2000();
+        const Shared<const Frame> fromFrame = Frame::GCRF();
+        const Shared<const Frame> toFrame = Frame::TEME();
+        VectorXd fullCoordinatesVector(3);
+        fullCoordinatesVector << 1.0e7, -1e7, 5e6;
+
+        VectorXd expected(1);
+        expected << 1.0e7;
+
+        const VectorXd actual = defaultCoordinateSubset_.applyTransform(
+            fromFrame->getTransformTo(toFrame, instant),
+            instant,
+            fullCoordinatesVector,
+            fromFrame,
+            toFrame,
+            defaultCoordinateBroker_
+        );
+
+        EXPECT_EQ(expected, actual);
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_CoordinateSubset, Mass)
 {
     {
@@ -100,6 +100,32 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_CoordinateSubset_Cartesia
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_CoordinateSubset_CartesianPosition, ApplyTransform)
+{
+    {
+        const Instant instant = Instant::J2000();
+        const Shared<const Frame> fromFrame = Frame::GCRF();
+        const Shared<const Frame> toFrame = Frame::TEME();
+        VectorXd fullCoordinatesVector(3);
+        fullCoordinatesVector << 1.0e7, -1e7, 5e6;
+
+        const VectorXd expected = defaultCartesianPosition_.inFrame(
+            instant, fullCoordinatesVector, fromFrame, toFrame, defaultCoordinateBroker_
+        );
+
+        const VectorXd actual = defaultCartesianPosition_.applyTransform(
+            fromFrame->getTransformTo(toFrame, instant),
+            instant,
+            fullCoordinatesVector,
+            fromFrame,
+            toFrame,
+            defaultCoordinateBroker_
+        );
+
+        EXPECT_EQ(expected, actual);
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_CoordinateSubset_CartesianPosition, Default)
 {
     {
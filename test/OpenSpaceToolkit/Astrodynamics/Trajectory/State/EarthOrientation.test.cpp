@@ -0,0 +1,157 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/EarthOrientation.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/TransformCache.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Transform;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+
+using ostk::astrodynamics::trajectory::state::EarthOrientation;
+using ostk::astrodynamics::trajectory::state::TransformCache;
+
+class OpenSpaceToolkit_Astrodynamics_Trajectory_State_EarthOrientation : public ::testing::Test
+{
+   protected:
+    void TearDown() override
+    {
+        EarthOrientation::SetModel(EarthOrientation::Model::Full);
+        EarthOrientation::SetInterpolationStep(Duration::Hours(1.0));
+    }
+
+    const Shared<const Frame> gcrfSPtr_ = Frame::GCRF();
+    const Shared<const Frame> itrfSPtr_ = Frame::ITRF();
+    const Shared<const Frame> temeSPtr_ = Frame::TEME();
+    const Instant startInstant_ = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_EarthOrientation, Model)
+{
+    {
+        EXPECT_EQ(EarthOrientation::Model::Full, EarthOrientation::GetModel());
+        EXPECT_EQ(Duration::Hours(1.0), EarthOrientation::GetInterpolationStep());
+    }
+
+    {
+        TransformCache::Get(gcrfSPtr_, itrfSPtr_, startInstant_);
+
+        EXPECT_EQ(1, TransformCache::GetSize());
+
+        EarthOrientation::SetModel(EarthOrientation::Model::Interpolated);
+
+        EXPECT_EQ(EarthOrientation::Model::Interpolated, EarthOrientation::GetModel());
+        EXPECT_EQ(0, TransformCache::GetSize());
+    }
+
+    {
+        EarthOrientation::SetInterpolationStep(Duration::Minutes(10.0));
+
+        EXPECT_EQ(Duration::Minutes(10.0), EarthOrientation::GetInterpolationStep());
+
+        EXPECT_THROW(EarthOrientation::SetInterpolationStep(Duration::Zero()), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(
+            EarthOrientation::SetInterpolationStep(Duration::Undefined()), ostk::core::error::runtime::Wrong
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_EarthOrientation, GetTransform)
+{
+    const Vector3d leoPosition = {4000000.0, -3000000.0, 4500000.0};
+    const Vector3d geoPosition = {42164000.0, 0.0, 0.0};
+
+    // The full model is exact
+
+    {
+        const Transform referenceTransform = gcrfSPtr_->getTransformTo(itrfSPtr_, startInstant_);
+        const Transform transform = EarthOrientation::GetTransform(gcrfSPtr_, itrfSPtr_, startInstant_);
+
+        EXPECT_TRUE(
+            transform.applyToPosition(leoPosition).isNear(referenceTransform.applyToPosition(leoPosition), 1e-9)
+        );
+    }
+
+    EarthOrientation::SetModel(EarthOrientation::Model::Interpolated);
+
+    // The interpolated model is accurate, in both directions
+
+    {
+        for (Size i = 0; i < 97; ++i)
+        {
+            const Instant instant = startInstant_ + Duration::Seconds(900.0 * i + 137.0);
+
+            const Transform referenceTransform = gcrfSPtr_->getTransformTo(itrfSPtr_, instant);
+            const Transform transform = EarthOrientation::GetTransform(gcrfSPtr_, itrfSPtr_, instant);
+
+            EXPECT_EQ(instant, transform.getInstant());
+
+            EXPECT_TRUE(transform.applyToPosition(leoPosition).isNear(
+                referenceTransform.applyToPosition(leoPosition), 5e-2
+            ));
+            EXPECT_TRUE(transform.applyToPosition(geoPosition).isNear(
+                referenceTransform.applyToPosition(geoPosition), 5e-1
+            ));
+
+            EXPECT_TRUE(EarthOrientation::GetTransform(itrfSPtr_, gcrfSPtr_, instant)
+                            .applyToPosition(leoPosition)
+                            .isNear(referenceTransform.getInverse().applyToPosition(leoPosition), 5e-2));
+        }
+    }
+
+    // Going back in time, and changing the step, are supported
+
+    {
+        EarthOrientation::SetInterpolationStep(Duration::Minutes(5.0));
+
+        for (Size i = 0; i < 12; ++i)
+        {
+            const Instant instant = startInstant_ - Duration::Seconds(1700.0 * i + 11.0);
+
+            EXPECT_TRUE(EarthOrientation::GetTransform(gcrfSPtr_, itrfSPtr_, instant)
+                            .applyToPosition(leoPosition)
+                            .isNear(gcrfSPtr_->getTransformTo(itrfSPtr_, instant).applyToPosition(leoPosition), 1e-3));
+        }
+    }
+
+    // Other transforms are exact
+
+    {
+        EXPECT_TRUE(
+            EarthOrientation::GetTransform(gcrfSPtr_, temeSPtr_, startInstant_)
+                .applyToPosition(leoPosition)
+                .isNear(gcrfSPtr_->getTransformTo(temeSPtr_, startInstant_).applyToPosition(leoPosition), 1e-9)
+        );
+    }
+
+    {
+        EXPECT_THROW(
+            EarthOrientation::GetTransform(nullptr, itrfSPtr_, startInstant_), ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            EarthOrientation::GetTransform(gcrfSPtr_, itrfSPtr_, Instant::Undefined()),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
@@ -0,0 +1,81 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Velocity.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/LazyState.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Shared;
+
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Velocity;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+
+using ostk::astrodynamics::trajectory::State;
+using ostk::astrodynamics::trajectory::state::LazyState;
+
+class OpenSpaceToolkit_Astrodynamics_Trajectory_State_LazyState : public ::testing::Test
+{
+   protected:
+    const Instant instant_ = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+    const State state_ = {
+        instant_,
+        Position::Meters({7000000.0, 0.0, 0.0}, Frame::GCRF()),
+        Velocity::MetersPerSecond({0.0, 7546.0, 0.0}, Frame::GCRF()),
+    };
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_LazyState, Constructor)
+{
+    {
+        const LazyState lazyState = {this->state_, Frame::ITRF()};
+
+        EXPECT_EQ(this->state_, lazyState.accessSourceState());
+        EXPECT_EQ(this->instant_, lazyState.accessInstant());
+        EXPECT_EQ(Frame::ITRF(), lazyState.accessFrame());
+        EXPECT_FALSE(lazyState.isTransformComputed());
+    }
+
+    {
+        EXPECT_THROW(LazyState(State::Undefined(), Frame::ITRF()), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(LazyState(this->state_, nullptr), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_LazyState, AccessCoordinates)
+{
+    {
+        const LazyState lazyState = {this->state_, Frame::ITRF()};
+        const State referenceState = this->state_.inFrame(Frame::ITRF());
+
+        EXPECT_TRUE(lazyState.accessPositionCoordinates().isApprox(referenceState.accessPositionCoordinates(), 1e-12));
+        EXPECT_TRUE(lazyState.isTransformComputed());
+        EXPECT_TRUE(lazyState.accessVelocityCoordinates().isApprox(referenceState.accessVelocityCoordinates(), 1e-12));
+        EXPECT_EQ(referenceState, lazyState.accessState());
+    }
+
+    {
+        const LazyState lazyState = {this->state_, Frame::GCRF()};
+
+        EXPECT_EQ(Vector3d(this->state_.accessPositionCoordinates()), lazyState.accessPositionCoordinates());
+        EXPECT_EQ(Vector3d(this->state_.accessVelocityCoordinates()), lazyState.accessVelocityCoordinates());
+        EXPECT_EQ(this->state_, lazyState.accessState());
+        EXPECT_FALSE(lazyState.isTransformComputed());
+    }
+}
@@ -1,5 +1,7 @@
 /// Apache License 2.0
 
+#include <atomic>
+
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Tuple.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
@@ -7,22 +9,32 @@
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
 
+#include <OpenSpaceToolkit/Astrodynamics/EventCondition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/EventCondition/BooleanCondition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/EventCondition/InstantCondition.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/EventCondition/RealCondition.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateBroker.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/AngularVelocity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/AttitudeQuaternion.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/NumericalSolver.hpp>
 
 #include <Global.test.hpp>
 
 using ostk::core::container::Array;
 using ostk::core::container::Tuple;
+using ostk::core::type::Index;
 using ostk::core::type::Integer;
 using ostk::core::type::Real;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::Vector3d;
 using ostk::mathematics::object::VectorXd;
 
 using ostk::physics::coordinate::Frame;
@@ -31,11 +43,16 @@ using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 using ostk::physics::time::Scale;
 
+using ostk::astrodynamics::EventCondition;
+using ostk::astrodynamics::eventcondition::BooleanCondition;
 using ostk::astrodynamics::eventcondition::RealCondition;
 using ostk::astrodynamics::trajectory::State;
 using ostk::astrodynamics::trajectory::state::CoordinateBroker;
 using ostk::astrodynamics::trajectory::state::CoordinateSubset;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::AngularVelocity;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::AttitudeQuaternion;
 using ostk::astrodynamics::trajectory::state::NumericalSolver;
+using ostk::astrodynamics::trajectory::state::StateHistory;
 
 // Simple duration based condition
 
@@ -177,6 +194,36 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, Accessor
     {
         EXPECT_THROW(NumericalSolver::Undefined().accessObservedStates(), ostk::core::error::runtime::Undefined);
     }
+
+    {
+        EXPECT_TRUE(defaultRKD5_.accessObservedStateHistory().isEmpty());
+        EXPECT_THROW(NumericalSolver::Undefined().accessObservedStateHistory(), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, AccessObservedStateHistory)
+{
+    defaultRK54_.integrateTime(defaultState_, defaultState_.accessInstant() + defaultDuration_, systemOfEquations_);
+
+    const StateHistory& stateHistory = defaultRK54_.accessObservedStateHistory();
+    const Array<State>& observedStates = defaultRK54_.accessObservedStates();
+
+    ASSERT_FALSE(stateHistory.isEmpty());
+    ASSERT_EQ(stateHistory.getSize(), observedStates.getSize());
+
+    EXPECT_EQ(defaultState_, observedStates.accessFirst());
+
+    for (Index i = 0; i < stateHistory.getSize(); ++i)
+    {
+        EXPECT_EQ(observedStates[i], stateHistory.getStateAt(i));
+    }
+
+    // Observed states are rebuilt after a new integration
+
+    defaultRK54_.integrateTime(defaultState_, defaultState_.accessInstant() - defaultDuration_, systemOfEquations_);
+
+    ASSERT_EQ(defaultRK54_.accessObservedStateHistory().getSize(), defaultRK54_.accessObservedStates().getSize());
+    EXPECT_LT(defaultRK54_.accessObservedStates().accessLast().accessInstant(), defaultState_.accessInstant());
 }
 
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, IntegrateTime)
@@ -237,23 +284,297 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, Integrat
     }
 }
 
-TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, IntegrateTime_Conditions)
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, IntegrateTime_Array_DenseOutput)
 {
-    const State state = getStateVector(defaultStartInstant_);
+    const NumericalSolver numericalSolver = {
+        NumericalSolver::LogType::NoLog,
+        NumericalSolver::StepperType::RungeKuttaDopri5,
+        1e-3,
+        1.0e-12,
+        1.0e-12,
+    };
 
+    Size evaluationCount = 0;
+
+    const NumericalSolver::SystemOfEquationsWrapper countingSystemOfEquations =
+        [this, &evaluationCount](
+            const NumericalSolver::StateVector &x, NumericalSolver::StateVector &dxdt, const double t
+        ) -> void
     {
-        EXPECT_TRUE(defaultRKD5_.getObservedStates().isEmpty());
+        ++evaluationCount;
+        systemOfEquations_(x, dxdt, t);
+    };
+
+    for (const double direction : {1.0, -1.0})
+    {
+        // Fine output grid, denser than the natural steps of the stepper
+
+        Array<Instant> instants = Array<Instant>::Empty();
+
+        for (Size i = 0; i <= 10000; ++i)
+        {
+            instants.add(defaultStartInstant_ + Duration::Seconds(direction * 1e-3 * i));
+        }
+
+        evaluationCount = 0;
+
+        NumericalSolver solver = numericalSolver;
+
+        const Array<State> propagatedStates = solver.integrateTime(defaultState_, instants, countingSystemOfEquations);
+
+        ASSERT_EQ(instants.getSize(), propagatedStates.getSize());
+
+        for (Size i = 0; i < instants.getSize(); ++i)
+        {
+            EXPECT_EQ(instants[i], propagatedStates[i].accessInstant());
+        }
+
+        validatePropagatedStates(instants, propagatedStates, 2e-8);
+
+        // Stopping at every output instant would take at least one step, hence several evaluations, per instant
+
+        EXPECT_LT(evaluationCount, instants.getSize());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, IntegrateTime_Array_DenseOutput_Log)
+{
+    NumericalSolver numericalSolver = {
+        NumericalSolver::LogType::LogConstant,
+        NumericalSolver::StepperType::RungeKuttaDopri5,
+        5.0,
+        1.0e-12,
+        1.0e-12,
+    };
+
+    const Array<Instant> instants = {
+        defaultStartInstant_ + Duration::Seconds(10.0),
+        defaultStartInstant_ + Duration::Seconds(20.0),
+        defaultStartInstant_ + Duration::Seconds(30.0),
+    };
+
+    testing::internal::CaptureStdout();
+
+    const Array<State> propagatedStates = numericalSolver.integrateTime(defaultState_, instants, systemOfEquations_);
+
+    EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+
+    ASSERT_EQ(instants.getSize(), propagatedStates.getSize());
+
+    validatePropagatedStates(instants, propagatedStates, 2e-8);
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, Session)
+{
+    const Array<NumericalSolver> numericalSolvers = {
+        defaultRK54_,
+        defaultRKD5_,
+        NumericalSolver::Default(),
+        NumericalSolver::FixedStepSize(NumericalSolver::StepperType::RungeKutta4, 1e-3),
+    };
+
+    for (const NumericalSolver &numericalSolver : numericalSolvers)
+    {
+        NumericalSolver::Session session = {numericalSolver, defaultState_, systemOfEquations_};
+
+        EXPECT_EQ(defaultState_, session.accessState());
+
+        Array<Instant> instants = Array<Instant>::Empty();
+        Array<State> states = Array<State>::Empty();
+
+        for (Size i = 1; i <= 10; ++i)
+        {
+            const Instant instant = defaultStartInstant_ + Duration::Seconds(1.5 * i);
+
+            instants.add(instant);
+            states.add(session.integrateTime(instant));
+
+            EXPECT_EQ(instant, session.accessState().accessInstant());
+        }
+
+        validatePropagatedStates(instants, states, 2e-8);
+
+        EXPECT_THROW(session.integrateTime(defaultStartInstant_), ostk::core::error::RuntimeError);
+    }
+
+    {
+        EXPECT_THROW(
+            NumericalSolver::Session(defaultRK54_, State::Undefined(), systemOfEquations_),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, IntegrateEnsembleTime)
+{
+    const NumericalSolver::EnsembleSystemOfEquationsWrapper ensembleSystemOfEquations =
+        [](const MatrixXd &x, MatrixXd &dxdt, const double) -> void
+    {
+        dxdt.row(0) = x.row(1);
+        dxdt.row(1) = -x.row(0);
+    };
+
+    Array<State> states = Array<State>::Empty();
+
+    for (Size i = 0; i < 5; ++i)
+    {
+        VectorXd stateVector(2);
+        stateVector << 0.0, 1.0 + 0.5 * i;
+
+        states.add({defaultStartInstant_, stateVector, gcrfSPtr_, defaultCoordinateBroker_});
+    }
+
+    {
+        const NumericalSolver rk4 = NumericalSolver::FixedStepSize(NumericalSolver::StepperType::RungeKutta4, 1e-3);
+
+        for (NumericalSolver numericalSolver : {defaultRK54_, defaultRKD5_, rk4})
+        {
+            for (const Instant &endInstant :
+                 {defaultStartInstant_ + defaultDuration_, defaultStartInstant_ - defaultDuration_})
+            {
+                const Array<State> propagatedStates =
+                    numericalSolver.integrateEnsembleTime(states, endInstant, ensembleSystemOfEquations);
+
+                ASSERT_EQ(states.getSize(), propagatedStates.getSize());
+
+                const double duration = (endInstant - defaultStartInstant_).inSeconds();
+
+                // Validate the output against an analytical function
+
+                for (Size i = 0; i < states.getSize(); ++i)
+                {
+                    const double amplitude = states[i].accessCoordinates()[1];
+
+                    EXPECT_EQ(endInstant, propagatedStates[i].accessInstant());
+                    EXPECT_GT(
+                        2e-8 * amplitude,
+                        std::abs(propagatedStates[i].accessCoordinates()[0] - amplitude * std::sin(duration))
+                    );
+                    EXPECT_GT(
+                        2e-8 * amplitude,
+                        std::abs(propagatedStates[i].accessCoordinates()[1] - amplitude * std::cos(duration))
+                    );
+                }
+            }
+        }
+    }
+
+    {
+        EXPECT_TRUE(defaultRK54_
+                        .integrateEnsembleTime(
+                            Array<State>::Empty(), defaultStartInstant_ + defaultDuration_, ensembleSystemOfEquations
+                        )
+                        .isEmpty());
+    }
+
+    {
+        const State shiftedState = {
+            defaultStartInstant_ + Duration::Seconds(1.0), defaultStateVector_, gcrfSPtr_, defaultCoordinateBroker_
+        };
 
         EXPECT_THROW(
-            defaultRK54_.integrateTime(
+            defaultRK54_.integrateEnsembleTime(
+                {defaultState_, shiftedState}, defaultStartInstant_ + defaultDuration_, ensembleSystemOfEquations
+            ),
+            ostk::core::error::runtime::Wrong
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, IntegrateFixedSizeTime)
+{
+    // Three independent harmonic oscillators, positions followed by velocities
+
+    const NumericalSolver::FixedSizeSystemOfEquationsWrapper<6> fixedSizeSystemOfEquations =
+        [](const NumericalSolver::FixedSizeStateVector<6> &x,
+           NumericalSolver::FixedSizeStateVector<6> &dxdt,
+           const double) -> void
+    {
+        dxdt.head<3>() = x.tail<3>();
+        dxdt.tail<3>() = -x.head<3>();
+    };
+
+    const Shared<const CoordinateBroker> coordinateBrokerSPtr =
+        std::make_shared<CoordinateBroker>(CoordinateBroker({std::make_shared<CoordinateSubset>("Test", 6)}));
+
+    VectorXd stateVector(6);
+    stateVector << 0.0, 0.0, 0.0, 1.0, 2.0, 3.0;
+
+    const State state = {defaultStartInstant_, stateVector, gcrfSPtr_, coordinateBrokerSPtr};
+
+    {
+        NumericalSolver rk4 = NumericalSolver::FixedStepSize(NumericalSolver::StepperType::RungeKutta4, 1e-3);
+
+        for (NumericalSolver numericalSolver : {defaultRK54_, defaultRKD5_, rk4})
+        {
+            EXPECT_TRUE(numericalSolver.supportsFixedSizeIntegration());
+
+            for (const Instant &endInstant :
+                 {defaultStartInstant_ + defaultDuration_, defaultStartInstant_ - defaultDuration_})
+            {
+                const State propagatedState =
+                    numericalSolver.integrateFixedSizeTime<6>(state, endInstant, fixedSizeSystemOfEquations);
+
+                const double duration = (endInstant - defaultStartInstant_).inSeconds();
+
+                // Validate the output against an analytical function
+
+                EXPECT_EQ(endInstant, propagatedState.accessInstant());
+                EXPECT_EQ(state.accessCoordinateBroker(), propagatedState.accessCoordinateBroker());
+                EXPECT_FALSE(numericalSolver.getObservedStates().isEmpty());
+
+                for (Index i = 0; i < 3; ++i)
+                {
+                    const double amplitude = stateVector[3 + i];
+
+                    EXPECT_GT(
+                        2e-8 * amplitude,
+                        std::abs(propagatedState.accessCoordinates()[i] - amplitude * std::sin(duration))
+                    );
+                    EXPECT_GT(
+                        2e-8 * amplitude,
+                        std::abs(propagatedState.accessCoordinates()[3 + i] - amplitude * std::cos(duration))
+                    );
+                }
+            }
+
+            EXPECT_EQ(
                 state,
-                defaultStartInstant_,
-                systemOfEquations_,
-                InstantCondition(state.accessInstant(), RealCondition::Criterion::AnyCrossing)
+                numericalSolver.integrateFixedSizeTime<6>(state, defaultStartInstant_, fixedSizeSystemOfEquations)
+            );
+        }
+    }
+
+    {
+        EXPECT_THROW(
+            defaultRK54_.integrateFixedSizeTime<6>(
+                defaultState_, defaultStartInstant_ + defaultDuration_, fixedSizeSystemOfEquations
             ),
-            ostk::core::error::RuntimeError
+            ostk::core::error::runtime::Wrong
+        );
+    }
+
+    {
+        NumericalSolver numericalSolver =
+            NumericalSolver::LongHorizon(NumericalSolver::LongHorizonScheme::GaussLegendre, 1e-3);
+
+        EXPECT_FALSE(numericalSolver.supportsFixedSizeIntegration());
+        EXPECT_THROW(
+            numericalSolver.integrateFixedSizeTime<6>(
+                state, defaultStartInstant_ + defaultDuration_, fixedSizeSystemOfEquations
+            ),
+            ostk::core::error::runtime::Wrong
         );
     }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, IntegrateTime_Conditions)
+{
+    const State state = getStateVector(defaultStartInstant_);
+
+    {
+        EXPECT_TRUE(defaultRKD5_.getObservedStates().isEmpty());
+    }
 
     // trivial case, zero second integration
     {
@@ -370,31 +691,1006 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, Integrat
     }
 }
 
-TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, Undefined)
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, IntegrateTime_Conditions_RootSolving)
 {
-    {
-        EXPECT_NO_THROW(NumericalSolver::Undefined());
-    }
+    const State state = getStateVector(defaultStartInstant_);
+    const Instant endInstant = defaultStartInstant_ + defaultDuration_;
+
+    // Real conditions are solved on their value, boolean conditions are bisected
+
+    const NumericalSolver::ConditionSolution realConditionSolution =
+        defaultRKD5_.integrateTime(state, endInstant, systemOfEquations_, XCrossingCondition(0.9));
+
+    const NumericalSolver::ConditionSolution booleanConditionSolution = defaultRKD5_.integrateTime(
+        state,
+        endInstant,
+        systemOfEquations_,
+        BooleanCondition(
+            "test",
+            RealCondition::Criterion::PositiveCrossing,
+            [](const State &aState) -> bool
+            {
+                return aState.accessCoordinates()[0] > 0.9;
+            }
+        )
+    );
+
+    EXPECT_TRUE(realConditionSolution.conditionIsSatisfied);
+    EXPECT_TRUE(realConditionSolution.rootSolverHasConverged);
+    EXPECT_TRUE(booleanConditionSolution.conditionIsSatisfied);
+    EXPECT_TRUE(booleanConditionSolution.rootSolverHasConverged);
+
+    EXPECT_NEAR(
+        std::asin(0.9), (realConditionSolution.state.accessInstant() - defaultStartInstant_).inSeconds(), 1e-8
+    );
+    EXPECT_NEAR(
+        std::asin(0.9), (booleanConditionSolution.state.accessInstant() - defaultStartInstant_).inSeconds(), 1e-8
+    );
+
+    EXPECT_LT(realConditionSolution.iterationCount, booleanConditionSolution.iterationCount);
+    EXPECT_GT(10, realConditionSolution.iterationCount);
 }
 
-TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, Default)
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, IntegrateTime_Events)
 {
+    const State state = getStateVector(defaultStartInstant_);
+
+    // Every occurrence of every condition is recorded in a single pass, in integration order
+
     {
-        EXPECT_NO_THROW(NumericalSolver::Default());
+        const Instant endInstant = defaultStartInstant_ + defaultDuration_;
+
+        const Array<Shared<EventCondition>> eventConditions = {
+            std::make_shared<XCrossingCondition>(0.5),
+            std::make_shared<XCrossingCondition>(0.0),
+            std::make_shared<RealCondition>(
+                "test",
+                RealCondition::Criterion::StrictlyPositive,
+                [](const State &aState) -> Real
+                {
+                    return aState.accessCoordinates()[0];
+                },
+                0.9
+            ),
+        };
+
+        const double pi = M_PI;
+        const double asin05 = std::asin(0.5);
+        const double asin09 = std::asin(0.9);
+
+        const Array<Tuple<Index, double>> expectedOccurrences = {
+            {0, asin05},
+            {2, asin09},
+            {0, pi - asin05},
+            {1, pi},
+            {1, 2.0 * pi},
+            {0, 2.0 * pi + asin05},
+            {2, 2.0 * pi + asin09},
+            {0, 3.0 * pi - asin05},
+            {1, 3.0 * pi},
+        };
+
+        const NumericalSolver::EventsSolution eventsSolution =
+            defaultRKD5_.integrateTime(state, endInstant, systemOfEquations_, eventConditions);
+
+        ASSERT_EQ(expectedOccurrences.getSize(), eventsSolution.eventOccurrences.getSize());
+
+        for (Index i = 0; i < expectedOccurrences.getSize(); ++i)
+        {
+            const NumericalSolver::EventOccurrence &eventOccurrence = eventsSolution.eventOccurrences[i];
+            const Real propagatedTime = (eventOccurrence.state.accessInstant() - defaultStartInstant_).inSeconds();
+
+            EXPECT_EQ(std::get<0>(expectedOccurrences[i]), eventOccurrence.conditionIndex);
+            EXPECT_TRUE(eventOccurrence.rootSolverHasConverged);
+            EXPECT_NEAR(std::get<1>(expectedOccurrences[i]), propagatedTime, 1e-8);
+
+            EXPECT_NEAR(eventOccurrence.state.accessCoordinates()[0], std::sin(propagatedTime), 1e-9);
+            EXPECT_NEAR(eventOccurrence.state.accessCoordinates()[1], std::cos(propagatedTime), 1e-9);
+        }
+
+        // Conditions do not terminate the integration
+
+        EXPECT_EQ(endInstant, eventsSolution.state.accessInstant());
+        EXPECT_NEAR(eventsSolution.state.accessCoordinates()[0], std::sin(defaultDuration_.inSeconds()), 1e-9);
+        EXPECT_NEAR(eventsSolution.state.accessCoordinates()[1], std::cos(defaultDuration_.inSeconds()), 1e-9);
+
+        // The first occurrence matches the single condition integration
+
+        const NumericalSolver::ConditionSolution conditionSolution =
+            defaultRKD5_.integrateTime(state, endInstant, systemOfEquations_, XCrossingCondition(0.5));
+
+        EXPECT_NEAR(
+            (conditionSolution.state.accessInstant() - defaultStartInstant_).inSeconds(),
+            (eventsSolution.eventOccurrences[0].state.accessInstant() - defaultStartInstant_).inSeconds(),
+            1e-9
+        );
+    }
+
+    // Backward integration, with a Hermite dense output
+
+    {
+        const Instant endInstant = defaultStartInstant_ - defaultDuration_;
+
+        const Array<Shared<EventCondition>> eventConditions = {std::make_shared<XCrossingCondition>(0.5)};
+
+        const NumericalSolver::EventsSolution eventsSolution =
+            defaultRK54_.integrateTime(state, endInstant, systemOfEquations_, eventConditions);
+
+        const Array<double> expectedTimes = {
+            -M_PI - std::asin(0.5),
+            std::asin(0.5) - 2.0 * M_PI,
+            -3.0 * M_PI - std::asin(0.5),
+        };
+
+        ASSERT_EQ(expectedTimes.getSize(), eventsSolution.eventOccurrences.getSize());
+
+        for (Index i = 0; i < expectedTimes.getSize(); ++i)
+        {
+            EXPECT_NEAR(
+                expectedTimes[i],
+                (eventsSolution.eventOccurrences[i].state.accessInstant() - defaultStartInstant_).inSeconds(),
+                1e-7
+            );
+        }
+
+        EXPECT_EQ(endInstant, eventsSolution.state.accessInstant());
+    }
+
+    // No conditions, or zero duration
+
+    {
+        const Instant endInstant = defaultStartInstant_ + defaultDuration_;
+
+        const NumericalSolver::EventsSolution eventsSolution =
+            defaultRKD5_.integrateTime(state, endInstant, systemOfEquations_, Array<Shared<EventCondition>>::Empty());
+
+        EXPECT_TRUE(eventsSolution.eventOccurrences.isEmpty());
+        EXPECT_EQ(endInstant, eventsSolution.state.accessInstant());
+
+        const Array<Shared<EventCondition>> eventConditions = {std::make_shared<XCrossingCondition>(0.5)};
+
+        const NumericalSolver::EventsSolution zeroDurationEventsSolution =
+            defaultRKD5_.integrateTime(state, defaultStartInstant_, systemOfEquations_, eventConditions);
+
+        EXPECT_TRUE(zeroDurationEventsSolution.eventOccurrences.isEmpty());
+        EXPECT_EQ(state, zeroDurationEventsSolution.state);
+    }
+
+    {
+        const Instant endInstant = defaultStartInstant_ + defaultDuration_;
+        const Array<Shared<EventCondition>> eventConditions = {std::make_shared<XCrossingCondition>(0.5), nullptr};
+
+        EXPECT_THROW(
+            defaultRKD5_.integrateTime(state, endInstant, systemOfEquations_, eventConditions),
+            ostk::core::error::runtime::Undefined
+        );
     }
 }
 
-TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, FixedStepSize)
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, IntegrateTime_Conditions_TimeBased)
 {
+    const State state = getStateVector(defaultStartInstant_);
+
+    NumericalSolver numericalSolver = {
+        NumericalSolver::LogType::NoLog,
+        NumericalSolver::StepperType::RungeKuttaFehlberg78,
+        1e-3,
+        1.0e-15,
+        1.0e-15,
+    };
+
+    // Time based conditions are met at their target instant, without root solving
+
     {
-        EXPECT_NO_THROW(NumericalSolver::FixedStepSize(NumericalSolver::StepperType::RungeKutta4, 30.0));
+        const Array<Tuple<Duration, RealCondition::Criterion>> testCases = {
+            {defaultDuration_, RealCondition::Criterion::AnyCrossing},
+            {defaultDuration_, RealCondition::Criterion::PositiveCrossing},
+            {defaultDuration_, RealCondition::Criterion::StrictlyPositive},
+            {-defaultDuration_, RealCondition::Criterion::AnyCrossing},
+            {-defaultDuration_, RealCondition::Criterion::NegativeCrossing},
+        };
+
+        for (const auto &testCase : testCases)
+        {
+            const Duration duration = std::get<0>(testCase);
+            const RealCondition::Criterion criterion = std::get<1>(testCase);
+
+            const Instant endInstant = defaultStartInstant_ + duration;
+            const Instant targetInstant = defaultStartInstant_ + duration / 2.0;
+
+            const ostk::astrodynamics::eventcondition::InstantCondition instantCondition = {criterion, targetInstant};
+
+            RealCondition durationCondition = RealCondition::DurationCondition(criterion, duration / 2.0);
+            durationCondition.updateTarget(state);
+
+            for (const RealCondition &condition : {RealCondition(instantCondition), durationCondition})
+            {
+                EXPECT_TRUE(condition.getTargetInstant().isDefined());
+
+                const NumericalSolver::ConditionSolution conditionSolution =
+                    numericalSolver.integrateTime(state, endInstant, systemOfEquations_, condition);
+
+                const Real propagatedTime =
+                    (conditionSolution.state.accessInstant() - defaultStartInstant_).inSeconds();
+
+                EXPECT_TRUE(conditionSolution.conditionIsSatisfied);
+                EXPECT_TRUE(conditionSolution.rootSolverHasConverged);
+                EXPECT_EQ(0, conditionSolution.iterationCount);
+                EXPECT_NEAR((duration / 2.0).inSeconds(), propagatedTime, 1e-9);
+
+                EXPECT_NEAR(conditionSolution.state.accessCoordinates()[0], std::sin(propagatedTime), 1e-9);
+                EXPECT_NEAR(conditionSolution.state.accessCoordinates()[1], std::cos(propagatedTime), 1e-9);
+            }
+        }
     }
 
+    // Target instant beyond the end instant
+
     {
-        EXPECT_THROW(
-            NumericalSolver::FixedStepSize(NumericalSolver::StepperType::RungeKuttaDopri5, 30.0),
-            ostk::core::error::RuntimeError
+        const Instant endInstant = defaultStartInstant_ + defaultDuration_;
+
+        const NumericalSolver::ConditionSolution conditionSolution = numericalSolver.integrateTime(
+            state,
+            endInstant,
+            systemOfEquations_,
+            ostk::astrodynamics::eventcondition::InstantCondition(
+                RealCondition::Criterion::AnyCrossing, endInstant + defaultDuration_
+            )
         );
+
+        EXPECT_FALSE(conditionSolution.conditionIsSatisfied);
+        EXPECT_EQ(endInstant, conditionSolution.state.accessInstant());
+        EXPECT_NEAR(conditionSolution.state.accessCoordinates()[0], std::sin(defaultDuration_.inSeconds()), 1e-9);
+    }
+
+    // Conditions that do not only depend on time have no target instant
+
+    {
+        EXPECT_FALSE(XCrossingCondition(0.9).getTargetInstant().isDefined());
+        EXPECT_FALSE(InstantCondition(defaultStartInstant_, RealCondition::Criterion::AnyCrossing)
+                         .getTargetInstant()
+                         .isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, SetCancellationFlag)
+{
+    const State state = getStateVector(defaultStartInstant_);
+    const Instant endInstant = defaultStartInstant_ + defaultDuration_;
+
+    const Shared<std::atomic<bool>> cancellationFlagSPtr = std::make_shared<std::atomic<bool>>(false);
+
+    NumericalSolver numericalSolver = defaultRK54_;
+    numericalSolver.setCancellationFlag(cancellationFlagSPtr);
+
+    // A lowered flag does not affect the integration
+
+    {
+        const State finalState = numericalSolver.integrateTime(state, endInstant, systemOfEquations_);
+
+        EXPECT_EQ(defaultRK54_.integrateTime(state, endInstant, systemOfEquations_), finalState);
+    }
+
+    // The flag is checked within the integration, and shared by copies of the solver
+
+    {
+        Size evaluationCount = 0;
+
+        const RealCondition cancellingCondition = {
+            "Cancelling",
+            RealCondition::Criterion::AnyCrossing,
+            [&evaluationCount, &cancellationFlagSPtr](const State &aState) -> Real
+            {
+                if (++evaluationCount == 10)
+                {
+                    cancellationFlagSPtr->store(true);
+                }
+
+                return aState.accessCoordinates()[0];
+            },
+            2.0,
+        };
+
+        NumericalSolver numericalSolverCopy = numericalSolver;
+
+        EXPECT_THROW(
+            numericalSolverCopy.integrateTime(state, endInstant, systemOfEquations_, cancellingCondition),
+            ostk::core::error::RuntimeError
+        );
+        EXPECT_LE(10, evaluationCount);
+
+        EXPECT_THROW(
+            numericalSolver.integrateTime(state, Array<Instant> {endInstant}, systemOfEquations_),
+            ostk::core::error::RuntimeError
+        );
+    }
+
+    {
+        numericalSolver.setCancellationFlag(nullptr);
+
+        EXPECT_NO_THROW(numericalSolver.integrateTime(state, endInstant, systemOfEquations_));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, SetStateBatchLogger)
+{
+    const State state = getStateVector(defaultStartInstant_);
+    const Instant endInstant = defaultStartInstant_ + defaultDuration_;
+
+    // Observed states (but the initial one) are delivered in order, by full batches but for the last one
+
+    for (const bool isAsynchronous : {false, true})
+    {
+        Array<Array<State>> stateBatches = Array<Array<State>>::Empty();
+
+        NumericalSolver numericalSolver = defaultRK54_;
+        numericalSolver.setStateBatchLogger(
+            [&stateBatches](const Array<State> &aStateArray) -> void
+            {
+                stateBatches.add(aStateArray);
+            },
+            16,
+            isAsynchronous
+        );
+
+        const NumericalSolver::ConditionSolution conditionSolution =
+            numericalSolver.integrateTime(state, endInstant, systemOfEquations_, XCrossingCondition(2.0));
+
+        numericalSolver.flushStateBatchLogger();
+
+        const Array<State> &observedStates = numericalSolver.accessObservedStates();
+
+        ASSERT_LT(16, observedStates.getSize());
+        ASSERT_FALSE(stateBatches.isEmpty());
+
+        Array<State> loggedStates = Array<State>::Empty();
+
+        for (Index i = 0; i < stateBatches.getSize(); ++i)
+        {
+            if (i + 1 < stateBatches.getSize())
+            {
+                EXPECT_EQ(16, stateBatches[i].getSize());
+            }
+            else
+            {
+                EXPECT_GE(16, stateBatches[i].getSize());
+            }
+
+            loggedStates.add(stateBatches[i]);
+        }
+
+        ASSERT_EQ(observedStates.getSize() - 1, loggedStates.getSize());
+
+        for (Index i = 0; i < loggedStates.getSize(); ++i)
+        {
+            EXPECT_EQ(observedStates[i + 1], loggedStates[i]);
+        }
+
+        // The logger is shared by copies of the solver
+
+        const Size batchCount = stateBatches.getSize();
+
+        NumericalSolver numericalSolverCopy = numericalSolver.getCallCopy();
+        numericalSolverCopy.integrateTime(state, endInstant, systemOfEquations_, XCrossingCondition(2.0));
+        numericalSolverCopy.flushStateBatchLogger();
+
+        EXPECT_EQ(2 * batchCount, stateBatches.getSize());
+
+        // Batch logging does not change the solution
+
+        EXPECT_EQ(
+            defaultRK54_.integrateTime(state, endInstant, systemOfEquations_, XCrossingCondition(2.0)).state,
+            conditionSolution.state
+        );
+    }
+
+    // Failures of the logger are rethrown by the integration, or by the flush when asynchronous
+
+    {
+        const auto failingStateBatchLogger = [](const Array<State> &) -> void
+        {
+            throw ostk::core::error::RuntimeError("Logger failure.");
+        };
+
+        NumericalSolver numericalSolver = defaultRK54_;
+
+        numericalSolver.setStateBatchLogger(failingStateBatchLogger, 16, false);
+
+        EXPECT_THROW(
+            numericalSolver.integrateTime(state, endInstant, systemOfEquations_, XCrossingCondition(2.0)),
+            ostk::core::error::RuntimeError
+        );
+
+        numericalSolver.setStateBatchLogger(failingStateBatchLogger, 16, true);
+
+        EXPECT_NO_THROW(numericalSolver.integrateTime(state, endInstant, systemOfEquations_, XCrossingCondition(2.0)));
+        EXPECT_THROW(numericalSolver.flushStateBatchLogger(), ostk::core::error::RuntimeError);
+        EXPECT_NO_THROW(numericalSolver.flushStateBatchLogger());
+    }
+
+    {
+        NumericalSolver numericalSolver = defaultRK54_;
+
+        EXPECT_THROW(
+            numericalSolver.setStateBatchLogger(
+                [](const Array<State> &) -> void
+                {
+                },
+                0
+            ),
+            ostk::core::error::runtime::Wrong
+        );
+
+        EXPECT_NO_THROW(numericalSolver.setStateBatchLogger(nullptr, 0));
+        EXPECT_NO_THROW(numericalSolver.flushStateBatchLogger());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, SetInitialTimeStep)
+{
+    const State state = getStateVector(defaultStartInstant_);
+    const Instant endInstant = defaultStartInstant_ + defaultDuration_;
+
+    Size evaluationCount = 0;
+
+    const NumericalSolver::SystemOfEquationsWrapper countingSystemOfEquations =
+        [this, &evaluationCount](
+            const NumericalSolver::StateVector &x, NumericalSolver::StateVector &dxdt, const double t
+        ) -> void
+    {
+        ++evaluationCount;
+        systemOfEquations_(x, dxdt, t);
+    };
+
+    {
+        NumericalSolver numericalSolver = defaultRKD5_;
+
+        EXPECT_FALSE(numericalSolver.getInitialTimeStep().isDefined());
+        EXPECT_FALSE(numericalSolver.getFinalTimeStep().isDefined());
+
+        EXPECT_THROW(numericalSolver.setInitialTimeStep(0.0), ostk::core::error::runtime::Wrong);
+
+        numericalSolver.setInitialTimeStep(1.0);
+
+        EXPECT_EQ(1.0, numericalSolver.getInitialTimeStep());
+        EXPECT_EQ(1.0, numericalSolver.getCallCopy().getInitialTimeStep());
+
+        numericalSolver.setInitialTimeStep(Real::Undefined());
+
+        EXPECT_FALSE(numericalSolver.getInitialTimeStep().isDefined());
+    }
+
+    // Starting with the final time step of a previous integration saves the ramp-up from a small configured step
+
+    for (const NumericalSolver::StepperType &stepperType :
+         {NumericalSolver::StepperType::RungeKuttaDopri5, NumericalSolver::StepperType::RungeKuttaCashKarp54})
+    {
+        NumericalSolver numericalSolver = {NumericalSolver::LogType::NoLog, stepperType, 1.0e-6, 1.0e-12, 1.0e-12};
+
+        evaluationCount = 0;
+        const NumericalSolver::ConditionSolution coldConditionSolution =
+            numericalSolver.integrateTime(state, endInstant, countingSystemOfEquations, XCrossingCondition(0.5));
+        const Size coldEvaluationCount = evaluationCount;
+
+        const Real finalTimeStep = numericalSolver.getFinalTimeStep();
+
+        ASSERT_TRUE(finalTimeStep.isDefined());
+        EXPECT_LT(1.0e-6, finalTimeStep);
+
+        numericalSolver.setInitialTimeStep(finalTimeStep);
+
+        evaluationCount = 0;
+        const NumericalSolver::ConditionSolution warmConditionSolution =
+            numericalSolver.integrateTime(state, endInstant, countingSystemOfEquations, XCrossingCondition(0.5));
+
+        EXPECT_GT(coldEvaluationCount, evaluationCount);
+
+        EXPECT_TRUE(warmConditionSolution.conditionIsSatisfied);
+        EXPECT_NEAR(
+            (coldConditionSolution.state.accessInstant() - defaultStartInstant_).inSeconds(),
+            (warmConditionSolution.state.accessInstant() - defaultStartInstant_).inSeconds(),
+            1e-9
+        );
+
+        // Integrations to an instant are warm-started as well
+
+        const State propagatedState = numericalSolver.integrateTime(state, endInstant, systemOfEquations_);
+
+        EXPECT_TRUE(numericalSolver.getFinalTimeStep().isDefined());
+        EXPECT_GT(1e-8, std::abs(propagatedState.accessCoordinates()[0] - std::sin(defaultDuration_.inSeconds())));
+        EXPECT_GT(1e-8, std::abs(propagatedState.accessCoordinates()[1] - std::cos(defaultDuration_.inSeconds())));
+    }
+
+    // Fixed step steppers keep their configured step
+
+    {
+        NumericalSolver numericalSolver =
+            NumericalSolver::FixedStepSize(NumericalSolver::StepperType::RungeKutta4, 1e-2);
+
+        const State referenceState = numericalSolver.integrateTime(state, endInstant, systemOfEquations_);
+
+        numericalSolver.setInitialTimeStep(1.0);
+
+        EXPECT_EQ(referenceState, numericalSolver.integrateTime(state, endInstant, systemOfEquations_));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, Statistics)
+{
+    const State state = getStateVector(defaultStartInstant_);
+    const Instant endInstant = defaultStartInstant_ + defaultDuration_;
+
+    Size evaluationCount = 0;
+
+    const NumericalSolver::SystemOfEquationsWrapper countingSystemOfEquations =
+        [this, &evaluationCount](
+            const NumericalSolver::StateVector &x, NumericalSolver::StateVector &dxdt, const double t
+        ) -> void
+    {
+        ++evaluationCount;
+        systemOfEquations_(x, dxdt, t);
+    };
+
+    {
+        NumericalSolver numericalSolver = defaultRK54_;
+
+        EXPECT_FALSE(numericalSolver.isStatisticsEnabled());
+        EXPECT_THROW(numericalSolver.getStatistics(), ostk::core::error::RuntimeError);
+    }
+
+    {
+        NumericalSolver numericalSolver = defaultRK54_;
+        numericalSolver.enableStatistics();
+
+        EXPECT_TRUE(numericalSolver.isStatisticsEnabled());
+        EXPECT_EQ(0, numericalSolver.getStatistics().evaluationCount);
+        EXPECT_FALSE(numericalSolver.getStatistics().getMeanStepDuration().isDefined());
+
+        evaluationCount = 0;
+        numericalSolver.integrateTime(state, endInstant, countingSystemOfEquations);
+
+        const NumericalSolver::Statistics statistics = numericalSolver.getStatistics();
+
+        EXPECT_EQ(evaluationCount, statistics.evaluationCount);
+        EXPECT_LT(0, statistics.stepCount);
+        EXPECT_EQ(statistics.evaluationCount, 6 * (statistics.stepCount + statistics.rejectedStepCount));
+        EXPECT_LE(statistics.minimumStepDuration, statistics.getMeanStepDuration());
+        EXPECT_LE(statistics.getMeanStepDuration(), statistics.maximumStepDuration);
+        EXPECT_NEAR(defaultDuration_.inSeconds(), statistics.cumulativeStepDuration.inSeconds(), 1e-9);
+
+        // Statistics accumulate over integrations, and are shared by copies of the solver
+
+        NumericalSolver numericalSolverCopy = numericalSolver;
+
+        evaluationCount = 0;
+        numericalSolverCopy.integrateTime(state, endInstant, countingSystemOfEquations, XCrossingCondition(0.9));
+
+        EXPECT_EQ(statistics.evaluationCount + evaluationCount, numericalSolver.getStatistics().evaluationCount);
+        EXPECT_LT(statistics.stepCount, numericalSolver.getStatistics().stepCount);
+
+        numericalSolver.resetStatistics();
+
+        EXPECT_EQ(0, numericalSolverCopy.getStatistics().evaluationCount);
+        EXPECT_EQ(0, numericalSolverCopy.getStatistics().stepCount);
+
+        numericalSolver.disableStatistics();
+
+        EXPECT_FALSE(numericalSolver.isStatisticsEnabled());
+        EXPECT_TRUE(numericalSolverCopy.isStatisticsEnabled());
+    }
+
+    // Dense, Hermite and fixed size integrations
+
+    {
+        NumericalSolver numericalSolver = defaultRKD5_;
+        numericalSolver.enableStatistics();
+
+        evaluationCount = 0;
+        numericalSolver.integrateTime(state, Array<Instant> {endInstant}, countingSystemOfEquations);
+
+        const NumericalSolver::Statistics statistics = numericalSolver.getStatistics();
+
+        EXPECT_EQ(evaluationCount, statistics.evaluationCount);
+        EXPECT_LT(0, statistics.stepCount);
+        EXPECT_LE(defaultDuration_, statistics.cumulativeStepDuration);
+    }
+
+    {
+        NumericalSolver numericalSolver =
+            NumericalSolver::FixedStepSize(NumericalSolver::StepperType::RungeKutta4, 1e-2);
+        numericalSolver.enableStatistics();
+
+        numericalSolver.integrateTime(state, endInstant, systemOfEquations_, XCrossingCondition(0.9));
+
+        const NumericalSolver::Statistics statistics = numericalSolver.getStatistics();
+
+        EXPECT_LT(0, statistics.stepCount);
+        EXPECT_EQ(0, statistics.rejectedStepCount);
+        EXPECT_NEAR(1e-2, statistics.minimumStepDuration.inSeconds(), 1e-12);
+        EXPECT_NEAR(1e-2, statistics.maximumStepDuration.inSeconds(), 1e-12);
+    }
+
+    {
+        NumericalSolver numericalSolver = defaultRK54_;
+        numericalSolver.enableStatistics();
+
+        const NumericalSolver::FixedSizeSystemOfEquationsWrapper<6> fixedSizeSystemOfEquations =
+            [](const NumericalSolver::FixedSizeStateVector<6> &x,
+               NumericalSolver::FixedSizeStateVector<6> &dxdt,
+               const double) -> void
+        {
+            dxdt.head<3>() = x.tail<3>();
+            dxdt.tail<3>() = -x.head<3>();
+        };
+
+        VectorXd stateVector(6);
+        stateVector << 0.0, 0.0, 0.0, 1.0, 2.0, 3.0;
+
+        const State fixedSizeState = {
+            defaultStartInstant_,
+            stateVector,
+            gcrfSPtr_,
+            std::make_shared<CoordinateBroker>(CoordinateBroker({std::make_shared<CoordinateSubset>("Test", 6)})),
+        };
+
+        numericalSolver.integrateFixedSizeTime<6>(fixedSizeState, endInstant, fixedSizeSystemOfEquations);
+
+        const NumericalSolver::Statistics statistics = numericalSolver.getStatistics();
+
+        EXPECT_EQ(numericalSolver.getObservedStates().getSize() - 1, statistics.stepCount);
+        EXPECT_EQ(statistics.evaluationCount, 6 * (statistics.stepCount + statistics.rejectedStepCount));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, GetCallCopy)
+{
+    const State state = getStateVector(defaultStartInstant_);
+    const Instant endInstant = defaultStartInstant_ + defaultDuration_;
+
+    NumericalSolver numericalSolver = defaultRK54_;
+    numericalSolver.enableStatistics();
+    numericalSolver.integrateTime(state, endInstant, systemOfEquations_);
+
+    const Size observedStateCount = numericalSolver.accessObservedStates().getSize();
+    const Size evaluationCount = numericalSolver.getStatistics().evaluationCount;
+
+    // Settings are copied, observed states are not
+
+    NumericalSolver callNumericalSolver = numericalSolver.getCallCopy();
+
+    {
+        EXPECT_EQ(numericalSolver.getStepperType(), callNumericalSolver.getStepperType());
+        EXPECT_EQ(numericalSolver.getTimeStep(), callNumericalSolver.getTimeStep());
+        EXPECT_EQ(numericalSolver.getRelativeTolerance(), callNumericalSolver.getRelativeTolerance());
+        EXPECT_EQ(numericalSolver.getAbsoluteTolerance(), callNumericalSolver.getAbsoluteTolerance());
+        EXPECT_EQ(numericalSolver.getLongHorizonScheme(), callNumericalSolver.getLongHorizonScheme());
+
+        EXPECT_LT(0, observedStateCount);
+        EXPECT_TRUE(callNumericalSolver.accessObservedStates().isEmpty());
+    }
+
+    // Integrating with the copy leaves the observed states of the solver untouched, and accumulates its statistics
+
+    {
+        NumericalSolver referenceNumericalSolver = defaultRK54_;
+
+        EXPECT_EQ(
+            referenceNumericalSolver.integrateTime(state, endInstant, systemOfEquations_),
+            callNumericalSolver.integrateTime(state, endInstant, systemOfEquations_)
+        );
+
+        EXPECT_EQ(observedStateCount, numericalSolver.accessObservedStates().getSize());
+        EXPECT_EQ(observedStateCount, callNumericalSolver.accessObservedStates().getSize());
+        EXPECT_EQ(2 * evaluationCount, numericalSolver.getStatistics().evaluationCount);
+    }
+
+    {
+        const NumericalSolver longHorizonNumericalSolver =
+            NumericalSolver::LongHorizon(NumericalSolver::LongHorizonScheme::GaussLegendre, 1e-2);
+
+        EXPECT_EQ(
+            NumericalSolver::LongHorizonScheme::GaussLegendre,
+            longHorizonNumericalSolver.getCallCopy().getLongHorizonScheme()
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, IntegrateTime_Conditions_HermiteDenseOutput)
+{
+    const State state = getStateVector(defaultStartInstant_);
+
+    const Array<NumericalSolver> numericalSolvers = {
+        NumericalSolver::FixedStepSize(NumericalSolver::StepperType::RungeKutta4, 1e-3),
+        defaultRK54_,
+        {
+            NumericalSolver::LogType::NoLog,
+            NumericalSolver::StepperType::RungeKuttaFehlberg78,
+            1e-3,
+            1.0e-15,
+            1.0e-15,
+        },
+    };
+
+    for (NumericalSolver numericalSolver : numericalSolvers)
+    {
+        for (const Duration &duration : Array<Duration> {defaultDuration_, -defaultDuration_})
+        {
+            const Instant endInstant = defaultStartInstant_ + duration;
+
+            {
+                const NumericalSolver::ConditionSolution conditionSolution = numericalSolver.integrateTime(
+                    state,
+                    endInstant,
+                    systemOfEquations_,
+                    InstantCondition((endInstant + duration / 2.0), RealCondition::Criterion::AnyCrossing)
+                );
+
+                const NumericalSolver::StateVector propagatedStateVector = conditionSolution.state.accessCoordinates();
+
+                EXPECT_LT((conditionSolution.state.accessInstant() - endInstant).inSeconds(), 1e-12);
+                EXPECT_FALSE(conditionSolution.conditionIsSatisfied);
+                EXPECT_NEAR(propagatedStateVector[0], std::sin(duration.inSeconds()), 1e-9);
+                EXPECT_NEAR(propagatedStateVector[1], std::cos(duration.inSeconds()), 1e-9);
+            }
+
+            {
+                const Real target = duration > Duration::Zero() ? 0.9 : -0.9;
+
+                const NumericalSolver::ConditionSolution conditionSolution =
+                    numericalSolver.integrateTime(state, endInstant, systemOfEquations_, XCrossingCondition(target));
+
+                const NumericalSolver::StateVector propagatedStateVector = conditionSolution.state.accessCoordinates();
+                const Real propagatedTime =
+                    (conditionSolution.state.accessInstant() - defaultStartInstant_).inSeconds();
+
+                EXPECT_TRUE(conditionSolution.conditionIsSatisfied);
+                EXPECT_TRUE(conditionSolution.rootSolverHasConverged);
+                EXPECT_NEAR(target, propagatedStateVector[0], 1e-6);
+
+                // Validate the output against an analytical function
+
+                EXPECT_NEAR(propagatedStateVector[0], std::sin(propagatedTime), 1e-9);
+                EXPECT_NEAR(propagatedStateVector[1], std::cos(propagatedTime), 1e-9);
+                EXPECT_FALSE(numericalSolver.getObservedStates().isEmpty());
+            }
+        }
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, Undefined)
+{
+    {
+        EXPECT_NO_THROW(NumericalSolver::Undefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, Default)
+{
+    {
+        EXPECT_NO_THROW(NumericalSolver::Default());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, FixedStepSize)
+{
+    {
+        EXPECT_NO_THROW(NumericalSolver::FixedStepSize(NumericalSolver::StepperType::RungeKutta4, 30.0));
+    }
+
+    {
+        EXPECT_THROW(
+            NumericalSolver::FixedStepSize(NumericalSolver::StepperType::RungeKuttaDopri5, 30.0),
+            ostk::core::error::RuntimeError
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, LongHorizon)
+{
+    {
+        const NumericalSolver numericalSolver =
+            NumericalSolver::LongHorizon(NumericalSolver::LongHorizonScheme::AdamsBashforthMoulton, 30.0);
+
+        EXPECT_TRUE(numericalSolver.isDefined());
+        EXPECT_EQ(NumericalSolver::LongHorizonScheme::AdamsBashforthMoulton, numericalSolver.getLongHorizonScheme());
+        EXPECT_EQ(30.0, numericalSolver.getTimeStep());
+    }
+
+    {
+        EXPECT_EQ(NumericalSolver::LongHorizonScheme::Undefined, defaultRKD5_.getLongHorizonScheme());
+    }
+
+    {
+        EXPECT_THROW(
+            NumericalSolver::LongHorizon(NumericalSolver::LongHorizonScheme::Undefined, 30.0),
+            ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            NumericalSolver::LongHorizon(NumericalSolver::LongHorizonScheme::GaussLegendre, -30.0),
+            ostk::core::error::runtime::Wrong
+        );
+    }
+
+    {
+        EXPECT_EQ(
+            "AdamsBashforthMoulton",
+            NumericalSolver::StringFromLongHorizonScheme(NumericalSolver::LongHorizonScheme::AdamsBashforthMoulton)
+        );
+        EXPECT_EQ(
+            "GaussLegendre",
+            NumericalSolver::StringFromLongHorizonScheme(NumericalSolver::LongHorizonScheme::GaussLegendre)
+        );
+        EXPECT_EQ(
+            "RungeKuttaMuntheKaas",
+            NumericalSolver::StringFromLongHorizonScheme(NumericalSolver::LongHorizonScheme::RungeKuttaMuntheKaas)
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, IntegrateTime_LongHorizon)
+{
+    const Array<NumericalSolver::LongHorizonScheme> longHorizonSchemes = {
+        NumericalSolver::LongHorizonScheme::AdamsBashforthMoulton,
+        NumericalSolver::LongHorizonScheme::GaussLegendre,
+        NumericalSolver::LongHorizonScheme::RungeKuttaMuntheKaas,
+    };
+
+    for (const NumericalSolver::LongHorizonScheme &longHorizonScheme : longHorizonSchemes)
+    {
+        NumericalSolver numericalSolver = NumericalSolver::LongHorizon(longHorizonScheme, 1e-2);
+
+        {
+            const Instant endInstant = defaultStartInstant_ + defaultDuration_;
+
+            const State state = numericalSolver.integrateTime(defaultState_, endInstant, systemOfEquations_);
+
+            EXPECT_EQ(endInstant, state.accessInstant());
+            validatePropagatedStates({endInstant}, {state}, 1e-8);
+        }
+
+        {
+            // Output instants do not fall on steps
+
+            const Array<Instant> instants = {
+                defaultStartInstant_ + Duration::Seconds(0.333),
+                defaultStartInstant_ + Duration::Seconds(5.0),
+                defaultStartInstant_ + Duration::Seconds(9.999),
+            };
+
+            const Array<State> states = numericalSolver.integrateTime(defaultState_, instants, systemOfEquations_);
+
+            validatePropagatedStates(instants, states, 1e-8);
+        }
+
+        {
+            const Instant endInstant = defaultStartInstant_ + defaultDuration_;
+
+            const NumericalSolver::ConditionSolution conditionSolution =
+                numericalSolver.integrateTime(defaultState_, endInstant, systemOfEquations_, XCrossingCondition(0.9));
+
+            EXPECT_TRUE(conditionSolution.conditionIsSatisfied);
+            EXPECT_NEAR(
+                std::asin(0.9), (conditionSolution.state.accessInstant() - defaultStartInstant_).inSeconds(), 1e-7
+            );
+        }
+
+        {
+            EXPECT_THROW(
+                NumericalSolver::Session(numericalSolver, defaultState_, systemOfEquations_),
+                ostk::core::error::runtime::ToBeImplemented
+            );
+        }
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, IntegrateTime_LongHorizon_Energy)
+{
+    // Over many periods with large steps, the symplectic scheme keeps the energy while Runge-Kutta 4 drifts
+
+    const Instant endInstant = defaultStartInstant_ + Duration::Seconds(1.0e4);
+
+    NumericalSolver gaussLegendre =
+        NumericalSolver::LongHorizon(NumericalSolver::LongHorizonScheme::GaussLegendre, 0.5);
+    NumericalSolver rungeKutta4 = NumericalSolver::FixedStepSize(NumericalSolver::StepperType::RungeKutta4, 0.5);
+
+    const VectorXd gaussLegendreStateVector =
+        gaussLegendre.integrateTime(defaultState_, endInstant, systemOfEquations_).accessCoordinates();
+    const VectorXd rungeKutta4StateVector =
+        rungeKutta4.integrateTime(defaultState_, endInstant, systemOfEquations_).accessCoordinates();
+
+    EXPECT_GT(1e-8, std::abs(gaussLegendreStateVector.squaredNorm() - 1.0));
+    EXPECT_LT(1e-3, std::abs(rungeKutta4StateVector.squaredNorm() - 1.0));
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_NumericalSolver, IntegrateTime_LongHorizon_Attitude)
+{
+    // Attitude quaternion (XYZS) and angular velocity (in the reference frame), with q' = 1/2 w q
+
+    const Vector3d angularAcceleration = {0.02, -0.01, 0.03};
+
+    const auto getSystemOfEquations = [](const Vector3d &anAngularAcceleration)
+    {
+        return [anAngularAcceleration](
+                   const NumericalSolver::StateVector &x, NumericalSolver::StateVector &dxdt, const double
+               ) -> void
+        {
+            const Eigen::Quaterniond quaternion = Eigen::Quaterniond(Eigen::Vector4d(x.segment<4>(0)));
+            const Eigen::Quaterniond angularVelocity = Eigen::Quaterniond(0.0, x[4], x[5], x[6]);
+
+            dxdt.resize(x.size());
+            dxdt.segment<4>(0) = 0.5 * (angularVelocity * quaternion).coeffs();
+            dxdt.segment<3>(4) = anAngularAcceleration;
+        };
+    };
+
+    VectorXd attitudeStateVector(7);
+    attitudeStateVector << 0.0, 0.0, 0.0, 1.0, 0.6, 0.0, 0.8;
+
+    const State attitudeState = {
+        defaultStartInstant_,
+        attitudeStateVector,
+        gcrfSPtr_,
+        std::make_shared<CoordinateBroker>(
+            CoordinateBroker({AttitudeQuaternion::Default(), AngularVelocity::Default()})
+        ),
+    };
+
+    const Instant endInstant = defaultStartInstant_ + Duration::Seconds(100.0);
+
+    NumericalSolver muntheKaas =
+        NumericalSolver::LongHorizon(NumericalSolver::LongHorizonScheme::RungeKuttaMuntheKaas, 0.5);
+    NumericalSolver rungeKutta4 = NumericalSolver::FixedStepSize(NumericalSolver::StepperType::RungeKutta4, 0.5);
+
+    // With a constant angular velocity, large steps follow the rotation exactly, while Runge-Kutta 4 drifts off the
+    // unit sphere
+
+    {
+        const NumericalSolver::SystemOfEquationsWrapper systemOfEquations = getSystemOfEquations(Vector3d::Zero());
+
+        const VectorXd muntheKaasStateVector =
+            muntheKaas.integrateTime(attitudeState, endInstant, systemOfEquations).accessCoordinates();
+        const VectorXd rungeKutta4StateVector =
+            rungeKutta4.integrateTime(attitudeState, endInstant, systemOfEquations).accessCoordinates();
+
+        const VectorXd expectedQuaternion =
+            Eigen::Quaterniond(Eigen::AngleAxisd(100.0, Vector3d(0.6, 0.0, 0.8))).coeffs();
+
+        EXPECT_GT(1e-12, std::abs(muntheKaasStateVector.segment<4>(0).norm() - 1.0));
+        EXPECT_GT(1e-10, (muntheKaasStateVector.segment<4>(0) - expectedQuaternion).norm());
+        EXPECT_LT(1e-4, std::abs(rungeKutta4StateVector.segment<4>(0).norm() - 1.0));
+
+        // Output instants do not fall on steps, and are reached by a partial step
+
+        const Array<State> states = muntheKaas.integrateTime(
+            attitudeState,
+            {defaultStartInstant_ + Duration::Seconds(0.3), defaultStartInstant_ + Duration::Seconds(10.1)},
+            systemOfEquations
+        );
+
+        EXPECT_GT(1e-12, std::abs(states[0].accessCoordinates().segment<4>(0).norm() - 1.0));
+        EXPECT_GT(1e-12, std::abs(states[1].accessCoordinates().segment<4>(0).norm() - 1.0));
+    }
+
+    // With an angular acceleration, large steps stay accurate and on the unit sphere
+
+    {
+        const NumericalSolver::SystemOfEquationsWrapper systemOfEquations = getSystemOfEquations(angularAcceleration);
+
+        NumericalSolver referenceNumericalSolver = {
+            NumericalSolver::LogType::NoLog,
+            NumericalSolver::StepperType::RungeKuttaCashKarp54,
+            1e-3,
+            1.0e-13,
+            1.0e-13,
+        };
+
+        const VectorXd referenceStateVector =
+            referenceNumericalSolver.integrateTime(attitudeState, endInstant, systemOfEquations).accessCoordinates();
+        const VectorXd muntheKaasStateVector =
+            muntheKaas.integrateTime(attitudeState, endInstant, systemOfEquations).accessCoordinates();
+
+        EXPECT_GT(1e-12, std::abs(muntheKaasStateVector.segment<4>(0).norm() - 1.0));
+        EXPECT_GT(1e-5, (muntheKaasStateVector - referenceStateVector).norm());
     }
 }
 
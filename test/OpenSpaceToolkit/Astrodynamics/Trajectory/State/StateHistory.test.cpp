@@ -0,0 +1,159 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateBroker.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianPosition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianVelocity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/StateHistory.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::VectorXd;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+
+using ostk::astrodynamics::trajectory::State;
+using ostk::astrodynamics::trajectory::state::CoordinateBroker;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianPosition;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianVelocity;
+using ostk::astrodynamics::trajectory::state::StateHistory;
+
+class OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateHistory : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        for (Size i = 0; i < 5; ++i)
+        {
+            VectorXd coordinates(6);
+            coordinates << 7000000.0 + i, 1.0 * i, 2.0 * i, 0.0, 7546.0 + i, 3.0 * i;
+
+            this->states_.add({
+                Instant::J2000() + Duration::Seconds(10.0 * i),
+                coordinates,
+                Frame::GCRF(),
+                this->coordinateBrokerSPtr_,
+            });
+        }
+    }
+
+    const Shared<const CoordinateBroker> coordinateBrokerSPtr_ = std::make_shared<CoordinateBroker>(
+        CoordinateBroker({CartesianPosition::Default(), CartesianVelocity::Default()})
+    );
+
+    Array<State> states_ = Array<State>::Empty();
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateHistory, Constructor)
+{
+    {
+        const StateHistory stateHistory = {};
+
+        EXPECT_TRUE(stateHistory.isEmpty());
+        EXPECT_EQ(0, stateHistory.getSize());
+        EXPECT_TRUE(stateHistory.getStates().isEmpty());
+
+        EXPECT_THROW(stateHistory.accessFrame(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(stateHistory.accessCoordinateBroker(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(stateHistory.getStateAt(0), ostk::core::error::runtime::Wrong);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateHistory, Add)
+{
+    {
+        StateHistory stateHistory = {};
+        stateHistory.reserve(this->states_.getSize());
+
+        for (const State& state : this->states_)
+        {
+            stateHistory.add(state);
+        }
+
+        ASSERT_EQ(this->states_.getSize(), stateHistory.getSize());
+
+        EXPECT_EQ(Frame::GCRF(), stateHistory.accessFrame());
+        EXPECT_EQ(this->coordinateBrokerSPtr_, stateHistory.accessCoordinateBroker());
+
+        for (Index i = 0; i < this->states_.getSize(); ++i)
+        {
+            EXPECT_EQ(this->states_[i].accessInstant(), stateHistory.accessInstantAt(i));
+            EXPECT_EQ(this->states_[i], stateHistory.getStateAt(i));
+        }
+
+        EXPECT_EQ(this->states_, stateHistory.getStates());
+        EXPECT_THROW(stateHistory.getStateAt(this->states_.getSize()), ostk::core::error::runtime::Wrong);
+
+        stateHistory.clear();
+
+        EXPECT_TRUE(stateHistory.isEmpty());
+    }
+
+    {
+        StateHistory stateHistory = {};
+        stateHistory.add(this->states_[0]);
+
+        EXPECT_THROW(stateHistory.add(State::Undefined()), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(stateHistory.add(this->states_[1].inFrame(Frame::ITRF())), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(
+            stateHistory.add(State(
+                Instant::J2000(),
+                VectorXd::Zero(3),
+                Frame::GCRF(),
+                std::make_shared<CoordinateBroker>(CoordinateBroker({CartesianPosition::Default()}))
+            )),
+            ostk::core::error::runtime::Wrong
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateHistory, Add_StateHistory)
+{
+    StateHistory firstStateHistory = {};
+    StateHistory secondStateHistory = {};
+
+    for (Index i = 0; i < this->states_.getSize(); ++i)
+    {
+        (i < 3 ? firstStateHistory : secondStateHistory).add(this->states_[i]);
+    }
+
+    {
+        StateHistory stateHistory = {};
+
+        stateHistory.add(firstStateHistory);
+        stateHistory.add(secondStateHistory);
+
+        EXPECT_EQ(this->states_, stateHistory.getStates());
+    }
+
+    {
+        StateHistory stateHistory = firstStateHistory;
+
+        stateHistory.add(secondStateHistory, 1);
+
+        ASSERT_EQ(this->states_.getSize() - 1, stateHistory.getSize());
+        EXPECT_EQ(this->states_[2], stateHistory.getStateAt(2));
+        EXPECT_EQ(this->states_[4], stateHistory.getStateAt(3));
+
+        stateHistory.add(secondStateHistory, secondStateHistory.getSize());
+
+        EXPECT_EQ(this->states_.getSize() - 1, stateHistory.getSize());
+    }
+}
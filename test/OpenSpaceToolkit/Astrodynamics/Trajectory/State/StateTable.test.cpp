@@ -0,0 +1,207 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/Model/Tabulated.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateBroker.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianPosition.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/CoordinateSubset/CartesianVelocity.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/StateTable.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::mathematics::curvefitting::Interpolator;
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::VectorXd;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+
+using ostk::astrodynamics::trajectory::model::Tabulated;
+using ostk::astrodynamics::trajectory::State;
+using ostk::astrodynamics::trajectory::state::CoordinateBroker;
+using ostk::astrodynamics::trajectory::state::CoordinateSubset;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianPosition;
+using ostk::astrodynamics::trajectory::state::coordinatesubset::CartesianVelocity;
+using ostk::astrodynamics::trajectory::state::StateTable;
+
+class OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateTable : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        for (Size i = 0; i < 5; ++i)
+        {
+            VectorXd coordinates(7);
+            coordinates << 7000000.0 + i, 1.0 * i, 2.0 * i, 0.0, 7546.0 + i, 3.0 * i, 100.0 - i;
+
+            this->states_.add({
+                Instant::J2000() + Duration::Seconds(10.0 * i),
+                coordinates,
+                Frame::GCRF(),
+                this->coordinateBrokerSPtr_,
+            });
+        }
+    }
+
+    const Shared<const CoordinateBroker> coordinateBrokerSPtr_ = std::make_shared<CoordinateBroker>(
+        CoordinateBroker({CartesianPosition::Default(), CartesianVelocity::Default(), CoordinateSubset::Mass()})
+    );
+
+    Array<State> states_ = Array<State>::Empty();
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateTable, Constructor)
+{
+    {
+        const StateTable stateTable = {
+            Instant::J2000(),
+            StateTable::OffsetVector::Zero(2),
+            MatrixXd::Zero(2, 7),
+            Frame::GCRF(),
+            coordinateBrokerSPtr_,
+        };
+
+        EXPECT_TRUE(stateTable.isDefined());
+        EXPECT_EQ(2, stateTable.getSize());
+    }
+
+    {
+        EXPECT_THROW(
+            StateTable(
+                Instant::J2000(), StateTable::OffsetVector::Zero(2), MatrixXd::Zero(3, 7), Frame::GCRF(), nullptr
+            ),
+            ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            StateTable(
+                Instant::J2000(),
+                StateTable::OffsetVector::Zero(2),
+                MatrixXd::Zero(2, 6),
+                Frame::GCRF(),
+                coordinateBrokerSPtr_
+            ),
+            ostk::core::error::runtime::Wrong
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateTable, FromStates)
+{
+    {
+        const StateTable stateTable = StateTable::FromStates(states_);
+
+        EXPECT_TRUE(stateTable.isDefined());
+        EXPECT_EQ(states_.getSize(), stateTable.getSize());
+        EXPECT_EQ(states_.accessFirst().accessInstant(), stateTable.accessEpoch());
+        EXPECT_EQ(*Frame::GCRF(), *stateTable.accessFrame());
+        EXPECT_EQ(*coordinateBrokerSPtr_, *stateTable.accessCoordinateBroker());
+
+        EXPECT_EQ(10000000000, stateTable.accessOffsets()(1));
+        EXPECT_EQ(7, stateTable.accessCoordinates().cols());
+
+        // Each coordinate is a contiguous column
+
+        EXPECT_EQ(stateTable.accessCoordinates().data() + 2 * states_.getSize(), &stateTable.accessCoordinates()(0, 2));
+
+        const Eigen::Ref<const MatrixXd> velocities = stateTable.accessCoordinatesOf(CartesianVelocity::Default());
+
+        EXPECT_EQ(3, velocities.cols());
+        EXPECT_EQ(&stateTable.accessCoordinates()(0, 3), velocities.data());
+        EXPECT_EQ(7547.0, velocities(1, 1));
+
+        EXPECT_EQ(states_, stateTable.getStates());
+        EXPECT_EQ(states_[2], stateTable.getStateAt(2));
+        EXPECT_EQ(states_[2].accessInstant(), stateTable.getInstants()[2]);
+
+        EXPECT_EQ(stateTable, StateTable::FromStates(stateTable.getStates()));
+    }
+
+    {
+        // States are converted to the frame of the first state
+
+        Array<State> states = states_;
+        states[1] = states[1].inFrame(Frame::ITRF());
+
+        const StateTable stateTable = StateTable::FromStates(states);
+
+        EXPECT_EQ(*Frame::GCRF(), *stateTable.getStateAt(1).accessFrame());
+        EXPECT_TRUE(stateTable.getStateAt(1).accessCoordinates().isApprox(states_[1].accessCoordinates(), 1e-12));
+    }
+
+    {
+        EXPECT_FALSE(StateTable::FromStates({}).isDefined());
+
+        Array<State> states = states_;
+        states.add(State::Undefined());
+
+        EXPECT_THROW(StateTable::FromStates(states), ostk::core::error::runtime::Undefined);
+
+        states[states.getSize() - 1] = {
+            Instant::J2000(),
+            states_[0].getPosition(),
+            states_[0].getVelocity(),
+        };
+
+        EXPECT_THROW(StateTable::FromStates(states), ostk::core::error::RuntimeError);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateTable, CalculateStateTableAt)
+{
+    {
+        const Tabulated tabulated = {states_, Interpolator::Type::Linear};
+
+        const Array<Instant> instants = {
+            Instant::J2000() + Duration::Seconds(5.0),
+            Instant::J2000() + Duration::Seconds(15.0),
+            Instant::J2000() + Duration::Seconds(40.0),
+        };
+
+        const StateTable stateTable = tabulated.calculateStateTableAt(instants);
+
+        EXPECT_EQ(instants, stateTable.getInstants());
+        EXPECT_EQ(*coordinateBrokerSPtr_, *stateTable.accessCoordinateBroker());
+
+        const Array<State> states = tabulated.calculateStatesAt(instants);
+
+        for (Index i = 0; i < instants.getSize(); ++i)
+        {
+            EXPECT_TRUE(stateTable.getStateAt(i).accessCoordinates().isApprox(states[i].accessCoordinates(), 1e-12));
+        }
+
+        EXPECT_FALSE(tabulated.calculateStateTableAt({}).isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_StateTable, Undefined)
+{
+    {
+        const StateTable stateTable = StateTable::Undefined();
+
+        EXPECT_FALSE(stateTable.isDefined());
+        EXPECT_EQ(0, stateTable.getSize());
+        EXPECT_FALSE(stateTable == stateTable);
+
+        EXPECT_THROW(stateTable.accessEpoch(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(stateTable.accessFrame(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(stateTable.getStateAt(0), ostk::core::error::runtime::Undefined);
+    }
+}
@@ -0,0 +1,155 @@
+/// Apache License 2.0
+
+#include <thread>
+#include <vector>
+
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/TransformCache.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Transform;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+
+using ostk::astrodynamics::trajectory::state::TransformCache;
+
+class OpenSpaceToolkit_Astrodynamics_Trajectory_State_TransformCache : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        TransformCache::Clear();
+    }
+
+    void TearDown() override
+    {
+        TransformCache::SetCapacity(TransformCache::DefaultCapacity);
+        TransformCache::Clear();
+    }
+
+    const Shared<const Frame> gcrfSPtr_ = Frame::GCRF();
+    const Shared<const Frame> itrfSPtr_ = Frame::ITRF();
+    const Instant instant_ = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_TransformCache, Get)
+{
+    {
+        const Vector3d position = {7000000.0, 0.0, 0.0};
+
+        const Transform referenceTransform = gcrfSPtr_->getTransformTo(itrfSPtr_, instant_);
+
+        EXPECT_EQ(0, TransformCache::GetSize());
+
+        const Transform transform = TransformCache::Get(gcrfSPtr_, itrfSPtr_, instant_);
+
+        EXPECT_EQ(1, TransformCache::GetSize());
+        EXPECT_TRUE(
+            (transform.applyToPosition(position) - referenceTransform.applyToPosition(position)).norm() < 1e-9
+        );
+
+        // Cached transforms are reused
+
+        TransformCache::Get(gcrfSPtr_, itrfSPtr_, instant_);
+
+        EXPECT_EQ(1, TransformCache::GetSize());
+
+        TransformCache::Get(itrfSPtr_, gcrfSPtr_, instant_);
+        TransformCache::Get(gcrfSPtr_, itrfSPtr_, instant_ + Duration::Seconds(1.0));
+
+        EXPECT_EQ(3, TransformCache::GetSize());
+    }
+
+    {
+        EXPECT_ANY_THROW(TransformCache::Get(nullptr, itrfSPtr_, instant_));
+        EXPECT_ANY_THROW(TransformCache::Get(gcrfSPtr_, itrfSPtr_, Instant::Undefined()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_TransformCache, SetCapacity)
+{
+    EXPECT_EQ(TransformCache::DefaultCapacity, TransformCache::GetCapacity());
+
+    for (Size i = 0; i < 5; ++i)
+    {
+        TransformCache::Get(gcrfSPtr_, itrfSPtr_, instant_ + Duration::Seconds(1.0 * i));
+    }
+
+    EXPECT_EQ(5, TransformCache::GetSize());
+
+    TransformCache::SetCapacity(2);
+
+    EXPECT_EQ(2, TransformCache::GetCapacity());
+    EXPECT_EQ(2, TransformCache::GetSize());
+
+    TransformCache::Get(gcrfSPtr_, itrfSPtr_, instant_);
+
+    EXPECT_EQ(2, TransformCache::GetSize());
+
+    TransformCache::SetCapacity(0);
+
+    EXPECT_EQ(0, TransformCache::GetSize());
+
+    TransformCache::Get(gcrfSPtr_, itrfSPtr_, instant_);
+
+    EXPECT_EQ(0, TransformCache::GetSize());
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_TransformCache, GetGeneration)
+{
+    const Size generation = TransformCache::GetGeneration();
+
+    TransformCache::Get(gcrfSPtr_, itrfSPtr_, instant_);
+
+    EXPECT_EQ(generation, TransformCache::GetGeneration());
+
+    TransformCache::Clear();
+
+    EXPECT_EQ(generation + 1, TransformCache::GetGeneration());
+    EXPECT_EQ(0, TransformCache::GetSize());
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_TransformCache, ConcurrentGet)
+{
+    const Size threadCount = 4;
+    const Size instantCount = 20;
+
+    std::vector<std::thread> threads;
+
+    for (Size threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+    {
+        threads.emplace_back(
+            [this]() -> void
+            {
+                for (Size i = 0; i < instantCount; ++i)
+                {
+                    TransformCache::Get(gcrfSPtr_, itrfSPtr_, instant_ + Duration::Seconds(1.0 * i));
+                }
+            }
+        );
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(instantCount, TransformCache::GetSize());
+}
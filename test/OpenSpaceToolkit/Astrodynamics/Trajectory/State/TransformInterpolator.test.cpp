@@ -0,0 +1,141 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/TransformInterpolator.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Transform;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::time::Scale;
+
+using ostk::astrodynamics::trajectory::state::TransformInterpolator;
+
+class OpenSpaceToolkit_Astrodynamics_Trajectory_State_TransformInterpolator : public ::testing::Test
+{
+   protected:
+    const Shared<const Frame> gcrfSPtr_ = Frame::GCRF();
+    const Shared<const Frame> itrfSPtr_ = Frame::ITRF();
+    const Instant startInstant_ = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+    const Interval interval_ = Interval::Closed(startInstant_, startInstant_ + Duration::Days(1.0));
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_TransformInterpolator, Constructor)
+{
+    {
+        const TransformInterpolator interpolator = {gcrfSPtr_, itrfSPtr_, interval_};
+
+        EXPECT_EQ(interval_, interpolator.getInterval());
+        EXPECT_EQ(Duration::Minutes(5.0), interpolator.getStep());
+        EXPECT_EQ(289, interpolator.getNodeCount());
+    }
+
+    {
+        const TransformInterpolator interpolator = {
+            gcrfSPtr_, itrfSPtr_, Interval::Closed(startInstant_, startInstant_ + Duration::Minutes(7.0))
+        };
+
+        EXPECT_EQ(3, interpolator.getNodeCount());
+    }
+
+    {
+        const TransformInterpolator interpolator = {
+            gcrfSPtr_, itrfSPtr_, Interval::Closed(startInstant_, startInstant_)
+        };
+
+        EXPECT_EQ(2, interpolator.getNodeCount());
+    }
+
+    {
+        EXPECT_THROW(
+            TransformInterpolator(nullptr, itrfSPtr_, interval_), ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            TransformInterpolator(gcrfSPtr_, Frame::Undefined(), interval_), ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            TransformInterpolator(gcrfSPtr_, itrfSPtr_, Interval::Undefined()), ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            TransformInterpolator(gcrfSPtr_, itrfSPtr_, interval_, Duration::Zero()), ostk::core::error::runtime::Wrong
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_State_TransformInterpolator, GetTransformAt)
+{
+    const TransformInterpolator interpolator = {gcrfSPtr_, itrfSPtr_, interval_};
+
+    // Transforms are exact at nodes
+
+    {
+        const Instant instant = startInstant_ + Duration::Minutes(15.0);
+
+        const Vector3d position = {7000000.0, 0.0, 0.0};
+
+        EXPECT_TRUE(interpolator.getTransformAt(instant).applyToPosition(position).isNear(
+            gcrfSPtr_->getTransformTo(itrfSPtr_, instant).applyToPosition(position), 1e-9
+        ));
+    }
+
+    // And accurate in between, for LEO and GEO states
+
+    {
+        const Vector3d leoPosition = {4000000.0, -3000000.0, 4500000.0};
+        const Vector3d leoVelocity = {-2000.0, 5000.0, 4500.0};
+        const Vector3d geoPosition = {42164000.0, 0.0, 0.0};
+        const Vector3d geoVelocity = {0.0, 3074.7, 0.0};
+
+        for (Size i = 0; i < 97; ++i)
+        {
+            const Instant instant = startInstant_ + Duration::Seconds(900.0 * i + 137.0);
+
+            const Transform referenceTransform = gcrfSPtr_->getTransformTo(itrfSPtr_, instant);
+            const Transform transform = interpolator.getTransformAt(instant);
+
+            EXPECT_EQ(instant, transform.getInstant());
+
+            EXPECT_TRUE(transform.applyToPosition(leoPosition).isNear(
+                referenceTransform.applyToPosition(leoPosition), 1e-4
+            ));
+            EXPECT_TRUE(transform.applyToPosition(geoPosition).isNear(
+                referenceTransform.applyToPosition(geoPosition), 1e-3
+            ));
+            EXPECT_TRUE(transform.applyToVelocity(leoPosition, leoVelocity)
+                            .isNear(referenceTransform.applyToVelocity(leoPosition, leoVelocity), 1e-6));
+            EXPECT_TRUE(transform.applyToVelocity(geoPosition, geoVelocity)
+                            .isNear(referenceTransform.applyToVelocity(geoPosition, geoVelocity), 1e-6));
+        }
+    }
+
+    {
+        EXPECT_THROW(interpolator.getTransformAt(Instant::Undefined()), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(
+            interpolator.getTransformAt(startInstant_ - Duration::Seconds(1.0)), ostk::core::error::RuntimeError
+        );
+        EXPECT_THROW(
+            interpolator.getTransformAt(interval_.accessEnd() + Duration::Seconds(1.0)), ostk::core::error::RuntimeError
+        );
+    }
+}
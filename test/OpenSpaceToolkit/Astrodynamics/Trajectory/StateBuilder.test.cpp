@@ -8,11 +8,13 @@
 
 using ostk::core::container::Array;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 
 using ostk::mathematics::object::VectorXd;
 
 using ostk::physics::coordinate::Frame;
 using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 using ostk::physics::time::Scale;
 
@@ -572,6 +574,97 @@ TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_StateBuilder, Expand)
     }
 }
 
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_StateBuilder, Reduce_Array)
+{
+    const Instant instant = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+
+    VectorXd posVelMassCoordinates(7);
+    posVelMassCoordinates << 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 100.0;
+
+    VectorXd massPosCoordinates(4);
+    massPosCoordinates << 200.0, -1.0, -2.0, -3.0;
+
+    const Array<State> states = {
+        State(instant, posVelMassCoordinates, Frame::GCRF(), posVelMassBrokerSPtr),
+        State(instant + Duration::Seconds(1.0), posVelMassCoordinates * 2.0, Frame::GCRF(), posVelMassBrokerSPtr),
+        State(instant + Duration::Seconds(2.0), massPosCoordinates, Frame::GCRF(), massPosBrokerSPtr),
+    };
+
+    {
+        const StateBuilder stateBuilder = StateBuilder(Frame::GCRF(), massPosBrokerSPtr);
+
+        const Array<State> reducedStates = stateBuilder.reduce(states);
+
+        ASSERT_EQ(states.getSize(), reducedStates.getSize());
+
+        for (Size i = 0; i < states.getSize(); ++i)
+        {
+            EXPECT_EQ(stateBuilder.reduce(states[i]), reducedStates[i]);
+            EXPECT_EQ(massPosBrokerSPtr, reducedStates[i].accessCoordinateBroker());
+        }
+
+        VectorXd expectedCoordinates(4);
+        expectedCoordinates << 200.0, 2.0, 4.0, 6.0;
+
+        EXPECT_EQ(expectedCoordinates, reducedStates[1].accessCoordinates());
+    }
+
+    {
+        const StateBuilder stateBuilder = StateBuilder(Frame::GCRF(), posVelBrokerSPtr);
+
+        EXPECT_ANY_THROW(stateBuilder.reduce(states));
+        EXPECT_TRUE(stateBuilder.reduce(Array<State>::Empty()).isEmpty());
+    }
+
+    {
+        EXPECT_ANY_THROW(StateBuilder::Undefined().reduce(states));
+        EXPECT_ANY_THROW(StateBuilder(Frame::ITRF(), massPosBrokerSPtr).reduce(states));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_StateBuilder, Expand_Array)
+{
+    const Instant instant = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+
+    VectorXd coordinates(4);
+    coordinates << 100.0, 1.0, 2.0, 3.0;
+
+    VectorXd defaultCoordinates(6);
+    defaultCoordinates << -1.0, -2.0, -3.0, -4.0, -5.0, -6.0;
+    const State defaultState = State(instant, defaultCoordinates, Frame::GCRF(), posVelBrokerSPtr);
+
+    const Array<State> states = {
+        State(instant, coordinates, Frame::GCRF(), massPosBrokerSPtr),
+        State(instant + Duration::Seconds(1.0), coordinates * 2.0, Frame::GCRF(), massPosBrokerSPtr),
+    };
+
+    {
+        const StateBuilder stateBuilder = StateBuilder(Frame::GCRF(), posVelMassBrokerSPtr);
+
+        const Array<State> expandedStates = stateBuilder.expand(states, defaultState);
+
+        ASSERT_EQ(states.getSize(), expandedStates.getSize());
+
+        for (Size i = 0; i < states.getSize(); ++i)
+        {
+            EXPECT_EQ(stateBuilder.expand(states[i], defaultState), expandedStates[i]);
+        }
+
+        VectorXd expectedCoordinates(7);
+        expectedCoordinates << 2.0, 4.0, 6.0, -4.0, -5.0, -6.0, 200.0;
+
+        EXPECT_EQ(expectedCoordinates, expandedStates[1].accessCoordinates());
+    }
+
+    {
+        const StateBuilder stateBuilder = StateBuilder(Frame::GCRF(), posVelMassBrokerSPtr);
+
+        EXPECT_ANY_THROW(stateBuilder.expand(states, State::Undefined()));
+        EXPECT_ANY_THROW(stateBuilder.expand({State::Undefined()}, defaultState));
+        EXPECT_ANY_THROW(StateBuilder(Frame::GCRF(), posVelBrokerSPtr).expand(states, defaultState));
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Astrodynamics_Trajectory_StateBuilder, Accessors)
 {
     {
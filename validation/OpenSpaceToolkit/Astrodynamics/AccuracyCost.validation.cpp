@@ -0,0 +1,217 @@
+/// Apache License 2.0
+
+#include <chrono>
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Dictionary.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/CrossValidator.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/MissionSequence.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Parser.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/NumericalSolver.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::container::Dictionary;
+using ostk::core::filesystem::File;
+using ostk::core::filesystem::Path;
+using ostk::core::type::Size;
+using ostk::core::type::String;
+
+using ostk::mathematics::object::VectorXd;
+
+using ostk::astrodynamics::trajectory::state::NumericalSolver;
+
+using ostk::astrodynamics::validation::CrossValidator;
+using ostk::astrodynamics::validation::MissionSequence;
+using ostk::astrodynamics::validation::Parser;
+using ostk::astrodynamics::validation::Quantity;
+using ostk::astrodynamics::validation::Tool;
+using ostk::astrodynamics::validation::ToolComparison;
+
+/// @brief Accuracy versus cost of solver settings over the validation scenarios
+///
+/// Each scenario is solved with each solver setting, overriding the propagator of the scenario, and the runtime and
+/// the maximum position error against each available reference tool are recorded. Settings which are not dominated
+/// (i.e. no other setting is both faster and more accurate) for a scenario and tool form its Pareto front.
+///
+/// The table is printed as CSV. This test is disabled by default, run it with:
+/// --gtest_filter=*AccuracyCost* --gtest_also_run_disabled_tests
+class OpenSpaceToolkit_Astrodynamics_Validation_AccuracyCost : public ::testing::Test
+{
+   protected:
+    struct SolverSetting
+    {
+        String name;
+        NumericalSolver numericalSolver;
+    };
+
+    struct Record
+    {
+        String scenarioName;
+        Tool tool;
+        String solverSettingName;
+        double runtime_s;
+        double maxPositionError_m;
+    };
+
+    const String pathToData = {"/app/validation/OpenSpaceToolkit/Astrodynamics/data"};
+
+    const Array<String> scenarioNames = {
+        "001-force-model-spherical-a",
+        "001-force-model-spherical-b",
+        "001-force-model-spherical-c",
+        "002-force-model-non-spherical-60x60",
+        "002-force-model-non-spherical-360x360",
+        "003-force-model-exponential-320",
+        "003-force-model-exponential-500",
+        "003-force-model-exponential-600",
+        "003-force-model-nrlmsis-470-large-area-short-duration",
+        "003-force-model-nrlmsis-470-small-area",
+        "004-force-model-moon",
+        "004-force-model-sun",
+        "004-force-model-sun-moon",
+        "005-force-model-all-perturbs",
+        "006-force-model-constant-thrust",
+        "006-force-model-constant-thrust-exponential",
+        "010-thruster-direction-crosstrack",
+        "010-thruster-direction-in-cross-radial",
+        "010-thruster-direction-intrack",
+        "010-thruster-direction-radial",
+        "011-thruster-params-drag-decrease",
+        "011-thruster-params-drag-increase",
+        "011-thruster-params-mass-decrease",
+        "011-thruster-params-mass-increase",
+        "011-thruster-params-thrust-decrease-isp-increase",
+        "011-thruster-params-thrust-increase-isp-decrease",
+        "020-sequence-multiple-2h-maneuvers",
+        "020-sequence-multiple-30m-maneuvers",
+    };
+
+    const Array<Tool> tools = {Tool::GMAT, Tool::OREKIT};
+
+    static SolverSetting AdaptiveSetting(
+        const String& aName, const NumericalSolver::StepperType& aStepperType, const double aTolerance
+    )
+    {
+        return {
+            String::Format("{} | {:g}", aName, aTolerance),
+            {NumericalSolver::LogType::NoLog, aStepperType, 30.0, aTolerance, aTolerance},
+        };
+    }
+
+    static SolverSetting FixedStepSetting(const double aTimeStep)
+    {
+        return {
+            String::Format("RK4 | {:g} s", aTimeStep),
+            NumericalSolver::FixedStepSize(NumericalSolver::StepperType::RungeKutta4, aTimeStep),
+        };
+    }
+
+    const Array<SolverSetting> solverSettings = {
+        AdaptiveSetting("Dormand-Prince 45", NumericalSolver::StepperType::RungeKuttaDopri5, 1.0e-12),
+        AdaptiveSetting("Dormand-Prince 45", NumericalSolver::StepperType::RungeKuttaDopri5, 1.0e-10),
+        AdaptiveSetting("Dormand-Prince 45", NumericalSolver::StepperType::RungeKuttaDopri5, 1.0e-8),
+        AdaptiveSetting("Cash-Karp 54", NumericalSolver::StepperType::RungeKuttaCashKarp54, 1.0e-10),
+        AdaptiveSetting("Fehlberg 78", NumericalSolver::StepperType::RungeKuttaFehlberg78, 1.0e-12),
+        AdaptiveSetting("Fehlberg 78", NumericalSolver::StepperType::RungeKuttaFehlberg78, 1.0e-10),
+        FixedStepSetting(10.0),
+        FixedStepSetting(30.0),
+        FixedStepSetting(60.0),
+    };
+
+    static bool IsDominated(const Record& aRecord, const Array<Record>& aRecordArray)
+    {
+        for (const Record& record : aRecordArray)
+        {
+            if ((record.scenarioName != aRecord.scenarioName) || (record.tool != aRecord.tool))
+            {
+                continue;
+            }
+
+            if ((record.runtime_s <= aRecord.runtime_s) && (record.maxPositionError_m <= aRecord.maxPositionError_m) &&
+                ((record.runtime_s < aRecord.runtime_s) || (record.maxPositionError_m < aRecord.maxPositionError_m)))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+};
+
+TEST_F(OpenSpaceToolkit_Astrodynamics_Validation_AccuracyCost, DISABLED_ParetoTable)
+{
+    Array<Record> records = Array<Record>::Empty();
+    records.reserve(scenarioNames.getSize() * tools.getSize() * solverSettings.getSize());
+
+    for (const String& scenarioName : scenarioNames)
+    {
+        const Dictionary dataTree = Parser::ParseYaml(String::Format("{0}/scenarios", pathToData), scenarioName);
+
+        for (const SolverSetting& solverSetting : solverSettings)
+        {
+            MissionSequence missionSequence = {dataTree, solverSetting.numericalSolver};
+
+            const auto startTime = std::chrono::steady_clock::now();
+
+            missionSequence.run();
+
+            const double runtime_s =
+                std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+            for (const Tool& tool : tools)
+            {
+                const File referenceFile = File::Path(Path::Parse(String::Format(
+                    "{0}/{1}/{2}.csv", pathToData, CrossValidator::ToolToPath(tool), scenarioName
+                )));
+
+                if (!referenceFile.exists())
+                {
+                    continue;
+                }
+
+                const ToolComparison toolComparison = {tool, {{Quantity::CARTESIAN_POSITION_GCRF, 0.0}}};
+
+                const Array<VectorXd> allDeltasWithTool =
+                    missionSequence.compareResults(Parser::ParseCSV(pathToData, scenarioName, tool), toolComparison);
+
+                const Size maxIndex = CrossValidator::FindMaxDeltaIndex(allDeltasWithTool, 0);
+
+                records.add({
+                    scenarioName,
+                    tool,
+                    solverSetting.name,
+                    runtime_s,
+                    allDeltasWithTool[maxIndex][0],
+                });
+            }
+        }
+    }
+
+    EXPECT_FALSE(records.isEmpty());
+
+    std::cout << "Scenario,Tool,Solver,Runtime [s],Max Position Error [m],Pareto" << std::endl;
+
+    for (const Record& record : records)
+    {
+        std::cout << String::Format(
+                         "{},{},{},{},{},{}",
+                         record.scenarioName,
+                         CrossValidator::ToolToString(record.tool),
+                         record.solverSettingName,
+                         record.runtime_s,
+                         record.maxPositionError_m,
+                         IsDominated(record, records) ? "" : "*"
+                     )
+                  << std::endl;
+    }
+}
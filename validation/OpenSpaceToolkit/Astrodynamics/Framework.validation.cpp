@@ -1,5 +1,14 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <future>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
@@ -145,11 +154,17 @@ using ostk::astrodynamics::validation::QuantityComparison;
 using ostk::astrodynamics::validation::Tool;
 using ostk::astrodynamics::validation::ToolComparison;
 
+static const String PATH_TO_DATA = {"/app/validation/OpenSpaceToolkit/Astrodynamics/data"};
+
+// Scenarios are independent, hence are solved concurrently by a pool of worker threads as soon as the first test case
+// runs. Each test case then waits for the solution of its own scenario, and compares it with the reference tools.
+static Shared<const MissionSequence> AccessSolvedMissionSequence(const String& aScenarioName);
+
 class OpenSpaceToolkit_Astrodynamics_Validation
     : public ::testing::TestWithParam<std::tuple<String, Array<ToolComparison>>>
 {
    protected:
-    const String pathToData = {"/app/validation/OpenSpaceToolkit/Astrodynamics/data"};
+    const String pathToData = PATH_TO_DATA;
 };
 
 TEST_P(OpenSpaceToolkit_Astrodynamics_Validation, ValidationTestRunner)
@@ -160,11 +175,9 @@ TEST_P(OpenSpaceToolkit_Astrodynamics_Validation, ValidationTestRunner)
     const String scenarioName = std::get<0>(parameters);
     const Array<ToolComparison> toolComparisons = std::get<1>(parameters);
 
-    // Instatiate mission sequence app to set up the scenario
-    MissionSequence missionSequence = {Parser::ParseYaml(String::Format("{0}/scenarios", pathToData), scenarioName)};
-
-    // Solve the scenario
-    missionSequence.run();
+    // Access the mission sequence app of the scenario, once solved
+    const Shared<const MissionSequence> missionSequenceSPtr = AccessSolvedMissionSequence(scenarioName);
+    const MissionSequence& missionSequence = *missionSequenceSPtr;
 
     // Compare with each reference tool
     for (const ToolComparison& toolComparison : toolComparisons)
@@ -706,3 +719,141 @@ static const std::vector<std::tuple<String, Array<ToolComparison>>> testCases_Se
 INSTANTIATE_TEST_SUITE_P(
     SequenceValidation, OpenSpaceToolkit_Astrodynamics_Validation, ::testing::ValuesIn(testCases_Sequence)
 );
+
+// Solve scenarios with a pool of worker threads, which claim scenarios in order from a shared counter
+
+class ScenarioRunner
+{
+   public:
+    ScenarioRunner(const Array<String>& aScenarioNameArray, const Size& aThreadCount)
+        : scenarioNames_(Array<String>::Empty()),
+          promises_(),
+          solutions_(),
+          nextScenarioIndex_(0),
+          threads_()
+    {
+        for (const String& scenarioName : aScenarioNameArray)
+        {
+            if (solutions_.find(scenarioName) == solutions_.end())
+            {
+                scenarioNames_.add(scenarioName);
+                promises_.emplace_back();
+                solutions_.emplace(scenarioName, promises_.back().get_future().share());
+            }
+        }
+
+        const Size threadCount = std::max<Size>(1, std::min<Size>(aThreadCount, scenarioNames_.getSize()));
+
+        threads_.reserve(threadCount);
+
+        for (Size threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            threads_.emplace_back(&ScenarioRunner::work, this);
+        }
+    }
+
+    ~ScenarioRunner()
+    {
+        nextScenarioIndex_ = scenarioNames_.getSize();
+
+        for (std::thread& thread : threads_)
+        {
+            thread.join();
+        }
+    }
+
+    Shared<const MissionSequence> accessSolvedMissionSequence(const String& aScenarioName) const
+    {
+        const auto solutionIt = solutions_.find(aScenarioName);
+
+        if (solutionIt == solutions_.end())
+        {
+            throw ostk::core::error::RuntimeError("Scenario [{}] is not scheduled.", aScenarioName);
+        }
+
+        return solutionIt->second.get();
+    }
+
+   private:
+    Array<String> scenarioNames_;
+    std::vector<std::promise<Shared<const MissionSequence>>> promises_;
+    std::map<String, std::shared_future<Shared<const MissionSequence>>> solutions_;
+    std::atomic<Size> nextScenarioIndex_;
+    std::vector<std::thread> threads_;
+
+    void work()
+    {
+        for (Size scenarioIndex = nextScenarioIndex_++; scenarioIndex < scenarioNames_.getSize();
+             scenarioIndex = nextScenarioIndex_++)
+        {
+            try
+            {
+                const Shared<MissionSequence> missionSequenceSPtr = std::make_shared<MissionSequence>(
+                    Parser::ParseYaml(String::Format("{0}/scenarios", PATH_TO_DATA), scenarioNames_[scenarioIndex])
+                );
+
+                missionSequenceSPtr->run();
+
+                promises_[scenarioIndex].set_value(missionSequenceSPtr);
+            }
+            catch (...)
+            {
+                promises_[scenarioIndex].set_exception(std::current_exception());
+            }
+        }
+    }
+};
+
+// Names of the scenarios of the test cases selected to run (e.g., with --gtest_filter), so that filtered out scenarios
+// are not solved. Parameterized test suites are named "<instantiation>/<fixture>", and their test cases
+// "<test>/<parameter index>".
+
+static Array<String> GetSelectedScenarioNames()
+{
+    const std::map<std::string, const std::vector<std::tuple<String, Array<ToolComparison>>>*> testCasesMap = {
+        {"ForceModelValidation", &testCases_ForceModel},
+        {"ThrusterValidation", &testCases_Thruster},
+        {"SequenceValidation", &testCases_Sequence},
+    };
+
+    Array<String> scenarioNames = Array<String>::Empty();
+
+    const ::testing::UnitTest* unitTest = ::testing::UnitTest::GetInstance();
+
+    for (int testSuiteIndex = 0; testSuiteIndex < unitTest->total_test_suite_count(); ++testSuiteIndex)
+    {
+        const ::testing::TestSuite* testSuite = unitTest->GetTestSuite(testSuiteIndex);
+
+        const std::string testSuiteName = testSuite->name();
+        const auto testCasesIt = testCasesMap.find(testSuiteName.substr(0, testSuiteName.find('/')));
+
+        if (testCasesIt == testCasesMap.end())
+        {
+            continue;
+        }
+
+        for (int testIndex = 0; testIndex < testSuite->total_test_count(); ++testIndex)
+        {
+            const ::testing::TestInfo* testInfo = testSuite->GetTestInfo(testIndex);
+
+            if (!testInfo->should_run())
+            {
+                continue;
+            }
+
+            const std::string testName = testInfo->name();
+            const Size parameterIndex = std::stoul(testName.substr(testName.rfind('/') + 1));
+
+            scenarioNames.add(std::get<0>(testCasesIt->second->at(parameterIndex)));
+        }
+    }
+
+    return scenarioNames;
+}
+
+static Shared<const MissionSequence> AccessSolvedMissionSequence(const String& aScenarioName)
+{
+    static const ScenarioRunner scenarioRunner = {GetSelectedScenarioNames(), std::thread::hardware_concurrency()};
+
+    return scenarioRunner.accessSolvedMissionSequence(aScenarioName);
+}
@@ -20,6 +20,17 @@ MissionSequence::MissionSequence(const Dictionary& aDataTree)
 {
 }
 
+MissionSequence::MissionSequence(const Dictionary& aDataTree, const NumericalSolver& aNumericalSolver)
+    : dataTree_(aDataTree),
+      satelliteSystem_(Parser::CreateSatelliteSystem(dataTree_)),
+      initialState_(Parser::CreateInitialState(dataTree_, satelliteSystem_)),
+      environment_(Parser::CreateEnvironment(dataTree_)),
+      dynamics_(Dynamics::FromEnvironment(environment_)),
+      sequence_(Parser::CreateSequence(dataTree_, satelliteSystem_, dynamics_, aNumericalSolver)),
+      solvedStates_(Array<State>::Empty())
+{
+}
+
 MissionSequence::~MissionSequence() {}
 
 void MissionSequence::run()
@@ -22,6 +22,7 @@
 #include <OpenSpaceToolkit/Astrodynamics/Parser.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/Sequence.hpp>
 #include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State/NumericalSolver.hpp>
 
 namespace ostk
 {
@@ -51,6 +52,7 @@ using ostk::astrodynamics::Dynamics;
 using ostk::astrodynamics::flight::system::SatelliteSystem;
 using ostk::astrodynamics::trajectory::Sequence;
 using ostk::astrodynamics::trajectory::State;
+using ostk::astrodynamics::trajectory::state::NumericalSolver;
 
 /// @brief Holds the OSTk objects and data required to define and run a "Mission Sequence".
 class MissionSequence
@@ -61,6 +63,12 @@ class MissionSequence
     /// @param aDataTree A dictionary containing all the data needed to define and initialize a "Mission Sequence".
     MissionSequence(const Dictionary& aDataTree);
 
+    /// @brief Constructor, with a numerical solver overriding the propagator of the data tree.
+    ///
+    /// @param aDataTree A dictionary containing all the data needed to define and initialize a "Mission Sequence".
+    /// @param aNumericalSolver A numerical solver.
+    MissionSequence(const Dictionary& aDataTree, const NumericalSolver& aNumericalSolver);
+
     /// @brief Destructor
     ~MissionSequence();
 
@@ -1,5 +1,8 @@
 /// Apache License 2.0
 
+#include <map>
+#include <mutex>
+
 #include <OpenSpaceToolkit/Astrodynamics/Parser.hpp>
 
 namespace ostk
@@ -111,7 +114,14 @@ State Parser::CreateInitialState(const Dictionary& aDictionary, const SatelliteS
 
 Environment Parser::CreateEnvironment(const Dictionary& aDictionary)
 {
+    // Environments are cached by model, as loading the gravitational model coefficients (e.g., 360x360) dominates the
+    // set up of a scenario. Environments are only read during propagation, hence can be shared between scenarios.
+
+    static std::mutex environmentCacheMutex;
+    static std::map<String, Environment> environmentCache;
+
     Array<Shared<Object>> celestials = Array<Shared<Object>>::Empty();
+    String thirdBodiesKey = "";
 
     EarthGravitationalModel::Type earthGravitationalModelType = EarthGravitationalModel::Type::Undefined;
     Integer earthGravitationalModelDegree = 0;
@@ -139,10 +149,12 @@ Environment Parser::CreateEnvironment(const Dictionary& aDictionary)
             else if (force["data"]["body"].accessString() == "SUN")
             {
                 celestials.add(std::make_shared<Sun>(Sun::Default()));
+                thirdBodiesKey += "SUN;";
             }
             else if (force["data"]["body"].accessString() == "MOON")
             {
                 celestials.add(std::make_shared<Moon>(Moon::Default()));
+                thirdBodiesKey += "MOON;";
             }
             else
             {
@@ -177,6 +189,26 @@ Environment Parser::CreateEnvironment(const Dictionary& aDictionary)
         }
     }
 
+    const String environmentKey = String::Format(
+        "{}|{}|{}|{}|{}",
+        static_cast<int>(earthGravitationalModelType),
+        earthGravitationalModelDegree.toString(),
+        earthGravitationalModelOrder.toString(),
+        static_cast<int>(earthAtmosphericModelType),
+        thirdBodiesKey
+    );
+
+    {
+        const std::lock_guard<std::mutex> lock(environmentCacheMutex);
+
+        const auto environmentIt = environmentCache.find(environmentKey);
+
+        if (environmentIt != environmentCache.end())
+        {
+            return environmentIt->second;
+        }
+    }
+
     celestials.add(std::make_shared<Earth>(Earth::FromModels(
         std::make_shared<EarthGravitationalModel>(
             earthGravitationalModelType,
@@ -188,50 +220,68 @@ Environment Parser::CreateEnvironment(const Dictionary& aDictionary)
         std::make_shared<EarthAtmosphericModel>(earthAtmosphericModelType)
     )));
 
-    return Environment(Instant::J2000(), celestials);
+    const Environment environment = {Instant::J2000(), celestials};
+
+    // The environment is created outside of the lock, so that scenarios with different models are set up concurrently
+
+    const std::lock_guard<std::mutex> lock(environmentCacheMutex);
+
+    return environmentCache.emplace(environmentKey, environment).first->second;
 }
 
-Sequence Parser::CreateSequence(
-    const Dictionary& aDictionary,
-    const SatelliteSystem& aSatelliteSystem,
-    const Array<Shared<Dynamics>>& aDynamicsArray
-)
+NumericalSolver Parser::CreateNumericalSolver(const Dictionary& aDictionary)
 {
-    // Create numerical solver
-    NumericalSolver numericalSolver = NumericalSolver::Undefined();
     if (aDictionary["data"]["sequence"]["propagator"]["type"].accessString() == "RUNGE_KUTTA_DORMAND_PRINCE_45")
     {
-        numericalSolver = NumericalSolver(
+        return {
             NumericalSolver::LogType::NoLog,
             NumericalSolver::StepperType::RungeKuttaDopri5,
             aDictionary["data"]["sequence"]["propagator"]["data"]["initial-step"].accessReal(),
             aDictionary["data"]["sequence"]["propagator"]["data"]["relative-tolerance"].accessReal(),
-            aDictionary["data"]["sequence"]["propagator"]["data"]["absolute-tolerance"].accessReal()
-        );
+            aDictionary["data"]["sequence"]["propagator"]["data"]["absolute-tolerance"].accessReal(),
+        };
     }
-    else if (aDictionary["data"]["sequence"]["propagator"]["type"].accessString() == "RUNGE_KUTTA_4")
+
+    if (aDictionary["data"]["sequence"]["propagator"]["type"].accessString() == "RUNGE_KUTTA_4")
     {
-        numericalSolver = NumericalSolver::FixedStepSize(
+        return NumericalSolver::FixedStepSize(
             NumericalSolver::StepperType::RungeKutta4,
             aDictionary["data"]["sequence"]["propagator"]["data"]["step"].accessReal()
         );
     }
-    else
-    {
-        throw ostk::core::error::runtime::Wrong("Propagator type");
-    }
 
+    throw ostk::core::error::runtime::Wrong("Propagator type");
+}
+
+Sequence Parser::CreateSequence(
+    const Dictionary& aDictionary,
+    const SatelliteSystem& aSatelliteSystem,
+    const Array<Shared<Dynamics>>& aDynamicsArray
+)
+{
+    return Parser::CreateSequence(
+        aDictionary, aSatelliteSystem, aDynamicsArray, Parser::CreateNumericalSolver(aDictionary)
+    );
+}
+
+Sequence Parser::CreateSequence(
+    const Dictionary& aDictionary,
+    const SatelliteSystem& aSatelliteSystem,
+    const Array<Shared<Dynamics>>& aDynamicsArray,
+    const NumericalSolver& aNumericalSolver
+)
+{
     Array<Segment> segments = Array<Segment>::Empty();
     for (const auto& segment : aDictionary["data"]["sequence"]["segments"].accessArray())
     {
         segments.add(
-            Parser::CreateSegment(segment.accessDictionary(), aSatelliteSystem, aDynamicsArray, numericalSolver)
+            Parser::CreateSegment(segment.accessDictionary(), aSatelliteSystem, aDynamicsArray, aNumericalSolver)
         );
     }
 
     return {
         segments,
-        numericalSolver,
+        aNumericalSolver,
         Array<Shared<Dynamics>>::Empty(),
         Duration::Seconds(aDictionary["data"]["sequence"]["max-duration"].accessReal()),
         0,
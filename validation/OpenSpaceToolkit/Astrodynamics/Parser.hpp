@@ -172,10 +172,19 @@ class Parser
 
     /// @brief Create an environment from a dictionary.
     ///
+    /// Environments are cached by model: dictionaries defining the same forces share the same celestial objects. This
+    /// method is thread-safe.
+    ///
     /// @param aDictionary A dictionary.
     /// @return An environment.
     static Environment CreateEnvironment(const Dictionary& aDictionary);
 
+    /// @brief Create the numerical solver of the sequence from a dictionary.
+    ///
+    /// @param aDictionary A dictionary.
+    /// @return A numerical solver.
+    static NumericalSolver CreateNumericalSolver(const Dictionary& aDictionary);
+
     /// @brief Create a segment from a dictionary and other OSTk objects.
     ///
     /// @param aDictionary A dictionary.
@@ -188,6 +197,22 @@ class Parser
         const Array<Shared<Dynamics>>& aDynamicsArray
     );
 
+    /// @brief Create a sequence from a dictionary and other OSTk objects, with a given numerical solver.
+    ///
+    /// The propagator defined in the dictionary is ignored.
+    ///
+    /// @param aDictionary A dictionary.
+    /// @param aSatelliteSystem A satellite system.
+    /// @param aDynamicsArray An array of shared dynamics.
+    /// @param aNumericalSolver A numerical solver.
+    /// return A sequence.
+    static Sequence CreateSequence(
+        const Dictionary& aDictionary,
+        const SatelliteSystem& aSatelliteSystem,
+        const Array<Shared<Dynamics>>& aDynamicsArray,
+        const NumericalSolver& aNumericalSolver
+    );
+
     /// @brief Create an array of evenly spaced instants at which to compare the output of two tools.
     ///
     /// @param aDictionary A dictionary.